@@ -12,3 +12,4 @@ struct buf {
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_DATA  0x8  // buffer holds file data (not journaled in ordered mode)
@@ -6,13 +6,20 @@ struct buf;
 struct context;
 struct extent;
 struct inode;
+struct iovec;
+struct pollfd;
 struct proc;
+struct rmap;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
+struct rwsleeplock;
+struct slab_cache;
 struct stat;
 struct superblock;
 struct mem_region;
+struct vma;
+struct waitqueue;
 
 extern int npages;
 extern int pages_in_use;
@@ -29,6 +36,7 @@ extern int crashn;
 
 // bio.c
 void            binit(void);
+struct buf*     bget(uint, uint);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
@@ -62,13 +70,17 @@ void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 void            init_inodefile(int dev);
 struct inode*   iget(uint dev, uint inum);
-void            setBitmapWithDinode(struct dinode *dinode);
+int             allocExtent(struct extent *extent, uint nblocks);
+uint            bmap(struct inode*, uint);
+uint            ialloc(uint dev, short type);
 void            log_start_tx();
 void            log_end_tx();
 void            log_recover();
 int             is_trx();
+int             is_ordered_log();
+int             is_swap_block(uint blockno);
 int             getBlocksInLog();
-void            addNewWriteLocationToLog(uint blockno);
+uint            addNewWriteLocationToLog(uint blockno);
 struct logHeader*   getLogHeader();
 int             getLogStart();
 void            write_log_to_disk(struct logHeader *header);
@@ -81,10 +93,24 @@ int             readFile(struct file *file, char *buffer, int numBytes);
 int             writeFile(struct file *file, char *buffer, int numBytes);
 int             closeFile(struct file *file);
 int             dupFile(struct file *file);
+void            fdinit(struct proc *p);
+int             fdalloc(struct file *file);
+struct file*    fdget(int fd);
+void            fdfree(int fd);
+int             fdcopy(struct proc *p, struct proc *child);
+void            fdcloseall(struct proc *p);
 struct pipe *   openPipe(struct file *f1, struct file *f2);
-int             readPipe(struct pipe *pipe, char *buffer, int numBytes);
-int             writePipe(struct pipe *pipe, char *buffer, int numBytes);
+int             readPipe(struct pipe *pipe, char *buffer, int numBytes, int nonblock);
+int             writePipe(struct pipe *pipe, char *buffer, int numBytes, int nonblock);
 int             closePipe(struct pipe *pipe);
+int             sendFile(struct file *out, struct file *in, int off, int numBytes);
+int             spliceFile(struct file *in, struct file *out, int numBytes);
+int             preadFile(struct file *file, char *buffer, int numBytes, uint off);
+int             pwriteFile(struct file *file, char *buffer, int numBytes, uint off);
+int             readvFile(struct file *file, struct iovec *iov, int iovcnt);
+int             writevFile(struct file *file, struct iovec *iov, int iovcnt);
+int             pollFile(struct file *file, int events);
+struct waitqueue* fileWaitQueue(struct file *file);
 int             fstat(struct file *file, struct stat *st);
 int             mmap(int fd);
 int             munmap(int fd);
@@ -94,6 +120,8 @@ int             munmap(int fd);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderw_async(struct buf*);
+void            iderw_wait(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -102,19 +130,28 @@ void            ioapicinit(void);
 
 // kalloc.c
 struct core_map_entry*	pa2page(uint64_t pa);
+uint64_t        page2pa(struct core_map_entry*);
 void			      detect_memory(void);
 char*           kalloc(void);
 void            kfree(char*);
+char*           kalloc_zeroed(void);
+void            kzero_idle(void);
+void            kswapdinit(void);
+char*           kalloc_pages(int);
+void            kfree_pages(char*, int);
 void            mem_init(void*);
-void            add_phy_mem_map(int, uint64_t, uint64_t);
-void   	        remove_phy_mem_map(int, uint64_t, uint64_t);
+int             add_phy_mem_map(pml4e_t*, int, uint64_t, uint64_t);
+void   	        remove_phy_mem_map(pml4e_t*, int, uint64_t, uint64_t);
 void            inrementPageRefCount(uint64_t pa);
 void            decrementPageRefCount(uint64_t pa);
 int             evictPage();
 int             getFreeDiskPageIndex();
 struct core_map_entry*  findPageToEvict();
 int             swapPageIn(uint64_t vAddr, pte_t *pte);
-void            decrementSwapCoreMapEntryRefCount(uint64_t index);
+int             sharePTE(pte_t*, pml4e_t*, uint64_t, pte_t*, int);
+int             copyOnWrite(pml4e_t*, int, uint64_t, pte_t*);
+void            unmapUserPage(pml4e_t*, uint64_t va, pte_t*);
+void            releaseSwapCache(uint64_t pa);
 
 
 
@@ -131,14 +168,39 @@ void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
 
+// mmap.c
+struct vma*     vma_find(struct proc*, uint64_t);
+int             vma_check(struct proc*, uint64_t, uint64_t);
+int             vma_maps_inode(struct proc*, uint64_t, uint64_t, struct inode*);
+uint64_t        vma_map(struct proc*, uint64_t, uint64_t, int, int, struct inode*, uint);
+int             vma_fault(struct proc*, uint64_t, int);
+int             vma_unmap(struct proc*, uint64_t, uint64_t);
+int             vma_msync(struct proc*, uint64_t, uint64_t);
+void            vma_unmap_all(struct proc*);
+int             vma_fork(struct proc*, struct proc*, pml4e_t*);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pcache.c
+void            pcache_init(void);
+char*           pcache_get(struct inode*, uint);
+void            pcache_put(char*);
+void            pcache_update(struct inode*, uint, char*, uint);
+void            pcache_drop(struct inode*);
+int             pcache_reclaim(void);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
+// poll.c
+void            pollinit(void);
+void            pollwakeup(struct waitqueue*);
+void            polltick(void);
+int             pollfds(struct pollfd*, int, int);
+
 
 //PAGEBREAK: 16
 // proc.c
@@ -157,6 +219,7 @@ int             wait(void);
 void            wakeup(void*);
 void            yield(void);
 struct proc*    getProcessAtIndex(int index);
+struct proc*    kthread(char*, void (*)(void));
 void            reboot(void);
 
 
@@ -172,11 +235,34 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// rmap.c
+void            rmap_init(void);
+struct rmap*    rmap_alloc(void);
+void            rmap_free(struct rmap*);
+void            rmap_link(struct rmap**, struct rmap*, pml4e_t*, uint64_t);
+int             rmap_add(struct rmap**, pml4e_t*, uint64_t);
+void            rmap_remove(struct rmap**, pml4e_t*, uint64_t);
+void            rmap_move(struct rmap**, struct rmap**);
+int             rmap_relink(struct rmap**, struct rmap**, pml4e_t*, uint64_t);
+void            rmap_clear(struct rmap**);
+void            rmap_walk(struct rmap**, void (*)(pml4e_t*, pte_t*, void*), void*);
+
+// slab.c
+void            slab_init(struct slab_cache*, char*, uint);
+void*           slab_alloc(struct slab_cache*);
+void            slab_free(struct slab_cache*, void*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
+void            acquiresleepread(struct rwsleeplock*);
+void            releasesleepread(struct rwsleeplock*);
+void            acquiresleepwrite(struct rwsleeplock*);
+void            releasesleepwrite(struct rwsleeplock*);
+int             holdingsleepwrite(struct rwsleeplock*);
+void            initrwsleeplock(struct rwsleeplock*, char*);
 
 // string.c
 int             memcmp(const void*, const void*, uint);
@@ -195,6 +281,7 @@ int             argstr(int, char**);
 int             fetchint(uint64_t, int*);
 int             fetchint64(uint64_t, int64_t*);
 int             fetchstr(uint64_t, char**);
+int             fetchptr(uint64_t, char**, int);
 void            syscall(void);
 
 
@@ -228,6 +315,12 @@ void            initustack(pml4e_t *, struct mem_region*, int);
 int             mappages(pml4e_t *pml4, uint64_t virt_pn, int num_page, uint64_t
 	                phy_pn, int perm, int pid);
 
+// zswap.c
+void            zswap_init(void);
+int             zswap_store(char*, int*);
+void            zswap_load(int, int, char*);
+void            zswap_free(int, int);
+
 
 
 // number of elements in fixed-size array
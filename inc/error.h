@@ -9,6 +9,7 @@ enum {
 	E_NO_FREE_ENV	,	// Attempt to create a new environment beyond
 				// the maximum allowed
 	E_FAULT		,	// Memory fault
+	E_AGAIN		,	// Operation would block on a non-blocking file
 
 	MAXERROR
 };
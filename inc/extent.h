@@ -5,3 +5,5 @@ struct extent {
   uint startblkno;  // start block number
   uint nblocks;     // n blocks following the start block
 };
+
+#define EXTENTBLKS 20  // blocks in the extent given to a file
@@ -2,6 +2,7 @@
 
 #include <sleeplock.h>
 #include <extent.h>
+#include <fs.h>
 
 
 // in-memory copy of an inode
@@ -9,7 +10,7 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  struct sleeplock lock;
+  struct rwsleeplock lock;  // shared by readers, exclusive for writes and metadata
   int flags;          // I_VALID
 
   short type;         // copy of disk inode
@@ -18,15 +19,29 @@ struct inode {
   short nlink;
   uint size;
   struct extent data;
-
+  short dflags;       // DI_INLINE
+  int npages;         // pages of the file in the page cache
+  uint pgen;          // bumped by every write, see pcache_get
+  struct inode *next; // inode cache list
+  union {
+    char inlinedata[DINLINESZ];
+    struct extent extents[NEXTENTS];
+  };
 };
 #define I_VALID 0x2
 
+// processes polling an object, see poll.c
+struct waitqueue {
+  struct pollentry *head;
+};
+
 // table mapping major device number to
 // device functions
 struct devsw {
   int (*read)(struct inode*, char*, int);
   int (*write)(struct inode*, char*, int);
+  int (*poll)(struct inode*);   // POLLIN/POLLOUT ready now, 0 if not pollable
+  struct waitqueue *pollq;      // woken when the device may have become ready
 };
 
 extern struct devsw devsw[];
@@ -36,7 +51,8 @@ extern struct devsw devsw[];
 #define FTYPE_INODE  1   // inode
 #define FTYPE_PIPE 2     // pipe
 
-#define PIPE_SIZE 2048    // max number of bytes for pipe buffer
+#define PIPE_MINBUFS 1    // pages of data a new pipe holds
+#define PIPE_MAXBUFS 16   // pages of data a pipe can grow to hold
 
 // file struct
 struct file {
@@ -46,15 +62,31 @@ struct file {
   struct inode *inode; // underlying inode
   struct pipe *pipe;   // underlying pipe
   int permissions;     // read or write permissions for file
+  int flags;           // O_NONBLOCK
   int refCount;        // number of references to this file
 };
 
-// pipe struct
+// a page of data in a pipe
+struct pipe_buf {
+  char *page;             // page holding the data
+  uint off;               // offset of the first unread byte in page
+  uint len;               // number of unread bytes
+  int flags;              // PIPE_BUF_SHARED
+};
+#define PIPE_BUF_SHARED 0x1  // page is not the pipe's own, e.g. a page cache page
+
+// pipe struct, the data is a ring of pages read from tail to head
 struct pipe {
   struct spinlock lock;
-  int readOffset;         // bytes read
-  int writeOffset;        // bytes written
-  char buffer[PIPE_SIZE]; // pipe buffer
+  struct sleeplock rlock; // one reader copies out at a time
+  struct sleeplock wlock; // one writer copies in at a time
+  struct pipe_buf bufs[PIPE_MAXBUFS];
+  uint head;              // pages written, next one is bufs[head % PIPE_MAXBUFS]
+  uint tail;              // pages read, next one is bufs[tail % PIPE_MAXBUFS]
+  uint maxbufs;           // pages the pipe may hold now
+  char *spare;            // drained page kept for the next write
+  int filling;            // a writer is copying into the last page
+  struct waitqueue pollq; // processes polling either end
   int readClosed;         // if 1 read side is closed
   int writeClosed;        // if 1 write side is closed
   int referenceCount;     // number of references to pipe
@@ -8,6 +8,9 @@
 #define INODEFILEINO   0  // inode file inum
 #define ROOTINO        1  // root i-number
 #define BSIZE        512  // block size
+#define DINLINESZ     40  // max size of a file stored in its dinode
+#define NEXTENTS      (DINLINESZ / sizeof(struct extent)) // extents added as a file grows
+#define MAXINODES  65536  // inums must fit in dirent.inum
 
 
 // Disk layout:
@@ -25,8 +28,14 @@ struct superblock {
   uint swapsize;     // Size of swap space in block
   uint logstart;     // start of the log space
   uint logsize;      // size of the log region
+  uint logmode;      // LOG_FULL or LOG_ORDERED
 };
 
+// Journaling modes, chosen at mkfs time.
+#define LOG_FULL     0  // journal both file data and metadata
+#define LOG_ORDERED  1  // journal metadata only, file data is written
+                        // in place before the commit record
+
 // On-disk inode structure
 struct dinode {
   short type;           // File type
@@ -35,12 +44,20 @@ struct dinode {
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
   struct extent data;   // Data blocks of file on disk
-  char pad[44];         // So disk inodes fit contiguosly in a block
+  short flags;          // DI_INLINE
+  char pad[2];          // So disk inodes fit contiguosly in a block
+  union {
+    char inlinedata[DINLINESZ];       // Contents of a small file (DI_INLINE only)
+    struct extent extents[NEXTENTS];  // Blocks past data, in file order
+  };
 };
 
+#define DI_INLINE  0x1  // file contents live in inlinedata, not in data
+
 struct logHeader {
   int valid;
   uint nblocks;
+  uint checksum;          // crc32 over writeLocation and the logged blocks
   uint writeLocation[30];
 };
 
@@ -0,0 +1,13 @@
+#pragma once
+
+// Protection and flags for mmap2.
+// Both the kernel and user programs use this header file.
+
+#define PROT_READ     0x1  // pages can be read
+#define PROT_WRITE    0x2  // pages can be written
+
+#define MAP_SHARED    0x01  // changes are shared and written back to the file
+#define MAP_PRIVATE   0x02  // changes are private to the process
+#define MAP_ANONYMOUS 0x20  // zeroed memory not backed by a file, fd is ignored
+
+#define MAP_FAILED    ((void *) -1)
@@ -55,6 +55,7 @@
 #define PTE_PS		BIT64(7)	/* page size */
 #define PTE_G		BIT64(8)	/* global */
 #define PTE_DSK     BIT64(9)    /* page on disk */
+#define PTE_ZSW     BIT64(10)   /* page of PTE_DSK in the compressed pool */
 #define PTE_AVL		BITMASK64(11, 9)
 #define PTE_RO   BIT64(11) /* read-only page, used to implement copy-on-write fork */
 
@@ -155,14 +156,31 @@ struct core_map_entry {
 	int pid;       // -1 means it is used by kernel only
 	uint64_t va;   // if it is used by kernel only, this field is 0
 	int refCount;  // keeps track of the number of processes mapped to the page
-    struct core_map_entry *next;
+    struct core_map_entry *next;  // free list, or page cache hash chain
+    struct inode *inode;  // file whose data the page caches, 0 if none
+    uint pgoff;           // page offset within that file
+    struct core_map_entry *prev;  // buddy free list
+    int order;            // free block the page heads has 2^order pages
+    int flags;
+    struct rmap *rmap;    // PTEs mapping the page, see rmap.c
+    struct swap_map_entry *swap;  // slot still holding a copy of the page
 };
 
+// core_map_entry flags
+#define CM_BUDDY  0x1   // heads a free block on a buddy free list
+
 struct swap_map_entry {
 	int pid;
 	uint64_t va;
 	int refCount;
 	int in_use;
+    struct rmap *rmap;    // PTEs of the swapped out page
+    int zswapped;         // contents are in the compressed pool
+    int zchunk;           // where in the pool, see zswap_store
+    int zlen;
+    int writing;          // being moved from the pool to disk
+    int pageout;          // its page is being stored, faults wait
+    struct core_map_entry *cached;  // page swapped in from the slot, if kept
 };
 
 #endif
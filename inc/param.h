@@ -3,9 +3,12 @@
 #define KSTACKSIZE   PGSIZE
 #define NPROC        64  // maximum number of processes
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define MAXORDER     10  // largest kalloc_pages block is 2^MAXORDER pages
+#define ZSWAPORDER    6  // compressed swap pool is 2^ZSWAPORDER pages
+#define NOFILE       16  // open files per process before its table grows
+#define MAXOFILE    512  // open files per process, a page of pointers
+#define NVMA          8  // memory mappings per process
+#define NINODE       50  // i-nodes kept cached while unused
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
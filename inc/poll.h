@@ -0,0 +1,16 @@
+#pragma once
+
+// Events for poll.
+// Both the kernel and user programs use this header file.
+
+#define POLLIN   0x001  // there is data to read
+#define POLLOUT  0x004  // writing will not block
+#define POLLERR  0x008  // nobody will read what is written (revents only)
+#define POLLHUP  0x010  // the writing end has hung up (revents only)
+#define POLLNVAL 0x020  // fd is not open (revents only)
+
+struct pollfd {
+  int fd;         // file descriptor, ignored if negative
+  short events;   // events to wait for
+  short revents;  // events that are ready, filled in by poll
+};
@@ -87,6 +87,21 @@ struct mem_region {
 
 enum mem_region_enum { CODE, HEAP, USTACK, MMAP};
 
+// A memory mapping made by mmap. Its pages are filled in when they are
+// first touched. The MMAP region spans all of a process's mappings.
+struct vma {
+  uint64_t start;        // page aligned, 0 if the slot is unused
+  uint64_t size;         // multiple of PGSIZE
+  struct inode *inode;   // mapped file, 0 for anonymous memory
+  uint offset;           // file offset of start, multiple of PGSIZE
+  int prot;              // PROT_READ, PROT_WRITE
+  int flags;             // MAP_SHARED or MAP_PRIVATE
+};
+
+// Mappings are placed in [MMAPBASE, MMAPTOP)
+#define MMAPBASE  SZ_2G
+#define MMAPTOP   SZ_4G
+
 
 // Per-process state
 struct proc {
@@ -101,8 +116,13 @@ struct proc {
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
   char name[16];               // Process name (debugging)
-  struct file *oft[NOFILE];    // per-process open file table
-  struct inode *mapped_file;   // file being mapped to process's MMAP region
+  struct file **oft;           // per-process open file table, nofile entries
+  int nofile;                  // size of oft, NOFILE or MAXOFILE
+  uint64_t fdmap[MAXOFILE/64]; // bit set for each file descriptor in use
+  int fdhint;                  // every file descriptor below this is in use
+  struct file *oftsmall[NOFILE]; // oft until it outgrows NOFILE entries
+  struct inode *mapped_file;   // file mapped by mmap(fd) at MMAPBASE
+  struct vma vmas[NVMA];       // memory mappings
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,11 @@
+#pragma once
+#include <spinlock.h>
+
+// A cache of equal-sized kernel objects, see slab.c
+struct slab_cache {
+  struct spinlock lock;
+  char *name;
+  uint size;              // bytes per object
+  uint perslab;           // objects that fit in a slab
+  struct slab *partial;   // slabs with free objects
+};
@@ -10,3 +10,16 @@ struct sleeplock {
   char *name;        // Name of lock.
   int pid;           // Process holding lock
 };
+
+// Long-term lock that many readers can hold at once, or one writer.
+// Waiting writers go before readers that come later.
+struct rwsleeplock {
+  int readers;        // Number of readers holding the lock
+  uint writer;        // Is the lock held by a writer?
+  int waitingWriters; // Writers sleeping until the lock is free
+  struct spinlock lk; // spinlock protecting this sleep lock
+
+  // For debugging:
+  char *name;        // Name of lock.
+  int pid;           // Writer holding lock
+};
@@ -24,3 +24,14 @@
 #define SYS_mmap    23
 #define SYS_munmap	24
 #define SYS_crashn  25
+#define SYS_mmap2   26
+#define SYS_munmap2 27
+#define SYS_msync   28
+#define SYS_sendfile 29
+#define SYS_splice  30
+#define SYS_pread   31
+#define SYS_pwrite  32
+#define SYS_readv   33
+#define SYS_writev  34
+#define SYS_poll    35
+#define SYS_pipe2   36
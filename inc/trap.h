@@ -26,6 +26,11 @@
 #define TRAP_VC		29	/* VMM communication */
 #define TRAP_SX		30	/* security */
 
+/* page fault error code bits */
+#define FEC_PR		0x1	/* page fault caused by protection violation */
+#define FEC_WR		0x2	/* page fault caused by a write */
+#define FEC_U		0x4	/* page fault occurred while in user mode */
+
 #define TRAP_IRQ0	32
 #define TRAP_SYSCALL       64      // system call
 
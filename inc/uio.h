@@ -0,0 +1,11 @@
+#pragma once
+
+// I/O vectors for readv and writev.
+// Both the kernel and user programs use this header file.
+
+#define IOV_MAX 16  // max number of iovecs in one call
+
+struct iovec {
+  void *iov_base;  // start of the buffer
+  int iov_len;     // number of bytes in the buffer
+};
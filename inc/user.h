@@ -3,6 +3,8 @@
 struct stat;
 struct rtcdate;
 struct sys_info;
+struct iovec;
+struct pollfd;
 
 // system calls
 int fork(void);
@@ -30,6 +32,17 @@ int sysinfo(struct sys_info*);
 int mmap(int);
 int munmap(int);
 int crashn(int);
+void* mmap2(void*, int, int, int, int, int);
+int munmap2(void*, int);
+int msync(void*, int);
+int sendfile(int, int, int, int);
+int splice(int, int, int);
+int pread(int, void*, int, int);
+int pwrite(int, void*, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int poll(struct pollfd*, int, int);
+int pipe2(int*, int);
 
 // ulib.c
 int stat(char*, struct stat*);
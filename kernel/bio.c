@@ -26,9 +26,6 @@
 #include <fs.h>
 #include <buf.h>
 
-int crashn_enable = 0;
-int crashn = 0;
-
 int num_disk_reads = 0;
 
 struct {
@@ -63,7 +60,9 @@ binit(void)
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
-static struct buf*
+// Callers that queue their own disk requests (iderw_async) use this
+// instead of bread.
+struct buf*
 bget(uint dev, uint blockno)
 {
   struct buf *b;
@@ -115,59 +114,39 @@ bread(uint dev, uint blockno)
 void
 bwrite(struct buf *b)
 {
-  if (crashn_enable) {
-    crashn --;
-    if (crashn < 0)
-      reboot();
-  }
   if(!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
-  if (is_trx()) {
-    // put data in buffer cache
-    // put data in log logHeader
-    // write log header to Disk
-    // write log index
-
+  if (is_trx() && !is_swap_block(b->blockno) &&
+      !((b->flags & B_DATA) && is_ordered_log())) {
+    // the block belongs to the running transaction: record it in the
+    // log header. b stays dirty in the cache, which keeps it from being
+    // recycled; the commit copies it into its log slot and then
+    // installs it at its home location
     addNewWriteLocationToLog(b->blockno);
-
-    // need to redirect b to the log
-    // get log block number and offset
-    uint logstart = getLogStart();
-    uint datablock = logstart + 1 + getBlocksInLog();
-    struct buf *logHeaderBuf = bget(ROOTDEV, logstart);
-    struct buf *logBlockBuf = bget(ROOTDEV, datablock);
-
-    // write b to logBlockBuf
-    // write metadata to logHeaderBuf
-    struct logHeader *header = getLogHeader();
-    acquiresleep(&logHeaderBuf->lock);
-    memmove(logHeaderBuf->data, (char *)header, sizeof(struct logHeader));
-    releasesleep(&logHeaderBuf->lock);
-
-    acquiresleep(&logBlockBuf->lock);
-    memmove(logBlockBuf->data, (char *)b->data, BSIZE);
-    releasesleep(&logBlockBuf->lock);
-
-    // flush the log to disk
-    iderw(logHeaderBuf);
-    iderw(logBlockBuf);
   } else {
+    // outside of a transaction, or file data in ordered mode: write
+    // in place. in ordered mode this puts the data on disk before the
+    // commit record of the metadata that points at it.
     iderw(b);
   }
+  b->flags &= ~B_DATA;
 }
 
+// Copy the contents of block srcBlockNum to block destBlockNum
+// and flush the destination to disk.
 void
 bwriteBlockAToBlockB(uint srcBlockNum, uint destBlockNum) {
-  struct buf *srcBuf = bget(ROOTDEV, srcBlockNum);
+  struct buf *srcBuf = bread(ROOTDEV, srcBlockNum);
   struct buf *destBuf = bget(ROOTDEV, destBlockNum);
 
-  acquiresleep(&destBuf->lock);
   memmove(destBuf->data, (char *)srcBuf->data, BSIZE);
-  releasesleep(&destBuf->lock);
+  destBuf->flags |= B_DIRTY;
 
   // flush to disk
   iderw(destBuf);
+  brelse(destBuf);
+  brelse(srcBuf);
 }
 
 // Release a locked buffer.
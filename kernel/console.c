@@ -10,6 +10,7 @@
 #include <sleeplock.h>
 #include <fs.h>
 #include <file.h>
+#include <poll.h>
 #include <memlayout.h>
 #include <mmu.h>
 #include <proc.h>
@@ -20,6 +21,8 @@ static void consputc(int);
 
 static int panicked = 0;
 
+static struct waitqueue conspollq;  // processes polling the console
+
 static struct {
   struct spinlock lock;
   int locking;
@@ -263,6 +266,7 @@ consoleintr(int (*getc)(void))
         if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
           input.w = input.e;
           wakeup(&input.r);
+          pollwakeup(&conspollq);
         }
       }
       break;
@@ -309,6 +313,19 @@ consoleread(struct inode *ip, char *dst, int n)
   return target - n;
 }
 
+// The console can always be written, and read once a line is in.
+int
+consolepoll(struct inode *ip)
+{
+  int revents = POLLOUT;
+
+  acquire(&cons.lock);
+  if(input.r != input.w)
+    revents |= POLLIN;
+  release(&cons.lock);
+  return revents;
+}
+
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
@@ -329,6 +346,8 @@ consoleinit(void)
 
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
+  devsw[CONSOLE].pollq = &conspollq;
   
   cons.locking = 1;
 
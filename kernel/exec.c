@@ -6,6 +6,10 @@
 #include <defs.h>
 #include <x86_64.h>
 #include <elf.h>
+#include <spinlock.h>
+#include <sleeplock.h>
+#include <fs.h>
+#include <file.h>
 #include <trap.h>
 
 int load_program_from_disk(pml4e_t *pml4, char *path, uint64_t *rip) {
@@ -21,6 +25,8 @@ int load_program_from_disk(pml4e_t *pml4, char *path, uint64_t *rip) {
   }
 
   iload(ip);
+  // many processes can load the same binary at once
+  acquiresleepread(&ip->lock);
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -50,11 +56,13 @@ int load_program_from_disk(pml4e_t *pml4, char *path, uint64_t *rip) {
     if(loaduvm(pml4, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
      goto elf_failure;
   }
+  releasesleepread(&ip->lock);
   iput(ip);
   *rip = elf.entry;
   return sz;
 elf_failure:
   if(ip){
+    releasesleepread(&ip->lock);
     iput(ip);
   }
   return 0;
@@ -89,10 +97,6 @@ exec(char *path, char **argv)
   process->mem_regions[HEAP].start = (char *)PGROUNDUP((int64_t) sz);
   process->mem_regions[HEAP].size = 0;
 
-  // zero out MMAP regions
-  process->mem_regions[MMAP].start = (char *)0;
-  process->mem_regions[MMAP].size = 0;
-
   // initialize user's stack
   initustack(pml4, &process->mem_regions[USTACK], process->pid);
 
@@ -138,6 +142,9 @@ exec(char *path, char **argv)
   process->tf->rip = rip;
   process->tf->rsp = endOfStack;
 
+  // the old memory mappings go away with the old page table
+  vma_unmap_all(process);
+
   // replace page table
   pml4e_t *oldpml4 = process->pml4;
   process->pml4 = pml4;
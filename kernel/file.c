@@ -6,49 +6,47 @@
 #include <defs.h>
 #include <param.h>
 #include <stat.h>
+#include <memlayout.h>
 #include <mmu.h>
 #include <param.h>
 #include <fcntl.h>
+#include <mman.h>
 #include <fs.h>
 #include <spinlock.h>
 #include <sleeplock.h>
+#include <slab.h>
 #include <file.h>
+#include <uio.h>
+#include <poll.h>
+#include <error.h>
 #include <proc.h>
 
 struct devsw devsw[NDEV];
 
-struct {
-  struct spinlock lock;
-  struct file globalFileTable[NFILE];
-} gftTable;
+struct slab_cache fileCache;  // open files
+struct slab_cache pipeCache;  // pipes
 
 void
 finit(void)
 {
-  initlock(&gftTable.lock, "gtfTable");
+  slab_init(&fileCache, "file", sizeof(struct file));
+  slab_init(&pipeCache, "pipe", sizeof(struct pipe));
 }
 
 /*
-  Allocates a file in the global file table if there
-  is space, returns a pointer to the file in the table,
-  returns NULL on error
+  Allocates a file from the file slab cache.
+  Returns a pointer to the file, NULL on error
 */
 struct file*
 openFile() {
-  // loop through the global file table to find an open position
-  acquire(&gftTable.lock);  // acquire lock
-  for (int i = 0; i < NFILE; i++) {
-    struct file *file = &gftTable.globalFileTable[i];
-    if (file->refCount == 0) {
-      // found an open position
-      initsleeplock(&file->lock, "file");
-      file->refCount = 1;
-      release(&gftTable.lock);  // release lock on return
-      return file;
-    }
+  struct file *file = slab_alloc(&fileCache);
+  if (file == NULL) {
+    return NULL;
   }
-  release(&gftTable.lock);  // release lock on return
-  return NULL;
+  memset(file, 0, sizeof(*file));
+  initsleeplock(&file->lock, "file");
+  file->refCount = 1;
+  return file;
 }
 
 /*
@@ -68,20 +66,82 @@ readFile(struct file *file, char *buffer, int numBytes) {
   // read based on file type
   int numRead = 0;
   if (file->type == FTYPE_INODE) {
+    // a device with no input yet would block
+    if ((file->flags & O_NONBLOCK) && !(pollFile(file, POLLIN) & POLLIN)) {
+      releasesleep(&file->lock);
+      return -E_AGAIN;
+    }
     // read with inode
-    acquiresleep(&file->inode->lock);
+    acquiresleepread(&file->inode->lock);
     numRead = readi(file->inode, buffer, file->offset, numBytes);
-    releasesleep(&file->inode->lock);
-    file->offset += numRead;
+    releasesleepread(&file->inode->lock);
+    if (numRead > 0)
+      file->offset += numRead;
   } else {
     // read with pipe
     releasesleep(&file->lock);
-    return readPipe(file->pipe, buffer, numBytes);
+    return readPipe(file->pipe, buffer, numBytes, file->flags & O_NONBLOCK);
   }
   releasesleep(&file->lock);
   return numRead;
 }
 
+/*
+  Writes numBytes worth of data from buffer to the inode at offset
+  off, splitting the write into transactions that are small enough
+  to fit in the log. Returns the number of bytes written, -1 if
+  nothing could be
+*/
+static int
+writeInode(struct inode *ip, char *buffer, uint off, int numBytes) {
+  int numWritten = 0;
+
+  if (ip->type == T_DEV) {
+    // devices are not journaled
+    acquiresleepwrite(&ip->lock);
+    numWritten = writei(ip, buffer, off, numBytes);
+    releasesleepwrite(&ip->lock);
+    return numWritten;
+  }
+
+  // writei copies into locked buffers inside a transaction. Filling
+  // in a page of a mapping of this very file needs those buffers, so
+  // a buffer in such a mapping is copied into a kernel page first, a
+  // chunk at a time, while no locks are held.
+  char *bounce = 0;
+  int maxBytes = (MAXOPBLOCKS - 2) * BSIZE;
+  if (myproc() != 0 && vma_maps_inode(myproc(), (uint64_t)buffer, numBytes, ip)) {
+    if ((bounce = kalloc()) == 0)
+      return -1;
+    maxBytes = min(maxBytes, PGSIZE);
+  }
+
+  while (numWritten < numBytes) {
+    int n = min(numBytes - numWritten, maxBytes);
+    char *src = buffer + numWritten;
+    if (bounce) {
+      memmove(bounce, src, n);
+      src = bounce;
+    }
+    log_start_tx();
+    acquiresleepwrite(&ip->lock);
+    int r = writei(ip, src, off + numWritten, n);
+    releasesleepwrite(&ip->lock);
+    log_end_tx();
+    if (r < 0) {
+      if (numWritten == 0)
+        numWritten = -1;
+      break;
+    }
+    numWritten += r;
+    if (r != n)
+      break;
+  }
+  if (bounce)
+    kfree(bounce);
+  return numWritten;
+}
+
 /*
   Writes numBytes worth of data from buffer to the struct file
 */
@@ -96,20 +156,90 @@ writeFile(struct file *file, char *buffer, int numBytes) {
   int numWritten = 0;
   // write based on file type
   if (file->type == FTYPE_INODE) {
-    // write with inode
-    acquiresleep(&file->inode->lock);
-    numWritten = writei(file->inode, buffer, file->offset, numBytes);
-    releasesleep(&file->inode->lock);
-    file->offset += numWritten;
+    numWritten = writeInode(file->inode, buffer, file->offset, numBytes);
+    if (numWritten > 0)
+      file->offset += numWritten;
   } else {
     // write with pipe
     releasesleep(&file->lock);
-    return writePipe(file->pipe, buffer, numBytes);
+    return writePipe(file->pipe, buffer, numBytes, file->flags & O_NONBLOCK);
   }
   releasesleep(&file->lock);
   return numWritten;
 }
 
+/*
+  Reads up to numBytes at offset off of the file into buffer without
+  using or moving the file offset, so it does not take the file's
+  lock. Only works on inodes. Returns the number of bytes read, -1 on
+  error
+*/
+int
+preadFile(struct file *file, char *buffer, int numBytes, uint off) {
+  if (file->type != FTYPE_INODE || file->permissions == O_WRONLY ||
+      file->permissions == O_CREATE) {
+    return -1;
+  }
+  acquiresleepread(&file->inode->lock);
+  int numRead = readi(file->inode, buffer, off, numBytes);
+  releasesleepread(&file->inode->lock);
+  return numRead;
+}
+
+/*
+  Writes numBytes from buffer at offset off of the file without using
+  or moving the file offset, so it does not take the file's lock. Only
+  works on inodes. Returns the number of bytes written, -1 on error
+*/
+int
+pwriteFile(struct file *file, char *buffer, int numBytes, uint off) {
+  if (file->type != FTYPE_INODE || file->permissions == O_RDONLY ||
+      file->permissions == O_CREATE) {
+    return -1;
+  }
+  return writeInode(file->inode, buffer, off, numBytes);
+}
+
+/*
+  Reads into each buffer of iov in turn, stopping early at a short
+  read. Returns the total number of bytes read, or what the first
+  read returned if it fails
+*/
+int
+readvFile(struct file *file, struct iovec *iov, int iovcnt) {
+  int total = 0;
+
+  for (int i = 0; i < iovcnt; i++) {
+    int r = readFile(file, iov[i].iov_base, iov[i].iov_len);
+    if (r < 0)
+      return total > 0 ? total : r;
+    total += r;
+    if (r != iov[i].iov_len)
+      break;
+  }
+  return total;
+}
+
+/*
+  Writes each buffer of iov in turn, stopping early at a short write.
+  Returns the total number of bytes written, or what the first write
+  returned if it fails
+*/
+int
+writevFile(struct file *file, struct iovec *iov, int iovcnt) {
+  int total = 0;
+
+  for (int i = 0; i < iovcnt; i++) {
+    int r = writeFile(file, iov[i].iov_base, iov[i].iov_len);
+    if (r < 0)
+      return total > 0 ? total : r;
+    total += r;
+    if (r != iov[i].iov_len)
+      break;
+  }
+  return total;
+}
+
 /*
   given a file closes and removes a reference from it
   return 0 on success -1 otherwise
@@ -127,7 +257,7 @@ closeFile(struct file *file) {
       if (file->type == FTYPE_INODE) {
         // release inode
         iput(file->inode);
-      } else {
+      } else if (file->type == FTYPE_PIPE) {
         // release pipe
         if (file->permissions == O_WRONLY) {
           file->pipe->writeClosed = 1;
@@ -143,6 +273,10 @@ closeFile(struct file *file) {
       file->offset = 0;
       file->inode = 0;
       file->pipe = 0;
+      file->flags = 0;
+      releasesleep(&file->lock);
+      slab_free(&fileCache, file);
+      return 0;
     }
     releasesleep(&file->lock);
     return 0;
@@ -178,6 +312,138 @@ fstat(struct file *file, struct stat *st) {
   return -1;
 }
 
+/*
+  Per-process file descriptor tables. A process starts out with room
+  for NOFILE descriptors in its struct proc; when they are all in use
+  the table moves to a page of its own with room for MAXOFILE. A bitmap
+  of the descriptors in use, and a hint below which every descriptor
+  is in use, find the lowest free descriptor without a scan of the
+  table.
+*/
+
+/*
+  Gives p an empty file descriptor table
+*/
+void
+fdinit(struct proc *p) {
+  p->oft = p->oftsmall;
+  p->nofile = NOFILE;
+  memset(p->oftsmall, 0, sizeof(p->oftsmall));
+  memset(p->fdmap, 0, sizeof(p->fdmap));
+  p->fdhint = 0;
+}
+
+/*
+  Moves the file descriptor table of p to a page of its own.
+  Returns 0 on success, -1 if it is as big as it gets or out of memory
+*/
+static int
+fdgrow(struct proc *p) {
+  struct file **oft;
+
+  if (p->nofile == MAXOFILE || (oft = (struct file **) kalloc_zeroed()) == NULL) {
+    return -1;
+  }
+  memmove(oft, p->oft, p->nofile * sizeof(struct file *));
+  p->oft = oft;
+  p->nofile = MAXOFILE;
+  return 0;
+}
+
+/*
+  Puts file at the lowest free file descriptor of the current process.
+  Returns the file descriptor, -1 if there is none
+*/
+int
+fdalloc(struct file *file) {
+  struct proc *p = myproc();
+
+  // every descriptor below the hint is in use, so the first word
+  // worth looking at is the one holding the hint
+  for (int w = p->fdhint / 64; w < MAXOFILE / 64; w++) {
+    if (p->fdmap[w] == ~0ULL) {
+      continue;
+    }
+    int fd = w * 64 + __builtin_ctzll(~p->fdmap[w]);
+    if (fd >= p->nofile && fdgrow(p) < 0) {
+      return -1;
+    }
+    p->fdmap[w] |= 1ULL << (fd % 64);
+    p->oft[fd] = file;
+    p->fdhint = fd + 1;
+    return fd;
+  }
+  return -1;
+}
+
+/*
+  Returns the file at file descriptor fd of the current process,
+  NULL if fd is not open
+*/
+struct file*
+fdget(int fd) {
+  struct proc *p = myproc();
+
+  if (fd < 0 || fd >= p->nofile) {
+    return NULL;
+  }
+  return p->oft[fd];
+}
+
+/*
+  Makes file descriptor fd of the current process free again. Does
+  not close the file
+*/
+void
+fdfree(int fd) {
+  struct proc *p = myproc();
+
+  p->oft[fd] = NULL;
+  p->fdmap[fd / 64] &= ~(1ULL << (fd % 64));
+  if (fd < p->fdhint) {
+    p->fdhint = fd;
+  }
+}
+
+/*
+  Gives child a copy of the file descriptor table of p, with a
+  reference to each open file. Returns 0 on success, -1 otherwise
+*/
+int
+fdcopy(struct proc *p, struct proc *child) {
+  if (p->nofile > child->nofile && fdgrow(child) < 0) {
+    return -1;
+  }
+  for (int fd = 0; fd < p->nofile; fd++) {
+    if (p->oft[fd] != NULL) {
+      if (dupFile(p->oft[fd]) == -1) {
+        return -1;
+      }
+      child->oft[fd] = p->oft[fd];
+    }
+  }
+  memmove(child->fdmap, p->fdmap, sizeof(p->fdmap));
+  child->fdhint = p->fdhint;
+  return 0;
+}
+
+/*
+  Closes every open file of p and frees its file descriptor table
+*/
+void
+fdcloseall(struct proc *p) {
+  for (int fd = 0; fd < p->nofile; fd++) {
+    if (p->oft[fd] != NULL) {
+      closeFile(p->oft[fd]);
+      p->oft[fd] = NULL;
+    }
+  }
+  if (p->oft != p->oftsmall) {
+    kfree((char *) p->oft);
+  }
+  fdinit(p);
+}
+
 /*
   Given two pointers to file structs, makes a pipe
   that references those files and returns that pipe
@@ -185,7 +451,7 @@ fstat(struct file *file, struct stat *st) {
 struct pipe *
 openPipe(struct file *f1, struct file *f2) {
   // try creating 2 new files
-  struct pipe *pipeSpace = (struct pipe*) kalloc();
+  struct pipe *pipeSpace = slab_alloc(&pipeCache);
   if (pipeSpace == NULL) {
     return NULL;
   }
@@ -196,68 +462,257 @@ openPipe(struct file *f1, struct file *f2) {
   f2->type = FTYPE_PIPE;
   f2->pipe = pipeSpace;
 
-  // set pipe struct values
+  // set pipe struct values, the data pages are allocated as they are written
+  memset(pipeSpace, 0, sizeof(*pipeSpace));
   initlock(&pipeSpace->lock, "pipe");
-  pipeSpace->readOffset = 0;
-  pipeSpace->writeOffset = 0;
+  initsleeplock(&pipeSpace->rlock, "pipe reader");
+  initsleeplock(&pipeSpace->wlock, "pipe writer");
+  pipeSpace->maxbufs = PIPE_MINBUFS;
   pipeSpace->readClosed = 0;
   pipeSpace->writeClosed = 0;
   pipeSpace->referenceCount = 2;
   return pipeSpace;
 }
 
+/*
+  Drops the page of a drained pipe buffer, keeping one page around
+  for the next write. Caller holds the pipe lock
+*/
+static void
+releasePipeBuf(struct pipe *pipe, struct pipe_buf *buf) {
+  if (pipe->spare == NULL && !(buf->flags & PIPE_BUF_SHARED)) {
+    pipe->spare = buf->page;
+  } else {
+    kfree(buf->page);
+  }
+  buf->page = NULL;
+  buf->off = 0;
+  buf->len = 0;
+  buf->flags = 0;
+}
+
+/*
+  Returns 1 if the pipe has nothing to read. The last page may be
+  empty while a writer is still copying into it. Caller holds the
+  pipe lock
+*/
+static int
+pipeEmpty(struct pipe *pipe) {
+  return pipe->head == pipe->tail ||
+    (pipe->head - pipe->tail == 1 && pipe->bufs[pipe->tail % PIPE_MAXBUFS].len == 0);
+}
+
+/*
+  Returns 1 if a write to the pipe can make progress without waiting:
+  the last page has room, or waitPipeRoom would let a new page in.
+  Caller holds the pipe lock
+*/
+static int
+pipeHasRoom(struct pipe *pipe) {
+  struct pipe_buf *buf;
+
+  if (pipe->head - pipe->tail < pipe->maxbufs || pipe->maxbufs < PIPE_MAXBUFS) {
+    return 1;
+  }
+  buf = &pipe->bufs[(pipe->head - 1) % PIPE_MAXBUFS];
+  return !(buf->flags & PIPE_BUF_SHARED) && buf->off + buf->len < PGSIZE;
+}
+
+/*
+  Takes n bytes off the front of the pipe. A drained page is dropped
+  unless a writer is still copying into it. Caller holds the pipe lock
+*/
+static void
+consumePipe(struct pipe *pipe, uint n) {
+  struct pipe_buf *buf = &pipe->bufs[pipe->tail % PIPE_MAXBUFS];
+
+  buf->off += n;
+  buf->len -= n;
+  if (buf->len == 0 && !(pipe->filling && pipe->tail + 1 == pipe->head)) {
+    releasePipeBuf(pipe, buf);
+    pipe->tail++;
+  }
+}
+
+/*
+  Waits until the pipe has something to read or the write side is
+  closed. Caller holds the pipe lock. Returns 0 when done waiting, -1
+  if the pipe cannot be read anymore, -E_AGAIN if it would have to
+  wait and nonblock is set
+*/
+static int
+waitPipeData(struct pipe *pipe, int nonblock) {
+  while (pipeEmpty(pipe) && pipe->writeClosed == 0) {
+    if (myproc()->killed || pipe->readClosed) {
+      // pipe is invalid
+      return -1;
+    }
+    if (nonblock) {
+      return -E_AGAIN;
+    }
+    sleep(&pipe->head, &pipe->lock);
+  }
+  return 0;
+}
+
+/*
+  Waits until the pipe has room for another page, letting it grow
+  first if it may. Caller holds the pipe lock. Returns -1 if the pipe
+  cannot be written anymore, -E_AGAIN if it would have to wait and
+  nonblock is set, 0 otherwise
+*/
+static int
+waitPipeRoom(struct pipe *pipe, int nonblock) {
+  while (pipe->head - pipe->tail == pipe->maxbufs) {
+    if (myproc()->killed || pipe->readClosed || pipe->writeClosed) {
+      return -1;
+    }
+    // a writer that keeps filling the pipe gets more room,
+    // after that it waits for the reader to catch up
+    if (pipe->maxbufs < PIPE_MAXBUFS) {
+      pipe->maxbufs = min(pipe->maxbufs * 2, (uint)PIPE_MAXBUFS);
+      break;
+    }
+    if (nonblock) {
+      return -E_AGAIN;
+    }
+    wakeup(&pipe->head);
+    pollwakeup(&pipe->pollq);
+    sleep(&pipe->tail, &pipe->lock);
+  }
+  if (myproc()->killed || pipe->readClosed || pipe->writeClosed) {
+    return -1;
+  }
+  return 0;
+}
+
 /*
   Given a pipe and a buffer, reads from the pipe and into
-  the buffer numBytes worth of information
+  the buffer up to numBytes worth of information. Blocks until
+  there is something to read or the write side is closed, then
+  returns what is there without waiting for more. If nonblock is set
+  an empty pipe returns -E_AGAIN instead of blocking
 */
-int readPipe(struct pipe *pipe, char *buffer, int numBytes) {
-  int i = 0;
-  // cannot read more than you write
+int readPipe(struct pipe *pipe, char *buffer, int numBytes, int nonblock) {
+  struct pipe_buf *buf;
+  char *src;
+  int i = 0, r;
+  uint n;
+
+  acquiresleep(&pipe->rlock);
   acquire(&pipe->lock);
-  // here is where we need to test the condition variable
   // we have to wait on read until there is something to read
-  struct proc *currentProcess = myproc();
-  if (currentProcess->killed == 1 || pipe->readClosed == 1) {
-    // pipe is invalid
+  if ((r = waitPipeData(pipe, nonblock)) < 0) {
     release(&pipe->lock);
-    return -1;
+    releasesleep(&pipe->rlock);
+    return r;
   }
 
-  while (pipe->readOffset == pipe->writeOffset && pipe->writeClosed == 0) {
-    sleep(&pipe->readOffset, &pipe->lock);
+  // one copy per page of data. The user buffer may fault, so the copy
+  // is made with the lock dropped; holding rlock keeps the page at the
+  // tail ours until it is consumed.
+  while (i < numBytes && !pipeEmpty(pipe)) {
+    buf = &pipe->bufs[pipe->tail % PIPE_MAXBUFS];
+    n = min((uint)(numBytes - i), buf->len);
+    src = buf->page + buf->off;
+    if (n > 0) {
+      release(&pipe->lock);
+      memmove(buffer + i, src, n);
+      acquire(&pipe->lock);
+    }
+    consumePipe(pipe, n);
+    i += n;
   }
 
-  while ((pipe->readOffset != pipe->writeOffset) && i < numBytes) {
-  	buffer[i] = (pipe->buffer)[pipe->readOffset % PIPE_SIZE];
-  	pipe->readOffset++;
-  	i++;
-  }
+  // there is room for the writers again
+  wakeup(&pipe->tail);
+  pollwakeup(&pipe->pollq);
   release(&pipe->lock);
+  releasesleep(&pipe->rlock);
   return i;
 }
 
 /*
   Given a pipe and a buffer writes numBytes worth of data from
-  the buffer into the pipe
+  the buffer into the pipe. Sleeps while the pipe is full. Returns
+  the number of bytes written, which is less than numBytes only if
+  the read side was closed, the process killed or, if nonblock is set,
+  the pipe filled up part way. Returns -1 if nothing could be written,
+  -E_AGAIN if nothing could because the pipe is full and nonblock is set
 */
-int writePipe(struct pipe *pipe, char *buffer, int numBytes) {
-  int i = 0;
-  acquire(&pipe->lock);
-  struct proc *currentProcess = myproc();
-  if (currentProcess->killed == 1 || pipe->writeClosed == 1) {
-    // pipe is invalid
-    wakeup(&pipe->readOffset);
-    release(&pipe->lock);
-    return -1;
-  }
+int writePipe(struct pipe *pipe, char *buffer, int numBytes, int nonblock) {
+  struct pipe_buf *buf;
+  char *page;
+  int i = 0, err = -1;
+  char *dst;
+  uint n;
 
+  acquiresleep(&pipe->wlock);
+  acquire(&pipe->lock);
   while (i < numBytes) {
-  	(pipe->buffer)[(pipe->writeOffset) % PIPE_SIZE] = buffer[i];
-  	pipe->writeOffset++;
-  	i++;
+    if (myproc()->killed || pipe->readClosed || pipe->writeClosed) {
+      // nobody will read the rest
+      break;
+    }
+
+    // fill up the last page before starting a new one. The user
+    // buffer may fault, so the copy is made with the lock dropped;
+    // filling keeps readers from dropping the page meanwhile.
+    if (pipe->head != pipe->tail) {
+      buf = &pipe->bufs[(pipe->head - 1) % PIPE_MAXBUFS];
+      if (!(buf->flags & PIPE_BUF_SHARED) && buf->off + buf->len < PGSIZE) {
+        n = min((uint)(numBytes - i), PGSIZE - (buf->off + buf->len));
+        dst = buf->page + buf->off + buf->len;
+        pipe->filling = 1;
+        release(&pipe->lock);
+        memmove(dst, buffer + i, n);
+        acquire(&pipe->lock);
+        pipe->filling = 0;
+        buf->len += n;
+        i += n;
+        continue;
+      }
+    }
+
+    if ((err = waitPipeRoom(pipe, nonblock)) < 0) {
+      break;
+    }
+    err = -1;
+
+    if (pipe->spare == NULL) {
+      // kalloc may have to swap a page out, which sleeps
+      release(&pipe->lock);
+      page = kalloc();
+      acquire(&pipe->lock);
+      if (page == NULL) {
+        break;
+      }
+      if (pipe->spare != NULL) {
+        kfree(page);
+      } else {
+        pipe->spare = page;
+      }
+      continue;
+    }
+
+    // start a new page at the head of the ring
+    buf = &pipe->bufs[pipe->head % PIPE_MAXBUFS];
+    buf->page = pipe->spare;
+    buf->off = 0;
+    buf->len = 0;
+    buf->flags = 0;
+    pipe->spare = NULL;
+    pipe->head++;
   }
-  wakeup(&pipe->readOffset);
+
+  // wake up readers even on failure so they see a closed pipe
+  wakeup(&pipe->head);
+  pollwakeup(&pipe->pollq);
   release(&pipe->lock);
+  releasesleep(&pipe->wlock);
+  if (i == 0 && numBytes > 0) {
+    return err;
+  }
   return i;
 }
 
@@ -266,8 +721,11 @@ int writePipe(struct pipe *pipe, char *buffer, int numBytes) {
 */
 int closePipe(struct pipe *pipe) {
   acquire(&pipe->lock);
+  // either side may be waiting on the one that closed
+  wakeup(&pipe->head);
+  wakeup(&pipe->tail);
+  pollwakeup(&pipe->pollq);
   if(pipe->referenceCount == 0) {
-    wakeup(&pipe->readOffset);
     release(&pipe->lock);
     return -1;
   }
@@ -276,50 +734,319 @@ int closePipe(struct pipe *pipe) {
   pipe->referenceCount--;
   // only delete when both the read and write files have been closed
   if (pipe->referenceCount == 0) {
-      wakeup(&pipe->readOffset);
       release(&pipe->lock);
-      kfree((char *) pipe);
+      for (; pipe->tail != pipe->head; pipe->tail++) {
+        kfree(pipe->bufs[pipe->tail % PIPE_MAXBUFS].page);
+      }
+      if (pipe->spare != NULL) {
+        kfree(pipe->spare);
+      }
+      slab_free(&pipeCache, pipe);
       return 0;
   }
-  wakeup(&pipe->readOffset);
   release(&pipe->lock);
   return 0;
 }
 
 /*
-  Given a file descriptor we copy the file's contents
-  into user space so that it can be edited manually
+  Adds a page holding len bytes at offset off to the pipe without
+  copying them. The pipe takes over the caller's reference to the
+  page. Returns 0 on success, -1 if the pipe cannot be written,
+  -E_AGAIN if it is full and nonblock is set
+*/
+static int
+pushPipePage(struct pipe *pipe, char *page, uint off, uint len, int nonblock) {
+  struct pipe_buf *buf;
+  int r;
+
+  acquiresleep(&pipe->wlock);
+  acquire(&pipe->lock);
+  if ((r = waitPipeRoom(pipe, nonblock)) < 0) {
+    wakeup(&pipe->head);
+    pollwakeup(&pipe->pollq);
+    release(&pipe->lock);
+    releasesleep(&pipe->wlock);
+    return r;
+  }
+  buf = &pipe->bufs[pipe->head % PIPE_MAXBUFS];
+  buf->page = page;
+  buf->off = off;
+  buf->len = len;
+  buf->flags = PIPE_BUF_SHARED;
+  pipe->head++;
+  wakeup(&pipe->head);
+  pollwakeup(&pipe->pollq);
+  release(&pipe->lock);
+  releasesleep(&pipe->wlock);
+  return 0;
+}
+
+/*
+  Sends up to numBytes of the regular file ip starting at offset off
+  to the file out. The data comes straight from the page cache: a pipe
+  gets references to the cached pages, anything else is written from
+  them. The pages are not copied when the file is written later, so
+  the pipe's reader sees such a write. Returns the number of bytes sent, or -1 (-E_AGAIN for a full
+  non-blocking pipe) if none could be
+*/
+static int
+sendPages(struct file *out, struct inode *ip, uint off, int numBytes) {
+  char *page;
+  uint n;
+  int i = 0, r, err = -1;
+
+  while (i < numBytes) {
+    acquiresleepread(&ip->lock);
+    if (off >= ip->size) {
+      // end of file
+      releasesleepread(&ip->lock);
+      return i;
+    }
+    n = min(min((uint)(numBytes - i), ip->size - off), PGSIZE - off % PGSIZE);
+    page = pcache_get(ip, off / PGSIZE);
+    releasesleepread(&ip->lock);
+    if (page == NULL) {
+      break;
+    }
+
+    if (out->type == FTYPE_PIPE) {
+      if ((err = pushPipePage(out->pipe, page, off % PGSIZE, n,
+                              out->flags & O_NONBLOCK)) < 0) {
+        pcache_put(page);
+        break;
+      }
+      r = n;
+    } else {
+      r = writeFile(out, page + off % PGSIZE, n);
+      pcache_put(page);
+      if (r < 0) {
+        err = r;
+        break;
+      }
+    }
+    i += r;
+    off += r;
+    if (r != n) {
+      break;
+    }
+  }
+  return i > 0 ? i : err;
+}
+
+/*
+  Sends up to numBytes of the regular file in, starting at offset off,
+  to the file out without a trip through user space. If off is -1 the
+  data starts at and advances the offset of in. Returns the number of
+  bytes sent, 0 at the end of the file, -1 on error
+*/
+int
+sendFile(struct file *out, struct file *in, int off, int numBytes) {
+  if (in == out || numBytes < 0 || in->type != FTYPE_INODE ||
+      in->permissions == O_WRONLY || in->permissions == O_CREATE ||
+      out->permissions == O_RDONLY || out->permissions == O_CREATE) {
+    return -1;
+  }
+  iload(in->inode);
+  if (in->inode->type != T_FILE) {
+    return -1;
+  }
+
+  // the offset is not held locked while sending, sendfile between
+  // two files in both directions at once must not deadlock
+  acquiresleep(&in->lock);
+  uint start = off < 0 ? in->offset : off;
+  releasesleep(&in->lock);
+
+  int numSent = sendPages(out, in->inode, start, numBytes);
+  if (off < 0 && numSent > 0) {
+    acquiresleep(&in->lock);
+    in->offset += numSent;
+    releasesleep(&in->lock);
+  }
+  return numSent;
+}
+
+/*
+  Moves up to numBytes of what is in the pipe to the file out, writing
+  it straight from the pipe's pages. Waits for data like readPipe.
+  Returns the number of bytes moved, or -1 on error
+*/
+static int
+drainPipe(struct pipe *pipe, struct file *out, int numBytes, int nonblock) {
+  struct pipe_buf *buf;
+  char *page;
+  uint off, n;
+  int i = 0, r;
+
+  acquiresleep(&pipe->rlock);
+  acquire(&pipe->lock);
+  if ((r = waitPipeData(pipe, nonblock)) < 0) {
+    release(&pipe->lock);
+    releasesleep(&pipe->rlock);
+    return r;
+  }
+
+  while (i < numBytes && !pipeEmpty(pipe)) {
+    buf = &pipe->bufs[pipe->tail % PIPE_MAXBUFS];
+    if (buf->len == 0) {
+      consumePipe(pipe, 0);
+      continue;
+    }
+    // take the data out of the pipe, keeping the page alive with our
+    // own reference. Nothing more is written to a shared page, and a
+    // writer still filling it only appends past these bytes, so they
+    // stay put while the lock is dropped for the write.
+    page = buf->page;
+    off = buf->off;
+    n = min((uint)(numBytes - i), buf->len);
+    inrementPageRefCount(V2P(page));
+    buf->flags |= PIPE_BUF_SHARED;
+    consumePipe(pipe, n);
+    wakeup(&pipe->tail);
+    pollwakeup(&pipe->pollq);
+    release(&pipe->lock);
+
+    r = writeFile(out, page + off, n);
+    kfree(page);
+    if (r < 0) {
+      releasesleep(&pipe->rlock);
+      return i > 0 ? i : -1;
+    }
+    i += r;
+    if (r != n) {
+      releasesleep(&pipe->rlock);
+      return i;
+    }
+    acquire(&pipe->lock);
+  }
+  release(&pipe->lock);
+  releasesleep(&pipe->rlock);
+  return i;
+}
+
+/*
+  Moves up to numBytes from in to out inside the kernel, one of which
+  must be a pipe. Data of a regular file goes into a pipe as references
+  to its cached pages, data out of a pipe is written from the pipe's
+  pages. Returns the number of bytes moved, or -1 on error
+*/
+int
+spliceFile(struct file *in, struct file *out, int numBytes) {
+  if (in->type == FTYPE_PIPE && out->type == FTYPE_PIPE) {
+    return -1;
+  }
+  if (in->type != FTYPE_PIPE) {
+    if (out->type != FTYPE_PIPE) {
+      return -1;
+    }
+    return sendFile(out, in, -1, numBytes);
+  }
+  if (numBytes < 0 || in->permissions == O_WRONLY ||
+      out->permissions == O_RDONLY || out->permissions == O_CREATE) {
+    return -1;
+  }
+  return drainPipe(in->pipe, out, numBytes, in->flags & O_NONBLOCK);
+}
+
+/*
+  Returns which of events (POLLIN, POLLOUT) the file is ready for
+  right now, plus POLLHUP or POLLERR if the other end of a pipe is
+  closed
+*/
+int
+pollFile(struct file *file, int events) {
+  int revents = 0;
+
+  if (file->type == FTYPE_PIPE) {
+    struct pipe *pipe = file->pipe;
+    acquire(&pipe->lock);
+    if (file->permissions == O_WRONLY) {
+      if (pipe->readClosed) {
+        revents |= POLLERR;
+      } else if (pipeHasRoom(pipe)) {
+        revents |= POLLOUT;
+      }
+    } else {
+      if (!pipeEmpty(pipe)) {
+        revents |= POLLIN;
+      }
+      if (pipe->writeClosed) {
+        revents |= POLLHUP;
+      }
+    }
+    release(&pipe->lock);
+    return revents & (events | POLLHUP | POLLERR);
+  }
+
+  struct inode *ip = file->inode;
+  if (ip->type == T_DEV && ip->major >= 0 && ip->major < NDEV && devsw[ip->major].poll) {
+    revents = devsw[ip->major].poll(ip);
+  } else {
+    // reading or writing a file never has to wait for anyone
+    revents = POLLIN | POLLOUT;
+  }
+  return revents & events;
+}
+
+/*
+  Returns the wait queue woken when the file may have become ready,
+  0 if it never has to be waited for
+*/
+struct waitqueue*
+fileWaitQueue(struct file *file) {
+  if (file->type == FTYPE_PIPE) {
+    return &file->pipe->pollq;
+  }
+  struct inode *ip = file->inode;
+  if (ip->type == T_DEV && ip->major >= 0 && ip->major < NDEV) {
+    return devsw[ip->major].pollq;
+  }
+  return 0;
+}
+
+/*
+  Given a file descriptor maps the file at MMAPBASE (2G) and returns its
+  size. A file opened for writing is mapped shared, so the mapping and
+  the file are the same memory. Otherwise the process gets a copy of the
+  file that it can write to and that stays shared with its children.
   */
 int mmap(int fd) {
   struct proc *currentProcess = myproc();
-  struct file *file = currentProcess->oft[fd];
+  struct file *file = fdget(fd);
 
   //if the process currently has a mapped file return an error
-  if (currentProcess->mem_regions[MMAP].start != 0) {
+  if (file == 0 || file->type != FTYPE_INODE || currentProcess->mapped_file != 0) {
     return -1;
   }
 
-  acquiresleep(&file->inode->lock);
-  // allocate the appropriate pages starting at 2G that will hold the
-  // file's content
-  if (allocuvm(currentProcess->pml4, (char*)SZ_2G, 0, file->inode->size, currentProcess->pid) < 0) {
-    releasesleep(&file->inode->lock);
+  iload(file->inode);
+  uint size = file->inode->size;
+  if (size == 0) {
     return -1;
   }
 
-  // now that we have the pages allocated we need to place our file's contents in
-  // that area
-  if (loaduvm(currentProcess->pml4, (char*)SZ_2G, file->inode, 0, file->inode->size) < 0) {
-    releasesleep(&file->inode->lock);
-    return -1;
+  if (file->permissions & (O_WRONLY | O_RDWR)) {
+    if (vma_map(currentProcess, MMAPBASE, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, file->inode, 0) != MMAPBASE) {
+      return -1;
+    }
+  } else {
+    // the copy is anonymous memory, fill it from the file now
+    if (vma_map(currentProcess, MMAPBASE, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED, 0, 0) != MMAPBASE) {
+      return -1;
+    }
+    acquiresleepread(&file->inode->lock);
+    int r = readi(file->inode, (char*)MMAPBASE, 0, size);
+    releasesleepread(&file->inode->lock);
+    if (r != size) {
+      vma_unmap(currentProcess, MMAPBASE, size);
+      return -1;
+    }
   }
 
-  // set the current process's MMAP region properties appropriately
-  currentProcess->mem_regions[MMAP].start = (char*)SZ_2G;
-  currentProcess->mem_regions[MMAP].size = file->inode->size;
   currentProcess->mapped_file = file->inode;
-  releasesleep(&file->inode->lock);
-  return currentProcess->mem_regions[MMAP].size;
+  return size;
 }
 
 /*
@@ -328,23 +1055,16 @@ int mmap(int fd) {
 */
 int munmap(int fd) {
   struct proc *currentProcess = myproc();
-  struct file *file = currentProcess->oft[fd];
+  struct file *file = fdget(fd);
+  struct vma *vma;
 
   // if this is not the mapped file return an error
-  if (currentProcess->mapped_file != file->inode || currentProcess->mem_regions[MMAP].start == 0) {
+  if (file == 0 || currentProcess->mapped_file != file->inode ||
+      (vma = vma_find(currentProcess, MMAPBASE)) == 0) {
     return -1;
   }
 
-  acquiresleep(&file->inode->lock);
-  // deallocate the appropriate pages starting at 2G that will hold the
-  // file's content
-  deallocuvm(currentProcess->pml4, currentProcess->mem_regions[MMAP].start,
-    currentProcess->mem_regions[MMAP].size, 0, currentProcess->pid);
-
-  // zero out the current process's MMAP region
-  currentProcess->mem_regions[MMAP].start = 0;
-  currentProcess->mem_regions[MMAP].size = 0;
+  vma_unmap(currentProcess, vma->start, vma->size);
   currentProcess->mapped_file = NULL;
-  releasesleep(&file->inode->lock);
   return 0;
 }
@@ -16,6 +16,7 @@
 #include <proc.h>
 #include <spinlock.h>
 #include <sleeplock.h>
+#include <slab.h>
 #include <fs.h>
 #include <buf.h>
 #include <file.h>
@@ -24,8 +25,16 @@
 // only one device
 struct superblock sb;
 
+// A transaction keeps a dirty buffer pinned in the cache for each
+// block it writes until it commits, and the commit pins up to LOGBATCH
+// log slots more and the log header. A transaction may only be as big
+// as leaves room in the cache for that and for a page of swap I/O.
+#define LOGBATCH      4
+#define LOGMAXBLOCKS  (NBUF - LOGBATCH - 1 - PGSIZE/BSIZE)
+
 struct log {
   struct sleeplock lock;
+  int owner;                // pid of the process running the transaction
   struct logHeader header;
 } log;
 
@@ -73,31 +82,71 @@ readsb(int dev, struct superblock *sb)
 // freeing up space in the cache for the inode to be used again.
 
 void init_inodefile(int dev);
-void setDinodeAtBlockIndex(int index, struct buf *buf, struct dinode *dinode);
-
+static int iexpand(struct inode *ip);
+static void read_dinode(uint inum, struct dinode* dip);
+static void itrunc(struct inode *ip);
+static void ifree(uint inum);
+static uint icapacity(struct inode *ip);
+static int igrow(struct inode *ip);
+static void freeExtent(struct extent *extent);
+
+// In-memory inodes come from a slab cache and are kept on
+// icache.list. Up to NINODE of them stay cached while unreferenced;
+// past that, an inode is freed when its last reference goes, unless it
+// still has pages in the page cache.
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct slab_cache slab;
+  struct inode *list;
+  int n;              // inodes on list
   struct inode inodefile;
 } icache;
 
+// Inode allocation bitmap, one bit per inum, set when the dinode is in
+// use. It is rebuilt from the inodefile at boot, so only the dinodes
+// themselves need to be written to disk. No inum below hint is free,
+// which keeps ialloc from rescanning the allocated prefix.
+struct {
+  struct spinlock lock;
+  uchar bits[MAXINODES/8];
+  uint hint;
+} imap;
+
+static void
+imap_init(void)
+{
+  struct dinode di;
+  uint inum;
+
+  initlock(&imap.lock, "imap");
+  imap.hint = MAXINODES;
+  for(inum = 0; INODEOFF(inum) < icache.inodefile.size; inum++){
+    read_dinode(inum, &di);
+    if(di.type != 0)
+      imap.bits[inum/8] |= 1 << (inum%8);
+    else if(inum < imap.hint)
+      imap.hint = inum;
+  }
+  if(inum < imap.hint)
+    imap.hint = inum;
+}
+
 void
 iinit(int dev)
 {
-  int i = 0;
-
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
-  initsleeplock(&icache.inodefile.lock, "inodefile");
+  slab_init(&icache.slab, "inode", sizeof(struct inode));
+  initrwsleeplock(&icache.inodefile.lock, "inodefile");
   initsleeplock(&log.lock, "log");
 
   readsb(dev, &sb);
-  cprintf("sb: size %d nblocks %d bmap start %d inodestart %d\n",
-     sb.size, sb.nblocks, sb.bmapstart, sb.inodestart);
+  cprintf("sb: size %d nblocks %d bmap start %d inodestart %d log %s\n",
+     sb.size, sb.nblocks, sb.bmapstart, sb.inodestart,
+     is_ordered_log() ? "ordered" : "full");
 
+  log_recover();
   init_inodefile(dev);
+  imap_init();
 }
 
 // Find the inode file on the disk and load it into memory
@@ -107,7 +156,7 @@ init_inodefile(int dev) {
   struct buf *b;
   struct dinode di;
 
-  acquiresleep(&icache.inodefile.lock);
+  acquiresleepwrite(&icache.inodefile.lock);
   b = bread(dev, sb.inodestart);
   memmove(&di, b->data, sizeof(struct dinode));
 
@@ -119,9 +168,11 @@ init_inodefile(int dev) {
   icache.inodefile.nlink = di.nlink;
   icache.inodefile.size = di.size;
   icache.inodefile.data = di.data;
+  icache.inodefile.dflags = di.flags;
+  memmove(icache.inodefile.extents, di.extents, sizeof(di.extents));
 
   brelse(b);
-  releasesleep(&icache.inodefile.lock);
+  releasesleepwrite(&icache.inodefile.lock);
 }
 
 
@@ -132,25 +183,62 @@ init_inodefile(int dev) {
 struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, *empty, *new;
 
+  new = 0;
   acquire(&icache.lock);
+  for(;;){
+    // Is the inode already cached? An unreferenced entry that still
+    // has pages in the page cache is kept around so they can be found.
+    empty = 0;
+    for(ip = icache.list; ip; ip = ip->next){
+      if((ip->ref > 0 || ip->npages > 0) && ip->dev == dev && ip->inum == inum){
+        ip->ref++;
+        release(&icache.lock);
+        if(new)
+          slab_free(&icache.slab, new);
+        return ip;
+      }
+      if(empty == 0 && ip->ref == 0 && ip->npages == 0)    // Remember empty slot.
+        empty = ip;
+    }
+    if(empty)
+      break;
+
+    // Once the cache is full, recycle an entry, dropping its cached
+    // pages, rather than grow it.
+    if(icache.n >= NINODE){
+      for(ip = icache.list; ip; ip = ip->next){
+        if(ip->ref == 0){
+          empty = ip;
+          break;
+        }
+      }
+      if(empty){
+        pcache_drop(empty);
+        break;
+      }
+    }
 
-  // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
-      return ip;
+    if(new){
+      new->next = icache.list;
+      icache.list = new;
+      icache.n++;
+      empty = new;
+      new = 0;
+      break;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
-  }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+    // slab_alloc may sleep, so it runs without the lock; look again after
+    release(&icache.lock);
+    if((new = slab_alloc(&icache.slab)) == 0)
+      panic("iget: no inodes");
+    memset(new, 0, sizeof(*new));
+    initrwsleeplock(&new->lock, "inode");
+    acquire(&icache.lock);
+  }
+  if(new)
+    slab_free(&icache.slab, new);
 
   ip = empty;
   ip->dev = dev;
@@ -165,9 +253,9 @@ iget(uint dev, uint inum)
 static void
 read_dinode(uint inum, struct dinode* dip)
 {
-  acquiresleep(&icache.inodefile.lock);
+  acquiresleepread(&icache.inodefile.lock);
   readi(&icache.inodefile, (char *)dip, INODEOFF(inum), sizeof(*dip));
-  releasesleep(&icache.inodefile.lock);
+  releasesleepread(&icache.inodefile.lock);
 }
 
 // Increment reference count for ip.
@@ -198,6 +286,8 @@ iload(struct inode *ip)
     ip->nlink = dip.nlink;
     ip->size = dip.size;
     ip->data = dip.data;
+    ip->dflags = dip.flags;
+    memmove(ip->inlinedata, dip.inlinedata, DINLINESZ);
     ip->flags |= I_VALID;
     if(ip->type == 0)
       panic("iload: no type");
@@ -216,11 +306,31 @@ iput(struct inode *ip)
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
     release(&icache.lock);
+    int own = !is_trx();
+    if(own)
+      log_start_tx();
+    itrunc(ip);
     ip->type = 0;
+    iupdate(ip);
+    if(own)
+      log_end_tx();
+    ifree(ip->inum);
     acquire(&icache.lock);
     ip->flags = 0;
   }
   ip->ref--;
+  if(ip->ref == 0 && ip->npages == 0 && icache.n > NINODE){
+    // the cache has grown past NINODE, shrink it back
+    struct inode **pp;
+    for(pp = &icache.list; *pp; pp = &(*pp)->next){
+      if(*pp == ip){
+        *pp = ip->next;
+        icache.n--;
+        slab_free(&icache.slab, ip);
+        break;
+      }
+    }
+  }
   release(&icache.lock);
 }
 
@@ -254,8 +364,27 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  // small files live in the dinode itself
+  if(ip->dflags & DI_INLINE){
+    memmove(dst, ip->inlinedata + off, n);
+    return n;
+  }
+
+  // file data is read through the page cache
+  if(ip->type == T_FILE && ip->inum != INODEFILEINO){
+    char *pg;
+    for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+      if((pg = pcache_get(ip, off/PGSIZE)) == 0)
+        return tot > 0 ? tot : -1;
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      memmove(dst, pg + off%PGSIZE, m);
+      pcache_put(pg);
+    }
+    return n;
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, ip->data.startblkno + off/BSIZE);
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     /*
     cprintf("data off %d:\n", off);
@@ -288,23 +417,48 @@ writei(struct inode *ip, char *src, uint off, uint n)
   // then if the size of our file is larger than
   // the offset we are at and what we are reading
   // we need to increase the file size
-
-  // in our version increasing the file size does
-  // not involve extents since we do ours to have a
-  // 20 block region
   uint tot, m;
   struct buf *bp;
   if(off > ip->size || off + n < off)
     return -1;
+
+  if(ip->dflags & DI_INLINE){
+    if(off + n <= DINLINESZ){
+      // still small enough to stay in the dinode, so the only
+      // block written is the one holding the dinode
+      memmove(ip->inlinedata + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      pcache_update(ip, off, ip->inlinedata + off, n);
+      return n;
+    }
+    // the file outgrew its dinode: move it into an extent
+    if(iexpand(ip) < 0)
+      return -1;
+  }
+
+  // add extents until the write fits, or stop it at the end of the
+  // last one if the disk or the dinode runs out of room for more
+  while(off + n > icapacity(ip) * BSIZE && igrow(ip) == 0)
+    ;
+  if(off >= icapacity(ip) * BSIZE)
+    return -1;
+  if(off + n > icapacity(ip) * BSIZE)
+    n = icapacity(ip) * BSIZE - off;
   if(off + n > ip->size)
     ip->size = off + n;
 
   // loop and write data to disk block chuncks or n bytes
   // at a time depending on which is smaller
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, ip->data.startblkno + off/BSIZE);
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
+    // copy from the buffer, user memory must not fault under the cache lock
+    pcache_update(ip, off, (char*)bp->data + off%BSIZE, m);
+    if (ip->type == T_FILE && ip->inum != INODEFILEINO)
+      bp->flags |= B_DATA;
     bwrite(bp);
     brelse(bp);
   }
@@ -312,29 +466,188 @@ writei(struct inode *ip, char *src, uint off, uint n)
   // after we have written the data to disk we now also
   // need to write the data for the changed inodeFile
   // that holds meta data for the file we are writing
+  iupdate(ip);
+  return n;
+}
 
-  // create dinode and copy the metadata for the file
-  // we wrote to into it
+// Copy a modified in-memory inode to its dinode in the inodefile.
+void
+iupdate(struct inode *ip)
+{
+  struct buf *bp;
   struct dinode dinode;
+
+  memset(&dinode, 0, sizeof(dinode));
   dinode.type = ip->type;
   dinode.major = ip->major;
   dinode.minor = ip->minor;
   dinode.nlink = ip->nlink;
   dinode.size = ip->size;
-  dinode.data.startblkno = ip->data.startblkno;
-  dinode.data.nblocks = ip->data.nblocks;
-
-  // get the inodeFile and write the dinode data into the buffer
-  // flush that buffer to disk
-  struct inode *inodeFile = iget(ROOTDEV, INODEFILEINO);
-  iload(inodeFile);
-  bp = bread(inodeFile->dev, inodeFile->data.startblkno + INODEOFF(ip->inum)/BSIZE);
+  dinode.data = ip->data;
+  dinode.flags = ip->dflags;
+  memmove(dinode.inlinedata, ip->inlinedata, DINLINESZ);
+
+  // blocks of the inodefile never move once allocated
+  bp = bread(ip->dev, bmap(&icache.inodefile, INODEOFF(ip->inum)/BSIZE));
   memmove(bp->data + (uint)INODEOFF(ip->inum)%BSIZE, (char *)&dinode, sizeof(dinode));
   bwrite(bp);
   brelse(bp);
+}
+
+// Move the contents of an inline file into a newly allocated extent.
+// The caller writes the dinode.
+static int
+iexpand(struct inode *ip)
+{
+  struct buf *bp;
+
+  if(allocExtent(&ip->data, EXTENTBLKS) < 0)
+    return -1;
+
+  bp = bread(ip->dev, ip->data.startblkno);
+  memset(bp->data, 0, BSIZE);
+  memmove(bp->data, ip->inlinedata, ip->size);
+  bp->flags |= B_DATA;
+  bwrite(bp);
+  brelse(bp);
+
+  ip->dflags &= ~DI_INLINE;
+  memset(ip->inlinedata, 0, DINLINESZ);
+  return 0;
+}
+
+// Return the disk block holding block bn of the file, or 0 if the
+// file has no such block. A file's blocks are those of data followed
+// by those of each of its extents in turn.
+uint
+bmap(struct inode *ip, uint bn)
+{
+  int i;
+
+  if(bn < ip->data.nblocks)
+    return ip->data.startblkno + bn;
+  bn -= ip->data.nblocks;
+  for(i = 0; i < NEXTENTS; i++){
+    if(bn < ip->extents[i].nblocks)
+      return ip->extents[i].startblkno + bn;
+    bn -= ip->extents[i].nblocks;
+  }
+  return 0;
+}
+
+// Number of data blocks allocated to a file.
+static uint
+icapacity(struct inode *ip)
+{
+  uint n;
+  int i;
+
+  if(ip->dflags & DI_INLINE)
+    return 0;
+  n = ip->data.nblocks;
+  for(i = 0; i < NEXTENTS; i++)
+    n += ip->extents[i].nblocks;
   return n;
 }
 
+// Give a file one more extent. Each new extent is as large as the
+// whole file so far, so a file doubles every time it grows and a few
+// extents cover even the largest files. Falls back to smaller runs
+// when the disk is too fragmented for a big one.
+// The caller writes the dinode.
+static int
+igrow(struct inode *ip)
+{
+  uint want;
+  int i;
+
+  if(ip->data.nblocks == 0)
+    return allocExtent(&ip->data, EXTENTBLKS);
+
+  for(i = 0; i < NEXTENTS; i++)
+    if(ip->extents[i].nblocks == 0)
+      break;
+  if(i == NEXTENTS)
+    return -1;
+
+  want = min(icapacity(ip), (uint)BPB);
+  for(; want >= EXTENTBLKS; want /= 2)
+    if(allocExtent(&ip->extents[i], want) == 0)
+      return 0;
+  return -1;
+}
+
+// Free all data blocks of a file.
+// The caller writes the dinode.
+static void
+itrunc(struct inode *ip)
+{
+  int i;
+
+  pcache_drop(ip);
+  if(!(ip->dflags & DI_INLINE)){
+    freeExtent(&ip->data);
+    for(i = 0; i < NEXTENTS; i++)
+      freeExtent(&ip->extents[i]);
+  }
+  ip->dflags = 0;
+  memset(&ip->data, 0, sizeof(ip->data));
+  memset(ip->inlinedata, 0, DINLINESZ);
+  ip->size = 0;
+}
+
+// Allocate an inode of the given type and return its inum, or 0 if
+// every inum is taken. The lowest free inum is reused; when there is
+// none the inodefile is extended by one dinode.
+// Must be called inside a transaction.
+uint
+ialloc(uint dev, short type)
+{
+  struct dinode di;
+  uint inum;
+
+  acquire(&imap.lock);
+  for(inum = imap.hint; inum < MAXINODES; inum++)
+    if(!(imap.bits[inum/8] & (1 << (inum%8))))
+      break;
+  if(inum == MAXINODES){
+    release(&imap.lock);
+    return 0;
+  }
+  imap.bits[inum/8] |= 1 << (inum%8);
+  imap.hint = inum + 1;
+  release(&imap.lock);
+
+  memset(&di, 0, sizeof(di));
+  di.type = type;
+  di.nlink = 1;
+  if(type == T_FILE)
+    di.flags = DI_INLINE;
+
+  // every inum below the hint is in use, so a new inum is at most one
+  // past the end of the inodefile and writei can append it
+  acquiresleepwrite(&icache.inodefile.lock);
+  if(writei(&icache.inodefile, (char *)&di, INODEOFF(inum), sizeof(di)) != sizeof(di)){
+    releasesleepwrite(&icache.inodefile.lock);
+    ifree(inum);
+    return 0;
+  }
+  releasesleepwrite(&icache.inodefile.lock);
+  return inum;
+}
+
+// Return an inum to the allocation bitmap. The dinode must already
+// be marked free on disk.
+static void
+ifree(uint inum)
+{
+  acquire(&imap.lock);
+  imap.bits[inum/8] &= ~(1 << (inum%8));
+  if(inum < imap.hint)
+    imap.hint = inum;
+  release(&imap.lock);
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -373,6 +686,30 @@ dirlookup(struct inode *dp, char *name, uint *poff)
   return 0;
 }
 
+// Write a new directory entry (name, inum) into the directory dp,
+// reusing the slot of a removed entry if there is one.
+// Must be called inside a transaction with dp locked.
+int
+dirlink(struct inode *dp, char *name, uint inum)
+{
+  uint off;
+  struct dirent de;
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirlink read");
+    if(de.inum == 0)
+      break;
+  }
+
+  memset(&de, 0, sizeof(de));
+  strncpy(de.name, name, DIRSIZ);
+  de.inum = inum;
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    return -1;
+  return 0;
+}
+
 
 //PAGEBREAK!
 // Paths
@@ -465,40 +802,58 @@ nameiparent(char *path, char *name)
   return namex(path, 1, name);
 }
 
-void
-setBitmapWithDinode(struct dinode *dinode) {
-  // loop through the inode region starting at the start of the
-  // inode region on disk
-  for (int i = sb.inodestart + 20000; i < FSSIZE; i++) {
-    uint block =  BBLOCK(i, sb);
+// Find a run of nblocks free data blocks, mark them allocated
+// in the bitmap and store the run in *extent.
+// Returns -1 if there is no such run left.
+int
+allocExtent(struct extent *extent, uint nblocks) {
+  // loop through the data region, the bitmap already marks the
+  // metadata and the start of the inode file as used
+  for (int i = sb.inodestart; i + nblocks <= FSSIZE; i++) {
+    uint block = BBLOCK(i, sb);
+    if (BBLOCK(i + nblocks - 1, sb) != block)
+      continue;
+
     struct buf *buf = bread(ROOTDEV, block);
-    int found = 0;
-    if (!(buf->data[(i%BPB)/8] & (1 << (i % 8)))) {
-      for (int j = i; j < i + 20; j++) {
-        if ((buf->data[(j%BPB)/8] & (1 << (j % 8))) != 0) {
-          found = 1;
-          break;
-        }
+    int found = 1;
+    for (int j = i; j < i + nblocks; j++) {
+      if ((buf->data[(j%BPB)/8] & (1 << (j % 8))) != 0) {
+        // no run can start before the used block
+        found = 0;
+        i = j;
+        break;
       }
-      if (found == 0) {
-        setDinodeAtBlockIndex(i, buf, dinode);
-        return;
+    }
+    if (found) {
+      for (int j = i; j < i + nblocks; j++) {
+        buf->data[(j%BPB)/8] |= (1 << (j % 8));
       }
+      bwrite(buf);
+      brelse(buf);
+      extent->startblkno = i;
+      extent->nblocks = nblocks;
+      return 0;
     }
-
     brelse(buf);
   }
+  return -1;
 }
 
-void
-setDinodeAtBlockIndex(int index, struct buf *buf, struct dinode *dinode) {
-  dinode->data.startblkno = index;
-  dinode->data.nblocks = 20;
-  for (int j = index; j < index + 20; j++) {
-    buf->data[(j%BPB)/8] |= (1 << (j % 8));
+// Mark the blocks of an extent free in the bitmap.
+static void
+freeExtent(struct extent *extent) {
+  uint i = extent->startblkno;
+  uint end = extent->startblkno + extent->nblocks;
+
+  while (i < end) {
+    uint block = BBLOCK(i, sb);
+    struct buf *buf = bread(ROOTDEV, block);
+    for (; i < end && BBLOCK(i, sb) == block; i++) {
+      buf->data[(i%BPB)/8] &= ~(1 << (i % 8));
+    }
+    bwrite(buf);
+    brelse(buf);
   }
-  bwrite(buf);
-  brelse(buf);
 }
 
 void
@@ -506,43 +861,160 @@ log_start_tx() {
   acquiresleep(&log.lock);
   log.header.nblocks = 0;
   log.header.valid = 0;
+  log.owner = myproc()->pid;
   trx_in_progress = 1;
 }
 
+// Write the in memory log header to the header block of the log.
+static void
+write_log_header(struct logHeader *header) {
+  struct buf *bp = bread(ROOTDEV, getLogStart());
+  memmove(bp->data, header, sizeof(struct logHeader));
+  bp->flags |= B_DIRTY;
+  iderw(bp);
+  brelse(bp);
+}
+
+// crc32 of n bytes at p, continuing from crc.
+static uint
+crc32(uint crc, uchar *p, uint n) {
+  crc = ~crc;
+  while (n-- > 0) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++)
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+// Checksum of a transaction: its home block numbers followed by
+// the contents of its log blocks.
+static uint
+log_checksum(struct logHeader *header, struct buf **logBlocks) {
+  uint crc = crc32(0, (uchar *)header->writeLocation, header->nblocks * sizeof(uint));
+  for (int i = 0; i < header->nblocks; i++)
+    crc = crc32(crc, logBlocks[i]->data, BSIZE);
+  return crc;
+}
+
+// Commit the running transaction: copy each logged block from its
+// dirty home buffer into its log slot and queue the slot for the
+// disk, with at most LOGBATCH slots in flight, then queue the header
+// with valid set behind the last of them and wait for them all. The
+// checksum in the header lets recovery tell a torn commit from a
+// complete one, so the header does not have to wait for the log
+// blocks.
+static void
+log_commit() {
+  struct buf *inflight[LOGBATCH];
+  struct buf *b, *home, *headerBuf;
+  uint logstart = getLogStart();
+  uint crc;
+  int i;
+
+  crc = crc32(0, (uchar *)log.header.writeLocation, log.header.nblocks * sizeof(uint));
+  for (i = 0; i < log.header.nblocks; i++) {
+    // the slot queued LOGBATCH blocks ago gives its place up
+    if (i >= LOGBATCH) {
+      iderw_wait(inflight[i % LOGBATCH]);
+      brelse(inflight[i % LOGBATCH]);
+    }
+    home = bread(ROOTDEV, log.header.writeLocation[i]);
+    b = bget(ROOTDEV, logstart + 1 + i);
+    memmove(b->data, home->data, BSIZE);
+    brelse(home);
+    crc = crc32(crc, b->data, BSIZE);
+    b->flags |= B_VALID | B_DIRTY;
+    iderw_async(b);
+    inflight[i % LOGBATCH] = b;
+  }
+
+  log.header.checksum = crc;
+  log.header.valid = 1;
+  headerBuf = bread(ROOTDEV, logstart);
+  memmove(headerBuf->data, &log.header, sizeof(struct logHeader));
+  headerBuf->flags |= B_DIRTY;
+  iderw_async(headerBuf);
+
+  for (i = max(0, (int)log.header.nblocks - LOGBATCH); i < log.header.nblocks; i++) {
+    iderw_wait(inflight[i % LOGBATCH]);
+    brelse(inflight[i % LOGBATCH]);
+  }
+  iderw_wait(headerBuf);
+  brelse(headerBuf);
+}
+
+// Write the committed blocks from their home buffers to their home
+// locations, which unpins the buffers.
+static void
+log_install(struct logHeader *header) {
+  for (int i = 0; i < header->nblocks; i++) {
+    struct buf *b = bread(ROOTDEV, header->writeLocation[i]);
+    if (b->flags & B_DIRTY)
+      iderw(b);
+    brelse(b);
+  }
+  header->valid = 0;
+  header->nblocks = 0;
+}
+
 void
 log_end_tx() {
   // end transaction
-  // set commit message
   trx_in_progress = 0;
-  log.header.valid = 1;
 
-  // write commit message to disk
-  struct inode *logHeader = iget(ROOTDEV, getLogStart());
-  iload(logHeader);
-  acquiresleep(&logHeader->lock);
-  struct buf *bp = bread(logHeader->dev, logHeader->data.startblkno);
-  memmove(bp->data, &log.header, sizeof(struct logHeader));
-  bwrite(bp);
-  brelse(bp);
-  releasesleep(&logHeader->lock);
+  if (log.header.nblocks > 0) {
+    // writing the log and the header with valid set is the commit
+    // point (in ordered mode every data block is already at its home
+    // location by now)
+    log_commit();
 
-  // loop through the log and write every thing to disk
-  // same action as the recover step
-  // clear commit message on successful completeion
-  // set nblocks to 0
-  write_log_to_disk(&log.header);
+    // install the logged blocks at their home locations, then clear
+    // the commit message
+    log_install(&log.header);
+    write_log_header(&log.header);
+  }
   releasesleep(&log.lock);
 }
 
+// Replay a committed transaction that was not completely installed
+// before a crash. A transaction whose checksum does not match was
+// torn by the crash and is discarded. Called once at boot before the
+// file system is used.
 void
 log_recover() {
-  // get header from disk and then
-  // pass that to write log to disk method
+  struct logHeader header;
+  struct buf *logBlocks[NELEM(header.writeLocation)];
+  uint logstart = getLogStart();
+
+  struct buf *bp = bread(ROOTDEV, logstart);
+  memmove(&header, bp->data, sizeof(struct logHeader));
+  brelse(bp);
+
+  if (!header.valid)
+    return;
+
+  int intact = header.nblocks <= sb.logsize - 1 && header.nblocks <= NELEM(header.writeLocation);
+  if (intact) {
+    for (int i = 0; i < header.nblocks; i++)
+      logBlocks[i] = bread(ROOTDEV, logstart + 1 + i);
+    intact = log_checksum(&header, logBlocks) == header.checksum;
+    for (int i = 0; i < header.nblocks; i++)
+      brelse(logBlocks[i]);
+  }
+
+  if (intact) {
+    write_log_to_disk(&header);
+  } else {
+    cprintf("log: discarding torn transaction\n");
+    header.valid = 0;
+    header.nblocks = 0;
+  }
+  write_log_header(&header);
 }
 
 void
 write_log_to_disk(struct logHeader *header) {
-  // need to get header from disk
   uint logstart = getLogStart();
   for (int i = 0; i < header->nblocks; i++) {
     int blockToWrite = header->writeLocation[i];
@@ -552,9 +1024,24 @@ write_log_to_disk(struct logHeader *header) {
   header->nblocks = 0;
 }
 
+// Only the process that started the transaction writes through the
+// log; writes from anyone else (e.g. swap) go straight to disk.
 int
 is_trx() {
-  return trx_in_progress;
+  return trx_in_progress && myproc() != 0 && myproc()->pid == log.owner;
+}
+
+// In ordered mode only metadata is journaled.
+int
+is_ordered_log() {
+  return sb.logmode == LOG_ORDERED;
+}
+
+// Swap space is not part of the file system and never goes through
+// the log, even when a page fault inside a transaction evicts a page.
+int
+is_swap_block(uint blockno) {
+  return blockno >= sb.swapstart && blockno < sb.swapstart + sb.swapsize;
 }
 
 int
@@ -562,9 +1049,20 @@ getBlocksInLog() {
   return log.header.nblocks;
 }
 
-void addNewWriteLocationToLog(uint blockno) {
+// Record blockno in the log header and return the log slot that
+// holds its contents. A block written twice in one transaction
+// reuses its slot.
+uint
+addNewWriteLocationToLog(uint blockno) {
+  for (uint i = 0; i < log.header.nblocks; i++) {
+    if (log.header.writeLocation[i] == blockno)
+      return i;
+  }
+  if (log.header.nblocks >= sb.logsize - 1 || log.header.nblocks >= LOGMAXBLOCKS ||
+      log.header.nblocks >= NELEM(log.header.writeLocation))
+    panic("log: transaction too big");
   log.header.writeLocation[log.header.nblocks] = blockno;
-  log.header.nblocks++;
+  return log.header.nblocks++;
 }
 
 struct logHeader*
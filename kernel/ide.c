@@ -32,6 +32,11 @@
 static struct spinlock idelock;
 static struct buf *idequeue;
 
+// sys_crashn: once crashn more writes have been queued, the next one
+// crashes the machine.
+int crashn_enable = 0;
+int crashn = 0;
+
 static int havedisk1;
 static void idestart(struct buf*);
 
@@ -132,12 +137,25 @@ ideintr(void)
   release(&idelock);
 }
 
+// sys_crashn ran out on the write of b: write b and bring the machine
+// down. Requests queued behind the one in progress never reach the
+// disk, as with a disk that reorders writes, so b may land without
+// writes queued before it. Caller holds idelock.
+static void
+crashwrite(struct buf *b)
+{
+  idewait(0);  // the request in progress finishes
+  idestart(b);
+  idewait(0);
+  reboot();
+}
+
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Queue b for the disk and return without waiting for the
+// request to finish; iderw_wait() waits for it. Lets a caller
+// put several buffers in flight at once.
 void
-iderw(struct buf *b)
+iderw_async(struct buf *b)
 {
   struct buf **pp;
 
@@ -150,6 +168,9 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
+  if(crashn_enable && (b->flags & B_DIRTY) && --crashn < 0)
+    crashwrite(b);
+
   // Append b to idequeue.
   b->qnext = 0;
   for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
@@ -160,10 +181,26 @@ iderw(struct buf *b)
   if(idequeue == b)
     idestart(b);
 
-  // Wait for request to finish.
+  release(&idelock);
+}
+
+// Wait for a request queued by iderw_async() to finish.
+void
+iderw_wait(struct buf *b)
+{
+  acquire(&idelock);
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
-
   release(&idelock);
-}
\ No newline at end of file
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  iderw_async(b);
+  iderw_wait(b);
+}
@@ -7,6 +7,7 @@
 #include <param.h>
 #include <memlayout.h>
 #include <mmu.h>
+#include <x86_64.h>
 #include <e820.h>
 #include <spinlock.h>
 #include <sleeplock.h>
@@ -15,6 +16,10 @@
 #include <buf.h>
 
 #define NDISKPAGES 8192
+#define SWAPSTART 2         // first disk block of the swap area
+#define SWAP_CLUSTER 4      // pages evictPage writes out together
+#define SWAP_READAHEAD 3    // slots after a faulting one swapPageIn reads too
+#define CLEAN_LOOKAHEAD 8   // pages past the hand findPageToEvict checks for a clean one
 
 int npages = 0;
 int pages_in_use;
@@ -24,6 +29,36 @@ int free_pages;
 struct core_map_entry *core_map = NULL;
 struct swap_map_entry swap_core_map[NDISKPAGES];
 
+// Swap slots are handed out from a bitmap, next fit from swapHint,
+// so slots allocated one after another, or together as a run, end up
+// next to each other on disk. Protected by kmem.lock.
+uint64_t swapBitmap[NDISKPAGES / 64];
+int swapHint;
+
+// A page read back from its swap slot on disk keeps the slot, and the
+// two point at each other through core_map_entry.swap and
+// swap_map_entry.cached, for as long as the page is not written: the
+// swap cache. Evicting the page again then needs no write, and a PTE
+// still pointing at the slot maps the same page instead of reading
+// another copy. The slot is let go when a PTE that wrote the page
+// (PTE_D) is evicted or unmapped, when the page is freed, or when
+// evictPage runs out of slots.
+//
+// evictPage points the PTEs of a page at its new slot before it
+// stores the page, so no process can write the page while it is being
+// compressed or written; until it is stored, swap_map_entry.pageout is
+// set and a fault on the slot waits for it.
+//
+// Swapped out pages that compress well are kept in the compressed
+// pool (zswap.c) and their PTEs have PTE_ZSW set as well as PTE_DSK.
+// They still own a swap slot, and when the pool is full evictPage
+// moves them to it on disk through buf, one at a time, to make room.
+struct {
+  struct sleeplock lock;
+  int hand;  // where zswapDemote continues its scan
+  char buf[PGSIZE];
+} zdemote;
+
 struct core_map_entry*
 pa2page(uint64_t pa)
 {
@@ -67,12 +102,58 @@ detect_memory(void)
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Free memory is kept by a buddy allocator: a free block of 2^k pages
+// starts at a page number that is a multiple of 2^k and sits on
+// kmem.freelist[k], linked through next/prev of its first page. A
+// block is allocated by splitting the smallest free block that is big
+// enough, and a freed block is merged with its buddy, the other half
+// of the block of twice its size, for as long as the buddy is free.
 struct {
   struct spinlock lock;
   int use_lock;
-  struct core_map_entry *freelist;
+  struct core_map_entry *freelist[MAXORDER + 1];
 } kmem;
 
+// Each CPU keeps a magazine of free pages of its own, so most
+// kalloc/kfree calls never take kmem.lock. An empty magazine is
+// refilled from the buddy allocator and a full one gives pages back,
+// KMAG_BATCH pages per trip to the lock. A magazine is only touched
+// by its CPU with interrupts off.
+#define KMAG_SIZE  64
+#define KMAG_BATCH 32
+
+struct kmag {
+  struct core_map_entry *pages;  // linked through next
+  int n;
+} kmags[NCPU];
+
+// Pages zeroed ahead of time by the idle loop for kalloc_zeroed.
+// They count as free: kalloc takes them too before it evicts a page.
+#define KZERO_MAX 64
+
+struct {
+  struct spinlock lock;
+  struct core_map_entry *pages;  // linked through next
+  int n;
+} kzero;
+
+// kswapd evicts pages in the background so that allocations rarely
+// have to. kalloc wakes it when free_pages drops below low, and it
+// evicts until free_pages is back at high.
+struct {
+  int started;
+  int low;
+  int high;
+} kswapd;
+
+// Wake kswapd if free memory is low.
+static void
+kswapd_check(void)
+{
+  if (kswapd.started && free_pages < kswapd.low)
+    wakeup(&kswapd);
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -88,12 +169,15 @@ mem_init(void *vstart)
   vstart += PGROUNDUP(npages * sizeof (struct core_map_entry));
 
   initlock(&kmem.lock, "kmem");
+  initlock(&kzero.lock, "kzero");
+  initsleeplock(&zdemote.lock, "zdemote");
   kmem.use_lock = 0;
-  kmem.freelist = 0;
 
   vend = (void *) P2V((uint64_t)(npages * PGSIZE));
   freerange(vstart, vend);
   free_pages = (vend - vstart) >> PT_SHIFT;
+  kswapd.low = max(free_pages / 64, 16);
+  kswapd.high = 2 * kswapd.low;
   pages_in_use = 0;
   pages_in_swap = 0;
   kmem.use_lock = 1;
@@ -108,6 +192,160 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+// Put a free block of 2^order pages on its free list.
+// Caller holds kmem.lock.
+static void
+buddy_push(struct core_map_entry *r, int order)
+{
+  r->order = order;
+  r->flags |= CM_BUDDY;
+  r->prev = 0;
+  r->next = kmem.freelist[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.freelist[order] = r;
+}
+
+// Take a free block off its free list. Caller holds kmem.lock.
+static void
+buddy_remove(struct core_map_entry *r)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[r->order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  r->flags &= ~CM_BUDDY;
+  r->next = 0;
+  r->prev = 0;
+}
+
+// Allocate a block of 2^order pages, splitting a larger block if
+// there is no free one that size. Caller holds kmem.lock.
+// Returns 0 if there is no block big enough.
+static struct core_map_entry*
+buddy_alloc(int order)
+{
+  struct core_map_entry *r;
+  int k;
+
+  for(k = order; k <= MAXORDER && kmem.freelist[k] == 0; k++)
+    ;
+  if(k > MAXORDER)
+    return 0;
+
+  r = kmem.freelist[k];
+  buddy_remove(r);
+  // the upper halves go back on the free lists
+  while(k > order) {
+    k--;
+    buddy_push(r + (1 << k), k);
+  }
+  return r;
+}
+
+// Free a block of 2^order pages, merging it with its buddy as long
+// as that is free too. Caller holds kmem.lock.
+static void
+buddy_free(struct core_map_entry *r, int order)
+{
+  uint64_t pn, buddy;
+
+  pn = r - core_map;
+  while(order < MAXORDER) {
+    buddy = pn ^ (1 << order);
+    if(buddy >= npages || !(core_map[buddy].flags & CM_BUDDY) ||
+       core_map[buddy].order != order)
+      break;
+    buddy_remove(&core_map[buddy]);
+    pn &= ~(1UL << order);
+    order++;
+  }
+  buddy_push(&core_map[pn], order);
+}
+
+// Move pages of magazine m back to the buddy allocator until only
+// keep are left. Caller holds kmem.lock.
+static void
+kmag_drain(struct kmag *m, int keep)
+{
+  struct core_map_entry *r;
+
+  while(m->n > keep) {
+    r = m->pages;
+    m->pages = r->next;
+    m->n--;
+    buddy_free(r, 0);
+  }
+}
+
+// Take a free page from this CPU's magazine, refilling it from
+// the buddy allocator if it is empty. Returns 0 if there are no free pages.
+static struct core_map_entry*
+kmag_get(void)
+{
+  struct kmag *m;
+  struct core_map_entry *r;
+
+  pushcli();
+  m = &kmags[mycpu() - cpus];
+  if(m->n == 0) {
+    acquire(&kmem.lock);
+    while(m->n < KMAG_BATCH && (r = buddy_alloc(0)) != 0) {
+      r->next = m->pages;
+      m->pages = r;
+      m->n++;
+    }
+    release(&kmem.lock);
+  }
+  if((r = m->pages) != 0) {
+    m->pages = r->next;
+    m->n--;
+  }
+  popcli();
+  return r;
+}
+
+// Put a free page in this CPU's magazine, first giving a batch of
+// pages back to the buddy allocator if it is full.
+static void
+kmag_put(struct core_map_entry *r)
+{
+  struct kmag *m;
+
+  pushcli();
+  m = &kmags[mycpu() - cpus];
+  if(m->n == KMAG_SIZE) {
+    acquire(&kmem.lock);
+    kmag_drain(m, KMAG_SIZE - KMAG_BATCH);
+    release(&kmem.lock);
+  }
+  r->next = m->pages;
+  m->pages = r;
+  m->n++;
+  popcli();
+}
+
+// Clear the bookkeeping of a page that is being freed.
+static void
+kfree_reset(struct core_map_entry *r)
+{
+#if KALLOC_DEBUG
+  // Fill with junk to catch dangling refs.
+  memset(P2V(page2pa(r)), 2, PGSIZE);
+#endif
+
+  r->pid = -1;
+  r->va = 0;
+  r->inode = 0;
+  r->refCount = 0;
+  rmap_clear(&r->rmap);
+  if (r->swap) {
+    releaseSwapCache(page2pa(r));
+  }
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -121,207 +359,851 @@ kfree(char *v)
   if((uint64_t)v % PGSIZE || v < _end || V2P(v) >= (uint64_t)(npages * PGSIZE))
     panic("kfree");
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-
   r = (struct core_map_entry*)pa2page(V2P(v));
-  if (r->refCount > 0) {
-    r->refCount--;
-  }
+  // only the last reference frees the page
+  if (r->refCount > 0 && __sync_sub_and_fetch(&r->refCount, 1) > 0)
+    return;
 
-  if (r->refCount > 0) {
-    if(kmem.use_lock)
-      release(&kmem.lock);
+  __sync_fetch_and_sub(&pages_in_use, 1);
+  __sync_fetch_and_add(&free_pages, 1);
+  kfree_reset(r);
+  if(!kmem.use_lock) {
+    // still in mem_init
+    buddy_free(r, 0);
     return;
   }
+  kmag_put(r);
+}
 
-  pages_in_use --;
-  free_pages ++;
+// Allocate 2^order physically contiguous pages, aligned to their
+// size. Every page of the block starts out with one reference, but
+// only the one on the first page counts: kfree_pages drops it and
+// frees the whole block.
+// Returns 0 if there is no free block that large.
+char*
+kalloc_pages(int order)
+{
+  struct core_map_entry *r;
+  int i;
 
-  // Fill with junk to catch dangling refs.
-  memset(v, 2, PGSIZE);
+  if(order == 0)
+    return kalloc();
+  if(order < 0 || order > MAXORDER)
+    return 0;
 
-  r->pid = -1;
-  r->va = 0;
-  r->next = kmem.freelist;
-  r->refCount = 0;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  acquire(&kmem.lock);
+  if((r = buddy_alloc(order)) == 0) {
+    // pages parked in this CPU's magazine may complete a block
+    pushcli();
+    kmag_drain(&kmags[mycpu() - cpus], 0);
+    popcli();
+    r = buddy_alloc(order);
+  }
+  release(&kmem.lock);
+  if(r == 0)
+    return 0;
+
+  for(i = 0; i < (1 << order); i++)
+    r[i].refCount = 1;
+  __sync_fetch_and_add(&pages_in_use, 1 << order);
+  __sync_fetch_and_sub(&free_pages, 1 << order);
+  kswapd_check();
+  return P2V(page2pa(r));
 }
 
+// Drop a reference to a block returned by kalloc_pages(order),
+// freeing it if it was the last one.
 void
-add_phy_mem_map(int pid, uint64_t va, uint64_t pa) {
+kfree_pages(char *v, int order)
+{
+  struct core_map_entry *r;
+  int i;
+
+  if(order == 0) {
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || V2P(v) % ((uint64_t)PGSIZE << order) ||
+     V2P(v) + ((uint64_t)PGSIZE << order) > (uint64_t)npages * PGSIZE)
+    panic("kfree_pages");
+
+  r = pa2page(V2P(v));
+  if (r->refCount > 0 && __sync_sub_and_fetch(&r->refCount, 1) > 0)
+    return;
+
+  for(i = 0; i < (1 << order); i++)
+    kfree_reset(&r[i]);
+  __sync_fetch_and_sub(&pages_in_use, 1 << order);
+  __sync_fetch_and_add(&free_pages, 1 << order);
+
+  acquire(&kmem.lock);
+  buddy_free(r, order);
+  release(&kmem.lock);
+}
+
+// Returns 0, or -1 if out of memory.
+int
+add_phy_mem_map(pml4e_t *pml4, int pid, uint64_t va, uint64_t pa) {
   // check if it is a kernal mem map
   if (pid == -1)
-    return;
+    return 0;
 
   // for user mem, add an mapping to proc_info
   struct core_map_entry *r = pa2page(pa);
 
   r->pid = pid;
   r->va = va;
+  return rmap_add(&r->rmap, pml4, va);
 }
 
 void
-remove_phy_mem_map(int pid, uint64_t va, uint64_t pa) {
+remove_phy_mem_map(pml4e_t *pml4, int pid, uint64_t va, uint64_t pa) {
   // check if it is a kernal mem map
   if (pid == -1)
     return;
 
-  // for user mem, add an mapping to proc_info
   struct core_map_entry *r = pa2page(pa);
 
-  r->pid = -1;
-  r->va = 0;
+  rmap_remove(&r->rmap, pml4, va);
+  // processes the page was shared with may still map it
+  if (r->rmap == 0) {
+    r->pid = -1;
+    r->va = 0;
+  }
+}
+
+// The reclaim thread. It can miss a wakeup between checking
+// free_pages and going to sleep, but the next allocation wakes it
+// again.
+static void
+kswapd_run(void)
+{
+  for (;;) {
+    acquire(&kmem.lock);
+    while (free_pages >= kswapd.low)
+      sleep(&kswapd, &kmem.lock);
+    release(&kmem.lock);
+
+    while (free_pages < kswapd.high) {
+      if (evictPage() == -1) {
+        // nothing left to evict; give it time before trying again
+        acquire(&kmem.lock);
+        sleep(&kswapd, &kmem.lock);
+        release(&kmem.lock);
+        break;
+      }
+    }
+  }
+}
+
+void
+kswapdinit(void)
+{
+  kthread("kswapd", kswapd_run);
+  kswapd.started = 1;
 }
 
+// Take a page from the pre-zeroed pool, 0 if it is empty.
+static struct core_map_entry*
+kzero_get(void)
+{
+  struct core_map_entry *r;
 
+  if(kzero.pages == 0)
+    return 0;
+  acquire(&kzero.lock);
+  if((r = kzero.pages) != 0) {
+    kzero.pages = r->next;
+    kzero.n--;
+  }
+  release(&kzero.lock);
+  return r;
+}
 
 char*
 kalloc(void)
 {
-  pages_in_use ++;
-  free_pages --;
+  struct core_map_entry *r;
 
+  // when there is no free page, evict a page and try again
+  while((r = kmag_get()) == 0 && (r = kzero_get()) == 0) {
+    if (evictPage() == -1) {
+      return 0;
+    }
+  }
+  r->refCount = 1;
+  __sync_fetch_and_add(&pages_in_use, 1);
+  __sync_fetch_and_sub(&free_pages, 1);
+  kswapd_check();
+  return P2V(page2pa(r));
+}
+
+// Allocate a page filled with zeroes, from the pool the idle loop
+// keeps if it has one.
+char*
+kalloc_zeroed(void)
+{
   struct core_map_entry *r;
+  char *mem;
 
+  if((r = kzero_get()) == 0) {
+    if((mem = kalloc()) != 0)
+      memset(mem, 0, PGSIZE);
+    return mem;
+  }
+  r->refCount = 1;
+  __sync_fetch_and_add(&pages_in_use, 1);
+  __sync_fetch_and_sub(&free_pages, 1);
+  kswapd_check();
+  return P2V(page2pa(r));
+}
+
+// Called by the scheduler when it has nothing to run: zero a free
+// page for kalloc_zeroed, unless the pool is full.
+void
+kzero_idle(void)
+{
+  struct core_map_entry *r;
+
+  if(kzero.n >= KZERO_MAX || (r = kmag_get()) == 0)
+    return;
+  memset(P2V(page2pa(r)), 0, PGSIZE);
+  acquire(&kzero.lock);
+  r->next = kzero.pages;
+  kzero.pages = r;
+  kzero.n++;
+  release(&kzero.lock);
+}
+
+// Allocate a run of n free swap slots next to each other. A run does
+// not wrap around the end of the swap area. Caller holds kmem.lock.
+// Returns the first slot of the run, -1 if there is no such run.
+static int
+allocSwapSlots(int n) {
+  int i = swapHint, first = 0, run = 0;
+
+  for (int scanned = 0; scanned < NDISKPAGES + n; scanned++, i++) {
+    if (i == NDISKPAGES) {
+      i = 0;
+      run = 0;
+    }
+    if (run == 0 && i % 64 == 0 && swapBitmap[i / 64] == ~0ULL) {
+      // skip a full word
+      i += 63;
+      scanned += 63;
+      continue;
+    }
+    if (swapBitmap[i / 64] & (1ULL << (i % 64))) {
+      run = 0;
+      continue;
+    }
+    if (run++ == 0) {
+      first = i;
+    }
+    if (run == n) {
+      for (i = first; i < first + n; i++) {
+        swapBitmap[i / 64] |= 1ULL << (i % 64);
+      }
+      pages_in_swap += n;
+      swapHint = (first + n) % NDISKPAGES;
+      return first;
+    }
+  }
+  return -1;
+}
+
+// Give a swap slot back. Caller holds kmem.lock.
+static void
+freeSwapSlot(int index) {
+  swapBitmap[index / 64] &= ~(1ULL << (index % 64));
+  pages_in_swap--;
+}
+
+// Swap slot index is no longer used: clear its entry and give back
+// the slot and its space in the compressed pool. While zswapDemote or
+// evictPage is writing the slot it keeps both, and gives them back
+// when it is done. Caller holds kmem.lock.
+static void
+releaseSwapSlot(int index) {
+  struct swap_map_entry *s = &swap_core_map[index];
+
+  if (s->zswapped && !s->writing) {
+    zswap_free(s->zchunk, s->zlen);
+  }
+  if (!s->writing && !s->pageout) {
+    freeSwapSlot(index);
+  }
+  if (s->cached) {
+    s->cached->swap = 0;
+    s->cached = 0;
+  }
+  s->va = 0;
+  s->pid = 0;
+  s->refCount = 0;
+  s->in_use = 0;
+  s->zswapped = 0;
+}
+
+// Take page r out of the swap cache. Its slot is freed unless a PTE
+// still points at it. Caller holds kmem.lock.
+static void
+swapCacheDrop(struct core_map_entry *r) {
+  struct swap_map_entry *s = r->swap;
+
+  r->swap = 0;
+  s->cached = 0;
+  if (s->refCount <= 0) {
+    releaseSwapSlot(s - swap_core_map);
+  }
+}
+
+// Page pa was written, or is being freed, so the copy in its swap
+// slot is of no more use.
+void
+releaseSwapCache(uint64_t pa) {
+  struct core_map_entry *r = pa2page(pa);
+
+  if (r->swap == 0) {
+    return;
+  }
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r) {
-    kmem.freelist = r->next;
-    r->refCount = 1;
-    if(kmem.use_lock) {
-      release(&kmem.lock);
-    }
+  if (r->swap) {
+    swapCacheDrop(r);
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
 
-    return P2V(page2pa(r));
-  } else {
-    // we need to evict a page, free that page
-    // then return that newly freed page
-    if(kmem.use_lock) {
-      release(&kmem.lock);
+// Free the slots of every page in the swap cache, for when evictPage
+// runs out of slots. Caller holds kmem.lock. Returns how many slots
+// were freed.
+static int
+shrinkSwapCache(void) {
+  int freed = 0;
+
+  for (int i = 0; i < NDISKPAGES; i++) {
+    if (swap_core_map[i].cached && swap_core_map[i].refCount <= 0) {
+      swapCacheDrop(swap_core_map[i].cached);
+      freed++;
     }
-    if (evictPage() == -1) {
-      return 0;
+  }
+  return freed;
+}
+
+// returns a free index in the swap_core_map
+// for which we can evict the physical
+// memory page to
+int
+getFreeDiskPageIndex() {
+  int index;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  index = allocSwapSlots(1);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return index;
+}
+
+// Write n pages to, or read them from, the n swap slots starting at
+// first. The slots are next to each other on disk, so the blocks go
+// to the disk as one sequential run, a page of blocks in flight at a
+// time.
+static void
+swapIO(int first, char **pages, int n, int write) {
+  struct buf *bufs[PGSIZE / BSIZE];
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < PGSIZE / BSIZE; j++) {
+      struct buf *b = bget(ROOTDEV, SWAPSTART + (first + i) * (PGSIZE / BSIZE) + j);
+      if (write) {
+        memmove(b->data, pages[i] + BSIZE * j, BSIZE);
+        b->flags |= B_DIRTY;
+        iderw_async(b);
+      } else if (!(b->flags & B_VALID)) {
+        num_disk_reads += 1;
+        iderw_async(b);
+      }
+      bufs[j] = b;
     }
-    if(kmem.use_lock) {
-      acquire(&kmem.lock);
+    for (int j = 0; j < PGSIZE / BSIZE; j++) {
+      iderw_wait(bufs[j]);
+      if (!write)
+        memmove(pages[i] + BSIZE * j, bufs[j]->data, BSIZE);
+      brelse(bufs[j]);
     }
+  }
+}
 
-    r = kmem.freelist;
-    kmem.freelist = r->next;
-    r->refCount = 1;
-    if(kmem.use_lock) {
-      release(&kmem.lock);
-    }
+struct swapOutArg {
+  uint64_t pa;
+  int swapIndex;
+  uint64_t flags;  // PTE_DSK, and PTE_ZSW if the page is in the pool
+  int n;
+};
+
+// rmap_walk callback of evictPage: point a PTE of the page at its
+// swap slot.
+static void
+unmapToSwap(pml4e_t *pml4, pte_t *pte, void *arg) {
+  struct swapOutArg *a = arg;
 
-    return P2V(page2pa(r));
+  if ((*pte & PTE_P) && PTE_ADDR(*pte) == a->pa) {
+    *pte = PTE_FLAGS(*pte);
+    *pte &= ~(PTE_P);
+    *pte |= a->flags;
+    *pte |= (uint64_t)a->swapIndex << PT_SHIFT;
+    a->n++;
+    // only this CPU runs processes, and it loads a fresh TLB with
+    // every other page table
+    if (myproc() != 0 && pml4 == myproc()->pml4)
+      lcr3(V2P(pml4));
   }
+}
 
-  if(kmem.use_lock) {
-    release(&kmem.lock);
+// rmap_walk callback undoing unmapToSwap: point a PTE back at the
+// page.
+static void
+remapPage(pml4e_t *pml4, pte_t *pte, void *arg) {
+  struct swapOutArg *a = arg;
+
+  if (!(*pte & PTE_P) && (*pte & PTE_DSK) && (*pte >> PT_SHIFT) == a->swapIndex) {
+    *pte = PTE(a->pa, PTE_FLAGS(*pte) | PTE_P);
+    *pte &= ~(PTE_DSK | PTE_ZSW);
   }
+}
 
+// Point every PTE of page r at swap slot arg->swapIndex, with the
+// flags in arg. That only frees the page if the PTEs hold all of its
+// references; if something else holds one too, e.g. a process that is
+// just mapping or unmapping the page, the PTEs are pointed back at the
+// page and -1 is returned. Otherwise arg->n says how many PTEs there
+// were, and their references are the slot's now, except for one the
+// caller drops with kfree. Caller holds kmem.lock.
+static int
+unmapToSlot(struct core_map_entry *r, struct swapOutArg *arg) {
+  rmap_walk(&r->rmap, unmapToSwap, arg);
+  if (arg->n == 0) {
+    return -1;
+  }
+  if (arg->n != r->refCount) {
+    rmap_walk(&r->rmap, remapPage, arg);
+    return -1;
+  }
+  __sync_fetch_and_sub(&r->refCount, arg->n - 1);
   return 0;
 }
 
-int
-evictPage() {
-  // find a page to evict
-  struct core_map_entry *pageToEvict = findPageToEvict();
-  if (pageToEvict == 0) {
+// rmap_walk callback of zswapDemote: the page of a PTE is on disk now.
+static void
+clearZswapped(pml4e_t *pml4, pte_t *pte, void *arg) {
+  uint64_t swapIndex = *(int*)arg;
+
+  if (!(*pte & PTE_P) && (*pte & PTE_DSK) && (*pte >> PT_SHIFT) == swapIndex) {
+    *pte &= ~PTE_ZSW;
+  }
+}
+
+// rmap_walk callback of evictPage: the page of a PTE went to the
+// compressed pool.
+static void
+setZswapped(pml4e_t *pml4, pte_t *pte, void *arg) {
+  uint64_t swapIndex = *(int*)arg;
+
+  if (!(*pte & PTE_P) && (*pte & PTE_DSK) && (*pte >> PT_SHIFT) == swapIndex) {
+    *pte |= PTE_ZSW;
+  }
+}
+
+// Make room in the compressed pool by writing the next page in it,
+// in slot order from where the last call left off, to its swap slot
+// on disk. Returns 0 if a page was moved, -1 if the pool is empty.
+static int
+zswapDemote(void) {
+  struct swap_map_entry *s;
+  char *pages[1] = { zdemote.buf };
+  int index, n;
+
+  acquiresleep(&zdemote.lock);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  for (n = 0; n < NDISKPAGES; n++, zdemote.hand = (zdemote.hand + 1) % NDISKPAGES) {
+    s = &swap_core_map[zdemote.hand];
+    if (s->zswapped && !s->writing) {
+      break;
+    }
+  }
+  if (n == NDISKPAGES) {
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    releasesleep(&zdemote.lock);
     return -1;
   }
+  index = zdemote.hand;
+  zdemote.hand = (zdemote.hand + 1) % NDISKPAGES;
+  s->writing = 1;
+  zswap_load(s->zchunk, s->zlen, zdemote.buf);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
+  swapIO(index, pages, 1, 1);
+
+  // the page may have been swapped in or freed while we wrote it,
+  // which left the slot and the pool space to us
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  zswap_free(s->zchunk, s->zlen);
+  if (s->in_use) {
+    rmap_walk(&s->rmap, clearZswapped, &index);
+  } else {
+    freeSwapSlot(index);
+  }
+  s->zswapped = 0;
+  s->writing = 0;
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  releasesleep(&zdemote.lock);
+  return 0;
+}
+
+struct accessArg {
+  uint64_t pa;
+  int bits;
+  int clear;  // clear the accessed bits too
+};
+
+// rmap_walk callback of testAndClearAccessed.
+static void
+sampleAccessed(pml4e_t *pml4, pte_t *pte, void *arg) {
+  struct accessArg *a = arg;
+
+  if (!(*pte & PTE_P) || PTE_ADDR(*pte) != a->pa) {
+    return;
+  }
+  a->bits |= *pte & (PTE_P | PTE_A | PTE_D);
+  if ((*pte & PTE_A) && a->clear) {
+    *pte &= ~PTE_A;
+    // drop the TLB entry too, or the bit is not set again
+    if (myproc() != 0 && pml4 == myproc()->pml4)
+      lcr3(V2P(pml4));
+  }
+}
+
+// Test and clear the accessed bits of every user mapping of page
+// cme. Returns the PTE_A and PTE_D bits that were set in any of
+// them, and PTE_P if the page is mapped at all.
+static int
+testAndClearAccessed(struct core_map_entry *cme) {
+  struct accessArg arg = { page2pa(cme), 0, 1 };
+
+  rmap_walk(&cme->rmap, sampleAccessed, &arg);
+  return arg.bits;
+}
+
+// testAndClearAccessed, leaving the bits as they are.
+static int
+testAccessed(struct core_map_entry *cme) {
+  struct accessArg arg = { page2pa(cme), 0, 0 };
+
+  rmap_walk(&cme->rmap, sampleAccessed, &arg);
+  return arg.bits;
+}
 
-  // move data to disk using the index and offset for the
-  // swap_core_map
-  int swapIndex = getFreeDiskPageIndex();
-  if (swapIndex == -1) {
+// Evict page r, which is in the swap cache, without writing it, if
+// no PTE has written it since it was read from its slot. Returns 0 if
+// the page was evicted, -1 if it has to be written out.
+static int
+evictCached(struct core_map_entry *r) {
+  struct swap_map_entry *s;
+  struct swapOutArg arg;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if ((s = r->swap) == 0 || r->refCount <= 0) {
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return -1;
+  }
+  if (testAndClearAccessed(r) & PTE_D) {
+    swapCacheDrop(r);
+    if(kmem.use_lock)
+      release(&kmem.lock);
     return -1;
   }
 
-  // loop through every block for this page and write
-  // block by block
-  // 8 blocks = 1 page
-  uint64_t pa = page2pa(pageToEvict);
-  for (int i = 0; i < 8; i++) {
-    uint disk_addr = 2 + (swapIndex * 8) + i;
-    struct buf *b = bread(ROOTDEV, disk_addr);
-    memmove(b->data, P2V(pa) + (BSIZE * i), BSIZE);
-    bwrite(b);
-    brelse(b);
-  }
-
-  // put the core_map_entry in the swap_core_map
-  //swap_core_map[swapIndex] = pageToEvict;
-  swap_core_map[swapIndex].va = pageToEvict->va;
-  swap_core_map[swapIndex].pid = pageToEvict->pid;
-  swap_core_map[swapIndex].refCount = pageToEvict->refCount;
-  swap_core_map[swapIndex].in_use = 1;
-
-  // loop over all processes in the ptable, use walkpml4 to get a PTE for the VA of the
-  // core_map_entry
-  // see if the physical memeory address matches the physical address we are swapping out.
-  // for each valid PTE we need to indicate that the page is on disk and turn of the present
-  // bit
-  uint64_t va = pageToEvict->va;
-  for (int i = 0; i < NPROC; i++) {
-    struct proc *process = getProcessAtIndex(i);
-    // for each process go through every page attributed to it
-    // and search for that va, if it exists then you can
-    // do a page walk
-    for (int region = 0; region < 4; region++) {
-      uint64_t region_start = (uint64_t)process->mem_regions[region].start;
-      uint64_t region_size = process->mem_regions[region].size;
-
-      if (va >= region_start && va < (region_start + region_size)) {
-        pte_t *pte = walkpml4(process->pml4, (char*)va, 0);
-        if (PTE_ADDR(*pte) == pa) {
-          *pte = PTE_FLAGS(*pte);
-          *pte &= ~(PTE_P);
-          *pte |= PTE_DSK;
-          *pte |= swapIndex << PT_SHIFT;
-        }
-      }
-    }
+  arg.pa = page2pa(r);
+  arg.swapIndex = s - swap_core_map;
+  arg.flags = PTE_DSK;
+  arg.n = 0;
+  if (unmapToSlot(r, &arg) < 0) {
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return -1;
   }
+  s->va = r->va;
+  s->pid = r->pid;
+  s->refCount += arg.n;
+  s->in_use = 1;
+  s->cached = 0;
+  r->swap = 0;
+  rmap_move(&r->rmap, &s->rmap);
+  if(kmem.use_lock)
+    release(&kmem.lock);
 
-  // free the page
-  kfree(P2V(pa));
+  kfree(P2V(arg.pa));
   return 0;
 }
 
-// returns a free index in the swap_core_map
-// for which we can evict the physical
-// memory page to
+// Free memory by dropping a clean page cache page, or else by
+// swapping out up to SWAP_CLUSTER pages. Pages in the swap cache
+// that were not written go back to their slots as they are. The
+// others get a run of new slots; those that compress well go to the
+// compressed pool, the rest are written to their slots on disk.
+// Returns 0 if some memory was freed, -1 if not.
 int
-getFreeDiskPageIndex() {
-  for (int i = 0; i < NDISKPAGES; i++) {
-    if (swap_core_map[i].in_use == 0) {
-      return i;
+evictPage() {
+  struct core_map_entry *victims[SWAP_CLUSTER];
+  char *pages[SWAP_CLUSTER];
+  int pids[SWAP_CLUSTER];
+  uint64_t vas[SWAP_CLUSTER];
+  int zlen[SWAP_CLUSTER], zchunk[SWAP_CLUSTER];
+  int n, first, freed;
+
+  // clean page cache pages are cheaper to drop than swapping
+  if (pcache_reclaim() == 0) {
+    return 0;
+  }
+
+  // find the pages to evict; the CLOCK hand moves on after each
+  freed = 0;
+  for (int tries = n = 0; tries < SWAP_CLUSTER; tries++) {
+    struct core_map_entry *victim = findPageToEvict();
+    int i;
+    for (i = 0; i < n && victims[i] != victim; i++)
+      ;
+    if (victim == 0 || i < n) {
+      break;
+    }
+    if (victim->swap && evictCached(victim) == 0) {
+      freed++;
+      continue;
     }
+    victims[n] = victim;
+    pages[n] = P2V(page2pa(victim));
+    pids[n] = victim->pid;
+    vas[n] = victim->va;
+    n++;
   }
-  return -1;
+  if (n == 0) {
+    return freed > 0 ? 0 : -1;
+  }
+
+  // find a run of swap slots for them, or for as many as fit
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  while ((first = allocSwapSlots(n)) == -1 && n > 1) {
+    n--;
+  }
+  if (first == -1 && shrinkSwapCache() > 0) {
+    first = allocSwapSlots(n);
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if (first == -1) {
+    return freed > 0 ? 0 : -1;
+  }
+
+  // every PTE mapping a page now points at its swap slot, which takes
+  // over their references and reverse mappings, so the page cannot
+  // change while it is stored. The page may have been freed since it
+  // was picked, or be held by more than its PTEs; then the slot is not
+  // needed.
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  for (int i = 0; i < n; i++) {
+    struct core_map_entry *pageToEvict = victims[i];
+    struct swap_map_entry *s = &swap_core_map[first + i];
+    struct swapOutArg arg = { page2pa(pageToEvict), first + i, PTE_DSK, 0 };
+
+    if (pageToEvict->refCount <= 0 || pageToEvict->pid != pids[i] ||
+        pageToEvict->va != vas[i] || unmapToSlot(pageToEvict, &arg) < 0) {
+      releaseSwapSlot(first + i);
+      victims[i] = 0;
+      continue;
+    }
+    s->va = pageToEvict->va;
+    s->pid = pageToEvict->pid;
+    s->refCount = arg.n;
+    s->in_use = 1;
+    s->pageout = 1;
+    rmap_move(&pageToEvict->rmap, &s->rmap);
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
+  // when the pool is full, a page in it makes room by going to disk
+  for (int i = 0; i < n; i++) {
+    if (victims[i] == 0) {
+      continue;
+    }
+    zlen[i] = zswap_store(pages[i], &zchunk[i]);
+    if (zlen[i] == -2 && zswapDemote() == 0) {
+      zlen[i] = zswap_store(pages[i], &zchunk[i]);
+    }
+    if (zlen[i] < 0) {
+      swapIO(first + i, &pages[i], 1, 1);
+    }
+  }
+
+  // the slots whose PTEs were all dropped while we stored them are
+  // left to us
+  for (int i = 0; i < n; i++) {
+    struct swap_map_entry *s = &swap_core_map[first + i];
+    int index = first + i;
+
+    if (victims[i] == 0) {
+      continue;
+    }
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    s->pageout = 0;
+    if (!s->in_use) {
+      if (zlen[i] >= 0) {
+        zswap_free(zchunk[i], zlen[i]);
+      }
+      freeSwapSlot(index);
+    } else if (zlen[i] >= 0) {
+      s->zswapped = 1;
+      s->zchunk = zchunk[i];
+      s->zlen = zlen[i];
+      rmap_walk(&s->rmap, setZswapped, &index);
+    }
+    wakeup(s);
+    if(kmem.use_lock)
+      release(&kmem.lock);
+
+    // free the page
+    kfree(pages[i]);
+    freed++;
+  }
+  return freed > 0 ? 0 : -1;
+}
+
+// Can page r be swapped out, if it is mapped? Caller holds kmem.lock.
+static int
+evictable(struct core_map_entry *r) {
+  return r->pid > 2 && r->refCount > 0 && r->inode == 0;
 }
 
 // returns the page to evict
 // 0 if there is no page to evict
+//
+// A CLOCK hand sweeps the core map over the user pages that can be
+// swapped and are mapped. A page used since the hand last passed it has its accessed
+// bits cleared and gets a second chance, and the first page found
+// unused is evicted. If every page was used, the second sweep finds
+// them with their bits now clear. A page that is clean and in the swap
+// cache goes back to its slot without a write, so if the one found is
+// not, the next CLEAN_LOOKAHEAD pages are looked at for an unused one
+// that is; their accessed bits are left for the hand.
 struct core_map_entry*
 findPageToEvict() {
-  // cycle through core map to find the
-  // first non kernel page indicated by a pid
-  // of -1 and return it
+  static int hand;
+  struct core_map_entry *victim = 0;
+  int clean = 0;
+
   if(kmem.use_lock) {
     acquire(&kmem.lock);
   }
-  for (int i = 0; i < npages; i++) {
+  for (int n = 0; n < 2 * npages; n++, hand = (hand + 1) % npages) {
+    struct core_map_entry *current = &core_map[hand];
+    if (!evictable(current)) {
+      continue;
+    }
+    int bits = testAndClearAccessed(current);
+    if ((bits & PTE_P) && !(bits & PTE_A)) {
+      victim = current;
+      clean = current->swap && !(bits & PTE_D);
+      hand = (hand + 1) % npages;
+      break;
+    }
+  }
+  for (int n = 0, i = hand; victim && !clean && n < CLEAN_LOOKAHEAD; n++, i = (i + 1) % npages) {
     struct core_map_entry *current = &core_map[i];
-    if (current->pid > 2 && current->refCount > 0) { // changing to > 2 works 2 times, should focus on fixing memory clear where values become -1
-      if(kmem.use_lock)
-        release(&kmem.lock);
-      return current;
+    if (!evictable(current) || current->swap == 0) {
+      continue;
+    }
+    int bits = testAccessed(current);
+    if ((bits & PTE_P) && !(bits & (PTE_A | PTE_D))) {
+      victim = current;
+      clean = 1;
+    }
+  }
+  if(kmem.use_lock) {
+    release(&kmem.lock);
+  }
+  return victim;
+}
+
+struct swapInArg {
+  uint64_t swapIndex;
+  uint64_t pa;
+};
+
+// rmap_walk callback of swapPageIn: point a PTE of the swap slot
+// at the page it was read into.
+static void
+mapFromSwap(pml4e_t *pml4, pte_t *pte, void *arg) {
+  struct swapInArg *a = arg;
+
+  if (!(*pte & PTE_P) && (*pte & PTE_DSK) && ((*pte) >> PT_SHIFT) == a->swapIndex) {
+    *pte = PTE(a->pa, PTE_FLAGS(*pte) | PTE_P);
+    *pte &= ~(PTE_DSK | PTE_ZSW | PTE_D);
+  }
+}
+
+// Swap slot swapIndex has been read into mem: make mem the page of
+// every PTE that points at the slot, keeping their permissions. A
+// slot on disk stays with the page in the swap cache; a slot in the
+// compressed pool is freed, or the pool would hold pages that are in
+// memory anyway. Returns -1, leaving mem to the caller, if pte no
+// longer points at the slot because a process sharing the page
+// swapped it in first.
+static int
+mapSwappedPage(uint64_t swapIndex, pte_t *pte, char *mem) {
+  struct swap_map_entry *s = &swap_core_map[swapIndex];
+  struct core_map_entry *cme = pa2page(V2P(mem));
+
+  // the check and the adoption are one step under kmem.lock, which
+  // is also held wherever else a PTE of the slot is pointed at a page
+  if(kmem.use_lock) {
+    acquire(&kmem.lock);
+  }
+  if ((*pte & PTE_P) || !(*pte & PTE_DSK) || (*pte >> PT_SHIFT) != swapIndex ||
+      !s->in_use || s->refCount <= 0 || s->pageout) {
+    if(kmem.use_lock) {
+      release(&kmem.lock);
+    }
+    return -1;
+  }
+  cme->refCount = s->refCount;
+  cme->va = s->va;
+  cme->pid = s->pid;
+
+  // the page takes over the slot's reverse mappings
+  struct swapInArg arg = { swapIndex, V2P(mem) };
+  rmap_walk(&s->rmap, mapFromSwap, &arg);
+  rmap_move(&s->rmap, &cme->rmap);
+
+  if (s->zswapped) {
+    releaseSwapSlot(swapIndex);
+  } else {
+    s->refCount = 0;
+    // unless the slot is cached with a copy read in before
+    if (s->cached == 0) {
+      s->cached = cme;
+      cme->swap = s;
     }
   }
   if(kmem.use_lock) {
@@ -330,105 +1212,325 @@ findPageToEvict() {
   return 0;
 }
 
+// Decompress swap slot swapIndex into mem if its page is in the
+// compressed pool. Returns 0 if it was, -1 if it is on disk.
+static int
+zswapLoad(uint64_t swapIndex, char *mem) {
+  struct swap_map_entry *s = &swap_core_map[swapIndex];
+  int r = -1;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if (s->in_use && s->zswapped) {
+    zswap_load(s->zchunk, s->zlen, mem);
+    r = 0;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return r;
+}
+
+// If the page of swap slot swapIndex is still in memory, in the swap
+// cache, make it the page of the current process's PTE pte at va as
+// well. Returns 0 if it was, -1 if not.
+static int
+mapCachedPage(uint64_t swapIndex, pte_t *pte, uint64_t va) {
+  pml4e_t *pml4 = myproc()->pml4;
+  struct swap_map_entry *s = &swap_core_map[swapIndex];
+  struct core_map_entry *r;
+  int ret = -1;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if ((r = s->cached) != 0 && rmap_relink(&s->rmap, &r->rmap, pml4, va) == 0) {
+    inrementPageRefCount(page2pa(r));
+    s->refCount--;
+    *pte = PTE(page2pa(r), PTE_FLAGS(*pte) | PTE_P);
+    *pte &= ~(PTE_DSK | PTE_ZSW | PTE_D);
+    ret = 0;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return ret;
+}
+
+// Wait for evictPage to store the page of swap slot swapIndex, if it
+// is storing it. Returns 1 if it was, 0 if not.
+static int
+pageoutWait(uint64_t swapIndex) {
+  struct swap_map_entry *s = &swap_core_map[swapIndex];
+  int waited = 0;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  while (s->pageout) {
+    sleep(s, &kmem.lock);
+    waited = 1;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return waited;
+}
+
+// Swap in the page of the current process at vAddr, whose PTE pte
+// points at its swap slot. If another PTE of the slot swapped the
+// page in already, it is shared from the swap cache, and a page in
+// the compressed pool is just decompressed. For a page on disk, the slots right after it that
+// hold pages of the same region of the process are read in with it,
+// as long as the run lasts, so a process going through swapped out
+// memory in order takes one fault for several pages.
 int
 swapPageIn(uint64_t vAddr, pte_t *pte) {
-  // 1. find the entry into the swap_core_map for the page
+  struct proc *p = myproc();
+  char *pages[1 + SWAP_READAHEAD];
+  pte_t *ptes[1 + SWAP_READAHEAD];
   uint64_t swapIndex = *pte >> PT_SHIFT; // will be the value stored in the pte
+  uint64_t region_start = 0, region_end = 0;
+  int n, i;
 
-  // 2. kalloc a page
-  char *mem = kalloc();
-  if (mem == 0) {
-    return -1;
+  // the slot does not hold the page yet; the fault is taken again
+  if (pageoutWait(swapIndex)) {
+    return 0;
   }
 
-  // copy data from disk into physical memory
-  for (int i = 0; i < 8; i++) {
-    uint disk_addr = 2 + (swapIndex * 8) + i;
-    struct buf *b = bread(ROOTDEV, disk_addr);
-    memmove(mem + (BSIZE * i), b->data, BSIZE);
-    brelse(b);
+  if (swap_core_map[swapIndex].cached &&
+      mapCachedPage(swapIndex, pte, PGROUNDDOWN(vAddr)) == 0) {
+    return 0;
   }
 
-  add_phy_mem_map(myproc()->pid, PGROUNDDOWN(vAddr), V2P(mem));
-  struct core_map_entry *cme = pa2page(V2P(mem));
-  cme->refCount = swap_core_map[swapIndex].refCount;
-  cme->va = swap_core_map[swapIndex].va;
-  cme->pid = swap_core_map[swapIndex].pid;
-
-  // 3. set PTE for all processes properly to reflect that the pageToEvict is in physical memory and not on disk
-  // increment page count for the page
-  for (int i = 0; i < NPROC; i++) {
-    struct proc *process = getProcessAtIndex(i);
-    // for each process go through every page attributed to it
-    // and search for that va, if it exists then you can
-    // do a page walk
-    for (int region = 0; region < 4; region++) {
-      uint64_t region_start = (uint64_t)process->mem_regions[region].start;
-      uint64_t region_size = process->mem_regions[region].size;
-
-      if (vAddr >= region_start && vAddr < (region_start + region_size)) {
-        pte_t *pte = walkpml4(process->pml4, (char*)vAddr, 0);
-        if (((*pte) >> PT_SHIFT) == swapIndex) {
-          *pte |= PTE_P;
-          *pte &= ~(PTE_DSK);
-          *pte = PTE(V2P(mem), PTE_FLAGS(*pte) | PTE_P | PTE_W | PTE_U);
-          //inrementPageRefCount(V2P(mem));
-        }
+  // the entry, not PTE_ZSW, says where the page is: fork copies a
+  // PTE before it is on the slot's reverse map, so zswapDemote can
+  // miss clearing the bit in the copy
+  if (swap_core_map[swapIndex].zswapped) {
+    if ((pages[0] = kalloc()) == 0) {
+      return -1;
+    }
+    if ((*pte & PTE_P) || !(*pte & PTE_DSK) || (*pte >> PT_SHIFT) != swapIndex) {
+      // a process sharing the page swapped it in while we slept
+      kfree(pages[0]);
+      return 0;
+    }
+    if (zswapLoad(swapIndex, pages[0]) == 0) {
+      if (mapSwappedPage(swapIndex, pte, pages[0]) < 0) {
+        kfree(pages[0]);
       }
+      return 0;
     }
+    // it went to disk while we slept
+    kfree(pages[0]);
   }
 
-  // 4. zero out index in swap_core_map
-  if(kmem.use_lock) {
-    acquire(&kmem.lock);
+  for (int region = 0; region < 4; region++) {
+    uint64_t start = (uint64_t)p->mem_regions[region].start;
+    if (vAddr >= start && vAddr < start + p->mem_regions[region].size) {
+      region_start = start;
+      region_end = start + p->mem_regions[region].size;
+    }
   }
-  swap_core_map[swapIndex].va = 0;
-  swap_core_map[swapIndex].pid = 0;
-  swap_core_map[swapIndex].refCount = 0;
-  swap_core_map[swapIndex].in_use = 0;
-  if(kmem.use_lock) {
-    release(&kmem.lock);
+
+  ptes[0] = pte;
+  for (n = 1; n <= SWAP_READAHEAD && swapIndex + n < NDISKPAGES; n++) {
+    struct swap_map_entry *slot = &swap_core_map[swapIndex + n];
+    if (!slot->in_use || slot->zswapped || slot->pageout || slot->va < region_start ||
+        slot->va >= region_end) {
+      break;
+    }
+    pte_t *next = walkpml4(p->pml4, (char*)slot->va, 0);
+    if (next == 0 || (*next & PTE_P) || !(*next & PTE_DSK) ||
+        (*next >> PT_SHIFT) != swapIndex + n) {
+      break;
+    }
+    ptes[n] = next;
+  }
+
+  // the pages to read into; read-ahead is dropped if memory is short
+  for (i = 0; i < n; i++) {
+    if ((pages[i] = kalloc()) == 0) {
+      if (i == 0) {
+        return -1;
+      }
+      n = i;
+    }
+  }
+
+  swapIO(swapIndex, pages, n, 0);
+
+  // a process sharing a page may have swapped it in while we slept
+  for (i = 0; i < n; i++) {
+    if (mapSwappedPage(swapIndex + i, ptes[i], pages[i]) < 0) {
+      kfree(pages[i]);
+    }
   }
   return 0;
 }
 
+// kfree drops references without kmem.lock, so page reference
+// counts are only ever changed atomically.
 void
 inrementPageRefCount(uint64_t pa) {
+  struct core_map_entry *r = pa2page(pa);
+  __sync_fetch_and_add(&r->refCount, 1);
+}
+
+void
+decrementPageRefCount(uint64_t pa) {
+  struct core_map_entry *r = pa2page(pa);
+  __sync_fetch_and_sub(&r->refCount, 1);
+}
+
+// Make childPTE, the PTE at va in page table pml4, share the page or
+// swap slot of pte, as fork does. With cow, a writable page becomes
+// copy-on-write in both. The reverse mapping is allocated first, as
+// that can evict this very page; the rest is one step under
+// kmem.lock, which eviction holds while it takes a page's mappings
+// away, so eviction sees both PTEs or only pte.
+// Returns 0, or -1 if out of memory.
+int
+sharePTE(pte_t *pte, pml4e_t *pml4, uint64_t va, pte_t *childPTE, int cow) {
+  struct rmap *r;
+  uint64_t index;
+
+  if ((r = rmap_alloc()) == 0) {
+    return -1;
+  }
   if(kmem.use_lock) {
     acquire(&kmem.lock);
   }
-  struct core_map_entry *r = pa2page(pa);
-  r->refCount++;
+  if (cow && (*pte & PTE_W)) {
+    *pte &= ~PTE_W;
+    *pte |= PTE_RO;
+  }
+  if (*pte & PTE_P) {
+    inrementPageRefCount(PTE_ADDR(*pte));
+    rmap_link(&pa2page(PTE_ADDR(*pte))->rmap, r, pml4, va);
+    r = 0;
+  } else if (*pte & PTE_DSK) {
+    index = *pte >> PT_SHIFT;
+    swap_core_map[index].refCount++;
+    rmap_link(&swap_core_map[index].rmap, r, pml4, va);
+    r = 0;
+  }
+  *childPTE = *pte;
   if(kmem.use_lock) {
     release(&kmem.lock);
   }
+  if (r) {
+    rmap_free(r);
+  }
+  return 0;
 }
 
-void
-decrementPageRefCount(uint64_t pa) {
-  if(kmem.use_lock) {
-    acquire(&kmem.lock);
+// Handle a write fault on pte, the copy-on-write PTE at va in pml4 of
+// process pid: give it a copy of its page, or make it writable if it
+// is the only one left that maps the page. The page can be evicted
+// while the copy is allocated, so the PTE is looked at again under
+// kmem.lock; if it is no longer present, the fault is taken again.
+// Returns 0, or -1 if out of memory.
+int
+copyOnWrite(pml4e_t *pml4, int pid, uint64_t va, pte_t *pte) {
+  struct core_map_entry *r, *copy;
+  char *mem = 0;
+  uint64_t pa;
+
+  for (;;) {
+    if(kmem.use_lock) {
+      acquire(&kmem.lock);
+    }
+    if (!(*pte & PTE_P) || (*pte & PTE_W) || !(*pte & PTE_RO)) {
+      // evicted, or another thread of the fault got here first
+      if(kmem.use_lock) {
+        release(&kmem.lock);
+      }
+      if (mem) {
+        kfree(mem);
+      }
+      return 0;
+    }
+    pa = PTE_ADDR(*pte);
+    r = pa2page(pa);
+    if (r->refCount <= 0) {
+      panic("illegal core map entry");
+    }
+    if (r->refCount == 1) {
+      *pte |= PTE_W;
+      *pte &= ~(PTE_RO);
+      if(kmem.use_lock) {
+        release(&kmem.lock);
+      }
+      if (mem) {
+        kfree(mem);
+      }
+      return 0;
+    }
+    if (mem) {
+      break;
+    }
+    if(kmem.use_lock) {
+      release(&kmem.lock);
+    }
+    if ((mem = kalloc()) == 0) {
+      return -1;
+    }
   }
-  struct core_map_entry *r = pa2page(pa);
-  r->refCount--;
+
+  // a page written through the PTE differs from its swap copy
+  if ((*pte & PTE_D) && r->swap) {
+    swapCacheDrop(r);
+  }
+  memmove(mem, P2V(pa), PGSIZE);
+  copy = pa2page(V2P(mem));
+  copy->pid = pid;
+  copy->va = va;
+  rmap_relink(&r->rmap, &copy->rmap, pml4, va);
+  *pte = PTE(V2P(mem), PTE_FLAGS(*pte) | PTE_W | PTE_P | PTE_U);
+  *pte &= ~(PTE_RO);
   if(kmem.use_lock) {
     release(&kmem.lock);
   }
+  // the PTE's reference to the shared page, which may be the last
+  kfree(P2V(pa));
+  return 0;
 }
 
+// Clear pte, the PTE at va in pml4, and drop its reference to its
+// page or swap slot. Eviction and swap in change the PTEs of a page
+// under kmem.lock, so the PTE is read and cleared under it too.
 void
-decrementSwapCoreMapEntryRefCount(uint64_t index) {
+unmapUserPage(pml4e_t *pml4, uint64_t va, pte_t *pte) {
+  struct rmap *stale = 0;
+  struct core_map_entry *r = 0;
+  uint64_t index;
+
   if(kmem.use_lock) {
     acquire(&kmem.lock);
   }
-  swap_core_map[index].refCount--;
-  if (swap_core_map[index].refCount <= 0) {
-    swap_core_map[index].va = 0;
-    swap_core_map[index].pid = 0;
-    swap_core_map[index].refCount = 0;
-    swap_core_map[index].in_use = 0;
+  if (*pte & PTE_P) {
+    r = pa2page(PTE_ADDR(*pte));
+    // a page written through this PTE differs from its swap copy
+    if ((*pte & PTE_D) && r->swap) {
+      swapCacheDrop(r);
+    }
+    rmap_relink(&r->rmap, &stale, pml4, va);
+    // processes the page was shared with may still map it
+    if (r->rmap == 0) {
+      r->pid = -1;
+      r->va = 0;
+    }
+  } else if (*pte & PTE_DSK) {
+    index = *pte >> PT_SHIFT;
+    rmap_relink(&swap_core_map[index].rmap, &stale, pml4, va);
+    swap_core_map[index].refCount--;
+    if (swap_core_map[index].refCount <= 0) {
+      releaseSwapSlot(index);
+      rmap_move(&swap_core_map[index].rmap, &stale);
+    }
   }
+  *pte = 0;
   if(kmem.use_lock) {
     release(&kmem.lock);
   }
+  rmap_clear(&stale);
+  if (r) {
+    kfree(P2V(page2pa(r)));
+  }
 }
@@ -14,6 +14,8 @@ main(uint64_t addr)
   e820_init(addr);
   detect_memory();
   mem_init(_end); // phys page allocator
+  rmap_init();     // reverse mappings
+  zswap_init();    // compressed swap pool
   kvmalloc();      // kernel page table
   mpinit();
   lapicinit();
@@ -28,9 +30,12 @@ main(uint64_t addr)
   cprintf("free pages: %d\n", free_pages);
   pinit();
   finit();
+  pollinit();
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcache_init();   // page cache
   ideinit();       // disk
+  kswapdinit();    // page reclaim thread
   userinit();      // first user process
   mpmain();
   return 0;
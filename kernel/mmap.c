@@ -0,0 +1,395 @@
+//
+// Memory mappings
+//
+// A process can map up to NVMA regions of files or anonymous memory in
+// [MMAPBASE, MMAPTOP). Mapping only records the region in a struct vma;
+// each page is filled in by vma_fault the first time it is touched.
+//
+// A page of a MAP_SHARED file mapping is the file's page in the page
+// cache, so all processes mapping the file and read()/write() see the
+// same memory. Pages written through the mapping are found by the
+// dirty bit in the page table and written back to the file by msync,
+// munmap and exit.
+//
+// A MAP_PRIVATE file mapping also starts out on the page cache pages,
+// mapped read-only, and gets a private copy of a page on the first
+// write to it through the same copy-on-write path fork uses.
+//
+// Anonymous mappings (MAP_ANONYMOUS) get a zeroed page on first touch.
+// Their pages are ordinary user pages and can be swapped out. As there
+// is no file to find a shared anonymous page through, fork fills in
+// the untouched pages of such a mapping so parent and child share all
+// of it.
+//
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <fs.h>
+#include <spinlock.h>
+#include <sleeplock.h>
+#include <file.h>
+#include <mman.h>
+#include <proc.h>
+
+// Return the mapping containing addr, or 0 if there is none.
+struct vma*
+vma_find(struct proc *p, uint64_t addr)
+{
+  struct vma *v;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->size > 0 && addr >= v->start && addr < v->start + v->size)
+      return v;
+  return 0;
+}
+
+// Check that [addr, addr + len) lies within one mapping.
+// Returns 0 if it does, -1 otherwise.
+int
+vma_check(struct proc *p, uint64_t addr, uint64_t len)
+{
+  struct vma *v;
+
+  if((v = vma_find(p, addr)) == 0 || addr + len < addr)
+    return -1;
+  if(addr + len > v->start + v->size)
+    return -1;
+  return 0;
+}
+
+// Does any part of [addr, addr + len) lie in a mapping of ip?
+int
+vma_maps_inode(struct proc *p, uint64_t addr, uint64_t len, struct inode *ip)
+{
+  struct vma *v;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->size > 0 && v->inode == ip && addr < v->start + v->size &&
+       v->start < addr + len)
+      return 1;
+  return 0;
+}
+
+// Make the MMAP region span all mappings, so code that scans the
+// regions of a process (swapping) finds the mapped pages.
+static void
+vma_region(struct proc *p)
+{
+  struct vma *v;
+  uint64_t top = 0;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->size > 0 && v->start + v->size > top)
+      top = v->start + v->size;
+
+  if(top == 0){
+    p->mem_regions[MMAP].start = 0;
+    p->mem_regions[MMAP].size = 0;
+  } else {
+    p->mem_regions[MMAP].start = (char*)MMAPBASE;
+    p->mem_regions[MMAP].size = top - MMAPBASE;
+  }
+}
+
+// Is [start, start + len) free of mappings?
+static int
+vma_free_range(struct proc *p, uint64_t start, uint64_t len)
+{
+  struct vma *v;
+
+  if(start < MMAPBASE || start + len > MMAPTOP || start + len < start)
+    return 0;
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->size > 0 && start < v->start + v->size && v->start < start + len)
+      return 0;
+  return 1;
+}
+
+// Add a mapping of len bytes of ip starting at offset, or of anonymous
+// memory if ip is 0. It goes at addr if that range is free, otherwise
+// at the lowest free range. No page is touched until it faults.
+// The mapping takes its own reference to ip.
+// Returns the start address, or 0 on failure.
+uint64_t
+vma_map(struct proc *p, uint64_t addr, uint64_t len, int prot, int flags,
+        struct inode *ip, uint offset)
+{
+  struct vma *v, *slot;
+  uint64_t start;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || offset % PGSIZE != 0)
+    return 0;
+
+  slot = 0;
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+    if(v->size == 0){
+      slot = v;
+      break;
+    }
+  }
+  if(slot == 0)
+    return 0;
+
+  start = PGROUNDDOWN(addr);
+  if(!vma_free_range(p, start, len)){
+    // first fit: move past every mapping in the way
+    start = MMAPBASE;
+    for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+      if(v->size > 0 && start < v->start + v->size && v->start < start + len){
+        start = v->start + v->size;
+        v = p->vmas - 1;
+      }
+    }
+    if(!vma_free_range(p, start, len))
+      return 0;
+  }
+
+  slot->start = start;
+  slot->size = len;
+  slot->inode = ip ? idup(ip) : 0;
+  slot->offset = offset;
+  slot->prot = prot;
+  slot->flags = flags;
+  vma_region(p);
+  return start;
+}
+
+// Fill in the page containing addr of a mapping. Only handles pages
+// that are not present; faults on present pages are either access
+// violations or copy-on-write faults, handled in trap().
+// Returns 0 on success, -1 if addr is not mapped or the access is not
+// allowed.
+int
+vma_fault(struct proc *p, uint64_t addr, int write)
+{
+  struct vma *v;
+  uint64_t va;
+  pte_t *pte;
+  char *page, *mem;
+
+  if((v = vma_find(p, addr)) == 0)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+
+  va = PGROUNDDOWN(addr);
+  if((pte = walkpml4(p->pml4, (char*)va, 1)) == 0)
+    return -1;
+  if(*pte & (PTE_P | PTE_DSK))
+    return -1;
+
+  if(v->inode == 0){
+    // anonymous memory starts out zeroed
+    if((mem = kalloc_zeroed()) == 0)
+      return -1;
+    if(add_phy_mem_map(p->pml4, p->pid, va, V2P(mem)) < 0){
+      kfree(mem);
+      return -1;
+    }
+    *pte = PTE(V2P(mem), PTE_P | PTE_U | ((v->prot & PROT_WRITE) ? PTE_W : 0));
+    return 0;
+  }
+
+  // the page cache reference we get is handed to the page table
+  if((page = pcache_get(v->inode, (v->offset + (va - v->start)) / PGSIZE)) == 0)
+    return -1;
+
+  if(v->flags & MAP_SHARED){
+    if(rmap_add(&pa2page(V2P(page))->rmap, p->pml4, va) < 0){
+      pcache_put(page);
+      return -1;
+    }
+    *pte = PTE(V2P(page), PTE_P | PTE_U | ((v->prot & PROT_WRITE) ? PTE_W : 0));
+  } else if(write){
+    // private page written before it was ever read: copy right away
+    if((mem = kalloc()) == 0){
+      pcache_put(page);
+      return -1;
+    }
+    memmove(mem, page, PGSIZE);
+    pcache_put(page);
+    if(add_phy_mem_map(p->pml4, p->pid, va, V2P(mem)) < 0){
+      kfree(mem);
+      return -1;
+    }
+    *pte = PTE(V2P(mem), PTE_P | PTE_U | PTE_W);
+  } else {
+    // share the cached page until the first write copies it
+    if(rmap_add(&pa2page(V2P(page))->rmap, p->pml4, va) < 0){
+      pcache_put(page);
+      return -1;
+    }
+    *pte = PTE(V2P(page), PTE_P | PTE_U | ((v->prot & PROT_WRITE) ? PTE_RO : 0));
+  }
+  return 0;
+}
+
+// Write the dirty pages of [start, end) of a shared file mapping back
+// to the file. Must be called with p's page table loaded.
+static void
+vma_sync(struct proc *p, struct vma *v, uint64_t start, uint64_t end)
+{
+  uint64_t va;
+  uint off, n;
+  pte_t *pte;
+  int dirty = 0;
+
+  if(v->inode == 0 || !(v->flags & MAP_SHARED) || !(v->prot & PROT_WRITE))
+    return;
+
+  for(va = start; va < end; va += PGSIZE){
+    pte = walkpml4(p->pml4, (char*)va, 0);
+    if(pte == 0 || !(*pte & PTE_P) || !(*pte & PTE_D))
+      continue;
+    *pte &= ~PTE_D;
+    dirty = 1;
+
+    // the page is the file's cached page, so writei copies it onto
+    // itself on the way to the disk. Writes through a mapping never
+    // make the file longer.
+    off = v->offset + (va - v->start);
+    log_start_tx();
+    acquiresleepwrite(&v->inode->lock);
+    if(off < v->inode->size){
+      n = min(v->inode->size - off, (uint)PGSIZE);
+      writei(v->inode, P2V(PTE_ADDR(*pte)), off, n);
+    }
+    releasesleepwrite(&v->inode->lock);
+    log_end_tx();
+  }
+
+  // drop stale dirty bits from the TLB
+  if(dirty)
+    switchuvm(p);
+}
+
+// Remove [addr, addr + len) from p's mappings, writing back what has
+// to be. A mapping can be removed in part; one cut in the middle is
+// split in two. Returns 0 on success, -1 if len is not positive or a
+// split needs a free slot there is not.
+int
+vma_unmap(struct proc *p, uint64_t addr, uint64_t len)
+{
+  struct vma *v, *slot;
+  uint64_t start, end, from, to;
+
+  start = PGROUNDDOWN(addr);
+  end = PGROUNDUP(addr + len);
+  if(len == 0 || end <= start)
+    return -1;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+    if(v->size == 0 || end <= v->start || v->start + v->size <= start)
+      continue;
+    from = max(start, v->start);
+    to = min(end, v->start + v->size);
+
+    if(from > v->start && to < v->start + v->size){
+      // the hole splits the mapping, the part above it moves to a new slot
+      for(slot = p->vmas; slot < &p->vmas[NVMA]; slot++)
+        if(slot->size == 0)
+          break;
+      if(slot == &p->vmas[NVMA])
+        return -1;
+      *slot = *v;
+      slot->start = to;
+      slot->size = v->start + v->size - to;
+      slot->offset = v->offset + (to - v->start);
+      if(slot->inode)
+        idup(slot->inode);
+      v->size = to - v->start;
+    }
+
+    vma_sync(p, v, from, to);
+    deallocuvm(p->pml4, (char*)from, to - from, 0, p->pid);
+
+    if(from == v->start && to == v->start + v->size){
+      if(v->inode)
+        iput(v->inode);
+      memset(v, 0, sizeof(*v));
+    } else if(from == v->start){
+      v->offset += to - v->start;
+      v->size -= to - v->start;
+      v->start = to;
+    } else {
+      v->size = from - v->start;
+    }
+  }
+  vma_region(p);
+  return 0;
+}
+
+// Write back the dirty pages of [addr, addr + len).
+// Returns 0 on success, -1 if part of the range is not mapped.
+int
+vma_msync(struct proc *p, uint64_t addr, uint64_t len)
+{
+  struct vma *v;
+  uint64_t va, end;
+
+  end = PGROUNDUP(addr + len);
+  for(va = PGROUNDDOWN(addr); va < end; va = v->start + v->size){
+    if((v = vma_find(p, va)) == 0)
+      return -1;
+    vma_sync(p, v, va, min(end, v->start + v->size));
+  }
+  return 0;
+}
+
+// Drop all mappings of p, e.g. when it exits or execs.
+void
+vma_unmap_all(struct proc *p)
+{
+  struct vma *v;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++)
+    if(v->size > 0)
+      vma_unmap(p, v->start, v->size);
+  p->mapped_file = 0;
+}
+
+// Give child the mappings of p. Shared mappings share their pages,
+// private pages become copy-on-write in both processes.
+// Returns 0 on success, -1 if out of memory.
+int
+vma_fork(struct proc *p, struct proc *child, pml4e_t *pgtbl)
+{
+  struct vma *v;
+  uint64_t va;
+  pte_t *pte, *childPTE;
+
+  for(v = p->vmas; v < &p->vmas[NVMA]; v++){
+    if(v->size == 0)
+      continue;
+
+    if(v->inode == 0 && (v->flags & MAP_SHARED)){
+      for(va = v->start; va < v->start + v->size; va += PGSIZE){
+        pte = walkpml4(p->pml4, (char*)va, 0);
+        if((pte == 0 || !(*pte & (PTE_P | PTE_DSK))) && vma_fault(p, va, 0) < 0)
+          return -1;
+      }
+    }
+
+    child->vmas[v - p->vmas] = *v;
+    if(v->inode)
+      idup(v->inode);
+
+    for(va = v->start; va < v->start + v->size; va += PGSIZE){
+      pte = walkpml4(p->pml4, (char*)va, 0);
+      if(pte == 0 || !(*pte & (PTE_P | PTE_DSK)))
+        continue;
+      if((childPTE = walkpml4(pgtbl, (char*)va, 1)) == 0)
+        return -1;
+      if(sharePTE(pte, pgtbl, va, childPTE, !(v->flags & MAP_SHARED)) < 0)
+        return -1;
+    }
+  }
+  child->mem_regions[MMAP] = p->mem_regions[MMAP];
+  child->mapped_file = p->mapped_file;
+  switchuvm(p);
+  return 0;
+}
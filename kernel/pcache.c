@@ -0,0 +1,252 @@
+// Page cache.
+//
+// The page cache holds the contents of regular files in whole 4096-byte
+// pages, indexed by inode and page offset within the file. readi serves
+// file data from it, and the pages themselves can be mapped into user
+// page tables, so all readers and mappers of a file share one copy.
+//
+// Interface:
+// * To get a cached page of a file, call pcache_get. The page comes
+//     back with a reference held for the caller.
+// * When done with the page, call pcache_put.
+// * writei writes file data through the buffer cache as before (so
+//     journaling sees it) and then calls pcache_update so cached
+//     pages stay in sync.
+//
+// A cached page is an ordinary physical page whose core map entry
+// records the inode and page offset it holds. The cache owns one
+// reference to the page; every user mapping or pinned kernel user
+// holds another. Pages only the cache refers to are clean and can be
+// dropped at any time, which is how kalloc reclaims them under memory
+// pressure before it starts swapping.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <spinlock.h>
+#include <sleeplock.h>
+#include <fs.h>
+#include <file.h>
+#include <buf.h>
+
+#define NPCHASH 256  // buckets in the page cache hash table
+
+extern int npages;
+extern struct core_map_entry *core_map;
+
+struct {
+  struct spinlock lock;
+  // chains of cached pages, linked through core_map_entry.next
+  struct core_map_entry *hash[NPCHASH];
+  int hand;  // where pcache_reclaim continues its scan
+} pcache;
+
+static uint
+pcache_hash(struct inode *ip, uint pgoff)
+{
+  return (((uint64_t)ip >> 4) ^ pgoff) % NPCHASH;
+}
+
+void
+pcache_init(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Find a cached page. Caller holds pcache.lock.
+static struct core_map_entry*
+pcache_lookup(struct inode *ip, uint pgoff)
+{
+  struct core_map_entry *pp;
+
+  for(pp = pcache.hash[pcache_hash(ip, pgoff)]; pp; pp = pp->next)
+    if(pp->inode == ip && pp->pgoff == pgoff)
+      return pp;
+  return 0;
+}
+
+// Take a page out of the cache. Caller holds pcache.lock and
+// drops the cache's reference afterwards.
+static void
+pcache_remove(struct core_map_entry *pp)
+{
+  struct core_map_entry **pprev;
+
+  for(pprev = &pcache.hash[pcache_hash(pp->inode, pp->pgoff)]; *pprev; pprev = &(*pprev)->next){
+    if(*pprev == pp){
+      *pprev = pp->next;
+      break;
+    }
+  }
+  pp->inode->npages--;
+  pp->inode = 0;
+  pp->pgoff = 0;
+  pp->next = 0;
+}
+
+// Read page pgoff of a file from disk into mem. Blocks the file
+// does not have and bytes past its end read as zeroes.
+static void
+pcache_fill(struct inode *ip, uint pgoff, char *mem)
+{
+  struct buf *bp;
+  uint bn, blockno;
+  int i;
+
+  if(ip->dflags & DI_INLINE){
+    memset(mem, 0, PGSIZE);
+    if(pgoff == 0)
+      memmove(mem, ip->inlinedata, ip->size);
+    return;
+  }
+
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    bn = pgoff * (PGSIZE/BSIZE) + i;
+    if(bn * BSIZE >= ip->size || (blockno = bmap(ip, bn)) == 0){
+      memset(mem + i*BSIZE, 0, BSIZE);
+      continue;
+    }
+    bp = bread(ip->dev, blockno);
+    memmove(mem + i*BSIZE, bp->data, BSIZE);
+    brelse(bp);
+  }
+  if(ip->size > pgoff * PGSIZE && ip->size < (pgoff + 1) * PGSIZE)
+    memset(mem + ip->size % PGSIZE, 0, PGSIZE - ip->size % PGSIZE);
+}
+
+// Return page pgoff of a regular file, reading it in if it is not
+// cached yet. The page is returned with a reference held, which
+// the caller drops with pcache_put. Returns 0 if out of memory.
+//
+// Page faults call this without the inode lock, so a write can run
+// while the page is being read in. pcache_update does not see a page
+// that is not cached yet, so a page read while ip->pgen changed is
+// read again before it goes into the cache.
+char*
+pcache_get(struct inode *ip, uint pgoff)
+{
+  struct core_map_entry *pp;
+  char *mem;
+  uint gen;
+
+  acquire(&pcache.lock);
+  if((pp = pcache_lookup(ip, pgoff)) != 0){
+    inrementPageRefCount(page2pa(pp));
+    release(&pcache.lock);
+    return P2V(page2pa(pp));
+  }
+  gen = ip->pgen;
+  release(&pcache.lock);
+
+  // kalloc may reclaim cache pages, so it runs without the lock
+  if((mem = kalloc()) == 0)
+    return 0;
+  for(;;){
+    pcache_fill(ip, pgoff, mem);
+
+    acquire(&pcache.lock);
+    if((pp = pcache_lookup(ip, pgoff)) != 0){
+      // someone else read the page in while we were
+      inrementPageRefCount(page2pa(pp));
+      release(&pcache.lock);
+      kfree(mem);
+      return P2V(page2pa(pp));
+    }
+    if(ip->pgen == gen)
+      break;
+    gen = ip->pgen;
+    release(&pcache.lock);
+  }
+  pp = pa2page(V2P(mem));
+  pp->inode = ip;
+  pp->pgoff = pgoff;
+  pp->next = pcache.hash[pcache_hash(ip, pgoff)];
+  pcache.hash[pcache_hash(ip, pgoff)] = pp;
+  ip->npages++;
+  // one reference for the cache, one for the caller
+  inrementPageRefCount(V2P(mem));
+  release(&pcache.lock);
+  return mem;
+}
+
+// Drop a reference returned by pcache_get.
+void
+pcache_put(char *page)
+{
+  kfree(page);
+}
+
+// Copy n bytes written at offset off of a file into the pages of
+// the file that are cached. Pages that are not cached are left
+// alone; they are read from disk when next needed.
+void
+pcache_update(struct inode *ip, uint off, char *src, uint n)
+{
+  struct core_map_entry *pp;
+  uint tot, m;
+
+  // before npages is looked at, so pcache_get either sees the new
+  // generation or has its page in the cache by then
+  __sync_fetch_and_add(&ip->pgen, 1);
+  if(ip->npages == 0)
+    return;
+
+  acquire(&pcache.lock);
+  for(tot = 0; tot < n; tot += m, off += m, src += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    if((pp = pcache_lookup(ip, off/PGSIZE)) != 0)
+      memmove((char*)P2V(page2pa(pp)) + off%PGSIZE, src, m);
+  }
+  release(&pcache.lock);
+}
+
+// Drop every cached page of a file, e.g. because the file is
+// deleted or its inode cache entry is recycled. Pages still in use
+// elsewhere live on until their last reference is dropped.
+void
+pcache_drop(struct inode *ip)
+{
+  struct core_map_entry *pp;
+  int i;
+
+  if(ip->npages == 0)
+    return;
+
+  acquire(&pcache.lock);
+  for(i = 0; i < NPCHASH && ip->npages > 0; i++){
+    pp = pcache.hash[i];
+    while(pp){
+      struct core_map_entry *next = pp->next;
+      if(pp->inode == ip){
+        pcache_remove(pp);
+        kfree(P2V(page2pa(pp)));
+      }
+      pp = next;
+    }
+  }
+  release(&pcache.lock);
+}
+
+// Free one cached page that nobody but the cache refers to.
+// Returns 0 on success, -1 if there is no such page.
+int
+pcache_reclaim(void)
+{
+  struct core_map_entry *pp;
+  int n;
+
+  acquire(&pcache.lock);
+  for(n = 0; n < npages; n++, pcache.hand = (pcache.hand + 1) % npages){
+    pp = &core_map[pcache.hand];
+    if(pp->inode && pp->refCount == 1){
+      pcache_remove(pp);
+      release(&pcache.lock);
+      kfree(P2V(page2pa(pp)));
+      return 0;
+    }
+  }
+  release(&pcache.lock);
+  return -1;
+}
@@ -0,0 +1,188 @@
+//
+// Waiting for any of several files at once.
+//
+// Each object poll can wait on (a pipe, the console) has a struct
+// waitqueue. poll hangs an entry for itself on the queue of every
+// file it is given, checks the files, and sleeps until one of the
+// queues is woken or the timeout runs out. Objects call pollwakeup
+// whenever they may have become ready; it is cheap when nobody is
+// polling them.
+//
+// All wait queues are protected by polllock, which is also what poll
+// sleeps on, so a wakeup that comes between checking the files and
+// going to sleep is not lost.
+//
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <spinlock.h>
+#include <sleeplock.h>
+#include <fs.h>
+#include <file.h>
+#include <poll.h>
+#include <proc.h>
+
+// one process in poll
+struct poller {
+  int woken;  // set by pollwakeup
+};
+
+// a poller waiting on one wait queue
+struct pollentry {
+  struct poller *poller;
+  struct pollentry *next;
+};
+
+// one wait queue a poll call hangs an entry on
+struct pollslot {
+  struct pollentry entry;
+  struct waitqueue *wq;
+};
+
+struct spinlock polllock;
+struct waitqueue polltimeouts;  // pollers with a timeout, woken every tick
+
+extern uint ticks;
+
+void
+pollinit(void)
+{
+  initlock(&polllock, "poll");
+}
+
+// Wake the pollers waiting on wq.
+void
+pollwakeup(struct waitqueue *wq)
+{
+  struct pollentry *e;
+
+  // nobody is polling, the usual case. A poller queues itself before
+  // it looks at the object, so it either is on the queue by now or
+  // will see whatever the caller just changed.
+  if(wq->head == 0)
+    return;
+
+  acquire(&polllock);
+  for(e = wq->head; e; e = e->next){
+    e->poller->woken = 1;
+    wakeup(e->poller);
+  }
+  release(&polllock);
+}
+
+// Called every tick so pollers can check their timeouts.
+void
+polltick(void)
+{
+  pollwakeup(&polltimeouts);
+}
+
+static void
+pollqueue(struct waitqueue *wq, struct pollentry *e)
+{
+  e->next = wq->head;
+  wq->head = e;
+}
+
+static void
+pollunqueue(struct waitqueue *wq, struct pollentry *e)
+{
+  struct pollentry **pp;
+
+  for(pp = &wq->head; *pp; pp = &(*pp)->next){
+    if(*pp == e){
+      *pp = e->next;
+      return;
+    }
+  }
+}
+
+// Wait until one of the nfds files in fds is ready for the events
+// asked for, or timeout ticks have passed. A timeout of -1 waits
+// forever, 0 does not wait at all. Fills in revents of every entry.
+// Returns the number of entries with revents set, or -1 if the
+// process was killed while waiting.
+int
+pollfds(struct pollfd *fds, int nfds, int timeout)
+{
+  struct proc *p = myproc();
+  struct poller poller;
+  struct pollslot *slots;
+  struct file *f;
+  struct waitqueue *wq;
+  uint start;
+  int i, n, nqueues, order;
+
+  if(nfds < 0 || nfds > MAXOFILE)
+    return -1;
+
+  // one slot per file plus one for the timeout
+  for(order = 0; (PGSIZE << order) < (nfds + 1) * sizeof(*slots); order++)
+    ;
+  if((slots = (struct pollslot*)kalloc_pages(order)) == 0)
+    return -1;
+
+  // fds is user memory and may fault, so find the queues before
+  // taking polllock
+  nqueues = 0;
+  for(i = 0; i < nfds; i++){
+    if((f = fdget(fds[i].fd)) == 0)
+      continue;
+    if((wq = fileWaitQueue(f)) == 0)
+      continue;
+    slots[nqueues++].wq = wq;
+  }
+  if(timeout > 0)
+    slots[nqueues++].wq = &polltimeouts;
+
+  poller.woken = 0;
+  acquire(&polllock);
+  for(i = 0; i < nqueues; i++){
+    slots[i].entry.poller = &poller;
+    pollqueue(slots[i].wq, &slots[i].entry);
+  }
+  release(&polllock);
+
+  start = ticks;
+  for(;;){
+    // a wakeup from here on makes us look again
+    acquire(&polllock);
+    poller.woken = 0;
+    release(&polllock);
+
+    n = 0;
+    for(i = 0; i < nfds; i++){
+      fds[i].revents = 0;
+      if(fds[i].fd < 0)
+        continue;
+      if((f = fdget(fds[i].fd)) == 0)
+        fds[i].revents = POLLNVAL;
+      else
+        fds[i].revents = pollFile(f, fds[i].events);
+      if(fds[i].revents)
+        n++;
+    }
+    if(n > 0 || timeout == 0 || p->killed)
+      break;
+    if(timeout > 0 && ticks - start >= timeout)
+      break;
+
+    acquire(&polllock);
+    while(!poller.woken && !p->killed)
+      sleep(&poller, &polllock);
+    release(&polllock);
+  }
+
+  acquire(&polllock);
+  for(i = 0; i < nqueues; i++)
+    pollunqueue(slots[i].wq, &slots[i].entry);
+  release(&polllock);
+  kfree_pages((char*)slots, order);
+
+  if(n == 0 && p->killed)
+    return -1;
+  return n;
+}
@@ -19,6 +19,7 @@ static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
+static void kthreadret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
@@ -87,7 +88,12 @@ found:
   memset(p->context, 0, sizeof *p->context);
   p->context->rip = (uint64_t)forkret;
 
-
+  // no open files and no memory mappings yet
+  fdinit(p);
+  memset(p->vmas, 0, sizeof(p->vmas));
+  p->mapped_file = 0;
+  p->mem_regions[MMAP].start = 0;
+  p->mem_regions[MMAP].size = 0;
 
   return p;
 }
@@ -104,6 +110,33 @@ getProcessAtIndex(int index) {
   return p;
 }
 
+// Start a kernel thread that runs fn, which must never return.
+// A kernel thread has a page table with only the kernel part and
+// no pid of its own, so user pids are the same with or without it.
+struct proc*
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pml4 = setupkvm()) == 0)
+    panic("kthread");
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // start in kthreadret, which returns into fn instead of trapret.
+  // Not forkret: the first process through it initializes the file
+  // system, and that has to be the process that then uses it.
+  p->context->rip = (uint64_t)kthreadret;
+  *(uint64_t*)((char*)p->context + sizeof *p->context) = (uint64_t)fn;
+
+  acquire(&ptable.lock);
+  if(p->pid == nextpid - 1)
+    nextpid--;
+  p->pid = 0;
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+  return p;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
@@ -172,6 +205,7 @@ fork(void)
     kfree(newProcess->kstack);
     return -1;
   }
+  newProcess->pml4 = pgtbl;
 
   // loop through every region for the parent process excluding the mmaped I/O region
   for (int region = 0; region < 3; region++) {
@@ -189,62 +223,25 @@ fork(void)
       // get the pate table entry for the parent's process page
       pte_t *pte;
       if ((pte = walkpml4(currentProcess->pml4, (char *)pgVAddr, 0)) == 0) {
-        newProcess->state = UNUSED;
-        kfree(newProcess->kstack);
-        return -1;
+        goto fork_failure;
       }
 
-      // set the write bit of the parent process to off
-      // turn the read only bit on
-      *pte &= ~(PTE_W);
-      *pte |= PTE_RO;
-      *pte |= PTE_U;
-
-      // set up mapping of virtual address to physical address for the child process
-      uint64_t pa = PTE_ADDR(*pte);
+      // the child shares the page, or its swap slot if it is swapped
+      // out, copy-on-write
       pte_t *childPTE;
-      if ((childPTE = walkpml4(pgtbl, (char*)pgVAddr, 1)) == 0) {
-        newProcess->state = UNUSED;
-        kfree(newProcess->kstack);
-        return -1;
+      if ((childPTE = walkpml4(pgtbl, (char*)pgVAddr, 1)) == 0 ||
+          sharePTE(pte, pgtbl, pgVAddr, childPTE, 1) < 0) {
+        goto fork_failure;
       }
-      *childPTE = *pte;
-
-      inrementPageRefCount(pa);
-      switchuvm(currentProcess);
     }
   }
+  switchuvm(currentProcess);
 
-
-
-  // need to copy memory mapped region
-  if (currentProcess->mem_regions[MMAP].start != 0) {
-
-    // get page table entry
-    pte_t *pte = walkpml4(currentProcess->pml4, currentProcess->mem_regions[MMAP].start, 0);
-    if (pte == 0) {
-      return -1;
-    }
-
-    // set region mapping
-    newProcess->mem_regions[MMAP].start = currentProcess->mem_regions[MMAP].start;
-    newProcess->mem_regions[MMAP].size = currentProcess->mem_regions[MMAP].size;
-    newProcess->mapped_file = currentProcess->mapped_file;
-
-    // need to map the mmaped region to point to the same physical address
-    uint64_t pa = PTE_ADDR(*pte);
-    if (mappages(pgtbl, ((uint64_t)currentProcess->mem_regions[MMAP].start) >> PT_SHIFT, 1, pa >> PT_SHIFT, PTE_W | PTE_U, newProcess->pid) < 0) {
-      newProcess->state = UNUSED;
-      kfree(newProcess->kstack);
-      return -1;
-    }
-
-    // increase ref count for the physical page being mapped
-    struct core_map_entry *cme = pa2page(pa);
-    cme->refCount++;
+  // share or copy-on-write the memory mappings
+  if (vma_fork(currentProcess, newProcess, pgtbl) < 0) {
+    goto fork_failure;
   }
 
-  newProcess->pml4 = pgtbl;
   newProcess->parent = currentProcess;
 
 
@@ -259,15 +256,9 @@ fork(void)
   *(newProcess->tf) = *(currentProcess->tf);
 
   // duplicate all the open files in the new process
-  for (int i = 0; i < NOFILE; i++) {
-    if (currentProcess->oft[i] != 0) {
-      newProcess->oft[i] = currentProcess->oft[i];
-      if (dupFile(newProcess->oft[i]) == -1) {
-        newProcess->state = UNUSED;
-        kfree(newProcess->kstack);
-        return -1;
-      }
-    }
+  if (fdcopy(currentProcess, newProcess) == -1) {
+    fdcloseall(newProcess);
+    goto fork_failure;
   }
 
   // set the return register of fork to be different in both the child
@@ -284,6 +275,20 @@ fork(void)
   release(&ptable.lock);
 
   return newProcess->pid;
+
+fork_failure:
+  // give back what the child shares with the parent so far
+  for (int i = 0; i < NVMA; i++) {
+    if (newProcess->vmas[i].inode) {
+      iput(newProcess->vmas[i].inode);
+    }
+  }
+  memset(newProcess->vmas, 0, sizeof(newProcess->vmas));
+  freevm(pgtbl, newProcess->pid);
+  newProcess->pml4 = 0;
+  newProcess->state = UNUSED;
+  kfree(newProcess->kstack);
+  return -1;
 }
 
 // Exit the current process.  Does not return.
@@ -294,6 +299,10 @@ exit(void)
 {
   // your code here
   struct proc *currentProcess = myproc();
+
+  // write back and drop the memory mappings
+  vma_unmap_all(currentProcess);
+
   // wake up parent waiting on this process
   wakeup(currentProcess->parent);
 
@@ -320,14 +329,9 @@ exit(void)
   }
 
   // close all files for the current process
-  for (int i = 0; i < NOFILE; i++) {
-    if (currentProcess->oft[i] != 0) {
-      release(&ptable.lock);
-      closeFile(currentProcess->oft[i]);
-      currentProcess->oft[i] = 0;
-      acquire(&ptable.lock);
-    }
-  }
+  release(&ptable.lock);
+  fdcloseall(currentProcess);
+  acquire(&ptable.lock);
 
   // set state of current process to zombie so that it won't get timesliced back in
   currentProcess->state = ZOMBIE;
@@ -444,16 +448,19 @@ void
 scheduler(void)
 {
   struct proc *p;
+  int ran;
 
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
     // Loop over process table looking for process to run.
+    ran = 0;
     acquire(&ptable.lock);
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
       if(p->state != RUNNABLE)
         continue;
+      ran = 1;
 
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
@@ -470,6 +477,9 @@ scheduler(void)
     }
     release(&ptable.lock);
 
+    // nothing to run: zero pages ahead for kalloc_zeroed
+    if(!ran)
+      kzero_idle();
   }
 }
 
@@ -536,6 +546,15 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// A kernel thread's very first scheduling by scheduler()
+// will swtch here.  "Return" to the thread's function (see kthread).
+static void
+kthreadret(void)
+{
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -0,0 +1,170 @@
+// Reverse mappings.
+//
+// Each user page keeps a chain of the (page table, va) pairs that map
+// it, in core_map_entry.rmap, so eviction and swapping find the PTEs
+// of a page without searching every process. A page that is swapped
+// out hands its chain to its swap slot, and gets it back when it is
+// swapped in. A mapping is added by add_phy_mem_map or when fork
+// shares a page, and removed when the PTE is cleared.
+//
+// The chains are protected by rmap.lock. Entries come from a slab
+// cache, which may sleep to allocate, so an entry is allocated before
+// the lock is taken. Code that has to publish a mapping in one step
+// with other state allocates the entry with rmap_alloc first and links
+// it in later with rmap_link, which does not sleep.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <spinlock.h>
+#include <slab.h>
+
+struct rmap {
+  pml4e_t *pml4;
+  uint64_t va;
+  struct rmap *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct slab_cache slab;
+} rmap;
+
+void
+rmap_init(void)
+{
+  initlock(&rmap.lock, "rmap");
+  slab_init(&rmap.slab, "rmap", sizeof(struct rmap));
+}
+
+// Allocate an entry for rmap_link. May sleep, and may evict pages to
+// do so. Returns 0 if out of memory.
+struct rmap*
+rmap_alloc(void)
+{
+  return slab_alloc(&rmap.slab);
+}
+
+// Give back an entry from rmap_alloc that was not linked.
+void
+rmap_free(struct rmap *r)
+{
+  slab_free(&rmap.slab, r);
+}
+
+// Record with entry r that va in page table pml4 maps the page or
+// swap slot whose chain is *head.
+void
+rmap_link(struct rmap **head, struct rmap *r, pml4e_t *pml4, uint64_t va)
+{
+  r->pml4 = pml4;
+  r->va = va;
+  acquire(&rmap.lock);
+  r->next = *head;
+  *head = r;
+  release(&rmap.lock);
+}
+
+// Record that va in page table pml4 maps the page or swap slot
+// whose chain is *head. Returns 0, or -1 if out of memory.
+int
+rmap_add(struct rmap **head, pml4e_t *pml4, uint64_t va)
+{
+  struct rmap *r;
+
+  if((r = rmap_alloc()) == 0)
+    return -1;
+  rmap_link(head, r, pml4, va);
+  return 0;
+}
+
+// Forget the mapping of va in pml4, if *head has it.
+void
+rmap_remove(struct rmap **head, pml4e_t *pml4, uint64_t va)
+{
+  struct rmap **pp, *r;
+
+  acquire(&rmap.lock);
+  for(pp = head; (r = *pp) != 0; pp = &r->next){
+    if(r->pml4 == pml4 && r->va == va){
+      *pp = r->next;
+      release(&rmap.lock);
+      slab_free(&rmap.slab, r);
+      return;
+    }
+  }
+  release(&rmap.lock);
+}
+
+// Move the chain at *from onto the front of *to.
+void
+rmap_move(struct rmap **from, struct rmap **to)
+{
+  struct rmap **pp;
+
+  acquire(&rmap.lock);
+  if(*from){
+    for(pp = from; *pp; pp = &(*pp)->next)
+      ;
+    *pp = *to;
+    *to = *from;
+    *from = 0;
+  }
+  release(&rmap.lock);
+}
+
+// Move the mapping of va in pml4 from chain *from to chain *to.
+// Returns 0, or -1 if *from does not have it.
+int
+rmap_relink(struct rmap **from, struct rmap **to, pml4e_t *pml4, uint64_t va)
+{
+  struct rmap **pp, *r;
+
+  acquire(&rmap.lock);
+  for(pp = from; (r = *pp) != 0; pp = &r->next){
+    if(r->pml4 == pml4 && r->va == va){
+      *pp = r->next;
+      r->next = *to;
+      *to = r;
+      release(&rmap.lock);
+      return 0;
+    }
+  }
+  release(&rmap.lock);
+  return -1;
+}
+
+// Forget every mapping on the chain at *head.
+void
+rmap_clear(struct rmap **head)
+{
+  struct rmap *r, *next;
+
+  if(*head == 0)
+    return;
+  acquire(&rmap.lock);
+  r = *head;
+  *head = 0;
+  release(&rmap.lock);
+  for(; r; r = next){
+    next = r->next;
+    slab_free(&rmap.slab, r);
+  }
+}
+
+// Call fn with the page table, the PTE and arg for each mapping on
+// the chain at *head. fn must not sleep or change the chain.
+void
+rmap_walk(struct rmap **head, void (*fn)(pml4e_t*, pte_t*, void*), void *arg)
+{
+  struct rmap *r;
+  pte_t *pte;
+
+  acquire(&rmap.lock);
+  for(r = *head; r; r = r->next)
+    if((pte = walkpml4(r->pml4, (char*)r->va, 0)) != 0)
+      fn(r->pml4, pte, arg);
+  release(&rmap.lock);
+}
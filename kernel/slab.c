@@ -0,0 +1,142 @@
+// Slab allocator.
+//
+// A slab cache hands out kernel objects of one size, carved from
+// pages that kalloc returns. Each page, a slab, starts with a struct
+// slab and holds as many objects after it as fit. Free objects are
+// linked through their first word.
+//
+// Interface:
+// * slab_init sets up a cache for objects of a given size.
+// * slab_alloc returns an object, slab_free gives it back. Objects
+//     are not cleared in between.
+//
+// Slabs that have free objects are on the cache's partial list, so
+// slab_alloc takes from its head. A slab whose objects are all free
+// goes back to kalloc, unless it is the only partial slab left, which
+// is kept so that allocating and freeing one object does not take a
+// page from kalloc every time.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <spinlock.h>
+#include <slab.h>
+
+struct slab {
+  struct slab_cache *cache;
+  struct slab *next;   // partial list
+  struct slab *prev;
+  void *free;          // free objects
+  uint inuse;          // objects handed out
+};
+
+#define SLAB_HDR  ((sizeof(struct slab) + 7) & ~7)
+
+void
+slab_init(struct slab_cache *c, char *name, uint size)
+{
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = (max(size, (uint)sizeof(void*)) + 7) & ~7;
+  if(c->size > PGSIZE - SLAB_HDR)
+    panic("slab_init");
+  c->perslab = (PGSIZE - SLAB_HDR) / c->size;
+  c->partial = 0;
+}
+
+// Add s to the partial list. Caller holds c->lock.
+static void
+slab_link(struct slab_cache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+// Take s off the partial list. Caller holds c->lock.
+static void
+slab_unlink(struct slab_cache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->next = 0;
+  s->prev = 0;
+}
+
+// Turn a page from kalloc into a slab of free objects of cache c.
+static void
+slab_carve(struct slab_cache *c, struct slab *s)
+{
+  char *obj;
+  uint i;
+
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  obj = (char*)s + SLAB_HDR;
+  for(i = 0; i < c->perslab; i++, obj += c->size){
+    *(void**)obj = s->free;
+    s->free = obj;
+  }
+}
+
+// Allocate an object from cache c. Returns 0 if out of memory.
+void*
+slab_alloc(struct slab_cache *c)
+{
+  struct slab *s;
+  void *obj;
+
+  acquire(&c->lock);
+  while((s = c->partial) == 0){
+    // kalloc may sleep to swap a page out, so it runs without the lock
+    release(&c->lock);
+    if((s = (struct slab*)kalloc()) == 0)
+      return 0;
+    slab_carve(c, s);
+    acquire(&c->lock);
+    slab_link(c, s);
+  }
+
+  obj = s->free;
+  s->free = *(void**)obj;
+  if(++s->inuse == c->perslab)
+    slab_unlink(c, s);
+  release(&c->lock);
+  return obj;
+}
+
+// Give back an object that slab_alloc(c) returned.
+void
+slab_free(struct slab_cache *c, void *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint64_t)obj);
+  if(s->cache != c || (char*)obj < (char*)s + SLAB_HDR)
+    panic("slab_free");
+
+  acquire(&c->lock);
+  if(s->inuse == c->perslab)
+    slab_link(c, s);  // was full
+  *(void**)obj = s->free;
+  s->free = obj;
+  s->inuse--;
+
+  if(s->inuse == 0 && (c->partial != s || s->next != 0)){
+    slab_unlink(c, s);
+    release(&c->lock);
+    s->cache = 0;
+    kfree((char*)s);
+    return;
+  }
+  release(&c->lock);
+}
@@ -53,3 +53,73 @@ holdingsleep(struct sleeplock *lk)
 }
 
 
+
+void
+initrwsleeplock(struct rwsleeplock *lk, char *name)
+{
+  initlock(&lk->lk, "rw sleep lock");
+  lk->name = name;
+  lk->readers = 0;
+  lk->writer = 0;
+  lk->waitingWriters = 0;
+  lk->pid = 0;
+}
+
+// Take the lock shared with other readers.
+void
+acquiresleepread(struct rwsleeplock *lk)
+{
+  acquire(&lk->lk);
+  // let waiting writers in first so a stream of readers can't starve them
+  while (lk->writer || lk->waitingWriters > 0) {
+    sleep(lk, &lk->lk);
+  }
+  lk->readers++;
+  release(&lk->lk);
+}
+
+void
+releasesleepread(struct rwsleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->readers--;
+  if (lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
+// Take the lock exclusively.
+void
+acquiresleepwrite(struct rwsleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->waitingWriters++;
+  while (lk->writer || lk->readers > 0) {
+    sleep(lk, &lk->lk);
+  }
+  lk->waitingWriters--;
+  lk->writer = 1;
+  lk->pid = myproc()->pid;
+  release(&lk->lk);
+}
+
+void
+releasesleepwrite(struct rwsleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->writer = 0;
+  lk->pid = 0;
+  wakeup(lk);
+  release(&lk->lk);
+}
+
+int
+holdingsleepwrite(struct rwsleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->writer;
+  release(&lk->lk);
+  return r;
+}
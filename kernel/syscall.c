@@ -145,33 +145,46 @@ argint64(int n, int64_t *ip)
   return 0;
 }
 
-// Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// Check that the block of size bytes at addr lies within the
+// process address space and set *pp to point at it.
 int
-argptr(int n, char **pp, int size)
+fetchptr(uint64_t addr, char **pp, int size)
 {
-  int64_t i;
-
-  if(argint64(n, &i) < 0)
-    return -1;
   if(size < 0)
     return -1;
-  if (((uint64_t)i >= (uint64_t)myproc()->mem_regions[CODE].start) && ((uint64_t)i + size <= (uint64_t)myproc()->mem_regions[CODE].start + myproc()->mem_regions[CODE].size)) {
-      *pp = (char*)i;
+  if ((addr >= (uint64_t)myproc()->mem_regions[CODE].start) && (addr + size <= (uint64_t)myproc()->mem_regions[CODE].start + myproc()->mem_regions[CODE].size)) {
+      *pp = (char*)addr;
       return 0;
     }
-  if (((uint64_t)i >= (uint64_t)myproc()->mem_regions[HEAP].start) && ((uint64_t)i + size <= (uint64_t)myproc()->mem_regions[HEAP].start + myproc()->mem_regions[HEAP].size)) {
-    *pp = (char*)i;
+  if ((addr >= (uint64_t)myproc()->mem_regions[HEAP].start) && (addr + size <= (uint64_t)myproc()->mem_regions[HEAP].start + myproc()->mem_regions[HEAP].size)) {
+    *pp = (char*)addr;
+    return 0;
+  }
+  if ((addr >= (uint64_t)myproc()->mem_regions[USTACK].start) && (addr + size <= (uint64_t)myproc()->mem_regions[USTACK].start + myproc()->mem_regions[USTACK].size)) {
+    *pp = (char*)addr;
     return 0;
   }
-  if (((uint64_t)i >= (uint64_t)myproc()->mem_regions[USTACK].start) && ((uint64_t)i + size <= (uint64_t)myproc()->mem_regions[USTACK].start + myproc()->mem_regions[USTACK].size)) {
-    *pp = (char*)i;
+  // memory mappings fault their pages in as the kernel touches them
+  if (vma_check(myproc(), addr, size) == 0) {
+    *pp = (char*)addr;
     return 0;
   }
   return -1;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+  int64_t i;
+
+  if(argint64(n, &i) < 0)
+    return -1;
+  return fetchptr(i, pp, size);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -210,6 +223,17 @@ extern int sys_sysinfo(void);
 extern int sys_mmap(void);
 extern int sys_munmap(void);
 extern int sys_crashn(void);
+extern int sys_mmap2(void);
+extern int sys_munmap2(void);
+extern int sys_msync(void);
+extern int sys_sendfile(void);
+extern int sys_splice(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_poll(void);
+extern int sys_pipe2(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    = sys_fork,
@@ -237,6 +261,17 @@ static int (*syscalls[])(void) = {
 [SYS_mmap]    = sys_mmap,
 [SYS_munmap]  = sys_munmap,
 [SYS_crashn]  = sys_crashn,
+[SYS_mmap2]   = sys_mmap2,
+[SYS_munmap2] = sys_munmap2,
+[SYS_msync]   = sys_msync,
+[SYS_sendfile] = sys_sendfile,
+[SYS_splice]  = sys_splice,
+[SYS_pread]   = sys_pread,
+[SYS_pwrite]  = sys_pwrite,
+[SYS_readv]   = sys_readv,
+[SYS_writev]  = sys_writev,
+[SYS_poll]    = sys_poll,
+[SYS_pipe2]   = sys_pipe2,
 };
 
 void
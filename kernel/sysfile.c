@@ -15,8 +15,34 @@
 #include <sleeplock.h>
 #include <file.h>
 #include <fcntl.h>
+#include <mman.h>
+#include <uio.h>
+#include <poll.h>
 
-int     getOpenFileDescriptor();
+static int makePipe(int *arg, int flags);
+
+/*
+  Helper to fetch argument n as an open file descriptor of the
+  current process, setting *pfd and *pf if they are not NULL.
+  Returns 0 on success, -1 otherwise
+*/
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+  int fd;
+  struct file *f;
+
+  if (argint(n, &fd) < 0 || (f = fdget(fd)) == NULL) {
+    return -1;
+  }
+  if (pfd) {
+    *pfd = fd;
+  }
+  if (pf) {
+    *pf = f;
+  }
+  return 0;
+}
 
 
 /*
@@ -28,24 +54,21 @@ int     getOpenFileDescriptor();
 int
 sys_dup(void)
 {
-  int fd;
-  struct proc *currentProcess = myproc();
-  if (argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE || currentProcess->oft[fd] == 0) {
+  struct file *file;
+  if (argfd(0, NULL, &file) < 0) {
     // failed to obtain argument or invalid argument
     return -1;
   }
 
-  // search for new open file table position and return -1 if we cannot find an open spot
-  int newFd = getOpenFileDescriptor();
+  // put the same file at the lowest free descriptor, return -1 if there is none
+  int newFd = fdalloc(file);
   if (newFd == -1) {
     // failed to find an open file table position
     return -1;
   }
 
-  // set the reference at that position to the same file reference and
   // then call the file layer to duplicate the file
-  currentProcess->oft[newFd] = currentProcess->oft[fd];
-  dupFile(currentProcess->oft[fd]);
+  dupFile(file);
   return newFd;
 }
 
@@ -61,22 +84,21 @@ int
 sys_read(void)
 {
   // your code here
-  int fd;
+  struct file *file;
   char *buf;
   int numBytes;
 
-  // get and check arguments
-  if (argint(0, &fd) < 0 || argint(2, &numBytes) < 0 || argptr(1, &buf, numBytes) < 0) {
+  // get and check arguments, the file descriptor must be valid
+  if (argfd(0, NULL, &file) < 0 || argint(2, &numBytes) < 0 || argptr(1, &buf, numBytes) < 0) {
     // failed to get argument
     return -1;
   }
 
-  struct proc *currentProcess = myproc();
-  // file descriptor is not valid or numBytes is invalid
-  if (fd < 0 || fd >= NOFILE || numBytes < 0 || currentProcess->oft[fd] == 0) {
+  // numBytes is invalid
+  if (numBytes < 0) {
     return -1;
   }
-  return readFile(currentProcess->oft[fd], buf, numBytes);
+  return readFile(file, buf, numBytes);
 }
 
 /*
@@ -93,26 +115,24 @@ sys_write(void)
   // you have to change the code in this function.
   // Currently it support printing one character to screen
 
-  int fd;
+  struct file *file;
   int n;
   char *p;
 
-  // get arguments
-  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argint(0, &fd) < 0) {
+  // get arguments, the file descriptor must be valid
+  if(argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, NULL, &file) < 0) {
     // failed to retrieve arguments
     return -1;
   }
 
-  struct proc *currentProcess = myproc();
-
-  // check file descriptor and n's validity
-  if (fd < 0 || fd >= NOFILE || n < 0 || currentProcess->oft[fd] == 0) {
+  // check n's validity
+  if (n < 0) {
     // invalid args
     return -1;
   }
 
-  // get current process and call the file descriptor layer's implementation
-  return writeFile(currentProcess->oft[fd], p, n);
+  // call the file descriptor layer's implementation
+  return writeFile(file, p, n);
 }
 
 /*
@@ -126,36 +146,26 @@ sys_close(void)
 {
   // your code here
   int fd;
+  struct file *currentFile;
 
-  struct proc *currentProcess = myproc();
-  if(argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE || currentProcess->oft[fd] == 0) {
+  if(argfd(0, &fd, &currentFile) < 0) {
     // failed to retrieve arguments or invalid arguments
     return -1;
   }
 
-  // get current file and make the open file table spot vacent
-  struct file *currentFile = currentProcess->oft[fd];
-  currentProcess->oft[fd] = 0;
+  // make the open file table spot vacent and close the file
+  fdfree(fd);
   return closeFile(currentFile);
 }
 
 int
 sys_fstat(void)
 {
-  int fd;
   struct file *f;
   struct stat *st;
-  if(argint(0, &fd) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0) {
-    // failed to retrieve arguments or invalid arguments
-    return -1;
-  }
-
-  // get the current process's open file tabe, if the open file table entry for the
-  // requested file descriptor is empty then return an error. Otherwise call fstat to
-  // get the stat struct information
-  struct proc *currentProcess = myproc();
-  f = currentProcess->oft[fd];
-  if(currentProcess->oft[fd] == 0) {
+  // if the open file table entry for the requested file descriptor is empty
+  // then return an error. Otherwise call fstat to get the stat struct information
+  if(argfd(0, NULL, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0) {
     // failed to retrieve arguments or invalid arguments
     return -1;
   }
@@ -171,12 +181,100 @@ sys_link(void)
 
 
 //PAGEBREAK!
+/*
+ * arg0: char * [path of the file to remove]
+ *
+ * Removes the directory entry of a file. The inode and its blocks are
+ * freed once the last open file referring to it is closed, and its
+ * inum is then reused by the next file created.
+ *
+ * returns 0 on success, -1 on error
+ */
 int
 sys_unlink(void)
 {
+  char name[DIRSIZ], *path;
+  struct inode *ip, *dp;
+  struct dirent de;
+  uint off;
+
+  if (argstr(0, &path) < 0)
+    return -1;
+
+  log_start_tx();
+  if ((dp = nameiparent(path, name)) == 0) {
+    log_end_tx();
+    return -1;
+  }
+  iload(dp);
+  acquiresleepwrite(&dp->lock);
+
+  if ((ip = dirlookup(dp, name, &off)) == 0)
+    goto bad;
+  iload(ip);
+  // only plain files can be removed, directories and devices stay
+  if (ip->type != T_FILE) {
+    iput(ip);
+    goto bad;
+  }
+
+  memset(&de, 0, sizeof(de));
+  if (writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+  ip->nlink--;
+  iupdate(ip);
+  iput(ip);
+
+  releasesleepwrite(&dp->lock);
+  iput(dp);
+  log_end_tx();
+  return 0;
+
+bad:
+  releasesleepwrite(&dp->lock);
+  iput(dp);
+  log_end_tx();
   return -1;
 }
 
+/*
+ * Make a new empty file at path, returning its inode with a reference
+ * held, or 0 if the parent directory does not exist or is full.
+ */
+static struct inode*
+create(char *path)
+{
+  char name[DIRSIZ];
+  struct inode *dp, *ip;
+  uint inum;
+
+  log_start_tx();
+  if ((dp = nameiparent(path, name)) == 0) {
+    log_end_tx();
+    return 0;
+  }
+  iload(dp);
+  acquiresleepwrite(&dp->lock);
+
+  // another process may have created it while we waited for the log
+  if ((ip = dirlookup(dp, name, 0)) == 0 &&
+      (inum = ialloc(dp->dev, T_FILE)) != 0) {
+    ip = iget(dp->dev, inum);
+    if (dirlink(dp, name, inum) < 0) {
+      // no room for the entry: dropping the only link frees the inode
+      iload(ip);
+      ip->nlink = 0;
+      iput(ip);
+      ip = 0;
+    }
+  }
+
+  releasesleepwrite(&dp->lock);
+  iput(dp);
+  log_end_tx();
+  return ip;
+}
+
 /*
  * arg0: char * [path to the file]
  * arg1: int [mode for opening the file (see inc/fcntl.h)]
@@ -213,54 +311,15 @@ sys_open(void)
     // arguments not valid
     return -1;
   }
+  // O_NONBLOCK is kept apart from the access mode
+  int flags = mode & O_NONBLOCK;
+  mode &= ~O_NONBLOCK;
 
-  // check if we need to create a file
-  if ((mode & O_CREATE) && namei(filename) == 0) {
-    // get the inodeFile from disk
-    // log_start_tx();
-    struct inode *inodeFile = iget(ROOTDEV, INODEFILEINO);
-    iload(inodeFile);
-
-    // make a new dinode for the new file
-    struct dinode dinode;
-    dinode.type = T_FILE;
-    dinode.major = 0;
-    dinode.minor = 0;
-    dinode.nlink = 1;
-    dinode.size = 0;
-    dinode.data.startblkno = 0;
-    dinode.data.nblocks = 0;
-
-    // get an area of 20 blocks for the dinode
-    // on disk, this method sets the startblockno
-    // and nblocks of the dinode to a found region
-    setBitmapWithDinode(&dinode);
-
-    struct inode *rootDirectory = iget(ROOTDEV, ROOTINO);
-    iload(rootDirectory);
-
-    struct dirent entry;
-    strncpy(entry.name, filename, DIRSIZ);
-
-
-    acquiresleep(&inodeFile->lock);
-    entry.inum = inodeFile->size / sizeof(dinode);
-    writei(inodeFile, (char *)&dinode, inodeFile->size, sizeof(dinode));
-    // char *b = kalloc();
-    // readi(inodeFile, b, inodeFile->size, sizeof(dinode));
-    // cprintf("buf = %s\n", b);
-    releasesleep(&inodeFile->lock);
-
-    acquiresleep(&rootDirectory->lock);
-    writei(rootDirectory, (char*)&entry, rootDirectory->size, sizeof(entry));
-    releasesleep(&rootDirectory->lock);
-
-    init_inodefile(ROOTDEV);
-    // log_end_tx();
-  }
-
+  // create the file if it does not exist yet
   struct inode *inode;
-  if ((inode = namei(filename)) == 0) {
+  if ((inode = namei(filename)) == 0 && (mode & O_CREATE))
+    inode = create(filename);
+  if (inode == 0) {
     // could not find an inode with given path and name
     return -1;
   }
@@ -280,7 +339,6 @@ sys_open(void)
   // }
 
   // allocate file and then put that file into the open file table for the process
-  struct proc *currentProcess = myproc();
   struct file *newFile = openFile();
   if (newFile == NULL) {
     // we have to release the inode reference we have if we faile to find an
@@ -289,21 +347,20 @@ sys_open(void)
     return -1;
   }
 
-  int fd = getOpenFileDescriptor();
+  // set values on the file struct
+  newFile->type = FTYPE_INODE;
+  newFile->inode = inode;
+  newFile->offset = 0;
+  newFile->permissions = mode;
+  newFile->flags = flags;
+
+  int fd = fdalloc(newFile);
   if (fd == -1) {
     // we could not find an open position in the open file table so we
-    // have to close the file space allocated and return an error
+    // have to close the file, which drops the inode, and return an error
     closeFile(newFile);
-    iput(inode);
     return -1;
   }
-  currentProcess->oft[fd] = newFile;
-
-  // set values on the file struct and return file descriptor
-  newFile->type = FTYPE_INODE;
-  newFile->inode = inode;
-  newFile->offset = 0;
-  newFile->permissions = mode;
   return fd;
 }
 
@@ -373,18 +430,45 @@ sys_pipe(void)
   if (ret < 0) {
     return -1;
   }
+  return makePipe(arg, 0);
+}
 
-  struct proc *currentProcess = myproc();
+/*
+ * arg0: int[2] [an array of sufficient size to hold the returned file descriptors]
+ * arg1: int [flags for both ends of the pipe, 0 or O_NONBLOCK]
+ *
+ * same as sys_pipe(), with the flags arg1 set on both file descriptors.
+ * with O_NONBLOCK reading an empty pipe or writing a full one returns
+ * -E_AGAIN instead of waiting.
+ *
+ * returns 0 on success, -1 otherwise
+ */
+int
+sys_pipe2(void)
+{
+  int *arg;
+  int flags;
+  int totalSize = sizeof(arg[0]) + sizeof(arg[1]);
+  if (argptr(0, (char **)&arg, totalSize) < 0 || argint(1, &flags) < 0 ||
+      (flags & ~O_NONBLOCK) != 0) {
+    return -1;
+  }
+  return makePipe(arg, flags);
+}
 
-  // get fd1
+/*
+  Helper for sys_pipe and sys_pipe2, makes a pipe with flags set
+  on both ends and puts its file descriptors in arg
+*/
+static int
+makePipe(int *arg, int flags)
+{
+  // get the two files
   struct file *f1 = openFile();
   if (f1 == NULL) {
     // allocating space for file1 failed
     return -1;
   }
-  f1->type = FTYPE_PIPE;
-
-  // get fd2
   struct file *f2 = openFile();
   if (f2 == NULL) {
     // allocated a second file failed so we must
@@ -392,30 +476,6 @@ sys_pipe(void)
     closeFile(f1);
     return -1;
   }
-  f2->type = FTYPE_PIPE;
-
-  // get both the open file descriptors and if either fails, close
-  // the other file structs we allocated
-  int fd1 = getOpenFileDescriptor();
-  if (fd1 == -1 ) {
-    // we could not find an open position in the open file table so we
-    // have to close the file space allocated and return an error
-    closeFile(f1);
-    closeFile(f2);
-    return -1;
-  }
-  currentProcess->oft[fd1] = f1;
-
-  int fd2 = getOpenFileDescriptor();
-  if (fd2 == -1) {
-    // we could not find an open position in the open file table so we
-    // have to close the file space allocated and return an error
-    closeFile(f1);
-    closeFile(f2);
-    currentProcess->oft[fd1] = f1;
-    return -1;
-  }
-  currentProcess->oft[fd2] = f2;
 
   // make a pipe wirh given files
   struct pipe *pipe = openPipe(f1, f2);
@@ -425,14 +485,30 @@ sys_pipe(void)
     // before the method call
     closeFile(f1);
     closeFile(f2);
-    currentProcess->oft[fd1] = f1;
-    currentProcess->oft[fd2] = f2;
     return -1;
   }
 
   // set permissions on the files
   f1->permissions = O_RDONLY;
   f2->permissions = O_WRONLY;
+  f1->flags = flags;
+  f2->flags = flags;
+
+  // get both the open file descriptors, closing the files (and with
+  // them the pipe) if either fails
+  int fd1 = fdalloc(f1);
+  if (fd1 == -1) {
+    closeFile(f1);
+    closeFile(f2);
+    return -1;
+  }
+  int fd2 = fdalloc(f2);
+  if (fd2 == -1) {
+    fdfree(fd1);
+    closeFile(f1);
+    closeFile(f2);
+    return -1;
+  }
 
   // set the file descriptors in the return argument
   arg[0] = fd1;
@@ -440,23 +516,6 @@ sys_pipe(void)
   return 0;
 }
 
-/*
-  Helper method to get an open file descriptor in the table,
-  return the index into the process's open file table if it
-  succeeds, -1 if it fails
-*/
-int
-getOpenFileDescriptor() {
-  struct proc *currentProcess = myproc();
-  // loop through ever process to find an open file and whether we can use it
-  for (int i = 0; i < NOFILE; i++) {
-    if (currentProcess->oft[i] == 0) {
-      return i;
-    }
-  }
-  return -1;
-}
-
 /*
  * arg0: int [file descriptor of the mapped region]
  *
@@ -472,7 +531,7 @@ int
 sys_mmap(void)
 {
   int fd;
-  if (argint(0, &fd) < 0 || fd >= NOFILE || fd < 0) {
+  if (argfd(0, &fd, NULL) < 0) {
     // failed to retrieve arguments or invalid arguements
     return -1;
   }
@@ -490,9 +549,299 @@ int
 sys_munmap(void)
 {
   int fd;
-  if (argint(0, &fd) < 0 || fd >= NOFILE || fd < 0) {
+  if (argfd(0, &fd, NULL) < 0) {
     // failed to retrieve arguments or invalid arguements
     return -1;
   }
   return munmap(fd);
 }
+
+/*
+ * arg0: void * [address to place the mapping at, or 0]
+ * arg1: int [length of the mapping in bytes]
+ * arg2: int [PROT_READ and/or PROT_WRITE]
+ * arg3: int [MAP_SHARED or MAP_PRIVATE, optionally with MAP_ANONYMOUS]
+ * arg4: int [file descriptor of the file to map]
+ * arg5: int [offset into the file, a multiple of PGSIZE]
+ *
+ * Maps length bytes of the file at the given offset into memory. The
+ * mapping goes at the given address if that range is free, otherwise
+ * at the lowest free range above 2G. Pages are read in when first
+ * touched. Changes to a MAP_SHARED mapping are written back to the
+ * file by msync, munmap2 and exit, which requires PROT_WRITE mappings
+ * to be of a file opened for writing. Changes to a MAP_PRIVATE mapping
+ * are never written back.
+ *
+ * With MAP_ANONYMOUS the mapping is of zeroed memory instead of a file
+ * and the fd and offset are ignored. munmap2 gives the memory back.
+ *
+ * The address is returned as a 32-bit int, the user stub zero extends it.
+ *
+ * returns the address of the mapping, -1 on error
+ */
+int
+sys_mmap2(void)
+{
+  int64_t addr;
+  int length, prot, flags, fd, offset;
+  struct file *file;
+  uint64_t start;
+
+  if (argint64(0, &addr) < 0 || argint(1, &length) < 0 || argint(2, &prot) < 0 ||
+      argint(3, &flags) < 0 || argint(4, &fd) < 0 || argint(5, &offset) < 0)
+    return -1;
+  if (length <= 0 || offset < 0 || offset % PGSIZE != 0 ||
+      (flags & (MAP_SHARED | MAP_PRIVATE)) == 0 ||
+      (flags & (MAP_SHARED | MAP_PRIVATE)) == (MAP_SHARED | MAP_PRIVATE))
+    return -1;
+
+  if (flags & MAP_ANONYMOUS) {
+    if ((start = vma_map(myproc(), addr, length, prot, flags, 0, 0)) == 0)
+      return -1;
+    return start;
+  }
+
+  if ((file = fdget(fd)) == NULL ||
+      file->type != FTYPE_INODE || file->inode->type != T_FILE)
+    return -1;
+  // the file must be readable, and writable too if changes go back to it
+  if (file->permissions == O_WRONLY)
+    return -1;
+  if ((flags & MAP_SHARED) && (prot & PROT_WRITE) &&
+      !(file->permissions & (O_WRONLY | O_RDWR)))
+    return -1;
+
+  if ((start = vma_map(myproc(), addr, length, prot, flags, file->inode, offset)) == 0)
+    return -1;
+  return start;
+}
+
+/*
+ * arg0: void * [start of the range to unmap]
+ * arg1: int [length of the range in bytes]
+ *
+ * Writes back the dirty pages of shared mappings in the range and
+ * removes the range from the process's mappings.
+ *
+ * returns 0 on success, -1 on error
+ */
+int
+sys_munmap2(void)
+{
+  int64_t addr;
+  int length;
+
+  if (argint64(0, &addr) < 0 || argint(1, &length) < 0 || length <= 0)
+    return -1;
+  return vma_unmap(myproc(), addr, length);
+}
+
+/*
+ * arg0: void * [start of the range to write back]
+ * arg1: int [length of the range in bytes]
+ *
+ * Writes the pages of shared file mappings in the range that were
+ * changed since they were last written back to their files.
+ *
+ * returns 0 on success, -1 if part of the range is not mapped
+ */
+int
+sys_msync(void)
+{
+  int64_t addr;
+  int length;
+
+  if (argint64(0, &addr) < 0 || argint(1, &length) < 0 || length <= 0)
+    return -1;
+  return vma_msync(myproc(), addr, length);
+}
+
+/*
+ * arg0: int [file descriptor to send to]
+ * arg1: int [file descriptor of a regular file to send from]
+ * arg2: int [offset in arg1 to send from, -1 to use and advance the file offset]
+ * arg3: int [number of bytes to send]
+ *
+ * sends arg3 bytes of the file arg1 to arg0 without copying them through
+ * user space. a pipe gets the file's cached pages without any copy, so
+ * a write to the file before the pipe is read shows in what is read
+ * out of it; a page the file no longer caches, after an unlink say,
+ * keeps the data it had.
+ * returns the number of bytes sent, 0 at the end of the file, -1 on error
+ */
+int
+sys_sendfile(void)
+{
+  struct file *out, *in;
+  int off, n;
+
+  if (argfd(0, NULL, &out) < 0 || argfd(1, NULL, &in) < 0 || argint(2, &off) < 0 ||
+      argint(3, &n) < 0 || n < 0 || off < -1) {
+    return -1;
+  }
+  return sendFile(out, in, off, n);
+}
+
+/*
+ * arg0: int [file descriptor to move data from]
+ * arg1: int [file descriptor to move data to]
+ * arg2: int [number of bytes to move]
+ *
+ * moves up to arg2 bytes from arg0 to arg1 inside the kernel. one of the
+ * two must be a pipe, the other is read or written at its file offset.
+ * returns the number of bytes moved, -1 on error
+ */
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if (argfd(0, NULL, &in) < 0 || argfd(1, NULL, &out) < 0 || argint(2, &n) < 0 || n < 0) {
+    return -1;
+  }
+  return spliceFile(in, out, n);
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: char * [buffer to write read bytes to]
+ * arg2: int [number of bytes to read]
+ * arg3: int [offset in the file to read from]
+ *
+ * reads arg2 bytes at offset arg3 of the file arg0 into arg1. the file
+ * offset is neither used nor changed, so processes sharing arg0 can read
+ * at the same time. arg0 must not be a pipe.
+ * returns number of bytes read, or -1 if there was an error.
+ */
+int
+sys_pread(void)
+{
+  struct file *file;
+  int n, off;
+  char *buf;
+
+  if (argfd(0, NULL, &file) < 0 || argint(2, &n) < 0 || argptr(1, &buf, n) < 0 ||
+      argint(3, &off) < 0 || n < 0 || off < 0) {
+    return -1;
+  }
+  return preadFile(file, buf, n, off);
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: char * [buffer of bytes to write]
+ * arg2: int [number of bytes to write]
+ * arg3: int [offset in the file to write at]
+ *
+ * writes arg2 bytes of arg1 at offset arg3 of the file arg0. the file
+ * offset is neither used nor changed. arg0 must not be a pipe.
+ * returns number of bytes written, or -1 if there was an error.
+ */
+int
+sys_pwrite(void)
+{
+  struct file *file;
+  int n, off;
+  char *buf;
+
+  if (argfd(0, NULL, &file) < 0 || argint(2, &n) < 0 || argptr(1, &buf, n) < 0 ||
+      argint(3, &off) < 0 || n < 0 || off < 0) {
+    return -1;
+  }
+  return pwriteFile(file, buf, n, off);
+}
+
+/*
+  Helper to fetch the iovec array of argument n with iovcnt entries
+  into iov, checking that every buffer lies in the process's memory.
+  Returns 0 on success, -1 otherwise
+*/
+static int
+argiovec(int n, int iovcnt, struct iovec *iov) {
+  struct iovec *uiov;
+
+  if (iovcnt < 0 || iovcnt > IOV_MAX ||
+      argptr(n, (char **)&uiov, iovcnt * sizeof(struct iovec)) < 0) {
+    return -1;
+  }
+  // copy the array first so the user cannot change it after the checks
+  memmove(iov, uiov, iovcnt * sizeof(struct iovec));
+  for (int i = 0; i < iovcnt; i++) {
+    char *p;
+    if (iov[i].iov_len < 0 ||
+        fetchptr((uint64_t)iov[i].iov_base, &p, iov[i].iov_len) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: struct iovec * [buffers to read into]
+ * arg2: int [number of buffers in arg1, at most IOV_MAX]
+ *
+ * reads from arg0 into each buffer of arg1 in turn, as one read call per
+ * buffer would, stopping at the first short read.
+ * returns the total number of bytes read, or -1 if there was an error.
+ */
+int
+sys_readv(void)
+{
+  struct file *file;
+  int iovcnt;
+  struct iovec iov[IOV_MAX];
+
+  if (argfd(0, NULL, &file) < 0 || argint(2, &iovcnt) < 0 || argiovec(1, iovcnt, iov) < 0) {
+    return -1;
+  }
+  return readvFile(file, iov, iovcnt);
+}
+
+/*
+ * arg0: int [file descriptor]
+ * arg1: struct iovec * [buffers to write]
+ * arg2: int [number of buffers in arg1, at most IOV_MAX]
+ *
+ * writes each buffer of arg1 to arg0 in turn, as one write call per
+ * buffer would, stopping at the first short write.
+ * returns the total number of bytes written, or -1 if there was an error.
+ */
+int
+sys_writev(void)
+{
+  struct file *file;
+  int iovcnt;
+  struct iovec iov[IOV_MAX];
+
+  if (argfd(0, NULL, &file) < 0 || argint(2, &iovcnt) < 0 || argiovec(1, iovcnt, iov) < 0) {
+    return -1;
+  }
+  return writevFile(file, iov, iovcnt);
+}
+
+/*
+ * arg0: struct pollfd * [files to wait for and the events to wait for on each]
+ * arg1: int [number of entries in arg0, at most MAXOFILE]
+ * arg2: int [ticks to wait at most, -1 to wait until a file is ready]
+ *
+ * waits until one of the files in arg0 is ready for one of its events
+ * (POLLIN, POLLOUT) or arg2 ticks have passed, and fills in the revents
+ * of every entry. entries with a negative fd are ignored.
+ * returns the number of entries with revents set, 0 on timeout,
+ * -1 on error
+ */
+int
+sys_poll(void)
+{
+  struct pollfd *fds;
+  int nfds, timeout;
+
+  if (argint(1, &nfds) < 0 || nfds < 0 || nfds > MAXOFILE ||
+      argptr(0, (char **)&fds, nfds * sizeof(struct pollfd)) < 0 ||
+      argint(2, &timeout) < 0 || timeout < -1) {
+    return -1;
+  }
+  return pollfds(fds, nfds, timeout);
+}
@@ -57,6 +57,7 @@ trap(struct trap_frame *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      polltick();
     }
     lapiceoi();
     break;
@@ -93,24 +94,22 @@ trap(struct trap_frame *tf)
 
       // handle page swapping
       // get the current page table entry for the process
-      pte_t *pte;
-      if ((pte = walkpml4(currentProcess->pml4, (char *)addr, 0)) == 0) {
-
-        panic("invalid page");
-      }
-      if (!(*pte & PTE_P) && (*pte & PTE_DSK)) {
-        // this is where we handle a page swap
-        // 1. evict a page
-        // 2. pull page needed in
-        if (evictPage() == -1) {
-          panic("unable to evict page");
-        }
+      pte_t *pte = walkpml4(currentProcess->pml4, (char *)addr, 0);
+      if (pte != 0 && !(*pte & PTE_P) && (*pte & PTE_DSK)) {
+        // this is where we handle a page swap: pull the page
+        // needed in. kalloc evicts pages if there is no free one.
         if (swapPageIn(addr, pte) == -1) {
           panic("can't swap page in");
         }
         return;
       }
 
+      // pages of memory mappings are filled in on first touch
+      if ((pte == 0 || !(*pte & PTE_P)) &&
+          vma_fault(currentProcess, addr, tf->err & FEC_WR) == 0) {
+        return;
+      }
+
       // need to check that the address being accessed is within
       // mem_regions[USTACK].start + (10 * PGSIZE) else its an actual
       // trap exception.
@@ -131,36 +130,12 @@ trap(struct trap_frame *tf)
       }
 
       // check that the process has the RO bit set and the W bit off
-      if (!(*pte & PTE_W) && (*pte & PTE_RO)) {
-        if (addr >= SZ_2G) {
-          panic("Trying to write to memory above 2Gs");
-        }
-
-        // get the core map entry for the page
-        uint64_t pa = PTE_ADDR(*pte);
-        struct core_map_entry *cme = pa2page(pa);
-
-        if (cme->refCount > 1) {
-          // allocate a new page
-          char *mem = kalloc();
-          if (mem == 0) {
-            panic("kalloc couldn't make a new page");
-          }
-          decrementPageRefCount(pa);
-          memmove(mem, (char*)P2V(pa), PGSIZE);
-          *pte = PTE(V2P(mem), PTE_FLAGS(*pte) | PTE_W | PTE_P | PTE_U);
-          *pte &= ~(PTE_RO);
-          add_phy_mem_map(currentProcess->pid, PTE_ADDR(PGROUNDDOWN(addr)), PTE_ADDR(*pte));
-          switchuvm(currentProcess);
-          return;
-        } else if (cme->refCount == 1) {
-          *pte = PTE(*pte, PTE_FLAGS(*pte) | PTE_W | PTE_P | PTE_U);
-          *pte &= ~(PTE_RO);
-          switchuvm(currentProcess);
-          return;
-        } else {
-          panic("illegal core map entry");
+      if (pte != 0 && (*pte & PTE_P) && !(*pte & PTE_W) && (*pte & PTE_RO)) {
+        if (copyOnWrite(currentProcess->pml4, currentProcess->pid, PGROUNDDOWN(addr), pte) < 0) {
+          panic("kalloc couldn't make a new page");
         }
+        switchuvm(currentProcess);
+        return;
       }
 
       if(myproc() == 0 || (tf->cs&3) == 0) {
@@ -68,9 +68,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pml4e & PTE_P) {
     pdpt = (pdpte_t*)P2V(PDPT_ADDR(*pml4e));
   } else {
-    if(!alloc || (pdpt = (pdpte_t*)kalloc()) == 0)
+    if(!alloc || (pdpt = (pdpte_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pdpt, 0, PGSIZE);
     *pml4e = V2P(pdpt) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -79,9 +78,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pdpte & PTE_P) {
     pgdir = (pde_t*)P2V(PDE_ADDR(*pdpte));
   } else {
-    if(!alloc || (pgdir = (pde_t*)kalloc()) == 0)
+    if(!alloc || (pgdir = (pde_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pgdir, 0, PGSIZE);
     *pdpte = V2P(pgdir) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -90,9 +88,8 @@ walkpml4(pml4e_t *pml4, const void *va, int alloc)
   if (*pde & PTE_P) {
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
       return 0;
-    memset(pgtab, 0, PGSIZE);
     *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
   }
 
@@ -116,10 +113,10 @@ mappages(pml4e_t *pml4, uint64_t virt_pn, int num_page, uint64_t phy_pn, int per
     }
     if(*pte & PTE_P)
       panic("remap");
+    if (add_phy_mem_map(pml4, pid, virt_pn << PT_SHIFT, phy_pn << PT_SHIFT) < 0)
+      return -1;
     *pte = PTE(phy_pn << PT_SHIFT, perm | PTE_P);
 
-    add_phy_mem_map(pid, virt_pn << PT_SHIFT, phy_pn << PT_SHIFT);
-
     virt_pn ++;
     phy_pn ++;
   }
@@ -134,9 +131,8 @@ setupkvm(void)
   pml4e_t *pml4;
   struct kmap *k;
 
-  if((pml4 = (pml4e_t*)kalloc()) == 0)
+  if((pml4 = (pml4e_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pml4, 0, PGSIZE);
 
   struct kmap {
     void *virt;
@@ -203,10 +199,9 @@ inituvm(pml4e_t *pml4, char *init, int sz, int pid)
 
   i = 0;
   while (sz > 0) {
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if (mem == 0)
       panic("inituvm: kalloc failure 1");
-    memset(mem, 0, PGSIZE);
 
     if (mappages(pml4, i, 1, V2P(mem) >> PT_SHIFT, PTE_W|PTE_U, pid) < 0)
       panic("inituvm :mappages failure 1");
@@ -217,21 +212,21 @@ inituvm(pml4e_t *pml4, char *init, int sz, int pid)
   }
 
   // allocate the guard page
-  mem = kalloc();
+  mem = kalloc_zeroed();
   if (mem == 0)
     panic("inituvm: kalloc failure 2");
-  memset(mem, 0, PGSIZE);
   if (mappages(pml4, i, 1, V2P(mem) >> PT_SHIFT, PTE_W|PTE_U, pid) < 0)
     panic("inituvm :mappages failure 2");
   pte = walkpml4(pml4, (void*) (uint64_t)(i * PGSIZE), 0);
   *pte &= ~PTE_P;
+  // nothing maps the guard page, so it is never swapped
+  remove_phy_mem_map(pml4, pid, i * PGSIZE, V2P(mem));
   i ++;
 
   // allocate ustack
-  mem = kalloc();
+  mem = kalloc_zeroed();
   if (mem == 0)
     panic("inituvm: kalloc failure 3");
-  memset(mem, 0, PGSIZE);
   if (mappages(pml4, i, 1, V2P(mem) >> PT_SHIFT, PTE_W|PTE_U, pid) < 0)
     panic("inituvm :mappages failure 3");
 }
@@ -267,11 +262,10 @@ initustack(pml4e_t *pml4, struct mem_region *ustack_region, int pid)
 {
   char* mem_ustack;
   uint64_t ustack = SZ_2G - PGSIZE;
-  mem_ustack = kalloc();
+  mem_ustack = kalloc_zeroed();
   if(mem_ustack == 0){
     panic("initustack out of memory (3)\n");
   }
-    memset(mem_ustack, 0, PGSIZE);
   if(mappages(pml4, ustack >> PT_SHIFT, 1, V2P(mem_ustack) >> PT_SHIFT, PTE_W | PTE_U, pid) < 0){
     panic("initustack out of memory (4)\n");
   }
@@ -297,13 +291,12 @@ allocuvm(pml4e_t *pml4, char* start, uint64_t oldsz, uint64_t newsz, int pid)
 
   a = PGROUNDUP((uint64_t)start + oldsz);
   for(; a < (uint64_t)start + newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pml4, start, newsz, oldsz, pid);
       return -1;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pml4, a >> PT_SHIFT, 1, V2P(mem) >> PT_SHIFT, PTE_W|PTE_U, pid) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pml4, start, newsz, oldsz, pid);
@@ -353,7 +346,7 @@ int
 deallocuvm(pml4e_t *pml4, char* start, uint64_t oldsz, uint64_t newsz, int pid)
 {
   pte_t *pte;
-  uint64_t a, pa;
+  uint64_t a;
 
   if(newsz >= oldsz)
     return oldsz;
@@ -364,20 +357,8 @@ deallocuvm(pml4e_t *pml4, char* start, uint64_t oldsz, uint64_t newsz, int pid)
     if(!pte) {
       a = find_next_possible_page(pml4, a);
     }
-    else if((*pte & PTE_P) != 0){
-      pa = PTE_ADDR(*pte);
-      if(pa == 0)
-        panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
-      *pte = 0;
-      remove_phy_mem_map(pid, a, pa);
-    } else if ((*pte & PTE_P) == 0 && (*pte & PTE_DSK)) {
-      // handle disk page
-      // remove ref count
-      uint64_t swapIndex = *pte >> PT_SHIFT;
-      //cprintf("removing reference to disk page %d pid:%d\n", swapIndex, pid);
-      decrementSwapCoreMapEntryRefCount(swapIndex);
+    else if(*pte & (PTE_P | PTE_DSK)){
+      unmapUserPage(pml4, a, pte);
     }
   }
   return newsz;
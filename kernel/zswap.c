@@ -0,0 +1,226 @@
+// Compressed swap pool.
+//
+// A swapped out page that compresses well is kept compressed in a
+// pool of kernel memory instead of being written to the swap area on
+// disk, so swapping it back in costs a decompression rather than
+// eight disk reads. The page still owns a swap slot; the pool only
+// holds its contents until evictPage needs room and moves them out to
+// the slot on disk.
+//
+// Interface:
+// * zswap_store compresses a page into the pool and returns the
+//     length it takes, along with where it starts.
+// * zswap_load decompresses it again; zswap_free gives the space back.
+//
+// The pool is 2^ZSWAPORDER pages split into ZCHUNK-byte chunks, and a
+// compressed page takes a run of chunks next to each other, allocated
+// next fit from a bitmap. A page of zeroes takes no chunks at all.
+//
+// Pages are compressed with a small LZ77 coder. The output is a
+// sequence of items, each starting with a control byte c: if c < 0x80,
+// c+1 literal bytes follow; otherwise the item is a match of
+// (c & 0x7f) + ZMINMATCH bytes copied from a 16-bit distance back in
+// the page, stored in the next two bytes. Matches are found through
+// a hash table of the last position each 4-byte sequence was seen at.
+
+#include <cdefs.h>
+#include <defs.h>
+#include <param.h>
+#include <memlayout.h>
+#include <mmu.h>
+#include <spinlock.h>
+
+#define ZCHUNK     64                          // pool allocation unit
+#define ZNCHUNK    ((PGSIZE << ZSWAPORDER) / ZCHUNK)
+#define ZMAXLEN    (PGSIZE * 3 / 4)            // worse pages go to disk
+#define ZMINMATCH  4
+#define ZMAXMATCH  (0x7f + ZMINMATCH)
+#define ZHASHBITS  12
+
+struct {
+  struct spinlock lock;
+  char *pool;
+  uint64_t used[ZNCHUNK / 64];  // allocated chunks
+  int hint;                     // where the next allocation looks first
+  ushort table[1 << ZHASHBITS]; // compressor hash table
+  uchar out[ZMAXLEN];           // compressor output
+} zswap;
+
+void
+zswap_init(void)
+{
+  initlock(&zswap.lock, "zswap");
+  if((zswap.pool = kalloc_pages(ZSWAPORDER)) == 0)
+    panic("zswap_init");
+}
+
+static uint
+zhash(uchar *p)
+{
+  uint v = p[0] | p[1] << 8 | p[2] << 16 | (uint)p[3] << 24;
+  return (v * 2654435761U) >> (32 - ZHASHBITS);
+}
+
+// Compress a page into zswap.out. Returns the compressed length,
+// -1 if it is more than ZMAXLEN. Caller holds zswap.lock.
+static int
+lz_compress(uchar *in)
+{
+  uchar *out = zswap.out;
+  int i, lit, o, n, len, cand, dist;
+  uint h;
+
+  memset(zswap.table, 0xff, sizeof(zswap.table));
+  i = lit = o = 0;
+  while(i + ZMINMATCH <= PGSIZE){
+    h = zhash(in + i);
+    cand = zswap.table[h];
+    zswap.table[h] = i;
+    if(cand == 0xffff || memcmp(in + cand, in + i, ZMINMATCH) != 0){
+      i++;
+      continue;
+    }
+    for(len = ZMINMATCH; i + len < PGSIZE && len < ZMAXMATCH; len++)
+      if(in[cand + len] != in[i + len])
+        break;
+
+    // the literals since the last match go first
+    for(; lit < i; lit += n){
+      n = min(i - lit, 0x80);
+      if(o + 1 + n > ZMAXLEN)
+        return -1;
+      out[o++] = n - 1;
+      memmove(out + o, in + lit, n);
+      o += n;
+    }
+    if(o + 3 > ZMAXLEN)
+      return -1;
+    dist = i - cand;
+    out[o++] = 0x80 | (len - ZMINMATCH);
+    out[o++] = dist & 0xff;
+    out[o++] = dist >> 8;
+    i += len;
+    lit = i;
+  }
+  for(; lit < PGSIZE; lit += n){
+    n = min(PGSIZE - lit, 0x80);
+    if(o + 1 + n > ZMAXLEN)
+      return -1;
+    out[o++] = n - 1;
+    memmove(out + o, in + lit, n);
+    o += n;
+  }
+  return o;
+}
+
+static void
+lz_decompress(uchar *in, int len, uchar *out)
+{
+  int i, o, c, n, dist;
+
+  i = o = 0;
+  while(i < len){
+    c = in[i++];
+    if(c < 0x80){
+      memmove(out + o, in + i, c + 1);
+      i += c + 1;
+      o += c + 1;
+      continue;
+    }
+    n = (c & 0x7f) + ZMINMATCH;
+    dist = in[i] | in[i + 1] << 8;
+    i += 2;
+    // byte by byte: a match may overlap the bytes it produces
+    for(; n > 0; n--, o++)
+      out[o] = out[o - dist];
+  }
+}
+
+// Allocate a run of n chunks. Caller holds zswap.lock.
+// Returns the first chunk of the run, -1 if there is no such run.
+static int
+zpool_alloc(int n)
+{
+  int i = zswap.hint, first = 0, run = 0;
+
+  for(int scanned = 0; scanned < ZNCHUNK + n; scanned++, i++){
+    if(i == ZNCHUNK){
+      i = 0;
+      run = 0;
+    }
+    if(zswap.used[i / 64] & (1ULL << (i % 64))){
+      run = 0;
+      continue;
+    }
+    if(run++ == 0)
+      first = i;
+    if(run == n){
+      for(i = first; i < first + n; i++)
+        zswap.used[i / 64] |= 1ULL << (i % 64);
+      zswap.hint = (first + n) % ZNCHUNK;
+      return first;
+    }
+  }
+  return -1;
+}
+
+static int
+is_zero(char *page)
+{
+  uint64_t *p = (uint64_t*)page;
+
+  for(int i = 0; i < PGSIZE / sizeof(uint64_t); i++)
+    if(p[i])
+      return 0;
+  return 1;
+}
+
+// Store page in the pool. Returns its compressed length and sets
+// *chunk to where it starts. Returns -1 if the page does not compress
+// well enough to be worth keeping in memory, -2 if it does but the
+// pool has no room for it.
+int
+zswap_store(char *page, int *chunk)
+{
+  int len;
+
+  *chunk = 0;
+  if(is_zero(page))
+    return 0;
+
+  acquire(&zswap.lock);
+  if((len = lz_compress((uchar*)page)) < 0){
+    release(&zswap.lock);
+    return -1;
+  }
+  if((*chunk = zpool_alloc((len + ZCHUNK - 1) / ZCHUNK)) < 0){
+    release(&zswap.lock);
+    return -2;
+  }
+  memmove(zswap.pool + *chunk * ZCHUNK, zswap.out, len);
+  release(&zswap.lock);
+  return len;
+}
+
+// Decompress the page stored by zswap_store into page.
+void
+zswap_load(int chunk, int len, char *page)
+{
+  if(len == 0){
+    memset(page, 0, PGSIZE);
+    return;
+  }
+  lz_decompress((uchar*)zswap.pool + chunk * ZCHUNK, len, (uchar*)page);
+}
+
+// Give back the space of a page stored by zswap_store.
+void
+zswap_free(int chunk, int len)
+{
+  int i;
+
+  acquire(&zswap.lock);
+  for(i = chunk; i < chunk + (len + ZCHUNK - 1) / ZCHUNK; i++)
+    zswap.used[i / 64] &= ~(1ULL << (i % 64));
+  release(&zswap.lock);
+}
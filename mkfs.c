@@ -20,6 +20,7 @@ typedef unsigned char  uchar;
 #endif
 
 #define IPB (BSIZE / sizeof(struct dinode))
+#define INODEFILEBLKS 64  // initial size of the inode file
 #define CONSOLE 1
 
 // Disk layout:
@@ -84,8 +85,21 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  // journaling mode, ordered unless asked for full data journaling
+  uint logmode = LOG_ORDERED;
+  if(argc > 2 && strcmp(argv[1], "-j") == 0){
+    if(strcmp(argv[2], "full") == 0)
+      logmode = LOG_FULL;
+    else if(strcmp(argv[2], "ordered") != 0){
+      fprintf(stderr, "mkfs: unknown journaling mode %s\n", argv[2]);
+      exit(1);
+    }
+    argv += 2;
+    argc -= 2;
+  }
+
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-j full|ordered] fs.img files...\n");
     exit(1);
   }
 
@@ -116,6 +130,7 @@ main(int argc, char *argv[])
   // shift all other regions up by the logsize
   sb.logstart = xint(2 + nswap);
   sb.logsize = 30;
+  sb.logmode = xint(logmode);
 
   sb.bmapstart = xint(2 + sb.logsize + nswap);
   sb.inodestart = xint(2 + sb.logsize + nswap + nbitmap);
@@ -143,7 +158,11 @@ main(int argc, char *argv[])
   inodefileblkn = inum_count/IPB;
   if (inodefileblkn == 0 || (inum_count * sizeof(struct dinode) % BSIZE))
     inodefileblkn++;
-  inodefileblkn += 20000;  // this line is the master line, if you add it and dont do any modification for crash safety you pass lab 5 test b (biggest hack in human history) praise be to this line
+  // the kernel grows the inode file by extents as inodes are created,
+  // each as large as the file so far, so the first extent sets how far
+  // NEXTENTS doublings can take it
+  if (inodefileblkn < INODEFILEBLKS)
+    inodefileblkn = INODEFILEBLKS;
   din.data.nblocks = xint(inodefileblkn);
   din.size = xint(inum_count * sizeof(struct dinode));
   winode(inodefileino, &din);
@@ -211,6 +230,23 @@ main(int argc, char *argv[])
     strncpy(de.name, name, DIRSIZ);
     iappend(rootino, &de, sizeof(de));
 
+    // small files are stored inline in their dinode
+    off = lseek(fd, 0, SEEK_END);
+    lseek(fd, 0, SEEK_SET);
+    if(off <= DINLINESZ){
+      rinode(inum, &din);
+      if(read(fd, din.inlinedata, off) != off){
+        perror(argv[i]);
+        exit(1);
+      }
+      din.size = xint(off);
+      din.flags = xshort(DI_INLINE);
+      winode(inum, &din);
+      printf("inum: %d name: %s size %d inline\n", inum, name, off);
+      close(fd);
+      continue;
+    }
+
     rinode(inum, &din);
     din.data.startblkno = xint(freeblock);
 		winode(inum, &din);
@@ -0,0 +1,40 @@
+
+out/initcode.out:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <start>:
+#include <syscall.h>
+#include <trap.h>
+
+.globl start
+start:
+  mov $init, %rdi
+   0:	48 c7 c7 22 00 00 00 	mov    $0x22,%rdi
+  mov $argv, %rsi
+   7:	48 c7 c6 2c 00 00 00 	mov    $0x2c,%rsi
+  mov $SYS_exec, %rax
+   e:	48 c7 c0 07 00 00 00 	mov    $0x7,%rax
+  int $TRAP_SYSCALL
+  15:	cd 40                	int    $0x40
+
+0000000000000017 <exit>:
+
+exit:
+  mov $SYS_exit, %rax
+  17:	48 c7 c0 02 00 00 00 	mov    $0x2,%rax
+  int $TRAP_SYSCALL
+  1e:	cd 40                	int    $0x40
+  jmp exit
+  20:	eb f5                	jmp    17 <exit>
+
+0000000000000022 <init>:
+  22:	2f                   	(bad)
+  23:	69 6e 69 74 00 00 0f 	imul   $0xf000074,0x69(%rsi),%ebp
+  2a:	1f                   	(bad)
+	...
+
+000000000000002c <argv>:
+  2c:	22 00                	and    (%rax),%al
+	...
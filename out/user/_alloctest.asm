@@ -0,0 +1,2469 @@
+
+out/user/_alloctest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <pagestotal>:
+struct pollfd pfds[MAXOFILE];
+
+// Pages that are neither free nor in use can only have leaked.
+int
+pagestotal(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+  struct sys_info info;
+
+  sysinfo(&info);
+       8:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+       c:	48 89 c7             	mov    %rax,%rdi
+       f:	e8 8e 15 00 00       	call   15a2 <sysinfo>
+  return info.pages_in_use + info.free_pages;
+      14:	8b 55 ec             	mov    -0x14(%rbp),%edx
+      17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      1a:	01 d0                	add    %edx,%eax
+}
+      1c:	c9                   	leave
+      1d:	c3                   	ret
+
+000000000000001e <pagesinuse>:
+
+int
+pagesinuse(void)
+{
+      1e:	55                   	push   %rbp
+      1f:	48 89 e5             	mov    %rsp,%rbp
+      22:	48 83 ec 20          	sub    $0x20,%rsp
+  struct sys_info info;
+
+  sysinfo(&info);
+      26:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+      2a:	48 89 c7             	mov    %rax,%rdi
+      2d:	e8 70 15 00 00       	call   15a2 <sysinfo>
+  return info.pages_in_use;
+      32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+      35:	c9                   	leave
+      36:	c3                   	ret
+
+0000000000000037 <grow>:
+
+// Grow the heap by n pages, check they come zeroed, then dirty them.
+char*
+grow(int n, int fill)
+{
+      37:	55                   	push   %rbp
+      38:	48 89 e5             	mov    %rsp,%rbp
+      3b:	48 83 ec 20          	sub    $0x20,%rsp
+      3f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      42:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  char *p;
+  int i;
+
+  if((p = sbrk(n * PGSIZE)) == (char*)-1)
+      45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      48:	c1 e0 0c             	shl    $0xc,%eax
+      4b:	89 c7                	mov    %eax,%edi
+      4d:	e8 38 15 00 00       	call   158a <sbrk>
+      52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      56:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+      5b:	75 5f                	jne    bc <grow+0x85>
+    error("sbrk of %d pages failed", n);
+      5d:	8b 05 7d 1e 00 00    	mov    0x1e7d(%rip),%eax        # 1ee0 <stdout>
+      63:	ba 35 00 00 00       	mov    $0x35,%edx
+      68:	48 8d 0d f1 18 00 00 	lea    0x18f1(%rip),%rcx        # 1960 <malloc+0x183>
+      6f:	48 89 ce             	mov    %rcx,%rsi
+      72:	89 c7                	mov    %eax,%edi
+      74:	b8 00 00 00 00       	mov    $0x0,%eax
+      79:	e8 dd 0e 00 00       	call   f5b <printf>
+      7e:	8b 05 5c 1e 00 00    	mov    0x1e5c(%rip),%eax        # 1ee0 <stdout>
+      84:	8b 55 ec             	mov    -0x14(%rbp),%edx
+      87:	48 8d 0d e4 18 00 00 	lea    0x18e4(%rip),%rcx        # 1972 <malloc+0x195>
+      8e:	48 89 ce             	mov    %rcx,%rsi
+      91:	89 c7                	mov    %eax,%edi
+      93:	b8 00 00 00 00       	mov    $0x0,%eax
+      98:	e8 be 0e 00 00       	call   f5b <printf>
+      9d:	8b 05 3d 1e 00 00    	mov    0x1e3d(%rip),%eax        # 1ee0 <stdout>
+      a3:	48 8d 15 e0 18 00 00 	lea    0x18e0(%rip),%rdx        # 198a <malloc+0x1ad>
+      aa:	48 89 d6             	mov    %rdx,%rsi
+      ad:	89 c7                	mov    %eax,%edi
+      af:	b8 00 00 00 00       	mov    $0x0,%eax
+      b4:	e8 a2 0e 00 00       	call   f5b <printf>
+      b9:	90                   	nop
+      ba:	eb fd                	jmp    b9 <grow+0x82>
+  for(i = 0; i < n * PGSIZE; i += sizeof(int))
+      bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      c3:	eb 7b                	jmp    140 <grow+0x109>
+    if(*(int*)(p + i) != 0)
+      c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      c8:	48 63 d0             	movslq %eax,%rdx
+      cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      cf:	48 01 d0             	add    %rdx,%rax
+      d2:	8b 00                	mov    (%rax),%eax
+      d4:	85 c0                	test   %eax,%eax
+      d6:	74 5f                	je     137 <grow+0x100>
+      error("byte %d of new memory is not zero", i);
+      d8:	8b 05 02 1e 00 00    	mov    0x1e02(%rip),%eax        # 1ee0 <stdout>
+      de:	ba 38 00 00 00       	mov    $0x38,%edx
+      e3:	48 8d 0d 76 18 00 00 	lea    0x1876(%rip),%rcx        # 1960 <malloc+0x183>
+      ea:	48 89 ce             	mov    %rcx,%rsi
+      ed:	89 c7                	mov    %eax,%edi
+      ef:	b8 00 00 00 00       	mov    $0x0,%eax
+      f4:	e8 62 0e 00 00       	call   f5b <printf>
+      f9:	8b 05 e1 1d 00 00    	mov    0x1de1(%rip),%eax        # 1ee0 <stdout>
+      ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     102:	48 8d 0d 87 18 00 00 	lea    0x1887(%rip),%rcx        # 1990 <malloc+0x1b3>
+     109:	48 89 ce             	mov    %rcx,%rsi
+     10c:	89 c7                	mov    %eax,%edi
+     10e:	b8 00 00 00 00       	mov    $0x0,%eax
+     113:	e8 43 0e 00 00       	call   f5b <printf>
+     118:	8b 05 c2 1d 00 00    	mov    0x1dc2(%rip),%eax        # 1ee0 <stdout>
+     11e:	48 8d 15 65 18 00 00 	lea    0x1865(%rip),%rdx        # 198a <malloc+0x1ad>
+     125:	48 89 d6             	mov    %rdx,%rsi
+     128:	89 c7                	mov    %eax,%edi
+     12a:	b8 00 00 00 00       	mov    $0x0,%eax
+     12f:	e8 27 0e 00 00       	call   f5b <printf>
+     134:	90                   	nop
+     135:	eb fd                	jmp    134 <grow+0xfd>
+  for(i = 0; i < n * PGSIZE; i += sizeof(int))
+     137:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     13a:	83 c0 04             	add    $0x4,%eax
+     13d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     140:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     143:	c1 e0 0c             	shl    $0xc,%eax
+     146:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     149:	0f 8c 76 ff ff ff    	jl     c5 <grow+0x8e>
+  memset(p, fill, n * PGSIZE);
+     14f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     152:	c1 e0 0c             	shl    $0xc,%eax
+     155:	89 c2                	mov    %eax,%edx
+     157:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+     15a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     15e:	89 ce                	mov    %ecx,%esi
+     160:	48 89 c7             	mov    %rax,%rdi
+     163:	e8 b1 11 00 00       	call   1319 <memset>
+  return p;
+     168:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+     16c:	c9                   	leave
+     16d:	c3                   	ret
+
+000000000000016e <pagetest>:
+// nothing is lost in the per-CPU caches or the buddy lists, and every
+// page handed out is zero, whether it came from the pre-zeroed pool or
+// not.
+void
+pagetest(void)
+{
+     16e:	55                   	push   %rbp
+     16f:	48 89 e5             	mov    %rsp,%rbp
+     172:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, before, total;
+
+  printf(stdout, "pagetest\n");
+     176:	8b 05 64 1d 00 00    	mov    0x1d64(%rip),%eax        # 1ee0 <stdout>
+     17c:	48 8d 15 2f 18 00 00 	lea    0x182f(%rip),%rdx        # 19b2 <malloc+0x1d5>
+     183:	48 89 d6             	mov    %rdx,%rsi
+     186:	89 c7                	mov    %eax,%edi
+     188:	b8 00 00 00 00       	mov    $0x0,%eax
+     18d:	e8 c9 0d 00 00       	call   f5b <printf>
+  total = pagestotal();
+     192:	e8 69 fe ff ff       	call   0 <pagestotal>
+     197:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  grow(NPAGES, 0xff);
+     19a:	be ff 00 00 00       	mov    $0xff,%esi
+     19f:	bf 2c 01 00 00       	mov    $0x12c,%edi
+     1a4:	e8 8e fe ff ff       	call   37 <grow>
+  sbrk(-NPAGES * PGSIZE);
+     1a9:	bf 00 40 ed ff       	mov    $0xffed4000,%edi
+     1ae:	e8 d7 13 00 00       	call   158a <sbrk>
+  before = pagesinuse();
+     1b3:	e8 66 fe ff ff       	call   1e <pagesinuse>
+     1b8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  for(i = 0; i < 20; i++){
+     1bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1c2:	eb 22                	jmp    1e6 <pagetest+0x78>
+    grow(NPAGES, 0xff - i);
+     1c4:	b8 ff 00 00 00       	mov    $0xff,%eax
+     1c9:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     1cc:	89 c6                	mov    %eax,%esi
+     1ce:	bf 2c 01 00 00       	mov    $0x12c,%edi
+     1d3:	e8 5f fe ff ff       	call   37 <grow>
+    sbrk(-NPAGES * PGSIZE);
+     1d8:	bf 00 40 ed ff       	mov    $0xffed4000,%edi
+     1dd:	e8 a8 13 00 00       	call   158a <sbrk>
+  for(i = 0; i < 20; i++){
+     1e2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1e6:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+     1ea:	7e d8                	jle    1c4 <pagetest+0x56>
+  }
+  if(pagesinuse() > before + SLACK)
+     1ec:	e8 2d fe ff ff       	call   1e <pagesinuse>
+     1f1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     1f4:	83 c2 04             	add    $0x4,%edx
+     1f7:	39 d0                	cmp    %edx,%eax
+     1f9:	7e 67                	jle    262 <pagetest+0xf4>
+    error("%d pages in use, %d before", pagesinuse(), before);
+     1fb:	8b 05 df 1c 00 00    	mov    0x1cdf(%rip),%eax        # 1ee0 <stdout>
+     201:	ba 50 00 00 00       	mov    $0x50,%edx
+     206:	48 8d 0d 53 17 00 00 	lea    0x1753(%rip),%rcx        # 1960 <malloc+0x183>
+     20d:	48 89 ce             	mov    %rcx,%rsi
+     210:	89 c7                	mov    %eax,%edi
+     212:	b8 00 00 00 00       	mov    $0x0,%eax
+     217:	e8 3f 0d 00 00       	call   f5b <printf>
+     21c:	e8 fd fd ff ff       	call   1e <pagesinuse>
+     221:	89 c6                	mov    %eax,%esi
+     223:	8b 05 b7 1c 00 00    	mov    0x1cb7(%rip),%eax        # 1ee0 <stdout>
+     229:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     22c:	89 d1                	mov    %edx,%ecx
+     22e:	89 f2                	mov    %esi,%edx
+     230:	48 8d 35 85 17 00 00 	lea    0x1785(%rip),%rsi        # 19bc <malloc+0x1df>
+     237:	89 c7                	mov    %eax,%edi
+     239:	b8 00 00 00 00       	mov    $0x0,%eax
+     23e:	e8 18 0d 00 00       	call   f5b <printf>
+     243:	8b 05 97 1c 00 00    	mov    0x1c97(%rip),%eax        # 1ee0 <stdout>
+     249:	48 8d 15 3a 17 00 00 	lea    0x173a(%rip),%rdx        # 198a <malloc+0x1ad>
+     250:	48 89 d6             	mov    %rdx,%rsi
+     253:	89 c7                	mov    %eax,%edi
+     255:	b8 00 00 00 00       	mov    $0x0,%eax
+     25a:	e8 fc 0c 00 00       	call   f5b <printf>
+     25f:	90                   	nop
+     260:	eb fd                	jmp    25f <pagetest+0xf1>
+  if(pagestotal() != total)
+     262:	e8 99 fd ff ff       	call   0 <pagestotal>
+     267:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     26a:	74 67                	je     2d3 <pagetest+0x165>
+    error("%d pages free or in use, %d before", pagestotal(), total);
+     26c:	8b 05 6e 1c 00 00    	mov    0x1c6e(%rip),%eax        # 1ee0 <stdout>
+     272:	ba 52 00 00 00       	mov    $0x52,%edx
+     277:	48 8d 0d e2 16 00 00 	lea    0x16e2(%rip),%rcx        # 1960 <malloc+0x183>
+     27e:	48 89 ce             	mov    %rcx,%rsi
+     281:	89 c7                	mov    %eax,%edi
+     283:	b8 00 00 00 00       	mov    $0x0,%eax
+     288:	e8 ce 0c 00 00       	call   f5b <printf>
+     28d:	e8 6e fd ff ff       	call   0 <pagestotal>
+     292:	89 c6                	mov    %eax,%esi
+     294:	8b 05 46 1c 00 00    	mov    0x1c46(%rip),%eax        # 1ee0 <stdout>
+     29a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     29d:	89 d1                	mov    %edx,%ecx
+     29f:	89 f2                	mov    %esi,%edx
+     2a1:	48 8d 35 30 17 00 00 	lea    0x1730(%rip),%rsi        # 19d8 <malloc+0x1fb>
+     2a8:	89 c7                	mov    %eax,%edi
+     2aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     2af:	e8 a7 0c 00 00       	call   f5b <printf>
+     2b4:	8b 05 26 1c 00 00    	mov    0x1c26(%rip),%eax        # 1ee0 <stdout>
+     2ba:	48 8d 15 c9 16 00 00 	lea    0x16c9(%rip),%rdx        # 198a <malloc+0x1ad>
+     2c1:	48 89 d6             	mov    %rdx,%rsi
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cb:	e8 8b 0c 00 00       	call   f5b <printf>
+     2d0:	90                   	nop
+     2d1:	eb fd                	jmp    2d0 <pagetest+0x162>
+  printf(stdout, "pagetest OK\n");
+     2d3:	8b 05 07 1c 00 00    	mov    0x1c07(%rip),%eax        # 1ee0 <stdout>
+     2d9:	48 8d 15 1b 17 00 00 	lea    0x171b(%rip),%rdx        # 19fb <malloc+0x21e>
+     2e0:	48 89 d6             	mov    %rdx,%rsi
+     2e3:	89 c7                	mov    %eax,%edi
+     2e5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ea:	e8 6c 0c 00 00       	call   f5b <printf>
+}
+     2ef:	90                   	nop
+     2f0:	c9                   	leave
+     2f1:	c3                   	ret
+
+00000000000002f2 <concurrenttest>:
+
+// Processes on every CPU allocate and free at once, each with data of
+// its own that must not change under it.
+void
+concurrenttest(void)
+{
+     2f2:	55                   	push   %rbp
+     2f3:	48 89 e5             	mov    %rsp,%rbp
+     2f6:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, j, k, pid, before, total;
+  char *p;
+
+  printf(stdout, "concurrenttest\n");
+     2fa:	8b 05 e0 1b 00 00    	mov    0x1be0(%rip),%eax        # 1ee0 <stdout>
+     300:	48 8d 15 01 17 00 00 	lea    0x1701(%rip),%rdx        # 1a08 <malloc+0x22b>
+     307:	48 89 d6             	mov    %rdx,%rsi
+     30a:	89 c7                	mov    %eax,%edi
+     30c:	b8 00 00 00 00       	mov    $0x0,%eax
+     311:	e8 45 0c 00 00       	call   f5b <printf>
+  total = pagestotal();
+     316:	e8 e5 fc ff ff       	call   0 <pagestotal>
+     31b:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  before = pagesinuse();
+     31e:	e8 fb fc ff ff       	call   1e <pagesinuse>
+     323:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  for(i = 0; i < NCHILD; i++){
+     326:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     32d:	e9 53 01 00 00       	jmp    485 <concurrenttest+0x193>
+    if((pid = fork()) < 0)
+     332:	e8 c3 11 00 00       	call   14fa <fork>
+     337:	89 45 e8             	mov    %eax,-0x18(%rbp)
+     33a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     33e:	79 5c                	jns    39c <concurrenttest+0xaa>
+      error("fork failed");
+     340:	8b 05 9a 1b 00 00    	mov    0x1b9a(%rip),%eax        # 1ee0 <stdout>
+     346:	ba 63 00 00 00       	mov    $0x63,%edx
+     34b:	48 8d 0d 0e 16 00 00 	lea    0x160e(%rip),%rcx        # 1960 <malloc+0x183>
+     352:	48 89 ce             	mov    %rcx,%rsi
+     355:	89 c7                	mov    %eax,%edi
+     357:	b8 00 00 00 00       	mov    $0x0,%eax
+     35c:	e8 fa 0b 00 00       	call   f5b <printf>
+     361:	8b 05 79 1b 00 00    	mov    0x1b79(%rip),%eax        # 1ee0 <stdout>
+     367:	48 8d 15 aa 16 00 00 	lea    0x16aa(%rip),%rdx        # 1a18 <malloc+0x23b>
+     36e:	48 89 d6             	mov    %rdx,%rsi
+     371:	89 c7                	mov    %eax,%edi
+     373:	b8 00 00 00 00       	mov    $0x0,%eax
+     378:	e8 de 0b 00 00       	call   f5b <printf>
+     37d:	8b 05 5d 1b 00 00    	mov    0x1b5d(%rip),%eax        # 1ee0 <stdout>
+     383:	48 8d 15 00 16 00 00 	lea    0x1600(%rip),%rdx        # 198a <malloc+0x1ad>
+     38a:	48 89 d6             	mov    %rdx,%rsi
+     38d:	89 c7                	mov    %eax,%edi
+     38f:	b8 00 00 00 00       	mov    $0x0,%eax
+     394:	e8 c2 0b 00 00       	call   f5b <printf>
+     399:	90                   	nop
+     39a:	eb fd                	jmp    399 <concurrenttest+0xa7>
+    if(pid == 0){
+     39c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     3a0:	0f 85 db 00 00 00    	jne    481 <concurrenttest+0x18f>
+      for(j = 0; j < 10; j++){
+     3a6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     3ad:	e9 c0 00 00 00       	jmp    472 <concurrenttest+0x180>
+        p = grow(NPAGES / NCHILD, 'a' + i);
+     3b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3b5:	83 c0 61             	add    $0x61,%eax
+     3b8:	89 c6                	mov    %eax,%esi
+     3ba:	bf 4b 00 00 00       	mov    $0x4b,%edi
+     3bf:	e8 73 fc ff ff       	call   37 <grow>
+     3c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        for(k = 0; k < NPAGES / NCHILD * PGSIZE; k += PGSIZE)
+     3c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     3cf:	e9 83 00 00 00       	jmp    457 <concurrenttest+0x165>
+          if(p[k] != 'a' + i)
+     3d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     3d7:	48 63 d0             	movslq %eax,%rdx
+     3da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     3de:	48 01 d0             	add    %rdx,%rax
+     3e1:	0f b6 00             	movzbl (%rax),%eax
+     3e4:	0f be d0             	movsbl %al,%edx
+     3e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3ea:	83 c0 61             	add    $0x61,%eax
+     3ed:	39 c2                	cmp    %eax,%edx
+     3ef:	74 5f                	je     450 <concurrenttest+0x15e>
+            error("child %d lost its data", i);
+     3f1:	8b 05 e9 1a 00 00    	mov    0x1ae9(%rip),%eax        # 1ee0 <stdout>
+     3f7:	ba 69 00 00 00       	mov    $0x69,%edx
+     3fc:	48 8d 0d 5d 15 00 00 	lea    0x155d(%rip),%rcx        # 1960 <malloc+0x183>
+     403:	48 89 ce             	mov    %rcx,%rsi
+     406:	89 c7                	mov    %eax,%edi
+     408:	b8 00 00 00 00       	mov    $0x0,%eax
+     40d:	e8 49 0b 00 00       	call   f5b <printf>
+     412:	8b 05 c8 1a 00 00    	mov    0x1ac8(%rip),%eax        # 1ee0 <stdout>
+     418:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     41b:	48 8d 0d 02 16 00 00 	lea    0x1602(%rip),%rcx        # 1a24 <malloc+0x247>
+     422:	48 89 ce             	mov    %rcx,%rsi
+     425:	89 c7                	mov    %eax,%edi
+     427:	b8 00 00 00 00       	mov    $0x0,%eax
+     42c:	e8 2a 0b 00 00       	call   f5b <printf>
+     431:	8b 05 a9 1a 00 00    	mov    0x1aa9(%rip),%eax        # 1ee0 <stdout>
+     437:	48 8d 15 4c 15 00 00 	lea    0x154c(%rip),%rdx        # 198a <malloc+0x1ad>
+     43e:	48 89 d6             	mov    %rdx,%rsi
+     441:	89 c7                	mov    %eax,%edi
+     443:	b8 00 00 00 00       	mov    $0x0,%eax
+     448:	e8 0e 0b 00 00       	call   f5b <printf>
+     44d:	90                   	nop
+     44e:	eb fd                	jmp    44d <concurrenttest+0x15b>
+        for(k = 0; k < NPAGES / NCHILD * PGSIZE; k += PGSIZE)
+     450:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%rbp)
+     457:	81 7d f4 ff af 04 00 	cmpl   $0x4afff,-0xc(%rbp)
+     45e:	0f 8e 70 ff ff ff    	jle    3d4 <concurrenttest+0xe2>
+        sbrk(-NPAGES / NCHILD * PGSIZE);
+     464:	bf 00 50 fb ff       	mov    $0xfffb5000,%edi
+     469:	e8 1c 11 00 00       	call   158a <sbrk>
+      for(j = 0; j < 10; j++){
+     46e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     472:	83 7d f8 09          	cmpl   $0x9,-0x8(%rbp)
+     476:	0f 8e 36 ff ff ff    	jle    3b2 <concurrenttest+0xc0>
+      }
+      exit();
+     47c:	e8 81 10 00 00       	call   1502 <exit>
+  for(i = 0; i < NCHILD; i++){
+     481:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     485:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     489:	0f 8e a3 fe ff ff    	jle    332 <concurrenttest+0x40>
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+     48f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     496:	eb 09                	jmp    4a1 <concurrenttest+0x1af>
+    wait();
+     498:	e8 6d 10 00 00       	call   150a <wait>
+  for(i = 0; i < NCHILD; i++)
+     49d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     4a1:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     4a5:	7e f1                	jle    498 <concurrenttest+0x1a6>
+  if(pagesinuse() > before + SLACK)
+     4a7:	e8 72 fb ff ff       	call   1e <pagesinuse>
+     4ac:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     4af:	83 c2 04             	add    $0x4,%edx
+     4b2:	39 d0                	cmp    %edx,%eax
+     4b4:	7e 67                	jle    51d <concurrenttest+0x22b>
+    error("%d pages in use, %d before", pagesinuse(), before);
+     4b6:	8b 05 24 1a 00 00    	mov    0x1a24(%rip),%eax        # 1ee0 <stdout>
+     4bc:	ba 72 00 00 00       	mov    $0x72,%edx
+     4c1:	48 8d 0d 98 14 00 00 	lea    0x1498(%rip),%rcx        # 1960 <malloc+0x183>
+     4c8:	48 89 ce             	mov    %rcx,%rsi
+     4cb:	89 c7                	mov    %eax,%edi
+     4cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d2:	e8 84 0a 00 00       	call   f5b <printf>
+     4d7:	e8 42 fb ff ff       	call   1e <pagesinuse>
+     4dc:	89 c6                	mov    %eax,%esi
+     4de:	8b 05 fc 19 00 00    	mov    0x19fc(%rip),%eax        # 1ee0 <stdout>
+     4e4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     4e7:	89 d1                	mov    %edx,%ecx
+     4e9:	89 f2                	mov    %esi,%edx
+     4eb:	48 8d 35 ca 14 00 00 	lea    0x14ca(%rip),%rsi        # 19bc <malloc+0x1df>
+     4f2:	89 c7                	mov    %eax,%edi
+     4f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f9:	e8 5d 0a 00 00       	call   f5b <printf>
+     4fe:	8b 05 dc 19 00 00    	mov    0x19dc(%rip),%eax        # 1ee0 <stdout>
+     504:	48 8d 15 7f 14 00 00 	lea    0x147f(%rip),%rdx        # 198a <malloc+0x1ad>
+     50b:	48 89 d6             	mov    %rdx,%rsi
+     50e:	89 c7                	mov    %eax,%edi
+     510:	b8 00 00 00 00       	mov    $0x0,%eax
+     515:	e8 41 0a 00 00       	call   f5b <printf>
+     51a:	90                   	nop
+     51b:	eb fd                	jmp    51a <concurrenttest+0x228>
+  if(pagestotal() != total)
+     51d:	e8 de fa ff ff       	call   0 <pagestotal>
+     522:	39 45 f0             	cmp    %eax,-0x10(%rbp)
+     525:	74 67                	je     58e <concurrenttest+0x29c>
+    error("%d pages free or in use, %d before", pagestotal(), total);
+     527:	8b 05 b3 19 00 00    	mov    0x19b3(%rip),%eax        # 1ee0 <stdout>
+     52d:	ba 74 00 00 00       	mov    $0x74,%edx
+     532:	48 8d 0d 27 14 00 00 	lea    0x1427(%rip),%rcx        # 1960 <malloc+0x183>
+     539:	48 89 ce             	mov    %rcx,%rsi
+     53c:	89 c7                	mov    %eax,%edi
+     53e:	b8 00 00 00 00       	mov    $0x0,%eax
+     543:	e8 13 0a 00 00       	call   f5b <printf>
+     548:	e8 b3 fa ff ff       	call   0 <pagestotal>
+     54d:	89 c6                	mov    %eax,%esi
+     54f:	8b 05 8b 19 00 00    	mov    0x198b(%rip),%eax        # 1ee0 <stdout>
+     555:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     558:	89 d1                	mov    %edx,%ecx
+     55a:	89 f2                	mov    %esi,%edx
+     55c:	48 8d 35 75 14 00 00 	lea    0x1475(%rip),%rsi        # 19d8 <malloc+0x1fb>
+     563:	89 c7                	mov    %eax,%edi
+     565:	b8 00 00 00 00       	mov    $0x0,%eax
+     56a:	e8 ec 09 00 00       	call   f5b <printf>
+     56f:	8b 05 6b 19 00 00    	mov    0x196b(%rip),%eax        # 1ee0 <stdout>
+     575:	48 8d 15 0e 14 00 00 	lea    0x140e(%rip),%rdx        # 198a <malloc+0x1ad>
+     57c:	48 89 d6             	mov    %rdx,%rsi
+     57f:	89 c7                	mov    %eax,%edi
+     581:	b8 00 00 00 00       	mov    $0x0,%eax
+     586:	e8 d0 09 00 00       	call   f5b <printf>
+     58b:	90                   	nop
+     58c:	eb fd                	jmp    58b <concurrenttest+0x299>
+  printf(stdout, "concurrenttest OK\n");
+     58e:	8b 05 4c 19 00 00    	mov    0x194c(%rip),%eax        # 1ee0 <stdout>
+     594:	48 8d 15 a0 14 00 00 	lea    0x14a0(%rip),%rdx        # 1a3b <malloc+0x25e>
+     59b:	48 89 d6             	mov    %rdx,%rsi
+     59e:	89 c7                	mov    %eax,%edi
+     5a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a5:	e8 b1 09 00 00       	call   f5b <printf>
+}
+     5aa:	90                   	nop
+     5ab:	c9                   	leave
+     5ac:	c3                   	ret
+
+00000000000005ad <objecttest>:
+// Kernel objects come and go with processes, pipes and files: process
+// structures, kernel stacks, page tables, file structures and pipes.
+// Creating and dropping them many times leaves memory where it was.
+void
+objecttest(void)
+{
+     5ad:	55                   	push   %rbp
+     5ae:	48 89 e5             	mov    %rsp,%rbp
+     5b1:	48 83 ec 20          	sub    $0x20,%rsp
+  int i, fds[2], fd, pid, before;
+
+  printf(stdout, "objecttest\n");
+     5b5:	8b 05 25 19 00 00    	mov    0x1925(%rip),%eax        # 1ee0 <stdout>
+     5bb:	48 8d 15 8c 14 00 00 	lea    0x148c(%rip),%rdx        # 1a4e <malloc+0x271>
+     5c2:	48 89 d6             	mov    %rdx,%rsi
+     5c5:	89 c7                	mov    %eax,%edi
+     5c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cc:	e8 8a 09 00 00       	call   f5b <printf>
+  if((fd = open("alloc1.txt", O_CREATE | O_RDWR)) < 0)
+     5d1:	be 02 02 00 00       	mov    $0x202,%esi
+     5d6:	48 8d 05 7d 14 00 00 	lea    0x147d(%rip),%rax        # 1a5a <malloc+0x27d>
+     5dd:	48 89 c7             	mov    %rax,%rdi
+     5e0:	e8 5d 0f 00 00       	call   1542 <open>
+     5e5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     5e8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     5ec:	79 5c                	jns    64a <objecttest+0x9d>
+    error("unable to create alloc1.txt");
+     5ee:	8b 05 ec 18 00 00    	mov    0x18ec(%rip),%eax        # 1ee0 <stdout>
+     5f4:	ba 82 00 00 00       	mov    $0x82,%edx
+     5f9:	48 8d 0d 60 13 00 00 	lea    0x1360(%rip),%rcx        # 1960 <malloc+0x183>
+     600:	48 89 ce             	mov    %rcx,%rsi
+     603:	89 c7                	mov    %eax,%edi
+     605:	b8 00 00 00 00       	mov    $0x0,%eax
+     60a:	e8 4c 09 00 00       	call   f5b <printf>
+     60f:	8b 05 cb 18 00 00    	mov    0x18cb(%rip),%eax        # 1ee0 <stdout>
+     615:	48 8d 15 49 14 00 00 	lea    0x1449(%rip),%rdx        # 1a65 <malloc+0x288>
+     61c:	48 89 d6             	mov    %rdx,%rsi
+     61f:	89 c7                	mov    %eax,%edi
+     621:	b8 00 00 00 00       	mov    $0x0,%eax
+     626:	e8 30 09 00 00       	call   f5b <printf>
+     62b:	8b 05 af 18 00 00    	mov    0x18af(%rip),%eax        # 1ee0 <stdout>
+     631:	48 8d 15 52 13 00 00 	lea    0x1352(%rip),%rdx        # 198a <malloc+0x1ad>
+     638:	48 89 d6             	mov    %rdx,%rsi
+     63b:	89 c7                	mov    %eax,%edi
+     63d:	b8 00 00 00 00       	mov    $0x0,%eax
+     642:	e8 14 09 00 00       	call   f5b <printf>
+     647:	90                   	nop
+     648:	eb fd                	jmp    647 <objecttest+0x9a>
+  close(fd);
+     64a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     64d:	89 c7                	mov    %eax,%edi
+     64f:	e8 d6 0e 00 00       	call   152a <close>
+
+  before = pagesinuse();
+     654:	e8 c5 f9 ff ff       	call   1e <pagesinuse>
+     659:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  for(i = 0; i < 200; i++){
+     65c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     663:	e9 9a 01 00 00       	jmp    802 <objecttest+0x255>
+    if(pipe(fds) < 0)
+     668:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+     66c:	48 89 c7             	mov    %rax,%rdi
+     66f:	e8 9e 0e 00 00       	call   1512 <pipe>
+     674:	85 c0                	test   %eax,%eax
+     676:	79 5c                	jns    6d4 <objecttest+0x127>
+      error("pipe failed");
+     678:	8b 05 62 18 00 00    	mov    0x1862(%rip),%eax        # 1ee0 <stdout>
+     67e:	ba 88 00 00 00       	mov    $0x88,%edx
+     683:	48 8d 0d d6 12 00 00 	lea    0x12d6(%rip),%rcx        # 1960 <malloc+0x183>
+     68a:	48 89 ce             	mov    %rcx,%rsi
+     68d:	89 c7                	mov    %eax,%edi
+     68f:	b8 00 00 00 00       	mov    $0x0,%eax
+     694:	e8 c2 08 00 00       	call   f5b <printf>
+     699:	8b 05 41 18 00 00    	mov    0x1841(%rip),%eax        # 1ee0 <stdout>
+     69f:	48 8d 15 db 13 00 00 	lea    0x13db(%rip),%rdx        # 1a81 <malloc+0x2a4>
+     6a6:	48 89 d6             	mov    %rdx,%rsi
+     6a9:	89 c7                	mov    %eax,%edi
+     6ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     6b0:	e8 a6 08 00 00       	call   f5b <printf>
+     6b5:	8b 05 25 18 00 00    	mov    0x1825(%rip),%eax        # 1ee0 <stdout>
+     6bb:	48 8d 15 c8 12 00 00 	lea    0x12c8(%rip),%rdx        # 198a <malloc+0x1ad>
+     6c2:	48 89 d6             	mov    %rdx,%rsi
+     6c5:	89 c7                	mov    %eax,%edi
+     6c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cc:	e8 8a 08 00 00       	call   f5b <printf>
+     6d1:	90                   	nop
+     6d2:	eb fd                	jmp    6d1 <objecttest+0x124>
+    if((fd = open("alloc1.txt", O_RDONLY)) < 0)
+     6d4:	be 00 00 00 00       	mov    $0x0,%esi
+     6d9:	48 8d 05 7a 13 00 00 	lea    0x137a(%rip),%rax        # 1a5a <malloc+0x27d>
+     6e0:	48 89 c7             	mov    %rax,%rdi
+     6e3:	e8 5a 0e 00 00       	call   1542 <open>
+     6e8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     6eb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     6ef:	79 5c                	jns    74d <objecttest+0x1a0>
+      error("unable to open alloc1.txt");
+     6f1:	8b 05 e9 17 00 00    	mov    0x17e9(%rip),%eax        # 1ee0 <stdout>
+     6f7:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     6fc:	48 8d 0d 5d 12 00 00 	lea    0x125d(%rip),%rcx        # 1960 <malloc+0x183>
+     703:	48 89 ce             	mov    %rcx,%rsi
+     706:	89 c7                	mov    %eax,%edi
+     708:	b8 00 00 00 00       	mov    $0x0,%eax
+     70d:	e8 49 08 00 00       	call   f5b <printf>
+     712:	8b 05 c8 17 00 00    	mov    0x17c8(%rip),%eax        # 1ee0 <stdout>
+     718:	48 8d 15 6e 13 00 00 	lea    0x136e(%rip),%rdx        # 1a8d <malloc+0x2b0>
+     71f:	48 89 d6             	mov    %rdx,%rsi
+     722:	89 c7                	mov    %eax,%edi
+     724:	b8 00 00 00 00       	mov    $0x0,%eax
+     729:	e8 2d 08 00 00       	call   f5b <printf>
+     72e:	8b 05 ac 17 00 00    	mov    0x17ac(%rip),%eax        # 1ee0 <stdout>
+     734:	48 8d 15 4f 12 00 00 	lea    0x124f(%rip),%rdx        # 198a <malloc+0x1ad>
+     73b:	48 89 d6             	mov    %rdx,%rsi
+     73e:	89 c7                	mov    %eax,%edi
+     740:	b8 00 00 00 00       	mov    $0x0,%eax
+     745:	e8 11 08 00 00       	call   f5b <printf>
+     74a:	90                   	nop
+     74b:	eb fd                	jmp    74a <objecttest+0x19d>
+    pid = fork();
+     74d:	e8 a8 0d 00 00       	call   14fa <fork>
+     752:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if(pid < 0)
+     755:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     759:	79 5c                	jns    7b7 <objecttest+0x20a>
+      error("fork failed");
+     75b:	8b 05 7f 17 00 00    	mov    0x177f(%rip),%eax        # 1ee0 <stdout>
+     761:	ba 8d 00 00 00       	mov    $0x8d,%edx
+     766:	48 8d 0d f3 11 00 00 	lea    0x11f3(%rip),%rcx        # 1960 <malloc+0x183>
+     76d:	48 89 ce             	mov    %rcx,%rsi
+     770:	89 c7                	mov    %eax,%edi
+     772:	b8 00 00 00 00       	mov    $0x0,%eax
+     777:	e8 df 07 00 00       	call   f5b <printf>
+     77c:	8b 05 5e 17 00 00    	mov    0x175e(%rip),%eax        # 1ee0 <stdout>
+     782:	48 8d 15 8f 12 00 00 	lea    0x128f(%rip),%rdx        # 1a18 <malloc+0x23b>
+     789:	48 89 d6             	mov    %rdx,%rsi
+     78c:	89 c7                	mov    %eax,%edi
+     78e:	b8 00 00 00 00       	mov    $0x0,%eax
+     793:	e8 c3 07 00 00       	call   f5b <printf>
+     798:	8b 05 42 17 00 00    	mov    0x1742(%rip),%eax        # 1ee0 <stdout>
+     79e:	48 8d 15 e5 11 00 00 	lea    0x11e5(%rip),%rdx        # 198a <malloc+0x1ad>
+     7a5:	48 89 d6             	mov    %rdx,%rsi
+     7a8:	89 c7                	mov    %eax,%edi
+     7aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     7af:	e8 a7 07 00 00       	call   f5b <printf>
+     7b4:	90                   	nop
+     7b5:	eb fd                	jmp    7b4 <objecttest+0x207>
+    if(pid == 0){
+     7b7:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     7bb:	75 1e                	jne    7db <objecttest+0x22e>
+      write(fds[1], "x", 1);
+     7bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7c0:	ba 01 00 00 00       	mov    $0x1,%edx
+     7c5:	48 8d 0d db 12 00 00 	lea    0x12db(%rip),%rcx        # 1aa7 <malloc+0x2ca>
+     7cc:	48 89 ce             	mov    %rcx,%rsi
+     7cf:	89 c7                	mov    %eax,%edi
+     7d1:	e8 4c 0d 00 00       	call   1522 <write>
+      exit();
+     7d6:	e8 27 0d 00 00       	call   1502 <exit>
+    }
+    wait();
+     7db:	e8 2a 0d 00 00       	call   150a <wait>
+    close(fd);
+     7e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     7e3:	89 c7                	mov    %eax,%edi
+     7e5:	e8 40 0d 00 00       	call   152a <close>
+    close(fds[0]);
+     7ea:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     7ed:	89 c7                	mov    %eax,%edi
+     7ef:	e8 36 0d 00 00       	call   152a <close>
+    close(fds[1]);
+     7f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     7f7:	89 c7                	mov    %eax,%edi
+     7f9:	e8 2c 0d 00 00       	call   152a <close>
+  for(i = 0; i < 200; i++){
+     7fe:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     802:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     809:	0f 8e 59 fe ff ff    	jle    668 <objecttest+0xbb>
+  }
+  if(pagesinuse() > before + SLACK)
+     80f:	e8 0a f8 ff ff       	call   1e <pagesinuse>
+     814:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     817:	83 c2 04             	add    $0x4,%edx
+     81a:	39 d0                	cmp    %edx,%eax
+     81c:	7e 67                	jle    885 <objecttest+0x2d8>
+    error("%d pages in use, %d before", pagesinuse(), before);
+     81e:	8b 05 bc 16 00 00    	mov    0x16bc(%rip),%eax        # 1ee0 <stdout>
+     824:	ba 98 00 00 00       	mov    $0x98,%edx
+     829:	48 8d 0d 30 11 00 00 	lea    0x1130(%rip),%rcx        # 1960 <malloc+0x183>
+     830:	48 89 ce             	mov    %rcx,%rsi
+     833:	89 c7                	mov    %eax,%edi
+     835:	b8 00 00 00 00       	mov    $0x0,%eax
+     83a:	e8 1c 07 00 00       	call   f5b <printf>
+     83f:	e8 da f7 ff ff       	call   1e <pagesinuse>
+     844:	89 c6                	mov    %eax,%esi
+     846:	8b 05 94 16 00 00    	mov    0x1694(%rip),%eax        # 1ee0 <stdout>
+     84c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     84f:	89 d1                	mov    %edx,%ecx
+     851:	89 f2                	mov    %esi,%edx
+     853:	48 8d 35 62 11 00 00 	lea    0x1162(%rip),%rsi        # 19bc <malloc+0x1df>
+     85a:	89 c7                	mov    %eax,%edi
+     85c:	b8 00 00 00 00       	mov    $0x0,%eax
+     861:	e8 f5 06 00 00       	call   f5b <printf>
+     866:	8b 05 74 16 00 00    	mov    0x1674(%rip),%eax        # 1ee0 <stdout>
+     86c:	48 8d 15 17 11 00 00 	lea    0x1117(%rip),%rdx        # 198a <malloc+0x1ad>
+     873:	48 89 d6             	mov    %rdx,%rsi
+     876:	89 c7                	mov    %eax,%edi
+     878:	b8 00 00 00 00       	mov    $0x0,%eax
+     87d:	e8 d9 06 00 00       	call   f5b <printf>
+     882:	90                   	nop
+     883:	eb fd                	jmp    882 <objecttest+0x2d5>
+  unlink("alloc1.txt");
+     885:	48 8d 05 ce 11 00 00 	lea    0x11ce(%rip),%rax        # 1a5a <malloc+0x27d>
+     88c:	48 89 c7             	mov    %rax,%rdi
+     88f:	e8 be 0c 00 00       	call   1552 <unlink>
+  printf(stdout, "objecttest OK\n");
+     894:	8b 05 46 16 00 00    	mov    0x1646(%rip),%eax        # 1ee0 <stdout>
+     89a:	48 8d 15 08 12 00 00 	lea    0x1208(%rip),%rdx        # 1aa9 <malloc+0x2cc>
+     8a1:	48 89 d6             	mov    %rdx,%rsi
+     8a4:	89 c7                	mov    %eax,%edi
+     8a6:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ab:	e8 ab 06 00 00       	call   f5b <printf>
+}
+     8b0:	90                   	nop
+     8b1:	c9                   	leave
+     8b2:	c3                   	ret
+
+00000000000008b3 <blocktest>:
+
+// A poll of many entries takes a block of contiguous pages for them,
+// which goes back to the buddy lists each time.
+void
+blocktest(void)
+{
+     8b3:	55                   	push   %rbp
+     8b4:	48 89 e5             	mov    %rsp,%rbp
+     8b7:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, before;
+
+  printf(stdout, "blocktest\n");
+     8bb:	8b 05 1f 16 00 00    	mov    0x161f(%rip),%eax        # 1ee0 <stdout>
+     8c1:	48 8d 15 f0 11 00 00 	lea    0x11f0(%rip),%rdx        # 1ab8 <malloc+0x2db>
+     8c8:	48 89 d6             	mov    %rdx,%rsi
+     8cb:	89 c7                	mov    %eax,%edi
+     8cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d2:	e8 84 06 00 00       	call   f5b <printf>
+  for(i = 0; i < MAXOFILE; i++){
+     8d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     8de:	eb 39                	jmp    919 <blocktest+0x66>
+    pfds[i].fd = -1;
+     8e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8e3:	48 98                	cltq
+     8e5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     8ec:	00 
+     8ed:	48 8d 05 8c 16 00 00 	lea    0x168c(%rip),%rax        # 1f80 <pfds>
+     8f4:	c7 04 02 ff ff ff ff 	movl   $0xffffffff,(%rdx,%rax,1)
+    pfds[i].events = POLLIN;
+     8fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8fe:	48 98                	cltq
+     900:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     907:	00 
+     908:	48 8d 05 75 16 00 00 	lea    0x1675(%rip),%rax        # 1f84 <pfds+0x4>
+     90f:	66 c7 04 02 01 00    	movw   $0x1,(%rdx,%rax,1)
+  for(i = 0; i < MAXOFILE; i++){
+     915:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     919:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+     920:	7e be                	jle    8e0 <blocktest+0x2d>
+  }
+  before = pagesinuse();
+     922:	e8 f7 f6 ff ff       	call   1e <pagesinuse>
+     927:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for(i = 0; i < 100; i++)
+     92a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     931:	eb 7d                	jmp    9b0 <blocktest+0xfd>
+    if(poll(pfds, MAXOFILE, 0) != 0)
+     933:	ba 00 00 00 00       	mov    $0x0,%edx
+     938:	be 00 02 00 00       	mov    $0x200,%esi
+     93d:	48 8d 05 3c 16 00 00 	lea    0x163c(%rip),%rax        # 1f80 <pfds>
+     944:	48 89 c7             	mov    %rax,%rdi
+     947:	e8 c5 0c 00 00       	call   1611 <poll>
+     94c:	85 c0                	test   %eax,%eax
+     94e:	74 5c                	je     9ac <blocktest+0xf9>
+      error("poll of no files failed");
+     950:	8b 05 8a 15 00 00    	mov    0x158a(%rip),%eax        # 1ee0 <stdout>
+     956:	ba ac 00 00 00       	mov    $0xac,%edx
+     95b:	48 8d 0d fe 0f 00 00 	lea    0xffe(%rip),%rcx        # 1960 <malloc+0x183>
+     962:	48 89 ce             	mov    %rcx,%rsi
+     965:	89 c7                	mov    %eax,%edi
+     967:	b8 00 00 00 00       	mov    $0x0,%eax
+     96c:	e8 ea 05 00 00       	call   f5b <printf>
+     971:	8b 05 69 15 00 00    	mov    0x1569(%rip),%eax        # 1ee0 <stdout>
+     977:	48 8d 15 45 11 00 00 	lea    0x1145(%rip),%rdx        # 1ac3 <malloc+0x2e6>
+     97e:	48 89 d6             	mov    %rdx,%rsi
+     981:	89 c7                	mov    %eax,%edi
+     983:	b8 00 00 00 00       	mov    $0x0,%eax
+     988:	e8 ce 05 00 00       	call   f5b <printf>
+     98d:	8b 05 4d 15 00 00    	mov    0x154d(%rip),%eax        # 1ee0 <stdout>
+     993:	48 8d 15 f0 0f 00 00 	lea    0xff0(%rip),%rdx        # 198a <malloc+0x1ad>
+     99a:	48 89 d6             	mov    %rdx,%rsi
+     99d:	89 c7                	mov    %eax,%edi
+     99f:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a4:	e8 b2 05 00 00       	call   f5b <printf>
+     9a9:	90                   	nop
+     9aa:	eb fd                	jmp    9a9 <blocktest+0xf6>
+  for(i = 0; i < 100; i++)
+     9ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9b0:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     9b4:	0f 8e 79 ff ff ff    	jle    933 <blocktest+0x80>
+  if(pagesinuse() > before + SLACK)
+     9ba:	e8 5f f6 ff ff       	call   1e <pagesinuse>
+     9bf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     9c2:	83 c2 04             	add    $0x4,%edx
+     9c5:	39 d0                	cmp    %edx,%eax
+     9c7:	7e 67                	jle    a30 <blocktest+0x17d>
+    error("%d pages in use, %d before", pagesinuse(), before);
+     9c9:	8b 05 11 15 00 00    	mov    0x1511(%rip),%eax        # 1ee0 <stdout>
+     9cf:	ba ae 00 00 00       	mov    $0xae,%edx
+     9d4:	48 8d 0d 85 0f 00 00 	lea    0xf85(%rip),%rcx        # 1960 <malloc+0x183>
+     9db:	48 89 ce             	mov    %rcx,%rsi
+     9de:	89 c7                	mov    %eax,%edi
+     9e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9e5:	e8 71 05 00 00       	call   f5b <printf>
+     9ea:	e8 2f f6 ff ff       	call   1e <pagesinuse>
+     9ef:	89 c6                	mov    %eax,%esi
+     9f1:	8b 05 e9 14 00 00    	mov    0x14e9(%rip),%eax        # 1ee0 <stdout>
+     9f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     9fa:	89 d1                	mov    %edx,%ecx
+     9fc:	89 f2                	mov    %esi,%edx
+     9fe:	48 8d 35 b7 0f 00 00 	lea    0xfb7(%rip),%rsi        # 19bc <malloc+0x1df>
+     a05:	89 c7                	mov    %eax,%edi
+     a07:	b8 00 00 00 00       	mov    $0x0,%eax
+     a0c:	e8 4a 05 00 00       	call   f5b <printf>
+     a11:	8b 05 c9 14 00 00    	mov    0x14c9(%rip),%eax        # 1ee0 <stdout>
+     a17:	48 8d 15 6c 0f 00 00 	lea    0xf6c(%rip),%rdx        # 198a <malloc+0x1ad>
+     a1e:	48 89 d6             	mov    %rdx,%rsi
+     a21:	89 c7                	mov    %eax,%edi
+     a23:	b8 00 00 00 00       	mov    $0x0,%eax
+     a28:	e8 2e 05 00 00       	call   f5b <printf>
+     a2d:	90                   	nop
+     a2e:	eb fd                	jmp    a2d <blocktest+0x17a>
+  printf(stdout, "blocktest OK\n");
+     a30:	8b 05 aa 14 00 00    	mov    0x14aa(%rip),%eax        # 1ee0 <stdout>
+     a36:	48 8d 15 9e 10 00 00 	lea    0x109e(%rip),%rdx        # 1adb <malloc+0x2fe>
+     a3d:	48 89 d6             	mov    %rdx,%rsi
+     a40:	89 c7                	mov    %eax,%edi
+     a42:	b8 00 00 00 00       	mov    $0x0,%eax
+     a47:	e8 0f 05 00 00       	call   f5b <printf>
+}
+     a4c:	90                   	nop
+     a4d:	c9                   	leave
+     a4e:	c3                   	ret
+
+0000000000000a4f <zerotest>:
+
+// Anonymous mappings come zeroed too, also after a fork has shared
+// them copy-on-write.
+void
+zerotest(void)
+{
+     a4f:	55                   	push   %rbp
+     a50:	48 89 e5             	mov    %rsp,%rbp
+     a53:	48 83 ec 20          	sub    $0x20,%rsp
+  char *p;
+  int i, k, pid;
+
+  printf(stdout, "zerotest\n");
+     a57:	8b 05 83 14 00 00    	mov    0x1483(%rip),%eax        # 1ee0 <stdout>
+     a5d:	48 8d 15 85 10 00 00 	lea    0x1085(%rip),%rdx        # 1ae9 <malloc+0x30c>
+     a64:	48 89 d6             	mov    %rdx,%rsi
+     a67:	89 c7                	mov    %eax,%edi
+     a69:	b8 00 00 00 00       	mov    $0x0,%eax
+     a6e:	e8 e8 04 00 00       	call   f5b <printf>
+  for(i = 0; i < 5; i++){
+     a73:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a7a:	e9 a8 02 00 00       	jmp    d27 <zerotest+0x2d8>
+    p = mmap2(0, 64 * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+     a7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     a85:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+     a8b:	b9 22 00 00 00       	mov    $0x22,%ecx
+     a90:	ba 03 00 00 00       	mov    $0x3,%edx
+     a95:	be 00 00 04 00       	mov    $0x40000,%esi
+     a9a:	bf 00 00 00 00       	mov    $0x0,%edi
+     a9f:	e8 1e 0b 00 00       	call   15c2 <mmap2>
+     aa4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(p == MAP_FAILED)
+     aa8:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     aad:	75 5c                	jne    b0b <zerotest+0xbc>
+      error("mmap2 failed");
+     aaf:	8b 05 2b 14 00 00    	mov    0x142b(%rip),%eax        # 1ee0 <stdout>
+     ab5:	ba be 00 00 00       	mov    $0xbe,%edx
+     aba:	48 8d 0d 9f 0e 00 00 	lea    0xe9f(%rip),%rcx        # 1960 <malloc+0x183>
+     ac1:	48 89 ce             	mov    %rcx,%rsi
+     ac4:	89 c7                	mov    %eax,%edi
+     ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+     acb:	e8 8b 04 00 00       	call   f5b <printf>
+     ad0:	8b 05 0a 14 00 00    	mov    0x140a(%rip),%eax        # 1ee0 <stdout>
+     ad6:	48 8d 15 16 10 00 00 	lea    0x1016(%rip),%rdx        # 1af3 <malloc+0x316>
+     add:	48 89 d6             	mov    %rdx,%rsi
+     ae0:	89 c7                	mov    %eax,%edi
+     ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae7:	e8 6f 04 00 00       	call   f5b <printf>
+     aec:	8b 05 ee 13 00 00    	mov    0x13ee(%rip),%eax        # 1ee0 <stdout>
+     af2:	48 8d 15 91 0e 00 00 	lea    0xe91(%rip),%rdx        # 198a <malloc+0x1ad>
+     af9:	48 89 d6             	mov    %rdx,%rsi
+     afc:	89 c7                	mov    %eax,%edi
+     afe:	b8 00 00 00 00       	mov    $0x0,%eax
+     b03:	e8 53 04 00 00       	call   f5b <printf>
+     b08:	90                   	nop
+     b09:	eb fd                	jmp    b08 <zerotest+0xb9>
+    for(k = 0; k < 64 * PGSIZE; k += 64)
+     b0b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     b12:	eb 77                	jmp    b8b <zerotest+0x13c>
+      if(p[k] != 0)
+     b14:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b17:	48 63 d0             	movslq %eax,%rdx
+     b1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b1e:	48 01 d0             	add    %rdx,%rax
+     b21:	0f b6 00             	movzbl (%rax),%eax
+     b24:	84 c0                	test   %al,%al
+     b26:	74 5f                	je     b87 <zerotest+0x138>
+        error("byte %d of an anonymous mapping is not zero", k);
+     b28:	8b 05 b2 13 00 00    	mov    0x13b2(%rip),%eax        # 1ee0 <stdout>
+     b2e:	ba c1 00 00 00       	mov    $0xc1,%edx
+     b33:	48 8d 0d 26 0e 00 00 	lea    0xe26(%rip),%rcx        # 1960 <malloc+0x183>
+     b3a:	48 89 ce             	mov    %rcx,%rsi
+     b3d:	89 c7                	mov    %eax,%edi
+     b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b44:	e8 12 04 00 00       	call   f5b <printf>
+     b49:	8b 05 91 13 00 00    	mov    0x1391(%rip),%eax        # 1ee0 <stdout>
+     b4f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     b52:	48 8d 0d a7 0f 00 00 	lea    0xfa7(%rip),%rcx        # 1b00 <malloc+0x323>
+     b59:	48 89 ce             	mov    %rcx,%rsi
+     b5c:	89 c7                	mov    %eax,%edi
+     b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b63:	e8 f3 03 00 00       	call   f5b <printf>
+     b68:	8b 05 72 13 00 00    	mov    0x1372(%rip),%eax        # 1ee0 <stdout>
+     b6e:	48 8d 15 15 0e 00 00 	lea    0xe15(%rip),%rdx        # 198a <malloc+0x1ad>
+     b75:	48 89 d6             	mov    %rdx,%rsi
+     b78:	89 c7                	mov    %eax,%edi
+     b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+     b7f:	e8 d7 03 00 00       	call   f5b <printf>
+     b84:	90                   	nop
+     b85:	eb fd                	jmp    b84 <zerotest+0x135>
+    for(k = 0; k < 64 * PGSIZE; k += 64)
+     b87:	83 45 f8 40          	addl   $0x40,-0x8(%rbp)
+     b8b:	81 7d f8 ff ff 03 00 	cmpl   $0x3ffff,-0x8(%rbp)
+     b92:	7e 80                	jle    b14 <zerotest+0xc5>
+    memset(p, 0x5a, 64 * PGSIZE);
+     b94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b98:	ba 00 00 04 00       	mov    $0x40000,%edx
+     b9d:	be 5a 00 00 00       	mov    $0x5a,%esi
+     ba2:	48 89 c7             	mov    %rax,%rdi
+     ba5:	e8 6f 07 00 00       	call   1319 <memset>
+    if((pid = fork()) < 0)
+     baa:	e8 4b 09 00 00       	call   14fa <fork>
+     baf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     bb2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     bb6:	79 5c                	jns    c14 <zerotest+0x1c5>
+      error("fork failed");
+     bb8:	8b 05 22 13 00 00    	mov    0x1322(%rip),%eax        # 1ee0 <stdout>
+     bbe:	ba c4 00 00 00       	mov    $0xc4,%edx
+     bc3:	48 8d 0d 96 0d 00 00 	lea    0xd96(%rip),%rcx        # 1960 <malloc+0x183>
+     bca:	48 89 ce             	mov    %rcx,%rsi
+     bcd:	89 c7                	mov    %eax,%edi
+     bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd4:	e8 82 03 00 00       	call   f5b <printf>
+     bd9:	8b 05 01 13 00 00    	mov    0x1301(%rip),%eax        # 1ee0 <stdout>
+     bdf:	48 8d 15 32 0e 00 00 	lea    0xe32(%rip),%rdx        # 1a18 <malloc+0x23b>
+     be6:	48 89 d6             	mov    %rdx,%rsi
+     be9:	89 c7                	mov    %eax,%edi
+     beb:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf0:	e8 66 03 00 00       	call   f5b <printf>
+     bf5:	8b 05 e5 12 00 00    	mov    0x12e5(%rip),%eax        # 1ee0 <stdout>
+     bfb:	48 8d 15 88 0d 00 00 	lea    0xd88(%rip),%rdx        # 198a <malloc+0x1ad>
+     c02:	48 89 d6             	mov    %rdx,%rsi
+     c05:	89 c7                	mov    %eax,%edi
+     c07:	b8 00 00 00 00       	mov    $0x0,%eax
+     c0c:	e8 4a 03 00 00       	call   f5b <printf>
+     c11:	90                   	nop
+     c12:	eb fd                	jmp    c11 <zerotest+0x1c2>
+    if(pid == 0){
+     c14:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     c18:	75 1b                	jne    c35 <zerotest+0x1e6>
+      memset(p, 0xa5, 64 * PGSIZE);
+     c1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c1e:	ba 00 00 04 00       	mov    $0x40000,%edx
+     c23:	be a5 00 00 00       	mov    $0xa5,%esi
+     c28:	48 89 c7             	mov    %rax,%rdi
+     c2b:	e8 e9 06 00 00       	call   1319 <memset>
+      exit();
+     c30:	e8 cd 08 00 00       	call   1502 <exit>
+    }
+    wait();
+     c35:	e8 d0 08 00 00       	call   150a <wait>
+    if(p[0] != 0x5a || p[64 * PGSIZE - 1] != 0x5a)
+     c3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c3e:	0f b6 00             	movzbl (%rax),%eax
+     c41:	3c 5a                	cmp    $0x5a,%al
+     c43:	75 11                	jne    c56 <zerotest+0x207>
+     c45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c49:	48 05 ff ff 03 00    	add    $0x3ffff,%rax
+     c4f:	0f b6 00             	movzbl (%rax),%eax
+     c52:	3c 5a                	cmp    $0x5a,%al
+     c54:	74 5c                	je     cb2 <zerotest+0x263>
+      error("child write reached the parent");
+     c56:	8b 05 84 12 00 00    	mov    0x1284(%rip),%eax        # 1ee0 <stdout>
+     c5c:	ba cb 00 00 00       	mov    $0xcb,%edx
+     c61:	48 8d 0d f8 0c 00 00 	lea    0xcf8(%rip),%rcx        # 1960 <malloc+0x183>
+     c68:	48 89 ce             	mov    %rcx,%rsi
+     c6b:	89 c7                	mov    %eax,%edi
+     c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c72:	e8 e4 02 00 00       	call   f5b <printf>
+     c77:	8b 05 63 12 00 00    	mov    0x1263(%rip),%eax        # 1ee0 <stdout>
+     c7d:	48 8d 15 ac 0e 00 00 	lea    0xeac(%rip),%rdx        # 1b30 <malloc+0x353>
+     c84:	48 89 d6             	mov    %rdx,%rsi
+     c87:	89 c7                	mov    %eax,%edi
+     c89:	b8 00 00 00 00       	mov    $0x0,%eax
+     c8e:	e8 c8 02 00 00       	call   f5b <printf>
+     c93:	8b 05 47 12 00 00    	mov    0x1247(%rip),%eax        # 1ee0 <stdout>
+     c99:	48 8d 15 ea 0c 00 00 	lea    0xcea(%rip),%rdx        # 198a <malloc+0x1ad>
+     ca0:	48 89 d6             	mov    %rdx,%rsi
+     ca3:	89 c7                	mov    %eax,%edi
+     ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+     caa:	e8 ac 02 00 00       	call   f5b <printf>
+     caf:	90                   	nop
+     cb0:	eb fd                	jmp    caf <zerotest+0x260>
+    if(munmap2(p, 64 * PGSIZE) < 0)
+     cb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cb6:	be 00 00 04 00       	mov    $0x40000,%esi
+     cbb:	48 89 c7             	mov    %rax,%rdi
+     cbe:	e8 0e 09 00 00       	call   15d1 <munmap2>
+     cc3:	85 c0                	test   %eax,%eax
+     cc5:	79 5c                	jns    d23 <zerotest+0x2d4>
+      error("munmap2 failed");
+     cc7:	8b 05 13 12 00 00    	mov    0x1213(%rip),%eax        # 1ee0 <stdout>
+     ccd:	ba cd 00 00 00       	mov    $0xcd,%edx
+     cd2:	48 8d 0d 87 0c 00 00 	lea    0xc87(%rip),%rcx        # 1960 <malloc+0x183>
+     cd9:	48 89 ce             	mov    %rcx,%rsi
+     cdc:	89 c7                	mov    %eax,%edi
+     cde:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce3:	e8 73 02 00 00       	call   f5b <printf>
+     ce8:	8b 05 f2 11 00 00    	mov    0x11f2(%rip),%eax        # 1ee0 <stdout>
+     cee:	48 8d 15 5a 0e 00 00 	lea    0xe5a(%rip),%rdx        # 1b4f <malloc+0x372>
+     cf5:	48 89 d6             	mov    %rdx,%rsi
+     cf8:	89 c7                	mov    %eax,%edi
+     cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+     cff:	e8 57 02 00 00       	call   f5b <printf>
+     d04:	8b 05 d6 11 00 00    	mov    0x11d6(%rip),%eax        # 1ee0 <stdout>
+     d0a:	48 8d 15 79 0c 00 00 	lea    0xc79(%rip),%rdx        # 198a <malloc+0x1ad>
+     d11:	48 89 d6             	mov    %rdx,%rsi
+     d14:	89 c7                	mov    %eax,%edi
+     d16:	b8 00 00 00 00       	mov    $0x0,%eax
+     d1b:	e8 3b 02 00 00       	call   f5b <printf>
+     d20:	90                   	nop
+     d21:	eb fd                	jmp    d20 <zerotest+0x2d1>
+  for(i = 0; i < 5; i++){
+     d23:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d27:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+     d2b:	0f 8e 4e fd ff ff    	jle    a7f <zerotest+0x30>
+  }
+  printf(stdout, "zerotest OK\n");
+     d31:	8b 05 a9 11 00 00    	mov    0x11a9(%rip),%eax        # 1ee0 <stdout>
+     d37:	48 8d 15 20 0e 00 00 	lea    0xe20(%rip),%rdx        # 1b5e <malloc+0x381>
+     d3e:	48 89 d6             	mov    %rdx,%rsi
+     d41:	89 c7                	mov    %eax,%edi
+     d43:	b8 00 00 00 00       	mov    $0x0,%eax
+     d48:	e8 0e 02 00 00       	call   f5b <printf>
+}
+     d4d:	90                   	nop
+     d4e:	c9                   	leave
+     d4f:	c3                   	ret
+
+0000000000000d50 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     d50:	55                   	push   %rbp
+     d51:	48 89 e5             	mov    %rsp,%rbp
+     d54:	48 83 ec 10          	sub    $0x10,%rsp
+     d58:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     d5b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  pagetest();
+     d5f:	e8 0a f4 ff ff       	call   16e <pagetest>
+  concurrenttest();
+     d64:	e8 89 f5 ff ff       	call   2f2 <concurrenttest>
+  objecttest();
+     d69:	e8 3f f8 ff ff       	call   5ad <objecttest>
+  blocktest();
+     d6e:	e8 40 fb ff ff       	call   8b3 <blocktest>
+  zerotest();
+     d73:	e8 d7 fc ff ff       	call   a4f <zerotest>
+  printf(stdout, "alloctest passed!!\n");
+     d78:	8b 05 62 11 00 00    	mov    0x1162(%rip),%eax        # 1ee0 <stdout>
+     d7e:	48 8d 15 e6 0d 00 00 	lea    0xde6(%rip),%rdx        # 1b6b <malloc+0x38e>
+     d85:	48 89 d6             	mov    %rdx,%rsi
+     d88:	89 c7                	mov    %eax,%edi
+     d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d8f:	e8 c7 01 00 00       	call   f5b <printf>
+  exit();
+     d94:	e8 69 07 00 00       	call   1502 <exit>
+
+0000000000000d99 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     d99:	55                   	push   %rbp
+     d9a:	48 89 e5             	mov    %rsp,%rbp
+     d9d:	48 83 ec 10          	sub    $0x10,%rsp
+     da1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     da4:	89 f0                	mov    %esi,%eax
+     da6:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     da9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     dad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     db0:	ba 01 00 00 00       	mov    $0x1,%edx
+     db5:	48 89 ce             	mov    %rcx,%rsi
+     db8:	89 c7                	mov    %eax,%edi
+     dba:	e8 63 07 00 00       	call   1522 <write>
+}
+     dbf:	90                   	nop
+     dc0:	c9                   	leave
+     dc1:	c3                   	ret
+
+0000000000000dc2 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     dc2:	55                   	push   %rbp
+     dc3:	48 89 e5             	mov    %rsp,%rbp
+     dc6:	48 83 ec 40          	sub    $0x40,%rsp
+     dca:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     dcd:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     dd0:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     dd3:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     dd6:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     dda:	74 1f                	je     dfb <printint64+0x39>
+     ddc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ddf:	c1 e8 1f             	shr    $0x1f,%eax
+     de2:	0f b6 c0             	movzbl %al,%eax
+     de5:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     de8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     dec:	74 0d                	je     dfb <printint64+0x39>
+    x = -xx;
+     dee:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     df1:	f7 d8                	neg    %eax
+     df3:	48 98                	cltq
+     df5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     df9:	eb 09                	jmp    e04 <printint64+0x42>
+  else
+    x = xx;
+     dfb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     dfe:	48 98                	cltq
+     e00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     e04:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     e0b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     e0e:	48 63 c8             	movslq %eax,%rcx
+     e11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e15:	ba 00 00 00 00       	mov    $0x0,%edx
+     e1a:	48 f7 f1             	div    %rcx
+     e1d:	48 89 d1             	mov    %rdx,%rcx
+     e20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e23:	8d 50 01             	lea    0x1(%rax),%edx
+     e26:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e29:	48 8d 15 c0 10 00 00 	lea    0x10c0(%rip),%rdx        # 1ef0 <digits.1>
+     e30:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     e34:	48 98                	cltq
+     e36:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     e3a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     e3d:	48 63 f0             	movslq %eax,%rsi
+     e40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e44:	ba 00 00 00 00       	mov    $0x0,%edx
+     e49:	48 f7 f6             	div    %rsi
+     e4c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e50:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     e55:	75 b4                	jne    e0b <printint64+0x49>
+
+  if(sgn)
+     e57:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     e5b:	74 2b                	je     e88 <printint64+0xc6>
+    buf[i++] = '-';
+     e5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e60:	8d 50 01             	lea    0x1(%rax),%edx
+     e63:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e66:	48 98                	cltq
+     e68:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     e6d:	eb 19                	jmp    e88 <printint64+0xc6>
+    putc(fd, buf[i]);
+     e6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e72:	48 98                	cltq
+     e74:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     e79:	0f be d0             	movsbl %al,%edx
+     e7c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     e7f:	89 d6                	mov    %edx,%esi
+     e81:	89 c7                	mov    %eax,%edi
+     e83:	e8 11 ff ff ff       	call   d99 <putc>
+  while(--i >= 0)
+     e88:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     e8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e90:	79 dd                	jns    e6f <printint64+0xad>
+}
+     e92:	90                   	nop
+     e93:	90                   	nop
+     e94:	c9                   	leave
+     e95:	c3                   	ret
+
+0000000000000e96 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     e96:	55                   	push   %rbp
+     e97:	48 89 e5             	mov    %rsp,%rbp
+     e9a:	48 83 ec 30          	sub    $0x30,%rsp
+     e9e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     ea1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     ea4:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     ea7:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     eaa:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     eb1:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     eb5:	74 17                	je     ece <printint+0x38>
+     eb7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     ebb:	79 11                	jns    ece <printint+0x38>
+    neg = 1;
+     ebd:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     ec4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     ec7:	f7 d8                	neg    %eax
+     ec9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ecc:	eb 06                	jmp    ed4 <printint+0x3e>
+  } else {
+    x = xx;
+     ece:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     ed1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     ed4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     edb:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     ede:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+     ee6:	f7 f1                	div    %ecx
+     ee8:	89 d1                	mov    %edx,%ecx
+     eea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eed:	8d 50 01             	lea    0x1(%rax),%edx
+     ef0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ef3:	89 c9                	mov    %ecx,%ecx
+     ef5:	48 8d 15 14 10 00 00 	lea    0x1014(%rip),%rdx        # 1f10 <digits.0>
+     efc:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     f00:	48 98                	cltq
+     f02:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     f06:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     f09:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+     f11:	f7 f6                	div    %esi
+     f13:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     f16:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     f1a:	75 bf                	jne    edb <printint+0x45>
+  if(neg)
+     f1c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     f20:	74 2b                	je     f4d <printint+0xb7>
+    buf[i++] = '-';
+     f22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f25:	8d 50 01             	lea    0x1(%rax),%edx
+     f28:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     f2b:	48 98                	cltq
+     f2d:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     f32:	eb 19                	jmp    f4d <printint+0xb7>
+    putc(fd, buf[i]);
+     f34:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f37:	48 98                	cltq
+     f39:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     f3e:	0f be d0             	movsbl %al,%edx
+     f41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     f44:	89 d6                	mov    %edx,%esi
+     f46:	89 c7                	mov    %eax,%edi
+     f48:	e8 4c fe ff ff       	call   d99 <putc>
+  while(--i >= 0)
+     f4d:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     f51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f55:	79 dd                	jns    f34 <printint+0x9e>
+}
+     f57:	90                   	nop
+     f58:	90                   	nop
+     f59:	c9                   	leave
+     f5a:	c3                   	ret
+
+0000000000000f5b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     f5b:	55                   	push   %rbp
+     f5c:	48 89 e5             	mov    %rsp,%rbp
+     f5f:	48 83 ec 70          	sub    $0x70,%rsp
+     f63:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     f66:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     f6a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     f6e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     f72:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     f76:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     f7a:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     f81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     f85:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     f89:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     f8d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     f91:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     f98:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     f9f:	e9 6b 02 00 00       	jmp    120f <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     fa4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     fa7:	48 63 d0             	movslq %eax,%rdx
+     faa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     fae:	48 01 d0             	add    %rdx,%rax
+     fb1:	0f b6 00             	movzbl (%rax),%eax
+     fb4:	0f be c0             	movsbl %al,%eax
+     fb7:	25 ff 00 00 00       	and    $0xff,%eax
+     fbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     fbf:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     fc3:	75 30                	jne    ff5 <printf+0x9a>
+      if(c == '%'){
+     fc5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     fc9:	75 13                	jne    fde <printf+0x83>
+        state = '%';
+     fcb:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     fd2:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     fd9:	e9 2d 02 00 00       	jmp    120b <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     fde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     fe1:	0f be d0             	movsbl %al,%edx
+     fe4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     fe7:	89 d6                	mov    %edx,%esi
+     fe9:	89 c7                	mov    %eax,%edi
+     feb:	e8 a9 fd ff ff       	call   d99 <putc>
+     ff0:	e9 16 02 00 00       	jmp    120b <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     ff5:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     ff9:	0f 85 0c 02 00 00    	jne    120b <printf+0x2b0>
+      if(c == 'l') {
+     fff:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1003:	75 0c                	jne    1011 <printf+0xb6>
+        lflag = 1;
+    1005:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    100c:	e9 fa 01 00 00       	jmp    120b <printf+0x2b0>
+      } else if(c == 'd'){
+    1011:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1015:	0f 85 95 00 00 00    	jne    10b0 <printf+0x155>
+        if (lflag == 1)
+    101b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    101f:	75 49                	jne    106a <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1021:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1024:	83 f8 2f             	cmp    $0x2f,%eax
+    1027:	77 17                	ja     1040 <printf+0xe5>
+    1029:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    102d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1030:	89 d2                	mov    %edx,%edx
+    1032:	48 01 d0             	add    %rdx,%rax
+    1035:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1038:	83 c2 08             	add    $0x8,%edx
+    103b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    103e:	eb 0c                	jmp    104c <printf+0xf1>
+    1040:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1044:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1048:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    104c:	48 8b 00             	mov    (%rax),%rax
+    104f:	89 c6                	mov    %eax,%esi
+    1051:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1054:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1059:	ba 0a 00 00 00       	mov    $0xa,%edx
+    105e:	89 c7                	mov    %eax,%edi
+    1060:	e8 5d fd ff ff       	call   dc2 <printint64>
+    1065:	e9 9a 01 00 00       	jmp    1204 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    106a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    106d:	83 f8 2f             	cmp    $0x2f,%eax
+    1070:	77 17                	ja     1089 <printf+0x12e>
+    1072:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1076:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1079:	89 d2                	mov    %edx,%edx
+    107b:	48 01 d0             	add    %rdx,%rax
+    107e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1081:	83 c2 08             	add    $0x8,%edx
+    1084:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1087:	eb 0c                	jmp    1095 <printf+0x13a>
+    1089:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    108d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1091:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1095:	8b 30                	mov    (%rax),%esi
+    1097:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    109a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    109f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    10a4:	89 c7                	mov    %eax,%edi
+    10a6:	e8 eb fd ff ff       	call   e96 <printint>
+    10ab:	e9 54 01 00 00       	jmp    1204 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    10b0:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    10b4:	74 0a                	je     10c0 <printf+0x165>
+    10b6:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    10ba:	0f 85 95 00 00 00    	jne    1155 <printf+0x1fa>
+        if (lflag == 1)
+    10c0:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    10c4:	75 49                	jne    110f <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    10c6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    10c9:	83 f8 2f             	cmp    $0x2f,%eax
+    10cc:	77 17                	ja     10e5 <printf+0x18a>
+    10ce:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    10d2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    10d5:	89 d2                	mov    %edx,%edx
+    10d7:	48 01 d0             	add    %rdx,%rax
+    10da:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    10dd:	83 c2 08             	add    $0x8,%edx
+    10e0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    10e3:	eb 0c                	jmp    10f1 <printf+0x196>
+    10e5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    10e9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    10ed:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    10f1:	48 8b 00             	mov    (%rax),%rax
+    10f4:	89 c6                	mov    %eax,%esi
+    10f6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    10fe:	ba 10 00 00 00       	mov    $0x10,%edx
+    1103:	89 c7                	mov    %eax,%edi
+    1105:	e8 b8 fc ff ff       	call   dc2 <printint64>
+        if (lflag == 1)
+    110a:	e9 f5 00 00 00       	jmp    1204 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    110f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1112:	83 f8 2f             	cmp    $0x2f,%eax
+    1115:	77 17                	ja     112e <printf+0x1d3>
+    1117:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    111b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    111e:	89 d2                	mov    %edx,%edx
+    1120:	48 01 d0             	add    %rdx,%rax
+    1123:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1126:	83 c2 08             	add    $0x8,%edx
+    1129:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    112c:	eb 0c                	jmp    113a <printf+0x1df>
+    112e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1132:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1136:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    113a:	8b 30                	mov    (%rax),%esi
+    113c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    113f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1144:	ba 10 00 00 00       	mov    $0x10,%edx
+    1149:	89 c7                	mov    %eax,%edi
+    114b:	e8 46 fd ff ff       	call   e96 <printint>
+        if (lflag == 1)
+    1150:	e9 af 00 00 00       	jmp    1204 <printf+0x2a9>
+      } else if(c == 's'){
+    1155:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1159:	75 6e                	jne    11c9 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    115b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    115e:	83 f8 2f             	cmp    $0x2f,%eax
+    1161:	77 17                	ja     117a <printf+0x21f>
+    1163:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1167:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    116a:	89 d2                	mov    %edx,%edx
+    116c:	48 01 d0             	add    %rdx,%rax
+    116f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1172:	83 c2 08             	add    $0x8,%edx
+    1175:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1178:	eb 0c                	jmp    1186 <printf+0x22b>
+    117a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    117e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1182:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1186:	48 8b 00             	mov    (%rax),%rax
+    1189:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    118d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1192:	75 28                	jne    11bc <printf+0x261>
+          s = "(null)";
+    1194:	48 8d 05 e4 09 00 00 	lea    0x9e4(%rip),%rax        # 1b7f <malloc+0x3a2>
+    119b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    119f:	eb 1b                	jmp    11bc <printf+0x261>
+          putc(fd, *s);
+    11a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    11a5:	0f b6 00             	movzbl (%rax),%eax
+    11a8:	0f be d0             	movsbl %al,%edx
+    11ab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11ae:	89 d6                	mov    %edx,%esi
+    11b0:	89 c7                	mov    %eax,%edi
+    11b2:	e8 e2 fb ff ff       	call   d99 <putc>
+        for(; *s; s++)
+    11b7:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    11bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    11c0:	0f b6 00             	movzbl (%rax),%eax
+    11c3:	84 c0                	test   %al,%al
+    11c5:	75 da                	jne    11a1 <printf+0x246>
+    11c7:	eb 3b                	jmp    1204 <printf+0x2a9>
+      } else if(c == '%'){
+    11c9:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    11cd:	75 14                	jne    11e3 <printf+0x288>
+        putc(fd, c);
+    11cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    11d2:	0f be d0             	movsbl %al,%edx
+    11d5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11d8:	89 d6                	mov    %edx,%esi
+    11da:	89 c7                	mov    %eax,%edi
+    11dc:	e8 b8 fb ff ff       	call   d99 <putc>
+    11e1:	eb 21                	jmp    1204 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    11e3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11e6:	be 25 00 00 00       	mov    $0x25,%esi
+    11eb:	89 c7                	mov    %eax,%edi
+    11ed:	e8 a7 fb ff ff       	call   d99 <putc>
+        putc(fd, c);
+    11f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    11f5:	0f be d0             	movsbl %al,%edx
+    11f8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11fb:	89 d6                	mov    %edx,%esi
+    11fd:	89 c7                	mov    %eax,%edi
+    11ff:	e8 95 fb ff ff       	call   d99 <putc>
+      }
+      state = 0;
+    1204:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    120b:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    120f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1212:	48 63 d0             	movslq %eax,%rdx
+    1215:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1219:	48 01 d0             	add    %rdx,%rax
+    121c:	0f b6 00             	movzbl (%rax),%eax
+    121f:	84 c0                	test   %al,%al
+    1221:	0f 85 7d fd ff ff    	jne    fa4 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1227:	90                   	nop
+    1228:	90                   	nop
+    1229:	c9                   	leave
+    122a:	c3                   	ret
+
+000000000000122b <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    122b:	55                   	push   %rbp
+    122c:	48 89 e5             	mov    %rsp,%rbp
+    122f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1233:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1236:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    1239:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    123d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1240:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1243:	48 89 ce             	mov    %rcx,%rsi
+    1246:	48 89 f7             	mov    %rsi,%rdi
+    1249:	89 d1                	mov    %edx,%ecx
+    124b:	fc                   	cld
+    124c:	f3 aa                	rep stos %al,%es:(%rdi)
+    124e:	89 ca                	mov    %ecx,%edx
+    1250:	48 89 fe             	mov    %rdi,%rsi
+    1253:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1257:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    125a:	90                   	nop
+    125b:	5d                   	pop    %rbp
+    125c:	c3                   	ret
+
+000000000000125d <strcpy>:
+{
+    125d:	55                   	push   %rbp
+    125e:	48 89 e5             	mov    %rsp,%rbp
+    1261:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1265:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1269:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    126d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1271:	90                   	nop
+    1272:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1276:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    127a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    127e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1282:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1286:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    128a:	0f b6 12             	movzbl (%rdx),%edx
+    128d:	88 10                	mov    %dl,(%rax)
+    128f:	0f b6 00             	movzbl (%rax),%eax
+    1292:	84 c0                	test   %al,%al
+    1294:	75 dc                	jne    1272 <strcpy+0x15>
+  return os;
+    1296:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    129a:	5d                   	pop    %rbp
+    129b:	c3                   	ret
+
+000000000000129c <strcmp>:
+{
+    129c:	55                   	push   %rbp
+    129d:	48 89 e5             	mov    %rsp,%rbp
+    12a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    12a8:	eb 0a                	jmp    12b4 <strcmp+0x18>
+    p++, q++;
+    12aa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    12af:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    12b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b8:	0f b6 00             	movzbl (%rax),%eax
+    12bb:	84 c0                	test   %al,%al
+    12bd:	74 12                	je     12d1 <strcmp+0x35>
+    12bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12c3:	0f b6 10             	movzbl (%rax),%edx
+    12c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12ca:	0f b6 00             	movzbl (%rax),%eax
+    12cd:	38 c2                	cmp    %al,%dl
+    12cf:	74 d9                	je     12aa <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    12d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12d5:	0f b6 00             	movzbl (%rax),%eax
+    12d8:	0f b6 d0             	movzbl %al,%edx
+    12db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12df:	0f b6 00             	movzbl (%rax),%eax
+    12e2:	0f b6 c0             	movzbl %al,%eax
+    12e5:	29 c2                	sub    %eax,%edx
+    12e7:	89 d0                	mov    %edx,%eax
+}
+    12e9:	5d                   	pop    %rbp
+    12ea:	c3                   	ret
+
+00000000000012eb <strlen>:
+{
+    12eb:	55                   	push   %rbp
+    12ec:	48 89 e5             	mov    %rsp,%rbp
+    12ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    12f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    12fa:	eb 04                	jmp    1300 <strlen+0x15>
+    12fc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1300:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1303:	48 63 d0             	movslq %eax,%rdx
+    1306:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    130a:	48 01 d0             	add    %rdx,%rax
+    130d:	0f b6 00             	movzbl (%rax),%eax
+    1310:	84 c0                	test   %al,%al
+    1312:	75 e8                	jne    12fc <strlen+0x11>
+  return n;
+    1314:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1317:	5d                   	pop    %rbp
+    1318:	c3                   	ret
+
+0000000000001319 <memset>:
+{
+    1319:	55                   	push   %rbp
+    131a:	48 89 e5             	mov    %rsp,%rbp
+    131d:	48 83 ec 10          	sub    $0x10,%rsp
+    1321:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1325:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1328:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    132b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    132e:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1331:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1335:	89 ce                	mov    %ecx,%esi
+    1337:	48 89 c7             	mov    %rax,%rdi
+    133a:	e8 ec fe ff ff       	call   122b <stosb>
+  return dst;
+    133f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1343:	c9                   	leave
+    1344:	c3                   	ret
+
+0000000000001345 <strchr>:
+{
+    1345:	55                   	push   %rbp
+    1346:	48 89 e5             	mov    %rsp,%rbp
+    1349:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    134d:	89 f0                	mov    %esi,%eax
+    134f:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1352:	eb 17                	jmp    136b <strchr+0x26>
+    if(*s == c)
+    1354:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1358:	0f b6 00             	movzbl (%rax),%eax
+    135b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    135e:	75 06                	jne    1366 <strchr+0x21>
+      return (char*)s;
+    1360:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1364:	eb 15                	jmp    137b <strchr+0x36>
+  for(; *s; s++)
+    1366:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    136b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    136f:	0f b6 00             	movzbl (%rax),%eax
+    1372:	84 c0                	test   %al,%al
+    1374:	75 de                	jne    1354 <strchr+0xf>
+  return 0;
+    1376:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    137b:	5d                   	pop    %rbp
+    137c:	c3                   	ret
+
+000000000000137d <gets>:
+gets(char *buf, int max)
+{
+    137d:	55                   	push   %rbp
+    137e:	48 89 e5             	mov    %rsp,%rbp
+    1381:	48 83 ec 20          	sub    $0x20,%rsp
+    1385:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1389:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    138c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1393:	eb 48                	jmp    13dd <gets+0x60>
+    cc = read(0, &c, 1);
+    1395:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1399:	ba 01 00 00 00       	mov    $0x1,%edx
+    139e:	48 89 c6             	mov    %rax,%rsi
+    13a1:	bf 00 00 00 00       	mov    $0x0,%edi
+    13a6:	e8 6f 01 00 00       	call   151a <read>
+    13ab:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    13ae:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    13b2:	7e 36                	jle    13ea <gets+0x6d>
+      break;
+    buf[i++] = c;
+    13b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13b7:	8d 50 01             	lea    0x1(%rax),%edx
+    13ba:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    13bd:	48 63 d0             	movslq %eax,%rdx
+    13c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13c4:	48 01 c2             	add    %rax,%rdx
+    13c7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    13cb:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    13cd:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    13d1:	3c 0a                	cmp    $0xa,%al
+    13d3:	74 16                	je     13eb <gets+0x6e>
+    13d5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    13d9:	3c 0d                	cmp    $0xd,%al
+    13db:	74 0e                	je     13eb <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    13dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13e0:	83 c0 01             	add    $0x1,%eax
+    13e3:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    13e6:	7f ad                	jg     1395 <gets+0x18>
+    13e8:	eb 01                	jmp    13eb <gets+0x6e>
+      break;
+    13ea:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    13eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13ee:	48 63 d0             	movslq %eax,%rdx
+    13f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13f5:	48 01 d0             	add    %rdx,%rax
+    13f8:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    13fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    13ff:	c9                   	leave
+    1400:	c3                   	ret
+
+0000000000001401 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1401:	55                   	push   %rbp
+    1402:	48 89 e5             	mov    %rsp,%rbp
+    1405:	48 83 ec 20          	sub    $0x20,%rsp
+    1409:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    140d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1415:	be 00 00 00 00       	mov    $0x0,%esi
+    141a:	48 89 c7             	mov    %rax,%rdi
+    141d:	e8 20 01 00 00       	call   1542 <open>
+    1422:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1425:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1429:	79 07                	jns    1432 <stat+0x31>
+    return -1;
+    142b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1430:	eb 21                	jmp    1453 <stat+0x52>
+  r = fstat(fd, st);
+    1432:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1436:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1439:	48 89 d6             	mov    %rdx,%rsi
+    143c:	89 c7                	mov    %eax,%edi
+    143e:	e8 17 01 00 00       	call   155a <fstat>
+    1443:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1446:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1449:	89 c7                	mov    %eax,%edi
+    144b:	e8 da 00 00 00       	call   152a <close>
+  return r;
+    1450:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1453:	c9                   	leave
+    1454:	c3                   	ret
+
+0000000000001455 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1455:	55                   	push   %rbp
+    1456:	48 89 e5             	mov    %rsp,%rbp
+    1459:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    145d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1464:	eb 28                	jmp    148e <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1466:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1469:	89 d0                	mov    %edx,%eax
+    146b:	c1 e0 02             	shl    $0x2,%eax
+    146e:	01 d0                	add    %edx,%eax
+    1470:	01 c0                	add    %eax,%eax
+    1472:	89 c1                	mov    %eax,%ecx
+    1474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1478:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    147c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1480:	0f b6 00             	movzbl (%rax),%eax
+    1483:	0f be c0             	movsbl %al,%eax
+    1486:	01 c8                	add    %ecx,%eax
+    1488:	83 e8 30             	sub    $0x30,%eax
+    148b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    148e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1492:	0f b6 00             	movzbl (%rax),%eax
+    1495:	3c 2f                	cmp    $0x2f,%al
+    1497:	7e 0b                	jle    14a4 <atoi+0x4f>
+    1499:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    149d:	0f b6 00             	movzbl (%rax),%eax
+    14a0:	3c 39                	cmp    $0x39,%al
+    14a2:	7e c2                	jle    1466 <atoi+0x11>
+  return n;
+    14a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    14a7:	5d                   	pop    %rbp
+    14a8:	c3                   	ret
+
+00000000000014a9 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    14a9:	55                   	push   %rbp
+    14aa:	48 89 e5             	mov    %rsp,%rbp
+    14ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    14b5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    14b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    14c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    14c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    14c8:	eb 1d                	jmp    14e7 <memmove+0x3e>
+    *dst++ = *src++;
+    14ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    14ce:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    14d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    14d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14da:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    14de:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    14e2:	0f b6 12             	movzbl (%rdx),%edx
+    14e5:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    14e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    14ea:	8d 50 ff             	lea    -0x1(%rax),%edx
+    14ed:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    14f0:	85 c0                	test   %eax,%eax
+    14f2:	7f d6                	jg     14ca <memmove+0x21>
+  return vdst;
+    14f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14f8:	5d                   	pop    %rbp
+    14f9:	c3                   	ret
+
+00000000000014fa <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    14fa:	b8 01 00 00 00       	mov    $0x1,%eax
+    14ff:	cd 40                	int    $0x40
+    1501:	c3                   	ret
+
+0000000000001502 <exit>:
+SYSCALL(exit)
+    1502:	b8 02 00 00 00       	mov    $0x2,%eax
+    1507:	cd 40                	int    $0x40
+    1509:	c3                   	ret
+
+000000000000150a <wait>:
+SYSCALL(wait)
+    150a:	b8 03 00 00 00       	mov    $0x3,%eax
+    150f:	cd 40                	int    $0x40
+    1511:	c3                   	ret
+
+0000000000001512 <pipe>:
+SYSCALL(pipe)
+    1512:	b8 04 00 00 00       	mov    $0x4,%eax
+    1517:	cd 40                	int    $0x40
+    1519:	c3                   	ret
+
+000000000000151a <read>:
+SYSCALL(read)
+    151a:	b8 05 00 00 00       	mov    $0x5,%eax
+    151f:	cd 40                	int    $0x40
+    1521:	c3                   	ret
+
+0000000000001522 <write>:
+SYSCALL(write)
+    1522:	b8 10 00 00 00       	mov    $0x10,%eax
+    1527:	cd 40                	int    $0x40
+    1529:	c3                   	ret
+
+000000000000152a <close>:
+SYSCALL(close)
+    152a:	b8 15 00 00 00       	mov    $0x15,%eax
+    152f:	cd 40                	int    $0x40
+    1531:	c3                   	ret
+
+0000000000001532 <kill>:
+SYSCALL(kill)
+    1532:	b8 06 00 00 00       	mov    $0x6,%eax
+    1537:	cd 40                	int    $0x40
+    1539:	c3                   	ret
+
+000000000000153a <exec>:
+SYSCALL(exec)
+    153a:	b8 07 00 00 00       	mov    $0x7,%eax
+    153f:	cd 40                	int    $0x40
+    1541:	c3                   	ret
+
+0000000000001542 <open>:
+SYSCALL(open)
+    1542:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1547:	cd 40                	int    $0x40
+    1549:	c3                   	ret
+
+000000000000154a <mknod>:
+SYSCALL(mknod)
+    154a:	b8 11 00 00 00       	mov    $0x11,%eax
+    154f:	cd 40                	int    $0x40
+    1551:	c3                   	ret
+
+0000000000001552 <unlink>:
+SYSCALL(unlink)
+    1552:	b8 12 00 00 00       	mov    $0x12,%eax
+    1557:	cd 40                	int    $0x40
+    1559:	c3                   	ret
+
+000000000000155a <fstat>:
+SYSCALL(fstat)
+    155a:	b8 08 00 00 00       	mov    $0x8,%eax
+    155f:	cd 40                	int    $0x40
+    1561:	c3                   	ret
+
+0000000000001562 <link>:
+SYSCALL(link)
+    1562:	b8 13 00 00 00       	mov    $0x13,%eax
+    1567:	cd 40                	int    $0x40
+    1569:	c3                   	ret
+
+000000000000156a <mkdir>:
+SYSCALL(mkdir)
+    156a:	b8 14 00 00 00       	mov    $0x14,%eax
+    156f:	cd 40                	int    $0x40
+    1571:	c3                   	ret
+
+0000000000001572 <chdir>:
+SYSCALL(chdir)
+    1572:	b8 09 00 00 00       	mov    $0x9,%eax
+    1577:	cd 40                	int    $0x40
+    1579:	c3                   	ret
+
+000000000000157a <dup>:
+SYSCALL(dup)
+    157a:	b8 0a 00 00 00       	mov    $0xa,%eax
+    157f:	cd 40                	int    $0x40
+    1581:	c3                   	ret
+
+0000000000001582 <getpid>:
+SYSCALL(getpid)
+    1582:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1587:	cd 40                	int    $0x40
+    1589:	c3                   	ret
+
+000000000000158a <sbrk>:
+SYSCALL(sbrk)
+    158a:	b8 0c 00 00 00       	mov    $0xc,%eax
+    158f:	cd 40                	int    $0x40
+    1591:	c3                   	ret
+
+0000000000001592 <sleep>:
+SYSCALL(sleep)
+    1592:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1597:	cd 40                	int    $0x40
+    1599:	c3                   	ret
+
+000000000000159a <uptime>:
+SYSCALL(uptime)
+    159a:	b8 0e 00 00 00       	mov    $0xe,%eax
+    159f:	cd 40                	int    $0x40
+    15a1:	c3                   	ret
+
+00000000000015a2 <sysinfo>:
+SYSCALL(sysinfo)
+    15a2:	b8 16 00 00 00       	mov    $0x16,%eax
+    15a7:	cd 40                	int    $0x40
+    15a9:	c3                   	ret
+
+00000000000015aa <mmap>:
+SYSCALL(mmap)
+    15aa:	b8 17 00 00 00       	mov    $0x17,%eax
+    15af:	cd 40                	int    $0x40
+    15b1:	c3                   	ret
+
+00000000000015b2 <munmap>:
+SYSCALL(munmap)
+    15b2:	b8 18 00 00 00       	mov    $0x18,%eax
+    15b7:	cd 40                	int    $0x40
+    15b9:	c3                   	ret
+
+00000000000015ba <crashn>:
+SYSCALL(crashn)
+    15ba:	b8 19 00 00 00       	mov    $0x19,%eax
+    15bf:	cd 40                	int    $0x40
+    15c1:	c3                   	ret
+
+00000000000015c2 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    15c2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    15c7:	cd 40                	int    $0x40
+    15c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15cc:	74 02                	je     15d0 <mmap2+0xe>
+    15ce:	89 c0                	mov    %eax,%eax
+    15d0:	c3                   	ret
+
+00000000000015d1 <munmap2>:
+SYSCALL(munmap2)
+    15d1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    15d6:	cd 40                	int    $0x40
+    15d8:	c3                   	ret
+
+00000000000015d9 <msync>:
+SYSCALL(msync)
+    15d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15de:	cd 40                	int    $0x40
+    15e0:	c3                   	ret
+
+00000000000015e1 <sendfile>:
+SYSCALL(sendfile)
+    15e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15e6:	cd 40                	int    $0x40
+    15e8:	c3                   	ret
+
+00000000000015e9 <splice>:
+SYSCALL(splice)
+    15e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15ee:	cd 40                	int    $0x40
+    15f0:	c3                   	ret
+
+00000000000015f1 <pread>:
+SYSCALL(pread)
+    15f1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15f6:	cd 40                	int    $0x40
+    15f8:	c3                   	ret
+
+00000000000015f9 <pwrite>:
+SYSCALL(pwrite)
+    15f9:	b8 20 00 00 00       	mov    $0x20,%eax
+    15fe:	cd 40                	int    $0x40
+    1600:	c3                   	ret
+
+0000000000001601 <readv>:
+SYSCALL(readv)
+    1601:	b8 21 00 00 00       	mov    $0x21,%eax
+    1606:	cd 40                	int    $0x40
+    1608:	c3                   	ret
+
+0000000000001609 <writev>:
+SYSCALL(writev)
+    1609:	b8 22 00 00 00       	mov    $0x22,%eax
+    160e:	cd 40                	int    $0x40
+    1610:	c3                   	ret
+
+0000000000001611 <poll>:
+SYSCALL(poll)
+    1611:	b8 23 00 00 00       	mov    $0x23,%eax
+    1616:	cd 40                	int    $0x40
+    1618:	c3                   	ret
+
+0000000000001619 <pipe2>:
+SYSCALL(pipe2)
+    1619:	b8 24 00 00 00       	mov    $0x24,%eax
+    161e:	cd 40                	int    $0x40
+    1620:	c3                   	ret
+
+0000000000001621 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1621:	55                   	push   %rbp
+    1622:	48 89 e5             	mov    %rsp,%rbp
+    1625:	48 83 ec 20          	sub    $0x20,%rsp
+    1629:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    162d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1631:	48 83 e8 10          	sub    $0x10,%rax
+    1635:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1639:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    163d:	48 8b 10             	mov    (%rax),%rdx
+    1640:	48 8d 05 19 09 00 00 	lea    0x919(%rip),%rax        # 1f60 <bigblock>
+    1647:	48 39 c2             	cmp    %rax,%rdx
+    164a:	75 1f                	jne    166b <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    164c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1650:	8b 40 08             	mov    0x8(%rax),%eax
+    1653:	c1 e0 04             	shl    $0x4,%eax
+    1656:	89 c2                	mov    %eax,%edx
+    1658:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    165c:	89 d6                	mov    %edx,%esi
+    165e:	48 89 c7             	mov    %rax,%rdi
+    1661:	e8 6b ff ff ff       	call   15d1 <munmap2>
+    return;
+    1666:	e9 0b 01 00 00       	jmp    1776 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    166b:	48 8b 05 de 08 00 00 	mov    0x8de(%rip),%rax        # 1f50 <freep>
+    1672:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1676:	eb 2f                	jmp    16a7 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1678:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167c:	48 8b 00             	mov    (%rax),%rax
+    167f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1683:	72 17                	jb     169c <free+0x7b>
+    1685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1689:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    168d:	72 2f                	jb     16be <free+0x9d>
+    168f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1693:	48 8b 00             	mov    (%rax),%rax
+    1696:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    169a:	72 22                	jb     16be <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    169c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a0:	48 8b 00             	mov    (%rax),%rax
+    16a3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ab:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    16af:	73 c7                	jae    1678 <free+0x57>
+    16b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b5:	48 8b 00             	mov    (%rax),%rax
+    16b8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    16bc:	73 ba                	jae    1678 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    16be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c2:	8b 40 08             	mov    0x8(%rax),%eax
+    16c5:	89 c0                	mov    %eax,%eax
+    16c7:	48 c1 e0 04          	shl    $0x4,%rax
+    16cb:	48 89 c2             	mov    %rax,%rdx
+    16ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16d2:	48 01 c2             	add    %rax,%rdx
+    16d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16d9:	48 8b 00             	mov    (%rax),%rax
+    16dc:	48 39 c2             	cmp    %rax,%rdx
+    16df:	75 2d                	jne    170e <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    16e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e5:	8b 50 08             	mov    0x8(%rax),%edx
+    16e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ec:	48 8b 00             	mov    (%rax),%rax
+    16ef:	8b 40 08             	mov    0x8(%rax),%eax
+    16f2:	01 c2                	add    %eax,%edx
+    16f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f8:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    16fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ff:	48 8b 00             	mov    (%rax),%rax
+    1702:	48 8b 10             	mov    (%rax),%rdx
+    1705:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1709:	48 89 10             	mov    %rdx,(%rax)
+    170c:	eb 0e                	jmp    171c <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    170e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1712:	48 8b 10             	mov    (%rax),%rdx
+    1715:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1719:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    171c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1720:	8b 40 08             	mov    0x8(%rax),%eax
+    1723:	89 c0                	mov    %eax,%eax
+    1725:	48 c1 e0 04          	shl    $0x4,%rax
+    1729:	48 89 c2             	mov    %rax,%rdx
+    172c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1730:	48 01 d0             	add    %rdx,%rax
+    1733:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1737:	75 27                	jne    1760 <free+0x13f>
+    p->s.size += bp->s.size;
+    1739:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    173d:	8b 50 08             	mov    0x8(%rax),%edx
+    1740:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1744:	8b 40 08             	mov    0x8(%rax),%eax
+    1747:	01 c2                	add    %eax,%edx
+    1749:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    174d:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1754:	48 8b 10             	mov    (%rax),%rdx
+    1757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175b:	48 89 10             	mov    %rdx,(%rax)
+    175e:	eb 0b                	jmp    176b <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1764:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1768:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    176b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176f:	48 89 05 da 07 00 00 	mov    %rax,0x7da(%rip)        # 1f50 <freep>
+}
+    1776:	c9                   	leave
+    1777:	c3                   	ret
+
+0000000000001778 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1778:	55                   	push   %rbp
+    1779:	48 89 e5             	mov    %rsp,%rbp
+    177c:	48 83 ec 20          	sub    $0x20,%rsp
+    1780:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1783:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    178a:	77 07                	ja     1793 <morecore+0x1b>
+    nu = 4096;
+    178c:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1793:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1796:	c1 e0 04             	shl    $0x4,%eax
+    1799:	89 c7                	mov    %eax,%edi
+    179b:	e8 ea fd ff ff       	call   158a <sbrk>
+    17a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    17a4:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    17a9:	75 07                	jne    17b2 <morecore+0x3a>
+    return 0;
+    17ab:	b8 00 00 00 00       	mov    $0x0,%eax
+    17b0:	eb 29                	jmp    17db <morecore+0x63>
+  hp = (Header*)p;
+    17b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    17ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17be:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    17c1:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    17c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c8:	48 83 c0 10          	add    $0x10,%rax
+    17cc:	48 89 c7             	mov    %rax,%rdi
+    17cf:	e8 4d fe ff ff       	call   1621 <free>
+  return freep;
+    17d4:	48 8b 05 75 07 00 00 	mov    0x775(%rip),%rax        # 1f50 <freep>
+}
+    17db:	c9                   	leave
+    17dc:	c3                   	ret
+
+00000000000017dd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    17dd:	55                   	push   %rbp
+    17de:	48 89 e5             	mov    %rsp,%rbp
+    17e1:	48 83 ec 30          	sub    $0x30,%rsp
+    17e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    17eb:	48 83 c0 0f          	add    $0xf,%rax
+    17ef:	48 c1 e8 04          	shr    $0x4,%rax
+    17f3:	83 c0 01             	add    $0x1,%eax
+    17f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    17f9:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1800:	76 62                	jbe    1864 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1802:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1805:	c1 e0 04             	shl    $0x4,%eax
+    1808:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    180e:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1814:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1819:	ba 03 00 00 00       	mov    $0x3,%edx
+    181e:	89 c6                	mov    %eax,%esi
+    1820:	bf 00 00 00 00       	mov    $0x0,%edi
+    1825:	e8 98 fd ff ff       	call   15c2 <mmap2>
+    182a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    182e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1833:	75 0a                	jne    183f <malloc+0x62>
+      return 0;
+    1835:	b8 00 00 00 00       	mov    $0x0,%eax
+    183a:	e9 1c 01 00 00       	jmp    195b <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    183f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1843:	48 8d 15 16 07 00 00 	lea    0x716(%rip),%rdx        # 1f60 <bigblock>
+    184a:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    184d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1851:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1854:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1857:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    185b:	48 83 c0 10          	add    $0x10,%rax
+    185f:	e9 f7 00 00 00       	jmp    195b <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1864:	48 8b 05 e5 06 00 00 	mov    0x6e5(%rip),%rax        # 1f50 <freep>
+    186b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    186f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1874:	75 2e                	jne    18a4 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1876:	48 8d 05 c3 06 00 00 	lea    0x6c3(%rip),%rax        # 1f40 <base>
+    187d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1881:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1885:	48 89 05 c4 06 00 00 	mov    %rax,0x6c4(%rip)        # 1f50 <freep>
+    188c:	48 8b 05 bd 06 00 00 	mov    0x6bd(%rip),%rax        # 1f50 <freep>
+    1893:	48 89 05 a6 06 00 00 	mov    %rax,0x6a6(%rip)        # 1f40 <base>
+    base.s.size = 0;
+    189a:	c7 05 a4 06 00 00 00 	movl   $0x0,0x6a4(%rip)        # 1f48 <base+0x8>
+    18a1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    18a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a8:	48 8b 00             	mov    (%rax),%rax
+    18ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    18af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18b3:	8b 40 08             	mov    0x8(%rax),%eax
+    18b6:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    18b9:	72 5f                	jb     191a <malloc+0x13d>
+      if(p->s.size == nunits)
+    18bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18bf:	8b 40 08             	mov    0x8(%rax),%eax
+    18c2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    18c5:	75 10                	jne    18d7 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    18c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18cb:	48 8b 10             	mov    (%rax),%rdx
+    18ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18d2:	48 89 10             	mov    %rdx,(%rax)
+    18d5:	eb 2e                	jmp    1905 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    18d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18db:	8b 40 08             	mov    0x8(%rax),%eax
+    18de:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    18e1:	89 c2                	mov    %eax,%edx
+    18e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e7:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    18ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ee:	8b 40 08             	mov    0x8(%rax),%eax
+    18f1:	89 c0                	mov    %eax,%eax
+    18f3:	48 c1 e0 04          	shl    $0x4,%rax
+    18f7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    18fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ff:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1902:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1905:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1909:	48 89 05 40 06 00 00 	mov    %rax,0x640(%rip)        # 1f50 <freep>
+      return (void*)(p + 1);
+    1910:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1914:	48 83 c0 10          	add    $0x10,%rax
+    1918:	eb 41                	jmp    195b <malloc+0x17e>
+    }
+    if(p == freep)
+    191a:	48 8b 05 2f 06 00 00 	mov    0x62f(%rip),%rax        # 1f50 <freep>
+    1921:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1925:	75 1c                	jne    1943 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1927:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    192a:	89 c7                	mov    %eax,%edi
+    192c:	e8 47 fe ff ff       	call   1778 <morecore>
+    1931:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1935:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    193a:	75 07                	jne    1943 <malloc+0x166>
+        return 0;
+    193c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1941:	eb 18                	jmp    195b <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1947:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    194b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    194f:	48 8b 00             	mov    (%rax),%rax
+    1952:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1956:	e9 54 ff ff ff       	jmp    18af <malloc+0xd2>
+  }
+}
+    195b:	c9                   	leave
+    195c:	c3                   	ret
@@ -0,0 +1,1558 @@
+
+out/user/_cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int n, sent = 0;
+   b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // a regular file goes out straight from the kernel's page cache
+  while((n = sendfile(1, fd, -1, 16 * 4096)) > 0)
+  12:	eb 07                	jmp    1b <cat+0x1b>
+    sent = 1;
+  14:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  while((n = sendfile(1, fd, -1, 16 * 4096)) > 0)
+  1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  1e:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  23:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  28:	89 c6                	mov    %eax,%esi
+  2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  2f:	e8 bf 09 00 00       	call   9f3 <sendfile>
+  34:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  37:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  3b:	7f d7                	jg     14 <cat+0x14>
+  if(n == 0)
+  3d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  41:	0f 84 a6 00 00 00    	je     ed <cat+0xed>
+    return;
+  if(sent){
+  47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  4b:	74 5a                	je     a7 <cat+0xa7>
+    printf(1, "cat: write error\n");
+  4d:	48 8d 05 1b 0d 00 00 	lea    0xd1b(%rip),%rax        # d6f <malloc+0x180>
+  54:	48 89 c6             	mov    %rax,%rsi
+  57:	bf 01 00 00 00       	mov    $0x1,%edi
+  5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  61:	e8 07 03 00 00       	call   36d <printf>
+    exit();
+  66:	e8 a9 08 00 00       	call   914 <exit>
+  }
+
+  // anything else, e.g. a pipe, is copied through buf
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+    if (write(1, buf, n) != n) {
+  6b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  6e:	89 c2                	mov    %eax,%edx
+  70:	48 8d 05 49 10 00 00 	lea    0x1049(%rip),%rax        # 10c0 <buf>
+  77:	48 89 c6             	mov    %rax,%rsi
+  7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  7f:	e8 b0 08 00 00       	call   934 <write>
+  84:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+  87:	74 1e                	je     a7 <cat+0xa7>
+      printf(1, "cat: write error\n");
+  89:	48 8d 05 df 0c 00 00 	lea    0xcdf(%rip),%rax        # d6f <malloc+0x180>
+  90:	48 89 c6             	mov    %rax,%rsi
+  93:	bf 01 00 00 00       	mov    $0x1,%edi
+  98:	b8 00 00 00 00       	mov    $0x0,%eax
+  9d:	e8 cb 02 00 00       	call   36d <printf>
+      exit();
+  a2:	e8 6d 08 00 00       	call   914 <exit>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  aa:	ba 00 02 00 00       	mov    $0x200,%edx
+  af:	48 8d 0d 0a 10 00 00 	lea    0x100a(%rip),%rcx        # 10c0 <buf>
+  b6:	48 89 ce             	mov    %rcx,%rsi
+  b9:	89 c7                	mov    %eax,%edi
+  bb:	e8 6c 08 00 00       	call   92c <read>
+  c0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  c3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  c7:	7f a2                	jg     6b <cat+0x6b>
+    }
+  }
+  if(n < 0){
+  c9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  cd:	79 1f                	jns    ee <cat+0xee>
+    printf(1, "cat: read error\n");
+  cf:	48 8d 05 ab 0c 00 00 	lea    0xcab(%rip),%rax        # d81 <malloc+0x192>
+  d6:	48 89 c6             	mov    %rax,%rsi
+  d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  de:	b8 00 00 00 00       	mov    $0x0,%eax
+  e3:	e8 85 02 00 00       	call   36d <printf>
+    exit();
+  e8:	e8 27 08 00 00       	call   914 <exit>
+    return;
+  ed:	90                   	nop
+  }
+}
+  ee:	c9                   	leave
+  ef:	c3                   	ret
+
+00000000000000f0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f0:	55                   	push   %rbp
+  f1:	48 89 e5             	mov    %rsp,%rbp
+  f4:	48 83 ec 20          	sub    $0x20,%rsp
+  f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, i;
+
+  if(argc <= 1){
+  ff:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+ 103:	7f 0f                	jg     114 <main+0x24>
+    cat(0);
+ 105:	bf 00 00 00 00       	mov    $0x0,%edi
+ 10a:	e8 f1 fe ff ff       	call   0 <cat>
+    exit();
+ 10f:	e8 00 08 00 00       	call   914 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 114:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+ 11b:	eb 7d                	jmp    19a <main+0xaa>
+    if((fd = open(argv[i], 0)) < 0){
+ 11d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 120:	48 98                	cltq
+ 122:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 129:	00 
+ 12a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 12e:	48 01 d0             	add    %rdx,%rax
+ 131:	48 8b 00             	mov    (%rax),%rax
+ 134:	be 00 00 00 00       	mov    $0x0,%esi
+ 139:	48 89 c7             	mov    %rax,%rdi
+ 13c:	e8 13 08 00 00       	call   954 <open>
+ 141:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ 144:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 148:	79 38                	jns    182 <main+0x92>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+ 14a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 14d:	48 98                	cltq
+ 14f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 156:	00 
+ 157:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 15b:	48 01 d0             	add    %rdx,%rax
+ 15e:	48 8b 00             	mov    (%rax),%rax
+ 161:	48 89 c2             	mov    %rax,%rdx
+ 164:	48 8d 05 27 0c 00 00 	lea    0xc27(%rip),%rax        # d92 <malloc+0x1a3>
+ 16b:	48 89 c6             	mov    %rax,%rsi
+ 16e:	bf 01 00 00 00       	mov    $0x1,%edi
+ 173:	b8 00 00 00 00       	mov    $0x0,%eax
+ 178:	e8 f0 01 00 00       	call   36d <printf>
+      exit();
+ 17d:	e8 92 07 00 00       	call   914 <exit>
+    }
+    cat(fd);
+ 182:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 185:	89 c7                	mov    %eax,%edi
+ 187:	e8 74 fe ff ff       	call   0 <cat>
+    close(fd);
+ 18c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 18f:	89 c7                	mov    %eax,%edi
+ 191:	e8 a6 07 00 00       	call   93c <close>
+  for(i = 1; i < argc; i++){
+ 196:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 19a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 19d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ 1a0:	0f 8c 77 ff ff ff    	jl     11d <main+0x2d>
+  }
+  exit();
+ 1a6:	e8 69 07 00 00       	call   914 <exit>
+
+00000000000001ab <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+ 1ab:	55                   	push   %rbp
+ 1ac:	48 89 e5             	mov    %rsp,%rbp
+ 1af:	48 83 ec 10          	sub    $0x10,%rsp
+ 1b3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 1b6:	89 f0                	mov    %esi,%eax
+ 1b8:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 1bb:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 1bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1c2:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1c7:	48 89 ce             	mov    %rcx,%rsi
+ 1ca:	89 c7                	mov    %eax,%edi
+ 1cc:	e8 63 07 00 00       	call   934 <write>
+}
+ 1d1:	90                   	nop
+ 1d2:	c9                   	leave
+ 1d3:	c3                   	ret
+
+00000000000001d4 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+ 1d4:	55                   	push   %rbp
+ 1d5:	48 89 e5             	mov    %rsp,%rbp
+ 1d8:	48 83 ec 40          	sub    $0x40,%rsp
+ 1dc:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 1df:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 1e2:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 1e5:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+ 1e8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1ec:	74 1f                	je     20d <printint64+0x39>
+ 1ee:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 1f1:	c1 e8 1f             	shr    $0x1f,%eax
+ 1f4:	0f b6 c0             	movzbl %al,%eax
+ 1f7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 1fa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1fe:	74 0d                	je     20d <printint64+0x39>
+    x = -xx;
+ 200:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 203:	f7 d8                	neg    %eax
+ 205:	48 98                	cltq
+ 207:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 20b:	eb 09                	jmp    216 <printint64+0x42>
+  else
+    x = xx;
+ 20d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 210:	48 98                	cltq
+ 212:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 216:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 21d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 220:	48 63 c8             	movslq %eax,%rcx
+ 223:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 227:	ba 00 00 00 00       	mov    $0x0,%edx
+ 22c:	48 f7 f1             	div    %rcx
+ 22f:	48 89 d1             	mov    %rdx,%rcx
+ 232:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 235:	8d 50 01             	lea    0x1(%rax),%edx
+ 238:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 23b:	48 8d 15 ee 0d 00 00 	lea    0xdee(%rip),%rdx        # 1030 <digits.1>
+ 242:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 246:	48 98                	cltq
+ 248:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 24c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 24f:	48 63 f0             	movslq %eax,%rsi
+ 252:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 256:	ba 00 00 00 00       	mov    $0x0,%edx
+ 25b:	48 f7 f6             	div    %rsi
+ 25e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 262:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 267:	75 b4                	jne    21d <printint64+0x49>
+
+  if(sgn)
+ 269:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 26d:	74 2b                	je     29a <printint64+0xc6>
+    buf[i++] = '-';
+ 26f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 272:	8d 50 01             	lea    0x1(%rax),%edx
+ 275:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 278:	48 98                	cltq
+ 27a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 27f:	eb 19                	jmp    29a <printint64+0xc6>
+    putc(fd, buf[i]);
+ 281:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 284:	48 98                	cltq
+ 286:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 28b:	0f be d0             	movsbl %al,%edx
+ 28e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 291:	89 d6                	mov    %edx,%esi
+ 293:	89 c7                	mov    %eax,%edi
+ 295:	e8 11 ff ff ff       	call   1ab <putc>
+  while(--i >= 0)
+ 29a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 29e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2a2:	79 dd                	jns    281 <printint64+0xad>
+}
+ 2a4:	90                   	nop
+ 2a5:	90                   	nop
+ 2a6:	c9                   	leave
+ 2a7:	c3                   	ret
+
+00000000000002a8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2a8:	55                   	push   %rbp
+ 2a9:	48 89 e5             	mov    %rsp,%rbp
+ 2ac:	48 83 ec 30          	sub    $0x30,%rsp
+ 2b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 2b3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 2b6:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 2b9:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 2bc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 2c3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 2c7:	74 17                	je     2e0 <printint+0x38>
+ 2c9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 2cd:	79 11                	jns    2e0 <printint+0x38>
+    neg = 1;
+ 2cf:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 2d6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 2d9:	f7 d8                	neg    %eax
+ 2db:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 2de:	eb 06                	jmp    2e6 <printint+0x3e>
+  } else {
+    x = xx;
+ 2e0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 2e3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 2e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 2ed:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 2f0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 2f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2f8:	f7 f1                	div    %ecx
+ 2fa:	89 d1                	mov    %edx,%ecx
+ 2fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2ff:	8d 50 01             	lea    0x1(%rax),%edx
+ 302:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 305:	89 c9                	mov    %ecx,%ecx
+ 307:	48 8d 15 42 0d 00 00 	lea    0xd42(%rip),%rdx        # 1050 <digits.0>
+ 30e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 312:	48 98                	cltq
+ 314:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 318:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 31b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 31e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 323:	f7 f6                	div    %esi
+ 325:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 328:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 32c:	75 bf                	jne    2ed <printint+0x45>
+  if(neg)
+ 32e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 332:	74 2b                	je     35f <printint+0xb7>
+    buf[i++] = '-';
+ 334:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 337:	8d 50 01             	lea    0x1(%rax),%edx
+ 33a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 33d:	48 98                	cltq
+ 33f:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 344:	eb 19                	jmp    35f <printint+0xb7>
+    putc(fd, buf[i]);
+ 346:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 349:	48 98                	cltq
+ 34b:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 350:	0f be d0             	movsbl %al,%edx
+ 353:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 356:	89 d6                	mov    %edx,%esi
+ 358:	89 c7                	mov    %eax,%edi
+ 35a:	e8 4c fe ff ff       	call   1ab <putc>
+  while(--i >= 0)
+ 35f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 363:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 367:	79 dd                	jns    346 <printint+0x9e>
+}
+ 369:	90                   	nop
+ 36a:	90                   	nop
+ 36b:	c9                   	leave
+ 36c:	c3                   	ret
+
+000000000000036d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 36d:	55                   	push   %rbp
+ 36e:	48 89 e5             	mov    %rsp,%rbp
+ 371:	48 83 ec 70          	sub    $0x70,%rsp
+ 375:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 378:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 37c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 380:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 384:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 388:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 38c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 393:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 397:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 39b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 39f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 3a3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 3aa:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 3b1:	e9 6b 02 00 00       	jmp    621 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 3b6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 3b9:	48 63 d0             	movslq %eax,%rdx
+ 3bc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 3c0:	48 01 d0             	add    %rdx,%rax
+ 3c3:	0f b6 00             	movzbl (%rax),%eax
+ 3c6:	0f be c0             	movsbl %al,%eax
+ 3c9:	25 ff 00 00 00       	and    $0xff,%eax
+ 3ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 3d1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 3d5:	75 30                	jne    407 <printf+0x9a>
+      if(c == '%'){
+ 3d7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 3db:	75 13                	jne    3f0 <printf+0x83>
+        state = '%';
+ 3dd:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 3e4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 3eb:	e9 2d 02 00 00       	jmp    61d <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 3f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 3f3:	0f be d0             	movsbl %al,%edx
+ 3f6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3f9:	89 d6                	mov    %edx,%esi
+ 3fb:	89 c7                	mov    %eax,%edi
+ 3fd:	e8 a9 fd ff ff       	call   1ab <putc>
+ 402:	e9 16 02 00 00       	jmp    61d <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 407:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 40b:	0f 85 0c 02 00 00    	jne    61d <printf+0x2b0>
+      if(c == 'l') {
+ 411:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 415:	75 0c                	jne    423 <printf+0xb6>
+        lflag = 1;
+ 417:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 41e:	e9 fa 01 00 00       	jmp    61d <printf+0x2b0>
+      } else if(c == 'd'){
+ 423:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 427:	0f 85 95 00 00 00    	jne    4c2 <printf+0x155>
+        if (lflag == 1)
+ 42d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 431:	75 49                	jne    47c <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 433:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 436:	83 f8 2f             	cmp    $0x2f,%eax
+ 439:	77 17                	ja     452 <printf+0xe5>
+ 43b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 43f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 442:	89 d2                	mov    %edx,%edx
+ 444:	48 01 d0             	add    %rdx,%rax
+ 447:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 44a:	83 c2 08             	add    $0x8,%edx
+ 44d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 450:	eb 0c                	jmp    45e <printf+0xf1>
+ 452:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 456:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 45a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 45e:	48 8b 00             	mov    (%rax),%rax
+ 461:	89 c6                	mov    %eax,%esi
+ 463:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 466:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 46b:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 470:	89 c7                	mov    %eax,%edi
+ 472:	e8 5d fd ff ff       	call   1d4 <printint64>
+ 477:	e9 9a 01 00 00       	jmp    616 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 47c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 47f:	83 f8 2f             	cmp    $0x2f,%eax
+ 482:	77 17                	ja     49b <printf+0x12e>
+ 484:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 488:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 48b:	89 d2                	mov    %edx,%edx
+ 48d:	48 01 d0             	add    %rdx,%rax
+ 490:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 493:	83 c2 08             	add    $0x8,%edx
+ 496:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 499:	eb 0c                	jmp    4a7 <printf+0x13a>
+ 49b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 49f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4a3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4a7:	8b 30                	mov    (%rax),%esi
+ 4a9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4b1:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 4b6:	89 c7                	mov    %eax,%edi
+ 4b8:	e8 eb fd ff ff       	call   2a8 <printint>
+ 4bd:	e9 54 01 00 00       	jmp    616 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 4c2:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 4c6:	74 0a                	je     4d2 <printf+0x165>
+ 4c8:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 4cc:	0f 85 95 00 00 00    	jne    567 <printf+0x1fa>
+        if (lflag == 1)
+ 4d2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 4d6:	75 49                	jne    521 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 4d8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4db:	83 f8 2f             	cmp    $0x2f,%eax
+ 4de:	77 17                	ja     4f7 <printf+0x18a>
+ 4e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4e4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4e7:	89 d2                	mov    %edx,%edx
+ 4e9:	48 01 d0             	add    %rdx,%rax
+ 4ec:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4ef:	83 c2 08             	add    $0x8,%edx
+ 4f2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4f5:	eb 0c                	jmp    503 <printf+0x196>
+ 4f7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4fb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4ff:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 503:	48 8b 00             	mov    (%rax),%rax
+ 506:	89 c6                	mov    %eax,%esi
+ 508:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 50b:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 510:	ba 10 00 00 00       	mov    $0x10,%edx
+ 515:	89 c7                	mov    %eax,%edi
+ 517:	e8 b8 fc ff ff       	call   1d4 <printint64>
+        if (lflag == 1)
+ 51c:	e9 f5 00 00 00       	jmp    616 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 521:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 524:	83 f8 2f             	cmp    $0x2f,%eax
+ 527:	77 17                	ja     540 <printf+0x1d3>
+ 529:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 52d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 530:	89 d2                	mov    %edx,%edx
+ 532:	48 01 d0             	add    %rdx,%rax
+ 535:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 538:	83 c2 08             	add    $0x8,%edx
+ 53b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 53e:	eb 0c                	jmp    54c <printf+0x1df>
+ 540:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 544:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 548:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 54c:	8b 30                	mov    (%rax),%esi
+ 54e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 551:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 556:	ba 10 00 00 00       	mov    $0x10,%edx
+ 55b:	89 c7                	mov    %eax,%edi
+ 55d:	e8 46 fd ff ff       	call   2a8 <printint>
+        if (lflag == 1)
+ 562:	e9 af 00 00 00       	jmp    616 <printf+0x2a9>
+      } else if(c == 's'){
+ 567:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 56b:	75 6e                	jne    5db <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 56d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 570:	83 f8 2f             	cmp    $0x2f,%eax
+ 573:	77 17                	ja     58c <printf+0x21f>
+ 575:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 579:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 57c:	89 d2                	mov    %edx,%edx
+ 57e:	48 01 d0             	add    %rdx,%rax
+ 581:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 584:	83 c2 08             	add    $0x8,%edx
+ 587:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 58a:	eb 0c                	jmp    598 <printf+0x22b>
+ 58c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 590:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 594:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 598:	48 8b 00             	mov    (%rax),%rax
+ 59b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 59f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 5a4:	75 28                	jne    5ce <printf+0x261>
+          s = "(null)";
+ 5a6:	48 8d 05 fa 07 00 00 	lea    0x7fa(%rip),%rax        # da7 <malloc+0x1b8>
+ 5ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 5b1:	eb 1b                	jmp    5ce <printf+0x261>
+          putc(fd, *s);
+ 5b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 5b7:	0f b6 00             	movzbl (%rax),%eax
+ 5ba:	0f be d0             	movsbl %al,%edx
+ 5bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5c0:	89 d6                	mov    %edx,%esi
+ 5c2:	89 c7                	mov    %eax,%edi
+ 5c4:	e8 e2 fb ff ff       	call   1ab <putc>
+        for(; *s; s++)
+ 5c9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 5ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 5d2:	0f b6 00             	movzbl (%rax),%eax
+ 5d5:	84 c0                	test   %al,%al
+ 5d7:	75 da                	jne    5b3 <printf+0x246>
+ 5d9:	eb 3b                	jmp    616 <printf+0x2a9>
+      } else if(c == '%'){
+ 5db:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 5df:	75 14                	jne    5f5 <printf+0x288>
+        putc(fd, c);
+ 5e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 5e4:	0f be d0             	movsbl %al,%edx
+ 5e7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5ea:	89 d6                	mov    %edx,%esi
+ 5ec:	89 c7                	mov    %eax,%edi
+ 5ee:	e8 b8 fb ff ff       	call   1ab <putc>
+ 5f3:	eb 21                	jmp    616 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5f5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 5f8:	be 25 00 00 00       	mov    $0x25,%esi
+ 5fd:	89 c7                	mov    %eax,%edi
+ 5ff:	e8 a7 fb ff ff       	call   1ab <putc>
+        putc(fd, c);
+ 604:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 607:	0f be d0             	movsbl %al,%edx
+ 60a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 60d:	89 d6                	mov    %edx,%esi
+ 60f:	89 c7                	mov    %eax,%edi
+ 611:	e8 95 fb ff ff       	call   1ab <putc>
+      }
+      state = 0;
+ 616:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 61d:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 621:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 624:	48 63 d0             	movslq %eax,%rdx
+ 627:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 62b:	48 01 d0             	add    %rdx,%rax
+ 62e:	0f b6 00             	movzbl (%rax),%eax
+ 631:	84 c0                	test   %al,%al
+ 633:	0f 85 7d fd ff ff    	jne    3b6 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 639:	90                   	nop
+ 63a:	90                   	nop
+ 63b:	c9                   	leave
+ 63c:	c3                   	ret
+
+000000000000063d <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 63d:	55                   	push   %rbp
+ 63e:	48 89 e5             	mov    %rsp,%rbp
+ 641:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 645:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 648:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 64b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 64f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 652:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 655:	48 89 ce             	mov    %rcx,%rsi
+ 658:	48 89 f7             	mov    %rsi,%rdi
+ 65b:	89 d1                	mov    %edx,%ecx
+ 65d:	fc                   	cld
+ 65e:	f3 aa                	rep stos %al,%es:(%rdi)
+ 660:	89 ca                	mov    %ecx,%edx
+ 662:	48 89 fe             	mov    %rdi,%rsi
+ 665:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 669:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 66c:	90                   	nop
+ 66d:	5d                   	pop    %rbp
+ 66e:	c3                   	ret
+
+000000000000066f <strcpy>:
+{
+ 66f:	55                   	push   %rbp
+ 670:	48 89 e5             	mov    %rsp,%rbp
+ 673:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 677:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 67b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 67f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 683:	90                   	nop
+ 684:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 688:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 68c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 690:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 694:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 698:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 69c:	0f b6 12             	movzbl (%rdx),%edx
+ 69f:	88 10                	mov    %dl,(%rax)
+ 6a1:	0f b6 00             	movzbl (%rax),%eax
+ 6a4:	84 c0                	test   %al,%al
+ 6a6:	75 dc                	jne    684 <strcpy+0x15>
+  return os;
+ 6a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6ac:	5d                   	pop    %rbp
+ 6ad:	c3                   	ret
+
+00000000000006ae <strcmp>:
+{
+ 6ae:	55                   	push   %rbp
+ 6af:	48 89 e5             	mov    %rsp,%rbp
+ 6b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 6ba:	eb 0a                	jmp    6c6 <strcmp+0x18>
+    p++, q++;
+ 6bc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 6c1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 6c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6ca:	0f b6 00             	movzbl (%rax),%eax
+ 6cd:	84 c0                	test   %al,%al
+ 6cf:	74 12                	je     6e3 <strcmp+0x35>
+ 6d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6d5:	0f b6 10             	movzbl (%rax),%edx
+ 6d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 6dc:	0f b6 00             	movzbl (%rax),%eax
+ 6df:	38 c2                	cmp    %al,%dl
+ 6e1:	74 d9                	je     6bc <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 6e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6e7:	0f b6 00             	movzbl (%rax),%eax
+ 6ea:	0f b6 d0             	movzbl %al,%edx
+ 6ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 6f1:	0f b6 00             	movzbl (%rax),%eax
+ 6f4:	0f b6 c0             	movzbl %al,%eax
+ 6f7:	29 c2                	sub    %eax,%edx
+ 6f9:	89 d0                	mov    %edx,%eax
+}
+ 6fb:	5d                   	pop    %rbp
+ 6fc:	c3                   	ret
+
+00000000000006fd <strlen>:
+{
+ 6fd:	55                   	push   %rbp
+ 6fe:	48 89 e5             	mov    %rsp,%rbp
+ 701:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 705:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 70c:	eb 04                	jmp    712 <strlen+0x15>
+ 70e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 712:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 715:	48 63 d0             	movslq %eax,%rdx
+ 718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 71c:	48 01 d0             	add    %rdx,%rax
+ 71f:	0f b6 00             	movzbl (%rax),%eax
+ 722:	84 c0                	test   %al,%al
+ 724:	75 e8                	jne    70e <strlen+0x11>
+  return n;
+ 726:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 729:	5d                   	pop    %rbp
+ 72a:	c3                   	ret
+
+000000000000072b <memset>:
+{
+ 72b:	55                   	push   %rbp
+ 72c:	48 89 e5             	mov    %rsp,%rbp
+ 72f:	48 83 ec 10          	sub    $0x10,%rsp
+ 733:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 737:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 73a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 73d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 740:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 747:	89 ce                	mov    %ecx,%esi
+ 749:	48 89 c7             	mov    %rax,%rdi
+ 74c:	e8 ec fe ff ff       	call   63d <stosb>
+  return dst;
+ 751:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 755:	c9                   	leave
+ 756:	c3                   	ret
+
+0000000000000757 <strchr>:
+{
+ 757:	55                   	push   %rbp
+ 758:	48 89 e5             	mov    %rsp,%rbp
+ 75b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 75f:	89 f0                	mov    %esi,%eax
+ 761:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 764:	eb 17                	jmp    77d <strchr+0x26>
+    if(*s == c)
+ 766:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 76a:	0f b6 00             	movzbl (%rax),%eax
+ 76d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 770:	75 06                	jne    778 <strchr+0x21>
+      return (char*)s;
+ 772:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 776:	eb 15                	jmp    78d <strchr+0x36>
+  for(; *s; s++)
+ 778:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 77d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 781:	0f b6 00             	movzbl (%rax),%eax
+ 784:	84 c0                	test   %al,%al
+ 786:	75 de                	jne    766 <strchr+0xf>
+  return 0;
+ 788:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 78d:	5d                   	pop    %rbp
+ 78e:	c3                   	ret
+
+000000000000078f <gets>:
+gets(char *buf, int max)
+{
+ 78f:	55                   	push   %rbp
+ 790:	48 89 e5             	mov    %rsp,%rbp
+ 793:	48 83 ec 20          	sub    $0x20,%rsp
+ 797:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 79b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 79e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 7a5:	eb 48                	jmp    7ef <gets+0x60>
+    cc = read(0, &c, 1);
+ 7a7:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 7ab:	ba 01 00 00 00       	mov    $0x1,%edx
+ 7b0:	48 89 c6             	mov    %rax,%rsi
+ 7b3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7b8:	e8 6f 01 00 00       	call   92c <read>
+ 7bd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 7c0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 7c4:	7e 36                	jle    7fc <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 7c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7c9:	8d 50 01             	lea    0x1(%rax),%edx
+ 7cc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 7cf:	48 63 d0             	movslq %eax,%rdx
+ 7d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7d6:	48 01 c2             	add    %rax,%rdx
+ 7d9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 7dd:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 7df:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 7e3:	3c 0a                	cmp    $0xa,%al
+ 7e5:	74 16                	je     7fd <gets+0x6e>
+ 7e7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 7eb:	3c 0d                	cmp    $0xd,%al
+ 7ed:	74 0e                	je     7fd <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 7ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7f2:	83 c0 01             	add    $0x1,%eax
+ 7f5:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 7f8:	7f ad                	jg     7a7 <gets+0x18>
+ 7fa:	eb 01                	jmp    7fd <gets+0x6e>
+      break;
+ 7fc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 7fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 800:	48 63 d0             	movslq %eax,%rdx
+ 803:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 807:	48 01 d0             	add    %rdx,%rax
+ 80a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 80d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 811:	c9                   	leave
+ 812:	c3                   	ret
+
+0000000000000813 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 813:	55                   	push   %rbp
+ 814:	48 89 e5             	mov    %rsp,%rbp
+ 817:	48 83 ec 20          	sub    $0x20,%rsp
+ 81b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 81f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 827:	be 00 00 00 00       	mov    $0x0,%esi
+ 82c:	48 89 c7             	mov    %rax,%rdi
+ 82f:	e8 20 01 00 00       	call   954 <open>
+ 834:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 837:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 83b:	79 07                	jns    844 <stat+0x31>
+    return -1;
+ 83d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 842:	eb 21                	jmp    865 <stat+0x52>
+  r = fstat(fd, st);
+ 844:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 848:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 84b:	48 89 d6             	mov    %rdx,%rsi
+ 84e:	89 c7                	mov    %eax,%edi
+ 850:	e8 17 01 00 00       	call   96c <fstat>
+ 855:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 858:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 85b:	89 c7                	mov    %eax,%edi
+ 85d:	e8 da 00 00 00       	call   93c <close>
+  return r;
+ 862:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 865:	c9                   	leave
+ 866:	c3                   	ret
+
+0000000000000867 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 867:	55                   	push   %rbp
+ 868:	48 89 e5             	mov    %rsp,%rbp
+ 86b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 86f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 876:	eb 28                	jmp    8a0 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 878:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 87b:	89 d0                	mov    %edx,%eax
+ 87d:	c1 e0 02             	shl    $0x2,%eax
+ 880:	01 d0                	add    %edx,%eax
+ 882:	01 c0                	add    %eax,%eax
+ 884:	89 c1                	mov    %eax,%ecx
+ 886:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 88a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 88e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 892:	0f b6 00             	movzbl (%rax),%eax
+ 895:	0f be c0             	movsbl %al,%eax
+ 898:	01 c8                	add    %ecx,%eax
+ 89a:	83 e8 30             	sub    $0x30,%eax
+ 89d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 8a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8a4:	0f b6 00             	movzbl (%rax),%eax
+ 8a7:	3c 2f                	cmp    $0x2f,%al
+ 8a9:	7e 0b                	jle    8b6 <atoi+0x4f>
+ 8ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8af:	0f b6 00             	movzbl (%rax),%eax
+ 8b2:	3c 39                	cmp    $0x39,%al
+ 8b4:	7e c2                	jle    878 <atoi+0x11>
+  return n;
+ 8b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 8b9:	5d                   	pop    %rbp
+ 8ba:	c3                   	ret
+
+00000000000008bb <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 8bb:	55                   	push   %rbp
+ 8bc:	48 89 e5             	mov    %rsp,%rbp
+ 8bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 8c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 8c7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 8ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 8d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 8d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 8da:	eb 1d                	jmp    8f9 <memmove+0x3e>
+    *dst++ = *src++;
+ 8dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 8e0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 8e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 8e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 8f0:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 8f4:	0f b6 12             	movzbl (%rdx),%edx
+ 8f7:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 8f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 8fc:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 8ff:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 902:	85 c0                	test   %eax,%eax
+ 904:	7f d6                	jg     8dc <memmove+0x21>
+  return vdst;
+ 906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 90a:	5d                   	pop    %rbp
+ 90b:	c3                   	ret
+
+000000000000090c <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 90c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 911:	cd 40                	int    $0x40
+ 913:	c3                   	ret
+
+0000000000000914 <exit>:
+SYSCALL(exit)
+ 914:	b8 02 00 00 00       	mov    $0x2,%eax
+ 919:	cd 40                	int    $0x40
+ 91b:	c3                   	ret
+
+000000000000091c <wait>:
+SYSCALL(wait)
+ 91c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 921:	cd 40                	int    $0x40
+ 923:	c3                   	ret
+
+0000000000000924 <pipe>:
+SYSCALL(pipe)
+ 924:	b8 04 00 00 00       	mov    $0x4,%eax
+ 929:	cd 40                	int    $0x40
+ 92b:	c3                   	ret
+
+000000000000092c <read>:
+SYSCALL(read)
+ 92c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 931:	cd 40                	int    $0x40
+ 933:	c3                   	ret
+
+0000000000000934 <write>:
+SYSCALL(write)
+ 934:	b8 10 00 00 00       	mov    $0x10,%eax
+ 939:	cd 40                	int    $0x40
+ 93b:	c3                   	ret
+
+000000000000093c <close>:
+SYSCALL(close)
+ 93c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 941:	cd 40                	int    $0x40
+ 943:	c3                   	ret
+
+0000000000000944 <kill>:
+SYSCALL(kill)
+ 944:	b8 06 00 00 00       	mov    $0x6,%eax
+ 949:	cd 40                	int    $0x40
+ 94b:	c3                   	ret
+
+000000000000094c <exec>:
+SYSCALL(exec)
+ 94c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 951:	cd 40                	int    $0x40
+ 953:	c3                   	ret
+
+0000000000000954 <open>:
+SYSCALL(open)
+ 954:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 959:	cd 40                	int    $0x40
+ 95b:	c3                   	ret
+
+000000000000095c <mknod>:
+SYSCALL(mknod)
+ 95c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 961:	cd 40                	int    $0x40
+ 963:	c3                   	ret
+
+0000000000000964 <unlink>:
+SYSCALL(unlink)
+ 964:	b8 12 00 00 00       	mov    $0x12,%eax
+ 969:	cd 40                	int    $0x40
+ 96b:	c3                   	ret
+
+000000000000096c <fstat>:
+SYSCALL(fstat)
+ 96c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 971:	cd 40                	int    $0x40
+ 973:	c3                   	ret
+
+0000000000000974 <link>:
+SYSCALL(link)
+ 974:	b8 13 00 00 00       	mov    $0x13,%eax
+ 979:	cd 40                	int    $0x40
+ 97b:	c3                   	ret
+
+000000000000097c <mkdir>:
+SYSCALL(mkdir)
+ 97c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 981:	cd 40                	int    $0x40
+ 983:	c3                   	ret
+
+0000000000000984 <chdir>:
+SYSCALL(chdir)
+ 984:	b8 09 00 00 00       	mov    $0x9,%eax
+ 989:	cd 40                	int    $0x40
+ 98b:	c3                   	ret
+
+000000000000098c <dup>:
+SYSCALL(dup)
+ 98c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 991:	cd 40                	int    $0x40
+ 993:	c3                   	ret
+
+0000000000000994 <getpid>:
+SYSCALL(getpid)
+ 994:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 999:	cd 40                	int    $0x40
+ 99b:	c3                   	ret
+
+000000000000099c <sbrk>:
+SYSCALL(sbrk)
+ 99c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9a1:	cd 40                	int    $0x40
+ 9a3:	c3                   	ret
+
+00000000000009a4 <sleep>:
+SYSCALL(sleep)
+ 9a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9a9:	cd 40                	int    $0x40
+ 9ab:	c3                   	ret
+
+00000000000009ac <uptime>:
+SYSCALL(uptime)
+ 9ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9b1:	cd 40                	int    $0x40
+ 9b3:	c3                   	ret
+
+00000000000009b4 <sysinfo>:
+SYSCALL(sysinfo)
+ 9b4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9b9:	cd 40                	int    $0x40
+ 9bb:	c3                   	ret
+
+00000000000009bc <mmap>:
+SYSCALL(mmap)
+ 9bc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9c1:	cd 40                	int    $0x40
+ 9c3:	c3                   	ret
+
+00000000000009c4 <munmap>:
+SYSCALL(munmap)
+ 9c4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9c9:	cd 40                	int    $0x40
+ 9cb:	c3                   	ret
+
+00000000000009cc <crashn>:
+SYSCALL(crashn)
+ 9cc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9d1:	cd 40                	int    $0x40
+ 9d3:	c3                   	ret
+
+00000000000009d4 <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 9d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9d9:	cd 40                	int    $0x40
+ 9db:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9de:	74 02                	je     9e2 <mmap2+0xe>
+ 9e0:	89 c0                	mov    %eax,%eax
+ 9e2:	c3                   	ret
+
+00000000000009e3 <munmap2>:
+SYSCALL(munmap2)
+ 9e3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9e8:	cd 40                	int    $0x40
+ 9ea:	c3                   	ret
+
+00000000000009eb <msync>:
+SYSCALL(msync)
+ 9eb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 9f0:	cd 40                	int    $0x40
+ 9f2:	c3                   	ret
+
+00000000000009f3 <sendfile>:
+SYSCALL(sendfile)
+ 9f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9f8:	cd 40                	int    $0x40
+ 9fa:	c3                   	ret
+
+00000000000009fb <splice>:
+SYSCALL(splice)
+ 9fb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a00:	cd 40                	int    $0x40
+ a02:	c3                   	ret
+
+0000000000000a03 <pread>:
+SYSCALL(pread)
+ a03:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a08:	cd 40                	int    $0x40
+ a0a:	c3                   	ret
+
+0000000000000a0b <pwrite>:
+SYSCALL(pwrite)
+ a0b:	b8 20 00 00 00       	mov    $0x20,%eax
+ a10:	cd 40                	int    $0x40
+ a12:	c3                   	ret
+
+0000000000000a13 <readv>:
+SYSCALL(readv)
+ a13:	b8 21 00 00 00       	mov    $0x21,%eax
+ a18:	cd 40                	int    $0x40
+ a1a:	c3                   	ret
+
+0000000000000a1b <writev>:
+SYSCALL(writev)
+ a1b:	b8 22 00 00 00       	mov    $0x22,%eax
+ a20:	cd 40                	int    $0x40
+ a22:	c3                   	ret
+
+0000000000000a23 <poll>:
+SYSCALL(poll)
+ a23:	b8 23 00 00 00       	mov    $0x23,%eax
+ a28:	cd 40                	int    $0x40
+ a2a:	c3                   	ret
+
+0000000000000a2b <pipe2>:
+SYSCALL(pipe2)
+ a2b:	b8 24 00 00 00       	mov    $0x24,%eax
+ a30:	cd 40                	int    $0x40
+ a32:	c3                   	ret
+
+0000000000000a33 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ a33:	55                   	push   %rbp
+ a34:	48 89 e5             	mov    %rsp,%rbp
+ a37:	48 83 ec 20          	sub    $0x20,%rsp
+ a3b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a43:	48 83 e8 10          	sub    $0x10,%rax
+ a47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a4f:	48 8b 10             	mov    (%rax),%rdx
+ a52:	48 8d 05 47 06 00 00 	lea    0x647(%rip),%rax        # 10a0 <bigblock>
+ a59:	48 39 c2             	cmp    %rax,%rdx
+ a5c:	75 1f                	jne    a7d <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ a5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a62:	8b 40 08             	mov    0x8(%rax),%eax
+ a65:	c1 e0 04             	shl    $0x4,%eax
+ a68:	89 c2                	mov    %eax,%edx
+ a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a6e:	89 d6                	mov    %edx,%esi
+ a70:	48 89 c7             	mov    %rax,%rdi
+ a73:	e8 6b ff ff ff       	call   9e3 <munmap2>
+    return;
+ a78:	e9 0b 01 00 00       	jmp    b88 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7d:	48 8b 05 0c 06 00 00 	mov    0x60c(%rip),%rax        # 1090 <freep>
+ a84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ a88:	eb 2f                	jmp    ab9 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a8e:	48 8b 00             	mov    (%rax),%rax
+ a91:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a95:	72 17                	jb     aae <free+0x7b>
+ a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a9b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a9f:	72 2f                	jb     ad0 <free+0x9d>
+ aa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aa5:	48 8b 00             	mov    (%rax),%rax
+ aa8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ aac:	72 22                	jb     ad0 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab2:	48 8b 00             	mov    (%rax),%rax
+ ab5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ abd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ ac1:	73 c7                	jae    a8a <free+0x57>
+ ac3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac7:	48 8b 00             	mov    (%rax),%rax
+ aca:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ ace:	73 ba                	jae    a8a <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ad4:	8b 40 08             	mov    0x8(%rax),%eax
+ ad7:	89 c0                	mov    %eax,%eax
+ ad9:	48 c1 e0 04          	shl    $0x4,%rax
+ add:	48 89 c2             	mov    %rax,%rdx
+ ae0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae4:	48 01 c2             	add    %rax,%rdx
+ ae7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aeb:	48 8b 00             	mov    (%rax),%rax
+ aee:	48 39 c2             	cmp    %rax,%rdx
+ af1:	75 2d                	jne    b20 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ af3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ af7:	8b 50 08             	mov    0x8(%rax),%edx
+ afa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ afe:	48 8b 00             	mov    (%rax),%rax
+ b01:	8b 40 08             	mov    0x8(%rax),%eax
+ b04:	01 c2                	add    %eax,%edx
+ b06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b0a:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b11:	48 8b 00             	mov    (%rax),%rax
+ b14:	48 8b 10             	mov    (%rax),%rdx
+ b17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b1b:	48 89 10             	mov    %rdx,(%rax)
+ b1e:	eb 0e                	jmp    b2e <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b24:	48 8b 10             	mov    (%rax),%rdx
+ b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b2b:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ b2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b32:	8b 40 08             	mov    0x8(%rax),%eax
+ b35:	89 c0                	mov    %eax,%eax
+ b37:	48 c1 e0 04          	shl    $0x4,%rax
+ b3b:	48 89 c2             	mov    %rax,%rdx
+ b3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b42:	48 01 d0             	add    %rdx,%rax
+ b45:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ b49:	75 27                	jne    b72 <free+0x13f>
+    p->s.size += bp->s.size;
+ b4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4f:	8b 50 08             	mov    0x8(%rax),%edx
+ b52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b56:	8b 40 08             	mov    0x8(%rax),%eax
+ b59:	01 c2                	add    %eax,%edx
+ b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b5f:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ b62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b66:	48 8b 10             	mov    (%rax),%rdx
+ b69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b6d:	48 89 10             	mov    %rdx,(%rax)
+ b70:	eb 0b                	jmp    b7d <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ b72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ b7a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b81:	48 89 05 08 05 00 00 	mov    %rax,0x508(%rip)        # 1090 <freep>
+}
+ b88:	c9                   	leave
+ b89:	c3                   	ret
+
+0000000000000b8a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b8a:	55                   	push   %rbp
+ b8b:	48 89 e5             	mov    %rsp,%rbp
+ b8e:	48 83 ec 20          	sub    $0x20,%rsp
+ b92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b95:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ b9c:	77 07                	ja     ba5 <morecore+0x1b>
+    nu = 4096;
+ b9e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ ba5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ba8:	c1 e0 04             	shl    $0x4,%eax
+ bab:	89 c7                	mov    %eax,%edi
+ bad:	e8 ea fd ff ff       	call   99c <sbrk>
+ bb2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ bb6:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ bbb:	75 07                	jne    bc4 <morecore+0x3a>
+    return 0;
+ bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+ bc2:	eb 29                	jmp    bed <morecore+0x63>
+  hp = (Header*)p;
+ bc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ bcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bd0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bd3:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ bd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bda:	48 83 c0 10          	add    $0x10,%rax
+ bde:	48 89 c7             	mov    %rax,%rdi
+ be1:	e8 4d fe ff ff       	call   a33 <free>
+  return freep;
+ be6:	48 8b 05 a3 04 00 00 	mov    0x4a3(%rip),%rax        # 1090 <freep>
+}
+ bed:	c9                   	leave
+ bee:	c3                   	ret
+
+0000000000000bef <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bef:	55                   	push   %rbp
+ bf0:	48 89 e5             	mov    %rsp,%rbp
+ bf3:	48 83 ec 30          	sub    $0x30,%rsp
+ bf7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ bfd:	48 83 c0 0f          	add    $0xf,%rax
+ c01:	48 c1 e8 04          	shr    $0x4,%rax
+ c05:	83 c0 01             	add    $0x1,%eax
+ c08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ c0b:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ c12:	76 62                	jbe    c76 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ c14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c17:	c1 e0 04             	shl    $0x4,%eax
+ c1a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ c20:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ c26:	b9 22 00 00 00       	mov    $0x22,%ecx
+ c2b:	ba 03 00 00 00       	mov    $0x3,%edx
+ c30:	89 c6                	mov    %eax,%esi
+ c32:	bf 00 00 00 00       	mov    $0x0,%edi
+ c37:	e8 98 fd ff ff       	call   9d4 <mmap2>
+ c3c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ c40:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ c45:	75 0a                	jne    c51 <malloc+0x62>
+      return 0;
+ c47:	b8 00 00 00 00       	mov    $0x0,%eax
+ c4c:	e9 1c 01 00 00       	jmp    d6d <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ c51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c55:	48 8d 15 44 04 00 00 	lea    0x444(%rip),%rdx        # 10a0 <bigblock>
+ c5c:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ c5f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c63:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c66:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ c69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c6d:	48 83 c0 10          	add    $0x10,%rax
+ c71:	e9 f7 00 00 00       	jmp    d6d <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ c76:	48 8b 05 13 04 00 00 	mov    0x413(%rip),%rax        # 1090 <freep>
+ c7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c81:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ c86:	75 2e                	jne    cb6 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ c88:	48 8d 05 f1 03 00 00 	lea    0x3f1(%rip),%rax        # 1080 <base>
+ c8f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c97:	48 89 05 f2 03 00 00 	mov    %rax,0x3f2(%rip)        # 1090 <freep>
+ c9e:	48 8b 05 eb 03 00 00 	mov    0x3eb(%rip),%rax        # 1090 <freep>
+ ca5:	48 89 05 d4 03 00 00 	mov    %rax,0x3d4(%rip)        # 1080 <base>
+    base.s.size = 0;
+ cac:	c7 05 d2 03 00 00 00 	movl   $0x0,0x3d2(%rip)        # 1088 <base+0x8>
+ cb3:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cba:	48 8b 00             	mov    (%rax),%rax
+ cbd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ cc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc5:	8b 40 08             	mov    0x8(%rax),%eax
+ cc8:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ ccb:	72 5f                	jb     d2c <malloc+0x13d>
+      if(p->s.size == nunits)
+ ccd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cd1:	8b 40 08             	mov    0x8(%rax),%eax
+ cd4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ cd7:	75 10                	jne    ce9 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cdd:	48 8b 10             	mov    (%rax),%rdx
+ ce0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ce4:	48 89 10             	mov    %rdx,(%rax)
+ ce7:	eb 2e                	jmp    d17 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ced:	8b 40 08             	mov    0x8(%rax),%eax
+ cf0:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ cf3:	89 c2                	mov    %eax,%edx
+ cf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cf9:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ cfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d00:	8b 40 08             	mov    0x8(%rax),%eax
+ d03:	89 c0                	mov    %eax,%eax
+ d05:	48 c1 e0 04          	shl    $0x4,%rax
+ d09:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d11:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ d14:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ d17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d1b:	48 89 05 6e 03 00 00 	mov    %rax,0x36e(%rip)        # 1090 <freep>
+      return (void*)(p + 1);
+ d22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d26:	48 83 c0 10          	add    $0x10,%rax
+ d2a:	eb 41                	jmp    d6d <malloc+0x17e>
+    }
+    if(p == freep)
+ d2c:	48 8b 05 5d 03 00 00 	mov    0x35d(%rip),%rax        # 1090 <freep>
+ d33:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ d37:	75 1c                	jne    d55 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ d39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ d3c:	89 c7                	mov    %eax,%edi
+ d3e:	e8 47 fe ff ff       	call   b8a <morecore>
+ d43:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ d47:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ d4c:	75 07                	jne    d55 <malloc+0x166>
+        return 0;
+ d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+ d53:	eb 18                	jmp    d6d <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d59:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ d5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d61:	48 8b 00             	mov    (%rax),%rax
+ d64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ d68:	e9 54 ff ff ff       	jmp    cc1 <malloc+0xd2>
+  }
+}
+ d6d:	c9                   	leave
+ d6e:	c3                   	ret
@@ -0,0 +1,2531 @@
+
+out/user/_fdtest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <growtest>:
+
+// The table grows past NOFILE, handing out the lowest free fd each
+// time, and every fd is a file of its own.
+void
+growtest(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+  char c;
+
+  printf(stdout, "growtest\n");
+       8:	8b 05 92 21 00 00    	mov    0x2192(%rip),%eax        # 21a0 <stdout>
+       e:	48 8d 15 9b 1b 00 00 	lea    0x1b9b(%rip),%rdx        # 1bb0 <malloc+0x180>
+      15:	48 89 d6             	mov    %rdx,%rsi
+      18:	89 c7                	mov    %eax,%edi
+      1a:	b8 00 00 00 00       	mov    $0x0,%eax
+      1f:	e8 8a 11 00 00       	call   11ae <printf>
+  if((fd = open("fd1.txt", O_CREATE | O_RDWR)) < 0)
+      24:	be 02 02 00 00       	mov    $0x202,%esi
+      29:	48 8d 05 8a 1b 00 00 	lea    0x1b8a(%rip),%rax        # 1bba <malloc+0x18a>
+      30:	48 89 c7             	mov    %rax,%rdi
+      33:	e8 5d 17 00 00       	call   1795 <open>
+      38:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      3b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      3f:	79 5c                	jns    9d <growtest+0x9d>
+    error("unable to create fd1.txt");
+      41:	8b 05 59 21 00 00    	mov    0x2159(%rip),%eax        # 21a0 <stdout>
+      47:	ba 21 00 00 00       	mov    $0x21,%edx
+      4c:	48 8d 0d 6f 1b 00 00 	lea    0x1b6f(%rip),%rcx        # 1bc2 <malloc+0x192>
+      53:	48 89 ce             	mov    %rcx,%rsi
+      56:	89 c7                	mov    %eax,%edi
+      58:	b8 00 00 00 00       	mov    $0x0,%eax
+      5d:	e8 4c 11 00 00       	call   11ae <printf>
+      62:	8b 05 38 21 00 00    	mov    0x2138(%rip),%eax        # 21a0 <stdout>
+      68:	48 8d 15 65 1b 00 00 	lea    0x1b65(%rip),%rdx        # 1bd4 <malloc+0x1a4>
+      6f:	48 89 d6             	mov    %rdx,%rsi
+      72:	89 c7                	mov    %eax,%edi
+      74:	b8 00 00 00 00       	mov    $0x0,%eax
+      79:	e8 30 11 00 00       	call   11ae <printf>
+      7e:	8b 05 1c 21 00 00    	mov    0x211c(%rip),%eax        # 21a0 <stdout>
+      84:	48 8d 15 62 1b 00 00 	lea    0x1b62(%rip),%rdx        # 1bed <malloc+0x1bd>
+      8b:	48 89 d6             	mov    %rdx,%rsi
+      8e:	89 c7                	mov    %eax,%edi
+      90:	b8 00 00 00 00       	mov    $0x0,%eax
+      95:	e8 14 11 00 00       	call   11ae <printf>
+      9a:	90                   	nop
+      9b:	eb fd                	jmp    9a <growtest+0x9a>
+  if(write(fd, "0123456789", 10) != 10)
+      9d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      a0:	ba 0a 00 00 00       	mov    $0xa,%edx
+      a5:	48 8d 0d 43 1b 00 00 	lea    0x1b43(%rip),%rcx        # 1bef <malloc+0x1bf>
+      ac:	48 89 ce             	mov    %rcx,%rsi
+      af:	89 c7                	mov    %eax,%edi
+      b1:	e8 bf 16 00 00       	call   1775 <write>
+      b6:	83 f8 0a             	cmp    $0xa,%eax
+      b9:	74 5c                	je     117 <growtest+0x117>
+    error("unable to write fd1.txt");
+      bb:	8b 05 df 20 00 00    	mov    0x20df(%rip),%eax        # 21a0 <stdout>
+      c1:	ba 23 00 00 00       	mov    $0x23,%edx
+      c6:	48 8d 0d f5 1a 00 00 	lea    0x1af5(%rip),%rcx        # 1bc2 <malloc+0x192>
+      cd:	48 89 ce             	mov    %rcx,%rsi
+      d0:	89 c7                	mov    %eax,%edi
+      d2:	b8 00 00 00 00       	mov    $0x0,%eax
+      d7:	e8 d2 10 00 00       	call   11ae <printf>
+      dc:	8b 05 be 20 00 00    	mov    0x20be(%rip),%eax        # 21a0 <stdout>
+      e2:	48 8d 15 11 1b 00 00 	lea    0x1b11(%rip),%rdx        # 1bfa <malloc+0x1ca>
+      e9:	48 89 d6             	mov    %rdx,%rsi
+      ec:	89 c7                	mov    %eax,%edi
+      ee:	b8 00 00 00 00       	mov    $0x0,%eax
+      f3:	e8 b6 10 00 00       	call   11ae <printf>
+      f8:	8b 05 a2 20 00 00    	mov    0x20a2(%rip),%eax        # 21a0 <stdout>
+      fe:	48 8d 15 e8 1a 00 00 	lea    0x1ae8(%rip),%rdx        # 1bed <malloc+0x1bd>
+     105:	48 89 d6             	mov    %rdx,%rsi
+     108:	89 c7                	mov    %eax,%edi
+     10a:	b8 00 00 00 00       	mov    $0x0,%eax
+     10f:	e8 9a 10 00 00       	call   11ae <printf>
+     114:	90                   	nop
+     115:	eb fd                	jmp    114 <growtest+0x114>
+  close(fd);
+     117:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     11a:	89 c7                	mov    %eax,%edi
+     11c:	e8 5c 16 00 00       	call   177d <close>
+
+  for(i = 0; i < NFD; i++){
+     121:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     128:	e9 80 01 00 00       	jmp    2ad <growtest+0x2ad>
+    if((fds[i] = open("fd1.txt", O_RDONLY)) < 0)
+     12d:	be 00 00 00 00       	mov    $0x0,%esi
+     132:	48 8d 05 81 1a 00 00 	lea    0x1a81(%rip),%rax        # 1bba <malloc+0x18a>
+     139:	48 89 c7             	mov    %rax,%rdi
+     13c:	e8 54 16 00 00       	call   1795 <open>
+     141:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     144:	48 63 d2             	movslq %edx,%rdx
+     147:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+     14e:	00 
+     14f:	48 8d 15 ea 20 00 00 	lea    0x20ea(%rip),%rdx        # 2240 <fds>
+     156:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+     159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     15c:	48 98                	cltq
+     15e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     165:	00 
+     166:	48 8d 05 d3 20 00 00 	lea    0x20d3(%rip),%rax        # 2240 <fds>
+     16d:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     170:	85 c0                	test   %eax,%eax
+     172:	79 5f                	jns    1d3 <growtest+0x1d3>
+      error("open %d failed", i);
+     174:	8b 05 26 20 00 00    	mov    0x2026(%rip),%eax        # 21a0 <stdout>
+     17a:	ba 28 00 00 00       	mov    $0x28,%edx
+     17f:	48 8d 0d 3c 1a 00 00 	lea    0x1a3c(%rip),%rcx        # 1bc2 <malloc+0x192>
+     186:	48 89 ce             	mov    %rcx,%rsi
+     189:	89 c7                	mov    %eax,%edi
+     18b:	b8 00 00 00 00       	mov    $0x0,%eax
+     190:	e8 19 10 00 00       	call   11ae <printf>
+     195:	8b 05 05 20 00 00    	mov    0x2005(%rip),%eax        # 21a0 <stdout>
+     19b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     19e:	48 8d 0d 6d 1a 00 00 	lea    0x1a6d(%rip),%rcx        # 1c12 <malloc+0x1e2>
+     1a5:	48 89 ce             	mov    %rcx,%rsi
+     1a8:	89 c7                	mov    %eax,%edi
+     1aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     1af:	e8 fa 0f 00 00       	call   11ae <printf>
+     1b4:	8b 05 e6 1f 00 00    	mov    0x1fe6(%rip),%eax        # 21a0 <stdout>
+     1ba:	48 8d 15 2c 1a 00 00 	lea    0x1a2c(%rip),%rdx        # 1bed <malloc+0x1bd>
+     1c1:	48 89 d6             	mov    %rdx,%rsi
+     1c4:	89 c7                	mov    %eax,%edi
+     1c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1cb:	e8 de 0f 00 00       	call   11ae <printf>
+     1d0:	90                   	nop
+     1d1:	eb fd                	jmp    1d0 <growtest+0x1d0>
+    if(i > 0 && fds[i] != fds[i - 1] + 1)
+     1d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1d7:	0f 8e cc 00 00 00    	jle    2a9 <growtest+0x2a9>
+     1dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e0:	48 98                	cltq
+     1e2:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     1e9:	00 
+     1ea:	48 8d 05 4f 20 00 00 	lea    0x204f(%rip),%rax        # 2240 <fds>
+     1f1:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     1f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1f7:	83 e8 01             	sub    $0x1,%eax
+     1fa:	48 98                	cltq
+     1fc:	48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+     203:	00 
+     204:	48 8d 05 35 20 00 00 	lea    0x2035(%rip),%rax        # 2240 <fds>
+     20b:	8b 04 01             	mov    (%rcx,%rax,1),%eax
+     20e:	83 c0 01             	add    $0x1,%eax
+     211:	39 c2                	cmp    %eax,%edx
+     213:	0f 84 90 00 00 00    	je     2a9 <growtest+0x2a9>
+      error("open %d returned fd %d after %d", i, fds[i], fds[i - 1]);
+     219:	8b 05 81 1f 00 00    	mov    0x1f81(%rip),%eax        # 21a0 <stdout>
+     21f:	ba 2a 00 00 00       	mov    $0x2a,%edx
+     224:	48 8d 0d 97 19 00 00 	lea    0x1997(%rip),%rcx        # 1bc2 <malloc+0x192>
+     22b:	48 89 ce             	mov    %rcx,%rsi
+     22e:	89 c7                	mov    %eax,%edi
+     230:	b8 00 00 00 00       	mov    $0x0,%eax
+     235:	e8 74 0f 00 00       	call   11ae <printf>
+     23a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     23d:	83 e8 01             	sub    $0x1,%eax
+     240:	48 98                	cltq
+     242:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     249:	00 
+     24a:	48 8d 05 ef 1f 00 00 	lea    0x1fef(%rip),%rax        # 2240 <fds>
+     251:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+     254:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     257:	48 98                	cltq
+     259:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     260:	00 
+     261:	48 8d 05 d8 1f 00 00 	lea    0x1fd8(%rip),%rax        # 2240 <fds>
+     268:	8b 0c 02             	mov    (%rdx,%rax,1),%ecx
+     26b:	8b 05 2f 1f 00 00    	mov    0x1f2f(%rip),%eax        # 21a0 <stdout>
+     271:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     274:	41 89 f0             	mov    %esi,%r8d
+     277:	48 8d 35 aa 19 00 00 	lea    0x19aa(%rip),%rsi        # 1c28 <malloc+0x1f8>
+     27e:	89 c7                	mov    %eax,%edi
+     280:	b8 00 00 00 00       	mov    $0x0,%eax
+     285:	e8 24 0f 00 00       	call   11ae <printf>
+     28a:	8b 05 10 1f 00 00    	mov    0x1f10(%rip),%eax        # 21a0 <stdout>
+     290:	48 8d 15 56 19 00 00 	lea    0x1956(%rip),%rdx        # 1bed <malloc+0x1bd>
+     297:	48 89 d6             	mov    %rdx,%rsi
+     29a:	89 c7                	mov    %eax,%edi
+     29c:	b8 00 00 00 00       	mov    $0x0,%eax
+     2a1:	e8 08 0f 00 00       	call   11ae <printf>
+     2a6:	90                   	nop
+     2a7:	eb fd                	jmp    2a6 <growtest+0x2a6>
+  for(i = 0; i < NFD; i++){
+     2a9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     2ad:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     2b4:	0f 8e 73 fe ff ff    	jle    12d <growtest+0x12d>
+  }
+
+  // each open has its own offset
+  for(i = 0; i < NFD; i++){
+     2ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2c1:	e9 b2 00 00 00       	jmp    378 <growtest+0x378>
+    if(read(fds[i], &c, 1) != 1 || c != '0')
+     2c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c9:	48 98                	cltq
+     2cb:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     2d2:	00 
+     2d3:	48 8d 05 66 1f 00 00 	lea    0x1f66(%rip),%rax        # 2240 <fds>
+     2da:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     2dd:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     2e1:	ba 01 00 00 00       	mov    $0x1,%edx
+     2e6:	48 89 ce             	mov    %rcx,%rsi
+     2e9:	89 c7                	mov    %eax,%edi
+     2eb:	e8 7d 14 00 00       	call   176d <read>
+     2f0:	83 f8 01             	cmp    $0x1,%eax
+     2f3:	75 08                	jne    2fd <growtest+0x2fd>
+     2f5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     2f9:	3c 30                	cmp    $0x30,%al
+     2fb:	74 77                	je     374 <growtest+0x374>
+      error("first read of fd %d got %c", fds[i], c);
+     2fd:	8b 05 9d 1e 00 00    	mov    0x1e9d(%rip),%eax        # 21a0 <stdout>
+     303:	ba 30 00 00 00       	mov    $0x30,%edx
+     308:	48 8d 0d b3 18 00 00 	lea    0x18b3(%rip),%rcx        # 1bc2 <malloc+0x192>
+     30f:	48 89 ce             	mov    %rcx,%rsi
+     312:	89 c7                	mov    %eax,%edi
+     314:	b8 00 00 00 00       	mov    $0x0,%eax
+     319:	e8 90 0e 00 00       	call   11ae <printf>
+     31e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     322:	0f be c8             	movsbl %al,%ecx
+     325:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     328:	48 98                	cltq
+     32a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     331:	00 
+     332:	48 8d 05 07 1f 00 00 	lea    0x1f07(%rip),%rax        # 2240 <fds>
+     339:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     33c:	8b 05 5e 1e 00 00    	mov    0x1e5e(%rip),%eax        # 21a0 <stdout>
+     342:	48 8d 35 ff 18 00 00 	lea    0x18ff(%rip),%rsi        # 1c48 <malloc+0x218>
+     349:	89 c7                	mov    %eax,%edi
+     34b:	b8 00 00 00 00       	mov    $0x0,%eax
+     350:	e8 59 0e 00 00       	call   11ae <printf>
+     355:	8b 05 45 1e 00 00    	mov    0x1e45(%rip),%eax        # 21a0 <stdout>
+     35b:	48 8d 15 8b 18 00 00 	lea    0x188b(%rip),%rdx        # 1bed <malloc+0x1bd>
+     362:	48 89 d6             	mov    %rdx,%rsi
+     365:	89 c7                	mov    %eax,%edi
+     367:	b8 00 00 00 00       	mov    $0x0,%eax
+     36c:	e8 3d 0e 00 00       	call   11ae <printf>
+     371:	90                   	nop
+     372:	eb fd                	jmp    371 <growtest+0x371>
+  for(i = 0; i < NFD; i++){
+     374:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     378:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     37f:	0f 8e 41 ff ff ff    	jle    2c6 <growtest+0x2c6>
+  }
+  if(read(fds[NFD - 1], &c, 1) != 1 || c != '1')
+     385:	8b 05 d1 21 00 00    	mov    0x21d1(%rip),%eax        # 255c <fds+0x31c>
+     38b:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     38f:	ba 01 00 00 00       	mov    $0x1,%edx
+     394:	48 89 ce             	mov    %rcx,%rsi
+     397:	89 c7                	mov    %eax,%edi
+     399:	e8 cf 13 00 00       	call   176d <read>
+     39e:	83 f8 01             	cmp    $0x1,%eax
+     3a1:	75 08                	jne    3ab <growtest+0x3ab>
+     3a3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3a7:	3c 31                	cmp    $0x31,%al
+     3a9:	74 66                	je     411 <growtest+0x411>
+    error("second read of fd %d got %c", fds[NFD - 1], c);
+     3ab:	8b 05 ef 1d 00 00    	mov    0x1def(%rip),%eax        # 21a0 <stdout>
+     3b1:	ba 33 00 00 00       	mov    $0x33,%edx
+     3b6:	48 8d 0d 05 18 00 00 	lea    0x1805(%rip),%rcx        # 1bc2 <malloc+0x192>
+     3bd:	48 89 ce             	mov    %rcx,%rsi
+     3c0:	89 c7                	mov    %eax,%edi
+     3c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c7:	e8 e2 0d 00 00       	call   11ae <printf>
+     3cc:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     3d0:	0f be c8             	movsbl %al,%ecx
+     3d3:	8b 15 83 21 00 00    	mov    0x2183(%rip),%edx        # 255c <fds+0x31c>
+     3d9:	8b 05 c1 1d 00 00    	mov    0x1dc1(%rip),%eax        # 21a0 <stdout>
+     3df:	48 8d 35 7d 18 00 00 	lea    0x187d(%rip),%rsi        # 1c63 <malloc+0x233>
+     3e6:	89 c7                	mov    %eax,%edi
+     3e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ed:	e8 bc 0d 00 00       	call   11ae <printf>
+     3f2:	8b 05 a8 1d 00 00    	mov    0x1da8(%rip),%eax        # 21a0 <stdout>
+     3f8:	48 8d 15 ee 17 00 00 	lea    0x17ee(%rip),%rdx        # 1bed <malloc+0x1bd>
+     3ff:	48 89 d6             	mov    %rdx,%rsi
+     402:	89 c7                	mov    %eax,%edi
+     404:	b8 00 00 00 00       	mov    $0x0,%eax
+     409:	e8 a0 0d 00 00       	call   11ae <printf>
+     40e:	90                   	nop
+     40f:	eb fd                	jmp    40e <growtest+0x40e>
+
+  // the lowest free fd is handed out first
+  close(fds[150]);
+     411:	8b 05 81 20 00 00    	mov    0x2081(%rip),%eax        # 2498 <fds+0x258>
+     417:	89 c7                	mov    %eax,%edi
+     419:	e8 5f 13 00 00       	call   177d <close>
+  close(fds[20]);
+     41e:	8b 05 6c 1e 00 00    	mov    0x1e6c(%rip),%eax        # 2290 <fds+0x50>
+     424:	89 c7                	mov    %eax,%edi
+     426:	e8 52 13 00 00       	call   177d <close>
+  if((fd = open("fd1.txt", O_RDONLY)) != fds[20])
+     42b:	be 00 00 00 00       	mov    $0x0,%esi
+     430:	48 8d 05 83 17 00 00 	lea    0x1783(%rip),%rax        # 1bba <malloc+0x18a>
+     437:	48 89 c7             	mov    %rax,%rdi
+     43a:	e8 56 13 00 00       	call   1795 <open>
+     43f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     442:	8b 05 48 1e 00 00    	mov    0x1e48(%rip),%eax        # 2290 <fds+0x50>
+     448:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     44b:	74 62                	je     4af <growtest+0x4af>
+    error("open returned %d, not the lowest free %d", fd, fds[20]);
+     44d:	8b 05 4d 1d 00 00    	mov    0x1d4d(%rip),%eax        # 21a0 <stdout>
+     453:	ba 39 00 00 00       	mov    $0x39,%edx
+     458:	48 8d 0d 63 17 00 00 	lea    0x1763(%rip),%rcx        # 1bc2 <malloc+0x192>
+     45f:	48 89 ce             	mov    %rcx,%rsi
+     462:	89 c7                	mov    %eax,%edi
+     464:	b8 00 00 00 00       	mov    $0x0,%eax
+     469:	e8 40 0d 00 00       	call   11ae <printf>
+     46e:	8b 0d 1c 1e 00 00    	mov    0x1e1c(%rip),%ecx        # 2290 <fds+0x50>
+     474:	8b 05 26 1d 00 00    	mov    0x1d26(%rip),%eax        # 21a0 <stdout>
+     47a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     47d:	48 8d 35 fc 17 00 00 	lea    0x17fc(%rip),%rsi        # 1c80 <malloc+0x250>
+     484:	89 c7                	mov    %eax,%edi
+     486:	b8 00 00 00 00       	mov    $0x0,%eax
+     48b:	e8 1e 0d 00 00       	call   11ae <printf>
+     490:	8b 05 0a 1d 00 00    	mov    0x1d0a(%rip),%eax        # 21a0 <stdout>
+     496:	48 8d 15 50 17 00 00 	lea    0x1750(%rip),%rdx        # 1bed <malloc+0x1bd>
+     49d:	48 89 d6             	mov    %rdx,%rsi
+     4a0:	89 c7                	mov    %eax,%edi
+     4a2:	b8 00 00 00 00       	mov    $0x0,%eax
+     4a7:	e8 02 0d 00 00       	call   11ae <printf>
+     4ac:	90                   	nop
+     4ad:	eb fd                	jmp    4ac <growtest+0x4ac>
+  if((fd = dup(fds[0])) != fds[150])
+     4af:	8b 05 8b 1d 00 00    	mov    0x1d8b(%rip),%eax        # 2240 <fds>
+     4b5:	89 c7                	mov    %eax,%edi
+     4b7:	e8 11 13 00 00       	call   17cd <dup>
+     4bc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     4bf:	8b 05 d3 1f 00 00    	mov    0x1fd3(%rip),%eax        # 2498 <fds+0x258>
+     4c5:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     4c8:	74 62                	je     52c <growtest+0x52c>
+    error("dup returned %d, not the lowest free %d", fd, fds[150]);
+     4ca:	8b 05 d0 1c 00 00    	mov    0x1cd0(%rip),%eax        # 21a0 <stdout>
+     4d0:	ba 3b 00 00 00       	mov    $0x3b,%edx
+     4d5:	48 8d 0d e6 16 00 00 	lea    0x16e6(%rip),%rcx        # 1bc2 <malloc+0x192>
+     4dc:	48 89 ce             	mov    %rcx,%rsi
+     4df:	89 c7                	mov    %eax,%edi
+     4e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e6:	e8 c3 0c 00 00       	call   11ae <printf>
+     4eb:	8b 0d a7 1f 00 00    	mov    0x1fa7(%rip),%ecx        # 2498 <fds+0x258>
+     4f1:	8b 05 a9 1c 00 00    	mov    0x1ca9(%rip),%eax        # 21a0 <stdout>
+     4f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     4fa:	48 8d 35 af 17 00 00 	lea    0x17af(%rip),%rsi        # 1cb0 <malloc+0x280>
+     501:	89 c7                	mov    %eax,%edi
+     503:	b8 00 00 00 00       	mov    $0x0,%eax
+     508:	e8 a1 0c 00 00       	call   11ae <printf>
+     50d:	8b 05 8d 1c 00 00    	mov    0x1c8d(%rip),%eax        # 21a0 <stdout>
+     513:	48 8d 15 d3 16 00 00 	lea    0x16d3(%rip),%rdx        # 1bed <malloc+0x1bd>
+     51a:	48 89 d6             	mov    %rdx,%rsi
+     51d:	89 c7                	mov    %eax,%edi
+     51f:	b8 00 00 00 00       	mov    $0x0,%eax
+     524:	e8 85 0c 00 00       	call   11ae <printf>
+     529:	90                   	nop
+     52a:	eb fd                	jmp    529 <growtest+0x529>
+
+  // a dup shares the offset of the file it copies
+  if(read(fds[0], &c, 1) != 1 || c != '1' || read(fds[150], &c, 1) != 1 || c != '2')
+     52c:	8b 05 0e 1d 00 00    	mov    0x1d0e(%rip),%eax        # 2240 <fds>
+     532:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     536:	ba 01 00 00 00       	mov    $0x1,%edx
+     53b:	48 89 ce             	mov    %rcx,%rsi
+     53e:	89 c7                	mov    %eax,%edi
+     540:	e8 28 12 00 00       	call   176d <read>
+     545:	83 f8 01             	cmp    $0x1,%eax
+     548:	75 2e                	jne    578 <growtest+0x578>
+     54a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     54e:	3c 31                	cmp    $0x31,%al
+     550:	75 26                	jne    578 <growtest+0x578>
+     552:	8b 05 40 1f 00 00    	mov    0x1f40(%rip),%eax        # 2498 <fds+0x258>
+     558:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     55c:	ba 01 00 00 00       	mov    $0x1,%edx
+     561:	48 89 ce             	mov    %rcx,%rsi
+     564:	89 c7                	mov    %eax,%edi
+     566:	e8 02 12 00 00       	call   176d <read>
+     56b:	83 f8 01             	cmp    $0x1,%eax
+     56e:	75 08                	jne    578 <growtest+0x578>
+     570:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     574:	3c 32                	cmp    $0x32,%al
+     576:	74 5c                	je     5d4 <growtest+0x5d4>
+    error("dup does not share the file offset");
+     578:	8b 05 22 1c 00 00    	mov    0x1c22(%rip),%eax        # 21a0 <stdout>
+     57e:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     583:	48 8d 0d 38 16 00 00 	lea    0x1638(%rip),%rcx        # 1bc2 <malloc+0x192>
+     58a:	48 89 ce             	mov    %rcx,%rsi
+     58d:	89 c7                	mov    %eax,%edi
+     58f:	b8 00 00 00 00       	mov    $0x0,%eax
+     594:	e8 15 0c 00 00       	call   11ae <printf>
+     599:	8b 05 01 1c 00 00    	mov    0x1c01(%rip),%eax        # 21a0 <stdout>
+     59f:	48 8d 15 32 17 00 00 	lea    0x1732(%rip),%rdx        # 1cd8 <malloc+0x2a8>
+     5a6:	48 89 d6             	mov    %rdx,%rsi
+     5a9:	89 c7                	mov    %eax,%edi
+     5ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     5b0:	e8 f9 0b 00 00       	call   11ae <printf>
+     5b5:	8b 05 e5 1b 00 00    	mov    0x1be5(%rip),%eax        # 21a0 <stdout>
+     5bb:	48 8d 15 2b 16 00 00 	lea    0x162b(%rip),%rdx        # 1bed <malloc+0x1bd>
+     5c2:	48 89 d6             	mov    %rdx,%rsi
+     5c5:	89 c7                	mov    %eax,%edi
+     5c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cc:	e8 dd 0b 00 00       	call   11ae <printf>
+     5d1:	90                   	nop
+     5d2:	eb fd                	jmp    5d1 <growtest+0x5d1>
+  printf(stdout, "growtest OK\n");
+     5d4:	8b 05 c6 1b 00 00    	mov    0x1bc6(%rip),%eax        # 21a0 <stdout>
+     5da:	48 8d 15 1a 17 00 00 	lea    0x171a(%rip),%rdx        # 1cfb <malloc+0x2cb>
+     5e1:	48 89 d6             	mov    %rdx,%rsi
+     5e4:	89 c7                	mov    %eax,%edi
+     5e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     5eb:	e8 be 0b 00 00       	call   11ae <printf>
+}
+     5f0:	90                   	nop
+     5f1:	c9                   	leave
+     5f2:	c3                   	ret
+
+00000000000005f3 <forktest>:
+
+// A child gets every fd of its parent, and closing its copies leaves
+// the parent's alone.
+void
+forktest(void)
+{
+     5f3:	55                   	push   %rbp
+     5f4:	48 89 e5             	mov    %rsp,%rbp
+     5f7:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, i;
+  char c;
+
+  printf(stdout, "forktest\n");
+     5fb:	8b 05 9f 1b 00 00    	mov    0x1b9f(%rip),%eax        # 21a0 <stdout>
+     601:	48 8d 15 00 17 00 00 	lea    0x1700(%rip),%rdx        # 1d08 <malloc+0x2d8>
+     608:	48 89 d6             	mov    %rdx,%rsi
+     60b:	89 c7                	mov    %eax,%edi
+     60d:	b8 00 00 00 00       	mov    $0x0,%eax
+     612:	e8 97 0b 00 00       	call   11ae <printf>
+  if((pid = fork()) < 0)
+     617:	e8 31 11 00 00       	call   174d <fork>
+     61c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     61f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     623:	79 5c                	jns    681 <forktest+0x8e>
+    error("fork failed");
+     625:	8b 05 75 1b 00 00    	mov    0x1b75(%rip),%eax        # 21a0 <stdout>
+     62b:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     630:	48 8d 0d 8b 15 00 00 	lea    0x158b(%rip),%rcx        # 1bc2 <malloc+0x192>
+     637:	48 89 ce             	mov    %rcx,%rsi
+     63a:	89 c7                	mov    %eax,%edi
+     63c:	b8 00 00 00 00       	mov    $0x0,%eax
+     641:	e8 68 0b 00 00       	call   11ae <printf>
+     646:	8b 05 54 1b 00 00    	mov    0x1b54(%rip),%eax        # 21a0 <stdout>
+     64c:	48 8d 15 bf 16 00 00 	lea    0x16bf(%rip),%rdx        # 1d12 <malloc+0x2e2>
+     653:	48 89 d6             	mov    %rdx,%rsi
+     656:	89 c7                	mov    %eax,%edi
+     658:	b8 00 00 00 00       	mov    $0x0,%eax
+     65d:	e8 4c 0b 00 00       	call   11ae <printf>
+     662:	8b 05 38 1b 00 00    	mov    0x1b38(%rip),%eax        # 21a0 <stdout>
+     668:	48 8d 15 7e 15 00 00 	lea    0x157e(%rip),%rdx        # 1bed <malloc+0x1bd>
+     66f:	48 89 d6             	mov    %rdx,%rsi
+     672:	89 c7                	mov    %eax,%edi
+     674:	b8 00 00 00 00       	mov    $0x0,%eax
+     679:	e8 30 0b 00 00       	call   11ae <printf>
+     67e:	90                   	nop
+     67f:	eb fd                	jmp    67e <forktest+0x8b>
+  if(pid == 0){
+     681:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     685:	0f 85 c5 00 00 00    	jne    750 <forktest+0x15d>
+    if(read(fds[NFD - 1], &c, 1) != 1 || c != '2')
+     68b:	8b 05 cb 1e 00 00    	mov    0x1ecb(%rip),%eax        # 255c <fds+0x31c>
+     691:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     695:	ba 01 00 00 00       	mov    $0x1,%edx
+     69a:	48 89 ce             	mov    %rcx,%rsi
+     69d:	89 c7                	mov    %eax,%edi
+     69f:	e8 c9 10 00 00       	call   176d <read>
+     6a4:	83 f8 01             	cmp    $0x1,%eax
+     6a7:	75 08                	jne    6b1 <forktest+0xbe>
+     6a9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     6ad:	3c 32                	cmp    $0x32,%al
+     6af:	74 66                	je     717 <forktest+0x124>
+      error("child read of fd %d got %c", fds[NFD - 1], c);
+     6b1:	8b 05 e9 1a 00 00    	mov    0x1ae9(%rip),%eax        # 21a0 <stdout>
+     6b7:	ba 50 00 00 00       	mov    $0x50,%edx
+     6bc:	48 8d 0d ff 14 00 00 	lea    0x14ff(%rip),%rcx        # 1bc2 <malloc+0x192>
+     6c3:	48 89 ce             	mov    %rcx,%rsi
+     6c6:	89 c7                	mov    %eax,%edi
+     6c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cd:	e8 dc 0a 00 00       	call   11ae <printf>
+     6d2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     6d6:	0f be c8             	movsbl %al,%ecx
+     6d9:	8b 15 7d 1e 00 00    	mov    0x1e7d(%rip),%edx        # 255c <fds+0x31c>
+     6df:	8b 05 bb 1a 00 00    	mov    0x1abb(%rip),%eax        # 21a0 <stdout>
+     6e5:	48 8d 35 32 16 00 00 	lea    0x1632(%rip),%rsi        # 1d1e <malloc+0x2ee>
+     6ec:	89 c7                	mov    %eax,%edi
+     6ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f3:	e8 b6 0a 00 00       	call   11ae <printf>
+     6f8:	8b 05 a2 1a 00 00    	mov    0x1aa2(%rip),%eax        # 21a0 <stdout>
+     6fe:	48 8d 15 e8 14 00 00 	lea    0x14e8(%rip),%rdx        # 1bed <malloc+0x1bd>
+     705:	48 89 d6             	mov    %rdx,%rsi
+     708:	89 c7                	mov    %eax,%edi
+     70a:	b8 00 00 00 00       	mov    $0x0,%eax
+     70f:	e8 9a 0a 00 00       	call   11ae <printf>
+     714:	90                   	nop
+     715:	eb fd                	jmp    714 <forktest+0x121>
+    for(i = 0; i < NFD; i++)
+     717:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     71e:	eb 22                	jmp    742 <forktest+0x14f>
+      close(fds[i]);
+     720:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     723:	48 98                	cltq
+     725:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     72c:	00 
+     72d:	48 8d 05 0c 1b 00 00 	lea    0x1b0c(%rip),%rax        # 2240 <fds>
+     734:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     737:	89 c7                	mov    %eax,%edi
+     739:	e8 3f 10 00 00       	call   177d <close>
+    for(i = 0; i < NFD; i++)
+     73e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     742:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     749:	7e d5                	jle    720 <forktest+0x12d>
+    exit();
+     74b:	e8 05 10 00 00       	call   1755 <exit>
+  }
+  wait();
+     750:	e8 08 10 00 00       	call   175d <wait>
+  if(read(fds[NFD - 1], &c, 1) != 1 || c != '3')
+     755:	8b 05 01 1e 00 00    	mov    0x1e01(%rip),%eax        # 255c <fds+0x31c>
+     75b:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     75f:	ba 01 00 00 00       	mov    $0x1,%edx
+     764:	48 89 ce             	mov    %rcx,%rsi
+     767:	89 c7                	mov    %eax,%edi
+     769:	e8 ff 0f 00 00       	call   176d <read>
+     76e:	83 f8 01             	cmp    $0x1,%eax
+     771:	75 08                	jne    77b <forktest+0x188>
+     773:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     777:	3c 33                	cmp    $0x33,%al
+     779:	74 62                	je     7dd <forktest+0x1ea>
+    error("fd %d does not share its offset with the child", fds[NFD - 1]);
+     77b:	8b 05 1f 1a 00 00    	mov    0x1a1f(%rip),%eax        # 21a0 <stdout>
+     781:	ba 57 00 00 00       	mov    $0x57,%edx
+     786:	48 8d 0d 35 14 00 00 	lea    0x1435(%rip),%rcx        # 1bc2 <malloc+0x192>
+     78d:	48 89 ce             	mov    %rcx,%rsi
+     790:	89 c7                	mov    %eax,%edi
+     792:	b8 00 00 00 00       	mov    $0x0,%eax
+     797:	e8 12 0a 00 00       	call   11ae <printf>
+     79c:	8b 15 ba 1d 00 00    	mov    0x1dba(%rip),%edx        # 255c <fds+0x31c>
+     7a2:	8b 05 f8 19 00 00    	mov    0x19f8(%rip),%eax        # 21a0 <stdout>
+     7a8:	48 8d 0d 91 15 00 00 	lea    0x1591(%rip),%rcx        # 1d40 <malloc+0x310>
+     7af:	48 89 ce             	mov    %rcx,%rsi
+     7b2:	89 c7                	mov    %eax,%edi
+     7b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7b9:	e8 f0 09 00 00       	call   11ae <printf>
+     7be:	8b 05 dc 19 00 00    	mov    0x19dc(%rip),%eax        # 21a0 <stdout>
+     7c4:	48 8d 15 22 14 00 00 	lea    0x1422(%rip),%rdx        # 1bed <malloc+0x1bd>
+     7cb:	48 89 d6             	mov    %rdx,%rsi
+     7ce:	89 c7                	mov    %eax,%edi
+     7d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d5:	e8 d4 09 00 00       	call   11ae <printf>
+     7da:	90                   	nop
+     7db:	eb fd                	jmp    7da <forktest+0x1e7>
+  for(i = 0; i < NFD; i++)
+     7dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7e4:	e9 99 00 00 00       	jmp    882 <forktest+0x28f>
+    if(close(fds[i]) < 0)
+     7e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7ec:	48 98                	cltq
+     7ee:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     7f5:	00 
+     7f6:	48 8d 05 43 1a 00 00 	lea    0x1a43(%rip),%rax        # 2240 <fds>
+     7fd:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     800:	89 c7                	mov    %eax,%edi
+     802:	e8 76 0f 00 00       	call   177d <close>
+     807:	85 c0                	test   %eax,%eax
+     809:	79 73                	jns    87e <forktest+0x28b>
+      error("close of fd %d failed", fds[i]);
+     80b:	8b 05 8f 19 00 00    	mov    0x198f(%rip),%eax        # 21a0 <stdout>
+     811:	ba 5a 00 00 00       	mov    $0x5a,%edx
+     816:	48 8d 0d a5 13 00 00 	lea    0x13a5(%rip),%rcx        # 1bc2 <malloc+0x192>
+     81d:	48 89 ce             	mov    %rcx,%rsi
+     820:	89 c7                	mov    %eax,%edi
+     822:	b8 00 00 00 00       	mov    $0x0,%eax
+     827:	e8 82 09 00 00       	call   11ae <printf>
+     82c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     82f:	48 98                	cltq
+     831:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     838:	00 
+     839:	48 8d 05 00 1a 00 00 	lea    0x1a00(%rip),%rax        # 2240 <fds>
+     840:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     843:	8b 05 57 19 00 00    	mov    0x1957(%rip),%eax        # 21a0 <stdout>
+     849:	48 8d 0d 1f 15 00 00 	lea    0x151f(%rip),%rcx        # 1d6f <malloc+0x33f>
+     850:	48 89 ce             	mov    %rcx,%rsi
+     853:	89 c7                	mov    %eax,%edi
+     855:	b8 00 00 00 00       	mov    $0x0,%eax
+     85a:	e8 4f 09 00 00       	call   11ae <printf>
+     85f:	8b 05 3b 19 00 00    	mov    0x193b(%rip),%eax        # 21a0 <stdout>
+     865:	48 8d 15 81 13 00 00 	lea    0x1381(%rip),%rdx        # 1bed <malloc+0x1bd>
+     86c:	48 89 d6             	mov    %rdx,%rsi
+     86f:	89 c7                	mov    %eax,%edi
+     871:	b8 00 00 00 00       	mov    $0x0,%eax
+     876:	e8 33 09 00 00       	call   11ae <printf>
+     87b:	90                   	nop
+     87c:	eb fd                	jmp    87b <forktest+0x288>
+  for(i = 0; i < NFD; i++)
+     87e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     882:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+     889:	0f 8e 5a ff ff ff    	jle    7e9 <forktest+0x1f6>
+  printf(stdout, "forktest OK\n");
+     88f:	8b 05 0b 19 00 00    	mov    0x190b(%rip),%eax        # 21a0 <stdout>
+     895:	48 8d 15 e9 14 00 00 	lea    0x14e9(%rip),%rdx        # 1d85 <malloc+0x355>
+     89c:	48 89 d6             	mov    %rdx,%rsi
+     89f:	89 c7                	mov    %eax,%edi
+     8a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a6:	e8 03 09 00 00       	call   11ae <printf>
+}
+     8ab:	90                   	nop
+     8ac:	c9                   	leave
+     8ad:	c3                   	ret
+
+00000000000008ae <polltest>:
+
+// poll watches more than NOFILE files at once.
+void
+polltest(void)
+{
+     8ae:	55                   	push   %rbp
+     8af:	48 89 e5             	mov    %rsp,%rbp
+     8b2:	48 81 ec 50 01 00 00 	sub    $0x150,%rsp
+  int p[NPIPE][2], i, n;
+
+  printf(stdout, "polltest\n");
+     8b9:	8b 05 e1 18 00 00    	mov    0x18e1(%rip),%eax        # 21a0 <stdout>
+     8bf:	48 8d 15 cc 14 00 00 	lea    0x14cc(%rip),%rdx        # 1d92 <malloc+0x362>
+     8c6:	48 89 d6             	mov    %rdx,%rsi
+     8c9:	89 c7                	mov    %eax,%edi
+     8cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d0:	e8 d9 08 00 00       	call   11ae <printf>
+  for(i = 0; i < NPIPE; i++){
+     8d5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     8dc:	e9 c1 00 00 00       	jmp    9a2 <polltest+0xf4>
+    if(pipe(p[i]) < 0)
+     8e1:	48 8d 85 b8 fe ff ff 	lea    -0x148(%rbp),%rax
+     8e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     8eb:	48 63 d2             	movslq %edx,%rdx
+     8ee:	48 c1 e2 03          	shl    $0x3,%rdx
+     8f2:	48 01 d0             	add    %rdx,%rax
+     8f5:	48 89 c7             	mov    %rax,%rdi
+     8f8:	e8 68 0e 00 00       	call   1765 <pipe>
+     8fd:	85 c0                	test   %eax,%eax
+     8ff:	79 5f                	jns    960 <polltest+0xb2>
+      error("pipe %d failed", i);
+     901:	8b 05 99 18 00 00    	mov    0x1899(%rip),%eax        # 21a0 <stdout>
+     907:	ba 67 00 00 00       	mov    $0x67,%edx
+     90c:	48 8d 0d af 12 00 00 	lea    0x12af(%rip),%rcx        # 1bc2 <malloc+0x192>
+     913:	48 89 ce             	mov    %rcx,%rsi
+     916:	89 c7                	mov    %eax,%edi
+     918:	b8 00 00 00 00       	mov    $0x0,%eax
+     91d:	e8 8c 08 00 00       	call   11ae <printf>
+     922:	8b 05 78 18 00 00    	mov    0x1878(%rip),%eax        # 21a0 <stdout>
+     928:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     92b:	48 8d 0d 6a 14 00 00 	lea    0x146a(%rip),%rcx        # 1d9c <malloc+0x36c>
+     932:	48 89 ce             	mov    %rcx,%rsi
+     935:	89 c7                	mov    %eax,%edi
+     937:	b8 00 00 00 00       	mov    $0x0,%eax
+     93c:	e8 6d 08 00 00       	call   11ae <printf>
+     941:	8b 05 59 18 00 00    	mov    0x1859(%rip),%eax        # 21a0 <stdout>
+     947:	48 8d 15 9f 12 00 00 	lea    0x129f(%rip),%rdx        # 1bed <malloc+0x1bd>
+     94e:	48 89 d6             	mov    %rdx,%rsi
+     951:	89 c7                	mov    %eax,%edi
+     953:	b8 00 00 00 00       	mov    $0x0,%eax
+     958:	e8 51 08 00 00       	call   11ae <printf>
+     95d:	90                   	nop
+     95e:	eb fd                	jmp    95d <polltest+0xaf>
+    pfds[i].fd = p[i][0];
+     960:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     963:	48 98                	cltq
+     965:	8b 84 c5 b8 fe ff ff 	mov    -0x148(%rbp,%rax,8),%eax
+     96c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     96f:	48 63 d2             	movslq %edx,%rdx
+     972:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+     979:	00 
+     97a:	48 8d 15 df 20 00 00 	lea    0x20df(%rip),%rdx        # 2a60 <pfds>
+     981:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+    pfds[i].events = POLLIN;
+     984:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     987:	48 98                	cltq
+     989:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     990:	00 
+     991:	48 8d 05 cc 20 00 00 	lea    0x20cc(%rip),%rax        # 2a64 <pfds+0x4>
+     998:	66 c7 04 02 01 00    	movw   $0x1,(%rdx,%rax,1)
+  for(i = 0; i < NPIPE; i++){
+     99e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9a2:	83 7d fc 27          	cmpl   $0x27,-0x4(%rbp)
+     9a6:	0f 8e 35 ff ff ff    	jle    8e1 <polltest+0x33>
+  }
+  if(write(p[NPIPE - 3][1], "x", 1) != 1)
+     9ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     9af:	ba 01 00 00 00       	mov    $0x1,%edx
+     9b4:	48 8d 0d f0 13 00 00 	lea    0x13f0(%rip),%rcx        # 1dab <malloc+0x37b>
+     9bb:	48 89 ce             	mov    %rcx,%rsi
+     9be:	89 c7                	mov    %eax,%edi
+     9c0:	e8 b0 0d 00 00       	call   1775 <write>
+     9c5:	83 f8 01             	cmp    $0x1,%eax
+     9c8:	74 5c                	je     a26 <polltest+0x178>
+    error("write failed");
+     9ca:	8b 05 d0 17 00 00    	mov    0x17d0(%rip),%eax        # 21a0 <stdout>
+     9d0:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     9d5:	48 8d 0d e6 11 00 00 	lea    0x11e6(%rip),%rcx        # 1bc2 <malloc+0x192>
+     9dc:	48 89 ce             	mov    %rcx,%rsi
+     9df:	89 c7                	mov    %eax,%edi
+     9e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9e6:	e8 c3 07 00 00       	call   11ae <printf>
+     9eb:	8b 05 af 17 00 00    	mov    0x17af(%rip),%eax        # 21a0 <stdout>
+     9f1:	48 8d 15 b5 13 00 00 	lea    0x13b5(%rip),%rdx        # 1dad <malloc+0x37d>
+     9f8:	48 89 d6             	mov    %rdx,%rsi
+     9fb:	89 c7                	mov    %eax,%edi
+     9fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     a02:	e8 a7 07 00 00       	call   11ae <printf>
+     a07:	8b 05 93 17 00 00    	mov    0x1793(%rip),%eax        # 21a0 <stdout>
+     a0d:	48 8d 15 d9 11 00 00 	lea    0x11d9(%rip),%rdx        # 1bed <malloc+0x1bd>
+     a14:	48 89 d6             	mov    %rdx,%rsi
+     a17:	89 c7                	mov    %eax,%edi
+     a19:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1e:	e8 8b 07 00 00       	call   11ae <printf>
+     a23:	90                   	nop
+     a24:	eb fd                	jmp    a23 <polltest+0x175>
+  if((n = poll(pfds, NPIPE, 0)) != 1)
+     a26:	ba 00 00 00 00       	mov    $0x0,%edx
+     a2b:	be 28 00 00 00       	mov    $0x28,%esi
+     a30:	48 8d 05 29 20 00 00 	lea    0x2029(%rip),%rax        # 2a60 <pfds>
+     a37:	48 89 c7             	mov    %rax,%rdi
+     a3a:	e8 25 0e 00 00       	call   1864 <poll>
+     a3f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     a42:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     a46:	74 5f                	je     aa7 <polltest+0x1f9>
+    error("poll returned %d", n);
+     a48:	8b 05 52 17 00 00    	mov    0x1752(%rip),%eax        # 21a0 <stdout>
+     a4e:	ba 6e 00 00 00       	mov    $0x6e,%edx
+     a53:	48 8d 0d 68 11 00 00 	lea    0x1168(%rip),%rcx        # 1bc2 <malloc+0x192>
+     a5a:	48 89 ce             	mov    %rcx,%rsi
+     a5d:	89 c7                	mov    %eax,%edi
+     a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a64:	e8 45 07 00 00       	call   11ae <printf>
+     a69:	8b 05 31 17 00 00    	mov    0x1731(%rip),%eax        # 21a0 <stdout>
+     a6f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     a72:	48 8d 0d 41 13 00 00 	lea    0x1341(%rip),%rcx        # 1dba <malloc+0x38a>
+     a79:	48 89 ce             	mov    %rcx,%rsi
+     a7c:	89 c7                	mov    %eax,%edi
+     a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a83:	e8 26 07 00 00       	call   11ae <printf>
+     a88:	8b 05 12 17 00 00    	mov    0x1712(%rip),%eax        # 21a0 <stdout>
+     a8e:	48 8d 15 58 11 00 00 	lea    0x1158(%rip),%rdx        # 1bed <malloc+0x1bd>
+     a95:	48 89 d6             	mov    %rdx,%rsi
+     a98:	89 c7                	mov    %eax,%edi
+     a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     a9f:	e8 0a 07 00 00       	call   11ae <printf>
+     aa4:	90                   	nop
+     aa5:	eb fd                	jmp    aa4 <polltest+0x1f6>
+  for(i = 0; i < NPIPE; i++)
+     aa7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     aae:	e9 a4 00 00 00       	jmp    b57 <polltest+0x2a9>
+    if(pfds[i].revents != (i == NPIPE - 3 ? POLLIN : 0))
+     ab3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ab6:	48 98                	cltq
+     ab8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     abf:	00 
+     ac0:	48 8d 05 9f 1f 00 00 	lea    0x1f9f(%rip),%rax        # 2a66 <pfds+0x6>
+     ac7:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+     acb:	0f bf d0             	movswl %ax,%edx
+     ace:	83 7d fc 25          	cmpl   $0x25,-0x4(%rbp)
+     ad2:	0f 94 c0             	sete   %al
+     ad5:	0f b6 c0             	movzbl %al,%eax
+     ad8:	39 c2                	cmp    %eax,%edx
+     ada:	74 77                	je     b53 <polltest+0x2a5>
+      error("pipe %d has revents %x", i, pfds[i].revents);
+     adc:	8b 05 be 16 00 00    	mov    0x16be(%rip),%eax        # 21a0 <stdout>
+     ae2:	ba 71 00 00 00       	mov    $0x71,%edx
+     ae7:	48 8d 0d d4 10 00 00 	lea    0x10d4(%rip),%rcx        # 1bc2 <malloc+0x192>
+     aee:	48 89 ce             	mov    %rcx,%rsi
+     af1:	89 c7                	mov    %eax,%edi
+     af3:	b8 00 00 00 00       	mov    $0x0,%eax
+     af8:	e8 b1 06 00 00       	call   11ae <printf>
+     afd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b00:	48 98                	cltq
+     b02:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     b09:	00 
+     b0a:	48 8d 05 55 1f 00 00 	lea    0x1f55(%rip),%rax        # 2a66 <pfds+0x6>
+     b11:	0f b7 04 02          	movzwl (%rdx,%rax,1),%eax
+     b15:	0f bf c8             	movswl %ax,%ecx
+     b18:	8b 05 82 16 00 00    	mov    0x1682(%rip),%eax        # 21a0 <stdout>
+     b1e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     b21:	48 8d 35 a3 12 00 00 	lea    0x12a3(%rip),%rsi        # 1dcb <malloc+0x39b>
+     b28:	89 c7                	mov    %eax,%edi
+     b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2f:	e8 7a 06 00 00       	call   11ae <printf>
+     b34:	8b 05 66 16 00 00    	mov    0x1666(%rip),%eax        # 21a0 <stdout>
+     b3a:	48 8d 15 ac 10 00 00 	lea    0x10ac(%rip),%rdx        # 1bed <malloc+0x1bd>
+     b41:	48 89 d6             	mov    %rdx,%rsi
+     b44:	89 c7                	mov    %eax,%edi
+     b46:	b8 00 00 00 00       	mov    $0x0,%eax
+     b4b:	e8 5e 06 00 00       	call   11ae <printf>
+     b50:	90                   	nop
+     b51:	eb fd                	jmp    b50 <polltest+0x2a2>
+  for(i = 0; i < NPIPE; i++)
+     b53:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b57:	83 7d fc 27          	cmpl   $0x27,-0x4(%rbp)
+     b5b:	0f 8e 52 ff ff ff    	jle    ab3 <polltest+0x205>
+  for(i = 0; i < NPIPE; i++){
+     b61:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b68:	eb 2a                	jmp    b94 <polltest+0x2e6>
+    close(p[i][0]);
+     b6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b6d:	48 98                	cltq
+     b6f:	8b 84 c5 b8 fe ff ff 	mov    -0x148(%rbp,%rax,8),%eax
+     b76:	89 c7                	mov    %eax,%edi
+     b78:	e8 00 0c 00 00       	call   177d <close>
+    close(p[i][1]);
+     b7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b80:	48 98                	cltq
+     b82:	8b 84 c5 bc fe ff ff 	mov    -0x144(%rbp,%rax,8),%eax
+     b89:	89 c7                	mov    %eax,%edi
+     b8b:	e8 ed 0b 00 00       	call   177d <close>
+  for(i = 0; i < NPIPE; i++){
+     b90:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b94:	83 7d fc 27          	cmpl   $0x27,-0x4(%rbp)
+     b98:	7e d0                	jle    b6a <polltest+0x2bc>
+  }
+  printf(stdout, "polltest OK\n");
+     b9a:	8b 05 00 16 00 00    	mov    0x1600(%rip),%eax        # 21a0 <stdout>
+     ba0:	48 8d 15 3b 12 00 00 	lea    0x123b(%rip),%rdx        # 1de2 <malloc+0x3b2>
+     ba7:	48 89 d6             	mov    %rdx,%rsi
+     baa:	89 c7                	mov    %eax,%edi
+     bac:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb1:	e8 f8 05 00 00       	call   11ae <printf>
+}
+     bb6:	90                   	nop
+     bb7:	c9                   	leave
+     bb8:	c3                   	ret
+
+0000000000000bb9 <limittest>:
+
+// A process can have MAXOFILE files open and no more, and they can all
+// be polled in one call.
+void
+limittest(void)
+{
+     bb9:	55                   	push   %rbp
+     bba:	48 89 e5             	mov    %rsp,%rbp
+     bbd:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, n, first;
+
+  printf(stdout, "limittest\n");
+     bc1:	8b 05 d9 15 00 00    	mov    0x15d9(%rip),%eax        # 21a0 <stdout>
+     bc7:	48 8d 15 21 12 00 00 	lea    0x1221(%rip),%rdx        # 1def <malloc+0x3bf>
+     bce:	48 89 d6             	mov    %rdx,%rsi
+     bd1:	89 c7                	mov    %eax,%edi
+     bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd8:	e8 d1 05 00 00       	call   11ae <printf>
+  if((first = open("fd1.txt", O_RDONLY)) < 0)
+     bdd:	be 00 00 00 00       	mov    $0x0,%esi
+     be2:	48 8d 05 d1 0f 00 00 	lea    0xfd1(%rip),%rax        # 1bba <malloc+0x18a>
+     be9:	48 89 c7             	mov    %rax,%rdi
+     bec:	e8 a4 0b 00 00       	call   1795 <open>
+     bf1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     bf4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     bf8:	79 5c                	jns    c56 <limittest+0x9d>
+    error("unable to open fd1.txt");
+     bfa:	8b 05 a0 15 00 00    	mov    0x15a0(%rip),%eax        # 21a0 <stdout>
+     c00:	ba 82 00 00 00       	mov    $0x82,%edx
+     c05:	48 8d 0d b6 0f 00 00 	lea    0xfb6(%rip),%rcx        # 1bc2 <malloc+0x192>
+     c0c:	48 89 ce             	mov    %rcx,%rsi
+     c0f:	89 c7                	mov    %eax,%edi
+     c11:	b8 00 00 00 00       	mov    $0x0,%eax
+     c16:	e8 93 05 00 00       	call   11ae <printf>
+     c1b:	8b 05 7f 15 00 00    	mov    0x157f(%rip),%eax        # 21a0 <stdout>
+     c21:	48 8d 15 d2 11 00 00 	lea    0x11d2(%rip),%rdx        # 1dfa <malloc+0x3ca>
+     c28:	48 89 d6             	mov    %rdx,%rsi
+     c2b:	89 c7                	mov    %eax,%edi
+     c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+     c32:	e8 77 05 00 00       	call   11ae <printf>
+     c37:	8b 05 63 15 00 00    	mov    0x1563(%rip),%eax        # 21a0 <stdout>
+     c3d:	48 8d 15 a9 0f 00 00 	lea    0xfa9(%rip),%rdx        # 1bed <malloc+0x1bd>
+     c44:	48 89 d6             	mov    %rdx,%rsi
+     c47:	89 c7                	mov    %eax,%edi
+     c49:	b8 00 00 00 00       	mov    $0x0,%eax
+     c4e:	e8 5b 05 00 00       	call   11ae <printf>
+     c53:	90                   	nop
+     c54:	eb fd                	jmp    c53 <limittest+0x9a>
+  fds[0] = first;
+     c56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c59:	89 05 e1 15 00 00    	mov    %eax,0x15e1(%rip)        # 2240 <fds>
+  for(n = 1; (fds[n] = dup(first)) >= 0; n++)
+     c5f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     c66:	eb 69                	jmp    cd1 <limittest+0x118>
+    if(n == MAXOFILE)
+     c68:	81 7d f8 00 02 00 00 	cmpl   $0x200,-0x8(%rbp)
+     c6f:	75 5c                	jne    ccd <limittest+0x114>
+      error("more than MAXOFILE fds open");
+     c71:	8b 05 29 15 00 00    	mov    0x1529(%rip),%eax        # 21a0 <stdout>
+     c77:	ba 86 00 00 00       	mov    $0x86,%edx
+     c7c:	48 8d 0d 3f 0f 00 00 	lea    0xf3f(%rip),%rcx        # 1bc2 <malloc+0x192>
+     c83:	48 89 ce             	mov    %rcx,%rsi
+     c86:	89 c7                	mov    %eax,%edi
+     c88:	b8 00 00 00 00       	mov    $0x0,%eax
+     c8d:	e8 1c 05 00 00       	call   11ae <printf>
+     c92:	8b 05 08 15 00 00    	mov    0x1508(%rip),%eax        # 21a0 <stdout>
+     c98:	48 8d 15 72 11 00 00 	lea    0x1172(%rip),%rdx        # 1e11 <malloc+0x3e1>
+     c9f:	48 89 d6             	mov    %rdx,%rsi
+     ca2:	89 c7                	mov    %eax,%edi
+     ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca9:	e8 00 05 00 00       	call   11ae <printf>
+     cae:	8b 05 ec 14 00 00    	mov    0x14ec(%rip),%eax        # 21a0 <stdout>
+     cb4:	48 8d 15 32 0f 00 00 	lea    0xf32(%rip),%rdx        # 1bed <malloc+0x1bd>
+     cbb:	48 89 d6             	mov    %rdx,%rsi
+     cbe:	89 c7                	mov    %eax,%edi
+     cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc5:	e8 e4 04 00 00       	call   11ae <printf>
+     cca:	90                   	nop
+     ccb:	eb fd                	jmp    cca <limittest+0x111>
+  for(n = 1; (fds[n] = dup(first)) >= 0; n++)
+     ccd:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     cd1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cd4:	89 c7                	mov    %eax,%edi
+     cd6:	e8 f2 0a 00 00       	call   17cd <dup>
+     cdb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     cde:	48 63 d2             	movslq %edx,%rdx
+     ce1:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+     ce8:	00 
+     ce9:	48 8d 15 50 15 00 00 	lea    0x1550(%rip),%rdx        # 2240 <fds>
+     cf0:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+     cf3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     cf6:	48 98                	cltq
+     cf8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     cff:	00 
+     d00:	48 8d 05 39 15 00 00 	lea    0x1539(%rip),%rax        # 2240 <fds>
+     d07:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     d0a:	85 c0                	test   %eax,%eax
+     d0c:	0f 89 56 ff ff ff    	jns    c68 <limittest+0xaf>
+  if(fds[n - 1] != MAXOFILE - 1)
+     d12:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d15:	83 e8 01             	sub    $0x1,%eax
+     d18:	48 98                	cltq
+     d1a:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     d21:	00 
+     d22:	48 8d 05 17 15 00 00 	lea    0x1517(%rip),%rax        # 2240 <fds>
+     d29:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     d2c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+     d31:	74 78                	je     dab <limittest+0x1f2>
+    error("table filled up at fd %d, not %d", fds[n - 1], MAXOFILE - 1);
+     d33:	8b 05 67 14 00 00    	mov    0x1467(%rip),%eax        # 21a0 <stdout>
+     d39:	ba 88 00 00 00       	mov    $0x88,%edx
+     d3e:	48 8d 0d 7d 0e 00 00 	lea    0xe7d(%rip),%rcx        # 1bc2 <malloc+0x192>
+     d45:	48 89 ce             	mov    %rcx,%rsi
+     d48:	89 c7                	mov    %eax,%edi
+     d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4f:	e8 5a 04 00 00       	call   11ae <printf>
+     d54:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d57:	83 e8 01             	sub    $0x1,%eax
+     d5a:	48 98                	cltq
+     d5c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     d63:	00 
+     d64:	48 8d 05 d5 14 00 00 	lea    0x14d5(%rip),%rax        # 2240 <fds>
+     d6b:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     d6e:	8b 05 2c 14 00 00    	mov    0x142c(%rip),%eax        # 21a0 <stdout>
+     d74:	b9 ff 01 00 00       	mov    $0x1ff,%ecx
+     d79:	48 8d 35 b0 10 00 00 	lea    0x10b0(%rip),%rsi        # 1e30 <malloc+0x400>
+     d80:	89 c7                	mov    %eax,%edi
+     d82:	b8 00 00 00 00       	mov    $0x0,%eax
+     d87:	e8 22 04 00 00       	call   11ae <printf>
+     d8c:	8b 05 0e 14 00 00    	mov    0x140e(%rip),%eax        # 21a0 <stdout>
+     d92:	48 8d 15 54 0e 00 00 	lea    0xe54(%rip),%rdx        # 1bed <malloc+0x1bd>
+     d99:	48 89 d6             	mov    %rdx,%rsi
+     d9c:	89 c7                	mov    %eax,%edi
+     d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+     da3:	e8 06 04 00 00       	call   11ae <printf>
+     da8:	90                   	nop
+     da9:	eb fd                	jmp    da8 <limittest+0x1ef>
+
+  for(i = 0; i < MAXOFILE; i++){
+     dab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     db2:	eb 38                	jmp    dec <limittest+0x233>
+    pfds[i].fd = i;
+     db4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     db7:	48 98                	cltq
+     db9:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+     dc0:	00 
+     dc1:	48 8d 15 98 1c 00 00 	lea    0x1c98(%rip),%rdx        # 2a60 <pfds>
+     dc8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dcb:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+    pfds[i].events = POLLIN;
+     dce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dd1:	48 98                	cltq
+     dd3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+     dda:	00 
+     ddb:	48 8d 05 82 1c 00 00 	lea    0x1c82(%rip),%rax        # 2a64 <pfds+0x4>
+     de2:	66 c7 04 02 01 00    	movw   $0x1,(%rdx,%rax,1)
+  for(i = 0; i < MAXOFILE; i++){
+     de8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     dec:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+     df3:	7e bf                	jle    db4 <limittest+0x1fb>
+  }
+  if((n = poll(pfds, MAXOFILE, 0)) < MAXOFILE - 3)
+     df5:	ba 00 00 00 00       	mov    $0x0,%edx
+     dfa:	be 00 02 00 00       	mov    $0x200,%esi
+     dff:	48 8d 05 5a 1c 00 00 	lea    0x1c5a(%rip),%rax        # 2a60 <pfds>
+     e06:	48 89 c7             	mov    %rax,%rdi
+     e09:	e8 56 0a 00 00       	call   1864 <poll>
+     e0e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     e11:	81 7d f8 fc 01 00 00 	cmpl   $0x1fc,-0x8(%rbp)
+     e18:	7f 63                	jg     e7d <limittest+0x2c4>
+    error("poll of %d fds returned %d", MAXOFILE, n);
+     e1a:	8b 05 80 13 00 00    	mov    0x1380(%rip),%eax        # 21a0 <stdout>
+     e20:	ba 8f 00 00 00       	mov    $0x8f,%edx
+     e25:	48 8d 0d 96 0d 00 00 	lea    0xd96(%rip),%rcx        # 1bc2 <malloc+0x192>
+     e2c:	48 89 ce             	mov    %rcx,%rsi
+     e2f:	89 c7                	mov    %eax,%edi
+     e31:	b8 00 00 00 00       	mov    $0x0,%eax
+     e36:	e8 73 03 00 00       	call   11ae <printf>
+     e3b:	8b 05 5f 13 00 00    	mov    0x135f(%rip),%eax        # 21a0 <stdout>
+     e41:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     e44:	89 d1                	mov    %edx,%ecx
+     e46:	ba 00 02 00 00       	mov    $0x200,%edx
+     e4b:	48 8d 35 ff 0f 00 00 	lea    0xfff(%rip),%rsi        # 1e51 <malloc+0x421>
+     e52:	89 c7                	mov    %eax,%edi
+     e54:	b8 00 00 00 00       	mov    $0x0,%eax
+     e59:	e8 50 03 00 00       	call   11ae <printf>
+     e5e:	8b 05 3c 13 00 00    	mov    0x133c(%rip),%eax        # 21a0 <stdout>
+     e64:	48 8d 15 82 0d 00 00 	lea    0xd82(%rip),%rdx        # 1bed <malloc+0x1bd>
+     e6b:	48 89 d6             	mov    %rdx,%rsi
+     e6e:	89 c7                	mov    %eax,%edi
+     e70:	b8 00 00 00 00       	mov    $0x0,%eax
+     e75:	e8 34 03 00 00       	call   11ae <printf>
+     e7a:	90                   	nop
+     e7b:	eb fd                	jmp    e7a <limittest+0x2c1>
+  if(poll(pfds, MAXOFILE + 1, 0) != -1)
+     e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+     e82:	be 01 02 00 00       	mov    $0x201,%esi
+     e87:	48 8d 05 d2 1b 00 00 	lea    0x1bd2(%rip),%rax        # 2a60 <pfds>
+     e8e:	48 89 c7             	mov    %rax,%rdi
+     e91:	e8 ce 09 00 00       	call   1864 <poll>
+     e96:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e99:	74 5c                	je     ef7 <limittest+0x33e>
+    error("poll of more than MAXOFILE fds did not fail");
+     e9b:	8b 05 ff 12 00 00    	mov    0x12ff(%rip),%eax        # 21a0 <stdout>
+     ea1:	ba 91 00 00 00       	mov    $0x91,%edx
+     ea6:	48 8d 0d 15 0d 00 00 	lea    0xd15(%rip),%rcx        # 1bc2 <malloc+0x192>
+     ead:	48 89 ce             	mov    %rcx,%rsi
+     eb0:	89 c7                	mov    %eax,%edi
+     eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb7:	e8 f2 02 00 00       	call   11ae <printf>
+     ebc:	8b 05 de 12 00 00    	mov    0x12de(%rip),%eax        # 21a0 <stdout>
+     ec2:	48 8d 15 a7 0f 00 00 	lea    0xfa7(%rip),%rdx        # 1e70 <malloc+0x440>
+     ec9:	48 89 d6             	mov    %rdx,%rsi
+     ecc:	89 c7                	mov    %eax,%edi
+     ece:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed3:	e8 d6 02 00 00       	call   11ae <printf>
+     ed8:	8b 05 c2 12 00 00    	mov    0x12c2(%rip),%eax        # 21a0 <stdout>
+     ede:	48 8d 15 08 0d 00 00 	lea    0xd08(%rip),%rdx        # 1bed <malloc+0x1bd>
+     ee5:	48 89 d6             	mov    %rdx,%rsi
+     ee8:	89 c7                	mov    %eax,%edi
+     eea:	b8 00 00 00 00       	mov    $0x0,%eax
+     eef:	e8 ba 02 00 00       	call   11ae <printf>
+     ef4:	90                   	nop
+     ef5:	eb fd                	jmp    ef4 <limittest+0x33b>
+
+  for(i = 3; i < MAXOFILE; i++)
+     ef7:	c7 45 fc 03 00 00 00 	movl   $0x3,-0x4(%rbp)
+     efe:	eb 71                	jmp    f71 <limittest+0x3b8>
+    if(close(i) < 0)
+     f00:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f03:	89 c7                	mov    %eax,%edi
+     f05:	e8 73 08 00 00       	call   177d <close>
+     f0a:	85 c0                	test   %eax,%eax
+     f0c:	79 5f                	jns    f6d <limittest+0x3b4>
+      error("close of fd %d failed", i);
+     f0e:	8b 05 8c 12 00 00    	mov    0x128c(%rip),%eax        # 21a0 <stdout>
+     f14:	ba 95 00 00 00       	mov    $0x95,%edx
+     f19:	48 8d 0d a2 0c 00 00 	lea    0xca2(%rip),%rcx        # 1bc2 <malloc+0x192>
+     f20:	48 89 ce             	mov    %rcx,%rsi
+     f23:	89 c7                	mov    %eax,%edi
+     f25:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2a:	e8 7f 02 00 00       	call   11ae <printf>
+     f2f:	8b 05 6b 12 00 00    	mov    0x126b(%rip),%eax        # 21a0 <stdout>
+     f35:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f38:	48 8d 0d 30 0e 00 00 	lea    0xe30(%rip),%rcx        # 1d6f <malloc+0x33f>
+     f3f:	48 89 ce             	mov    %rcx,%rsi
+     f42:	89 c7                	mov    %eax,%edi
+     f44:	b8 00 00 00 00       	mov    $0x0,%eax
+     f49:	e8 60 02 00 00       	call   11ae <printf>
+     f4e:	8b 05 4c 12 00 00    	mov    0x124c(%rip),%eax        # 21a0 <stdout>
+     f54:	48 8d 15 92 0c 00 00 	lea    0xc92(%rip),%rdx        # 1bed <malloc+0x1bd>
+     f5b:	48 89 d6             	mov    %rdx,%rsi
+     f5e:	89 c7                	mov    %eax,%edi
+     f60:	b8 00 00 00 00       	mov    $0x0,%eax
+     f65:	e8 44 02 00 00       	call   11ae <printf>
+     f6a:	90                   	nop
+     f6b:	eb fd                	jmp    f6a <limittest+0x3b1>
+  for(i = 3; i < MAXOFILE; i++)
+     f6d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     f71:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+     f78:	7e 86                	jle    f00 <limittest+0x347>
+  unlink("fd1.txt");
+     f7a:	48 8d 05 39 0c 00 00 	lea    0xc39(%rip),%rax        # 1bba <malloc+0x18a>
+     f81:	48 89 c7             	mov    %rax,%rdi
+     f84:	e8 1c 08 00 00       	call   17a5 <unlink>
+  printf(stdout, "limittest OK\n");
+     f89:	8b 05 11 12 00 00    	mov    0x1211(%rip),%eax        # 21a0 <stdout>
+     f8f:	48 8d 15 06 0f 00 00 	lea    0xf06(%rip),%rdx        # 1e9c <malloc+0x46c>
+     f96:	48 89 d6             	mov    %rdx,%rsi
+     f99:	89 c7                	mov    %eax,%edi
+     f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+     fa0:	e8 09 02 00 00       	call   11ae <printf>
+}
+     fa5:	90                   	nop
+     fa6:	c9                   	leave
+     fa7:	c3                   	ret
+
+0000000000000fa8 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     fa8:	55                   	push   %rbp
+     fa9:	48 89 e5             	mov    %rsp,%rbp
+     fac:	48 83 ec 10          	sub    $0x10,%rsp
+     fb0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     fb3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  growtest();
+     fb7:	e8 44 f0 ff ff       	call   0 <growtest>
+  forktest();
+     fbc:	e8 32 f6 ff ff       	call   5f3 <forktest>
+  polltest();
+     fc1:	e8 e8 f8 ff ff       	call   8ae <polltest>
+  limittest();
+     fc6:	e8 ee fb ff ff       	call   bb9 <limittest>
+  printf(stdout, "fdtest passed!!\n");
+     fcb:	8b 05 cf 11 00 00    	mov    0x11cf(%rip),%eax        # 21a0 <stdout>
+     fd1:	48 8d 15 d2 0e 00 00 	lea    0xed2(%rip),%rdx        # 1eaa <malloc+0x47a>
+     fd8:	48 89 d6             	mov    %rdx,%rsi
+     fdb:	89 c7                	mov    %eax,%edi
+     fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe2:	e8 c7 01 00 00       	call   11ae <printf>
+  exit();
+     fe7:	e8 69 07 00 00       	call   1755 <exit>
+
+0000000000000fec <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     fec:	55                   	push   %rbp
+     fed:	48 89 e5             	mov    %rsp,%rbp
+     ff0:	48 83 ec 10          	sub    $0x10,%rsp
+     ff4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     ff7:	89 f0                	mov    %esi,%eax
+     ff9:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     ffc:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1000:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1003:	ba 01 00 00 00       	mov    $0x1,%edx
+    1008:	48 89 ce             	mov    %rcx,%rsi
+    100b:	89 c7                	mov    %eax,%edi
+    100d:	e8 63 07 00 00       	call   1775 <write>
+}
+    1012:	90                   	nop
+    1013:	c9                   	leave
+    1014:	c3                   	ret
+
+0000000000001015 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    1015:	55                   	push   %rbp
+    1016:	48 89 e5             	mov    %rsp,%rbp
+    1019:	48 83 ec 40          	sub    $0x40,%rsp
+    101d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1020:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1023:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1026:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    1029:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    102d:	74 1f                	je     104e <printint64+0x39>
+    102f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1032:	c1 e8 1f             	shr    $0x1f,%eax
+    1035:	0f b6 c0             	movzbl %al,%eax
+    1038:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    103b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    103f:	74 0d                	je     104e <printint64+0x39>
+    x = -xx;
+    1041:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1044:	f7 d8                	neg    %eax
+    1046:	48 98                	cltq
+    1048:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    104c:	eb 09                	jmp    1057 <printint64+0x42>
+  else
+    x = xx;
+    104e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1051:	48 98                	cltq
+    1053:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1057:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    105e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1061:	48 63 c8             	movslq %eax,%rcx
+    1064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1068:	ba 00 00 00 00       	mov    $0x0,%edx
+    106d:	48 f7 f1             	div    %rcx
+    1070:	48 89 d1             	mov    %rdx,%rcx
+    1073:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1076:	8d 50 01             	lea    0x1(%rax),%edx
+    1079:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    107c:	48 8d 15 2d 11 00 00 	lea    0x112d(%rip),%rdx        # 21b0 <digits.1>
+    1083:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1087:	48 98                	cltq
+    1089:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    108d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1090:	48 63 f0             	movslq %eax,%rsi
+    1093:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1097:	ba 00 00 00 00       	mov    $0x0,%edx
+    109c:	48 f7 f6             	div    %rsi
+    109f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    10a3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    10a8:	75 b4                	jne    105e <printint64+0x49>
+
+  if(sgn)
+    10aa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    10ae:	74 2b                	je     10db <printint64+0xc6>
+    buf[i++] = '-';
+    10b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10b3:	8d 50 01             	lea    0x1(%rax),%edx
+    10b6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    10b9:	48 98                	cltq
+    10bb:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    10c0:	eb 19                	jmp    10db <printint64+0xc6>
+    putc(fd, buf[i]);
+    10c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10c5:	48 98                	cltq
+    10c7:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    10cc:	0f be d0             	movsbl %al,%edx
+    10cf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    10d2:	89 d6                	mov    %edx,%esi
+    10d4:	89 c7                	mov    %eax,%edi
+    10d6:	e8 11 ff ff ff       	call   fec <putc>
+  while(--i >= 0)
+    10db:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    10df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    10e3:	79 dd                	jns    10c2 <printint64+0xad>
+}
+    10e5:	90                   	nop
+    10e6:	90                   	nop
+    10e7:	c9                   	leave
+    10e8:	c3                   	ret
+
+00000000000010e9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    10e9:	55                   	push   %rbp
+    10ea:	48 89 e5             	mov    %rsp,%rbp
+    10ed:	48 83 ec 30          	sub    $0x30,%rsp
+    10f1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    10f4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    10f7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    10fa:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    10fd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    1104:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1108:	74 17                	je     1121 <printint+0x38>
+    110a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    110e:	79 11                	jns    1121 <printint+0x38>
+    neg = 1;
+    1110:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1117:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    111a:	f7 d8                	neg    %eax
+    111c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    111f:	eb 06                	jmp    1127 <printint+0x3e>
+  } else {
+    x = xx;
+    1121:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1124:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1127:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    112e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1131:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1134:	ba 00 00 00 00       	mov    $0x0,%edx
+    1139:	f7 f1                	div    %ecx
+    113b:	89 d1                	mov    %edx,%ecx
+    113d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1140:	8d 50 01             	lea    0x1(%rax),%edx
+    1143:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1146:	89 c9                	mov    %ecx,%ecx
+    1148:	48 8d 15 81 10 00 00 	lea    0x1081(%rip),%rdx        # 21d0 <digits.0>
+    114f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1153:	48 98                	cltq
+    1155:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1159:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    115c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    115f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1164:	f7 f6                	div    %esi
+    1166:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1169:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    116d:	75 bf                	jne    112e <printint+0x45>
+  if(neg)
+    116f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1173:	74 2b                	je     11a0 <printint+0xb7>
+    buf[i++] = '-';
+    1175:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1178:	8d 50 01             	lea    0x1(%rax),%edx
+    117b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    117e:	48 98                	cltq
+    1180:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1185:	eb 19                	jmp    11a0 <printint+0xb7>
+    putc(fd, buf[i]);
+    1187:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    118a:	48 98                	cltq
+    118c:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1191:	0f be d0             	movsbl %al,%edx
+    1194:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1197:	89 d6                	mov    %edx,%esi
+    1199:	89 c7                	mov    %eax,%edi
+    119b:	e8 4c fe ff ff       	call   fec <putc>
+  while(--i >= 0)
+    11a0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    11a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    11a8:	79 dd                	jns    1187 <printint+0x9e>
+}
+    11aa:	90                   	nop
+    11ab:	90                   	nop
+    11ac:	c9                   	leave
+    11ad:	c3                   	ret
+
+00000000000011ae <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    11ae:	55                   	push   %rbp
+    11af:	48 89 e5             	mov    %rsp,%rbp
+    11b2:	48 83 ec 70          	sub    $0x70,%rsp
+    11b6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    11b9:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    11bd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    11c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    11c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    11c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    11cd:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    11d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    11d8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    11dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    11e0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    11e4:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    11eb:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    11f2:	e9 6b 02 00 00       	jmp    1462 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    11f7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    11fa:	48 63 d0             	movslq %eax,%rdx
+    11fd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1201:	48 01 d0             	add    %rdx,%rax
+    1204:	0f b6 00             	movzbl (%rax),%eax
+    1207:	0f be c0             	movsbl %al,%eax
+    120a:	25 ff 00 00 00       	and    $0xff,%eax
+    120f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    1212:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1216:	75 30                	jne    1248 <printf+0x9a>
+      if(c == '%'){
+    1218:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    121c:	75 13                	jne    1231 <printf+0x83>
+        state = '%';
+    121e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1225:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    122c:	e9 2d 02 00 00       	jmp    145e <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1231:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1234:	0f be d0             	movsbl %al,%edx
+    1237:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    123a:	89 d6                	mov    %edx,%esi
+    123c:	89 c7                	mov    %eax,%edi
+    123e:	e8 a9 fd ff ff       	call   fec <putc>
+    1243:	e9 16 02 00 00       	jmp    145e <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    1248:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    124c:	0f 85 0c 02 00 00    	jne    145e <printf+0x2b0>
+      if(c == 'l') {
+    1252:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1256:	75 0c                	jne    1264 <printf+0xb6>
+        lflag = 1;
+    1258:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    125f:	e9 fa 01 00 00       	jmp    145e <printf+0x2b0>
+      } else if(c == 'd'){
+    1264:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1268:	0f 85 95 00 00 00    	jne    1303 <printf+0x155>
+        if (lflag == 1)
+    126e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1272:	75 49                	jne    12bd <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1274:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1277:	83 f8 2f             	cmp    $0x2f,%eax
+    127a:	77 17                	ja     1293 <printf+0xe5>
+    127c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1280:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1283:	89 d2                	mov    %edx,%edx
+    1285:	48 01 d0             	add    %rdx,%rax
+    1288:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    128b:	83 c2 08             	add    $0x8,%edx
+    128e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1291:	eb 0c                	jmp    129f <printf+0xf1>
+    1293:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1297:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    129b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    129f:	48 8b 00             	mov    (%rax),%rax
+    12a2:	89 c6                	mov    %eax,%esi
+    12a4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12ac:	ba 0a 00 00 00       	mov    $0xa,%edx
+    12b1:	89 c7                	mov    %eax,%edi
+    12b3:	e8 5d fd ff ff       	call   1015 <printint64>
+    12b8:	e9 9a 01 00 00       	jmp    1457 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    12bd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    12c0:	83 f8 2f             	cmp    $0x2f,%eax
+    12c3:	77 17                	ja     12dc <printf+0x12e>
+    12c5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    12c9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    12cc:	89 d2                	mov    %edx,%edx
+    12ce:	48 01 d0             	add    %rdx,%rax
+    12d1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    12d4:	83 c2 08             	add    $0x8,%edx
+    12d7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    12da:	eb 0c                	jmp    12e8 <printf+0x13a>
+    12dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    12e0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    12e4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    12e8:	8b 30                	mov    (%rax),%esi
+    12ea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12ed:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12f2:	ba 0a 00 00 00       	mov    $0xa,%edx
+    12f7:	89 c7                	mov    %eax,%edi
+    12f9:	e8 eb fd ff ff       	call   10e9 <printint>
+    12fe:	e9 54 01 00 00       	jmp    1457 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    1303:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1307:	74 0a                	je     1313 <printf+0x165>
+    1309:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    130d:	0f 85 95 00 00 00    	jne    13a8 <printf+0x1fa>
+        if (lflag == 1)
+    1313:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1317:	75 49                	jne    1362 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1319:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    131c:	83 f8 2f             	cmp    $0x2f,%eax
+    131f:	77 17                	ja     1338 <printf+0x18a>
+    1321:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1325:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1328:	89 d2                	mov    %edx,%edx
+    132a:	48 01 d0             	add    %rdx,%rax
+    132d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1330:	83 c2 08             	add    $0x8,%edx
+    1333:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1336:	eb 0c                	jmp    1344 <printf+0x196>
+    1338:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    133c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1340:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1344:	48 8b 00             	mov    (%rax),%rax
+    1347:	89 c6                	mov    %eax,%esi
+    1349:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    134c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1351:	ba 10 00 00 00       	mov    $0x10,%edx
+    1356:	89 c7                	mov    %eax,%edi
+    1358:	e8 b8 fc ff ff       	call   1015 <printint64>
+        if (lflag == 1)
+    135d:	e9 f5 00 00 00       	jmp    1457 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1362:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1365:	83 f8 2f             	cmp    $0x2f,%eax
+    1368:	77 17                	ja     1381 <printf+0x1d3>
+    136a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    136e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1371:	89 d2                	mov    %edx,%edx
+    1373:	48 01 d0             	add    %rdx,%rax
+    1376:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1379:	83 c2 08             	add    $0x8,%edx
+    137c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    137f:	eb 0c                	jmp    138d <printf+0x1df>
+    1381:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1385:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1389:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    138d:	8b 30                	mov    (%rax),%esi
+    138f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1392:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1397:	ba 10 00 00 00       	mov    $0x10,%edx
+    139c:	89 c7                	mov    %eax,%edi
+    139e:	e8 46 fd ff ff       	call   10e9 <printint>
+        if (lflag == 1)
+    13a3:	e9 af 00 00 00       	jmp    1457 <printf+0x2a9>
+      } else if(c == 's'){
+    13a8:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    13ac:	75 6e                	jne    141c <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    13ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13b1:	83 f8 2f             	cmp    $0x2f,%eax
+    13b4:	77 17                	ja     13cd <printf+0x21f>
+    13b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13bd:	89 d2                	mov    %edx,%edx
+    13bf:	48 01 d0             	add    %rdx,%rax
+    13c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13c5:	83 c2 08             	add    $0x8,%edx
+    13c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    13cb:	eb 0c                	jmp    13d9 <printf+0x22b>
+    13cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    13d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    13d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13d9:	48 8b 00             	mov    (%rax),%rax
+    13dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    13e0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    13e5:	75 28                	jne    140f <printf+0x261>
+          s = "(null)";
+    13e7:	48 8d 05 cd 0a 00 00 	lea    0xacd(%rip),%rax        # 1ebb <malloc+0x48b>
+    13ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    13f2:	eb 1b                	jmp    140f <printf+0x261>
+          putc(fd, *s);
+    13f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    13f8:	0f b6 00             	movzbl (%rax),%eax
+    13fb:	0f be d0             	movsbl %al,%edx
+    13fe:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1401:	89 d6                	mov    %edx,%esi
+    1403:	89 c7                	mov    %eax,%edi
+    1405:	e8 e2 fb ff ff       	call   fec <putc>
+        for(; *s; s++)
+    140a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    140f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1413:	0f b6 00             	movzbl (%rax),%eax
+    1416:	84 c0                	test   %al,%al
+    1418:	75 da                	jne    13f4 <printf+0x246>
+    141a:	eb 3b                	jmp    1457 <printf+0x2a9>
+      } else if(c == '%'){
+    141c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1420:	75 14                	jne    1436 <printf+0x288>
+        putc(fd, c);
+    1422:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1425:	0f be d0             	movsbl %al,%edx
+    1428:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    142b:	89 d6                	mov    %edx,%esi
+    142d:	89 c7                	mov    %eax,%edi
+    142f:	e8 b8 fb ff ff       	call   fec <putc>
+    1434:	eb 21                	jmp    1457 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1436:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1439:	be 25 00 00 00       	mov    $0x25,%esi
+    143e:	89 c7                	mov    %eax,%edi
+    1440:	e8 a7 fb ff ff       	call   fec <putc>
+        putc(fd, c);
+    1445:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1448:	0f be d0             	movsbl %al,%edx
+    144b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    144e:	89 d6                	mov    %edx,%esi
+    1450:	89 c7                	mov    %eax,%edi
+    1452:	e8 95 fb ff ff       	call   fec <putc>
+      }
+      state = 0;
+    1457:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    145e:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1462:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1465:	48 63 d0             	movslq %eax,%rdx
+    1468:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    146c:	48 01 d0             	add    %rdx,%rax
+    146f:	0f b6 00             	movzbl (%rax),%eax
+    1472:	84 c0                	test   %al,%al
+    1474:	0f 85 7d fd ff ff    	jne    11f7 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    147a:	90                   	nop
+    147b:	90                   	nop
+    147c:	c9                   	leave
+    147d:	c3                   	ret
+
+000000000000147e <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    147e:	55                   	push   %rbp
+    147f:	48 89 e5             	mov    %rsp,%rbp
+    1482:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1486:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1489:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    148c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1490:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1493:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1496:	48 89 ce             	mov    %rcx,%rsi
+    1499:	48 89 f7             	mov    %rsi,%rdi
+    149c:	89 d1                	mov    %edx,%ecx
+    149e:	fc                   	cld
+    149f:	f3 aa                	rep stos %al,%es:(%rdi)
+    14a1:	89 ca                	mov    %ecx,%edx
+    14a3:	48 89 fe             	mov    %rdi,%rsi
+    14a6:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    14aa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    14ad:	90                   	nop
+    14ae:	5d                   	pop    %rbp
+    14af:	c3                   	ret
+
+00000000000014b0 <strcpy>:
+{
+    14b0:	55                   	push   %rbp
+    14b1:	48 89 e5             	mov    %rsp,%rbp
+    14b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    14bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    14c4:	90                   	nop
+    14c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    14c9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    14cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    14d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14d5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    14d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    14dd:	0f b6 12             	movzbl (%rdx),%edx
+    14e0:	88 10                	mov    %dl,(%rax)
+    14e2:	0f b6 00             	movzbl (%rax),%eax
+    14e5:	84 c0                	test   %al,%al
+    14e7:	75 dc                	jne    14c5 <strcpy+0x15>
+  return os;
+    14e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    14ed:	5d                   	pop    %rbp
+    14ee:	c3                   	ret
+
+00000000000014ef <strcmp>:
+{
+    14ef:	55                   	push   %rbp
+    14f0:	48 89 e5             	mov    %rsp,%rbp
+    14f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    14fb:	eb 0a                	jmp    1507 <strcmp+0x18>
+    p++, q++;
+    14fd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1502:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1507:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    150b:	0f b6 00             	movzbl (%rax),%eax
+    150e:	84 c0                	test   %al,%al
+    1510:	74 12                	je     1524 <strcmp+0x35>
+    1512:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1516:	0f b6 10             	movzbl (%rax),%edx
+    1519:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    151d:	0f b6 00             	movzbl (%rax),%eax
+    1520:	38 c2                	cmp    %al,%dl
+    1522:	74 d9                	je     14fd <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1528:	0f b6 00             	movzbl (%rax),%eax
+    152b:	0f b6 d0             	movzbl %al,%edx
+    152e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1532:	0f b6 00             	movzbl (%rax),%eax
+    1535:	0f b6 c0             	movzbl %al,%eax
+    1538:	29 c2                	sub    %eax,%edx
+    153a:	89 d0                	mov    %edx,%eax
+}
+    153c:	5d                   	pop    %rbp
+    153d:	c3                   	ret
+
+000000000000153e <strlen>:
+{
+    153e:	55                   	push   %rbp
+    153f:	48 89 e5             	mov    %rsp,%rbp
+    1542:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1546:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    154d:	eb 04                	jmp    1553 <strlen+0x15>
+    154f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1553:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1556:	48 63 d0             	movslq %eax,%rdx
+    1559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    155d:	48 01 d0             	add    %rdx,%rax
+    1560:	0f b6 00             	movzbl (%rax),%eax
+    1563:	84 c0                	test   %al,%al
+    1565:	75 e8                	jne    154f <strlen+0x11>
+  return n;
+    1567:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    156a:	5d                   	pop    %rbp
+    156b:	c3                   	ret
+
+000000000000156c <memset>:
+{
+    156c:	55                   	push   %rbp
+    156d:	48 89 e5             	mov    %rsp,%rbp
+    1570:	48 83 ec 10          	sub    $0x10,%rsp
+    1574:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1578:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    157b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    157e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1581:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1588:	89 ce                	mov    %ecx,%esi
+    158a:	48 89 c7             	mov    %rax,%rdi
+    158d:	e8 ec fe ff ff       	call   147e <stosb>
+  return dst;
+    1592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1596:	c9                   	leave
+    1597:	c3                   	ret
+
+0000000000001598 <strchr>:
+{
+    1598:	55                   	push   %rbp
+    1599:	48 89 e5             	mov    %rsp,%rbp
+    159c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15a0:	89 f0                	mov    %esi,%eax
+    15a2:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    15a5:	eb 17                	jmp    15be <strchr+0x26>
+    if(*s == c)
+    15a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15ab:	0f b6 00             	movzbl (%rax),%eax
+    15ae:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    15b1:	75 06                	jne    15b9 <strchr+0x21>
+      return (char*)s;
+    15b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b7:	eb 15                	jmp    15ce <strchr+0x36>
+  for(; *s; s++)
+    15b9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    15be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15c2:	0f b6 00             	movzbl (%rax),%eax
+    15c5:	84 c0                	test   %al,%al
+    15c7:	75 de                	jne    15a7 <strchr+0xf>
+  return 0;
+    15c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    15ce:	5d                   	pop    %rbp
+    15cf:	c3                   	ret
+
+00000000000015d0 <gets>:
+gets(char *buf, int max)
+{
+    15d0:	55                   	push   %rbp
+    15d1:	48 89 e5             	mov    %rsp,%rbp
+    15d4:	48 83 ec 20          	sub    $0x20,%rsp
+    15d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15dc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    15df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    15e6:	eb 48                	jmp    1630 <gets+0x60>
+    cc = read(0, &c, 1);
+    15e8:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    15ec:	ba 01 00 00 00       	mov    $0x1,%edx
+    15f1:	48 89 c6             	mov    %rax,%rsi
+    15f4:	bf 00 00 00 00       	mov    $0x0,%edi
+    15f9:	e8 6f 01 00 00       	call   176d <read>
+    15fe:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1601:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1605:	7e 36                	jle    163d <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1607:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    160a:	8d 50 01             	lea    0x1(%rax),%edx
+    160d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1610:	48 63 d0             	movslq %eax,%rdx
+    1613:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1617:	48 01 c2             	add    %rax,%rdx
+    161a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    161e:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1620:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1624:	3c 0a                	cmp    $0xa,%al
+    1626:	74 16                	je     163e <gets+0x6e>
+    1628:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    162c:	3c 0d                	cmp    $0xd,%al
+    162e:	74 0e                	je     163e <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1630:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1633:	83 c0 01             	add    $0x1,%eax
+    1636:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1639:	7f ad                	jg     15e8 <gets+0x18>
+    163b:	eb 01                	jmp    163e <gets+0x6e>
+      break;
+    163d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    163e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1641:	48 63 d0             	movslq %eax,%rdx
+    1644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1648:	48 01 d0             	add    %rdx,%rax
+    164b:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    164e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1652:	c9                   	leave
+    1653:	c3                   	ret
+
+0000000000001654 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1654:	55                   	push   %rbp
+    1655:	48 89 e5             	mov    %rsp,%rbp
+    1658:	48 83 ec 20          	sub    $0x20,%rsp
+    165c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1660:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1668:	be 00 00 00 00       	mov    $0x0,%esi
+    166d:	48 89 c7             	mov    %rax,%rdi
+    1670:	e8 20 01 00 00       	call   1795 <open>
+    1675:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1678:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    167c:	79 07                	jns    1685 <stat+0x31>
+    return -1;
+    167e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1683:	eb 21                	jmp    16a6 <stat+0x52>
+  r = fstat(fd, st);
+    1685:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1689:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    168c:	48 89 d6             	mov    %rdx,%rsi
+    168f:	89 c7                	mov    %eax,%edi
+    1691:	e8 17 01 00 00       	call   17ad <fstat>
+    1696:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1699:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    169c:	89 c7                	mov    %eax,%edi
+    169e:	e8 da 00 00 00       	call   177d <close>
+  return r;
+    16a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    16a6:	c9                   	leave
+    16a7:	c3                   	ret
+
+00000000000016a8 <atoi>:
+
+int
+atoi(const char *s)
+{
+    16a8:	55                   	push   %rbp
+    16a9:	48 89 e5             	mov    %rsp,%rbp
+    16ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    16b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    16b7:	eb 28                	jmp    16e1 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    16b9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    16bc:	89 d0                	mov    %edx,%eax
+    16be:	c1 e0 02             	shl    $0x2,%eax
+    16c1:	01 d0                	add    %edx,%eax
+    16c3:	01 c0                	add    %eax,%eax
+    16c5:	89 c1                	mov    %eax,%ecx
+    16c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16cb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    16cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    16d3:	0f b6 00             	movzbl (%rax),%eax
+    16d6:	0f be c0             	movsbl %al,%eax
+    16d9:	01 c8                	add    %ecx,%eax
+    16db:	83 e8 30             	sub    $0x30,%eax
+    16de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    16e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16e5:	0f b6 00             	movzbl (%rax),%eax
+    16e8:	3c 2f                	cmp    $0x2f,%al
+    16ea:	7e 0b                	jle    16f7 <atoi+0x4f>
+    16ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16f0:	0f b6 00             	movzbl (%rax),%eax
+    16f3:	3c 39                	cmp    $0x39,%al
+    16f5:	7e c2                	jle    16b9 <atoi+0x11>
+  return n;
+    16f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    16fa:	5d                   	pop    %rbp
+    16fb:	c3                   	ret
+
+00000000000016fc <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    16fc:	55                   	push   %rbp
+    16fd:	48 89 e5             	mov    %rsp,%rbp
+    1700:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1704:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1708:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    170b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    170f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1713:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1717:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    171b:	eb 1d                	jmp    173a <memmove+0x3e>
+    *dst++ = *src++;
+    171d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1721:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1725:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    172d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1731:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1735:	0f b6 12             	movzbl (%rdx),%edx
+    1738:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    173a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    173d:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1740:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1743:	85 c0                	test   %eax,%eax
+    1745:	7f d6                	jg     171d <memmove+0x21>
+  return vdst;
+    1747:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174b:	5d                   	pop    %rbp
+    174c:	c3                   	ret
+
+000000000000174d <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    174d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1752:	cd 40                	int    $0x40
+    1754:	c3                   	ret
+
+0000000000001755 <exit>:
+SYSCALL(exit)
+    1755:	b8 02 00 00 00       	mov    $0x2,%eax
+    175a:	cd 40                	int    $0x40
+    175c:	c3                   	ret
+
+000000000000175d <wait>:
+SYSCALL(wait)
+    175d:	b8 03 00 00 00       	mov    $0x3,%eax
+    1762:	cd 40                	int    $0x40
+    1764:	c3                   	ret
+
+0000000000001765 <pipe>:
+SYSCALL(pipe)
+    1765:	b8 04 00 00 00       	mov    $0x4,%eax
+    176a:	cd 40                	int    $0x40
+    176c:	c3                   	ret
+
+000000000000176d <read>:
+SYSCALL(read)
+    176d:	b8 05 00 00 00       	mov    $0x5,%eax
+    1772:	cd 40                	int    $0x40
+    1774:	c3                   	ret
+
+0000000000001775 <write>:
+SYSCALL(write)
+    1775:	b8 10 00 00 00       	mov    $0x10,%eax
+    177a:	cd 40                	int    $0x40
+    177c:	c3                   	ret
+
+000000000000177d <close>:
+SYSCALL(close)
+    177d:	b8 15 00 00 00       	mov    $0x15,%eax
+    1782:	cd 40                	int    $0x40
+    1784:	c3                   	ret
+
+0000000000001785 <kill>:
+SYSCALL(kill)
+    1785:	b8 06 00 00 00       	mov    $0x6,%eax
+    178a:	cd 40                	int    $0x40
+    178c:	c3                   	ret
+
+000000000000178d <exec>:
+SYSCALL(exec)
+    178d:	b8 07 00 00 00       	mov    $0x7,%eax
+    1792:	cd 40                	int    $0x40
+    1794:	c3                   	ret
+
+0000000000001795 <open>:
+SYSCALL(open)
+    1795:	b8 0f 00 00 00       	mov    $0xf,%eax
+    179a:	cd 40                	int    $0x40
+    179c:	c3                   	ret
+
+000000000000179d <mknod>:
+SYSCALL(mknod)
+    179d:	b8 11 00 00 00       	mov    $0x11,%eax
+    17a2:	cd 40                	int    $0x40
+    17a4:	c3                   	ret
+
+00000000000017a5 <unlink>:
+SYSCALL(unlink)
+    17a5:	b8 12 00 00 00       	mov    $0x12,%eax
+    17aa:	cd 40                	int    $0x40
+    17ac:	c3                   	ret
+
+00000000000017ad <fstat>:
+SYSCALL(fstat)
+    17ad:	b8 08 00 00 00       	mov    $0x8,%eax
+    17b2:	cd 40                	int    $0x40
+    17b4:	c3                   	ret
+
+00000000000017b5 <link>:
+SYSCALL(link)
+    17b5:	b8 13 00 00 00       	mov    $0x13,%eax
+    17ba:	cd 40                	int    $0x40
+    17bc:	c3                   	ret
+
+00000000000017bd <mkdir>:
+SYSCALL(mkdir)
+    17bd:	b8 14 00 00 00       	mov    $0x14,%eax
+    17c2:	cd 40                	int    $0x40
+    17c4:	c3                   	ret
+
+00000000000017c5 <chdir>:
+SYSCALL(chdir)
+    17c5:	b8 09 00 00 00       	mov    $0x9,%eax
+    17ca:	cd 40                	int    $0x40
+    17cc:	c3                   	ret
+
+00000000000017cd <dup>:
+SYSCALL(dup)
+    17cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+    17d2:	cd 40                	int    $0x40
+    17d4:	c3                   	ret
+
+00000000000017d5 <getpid>:
+SYSCALL(getpid)
+    17d5:	b8 0b 00 00 00       	mov    $0xb,%eax
+    17da:	cd 40                	int    $0x40
+    17dc:	c3                   	ret
+
+00000000000017dd <sbrk>:
+SYSCALL(sbrk)
+    17dd:	b8 0c 00 00 00       	mov    $0xc,%eax
+    17e2:	cd 40                	int    $0x40
+    17e4:	c3                   	ret
+
+00000000000017e5 <sleep>:
+SYSCALL(sleep)
+    17e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+    17ea:	cd 40                	int    $0x40
+    17ec:	c3                   	ret
+
+00000000000017ed <uptime>:
+SYSCALL(uptime)
+    17ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+    17f2:	cd 40                	int    $0x40
+    17f4:	c3                   	ret
+
+00000000000017f5 <sysinfo>:
+SYSCALL(sysinfo)
+    17f5:	b8 16 00 00 00       	mov    $0x16,%eax
+    17fa:	cd 40                	int    $0x40
+    17fc:	c3                   	ret
+
+00000000000017fd <mmap>:
+SYSCALL(mmap)
+    17fd:	b8 17 00 00 00       	mov    $0x17,%eax
+    1802:	cd 40                	int    $0x40
+    1804:	c3                   	ret
+
+0000000000001805 <munmap>:
+SYSCALL(munmap)
+    1805:	b8 18 00 00 00       	mov    $0x18,%eax
+    180a:	cd 40                	int    $0x40
+    180c:	c3                   	ret
+
+000000000000180d <crashn>:
+SYSCALL(crashn)
+    180d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1812:	cd 40                	int    $0x40
+    1814:	c3                   	ret
+
+0000000000001815 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1815:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    181a:	cd 40                	int    $0x40
+    181c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    181f:	74 02                	je     1823 <mmap2+0xe>
+    1821:	89 c0                	mov    %eax,%eax
+    1823:	c3                   	ret
+
+0000000000001824 <munmap2>:
+SYSCALL(munmap2)
+    1824:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1829:	cd 40                	int    $0x40
+    182b:	c3                   	ret
+
+000000000000182c <msync>:
+SYSCALL(msync)
+    182c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1831:	cd 40                	int    $0x40
+    1833:	c3                   	ret
+
+0000000000001834 <sendfile>:
+SYSCALL(sendfile)
+    1834:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1839:	cd 40                	int    $0x40
+    183b:	c3                   	ret
+
+000000000000183c <splice>:
+SYSCALL(splice)
+    183c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1841:	cd 40                	int    $0x40
+    1843:	c3                   	ret
+
+0000000000001844 <pread>:
+SYSCALL(pread)
+    1844:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1849:	cd 40                	int    $0x40
+    184b:	c3                   	ret
+
+000000000000184c <pwrite>:
+SYSCALL(pwrite)
+    184c:	b8 20 00 00 00       	mov    $0x20,%eax
+    1851:	cd 40                	int    $0x40
+    1853:	c3                   	ret
+
+0000000000001854 <readv>:
+SYSCALL(readv)
+    1854:	b8 21 00 00 00       	mov    $0x21,%eax
+    1859:	cd 40                	int    $0x40
+    185b:	c3                   	ret
+
+000000000000185c <writev>:
+SYSCALL(writev)
+    185c:	b8 22 00 00 00       	mov    $0x22,%eax
+    1861:	cd 40                	int    $0x40
+    1863:	c3                   	ret
+
+0000000000001864 <poll>:
+SYSCALL(poll)
+    1864:	b8 23 00 00 00       	mov    $0x23,%eax
+    1869:	cd 40                	int    $0x40
+    186b:	c3                   	ret
+
+000000000000186c <pipe2>:
+SYSCALL(pipe2)
+    186c:	b8 24 00 00 00       	mov    $0x24,%eax
+    1871:	cd 40                	int    $0x40
+    1873:	c3                   	ret
+
+0000000000001874 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1874:	55                   	push   %rbp
+    1875:	48 89 e5             	mov    %rsp,%rbp
+    1878:	48 83 ec 20          	sub    $0x20,%rsp
+    187c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1880:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1884:	48 83 e8 10          	sub    $0x10,%rax
+    1888:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    188c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1890:	48 8b 10             	mov    (%rax),%rdx
+    1893:	48 8d 05 86 09 00 00 	lea    0x986(%rip),%rax        # 2220 <bigblock>
+    189a:	48 39 c2             	cmp    %rax,%rdx
+    189d:	75 1f                	jne    18be <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    189f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a3:	8b 40 08             	mov    0x8(%rax),%eax
+    18a6:	c1 e0 04             	shl    $0x4,%eax
+    18a9:	89 c2                	mov    %eax,%edx
+    18ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18af:	89 d6                	mov    %edx,%esi
+    18b1:	48 89 c7             	mov    %rax,%rdi
+    18b4:	e8 6b ff ff ff       	call   1824 <munmap2>
+    return;
+    18b9:	e9 0b 01 00 00       	jmp    19c9 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18be:	48 8b 05 4b 09 00 00 	mov    0x94b(%rip),%rax        # 2210 <freep>
+    18c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18c9:	eb 2f                	jmp    18fa <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    18cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18cf:	48 8b 00             	mov    (%rax),%rax
+    18d2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    18d6:	72 17                	jb     18ef <free+0x7b>
+    18d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18dc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    18e0:	72 2f                	jb     1911 <free+0x9d>
+    18e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e6:	48 8b 00             	mov    (%rax),%rax
+    18e9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    18ed:	72 22                	jb     1911 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    18ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18f3:	48 8b 00             	mov    (%rax),%rax
+    18f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    18fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18fe:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1902:	73 c7                	jae    18cb <free+0x57>
+    1904:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1908:	48 8b 00             	mov    (%rax),%rax
+    190b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    190f:	73 ba                	jae    18cb <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1911:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1915:	8b 40 08             	mov    0x8(%rax),%eax
+    1918:	89 c0                	mov    %eax,%eax
+    191a:	48 c1 e0 04          	shl    $0x4,%rax
+    191e:	48 89 c2             	mov    %rax,%rdx
+    1921:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1925:	48 01 c2             	add    %rax,%rdx
+    1928:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    192c:	48 8b 00             	mov    (%rax),%rax
+    192f:	48 39 c2             	cmp    %rax,%rdx
+    1932:	75 2d                	jne    1961 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1938:	8b 50 08             	mov    0x8(%rax),%edx
+    193b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    193f:	48 8b 00             	mov    (%rax),%rax
+    1942:	8b 40 08             	mov    0x8(%rax),%eax
+    1945:	01 c2                	add    %eax,%edx
+    1947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    194b:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    194e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1952:	48 8b 00             	mov    (%rax),%rax
+    1955:	48 8b 10             	mov    (%rax),%rdx
+    1958:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195c:	48 89 10             	mov    %rdx,(%rax)
+    195f:	eb 0e                	jmp    196f <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1961:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1965:	48 8b 10             	mov    (%rax),%rdx
+    1968:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    196c:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    196f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1973:	8b 40 08             	mov    0x8(%rax),%eax
+    1976:	89 c0                	mov    %eax,%eax
+    1978:	48 c1 e0 04          	shl    $0x4,%rax
+    197c:	48 89 c2             	mov    %rax,%rdx
+    197f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1983:	48 01 d0             	add    %rdx,%rax
+    1986:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    198a:	75 27                	jne    19b3 <free+0x13f>
+    p->s.size += bp->s.size;
+    198c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1990:	8b 50 08             	mov    0x8(%rax),%edx
+    1993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1997:	8b 40 08             	mov    0x8(%rax),%eax
+    199a:	01 c2                	add    %eax,%edx
+    199c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a0:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    19a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19a7:	48 8b 10             	mov    (%rax),%rdx
+    19aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ae:	48 89 10             	mov    %rdx,(%rax)
+    19b1:	eb 0b                	jmp    19be <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    19b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    19bb:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    19be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c2:	48 89 05 47 08 00 00 	mov    %rax,0x847(%rip)        # 2210 <freep>
+}
+    19c9:	c9                   	leave
+    19ca:	c3                   	ret
+
+00000000000019cb <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    19cb:	55                   	push   %rbp
+    19cc:	48 89 e5             	mov    %rsp,%rbp
+    19cf:	48 83 ec 20          	sub    $0x20,%rsp
+    19d3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    19d6:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    19dd:	77 07                	ja     19e6 <morecore+0x1b>
+    nu = 4096;
+    19df:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    19e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    19e9:	c1 e0 04             	shl    $0x4,%eax
+    19ec:	89 c7                	mov    %eax,%edi
+    19ee:	e8 ea fd ff ff       	call   17dd <sbrk>
+    19f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    19f7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    19fc:	75 07                	jne    1a05 <morecore+0x3a>
+    return 0;
+    19fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a03:	eb 29                	jmp    1a2e <morecore+0x63>
+  hp = (Header*)p;
+    1a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a09:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1a0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a11:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1a14:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1a17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a1b:	48 83 c0 10          	add    $0x10,%rax
+    1a1f:	48 89 c7             	mov    %rax,%rdi
+    1a22:	e8 4d fe ff ff       	call   1874 <free>
+  return freep;
+    1a27:	48 8b 05 e2 07 00 00 	mov    0x7e2(%rip),%rax        # 2210 <freep>
+}
+    1a2e:	c9                   	leave
+    1a2f:	c3                   	ret
+
+0000000000001a30 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a30:	55                   	push   %rbp
+    1a31:	48 89 e5             	mov    %rsp,%rbp
+    1a34:	48 83 ec 30          	sub    $0x30,%rsp
+    1a38:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a3e:	48 83 c0 0f          	add    $0xf,%rax
+    1a42:	48 c1 e8 04          	shr    $0x4,%rax
+    1a46:	83 c0 01             	add    $0x1,%eax
+    1a49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1a4c:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1a53:	76 62                	jbe    1ab7 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1a55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a58:	c1 e0 04             	shl    $0x4,%eax
+    1a5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1a61:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1a67:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1a6c:	ba 03 00 00 00       	mov    $0x3,%edx
+    1a71:	89 c6                	mov    %eax,%esi
+    1a73:	bf 00 00 00 00       	mov    $0x0,%edi
+    1a78:	e8 98 fd ff ff       	call   1815 <mmap2>
+    1a7d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1a81:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1a86:	75 0a                	jne    1a92 <malloc+0x62>
+      return 0;
+    1a88:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a8d:	e9 1c 01 00 00       	jmp    1bae <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1a92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a96:	48 8d 15 83 07 00 00 	lea    0x783(%rip),%rdx        # 2220 <bigblock>
+    1a9d:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aa4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1aa7:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1aaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aae:	48 83 c0 10          	add    $0x10,%rax
+    1ab2:	e9 f7 00 00 00       	jmp    1bae <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1ab7:	48 8b 05 52 07 00 00 	mov    0x752(%rip),%rax        # 2210 <freep>
+    1abe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ac2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ac7:	75 2e                	jne    1af7 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1ac9:	48 8d 05 30 07 00 00 	lea    0x730(%rip),%rax        # 2200 <base>
+    1ad0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ad4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad8:	48 89 05 31 07 00 00 	mov    %rax,0x731(%rip)        # 2210 <freep>
+    1adf:	48 8b 05 2a 07 00 00 	mov    0x72a(%rip),%rax        # 2210 <freep>
+    1ae6:	48 89 05 13 07 00 00 	mov    %rax,0x713(%rip)        # 2200 <base>
+    base.s.size = 0;
+    1aed:	c7 05 11 07 00 00 00 	movl   $0x0,0x711(%rip)        # 2208 <base+0x8>
+    1af4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1af7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1afb:	48 8b 00             	mov    (%rax),%rax
+    1afe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1b02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b06:	8b 40 08             	mov    0x8(%rax),%eax
+    1b09:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1b0c:	72 5f                	jb     1b6d <malloc+0x13d>
+      if(p->s.size == nunits)
+    1b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b12:	8b 40 08             	mov    0x8(%rax),%eax
+    1b15:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1b18:	75 10                	jne    1b2a <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1b1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b1e:	48 8b 10             	mov    (%rax),%rdx
+    1b21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b25:	48 89 10             	mov    %rdx,(%rax)
+    1b28:	eb 2e                	jmp    1b58 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1b2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b2e:	8b 40 08             	mov    0x8(%rax),%eax
+    1b31:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1b34:	89 c2                	mov    %eax,%edx
+    1b36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b3a:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1b3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b41:	8b 40 08             	mov    0x8(%rax),%eax
+    1b44:	89 c0                	mov    %eax,%eax
+    1b46:	48 c1 e0 04          	shl    $0x4,%rax
+    1b4a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1b4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b52:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b55:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1b58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b5c:	48 89 05 ad 06 00 00 	mov    %rax,0x6ad(%rip)        # 2210 <freep>
+      return (void*)(p + 1);
+    1b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b67:	48 83 c0 10          	add    $0x10,%rax
+    1b6b:	eb 41                	jmp    1bae <malloc+0x17e>
+    }
+    if(p == freep)
+    1b6d:	48 8b 05 9c 06 00 00 	mov    0x69c(%rip),%rax        # 2210 <freep>
+    1b74:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1b78:	75 1c                	jne    1b96 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1b7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b7d:	89 c7                	mov    %eax,%edi
+    1b7f:	e8 47 fe ff ff       	call   19cb <morecore>
+    1b84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1b88:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1b8d:	75 07                	jne    1b96 <malloc+0x166>
+        return 0;
+    1b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b94:	eb 18                	jmp    1bae <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1b96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba2:	48 8b 00             	mov    (%rax),%rax
+    1ba5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1ba9:	e9 54 ff ff ff       	jmp    1b02 <malloc+0xd2>
+  }
+}
+    1bae:	c9                   	leave
+    1baf:	c3                   	ret
@@ -0,0 +1,1778 @@
+
+out/user/_grep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 30          	sub    $0x30,%rsp
+   8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+   c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  int n, m;
+  char *p, *q;
+
+  m = 0;
+   f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  16:	e9 da 00 00 00       	jmp    f5 <grep+0xf5>
+    m += n;
+  1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  1e:	01 45 fc             	add    %eax,-0x4(%rbp)
+    buf[m] = '\0';
+  21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  24:	48 98                	cltq
+  26:	48 8d 15 13 13 00 00 	lea    0x1313(%rip),%rdx        # 1340 <buf>
+  2d:	c6 04 10 00          	movb   $0x0,(%rax,%rdx,1)
+    p = buf;
+  31:	48 8d 05 08 13 00 00 	lea    0x1308(%rip),%rax        # 1340 <buf>
+  38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    while((q = strchr(p, '\n')) != 0){
+  3c:	eb 50                	jmp    8e <grep+0x8e>
+      *q = 0;
+  3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  42:	c6 00 00             	movb   $0x0,(%rax)
+      if(match(pattern, p)){
+  45:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  4d:	48 89 d6             	mov    %rdx,%rsi
+  50:	48 89 c7             	mov    %rax,%rdi
+  53:	e8 d5 01 00 00       	call   22d <match>
+  58:	85 c0                	test   %eax,%eax
+  5a:	74 26                	je     82 <grep+0x82>
+        *q = '\n';
+  5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  60:	c6 00 0a             	movb   $0xa,(%rax)
+        write(1, p, q+1 - p);
+  63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  67:	48 83 c0 01          	add    $0x1,%rax
+  6b:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  6f:	89 c2                	mov    %eax,%edx
+  71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  75:	48 89 c6             	mov    %rax,%rsi
+  78:	bf 01 00 00 00       	mov    $0x1,%edi
+  7d:	e8 cd 0a 00 00       	call   b4f <write>
+      }
+      p = q+1;
+  82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  86:	48 83 c0 01          	add    $0x1,%rax
+  8a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    while((q = strchr(p, '\n')) != 0){
+  8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  92:	be 0a 00 00 00       	mov    $0xa,%esi
+  97:	48 89 c7             	mov    %rax,%rdi
+  9a:	e8 d3 08 00 00       	call   972 <strchr>
+  9f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  a3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  a8:	75 94                	jne    3e <grep+0x3e>
+    }
+    if(p == buf)
+  aa:	48 8d 05 8f 12 00 00 	lea    0x128f(%rip),%rax        # 1340 <buf>
+  b1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  b5:	75 07                	jne    be <grep+0xbe>
+      m = 0;
+  b7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    if(m > 0){
+  be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  c2:	7e 31                	jle    f5 <grep+0xf5>
+      m -= p - buf;
+  c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  c7:	48 8d 15 72 12 00 00 	lea    0x1272(%rip),%rdx        # 1340 <buf>
+  ce:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  d2:	48 29 d1             	sub    %rdx,%rcx
+  d5:	89 ca                	mov    %ecx,%edx
+  d7:	29 d0                	sub    %edx,%eax
+  d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      memmove(buf, p, m);
+  dc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  e3:	48 89 c6             	mov    %rax,%rsi
+  e6:	48 8d 05 53 12 00 00 	lea    0x1253(%rip),%rax        # 1340 <buf>
+  ed:	48 89 c7             	mov    %rax,%rdi
+  f0:	e8 e1 09 00 00       	call   ad6 <memmove>
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  f8:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  fd:	29 c2                	sub    %eax,%edx
+  ff:	89 d6                	mov    %edx,%esi
+ 101:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 104:	48 98                	cltq
+ 106:	48 8d 15 33 12 00 00 	lea    0x1233(%rip),%rdx        # 1340 <buf>
+ 10d:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+ 111:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ 114:	89 f2                	mov    %esi,%edx
+ 116:	48 89 ce             	mov    %rcx,%rsi
+ 119:	89 c7                	mov    %eax,%edi
+ 11b:	e8 27 0a 00 00       	call   b47 <read>
+ 120:	89 45 ec             	mov    %eax,-0x14(%rbp)
+ 123:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ 127:	0f 8f ee fe ff ff    	jg     1b <grep+0x1b>
+    }
+  }
+}
+ 12d:	90                   	nop
+ 12e:	90                   	nop
+ 12f:	c9                   	leave
+ 130:	c3                   	ret
+
+0000000000000131 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 131:	55                   	push   %rbp
+ 132:	48 89 e5             	mov    %rsp,%rbp
+ 135:	48 83 ec 30          	sub    $0x30,%rsp
+ 139:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 13c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+ 140:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+ 144:	7f 1e                	jg     164 <main+0x33>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 146:	48 8d 05 43 0e 00 00 	lea    0xe43(%rip),%rax        # f90 <malloc+0x186>
+ 14d:	48 89 c6             	mov    %rax,%rsi
+ 150:	bf 02 00 00 00       	mov    $0x2,%edi
+ 155:	b8 00 00 00 00       	mov    $0x0,%eax
+ 15a:	e8 29 04 00 00       	call   588 <printf>
+    exit();
+ 15f:	e8 cb 09 00 00       	call   b2f <exit>
+  }
+  pattern = argv[1];
+ 164:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 168:	48 8b 40 08          	mov    0x8(%rax),%rax
+ 16c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  if(argc <= 2){
+ 170:	83 7d dc 02          	cmpl   $0x2,-0x24(%rbp)
+ 174:	7f 16                	jg     18c <main+0x5b>
+    grep(pattern, 0);
+ 176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 17a:	be 00 00 00 00       	mov    $0x0,%esi
+ 17f:	48 89 c7             	mov    %rax,%rdi
+ 182:	e8 79 fe ff ff       	call   0 <grep>
+    exit();
+ 187:	e8 a3 09 00 00       	call   b2f <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+ 18c:	c7 45 fc 02 00 00 00 	movl   $0x2,-0x4(%rbp)
+ 193:	e9 84 00 00 00       	jmp    21c <main+0xeb>
+    if((fd = open(argv[i], 0)) < 0){
+ 198:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 19b:	48 98                	cltq
+ 19d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 1a4:	00 
+ 1a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 1a9:	48 01 d0             	add    %rdx,%rax
+ 1ac:	48 8b 00             	mov    (%rax),%rax
+ 1af:	be 00 00 00 00       	mov    $0x0,%esi
+ 1b4:	48 89 c7             	mov    %rax,%rdi
+ 1b7:	e8 b3 09 00 00       	call   b6f <open>
+ 1bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+ 1bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ 1c3:	79 38                	jns    1fd <main+0xcc>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 1c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1c8:	48 98                	cltq
+ 1ca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ 1d1:	00 
+ 1d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ 1d6:	48 01 d0             	add    %rdx,%rax
+ 1d9:	48 8b 00             	mov    (%rax),%rax
+ 1dc:	48 89 c2             	mov    %rax,%rdx
+ 1df:	48 8d 05 ca 0d 00 00 	lea    0xdca(%rip),%rax        # fb0 <malloc+0x1a6>
+ 1e6:	48 89 c6             	mov    %rax,%rsi
+ 1e9:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1ee:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1f3:	e8 90 03 00 00       	call   588 <printf>
+      exit();
+ 1f8:	e8 32 09 00 00       	call   b2f <exit>
+    }
+    grep(pattern, fd);
+ 1fd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ 200:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 204:	89 d6                	mov    %edx,%esi
+ 206:	48 89 c7             	mov    %rax,%rdi
+ 209:	e8 f2 fd ff ff       	call   0 <grep>
+    close(fd);
+ 20e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ 211:	89 c7                	mov    %eax,%edi
+ 213:	e8 3f 09 00 00       	call   b57 <close>
+  for(i = 2; i < argc; i++){
+ 218:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 21c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 21f:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ 222:	0f 8c 70 ff ff ff    	jl     198 <main+0x67>
+  }
+  exit();
+ 228:	e8 02 09 00 00       	call   b2f <exit>
+
+000000000000022d <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 22d:	55                   	push   %rbp
+ 22e:	48 89 e5             	mov    %rsp,%rbp
+ 231:	48 83 ec 10          	sub    $0x10,%rsp
+ 235:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 239:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(re[0] == '^')
+ 23d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 241:	0f b6 00             	movzbl (%rax),%eax
+ 244:	3c 5e                	cmp    $0x5e,%al
+ 246:	75 19                	jne    261 <match+0x34>
+    return matchhere(re+1, text);
+ 248:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 24c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 254:	48 89 c6             	mov    %rax,%rsi
+ 257:	48 89 d7             	mov    %rdx,%rdi
+ 25a:	e8 3a 00 00 00       	call   299 <matchhere>
+ 25f:	eb 36                	jmp    297 <match+0x6a>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+ 261:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 265:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 269:	48 89 d6             	mov    %rdx,%rsi
+ 26c:	48 89 c7             	mov    %rax,%rdi
+ 26f:	e8 25 00 00 00       	call   299 <matchhere>
+ 274:	85 c0                	test   %eax,%eax
+ 276:	74 07                	je     27f <match+0x52>
+      return 1;
+ 278:	b8 01 00 00 00       	mov    $0x1,%eax
+ 27d:	eb 18                	jmp    297 <match+0x6a>
+  }while(*text++ != '\0');
+ 27f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 283:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 287:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+ 28b:	0f b6 00             	movzbl (%rax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	75 cf                	jne    261 <match+0x34>
+  return 0;
+ 292:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+
+0000000000000299 <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 299:	55                   	push   %rbp
+ 29a:	48 89 e5             	mov    %rsp,%rbp
+ 29d:	48 83 ec 10          	sub    $0x10,%rsp
+ 2a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 2a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(re[0] == '\0')
+ 2a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2ad:	0f b6 00             	movzbl (%rax),%eax
+ 2b0:	84 c0                	test   %al,%al
+ 2b2:	75 0a                	jne    2be <matchhere+0x25>
+    return 1;
+ 2b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b9:	e9 a6 00 00 00       	jmp    364 <matchhere+0xcb>
+  if(re[1] == '*')
+ 2be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2c2:	48 83 c0 01          	add    $0x1,%rax
+ 2c6:	0f b6 00             	movzbl (%rax),%eax
+ 2c9:	3c 2a                	cmp    $0x2a,%al
+ 2cb:	75 22                	jne    2ef <matchhere+0x56>
+    return matchstar(re[0], re+2, text);
+ 2cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2d1:	48 8d 48 02          	lea    0x2(%rax),%rcx
+ 2d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2d9:	0f b6 00             	movzbl (%rax),%eax
+ 2dc:	0f be c0             	movsbl %al,%eax
+ 2df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 2e3:	48 89 ce             	mov    %rcx,%rsi
+ 2e6:	89 c7                	mov    %eax,%edi
+ 2e8:	e8 79 00 00 00       	call   366 <matchstar>
+ 2ed:	eb 75                	jmp    364 <matchhere+0xcb>
+  if(re[0] == '$' && re[1] == '\0')
+ 2ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2f3:	0f b6 00             	movzbl (%rax),%eax
+ 2f6:	3c 24                	cmp    $0x24,%al
+ 2f8:	75 20                	jne    31a <matchhere+0x81>
+ 2fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 2fe:	48 83 c0 01          	add    $0x1,%rax
+ 302:	0f b6 00             	movzbl (%rax),%eax
+ 305:	84 c0                	test   %al,%al
+ 307:	75 11                	jne    31a <matchhere+0x81>
+    return *text == '\0';
+ 309:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 30d:	0f b6 00             	movzbl (%rax),%eax
+ 310:	84 c0                	test   %al,%al
+ 312:	0f 94 c0             	sete   %al
+ 315:	0f b6 c0             	movzbl %al,%eax
+ 318:	eb 4a                	jmp    364 <matchhere+0xcb>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 31a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 31e:	0f b6 00             	movzbl (%rax),%eax
+ 321:	84 c0                	test   %al,%al
+ 323:	74 3a                	je     35f <matchhere+0xc6>
+ 325:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 329:	0f b6 00             	movzbl (%rax),%eax
+ 32c:	3c 2e                	cmp    $0x2e,%al
+ 32e:	74 12                	je     342 <matchhere+0xa9>
+ 330:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 334:	0f b6 10             	movzbl (%rax),%edx
+ 337:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 33b:	0f b6 00             	movzbl (%rax),%eax
+ 33e:	38 c2                	cmp    %al,%dl
+ 340:	75 1d                	jne    35f <matchhere+0xc6>
+    return matchhere(re+1, text+1);
+ 342:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 346:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 34a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 34e:	48 83 c0 01          	add    $0x1,%rax
+ 352:	48 89 d6             	mov    %rdx,%rsi
+ 355:	48 89 c7             	mov    %rax,%rdi
+ 358:	e8 3c ff ff ff       	call   299 <matchhere>
+ 35d:	eb 05                	jmp    364 <matchhere+0xcb>
+  return 0;
+ 35f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+
+0000000000000366 <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 366:	55                   	push   %rbp
+ 367:	48 89 e5             	mov    %rsp,%rbp
+ 36a:	48 83 ec 20          	sub    $0x20,%rsp
+ 36e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 371:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ 375:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 379:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ 37d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 381:	48 89 d6             	mov    %rdx,%rsi
+ 384:	48 89 c7             	mov    %rax,%rdi
+ 387:	e8 0d ff ff ff       	call   299 <matchhere>
+ 38c:	85 c0                	test   %eax,%eax
+ 38e:	74 07                	je     397 <matchstar+0x31>
+      return 1;
+ 390:	b8 01 00 00 00       	mov    $0x1,%eax
+ 395:	eb 2d                	jmp    3c4 <matchstar+0x5e>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 397:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 39b:	0f b6 00             	movzbl (%rax),%eax
+ 39e:	84 c0                	test   %al,%al
+ 3a0:	74 1d                	je     3bf <matchstar+0x59>
+ 3a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 3a6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 3aa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 3ae:	0f b6 00             	movzbl (%rax),%eax
+ 3b1:	0f be c0             	movsbl %al,%eax
+ 3b4:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ 3b7:	74 c0                	je     379 <matchstar+0x13>
+ 3b9:	83 7d fc 2e          	cmpl   $0x2e,-0x4(%rbp)
+ 3bd:	74 ba                	je     379 <matchstar+0x13>
+  return 0;
+ 3bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+
+00000000000003c6 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+ 3c6:	55                   	push   %rbp
+ 3c7:	48 89 e5             	mov    %rsp,%rbp
+ 3ca:	48 83 ec 10          	sub    $0x10,%rsp
+ 3ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 3d1:	89 f0                	mov    %esi,%eax
+ 3d3:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 3d6:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 3da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 3dd:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3e2:	48 89 ce             	mov    %rcx,%rsi
+ 3e5:	89 c7                	mov    %eax,%edi
+ 3e7:	e8 63 07 00 00       	call   b4f <write>
+}
+ 3ec:	90                   	nop
+ 3ed:	c9                   	leave
+ 3ee:	c3                   	ret
+
+00000000000003ef <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+ 3ef:	55                   	push   %rbp
+ 3f0:	48 89 e5             	mov    %rsp,%rbp
+ 3f3:	48 83 ec 40          	sub    $0x40,%rsp
+ 3f7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 3fa:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 3fd:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 400:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+ 403:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 407:	74 1f                	je     428 <printint64+0x39>
+ 409:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 40c:	c1 e8 1f             	shr    $0x1f,%eax
+ 40f:	0f b6 c0             	movzbl %al,%eax
+ 412:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 415:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 419:	74 0d                	je     428 <printint64+0x39>
+    x = -xx;
+ 41b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 41e:	f7 d8                	neg    %eax
+ 420:	48 98                	cltq
+ 422:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 426:	eb 09                	jmp    431 <printint64+0x42>
+  else
+    x = xx;
+ 428:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 42b:	48 98                	cltq
+ 42d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 431:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 438:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 43b:	48 63 c8             	movslq %eax,%rcx
+ 43e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 442:	ba 00 00 00 00       	mov    $0x0,%edx
+ 447:	48 f7 f1             	div    %rcx
+ 44a:	48 89 d1             	mov    %rdx,%rcx
+ 44d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 450:	8d 50 01             	lea    0x1(%rax),%edx
+ 453:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 456:	48 8d 15 53 0e 00 00 	lea    0xe53(%rip),%rdx        # 12b0 <digits.1>
+ 45d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 461:	48 98                	cltq
+ 463:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 467:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 46a:	48 63 f0             	movslq %eax,%rsi
+ 46d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 471:	ba 00 00 00 00       	mov    $0x0,%edx
+ 476:	48 f7 f6             	div    %rsi
+ 479:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 47d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 482:	75 b4                	jne    438 <printint64+0x49>
+
+  if(sgn)
+ 484:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 488:	74 2b                	je     4b5 <printint64+0xc6>
+    buf[i++] = '-';
+ 48a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 48d:	8d 50 01             	lea    0x1(%rax),%edx
+ 490:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 493:	48 98                	cltq
+ 495:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 49a:	eb 19                	jmp    4b5 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 49c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 49f:	48 98                	cltq
+ 4a1:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 4a6:	0f be d0             	movsbl %al,%edx
+ 4a9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 4ac:	89 d6                	mov    %edx,%esi
+ 4ae:	89 c7                	mov    %eax,%edi
+ 4b0:	e8 11 ff ff ff       	call   3c6 <putc>
+  while(--i >= 0)
+ 4b5:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 4b9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 4bd:	79 dd                	jns    49c <printint64+0xad>
+}
+ 4bf:	90                   	nop
+ 4c0:	90                   	nop
+ 4c1:	c9                   	leave
+ 4c2:	c3                   	ret
+
+00000000000004c3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c3:	55                   	push   %rbp
+ 4c4:	48 89 e5             	mov    %rsp,%rbp
+ 4c7:	48 83 ec 30          	sub    $0x30,%rsp
+ 4cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 4ce:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 4d1:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 4d4:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4d7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 4de:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 4e2:	74 17                	je     4fb <printint+0x38>
+ 4e4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 4e8:	79 11                	jns    4fb <printint+0x38>
+    neg = 1;
+ 4ea:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 4f1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 4f4:	f7 d8                	neg    %eax
+ 4f6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 4f9:	eb 06                	jmp    501 <printint+0x3e>
+  } else {
+    x = xx;
+ 4fb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 4fe:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 501:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 508:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 50b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 50e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 513:	f7 f1                	div    %ecx
+ 515:	89 d1                	mov    %edx,%ecx
+ 517:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 51a:	8d 50 01             	lea    0x1(%rax),%edx
+ 51d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 520:	89 c9                	mov    %ecx,%ecx
+ 522:	48 8d 15 a7 0d 00 00 	lea    0xda7(%rip),%rdx        # 12d0 <digits.0>
+ 529:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 52d:	48 98                	cltq
+ 52f:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 533:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 536:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 539:	ba 00 00 00 00       	mov    $0x0,%edx
+ 53e:	f7 f6                	div    %esi
+ 540:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 543:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 547:	75 bf                	jne    508 <printint+0x45>
+  if(neg)
+ 549:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 54d:	74 2b                	je     57a <printint+0xb7>
+    buf[i++] = '-';
+ 54f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 552:	8d 50 01             	lea    0x1(%rax),%edx
+ 555:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 558:	48 98                	cltq
+ 55a:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 55f:	eb 19                	jmp    57a <printint+0xb7>
+    putc(fd, buf[i]);
+ 561:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 564:	48 98                	cltq
+ 566:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 56b:	0f be d0             	movsbl %al,%edx
+ 56e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 571:	89 d6                	mov    %edx,%esi
+ 573:	89 c7                	mov    %eax,%edi
+ 575:	e8 4c fe ff ff       	call   3c6 <putc>
+  while(--i >= 0)
+ 57a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 57e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 582:	79 dd                	jns    561 <printint+0x9e>
+}
+ 584:	90                   	nop
+ 585:	90                   	nop
+ 586:	c9                   	leave
+ 587:	c3                   	ret
+
+0000000000000588 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 588:	55                   	push   %rbp
+ 589:	48 89 e5             	mov    %rsp,%rbp
+ 58c:	48 83 ec 70          	sub    $0x70,%rsp
+ 590:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 593:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 597:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 59b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 59f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 5a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 5a7:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 5ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 5b2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 5b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 5ba:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 5be:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 5c5:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 5cc:	e9 6b 02 00 00       	jmp    83c <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 5d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 5d4:	48 63 d0             	movslq %eax,%rdx
+ 5d7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 5db:	48 01 d0             	add    %rdx,%rax
+ 5de:	0f b6 00             	movzbl (%rax),%eax
+ 5e1:	0f be c0             	movsbl %al,%eax
+ 5e4:	25 ff 00 00 00       	and    $0xff,%eax
+ 5e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 5ec:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 5f0:	75 30                	jne    622 <printf+0x9a>
+      if(c == '%'){
+ 5f2:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 5f6:	75 13                	jne    60b <printf+0x83>
+        state = '%';
+ 5f8:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 5ff:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 606:	e9 2d 02 00 00       	jmp    838 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 60b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 60e:	0f be d0             	movsbl %al,%edx
+ 611:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 614:	89 d6                	mov    %edx,%esi
+ 616:	89 c7                	mov    %eax,%edi
+ 618:	e8 a9 fd ff ff       	call   3c6 <putc>
+ 61d:	e9 16 02 00 00       	jmp    838 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 622:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 626:	0f 85 0c 02 00 00    	jne    838 <printf+0x2b0>
+      if(c == 'l') {
+ 62c:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 630:	75 0c                	jne    63e <printf+0xb6>
+        lflag = 1;
+ 632:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 639:	e9 fa 01 00 00       	jmp    838 <printf+0x2b0>
+      } else if(c == 'd'){
+ 63e:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 642:	0f 85 95 00 00 00    	jne    6dd <printf+0x155>
+        if (lflag == 1)
+ 648:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 64c:	75 49                	jne    697 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 64e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 651:	83 f8 2f             	cmp    $0x2f,%eax
+ 654:	77 17                	ja     66d <printf+0xe5>
+ 656:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 65a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 65d:	89 d2                	mov    %edx,%edx
+ 65f:	48 01 d0             	add    %rdx,%rax
+ 662:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 665:	83 c2 08             	add    $0x8,%edx
+ 668:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 66b:	eb 0c                	jmp    679 <printf+0xf1>
+ 66d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 671:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 675:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 679:	48 8b 00             	mov    (%rax),%rax
+ 67c:	89 c6                	mov    %eax,%esi
+ 67e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 681:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 686:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 68b:	89 c7                	mov    %eax,%edi
+ 68d:	e8 5d fd ff ff       	call   3ef <printint64>
+ 692:	e9 9a 01 00 00       	jmp    831 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 697:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 69a:	83 f8 2f             	cmp    $0x2f,%eax
+ 69d:	77 17                	ja     6b6 <printf+0x12e>
+ 69f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 6a3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 6a6:	89 d2                	mov    %edx,%edx
+ 6a8:	48 01 d0             	add    %rdx,%rax
+ 6ab:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 6ae:	83 c2 08             	add    $0x8,%edx
+ 6b1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 6b4:	eb 0c                	jmp    6c2 <printf+0x13a>
+ 6b6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 6ba:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 6be:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 6c2:	8b 30                	mov    (%rax),%esi
+ 6c4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 6c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 6cc:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 6d1:	89 c7                	mov    %eax,%edi
+ 6d3:	e8 eb fd ff ff       	call   4c3 <printint>
+ 6d8:	e9 54 01 00 00       	jmp    831 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 6dd:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 6e1:	74 0a                	je     6ed <printf+0x165>
+ 6e3:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 6e7:	0f 85 95 00 00 00    	jne    782 <printf+0x1fa>
+        if (lflag == 1)
+ 6ed:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 6f1:	75 49                	jne    73c <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 6f3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 6f6:	83 f8 2f             	cmp    $0x2f,%eax
+ 6f9:	77 17                	ja     712 <printf+0x18a>
+ 6fb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 6ff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 702:	89 d2                	mov    %edx,%edx
+ 704:	48 01 d0             	add    %rdx,%rax
+ 707:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 70a:	83 c2 08             	add    $0x8,%edx
+ 70d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 710:	eb 0c                	jmp    71e <printf+0x196>
+ 712:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 716:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 71a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 71e:	48 8b 00             	mov    (%rax),%rax
+ 721:	89 c6                	mov    %eax,%esi
+ 723:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 726:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 72b:	ba 10 00 00 00       	mov    $0x10,%edx
+ 730:	89 c7                	mov    %eax,%edi
+ 732:	e8 b8 fc ff ff       	call   3ef <printint64>
+        if (lflag == 1)
+ 737:	e9 f5 00 00 00       	jmp    831 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 73c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 73f:	83 f8 2f             	cmp    $0x2f,%eax
+ 742:	77 17                	ja     75b <printf+0x1d3>
+ 744:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 748:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 74b:	89 d2                	mov    %edx,%edx
+ 74d:	48 01 d0             	add    %rdx,%rax
+ 750:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 753:	83 c2 08             	add    $0x8,%edx
+ 756:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 759:	eb 0c                	jmp    767 <printf+0x1df>
+ 75b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 75f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 763:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 767:	8b 30                	mov    (%rax),%esi
+ 769:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 76c:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 771:	ba 10 00 00 00       	mov    $0x10,%edx
+ 776:	89 c7                	mov    %eax,%edi
+ 778:	e8 46 fd ff ff       	call   4c3 <printint>
+        if (lflag == 1)
+ 77d:	e9 af 00 00 00       	jmp    831 <printf+0x2a9>
+      } else if(c == 's'){
+ 782:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 786:	75 6e                	jne    7f6 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 788:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 78b:	83 f8 2f             	cmp    $0x2f,%eax
+ 78e:	77 17                	ja     7a7 <printf+0x21f>
+ 790:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 794:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 797:	89 d2                	mov    %edx,%edx
+ 799:	48 01 d0             	add    %rdx,%rax
+ 79c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 79f:	83 c2 08             	add    $0x8,%edx
+ 7a2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 7a5:	eb 0c                	jmp    7b3 <printf+0x22b>
+ 7a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 7ab:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 7af:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 7b3:	48 8b 00             	mov    (%rax),%rax
+ 7b6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 7ba:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 7bf:	75 28                	jne    7e9 <printf+0x261>
+          s = "(null)";
+ 7c1:	48 8d 05 fe 07 00 00 	lea    0x7fe(%rip),%rax        # fc6 <malloc+0x1bc>
+ 7c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 7cc:	eb 1b                	jmp    7e9 <printf+0x261>
+          putc(fd, *s);
+ 7ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 7d2:	0f b6 00             	movzbl (%rax),%eax
+ 7d5:	0f be d0             	movsbl %al,%edx
+ 7d8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 7db:	89 d6                	mov    %edx,%esi
+ 7dd:	89 c7                	mov    %eax,%edi
+ 7df:	e8 e2 fb ff ff       	call   3c6 <putc>
+        for(; *s; s++)
+ 7e4:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 7e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 7ed:	0f b6 00             	movzbl (%rax),%eax
+ 7f0:	84 c0                	test   %al,%al
+ 7f2:	75 da                	jne    7ce <printf+0x246>
+ 7f4:	eb 3b                	jmp    831 <printf+0x2a9>
+      } else if(c == '%'){
+ 7f6:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 7fa:	75 14                	jne    810 <printf+0x288>
+        putc(fd, c);
+ 7fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 7ff:	0f be d0             	movsbl %al,%edx
+ 802:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 805:	89 d6                	mov    %edx,%esi
+ 807:	89 c7                	mov    %eax,%edi
+ 809:	e8 b8 fb ff ff       	call   3c6 <putc>
+ 80e:	eb 21                	jmp    831 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 810:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 813:	be 25 00 00 00       	mov    $0x25,%esi
+ 818:	89 c7                	mov    %eax,%edi
+ 81a:	e8 a7 fb ff ff       	call   3c6 <putc>
+        putc(fd, c);
+ 81f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 822:	0f be d0             	movsbl %al,%edx
+ 825:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 828:	89 d6                	mov    %edx,%esi
+ 82a:	89 c7                	mov    %eax,%edi
+ 82c:	e8 95 fb ff ff       	call   3c6 <putc>
+      }
+      state = 0;
+ 831:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 838:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 83c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 83f:	48 63 d0             	movslq %eax,%rdx
+ 842:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 846:	48 01 d0             	add    %rdx,%rax
+ 849:	0f b6 00             	movzbl (%rax),%eax
+ 84c:	84 c0                	test   %al,%al
+ 84e:	0f 85 7d fd ff ff    	jne    5d1 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 854:	90                   	nop
+ 855:	90                   	nop
+ 856:	c9                   	leave
+ 857:	c3                   	ret
+
+0000000000000858 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 858:	55                   	push   %rbp
+ 859:	48 89 e5             	mov    %rsp,%rbp
+ 85c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 860:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 863:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 866:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 86a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 86d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 870:	48 89 ce             	mov    %rcx,%rsi
+ 873:	48 89 f7             	mov    %rsi,%rdi
+ 876:	89 d1                	mov    %edx,%ecx
+ 878:	fc                   	cld
+ 879:	f3 aa                	rep stos %al,%es:(%rdi)
+ 87b:	89 ca                	mov    %ecx,%edx
+ 87d:	48 89 fe             	mov    %rdi,%rsi
+ 880:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 884:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 887:	90                   	nop
+ 888:	5d                   	pop    %rbp
+ 889:	c3                   	ret
+
+000000000000088a <strcpy>:
+{
+ 88a:	55                   	push   %rbp
+ 88b:	48 89 e5             	mov    %rsp,%rbp
+ 88e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 892:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 896:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 89a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 89e:	90                   	nop
+ 89f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 8a3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 8a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 8ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 8af:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 8b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 8b7:	0f b6 12             	movzbl (%rdx),%edx
+ 8ba:	88 10                	mov    %dl,(%rax)
+ 8bc:	0f b6 00             	movzbl (%rax),%eax
+ 8bf:	84 c0                	test   %al,%al
+ 8c1:	75 dc                	jne    89f <strcpy+0x15>
+  return os;
+ 8c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 8c7:	5d                   	pop    %rbp
+ 8c8:	c3                   	ret
+
+00000000000008c9 <strcmp>:
+{
+ 8c9:	55                   	push   %rbp
+ 8ca:	48 89 e5             	mov    %rsp,%rbp
+ 8cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 8d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 8d5:	eb 0a                	jmp    8e1 <strcmp+0x18>
+    p++, q++;
+ 8d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 8dc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 8e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8e5:	0f b6 00             	movzbl (%rax),%eax
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	74 12                	je     8fe <strcmp+0x35>
+ 8ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 8f0:	0f b6 10             	movzbl (%rax),%edx
+ 8f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 8f7:	0f b6 00             	movzbl (%rax),%eax
+ 8fa:	38 c2                	cmp    %al,%dl
+ 8fc:	74 d9                	je     8d7 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 8fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 902:	0f b6 00             	movzbl (%rax),%eax
+ 905:	0f b6 d0             	movzbl %al,%edx
+ 908:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 90c:	0f b6 00             	movzbl (%rax),%eax
+ 90f:	0f b6 c0             	movzbl %al,%eax
+ 912:	29 c2                	sub    %eax,%edx
+ 914:	89 d0                	mov    %edx,%eax
+}
+ 916:	5d                   	pop    %rbp
+ 917:	c3                   	ret
+
+0000000000000918 <strlen>:
+{
+ 918:	55                   	push   %rbp
+ 919:	48 89 e5             	mov    %rsp,%rbp
+ 91c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 920:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 927:	eb 04                	jmp    92d <strlen+0x15>
+ 929:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 92d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 930:	48 63 d0             	movslq %eax,%rdx
+ 933:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 937:	48 01 d0             	add    %rdx,%rax
+ 93a:	0f b6 00             	movzbl (%rax),%eax
+ 93d:	84 c0                	test   %al,%al
+ 93f:	75 e8                	jne    929 <strlen+0x11>
+  return n;
+ 941:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 944:	5d                   	pop    %rbp
+ 945:	c3                   	ret
+
+0000000000000946 <memset>:
+{
+ 946:	55                   	push   %rbp
+ 947:	48 89 e5             	mov    %rsp,%rbp
+ 94a:	48 83 ec 10          	sub    $0x10,%rsp
+ 94e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 952:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 955:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 958:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 95b:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 95e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 962:	89 ce                	mov    %ecx,%esi
+ 964:	48 89 c7             	mov    %rax,%rdi
+ 967:	e8 ec fe ff ff       	call   858 <stosb>
+  return dst;
+ 96c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 970:	c9                   	leave
+ 971:	c3                   	ret
+
+0000000000000972 <strchr>:
+{
+ 972:	55                   	push   %rbp
+ 973:	48 89 e5             	mov    %rsp,%rbp
+ 976:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 97a:	89 f0                	mov    %esi,%eax
+ 97c:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 97f:	eb 17                	jmp    998 <strchr+0x26>
+    if(*s == c)
+ 981:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 985:	0f b6 00             	movzbl (%rax),%eax
+ 988:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 98b:	75 06                	jne    993 <strchr+0x21>
+      return (char*)s;
+ 98d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 991:	eb 15                	jmp    9a8 <strchr+0x36>
+  for(; *s; s++)
+ 993:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 99c:	0f b6 00             	movzbl (%rax),%eax
+ 99f:	84 c0                	test   %al,%al
+ 9a1:	75 de                	jne    981 <strchr+0xf>
+  return 0;
+ 9a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 9a8:	5d                   	pop    %rbp
+ 9a9:	c3                   	ret
+
+00000000000009aa <gets>:
+gets(char *buf, int max)
+{
+ 9aa:	55                   	push   %rbp
+ 9ab:	48 89 e5             	mov    %rsp,%rbp
+ 9ae:	48 83 ec 20          	sub    $0x20,%rsp
+ 9b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 9b6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 9b9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 9c0:	eb 48                	jmp    a0a <gets+0x60>
+    cc = read(0, &c, 1);
+ 9c2:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 9c6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9cb:	48 89 c6             	mov    %rax,%rsi
+ 9ce:	bf 00 00 00 00       	mov    $0x0,%edi
+ 9d3:	e8 6f 01 00 00       	call   b47 <read>
+ 9d8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 9db:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 9df:	7e 36                	jle    a17 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 9e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 9e4:	8d 50 01             	lea    0x1(%rax),%edx
+ 9e7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 9ea:	48 63 d0             	movslq %eax,%rdx
+ 9ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 9f1:	48 01 c2             	add    %rax,%rdx
+ 9f4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 9f8:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 9fa:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 9fe:	3c 0a                	cmp    $0xa,%al
+ a00:	74 16                	je     a18 <gets+0x6e>
+ a02:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ a06:	3c 0d                	cmp    $0xd,%al
+ a08:	74 0e                	je     a18 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ a0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a0d:	83 c0 01             	add    $0x1,%eax
+ a10:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ a13:	7f ad                	jg     9c2 <gets+0x18>
+ a15:	eb 01                	jmp    a18 <gets+0x6e>
+      break;
+ a17:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ a18:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a1b:	48 63 d0             	movslq %eax,%rdx
+ a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a22:	48 01 d0             	add    %rdx,%rax
+ a25:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ a28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ a2c:	c9                   	leave
+ a2d:	c3                   	ret
+
+0000000000000a2e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ a2e:	55                   	push   %rbp
+ a2f:	48 89 e5             	mov    %rsp,%rbp
+ a32:	48 83 ec 20          	sub    $0x20,%rsp
+ a36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ a3a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ a3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ a42:	be 00 00 00 00       	mov    $0x0,%esi
+ a47:	48 89 c7             	mov    %rax,%rdi
+ a4a:	e8 20 01 00 00       	call   b6f <open>
+ a4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ a52:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ a56:	79 07                	jns    a5f <stat+0x31>
+    return -1;
+ a58:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a5d:	eb 21                	jmp    a80 <stat+0x52>
+  r = fstat(fd, st);
+ a5f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ a63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a66:	48 89 d6             	mov    %rdx,%rsi
+ a69:	89 c7                	mov    %eax,%edi
+ a6b:	e8 17 01 00 00       	call   b87 <fstat>
+ a70:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ a73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ a76:	89 c7                	mov    %eax,%edi
+ a78:	e8 da 00 00 00       	call   b57 <close>
+  return r;
+ a7d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ a80:	c9                   	leave
+ a81:	c3                   	ret
+
+0000000000000a82 <atoi>:
+
+int
+atoi(const char *s)
+{
+ a82:	55                   	push   %rbp
+ a83:	48 89 e5             	mov    %rsp,%rbp
+ a86:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ a8a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ a91:	eb 28                	jmp    abb <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ a93:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ a96:	89 d0                	mov    %edx,%eax
+ a98:	c1 e0 02             	shl    $0x2,%eax
+ a9b:	01 d0                	add    %edx,%eax
+ a9d:	01 c0                	add    %eax,%eax
+ a9f:	89 c1                	mov    %eax,%ecx
+ aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ aa5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ aa9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ aad:	0f b6 00             	movzbl (%rax),%eax
+ ab0:	0f be c0             	movsbl %al,%eax
+ ab3:	01 c8                	add    %ecx,%eax
+ ab5:	83 e8 30             	sub    $0x30,%eax
+ ab8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ abf:	0f b6 00             	movzbl (%rax),%eax
+ ac2:	3c 2f                	cmp    $0x2f,%al
+ ac4:	7e 0b                	jle    ad1 <atoi+0x4f>
+ ac6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ aca:	0f b6 00             	movzbl (%rax),%eax
+ acd:	3c 39                	cmp    $0x39,%al
+ acf:	7e c2                	jle    a93 <atoi+0x11>
+  return n;
+ ad1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ ad4:	5d                   	pop    %rbp
+ ad5:	c3                   	ret
+
+0000000000000ad6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ ad6:	55                   	push   %rbp
+ ad7:	48 89 e5             	mov    %rsp,%rbp
+ ada:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ ade:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ ae2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ ae5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ ae9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ aed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ af1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ af5:	eb 1d                	jmp    b14 <memmove+0x3e>
+    *dst++ = *src++;
+ af7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ afb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ aff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b07:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ b0b:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ b0f:	0f b6 12             	movzbl (%rdx),%edx
+ b12:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ b14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b17:	8d 50 ff             	lea    -0x1(%rax),%edx
+ b1a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ b1d:	85 c0                	test   %eax,%eax
+ b1f:	7f d6                	jg     af7 <memmove+0x21>
+  return vdst;
+ b21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ b25:	5d                   	pop    %rbp
+ b26:	c3                   	ret
+
+0000000000000b27 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ b27:	b8 01 00 00 00       	mov    $0x1,%eax
+ b2c:	cd 40                	int    $0x40
+ b2e:	c3                   	ret
+
+0000000000000b2f <exit>:
+SYSCALL(exit)
+ b2f:	b8 02 00 00 00       	mov    $0x2,%eax
+ b34:	cd 40                	int    $0x40
+ b36:	c3                   	ret
+
+0000000000000b37 <wait>:
+SYSCALL(wait)
+ b37:	b8 03 00 00 00       	mov    $0x3,%eax
+ b3c:	cd 40                	int    $0x40
+ b3e:	c3                   	ret
+
+0000000000000b3f <pipe>:
+SYSCALL(pipe)
+ b3f:	b8 04 00 00 00       	mov    $0x4,%eax
+ b44:	cd 40                	int    $0x40
+ b46:	c3                   	ret
+
+0000000000000b47 <read>:
+SYSCALL(read)
+ b47:	b8 05 00 00 00       	mov    $0x5,%eax
+ b4c:	cd 40                	int    $0x40
+ b4e:	c3                   	ret
+
+0000000000000b4f <write>:
+SYSCALL(write)
+ b4f:	b8 10 00 00 00       	mov    $0x10,%eax
+ b54:	cd 40                	int    $0x40
+ b56:	c3                   	ret
+
+0000000000000b57 <close>:
+SYSCALL(close)
+ b57:	b8 15 00 00 00       	mov    $0x15,%eax
+ b5c:	cd 40                	int    $0x40
+ b5e:	c3                   	ret
+
+0000000000000b5f <kill>:
+SYSCALL(kill)
+ b5f:	b8 06 00 00 00       	mov    $0x6,%eax
+ b64:	cd 40                	int    $0x40
+ b66:	c3                   	ret
+
+0000000000000b67 <exec>:
+SYSCALL(exec)
+ b67:	b8 07 00 00 00       	mov    $0x7,%eax
+ b6c:	cd 40                	int    $0x40
+ b6e:	c3                   	ret
+
+0000000000000b6f <open>:
+SYSCALL(open)
+ b6f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ b74:	cd 40                	int    $0x40
+ b76:	c3                   	ret
+
+0000000000000b77 <mknod>:
+SYSCALL(mknod)
+ b77:	b8 11 00 00 00       	mov    $0x11,%eax
+ b7c:	cd 40                	int    $0x40
+ b7e:	c3                   	ret
+
+0000000000000b7f <unlink>:
+SYSCALL(unlink)
+ b7f:	b8 12 00 00 00       	mov    $0x12,%eax
+ b84:	cd 40                	int    $0x40
+ b86:	c3                   	ret
+
+0000000000000b87 <fstat>:
+SYSCALL(fstat)
+ b87:	b8 08 00 00 00       	mov    $0x8,%eax
+ b8c:	cd 40                	int    $0x40
+ b8e:	c3                   	ret
+
+0000000000000b8f <link>:
+SYSCALL(link)
+ b8f:	b8 13 00 00 00       	mov    $0x13,%eax
+ b94:	cd 40                	int    $0x40
+ b96:	c3                   	ret
+
+0000000000000b97 <mkdir>:
+SYSCALL(mkdir)
+ b97:	b8 14 00 00 00       	mov    $0x14,%eax
+ b9c:	cd 40                	int    $0x40
+ b9e:	c3                   	ret
+
+0000000000000b9f <chdir>:
+SYSCALL(chdir)
+ b9f:	b8 09 00 00 00       	mov    $0x9,%eax
+ ba4:	cd 40                	int    $0x40
+ ba6:	c3                   	ret
+
+0000000000000ba7 <dup>:
+SYSCALL(dup)
+ ba7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ bac:	cd 40                	int    $0x40
+ bae:	c3                   	ret
+
+0000000000000baf <getpid>:
+SYSCALL(getpid)
+ baf:	b8 0b 00 00 00       	mov    $0xb,%eax
+ bb4:	cd 40                	int    $0x40
+ bb6:	c3                   	ret
+
+0000000000000bb7 <sbrk>:
+SYSCALL(sbrk)
+ bb7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ bbc:	cd 40                	int    $0x40
+ bbe:	c3                   	ret
+
+0000000000000bbf <sleep>:
+SYSCALL(sleep)
+ bbf:	b8 0d 00 00 00       	mov    $0xd,%eax
+ bc4:	cd 40                	int    $0x40
+ bc6:	c3                   	ret
+
+0000000000000bc7 <uptime>:
+SYSCALL(uptime)
+ bc7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ bcc:	cd 40                	int    $0x40
+ bce:	c3                   	ret
+
+0000000000000bcf <sysinfo>:
+SYSCALL(sysinfo)
+ bcf:	b8 16 00 00 00       	mov    $0x16,%eax
+ bd4:	cd 40                	int    $0x40
+ bd6:	c3                   	ret
+
+0000000000000bd7 <mmap>:
+SYSCALL(mmap)
+ bd7:	b8 17 00 00 00       	mov    $0x17,%eax
+ bdc:	cd 40                	int    $0x40
+ bde:	c3                   	ret
+
+0000000000000bdf <munmap>:
+SYSCALL(munmap)
+ bdf:	b8 18 00 00 00       	mov    $0x18,%eax
+ be4:	cd 40                	int    $0x40
+ be6:	c3                   	ret
+
+0000000000000be7 <crashn>:
+SYSCALL(crashn)
+ be7:	b8 19 00 00 00       	mov    $0x19,%eax
+ bec:	cd 40                	int    $0x40
+ bee:	c3                   	ret
+
+0000000000000bef <mmap2>:
+SYSCALL_ADDR(mmap2)
+ bef:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ bf4:	cd 40                	int    $0x40
+ bf6:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bf9:	74 02                	je     bfd <mmap2+0xe>
+ bfb:	89 c0                	mov    %eax,%eax
+ bfd:	c3                   	ret
+
+0000000000000bfe <munmap2>:
+SYSCALL(munmap2)
+ bfe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ c03:	cd 40                	int    $0x40
+ c05:	c3                   	ret
+
+0000000000000c06 <msync>:
+SYSCALL(msync)
+ c06:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ c0b:	cd 40                	int    $0x40
+ c0d:	c3                   	ret
+
+0000000000000c0e <sendfile>:
+SYSCALL(sendfile)
+ c0e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ c13:	cd 40                	int    $0x40
+ c15:	c3                   	ret
+
+0000000000000c16 <splice>:
+SYSCALL(splice)
+ c16:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ c1b:	cd 40                	int    $0x40
+ c1d:	c3                   	ret
+
+0000000000000c1e <pread>:
+SYSCALL(pread)
+ c1e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ c23:	cd 40                	int    $0x40
+ c25:	c3                   	ret
+
+0000000000000c26 <pwrite>:
+SYSCALL(pwrite)
+ c26:	b8 20 00 00 00       	mov    $0x20,%eax
+ c2b:	cd 40                	int    $0x40
+ c2d:	c3                   	ret
+
+0000000000000c2e <readv>:
+SYSCALL(readv)
+ c2e:	b8 21 00 00 00       	mov    $0x21,%eax
+ c33:	cd 40                	int    $0x40
+ c35:	c3                   	ret
+
+0000000000000c36 <writev>:
+SYSCALL(writev)
+ c36:	b8 22 00 00 00       	mov    $0x22,%eax
+ c3b:	cd 40                	int    $0x40
+ c3d:	c3                   	ret
+
+0000000000000c3e <poll>:
+SYSCALL(poll)
+ c3e:	b8 23 00 00 00       	mov    $0x23,%eax
+ c43:	cd 40                	int    $0x40
+ c45:	c3                   	ret
+
+0000000000000c46 <pipe2>:
+SYSCALL(pipe2)
+ c46:	b8 24 00 00 00       	mov    $0x24,%eax
+ c4b:	cd 40                	int    $0x40
+ c4d:	c3                   	ret
+
+0000000000000c4e <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ c4e:	55                   	push   %rbp
+ c4f:	48 89 e5             	mov    %rsp,%rbp
+ c52:	48 83 ec 20          	sub    $0x20,%rsp
+ c56:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ c5e:	48 83 e8 10          	sub    $0x10,%rax
+ c62:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ c66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c6a:	48 8b 10             	mov    (%rax),%rdx
+ c6d:	48 8d 05 ac 06 00 00 	lea    0x6ac(%rip),%rax        # 1320 <bigblock>
+ c74:	48 39 c2             	cmp    %rax,%rdx
+ c77:	75 1f                	jne    c98 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ c79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c7d:	8b 40 08             	mov    0x8(%rax),%eax
+ c80:	c1 e0 04             	shl    $0x4,%eax
+ c83:	89 c2                	mov    %eax,%edx
+ c85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c89:	89 d6                	mov    %edx,%esi
+ c8b:	48 89 c7             	mov    %rax,%rdi
+ c8e:	e8 6b ff ff ff       	call   bfe <munmap2>
+    return;
+ c93:	e9 0b 01 00 00       	jmp    da3 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c98:	48 8b 05 71 06 00 00 	mov    0x671(%rip),%rax        # 1310 <freep>
+ c9f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ ca3:	eb 2f                	jmp    cd4 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ca9:	48 8b 00             	mov    (%rax),%rax
+ cac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ cb0:	72 17                	jb     cc9 <free+0x7b>
+ cb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cb6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ cba:	72 2f                	jb     ceb <free+0x9d>
+ cbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc0:	48 8b 00             	mov    (%rax),%rax
+ cc3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ cc7:	72 22                	jb     ceb <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ccd:	48 8b 00             	mov    (%rax),%rax
+ cd0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ cd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cd8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ cdc:	73 c7                	jae    ca5 <free+0x57>
+ cde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ce2:	48 8b 00             	mov    (%rax),%rax
+ ce5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ ce9:	73 ba                	jae    ca5 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ceb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cef:	8b 40 08             	mov    0x8(%rax),%eax
+ cf2:	89 c0                	mov    %eax,%eax
+ cf4:	48 c1 e0 04          	shl    $0x4,%rax
+ cf8:	48 89 c2             	mov    %rax,%rdx
+ cfb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ cff:	48 01 c2             	add    %rax,%rdx
+ d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d06:	48 8b 00             	mov    (%rax),%rax
+ d09:	48 39 c2             	cmp    %rax,%rdx
+ d0c:	75 2d                	jne    d3b <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ d0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d12:	8b 50 08             	mov    0x8(%rax),%edx
+ d15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d19:	48 8b 00             	mov    (%rax),%rax
+ d1c:	8b 40 08             	mov    0x8(%rax),%eax
+ d1f:	01 c2                	add    %eax,%edx
+ d21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d25:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d2c:	48 8b 00             	mov    (%rax),%rax
+ d2f:	48 8b 10             	mov    (%rax),%rdx
+ d32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d36:	48 89 10             	mov    %rdx,(%rax)
+ d39:	eb 0e                	jmp    d49 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d3f:	48 8b 10             	mov    (%rax),%rdx
+ d42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d46:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ d49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d4d:	8b 40 08             	mov    0x8(%rax),%eax
+ d50:	89 c0                	mov    %eax,%eax
+ d52:	48 c1 e0 04          	shl    $0x4,%rax
+ d56:	48 89 c2             	mov    %rax,%rdx
+ d59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d5d:	48 01 d0             	add    %rdx,%rax
+ d60:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ d64:	75 27                	jne    d8d <free+0x13f>
+    p->s.size += bp->s.size;
+ d66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d6a:	8b 50 08             	mov    0x8(%rax),%edx
+ d6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d71:	8b 40 08             	mov    0x8(%rax),%eax
+ d74:	01 c2                	add    %eax,%edx
+ d76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d7a:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ d7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ d81:	48 8b 10             	mov    (%rax),%rdx
+ d84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d88:	48 89 10             	mov    %rdx,(%rax)
+ d8b:	eb 0b                	jmp    d98 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d91:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ d95:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ d9c:	48 89 05 6d 05 00 00 	mov    %rax,0x56d(%rip)        # 1310 <freep>
+}
+ da3:	c9                   	leave
+ da4:	c3                   	ret
+
+0000000000000da5 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ da5:	55                   	push   %rbp
+ da6:	48 89 e5             	mov    %rsp,%rbp
+ da9:	48 83 ec 20          	sub    $0x20,%rsp
+ dad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ db0:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ db7:	77 07                	ja     dc0 <morecore+0x1b>
+    nu = 4096;
+ db9:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ dc3:	c1 e0 04             	shl    $0x4,%eax
+ dc6:	89 c7                	mov    %eax,%edi
+ dc8:	e8 ea fd ff ff       	call   bb7 <sbrk>
+ dcd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ dd1:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ dd6:	75 07                	jne    ddf <morecore+0x3a>
+    return 0;
+ dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+ ddd:	eb 29                	jmp    e08 <morecore+0x63>
+  hp = (Header*)p;
+ ddf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ de3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ deb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ dee:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ df1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ df5:	48 83 c0 10          	add    $0x10,%rax
+ df9:	48 89 c7             	mov    %rax,%rdi
+ dfc:	e8 4d fe ff ff       	call   c4e <free>
+  return freep;
+ e01:	48 8b 05 08 05 00 00 	mov    0x508(%rip),%rax        # 1310 <freep>
+}
+ e08:	c9                   	leave
+ e09:	c3                   	ret
+
+0000000000000e0a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e0a:	55                   	push   %rbp
+ e0b:	48 89 e5             	mov    %rsp,%rbp
+ e0e:	48 83 ec 30          	sub    $0x30,%rsp
+ e12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ e18:	48 83 c0 0f          	add    $0xf,%rax
+ e1c:	48 c1 e8 04          	shr    $0x4,%rax
+ e20:	83 c0 01             	add    $0x1,%eax
+ e23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ e26:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ e2d:	76 62                	jbe    e91 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ e2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ e32:	c1 e0 04             	shl    $0x4,%eax
+ e35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ e3b:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ e41:	b9 22 00 00 00       	mov    $0x22,%ecx
+ e46:	ba 03 00 00 00       	mov    $0x3,%edx
+ e4b:	89 c6                	mov    %eax,%esi
+ e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+ e52:	e8 98 fd ff ff       	call   bef <mmap2>
+ e57:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ e5b:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ e60:	75 0a                	jne    e6c <malloc+0x62>
+      return 0;
+ e62:	b8 00 00 00 00       	mov    $0x0,%eax
+ e67:	e9 1c 01 00 00       	jmp    f88 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ e6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e70:	48 8d 15 a9 04 00 00 	lea    0x4a9(%rip),%rdx        # 1320 <bigblock>
+ e77:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ e7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e7e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ e81:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ e84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ e88:	48 83 c0 10          	add    $0x10,%rax
+ e8c:	e9 f7 00 00 00       	jmp    f88 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ e91:	48 8b 05 78 04 00 00 	mov    0x478(%rip),%rax        # 1310 <freep>
+ e98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ e9c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ ea1:	75 2e                	jne    ed1 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ ea3:	48 8d 05 56 04 00 00 	lea    0x456(%rip),%rax        # 1300 <base>
+ eaa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ eae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ eb2:	48 89 05 57 04 00 00 	mov    %rax,0x457(%rip)        # 1310 <freep>
+ eb9:	48 8b 05 50 04 00 00 	mov    0x450(%rip),%rax        # 1310 <freep>
+ ec0:	48 89 05 39 04 00 00 	mov    %rax,0x439(%rip)        # 1300 <base>
+    base.s.size = 0;
+ ec7:	c7 05 37 04 00 00 00 	movl   $0x0,0x437(%rip)        # 1308 <base+0x8>
+ ece:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ed1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ed5:	48 8b 00             	mov    (%rax),%rax
+ ed8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ee0:	8b 40 08             	mov    0x8(%rax),%eax
+ ee3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ ee6:	72 5f                	jb     f47 <malloc+0x13d>
+      if(p->s.size == nunits)
+ ee8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ eec:	8b 40 08             	mov    0x8(%rax),%eax
+ eef:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ ef2:	75 10                	jne    f04 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ ef4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ef8:	48 8b 10             	mov    (%rax),%rdx
+ efb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ eff:	48 89 10             	mov    %rdx,(%rax)
+ f02:	eb 2e                	jmp    f32 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ f04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f08:	8b 40 08             	mov    0x8(%rax),%eax
+ f0b:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ f0e:	89 c2                	mov    %eax,%edx
+ f10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f14:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ f17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f1b:	8b 40 08             	mov    0x8(%rax),%eax
+ f1e:	89 c0                	mov    %eax,%eax
+ f20:	48 c1 e0 04          	shl    $0x4,%rax
+ f24:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f2c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ f2f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ f32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ f36:	48 89 05 d3 03 00 00 	mov    %rax,0x3d3(%rip)        # 1310 <freep>
+      return (void*)(p + 1);
+ f3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f41:	48 83 c0 10          	add    $0x10,%rax
+ f45:	eb 41                	jmp    f88 <malloc+0x17e>
+    }
+    if(p == freep)
+ f47:	48 8b 05 c2 03 00 00 	mov    0x3c2(%rip),%rax        # 1310 <freep>
+ f4e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ f52:	75 1c                	jne    f70 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ f54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ f57:	89 c7                	mov    %eax,%edi
+ f59:	e8 47 fe ff ff       	call   da5 <morecore>
+ f5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ f62:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ f67:	75 07                	jne    f70 <malloc+0x166>
+        return 0;
+ f69:	b8 00 00 00 00       	mov    $0x0,%eax
+ f6e:	eb 18                	jmp    f88 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f74:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ f7c:	48 8b 00             	mov    (%rax),%rax
+ f7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ f83:	e9 54 ff ff ff       	jmp    edc <malloc+0xd2>
+  }
+}
+ f88:	c9                   	leave
+ f89:	c3                   	ret
@@ -0,0 +1,1486 @@
+
+out/user/_init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   8:	be 02 00 00 00       	mov    $0x2,%esi
+   d:	48 8d 05 ce 0c 00 00 	lea    0xcce(%rip),%rax        # ce2 <malloc+0x183>
+  14:	48 89 c7             	mov    %rax,%rdi
+  17:	e8 a8 08 00 00       	call   8c4 <open>
+  1c:	85 c0                	test   %eax,%eax
+  1e:	79 2d                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  20:	ba 01 00 00 00       	mov    $0x1,%edx
+  25:	be 01 00 00 00       	mov    $0x1,%esi
+  2a:	48 8d 05 b1 0c 00 00 	lea    0xcb1(%rip),%rax        # ce2 <malloc+0x183>
+  31:	48 89 c7             	mov    %rax,%rdi
+  34:	e8 93 08 00 00       	call   8cc <mknod>
+    open("console", O_RDWR);
+  39:	be 02 00 00 00       	mov    $0x2,%esi
+  3e:	48 8d 05 9d 0c 00 00 	lea    0xc9d(%rip),%rax        # ce2 <malloc+0x183>
+  45:	48 89 c7             	mov    %rax,%rdi
+  48:	e8 77 08 00 00       	call   8c4 <open>
+  }
+  dup(0);  // stdout
+  4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  52:	e8 a5 08 00 00       	call   8fc <dup>
+  dup(0);  // stderr
+  57:	bf 00 00 00 00       	mov    $0x0,%edi
+  5c:	e8 9b 08 00 00       	call   8fc <dup>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  61:	48 8d 05 82 0c 00 00 	lea    0xc82(%rip),%rax        # cea <malloc+0x18b>
+  68:	48 89 c6             	mov    %rax,%rsi
+  6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  70:	b8 00 00 00 00       	mov    $0x0,%eax
+  75:	e8 63 02 00 00       	call   2dd <printf>
+    pid = fork();
+  7a:	e8 fd 07 00 00       	call   87c <fork>
+  7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if(pid < 0){
+  82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  86:	79 1e                	jns    a6 <main+0xa6>
+      printf(1, "init: fork failed\n");
+  88:	48 8d 05 6e 0c 00 00 	lea    0xc6e(%rip),%rax        # cfd <malloc+0x19e>
+  8f:	48 89 c6             	mov    %rax,%rsi
+  92:	bf 01 00 00 00       	mov    $0x1,%edi
+  97:	b8 00 00 00 00       	mov    $0x0,%eax
+  9c:	e8 3c 02 00 00       	call   2dd <printf>
+      exit();
+  a1:	e8 de 07 00 00       	call   884 <exit>
+    }
+    if(pid == 0){
+  a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  aa:	75 50                	jne    fc <main+0xfc>
+      exec("sh", argv);
+  ac:	48 8d 05 dd 0e 00 00 	lea    0xedd(%rip),%rax        # f90 <argv>
+  b3:	48 89 c6             	mov    %rax,%rsi
+  b6:	48 8d 05 22 0c 00 00 	lea    0xc22(%rip),%rax        # cdf <malloc+0x180>
+  bd:	48 89 c7             	mov    %rax,%rdi
+  c0:	e8 f7 07 00 00       	call   8bc <exec>
+      printf(1, "init: exec sh failed\n");
+  c5:	48 8d 05 44 0c 00 00 	lea    0xc44(%rip),%rax        # d10 <malloc+0x1b1>
+  cc:	48 89 c6             	mov    %rax,%rsi
+  cf:	bf 01 00 00 00       	mov    $0x1,%edi
+  d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  d9:	e8 ff 01 00 00       	call   2dd <printf>
+      exit();
+  de:	e8 a1 07 00 00       	call   884 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  e3:	48 8d 05 3c 0c 00 00 	lea    0xc3c(%rip),%rax        # d26 <malloc+0x1c7>
+  ea:	48 89 c6             	mov    %rax,%rsi
+  ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  f7:	e8 e1 01 00 00       	call   2dd <printf>
+    while((wpid=wait()) >= 0 && wpid != pid)
+  fc:	e8 8b 07 00 00       	call   88c <wait>
+ 101:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ 104:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 108:	0f 88 53 ff ff ff    	js     61 <main+0x61>
+ 10e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ 111:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+ 114:	75 cd                	jne    e3 <main+0xe3>
+    printf(1, "init: starting sh\n");
+ 116:	e9 46 ff ff ff       	jmp    61 <main+0x61>
+
+000000000000011b <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+ 11b:	55                   	push   %rbp
+ 11c:	48 89 e5             	mov    %rsp,%rbp
+ 11f:	48 83 ec 10          	sub    $0x10,%rsp
+ 123:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ 126:	89 f0                	mov    %esi,%eax
+ 128:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+ 12b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+ 12f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 132:	ba 01 00 00 00       	mov    $0x1,%edx
+ 137:	48 89 ce             	mov    %rcx,%rsi
+ 13a:	89 c7                	mov    %eax,%edi
+ 13c:	e8 63 07 00 00       	call   8a4 <write>
+}
+ 141:	90                   	nop
+ 142:	c9                   	leave
+ 143:	c3                   	ret
+
+0000000000000144 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+ 144:	55                   	push   %rbp
+ 145:	48 89 e5             	mov    %rsp,%rbp
+ 148:	48 83 ec 40          	sub    $0x40,%rsp
+ 14c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ 14f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+ 152:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+ 155:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+ 158:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 15c:	74 1f                	je     17d <printint64+0x39>
+ 15e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 161:	c1 e8 1f             	shr    $0x1f,%eax
+ 164:	0f b6 c0             	movzbl %al,%eax
+ 167:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 16a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 16e:	74 0d                	je     17d <printint64+0x39>
+    x = -xx;
+ 170:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 173:	f7 d8                	neg    %eax
+ 175:	48 98                	cltq
+ 177:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 17b:	eb 09                	jmp    186 <printint64+0x42>
+  else
+    x = xx;
+ 17d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 180:	48 98                	cltq
+ 182:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 186:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 18d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 190:	48 63 c8             	movslq %eax,%rcx
+ 193:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 197:	ba 00 00 00 00       	mov    $0x0,%edx
+ 19c:	48 f7 f1             	div    %rcx
+ 19f:	48 89 d1             	mov    %rdx,%rcx
+ 1a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1a5:	8d 50 01             	lea    0x1(%rax),%edx
+ 1a8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ab:	48 8d 15 ee 0d 00 00 	lea    0xdee(%rip),%rdx        # fa0 <digits.1>
+ 1b2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1b6:	48 98                	cltq
+ 1b8:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 1bc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 1bf:	48 63 f0             	movslq %eax,%rsi
+ 1c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 1c6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1cb:	48 f7 f6             	div    %rsi
+ 1ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 1d2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 1d7:	75 b4                	jne    18d <printint64+0x49>
+
+  if(sgn)
+ 1d9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 1dd:	74 2b                	je     20a <printint64+0xc6>
+    buf[i++] = '-';
+ 1df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1e2:	8d 50 01             	lea    0x1(%rax),%edx
+ 1e5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1e8:	48 98                	cltq
+ 1ea:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 1ef:	eb 19                	jmp    20a <printint64+0xc6>
+    putc(fd, buf[i]);
+ 1f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f4:	48 98                	cltq
+ 1f6:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 1fb:	0f be d0             	movsbl %al,%edx
+ 1fe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 201:	89 d6                	mov    %edx,%esi
+ 203:	89 c7                	mov    %eax,%edi
+ 205:	e8 11 ff ff ff       	call   11b <putc>
+  while(--i >= 0)
+ 20a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 20e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 212:	79 dd                	jns    1f1 <printint64+0xad>
+}
+ 214:	90                   	nop
+ 215:	90                   	nop
+ 216:	c9                   	leave
+ 217:	c3                   	ret
+
+0000000000000218 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 218:	55                   	push   %rbp
+ 219:	48 89 e5             	mov    %rsp,%rbp
+ 21c:	48 83 ec 30          	sub    $0x30,%rsp
+ 220:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 223:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 226:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 229:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 22c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 233:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 237:	74 17                	je     250 <printint+0x38>
+ 239:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 23d:	79 11                	jns    250 <printint+0x38>
+    neg = 1;
+ 23f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 246:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 249:	f7 d8                	neg    %eax
+ 24b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 24e:	eb 06                	jmp    256 <printint+0x3e>
+  } else {
+    x = xx;
+ 250:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 253:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 256:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 25d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 260:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 263:	ba 00 00 00 00       	mov    $0x0,%edx
+ 268:	f7 f1                	div    %ecx
+ 26a:	89 d1                	mov    %edx,%ecx
+ 26c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 26f:	8d 50 01             	lea    0x1(%rax),%edx
+ 272:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 275:	89 c9                	mov    %ecx,%ecx
+ 277:	48 8d 15 42 0d 00 00 	lea    0xd42(%rip),%rdx        # fc0 <digits.0>
+ 27e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 282:	48 98                	cltq
+ 284:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 288:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 28b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 28e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 293:	f7 f6                	div    %esi
+ 295:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 298:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 29c:	75 bf                	jne    25d <printint+0x45>
+  if(neg)
+ 29e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 2a2:	74 2b                	je     2cf <printint+0xb7>
+    buf[i++] = '-';
+ 2a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2a7:	8d 50 01             	lea    0x1(%rax),%edx
+ 2aa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 2ad:	48 98                	cltq
+ 2af:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 2b4:	eb 19                	jmp    2cf <printint+0xb7>
+    putc(fd, buf[i]);
+ 2b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 2b9:	48 98                	cltq
+ 2bb:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 2c0:	0f be d0             	movsbl %al,%edx
+ 2c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 2c6:	89 d6                	mov    %edx,%esi
+ 2c8:	89 c7                	mov    %eax,%edi
+ 2ca:	e8 4c fe ff ff       	call   11b <putc>
+  while(--i >= 0)
+ 2cf:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 2d3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 2d7:	79 dd                	jns    2b6 <printint+0x9e>
+}
+ 2d9:	90                   	nop
+ 2da:	90                   	nop
+ 2db:	c9                   	leave
+ 2dc:	c3                   	ret
+
+00000000000002dd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 2dd:	55                   	push   %rbp
+ 2de:	48 89 e5             	mov    %rsp,%rbp
+ 2e1:	48 83 ec 70          	sub    $0x70,%rsp
+ 2e5:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 2e8:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 2ec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 2f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 2f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 2f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 2fc:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 303:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 307:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 30b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 30f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 313:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 31a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 321:	e9 6b 02 00 00       	jmp    591 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 326:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 329:	48 63 d0             	movslq %eax,%rdx
+ 32c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 330:	48 01 d0             	add    %rdx,%rax
+ 333:	0f b6 00             	movzbl (%rax),%eax
+ 336:	0f be c0             	movsbl %al,%eax
+ 339:	25 ff 00 00 00       	and    $0xff,%eax
+ 33e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 341:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 345:	75 30                	jne    377 <printf+0x9a>
+      if(c == '%'){
+ 347:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 34b:	75 13                	jne    360 <printf+0x83>
+        state = '%';
+ 34d:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 354:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 35b:	e9 2d 02 00 00       	jmp    58d <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 360:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 363:	0f be d0             	movsbl %al,%edx
+ 366:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 369:	89 d6                	mov    %edx,%esi
+ 36b:	89 c7                	mov    %eax,%edi
+ 36d:	e8 a9 fd ff ff       	call   11b <putc>
+ 372:	e9 16 02 00 00       	jmp    58d <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 377:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 37b:	0f 85 0c 02 00 00    	jne    58d <printf+0x2b0>
+      if(c == 'l') {
+ 381:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 385:	75 0c                	jne    393 <printf+0xb6>
+        lflag = 1;
+ 387:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 38e:	e9 fa 01 00 00       	jmp    58d <printf+0x2b0>
+      } else if(c == 'd'){
+ 393:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 397:	0f 85 95 00 00 00    	jne    432 <printf+0x155>
+        if (lflag == 1)
+ 39d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3a1:	75 49                	jne    3ec <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 3a3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3a6:	83 f8 2f             	cmp    $0x2f,%eax
+ 3a9:	77 17                	ja     3c2 <printf+0xe5>
+ 3ab:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3af:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3b2:	89 d2                	mov    %edx,%edx
+ 3b4:	48 01 d0             	add    %rdx,%rax
+ 3b7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3ba:	83 c2 08             	add    $0x8,%edx
+ 3bd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3c0:	eb 0c                	jmp    3ce <printf+0xf1>
+ 3c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3c6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3ca:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3ce:	48 8b 00             	mov    (%rax),%rax
+ 3d1:	89 c6                	mov    %eax,%esi
+ 3d3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3d6:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3db:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3e0:	89 c7                	mov    %eax,%edi
+ 3e2:	e8 5d fd ff ff       	call   144 <printint64>
+ 3e7:	e9 9a 01 00 00       	jmp    586 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 3ec:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3ef:	83 f8 2f             	cmp    $0x2f,%eax
+ 3f2:	77 17                	ja     40b <printf+0x12e>
+ 3f4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3f8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3fb:	89 d2                	mov    %edx,%edx
+ 3fd:	48 01 d0             	add    %rdx,%rax
+ 400:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 403:	83 c2 08             	add    $0x8,%edx
+ 406:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 409:	eb 0c                	jmp    417 <printf+0x13a>
+ 40b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 40f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 413:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 417:	8b 30                	mov    (%rax),%esi
+ 419:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 41c:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 421:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 426:	89 c7                	mov    %eax,%edi
+ 428:	e8 eb fd ff ff       	call   218 <printint>
+ 42d:	e9 54 01 00 00       	jmp    586 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 432:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 436:	74 0a                	je     442 <printf+0x165>
+ 438:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 43c:	0f 85 95 00 00 00    	jne    4d7 <printf+0x1fa>
+        if (lflag == 1)
+ 442:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 446:	75 49                	jne    491 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 448:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 44b:	83 f8 2f             	cmp    $0x2f,%eax
+ 44e:	77 17                	ja     467 <printf+0x18a>
+ 450:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 454:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 457:	89 d2                	mov    %edx,%edx
+ 459:	48 01 d0             	add    %rdx,%rax
+ 45c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 45f:	83 c2 08             	add    $0x8,%edx
+ 462:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 465:	eb 0c                	jmp    473 <printf+0x196>
+ 467:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 46b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 46f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 473:	48 8b 00             	mov    (%rax),%rax
+ 476:	89 c6                	mov    %eax,%esi
+ 478:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 47b:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 480:	ba 10 00 00 00       	mov    $0x10,%edx
+ 485:	89 c7                	mov    %eax,%edi
+ 487:	e8 b8 fc ff ff       	call   144 <printint64>
+        if (lflag == 1)
+ 48c:	e9 f5 00 00 00       	jmp    586 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 491:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 494:	83 f8 2f             	cmp    $0x2f,%eax
+ 497:	77 17                	ja     4b0 <printf+0x1d3>
+ 499:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 49d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4a0:	89 d2                	mov    %edx,%edx
+ 4a2:	48 01 d0             	add    %rdx,%rax
+ 4a5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4a8:	83 c2 08             	add    $0x8,%edx
+ 4ab:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4ae:	eb 0c                	jmp    4bc <printf+0x1df>
+ 4b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 4b4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4b8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4bc:	8b 30                	mov    (%rax),%esi
+ 4be:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 4c6:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4cb:	89 c7                	mov    %eax,%edi
+ 4cd:	e8 46 fd ff ff       	call   218 <printint>
+        if (lflag == 1)
+ 4d2:	e9 af 00 00 00       	jmp    586 <printf+0x2a9>
+      } else if(c == 's'){
+ 4d7:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 4db:	75 6e                	jne    54b <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 4dd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 4e0:	83 f8 2f             	cmp    $0x2f,%eax
+ 4e3:	77 17                	ja     4fc <printf+0x21f>
+ 4e5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 4e9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4ec:	89 d2                	mov    %edx,%edx
+ 4ee:	48 01 d0             	add    %rdx,%rax
+ 4f1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 4f4:	83 c2 08             	add    $0x8,%edx
+ 4f7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 4fa:	eb 0c                	jmp    508 <printf+0x22b>
+ 4fc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 500:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 504:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 508:	48 8b 00             	mov    (%rax),%rax
+ 50b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 50f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 514:	75 28                	jne    53e <printf+0x261>
+          s = "(null)";
+ 516:	48 8d 05 12 08 00 00 	lea    0x812(%rip),%rax        # d2f <malloc+0x1d0>
+ 51d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 521:	eb 1b                	jmp    53e <printf+0x261>
+          putc(fd, *s);
+ 523:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 527:	0f b6 00             	movzbl (%rax),%eax
+ 52a:	0f be d0             	movsbl %al,%edx
+ 52d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 530:	89 d6                	mov    %edx,%esi
+ 532:	89 c7                	mov    %eax,%edi
+ 534:	e8 e2 fb ff ff       	call   11b <putc>
+        for(; *s; s++)
+ 539:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 53e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 542:	0f b6 00             	movzbl (%rax),%eax
+ 545:	84 c0                	test   %al,%al
+ 547:	75 da                	jne    523 <printf+0x246>
+ 549:	eb 3b                	jmp    586 <printf+0x2a9>
+      } else if(c == '%'){
+ 54b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 54f:	75 14                	jne    565 <printf+0x288>
+        putc(fd, c);
+ 551:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 554:	0f be d0             	movsbl %al,%edx
+ 557:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 55a:	89 d6                	mov    %edx,%esi
+ 55c:	89 c7                	mov    %eax,%edi
+ 55e:	e8 b8 fb ff ff       	call   11b <putc>
+ 563:	eb 21                	jmp    586 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 565:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 568:	be 25 00 00 00       	mov    $0x25,%esi
+ 56d:	89 c7                	mov    %eax,%edi
+ 56f:	e8 a7 fb ff ff       	call   11b <putc>
+        putc(fd, c);
+ 574:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 577:	0f be d0             	movsbl %al,%edx
+ 57a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 57d:	89 d6                	mov    %edx,%esi
+ 57f:	89 c7                	mov    %eax,%edi
+ 581:	e8 95 fb ff ff       	call   11b <putc>
+      }
+      state = 0;
+ 586:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 58d:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 591:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 594:	48 63 d0             	movslq %eax,%rdx
+ 597:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 59b:	48 01 d0             	add    %rdx,%rax
+ 59e:	0f b6 00             	movzbl (%rax),%eax
+ 5a1:	84 c0                	test   %al,%al
+ 5a3:	0f 85 7d fd ff ff    	jne    326 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 5a9:	90                   	nop
+ 5aa:	90                   	nop
+ 5ab:	c9                   	leave
+ 5ac:	c3                   	ret
+
+00000000000005ad <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 5ad:	55                   	push   %rbp
+ 5ae:	48 89 e5             	mov    %rsp,%rbp
+ 5b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5b5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 5b8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 5bb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 5bf:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 5c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 5c5:	48 89 ce             	mov    %rcx,%rsi
+ 5c8:	48 89 f7             	mov    %rsi,%rdi
+ 5cb:	89 d1                	mov    %edx,%ecx
+ 5cd:	fc                   	cld
+ 5ce:	f3 aa                	rep stos %al,%es:(%rdi)
+ 5d0:	89 ca                	mov    %ecx,%edx
+ 5d2:	48 89 fe             	mov    %rdi,%rsi
+ 5d5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 5d9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 5dc:	90                   	nop
+ 5dd:	5d                   	pop    %rbp
+ 5de:	c3                   	ret
+
+00000000000005df <strcpy>:
+{
+ 5df:	55                   	push   %rbp
+ 5e0:	48 89 e5             	mov    %rsp,%rbp
+ 5e3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 5e7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 5eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 5ef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 5f3:	90                   	nop
+ 5f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 5f8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 5fc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 604:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 608:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 60c:	0f b6 12             	movzbl (%rdx),%edx
+ 60f:	88 10                	mov    %dl,(%rax)
+ 611:	0f b6 00             	movzbl (%rax),%eax
+ 614:	84 c0                	test   %al,%al
+ 616:	75 dc                	jne    5f4 <strcpy+0x15>
+  return os;
+ 618:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 61c:	5d                   	pop    %rbp
+ 61d:	c3                   	ret
+
+000000000000061e <strcmp>:
+{
+ 61e:	55                   	push   %rbp
+ 61f:	48 89 e5             	mov    %rsp,%rbp
+ 622:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 626:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 62a:	eb 0a                	jmp    636 <strcmp+0x18>
+    p++, q++;
+ 62c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 631:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 636:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 63a:	0f b6 00             	movzbl (%rax),%eax
+ 63d:	84 c0                	test   %al,%al
+ 63f:	74 12                	je     653 <strcmp+0x35>
+ 641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 645:	0f b6 10             	movzbl (%rax),%edx
+ 648:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 64c:	0f b6 00             	movzbl (%rax),%eax
+ 64f:	38 c2                	cmp    %al,%dl
+ 651:	74 d9                	je     62c <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 657:	0f b6 00             	movzbl (%rax),%eax
+ 65a:	0f b6 d0             	movzbl %al,%edx
+ 65d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 661:	0f b6 00             	movzbl (%rax),%eax
+ 664:	0f b6 c0             	movzbl %al,%eax
+ 667:	29 c2                	sub    %eax,%edx
+ 669:	89 d0                	mov    %edx,%eax
+}
+ 66b:	5d                   	pop    %rbp
+ 66c:	c3                   	ret
+
+000000000000066d <strlen>:
+{
+ 66d:	55                   	push   %rbp
+ 66e:	48 89 e5             	mov    %rsp,%rbp
+ 671:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 675:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 67c:	eb 04                	jmp    682 <strlen+0x15>
+ 67e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 682:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 685:	48 63 d0             	movslq %eax,%rdx
+ 688:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 68c:	48 01 d0             	add    %rdx,%rax
+ 68f:	0f b6 00             	movzbl (%rax),%eax
+ 692:	84 c0                	test   %al,%al
+ 694:	75 e8                	jne    67e <strlen+0x11>
+  return n;
+ 696:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 699:	5d                   	pop    %rbp
+ 69a:	c3                   	ret
+
+000000000000069b <memset>:
+{
+ 69b:	55                   	push   %rbp
+ 69c:	48 89 e5             	mov    %rsp,%rbp
+ 69f:	48 83 ec 10          	sub    $0x10,%rsp
+ 6a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6a7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 6aa:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 6ad:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 6b0:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 6b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6b7:	89 ce                	mov    %ecx,%esi
+ 6b9:	48 89 c7             	mov    %rax,%rdi
+ 6bc:	e8 ec fe ff ff       	call   5ad <stosb>
+  return dst;
+ 6c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 6c5:	c9                   	leave
+ 6c6:	c3                   	ret
+
+00000000000006c7 <strchr>:
+{
+ 6c7:	55                   	push   %rbp
+ 6c8:	48 89 e5             	mov    %rsp,%rbp
+ 6cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 6cf:	89 f0                	mov    %esi,%eax
+ 6d1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 6d4:	eb 17                	jmp    6ed <strchr+0x26>
+    if(*s == c)
+ 6d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6da:	0f b6 00             	movzbl (%rax),%eax
+ 6dd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 6e0:	75 06                	jne    6e8 <strchr+0x21>
+      return (char*)s;
+ 6e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6e6:	eb 15                	jmp    6fd <strchr+0x36>
+  for(; *s; s++)
+ 6e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 6ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 6f1:	0f b6 00             	movzbl (%rax),%eax
+ 6f4:	84 c0                	test   %al,%al
+ 6f6:	75 de                	jne    6d6 <strchr+0xf>
+  return 0;
+ 6f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6fd:	5d                   	pop    %rbp
+ 6fe:	c3                   	ret
+
+00000000000006ff <gets>:
+gets(char *buf, int max)
+{
+ 6ff:	55                   	push   %rbp
+ 700:	48 89 e5             	mov    %rsp,%rbp
+ 703:	48 83 ec 20          	sub    $0x20,%rsp
+ 707:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 70b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 70e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 715:	eb 48                	jmp    75f <gets+0x60>
+    cc = read(0, &c, 1);
+ 717:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 71b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 720:	48 89 c6             	mov    %rax,%rsi
+ 723:	bf 00 00 00 00       	mov    $0x0,%edi
+ 728:	e8 6f 01 00 00       	call   89c <read>
+ 72d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 730:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 734:	7e 36                	jle    76c <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 736:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 739:	8d 50 01             	lea    0x1(%rax),%edx
+ 73c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 73f:	48 63 d0             	movslq %eax,%rdx
+ 742:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 746:	48 01 c2             	add    %rax,%rdx
+ 749:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 74d:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 74f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 753:	3c 0a                	cmp    $0xa,%al
+ 755:	74 16                	je     76d <gets+0x6e>
+ 757:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 75b:	3c 0d                	cmp    $0xd,%al
+ 75d:	74 0e                	je     76d <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 75f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 762:	83 c0 01             	add    $0x1,%eax
+ 765:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 768:	7f ad                	jg     717 <gets+0x18>
+ 76a:	eb 01                	jmp    76d <gets+0x6e>
+      break;
+ 76c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 76d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 770:	48 63 d0             	movslq %eax,%rdx
+ 773:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 777:	48 01 d0             	add    %rdx,%rax
+ 77a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 77d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 781:	c9                   	leave
+ 782:	c3                   	ret
+
+0000000000000783 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 783:	55                   	push   %rbp
+ 784:	48 89 e5             	mov    %rsp,%rbp
+ 787:	48 83 ec 20          	sub    $0x20,%rsp
+ 78b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 78f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 797:	be 00 00 00 00       	mov    $0x0,%esi
+ 79c:	48 89 c7             	mov    %rax,%rdi
+ 79f:	e8 20 01 00 00       	call   8c4 <open>
+ 7a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 7a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 7ab:	79 07                	jns    7b4 <stat+0x31>
+    return -1;
+ 7ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7b2:	eb 21                	jmp    7d5 <stat+0x52>
+  r = fstat(fd, st);
+ 7b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 7b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7bb:	48 89 d6             	mov    %rdx,%rsi
+ 7be:	89 c7                	mov    %eax,%edi
+ 7c0:	e8 17 01 00 00       	call   8dc <fstat>
+ 7c5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 7c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 7cb:	89 c7                	mov    %eax,%edi
+ 7cd:	e8 da 00 00 00       	call   8ac <close>
+  return r;
+ 7d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 7d5:	c9                   	leave
+ 7d6:	c3                   	ret
+
+00000000000007d7 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 7d7:	55                   	push   %rbp
+ 7d8:	48 89 e5             	mov    %rsp,%rbp
+ 7db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 7df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 7e6:	eb 28                	jmp    810 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 7e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 7eb:	89 d0                	mov    %edx,%eax
+ 7ed:	c1 e0 02             	shl    $0x2,%eax
+ 7f0:	01 d0                	add    %edx,%eax
+ 7f2:	01 c0                	add    %eax,%eax
+ 7f4:	89 c1                	mov    %eax,%ecx
+ 7f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 7fe:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 802:	0f b6 00             	movzbl (%rax),%eax
+ 805:	0f be c0             	movsbl %al,%eax
+ 808:	01 c8                	add    %ecx,%eax
+ 80a:	83 e8 30             	sub    $0x30,%eax
+ 80d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 810:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 814:	0f b6 00             	movzbl (%rax),%eax
+ 817:	3c 2f                	cmp    $0x2f,%al
+ 819:	7e 0b                	jle    826 <atoi+0x4f>
+ 81b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 81f:	0f b6 00             	movzbl (%rax),%eax
+ 822:	3c 39                	cmp    $0x39,%al
+ 824:	7e c2                	jle    7e8 <atoi+0x11>
+  return n;
+ 826:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 829:	5d                   	pop    %rbp
+ 82a:	c3                   	ret
+
+000000000000082b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 82b:	55                   	push   %rbp
+ 82c:	48 89 e5             	mov    %rsp,%rbp
+ 82f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 833:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 837:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 83a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 83e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 842:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 846:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 84a:	eb 1d                	jmp    869 <memmove+0x3e>
+    *dst++ = *src++;
+ 84c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 850:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 854:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 858:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 85c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 860:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 864:	0f b6 12             	movzbl (%rdx),%edx
+ 867:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 869:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 86c:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 86f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 872:	85 c0                	test   %eax,%eax
+ 874:	7f d6                	jg     84c <memmove+0x21>
+  return vdst;
+ 876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 87a:	5d                   	pop    %rbp
+ 87b:	c3                   	ret
+
+000000000000087c <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 87c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+0000000000000884 <exit>:
+SYSCALL(exit)
+ 884:	b8 02 00 00 00       	mov    $0x2,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+000000000000088c <wait>:
+SYSCALL(wait)
+ 88c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+0000000000000894 <pipe>:
+SYSCALL(pipe)
+ 894:	b8 04 00 00 00       	mov    $0x4,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+000000000000089c <read>:
+SYSCALL(read)
+ 89c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8a1:	cd 40                	int    $0x40
+ 8a3:	c3                   	ret
+
+00000000000008a4 <write>:
+SYSCALL(write)
+ 8a4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 8a9:	cd 40                	int    $0x40
+ 8ab:	c3                   	ret
+
+00000000000008ac <close>:
+SYSCALL(close)
+ 8ac:	b8 15 00 00 00       	mov    $0x15,%eax
+ 8b1:	cd 40                	int    $0x40
+ 8b3:	c3                   	ret
+
+00000000000008b4 <kill>:
+SYSCALL(kill)
+ 8b4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 8b9:	cd 40                	int    $0x40
+ 8bb:	c3                   	ret
+
+00000000000008bc <exec>:
+SYSCALL(exec)
+ 8bc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8c1:	cd 40                	int    $0x40
+ 8c3:	c3                   	ret
+
+00000000000008c4 <open>:
+SYSCALL(open)
+ 8c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8c9:	cd 40                	int    $0x40
+ 8cb:	c3                   	ret
+
+00000000000008cc <mknod>:
+SYSCALL(mknod)
+ 8cc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+00000000000008d4 <unlink>:
+SYSCALL(unlink)
+ 8d4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8d9:	cd 40                	int    $0x40
+ 8db:	c3                   	ret
+
+00000000000008dc <fstat>:
+SYSCALL(fstat)
+ 8dc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8e1:	cd 40                	int    $0x40
+ 8e3:	c3                   	ret
+
+00000000000008e4 <link>:
+SYSCALL(link)
+ 8e4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8e9:	cd 40                	int    $0x40
+ 8eb:	c3                   	ret
+
+00000000000008ec <mkdir>:
+SYSCALL(mkdir)
+ 8ec:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8f1:	cd 40                	int    $0x40
+ 8f3:	c3                   	ret
+
+00000000000008f4 <chdir>:
+SYSCALL(chdir)
+ 8f4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8f9:	cd 40                	int    $0x40
+ 8fb:	c3                   	ret
+
+00000000000008fc <dup>:
+SYSCALL(dup)
+ 8fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 901:	cd 40                	int    $0x40
+ 903:	c3                   	ret
+
+0000000000000904 <getpid>:
+SYSCALL(getpid)
+ 904:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 909:	cd 40                	int    $0x40
+ 90b:	c3                   	ret
+
+000000000000090c <sbrk>:
+SYSCALL(sbrk)
+ 90c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 911:	cd 40                	int    $0x40
+ 913:	c3                   	ret
+
+0000000000000914 <sleep>:
+SYSCALL(sleep)
+ 914:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 919:	cd 40                	int    $0x40
+ 91b:	c3                   	ret
+
+000000000000091c <uptime>:
+SYSCALL(uptime)
+ 91c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 921:	cd 40                	int    $0x40
+ 923:	c3                   	ret
+
+0000000000000924 <sysinfo>:
+SYSCALL(sysinfo)
+ 924:	b8 16 00 00 00       	mov    $0x16,%eax
+ 929:	cd 40                	int    $0x40
+ 92b:	c3                   	ret
+
+000000000000092c <mmap>:
+SYSCALL(mmap)
+ 92c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 931:	cd 40                	int    $0x40
+ 933:	c3                   	ret
+
+0000000000000934 <munmap>:
+SYSCALL(munmap)
+ 934:	b8 18 00 00 00       	mov    $0x18,%eax
+ 939:	cd 40                	int    $0x40
+ 93b:	c3                   	ret
+
+000000000000093c <crashn>:
+SYSCALL(crashn)
+ 93c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 941:	cd 40                	int    $0x40
+ 943:	c3                   	ret
+
+0000000000000944 <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 944:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 949:	cd 40                	int    $0x40
+ 94b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 94e:	74 02                	je     952 <mmap2+0xe>
+ 950:	89 c0                	mov    %eax,%eax
+ 952:	c3                   	ret
+
+0000000000000953 <munmap2>:
+SYSCALL(munmap2)
+ 953:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+000000000000095b <msync>:
+SYSCALL(msync)
+ 95b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+0000000000000963 <sendfile>:
+SYSCALL(sendfile)
+ 963:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+000000000000096b <splice>:
+SYSCALL(splice)
+ 96b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+0000000000000973 <pread>:
+SYSCALL(pread)
+ 973:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+000000000000097b <pwrite>:
+SYSCALL(pwrite)
+ 97b:	b8 20 00 00 00       	mov    $0x20,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+0000000000000983 <readv>:
+SYSCALL(readv)
+ 983:	b8 21 00 00 00       	mov    $0x21,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+000000000000098b <writev>:
+SYSCALL(writev)
+ 98b:	b8 22 00 00 00       	mov    $0x22,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+0000000000000993 <poll>:
+SYSCALL(poll)
+ 993:	b8 23 00 00 00       	mov    $0x23,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+000000000000099b <pipe2>:
+SYSCALL(pipe2)
+ 99b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+00000000000009a3 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ 9a3:	55                   	push   %rbp
+ 9a4:	48 89 e5             	mov    %rsp,%rbp
+ 9a7:	48 83 ec 20          	sub    $0x20,%rsp
+ 9ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 9b3:	48 83 e8 10          	sub    $0x10,%rax
+ 9b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ 9bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9bf:	48 8b 10             	mov    (%rax),%rdx
+ 9c2:	48 8d 05 37 06 00 00 	lea    0x637(%rip),%rax        # 1000 <bigblock>
+ 9c9:	48 39 c2             	cmp    %rax,%rdx
+ 9cc:	75 1f                	jne    9ed <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ 9ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9d2:	8b 40 08             	mov    0x8(%rax),%eax
+ 9d5:	c1 e0 04             	shl    $0x4,%eax
+ 9d8:	89 c2                	mov    %eax,%edx
+ 9da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9de:	89 d6                	mov    %edx,%esi
+ 9e0:	48 89 c7             	mov    %rax,%rdi
+ 9e3:	e8 6b ff ff ff       	call   953 <munmap2>
+    return;
+ 9e8:	e9 0b 01 00 00       	jmp    af8 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ed:	48 8b 05 fc 05 00 00 	mov    0x5fc(%rip),%rax        # ff0 <freep>
+ 9f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9f8:	eb 2f                	jmp    a29 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9fe:	48 8b 00             	mov    (%rax),%rax
+ a01:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a05:	72 17                	jb     a1e <free+0x7b>
+ a07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a0b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a0f:	72 2f                	jb     a40 <free+0x9d>
+ a11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a15:	48 8b 00             	mov    (%rax),%rax
+ a18:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a1c:	72 22                	jb     a40 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a22:	48 8b 00             	mov    (%rax),%rax
+ a25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ a29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a2d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ a31:	73 c7                	jae    9fa <free+0x57>
+ a33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a37:	48 8b 00             	mov    (%rax),%rax
+ a3a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a3e:	73 ba                	jae    9fa <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a44:	8b 40 08             	mov    0x8(%rax),%eax
+ a47:	89 c0                	mov    %eax,%eax
+ a49:	48 c1 e0 04          	shl    $0x4,%rax
+ a4d:	48 89 c2             	mov    %rax,%rdx
+ a50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a54:	48 01 c2             	add    %rax,%rdx
+ a57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5b:	48 8b 00             	mov    (%rax),%rax
+ a5e:	48 39 c2             	cmp    %rax,%rdx
+ a61:	75 2d                	jne    a90 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a67:	8b 50 08             	mov    0x8(%rax),%edx
+ a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6e:	48 8b 00             	mov    (%rax),%rax
+ a71:	8b 40 08             	mov    0x8(%rax),%eax
+ a74:	01 c2                	add    %eax,%edx
+ a76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a7a:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a81:	48 8b 00             	mov    (%rax),%rax
+ a84:	48 8b 10             	mov    (%rax),%rdx
+ a87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a8b:	48 89 10             	mov    %rdx,(%rax)
+ a8e:	eb 0e                	jmp    a9e <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a94:	48 8b 10             	mov    (%rax),%rdx
+ a97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a9b:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aa2:	8b 40 08             	mov    0x8(%rax),%eax
+ aa5:	89 c0                	mov    %eax,%eax
+ aa7:	48 c1 e0 04          	shl    $0x4,%rax
+ aab:	48 89 c2             	mov    %rax,%rdx
+ aae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab2:	48 01 d0             	add    %rdx,%rax
+ ab5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ ab9:	75 27                	jne    ae2 <free+0x13f>
+    p->s.size += bp->s.size;
+ abb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ abf:	8b 50 08             	mov    0x8(%rax),%edx
+ ac2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ac6:	8b 40 08             	mov    0x8(%rax),%eax
+ ac9:	01 c2                	add    %eax,%edx
+ acb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ acf:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ ad2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ad6:	48 8b 10             	mov    (%rax),%rdx
+ ad9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ add:	48 89 10             	mov    %rdx,(%rax)
+ ae0:	eb 0b                	jmp    aed <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ae6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ aea:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ aed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ af1:	48 89 05 f8 04 00 00 	mov    %rax,0x4f8(%rip)        # ff0 <freep>
+}
+ af8:	c9                   	leave
+ af9:	c3                   	ret
+
+0000000000000afa <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ afa:	55                   	push   %rbp
+ afb:	48 89 e5             	mov    %rsp,%rbp
+ afe:	48 83 ec 20          	sub    $0x20,%rsp
+ b02:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b05:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ b0c:	77 07                	ja     b15 <morecore+0x1b>
+    nu = 4096;
+ b0e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ b15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b18:	c1 e0 04             	shl    $0x4,%eax
+ b1b:	89 c7                	mov    %eax,%edi
+ b1d:	e8 ea fd ff ff       	call   90c <sbrk>
+ b22:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ b26:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b2b:	75 07                	jne    b34 <morecore+0x3a>
+    return 0;
+ b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+ b32:	eb 29                	jmp    b5d <morecore+0x63>
+  hp = (Header*)p;
+ b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ b3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b40:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b43:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ b46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b4a:	48 83 c0 10          	add    $0x10,%rax
+ b4e:	48 89 c7             	mov    %rax,%rdi
+ b51:	e8 4d fe ff ff       	call   9a3 <free>
+  return freep;
+ b56:	48 8b 05 93 04 00 00 	mov    0x493(%rip),%rax        # ff0 <freep>
+}
+ b5d:	c9                   	leave
+ b5e:	c3                   	ret
+
+0000000000000b5f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b5f:	55                   	push   %rbp
+ b60:	48 89 e5             	mov    %rsp,%rbp
+ b63:	48 83 ec 30          	sub    $0x30,%rsp
+ b67:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b6d:	48 83 c0 0f          	add    $0xf,%rax
+ b71:	48 c1 e8 04          	shr    $0x4,%rax
+ b75:	83 c0 01             	add    $0x1,%eax
+ b78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ b7b:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ b82:	76 62                	jbe    be6 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ b84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b87:	c1 e0 04             	shl    $0x4,%eax
+ b8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ b90:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ b96:	b9 22 00 00 00       	mov    $0x22,%ecx
+ b9b:	ba 03 00 00 00       	mov    $0x3,%edx
+ ba0:	89 c6                	mov    %eax,%esi
+ ba2:	bf 00 00 00 00       	mov    $0x0,%edi
+ ba7:	e8 98 fd ff ff       	call   944 <mmap2>
+ bac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ bb0:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ bb5:	75 0a                	jne    bc1 <malloc+0x62>
+      return 0;
+ bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+ bbc:	e9 1c 01 00 00       	jmp    cdd <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ bc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc5:	48 8d 15 34 04 00 00 	lea    0x434(%rip),%rdx        # 1000 <bigblock>
+ bcc:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ bcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bd6:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ bd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bdd:	48 83 c0 10          	add    $0x10,%rax
+ be1:	e9 f7 00 00 00       	jmp    cdd <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ be6:	48 8b 05 03 04 00 00 	mov    0x403(%rip),%rax        # ff0 <freep>
+ bed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ bf1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ bf6:	75 2e                	jne    c26 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ bf8:	48 8d 05 e1 03 00 00 	lea    0x3e1(%rip),%rax        # fe0 <base>
+ bff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c07:	48 89 05 e2 03 00 00 	mov    %rax,0x3e2(%rip)        # ff0 <freep>
+ c0e:	48 8b 05 db 03 00 00 	mov    0x3db(%rip),%rax        # ff0 <freep>
+ c15:	48 89 05 c4 03 00 00 	mov    %rax,0x3c4(%rip)        # fe0 <base>
+    base.s.size = 0;
+ c1c:	c7 05 c2 03 00 00 00 	movl   $0x0,0x3c2(%rip)        # fe8 <base+0x8>
+ c23:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c2a:	48 8b 00             	mov    (%rax),%rax
+ c2d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ c31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c35:	8b 40 08             	mov    0x8(%rax),%eax
+ c38:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ c3b:	72 5f                	jb     c9c <malloc+0x13d>
+      if(p->s.size == nunits)
+ c3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c41:	8b 40 08             	mov    0x8(%rax),%eax
+ c44:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ c47:	75 10                	jne    c59 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ c49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c4d:	48 8b 10             	mov    (%rax),%rdx
+ c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c54:	48 89 10             	mov    %rdx,(%rax)
+ c57:	eb 2e                	jmp    c87 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ c59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c5d:	8b 40 08             	mov    0x8(%rax),%eax
+ c60:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ c63:	89 c2                	mov    %eax,%edx
+ c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c69:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ c6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c70:	8b 40 08             	mov    0x8(%rax),%eax
+ c73:	89 c0                	mov    %eax,%eax
+ c75:	48 c1 e0 04          	shl    $0x4,%rax
+ c79:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ c7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c81:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c84:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c8b:	48 89 05 5e 03 00 00 	mov    %rax,0x35e(%rip)        # ff0 <freep>
+      return (void*)(p + 1);
+ c92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c96:	48 83 c0 10          	add    $0x10,%rax
+ c9a:	eb 41                	jmp    cdd <malloc+0x17e>
+    }
+    if(p == freep)
+ c9c:	48 8b 05 4d 03 00 00 	mov    0x34d(%rip),%rax        # ff0 <freep>
+ ca3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ ca7:	75 1c                	jne    cc5 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ ca9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ cac:	89 c7                	mov    %eax,%edi
+ cae:	e8 47 fe ff ff       	call   afa <morecore>
+ cb3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ cb7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ cbc:	75 07                	jne    cc5 <malloc+0x166>
+        return 0;
+ cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+ cc3:	eb 18                	jmp    cdd <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cc9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ ccd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ cd1:	48 8b 00             	mov    (%rax),%rax
+ cd4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ cd8:	e9 54 ff ff ff       	jmp    c31 <malloc+0xd2>
+  }
+}
+ cdd:	c9                   	leave
+ cde:	c3                   	ret
@@ -0,0 +1,3004 @@
+
+out/user/_inlinetest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <checkfile>:
+char buf[3 * BSIZE];
+
+// Check that name holds n bytes, byte i being c + i % 26.
+void
+checkfile(char *name, int n, char c)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 30          	sub    $0x30,%rsp
+       8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+       c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+       f:	89 d0                	mov    %edx,%eax
+      11:	88 45 d0             	mov    %al,-0x30(%rbp)
+  struct stat st;
+  int fd, i;
+
+  if((fd = open(name, O_RDONLY)) < 0)
+      14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      18:	be 00 00 00 00       	mov    $0x0,%esi
+      1d:	48 89 c7             	mov    %rax,%rdi
+      20:	e8 20 1d 00 00       	call   1d45 <open>
+      25:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      28:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      2c:	79 60                	jns    8e <checkfile+0x8e>
+    error("unable to open %s", name);
+      2e:	8b 05 fc 27 00 00    	mov    0x27fc(%rip),%eax        # 2830 <stdout>
+      34:	ba 1e 00 00 00       	mov    $0x1e,%edx
+      39:	48 8d 0d 20 21 00 00 	lea    0x2120(%rip),%rcx        # 2160 <malloc+0x180>
+      40:	48 89 ce             	mov    %rcx,%rsi
+      43:	89 c7                	mov    %eax,%edi
+      45:	b8 00 00 00 00       	mov    $0x0,%eax
+      4a:	e8 0f 17 00 00       	call   175e <printf>
+      4f:	8b 05 db 27 00 00    	mov    0x27db(%rip),%eax        # 2830 <stdout>
+      55:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+      59:	48 8d 0d 12 21 00 00 	lea    0x2112(%rip),%rcx        # 2172 <malloc+0x192>
+      60:	48 89 ce             	mov    %rcx,%rsi
+      63:	89 c7                	mov    %eax,%edi
+      65:	b8 00 00 00 00       	mov    $0x0,%eax
+      6a:	e8 ef 16 00 00       	call   175e <printf>
+      6f:	8b 05 bb 27 00 00    	mov    0x27bb(%rip),%eax        # 2830 <stdout>
+      75:	48 8d 15 08 21 00 00 	lea    0x2108(%rip),%rdx        # 2184 <malloc+0x1a4>
+      7c:	48 89 d6             	mov    %rdx,%rsi
+      7f:	89 c7                	mov    %eax,%edi
+      81:	b8 00 00 00 00       	mov    $0x0,%eax
+      86:	e8 d3 16 00 00       	call   175e <printf>
+      8b:	90                   	nop
+      8c:	eb fd                	jmp    8b <checkfile+0x8b>
+  fstat(fd, &st);
+      8e:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+      92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      95:	48 89 d6             	mov    %rdx,%rsi
+      98:	89 c7                	mov    %eax,%edi
+      9a:	e8 be 1c 00 00       	call   1d5d <fstat>
+  if(st.size != n)
+      9f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      a2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+      a5:	39 c2                	cmp    %eax,%edx
+      a7:	74 66                	je     10f <checkfile+0x10f>
+    error("%s has %d bytes, not %d", name, st.size, n);
+      a9:	8b 05 81 27 00 00    	mov    0x2781(%rip),%eax        # 2830 <stdout>
+      af:	ba 21 00 00 00       	mov    $0x21,%edx
+      b4:	48 8d 0d a5 20 00 00 	lea    0x20a5(%rip),%rcx        # 2160 <malloc+0x180>
+      bb:	48 89 ce             	mov    %rcx,%rsi
+      be:	89 c7                	mov    %eax,%edi
+      c0:	b8 00 00 00 00       	mov    $0x0,%eax
+      c5:	e8 94 16 00 00       	call   175e <printf>
+      ca:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+      cd:	8b 05 5d 27 00 00    	mov    0x275d(%rip),%eax        # 2830 <stdout>
+      d3:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+      d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+      da:	41 89 f0             	mov    %esi,%r8d
+      dd:	48 8d 35 a2 20 00 00 	lea    0x20a2(%rip),%rsi        # 2186 <malloc+0x1a6>
+      e4:	89 c7                	mov    %eax,%edi
+      e6:	b8 00 00 00 00       	mov    $0x0,%eax
+      eb:	e8 6e 16 00 00       	call   175e <printf>
+      f0:	8b 05 3a 27 00 00    	mov    0x273a(%rip),%eax        # 2830 <stdout>
+      f6:	48 8d 15 87 20 00 00 	lea    0x2087(%rip),%rdx        # 2184 <malloc+0x1a4>
+      fd:	48 89 d6             	mov    %rdx,%rsi
+     100:	89 c7                	mov    %eax,%edi
+     102:	b8 00 00 00 00       	mov    $0x0,%eax
+     107:	e8 52 16 00 00       	call   175e <printf>
+     10c:	90                   	nop
+     10d:	eb fd                	jmp    10c <checkfile+0x10c>
+  memset(buf, 0, sizeof(buf));
+     10f:	ba 00 06 00 00       	mov    $0x600,%edx
+     114:	be 00 00 00 00       	mov    $0x0,%esi
+     119:	48 8d 05 a0 27 00 00 	lea    0x27a0(%rip),%rax        # 28c0 <buf>
+     120:	48 89 c7             	mov    %rax,%rdi
+     123:	e8 f4 19 00 00       	call   1b1c <memset>
+  if(read(fd, buf, sizeof(buf)) != n)
+     128:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     12b:	ba 00 06 00 00       	mov    $0x600,%edx
+     130:	48 8d 0d 89 27 00 00 	lea    0x2789(%rip),%rcx        # 28c0 <buf>
+     137:	48 89 ce             	mov    %rcx,%rsi
+     13a:	89 c7                	mov    %eax,%edi
+     13c:	e8 dc 1b 00 00       	call   1d1d <read>
+     141:	39 45 d4             	cmp    %eax,-0x2c(%rbp)
+     144:	74 60                	je     1a6 <checkfile+0x1a6>
+    error("unable to read the %d bytes of %s", n, name);
+     146:	8b 05 e4 26 00 00    	mov    0x26e4(%rip),%eax        # 2830 <stdout>
+     14c:	ba 24 00 00 00       	mov    $0x24,%edx
+     151:	48 8d 0d 08 20 00 00 	lea    0x2008(%rip),%rcx        # 2160 <malloc+0x180>
+     158:	48 89 ce             	mov    %rcx,%rsi
+     15b:	89 c7                	mov    %eax,%edi
+     15d:	b8 00 00 00 00       	mov    $0x0,%eax
+     162:	e8 f7 15 00 00       	call   175e <printf>
+     167:	8b 05 c3 26 00 00    	mov    0x26c3(%rip),%eax        # 2830 <stdout>
+     16d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     171:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     174:	48 8d 35 25 20 00 00 	lea    0x2025(%rip),%rsi        # 21a0 <malloc+0x1c0>
+     17b:	89 c7                	mov    %eax,%edi
+     17d:	b8 00 00 00 00       	mov    $0x0,%eax
+     182:	e8 d7 15 00 00       	call   175e <printf>
+     187:	8b 05 a3 26 00 00    	mov    0x26a3(%rip),%eax        # 2830 <stdout>
+     18d:	48 8d 15 f0 1f 00 00 	lea    0x1ff0(%rip),%rdx        # 2184 <malloc+0x1a4>
+     194:	48 89 d6             	mov    %rdx,%rsi
+     197:	89 c7                	mov    %eax,%edi
+     199:	b8 00 00 00 00       	mov    $0x0,%eax
+     19e:	e8 bb 15 00 00       	call   175e <printf>
+     1a3:	90                   	nop
+     1a4:	eb fd                	jmp    1a3 <checkfile+0x1a3>
+  for(i = 0; i < n; i++)
+     1a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1ad:	e9 ea 00 00 00       	jmp    29c <checkfile+0x29c>
+    if(buf[i] != c + i % 26)
+     1b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1b5:	48 98                	cltq
+     1b7:	48 8d 15 02 27 00 00 	lea    0x2702(%rip),%rdx        # 28c0 <buf>
+     1be:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     1c2:	0f be f0             	movsbl %al,%esi
+     1c5:	0f be 7d d0          	movsbl -0x30(%rbp),%edi
+     1c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1cc:	48 63 d0             	movslq %eax,%rdx
+     1cf:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     1d6:	48 c1 ea 20          	shr    $0x20,%rdx
+     1da:	c1 fa 03             	sar    $0x3,%edx
+     1dd:	89 c1                	mov    %eax,%ecx
+     1df:	c1 f9 1f             	sar    $0x1f,%ecx
+     1e2:	29 ca                	sub    %ecx,%edx
+     1e4:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     1e7:	29 c8                	sub    %ecx,%eax
+     1e9:	89 c2                	mov    %eax,%edx
+     1eb:	8d 04 17             	lea    (%rdi,%rdx,1),%eax
+     1ee:	39 c6                	cmp    %eax,%esi
+     1f0:	0f 84 a2 00 00 00    	je     298 <checkfile+0x298>
+      error("byte %d of %s is %d, not %c", i, name, buf[i], c + i % 26);
+     1f6:	8b 05 34 26 00 00    	mov    0x2634(%rip),%eax        # 2830 <stdout>
+     1fc:	ba 27 00 00 00       	mov    $0x27,%edx
+     201:	48 8d 0d 58 1f 00 00 	lea    0x1f58(%rip),%rcx        # 2160 <malloc+0x180>
+     208:	48 89 ce             	mov    %rcx,%rsi
+     20b:	89 c7                	mov    %eax,%edi
+     20d:	b8 00 00 00 00       	mov    $0x0,%eax
+     212:	e8 47 15 00 00       	call   175e <printf>
+     217:	0f be 75 d0          	movsbl -0x30(%rbp),%esi
+     21b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     21e:	48 63 d0             	movslq %eax,%rdx
+     221:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     228:	48 c1 ea 20          	shr    $0x20,%rdx
+     22c:	c1 fa 03             	sar    $0x3,%edx
+     22f:	89 c1                	mov    %eax,%ecx
+     231:	c1 f9 1f             	sar    $0x1f,%ecx
+     234:	29 ca                	sub    %ecx,%edx
+     236:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     239:	29 c8                	sub    %ecx,%eax
+     23b:	89 c2                	mov    %eax,%edx
+     23d:	8d 3c 16             	lea    (%rsi,%rdx,1),%edi
+     240:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     243:	48 98                	cltq
+     245:	48 8d 15 74 26 00 00 	lea    0x2674(%rip),%rdx        # 28c0 <buf>
+     24c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     250:	0f be f0             	movsbl %al,%esi
+     253:	8b 05 d7 25 00 00    	mov    0x25d7(%rip),%eax        # 2830 <stdout>
+     259:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     25d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     260:	41 89 f9             	mov    %edi,%r9d
+     263:	41 89 f0             	mov    %esi,%r8d
+     266:	48 8d 35 55 1f 00 00 	lea    0x1f55(%rip),%rsi        # 21c2 <malloc+0x1e2>
+     26d:	89 c7                	mov    %eax,%edi
+     26f:	b8 00 00 00 00       	mov    $0x0,%eax
+     274:	e8 e5 14 00 00       	call   175e <printf>
+     279:	8b 05 b1 25 00 00    	mov    0x25b1(%rip),%eax        # 2830 <stdout>
+     27f:	48 8d 15 fe 1e 00 00 	lea    0x1efe(%rip),%rdx        # 2184 <malloc+0x1a4>
+     286:	48 89 d6             	mov    %rdx,%rsi
+     289:	89 c7                	mov    %eax,%edi
+     28b:	b8 00 00 00 00       	mov    $0x0,%eax
+     290:	e8 c9 14 00 00       	call   175e <printf>
+     295:	90                   	nop
+     296:	eb fd                	jmp    295 <checkfile+0x295>
+  for(i = 0; i < n; i++)
+     298:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     29c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     29f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+     2a2:	0f 8c 0a ff ff ff    	jl     1b2 <checkfile+0x1b2>
+  close(fd);
+     2a8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2ab:	89 c7                	mov    %eax,%edi
+     2ad:	e8 7b 1a 00 00       	call   1d2d <close>
+}
+     2b2:	90                   	nop
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+
+00000000000002b5 <growtest>:
+
+// A file grows a byte at a time through its inline data and out of
+// it into a block, and reads back right at every size on the way.
+void
+growtest(void)
+{
+     2b5:	55                   	push   %rbp
+     2b6:	48 89 e5             	mov    %rsp,%rbp
+     2b9:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+  char c;
+
+  printf(stdout, "growtest\n");
+     2bd:	8b 05 6d 25 00 00    	mov    0x256d(%rip),%eax        # 2830 <stdout>
+     2c3:	48 8d 15 14 1f 00 00 	lea    0x1f14(%rip),%rdx        # 21de <malloc+0x1fe>
+     2ca:	48 89 d6             	mov    %rdx,%rsi
+     2cd:	89 c7                	mov    %eax,%edi
+     2cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d4:	e8 85 14 00 00       	call   175e <printf>
+  if((fd = open("inline1.txt", O_CREATE | O_RDWR)) < 0)
+     2d9:	be 02 02 00 00       	mov    $0x202,%esi
+     2de:	48 8d 05 03 1f 00 00 	lea    0x1f03(%rip),%rax        # 21e8 <malloc+0x208>
+     2e5:	48 89 c7             	mov    %rax,%rdi
+     2e8:	e8 58 1a 00 00       	call   1d45 <open>
+     2ed:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     2f0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     2f4:	79 5c                	jns    352 <growtest+0x9d>
+    error("unable to create inline1.txt");
+     2f6:	8b 05 34 25 00 00    	mov    0x2534(%rip),%eax        # 2830 <stdout>
+     2fc:	ba 35 00 00 00       	mov    $0x35,%edx
+     301:	48 8d 0d 58 1e 00 00 	lea    0x1e58(%rip),%rcx        # 2160 <malloc+0x180>
+     308:	48 89 ce             	mov    %rcx,%rsi
+     30b:	89 c7                	mov    %eax,%edi
+     30d:	b8 00 00 00 00       	mov    $0x0,%eax
+     312:	e8 47 14 00 00       	call   175e <printf>
+     317:	8b 05 13 25 00 00    	mov    0x2513(%rip),%eax        # 2830 <stdout>
+     31d:	48 8d 15 d0 1e 00 00 	lea    0x1ed0(%rip),%rdx        # 21f4 <malloc+0x214>
+     324:	48 89 d6             	mov    %rdx,%rsi
+     327:	89 c7                	mov    %eax,%edi
+     329:	b8 00 00 00 00       	mov    $0x0,%eax
+     32e:	e8 2b 14 00 00       	call   175e <printf>
+     333:	8b 05 f7 24 00 00    	mov    0x24f7(%rip),%eax        # 2830 <stdout>
+     339:	48 8d 15 44 1e 00 00 	lea    0x1e44(%rip),%rdx        # 2184 <malloc+0x1a4>
+     340:	48 89 d6             	mov    %rdx,%rsi
+     343:	89 c7                	mov    %eax,%edi
+     345:	b8 00 00 00 00       	mov    $0x0,%eax
+     34a:	e8 0f 14 00 00       	call   175e <printf>
+     34f:	90                   	nop
+     350:	eb fd                	jmp    34f <growtest+0x9a>
+  for(i = 0; i < DINLINESZ + BSIZE + 10; i++){
+     352:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     359:	e9 f0 00 00 00       	jmp    44e <growtest+0x199>
+    c = 'a' + i % 26;
+     35e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     361:	48 63 d0             	movslq %eax,%rdx
+     364:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     36b:	48 c1 ea 20          	shr    $0x20,%rdx
+     36f:	c1 fa 03             	sar    $0x3,%edx
+     372:	89 c1                	mov    %eax,%ecx
+     374:	c1 f9 1f             	sar    $0x1f,%ecx
+     377:	29 ca                	sub    %ecx,%edx
+     379:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     37c:	29 c8                	sub    %ecx,%eax
+     37e:	89 c2                	mov    %eax,%edx
+     380:	89 d0                	mov    %edx,%eax
+     382:	83 c0 61             	add    $0x61,%eax
+     385:	88 45 f7             	mov    %al,-0x9(%rbp)
+    if(write(fd, &c, 1) != 1)
+     388:	48 8d 4d f7          	lea    -0x9(%rbp),%rcx
+     38c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     38f:	ba 01 00 00 00       	mov    $0x1,%edx
+     394:	48 89 ce             	mov    %rcx,%rsi
+     397:	89 c7                	mov    %eax,%edi
+     399:	e8 87 19 00 00       	call   1d25 <write>
+     39e:	83 f8 01             	cmp    $0x1,%eax
+     3a1:	74 5f                	je     402 <growtest+0x14d>
+      error("unable to write byte %d", i);
+     3a3:	8b 05 87 24 00 00    	mov    0x2487(%rip),%eax        # 2830 <stdout>
+     3a9:	ba 39 00 00 00       	mov    $0x39,%edx
+     3ae:	48 8d 0d ab 1d 00 00 	lea    0x1dab(%rip),%rcx        # 2160 <malloc+0x180>
+     3b5:	48 89 ce             	mov    %rcx,%rsi
+     3b8:	89 c7                	mov    %eax,%edi
+     3ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     3bf:	e8 9a 13 00 00       	call   175e <printf>
+     3c4:	8b 05 66 24 00 00    	mov    0x2466(%rip),%eax        # 2830 <stdout>
+     3ca:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     3cd:	48 8d 0d 3d 1e 00 00 	lea    0x1e3d(%rip),%rcx        # 2211 <malloc+0x231>
+     3d4:	48 89 ce             	mov    %rcx,%rsi
+     3d7:	89 c7                	mov    %eax,%edi
+     3d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     3de:	e8 7b 13 00 00       	call   175e <printf>
+     3e3:	8b 05 47 24 00 00    	mov    0x2447(%rip),%eax        # 2830 <stdout>
+     3e9:	48 8d 15 94 1d 00 00 	lea    0x1d94(%rip),%rdx        # 2184 <malloc+0x1a4>
+     3f0:	48 89 d6             	mov    %rdx,%rsi
+     3f3:	89 c7                	mov    %eax,%edi
+     3f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3fa:	e8 5f 13 00 00       	call   175e <printf>
+     3ff:	90                   	nop
+     400:	eb fd                	jmp    3ff <growtest+0x14a>
+    if(i < DINLINESZ + 2 || i % 100 == 0)
+     402:	83 7d fc 29          	cmpl   $0x29,-0x4(%rbp)
+     406:	7e 26                	jle    42e <growtest+0x179>
+     408:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     40b:	48 63 c2             	movslq %edx,%rax
+     40e:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+     415:	48 c1 e8 20          	shr    $0x20,%rax
+     419:	c1 f8 05             	sar    $0x5,%eax
+     41c:	89 d1                	mov    %edx,%ecx
+     41e:	c1 f9 1f             	sar    $0x1f,%ecx
+     421:	29 c8                	sub    %ecx,%eax
+     423:	6b c8 64             	imul   $0x64,%eax,%ecx
+     426:	89 d0                	mov    %edx,%eax
+     428:	29 c8                	sub    %ecx,%eax
+     42a:	85 c0                	test   %eax,%eax
+     42c:	75 1c                	jne    44a <growtest+0x195>
+      checkfile("inline1.txt", i + 1, 'a');
+     42e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     431:	83 c0 01             	add    $0x1,%eax
+     434:	ba 61 00 00 00       	mov    $0x61,%edx
+     439:	89 c6                	mov    %eax,%esi
+     43b:	48 8d 05 a6 1d 00 00 	lea    0x1da6(%rip),%rax        # 21e8 <malloc+0x208>
+     442:	48 89 c7             	mov    %rax,%rdi
+     445:	e8 b6 fb ff ff       	call   0 <checkfile>
+  for(i = 0; i < DINLINESZ + BSIZE + 10; i++){
+     44a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     44e:	81 7d fc 31 02 00 00 	cmpl   $0x231,-0x4(%rbp)
+     455:	0f 8e 03 ff ff ff    	jle    35e <growtest+0xa9>
+  }
+  close(fd);
+     45b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     45e:	89 c7                	mov    %eax,%edi
+     460:	e8 c8 18 00 00       	call   1d2d <close>
+  checkfile("inline1.txt", DINLINESZ + BSIZE + 10, 'a');
+     465:	ba 61 00 00 00       	mov    $0x61,%edx
+     46a:	be 32 02 00 00       	mov    $0x232,%esi
+     46f:	48 8d 05 72 1d 00 00 	lea    0x1d72(%rip),%rax        # 21e8 <malloc+0x208>
+     476:	48 89 c7             	mov    %rax,%rdi
+     479:	e8 82 fb ff ff       	call   0 <checkfile>
+  if(unlink("inline1.txt") < 0)
+     47e:	48 8d 05 63 1d 00 00 	lea    0x1d63(%rip),%rax        # 21e8 <malloc+0x208>
+     485:	48 89 c7             	mov    %rax,%rdi
+     488:	e8 c8 18 00 00       	call   1d55 <unlink>
+     48d:	85 c0                	test   %eax,%eax
+     48f:	79 5c                	jns    4ed <growtest+0x238>
+    error("unable to unlink inline1.txt");
+     491:	8b 05 99 23 00 00    	mov    0x2399(%rip),%eax        # 2830 <stdout>
+     497:	ba 40 00 00 00       	mov    $0x40,%edx
+     49c:	48 8d 0d bd 1c 00 00 	lea    0x1cbd(%rip),%rcx        # 2160 <malloc+0x180>
+     4a3:	48 89 ce             	mov    %rcx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 ac 12 00 00       	call   175e <printf>
+     4b2:	8b 05 78 23 00 00    	mov    0x2378(%rip),%eax        # 2830 <stdout>
+     4b8:	48 8d 15 6a 1d 00 00 	lea    0x1d6a(%rip),%rdx        # 2229 <malloc+0x249>
+     4bf:	48 89 d6             	mov    %rdx,%rsi
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c9:	e8 90 12 00 00       	call   175e <printf>
+     4ce:	8b 05 5c 23 00 00    	mov    0x235c(%rip),%eax        # 2830 <stdout>
+     4d4:	48 8d 15 a9 1c 00 00 	lea    0x1ca9(%rip),%rdx        # 2184 <malloc+0x1a4>
+     4db:	48 89 d6             	mov    %rdx,%rsi
+     4de:	89 c7                	mov    %eax,%edi
+     4e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e5:	e8 74 12 00 00       	call   175e <printf>
+     4ea:	90                   	nop
+     4eb:	eb fd                	jmp    4ea <growtest+0x235>
+  printf(stdout, "growtest OK\n");
+     4ed:	8b 05 3d 23 00 00    	mov    0x233d(%rip),%eax        # 2830 <stdout>
+     4f3:	48 8d 15 4c 1d 00 00 	lea    0x1d4c(%rip),%rdx        # 2246 <malloc+0x266>
+     4fa:	48 89 d6             	mov    %rdx,%rsi
+     4fd:	89 c7                	mov    %eax,%edi
+     4ff:	b8 00 00 00 00       	mov    $0x0,%eax
+     504:	e8 55 12 00 00       	call   175e <printf>
+}
+     509:	90                   	nop
+     50a:	c9                   	leave
+     50b:	c3                   	ret
+
+000000000000050c <boundarytest>:
+
+// A write that starts inside the inline data and ends past it moves
+// the old bytes out along with the new ones.
+void
+boundarytest(void)
+{
+     50c:	55                   	push   %rbp
+     50d:	48 89 e5             	mov    %rsp,%rbp
+     510:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, i;
+
+  printf(stdout, "boundarytest\n");
+     514:	8b 05 16 23 00 00    	mov    0x2316(%rip),%eax        # 2830 <stdout>
+     51a:	48 8d 15 32 1d 00 00 	lea    0x1d32(%rip),%rdx        # 2253 <malloc+0x273>
+     521:	48 89 d6             	mov    %rdx,%rsi
+     524:	89 c7                	mov    %eax,%edi
+     526:	b8 00 00 00 00       	mov    $0x0,%eax
+     52b:	e8 2e 12 00 00       	call   175e <printf>
+  if((fd = open("inline2.txt", O_CREATE | O_RDWR)) < 0)
+     530:	be 02 02 00 00       	mov    $0x202,%esi
+     535:	48 8d 05 25 1d 00 00 	lea    0x1d25(%rip),%rax        # 2261 <malloc+0x281>
+     53c:	48 89 c7             	mov    %rax,%rdi
+     53f:	e8 01 18 00 00       	call   1d45 <open>
+     544:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     547:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     54b:	79 5c                	jns    5a9 <boundarytest+0x9d>
+    error("unable to create inline2.txt");
+     54d:	8b 05 dd 22 00 00    	mov    0x22dd(%rip),%eax        # 2830 <stdout>
+     553:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     558:	48 8d 0d 01 1c 00 00 	lea    0x1c01(%rip),%rcx        # 2160 <malloc+0x180>
+     55f:	48 89 ce             	mov    %rcx,%rsi
+     562:	89 c7                	mov    %eax,%edi
+     564:	b8 00 00 00 00       	mov    $0x0,%eax
+     569:	e8 f0 11 00 00       	call   175e <printf>
+     56e:	8b 05 bc 22 00 00    	mov    0x22bc(%rip),%eax        # 2830 <stdout>
+     574:	48 8d 15 f2 1c 00 00 	lea    0x1cf2(%rip),%rdx        # 226d <malloc+0x28d>
+     57b:	48 89 d6             	mov    %rdx,%rsi
+     57e:	89 c7                	mov    %eax,%edi
+     580:	b8 00 00 00 00       	mov    $0x0,%eax
+     585:	e8 d4 11 00 00       	call   175e <printf>
+     58a:	8b 05 a0 22 00 00    	mov    0x22a0(%rip),%eax        # 2830 <stdout>
+     590:	48 8d 15 ed 1b 00 00 	lea    0x1bed(%rip),%rdx        # 2184 <malloc+0x1a4>
+     597:	48 89 d6             	mov    %rdx,%rsi
+     59a:	89 c7                	mov    %eax,%edi
+     59c:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a1:	e8 b8 11 00 00       	call   175e <printf>
+     5a6:	90                   	nop
+     5a7:	eb fd                	jmp    5a6 <boundarytest+0x9a>
+  for(i = 0; i < DINLINESZ; i++)
+     5a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     5b0:	eb 3c                	jmp    5ee <boundarytest+0xe2>
+    buf[i] = 'a' + i % 26;
+     5b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5b5:	48 63 d0             	movslq %eax,%rdx
+     5b8:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     5bf:	48 c1 ea 20          	shr    $0x20,%rdx
+     5c3:	c1 fa 03             	sar    $0x3,%edx
+     5c6:	89 c1                	mov    %eax,%ecx
+     5c8:	c1 f9 1f             	sar    $0x1f,%ecx
+     5cb:	29 ca                	sub    %ecx,%edx
+     5cd:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     5d0:	29 c8                	sub    %ecx,%eax
+     5d2:	89 c2                	mov    %eax,%edx
+     5d4:	89 d0                	mov    %edx,%eax
+     5d6:	83 c0 61             	add    $0x61,%eax
+     5d9:	89 c1                	mov    %eax,%ecx
+     5db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5de:	48 98                	cltq
+     5e0:	48 8d 15 d9 22 00 00 	lea    0x22d9(%rip),%rdx        # 28c0 <buf>
+     5e7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(i = 0; i < DINLINESZ; i++)
+     5ea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     5ee:	83 7d fc 27          	cmpl   $0x27,-0x4(%rbp)
+     5f2:	7e be                	jle    5b2 <boundarytest+0xa6>
+  if(write(fd, buf, DINLINESZ) != DINLINESZ)
+     5f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     5f7:	ba 28 00 00 00       	mov    $0x28,%edx
+     5fc:	48 8d 0d bd 22 00 00 	lea    0x22bd(%rip),%rcx        # 28c0 <buf>
+     603:	48 89 ce             	mov    %rcx,%rsi
+     606:	89 c7                	mov    %eax,%edi
+     608:	e8 18 17 00 00       	call   1d25 <write>
+     60d:	83 f8 28             	cmp    $0x28,%eax
+     610:	74 5c                	je     66e <boundarytest+0x162>
+    error("unable to fill the inline data");
+     612:	8b 05 18 22 00 00    	mov    0x2218(%rip),%eax        # 2830 <stdout>
+     618:	ba 51 00 00 00       	mov    $0x51,%edx
+     61d:	48 8d 0d 3c 1b 00 00 	lea    0x1b3c(%rip),%rcx        # 2160 <malloc+0x180>
+     624:	48 89 ce             	mov    %rcx,%rsi
+     627:	89 c7                	mov    %eax,%edi
+     629:	b8 00 00 00 00       	mov    $0x0,%eax
+     62e:	e8 2b 11 00 00       	call   175e <printf>
+     633:	8b 05 f7 21 00 00    	mov    0x21f7(%rip),%eax        # 2830 <stdout>
+     639:	48 8d 15 50 1c 00 00 	lea    0x1c50(%rip),%rdx        # 2290 <malloc+0x2b0>
+     640:	48 89 d6             	mov    %rdx,%rsi
+     643:	89 c7                	mov    %eax,%edi
+     645:	b8 00 00 00 00       	mov    $0x0,%eax
+     64a:	e8 0f 11 00 00       	call   175e <printf>
+     64f:	8b 05 db 21 00 00    	mov    0x21db(%rip),%eax        # 2830 <stdout>
+     655:	48 8d 15 28 1b 00 00 	lea    0x1b28(%rip),%rdx        # 2184 <malloc+0x1a4>
+     65c:	48 89 d6             	mov    %rdx,%rsi
+     65f:	89 c7                	mov    %eax,%edi
+     661:	b8 00 00 00 00       	mov    $0x0,%eax
+     666:	e8 f3 10 00 00       	call   175e <printf>
+     66b:	90                   	nop
+     66c:	eb fd                	jmp    66b <boundarytest+0x15f>
+  checkfile("inline2.txt", DINLINESZ, 'a');
+     66e:	ba 61 00 00 00       	mov    $0x61,%edx
+     673:	be 28 00 00 00       	mov    $0x28,%esi
+     678:	48 8d 05 e2 1b 00 00 	lea    0x1be2(%rip),%rax        # 2261 <malloc+0x281>
+     67f:	48 89 c7             	mov    %rax,%rdi
+     682:	e8 79 f9 ff ff       	call   0 <checkfile>
+
+  // rewrite the middle of it, still inline
+  if(pwrite(fd, "XY", 2, 10) != 2)
+     687:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     68a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     68f:	ba 02 00 00 00       	mov    $0x2,%edx
+     694:	48 8d 35 14 1c 00 00 	lea    0x1c14(%rip),%rsi        # 22af <malloc+0x2cf>
+     69b:	89 c7                	mov    %eax,%edi
+     69d:	e8 5a 17 00 00       	call   1dfc <pwrite>
+     6a2:	83 f8 02             	cmp    $0x2,%eax
+     6a5:	74 5c                	je     703 <boundarytest+0x1f7>
+    error("unable to rewrite inline bytes");
+     6a7:	8b 05 83 21 00 00    	mov    0x2183(%rip),%eax        # 2830 <stdout>
+     6ad:	ba 56 00 00 00       	mov    $0x56,%edx
+     6b2:	48 8d 0d a7 1a 00 00 	lea    0x1aa7(%rip),%rcx        # 2160 <malloc+0x180>
+     6b9:	48 89 ce             	mov    %rcx,%rsi
+     6bc:	89 c7                	mov    %eax,%edi
+     6be:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c3:	e8 96 10 00 00       	call   175e <printf>
+     6c8:	8b 05 62 21 00 00    	mov    0x2162(%rip),%eax        # 2830 <stdout>
+     6ce:	48 8d 15 e3 1b 00 00 	lea    0x1be3(%rip),%rdx        # 22b8 <malloc+0x2d8>
+     6d5:	48 89 d6             	mov    %rdx,%rsi
+     6d8:	89 c7                	mov    %eax,%edi
+     6da:	b8 00 00 00 00       	mov    $0x0,%eax
+     6df:	e8 7a 10 00 00       	call   175e <printf>
+     6e4:	8b 05 46 21 00 00    	mov    0x2146(%rip),%eax        # 2830 <stdout>
+     6ea:	48 8d 15 93 1a 00 00 	lea    0x1a93(%rip),%rdx        # 2184 <malloc+0x1a4>
+     6f1:	48 89 d6             	mov    %rdx,%rsi
+     6f4:	89 c7                	mov    %eax,%edi
+     6f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     6fb:	e8 5e 10 00 00       	call   175e <printf>
+     700:	90                   	nop
+     701:	eb fd                	jmp    700 <boundarytest+0x1f4>
+  buf[10] = 'X';
+     703:	c6 05 c0 21 00 00 58 	movb   $0x58,0x21c0(%rip)        # 28ca <buf+0xa>
+  buf[11] = 'Y';
+     70a:	c6 05 ba 21 00 00 59 	movb   $0x59,0x21ba(%rip)        # 28cb <buf+0xb>
+  if(pread(fd, buf + BSIZE, DINLINESZ, 0) != DINLINESZ)
+     711:	48 8d 35 a8 23 00 00 	lea    0x23a8(%rip),%rsi        # 2ac0 <buf+0x200>
+     718:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     71b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     720:	ba 28 00 00 00       	mov    $0x28,%edx
+     725:	89 c7                	mov    %eax,%edi
+     727:	e8 c8 16 00 00       	call   1df4 <pread>
+     72c:	83 f8 28             	cmp    $0x28,%eax
+     72f:	74 5c                	je     78d <boundarytest+0x281>
+    error("unable to read the inline data");
+     731:	8b 05 f9 20 00 00    	mov    0x20f9(%rip),%eax        # 2830 <stdout>
+     737:	ba 5a 00 00 00       	mov    $0x5a,%edx
+     73c:	48 8d 0d 1d 1a 00 00 	lea    0x1a1d(%rip),%rcx        # 2160 <malloc+0x180>
+     743:	48 89 ce             	mov    %rcx,%rsi
+     746:	89 c7                	mov    %eax,%edi
+     748:	b8 00 00 00 00       	mov    $0x0,%eax
+     74d:	e8 0c 10 00 00       	call   175e <printf>
+     752:	8b 05 d8 20 00 00    	mov    0x20d8(%rip),%eax        # 2830 <stdout>
+     758:	48 8d 15 79 1b 00 00 	lea    0x1b79(%rip),%rdx        # 22d8 <malloc+0x2f8>
+     75f:	48 89 d6             	mov    %rdx,%rsi
+     762:	89 c7                	mov    %eax,%edi
+     764:	b8 00 00 00 00       	mov    $0x0,%eax
+     769:	e8 f0 0f 00 00       	call   175e <printf>
+     76e:	8b 05 bc 20 00 00    	mov    0x20bc(%rip),%eax        # 2830 <stdout>
+     774:	48 8d 15 09 1a 00 00 	lea    0x1a09(%rip),%rdx        # 2184 <malloc+0x1a4>
+     77b:	48 89 d6             	mov    %rdx,%rsi
+     77e:	89 c7                	mov    %eax,%edi
+     780:	b8 00 00 00 00       	mov    $0x0,%eax
+     785:	e8 d4 0f 00 00       	call   175e <printf>
+     78a:	90                   	nop
+     78b:	eb fd                	jmp    78a <boundarytest+0x27e>
+  for(i = 0; i < DINLINESZ; i++)
+     78d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     794:	e9 8c 00 00 00       	jmp    825 <boundarytest+0x319>
+    if(buf[BSIZE + i] != buf[i])
+     799:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     79c:	05 00 02 00 00       	add    $0x200,%eax
+     7a1:	48 98                	cltq
+     7a3:	48 8d 15 16 21 00 00 	lea    0x2116(%rip),%rdx        # 28c0 <buf>
+     7aa:	0f b6 14 10          	movzbl (%rax,%rdx,1),%edx
+     7ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7b1:	48 98                	cltq
+     7b3:	48 8d 0d 06 21 00 00 	lea    0x2106(%rip),%rcx        # 28c0 <buf>
+     7ba:	0f b6 04 08          	movzbl (%rax,%rcx,1),%eax
+     7be:	38 c2                	cmp    %al,%dl
+     7c0:	74 5f                	je     821 <boundarytest+0x315>
+      error("byte %d of the rewritten inline data is wrong", i);
+     7c2:	8b 05 68 20 00 00    	mov    0x2068(%rip),%eax        # 2830 <stdout>
+     7c8:	ba 5d 00 00 00       	mov    $0x5d,%edx
+     7cd:	48 8d 0d 8c 19 00 00 	lea    0x198c(%rip),%rcx        # 2160 <malloc+0x180>
+     7d4:	48 89 ce             	mov    %rcx,%rsi
+     7d7:	89 c7                	mov    %eax,%edi
+     7d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     7de:	e8 7b 0f 00 00       	call   175e <printf>
+     7e3:	8b 05 47 20 00 00    	mov    0x2047(%rip),%eax        # 2830 <stdout>
+     7e9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     7ec:	48 8d 0d 05 1b 00 00 	lea    0x1b05(%rip),%rcx        # 22f8 <malloc+0x318>
+     7f3:	48 89 ce             	mov    %rcx,%rsi
+     7f6:	89 c7                	mov    %eax,%edi
+     7f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7fd:	e8 5c 0f 00 00       	call   175e <printf>
+     802:	8b 05 28 20 00 00    	mov    0x2028(%rip),%eax        # 2830 <stdout>
+     808:	48 8d 15 75 19 00 00 	lea    0x1975(%rip),%rdx        # 2184 <malloc+0x1a4>
+     80f:	48 89 d6             	mov    %rdx,%rsi
+     812:	89 c7                	mov    %eax,%edi
+     814:	b8 00 00 00 00       	mov    $0x0,%eax
+     819:	e8 40 0f 00 00       	call   175e <printf>
+     81e:	90                   	nop
+     81f:	eb fd                	jmp    81e <boundarytest+0x312>
+  for(i = 0; i < DINLINESZ; i++)
+     821:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     825:	83 7d fc 27          	cmpl   $0x27,-0x4(%rbp)
+     829:	0f 8e 6a ff ff ff    	jle    799 <boundarytest+0x28d>
+  buf[10] = 'a' + 10;
+     82f:	c6 05 94 20 00 00 6b 	movb   $0x6b,0x2094(%rip)        # 28ca <buf+0xa>
+  buf[11] = 'a' + 11;
+     836:	c6 05 8e 20 00 00 6c 	movb   $0x6c,0x208e(%rip)        # 28cb <buf+0xb>
+  if(pwrite(fd, buf + 10, 2, 10) != 2)
+     83d:	48 8d 35 86 20 00 00 	lea    0x2086(%rip),%rsi        # 28ca <buf+0xa>
+     844:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     847:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     84c:	ba 02 00 00 00       	mov    $0x2,%edx
+     851:	89 c7                	mov    %eax,%edi
+     853:	e8 a4 15 00 00       	call   1dfc <pwrite>
+     858:	83 f8 02             	cmp    $0x2,%eax
+     85b:	74 5c                	je     8b9 <boundarytest+0x3ad>
+    error("unable to restore inline bytes");
+     85d:	8b 05 cd 1f 00 00    	mov    0x1fcd(%rip),%eax        # 2830 <stdout>
+     863:	ba 61 00 00 00       	mov    $0x61,%edx
+     868:	48 8d 0d f1 18 00 00 	lea    0x18f1(%rip),%rcx        # 2160 <malloc+0x180>
+     86f:	48 89 ce             	mov    %rcx,%rsi
+     872:	89 c7                	mov    %eax,%edi
+     874:	b8 00 00 00 00       	mov    $0x0,%eax
+     879:	e8 e0 0e 00 00       	call   175e <printf>
+     87e:	8b 05 ac 1f 00 00    	mov    0x1fac(%rip),%eax        # 2830 <stdout>
+     884:	48 8d 15 9d 1a 00 00 	lea    0x1a9d(%rip),%rdx        # 2328 <malloc+0x348>
+     88b:	48 89 d6             	mov    %rdx,%rsi
+     88e:	89 c7                	mov    %eax,%edi
+     890:	b8 00 00 00 00       	mov    $0x0,%eax
+     895:	e8 c4 0e 00 00       	call   175e <printf>
+     89a:	8b 05 90 1f 00 00    	mov    0x1f90(%rip),%eax        # 2830 <stdout>
+     8a0:	48 8d 15 dd 18 00 00 	lea    0x18dd(%rip),%rdx        # 2184 <malloc+0x1a4>
+     8a7:	48 89 d6             	mov    %rdx,%rsi
+     8aa:	89 c7                	mov    %eax,%edi
+     8ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b1:	e8 a8 0e 00 00       	call   175e <printf>
+     8b6:	90                   	nop
+     8b7:	eb fd                	jmp    8b6 <boundarytest+0x3aa>
+
+  // straddle the end of the inline data
+  for(i = DINLINESZ - 8; i < 2 * BSIZE; i++)
+     8b9:	c7 45 fc 20 00 00 00 	movl   $0x20,-0x4(%rbp)
+     8c0:	eb 3c                	jmp    8fe <boundarytest+0x3f2>
+    buf[i] = 'a' + i % 26;
+     8c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8c5:	48 63 d0             	movslq %eax,%rdx
+     8c8:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     8cf:	48 c1 ea 20          	shr    $0x20,%rdx
+     8d3:	c1 fa 03             	sar    $0x3,%edx
+     8d6:	89 c1                	mov    %eax,%ecx
+     8d8:	c1 f9 1f             	sar    $0x1f,%ecx
+     8db:	29 ca                	sub    %ecx,%edx
+     8dd:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     8e0:	29 c8                	sub    %ecx,%eax
+     8e2:	89 c2                	mov    %eax,%edx
+     8e4:	89 d0                	mov    %edx,%eax
+     8e6:	83 c0 61             	add    $0x61,%eax
+     8e9:	89 c1                	mov    %eax,%ecx
+     8eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8ee:	48 98                	cltq
+     8f0:	48 8d 15 c9 1f 00 00 	lea    0x1fc9(%rip),%rdx        # 28c0 <buf>
+     8f7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(i = DINLINESZ - 8; i < 2 * BSIZE; i++)
+     8fa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     8fe:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+     905:	7e bb                	jle    8c2 <boundarytest+0x3b6>
+  if(pwrite(fd, buf + DINLINESZ - 8, 2 * BSIZE - (DINLINESZ - 8),
+     907:	48 8d 35 d2 1f 00 00 	lea    0x1fd2(%rip),%rsi        # 28e0 <buf+0x20>
+     90e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     911:	b9 20 00 00 00       	mov    $0x20,%ecx
+     916:	ba e0 03 00 00       	mov    $0x3e0,%edx
+     91b:	89 c7                	mov    %eax,%edi
+     91d:	e8 da 14 00 00       	call   1dfc <pwrite>
+     922:	3d e0 03 00 00       	cmp    $0x3e0,%eax
+     927:	74 5c                	je     985 <boundarytest+0x479>
+            DINLINESZ - 8) != 2 * BSIZE - (DINLINESZ - 8))
+    error("unable to write past the inline data");
+     929:	8b 05 01 1f 00 00    	mov    0x1f01(%rip),%eax        # 2830 <stdout>
+     92f:	ba 68 00 00 00       	mov    $0x68,%edx
+     934:	48 8d 0d 25 18 00 00 	lea    0x1825(%rip),%rcx        # 2160 <malloc+0x180>
+     93b:	48 89 ce             	mov    %rcx,%rsi
+     93e:	89 c7                	mov    %eax,%edi
+     940:	b8 00 00 00 00       	mov    $0x0,%eax
+     945:	e8 14 0e 00 00       	call   175e <printf>
+     94a:	8b 05 e0 1e 00 00    	mov    0x1ee0(%rip),%eax        # 2830 <stdout>
+     950:	48 8d 15 f1 19 00 00 	lea    0x19f1(%rip),%rdx        # 2348 <malloc+0x368>
+     957:	48 89 d6             	mov    %rdx,%rsi
+     95a:	89 c7                	mov    %eax,%edi
+     95c:	b8 00 00 00 00       	mov    $0x0,%eax
+     961:	e8 f8 0d 00 00       	call   175e <printf>
+     966:	8b 05 c4 1e 00 00    	mov    0x1ec4(%rip),%eax        # 2830 <stdout>
+     96c:	48 8d 15 11 18 00 00 	lea    0x1811(%rip),%rdx        # 2184 <malloc+0x1a4>
+     973:	48 89 d6             	mov    %rdx,%rsi
+     976:	89 c7                	mov    %eax,%edi
+     978:	b8 00 00 00 00       	mov    $0x0,%eax
+     97d:	e8 dc 0d 00 00       	call   175e <printf>
+     982:	90                   	nop
+     983:	eb fd                	jmp    982 <boundarytest+0x476>
+  close(fd);
+     985:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     988:	89 c7                	mov    %eax,%edi
+     98a:	e8 9e 13 00 00       	call   1d2d <close>
+  checkfile("inline2.txt", 2 * BSIZE, 'a');
+     98f:	ba 61 00 00 00       	mov    $0x61,%edx
+     994:	be 00 04 00 00       	mov    $0x400,%esi
+     999:	48 8d 05 c1 18 00 00 	lea    0x18c1(%rip),%rax        # 2261 <malloc+0x281>
+     9a0:	48 89 c7             	mov    %rax,%rdi
+     9a3:	e8 58 f6 ff ff       	call   0 <checkfile>
+  if(unlink("inline2.txt") < 0)
+     9a8:	48 8d 05 b2 18 00 00 	lea    0x18b2(%rip),%rax        # 2261 <malloc+0x281>
+     9af:	48 89 c7             	mov    %rax,%rdi
+     9b2:	e8 9e 13 00 00       	call   1d55 <unlink>
+     9b7:	85 c0                	test   %eax,%eax
+     9b9:	79 5c                	jns    a17 <boundarytest+0x50b>
+    error("unable to unlink inline2.txt");
+     9bb:	8b 05 6f 1e 00 00    	mov    0x1e6f(%rip),%eax        # 2830 <stdout>
+     9c1:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     9c6:	48 8d 0d 93 17 00 00 	lea    0x1793(%rip),%rcx        # 2160 <malloc+0x180>
+     9cd:	48 89 ce             	mov    %rcx,%rsi
+     9d0:	89 c7                	mov    %eax,%edi
+     9d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d7:	e8 82 0d 00 00       	call   175e <printf>
+     9dc:	8b 05 4e 1e 00 00    	mov    0x1e4e(%rip),%eax        # 2830 <stdout>
+     9e2:	48 8d 15 84 19 00 00 	lea    0x1984(%rip),%rdx        # 236d <malloc+0x38d>
+     9e9:	48 89 d6             	mov    %rdx,%rsi
+     9ec:	89 c7                	mov    %eax,%edi
+     9ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f3:	e8 66 0d 00 00       	call   175e <printf>
+     9f8:	8b 05 32 1e 00 00    	mov    0x1e32(%rip),%eax        # 2830 <stdout>
+     9fe:	48 8d 15 7f 17 00 00 	lea    0x177f(%rip),%rdx        # 2184 <malloc+0x1a4>
+     a05:	48 89 d6             	mov    %rdx,%rsi
+     a08:	89 c7                	mov    %eax,%edi
+     a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+     a0f:	e8 4a 0d 00 00       	call   175e <printf>
+     a14:	90                   	nop
+     a15:	eb fd                	jmp    a14 <boundarytest+0x508>
+  printf(stdout, "boundarytest OK\n");
+     a17:	8b 05 13 1e 00 00    	mov    0x1e13(%rip),%eax        # 2830 <stdout>
+     a1d:	48 8d 15 66 19 00 00 	lea    0x1966(%rip),%rdx        # 238a <malloc+0x3aa>
+     a24:	48 89 d6             	mov    %rdx,%rsi
+     a27:	89 c7                	mov    %eax,%edi
+     a29:	b8 00 00 00 00       	mov    $0x0,%eax
+     a2e:	e8 2b 0d 00 00       	call   175e <printf>
+}
+     a33:	90                   	nop
+     a34:	c9                   	leave
+     a35:	c3                   	ret
+
+0000000000000a36 <manytest>:
+
+// Many small files of every inline size, each with its own contents.
+void
+manytest(void)
+{
+     a36:	55                   	push   %rbp
+     a37:	48 89 e5             	mov    %rsp,%rbp
+     a3a:	48 83 ec 20          	sub    $0x20,%rsp
+  char name[16];
+  int fd, i, j;
+
+  printf(stdout, "manytest\n");
+     a3e:	8b 05 ec 1d 00 00    	mov    0x1dec(%rip),%eax        # 2830 <stdout>
+     a44:	48 8d 15 50 19 00 00 	lea    0x1950(%rip),%rdx        # 239b <malloc+0x3bb>
+     a4b:	48 89 d6             	mov    %rdx,%rsi
+     a4e:	89 c7                	mov    %eax,%edi
+     a50:	b8 00 00 00 00       	mov    $0x0,%eax
+     a55:	e8 04 0d 00 00       	call   175e <printf>
+  strcpy(name, "small00");
+     a5a:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     a5e:	48 8d 15 40 19 00 00 	lea    0x1940(%rip),%rdx        # 23a5 <malloc+0x3c5>
+     a65:	48 89 d6             	mov    %rdx,%rsi
+     a68:	48 89 c7             	mov    %rax,%rdi
+     a6b:	e8 f0 0f 00 00       	call   1a60 <strcpy>
+  for(i = 0; i < NFILES; i++){
+     a70:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a77:	e9 2b 02 00 00       	jmp    ca7 <manytest+0x271>
+    name[5] = '0' + i / 10;
+     a7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a7f:	48 63 d0             	movslq %eax,%rdx
+     a82:	48 69 d2 67 66 66 66 	imul   $0x66666667,%rdx,%rdx
+     a89:	48 c1 ea 20          	shr    $0x20,%rdx
+     a8d:	c1 fa 02             	sar    $0x2,%edx
+     a90:	c1 f8 1f             	sar    $0x1f,%eax
+     a93:	29 c2                	sub    %eax,%edx
+     a95:	89 d0                	mov    %edx,%eax
+     a97:	83 c0 30             	add    $0x30,%eax
+     a9a:	88 45 e9             	mov    %al,-0x17(%rbp)
+    name[6] = '0' + i % 10;
+     a9d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     aa0:	48 63 c1             	movslq %ecx,%rax
+     aa3:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+     aaa:	48 c1 e8 20          	shr    $0x20,%rax
+     aae:	89 c2                	mov    %eax,%edx
+     ab0:	c1 fa 02             	sar    $0x2,%edx
+     ab3:	89 c8                	mov    %ecx,%eax
+     ab5:	c1 f8 1f             	sar    $0x1f,%eax
+     ab8:	29 c2                	sub    %eax,%edx
+     aba:	89 d0                	mov    %edx,%eax
+     abc:	c1 e0 02             	shl    $0x2,%eax
+     abf:	01 d0                	add    %edx,%eax
+     ac1:	01 c0                	add    %eax,%eax
+     ac3:	29 c1                	sub    %eax,%ecx
+     ac5:	89 ca                	mov    %ecx,%edx
+     ac7:	89 d0                	mov    %edx,%eax
+     ac9:	83 c0 30             	add    $0x30,%eax
+     acc:	88 45 ea             	mov    %al,-0x16(%rbp)
+    if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+     acf:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     ad3:	be 02 02 00 00       	mov    $0x202,%esi
+     ad8:	48 89 c7             	mov    %rax,%rdi
+     adb:	e8 65 12 00 00       	call   1d45 <open>
+     ae0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ae3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     ae7:	79 60                	jns    b49 <manytest+0x113>
+      error("unable to create %s", name);
+     ae9:	8b 05 41 1d 00 00    	mov    0x1d41(%rip),%eax        # 2830 <stdout>
+     aef:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     af4:	48 8d 0d 65 16 00 00 	lea    0x1665(%rip),%rcx        # 2160 <malloc+0x180>
+     afb:	48 89 ce             	mov    %rcx,%rsi
+     afe:	89 c7                	mov    %eax,%edi
+     b00:	b8 00 00 00 00       	mov    $0x0,%eax
+     b05:	e8 54 0c 00 00       	call   175e <printf>
+     b0a:	8b 05 20 1d 00 00    	mov    0x1d20(%rip),%eax        # 2830 <stdout>
+     b10:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+     b14:	48 8d 0d 92 18 00 00 	lea    0x1892(%rip),%rcx        # 23ad <malloc+0x3cd>
+     b1b:	48 89 ce             	mov    %rcx,%rsi
+     b1e:	89 c7                	mov    %eax,%edi
+     b20:	b8 00 00 00 00       	mov    $0x0,%eax
+     b25:	e8 34 0c 00 00       	call   175e <printf>
+     b2a:	8b 05 00 1d 00 00    	mov    0x1d00(%rip),%eax        # 2830 <stdout>
+     b30:	48 8d 15 4d 16 00 00 	lea    0x164d(%rip),%rdx        # 2184 <malloc+0x1a4>
+     b37:	48 89 d6             	mov    %rdx,%rsi
+     b3a:	89 c7                	mov    %eax,%edi
+     b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b41:	e8 18 0c 00 00       	call   175e <printf>
+     b46:	90                   	nop
+     b47:	eb fd                	jmp    b46 <manytest+0x110>
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+     b49:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     b50:	eb 41                	jmp    b93 <manytest+0x15d>
+      buf[j] = 'a' + (i + j) % 26;
+     b52:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     b55:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b58:	01 d0                	add    %edx,%eax
+     b5a:	48 63 d0             	movslq %eax,%rdx
+     b5d:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     b64:	48 c1 ea 20          	shr    $0x20,%rdx
+     b68:	c1 fa 03             	sar    $0x3,%edx
+     b6b:	89 c1                	mov    %eax,%ecx
+     b6d:	c1 f9 1f             	sar    $0x1f,%ecx
+     b70:	29 ca                	sub    %ecx,%edx
+     b72:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     b75:	29 c8                	sub    %ecx,%eax
+     b77:	89 c2                	mov    %eax,%edx
+     b79:	89 d0                	mov    %edx,%eax
+     b7b:	83 c0 61             	add    $0x61,%eax
+     b7e:	89 c1                	mov    %eax,%ecx
+     b80:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b83:	48 98                	cltq
+     b85:	48 8d 15 34 1d 00 00 	lea    0x1d34(%rip),%rdx        # 28c0 <buf>
+     b8c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+     b8f:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     b93:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     b96:	48 63 c1             	movslq %ecx,%rax
+     b99:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     ba0:	48 c1 e8 20          	shr    $0x20,%rax
+     ba4:	89 c2                	mov    %eax,%edx
+     ba6:	c1 fa 04             	sar    $0x4,%edx
+     ba9:	89 c8                	mov    %ecx,%eax
+     bab:	c1 f8 1f             	sar    $0x1f,%eax
+     bae:	29 c2                	sub    %eax,%edx
+     bb0:	89 d0                	mov    %edx,%eax
+     bb2:	c1 e0 02             	shl    $0x2,%eax
+     bb5:	01 d0                	add    %edx,%eax
+     bb7:	c1 e0 03             	shl    $0x3,%eax
+     bba:	01 d0                	add    %edx,%eax
+     bbc:	29 c1                	sub    %eax,%ecx
+     bbe:	89 ca                	mov    %ecx,%edx
+     bc0:	39 55 f8             	cmp    %edx,-0x8(%rbp)
+     bc3:	7c 8d                	jl     b52 <manytest+0x11c>
+    if(write(fd, buf, i % (DINLINESZ + 1)) != i % (DINLINESZ + 1))
+     bc5:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     bc8:	48 63 c1             	movslq %ecx,%rax
+     bcb:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     bd2:	48 c1 e8 20          	shr    $0x20,%rax
+     bd6:	89 c2                	mov    %eax,%edx
+     bd8:	c1 fa 04             	sar    $0x4,%edx
+     bdb:	89 c8                	mov    %ecx,%eax
+     bdd:	c1 f8 1f             	sar    $0x1f,%eax
+     be0:	29 c2                	sub    %eax,%edx
+     be2:	89 d0                	mov    %edx,%eax
+     be4:	c1 e0 02             	shl    $0x2,%eax
+     be7:	01 d0                	add    %edx,%eax
+     be9:	c1 e0 03             	shl    $0x3,%eax
+     bec:	01 d0                	add    %edx,%eax
+     bee:	29 c1                	sub    %eax,%ecx
+     bf0:	89 ca                	mov    %ecx,%edx
+     bf2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     bf5:	48 8d 0d c4 1c 00 00 	lea    0x1cc4(%rip),%rcx        # 28c0 <buf>
+     bfc:	48 89 ce             	mov    %rcx,%rsi
+     bff:	89 c7                	mov    %eax,%edi
+     c01:	e8 1f 11 00 00       	call   1d25 <write>
+     c06:	89 c6                	mov    %eax,%esi
+     c08:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     c0b:	48 63 c1             	movslq %ecx,%rax
+     c0e:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     c15:	48 c1 e8 20          	shr    $0x20,%rax
+     c19:	89 c2                	mov    %eax,%edx
+     c1b:	c1 fa 04             	sar    $0x4,%edx
+     c1e:	89 c8                	mov    %ecx,%eax
+     c20:	c1 f8 1f             	sar    $0x1f,%eax
+     c23:	29 c2                	sub    %eax,%edx
+     c25:	89 d0                	mov    %edx,%eax
+     c27:	c1 e0 02             	shl    $0x2,%eax
+     c2a:	01 d0                	add    %edx,%eax
+     c2c:	c1 e0 03             	shl    $0x3,%eax
+     c2f:	01 d0                	add    %edx,%eax
+     c31:	29 c1                	sub    %eax,%ecx
+     c33:	89 ca                	mov    %ecx,%edx
+     c35:	39 d6                	cmp    %edx,%esi
+     c37:	74 60                	je     c99 <manytest+0x263>
+      error("unable to write %s", name);
+     c39:	8b 05 f1 1b 00 00    	mov    0x1bf1(%rip),%eax        # 2830 <stdout>
+     c3f:	ba 81 00 00 00       	mov    $0x81,%edx
+     c44:	48 8d 0d 15 15 00 00 	lea    0x1515(%rip),%rcx        # 2160 <malloc+0x180>
+     c4b:	48 89 ce             	mov    %rcx,%rsi
+     c4e:	89 c7                	mov    %eax,%edi
+     c50:	b8 00 00 00 00       	mov    $0x0,%eax
+     c55:	e8 04 0b 00 00       	call   175e <printf>
+     c5a:	8b 05 d0 1b 00 00    	mov    0x1bd0(%rip),%eax        # 2830 <stdout>
+     c60:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+     c64:	48 8d 0d 56 17 00 00 	lea    0x1756(%rip),%rcx        # 23c1 <malloc+0x3e1>
+     c6b:	48 89 ce             	mov    %rcx,%rsi
+     c6e:	89 c7                	mov    %eax,%edi
+     c70:	b8 00 00 00 00       	mov    $0x0,%eax
+     c75:	e8 e4 0a 00 00       	call   175e <printf>
+     c7a:	8b 05 b0 1b 00 00    	mov    0x1bb0(%rip),%eax        # 2830 <stdout>
+     c80:	48 8d 15 fd 14 00 00 	lea    0x14fd(%rip),%rdx        # 2184 <malloc+0x1a4>
+     c87:	48 89 d6             	mov    %rdx,%rsi
+     c8a:	89 c7                	mov    %eax,%edi
+     c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     c91:	e8 c8 0a 00 00       	call   175e <printf>
+     c96:	90                   	nop
+     c97:	eb fd                	jmp    c96 <manytest+0x260>
+    close(fd);
+     c99:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c9c:	89 c7                	mov    %eax,%edi
+     c9e:	e8 8a 10 00 00       	call   1d2d <close>
+  for(i = 0; i < NFILES; i++){
+     ca3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ca7:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+     cab:	0f 8e cb fd ff ff    	jle    a7c <manytest+0x46>
+  }
+  for(i = 0; i < NFILES; i++){
+     cb1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     cb8:	e9 17 03 00 00       	jmp    fd4 <manytest+0x59e>
+    name[5] = '0' + i / 10;
+     cbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cc0:	48 63 d0             	movslq %eax,%rdx
+     cc3:	48 69 d2 67 66 66 66 	imul   $0x66666667,%rdx,%rdx
+     cca:	48 c1 ea 20          	shr    $0x20,%rdx
+     cce:	c1 fa 02             	sar    $0x2,%edx
+     cd1:	c1 f8 1f             	sar    $0x1f,%eax
+     cd4:	29 c2                	sub    %eax,%edx
+     cd6:	89 d0                	mov    %edx,%eax
+     cd8:	83 c0 30             	add    $0x30,%eax
+     cdb:	88 45 e9             	mov    %al,-0x17(%rbp)
+    name[6] = '0' + i % 10;
+     cde:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     ce1:	48 63 c1             	movslq %ecx,%rax
+     ce4:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+     ceb:	48 c1 e8 20          	shr    $0x20,%rax
+     cef:	89 c2                	mov    %eax,%edx
+     cf1:	c1 fa 02             	sar    $0x2,%edx
+     cf4:	89 c8                	mov    %ecx,%eax
+     cf6:	c1 f8 1f             	sar    $0x1f,%eax
+     cf9:	29 c2                	sub    %eax,%edx
+     cfb:	89 d0                	mov    %edx,%eax
+     cfd:	c1 e0 02             	shl    $0x2,%eax
+     d00:	01 d0                	add    %edx,%eax
+     d02:	01 c0                	add    %eax,%eax
+     d04:	29 c1                	sub    %eax,%ecx
+     d06:	89 ca                	mov    %ecx,%edx
+     d08:	89 d0                	mov    %edx,%eax
+     d0a:	83 c0 30             	add    $0x30,%eax
+     d0d:	88 45 ea             	mov    %al,-0x16(%rbp)
+    if((fd = open(name, O_RDONLY)) < 0)
+     d10:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     d14:	be 00 00 00 00       	mov    $0x0,%esi
+     d19:	48 89 c7             	mov    %rax,%rdi
+     d1c:	e8 24 10 00 00       	call   1d45 <open>
+     d21:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     d24:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     d28:	79 60                	jns    d8a <manytest+0x354>
+      error("unable to open %s", name);
+     d2a:	8b 05 00 1b 00 00    	mov    0x1b00(%rip),%eax        # 2830 <stdout>
+     d30:	ba 88 00 00 00       	mov    $0x88,%edx
+     d35:	48 8d 0d 24 14 00 00 	lea    0x1424(%rip),%rcx        # 2160 <malloc+0x180>
+     d3c:	48 89 ce             	mov    %rcx,%rsi
+     d3f:	89 c7                	mov    %eax,%edi
+     d41:	b8 00 00 00 00       	mov    $0x0,%eax
+     d46:	e8 13 0a 00 00       	call   175e <printf>
+     d4b:	8b 05 df 1a 00 00    	mov    0x1adf(%rip),%eax        # 2830 <stdout>
+     d51:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+     d55:	48 8d 0d 16 14 00 00 	lea    0x1416(%rip),%rcx        # 2172 <malloc+0x192>
+     d5c:	48 89 ce             	mov    %rcx,%rsi
+     d5f:	89 c7                	mov    %eax,%edi
+     d61:	b8 00 00 00 00       	mov    $0x0,%eax
+     d66:	e8 f3 09 00 00       	call   175e <printf>
+     d6b:	8b 05 bf 1a 00 00    	mov    0x1abf(%rip),%eax        # 2830 <stdout>
+     d71:	48 8d 15 0c 14 00 00 	lea    0x140c(%rip),%rdx        # 2184 <malloc+0x1a4>
+     d78:	48 89 d6             	mov    %rdx,%rsi
+     d7b:	89 c7                	mov    %eax,%edi
+     d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+     d82:	e8 d7 09 00 00       	call   175e <printf>
+     d87:	90                   	nop
+     d88:	eb fd                	jmp    d87 <manytest+0x351>
+    j = read(fd, buf, sizeof(buf));
+     d8a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d8d:	ba 00 06 00 00       	mov    $0x600,%edx
+     d92:	48 8d 0d 27 1b 00 00 	lea    0x1b27(%rip),%rcx        # 28c0 <buf>
+     d99:	48 89 ce             	mov    %rcx,%rsi
+     d9c:	89 c7                	mov    %eax,%edi
+     d9e:	e8 7a 0f 00 00       	call   1d1d <read>
+     da3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(j != i % (DINLINESZ + 1))
+     da6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     da9:	48 63 c1             	movslq %ecx,%rax
+     dac:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     db3:	48 c1 e8 20          	shr    $0x20,%rax
+     db7:	89 c2                	mov    %eax,%edx
+     db9:	c1 fa 04             	sar    $0x4,%edx
+     dbc:	89 c8                	mov    %ecx,%eax
+     dbe:	c1 f8 1f             	sar    $0x1f,%eax
+     dc1:	29 c2                	sub    %eax,%edx
+     dc3:	89 d0                	mov    %edx,%eax
+     dc5:	c1 e0 02             	shl    $0x2,%eax
+     dc8:	01 d0                	add    %edx,%eax
+     dca:	c1 e0 03             	shl    $0x3,%eax
+     dcd:	01 d0                	add    %edx,%eax
+     dcf:	29 c1                	sub    %eax,%ecx
+     dd1:	89 ca                	mov    %ecx,%edx
+     dd3:	39 55 f8             	cmp    %edx,-0x8(%rbp)
+     dd6:	0f 84 93 00 00 00    	je     e6f <manytest+0x439>
+      error("%s has %d bytes, not %d", name, j, i % (DINLINESZ + 1));
+     ddc:	8b 05 4e 1a 00 00    	mov    0x1a4e(%rip),%eax        # 2830 <stdout>
+     de2:	ba 8b 00 00 00       	mov    $0x8b,%edx
+     de7:	48 8d 0d 72 13 00 00 	lea    0x1372(%rip),%rcx        # 2160 <malloc+0x180>
+     dee:	48 89 ce             	mov    %rcx,%rsi
+     df1:	89 c7                	mov    %eax,%edi
+     df3:	b8 00 00 00 00       	mov    $0x0,%eax
+     df8:	e8 61 09 00 00       	call   175e <printf>
+     dfd:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     e00:	48 63 c1             	movslq %ecx,%rax
+     e03:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     e0a:	48 c1 e8 20          	shr    $0x20,%rax
+     e0e:	89 c2                	mov    %eax,%edx
+     e10:	c1 fa 04             	sar    $0x4,%edx
+     e13:	89 c8                	mov    %ecx,%eax
+     e15:	c1 f8 1f             	sar    $0x1f,%eax
+     e18:	29 c2                	sub    %eax,%edx
+     e1a:	89 d0                	mov    %edx,%eax
+     e1c:	c1 e0 02             	shl    $0x2,%eax
+     e1f:	01 d0                	add    %edx,%eax
+     e21:	c1 e0 03             	shl    $0x3,%eax
+     e24:	01 d0                	add    %edx,%eax
+     e26:	29 c1                	sub    %eax,%ecx
+     e28:	89 ca                	mov    %ecx,%edx
+     e2a:	8b 05 00 1a 00 00    	mov    0x1a00(%rip),%eax        # 2830 <stdout>
+     e30:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+     e33:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+     e37:	41 89 d0             	mov    %edx,%r8d
+     e3a:	48 89 f2             	mov    %rsi,%rdx
+     e3d:	48 8d 35 42 13 00 00 	lea    0x1342(%rip),%rsi        # 2186 <malloc+0x1a6>
+     e44:	89 c7                	mov    %eax,%edi
+     e46:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4b:	e8 0e 09 00 00       	call   175e <printf>
+     e50:	8b 05 da 19 00 00    	mov    0x19da(%rip),%eax        # 2830 <stdout>
+     e56:	48 8d 15 27 13 00 00 	lea    0x1327(%rip),%rdx        # 2184 <malloc+0x1a4>
+     e5d:	48 89 d6             	mov    %rdx,%rsi
+     e60:	89 c7                	mov    %eax,%edi
+     e62:	b8 00 00 00 00       	mov    $0x0,%eax
+     e67:	e8 f2 08 00 00       	call   175e <printf>
+     e6c:	90                   	nop
+     e6d:	eb fd                	jmp    e6c <manytest+0x436>
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+     e6f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     e76:	e9 a5 00 00 00       	jmp    f20 <manytest+0x4ea>
+      if(buf[j] != 'a' + (i + j) % 26)
+     e7b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     e7e:	48 98                	cltq
+     e80:	48 8d 15 39 1a 00 00 	lea    0x1a39(%rip),%rdx        # 28c0 <buf>
+     e87:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     e8b:	0f be f0             	movsbl %al,%esi
+     e8e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e91:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     e94:	01 c2                	add    %eax,%edx
+     e96:	48 63 c2             	movslq %edx,%rax
+     e99:	48 69 c0 4f ec c4 4e 	imul   $0x4ec4ec4f,%rax,%rax
+     ea0:	48 c1 e8 20          	shr    $0x20,%rax
+     ea4:	c1 f8 03             	sar    $0x3,%eax
+     ea7:	89 d1                	mov    %edx,%ecx
+     ea9:	c1 f9 1f             	sar    $0x1f,%ecx
+     eac:	29 c8                	sub    %ecx,%eax
+     eae:	6b c8 1a             	imul   $0x1a,%eax,%ecx
+     eb1:	89 d0                	mov    %edx,%eax
+     eb3:	29 c8                	sub    %ecx,%eax
+     eb5:	83 c0 61             	add    $0x61,%eax
+     eb8:	39 c6                	cmp    %eax,%esi
+     eba:	74 60                	je     f1c <manytest+0x4e6>
+        error("byte %d of %s is wrong", j, name);
+     ebc:	8b 05 6e 19 00 00    	mov    0x196e(%rip),%eax        # 2830 <stdout>
+     ec2:	ba 8e 00 00 00       	mov    $0x8e,%edx
+     ec7:	48 8d 0d 92 12 00 00 	lea    0x1292(%rip),%rcx        # 2160 <malloc+0x180>
+     ece:	48 89 ce             	mov    %rcx,%rsi
+     ed1:	89 c7                	mov    %eax,%edi
+     ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed8:	e8 81 08 00 00       	call   175e <printf>
+     edd:	8b 05 4d 19 00 00    	mov    0x194d(%rip),%eax        # 2830 <stdout>
+     ee3:	48 8d 4d e4          	lea    -0x1c(%rbp),%rcx
+     ee7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     eea:	48 8d 35 e3 14 00 00 	lea    0x14e3(%rip),%rsi        # 23d4 <malloc+0x3f4>
+     ef1:	89 c7                	mov    %eax,%edi
+     ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef8:	e8 61 08 00 00       	call   175e <printf>
+     efd:	8b 05 2d 19 00 00    	mov    0x192d(%rip),%eax        # 2830 <stdout>
+     f03:	48 8d 15 7a 12 00 00 	lea    0x127a(%rip),%rdx        # 2184 <malloc+0x1a4>
+     f0a:	48 89 d6             	mov    %rdx,%rsi
+     f0d:	89 c7                	mov    %eax,%edi
+     f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     f14:	e8 45 08 00 00       	call   175e <printf>
+     f19:	90                   	nop
+     f1a:	eb fd                	jmp    f19 <manytest+0x4e3>
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+     f1c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     f20:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     f23:	48 63 c1             	movslq %ecx,%rax
+     f26:	48 69 c0 3f 06 e7 63 	imul   $0x63e7063f,%rax,%rax
+     f2d:	48 c1 e8 20          	shr    $0x20,%rax
+     f31:	89 c2                	mov    %eax,%edx
+     f33:	c1 fa 04             	sar    $0x4,%edx
+     f36:	89 c8                	mov    %ecx,%eax
+     f38:	c1 f8 1f             	sar    $0x1f,%eax
+     f3b:	29 c2                	sub    %eax,%edx
+     f3d:	89 d0                	mov    %edx,%eax
+     f3f:	c1 e0 02             	shl    $0x2,%eax
+     f42:	01 d0                	add    %edx,%eax
+     f44:	c1 e0 03             	shl    $0x3,%eax
+     f47:	01 d0                	add    %edx,%eax
+     f49:	29 c1                	sub    %eax,%ecx
+     f4b:	89 ca                	mov    %ecx,%edx
+     f4d:	39 55 f8             	cmp    %edx,-0x8(%rbp)
+     f50:	0f 8c 25 ff ff ff    	jl     e7b <manytest+0x445>
+    close(fd);
+     f56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f59:	89 c7                	mov    %eax,%edi
+     f5b:	e8 cd 0d 00 00       	call   1d2d <close>
+    if(unlink(name) < 0)
+     f60:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     f64:	48 89 c7             	mov    %rax,%rdi
+     f67:	e8 e9 0d 00 00       	call   1d55 <unlink>
+     f6c:	85 c0                	test   %eax,%eax
+     f6e:	79 60                	jns    fd0 <manytest+0x59a>
+      error("unable to unlink %s", name);
+     f70:	8b 05 ba 18 00 00    	mov    0x18ba(%rip),%eax        # 2830 <stdout>
+     f76:	ba 91 00 00 00       	mov    $0x91,%edx
+     f7b:	48 8d 0d de 11 00 00 	lea    0x11de(%rip),%rcx        # 2160 <malloc+0x180>
+     f82:	48 89 ce             	mov    %rcx,%rsi
+     f85:	89 c7                	mov    %eax,%edi
+     f87:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8c:	e8 cd 07 00 00       	call   175e <printf>
+     f91:	8b 05 99 18 00 00    	mov    0x1899(%rip),%eax        # 2830 <stdout>
+     f97:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+     f9b:	48 8d 0d 49 14 00 00 	lea    0x1449(%rip),%rcx        # 23eb <malloc+0x40b>
+     fa2:	48 89 ce             	mov    %rcx,%rsi
+     fa5:	89 c7                	mov    %eax,%edi
+     fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+     fac:	e8 ad 07 00 00       	call   175e <printf>
+     fb1:	8b 05 79 18 00 00    	mov    0x1879(%rip),%eax        # 2830 <stdout>
+     fb7:	48 8d 15 c6 11 00 00 	lea    0x11c6(%rip),%rdx        # 2184 <malloc+0x1a4>
+     fbe:	48 89 d6             	mov    %rdx,%rsi
+     fc1:	89 c7                	mov    %eax,%edi
+     fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+     fc8:	e8 91 07 00 00       	call   175e <printf>
+     fcd:	90                   	nop
+     fce:	eb fd                	jmp    fcd <manytest+0x597>
+  for(i = 0; i < NFILES; i++){
+     fd0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     fd4:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+     fd8:	0f 8e df fc ff ff    	jle    cbd <manytest+0x287>
+  }
+  printf(stdout, "manytest OK\n");
+     fde:	8b 05 4c 18 00 00    	mov    0x184c(%rip),%eax        # 2830 <stdout>
+     fe4:	48 8d 15 14 14 00 00 	lea    0x1414(%rip),%rdx        # 23ff <malloc+0x41f>
+     feb:	48 89 d6             	mov    %rdx,%rsi
+     fee:	89 c7                	mov    %eax,%edi
+     ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ff5:	e8 64 07 00 00       	call   175e <printf>
+}
+     ffa:	90                   	nop
+     ffb:	c9                   	leave
+     ffc:	c3                   	ret
+
+0000000000000ffd <mmaptest>:
+
+// An inline file is mapped from its inline data, and a store through
+// a shared mapping goes back into it.
+void
+mmaptest(void)
+{
+     ffd:	55                   	push   %rbp
+     ffe:	48 89 e5             	mov    %rsp,%rbp
+    1001:	48 83 ec 10          	sub    $0x10,%rsp
+  char *p;
+  int fd, i;
+
+  printf(stdout, "mmaptest\n");
+    1005:	8b 05 25 18 00 00    	mov    0x1825(%rip),%eax        # 2830 <stdout>
+    100b:	48 8d 15 fa 13 00 00 	lea    0x13fa(%rip),%rdx        # 240c <malloc+0x42c>
+    1012:	48 89 d6             	mov    %rdx,%rsi
+    1015:	89 c7                	mov    %eax,%edi
+    1017:	b8 00 00 00 00       	mov    $0x0,%eax
+    101c:	e8 3d 07 00 00       	call   175e <printf>
+  if((fd = open("inline3.txt", O_CREATE | O_RDWR)) < 0)
+    1021:	be 02 02 00 00       	mov    $0x202,%esi
+    1026:	48 8d 05 e9 13 00 00 	lea    0x13e9(%rip),%rax        # 2416 <malloc+0x436>
+    102d:	48 89 c7             	mov    %rax,%rdi
+    1030:	e8 10 0d 00 00       	call   1d45 <open>
+    1035:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    1038:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    103c:	79 5c                	jns    109a <mmaptest+0x9d>
+    error("unable to create inline3.txt");
+    103e:	8b 05 ec 17 00 00    	mov    0x17ec(%rip),%eax        # 2830 <stdout>
+    1044:	ba a0 00 00 00       	mov    $0xa0,%edx
+    1049:	48 8d 0d 10 11 00 00 	lea    0x1110(%rip),%rcx        # 2160 <malloc+0x180>
+    1050:	48 89 ce             	mov    %rcx,%rsi
+    1053:	89 c7                	mov    %eax,%edi
+    1055:	b8 00 00 00 00       	mov    $0x0,%eax
+    105a:	e8 ff 06 00 00       	call   175e <printf>
+    105f:	8b 05 cb 17 00 00    	mov    0x17cb(%rip),%eax        # 2830 <stdout>
+    1065:	48 8d 15 b6 13 00 00 	lea    0x13b6(%rip),%rdx        # 2422 <malloc+0x442>
+    106c:	48 89 d6             	mov    %rdx,%rsi
+    106f:	89 c7                	mov    %eax,%edi
+    1071:	b8 00 00 00 00       	mov    $0x0,%eax
+    1076:	e8 e3 06 00 00       	call   175e <printf>
+    107b:	8b 05 af 17 00 00    	mov    0x17af(%rip),%eax        # 2830 <stdout>
+    1081:	48 8d 15 fc 10 00 00 	lea    0x10fc(%rip),%rdx        # 2184 <malloc+0x1a4>
+    1088:	48 89 d6             	mov    %rdx,%rsi
+    108b:	89 c7                	mov    %eax,%edi
+    108d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1092:	e8 c7 06 00 00       	call   175e <printf>
+    1097:	90                   	nop
+    1098:	eb fd                	jmp    1097 <mmaptest+0x9a>
+  for(i = 0; i < DINLINESZ / 2; i++)
+    109a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10a1:	eb 3c                	jmp    10df <mmaptest+0xe2>
+    buf[i] = 'a' + i % 26;
+    10a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10a6:	48 63 d0             	movslq %eax,%rdx
+    10a9:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+    10b0:	48 c1 ea 20          	shr    $0x20,%rdx
+    10b4:	c1 fa 03             	sar    $0x3,%edx
+    10b7:	89 c1                	mov    %eax,%ecx
+    10b9:	c1 f9 1f             	sar    $0x1f,%ecx
+    10bc:	29 ca                	sub    %ecx,%edx
+    10be:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+    10c1:	29 c8                	sub    %ecx,%eax
+    10c3:	89 c2                	mov    %eax,%edx
+    10c5:	89 d0                	mov    %edx,%eax
+    10c7:	83 c0 61             	add    $0x61,%eax
+    10ca:	89 c1                	mov    %eax,%ecx
+    10cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10cf:	48 98                	cltq
+    10d1:	48 8d 15 e8 17 00 00 	lea    0x17e8(%rip),%rdx        # 28c0 <buf>
+    10d8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(i = 0; i < DINLINESZ / 2; i++)
+    10db:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10df:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+    10e3:	7e be                	jle    10a3 <mmaptest+0xa6>
+  if(write(fd, buf, DINLINESZ / 2) != DINLINESZ / 2)
+    10e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    10e8:	ba 14 00 00 00       	mov    $0x14,%edx
+    10ed:	48 8d 0d cc 17 00 00 	lea    0x17cc(%rip),%rcx        # 28c0 <buf>
+    10f4:	48 89 ce             	mov    %rcx,%rsi
+    10f7:	89 c7                	mov    %eax,%edi
+    10f9:	e8 27 0c 00 00       	call   1d25 <write>
+    10fe:	83 f8 14             	cmp    $0x14,%eax
+    1101:	74 5c                	je     115f <mmaptest+0x162>
+    error("unable to write inline3.txt");
+    1103:	8b 05 27 17 00 00    	mov    0x1727(%rip),%eax        # 2830 <stdout>
+    1109:	ba a4 00 00 00       	mov    $0xa4,%edx
+    110e:	48 8d 0d 4b 10 00 00 	lea    0x104b(%rip),%rcx        # 2160 <malloc+0x180>
+    1115:	48 89 ce             	mov    %rcx,%rsi
+    1118:	89 c7                	mov    %eax,%edi
+    111a:	b8 00 00 00 00       	mov    $0x0,%eax
+    111f:	e8 3a 06 00 00       	call   175e <printf>
+    1124:	8b 05 06 17 00 00    	mov    0x1706(%rip),%eax        # 2830 <stdout>
+    112a:	48 8d 15 0e 13 00 00 	lea    0x130e(%rip),%rdx        # 243f <malloc+0x45f>
+    1131:	48 89 d6             	mov    %rdx,%rsi
+    1134:	89 c7                	mov    %eax,%edi
+    1136:	b8 00 00 00 00       	mov    $0x0,%eax
+    113b:	e8 1e 06 00 00       	call   175e <printf>
+    1140:	8b 05 ea 16 00 00    	mov    0x16ea(%rip),%eax        # 2830 <stdout>
+    1146:	48 8d 15 37 10 00 00 	lea    0x1037(%rip),%rdx        # 2184 <malloc+0x1a4>
+    114d:	48 89 d6             	mov    %rdx,%rsi
+    1150:	89 c7                	mov    %eax,%edi
+    1152:	b8 00 00 00 00       	mov    $0x0,%eax
+    1157:	e8 02 06 00 00       	call   175e <printf>
+    115c:	90                   	nop
+    115d:	eb fd                	jmp    115c <mmaptest+0x15f>
+
+  p = mmap2(0, PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    115f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1162:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1168:	41 89 c0             	mov    %eax,%r8d
+    116b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1170:	ba 03 00 00 00       	mov    $0x3,%edx
+    1175:	be 00 10 00 00       	mov    $0x1000,%esi
+    117a:	bf 00 00 00 00       	mov    $0x0,%edi
+    117f:	e8 41 0c 00 00       	call   1dc5 <mmap2>
+    1184:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(p == MAP_FAILED)
+    1188:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+    118d:	75 5c                	jne    11eb <mmaptest+0x1ee>
+    error("mmap2 failed");
+    118f:	8b 05 9b 16 00 00    	mov    0x169b(%rip),%eax        # 2830 <stdout>
+    1195:	ba a8 00 00 00       	mov    $0xa8,%edx
+    119a:	48 8d 0d bf 0f 00 00 	lea    0xfbf(%rip),%rcx        # 2160 <malloc+0x180>
+    11a1:	48 89 ce             	mov    %rcx,%rsi
+    11a4:	89 c7                	mov    %eax,%edi
+    11a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ab:	e8 ae 05 00 00       	call   175e <printf>
+    11b0:	8b 05 7a 16 00 00    	mov    0x167a(%rip),%eax        # 2830 <stdout>
+    11b6:	48 8d 15 9e 12 00 00 	lea    0x129e(%rip),%rdx        # 245b <malloc+0x47b>
+    11bd:	48 89 d6             	mov    %rdx,%rsi
+    11c0:	89 c7                	mov    %eax,%edi
+    11c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c7:	e8 92 05 00 00       	call   175e <printf>
+    11cc:	8b 05 5e 16 00 00    	mov    0x165e(%rip),%eax        # 2830 <stdout>
+    11d2:	48 8d 15 ab 0f 00 00 	lea    0xfab(%rip),%rdx        # 2184 <malloc+0x1a4>
+    11d9:	48 89 d6             	mov    %rdx,%rsi
+    11dc:	89 c7                	mov    %eax,%edi
+    11de:	b8 00 00 00 00       	mov    $0x0,%eax
+    11e3:	e8 76 05 00 00       	call   175e <printf>
+    11e8:	90                   	nop
+    11e9:	eb fd                	jmp    11e8 <mmaptest+0x1eb>
+  for(i = 0; i < PGSIZE; i++)
+    11eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    11f2:	e9 bc 00 00 00       	jmp    12b3 <mmaptest+0x2b6>
+    if(p[i] != (i < DINLINESZ / 2 ? 'a' + i % 26 : 0))
+    11f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11fa:	48 63 d0             	movslq %eax,%rdx
+    11fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1201:	48 01 d0             	add    %rdx,%rax
+    1204:	0f b6 00             	movzbl (%rax),%eax
+    1207:	0f be c8             	movsbl %al,%ecx
+    120a:	83 7d fc 13          	cmpl   $0x13,-0x4(%rbp)
+    120e:	7f 27                	jg     1237 <mmaptest+0x23a>
+    1210:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1213:	48 63 d0             	movslq %eax,%rdx
+    1216:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+    121d:	48 c1 ea 20          	shr    $0x20,%rdx
+    1221:	c1 fa 03             	sar    $0x3,%edx
+    1224:	89 c6                	mov    %eax,%esi
+    1226:	c1 fe 1f             	sar    $0x1f,%esi
+    1229:	29 f2                	sub    %esi,%edx
+    122b:	6b f2 1a             	imul   $0x1a,%edx,%esi
+    122e:	29 f0                	sub    %esi,%eax
+    1230:	89 c2                	mov    %eax,%edx
+    1232:	8d 42 61             	lea    0x61(%rdx),%eax
+    1235:	eb 05                	jmp    123c <mmaptest+0x23f>
+    1237:	b8 00 00 00 00       	mov    $0x0,%eax
+    123c:	39 c8                	cmp    %ecx,%eax
+    123e:	74 6f                	je     12af <mmaptest+0x2b2>
+      error("byte %d of the mapping is %d", i, p[i]);
+    1240:	8b 05 ea 15 00 00    	mov    0x15ea(%rip),%eax        # 2830 <stdout>
+    1246:	ba ab 00 00 00       	mov    $0xab,%edx
+    124b:	48 8d 0d 0e 0f 00 00 	lea    0xf0e(%rip),%rcx        # 2160 <malloc+0x180>
+    1252:	48 89 ce             	mov    %rcx,%rsi
+    1255:	89 c7                	mov    %eax,%edi
+    1257:	b8 00 00 00 00       	mov    $0x0,%eax
+    125c:	e8 fd 04 00 00       	call   175e <printf>
+    1261:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1264:	48 63 d0             	movslq %eax,%rdx
+    1267:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    126b:	48 01 d0             	add    %rdx,%rax
+    126e:	0f b6 00             	movzbl (%rax),%eax
+    1271:	0f be c8             	movsbl %al,%ecx
+    1274:	8b 05 b6 15 00 00    	mov    0x15b6(%rip),%eax        # 2830 <stdout>
+    127a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    127d:	48 8d 35 e4 11 00 00 	lea    0x11e4(%rip),%rsi        # 2468 <malloc+0x488>
+    1284:	89 c7                	mov    %eax,%edi
+    1286:	b8 00 00 00 00       	mov    $0x0,%eax
+    128b:	e8 ce 04 00 00       	call   175e <printf>
+    1290:	8b 05 9a 15 00 00    	mov    0x159a(%rip),%eax        # 2830 <stdout>
+    1296:	48 8d 15 e7 0e 00 00 	lea    0xee7(%rip),%rdx        # 2184 <malloc+0x1a4>
+    129d:	48 89 d6             	mov    %rdx,%rsi
+    12a0:	89 c7                	mov    %eax,%edi
+    12a2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a7:	e8 b2 04 00 00       	call   175e <printf>
+    12ac:	90                   	nop
+    12ad:	eb fd                	jmp    12ac <mmaptest+0x2af>
+  for(i = 0; i < PGSIZE; i++)
+    12af:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    12b3:	81 7d fc ff 0f 00 00 	cmpl   $0xfff,-0x4(%rbp)
+    12ba:	0f 8e 37 ff ff ff    	jle    11f7 <mmaptest+0x1fa>
+  p[3] = 'Z';
+    12c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12c4:	48 83 c0 03          	add    $0x3,%rax
+    12c8:	c6 00 5a             	movb   $0x5a,(%rax)
+  if(msync(p, PGSIZE) < 0)
+    12cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12cf:	be 00 10 00 00       	mov    $0x1000,%esi
+    12d4:	48 89 c7             	mov    %rax,%rdi
+    12d7:	e8 00 0b 00 00       	call   1ddc <msync>
+    12dc:	85 c0                	test   %eax,%eax
+    12de:	79 5c                	jns    133c <mmaptest+0x33f>
+    error("msync failed");
+    12e0:	8b 05 4a 15 00 00    	mov    0x154a(%rip),%eax        # 2830 <stdout>
+    12e6:	ba ae 00 00 00       	mov    $0xae,%edx
+    12eb:	48 8d 0d 6e 0e 00 00 	lea    0xe6e(%rip),%rcx        # 2160 <malloc+0x180>
+    12f2:	48 89 ce             	mov    %rcx,%rsi
+    12f5:	89 c7                	mov    %eax,%edi
+    12f7:	b8 00 00 00 00       	mov    $0x0,%eax
+    12fc:	e8 5d 04 00 00       	call   175e <printf>
+    1301:	8b 05 29 15 00 00    	mov    0x1529(%rip),%eax        # 2830 <stdout>
+    1307:	48 8d 15 77 11 00 00 	lea    0x1177(%rip),%rdx        # 2485 <malloc+0x4a5>
+    130e:	48 89 d6             	mov    %rdx,%rsi
+    1311:	89 c7                	mov    %eax,%edi
+    1313:	b8 00 00 00 00       	mov    $0x0,%eax
+    1318:	e8 41 04 00 00       	call   175e <printf>
+    131d:	8b 05 0d 15 00 00    	mov    0x150d(%rip),%eax        # 2830 <stdout>
+    1323:	48 8d 15 5a 0e 00 00 	lea    0xe5a(%rip),%rdx        # 2184 <malloc+0x1a4>
+    132a:	48 89 d6             	mov    %rdx,%rsi
+    132d:	89 c7                	mov    %eax,%edi
+    132f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1334:	e8 25 04 00 00       	call   175e <printf>
+    1339:	90                   	nop
+    133a:	eb fd                	jmp    1339 <mmaptest+0x33c>
+  if(munmap2(p, PGSIZE) < 0)
+    133c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1340:	be 00 10 00 00       	mov    $0x1000,%esi
+    1345:	48 89 c7             	mov    %rax,%rdi
+    1348:	e8 87 0a 00 00       	call   1dd4 <munmap2>
+    134d:	85 c0                	test   %eax,%eax
+    134f:	79 5c                	jns    13ad <mmaptest+0x3b0>
+    error("munmap2 failed");
+    1351:	8b 05 d9 14 00 00    	mov    0x14d9(%rip),%eax        # 2830 <stdout>
+    1357:	ba b0 00 00 00       	mov    $0xb0,%edx
+    135c:	48 8d 0d fd 0d 00 00 	lea    0xdfd(%rip),%rcx        # 2160 <malloc+0x180>
+    1363:	48 89 ce             	mov    %rcx,%rsi
+    1366:	89 c7                	mov    %eax,%edi
+    1368:	b8 00 00 00 00       	mov    $0x0,%eax
+    136d:	e8 ec 03 00 00       	call   175e <printf>
+    1372:	8b 05 b8 14 00 00    	mov    0x14b8(%rip),%eax        # 2830 <stdout>
+    1378:	48 8d 15 13 11 00 00 	lea    0x1113(%rip),%rdx        # 2492 <malloc+0x4b2>
+    137f:	48 89 d6             	mov    %rdx,%rsi
+    1382:	89 c7                	mov    %eax,%edi
+    1384:	b8 00 00 00 00       	mov    $0x0,%eax
+    1389:	e8 d0 03 00 00       	call   175e <printf>
+    138e:	8b 05 9c 14 00 00    	mov    0x149c(%rip),%eax        # 2830 <stdout>
+    1394:	48 8d 15 e9 0d 00 00 	lea    0xde9(%rip),%rdx        # 2184 <malloc+0x1a4>
+    139b:	48 89 d6             	mov    %rdx,%rsi
+    139e:	89 c7                	mov    %eax,%edi
+    13a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    13a5:	e8 b4 03 00 00       	call   175e <printf>
+    13aa:	90                   	nop
+    13ab:	eb fd                	jmp    13aa <mmaptest+0x3ad>
+  close(fd);
+    13ad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    13b0:	89 c7                	mov    %eax,%edi
+    13b2:	e8 76 09 00 00       	call   1d2d <close>
+
+  if((fd = open("inline3.txt", O_RDONLY)) < 0)
+    13b7:	be 00 00 00 00       	mov    $0x0,%esi
+    13bc:	48 8d 05 53 10 00 00 	lea    0x1053(%rip),%rax        # 2416 <malloc+0x436>
+    13c3:	48 89 c7             	mov    %rax,%rdi
+    13c6:	e8 7a 09 00 00       	call   1d45 <open>
+    13cb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    13ce:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    13d2:	79 5c                	jns    1430 <mmaptest+0x433>
+    error("unable to open inline3.txt");
+    13d4:	8b 05 56 14 00 00    	mov    0x1456(%rip),%eax        # 2830 <stdout>
+    13da:	ba b4 00 00 00       	mov    $0xb4,%edx
+    13df:	48 8d 0d 7a 0d 00 00 	lea    0xd7a(%rip),%rcx        # 2160 <malloc+0x180>
+    13e6:	48 89 ce             	mov    %rcx,%rsi
+    13e9:	89 c7                	mov    %eax,%edi
+    13eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    13f0:	e8 69 03 00 00       	call   175e <printf>
+    13f5:	8b 05 35 14 00 00    	mov    0x1435(%rip),%eax        # 2830 <stdout>
+    13fb:	48 8d 15 9f 10 00 00 	lea    0x109f(%rip),%rdx        # 24a1 <malloc+0x4c1>
+    1402:	48 89 d6             	mov    %rdx,%rsi
+    1405:	89 c7                	mov    %eax,%edi
+    1407:	b8 00 00 00 00       	mov    $0x0,%eax
+    140c:	e8 4d 03 00 00       	call   175e <printf>
+    1411:	8b 05 19 14 00 00    	mov    0x1419(%rip),%eax        # 2830 <stdout>
+    1417:	48 8d 15 66 0d 00 00 	lea    0xd66(%rip),%rdx        # 2184 <malloc+0x1a4>
+    141e:	48 89 d6             	mov    %rdx,%rsi
+    1421:	89 c7                	mov    %eax,%edi
+    1423:	b8 00 00 00 00       	mov    $0x0,%eax
+    1428:	e8 31 03 00 00       	call   175e <printf>
+    142d:	90                   	nop
+    142e:	eb fd                	jmp    142d <mmaptest+0x430>
+  if(read(fd, buf, sizeof(buf)) != DINLINESZ / 2 || buf[3] != 'Z' || buf[4] != 'e')
+    1430:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1433:	ba 00 06 00 00       	mov    $0x600,%edx
+    1438:	48 8d 0d 81 14 00 00 	lea    0x1481(%rip),%rcx        # 28c0 <buf>
+    143f:	48 89 ce             	mov    %rcx,%rsi
+    1442:	89 c7                	mov    %eax,%edi
+    1444:	e8 d4 08 00 00       	call   1d1d <read>
+    1449:	83 f8 14             	cmp    $0x14,%eax
+    144c:	75 16                	jne    1464 <mmaptest+0x467>
+    144e:	0f b6 05 6e 14 00 00 	movzbl 0x146e(%rip),%eax        # 28c3 <buf+0x3>
+    1455:	3c 5a                	cmp    $0x5a,%al
+    1457:	75 0b                	jne    1464 <mmaptest+0x467>
+    1459:	0f b6 05 64 14 00 00 	movzbl 0x1464(%rip),%eax        # 28c4 <buf+0x4>
+    1460:	3c 65                	cmp    $0x65,%al
+    1462:	74 5c                	je     14c0 <mmaptest+0x4c3>
+    error("store through the mapping did not reach the file");
+    1464:	8b 05 c6 13 00 00    	mov    0x13c6(%rip),%eax        # 2830 <stdout>
+    146a:	ba b6 00 00 00       	mov    $0xb6,%edx
+    146f:	48 8d 0d ea 0c 00 00 	lea    0xcea(%rip),%rcx        # 2160 <malloc+0x180>
+    1476:	48 89 ce             	mov    %rcx,%rsi
+    1479:	89 c7                	mov    %eax,%edi
+    147b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1480:	e8 d9 02 00 00       	call   175e <printf>
+    1485:	8b 05 a5 13 00 00    	mov    0x13a5(%rip),%eax        # 2830 <stdout>
+    148b:	48 8d 15 2e 10 00 00 	lea    0x102e(%rip),%rdx        # 24c0 <malloc+0x4e0>
+    1492:	48 89 d6             	mov    %rdx,%rsi
+    1495:	89 c7                	mov    %eax,%edi
+    1497:	b8 00 00 00 00       	mov    $0x0,%eax
+    149c:	e8 bd 02 00 00       	call   175e <printf>
+    14a1:	8b 05 89 13 00 00    	mov    0x1389(%rip),%eax        # 2830 <stdout>
+    14a7:	48 8d 15 d6 0c 00 00 	lea    0xcd6(%rip),%rdx        # 2184 <malloc+0x1a4>
+    14ae:	48 89 d6             	mov    %rdx,%rsi
+    14b1:	89 c7                	mov    %eax,%edi
+    14b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    14b8:	e8 a1 02 00 00       	call   175e <printf>
+    14bd:	90                   	nop
+    14be:	eb fd                	jmp    14bd <mmaptest+0x4c0>
+  close(fd);
+    14c0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    14c3:	89 c7                	mov    %eax,%edi
+    14c5:	e8 63 08 00 00       	call   1d2d <close>
+  if(unlink("inline3.txt") < 0)
+    14ca:	48 8d 05 45 0f 00 00 	lea    0xf45(%rip),%rax        # 2416 <malloc+0x436>
+    14d1:	48 89 c7             	mov    %rax,%rdi
+    14d4:	e8 7c 08 00 00       	call   1d55 <unlink>
+    14d9:	85 c0                	test   %eax,%eax
+    14db:	79 5c                	jns    1539 <mmaptest+0x53c>
+    error("unable to unlink inline3.txt");
+    14dd:	8b 05 4d 13 00 00    	mov    0x134d(%rip),%eax        # 2830 <stdout>
+    14e3:	ba b9 00 00 00       	mov    $0xb9,%edx
+    14e8:	48 8d 0d 71 0c 00 00 	lea    0xc71(%rip),%rcx        # 2160 <malloc+0x180>
+    14ef:	48 89 ce             	mov    %rcx,%rsi
+    14f2:	89 c7                	mov    %eax,%edi
+    14f4:	b8 00 00 00 00       	mov    $0x0,%eax
+    14f9:	e8 60 02 00 00       	call   175e <printf>
+    14fe:	8b 05 2c 13 00 00    	mov    0x132c(%rip),%eax        # 2830 <stdout>
+    1504:	48 8d 15 e6 0f 00 00 	lea    0xfe6(%rip),%rdx        # 24f1 <malloc+0x511>
+    150b:	48 89 d6             	mov    %rdx,%rsi
+    150e:	89 c7                	mov    %eax,%edi
+    1510:	b8 00 00 00 00       	mov    $0x0,%eax
+    1515:	e8 44 02 00 00       	call   175e <printf>
+    151a:	8b 05 10 13 00 00    	mov    0x1310(%rip),%eax        # 2830 <stdout>
+    1520:	48 8d 15 5d 0c 00 00 	lea    0xc5d(%rip),%rdx        # 2184 <malloc+0x1a4>
+    1527:	48 89 d6             	mov    %rdx,%rsi
+    152a:	89 c7                	mov    %eax,%edi
+    152c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1531:	e8 28 02 00 00       	call   175e <printf>
+    1536:	90                   	nop
+    1537:	eb fd                	jmp    1536 <mmaptest+0x539>
+  printf(stdout, "mmaptest OK\n");
+    1539:	8b 05 f1 12 00 00    	mov    0x12f1(%rip),%eax        # 2830 <stdout>
+    153f:	48 8d 15 c8 0f 00 00 	lea    0xfc8(%rip),%rdx        # 250e <malloc+0x52e>
+    1546:	48 89 d6             	mov    %rdx,%rsi
+    1549:	89 c7                	mov    %eax,%edi
+    154b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1550:	e8 09 02 00 00       	call   175e <printf>
+}
+    1555:	90                   	nop
+    1556:	c9                   	leave
+    1557:	c3                   	ret
+
+0000000000001558 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    1558:	55                   	push   %rbp
+    1559:	48 89 e5             	mov    %rsp,%rbp
+    155c:	48 83 ec 10          	sub    $0x10,%rsp
+    1560:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1563:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  growtest();
+    1567:	e8 49 ed ff ff       	call   2b5 <growtest>
+  boundarytest();
+    156c:	e8 9b ef ff ff       	call   50c <boundarytest>
+  manytest();
+    1571:	e8 c0 f4 ff ff       	call   a36 <manytest>
+  mmaptest();
+    1576:	e8 82 fa ff ff       	call   ffd <mmaptest>
+  printf(stdout, "inlinetest passed!!\n");
+    157b:	8b 05 af 12 00 00    	mov    0x12af(%rip),%eax        # 2830 <stdout>
+    1581:	48 8d 15 93 0f 00 00 	lea    0xf93(%rip),%rdx        # 251b <malloc+0x53b>
+    1588:	48 89 d6             	mov    %rdx,%rsi
+    158b:	89 c7                	mov    %eax,%edi
+    158d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1592:	e8 c7 01 00 00       	call   175e <printf>
+  exit();
+    1597:	e8 69 07 00 00       	call   1d05 <exit>
+
+000000000000159c <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    159c:	55                   	push   %rbp
+    159d:	48 89 e5             	mov    %rsp,%rbp
+    15a0:	48 83 ec 10          	sub    $0x10,%rsp
+    15a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    15a7:	89 f0                	mov    %esi,%eax
+    15a9:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    15ac:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    15b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15b3:	ba 01 00 00 00       	mov    $0x1,%edx
+    15b8:	48 89 ce             	mov    %rcx,%rsi
+    15bb:	89 c7                	mov    %eax,%edi
+    15bd:	e8 63 07 00 00       	call   1d25 <write>
+}
+    15c2:	90                   	nop
+    15c3:	c9                   	leave
+    15c4:	c3                   	ret
+
+00000000000015c5 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    15c5:	55                   	push   %rbp
+    15c6:	48 89 e5             	mov    %rsp,%rbp
+    15c9:	48 83 ec 40          	sub    $0x40,%rsp
+    15cd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    15d0:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    15d3:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    15d6:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    15d9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    15dd:	74 1f                	je     15fe <printint64+0x39>
+    15df:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    15e2:	c1 e8 1f             	shr    $0x1f,%eax
+    15e5:	0f b6 c0             	movzbl %al,%eax
+    15e8:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    15eb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    15ef:	74 0d                	je     15fe <printint64+0x39>
+    x = -xx;
+    15f1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    15f4:	f7 d8                	neg    %eax
+    15f6:	48 98                	cltq
+    15f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    15fc:	eb 09                	jmp    1607 <printint64+0x42>
+  else
+    x = xx;
+    15fe:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1601:	48 98                	cltq
+    1603:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1607:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    160e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1611:	48 63 c8             	movslq %eax,%rcx
+    1614:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1618:	ba 00 00 00 00       	mov    $0x0,%edx
+    161d:	48 f7 f1             	div    %rcx
+    1620:	48 89 d1             	mov    %rdx,%rcx
+    1623:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1626:	8d 50 01             	lea    0x1(%rax),%edx
+    1629:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    162c:	48 8d 15 0d 12 00 00 	lea    0x120d(%rip),%rdx        # 2840 <digits.1>
+    1633:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1637:	48 98                	cltq
+    1639:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    163d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1640:	48 63 f0             	movslq %eax,%rsi
+    1643:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1647:	ba 00 00 00 00       	mov    $0x0,%edx
+    164c:	48 f7 f6             	div    %rsi
+    164f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1653:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1658:	75 b4                	jne    160e <printint64+0x49>
+
+  if(sgn)
+    165a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    165e:	74 2b                	je     168b <printint64+0xc6>
+    buf[i++] = '-';
+    1660:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1663:	8d 50 01             	lea    0x1(%rax),%edx
+    1666:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1669:	48 98                	cltq
+    166b:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1670:	eb 19                	jmp    168b <printint64+0xc6>
+    putc(fd, buf[i]);
+    1672:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1675:	48 98                	cltq
+    1677:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    167c:	0f be d0             	movsbl %al,%edx
+    167f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1682:	89 d6                	mov    %edx,%esi
+    1684:	89 c7                	mov    %eax,%edi
+    1686:	e8 11 ff ff ff       	call   159c <putc>
+  while(--i >= 0)
+    168b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    168f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1693:	79 dd                	jns    1672 <printint64+0xad>
+}
+    1695:	90                   	nop
+    1696:	90                   	nop
+    1697:	c9                   	leave
+    1698:	c3                   	ret
+
+0000000000001699 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1699:	55                   	push   %rbp
+    169a:	48 89 e5             	mov    %rsp,%rbp
+    169d:	48 83 ec 30          	sub    $0x30,%rsp
+    16a1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    16a4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    16a7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    16aa:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    16ad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    16b4:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    16b8:	74 17                	je     16d1 <printint+0x38>
+    16ba:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    16be:	79 11                	jns    16d1 <printint+0x38>
+    neg = 1;
+    16c0:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    16c7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    16ca:	f7 d8                	neg    %eax
+    16cc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    16cf:	eb 06                	jmp    16d7 <printint+0x3e>
+  } else {
+    x = xx;
+    16d1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    16d4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    16d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    16de:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    16e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    16e4:	ba 00 00 00 00       	mov    $0x0,%edx
+    16e9:	f7 f1                	div    %ecx
+    16eb:	89 d1                	mov    %edx,%ecx
+    16ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16f0:	8d 50 01             	lea    0x1(%rax),%edx
+    16f3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    16f6:	89 c9                	mov    %ecx,%ecx
+    16f8:	48 8d 15 61 11 00 00 	lea    0x1161(%rip),%rdx        # 2860 <digits.0>
+    16ff:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1703:	48 98                	cltq
+    1705:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1709:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    170c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    170f:	ba 00 00 00 00       	mov    $0x0,%edx
+    1714:	f7 f6                	div    %esi
+    1716:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1719:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    171d:	75 bf                	jne    16de <printint+0x45>
+  if(neg)
+    171f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1723:	74 2b                	je     1750 <printint+0xb7>
+    buf[i++] = '-';
+    1725:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1728:	8d 50 01             	lea    0x1(%rax),%edx
+    172b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    172e:	48 98                	cltq
+    1730:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1735:	eb 19                	jmp    1750 <printint+0xb7>
+    putc(fd, buf[i]);
+    1737:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    173a:	48 98                	cltq
+    173c:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1741:	0f be d0             	movsbl %al,%edx
+    1744:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1747:	89 d6                	mov    %edx,%esi
+    1749:	89 c7                	mov    %eax,%edi
+    174b:	e8 4c fe ff ff       	call   159c <putc>
+  while(--i >= 0)
+    1750:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1754:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1758:	79 dd                	jns    1737 <printint+0x9e>
+}
+    175a:	90                   	nop
+    175b:	90                   	nop
+    175c:	c9                   	leave
+    175d:	c3                   	ret
+
+000000000000175e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    175e:	55                   	push   %rbp
+    175f:	48 89 e5             	mov    %rsp,%rbp
+    1762:	48 83 ec 70          	sub    $0x70,%rsp
+    1766:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1769:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    176d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1771:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1775:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1779:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    177d:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1784:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1788:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    178c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1790:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1794:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    179b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    17a2:	e9 6b 02 00 00       	jmp    1a12 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    17a7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    17aa:	48 63 d0             	movslq %eax,%rdx
+    17ad:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    17b1:	48 01 d0             	add    %rdx,%rax
+    17b4:	0f b6 00             	movzbl (%rax),%eax
+    17b7:	0f be c0             	movsbl %al,%eax
+    17ba:	25 ff 00 00 00       	and    $0xff,%eax
+    17bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    17c2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    17c6:	75 30                	jne    17f8 <printf+0x9a>
+      if(c == '%'){
+    17c8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    17cc:	75 13                	jne    17e1 <printf+0x83>
+        state = '%';
+    17ce:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    17d5:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    17dc:	e9 2d 02 00 00       	jmp    1a0e <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    17e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    17e4:	0f be d0             	movsbl %al,%edx
+    17e7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    17ea:	89 d6                	mov    %edx,%esi
+    17ec:	89 c7                	mov    %eax,%edi
+    17ee:	e8 a9 fd ff ff       	call   159c <putc>
+    17f3:	e9 16 02 00 00       	jmp    1a0e <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    17f8:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    17fc:	0f 85 0c 02 00 00    	jne    1a0e <printf+0x2b0>
+      if(c == 'l') {
+    1802:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1806:	75 0c                	jne    1814 <printf+0xb6>
+        lflag = 1;
+    1808:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    180f:	e9 fa 01 00 00       	jmp    1a0e <printf+0x2b0>
+      } else if(c == 'd'){
+    1814:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1818:	0f 85 95 00 00 00    	jne    18b3 <printf+0x155>
+        if (lflag == 1)
+    181e:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1822:	75 49                	jne    186d <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1824:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1827:	83 f8 2f             	cmp    $0x2f,%eax
+    182a:	77 17                	ja     1843 <printf+0xe5>
+    182c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1830:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1833:	89 d2                	mov    %edx,%edx
+    1835:	48 01 d0             	add    %rdx,%rax
+    1838:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    183b:	83 c2 08             	add    $0x8,%edx
+    183e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1841:	eb 0c                	jmp    184f <printf+0xf1>
+    1843:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1847:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    184b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    184f:	48 8b 00             	mov    (%rax),%rax
+    1852:	89 c6                	mov    %eax,%esi
+    1854:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1857:	b9 01 00 00 00       	mov    $0x1,%ecx
+    185c:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1861:	89 c7                	mov    %eax,%edi
+    1863:	e8 5d fd ff ff       	call   15c5 <printint64>
+    1868:	e9 9a 01 00 00       	jmp    1a07 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    186d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1870:	83 f8 2f             	cmp    $0x2f,%eax
+    1873:	77 17                	ja     188c <printf+0x12e>
+    1875:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1879:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    187c:	89 d2                	mov    %edx,%edx
+    187e:	48 01 d0             	add    %rdx,%rax
+    1881:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1884:	83 c2 08             	add    $0x8,%edx
+    1887:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    188a:	eb 0c                	jmp    1898 <printf+0x13a>
+    188c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1890:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1894:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1898:	8b 30                	mov    (%rax),%esi
+    189a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    189d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    18a2:	ba 0a 00 00 00       	mov    $0xa,%edx
+    18a7:	89 c7                	mov    %eax,%edi
+    18a9:	e8 eb fd ff ff       	call   1699 <printint>
+    18ae:	e9 54 01 00 00       	jmp    1a07 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    18b3:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    18b7:	74 0a                	je     18c3 <printf+0x165>
+    18b9:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    18bd:	0f 85 95 00 00 00    	jne    1958 <printf+0x1fa>
+        if (lflag == 1)
+    18c3:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    18c7:	75 49                	jne    1912 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    18c9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    18cc:	83 f8 2f             	cmp    $0x2f,%eax
+    18cf:	77 17                	ja     18e8 <printf+0x18a>
+    18d1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    18d5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    18d8:	89 d2                	mov    %edx,%edx
+    18da:	48 01 d0             	add    %rdx,%rax
+    18dd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    18e0:	83 c2 08             	add    $0x8,%edx
+    18e3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    18e6:	eb 0c                	jmp    18f4 <printf+0x196>
+    18e8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    18ec:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    18f0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    18f4:	48 8b 00             	mov    (%rax),%rax
+    18f7:	89 c6                	mov    %eax,%esi
+    18f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    18fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1901:	ba 10 00 00 00       	mov    $0x10,%edx
+    1906:	89 c7                	mov    %eax,%edi
+    1908:	e8 b8 fc ff ff       	call   15c5 <printint64>
+        if (lflag == 1)
+    190d:	e9 f5 00 00 00       	jmp    1a07 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1912:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1915:	83 f8 2f             	cmp    $0x2f,%eax
+    1918:	77 17                	ja     1931 <printf+0x1d3>
+    191a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    191e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1921:	89 d2                	mov    %edx,%edx
+    1923:	48 01 d0             	add    %rdx,%rax
+    1926:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1929:	83 c2 08             	add    $0x8,%edx
+    192c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    192f:	eb 0c                	jmp    193d <printf+0x1df>
+    1931:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1935:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1939:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    193d:	8b 30                	mov    (%rax),%esi
+    193f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1942:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1947:	ba 10 00 00 00       	mov    $0x10,%edx
+    194c:	89 c7                	mov    %eax,%edi
+    194e:	e8 46 fd ff ff       	call   1699 <printint>
+        if (lflag == 1)
+    1953:	e9 af 00 00 00       	jmp    1a07 <printf+0x2a9>
+      } else if(c == 's'){
+    1958:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    195c:	75 6e                	jne    19cc <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    195e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1961:	83 f8 2f             	cmp    $0x2f,%eax
+    1964:	77 17                	ja     197d <printf+0x21f>
+    1966:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    196a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    196d:	89 d2                	mov    %edx,%edx
+    196f:	48 01 d0             	add    %rdx,%rax
+    1972:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1975:	83 c2 08             	add    $0x8,%edx
+    1978:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    197b:	eb 0c                	jmp    1989 <printf+0x22b>
+    197d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1981:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1985:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1989:	48 8b 00             	mov    (%rax),%rax
+    198c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1990:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1995:	75 28                	jne    19bf <printf+0x261>
+          s = "(null)";
+    1997:	48 8d 05 92 0b 00 00 	lea    0xb92(%rip),%rax        # 2530 <malloc+0x550>
+    199e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    19a2:	eb 1b                	jmp    19bf <printf+0x261>
+          putc(fd, *s);
+    19a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    19a8:	0f b6 00             	movzbl (%rax),%eax
+    19ab:	0f be d0             	movsbl %al,%edx
+    19ae:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19b1:	89 d6                	mov    %edx,%esi
+    19b3:	89 c7                	mov    %eax,%edi
+    19b5:	e8 e2 fb ff ff       	call   159c <putc>
+        for(; *s; s++)
+    19ba:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    19bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    19c3:	0f b6 00             	movzbl (%rax),%eax
+    19c6:	84 c0                	test   %al,%al
+    19c8:	75 da                	jne    19a4 <printf+0x246>
+    19ca:	eb 3b                	jmp    1a07 <printf+0x2a9>
+      } else if(c == '%'){
+    19cc:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    19d0:	75 14                	jne    19e6 <printf+0x288>
+        putc(fd, c);
+    19d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    19d5:	0f be d0             	movsbl %al,%edx
+    19d8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19db:	89 d6                	mov    %edx,%esi
+    19dd:	89 c7                	mov    %eax,%edi
+    19df:	e8 b8 fb ff ff       	call   159c <putc>
+    19e4:	eb 21                	jmp    1a07 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    19e6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19e9:	be 25 00 00 00       	mov    $0x25,%esi
+    19ee:	89 c7                	mov    %eax,%edi
+    19f0:	e8 a7 fb ff ff       	call   159c <putc>
+        putc(fd, c);
+    19f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    19f8:	0f be d0             	movsbl %al,%edx
+    19fb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19fe:	89 d6                	mov    %edx,%esi
+    1a00:	89 c7                	mov    %eax,%edi
+    1a02:	e8 95 fb ff ff       	call   159c <putc>
+      }
+      state = 0;
+    1a07:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1a0e:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1a12:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1a15:	48 63 d0             	movslq %eax,%rdx
+    1a18:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1a1c:	48 01 d0             	add    %rdx,%rax
+    1a1f:	0f b6 00             	movzbl (%rax),%eax
+    1a22:	84 c0                	test   %al,%al
+    1a24:	0f 85 7d fd ff ff    	jne    17a7 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1a2a:	90                   	nop
+    1a2b:	90                   	nop
+    1a2c:	c9                   	leave
+    1a2d:	c3                   	ret
+
+0000000000001a2e <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    1a2e:	55                   	push   %rbp
+    1a2f:	48 89 e5             	mov    %rsp,%rbp
+    1a32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1a36:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1a39:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    1a3c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1a40:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1a43:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1a46:	48 89 ce             	mov    %rcx,%rsi
+    1a49:	48 89 f7             	mov    %rsi,%rdi
+    1a4c:	89 d1                	mov    %edx,%ecx
+    1a4e:	fc                   	cld
+    1a4f:	f3 aa                	rep stos %al,%es:(%rdi)
+    1a51:	89 ca                	mov    %ecx,%edx
+    1a53:	48 89 fe             	mov    %rdi,%rsi
+    1a56:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1a5a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    1a5d:	90                   	nop
+    1a5e:	5d                   	pop    %rbp
+    1a5f:	c3                   	ret
+
+0000000000001a60 <strcpy>:
+{
+    1a60:	55                   	push   %rbp
+    1a61:	48 89 e5             	mov    %rsp,%rbp
+    1a64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a68:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a70:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1a74:	90                   	nop
+    1a75:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1a79:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1a7d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1a81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a85:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1a89:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1a8d:	0f b6 12             	movzbl (%rdx),%edx
+    1a90:	88 10                	mov    %dl,(%rax)
+    1a92:	0f b6 00             	movzbl (%rax),%eax
+    1a95:	84 c0                	test   %al,%al
+    1a97:	75 dc                	jne    1a75 <strcpy+0x15>
+  return os;
+    1a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1a9d:	5d                   	pop    %rbp
+    1a9e:	c3                   	ret
+
+0000000000001a9f <strcmp>:
+{
+    1a9f:	55                   	push   %rbp
+    1aa0:	48 89 e5             	mov    %rsp,%rbp
+    1aa3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1aa7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1aab:	eb 0a                	jmp    1ab7 <strcmp+0x18>
+    p++, q++;
+    1aad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1ab2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1ab7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1abb:	0f b6 00             	movzbl (%rax),%eax
+    1abe:	84 c0                	test   %al,%al
+    1ac0:	74 12                	je     1ad4 <strcmp+0x35>
+    1ac2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ac6:	0f b6 10             	movzbl (%rax),%edx
+    1ac9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1acd:	0f b6 00             	movzbl (%rax),%eax
+    1ad0:	38 c2                	cmp    %al,%dl
+    1ad2:	74 d9                	je     1aad <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1ad4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad8:	0f b6 00             	movzbl (%rax),%eax
+    1adb:	0f b6 d0             	movzbl %al,%edx
+    1ade:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae2:	0f b6 00             	movzbl (%rax),%eax
+    1ae5:	0f b6 c0             	movzbl %al,%eax
+    1ae8:	29 c2                	sub    %eax,%edx
+    1aea:	89 d0                	mov    %edx,%eax
+}
+    1aec:	5d                   	pop    %rbp
+    1aed:	c3                   	ret
+
+0000000000001aee <strlen>:
+{
+    1aee:	55                   	push   %rbp
+    1aef:	48 89 e5             	mov    %rsp,%rbp
+    1af2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1af6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1afd:	eb 04                	jmp    1b03 <strlen+0x15>
+    1aff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1b03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1b06:	48 63 d0             	movslq %eax,%rdx
+    1b09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b0d:	48 01 d0             	add    %rdx,%rax
+    1b10:	0f b6 00             	movzbl (%rax),%eax
+    1b13:	84 c0                	test   %al,%al
+    1b15:	75 e8                	jne    1aff <strlen+0x11>
+  return n;
+    1b17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1b1a:	5d                   	pop    %rbp
+    1b1b:	c3                   	ret
+
+0000000000001b1c <memset>:
+{
+    1b1c:	55                   	push   %rbp
+    1b1d:	48 89 e5             	mov    %rsp,%rbp
+    1b20:	48 83 ec 10          	sub    $0x10,%rsp
+    1b24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b28:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1b2b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1b2e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1b31:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b38:	89 ce                	mov    %ecx,%esi
+    1b3a:	48 89 c7             	mov    %rax,%rdi
+    1b3d:	e8 ec fe ff ff       	call   1a2e <stosb>
+  return dst;
+    1b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1b46:	c9                   	leave
+    1b47:	c3                   	ret
+
+0000000000001b48 <strchr>:
+{
+    1b48:	55                   	push   %rbp
+    1b49:	48 89 e5             	mov    %rsp,%rbp
+    1b4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b50:	89 f0                	mov    %esi,%eax
+    1b52:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1b55:	eb 17                	jmp    1b6e <strchr+0x26>
+    if(*s == c)
+    1b57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b5b:	0f b6 00             	movzbl (%rax),%eax
+    1b5e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1b61:	75 06                	jne    1b69 <strchr+0x21>
+      return (char*)s;
+    1b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b67:	eb 15                	jmp    1b7e <strchr+0x36>
+  for(; *s; s++)
+    1b69:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b72:	0f b6 00             	movzbl (%rax),%eax
+    1b75:	84 c0                	test   %al,%al
+    1b77:	75 de                	jne    1b57 <strchr+0xf>
+  return 0;
+    1b79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1b7e:	5d                   	pop    %rbp
+    1b7f:	c3                   	ret
+
+0000000000001b80 <gets>:
+gets(char *buf, int max)
+{
+    1b80:	55                   	push   %rbp
+    1b81:	48 89 e5             	mov    %rsp,%rbp
+    1b84:	48 83 ec 20          	sub    $0x20,%rsp
+    1b88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b8c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    1b8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1b96:	eb 48                	jmp    1be0 <gets+0x60>
+    cc = read(0, &c, 1);
+    1b98:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1b9c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1ba1:	48 89 c6             	mov    %rax,%rsi
+    1ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ba9:	e8 6f 01 00 00       	call   1d1d <read>
+    1bae:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1bb1:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1bb5:	7e 36                	jle    1bed <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1bb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bba:	8d 50 01             	lea    0x1(%rax),%edx
+    1bbd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1bc0:	48 63 d0             	movslq %eax,%rdx
+    1bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bc7:	48 01 c2             	add    %rax,%rdx
+    1bca:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1bce:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1bd0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1bd4:	3c 0a                	cmp    $0xa,%al
+    1bd6:	74 16                	je     1bee <gets+0x6e>
+    1bd8:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1bdc:	3c 0d                	cmp    $0xd,%al
+    1bde:	74 0e                	je     1bee <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1be0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1be3:	83 c0 01             	add    $0x1,%eax
+    1be6:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1be9:	7f ad                	jg     1b98 <gets+0x18>
+    1beb:	eb 01                	jmp    1bee <gets+0x6e>
+      break;
+    1bed:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1bee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1bf1:	48 63 d0             	movslq %eax,%rdx
+    1bf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bf8:	48 01 d0             	add    %rdx,%rax
+    1bfb:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1bfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1c02:	c9                   	leave
+    1c03:	c3                   	ret
+
+0000000000001c04 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1c04:	55                   	push   %rbp
+    1c05:	48 89 e5             	mov    %rsp,%rbp
+    1c08:	48 83 ec 20          	sub    $0x20,%rsp
+    1c0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c10:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1c14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c18:	be 00 00 00 00       	mov    $0x0,%esi
+    1c1d:	48 89 c7             	mov    %rax,%rdi
+    1c20:	e8 20 01 00 00       	call   1d45 <open>
+    1c25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1c28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1c2c:	79 07                	jns    1c35 <stat+0x31>
+    return -1;
+    1c2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1c33:	eb 21                	jmp    1c56 <stat+0x52>
+  r = fstat(fd, st);
+    1c35:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1c39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c3c:	48 89 d6             	mov    %rdx,%rsi
+    1c3f:	89 c7                	mov    %eax,%edi
+    1c41:	e8 17 01 00 00       	call   1d5d <fstat>
+    1c46:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1c49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c4c:	89 c7                	mov    %eax,%edi
+    1c4e:	e8 da 00 00 00       	call   1d2d <close>
+  return r;
+    1c53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1c56:	c9                   	leave
+    1c57:	c3                   	ret
+
+0000000000001c58 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1c58:	55                   	push   %rbp
+    1c59:	48 89 e5             	mov    %rsp,%rbp
+    1c5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1c60:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1c67:	eb 28                	jmp    1c91 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1c69:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1c6c:	89 d0                	mov    %edx,%eax
+    1c6e:	c1 e0 02             	shl    $0x2,%eax
+    1c71:	01 d0                	add    %edx,%eax
+    1c73:	01 c0                	add    %eax,%eax
+    1c75:	89 c1                	mov    %eax,%ecx
+    1c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c7b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1c7f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1c83:	0f b6 00             	movzbl (%rax),%eax
+    1c86:	0f be c0             	movsbl %al,%eax
+    1c89:	01 c8                	add    %ecx,%eax
+    1c8b:	83 e8 30             	sub    $0x30,%eax
+    1c8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c95:	0f b6 00             	movzbl (%rax),%eax
+    1c98:	3c 2f                	cmp    $0x2f,%al
+    1c9a:	7e 0b                	jle    1ca7 <atoi+0x4f>
+    1c9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca0:	0f b6 00             	movzbl (%rax),%eax
+    1ca3:	3c 39                	cmp    $0x39,%al
+    1ca5:	7e c2                	jle    1c69 <atoi+0x11>
+  return n;
+    1ca7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1caa:	5d                   	pop    %rbp
+    1cab:	c3                   	ret
+
+0000000000001cac <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1cac:	55                   	push   %rbp
+    1cad:	48 89 e5             	mov    %rsp,%rbp
+    1cb0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cb4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1cb8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1cbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cbf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1cc3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1cc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1ccb:	eb 1d                	jmp    1cea <memmove+0x3e>
+    *dst++ = *src++;
+    1ccd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1cd1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1cd5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1cd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cdd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1ce1:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1ce5:	0f b6 12             	movzbl (%rdx),%edx
+    1ce8:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1cea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1ced:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1cf0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1cf3:	85 c0                	test   %eax,%eax
+    1cf5:	7f d6                	jg     1ccd <memmove+0x21>
+  return vdst;
+    1cf7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cfb:	5d                   	pop    %rbp
+    1cfc:	c3                   	ret
+
+0000000000001cfd <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1cfd:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d02:	cd 40                	int    $0x40
+    1d04:	c3                   	ret
+
+0000000000001d05 <exit>:
+SYSCALL(exit)
+    1d05:	b8 02 00 00 00       	mov    $0x2,%eax
+    1d0a:	cd 40                	int    $0x40
+    1d0c:	c3                   	ret
+
+0000000000001d0d <wait>:
+SYSCALL(wait)
+    1d0d:	b8 03 00 00 00       	mov    $0x3,%eax
+    1d12:	cd 40                	int    $0x40
+    1d14:	c3                   	ret
+
+0000000000001d15 <pipe>:
+SYSCALL(pipe)
+    1d15:	b8 04 00 00 00       	mov    $0x4,%eax
+    1d1a:	cd 40                	int    $0x40
+    1d1c:	c3                   	ret
+
+0000000000001d1d <read>:
+SYSCALL(read)
+    1d1d:	b8 05 00 00 00       	mov    $0x5,%eax
+    1d22:	cd 40                	int    $0x40
+    1d24:	c3                   	ret
+
+0000000000001d25 <write>:
+SYSCALL(write)
+    1d25:	b8 10 00 00 00       	mov    $0x10,%eax
+    1d2a:	cd 40                	int    $0x40
+    1d2c:	c3                   	ret
+
+0000000000001d2d <close>:
+SYSCALL(close)
+    1d2d:	b8 15 00 00 00       	mov    $0x15,%eax
+    1d32:	cd 40                	int    $0x40
+    1d34:	c3                   	ret
+
+0000000000001d35 <kill>:
+SYSCALL(kill)
+    1d35:	b8 06 00 00 00       	mov    $0x6,%eax
+    1d3a:	cd 40                	int    $0x40
+    1d3c:	c3                   	ret
+
+0000000000001d3d <exec>:
+SYSCALL(exec)
+    1d3d:	b8 07 00 00 00       	mov    $0x7,%eax
+    1d42:	cd 40                	int    $0x40
+    1d44:	c3                   	ret
+
+0000000000001d45 <open>:
+SYSCALL(open)
+    1d45:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1d4a:	cd 40                	int    $0x40
+    1d4c:	c3                   	ret
+
+0000000000001d4d <mknod>:
+SYSCALL(mknod)
+    1d4d:	b8 11 00 00 00       	mov    $0x11,%eax
+    1d52:	cd 40                	int    $0x40
+    1d54:	c3                   	ret
+
+0000000000001d55 <unlink>:
+SYSCALL(unlink)
+    1d55:	b8 12 00 00 00       	mov    $0x12,%eax
+    1d5a:	cd 40                	int    $0x40
+    1d5c:	c3                   	ret
+
+0000000000001d5d <fstat>:
+SYSCALL(fstat)
+    1d5d:	b8 08 00 00 00       	mov    $0x8,%eax
+    1d62:	cd 40                	int    $0x40
+    1d64:	c3                   	ret
+
+0000000000001d65 <link>:
+SYSCALL(link)
+    1d65:	b8 13 00 00 00       	mov    $0x13,%eax
+    1d6a:	cd 40                	int    $0x40
+    1d6c:	c3                   	ret
+
+0000000000001d6d <mkdir>:
+SYSCALL(mkdir)
+    1d6d:	b8 14 00 00 00       	mov    $0x14,%eax
+    1d72:	cd 40                	int    $0x40
+    1d74:	c3                   	ret
+
+0000000000001d75 <chdir>:
+SYSCALL(chdir)
+    1d75:	b8 09 00 00 00       	mov    $0x9,%eax
+    1d7a:	cd 40                	int    $0x40
+    1d7c:	c3                   	ret
+
+0000000000001d7d <dup>:
+SYSCALL(dup)
+    1d7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1d82:	cd 40                	int    $0x40
+    1d84:	c3                   	ret
+
+0000000000001d85 <getpid>:
+SYSCALL(getpid)
+    1d85:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1d8a:	cd 40                	int    $0x40
+    1d8c:	c3                   	ret
+
+0000000000001d8d <sbrk>:
+SYSCALL(sbrk)
+    1d8d:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1d92:	cd 40                	int    $0x40
+    1d94:	c3                   	ret
+
+0000000000001d95 <sleep>:
+SYSCALL(sleep)
+    1d95:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1d9a:	cd 40                	int    $0x40
+    1d9c:	c3                   	ret
+
+0000000000001d9d <uptime>:
+SYSCALL(uptime)
+    1d9d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1da2:	cd 40                	int    $0x40
+    1da4:	c3                   	ret
+
+0000000000001da5 <sysinfo>:
+SYSCALL(sysinfo)
+    1da5:	b8 16 00 00 00       	mov    $0x16,%eax
+    1daa:	cd 40                	int    $0x40
+    1dac:	c3                   	ret
+
+0000000000001dad <mmap>:
+SYSCALL(mmap)
+    1dad:	b8 17 00 00 00       	mov    $0x17,%eax
+    1db2:	cd 40                	int    $0x40
+    1db4:	c3                   	ret
+
+0000000000001db5 <munmap>:
+SYSCALL(munmap)
+    1db5:	b8 18 00 00 00       	mov    $0x18,%eax
+    1dba:	cd 40                	int    $0x40
+    1dbc:	c3                   	ret
+
+0000000000001dbd <crashn>:
+SYSCALL(crashn)
+    1dbd:	b8 19 00 00 00       	mov    $0x19,%eax
+    1dc2:	cd 40                	int    $0x40
+    1dc4:	c3                   	ret
+
+0000000000001dc5 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1dc5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1dca:	cd 40                	int    $0x40
+    1dcc:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1dcf:	74 02                	je     1dd3 <mmap2+0xe>
+    1dd1:	89 c0                	mov    %eax,%eax
+    1dd3:	c3                   	ret
+
+0000000000001dd4 <munmap2>:
+SYSCALL(munmap2)
+    1dd4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1dd9:	cd 40                	int    $0x40
+    1ddb:	c3                   	ret
+
+0000000000001ddc <msync>:
+SYSCALL(msync)
+    1ddc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1de1:	cd 40                	int    $0x40
+    1de3:	c3                   	ret
+
+0000000000001de4 <sendfile>:
+SYSCALL(sendfile)
+    1de4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1de9:	cd 40                	int    $0x40
+    1deb:	c3                   	ret
+
+0000000000001dec <splice>:
+SYSCALL(splice)
+    1dec:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1df1:	cd 40                	int    $0x40
+    1df3:	c3                   	ret
+
+0000000000001df4 <pread>:
+SYSCALL(pread)
+    1df4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1df9:	cd 40                	int    $0x40
+    1dfb:	c3                   	ret
+
+0000000000001dfc <pwrite>:
+SYSCALL(pwrite)
+    1dfc:	b8 20 00 00 00       	mov    $0x20,%eax
+    1e01:	cd 40                	int    $0x40
+    1e03:	c3                   	ret
+
+0000000000001e04 <readv>:
+SYSCALL(readv)
+    1e04:	b8 21 00 00 00       	mov    $0x21,%eax
+    1e09:	cd 40                	int    $0x40
+    1e0b:	c3                   	ret
+
+0000000000001e0c <writev>:
+SYSCALL(writev)
+    1e0c:	b8 22 00 00 00       	mov    $0x22,%eax
+    1e11:	cd 40                	int    $0x40
+    1e13:	c3                   	ret
+
+0000000000001e14 <poll>:
+SYSCALL(poll)
+    1e14:	b8 23 00 00 00       	mov    $0x23,%eax
+    1e19:	cd 40                	int    $0x40
+    1e1b:	c3                   	ret
+
+0000000000001e1c <pipe2>:
+SYSCALL(pipe2)
+    1e1c:	b8 24 00 00 00       	mov    $0x24,%eax
+    1e21:	cd 40                	int    $0x40
+    1e23:	c3                   	ret
+
+0000000000001e24 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1e24:	55                   	push   %rbp
+    1e25:	48 89 e5             	mov    %rsp,%rbp
+    1e28:	48 83 ec 20          	sub    $0x20,%rsp
+    1e2c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1e30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1e34:	48 83 e8 10          	sub    $0x10,%rax
+    1e38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1e3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e40:	48 8b 10             	mov    (%rax),%rdx
+    1e43:	48 8d 05 56 0a 00 00 	lea    0xa56(%rip),%rax        # 28a0 <bigblock>
+    1e4a:	48 39 c2             	cmp    %rax,%rdx
+    1e4d:	75 1f                	jne    1e6e <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1e4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e53:	8b 40 08             	mov    0x8(%rax),%eax
+    1e56:	c1 e0 04             	shl    $0x4,%eax
+    1e59:	89 c2                	mov    %eax,%edx
+    1e5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e5f:	89 d6                	mov    %edx,%esi
+    1e61:	48 89 c7             	mov    %rax,%rdi
+    1e64:	e8 6b ff ff ff       	call   1dd4 <munmap2>
+    return;
+    1e69:	e9 0b 01 00 00       	jmp    1f79 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1e6e:	48 8b 05 1b 0a 00 00 	mov    0xa1b(%rip),%rax        # 2890 <freep>
+    1e75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1e79:	eb 2f                	jmp    1eaa <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1e7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e7f:	48 8b 00             	mov    (%rax),%rax
+    1e82:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1e86:	72 17                	jb     1e9f <free+0x7b>
+    1e88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e8c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1e90:	72 2f                	jb     1ec1 <free+0x9d>
+    1e92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e96:	48 8b 00             	mov    (%rax),%rax
+    1e99:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1e9d:	72 22                	jb     1ec1 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1e9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ea3:	48 8b 00             	mov    (%rax),%rax
+    1ea6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1eaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1eae:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1eb2:	73 c7                	jae    1e7b <free+0x57>
+    1eb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eb8:	48 8b 00             	mov    (%rax),%rax
+    1ebb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1ebf:	73 ba                	jae    1e7b <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1ec1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ec5:	8b 40 08             	mov    0x8(%rax),%eax
+    1ec8:	89 c0                	mov    %eax,%eax
+    1eca:	48 c1 e0 04          	shl    $0x4,%rax
+    1ece:	48 89 c2             	mov    %rax,%rdx
+    1ed1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ed5:	48 01 c2             	add    %rax,%rdx
+    1ed8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1edc:	48 8b 00             	mov    (%rax),%rax
+    1edf:	48 39 c2             	cmp    %rax,%rdx
+    1ee2:	75 2d                	jne    1f11 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1ee4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ee8:	8b 50 08             	mov    0x8(%rax),%edx
+    1eeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eef:	48 8b 00             	mov    (%rax),%rax
+    1ef2:	8b 40 08             	mov    0x8(%rax),%eax
+    1ef5:	01 c2                	add    %eax,%edx
+    1ef7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1efb:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1efe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f02:	48 8b 00             	mov    (%rax),%rax
+    1f05:	48 8b 10             	mov    (%rax),%rdx
+    1f08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f0c:	48 89 10             	mov    %rdx,(%rax)
+    1f0f:	eb 0e                	jmp    1f1f <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1f11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f15:	48 8b 10             	mov    (%rax),%rdx
+    1f18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f1c:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1f1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f23:	8b 40 08             	mov    0x8(%rax),%eax
+    1f26:	89 c0                	mov    %eax,%eax
+    1f28:	48 c1 e0 04          	shl    $0x4,%rax
+    1f2c:	48 89 c2             	mov    %rax,%rdx
+    1f2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f33:	48 01 d0             	add    %rdx,%rax
+    1f36:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1f3a:	75 27                	jne    1f63 <free+0x13f>
+    p->s.size += bp->s.size;
+    1f3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f40:	8b 50 08             	mov    0x8(%rax),%edx
+    1f43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f47:	8b 40 08             	mov    0x8(%rax),%eax
+    1f4a:	01 c2                	add    %eax,%edx
+    1f4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f50:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1f53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f57:	48 8b 10             	mov    (%rax),%rdx
+    1f5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5e:	48 89 10             	mov    %rdx,(%rax)
+    1f61:	eb 0b                	jmp    1f6e <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1f63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f67:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1f6b:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1f6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f72:	48 89 05 17 09 00 00 	mov    %rax,0x917(%rip)        # 2890 <freep>
+}
+    1f79:	c9                   	leave
+    1f7a:	c3                   	ret
+
+0000000000001f7b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1f7b:	55                   	push   %rbp
+    1f7c:	48 89 e5             	mov    %rsp,%rbp
+    1f7f:	48 83 ec 20          	sub    $0x20,%rsp
+    1f83:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1f86:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1f8d:	77 07                	ja     1f96 <morecore+0x1b>
+    nu = 4096;
+    1f8f:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1f96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f99:	c1 e0 04             	shl    $0x4,%eax
+    1f9c:	89 c7                	mov    %eax,%edi
+    1f9e:	e8 ea fd ff ff       	call   1d8d <sbrk>
+    1fa3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1fa7:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1fac:	75 07                	jne    1fb5 <morecore+0x3a>
+    return 0;
+    1fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb3:	eb 29                	jmp    1fde <morecore+0x63>
+  hp = (Header*)p;
+    1fb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1fbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fc1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1fc4:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1fc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fcb:	48 83 c0 10          	add    $0x10,%rax
+    1fcf:	48 89 c7             	mov    %rax,%rdi
+    1fd2:	e8 4d fe ff ff       	call   1e24 <free>
+  return freep;
+    1fd7:	48 8b 05 b2 08 00 00 	mov    0x8b2(%rip),%rax        # 2890 <freep>
+}
+    1fde:	c9                   	leave
+    1fdf:	c3                   	ret
+
+0000000000001fe0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1fe0:	55                   	push   %rbp
+    1fe1:	48 89 e5             	mov    %rsp,%rbp
+    1fe4:	48 83 ec 30          	sub    $0x30,%rsp
+    1fe8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1feb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1fee:	48 83 c0 0f          	add    $0xf,%rax
+    1ff2:	48 c1 e8 04          	shr    $0x4,%rax
+    1ff6:	83 c0 01             	add    $0x1,%eax
+    1ff9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1ffc:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    2003:	76 62                	jbe    2067 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    2005:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    2008:	c1 e0 04             	shl    $0x4,%eax
+    200b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    2011:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    2017:	b9 22 00 00 00       	mov    $0x22,%ecx
+    201c:	ba 03 00 00 00       	mov    $0x3,%edx
+    2021:	89 c6                	mov    %eax,%esi
+    2023:	bf 00 00 00 00       	mov    $0x0,%edi
+    2028:	e8 98 fd ff ff       	call   1dc5 <mmap2>
+    202d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    2031:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2036:	75 0a                	jne    2042 <malloc+0x62>
+      return 0;
+    2038:	b8 00 00 00 00       	mov    $0x0,%eax
+    203d:	e9 1c 01 00 00       	jmp    215e <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    2042:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2046:	48 8d 15 53 08 00 00 	lea    0x853(%rip),%rdx        # 28a0 <bigblock>
+    204d:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    2050:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2054:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2057:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    205a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    205e:	48 83 c0 10          	add    $0x10,%rax
+    2062:	e9 f7 00 00 00       	jmp    215e <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    2067:	48 8b 05 22 08 00 00 	mov    0x822(%rip),%rax        # 2890 <freep>
+    206e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2072:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2077:	75 2e                	jne    20a7 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    2079:	48 8d 05 00 08 00 00 	lea    0x800(%rip),%rax        # 2880 <base>
+    2080:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2084:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2088:	48 89 05 01 08 00 00 	mov    %rax,0x801(%rip)        # 2890 <freep>
+    208f:	48 8b 05 fa 07 00 00 	mov    0x7fa(%rip),%rax        # 2890 <freep>
+    2096:	48 89 05 e3 07 00 00 	mov    %rax,0x7e3(%rip)        # 2880 <base>
+    base.s.size = 0;
+    209d:	c7 05 e1 07 00 00 00 	movl   $0x0,0x7e1(%rip)        # 2888 <base+0x8>
+    20a4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    20a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20ab:	48 8b 00             	mov    (%rax),%rax
+    20ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    20b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20b6:	8b 40 08             	mov    0x8(%rax),%eax
+    20b9:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    20bc:	72 5f                	jb     211d <malloc+0x13d>
+      if(p->s.size == nunits)
+    20be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20c2:	8b 40 08             	mov    0x8(%rax),%eax
+    20c5:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    20c8:	75 10                	jne    20da <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    20ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20ce:	48 8b 10             	mov    (%rax),%rdx
+    20d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20d5:	48 89 10             	mov    %rdx,(%rax)
+    20d8:	eb 2e                	jmp    2108 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    20da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20de:	8b 40 08             	mov    0x8(%rax),%eax
+    20e1:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    20e4:	89 c2                	mov    %eax,%edx
+    20e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20ea:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    20ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    20f1:	8b 40 08             	mov    0x8(%rax),%eax
+    20f4:	89 c0                	mov    %eax,%eax
+    20f6:	48 c1 e0 04          	shl    $0x4,%rax
+    20fa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    20fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2102:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2105:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    2108:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    210c:	48 89 05 7d 07 00 00 	mov    %rax,0x77d(%rip)        # 2890 <freep>
+      return (void*)(p + 1);
+    2113:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2117:	48 83 c0 10          	add    $0x10,%rax
+    211b:	eb 41                	jmp    215e <malloc+0x17e>
+    }
+    if(p == freep)
+    211d:	48 8b 05 6c 07 00 00 	mov    0x76c(%rip),%rax        # 2890 <freep>
+    2124:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2128:	75 1c                	jne    2146 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    212a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    212d:	89 c7                	mov    %eax,%edi
+    212f:	e8 47 fe ff ff       	call   1f7b <morecore>
+    2134:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2138:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    213d:	75 07                	jne    2146 <malloc+0x166>
+        return 0;
+    213f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2144:	eb 18                	jmp    215e <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2146:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    214a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    214e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2152:	48 8b 00             	mov    (%rax),%rax
+    2155:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    2159:	e9 54 ff ff ff       	jmp    20b2 <malloc+0xd2>
+  }
+}
+    215e:	c9                   	leave
+    215f:	c3                   	ret
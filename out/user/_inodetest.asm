@@ -0,0 +1,2374 @@
+
+out/user/_inodetest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <filename>:
+uint inums[NFILES];
+char name[8];
+
+char*
+filename(char c, int i)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	89 f8                	mov    %edi,%eax
+       6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+       9:	88 45 fc             	mov    %al,-0x4(%rbp)
+  name[0] = c;
+       c:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+      10:	88 05 7a 23 00 00    	mov    %al,0x237a(%rip)        # 2390 <name>
+  name[1] = '0' + i / 100;
+      16:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      19:	48 63 d0             	movslq %eax,%rdx
+      1c:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+      23:	48 c1 ea 20          	shr    $0x20,%rdx
+      27:	c1 fa 05             	sar    $0x5,%edx
+      2a:	c1 f8 1f             	sar    $0x1f,%eax
+      2d:	29 c2                	sub    %eax,%edx
+      2f:	89 d0                	mov    %edx,%eax
+      31:	83 c0 30             	add    $0x30,%eax
+      34:	88 05 57 23 00 00    	mov    %al,0x2357(%rip)        # 2391 <name+0x1>
+  name[2] = '0' + i / 10 % 10;
+      3a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      3d:	48 63 d0             	movslq %eax,%rdx
+      40:	48 69 d2 67 66 66 66 	imul   $0x66666667,%rdx,%rdx
+      47:	48 c1 ea 20          	shr    $0x20,%rdx
+      4b:	c1 fa 02             	sar    $0x2,%edx
+      4e:	c1 f8 1f             	sar    $0x1f,%eax
+      51:	89 d1                	mov    %edx,%ecx
+      53:	29 c1                	sub    %eax,%ecx
+      55:	48 63 c1             	movslq %ecx,%rax
+      58:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+      5f:	48 c1 e8 20          	shr    $0x20,%rax
+      63:	89 c2                	mov    %eax,%edx
+      65:	c1 fa 02             	sar    $0x2,%edx
+      68:	89 c8                	mov    %ecx,%eax
+      6a:	c1 f8 1f             	sar    $0x1f,%eax
+      6d:	29 c2                	sub    %eax,%edx
+      6f:	89 d0                	mov    %edx,%eax
+      71:	c1 e0 02             	shl    $0x2,%eax
+      74:	01 d0                	add    %edx,%eax
+      76:	01 c0                	add    %eax,%eax
+      78:	29 c1                	sub    %eax,%ecx
+      7a:	89 ca                	mov    %ecx,%edx
+      7c:	89 d0                	mov    %edx,%eax
+      7e:	83 c0 30             	add    $0x30,%eax
+      81:	88 05 0b 23 00 00    	mov    %al,0x230b(%rip)        # 2392 <name+0x2>
+  name[3] = '0' + i % 10;
+      87:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+      8a:	48 63 c1             	movslq %ecx,%rax
+      8d:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+      94:	48 c1 e8 20          	shr    $0x20,%rax
+      98:	89 c2                	mov    %eax,%edx
+      9a:	c1 fa 02             	sar    $0x2,%edx
+      9d:	89 c8                	mov    %ecx,%eax
+      9f:	c1 f8 1f             	sar    $0x1f,%eax
+      a2:	29 c2                	sub    %eax,%edx
+      a4:	89 d0                	mov    %edx,%eax
+      a6:	c1 e0 02             	shl    $0x2,%eax
+      a9:	01 d0                	add    %edx,%eax
+      ab:	01 c0                	add    %eax,%eax
+      ad:	29 c1                	sub    %eax,%ecx
+      af:	89 ca                	mov    %ecx,%edx
+      b1:	89 d0                	mov    %edx,%eax
+      b3:	83 c0 30             	add    $0x30,%eax
+      b6:	88 05 d7 22 00 00    	mov    %al,0x22d7(%rip)        # 2393 <name+0x3>
+  name[4] = 0;
+      bc:	c6 05 d1 22 00 00 00 	movb   $0x0,0x22d1(%rip)        # 2394 <name+0x4>
+  return name;
+      c3:	48 8d 05 c6 22 00 00 	lea    0x22c6(%rip),%rax        # 2390 <name>
+}
+      ca:	5d                   	pop    %rbp
+      cb:	c3                   	ret
+
+00000000000000cc <create>:
+
+// Create name holding i, returning its inum.
+uint
+create(char *name, int i)
+{
+      cc:	55                   	push   %rbp
+      cd:	48 89 e5             	mov    %rsp,%rbp
+      d0:	48 83 ec 30          	sub    $0x30,%rsp
+      d4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+      d8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  struct stat st;
+  int fd;
+
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+      db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      df:	be 02 02 00 00       	mov    $0x202,%esi
+      e4:	48 89 c7             	mov    %rax,%rdi
+      e7:	e8 8a 13 00 00       	call   1476 <open>
+      ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      f3:	79 60                	jns    155 <create+0x89>
+    error("unable to create %s", name);
+      f5:	8b 05 45 1d 00 00    	mov    0x1d45(%rip),%eax        # 1e40 <stdout>
+      fb:	ba 28 00 00 00       	mov    $0x28,%edx
+     100:	48 8d 0d 91 17 00 00 	lea    0x1791(%rip),%rcx        # 1898 <malloc+0x187>
+     107:	48 89 ce             	mov    %rcx,%rsi
+     10a:	89 c7                	mov    %eax,%edi
+     10c:	b8 00 00 00 00       	mov    $0x0,%eax
+     111:	e8 79 0d 00 00       	call   e8f <printf>
+     116:	8b 05 24 1d 00 00    	mov    0x1d24(%rip),%eax        # 1e40 <stdout>
+     11c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     120:	48 8d 0d 83 17 00 00 	lea    0x1783(%rip),%rcx        # 18aa <malloc+0x199>
+     127:	48 89 ce             	mov    %rcx,%rsi
+     12a:	89 c7                	mov    %eax,%edi
+     12c:	b8 00 00 00 00       	mov    $0x0,%eax
+     131:	e8 59 0d 00 00       	call   e8f <printf>
+     136:	8b 05 04 1d 00 00    	mov    0x1d04(%rip),%eax        # 1e40 <stdout>
+     13c:	48 8d 15 7b 17 00 00 	lea    0x177b(%rip),%rdx        # 18be <malloc+0x1ad>
+     143:	48 89 d6             	mov    %rdx,%rsi
+     146:	89 c7                	mov    %eax,%edi
+     148:	b8 00 00 00 00       	mov    $0x0,%eax
+     14d:	e8 3d 0d 00 00       	call   e8f <printf>
+     152:	90                   	nop
+     153:	eb fd                	jmp    152 <create+0x86>
+  if(write(fd, &i, sizeof(i)) != sizeof(i))
+     155:	48 8d 4d d4          	lea    -0x2c(%rbp),%rcx
+     159:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     15c:	ba 04 00 00 00       	mov    $0x4,%edx
+     161:	48 89 ce             	mov    %rcx,%rsi
+     164:	89 c7                	mov    %eax,%edi
+     166:	e8 eb 12 00 00       	call   1456 <write>
+     16b:	83 f8 04             	cmp    $0x4,%eax
+     16e:	74 60                	je     1d0 <create+0x104>
+    error("unable to write %s", name);
+     170:	8b 05 ca 1c 00 00    	mov    0x1cca(%rip),%eax        # 1e40 <stdout>
+     176:	ba 2a 00 00 00       	mov    $0x2a,%edx
+     17b:	48 8d 0d 16 17 00 00 	lea    0x1716(%rip),%rcx        # 1898 <malloc+0x187>
+     182:	48 89 ce             	mov    %rcx,%rsi
+     185:	89 c7                	mov    %eax,%edi
+     187:	b8 00 00 00 00       	mov    $0x0,%eax
+     18c:	e8 fe 0c 00 00       	call   e8f <printf>
+     191:	8b 05 a9 1c 00 00    	mov    0x1ca9(%rip),%eax        # 1e40 <stdout>
+     197:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     19b:	48 8d 0d 1e 17 00 00 	lea    0x171e(%rip),%rcx        # 18c0 <malloc+0x1af>
+     1a2:	48 89 ce             	mov    %rcx,%rsi
+     1a5:	89 c7                	mov    %eax,%edi
+     1a7:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ac:	e8 de 0c 00 00       	call   e8f <printf>
+     1b1:	8b 05 89 1c 00 00    	mov    0x1c89(%rip),%eax        # 1e40 <stdout>
+     1b7:	48 8d 15 00 17 00 00 	lea    0x1700(%rip),%rdx        # 18be <malloc+0x1ad>
+     1be:	48 89 d6             	mov    %rdx,%rsi
+     1c1:	89 c7                	mov    %eax,%edi
+     1c3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c8:	e8 c2 0c 00 00       	call   e8f <printf>
+     1cd:	90                   	nop
+     1ce:	eb fd                	jmp    1cd <create+0x101>
+  fstat(fd, &st);
+     1d0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+     1d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1d7:	48 89 d6             	mov    %rdx,%rsi
+     1da:	89 c7                	mov    %eax,%edi
+     1dc:	e8 ad 12 00 00       	call   148e <fstat>
+  close(fd);
+     1e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1e4:	89 c7                	mov    %eax,%edi
+     1e6:	e8 73 12 00 00       	call   145e <close>
+  return st.ino;
+     1eb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+00000000000001f0 <holds>:
+
+// Return 1 if name holds just i.
+int
+holds(char *name, int i)
+{
+     1f0:	55                   	push   %rbp
+     1f1:	48 89 e5             	mov    %rsp,%rbp
+     1f4:	48 83 ec 20          	sub    $0x20,%rsp
+     1f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     1fc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int fd, n, v[2];
+
+  if((fd = open(name, O_RDONLY)) < 0)
+     1ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     203:	be 00 00 00 00       	mov    $0x0,%esi
+     208:	48 89 c7             	mov    %rax,%rdi
+     20b:	e8 66 12 00 00       	call   1476 <open>
+     210:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     213:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     217:	79 60                	jns    279 <holds+0x89>
+    error("unable to open %s", name);
+     219:	8b 05 21 1c 00 00    	mov    0x1c21(%rip),%eax        # 1e40 <stdout>
+     21f:	ba 37 00 00 00       	mov    $0x37,%edx
+     224:	48 8d 0d 6d 16 00 00 	lea    0x166d(%rip),%rcx        # 1898 <malloc+0x187>
+     22b:	48 89 ce             	mov    %rcx,%rsi
+     22e:	89 c7                	mov    %eax,%edi
+     230:	b8 00 00 00 00       	mov    $0x0,%eax
+     235:	e8 55 0c 00 00       	call   e8f <printf>
+     23a:	8b 05 00 1c 00 00    	mov    0x1c00(%rip),%eax        # 1e40 <stdout>
+     240:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     244:	48 8d 0d 88 16 00 00 	lea    0x1688(%rip),%rcx        # 18d3 <malloc+0x1c2>
+     24b:	48 89 ce             	mov    %rcx,%rsi
+     24e:	89 c7                	mov    %eax,%edi
+     250:	b8 00 00 00 00       	mov    $0x0,%eax
+     255:	e8 35 0c 00 00       	call   e8f <printf>
+     25a:	8b 05 e0 1b 00 00    	mov    0x1be0(%rip),%eax        # 1e40 <stdout>
+     260:	48 8d 15 57 16 00 00 	lea    0x1657(%rip),%rdx        # 18be <malloc+0x1ad>
+     267:	48 89 d6             	mov    %rdx,%rsi
+     26a:	89 c7                	mov    %eax,%edi
+     26c:	b8 00 00 00 00       	mov    $0x0,%eax
+     271:	e8 19 0c 00 00       	call   e8f <printf>
+     276:	90                   	nop
+     277:	eb fd                	jmp    276 <holds+0x86>
+  n = read(fd, v, sizeof(v));
+     279:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+     27d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     280:	ba 08 00 00 00       	mov    $0x8,%edx
+     285:	48 89 ce             	mov    %rcx,%rsi
+     288:	89 c7                	mov    %eax,%edi
+     28a:	e8 bf 11 00 00       	call   144e <read>
+     28f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     292:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     295:	89 c7                	mov    %eax,%edi
+     297:	e8 c2 11 00 00       	call   145e <close>
+  return n == sizeof(int) && v[0] == i;
+     29c:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+     2a0:	75 0f                	jne    2b1 <holds+0xc1>
+     2a2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     2a5:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     2a8:	75 07                	jne    2b1 <holds+0xc1>
+     2aa:	b8 01 00 00 00       	mov    $0x1,%eax
+     2af:	eb 05                	jmp    2b6 <holds+0xc6>
+     2b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2b6:	c9                   	leave
+     2b7:	c3                   	ret
+
+00000000000002b8 <growtest>:
+
+// The inodefile grows to take many new files, each with an inum of
+// its own.
+void
+growtest(void)
+{
+     2b8:	55                   	push   %rbp
+     2b9:	48 89 e5             	mov    %rsp,%rbp
+     2bc:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, j;
+
+  printf(stdout, "growtest\n");
+     2c0:	8b 05 7a 1b 00 00    	mov    0x1b7a(%rip),%eax        # 1e40 <stdout>
+     2c6:	48 8d 15 18 16 00 00 	lea    0x1618(%rip),%rdx        # 18e5 <malloc+0x1d4>
+     2cd:	48 89 d6             	mov    %rdx,%rsi
+     2d0:	89 c7                	mov    %eax,%edi
+     2d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d7:	e8 b3 0b 00 00       	call   e8f <printf>
+  for(i = 0; i < NFILES; i++){
+     2dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2e3:	e9 02 01 00 00       	jmp    3ea <growtest+0x132>
+    inums[i] = create(filename('i', i), i);
+     2e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2eb:	89 c6                	mov    %eax,%esi
+     2ed:	bf 69 00 00 00       	mov    $0x69,%edi
+     2f2:	e8 09 fd ff ff       	call   0 <filename>
+     2f7:	48 89 c2             	mov    %rax,%rdx
+     2fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2fd:	89 c6                	mov    %eax,%esi
+     2ff:	48 89 d7             	mov    %rdx,%rdi
+     302:	e8 c5 fd ff ff       	call   cc <create>
+     307:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     30a:	48 63 d2             	movslq %edx,%rdx
+     30d:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+     314:	00 
+     315:	48 8d 15 c4 1b 00 00 	lea    0x1bc4(%rip),%rdx        # 1ee0 <inums>
+     31c:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+    for(j = 0; j < i; j++)
+     31f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     326:	e9 af 00 00 00       	jmp    3da <growtest+0x122>
+      if(inums[j] == inums[i])
+     32b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     32e:	48 98                	cltq
+     330:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     337:	00 
+     338:	48 8d 05 a1 1b 00 00 	lea    0x1ba1(%rip),%rax        # 1ee0 <inums>
+     33f:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     342:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     345:	48 98                	cltq
+     347:	48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+     34e:	00 
+     34f:	48 8d 05 8a 1b 00 00 	lea    0x1b8a(%rip),%rax        # 1ee0 <inums>
+     356:	8b 04 01             	mov    (%rcx,%rax,1),%eax
+     359:	39 c2                	cmp    %eax,%edx
+     35b:	75 79                	jne    3d6 <growtest+0x11e>
+        error("i%d and i%d share inum %d", j, i, inums[i]);
+     35d:	8b 05 dd 1a 00 00    	mov    0x1add(%rip),%eax        # 1e40 <stdout>
+     363:	ba 49 00 00 00       	mov    $0x49,%edx
+     368:	48 8d 0d 29 15 00 00 	lea    0x1529(%rip),%rcx        # 1898 <malloc+0x187>
+     36f:	48 89 ce             	mov    %rcx,%rsi
+     372:	89 c7                	mov    %eax,%edi
+     374:	b8 00 00 00 00       	mov    $0x0,%eax
+     379:	e8 11 0b 00 00       	call   e8f <printf>
+     37e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     381:	48 98                	cltq
+     383:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     38a:	00 
+     38b:	48 8d 05 4e 1b 00 00 	lea    0x1b4e(%rip),%rax        # 1ee0 <inums>
+     392:	8b 34 02             	mov    (%rdx,%rax,1),%esi
+     395:	8b 05 a5 1a 00 00    	mov    0x1aa5(%rip),%eax        # 1e40 <stdout>
+     39b:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     39e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     3a1:	41 89 f0             	mov    %esi,%r8d
+     3a4:	48 8d 35 44 15 00 00 	lea    0x1544(%rip),%rsi        # 18ef <malloc+0x1de>
+     3ab:	89 c7                	mov    %eax,%edi
+     3ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b2:	e8 d8 0a 00 00       	call   e8f <printf>
+     3b7:	8b 05 83 1a 00 00    	mov    0x1a83(%rip),%eax        # 1e40 <stdout>
+     3bd:	48 8d 15 fa 14 00 00 	lea    0x14fa(%rip),%rdx        # 18be <malloc+0x1ad>
+     3c4:	48 89 d6             	mov    %rdx,%rsi
+     3c7:	89 c7                	mov    %eax,%edi
+     3c9:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ce:	e8 bc 0a 00 00       	call   e8f <printf>
+     3d3:	90                   	nop
+     3d4:	eb fd                	jmp    3d3 <growtest+0x11b>
+    for(j = 0; j < i; j++)
+     3d6:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     3da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3dd:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+     3e0:	0f 8c 45 ff ff ff    	jl     32b <growtest+0x73>
+  for(i = 0; i < NFILES; i++){
+     3e6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     3ea:	81 7d fc 2b 01 00 00 	cmpl   $0x12b,-0x4(%rbp)
+     3f1:	0f 8e f1 fe ff ff    	jle    2e8 <growtest+0x30>
+  }
+  for(i = 0; i < NFILES; i++)
+     3f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     3fe:	e9 86 00 00 00       	jmp    489 <growtest+0x1d1>
+    if(!holds(filename('i', i), i))
+     403:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     406:	89 c6                	mov    %eax,%esi
+     408:	bf 69 00 00 00       	mov    $0x69,%edi
+     40d:	e8 ee fb ff ff       	call   0 <filename>
+     412:	48 89 c2             	mov    %rax,%rdx
+     415:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     418:	89 c6                	mov    %eax,%esi
+     41a:	48 89 d7             	mov    %rdx,%rdi
+     41d:	e8 ce fd ff ff       	call   1f0 <holds>
+     422:	85 c0                	test   %eax,%eax
+     424:	75 5f                	jne    485 <growtest+0x1cd>
+      error("i%d does not hold %d", i, i);
+     426:	8b 05 14 1a 00 00    	mov    0x1a14(%rip),%eax        # 1e40 <stdout>
+     42c:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     431:	48 8d 0d 60 14 00 00 	lea    0x1460(%rip),%rcx        # 1898 <malloc+0x187>
+     438:	48 89 ce             	mov    %rcx,%rsi
+     43b:	89 c7                	mov    %eax,%edi
+     43d:	b8 00 00 00 00       	mov    $0x0,%eax
+     442:	e8 48 0a 00 00       	call   e8f <printf>
+     447:	8b 05 f3 19 00 00    	mov    0x19f3(%rip),%eax        # 1e40 <stdout>
+     44d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     450:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     453:	48 8d 35 af 14 00 00 	lea    0x14af(%rip),%rsi        # 1909 <malloc+0x1f8>
+     45a:	89 c7                	mov    %eax,%edi
+     45c:	b8 00 00 00 00       	mov    $0x0,%eax
+     461:	e8 29 0a 00 00       	call   e8f <printf>
+     466:	8b 05 d4 19 00 00    	mov    0x19d4(%rip),%eax        # 1e40 <stdout>
+     46c:	48 8d 15 4b 14 00 00 	lea    0x144b(%rip),%rdx        # 18be <malloc+0x1ad>
+     473:	48 89 d6             	mov    %rdx,%rsi
+     476:	89 c7                	mov    %eax,%edi
+     478:	b8 00 00 00 00       	mov    $0x0,%eax
+     47d:	e8 0d 0a 00 00       	call   e8f <printf>
+     482:	90                   	nop
+     483:	eb fd                	jmp    482 <growtest+0x1ca>
+  for(i = 0; i < NFILES; i++)
+     485:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     489:	81 7d fc 2b 01 00 00 	cmpl   $0x12b,-0x4(%rbp)
+     490:	0f 8e 6d ff ff ff    	jle    403 <growtest+0x14b>
+  printf(stdout, "growtest OK\n");
+     496:	8b 05 a4 19 00 00    	mov    0x19a4(%rip),%eax        # 1e40 <stdout>
+     49c:	48 8d 15 7b 14 00 00 	lea    0x147b(%rip),%rdx        # 191e <malloc+0x20d>
+     4a3:	48 89 d6             	mov    %rdx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 dd 09 00 00       	call   e8f <printf>
+}
+     4b2:	90                   	nop
+     4b3:	c9                   	leave
+     4b4:	c3                   	ret
+
+00000000000004b5 <reusetest>:
+
+// Inums of unlinked files are taken again, lowest first, by new files
+// that start out empty.
+void
+reusetest(void)
+{
+     4b5:	55                   	push   %rbp
+     4b6:	48 89 e5             	mov    %rsp,%rbp
+     4b9:	48 83 ec 30          	sub    $0x30,%rsp
+  struct stat st;
+  uint lowest = ~0, inum;
+     4bd:	c7 45 fc ff ff ff ff 	movl   $0xffffffff,-0x4(%rbp)
+  int i, j, fd;
+  char c;
+
+  printf(stdout, "reusetest\n");
+     4c4:	8b 05 76 19 00 00    	mov    0x1976(%rip),%eax        # 1e40 <stdout>
+     4ca:	48 8d 15 5a 14 00 00 	lea    0x145a(%rip),%rdx        # 192b <malloc+0x21a>
+     4d1:	48 89 d6             	mov    %rdx,%rsi
+     4d4:	89 c7                	mov    %eax,%edi
+     4d6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4db:	e8 af 09 00 00       	call   e8f <printf>
+  for(i = 0; i < NFILES; i += 2){
+     4e0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     4e7:	e9 b4 00 00 00       	jmp    5a0 <reusetest+0xeb>
+    if(unlink(filename('i', i)) < 0)
+     4ec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4ef:	89 c6                	mov    %eax,%esi
+     4f1:	bf 69 00 00 00       	mov    $0x69,%edi
+     4f6:	e8 05 fb ff ff       	call   0 <filename>
+     4fb:	48 89 c7             	mov    %rax,%rdi
+     4fe:	e8 83 0f 00 00       	call   1486 <unlink>
+     503:	85 c0                	test   %eax,%eax
+     505:	79 5f                	jns    566 <reusetest+0xb1>
+      error("unable to unlink i%d", i);
+     507:	8b 05 33 19 00 00    	mov    0x1933(%rip),%eax        # 1e40 <stdout>
+     50d:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     512:	48 8d 0d 7f 13 00 00 	lea    0x137f(%rip),%rcx        # 1898 <malloc+0x187>
+     519:	48 89 ce             	mov    %rcx,%rsi
+     51c:	89 c7                	mov    %eax,%edi
+     51e:	b8 00 00 00 00       	mov    $0x0,%eax
+     523:	e8 67 09 00 00       	call   e8f <printf>
+     528:	8b 05 12 19 00 00    	mov    0x1912(%rip),%eax        # 1e40 <stdout>
+     52e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     531:	48 8d 0d fe 13 00 00 	lea    0x13fe(%rip),%rcx        # 1936 <malloc+0x225>
+     538:	48 89 ce             	mov    %rcx,%rsi
+     53b:	89 c7                	mov    %eax,%edi
+     53d:	b8 00 00 00 00       	mov    $0x0,%eax
+     542:	e8 48 09 00 00       	call   e8f <printf>
+     547:	8b 05 f3 18 00 00    	mov    0x18f3(%rip),%eax        # 1e40 <stdout>
+     54d:	48 8d 15 6a 13 00 00 	lea    0x136a(%rip),%rdx        # 18be <malloc+0x1ad>
+     554:	48 89 d6             	mov    %rdx,%rsi
+     557:	89 c7                	mov    %eax,%edi
+     559:	b8 00 00 00 00       	mov    $0x0,%eax
+     55e:	e8 2c 09 00 00       	call   e8f <printf>
+     563:	90                   	nop
+     564:	eb fd                	jmp    563 <reusetest+0xae>
+    if(inums[i] < lowest)
+     566:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     569:	48 98                	cltq
+     56b:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     572:	00 
+     573:	48 8d 05 66 19 00 00 	lea    0x1966(%rip),%rax        # 1ee0 <inums>
+     57a:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     57d:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+     580:	73 1a                	jae    59c <reusetest+0xe7>
+      lowest = inums[i];
+     582:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     585:	48 98                	cltq
+     587:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     58e:	00 
+     58f:	48 8d 05 4a 19 00 00 	lea    0x194a(%rip),%rax        # 1ee0 <inums>
+     596:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     599:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  for(i = 0; i < NFILES; i += 2){
+     59c:	83 45 f8 02          	addl   $0x2,-0x8(%rbp)
+     5a0:	81 7d f8 2b 01 00 00 	cmpl   $0x12b,-0x8(%rbp)
+     5a7:	0f 8e 3f ff ff ff    	jle    4ec <reusetest+0x37>
+  }
+
+  for(i = 0; i < NFILES; i += 2){
+     5ad:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     5b4:	e9 29 02 00 00       	jmp    7e2 <reusetest+0x32d>
+    if((fd = open(filename('j', i), O_CREATE | O_RDWR)) < 0)
+     5b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     5bc:	89 c6                	mov    %eax,%esi
+     5be:	bf 6a 00 00 00       	mov    $0x6a,%edi
+     5c3:	e8 38 fa ff ff       	call   0 <filename>
+     5c8:	be 02 02 00 00       	mov    $0x202,%esi
+     5cd:	48 89 c7             	mov    %rax,%rdi
+     5d0:	e8 a1 0e 00 00       	call   1476 <open>
+     5d5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     5d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     5dc:	79 5f                	jns    63d <reusetest+0x188>
+      error("unable to create j%d", i);
+     5de:	8b 05 5c 18 00 00    	mov    0x185c(%rip),%eax        # 1e40 <stdout>
+     5e4:	ba 65 00 00 00       	mov    $0x65,%edx
+     5e9:	48 8d 0d a8 12 00 00 	lea    0x12a8(%rip),%rcx        # 1898 <malloc+0x187>
+     5f0:	48 89 ce             	mov    %rcx,%rsi
+     5f3:	89 c7                	mov    %eax,%edi
+     5f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     5fa:	e8 90 08 00 00       	call   e8f <printf>
+     5ff:	8b 05 3b 18 00 00    	mov    0x183b(%rip),%eax        # 1e40 <stdout>
+     605:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     608:	48 8d 0d 3c 13 00 00 	lea    0x133c(%rip),%rcx        # 194b <malloc+0x23a>
+     60f:	48 89 ce             	mov    %rcx,%rsi
+     612:	89 c7                	mov    %eax,%edi
+     614:	b8 00 00 00 00       	mov    $0x0,%eax
+     619:	e8 71 08 00 00       	call   e8f <printf>
+     61e:	8b 05 1c 18 00 00    	mov    0x181c(%rip),%eax        # 1e40 <stdout>
+     624:	48 8d 15 93 12 00 00 	lea    0x1293(%rip),%rdx        # 18be <malloc+0x1ad>
+     62b:	48 89 d6             	mov    %rdx,%rsi
+     62e:	89 c7                	mov    %eax,%edi
+     630:	b8 00 00 00 00       	mov    $0x0,%eax
+     635:	e8 55 08 00 00       	call   e8f <printf>
+     63a:	90                   	nop
+     63b:	eb fd                	jmp    63a <reusetest+0x185>
+    if(read(fd, &c, 1) != 0)
+     63d:	48 8d 4d d7          	lea    -0x29(%rbp),%rcx
+     641:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     644:	ba 01 00 00 00       	mov    $0x1,%edx
+     649:	48 89 ce             	mov    %rcx,%rsi
+     64c:	89 c7                	mov    %eax,%edi
+     64e:	e8 fb 0d 00 00       	call   144e <read>
+     653:	85 c0                	test   %eax,%eax
+     655:	74 5f                	je     6b6 <reusetest+0x201>
+      error("new file j%d has the contents of an old one", i);
+     657:	8b 05 e3 17 00 00    	mov    0x17e3(%rip),%eax        # 1e40 <stdout>
+     65d:	ba 67 00 00 00       	mov    $0x67,%edx
+     662:	48 8d 0d 2f 12 00 00 	lea    0x122f(%rip),%rcx        # 1898 <malloc+0x187>
+     669:	48 89 ce             	mov    %rcx,%rsi
+     66c:	89 c7                	mov    %eax,%edi
+     66e:	b8 00 00 00 00       	mov    $0x0,%eax
+     673:	e8 17 08 00 00       	call   e8f <printf>
+     678:	8b 05 c2 17 00 00    	mov    0x17c2(%rip),%eax        # 1e40 <stdout>
+     67e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     681:	48 8d 0d d8 12 00 00 	lea    0x12d8(%rip),%rcx        # 1960 <malloc+0x24f>
+     688:	48 89 ce             	mov    %rcx,%rsi
+     68b:	89 c7                	mov    %eax,%edi
+     68d:	b8 00 00 00 00       	mov    $0x0,%eax
+     692:	e8 f8 07 00 00       	call   e8f <printf>
+     697:	8b 05 a3 17 00 00    	mov    0x17a3(%rip),%eax        # 1e40 <stdout>
+     69d:	48 8d 15 1a 12 00 00 	lea    0x121a(%rip),%rdx        # 18be <malloc+0x1ad>
+     6a4:	48 89 d6             	mov    %rdx,%rsi
+     6a7:	89 c7                	mov    %eax,%edi
+     6a9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ae:	e8 dc 07 00 00       	call   e8f <printf>
+     6b3:	90                   	nop
+     6b4:	eb fd                	jmp    6b3 <reusetest+0x1fe>
+    fstat(fd, &st);
+     6b6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+     6ba:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     6bd:	48 89 d6             	mov    %rdx,%rsi
+     6c0:	89 c7                	mov    %eax,%edi
+     6c2:	e8 c7 0d 00 00       	call   148e <fstat>
+    close(fd);
+     6c7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     6ca:	89 c7                	mov    %eax,%edi
+     6cc:	e8 8d 0d 00 00       	call   145e <close>
+    inum = st.ino;
+     6d1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     6d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if(i == 0 && inum != lowest)
+     6d7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     6db:	75 67                	jne    744 <reusetest+0x28f>
+     6dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     6e0:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+     6e3:	74 5f                	je     744 <reusetest+0x28f>
+      error("first new file got inum %d, not the lowest free %d", inum, lowest);
+     6e5:	8b 05 55 17 00 00    	mov    0x1755(%rip),%eax        # 1e40 <stdout>
+     6eb:	ba 6c 00 00 00       	mov    $0x6c,%edx
+     6f0:	48 8d 0d a1 11 00 00 	lea    0x11a1(%rip),%rcx        # 1898 <malloc+0x187>
+     6f7:	48 89 ce             	mov    %rcx,%rsi
+     6fa:	89 c7                	mov    %eax,%edi
+     6fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     701:	e8 89 07 00 00       	call   e8f <printf>
+     706:	8b 05 34 17 00 00    	mov    0x1734(%rip),%eax        # 1e40 <stdout>
+     70c:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     70f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     712:	48 8d 35 77 12 00 00 	lea    0x1277(%rip),%rsi        # 1990 <malloc+0x27f>
+     719:	89 c7                	mov    %eax,%edi
+     71b:	b8 00 00 00 00       	mov    $0x0,%eax
+     720:	e8 6a 07 00 00       	call   e8f <printf>
+     725:	8b 05 15 17 00 00    	mov    0x1715(%rip),%eax        # 1e40 <stdout>
+     72b:	48 8d 15 8c 11 00 00 	lea    0x118c(%rip),%rdx        # 18be <malloc+0x1ad>
+     732:	48 89 d6             	mov    %rdx,%rsi
+     735:	89 c7                	mov    %eax,%edi
+     737:	b8 00 00 00 00       	mov    $0x0,%eax
+     73c:	e8 4e 07 00 00       	call   e8f <printf>
+     741:	90                   	nop
+     742:	eb fd                	jmp    741 <reusetest+0x28c>
+    for(j = 0; j < NFILES && inums[j] != inum; j += 2)
+     744:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     74b:	eb 04                	jmp    751 <reusetest+0x29c>
+     74d:	83 45 f4 02          	addl   $0x2,-0xc(%rbp)
+     751:	81 7d f4 2b 01 00 00 	cmpl   $0x12b,-0xc(%rbp)
+     758:	7f 1c                	jg     776 <reusetest+0x2c1>
+     75a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     75d:	48 98                	cltq
+     75f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     766:	00 
+     767:	48 8d 05 72 17 00 00 	lea    0x1772(%rip),%rax        # 1ee0 <inums>
+     76e:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     771:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     774:	75 d7                	jne    74d <reusetest+0x298>
+      ;
+    if(j >= NFILES)
+     776:	81 7d f4 2b 01 00 00 	cmpl   $0x12b,-0xc(%rbp)
+     77d:	7e 5f                	jle    7de <reusetest+0x329>
+      error("j%d got inum %d, which was not freed", i, inum);
+     77f:	8b 05 bb 16 00 00    	mov    0x16bb(%rip),%eax        # 1e40 <stdout>
+     785:	ba 70 00 00 00       	mov    $0x70,%edx
+     78a:	48 8d 0d 07 11 00 00 	lea    0x1107(%rip),%rcx        # 1898 <malloc+0x187>
+     791:	48 89 ce             	mov    %rcx,%rsi
+     794:	89 c7                	mov    %eax,%edi
+     796:	b8 00 00 00 00       	mov    $0x0,%eax
+     79b:	e8 ef 06 00 00       	call   e8f <printf>
+     7a0:	8b 05 9a 16 00 00    	mov    0x169a(%rip),%eax        # 1e40 <stdout>
+     7a6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+     7a9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     7ac:	48 8d 35 15 12 00 00 	lea    0x1215(%rip),%rsi        # 19c8 <malloc+0x2b7>
+     7b3:	89 c7                	mov    %eax,%edi
+     7b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ba:	e8 d0 06 00 00       	call   e8f <printf>
+     7bf:	8b 05 7b 16 00 00    	mov    0x167b(%rip),%eax        # 1e40 <stdout>
+     7c5:	48 8d 15 f2 10 00 00 	lea    0x10f2(%rip),%rdx        # 18be <malloc+0x1ad>
+     7cc:	48 89 d6             	mov    %rdx,%rsi
+     7cf:	89 c7                	mov    %eax,%edi
+     7d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d6:	e8 b4 06 00 00       	call   e8f <printf>
+     7db:	90                   	nop
+     7dc:	eb fd                	jmp    7db <reusetest+0x326>
+  for(i = 0; i < NFILES; i += 2){
+     7de:	83 45 f8 02          	addl   $0x2,-0x8(%rbp)
+     7e2:	81 7d f8 2b 01 00 00 	cmpl   $0x12b,-0x8(%rbp)
+     7e9:	0f 8e ca fd ff ff    	jle    5b9 <reusetest+0x104>
+  }
+
+  // the files left alone are untouched
+  for(i = 1; i < NFILES; i += 2)
+     7ef:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+     7f6:	e9 86 00 00 00       	jmp    881 <reusetest+0x3cc>
+    if(!holds(filename('i', i), i))
+     7fb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     7fe:	89 c6                	mov    %eax,%esi
+     800:	bf 69 00 00 00       	mov    $0x69,%edi
+     805:	e8 f6 f7 ff ff       	call   0 <filename>
+     80a:	48 89 c2             	mov    %rax,%rdx
+     80d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     810:	89 c6                	mov    %eax,%esi
+     812:	48 89 d7             	mov    %rdx,%rdi
+     815:	e8 d6 f9 ff ff       	call   1f0 <holds>
+     81a:	85 c0                	test   %eax,%eax
+     81c:	75 5f                	jne    87d <reusetest+0x3c8>
+      error("i%d does not hold %d", i, i);
+     81e:	8b 05 1c 16 00 00    	mov    0x161c(%rip),%eax        # 1e40 <stdout>
+     824:	ba 76 00 00 00       	mov    $0x76,%edx
+     829:	48 8d 0d 68 10 00 00 	lea    0x1068(%rip),%rcx        # 1898 <malloc+0x187>
+     830:	48 89 ce             	mov    %rcx,%rsi
+     833:	89 c7                	mov    %eax,%edi
+     835:	b8 00 00 00 00       	mov    $0x0,%eax
+     83a:	e8 50 06 00 00       	call   e8f <printf>
+     83f:	8b 05 fb 15 00 00    	mov    0x15fb(%rip),%eax        # 1e40 <stdout>
+     845:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+     848:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     84b:	48 8d 35 b7 10 00 00 	lea    0x10b7(%rip),%rsi        # 1909 <malloc+0x1f8>
+     852:	89 c7                	mov    %eax,%edi
+     854:	b8 00 00 00 00       	mov    $0x0,%eax
+     859:	e8 31 06 00 00       	call   e8f <printf>
+     85e:	8b 05 dc 15 00 00    	mov    0x15dc(%rip),%eax        # 1e40 <stdout>
+     864:	48 8d 15 53 10 00 00 	lea    0x1053(%rip),%rdx        # 18be <malloc+0x1ad>
+     86b:	48 89 d6             	mov    %rdx,%rsi
+     86e:	89 c7                	mov    %eax,%edi
+     870:	b8 00 00 00 00       	mov    $0x0,%eax
+     875:	e8 15 06 00 00       	call   e8f <printf>
+     87a:	90                   	nop
+     87b:	eb fd                	jmp    87a <reusetest+0x3c5>
+  for(i = 1; i < NFILES; i += 2)
+     87d:	83 45 f8 02          	addl   $0x2,-0x8(%rbp)
+     881:	81 7d f8 2b 01 00 00 	cmpl   $0x12b,-0x8(%rbp)
+     888:	0f 8e 6d ff ff ff    	jle    7fb <reusetest+0x346>
+
+  for(i = 0; i < NFILES; i++)
+     88e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     895:	e9 91 00 00 00       	jmp    92b <reusetest+0x476>
+    if(unlink(filename(i % 2 ? 'i' : 'j', i)) < 0)
+     89a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     89d:	83 e0 01             	and    $0x1,%eax
+     8a0:	85 c0                	test   %eax,%eax
+     8a2:	74 07                	je     8ab <reusetest+0x3f6>
+     8a4:	ba 69 00 00 00       	mov    $0x69,%edx
+     8a9:	eb 05                	jmp    8b0 <reusetest+0x3fb>
+     8ab:	ba 6a 00 00 00       	mov    $0x6a,%edx
+     8b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8b3:	89 c6                	mov    %eax,%esi
+     8b5:	89 d7                	mov    %edx,%edi
+     8b7:	e8 44 f7 ff ff       	call   0 <filename>
+     8bc:	48 89 c7             	mov    %rax,%rdi
+     8bf:	e8 c2 0b 00 00       	call   1486 <unlink>
+     8c4:	85 c0                	test   %eax,%eax
+     8c6:	79 5f                	jns    927 <reusetest+0x472>
+      error("unable to unlink file %d", i);
+     8c8:	8b 05 72 15 00 00    	mov    0x1572(%rip),%eax        # 1e40 <stdout>
+     8ce:	ba 7a 00 00 00       	mov    $0x7a,%edx
+     8d3:	48 8d 0d be 0f 00 00 	lea    0xfbe(%rip),%rcx        # 1898 <malloc+0x187>
+     8da:	48 89 ce             	mov    %rcx,%rsi
+     8dd:	89 c7                	mov    %eax,%edi
+     8df:	b8 00 00 00 00       	mov    $0x0,%eax
+     8e4:	e8 a6 05 00 00       	call   e8f <printf>
+     8e9:	8b 05 51 15 00 00    	mov    0x1551(%rip),%eax        # 1e40 <stdout>
+     8ef:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     8f2:	48 8d 0d f4 10 00 00 	lea    0x10f4(%rip),%rcx        # 19ed <malloc+0x2dc>
+     8f9:	48 89 ce             	mov    %rcx,%rsi
+     8fc:	89 c7                	mov    %eax,%edi
+     8fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     903:	e8 87 05 00 00       	call   e8f <printf>
+     908:	8b 05 32 15 00 00    	mov    0x1532(%rip),%eax        # 1e40 <stdout>
+     90e:	48 8d 15 a9 0f 00 00 	lea    0xfa9(%rip),%rdx        # 18be <malloc+0x1ad>
+     915:	48 89 d6             	mov    %rdx,%rsi
+     918:	89 c7                	mov    %eax,%edi
+     91a:	b8 00 00 00 00       	mov    $0x0,%eax
+     91f:	e8 6b 05 00 00       	call   e8f <printf>
+     924:	90                   	nop
+     925:	eb fd                	jmp    924 <reusetest+0x46f>
+  for(i = 0; i < NFILES; i++)
+     927:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     92b:	81 7d f8 2b 01 00 00 	cmpl   $0x12b,-0x8(%rbp)
+     932:	0f 8e 62 ff ff ff    	jle    89a <reusetest+0x3e5>
+  printf(stdout, "reusetest OK\n");
+     938:	8b 05 02 15 00 00    	mov    0x1502(%rip),%eax        # 1e40 <stdout>
+     93e:	48 8d 15 c1 10 00 00 	lea    0x10c1(%rip),%rdx        # 1a06 <malloc+0x2f5>
+     945:	48 89 d6             	mov    %rdx,%rsi
+     948:	89 c7                	mov    %eax,%edi
+     94a:	b8 00 00 00 00       	mov    $0x0,%eax
+     94f:	e8 3b 05 00 00       	call   e8f <printf>
+}
+     954:	90                   	nop
+     955:	c9                   	leave
+     956:	c3                   	ret
+
+0000000000000957 <opentest>:
+
+// An unlinked file that is still open keeps its inum until it is
+// closed.
+void
+opentest(void)
+{
+     957:	55                   	push   %rbp
+     958:	48 89 e5             	mov    %rsp,%rbp
+     95b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint inum;
+  int fd;
+  int v;
+
+  printf(stdout, "opentest\n");
+     95f:	8b 05 db 14 00 00    	mov    0x14db(%rip),%eax        # 1e40 <stdout>
+     965:	48 8d 15 a8 10 00 00 	lea    0x10a8(%rip),%rdx        # 1a14 <malloc+0x303>
+     96c:	48 89 d6             	mov    %rdx,%rsi
+     96f:	89 c7                	mov    %eax,%edi
+     971:	b8 00 00 00 00       	mov    $0x0,%eax
+     976:	e8 14 05 00 00       	call   e8f <printf>
+  inum = create("open1", 42);
+     97b:	be 2a 00 00 00       	mov    $0x2a,%esi
+     980:	48 8d 05 97 10 00 00 	lea    0x1097(%rip),%rax        # 1a1e <malloc+0x30d>
+     987:	48 89 c7             	mov    %rax,%rdi
+     98a:	e8 3d f7 ff ff       	call   cc <create>
+     98f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if((fd = open("open1", O_RDONLY)) < 0)
+     992:	be 00 00 00 00       	mov    $0x0,%esi
+     997:	48 8d 05 80 10 00 00 	lea    0x1080(%rip),%rax        # 1a1e <malloc+0x30d>
+     99e:	48 89 c7             	mov    %rax,%rdi
+     9a1:	e8 d0 0a 00 00       	call   1476 <open>
+     9a6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     9a9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     9ad:	79 5c                	jns    a0b <opentest+0xb4>
+    error("unable to open open1");
+     9af:	8b 05 8b 14 00 00    	mov    0x148b(%rip),%eax        # 1e40 <stdout>
+     9b5:	ba 8a 00 00 00       	mov    $0x8a,%edx
+     9ba:	48 8d 0d d7 0e 00 00 	lea    0xed7(%rip),%rcx        # 1898 <malloc+0x187>
+     9c1:	48 89 ce             	mov    %rcx,%rsi
+     9c4:	89 c7                	mov    %eax,%edi
+     9c6:	b8 00 00 00 00       	mov    $0x0,%eax
+     9cb:	e8 bf 04 00 00       	call   e8f <printf>
+     9d0:	8b 05 6a 14 00 00    	mov    0x146a(%rip),%eax        # 1e40 <stdout>
+     9d6:	48 8d 15 47 10 00 00 	lea    0x1047(%rip),%rdx        # 1a24 <malloc+0x313>
+     9dd:	48 89 d6             	mov    %rdx,%rsi
+     9e0:	89 c7                	mov    %eax,%edi
+     9e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9e7:	e8 a3 04 00 00       	call   e8f <printf>
+     9ec:	8b 05 4e 14 00 00    	mov    0x144e(%rip),%eax        # 1e40 <stdout>
+     9f2:	48 8d 15 c5 0e 00 00 	lea    0xec5(%rip),%rdx        # 18be <malloc+0x1ad>
+     9f9:	48 89 d6             	mov    %rdx,%rsi
+     9fc:	89 c7                	mov    %eax,%edi
+     9fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     a03:	e8 87 04 00 00       	call   e8f <printf>
+     a08:	90                   	nop
+     a09:	eb fd                	jmp    a08 <opentest+0xb1>
+  if(unlink("open1") < 0)
+     a0b:	48 8d 05 0c 10 00 00 	lea    0x100c(%rip),%rax        # 1a1e <malloc+0x30d>
+     a12:	48 89 c7             	mov    %rax,%rdi
+     a15:	e8 6c 0a 00 00       	call   1486 <unlink>
+     a1a:	85 c0                	test   %eax,%eax
+     a1c:	79 5c                	jns    a7a <opentest+0x123>
+    error("unable to unlink open1");
+     a1e:	8b 05 1c 14 00 00    	mov    0x141c(%rip),%eax        # 1e40 <stdout>
+     a24:	ba 8c 00 00 00       	mov    $0x8c,%edx
+     a29:	48 8d 0d 68 0e 00 00 	lea    0xe68(%rip),%rcx        # 1898 <malloc+0x187>
+     a30:	48 89 ce             	mov    %rcx,%rsi
+     a33:	89 c7                	mov    %eax,%edi
+     a35:	b8 00 00 00 00       	mov    $0x0,%eax
+     a3a:	e8 50 04 00 00       	call   e8f <printf>
+     a3f:	8b 05 fb 13 00 00    	mov    0x13fb(%rip),%eax        # 1e40 <stdout>
+     a45:	48 8d 15 ed 0f 00 00 	lea    0xfed(%rip),%rdx        # 1a39 <malloc+0x328>
+     a4c:	48 89 d6             	mov    %rdx,%rsi
+     a4f:	89 c7                	mov    %eax,%edi
+     a51:	b8 00 00 00 00       	mov    $0x0,%eax
+     a56:	e8 34 04 00 00       	call   e8f <printf>
+     a5b:	8b 05 df 13 00 00    	mov    0x13df(%rip),%eax        # 1e40 <stdout>
+     a61:	48 8d 15 56 0e 00 00 	lea    0xe56(%rip),%rdx        # 18be <malloc+0x1ad>
+     a68:	48 89 d6             	mov    %rdx,%rsi
+     a6b:	89 c7                	mov    %eax,%edi
+     a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+     a72:	e8 18 04 00 00       	call   e8f <printf>
+     a77:	90                   	nop
+     a78:	eb fd                	jmp    a77 <opentest+0x120>
+  if(create("open2", 43) == inum)
+     a7a:	be 2b 00 00 00       	mov    $0x2b,%esi
+     a7f:	48 8d 05 ca 0f 00 00 	lea    0xfca(%rip),%rax        # 1a50 <malloc+0x33f>
+     a86:	48 89 c7             	mov    %rax,%rdi
+     a89:	e8 3e f6 ff ff       	call   cc <create>
+     a8e:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     a91:	75 5c                	jne    aef <opentest+0x198>
+    error("open2 took the inum of open1 while it is open");
+     a93:	8b 05 a7 13 00 00    	mov    0x13a7(%rip),%eax        # 1e40 <stdout>
+     a99:	ba 8e 00 00 00       	mov    $0x8e,%edx
+     a9e:	48 8d 0d f3 0d 00 00 	lea    0xdf3(%rip),%rcx        # 1898 <malloc+0x187>
+     aa5:	48 89 ce             	mov    %rcx,%rsi
+     aa8:	89 c7                	mov    %eax,%edi
+     aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+     aaf:	e8 db 03 00 00       	call   e8f <printf>
+     ab4:	8b 05 86 13 00 00    	mov    0x1386(%rip),%eax        # 1e40 <stdout>
+     aba:	48 8d 15 97 0f 00 00 	lea    0xf97(%rip),%rdx        # 1a58 <malloc+0x347>
+     ac1:	48 89 d6             	mov    %rdx,%rsi
+     ac4:	89 c7                	mov    %eax,%edi
+     ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+     acb:	e8 bf 03 00 00       	call   e8f <printf>
+     ad0:	8b 05 6a 13 00 00    	mov    0x136a(%rip),%eax        # 1e40 <stdout>
+     ad6:	48 8d 15 e1 0d 00 00 	lea    0xde1(%rip),%rdx        # 18be <malloc+0x1ad>
+     add:	48 89 d6             	mov    %rdx,%rsi
+     ae0:	89 c7                	mov    %eax,%edi
+     ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae7:	e8 a3 03 00 00       	call   e8f <printf>
+     aec:	90                   	nop
+     aed:	eb fd                	jmp    aec <opentest+0x195>
+  if(read(fd, &v, sizeof(v)) != sizeof(v) || v != 42)
+     aef:	48 8d 4d f4          	lea    -0xc(%rbp),%rcx
+     af3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     af6:	ba 04 00 00 00       	mov    $0x4,%edx
+     afb:	48 89 ce             	mov    %rcx,%rsi
+     afe:	89 c7                	mov    %eax,%edi
+     b00:	e8 49 09 00 00       	call   144e <read>
+     b05:	83 f8 04             	cmp    $0x4,%eax
+     b08:	75 08                	jne    b12 <opentest+0x1bb>
+     b0a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b0d:	83 f8 2a             	cmp    $0x2a,%eax
+     b10:	74 5c                	je     b6e <opentest+0x217>
+    error("open1 lost its contents after unlink");
+     b12:	8b 05 28 13 00 00    	mov    0x1328(%rip),%eax        # 1e40 <stdout>
+     b18:	ba 90 00 00 00       	mov    $0x90,%edx
+     b1d:	48 8d 0d 74 0d 00 00 	lea    0xd74(%rip),%rcx        # 1898 <malloc+0x187>
+     b24:	48 89 ce             	mov    %rcx,%rsi
+     b27:	89 c7                	mov    %eax,%edi
+     b29:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2e:	e8 5c 03 00 00       	call   e8f <printf>
+     b33:	8b 05 07 13 00 00    	mov    0x1307(%rip),%eax        # 1e40 <stdout>
+     b39:	48 8d 15 48 0f 00 00 	lea    0xf48(%rip),%rdx        # 1a88 <malloc+0x377>
+     b40:	48 89 d6             	mov    %rdx,%rsi
+     b43:	89 c7                	mov    %eax,%edi
+     b45:	b8 00 00 00 00       	mov    $0x0,%eax
+     b4a:	e8 40 03 00 00       	call   e8f <printf>
+     b4f:	8b 05 eb 12 00 00    	mov    0x12eb(%rip),%eax        # 1e40 <stdout>
+     b55:	48 8d 15 62 0d 00 00 	lea    0xd62(%rip),%rdx        # 18be <malloc+0x1ad>
+     b5c:	48 89 d6             	mov    %rdx,%rsi
+     b5f:	89 c7                	mov    %eax,%edi
+     b61:	b8 00 00 00 00       	mov    $0x0,%eax
+     b66:	e8 24 03 00 00       	call   e8f <printf>
+     b6b:	90                   	nop
+     b6c:	eb fd                	jmp    b6b <opentest+0x214>
+  close(fd);
+     b6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b71:	89 c7                	mov    %eax,%edi
+     b73:	e8 e6 08 00 00       	call   145e <close>
+  if(create("open3", 44) != inum)
+     b78:	be 2c 00 00 00       	mov    $0x2c,%esi
+     b7d:	48 8d 05 29 0f 00 00 	lea    0xf29(%rip),%rax        # 1aad <malloc+0x39c>
+     b84:	48 89 c7             	mov    %rax,%rdi
+     b87:	e8 40 f5 ff ff       	call   cc <create>
+     b8c:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     b8f:	74 5c                	je     bed <opentest+0x296>
+    error("inum of open1 was not freed by its last close");
+     b91:	8b 05 a9 12 00 00    	mov    0x12a9(%rip),%eax        # 1e40 <stdout>
+     b97:	ba 93 00 00 00       	mov    $0x93,%edx
+     b9c:	48 8d 0d f5 0c 00 00 	lea    0xcf5(%rip),%rcx        # 1898 <malloc+0x187>
+     ba3:	48 89 ce             	mov    %rcx,%rsi
+     ba6:	89 c7                	mov    %eax,%edi
+     ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+     bad:	e8 dd 02 00 00       	call   e8f <printf>
+     bb2:	8b 05 88 12 00 00    	mov    0x1288(%rip),%eax        # 1e40 <stdout>
+     bb8:	48 8d 15 f9 0e 00 00 	lea    0xef9(%rip),%rdx        # 1ab8 <malloc+0x3a7>
+     bbf:	48 89 d6             	mov    %rdx,%rsi
+     bc2:	89 c7                	mov    %eax,%edi
+     bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc9:	e8 c1 02 00 00       	call   e8f <printf>
+     bce:	8b 05 6c 12 00 00    	mov    0x126c(%rip),%eax        # 1e40 <stdout>
+     bd4:	48 8d 15 e3 0c 00 00 	lea    0xce3(%rip),%rdx        # 18be <malloc+0x1ad>
+     bdb:	48 89 d6             	mov    %rdx,%rsi
+     bde:	89 c7                	mov    %eax,%edi
+     be0:	b8 00 00 00 00       	mov    $0x0,%eax
+     be5:	e8 a5 02 00 00       	call   e8f <printf>
+     bea:	90                   	nop
+     beb:	eb fd                	jmp    bea <opentest+0x293>
+  if(unlink("open2") < 0 || unlink("open3") < 0)
+     bed:	48 8d 05 5c 0e 00 00 	lea    0xe5c(%rip),%rax        # 1a50 <malloc+0x33f>
+     bf4:	48 89 c7             	mov    %rax,%rdi
+     bf7:	e8 8a 08 00 00       	call   1486 <unlink>
+     bfc:	85 c0                	test   %eax,%eax
+     bfe:	78 13                	js     c13 <opentest+0x2bc>
+     c00:	48 8d 05 a6 0e 00 00 	lea    0xea6(%rip),%rax        # 1aad <malloc+0x39c>
+     c07:	48 89 c7             	mov    %rax,%rdi
+     c0a:	e8 77 08 00 00       	call   1486 <unlink>
+     c0f:	85 c0                	test   %eax,%eax
+     c11:	79 5c                	jns    c6f <opentest+0x318>
+    error("unable to unlink");
+     c13:	8b 05 27 12 00 00    	mov    0x1227(%rip),%eax        # 1e40 <stdout>
+     c19:	ba 95 00 00 00       	mov    $0x95,%edx
+     c1e:	48 8d 0d 73 0c 00 00 	lea    0xc73(%rip),%rcx        # 1898 <malloc+0x187>
+     c25:	48 89 ce             	mov    %rcx,%rsi
+     c28:	89 c7                	mov    %eax,%edi
+     c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c2f:	e8 5b 02 00 00       	call   e8f <printf>
+     c34:	8b 05 06 12 00 00    	mov    0x1206(%rip),%eax        # 1e40 <stdout>
+     c3a:	48 8d 15 a5 0e 00 00 	lea    0xea5(%rip),%rdx        # 1ae6 <malloc+0x3d5>
+     c41:	48 89 d6             	mov    %rdx,%rsi
+     c44:	89 c7                	mov    %eax,%edi
+     c46:	b8 00 00 00 00       	mov    $0x0,%eax
+     c4b:	e8 3f 02 00 00       	call   e8f <printf>
+     c50:	8b 05 ea 11 00 00    	mov    0x11ea(%rip),%eax        # 1e40 <stdout>
+     c56:	48 8d 15 61 0c 00 00 	lea    0xc61(%rip),%rdx        # 18be <malloc+0x1ad>
+     c5d:	48 89 d6             	mov    %rdx,%rsi
+     c60:	89 c7                	mov    %eax,%edi
+     c62:	b8 00 00 00 00       	mov    $0x0,%eax
+     c67:	e8 23 02 00 00       	call   e8f <printf>
+     c6c:	90                   	nop
+     c6d:	eb fd                	jmp    c6c <opentest+0x315>
+  printf(stdout, "opentest OK\n");
+     c6f:	8b 05 cb 11 00 00    	mov    0x11cb(%rip),%eax        # 1e40 <stdout>
+     c75:	48 8d 15 7b 0e 00 00 	lea    0xe7b(%rip),%rdx        # 1af7 <malloc+0x3e6>
+     c7c:	48 89 d6             	mov    %rdx,%rsi
+     c7f:	89 c7                	mov    %eax,%edi
+     c81:	b8 00 00 00 00       	mov    $0x0,%eax
+     c86:	e8 04 02 00 00       	call   e8f <printf>
+}
+     c8b:	90                   	nop
+     c8c:	c9                   	leave
+     c8d:	c3                   	ret
+
+0000000000000c8e <main>:
+
+int
+main(int argc, char *argv[])
+{
+     c8e:	55                   	push   %rbp
+     c8f:	48 89 e5             	mov    %rsp,%rbp
+     c92:	48 83 ec 10          	sub    $0x10,%rsp
+     c96:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     c99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  growtest();
+     c9d:	e8 16 f6 ff ff       	call   2b8 <growtest>
+  reusetest();
+     ca2:	e8 0e f8 ff ff       	call   4b5 <reusetest>
+  opentest();
+     ca7:	e8 ab fc ff ff       	call   957 <opentest>
+  printf(stdout, "inodetest passed!!\n");
+     cac:	8b 05 8e 11 00 00    	mov    0x118e(%rip),%eax        # 1e40 <stdout>
+     cb2:	48 8d 15 4b 0e 00 00 	lea    0xe4b(%rip),%rdx        # 1b04 <malloc+0x3f3>
+     cb9:	48 89 d6             	mov    %rdx,%rsi
+     cbc:	89 c7                	mov    %eax,%edi
+     cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc3:	e8 c7 01 00 00       	call   e8f <printf>
+  exit();
+     cc8:	e8 69 07 00 00       	call   1436 <exit>
+
+0000000000000ccd <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     ccd:	55                   	push   %rbp
+     cce:	48 89 e5             	mov    %rsp,%rbp
+     cd1:	48 83 ec 10          	sub    $0x10,%rsp
+     cd5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     cd8:	89 f0                	mov    %esi,%eax
+     cda:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     cdd:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     ce1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ce4:	ba 01 00 00 00       	mov    $0x1,%edx
+     ce9:	48 89 ce             	mov    %rcx,%rsi
+     cec:	89 c7                	mov    %eax,%edi
+     cee:	e8 63 07 00 00       	call   1456 <write>
+}
+     cf3:	90                   	nop
+     cf4:	c9                   	leave
+     cf5:	c3                   	ret
+
+0000000000000cf6 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     cf6:	55                   	push   %rbp
+     cf7:	48 89 e5             	mov    %rsp,%rbp
+     cfa:	48 83 ec 40          	sub    $0x40,%rsp
+     cfe:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     d01:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     d04:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     d07:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     d0a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     d0e:	74 1f                	je     d2f <printint64+0x39>
+     d10:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     d13:	c1 e8 1f             	shr    $0x1f,%eax
+     d16:	0f b6 c0             	movzbl %al,%eax
+     d19:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     d1c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     d20:	74 0d                	je     d2f <printint64+0x39>
+    x = -xx;
+     d22:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     d25:	f7 d8                	neg    %eax
+     d27:	48 98                	cltq
+     d29:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     d2d:	eb 09                	jmp    d38 <printint64+0x42>
+  else
+    x = xx;
+     d2f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     d32:	48 98                	cltq
+     d34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     d38:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     d3f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     d42:	48 63 c8             	movslq %eax,%rcx
+     d45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d49:	ba 00 00 00 00       	mov    $0x0,%edx
+     d4e:	48 f7 f1             	div    %rcx
+     d51:	48 89 d1             	mov    %rdx,%rcx
+     d54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d57:	8d 50 01             	lea    0x1(%rax),%edx
+     d5a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d5d:	48 8d 15 ec 10 00 00 	lea    0x10ec(%rip),%rdx        # 1e50 <digits.1>
+     d64:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     d68:	48 98                	cltq
+     d6a:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     d6e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     d71:	48 63 f0             	movslq %eax,%rsi
+     d74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d78:	ba 00 00 00 00       	mov    $0x0,%edx
+     d7d:	48 f7 f6             	div    %rsi
+     d80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     d84:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     d89:	75 b4                	jne    d3f <printint64+0x49>
+
+  if(sgn)
+     d8b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     d8f:	74 2b                	je     dbc <printint64+0xc6>
+    buf[i++] = '-';
+     d91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d94:	8d 50 01             	lea    0x1(%rax),%edx
+     d97:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d9a:	48 98                	cltq
+     d9c:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     da1:	eb 19                	jmp    dbc <printint64+0xc6>
+    putc(fd, buf[i]);
+     da3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     da6:	48 98                	cltq
+     da8:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     dad:	0f be d0             	movsbl %al,%edx
+     db0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     db3:	89 d6                	mov    %edx,%esi
+     db5:	89 c7                	mov    %eax,%edi
+     db7:	e8 11 ff ff ff       	call   ccd <putc>
+  while(--i >= 0)
+     dbc:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     dc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     dc4:	79 dd                	jns    da3 <printint64+0xad>
+}
+     dc6:	90                   	nop
+     dc7:	90                   	nop
+     dc8:	c9                   	leave
+     dc9:	c3                   	ret
+
+0000000000000dca <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     dca:	55                   	push   %rbp
+     dcb:	48 89 e5             	mov    %rsp,%rbp
+     dce:	48 83 ec 30          	sub    $0x30,%rsp
+     dd2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     dd5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     dd8:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     ddb:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     dde:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     de5:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     de9:	74 17                	je     e02 <printint+0x38>
+     deb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     def:	79 11                	jns    e02 <printint+0x38>
+    neg = 1;
+     df1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     df8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     dfb:	f7 d8                	neg    %eax
+     dfd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     e00:	eb 06                	jmp    e08 <printint+0x3e>
+  } else {
+    x = xx;
+     e02:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     e05:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     e08:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     e0f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     e12:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e15:	ba 00 00 00 00       	mov    $0x0,%edx
+     e1a:	f7 f1                	div    %ecx
+     e1c:	89 d1                	mov    %edx,%ecx
+     e1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e21:	8d 50 01             	lea    0x1(%rax),%edx
+     e24:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e27:	89 c9                	mov    %ecx,%ecx
+     e29:	48 8d 15 40 10 00 00 	lea    0x1040(%rip),%rdx        # 1e70 <digits.0>
+     e30:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     e34:	48 98                	cltq
+     e36:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     e3a:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     e3d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e40:	ba 00 00 00 00       	mov    $0x0,%edx
+     e45:	f7 f6                	div    %esi
+     e47:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     e4a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     e4e:	75 bf                	jne    e0f <printint+0x45>
+  if(neg)
+     e50:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e54:	74 2b                	je     e81 <printint+0xb7>
+    buf[i++] = '-';
+     e56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e59:	8d 50 01             	lea    0x1(%rax),%edx
+     e5c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     e5f:	48 98                	cltq
+     e61:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     e66:	eb 19                	jmp    e81 <printint+0xb7>
+    putc(fd, buf[i]);
+     e68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e6b:	48 98                	cltq
+     e6d:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     e72:	0f be d0             	movsbl %al,%edx
+     e75:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e78:	89 d6                	mov    %edx,%esi
+     e7a:	89 c7                	mov    %eax,%edi
+     e7c:	e8 4c fe ff ff       	call   ccd <putc>
+  while(--i >= 0)
+     e81:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     e85:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e89:	79 dd                	jns    e68 <printint+0x9e>
+}
+     e8b:	90                   	nop
+     e8c:	90                   	nop
+     e8d:	c9                   	leave
+     e8e:	c3                   	ret
+
+0000000000000e8f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     e8f:	55                   	push   %rbp
+     e90:	48 89 e5             	mov    %rsp,%rbp
+     e93:	48 83 ec 70          	sub    $0x70,%rsp
+     e97:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     e9a:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     e9e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     ea2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     ea6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     eaa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     eae:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     eb5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     eb9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     ebd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     ec1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     ec5:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     ecc:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     ed3:	e9 6b 02 00 00       	jmp    1143 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     ed8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     edb:	48 63 d0             	movslq %eax,%rdx
+     ede:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     ee2:	48 01 d0             	add    %rdx,%rax
+     ee5:	0f b6 00             	movzbl (%rax),%eax
+     ee8:	0f be c0             	movsbl %al,%eax
+     eeb:	25 ff 00 00 00       	and    $0xff,%eax
+     ef0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     ef3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     ef7:	75 30                	jne    f29 <printf+0x9a>
+      if(c == '%'){
+     ef9:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     efd:	75 13                	jne    f12 <printf+0x83>
+        state = '%';
+     eff:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     f06:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     f0d:	e9 2d 02 00 00       	jmp    113f <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     f12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     f15:	0f be d0             	movsbl %al,%edx
+     f18:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f1b:	89 d6                	mov    %edx,%esi
+     f1d:	89 c7                	mov    %eax,%edi
+     f1f:	e8 a9 fd ff ff       	call   ccd <putc>
+     f24:	e9 16 02 00 00       	jmp    113f <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     f29:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     f2d:	0f 85 0c 02 00 00    	jne    113f <printf+0x2b0>
+      if(c == 'l') {
+     f33:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     f37:	75 0c                	jne    f45 <printf+0xb6>
+        lflag = 1;
+     f39:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     f40:	e9 fa 01 00 00       	jmp    113f <printf+0x2b0>
+      } else if(c == 'd'){
+     f45:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     f49:	0f 85 95 00 00 00    	jne    fe4 <printf+0x155>
+        if (lflag == 1)
+     f4f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     f53:	75 49                	jne    f9e <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     f55:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     f58:	83 f8 2f             	cmp    $0x2f,%eax
+     f5b:	77 17                	ja     f74 <printf+0xe5>
+     f5d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     f61:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f64:	89 d2                	mov    %edx,%edx
+     f66:	48 01 d0             	add    %rdx,%rax
+     f69:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f6c:	83 c2 08             	add    $0x8,%edx
+     f6f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     f72:	eb 0c                	jmp    f80 <printf+0xf1>
+     f74:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     f78:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     f7c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     f80:	48 8b 00             	mov    (%rax),%rax
+     f83:	89 c6                	mov    %eax,%esi
+     f85:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f88:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f8d:	ba 0a 00 00 00       	mov    $0xa,%edx
+     f92:	89 c7                	mov    %eax,%edi
+     f94:	e8 5d fd ff ff       	call   cf6 <printint64>
+     f99:	e9 9a 01 00 00       	jmp    1138 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     f9e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     fa1:	83 f8 2f             	cmp    $0x2f,%eax
+     fa4:	77 17                	ja     fbd <printf+0x12e>
+     fa6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     faa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     fad:	89 d2                	mov    %edx,%edx
+     faf:	48 01 d0             	add    %rdx,%rax
+     fb2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     fb5:	83 c2 08             	add    $0x8,%edx
+     fb8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     fbb:	eb 0c                	jmp    fc9 <printf+0x13a>
+     fbd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     fc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     fc5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     fc9:	8b 30                	mov    (%rax),%esi
+     fcb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     fce:	b9 01 00 00 00       	mov    $0x1,%ecx
+     fd3:	ba 0a 00 00 00       	mov    $0xa,%edx
+     fd8:	89 c7                	mov    %eax,%edi
+     fda:	e8 eb fd ff ff       	call   dca <printint>
+     fdf:	e9 54 01 00 00       	jmp    1138 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     fe4:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     fe8:	74 0a                	je     ff4 <printf+0x165>
+     fea:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     fee:	0f 85 95 00 00 00    	jne    1089 <printf+0x1fa>
+        if (lflag == 1)
+     ff4:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     ff8:	75 49                	jne    1043 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     ffa:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     ffd:	83 f8 2f             	cmp    $0x2f,%eax
+    1000:	77 17                	ja     1019 <printf+0x18a>
+    1002:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1006:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1009:	89 d2                	mov    %edx,%edx
+    100b:	48 01 d0             	add    %rdx,%rax
+    100e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1011:	83 c2 08             	add    $0x8,%edx
+    1014:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1017:	eb 0c                	jmp    1025 <printf+0x196>
+    1019:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    101d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1021:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1025:	48 8b 00             	mov    (%rax),%rax
+    1028:	89 c6                	mov    %eax,%esi
+    102a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    102d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1032:	ba 10 00 00 00       	mov    $0x10,%edx
+    1037:	89 c7                	mov    %eax,%edi
+    1039:	e8 b8 fc ff ff       	call   cf6 <printint64>
+        if (lflag == 1)
+    103e:	e9 f5 00 00 00       	jmp    1138 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1043:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1046:	83 f8 2f             	cmp    $0x2f,%eax
+    1049:	77 17                	ja     1062 <printf+0x1d3>
+    104b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    104f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1052:	89 d2                	mov    %edx,%edx
+    1054:	48 01 d0             	add    %rdx,%rax
+    1057:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    105a:	83 c2 08             	add    $0x8,%edx
+    105d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1060:	eb 0c                	jmp    106e <printf+0x1df>
+    1062:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1066:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    106a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    106e:	8b 30                	mov    (%rax),%esi
+    1070:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1073:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1078:	ba 10 00 00 00       	mov    $0x10,%edx
+    107d:	89 c7                	mov    %eax,%edi
+    107f:	e8 46 fd ff ff       	call   dca <printint>
+        if (lflag == 1)
+    1084:	e9 af 00 00 00       	jmp    1138 <printf+0x2a9>
+      } else if(c == 's'){
+    1089:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    108d:	75 6e                	jne    10fd <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    108f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1092:	83 f8 2f             	cmp    $0x2f,%eax
+    1095:	77 17                	ja     10ae <printf+0x21f>
+    1097:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    109b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    109e:	89 d2                	mov    %edx,%edx
+    10a0:	48 01 d0             	add    %rdx,%rax
+    10a3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    10a6:	83 c2 08             	add    $0x8,%edx
+    10a9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    10ac:	eb 0c                	jmp    10ba <printf+0x22b>
+    10ae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    10b2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    10b6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    10ba:	48 8b 00             	mov    (%rax),%rax
+    10bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    10c1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    10c6:	75 28                	jne    10f0 <printf+0x261>
+          s = "(null)";
+    10c8:	48 8d 05 49 0a 00 00 	lea    0xa49(%rip),%rax        # 1b18 <malloc+0x407>
+    10cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    10d3:	eb 1b                	jmp    10f0 <printf+0x261>
+          putc(fd, *s);
+    10d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    10d9:	0f b6 00             	movzbl (%rax),%eax
+    10dc:	0f be d0             	movsbl %al,%edx
+    10df:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10e2:	89 d6                	mov    %edx,%esi
+    10e4:	89 c7                	mov    %eax,%edi
+    10e6:	e8 e2 fb ff ff       	call   ccd <putc>
+        for(; *s; s++)
+    10eb:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    10f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    10f4:	0f b6 00             	movzbl (%rax),%eax
+    10f7:	84 c0                	test   %al,%al
+    10f9:	75 da                	jne    10d5 <printf+0x246>
+    10fb:	eb 3b                	jmp    1138 <printf+0x2a9>
+      } else if(c == '%'){
+    10fd:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1101:	75 14                	jne    1117 <printf+0x288>
+        putc(fd, c);
+    1103:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1106:	0f be d0             	movsbl %al,%edx
+    1109:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    110c:	89 d6                	mov    %edx,%esi
+    110e:	89 c7                	mov    %eax,%edi
+    1110:	e8 b8 fb ff ff       	call   ccd <putc>
+    1115:	eb 21                	jmp    1138 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1117:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    111a:	be 25 00 00 00       	mov    $0x25,%esi
+    111f:	89 c7                	mov    %eax,%edi
+    1121:	e8 a7 fb ff ff       	call   ccd <putc>
+        putc(fd, c);
+    1126:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1129:	0f be d0             	movsbl %al,%edx
+    112c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    112f:	89 d6                	mov    %edx,%esi
+    1131:	89 c7                	mov    %eax,%edi
+    1133:	e8 95 fb ff ff       	call   ccd <putc>
+      }
+      state = 0;
+    1138:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    113f:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1143:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1146:	48 63 d0             	movslq %eax,%rdx
+    1149:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    114d:	48 01 d0             	add    %rdx,%rax
+    1150:	0f b6 00             	movzbl (%rax),%eax
+    1153:	84 c0                	test   %al,%al
+    1155:	0f 85 7d fd ff ff    	jne    ed8 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    115b:	90                   	nop
+    115c:	90                   	nop
+    115d:	c9                   	leave
+    115e:	c3                   	ret
+
+000000000000115f <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    115f:	55                   	push   %rbp
+    1160:	48 89 e5             	mov    %rsp,%rbp
+    1163:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1167:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    116a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    116d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1171:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1174:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1177:	48 89 ce             	mov    %rcx,%rsi
+    117a:	48 89 f7             	mov    %rsi,%rdi
+    117d:	89 d1                	mov    %edx,%ecx
+    117f:	fc                   	cld
+    1180:	f3 aa                	rep stos %al,%es:(%rdi)
+    1182:	89 ca                	mov    %ecx,%edx
+    1184:	48 89 fe             	mov    %rdi,%rsi
+    1187:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    118b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    118e:	90                   	nop
+    118f:	5d                   	pop    %rbp
+    1190:	c3                   	ret
+
+0000000000001191 <strcpy>:
+{
+    1191:	55                   	push   %rbp
+    1192:	48 89 e5             	mov    %rsp,%rbp
+    1195:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1199:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    119d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    11a5:	90                   	nop
+    11a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    11aa:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    11ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    11b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11b6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    11ba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    11be:	0f b6 12             	movzbl (%rdx),%edx
+    11c1:	88 10                	mov    %dl,(%rax)
+    11c3:	0f b6 00             	movzbl (%rax),%eax
+    11c6:	84 c0                	test   %al,%al
+    11c8:	75 dc                	jne    11a6 <strcpy+0x15>
+  return os;
+    11ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    11ce:	5d                   	pop    %rbp
+    11cf:	c3                   	ret
+
+00000000000011d0 <strcmp>:
+{
+    11d0:	55                   	push   %rbp
+    11d1:	48 89 e5             	mov    %rsp,%rbp
+    11d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    11d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    11dc:	eb 0a                	jmp    11e8 <strcmp+0x18>
+    p++, q++;
+    11de:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    11e3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    11e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ec:	0f b6 00             	movzbl (%rax),%eax
+    11ef:	84 c0                	test   %al,%al
+    11f1:	74 12                	je     1205 <strcmp+0x35>
+    11f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11f7:	0f b6 10             	movzbl (%rax),%edx
+    11fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11fe:	0f b6 00             	movzbl (%rax),%eax
+    1201:	38 c2                	cmp    %al,%dl
+    1203:	74 d9                	je     11de <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1205:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1209:	0f b6 00             	movzbl (%rax),%eax
+    120c:	0f b6 d0             	movzbl %al,%edx
+    120f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1213:	0f b6 00             	movzbl (%rax),%eax
+    1216:	0f b6 c0             	movzbl %al,%eax
+    1219:	29 c2                	sub    %eax,%edx
+    121b:	89 d0                	mov    %edx,%eax
+}
+    121d:	5d                   	pop    %rbp
+    121e:	c3                   	ret
+
+000000000000121f <strlen>:
+{
+    121f:	55                   	push   %rbp
+    1220:	48 89 e5             	mov    %rsp,%rbp
+    1223:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1227:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    122e:	eb 04                	jmp    1234 <strlen+0x15>
+    1230:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1234:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1237:	48 63 d0             	movslq %eax,%rdx
+    123a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    123e:	48 01 d0             	add    %rdx,%rax
+    1241:	0f b6 00             	movzbl (%rax),%eax
+    1244:	84 c0                	test   %al,%al
+    1246:	75 e8                	jne    1230 <strlen+0x11>
+  return n;
+    1248:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    124b:	5d                   	pop    %rbp
+    124c:	c3                   	ret
+
+000000000000124d <memset>:
+{
+    124d:	55                   	push   %rbp
+    124e:	48 89 e5             	mov    %rsp,%rbp
+    1251:	48 83 ec 10          	sub    $0x10,%rsp
+    1255:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1259:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    125c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    125f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1262:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1265:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1269:	89 ce                	mov    %ecx,%esi
+    126b:	48 89 c7             	mov    %rax,%rdi
+    126e:	e8 ec fe ff ff       	call   115f <stosb>
+  return dst;
+    1273:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1277:	c9                   	leave
+    1278:	c3                   	ret
+
+0000000000001279 <strchr>:
+{
+    1279:	55                   	push   %rbp
+    127a:	48 89 e5             	mov    %rsp,%rbp
+    127d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1281:	89 f0                	mov    %esi,%eax
+    1283:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1286:	eb 17                	jmp    129f <strchr+0x26>
+    if(*s == c)
+    1288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128c:	0f b6 00             	movzbl (%rax),%eax
+    128f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1292:	75 06                	jne    129a <strchr+0x21>
+      return (char*)s;
+    1294:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1298:	eb 15                	jmp    12af <strchr+0x36>
+  for(; *s; s++)
+    129a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    129f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12a3:	0f b6 00             	movzbl (%rax),%eax
+    12a6:	84 c0                	test   %al,%al
+    12a8:	75 de                	jne    1288 <strchr+0xf>
+  return 0;
+    12aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    12af:	5d                   	pop    %rbp
+    12b0:	c3                   	ret
+
+00000000000012b1 <gets>:
+gets(char *buf, int max)
+{
+    12b1:	55                   	push   %rbp
+    12b2:	48 89 e5             	mov    %rsp,%rbp
+    12b5:	48 83 ec 20          	sub    $0x20,%rsp
+    12b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12bd:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    12c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    12c7:	eb 48                	jmp    1311 <gets+0x60>
+    cc = read(0, &c, 1);
+    12c9:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    12cd:	ba 01 00 00 00       	mov    $0x1,%edx
+    12d2:	48 89 c6             	mov    %rax,%rsi
+    12d5:	bf 00 00 00 00       	mov    $0x0,%edi
+    12da:	e8 6f 01 00 00       	call   144e <read>
+    12df:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    12e2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    12e6:	7e 36                	jle    131e <gets+0x6d>
+      break;
+    buf[i++] = c;
+    12e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12eb:	8d 50 01             	lea    0x1(%rax),%edx
+    12ee:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12f1:	48 63 d0             	movslq %eax,%rdx
+    12f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12f8:	48 01 c2             	add    %rax,%rdx
+    12fb:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    12ff:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1301:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1305:	3c 0a                	cmp    $0xa,%al
+    1307:	74 16                	je     131f <gets+0x6e>
+    1309:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    130d:	3c 0d                	cmp    $0xd,%al
+    130f:	74 0e                	je     131f <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1311:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1314:	83 c0 01             	add    $0x1,%eax
+    1317:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    131a:	7f ad                	jg     12c9 <gets+0x18>
+    131c:	eb 01                	jmp    131f <gets+0x6e>
+      break;
+    131e:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    131f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1322:	48 63 d0             	movslq %eax,%rdx
+    1325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1329:	48 01 d0             	add    %rdx,%rax
+    132c:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    132f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1333:	c9                   	leave
+    1334:	c3                   	ret
+
+0000000000001335 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1335:	55                   	push   %rbp
+    1336:	48 89 e5             	mov    %rsp,%rbp
+    1339:	48 83 ec 20          	sub    $0x20,%rsp
+    133d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1341:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1345:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1349:	be 00 00 00 00       	mov    $0x0,%esi
+    134e:	48 89 c7             	mov    %rax,%rdi
+    1351:	e8 20 01 00 00       	call   1476 <open>
+    1356:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1359:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    135d:	79 07                	jns    1366 <stat+0x31>
+    return -1;
+    135f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1364:	eb 21                	jmp    1387 <stat+0x52>
+  r = fstat(fd, st);
+    1366:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    136a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    136d:	48 89 d6             	mov    %rdx,%rsi
+    1370:	89 c7                	mov    %eax,%edi
+    1372:	e8 17 01 00 00       	call   148e <fstat>
+    1377:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    137a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    137d:	89 c7                	mov    %eax,%edi
+    137f:	e8 da 00 00 00       	call   145e <close>
+  return r;
+    1384:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1387:	c9                   	leave
+    1388:	c3                   	ret
+
+0000000000001389 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1389:	55                   	push   %rbp
+    138a:	48 89 e5             	mov    %rsp,%rbp
+    138d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1391:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1398:	eb 28                	jmp    13c2 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    139a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    139d:	89 d0                	mov    %edx,%eax
+    139f:	c1 e0 02             	shl    $0x2,%eax
+    13a2:	01 d0                	add    %edx,%eax
+    13a4:	01 c0                	add    %eax,%eax
+    13a6:	89 c1                	mov    %eax,%ecx
+    13a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13ac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    13b0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    13b4:	0f b6 00             	movzbl (%rax),%eax
+    13b7:	0f be c0             	movsbl %al,%eax
+    13ba:	01 c8                	add    %ecx,%eax
+    13bc:	83 e8 30             	sub    $0x30,%eax
+    13bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    13c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13c6:	0f b6 00             	movzbl (%rax),%eax
+    13c9:	3c 2f                	cmp    $0x2f,%al
+    13cb:	7e 0b                	jle    13d8 <atoi+0x4f>
+    13cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13d1:	0f b6 00             	movzbl (%rax),%eax
+    13d4:	3c 39                	cmp    $0x39,%al
+    13d6:	7e c2                	jle    139a <atoi+0x11>
+  return n;
+    13d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    13db:	5d                   	pop    %rbp
+    13dc:	c3                   	ret
+
+00000000000013dd <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    13dd:	55                   	push   %rbp
+    13de:	48 89 e5             	mov    %rsp,%rbp
+    13e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    13e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    13e9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    13ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    13f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    13f8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    13fc:	eb 1d                	jmp    141b <memmove+0x3e>
+    *dst++ = *src++;
+    13fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1402:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1406:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    140a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    140e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1412:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1416:	0f b6 12             	movzbl (%rdx),%edx
+    1419:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    141b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    141e:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1421:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1424:	85 c0                	test   %eax,%eax
+    1426:	7f d6                	jg     13fe <memmove+0x21>
+  return vdst;
+    1428:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    142c:	5d                   	pop    %rbp
+    142d:	c3                   	ret
+
+000000000000142e <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    142e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1433:	cd 40                	int    $0x40
+    1435:	c3                   	ret
+
+0000000000001436 <exit>:
+SYSCALL(exit)
+    1436:	b8 02 00 00 00       	mov    $0x2,%eax
+    143b:	cd 40                	int    $0x40
+    143d:	c3                   	ret
+
+000000000000143e <wait>:
+SYSCALL(wait)
+    143e:	b8 03 00 00 00       	mov    $0x3,%eax
+    1443:	cd 40                	int    $0x40
+    1445:	c3                   	ret
+
+0000000000001446 <pipe>:
+SYSCALL(pipe)
+    1446:	b8 04 00 00 00       	mov    $0x4,%eax
+    144b:	cd 40                	int    $0x40
+    144d:	c3                   	ret
+
+000000000000144e <read>:
+SYSCALL(read)
+    144e:	b8 05 00 00 00       	mov    $0x5,%eax
+    1453:	cd 40                	int    $0x40
+    1455:	c3                   	ret
+
+0000000000001456 <write>:
+SYSCALL(write)
+    1456:	b8 10 00 00 00       	mov    $0x10,%eax
+    145b:	cd 40                	int    $0x40
+    145d:	c3                   	ret
+
+000000000000145e <close>:
+SYSCALL(close)
+    145e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1463:	cd 40                	int    $0x40
+    1465:	c3                   	ret
+
+0000000000001466 <kill>:
+SYSCALL(kill)
+    1466:	b8 06 00 00 00       	mov    $0x6,%eax
+    146b:	cd 40                	int    $0x40
+    146d:	c3                   	ret
+
+000000000000146e <exec>:
+SYSCALL(exec)
+    146e:	b8 07 00 00 00       	mov    $0x7,%eax
+    1473:	cd 40                	int    $0x40
+    1475:	c3                   	ret
+
+0000000000001476 <open>:
+SYSCALL(open)
+    1476:	b8 0f 00 00 00       	mov    $0xf,%eax
+    147b:	cd 40                	int    $0x40
+    147d:	c3                   	ret
+
+000000000000147e <mknod>:
+SYSCALL(mknod)
+    147e:	b8 11 00 00 00       	mov    $0x11,%eax
+    1483:	cd 40                	int    $0x40
+    1485:	c3                   	ret
+
+0000000000001486 <unlink>:
+SYSCALL(unlink)
+    1486:	b8 12 00 00 00       	mov    $0x12,%eax
+    148b:	cd 40                	int    $0x40
+    148d:	c3                   	ret
+
+000000000000148e <fstat>:
+SYSCALL(fstat)
+    148e:	b8 08 00 00 00       	mov    $0x8,%eax
+    1493:	cd 40                	int    $0x40
+    1495:	c3                   	ret
+
+0000000000001496 <link>:
+SYSCALL(link)
+    1496:	b8 13 00 00 00       	mov    $0x13,%eax
+    149b:	cd 40                	int    $0x40
+    149d:	c3                   	ret
+
+000000000000149e <mkdir>:
+SYSCALL(mkdir)
+    149e:	b8 14 00 00 00       	mov    $0x14,%eax
+    14a3:	cd 40                	int    $0x40
+    14a5:	c3                   	ret
+
+00000000000014a6 <chdir>:
+SYSCALL(chdir)
+    14a6:	b8 09 00 00 00       	mov    $0x9,%eax
+    14ab:	cd 40                	int    $0x40
+    14ad:	c3                   	ret
+
+00000000000014ae <dup>:
+SYSCALL(dup)
+    14ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14b3:	cd 40                	int    $0x40
+    14b5:	c3                   	ret
+
+00000000000014b6 <getpid>:
+SYSCALL(getpid)
+    14b6:	b8 0b 00 00 00       	mov    $0xb,%eax
+    14bb:	cd 40                	int    $0x40
+    14bd:	c3                   	ret
+
+00000000000014be <sbrk>:
+SYSCALL(sbrk)
+    14be:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14c3:	cd 40                	int    $0x40
+    14c5:	c3                   	ret
+
+00000000000014c6 <sleep>:
+SYSCALL(sleep)
+    14c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14cb:	cd 40                	int    $0x40
+    14cd:	c3                   	ret
+
+00000000000014ce <uptime>:
+SYSCALL(uptime)
+    14ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14d3:	cd 40                	int    $0x40
+    14d5:	c3                   	ret
+
+00000000000014d6 <sysinfo>:
+SYSCALL(sysinfo)
+    14d6:	b8 16 00 00 00       	mov    $0x16,%eax
+    14db:	cd 40                	int    $0x40
+    14dd:	c3                   	ret
+
+00000000000014de <mmap>:
+SYSCALL(mmap)
+    14de:	b8 17 00 00 00       	mov    $0x17,%eax
+    14e3:	cd 40                	int    $0x40
+    14e5:	c3                   	ret
+
+00000000000014e6 <munmap>:
+SYSCALL(munmap)
+    14e6:	b8 18 00 00 00       	mov    $0x18,%eax
+    14eb:	cd 40                	int    $0x40
+    14ed:	c3                   	ret
+
+00000000000014ee <crashn>:
+SYSCALL(crashn)
+    14ee:	b8 19 00 00 00       	mov    $0x19,%eax
+    14f3:	cd 40                	int    $0x40
+    14f5:	c3                   	ret
+
+00000000000014f6 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    14f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    14fb:	cd 40                	int    $0x40
+    14fd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1500:	74 02                	je     1504 <mmap2+0xe>
+    1502:	89 c0                	mov    %eax,%eax
+    1504:	c3                   	ret
+
+0000000000001505 <munmap2>:
+SYSCALL(munmap2)
+    1505:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    150a:	cd 40                	int    $0x40
+    150c:	c3                   	ret
+
+000000000000150d <msync>:
+SYSCALL(msync)
+    150d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1512:	cd 40                	int    $0x40
+    1514:	c3                   	ret
+
+0000000000001515 <sendfile>:
+SYSCALL(sendfile)
+    1515:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    151a:	cd 40                	int    $0x40
+    151c:	c3                   	ret
+
+000000000000151d <splice>:
+SYSCALL(splice)
+    151d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1522:	cd 40                	int    $0x40
+    1524:	c3                   	ret
+
+0000000000001525 <pread>:
+SYSCALL(pread)
+    1525:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    152a:	cd 40                	int    $0x40
+    152c:	c3                   	ret
+
+000000000000152d <pwrite>:
+SYSCALL(pwrite)
+    152d:	b8 20 00 00 00       	mov    $0x20,%eax
+    1532:	cd 40                	int    $0x40
+    1534:	c3                   	ret
+
+0000000000001535 <readv>:
+SYSCALL(readv)
+    1535:	b8 21 00 00 00       	mov    $0x21,%eax
+    153a:	cd 40                	int    $0x40
+    153c:	c3                   	ret
+
+000000000000153d <writev>:
+SYSCALL(writev)
+    153d:	b8 22 00 00 00       	mov    $0x22,%eax
+    1542:	cd 40                	int    $0x40
+    1544:	c3                   	ret
+
+0000000000001545 <poll>:
+SYSCALL(poll)
+    1545:	b8 23 00 00 00       	mov    $0x23,%eax
+    154a:	cd 40                	int    $0x40
+    154c:	c3                   	ret
+
+000000000000154d <pipe2>:
+SYSCALL(pipe2)
+    154d:	b8 24 00 00 00       	mov    $0x24,%eax
+    1552:	cd 40                	int    $0x40
+    1554:	c3                   	ret
+
+0000000000001555 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1555:	55                   	push   %rbp
+    1556:	48 89 e5             	mov    %rsp,%rbp
+    1559:	48 83 ec 20          	sub    $0x20,%rsp
+    155d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1561:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1565:	48 83 e8 10          	sub    $0x10,%rax
+    1569:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    156d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1571:	48 8b 10             	mov    (%rax),%rdx
+    1574:	48 8d 05 45 09 00 00 	lea    0x945(%rip),%rax        # 1ec0 <bigblock>
+    157b:	48 39 c2             	cmp    %rax,%rdx
+    157e:	75 1f                	jne    159f <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1580:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1584:	8b 40 08             	mov    0x8(%rax),%eax
+    1587:	c1 e0 04             	shl    $0x4,%eax
+    158a:	89 c2                	mov    %eax,%edx
+    158c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1590:	89 d6                	mov    %edx,%esi
+    1592:	48 89 c7             	mov    %rax,%rdi
+    1595:	e8 6b ff ff ff       	call   1505 <munmap2>
+    return;
+    159a:	e9 0b 01 00 00       	jmp    16aa <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    159f:	48 8b 05 0a 09 00 00 	mov    0x90a(%rip),%rax        # 1eb0 <freep>
+    15a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15aa:	eb 2f                	jmp    15db <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    15ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b0:	48 8b 00             	mov    (%rax),%rax
+    15b3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    15b7:	72 17                	jb     15d0 <free+0x7b>
+    15b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15bd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    15c1:	72 2f                	jb     15f2 <free+0x9d>
+    15c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15c7:	48 8b 00             	mov    (%rax),%rax
+    15ca:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    15ce:	72 22                	jb     15f2 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    15d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15d4:	48 8b 00             	mov    (%rax),%rax
+    15d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    15db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15df:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    15e3:	73 c7                	jae    15ac <free+0x57>
+    15e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e9:	48 8b 00             	mov    (%rax),%rax
+    15ec:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    15f0:	73 ba                	jae    15ac <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    15f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    15f6:	8b 40 08             	mov    0x8(%rax),%eax
+    15f9:	89 c0                	mov    %eax,%eax
+    15fb:	48 c1 e0 04          	shl    $0x4,%rax
+    15ff:	48 89 c2             	mov    %rax,%rdx
+    1602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1606:	48 01 c2             	add    %rax,%rdx
+    1609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160d:	48 8b 00             	mov    (%rax),%rax
+    1610:	48 39 c2             	cmp    %rax,%rdx
+    1613:	75 2d                	jne    1642 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1615:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1619:	8b 50 08             	mov    0x8(%rax),%edx
+    161c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1620:	48 8b 00             	mov    (%rax),%rax
+    1623:	8b 40 08             	mov    0x8(%rax),%eax
+    1626:	01 c2                	add    %eax,%edx
+    1628:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    162c:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    162f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1633:	48 8b 00             	mov    (%rax),%rax
+    1636:	48 8b 10             	mov    (%rax),%rdx
+    1639:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    163d:	48 89 10             	mov    %rdx,(%rax)
+    1640:	eb 0e                	jmp    1650 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1646:	48 8b 10             	mov    (%rax),%rdx
+    1649:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    164d:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1650:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1654:	8b 40 08             	mov    0x8(%rax),%eax
+    1657:	89 c0                	mov    %eax,%eax
+    1659:	48 c1 e0 04          	shl    $0x4,%rax
+    165d:	48 89 c2             	mov    %rax,%rdx
+    1660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1664:	48 01 d0             	add    %rdx,%rax
+    1667:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    166b:	75 27                	jne    1694 <free+0x13f>
+    p->s.size += bp->s.size;
+    166d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1671:	8b 50 08             	mov    0x8(%rax),%edx
+    1674:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1678:	8b 40 08             	mov    0x8(%rax),%eax
+    167b:	01 c2                	add    %eax,%edx
+    167d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1681:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1684:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1688:	48 8b 10             	mov    (%rax),%rdx
+    168b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168f:	48 89 10             	mov    %rdx,(%rax)
+    1692:	eb 0b                	jmp    169f <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1694:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1698:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    169c:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    169f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a3:	48 89 05 06 08 00 00 	mov    %rax,0x806(%rip)        # 1eb0 <freep>
+}
+    16aa:	c9                   	leave
+    16ab:	c3                   	ret
+
+00000000000016ac <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    16ac:	55                   	push   %rbp
+    16ad:	48 89 e5             	mov    %rsp,%rbp
+    16b0:	48 83 ec 20          	sub    $0x20,%rsp
+    16b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    16b7:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    16be:	77 07                	ja     16c7 <morecore+0x1b>
+    nu = 4096;
+    16c0:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    16c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    16ca:	c1 e0 04             	shl    $0x4,%eax
+    16cd:	89 c7                	mov    %eax,%edi
+    16cf:	e8 ea fd ff ff       	call   14be <sbrk>
+    16d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    16d8:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    16dd:	75 07                	jne    16e6 <morecore+0x3a>
+    return 0;
+    16df:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e4:	eb 29                	jmp    170f <morecore+0x63>
+  hp = (Header*)p;
+    16e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    16ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    16f5:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    16f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16fc:	48 83 c0 10          	add    $0x10,%rax
+    1700:	48 89 c7             	mov    %rax,%rdi
+    1703:	e8 4d fe ff ff       	call   1555 <free>
+  return freep;
+    1708:	48 8b 05 a1 07 00 00 	mov    0x7a1(%rip),%rax        # 1eb0 <freep>
+}
+    170f:	c9                   	leave
+    1710:	c3                   	ret
+
+0000000000001711 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1711:	55                   	push   %rbp
+    1712:	48 89 e5             	mov    %rsp,%rbp
+    1715:	48 83 ec 30          	sub    $0x30,%rsp
+    1719:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    171c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    171f:	48 83 c0 0f          	add    $0xf,%rax
+    1723:	48 c1 e8 04          	shr    $0x4,%rax
+    1727:	83 c0 01             	add    $0x1,%eax
+    172a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    172d:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1734:	76 62                	jbe    1798 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1736:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1739:	c1 e0 04             	shl    $0x4,%eax
+    173c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1742:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1748:	b9 22 00 00 00       	mov    $0x22,%ecx
+    174d:	ba 03 00 00 00       	mov    $0x3,%edx
+    1752:	89 c6                	mov    %eax,%esi
+    1754:	bf 00 00 00 00       	mov    $0x0,%edi
+    1759:	e8 98 fd ff ff       	call   14f6 <mmap2>
+    175e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1762:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1767:	75 0a                	jne    1773 <malloc+0x62>
+      return 0;
+    1769:	b8 00 00 00 00       	mov    $0x0,%eax
+    176e:	e9 1c 01 00 00       	jmp    188f <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1777:	48 8d 15 42 07 00 00 	lea    0x742(%rip),%rdx        # 1ec0 <bigblock>
+    177e:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1781:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1785:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1788:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    178b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178f:	48 83 c0 10          	add    $0x10,%rax
+    1793:	e9 f7 00 00 00       	jmp    188f <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1798:	48 8b 05 11 07 00 00 	mov    0x711(%rip),%rax        # 1eb0 <freep>
+    179f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17a3:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    17a8:	75 2e                	jne    17d8 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    17aa:	48 8d 05 ef 06 00 00 	lea    0x6ef(%rip),%rax        # 1ea0 <base>
+    17b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    17b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17b9:	48 89 05 f0 06 00 00 	mov    %rax,0x6f0(%rip)        # 1eb0 <freep>
+    17c0:	48 8b 05 e9 06 00 00 	mov    0x6e9(%rip),%rax        # 1eb0 <freep>
+    17c7:	48 89 05 d2 06 00 00 	mov    %rax,0x6d2(%rip)        # 1ea0 <base>
+    base.s.size = 0;
+    17ce:	c7 05 d0 06 00 00 00 	movl   $0x0,0x6d0(%rip)        # 1ea8 <base+0x8>
+    17d5:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17dc:	48 8b 00             	mov    (%rax),%rax
+    17df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    17e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17e7:	8b 40 08             	mov    0x8(%rax),%eax
+    17ea:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    17ed:	72 5f                	jb     184e <malloc+0x13d>
+      if(p->s.size == nunits)
+    17ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17f3:	8b 40 08             	mov    0x8(%rax),%eax
+    17f6:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    17f9:	75 10                	jne    180b <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    17fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ff:	48 8b 10             	mov    (%rax),%rdx
+    1802:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1806:	48 89 10             	mov    %rdx,(%rax)
+    1809:	eb 2e                	jmp    1839 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    180b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    180f:	8b 40 08             	mov    0x8(%rax),%eax
+    1812:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1815:	89 c2                	mov    %eax,%edx
+    1817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    181b:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    181e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1822:	8b 40 08             	mov    0x8(%rax),%eax
+    1825:	89 c0                	mov    %eax,%eax
+    1827:	48 c1 e0 04          	shl    $0x4,%rax
+    182b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    182f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1833:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1836:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    183d:	48 89 05 6c 06 00 00 	mov    %rax,0x66c(%rip)        # 1eb0 <freep>
+      return (void*)(p + 1);
+    1844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1848:	48 83 c0 10          	add    $0x10,%rax
+    184c:	eb 41                	jmp    188f <malloc+0x17e>
+    }
+    if(p == freep)
+    184e:	48 8b 05 5b 06 00 00 	mov    0x65b(%rip),%rax        # 1eb0 <freep>
+    1855:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1859:	75 1c                	jne    1877 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    185b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    185e:	89 c7                	mov    %eax,%edi
+    1860:	e8 47 fe ff ff       	call   16ac <morecore>
+    1865:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1869:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    186e:	75 07                	jne    1877 <malloc+0x166>
+        return 0;
+    1870:	b8 00 00 00 00       	mov    $0x0,%eax
+    1875:	eb 18                	jmp    188f <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1877:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    187b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    187f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1883:	48 8b 00             	mov    (%rax),%rax
+    1886:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    188a:	e9 54 ff ff ff       	jmp    17e3 <malloc+0xd2>
+  }
+}
+    188f:	c9                   	leave
+    1890:	c3                   	ret
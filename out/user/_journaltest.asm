@@ -0,0 +1,1916 @@
+
+out/user/_journaltest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <get_progress>:
+int stdout = 1;
+int state;
+
+void
+get_progress(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  if ((fd = open("jprogress.txt", O_RDONLY)) < 0) {
+       8:	be 00 00 00 00       	mov    $0x0,%esi
+       d:	48 8d 05 6c 12 00 00 	lea    0x126c(%rip),%rax        # 1280 <malloc+0x181>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 48 0e 00 00       	call   e64 <open>
+      1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      23:	0f 89 ab 00 00 00    	jns    d4 <get_progress+0xd4>
+    // first run
+    state = 1;
+      29:	c7 05 cd 17 00 00 01 	movl   $0x1,0x17cd(%rip)        # 1800 <state>
+      30:	00 00 00 
+    if ((fd = open("jprogress.txt", O_CREATE | O_RDWR)) < 0)
+      33:	be 02 02 00 00       	mov    $0x202,%esi
+      38:	48 8d 05 41 12 00 00 	lea    0x1241(%rip),%rax        # 1280 <malloc+0x181>
+      3f:	48 89 c7             	mov    %rax,%rdi
+      42:	e8 1d 0e 00 00       	call   e64 <open>
+      47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      4e:	79 5c                	jns    ac <get_progress+0xac>
+      error("unable to create jprogress.txt");
+      50:	8b 05 0a 17 00 00    	mov    0x170a(%rip),%eax        # 1760 <stdout>
+      56:	ba 31 00 00 00       	mov    $0x31,%edx
+      5b:	48 8d 0d 2c 12 00 00 	lea    0x122c(%rip),%rcx        # 128e <malloc+0x18f>
+      62:	48 89 ce             	mov    %rcx,%rsi
+      65:	89 c7                	mov    %eax,%edi
+      67:	b8 00 00 00 00       	mov    $0x0,%eax
+      6c:	e8 0c 08 00 00       	call   87d <printf>
+      71:	8b 05 e9 16 00 00    	mov    0x16e9(%rip),%eax        # 1760 <stdout>
+      77:	48 8d 15 22 12 00 00 	lea    0x1222(%rip),%rdx        # 12a0 <malloc+0x1a1>
+      7e:	48 89 d6             	mov    %rdx,%rsi
+      81:	89 c7                	mov    %eax,%edi
+      83:	b8 00 00 00 00       	mov    $0x0,%eax
+      88:	e8 f0 07 00 00       	call   87d <printf>
+      8d:	8b 05 cd 16 00 00    	mov    0x16cd(%rip),%eax        # 1760 <stdout>
+      93:	48 8d 15 25 12 00 00 	lea    0x1225(%rip),%rdx        # 12bf <malloc+0x1c0>
+      9a:	48 89 d6             	mov    %rdx,%rsi
+      9d:	89 c7                	mov    %eax,%edi
+      9f:	b8 00 00 00 00       	mov    $0x0,%eax
+      a4:	e8 d4 07 00 00       	call   87d <printf>
+      a9:	90                   	nop
+      aa:	eb fd                	jmp    a9 <get_progress+0xa9>
+    write(fd, &state, sizeof(int));
+      ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      af:	ba 04 00 00 00       	mov    $0x4,%edx
+      b4:	48 8d 0d 45 17 00 00 	lea    0x1745(%rip),%rcx        # 1800 <state>
+      bb:	48 89 ce             	mov    %rcx,%rsi
+      be:	89 c7                	mov    %eax,%edi
+      c0:	e8 7f 0d 00 00       	call   e44 <write>
+    close(fd);
+      c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      c8:	89 c7                	mov    %eax,%edi
+      ca:	e8 7d 0d 00 00       	call   e4c <close>
+    return;
+      cf:	e9 d5 00 00 00       	jmp    1a9 <get_progress+0x1a9>
+  }
+  read(fd, &state, sizeof(int));
+      d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      d7:	ba 04 00 00 00       	mov    $0x4,%edx
+      dc:	48 8d 0d 1d 17 00 00 	lea    0x171d(%rip),%rcx        # 1800 <state>
+      e3:	48 89 ce             	mov    %rcx,%rsi
+      e6:	89 c7                	mov    %eax,%edi
+      e8:	e8 4f 0d 00 00       	call   e3c <read>
+  close(fd);
+      ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      f0:	89 c7                	mov    %eax,%edi
+      f2:	e8 55 0d 00 00       	call   e4c <close>
+
+  if (state > 1000)
+      f7:	8b 05 03 17 00 00    	mov    0x1703(%rip),%eax        # 1800 <state>
+      fd:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     102:	7e 5c                	jle    160 <get_progress+0x160>
+    error("too many steps before operating is complete");
+     104:	8b 05 56 16 00 00    	mov    0x1656(%rip),%eax        # 1760 <stdout>
+     10a:	ba 3a 00 00 00       	mov    $0x3a,%edx
+     10f:	48 8d 0d 78 11 00 00 	lea    0x1178(%rip),%rcx        # 128e <malloc+0x18f>
+     116:	48 89 ce             	mov    %rcx,%rsi
+     119:	89 c7                	mov    %eax,%edi
+     11b:	b8 00 00 00 00       	mov    $0x0,%eax
+     120:	e8 58 07 00 00       	call   87d <printf>
+     125:	8b 05 35 16 00 00    	mov    0x1635(%rip),%eax        # 1760 <stdout>
+     12b:	48 8d 15 96 11 00 00 	lea    0x1196(%rip),%rdx        # 12c8 <malloc+0x1c9>
+     132:	48 89 d6             	mov    %rdx,%rsi
+     135:	89 c7                	mov    %eax,%edi
+     137:	b8 00 00 00 00       	mov    $0x0,%eax
+     13c:	e8 3c 07 00 00       	call   87d <printf>
+     141:	8b 05 19 16 00 00    	mov    0x1619(%rip),%eax        # 1760 <stdout>
+     147:	48 8d 15 71 11 00 00 	lea    0x1171(%rip),%rdx        # 12bf <malloc+0x1c0>
+     14e:	48 89 d6             	mov    %rdx,%rsi
+     151:	89 c7                	mov    %eax,%edi
+     153:	b8 00 00 00 00       	mov    $0x0,%eax
+     158:	e8 20 07 00 00       	call   87d <printf>
+     15d:	90                   	nop
+     15e:	eb fd                	jmp    15d <get_progress+0x15d>
+
+  state++;
+     160:	8b 05 9a 16 00 00    	mov    0x169a(%rip),%eax        # 1800 <state>
+     166:	83 c0 01             	add    $0x1,%eax
+     169:	89 05 91 16 00 00    	mov    %eax,0x1691(%rip)        # 1800 <state>
+  fd = open("jprogress.txt", O_RDWR);
+     16f:	be 02 00 00 00       	mov    $0x2,%esi
+     174:	48 8d 05 05 11 00 00 	lea    0x1105(%rip),%rax        # 1280 <malloc+0x181>
+     17b:	48 89 c7             	mov    %rax,%rdi
+     17e:	e8 e1 0c 00 00       	call   e64 <open>
+     183:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  write(fd, &state, sizeof(int));
+     186:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     189:	ba 04 00 00 00       	mov    $0x4,%edx
+     18e:	48 8d 0d 6b 16 00 00 	lea    0x166b(%rip),%rcx        # 1800 <state>
+     195:	48 89 ce             	mov    %rcx,%rsi
+     198:	89 c7                	mov    %eax,%edi
+     19a:	e8 a5 0c 00 00       	call   e44 <write>
+  close(fd);
+     19f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1a2:	89 c7                	mov    %eax,%edi
+     1a4:	e8 a3 0c 00 00       	call   e4c <close>
+}
+     1a9:	c9                   	leave
+     1aa:	c3                   	ret
+
+00000000000001ab <check>:
+
+// journal.txt must hold whole chunks, chunk i filled with 'a' + i
+void
+check(void)
+{
+     1ab:	55                   	push   %rbp
+     1ac:	48 89 e5             	mov    %rsp,%rbp
+     1af:	48 83 ec 20          	sub    $0x20,%rsp
+  struct stat st;
+  int fd, i, j;
+
+  if ((fd = open("journal.txt", O_RDONLY)) < 0)
+     1b3:	be 00 00 00 00       	mov    $0x0,%esi
+     1b8:	48 8d 05 35 11 00 00 	lea    0x1135(%rip),%rax        # 12f4 <malloc+0x1f5>
+     1bf:	48 89 c7             	mov    %rax,%rdi
+     1c2:	e8 9d 0c 00 00       	call   e64 <open>
+     1c7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     1ce:	0f 88 b9 02 00 00    	js     48d <check+0x2e2>
+    return;
+  fstat(fd, &st);
+     1d4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+     1d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1db:	48 89 d6             	mov    %rdx,%rsi
+     1de:	89 c7                	mov    %eax,%edi
+     1e0:	e8 97 0c 00 00       	call   e7c <fstat>
+  if (st.size % CHUNK != 0)
+     1e5:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+     1e8:	89 ca                	mov    %ecx,%edx
+     1ea:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+     1ef:	48 0f af c2          	imul   %rdx,%rax
+     1f3:	48 c1 e8 20          	shr    $0x20,%rax
+     1f7:	89 c2                	mov    %eax,%edx
+     1f9:	c1 ea 0b             	shr    $0xb,%edx
+     1fc:	89 d0                	mov    %edx,%eax
+     1fe:	01 c0                	add    %eax,%eax
+     200:	01 d0                	add    %edx,%eax
+     202:	c1 e0 0a             	shl    $0xa,%eax
+     205:	29 c1                	sub    %eax,%ecx
+     207:	89 ca                	mov    %ecx,%edx
+     209:	85 d2                	test   %edx,%edx
+     20b:	74 5f                	je     26c <check+0xc1>
+    error("journal.txt has %d bytes, not whole writes", st.size);
+     20d:	8b 05 4d 15 00 00    	mov    0x154d(%rip),%eax        # 1760 <stdout>
+     213:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     218:	48 8d 0d 6f 10 00 00 	lea    0x106f(%rip),%rcx        # 128e <malloc+0x18f>
+     21f:	48 89 ce             	mov    %rcx,%rsi
+     222:	89 c7                	mov    %eax,%edi
+     224:	b8 00 00 00 00       	mov    $0x0,%eax
+     229:	e8 4f 06 00 00       	call   87d <printf>
+     22e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     231:	8b 05 29 15 00 00    	mov    0x1529(%rip),%eax        # 1760 <stdout>
+     237:	48 8d 0d c2 10 00 00 	lea    0x10c2(%rip),%rcx        # 1300 <malloc+0x201>
+     23e:	48 89 ce             	mov    %rcx,%rsi
+     241:	89 c7                	mov    %eax,%edi
+     243:	b8 00 00 00 00       	mov    $0x0,%eax
+     248:	e8 30 06 00 00       	call   87d <printf>
+     24d:	8b 05 0d 15 00 00    	mov    0x150d(%rip),%eax        # 1760 <stdout>
+     253:	48 8d 15 65 10 00 00 	lea    0x1065(%rip),%rdx        # 12bf <malloc+0x1c0>
+     25a:	48 89 d6             	mov    %rdx,%rsi
+     25d:	89 c7                	mov    %eax,%edi
+     25f:	b8 00 00 00 00       	mov    $0x0,%eax
+     264:	e8 14 06 00 00       	call   87d <printf>
+     269:	90                   	nop
+     26a:	eb fd                	jmp    269 <check+0xbe>
+  if (st.size > NCHUNK * CHUNK)
+     26c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     26f:	3d 00 30 00 00       	cmp    $0x3000,%eax
+     274:	76 5f                	jbe    2d5 <check+0x12a>
+    error("journal.txt has %d bytes, more than was written", st.size);
+     276:	8b 05 e4 14 00 00    	mov    0x14e4(%rip),%eax        # 1760 <stdout>
+     27c:	ba 4f 00 00 00       	mov    $0x4f,%edx
+     281:	48 8d 0d 06 10 00 00 	lea    0x1006(%rip),%rcx        # 128e <malloc+0x18f>
+     288:	48 89 ce             	mov    %rcx,%rsi
+     28b:	89 c7                	mov    %eax,%edi
+     28d:	b8 00 00 00 00       	mov    $0x0,%eax
+     292:	e8 e6 05 00 00       	call   87d <printf>
+     297:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     29a:	8b 05 c0 14 00 00    	mov    0x14c0(%rip),%eax        # 1760 <stdout>
+     2a0:	48 8d 0d 89 10 00 00 	lea    0x1089(%rip),%rcx        # 1330 <malloc+0x231>
+     2a7:	48 89 ce             	mov    %rcx,%rsi
+     2aa:	89 c7                	mov    %eax,%edi
+     2ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b1:	e8 c7 05 00 00       	call   87d <printf>
+     2b6:	8b 05 a4 14 00 00    	mov    0x14a4(%rip),%eax        # 1760 <stdout>
+     2bc:	48 8d 15 fc 0f 00 00 	lea    0xffc(%rip),%rdx        # 12bf <malloc+0x1c0>
+     2c3:	48 89 d6             	mov    %rdx,%rsi
+     2c6:	89 c7                	mov    %eax,%edi
+     2c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cd:	e8 ab 05 00 00       	call   87d <printf>
+     2d2:	90                   	nop
+     2d3:	eb fd                	jmp    2d2 <check+0x127>
+
+  for (i = 0; i < st.size / CHUNK; i++) {
+     2d5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2dc:	e9 3b 01 00 00       	jmp    41c <check+0x271>
+    if (read(fd, buf, CHUNK) != CHUNK)
+     2e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2e4:	ba 00 0c 00 00       	mov    $0xc00,%edx
+     2e9:	48 8d 0d 30 15 00 00 	lea    0x1530(%rip),%rcx        # 1820 <buf>
+     2f0:	48 89 ce             	mov    %rcx,%rsi
+     2f3:	89 c7                	mov    %eax,%edi
+     2f5:	e8 42 0b 00 00       	call   e3c <read>
+     2fa:	3d 00 0c 00 00       	cmp    $0xc00,%eax
+     2ff:	74 5f                	je     360 <check+0x1b5>
+      error("unable to read chunk %d of journal.txt", i);
+     301:	8b 05 59 14 00 00    	mov    0x1459(%rip),%eax        # 1760 <stdout>
+     307:	ba 53 00 00 00       	mov    $0x53,%edx
+     30c:	48 8d 0d 7b 0f 00 00 	lea    0xf7b(%rip),%rcx        # 128e <malloc+0x18f>
+     313:	48 89 ce             	mov    %rcx,%rsi
+     316:	89 c7                	mov    %eax,%edi
+     318:	b8 00 00 00 00       	mov    $0x0,%eax
+     31d:	e8 5b 05 00 00       	call   87d <printf>
+     322:	8b 05 38 14 00 00    	mov    0x1438(%rip),%eax        # 1760 <stdout>
+     328:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     32b:	48 8d 0d 2e 10 00 00 	lea    0x102e(%rip),%rcx        # 1360 <malloc+0x261>
+     332:	48 89 ce             	mov    %rcx,%rsi
+     335:	89 c7                	mov    %eax,%edi
+     337:	b8 00 00 00 00       	mov    $0x0,%eax
+     33c:	e8 3c 05 00 00       	call   87d <printf>
+     341:	8b 05 19 14 00 00    	mov    0x1419(%rip),%eax        # 1760 <stdout>
+     347:	48 8d 15 71 0f 00 00 	lea    0xf71(%rip),%rdx        # 12bf <malloc+0x1c0>
+     34e:	48 89 d6             	mov    %rdx,%rsi
+     351:	89 c7                	mov    %eax,%edi
+     353:	b8 00 00 00 00       	mov    $0x0,%eax
+     358:	e8 20 05 00 00       	call   87d <printf>
+     35d:	90                   	nop
+     35e:	eb fd                	jmp    35d <check+0x1b2>
+    for (j = 0; j < CHUNK; j++) {
+     360:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     367:	e9 9f 00 00 00       	jmp    40b <check+0x260>
+      if (buf[j] != 'a' + i)
+     36c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     36f:	48 98                	cltq
+     371:	48 8d 15 a8 14 00 00 	lea    0x14a8(%rip),%rdx        # 1820 <buf>
+     378:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     37c:	0f be d0             	movsbl %al,%edx
+     37f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     382:	83 c0 61             	add    $0x61,%eax
+     385:	39 c2                	cmp    %eax,%edx
+     387:	74 7e                	je     407 <check+0x25c>
+        error("chunk %d of journal.txt has %d at %d, not %c",
+     389:	8b 05 d1 13 00 00    	mov    0x13d1(%rip),%eax        # 1760 <stdout>
+     38f:	ba 56 00 00 00       	mov    $0x56,%edx
+     394:	48 8d 0d f3 0e 00 00 	lea    0xef3(%rip),%rcx        # 128e <malloc+0x18f>
+     39b:	48 89 ce             	mov    %rcx,%rsi
+     39e:	89 c7                	mov    %eax,%edi
+     3a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3a5:	e8 d3 04 00 00       	call   87d <printf>
+     3aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3ad:	8d 78 61             	lea    0x61(%rax),%edi
+     3b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3b3:	48 98                	cltq
+     3b5:	48 8d 15 64 14 00 00 	lea    0x1464(%rip),%rdx        # 1820 <buf>
+     3bc:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     3c0:	0f be c8             	movsbl %al,%ecx
+     3c3:	8b 05 97 13 00 00    	mov    0x1397(%rip),%eax        # 1760 <stdout>
+     3c9:	8b 75 f8             	mov    -0x8(%rbp),%esi
+     3cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     3cf:	41 89 f9             	mov    %edi,%r9d
+     3d2:	41 89 f0             	mov    %esi,%r8d
+     3d5:	48 8d 35 ac 0f 00 00 	lea    0xfac(%rip),%rsi        # 1388 <malloc+0x289>
+     3dc:	89 c7                	mov    %eax,%edi
+     3de:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e3:	e8 95 04 00 00       	call   87d <printf>
+     3e8:	8b 05 72 13 00 00    	mov    0x1372(%rip),%eax        # 1760 <stdout>
+     3ee:	48 8d 15 ca 0e 00 00 	lea    0xeca(%rip),%rdx        # 12bf <malloc+0x1c0>
+     3f5:	48 89 d6             	mov    %rdx,%rsi
+     3f8:	89 c7                	mov    %eax,%edi
+     3fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ff:	e8 79 04 00 00       	call   87d <printf>
+     404:	90                   	nop
+     405:	eb fd                	jmp    404 <check+0x259>
+    for (j = 0; j < CHUNK; j++) {
+     407:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     40b:	81 7d f8 ff 0b 00 00 	cmpl   $0xbff,-0x8(%rbp)
+     412:	0f 8e 54 ff ff ff    	jle    36c <check+0x1c1>
+  for (i = 0; i < st.size / CHUNK; i++) {
+     418:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     41c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     41f:	89 c2                	mov    %eax,%edx
+     421:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+     426:	48 0f af c2          	imul   %rdx,%rax
+     42a:	48 c1 e8 20          	shr    $0x20,%rax
+     42e:	c1 e8 0b             	shr    $0xb,%eax
+     431:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     434:	39 c2                	cmp    %eax,%edx
+     436:	0f 82 a5 fe ff ff    	jb     2e1 <check+0x136>
+              i, buf[j], j, 'a' + i);
+    }
+  }
+  close(fd);
+     43c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     43f:	89 c7                	mov    %eax,%edi
+     441:	e8 06 0a 00 00       	call   e4c <close>
+
+  if (st.size == NCHUNK * CHUNK) {
+     446:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     449:	3d 00 30 00 00       	cmp    $0x3000,%eax
+     44e:	75 3e                	jne    48e <check+0x2e3>
+    printf(stdout, "journal.txt is completely written\n");
+     450:	8b 05 0a 13 00 00    	mov    0x130a(%rip),%eax        # 1760 <stdout>
+     456:	48 8d 15 5b 0f 00 00 	lea    0xf5b(%rip),%rdx        # 13b8 <malloc+0x2b9>
+     45d:	48 89 d6             	mov    %rdx,%rsi
+     460:	89 c7                	mov    %eax,%edi
+     462:	b8 00 00 00 00       	mov    $0x0,%eax
+     467:	e8 11 04 00 00       	call   87d <printf>
+    printf(stdout, "journaltest passed!\n");
+     46c:	8b 05 ee 12 00 00    	mov    0x12ee(%rip),%eax        # 1760 <stdout>
+     472:	48 8d 15 62 0f 00 00 	lea    0xf62(%rip),%rdx        # 13db <malloc+0x2dc>
+     479:	48 89 d6             	mov    %rdx,%rsi
+     47c:	89 c7                	mov    %eax,%edi
+     47e:	b8 00 00 00 00       	mov    $0x0,%eax
+     483:	e8 f5 03 00 00       	call   87d <printf>
+    exit();
+     488:	e8 97 09 00 00       	call   e24 <exit>
+    return;
+     48d:	90                   	nop
+  }
+}
+     48e:	c9                   	leave
+     48f:	c3                   	ret
+
+0000000000000490 <crashwrite>:
+
+// start over from an empty file, then crash on the disk write after
+// steps more
+void
+crashwrite(int steps)
+{
+     490:	55                   	push   %rbp
+     491:	48 89 e5             	mov    %rsp,%rbp
+     494:	48 83 ec 20          	sub    $0x20,%rsp
+     498:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int fd, i;
+
+  unlink("journal.txt");
+     49b:	48 8d 05 52 0e 00 00 	lea    0xe52(%rip),%rax        # 12f4 <malloc+0x1f5>
+     4a2:	48 89 c7             	mov    %rax,%rdi
+     4a5:	e8 ca 09 00 00       	call   e74 <unlink>
+  crashn(steps);
+     4aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     4ad:	89 c7                	mov    %eax,%edi
+     4af:	e8 28 0a 00 00       	call   edc <crashn>
+  printf(stdout, "crash after %d steps\n", steps);
+     4b4:	8b 05 a6 12 00 00    	mov    0x12a6(%rip),%eax        # 1760 <stdout>
+     4ba:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     4bd:	48 8d 0d 2c 0f 00 00 	lea    0xf2c(%rip),%rcx        # 13f0 <malloc+0x2f1>
+     4c4:	48 89 ce             	mov    %rcx,%rsi
+     4c7:	89 c7                	mov    %eax,%edi
+     4c9:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ce:	e8 aa 03 00 00       	call   87d <printf>
+  if ((fd = open("journal.txt", O_CREATE | O_RDWR)) < 0)
+     4d3:	be 02 02 00 00       	mov    $0x202,%esi
+     4d8:	48 8d 05 15 0e 00 00 	lea    0xe15(%rip),%rax        # 12f4 <malloc+0x1f5>
+     4df:	48 89 c7             	mov    %rax,%rdi
+     4e2:	e8 7d 09 00 00       	call   e64 <open>
+     4e7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     4ea:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     4ee:	79 5c                	jns    54c <crashwrite+0xbc>
+    error("unable to create journal.txt");
+     4f0:	8b 05 6a 12 00 00    	mov    0x126a(%rip),%eax        # 1760 <stdout>
+     4f6:	ba 6e 00 00 00       	mov    $0x6e,%edx
+     4fb:	48 8d 0d 8c 0d 00 00 	lea    0xd8c(%rip),%rcx        # 128e <malloc+0x18f>
+     502:	48 89 ce             	mov    %rcx,%rsi
+     505:	89 c7                	mov    %eax,%edi
+     507:	b8 00 00 00 00       	mov    $0x0,%eax
+     50c:	e8 6c 03 00 00       	call   87d <printf>
+     511:	8b 05 49 12 00 00    	mov    0x1249(%rip),%eax        # 1760 <stdout>
+     517:	48 8d 15 e8 0e 00 00 	lea    0xee8(%rip),%rdx        # 1406 <malloc+0x307>
+     51e:	48 89 d6             	mov    %rdx,%rsi
+     521:	89 c7                	mov    %eax,%edi
+     523:	b8 00 00 00 00       	mov    $0x0,%eax
+     528:	e8 50 03 00 00       	call   87d <printf>
+     52d:	8b 05 2d 12 00 00    	mov    0x122d(%rip),%eax        # 1760 <stdout>
+     533:	48 8d 15 85 0d 00 00 	lea    0xd85(%rip),%rdx        # 12bf <malloc+0x1c0>
+     53a:	48 89 d6             	mov    %rdx,%rsi
+     53d:	89 c7                	mov    %eax,%edi
+     53f:	b8 00 00 00 00       	mov    $0x0,%eax
+     544:	e8 34 03 00 00       	call   87d <printf>
+     549:	90                   	nop
+     54a:	eb fd                	jmp    549 <crashwrite+0xb9>
+  for (i = 0; i < NCHUNK; i++) {
+     54c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     553:	e9 9f 00 00 00       	jmp    5f7 <crashwrite+0x167>
+    memset(buf, 'a' + i, CHUNK);
+     558:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     55b:	83 c0 61             	add    $0x61,%eax
+     55e:	ba 00 0c 00 00       	mov    $0xc00,%edx
+     563:	89 c6                	mov    %eax,%esi
+     565:	48 8d 05 b4 12 00 00 	lea    0x12b4(%rip),%rax        # 1820 <buf>
+     56c:	48 89 c7             	mov    %rax,%rdi
+     56f:	e8 c7 06 00 00       	call   c3b <memset>
+    if (write(fd, buf, CHUNK) != CHUNK)
+     574:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     577:	ba 00 0c 00 00       	mov    $0xc00,%edx
+     57c:	48 8d 0d 9d 12 00 00 	lea    0x129d(%rip),%rcx        # 1820 <buf>
+     583:	48 89 ce             	mov    %rcx,%rsi
+     586:	89 c7                	mov    %eax,%edi
+     588:	e8 b7 08 00 00       	call   e44 <write>
+     58d:	3d 00 0c 00 00       	cmp    $0xc00,%eax
+     592:	74 5f                	je     5f3 <crashwrite+0x163>
+      error("unable to write chunk %d of journal.txt", i);
+     594:	8b 05 c6 11 00 00    	mov    0x11c6(%rip),%eax        # 1760 <stdout>
+     59a:	ba 72 00 00 00       	mov    $0x72,%edx
+     59f:	48 8d 0d e8 0c 00 00 	lea    0xce8(%rip),%rcx        # 128e <malloc+0x18f>
+     5a6:	48 89 ce             	mov    %rcx,%rsi
+     5a9:	89 c7                	mov    %eax,%edi
+     5ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     5b0:	e8 c8 02 00 00       	call   87d <printf>
+     5b5:	8b 05 a5 11 00 00    	mov    0x11a5(%rip),%eax        # 1760 <stdout>
+     5bb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5be:	48 8d 0d 63 0e 00 00 	lea    0xe63(%rip),%rcx        # 1428 <malloc+0x329>
+     5c5:	48 89 ce             	mov    %rcx,%rsi
+     5c8:	89 c7                	mov    %eax,%edi
+     5ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cf:	e8 a9 02 00 00       	call   87d <printf>
+     5d4:	8b 05 86 11 00 00    	mov    0x1186(%rip),%eax        # 1760 <stdout>
+     5da:	48 8d 15 de 0c 00 00 	lea    0xcde(%rip),%rdx        # 12bf <malloc+0x1c0>
+     5e1:	48 89 d6             	mov    %rdx,%rsi
+     5e4:	89 c7                	mov    %eax,%edi
+     5e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     5eb:	e8 8d 02 00 00       	call   87d <printf>
+     5f0:	90                   	nop
+     5f1:	eb fd                	jmp    5f0 <crashwrite+0x160>
+  for (i = 0; i < NCHUNK; i++) {
+     5f3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     5f7:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+     5fb:	0f 8e 57 ff ff ff    	jle    558 <crashwrite+0xc8>
+  }
+  close(fd);
+     601:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     604:	89 c7                	mov    %eax,%edi
+     606:	e8 41 08 00 00       	call   e4c <close>
+  // made it without crashing, nothing more to count
+  crashn(1 << 30);
+     60b:	bf 00 00 00 40       	mov    $0x40000000,%edi
+     610:	e8 c7 08 00 00       	call   edc <crashn>
+}
+     615:	90                   	nop
+     616:	c9                   	leave
+     617:	c3                   	ret
+
+0000000000000618 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     618:	55                   	push   %rbp
+     619:	48 89 e5             	mov    %rsp,%rbp
+     61c:	48 83 ec 10          	sub    $0x10,%rsp
+     620:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     623:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "journaltest starting\n");
+     627:	8b 05 33 11 00 00    	mov    0x1133(%rip),%eax        # 1760 <stdout>
+     62d:	48 8d 15 1c 0e 00 00 	lea    0xe1c(%rip),%rdx        # 1450 <malloc+0x351>
+     634:	48 89 d6             	mov    %rdx,%rsi
+     637:	89 c7                	mov    %eax,%edi
+     639:	b8 00 00 00 00       	mov    $0x0,%eax
+     63e:	e8 3a 02 00 00       	call   87d <printf>
+  check();
+     643:	e8 63 fb ff ff       	call   1ab <check>
+  get_progress();
+     648:	e8 b3 f9 ff ff       	call   0 <get_progress>
+  crashwrite(state);
+     64d:	8b 05 ad 11 00 00    	mov    0x11ad(%rip),%eax        # 1800 <state>
+     653:	89 c7                	mov    %eax,%edi
+     655:	e8 36 fe ff ff       	call   490 <crashwrite>
+  check();
+     65a:	e8 4c fb ff ff       	call   1ab <check>
+  error("journal.txt is not complete after all writes returned");
+     65f:	8b 05 fb 10 00 00    	mov    0x10fb(%rip),%eax        # 1760 <stdout>
+     665:	ba 81 00 00 00       	mov    $0x81,%edx
+     66a:	48 8d 0d 1d 0c 00 00 	lea    0xc1d(%rip),%rcx        # 128e <malloc+0x18f>
+     671:	48 89 ce             	mov    %rcx,%rsi
+     674:	89 c7                	mov    %eax,%edi
+     676:	b8 00 00 00 00       	mov    $0x0,%eax
+     67b:	e8 fd 01 00 00       	call   87d <printf>
+     680:	8b 05 da 10 00 00    	mov    0x10da(%rip),%eax        # 1760 <stdout>
+     686:	48 8d 15 db 0d 00 00 	lea    0xddb(%rip),%rdx        # 1468 <malloc+0x369>
+     68d:	48 89 d6             	mov    %rdx,%rsi
+     690:	89 c7                	mov    %eax,%edi
+     692:	b8 00 00 00 00       	mov    $0x0,%eax
+     697:	e8 e1 01 00 00       	call   87d <printf>
+     69c:	8b 05 be 10 00 00    	mov    0x10be(%rip),%eax        # 1760 <stdout>
+     6a2:	48 8d 15 16 0c 00 00 	lea    0xc16(%rip),%rdx        # 12bf <malloc+0x1c0>
+     6a9:	48 89 d6             	mov    %rdx,%rsi
+     6ac:	89 c7                	mov    %eax,%edi
+     6ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     6b3:	e8 c5 01 00 00       	call   87d <printf>
+     6b8:	90                   	nop
+     6b9:	eb fd                	jmp    6b8 <main+0xa0>
+
+00000000000006bb <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     6bb:	55                   	push   %rbp
+     6bc:	48 89 e5             	mov    %rsp,%rbp
+     6bf:	48 83 ec 10          	sub    $0x10,%rsp
+     6c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     6c6:	89 f0                	mov    %esi,%eax
+     6c8:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     6cb:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     6cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6d2:	ba 01 00 00 00       	mov    $0x1,%edx
+     6d7:	48 89 ce             	mov    %rcx,%rsi
+     6da:	89 c7                	mov    %eax,%edi
+     6dc:	e8 63 07 00 00       	call   e44 <write>
+}
+     6e1:	90                   	nop
+     6e2:	c9                   	leave
+     6e3:	c3                   	ret
+
+00000000000006e4 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     6e4:	55                   	push   %rbp
+     6e5:	48 89 e5             	mov    %rsp,%rbp
+     6e8:	48 83 ec 40          	sub    $0x40,%rsp
+     6ec:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     6ef:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     6f2:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     6f5:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     6f8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     6fc:	74 1f                	je     71d <printint64+0x39>
+     6fe:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     701:	c1 e8 1f             	shr    $0x1f,%eax
+     704:	0f b6 c0             	movzbl %al,%eax
+     707:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     70a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     70e:	74 0d                	je     71d <printint64+0x39>
+    x = -xx;
+     710:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     713:	f7 d8                	neg    %eax
+     715:	48 98                	cltq
+     717:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     71b:	eb 09                	jmp    726 <printint64+0x42>
+  else
+    x = xx;
+     71d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     720:	48 98                	cltq
+     722:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     726:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     72d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     730:	48 63 c8             	movslq %eax,%rcx
+     733:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     737:	ba 00 00 00 00       	mov    $0x0,%edx
+     73c:	48 f7 f1             	div    %rcx
+     73f:	48 89 d1             	mov    %rdx,%rcx
+     742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     745:	8d 50 01             	lea    0x1(%rax),%edx
+     748:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     74b:	48 8d 15 1e 10 00 00 	lea    0x101e(%rip),%rdx        # 1770 <digits.1>
+     752:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     756:	48 98                	cltq
+     758:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     75c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     75f:	48 63 f0             	movslq %eax,%rsi
+     762:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     766:	ba 00 00 00 00       	mov    $0x0,%edx
+     76b:	48 f7 f6             	div    %rsi
+     76e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     772:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     777:	75 b4                	jne    72d <printint64+0x49>
+
+  if(sgn)
+     779:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     77d:	74 2b                	je     7aa <printint64+0xc6>
+    buf[i++] = '-';
+     77f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     782:	8d 50 01             	lea    0x1(%rax),%edx
+     785:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     788:	48 98                	cltq
+     78a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     78f:	eb 19                	jmp    7aa <printint64+0xc6>
+    putc(fd, buf[i]);
+     791:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     794:	48 98                	cltq
+     796:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     79b:	0f be d0             	movsbl %al,%edx
+     79e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     7a1:	89 d6                	mov    %edx,%esi
+     7a3:	89 c7                	mov    %eax,%edi
+     7a5:	e8 11 ff ff ff       	call   6bb <putc>
+  while(--i >= 0)
+     7aa:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     7ae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7b2:	79 dd                	jns    791 <printint64+0xad>
+}
+     7b4:	90                   	nop
+     7b5:	90                   	nop
+     7b6:	c9                   	leave
+     7b7:	c3                   	ret
+
+00000000000007b8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     7b8:	55                   	push   %rbp
+     7b9:	48 89 e5             	mov    %rsp,%rbp
+     7bc:	48 83 ec 30          	sub    $0x30,%rsp
+     7c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     7c3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     7c6:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     7c9:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     7cc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     7d3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     7d7:	74 17                	je     7f0 <printint+0x38>
+     7d9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     7dd:	79 11                	jns    7f0 <printint+0x38>
+    neg = 1;
+     7df:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     7e6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7e9:	f7 d8                	neg    %eax
+     7eb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     7ee:	eb 06                	jmp    7f6 <printint+0x3e>
+  } else {
+    x = xx;
+     7f0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     7f3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     7f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     7fd:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     800:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     803:	ba 00 00 00 00       	mov    $0x0,%edx
+     808:	f7 f1                	div    %ecx
+     80a:	89 d1                	mov    %edx,%ecx
+     80c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     80f:	8d 50 01             	lea    0x1(%rax),%edx
+     812:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     815:	89 c9                	mov    %ecx,%ecx
+     817:	48 8d 15 72 0f 00 00 	lea    0xf72(%rip),%rdx        # 1790 <digits.0>
+     81e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     822:	48 98                	cltq
+     824:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     828:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     82b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     82e:	ba 00 00 00 00       	mov    $0x0,%edx
+     833:	f7 f6                	div    %esi
+     835:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     838:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     83c:	75 bf                	jne    7fd <printint+0x45>
+  if(neg)
+     83e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     842:	74 2b                	je     86f <printint+0xb7>
+    buf[i++] = '-';
+     844:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     847:	8d 50 01             	lea    0x1(%rax),%edx
+     84a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     84d:	48 98                	cltq
+     84f:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     854:	eb 19                	jmp    86f <printint+0xb7>
+    putc(fd, buf[i]);
+     856:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     859:	48 98                	cltq
+     85b:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     860:	0f be d0             	movsbl %al,%edx
+     863:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     866:	89 d6                	mov    %edx,%esi
+     868:	89 c7                	mov    %eax,%edi
+     86a:	e8 4c fe ff ff       	call   6bb <putc>
+  while(--i >= 0)
+     86f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     873:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     877:	79 dd                	jns    856 <printint+0x9e>
+}
+     879:	90                   	nop
+     87a:	90                   	nop
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+000000000000087d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     87d:	55                   	push   %rbp
+     87e:	48 89 e5             	mov    %rsp,%rbp
+     881:	48 83 ec 70          	sub    $0x70,%rsp
+     885:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     888:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     88c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     890:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     894:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     898:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     89c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     8a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     8a7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     8ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     8af:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     8b3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     8ba:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     8c1:	e9 6b 02 00 00       	jmp    b31 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     8c6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     8c9:	48 63 d0             	movslq %eax,%rdx
+     8cc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     8d0:	48 01 d0             	add    %rdx,%rax
+     8d3:	0f b6 00             	movzbl (%rax),%eax
+     8d6:	0f be c0             	movsbl %al,%eax
+     8d9:	25 ff 00 00 00       	and    $0xff,%eax
+     8de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     8e1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     8e5:	75 30                	jne    917 <printf+0x9a>
+      if(c == '%'){
+     8e7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     8eb:	75 13                	jne    900 <printf+0x83>
+        state = '%';
+     8ed:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     8f4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     8fb:	e9 2d 02 00 00       	jmp    b2d <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     903:	0f be d0             	movsbl %al,%edx
+     906:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     909:	89 d6                	mov    %edx,%esi
+     90b:	89 c7                	mov    %eax,%edi
+     90d:	e8 a9 fd ff ff       	call   6bb <putc>
+     912:	e9 16 02 00 00       	jmp    b2d <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     917:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     91b:	0f 85 0c 02 00 00    	jne    b2d <printf+0x2b0>
+      if(c == 'l') {
+     921:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     925:	75 0c                	jne    933 <printf+0xb6>
+        lflag = 1;
+     927:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     92e:	e9 fa 01 00 00       	jmp    b2d <printf+0x2b0>
+      } else if(c == 'd'){
+     933:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     937:	0f 85 95 00 00 00    	jne    9d2 <printf+0x155>
+        if (lflag == 1)
+     93d:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     941:	75 49                	jne    98c <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     943:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     946:	83 f8 2f             	cmp    $0x2f,%eax
+     949:	77 17                	ja     962 <printf+0xe5>
+     94b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     94f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     952:	89 d2                	mov    %edx,%edx
+     954:	48 01 d0             	add    %rdx,%rax
+     957:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     95a:	83 c2 08             	add    $0x8,%edx
+     95d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     960:	eb 0c                	jmp    96e <printf+0xf1>
+     962:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     966:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     96a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     96e:	48 8b 00             	mov    (%rax),%rax
+     971:	89 c6                	mov    %eax,%esi
+     973:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     976:	b9 01 00 00 00       	mov    $0x1,%ecx
+     97b:	ba 0a 00 00 00       	mov    $0xa,%edx
+     980:	89 c7                	mov    %eax,%edi
+     982:	e8 5d fd ff ff       	call   6e4 <printint64>
+     987:	e9 9a 01 00 00       	jmp    b26 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     98c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     98f:	83 f8 2f             	cmp    $0x2f,%eax
+     992:	77 17                	ja     9ab <printf+0x12e>
+     994:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     998:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     99b:	89 d2                	mov    %edx,%edx
+     99d:	48 01 d0             	add    %rdx,%rax
+     9a0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9a3:	83 c2 08             	add    $0x8,%edx
+     9a6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     9a9:	eb 0c                	jmp    9b7 <printf+0x13a>
+     9ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9af:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9b3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     9b7:	8b 30                	mov    (%rax),%esi
+     9b9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+     9c1:	ba 0a 00 00 00       	mov    $0xa,%edx
+     9c6:	89 c7                	mov    %eax,%edi
+     9c8:	e8 eb fd ff ff       	call   7b8 <printint>
+     9cd:	e9 54 01 00 00       	jmp    b26 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     9d2:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     9d6:	74 0a                	je     9e2 <printf+0x165>
+     9d8:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     9dc:	0f 85 95 00 00 00    	jne    a77 <printf+0x1fa>
+        if (lflag == 1)
+     9e2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     9e6:	75 49                	jne    a31 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     9e8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     9eb:	83 f8 2f             	cmp    $0x2f,%eax
+     9ee:	77 17                	ja     a07 <printf+0x18a>
+     9f0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     9f4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9f7:	89 d2                	mov    %edx,%edx
+     9f9:	48 01 d0             	add    %rdx,%rax
+     9fc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9ff:	83 c2 08             	add    $0x8,%edx
+     a02:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     a05:	eb 0c                	jmp    a13 <printf+0x196>
+     a07:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     a0b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a0f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     a13:	48 8b 00             	mov    (%rax),%rax
+     a16:	89 c6                	mov    %eax,%esi
+     a18:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a20:	ba 10 00 00 00       	mov    $0x10,%edx
+     a25:	89 c7                	mov    %eax,%edi
+     a27:	e8 b8 fc ff ff       	call   6e4 <printint64>
+        if (lflag == 1)
+     a2c:	e9 f5 00 00 00       	jmp    b26 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     a31:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     a34:	83 f8 2f             	cmp    $0x2f,%eax
+     a37:	77 17                	ja     a50 <printf+0x1d3>
+     a39:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     a3d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a40:	89 d2                	mov    %edx,%edx
+     a42:	48 01 d0             	add    %rdx,%rax
+     a45:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a48:	83 c2 08             	add    $0x8,%edx
+     a4b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     a4e:	eb 0c                	jmp    a5c <printf+0x1df>
+     a50:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     a54:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a58:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     a5c:	8b 30                	mov    (%rax),%esi
+     a5e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a61:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a66:	ba 10 00 00 00       	mov    $0x10,%edx
+     a6b:	89 c7                	mov    %eax,%edi
+     a6d:	e8 46 fd ff ff       	call   7b8 <printint>
+        if (lflag == 1)
+     a72:	e9 af 00 00 00       	jmp    b26 <printf+0x2a9>
+      } else if(c == 's'){
+     a77:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     a7b:	75 6e                	jne    aeb <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     a7d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     a80:	83 f8 2f             	cmp    $0x2f,%eax
+     a83:	77 17                	ja     a9c <printf+0x21f>
+     a85:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     a89:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a8c:	89 d2                	mov    %edx,%edx
+     a8e:	48 01 d0             	add    %rdx,%rax
+     a91:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a94:	83 c2 08             	add    $0x8,%edx
+     a97:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     a9a:	eb 0c                	jmp    aa8 <printf+0x22b>
+     a9c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     aa0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     aa4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     aa8:	48 8b 00             	mov    (%rax),%rax
+     aab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     aaf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     ab4:	75 28                	jne    ade <printf+0x261>
+          s = "(null)";
+     ab6:	48 8d 05 e1 09 00 00 	lea    0x9e1(%rip),%rax        # 149e <malloc+0x39f>
+     abd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     ac1:	eb 1b                	jmp    ade <printf+0x261>
+          putc(fd, *s);
+     ac3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ac7:	0f b6 00             	movzbl (%rax),%eax
+     aca:	0f be d0             	movsbl %al,%edx
+     acd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     ad0:	89 d6                	mov    %edx,%esi
+     ad2:	89 c7                	mov    %eax,%edi
+     ad4:	e8 e2 fb ff ff       	call   6bb <putc>
+        for(; *s; s++)
+     ad9:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     ade:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     ae2:	0f b6 00             	movzbl (%rax),%eax
+     ae5:	84 c0                	test   %al,%al
+     ae7:	75 da                	jne    ac3 <printf+0x246>
+     ae9:	eb 3b                	jmp    b26 <printf+0x2a9>
+      } else if(c == '%'){
+     aeb:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     aef:	75 14                	jne    b05 <printf+0x288>
+        putc(fd, c);
+     af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     af4:	0f be d0             	movsbl %al,%edx
+     af7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     afa:	89 d6                	mov    %edx,%esi
+     afc:	89 c7                	mov    %eax,%edi
+     afe:	e8 b8 fb ff ff       	call   6bb <putc>
+     b03:	eb 21                	jmp    b26 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     b05:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b08:	be 25 00 00 00       	mov    $0x25,%esi
+     b0d:	89 c7                	mov    %eax,%edi
+     b0f:	e8 a7 fb ff ff       	call   6bb <putc>
+        putc(fd, c);
+     b14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     b17:	0f be d0             	movsbl %al,%edx
+     b1a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b1d:	89 d6                	mov    %edx,%esi
+     b1f:	89 c7                	mov    %eax,%edi
+     b21:	e8 95 fb ff ff       	call   6bb <putc>
+      }
+      state = 0;
+     b26:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     b2d:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     b31:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     b34:	48 63 d0             	movslq %eax,%rdx
+     b37:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     b3b:	48 01 d0             	add    %rdx,%rax
+     b3e:	0f b6 00             	movzbl (%rax),%eax
+     b41:	84 c0                	test   %al,%al
+     b43:	0f 85 7d fd ff ff    	jne    8c6 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     b49:	90                   	nop
+     b4a:	90                   	nop
+     b4b:	c9                   	leave
+     b4c:	c3                   	ret
+
+0000000000000b4d <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     b4d:	55                   	push   %rbp
+     b4e:	48 89 e5             	mov    %rsp,%rbp
+     b51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b55:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     b58:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     b5b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     b5f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b62:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b65:	48 89 ce             	mov    %rcx,%rsi
+     b68:	48 89 f7             	mov    %rsi,%rdi
+     b6b:	89 d1                	mov    %edx,%ecx
+     b6d:	fc                   	cld
+     b6e:	f3 aa                	rep stos %al,%es:(%rdi)
+     b70:	89 ca                	mov    %ecx,%edx
+     b72:	48 89 fe             	mov    %rdi,%rsi
+     b75:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     b79:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+     b7c:	90                   	nop
+     b7d:	5d                   	pop    %rbp
+     b7e:	c3                   	ret
+
+0000000000000b7f <strcpy>:
+{
+     b7f:	55                   	push   %rbp
+     b80:	48 89 e5             	mov    %rsp,%rbp
+     b83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b87:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     b93:	90                   	nop
+     b94:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b98:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     b9c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     ba0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ba4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     ba8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     bac:	0f b6 12             	movzbl (%rdx),%edx
+     baf:	88 10                	mov    %dl,(%rax)
+     bb1:	0f b6 00             	movzbl (%rax),%eax
+     bb4:	84 c0                	test   %al,%al
+     bb6:	75 dc                	jne    b94 <strcpy+0x15>
+  return os;
+     bb8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     bbc:	5d                   	pop    %rbp
+     bbd:	c3                   	ret
+
+0000000000000bbe <strcmp>:
+{
+     bbe:	55                   	push   %rbp
+     bbf:	48 89 e5             	mov    %rsp,%rbp
+     bc2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     bc6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     bca:	eb 0a                	jmp    bd6 <strcmp+0x18>
+    p++, q++;
+     bcc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     bd1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     bd6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bda:	0f b6 00             	movzbl (%rax),%eax
+     bdd:	84 c0                	test   %al,%al
+     bdf:	74 12                	je     bf3 <strcmp+0x35>
+     be1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     be5:	0f b6 10             	movzbl (%rax),%edx
+     be8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bec:	0f b6 00             	movzbl (%rax),%eax
+     bef:	38 c2                	cmp    %al,%dl
+     bf1:	74 d9                	je     bcc <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     bf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bf7:	0f b6 00             	movzbl (%rax),%eax
+     bfa:	0f b6 d0             	movzbl %al,%edx
+     bfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c01:	0f b6 00             	movzbl (%rax),%eax
+     c04:	0f b6 c0             	movzbl %al,%eax
+     c07:	29 c2                	sub    %eax,%edx
+     c09:	89 d0                	mov    %edx,%eax
+}
+     c0b:	5d                   	pop    %rbp
+     c0c:	c3                   	ret
+
+0000000000000c0d <strlen>:
+{
+     c0d:	55                   	push   %rbp
+     c0e:	48 89 e5             	mov    %rsp,%rbp
+     c11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+     c15:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c1c:	eb 04                	jmp    c22 <strlen+0x15>
+     c1e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c25:	48 63 d0             	movslq %eax,%rdx
+     c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c2c:	48 01 d0             	add    %rdx,%rax
+     c2f:	0f b6 00             	movzbl (%rax),%eax
+     c32:	84 c0                	test   %al,%al
+     c34:	75 e8                	jne    c1e <strlen+0x11>
+  return n;
+     c36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c39:	5d                   	pop    %rbp
+     c3a:	c3                   	ret
+
+0000000000000c3b <memset>:
+{
+     c3b:	55                   	push   %rbp
+     c3c:	48 89 e5             	mov    %rsp,%rbp
+     c3f:	48 83 ec 10          	sub    $0x10,%rsp
+     c43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c47:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c4a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     c4d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c50:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     c53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c57:	89 ce                	mov    %ecx,%esi
+     c59:	48 89 c7             	mov    %rax,%rdi
+     c5c:	e8 ec fe ff ff       	call   b4d <stosb>
+  return dst;
+     c61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c65:	c9                   	leave
+     c66:	c3                   	ret
+
+0000000000000c67 <strchr>:
+{
+     c67:	55                   	push   %rbp
+     c68:	48 89 e5             	mov    %rsp,%rbp
+     c6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c6f:	89 f0                	mov    %esi,%eax
+     c71:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     c74:	eb 17                	jmp    c8d <strchr+0x26>
+    if(*s == c)
+     c76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c7a:	0f b6 00             	movzbl (%rax),%eax
+     c7d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     c80:	75 06                	jne    c88 <strchr+0x21>
+      return (char*)s;
+     c82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c86:	eb 15                	jmp    c9d <strchr+0x36>
+  for(; *s; s++)
+     c88:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c91:	0f b6 00             	movzbl (%rax),%eax
+     c94:	84 c0                	test   %al,%al
+     c96:	75 de                	jne    c76 <strchr+0xf>
+  return 0;
+     c98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     c9d:	5d                   	pop    %rbp
+     c9e:	c3                   	ret
+
+0000000000000c9f <gets>:
+gets(char *buf, int max)
+{
+     c9f:	55                   	push   %rbp
+     ca0:	48 89 e5             	mov    %rsp,%rbp
+     ca3:	48 83 ec 20          	sub    $0x20,%rsp
+     ca7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     cab:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     cae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     cb5:	eb 48                	jmp    cff <gets+0x60>
+    cc = read(0, &c, 1);
+     cb7:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     cbb:	ba 01 00 00 00       	mov    $0x1,%edx
+     cc0:	48 89 c6             	mov    %rax,%rsi
+     cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+     cc8:	e8 6f 01 00 00       	call   e3c <read>
+     ccd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     cd0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     cd4:	7e 36                	jle    d0c <gets+0x6d>
+      break;
+    buf[i++] = c;
+     cd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd9:	8d 50 01             	lea    0x1(%rax),%edx
+     cdc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     cdf:	48 63 d0             	movslq %eax,%rdx
+     ce2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ce6:	48 01 c2             	add    %rax,%rdx
+     ce9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ced:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     cef:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     cf3:	3c 0a                	cmp    $0xa,%al
+     cf5:	74 16                	je     d0d <gets+0x6e>
+     cf7:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     cfb:	3c 0d                	cmp    $0xd,%al
+     cfd:	74 0e                	je     d0d <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     cff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d02:	83 c0 01             	add    $0x1,%eax
+     d05:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d08:	7f ad                	jg     cb7 <gets+0x18>
+     d0a:	eb 01                	jmp    d0d <gets+0x6e>
+      break;
+     d0c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d10:	48 63 d0             	movslq %eax,%rdx
+     d13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d17:	48 01 d0             	add    %rdx,%rax
+     d1a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     d1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     d21:	c9                   	leave
+     d22:	c3                   	ret
+
+0000000000000d23 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d23:	55                   	push   %rbp
+     d24:	48 89 e5             	mov    %rsp,%rbp
+     d27:	48 83 ec 20          	sub    $0x20,%rsp
+     d2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d2f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d37:	be 00 00 00 00       	mov    $0x0,%esi
+     d3c:	48 89 c7             	mov    %rax,%rdi
+     d3f:	e8 20 01 00 00       	call   e64 <open>
+     d44:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     d47:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d4b:	79 07                	jns    d54 <stat+0x31>
+    return -1;
+     d4d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     d52:	eb 21                	jmp    d75 <stat+0x52>
+  r = fstat(fd, st);
+     d54:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     d58:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d5b:	48 89 d6             	mov    %rdx,%rsi
+     d5e:	89 c7                	mov    %eax,%edi
+     d60:	e8 17 01 00 00       	call   e7c <fstat>
+     d65:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     d68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d6b:	89 c7                	mov    %eax,%edi
+     d6d:	e8 da 00 00 00       	call   e4c <close>
+  return r;
+     d72:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     d75:	c9                   	leave
+     d76:	c3                   	ret
+
+0000000000000d77 <atoi>:
+
+int
+atoi(const char *s)
+{
+     d77:	55                   	push   %rbp
+     d78:	48 89 e5             	mov    %rsp,%rbp
+     d7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     d7f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     d86:	eb 28                	jmp    db0 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+     d88:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d8b:	89 d0                	mov    %edx,%eax
+     d8d:	c1 e0 02             	shl    $0x2,%eax
+     d90:	01 d0                	add    %edx,%eax
+     d92:	01 c0                	add    %eax,%eax
+     d94:	89 c1                	mov    %eax,%ecx
+     d96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d9a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     d9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     da2:	0f b6 00             	movzbl (%rax),%eax
+     da5:	0f be c0             	movsbl %al,%eax
+     da8:	01 c8                	add    %ecx,%eax
+     daa:	83 e8 30             	sub    $0x30,%eax
+     dad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     db4:	0f b6 00             	movzbl (%rax),%eax
+     db7:	3c 2f                	cmp    $0x2f,%al
+     db9:	7e 0b                	jle    dc6 <atoi+0x4f>
+     dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dbf:	0f b6 00             	movzbl (%rax),%eax
+     dc2:	3c 39                	cmp    $0x39,%al
+     dc4:	7e c2                	jle    d88 <atoi+0x11>
+  return n;
+     dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     dc9:	5d                   	pop    %rbp
+     dca:	c3                   	ret
+
+0000000000000dcb <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     dcb:	55                   	push   %rbp
+     dcc:	48 89 e5             	mov    %rsp,%rbp
+     dcf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     dd3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     dd7:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     dda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     dde:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     de2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     de6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     dea:	eb 1d                	jmp    e09 <memmove+0x3e>
+    *dst++ = *src++;
+     dec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     df0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     df4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     df8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dfc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e00:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     e04:	0f b6 12             	movzbl (%rdx),%edx
+     e07:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     e09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e0c:	8d 50 ff             	lea    -0x1(%rax),%edx
+     e0f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     e12:	85 c0                	test   %eax,%eax
+     e14:	7f d6                	jg     dec <memmove+0x21>
+  return vdst;
+     e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e1a:	5d                   	pop    %rbp
+     e1b:	c3                   	ret
+
+0000000000000e1c <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+     e1c:	b8 01 00 00 00       	mov    $0x1,%eax
+     e21:	cd 40                	int    $0x40
+     e23:	c3                   	ret
+
+0000000000000e24 <exit>:
+SYSCALL(exit)
+     e24:	b8 02 00 00 00       	mov    $0x2,%eax
+     e29:	cd 40                	int    $0x40
+     e2b:	c3                   	ret
+
+0000000000000e2c <wait>:
+SYSCALL(wait)
+     e2c:	b8 03 00 00 00       	mov    $0x3,%eax
+     e31:	cd 40                	int    $0x40
+     e33:	c3                   	ret
+
+0000000000000e34 <pipe>:
+SYSCALL(pipe)
+     e34:	b8 04 00 00 00       	mov    $0x4,%eax
+     e39:	cd 40                	int    $0x40
+     e3b:	c3                   	ret
+
+0000000000000e3c <read>:
+SYSCALL(read)
+     e3c:	b8 05 00 00 00       	mov    $0x5,%eax
+     e41:	cd 40                	int    $0x40
+     e43:	c3                   	ret
+
+0000000000000e44 <write>:
+SYSCALL(write)
+     e44:	b8 10 00 00 00       	mov    $0x10,%eax
+     e49:	cd 40                	int    $0x40
+     e4b:	c3                   	ret
+
+0000000000000e4c <close>:
+SYSCALL(close)
+     e4c:	b8 15 00 00 00       	mov    $0x15,%eax
+     e51:	cd 40                	int    $0x40
+     e53:	c3                   	ret
+
+0000000000000e54 <kill>:
+SYSCALL(kill)
+     e54:	b8 06 00 00 00       	mov    $0x6,%eax
+     e59:	cd 40                	int    $0x40
+     e5b:	c3                   	ret
+
+0000000000000e5c <exec>:
+SYSCALL(exec)
+     e5c:	b8 07 00 00 00       	mov    $0x7,%eax
+     e61:	cd 40                	int    $0x40
+     e63:	c3                   	ret
+
+0000000000000e64 <open>:
+SYSCALL(open)
+     e64:	b8 0f 00 00 00       	mov    $0xf,%eax
+     e69:	cd 40                	int    $0x40
+     e6b:	c3                   	ret
+
+0000000000000e6c <mknod>:
+SYSCALL(mknod)
+     e6c:	b8 11 00 00 00       	mov    $0x11,%eax
+     e71:	cd 40                	int    $0x40
+     e73:	c3                   	ret
+
+0000000000000e74 <unlink>:
+SYSCALL(unlink)
+     e74:	b8 12 00 00 00       	mov    $0x12,%eax
+     e79:	cd 40                	int    $0x40
+     e7b:	c3                   	ret
+
+0000000000000e7c <fstat>:
+SYSCALL(fstat)
+     e7c:	b8 08 00 00 00       	mov    $0x8,%eax
+     e81:	cd 40                	int    $0x40
+     e83:	c3                   	ret
+
+0000000000000e84 <link>:
+SYSCALL(link)
+     e84:	b8 13 00 00 00       	mov    $0x13,%eax
+     e89:	cd 40                	int    $0x40
+     e8b:	c3                   	ret
+
+0000000000000e8c <mkdir>:
+SYSCALL(mkdir)
+     e8c:	b8 14 00 00 00       	mov    $0x14,%eax
+     e91:	cd 40                	int    $0x40
+     e93:	c3                   	ret
+
+0000000000000e94 <chdir>:
+SYSCALL(chdir)
+     e94:	b8 09 00 00 00       	mov    $0x9,%eax
+     e99:	cd 40                	int    $0x40
+     e9b:	c3                   	ret
+
+0000000000000e9c <dup>:
+SYSCALL(dup)
+     e9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ea1:	cd 40                	int    $0x40
+     ea3:	c3                   	ret
+
+0000000000000ea4 <getpid>:
+SYSCALL(getpid)
+     ea4:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ea9:	cd 40                	int    $0x40
+     eab:	c3                   	ret
+
+0000000000000eac <sbrk>:
+SYSCALL(sbrk)
+     eac:	b8 0c 00 00 00       	mov    $0xc,%eax
+     eb1:	cd 40                	int    $0x40
+     eb3:	c3                   	ret
+
+0000000000000eb4 <sleep>:
+SYSCALL(sleep)
+     eb4:	b8 0d 00 00 00       	mov    $0xd,%eax
+     eb9:	cd 40                	int    $0x40
+     ebb:	c3                   	ret
+
+0000000000000ebc <uptime>:
+SYSCALL(uptime)
+     ebc:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ec1:	cd 40                	int    $0x40
+     ec3:	c3                   	ret
+
+0000000000000ec4 <sysinfo>:
+SYSCALL(sysinfo)
+     ec4:	b8 16 00 00 00       	mov    $0x16,%eax
+     ec9:	cd 40                	int    $0x40
+     ecb:	c3                   	ret
+
+0000000000000ecc <mmap>:
+SYSCALL(mmap)
+     ecc:	b8 17 00 00 00       	mov    $0x17,%eax
+     ed1:	cd 40                	int    $0x40
+     ed3:	c3                   	ret
+
+0000000000000ed4 <munmap>:
+SYSCALL(munmap)
+     ed4:	b8 18 00 00 00       	mov    $0x18,%eax
+     ed9:	cd 40                	int    $0x40
+     edb:	c3                   	ret
+
+0000000000000edc <crashn>:
+SYSCALL(crashn)
+     edc:	b8 19 00 00 00       	mov    $0x19,%eax
+     ee1:	cd 40                	int    $0x40
+     ee3:	c3                   	ret
+
+0000000000000ee4 <mmap2>:
+SYSCALL_ADDR(mmap2)
+     ee4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ee9:	cd 40                	int    $0x40
+     eeb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eee:	74 02                	je     ef2 <mmap2+0xe>
+     ef0:	89 c0                	mov    %eax,%eax
+     ef2:	c3                   	ret
+
+0000000000000ef3 <munmap2>:
+SYSCALL(munmap2)
+     ef3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ef8:	cd 40                	int    $0x40
+     efa:	c3                   	ret
+
+0000000000000efb <msync>:
+SYSCALL(msync)
+     efb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f00:	cd 40                	int    $0x40
+     f02:	c3                   	ret
+
+0000000000000f03 <sendfile>:
+SYSCALL(sendfile)
+     f03:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f08:	cd 40                	int    $0x40
+     f0a:	c3                   	ret
+
+0000000000000f0b <splice>:
+SYSCALL(splice)
+     f0b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f10:	cd 40                	int    $0x40
+     f12:	c3                   	ret
+
+0000000000000f13 <pread>:
+SYSCALL(pread)
+     f13:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f18:	cd 40                	int    $0x40
+     f1a:	c3                   	ret
+
+0000000000000f1b <pwrite>:
+SYSCALL(pwrite)
+     f1b:	b8 20 00 00 00       	mov    $0x20,%eax
+     f20:	cd 40                	int    $0x40
+     f22:	c3                   	ret
+
+0000000000000f23 <readv>:
+SYSCALL(readv)
+     f23:	b8 21 00 00 00       	mov    $0x21,%eax
+     f28:	cd 40                	int    $0x40
+     f2a:	c3                   	ret
+
+0000000000000f2b <writev>:
+SYSCALL(writev)
+     f2b:	b8 22 00 00 00       	mov    $0x22,%eax
+     f30:	cd 40                	int    $0x40
+     f32:	c3                   	ret
+
+0000000000000f33 <poll>:
+SYSCALL(poll)
+     f33:	b8 23 00 00 00       	mov    $0x23,%eax
+     f38:	cd 40                	int    $0x40
+     f3a:	c3                   	ret
+
+0000000000000f3b <pipe2>:
+SYSCALL(pipe2)
+     f3b:	b8 24 00 00 00       	mov    $0x24,%eax
+     f40:	cd 40                	int    $0x40
+     f42:	c3                   	ret
+
+0000000000000f43 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+     f43:	55                   	push   %rbp
+     f44:	48 89 e5             	mov    %rsp,%rbp
+     f47:	48 83 ec 20          	sub    $0x20,%rsp
+     f4b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     f53:	48 83 e8 10          	sub    $0x10,%rax
+     f57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+     f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f5f:	48 8b 10             	mov    (%rax),%rdx
+     f62:	48 8d 05 77 08 00 00 	lea    0x877(%rip),%rax        # 17e0 <bigblock>
+     f69:	48 39 c2             	cmp    %rax,%rdx
+     f6c:	75 1f                	jne    f8d <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+     f6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f72:	8b 40 08             	mov    0x8(%rax),%eax
+     f75:	c1 e0 04             	shl    $0x4,%eax
+     f78:	89 c2                	mov    %eax,%edx
+     f7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f7e:	89 d6                	mov    %edx,%esi
+     f80:	48 89 c7             	mov    %rax,%rdi
+     f83:	e8 6b ff ff ff       	call   ef3 <munmap2>
+    return;
+     f88:	e9 0b 01 00 00       	jmp    1098 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f8d:	48 8b 05 3c 08 00 00 	mov    0x83c(%rip),%rax        # 17d0 <freep>
+     f94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     f98:	eb 2f                	jmp    fc9 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f9e:	48 8b 00             	mov    (%rax),%rax
+     fa1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     fa5:	72 17                	jb     fbe <free+0x7b>
+     fa7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fab:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     faf:	72 2f                	jb     fe0 <free+0x9d>
+     fb1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fb5:	48 8b 00             	mov    (%rax),%rax
+     fb8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     fbc:	72 22                	jb     fe0 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc2:	48 8b 00             	mov    (%rax),%rax
+     fc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     fc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fcd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     fd1:	73 c7                	jae    f9a <free+0x57>
+     fd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd7:	48 8b 00             	mov    (%rax),%rax
+     fda:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     fde:	73 ba                	jae    f9a <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     fe0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe4:	8b 40 08             	mov    0x8(%rax),%eax
+     fe7:	89 c0                	mov    %eax,%eax
+     fe9:	48 c1 e0 04          	shl    $0x4,%rax
+     fed:	48 89 c2             	mov    %rax,%rdx
+     ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ff4:	48 01 c2             	add    %rax,%rdx
+     ff7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ffb:	48 8b 00             	mov    (%rax),%rax
+     ffe:	48 39 c2             	cmp    %rax,%rdx
+    1001:	75 2d                	jne    1030 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1003:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1007:	8b 50 08             	mov    0x8(%rax),%edx
+    100a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    100e:	48 8b 00             	mov    (%rax),%rax
+    1011:	8b 40 08             	mov    0x8(%rax),%eax
+    1014:	01 c2                	add    %eax,%edx
+    1016:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    101a:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    101d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1021:	48 8b 00             	mov    (%rax),%rax
+    1024:	48 8b 10             	mov    (%rax),%rdx
+    1027:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    102b:	48 89 10             	mov    %rdx,(%rax)
+    102e:	eb 0e                	jmp    103e <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1030:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1034:	48 8b 10             	mov    (%rax),%rdx
+    1037:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    103b:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    103e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1042:	8b 40 08             	mov    0x8(%rax),%eax
+    1045:	89 c0                	mov    %eax,%eax
+    1047:	48 c1 e0 04          	shl    $0x4,%rax
+    104b:	48 89 c2             	mov    %rax,%rdx
+    104e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1052:	48 01 d0             	add    %rdx,%rax
+    1055:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1059:	75 27                	jne    1082 <free+0x13f>
+    p->s.size += bp->s.size;
+    105b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105f:	8b 50 08             	mov    0x8(%rax),%edx
+    1062:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1066:	8b 40 08             	mov    0x8(%rax),%eax
+    1069:	01 c2                	add    %eax,%edx
+    106b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    106f:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1076:	48 8b 10             	mov    (%rax),%rdx
+    1079:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    107d:	48 89 10             	mov    %rdx,(%rax)
+    1080:	eb 0b                	jmp    108d <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1082:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1086:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    108a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    108d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1091:	48 89 05 38 07 00 00 	mov    %rax,0x738(%rip)        # 17d0 <freep>
+}
+    1098:	c9                   	leave
+    1099:	c3                   	ret
+
+000000000000109a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    109a:	55                   	push   %rbp
+    109b:	48 89 e5             	mov    %rsp,%rbp
+    109e:	48 83 ec 20          	sub    $0x20,%rsp
+    10a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    10a5:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    10ac:	77 07                	ja     10b5 <morecore+0x1b>
+    nu = 4096;
+    10ae:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    10b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    10b8:	c1 e0 04             	shl    $0x4,%eax
+    10bb:	89 c7                	mov    %eax,%edi
+    10bd:	e8 ea fd ff ff       	call   eac <sbrk>
+    10c2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    10c6:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    10cb:	75 07                	jne    10d4 <morecore+0x3a>
+    return 0;
+    10cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d2:	eb 29                	jmp    10fd <morecore+0x63>
+  hp = (Header*)p;
+    10d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    10dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10e0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    10e3:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    10e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10ea:	48 83 c0 10          	add    $0x10,%rax
+    10ee:	48 89 c7             	mov    %rax,%rdi
+    10f1:	e8 4d fe ff ff       	call   f43 <free>
+  return freep;
+    10f6:	48 8b 05 d3 06 00 00 	mov    0x6d3(%rip),%rax        # 17d0 <freep>
+}
+    10fd:	c9                   	leave
+    10fe:	c3                   	ret
+
+00000000000010ff <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    10ff:	55                   	push   %rbp
+    1100:	48 89 e5             	mov    %rsp,%rbp
+    1103:	48 83 ec 30          	sub    $0x30,%rsp
+    1107:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    110a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    110d:	48 83 c0 0f          	add    $0xf,%rax
+    1111:	48 c1 e8 04          	shr    $0x4,%rax
+    1115:	83 c0 01             	add    $0x1,%eax
+    1118:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    111b:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1122:	76 62                	jbe    1186 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1124:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1127:	c1 e0 04             	shl    $0x4,%eax
+    112a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1130:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1136:	b9 22 00 00 00       	mov    $0x22,%ecx
+    113b:	ba 03 00 00 00       	mov    $0x3,%edx
+    1140:	89 c6                	mov    %eax,%esi
+    1142:	bf 00 00 00 00       	mov    $0x0,%edi
+    1147:	e8 98 fd ff ff       	call   ee4 <mmap2>
+    114c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1150:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1155:	75 0a                	jne    1161 <malloc+0x62>
+      return 0;
+    1157:	b8 00 00 00 00       	mov    $0x0,%eax
+    115c:	e9 1c 01 00 00       	jmp    127d <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1165:	48 8d 15 74 06 00 00 	lea    0x674(%rip),%rdx        # 17e0 <bigblock>
+    116c:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    116f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1173:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1176:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1179:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    117d:	48 83 c0 10          	add    $0x10,%rax
+    1181:	e9 f7 00 00 00       	jmp    127d <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1186:	48 8b 05 43 06 00 00 	mov    0x643(%rip),%rax        # 17d0 <freep>
+    118d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1191:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1196:	75 2e                	jne    11c6 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1198:	48 8d 05 21 06 00 00 	lea    0x621(%rip),%rax        # 17c0 <base>
+    119f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    11a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11a7:	48 89 05 22 06 00 00 	mov    %rax,0x622(%rip)        # 17d0 <freep>
+    11ae:	48 8b 05 1b 06 00 00 	mov    0x61b(%rip),%rax        # 17d0 <freep>
+    11b5:	48 89 05 04 06 00 00 	mov    %rax,0x604(%rip)        # 17c0 <base>
+    base.s.size = 0;
+    11bc:	c7 05 02 06 00 00 00 	movl   $0x0,0x602(%rip)        # 17c8 <base+0x8>
+    11c3:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    11c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11ca:	48 8b 00             	mov    (%rax),%rax
+    11cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    11d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11d5:	8b 40 08             	mov    0x8(%rax),%eax
+    11d8:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    11db:	72 5f                	jb     123c <malloc+0x13d>
+      if(p->s.size == nunits)
+    11dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11e1:	8b 40 08             	mov    0x8(%rax),%eax
+    11e4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    11e7:	75 10                	jne    11f9 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    11e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11ed:	48 8b 10             	mov    (%rax),%rdx
+    11f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11f4:	48 89 10             	mov    %rdx,(%rax)
+    11f7:	eb 2e                	jmp    1227 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    11f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11fd:	8b 40 08             	mov    0x8(%rax),%eax
+    1200:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1203:	89 c2                	mov    %eax,%edx
+    1205:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1209:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    120c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1210:	8b 40 08             	mov    0x8(%rax),%eax
+    1213:	89 c0                	mov    %eax,%eax
+    1215:	48 c1 e0 04          	shl    $0x4,%rax
+    1219:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    121d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1221:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1224:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1227:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    122b:	48 89 05 9e 05 00 00 	mov    %rax,0x59e(%rip)        # 17d0 <freep>
+      return (void*)(p + 1);
+    1232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1236:	48 83 c0 10          	add    $0x10,%rax
+    123a:	eb 41                	jmp    127d <malloc+0x17e>
+    }
+    if(p == freep)
+    123c:	48 8b 05 8d 05 00 00 	mov    0x58d(%rip),%rax        # 17d0 <freep>
+    1243:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1247:	75 1c                	jne    1265 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1249:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    124c:	89 c7                	mov    %eax,%edi
+    124e:	e8 47 fe ff ff       	call   109a <morecore>
+    1253:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1257:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    125c:	75 07                	jne    1265 <malloc+0x166>
+        return 0;
+    125e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1263:	eb 18                	jmp    127d <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1265:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1269:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    126d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1271:	48 8b 00             	mov    (%rax),%rax
+    1274:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1278:	e9 54 ff ff ff       	jmp    11d1 <malloc+0xd2>
+  }
+}
+    127d:	c9                   	leave
+    127e:	c3                   	ret
@@ -0,0 +1,2439 @@
+
+out/user/_lab1test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void smallfilereadtest(void);
+void testinvalidargs(void);
+void testmaxfiles(void);
+void pipetest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+  if(open("console", O_RDWR) < 0){
+       4:	be 02 00 00 00       	mov    $0x2,%esi
+       9:	48 8d 05 d8 19 00 00 	lea    0x19d8(%rip),%rax        # 19e8 <malloc+0x180>
+      10:	48 89 c7             	mov    %rax,%rdi
+      13:	e8 b5 15 00 00       	call   15cd <open>
+      18:	85 c0                	test   %eax,%eax
+      1a:	79 07                	jns    23 <main+0x23>
+    return -1;
+      1c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      21:	eb 5d                	jmp    80 <main+0x80>
+  }
+  dup(0);  // stdout
+      23:	bf 00 00 00 00       	mov    $0x0,%edi
+      28:	e8 d8 15 00 00       	call   1605 <dup>
+  dup(0);  // stderr
+      2d:	bf 00 00 00 00       	mov    $0x0,%edi
+      32:	e8 ce 15 00 00       	call   1605 <dup>
+
+  printf(1, "hello world\n");
+      37:	48 8d 05 b2 19 00 00 	lea    0x19b2(%rip),%rax        # 19f0 <malloc+0x188>
+      3e:	48 89 c6             	mov    %rax,%rsi
+      41:	bf 01 00 00 00       	mov    $0x1,%edi
+      46:	b8 00 00 00 00       	mov    $0x0,%eax
+      4b:	e8 96 0f 00 00       	call   fe6 <printf>
+  //while(1);
+
+  smallfilereadtest();
+      50:	e8 2d 00 00 00       	call   82 <smallfilereadtest>
+  testinvalidargs();
+      55:	e8 2c 05 00 00       	call   586 <testinvalidargs>
+  pipetest();
+      5a:	e8 88 0b 00 00       	call   be7 <pipetest>
+
+  printf(stdout, "lab1 tests passed!\n");
+      5f:	8b 05 7b 22 00 00    	mov    0x227b(%rip),%eax        # 22e0 <stdout>
+      65:	48 8d 15 91 19 00 00 	lea    0x1991(%rip),%rdx        # 19fd <malloc+0x195>
+      6c:	48 89 d6             	mov    %rdx,%rsi
+      6f:	89 c7                	mov    %eax,%edi
+      71:	b8 00 00 00 00       	mov    $0x0,%eax
+      76:	e8 6b 0f 00 00       	call   fe6 <printf>
+
+  exit();
+      7b:	e8 0d 15 00 00       	call   158d <exit>
+  return 0;
+}
+      80:	5d                   	pop    %rbp
+      81:	c3                   	ret
+
+0000000000000082 <smallfilereadtest>:
+
+void
+smallfilereadtest(void)
+{
+      82:	55                   	push   %rbp
+      83:	48 89 e5             	mov    %rsp,%rbp
+      86:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd;
+  int i;
+  char buf[11];
+
+  printf(stdout, "small file test\n");
+      8a:	8b 05 50 22 00 00    	mov    0x2250(%rip),%eax        # 22e0 <stdout>
+      90:	48 8d 15 7a 19 00 00 	lea    0x197a(%rip),%rdx        # 1a11 <malloc+0x1a9>
+      97:	48 89 d6             	mov    %rdx,%rsi
+      9a:	89 c7                	mov    %eax,%edi
+      9c:	b8 00 00 00 00       	mov    $0x0,%eax
+      a1:	e8 40 0f 00 00       	call   fe6 <printf>
+  // Test read only funcionality
+  fd = open("/small.txt", O_RDONLY);
+      a6:	be 00 00 00 00       	mov    $0x0,%esi
+      ab:	48 8d 05 70 19 00 00 	lea    0x1970(%rip),%rax        # 1a22 <malloc+0x1ba>
+      b2:	48 89 c7             	mov    %rax,%rdi
+      b5:	e8 13 15 00 00       	call   15cd <open>
+      ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+      bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      c1:	79 5c                	jns    11f <smallfilereadtest+0x9d>
+    error("unable to open small file");
+      c3:	8b 05 17 22 00 00    	mov    0x2217(%rip),%eax        # 22e0 <stdout>
+      c9:	ba 35 00 00 00       	mov    $0x35,%edx
+      ce:	48 8d 0d 58 19 00 00 	lea    0x1958(%rip),%rcx        # 1a2d <malloc+0x1c5>
+      d5:	48 89 ce             	mov    %rcx,%rsi
+      d8:	89 c7                	mov    %eax,%edi
+      da:	b8 00 00 00 00       	mov    $0x0,%eax
+      df:	e8 02 0f 00 00       	call   fe6 <printf>
+      e4:	8b 05 f6 21 00 00    	mov    0x21f6(%rip),%eax        # 22e0 <stdout>
+      ea:	48 8d 15 4e 19 00 00 	lea    0x194e(%rip),%rdx        # 1a3f <malloc+0x1d7>
+      f1:	48 89 d6             	mov    %rdx,%rsi
+      f4:	89 c7                	mov    %eax,%edi
+      f6:	b8 00 00 00 00       	mov    $0x0,%eax
+      fb:	e8 e6 0e 00 00       	call   fe6 <printf>
+     100:	8b 05 da 21 00 00    	mov    0x21da(%rip),%eax        # 22e0 <stdout>
+     106:	48 8d 15 4c 19 00 00 	lea    0x194c(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     10d:	48 89 d6             	mov    %rdx,%rsi
+     110:	89 c7                	mov    %eax,%edi
+     112:	b8 00 00 00 00       	mov    $0x0,%eax
+     117:	e8 ca 0e 00 00       	call   fe6 <printf>
+     11c:	90                   	nop
+     11d:	eb fd                	jmp    11c <smallfilereadtest+0x9a>
+
+  printf(stdout, "open small file succeeded; ok\n");
+     11f:	8b 05 bb 21 00 00    	mov    0x21bb(%rip),%eax        # 22e0 <stdout>
+     125:	48 8d 15 34 19 00 00 	lea    0x1934(%rip),%rdx        # 1a60 <malloc+0x1f8>
+     12c:	48 89 d6             	mov    %rdx,%rsi
+     12f:	89 c7                	mov    %eax,%edi
+     131:	b8 00 00 00 00       	mov    $0x0,%eax
+     136:	e8 ab 0e 00 00       	call   fe6 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     13b:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     13f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     142:	ba 0a 00 00 00       	mov    $0xa,%edx
+     147:	48 89 ce             	mov    %rcx,%rsi
+     14a:	89 c7                	mov    %eax,%edi
+     14c:	e8 54 14 00 00       	call   15a5 <read>
+     151:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     154:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     158:	74 63                	je     1bd <smallfilereadtest+0x13b>
+    error("read of first 10 bytes unsucessful was %s bytes", "6");
+     15a:	8b 05 80 21 00 00    	mov    0x2180(%rip),%eax        # 22e0 <stdout>
+     160:	ba 3a 00 00 00       	mov    $0x3a,%edx
+     165:	48 8d 0d c1 18 00 00 	lea    0x18c1(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     16c:	48 89 ce             	mov    %rcx,%rsi
+     16f:	89 c7                	mov    %eax,%edi
+     171:	b8 00 00 00 00       	mov    $0x0,%eax
+     176:	e8 6b 0e 00 00       	call   fe6 <printf>
+     17b:	8b 05 5f 21 00 00    	mov    0x215f(%rip),%eax        # 22e0 <stdout>
+     181:	48 8d 15 f7 18 00 00 	lea    0x18f7(%rip),%rdx        # 1a7f <malloc+0x217>
+     188:	48 8d 0d f9 18 00 00 	lea    0x18f9(%rip),%rcx        # 1a88 <malloc+0x220>
+     18f:	48 89 ce             	mov    %rcx,%rsi
+     192:	89 c7                	mov    %eax,%edi
+     194:	b8 00 00 00 00       	mov    $0x0,%eax
+     199:	e8 48 0e 00 00       	call   fe6 <printf>
+     19e:	8b 05 3c 21 00 00    	mov    0x213c(%rip),%eax        # 22e0 <stdout>
+     1a4:	48 8d 15 ae 18 00 00 	lea    0x18ae(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     1ab:	48 89 d6             	mov    %rdx,%rsi
+     1ae:	89 c7                	mov    %eax,%edi
+     1b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b5:	e8 2c 0e 00 00       	call   fe6 <printf>
+     1ba:	90                   	nop
+     1bb:	eb fd                	jmp    1ba <smallfilereadtest+0x138>
+
+  buf[10] = 0;
+     1bd:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+     1c1:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     1c5:	48 8d 15 ec 18 00 00 	lea    0x18ec(%rip),%rdx        # 1ab8 <malloc+0x250>
+     1cc:	48 89 d6             	mov    %rdx,%rsi
+     1cf:	48 89 c7             	mov    %rax,%rdi
+     1d2:	e8 50 11 00 00       	call   1327 <strcmp>
+     1d7:	85 c0                	test   %eax,%eax
+     1d9:	74 60                	je     23b <smallfilereadtest+0x1b9>
+    error("buf was not 10 a's, was: '%s'", buf);
+     1db:	8b 05 ff 20 00 00    	mov    0x20ff(%rip),%eax        # 22e0 <stdout>
+     1e1:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     1e6:	48 8d 0d 40 18 00 00 	lea    0x1840(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     1ed:	48 89 ce             	mov    %rcx,%rsi
+     1f0:	89 c7                	mov    %eax,%edi
+     1f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f7:	e8 ea 0d 00 00       	call   fe6 <printf>
+     1fc:	8b 05 de 20 00 00    	mov    0x20de(%rip),%eax        # 22e0 <stdout>
+     202:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     206:	48 8d 0d b6 18 00 00 	lea    0x18b6(%rip),%rcx        # 1ac3 <malloc+0x25b>
+     20d:	48 89 ce             	mov    %rcx,%rsi
+     210:	89 c7                	mov    %eax,%edi
+     212:	b8 00 00 00 00       	mov    $0x0,%eax
+     217:	e8 ca 0d 00 00       	call   fe6 <printf>
+     21c:	8b 05 be 20 00 00    	mov    0x20be(%rip),%eax        # 22e0 <stdout>
+     222:	48 8d 15 30 18 00 00 	lea    0x1830(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     229:	48 89 d6             	mov    %rdx,%rsi
+     22c:	89 c7                	mov    %eax,%edi
+     22e:	b8 00 00 00 00       	mov    $0x0,%eax
+     233:	e8 ae 0d 00 00       	call   fe6 <printf>
+     238:	90                   	nop
+     239:	eb fd                	jmp    238 <smallfilereadtest+0x1b6>
+  printf(stdout, "read of first 10 bytes sucessful\n");
+     23b:	8b 05 9f 20 00 00    	mov    0x209f(%rip),%eax        # 22e0 <stdout>
+     241:	48 8d 15 a0 18 00 00 	lea    0x18a0(%rip),%rdx        # 1ae8 <malloc+0x280>
+     248:	48 89 d6             	mov    %rdx,%rsi
+     24b:	89 c7                	mov    %eax,%edi
+     24d:	b8 00 00 00 00       	mov    $0x0,%eax
+     252:	e8 8f 0d 00 00       	call   fe6 <printf>
+
+  if ((i = read(fd, buf, 10)) != 10)
+     257:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     25b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     25e:	ba 0a 00 00 00       	mov    $0xa,%edx
+     263:	48 89 ce             	mov    %rcx,%rsi
+     266:	89 c7                	mov    %eax,%edi
+     268:	e8 38 13 00 00       	call   15a5 <read>
+     26d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     270:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+     274:	74 5f                	je     2d5 <smallfilereadtest+0x253>
+    error("read of second 10 bytes unsucessful was %d bytes", i);
+     276:	8b 05 64 20 00 00    	mov    0x2064(%rip),%eax        # 22e0 <stdout>
+     27c:	ba 42 00 00 00       	mov    $0x42,%edx
+     281:	48 8d 0d a5 17 00 00 	lea    0x17a5(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     288:	48 89 ce             	mov    %rcx,%rsi
+     28b:	89 c7                	mov    %eax,%edi
+     28d:	b8 00 00 00 00       	mov    $0x0,%eax
+     292:	e8 4f 0d 00 00       	call   fe6 <printf>
+     297:	8b 05 43 20 00 00    	mov    0x2043(%rip),%eax        # 22e0 <stdout>
+     29d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     2a0:	48 8d 0d 69 18 00 00 	lea    0x1869(%rip),%rcx        # 1b10 <malloc+0x2a8>
+     2a7:	48 89 ce             	mov    %rcx,%rsi
+     2aa:	89 c7                	mov    %eax,%edi
+     2ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b1:	e8 30 0d 00 00       	call   fe6 <printf>
+     2b6:	8b 05 24 20 00 00    	mov    0x2024(%rip),%eax        # 22e0 <stdout>
+     2bc:	48 8d 15 96 17 00 00 	lea    0x1796(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     2c3:	48 89 d6             	mov    %rdx,%rsi
+     2c6:	89 c7                	mov    %eax,%edi
+     2c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cd:	e8 14 0d 00 00       	call   fe6 <printf>
+     2d2:	90                   	nop
+     2d3:	eb fd                	jmp    2d2 <smallfilereadtest+0x250>
+
+  buf[10] = 0;
+     2d5:	c6 45 f7 00          	movb   $0x0,-0x9(%rbp)
+  if (strcmp(buf, "bbbbbbbbbb") != 0)
+     2d9:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     2dd:	48 8d 15 5d 18 00 00 	lea    0x185d(%rip),%rdx        # 1b41 <malloc+0x2d9>
+     2e4:	48 89 d6             	mov    %rdx,%rsi
+     2e7:	48 89 c7             	mov    %rax,%rdi
+     2ea:	e8 38 10 00 00       	call   1327 <strcmp>
+     2ef:	85 c0                	test   %eax,%eax
+     2f1:	74 60                	je     353 <smallfilereadtest+0x2d1>
+    error("buf was not 10 b's, was: '%s'", buf);
+     2f3:	8b 05 e7 1f 00 00    	mov    0x1fe7(%rip),%eax        # 22e0 <stdout>
+     2f9:	ba 46 00 00 00       	mov    $0x46,%edx
+     2fe:	48 8d 0d 28 17 00 00 	lea    0x1728(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     305:	48 89 ce             	mov    %rcx,%rsi
+     308:	89 c7                	mov    %eax,%edi
+     30a:	b8 00 00 00 00       	mov    $0x0,%eax
+     30f:	e8 d2 0c 00 00       	call   fe6 <printf>
+     314:	8b 05 c6 1f 00 00    	mov    0x1fc6(%rip),%eax        # 22e0 <stdout>
+     31a:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     31e:	48 8d 0d 27 18 00 00 	lea    0x1827(%rip),%rcx        # 1b4c <malloc+0x2e4>
+     325:	48 89 ce             	mov    %rcx,%rsi
+     328:	89 c7                	mov    %eax,%edi
+     32a:	b8 00 00 00 00       	mov    $0x0,%eax
+     32f:	e8 b2 0c 00 00       	call   fe6 <printf>
+     334:	8b 05 a6 1f 00 00    	mov    0x1fa6(%rip),%eax        # 22e0 <stdout>
+     33a:	48 8d 15 18 17 00 00 	lea    0x1718(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     341:	48 89 d6             	mov    %rdx,%rsi
+     344:	89 c7                	mov    %eax,%edi
+     346:	b8 00 00 00 00       	mov    $0x0,%eax
+     34b:	e8 96 0c 00 00       	call   fe6 <printf>
+     350:	90                   	nop
+     351:	eb fd                	jmp    350 <smallfilereadtest+0x2ce>
+  printf(stdout, "read of second 10 bytes sucessful\n");
+     353:	8b 05 87 1f 00 00    	mov    0x1f87(%rip),%eax        # 22e0 <stdout>
+     359:	48 8d 15 10 18 00 00 	lea    0x1810(%rip),%rdx        # 1b70 <malloc+0x308>
+     360:	48 89 d6             	mov    %rdx,%rsi
+     363:	89 c7                	mov    %eax,%edi
+     365:	b8 00 00 00 00       	mov    $0x0,%eax
+     36a:	e8 77 0c 00 00       	call   fe6 <printf>
+
+  // only 25 byte file
+  if ((i = read(fd, buf, 10)) != 6)
+     36f:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     373:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     376:	ba 0a 00 00 00       	mov    $0xa,%edx
+     37b:	48 89 ce             	mov    %rcx,%rsi
+     37e:	89 c7                	mov    %eax,%edi
+     380:	e8 20 12 00 00       	call   15a5 <read>
+     385:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     388:	83 7d f8 06          	cmpl   $0x6,-0x8(%rbp)
+     38c:	74 5f                	je     3ed <smallfilereadtest+0x36b>
+    error("read of last 6 bytes unsucessful was %d bytes", i);
+     38e:	8b 05 4c 1f 00 00    	mov    0x1f4c(%rip),%eax        # 22e0 <stdout>
+     394:	ba 4b 00 00 00       	mov    $0x4b,%edx
+     399:	48 8d 0d 8d 16 00 00 	lea    0x168d(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     3a0:	48 89 ce             	mov    %rcx,%rsi
+     3a3:	89 c7                	mov    %eax,%edi
+     3a5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3aa:	e8 37 0c 00 00       	call   fe6 <printf>
+     3af:	8b 05 2b 1f 00 00    	mov    0x1f2b(%rip),%eax        # 22e0 <stdout>
+     3b5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     3b8:	48 8d 0d d9 17 00 00 	lea    0x17d9(%rip),%rcx        # 1b98 <malloc+0x330>
+     3bf:	48 89 ce             	mov    %rcx,%rsi
+     3c2:	89 c7                	mov    %eax,%edi
+     3c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3c9:	e8 18 0c 00 00       	call   fe6 <printf>
+     3ce:	8b 05 0c 1f 00 00    	mov    0x1f0c(%rip),%eax        # 22e0 <stdout>
+     3d4:	48 8d 15 7e 16 00 00 	lea    0x167e(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     3db:	48 89 d6             	mov    %rdx,%rsi
+     3de:	89 c7                	mov    %eax,%edi
+     3e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e5:	e8 fc 0b 00 00       	call   fe6 <printf>
+     3ea:	90                   	nop
+     3eb:	eb fd                	jmp    3ea <smallfilereadtest+0x368>
+
+  buf[6] = 0;
+     3ed:	c6 45 f3 00          	movb   $0x0,-0xd(%rbp)
+  if (strcmp(buf, "ccccc\n") != 0)
+     3f1:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     3f5:	48 8d 15 ca 17 00 00 	lea    0x17ca(%rip),%rdx        # 1bc6 <malloc+0x35e>
+     3fc:	48 89 d6             	mov    %rdx,%rsi
+     3ff:	48 89 c7             	mov    %rax,%rdi
+     402:	e8 20 0f 00 00       	call   1327 <strcmp>
+     407:	85 c0                	test   %eax,%eax
+     409:	74 60                	je     46b <smallfilereadtest+0x3e9>
+    error("buf was not 5 c's (and a newline), was: '%s'", buf);
+     40b:	8b 05 cf 1e 00 00    	mov    0x1ecf(%rip),%eax        # 22e0 <stdout>
+     411:	ba 4f 00 00 00       	mov    $0x4f,%edx
+     416:	48 8d 0d 10 16 00 00 	lea    0x1610(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     41d:	48 89 ce             	mov    %rcx,%rsi
+     420:	89 c7                	mov    %eax,%edi
+     422:	b8 00 00 00 00       	mov    $0x0,%eax
+     427:	e8 ba 0b 00 00       	call   fe6 <printf>
+     42c:	8b 05 ae 1e 00 00    	mov    0x1eae(%rip),%eax        # 22e0 <stdout>
+     432:	48 8d 55 ed          	lea    -0x13(%rbp),%rdx
+     436:	48 8d 0d 93 17 00 00 	lea    0x1793(%rip),%rcx        # 1bd0 <malloc+0x368>
+     43d:	48 89 ce             	mov    %rcx,%rsi
+     440:	89 c7                	mov    %eax,%edi
+     442:	b8 00 00 00 00       	mov    $0x0,%eax
+     447:	e8 9a 0b 00 00       	call   fe6 <printf>
+     44c:	8b 05 8e 1e 00 00    	mov    0x1e8e(%rip),%eax        # 22e0 <stdout>
+     452:	48 8d 15 00 16 00 00 	lea    0x1600(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     459:	48 89 d6             	mov    %rdx,%rsi
+     45c:	89 c7                	mov    %eax,%edi
+     45e:	b8 00 00 00 00       	mov    $0x0,%eax
+     463:	e8 7e 0b 00 00       	call   fe6 <printf>
+     468:	90                   	nop
+     469:	eb fd                	jmp    468 <smallfilereadtest+0x3e6>
+
+  printf(stdout, "read of last 5 bytes sucessful\n");
+     46b:	8b 05 6f 1e 00 00    	mov    0x1e6f(%rip),%eax        # 22e0 <stdout>
+     471:	48 8d 15 88 17 00 00 	lea    0x1788(%rip),%rdx        # 1c00 <malloc+0x398>
+     478:	48 89 d6             	mov    %rdx,%rsi
+     47b:	89 c7                	mov    %eax,%edi
+     47d:	b8 00 00 00 00       	mov    $0x0,%eax
+     482:	e8 5f 0b 00 00       	call   fe6 <printf>
+
+  if (read(fd, buf, 10) != 0)
+     487:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     48b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     48e:	ba 0a 00 00 00       	mov    $0xa,%edx
+     493:	48 89 ce             	mov    %rcx,%rsi
+     496:	89 c7                	mov    %eax,%edi
+     498:	e8 08 11 00 00       	call   15a5 <read>
+     49d:	85 c0                	test   %eax,%eax
+     49f:	74 5c                	je     4fd <smallfilereadtest+0x47b>
+    error("read more bytes than should be possible");
+     4a1:	8b 05 39 1e 00 00    	mov    0x1e39(%rip),%eax        # 22e0 <stdout>
+     4a7:	ba 54 00 00 00       	mov    $0x54,%edx
+     4ac:	48 8d 0d 7a 15 00 00 	lea    0x157a(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     4b3:	48 89 ce             	mov    %rcx,%rsi
+     4b6:	89 c7                	mov    %eax,%edi
+     4b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bd:	e8 24 0b 00 00       	call   fe6 <printf>
+     4c2:	8b 05 18 1e 00 00    	mov    0x1e18(%rip),%eax        # 22e0 <stdout>
+     4c8:	48 8d 15 51 17 00 00 	lea    0x1751(%rip),%rdx        # 1c20 <malloc+0x3b8>
+     4cf:	48 89 d6             	mov    %rdx,%rsi
+     4d2:	89 c7                	mov    %eax,%edi
+     4d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d9:	e8 08 0b 00 00       	call   fe6 <printf>
+     4de:	8b 05 fc 1d 00 00    	mov    0x1dfc(%rip),%eax        # 22e0 <stdout>
+     4e4:	48 8d 15 6e 15 00 00 	lea    0x156e(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     4eb:	48 89 d6             	mov    %rdx,%rsi
+     4ee:	89 c7                	mov    %eax,%edi
+     4f0:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f5:	e8 ec 0a 00 00       	call   fe6 <printf>
+     4fa:	90                   	nop
+     4fb:	eb fd                	jmp    4fa <smallfilereadtest+0x478>
+
+  if (close(fd) != 0)
+     4fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     500:	89 c7                	mov    %eax,%edi
+     502:	e8 ae 10 00 00       	call   15b5 <close>
+     507:	85 c0                	test   %eax,%eax
+     509:	74 5c                	je     567 <smallfilereadtest+0x4e5>
+    error("error closing fd");
+     50b:	8b 05 cf 1d 00 00    	mov    0x1dcf(%rip),%eax        # 22e0 <stdout>
+     511:	ba 57 00 00 00       	mov    $0x57,%edx
+     516:	48 8d 0d 10 15 00 00 	lea    0x1510(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     51d:	48 89 ce             	mov    %rcx,%rsi
+     520:	89 c7                	mov    %eax,%edi
+     522:	b8 00 00 00 00       	mov    $0x0,%eax
+     527:	e8 ba 0a 00 00       	call   fe6 <printf>
+     52c:	8b 05 ae 1d 00 00    	mov    0x1dae(%rip),%eax        # 22e0 <stdout>
+     532:	48 8d 15 0f 17 00 00 	lea    0x170f(%rip),%rdx        # 1c48 <malloc+0x3e0>
+     539:	48 89 d6             	mov    %rdx,%rsi
+     53c:	89 c7                	mov    %eax,%edi
+     53e:	b8 00 00 00 00       	mov    $0x0,%eax
+     543:	e8 9e 0a 00 00       	call   fe6 <printf>
+     548:	8b 05 92 1d 00 00    	mov    0x1d92(%rip),%eax        # 22e0 <stdout>
+     54e:	48 8d 15 04 15 00 00 	lea    0x1504(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     555:	48 89 d6             	mov    %rdx,%rsi
+     558:	89 c7                	mov    %eax,%edi
+     55a:	b8 00 00 00 00       	mov    $0x0,%eax
+     55f:	e8 82 0a 00 00       	call   fe6 <printf>
+     564:	90                   	nop
+     565:	eb fd                	jmp    564 <smallfilereadtest+0x4e2>
+  printf(stdout, "small file test ok\n");
+     567:	8b 05 73 1d 00 00    	mov    0x1d73(%rip),%eax        # 22e0 <stdout>
+     56d:	48 8d 15 e5 16 00 00 	lea    0x16e5(%rip),%rdx        # 1c59 <malloc+0x3f1>
+     574:	48 89 d6             	mov    %rdx,%rsi
+     577:	89 c7                	mov    %eax,%edi
+     579:	b8 00 00 00 00       	mov    $0x0,%eax
+     57e:	e8 63 0a 00 00       	call   fe6 <printf>
+}
+     583:	90                   	nop
+     584:	c9                   	leave
+     585:	c3                   	ret
+
+0000000000000586 <testinvalidargs>:
+
+void
+testinvalidargs(void)
+{
+     586:	55                   	push   %rbp
+     587:	48 89 e5             	mov    %rsp,%rbp
+     58a:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd;
+  int i;
+  char buf[11];
+  // open
+  if (open("/other.txt", O_CREATE) != -1)
+     58e:	be 00 02 00 00       	mov    $0x200,%esi
+     593:	48 8d 05 d3 16 00 00 	lea    0x16d3(%rip),%rax        # 1c6d <malloc+0x405>
+     59a:	48 89 c7             	mov    %rax,%rdi
+     59d:	e8 2b 10 00 00       	call   15cd <open>
+     5a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     5a5:	74 5c                	je     603 <testinvalidargs+0x7d>
+    error("created file in read only file system");
+     5a7:	8b 05 33 1d 00 00    	mov    0x1d33(%rip),%eax        # 22e0 <stdout>
+     5ad:	ba 63 00 00 00       	mov    $0x63,%edx
+     5b2:	48 8d 0d 74 14 00 00 	lea    0x1474(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     5b9:	48 89 ce             	mov    %rcx,%rsi
+     5bc:	89 c7                	mov    %eax,%edi
+     5be:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c3:	e8 1e 0a 00 00       	call   fe6 <printf>
+     5c8:	8b 05 12 1d 00 00    	mov    0x1d12(%rip),%eax        # 22e0 <stdout>
+     5ce:	48 8d 15 a3 16 00 00 	lea    0x16a3(%rip),%rdx        # 1c78 <malloc+0x410>
+     5d5:	48 89 d6             	mov    %rdx,%rsi
+     5d8:	89 c7                	mov    %eax,%edi
+     5da:	b8 00 00 00 00       	mov    $0x0,%eax
+     5df:	e8 02 0a 00 00       	call   fe6 <printf>
+     5e4:	8b 05 f6 1c 00 00    	mov    0x1cf6(%rip),%eax        # 22e0 <stdout>
+     5ea:	48 8d 15 68 14 00 00 	lea    0x1468(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     5f1:	48 89 d6             	mov    %rdx,%rsi
+     5f4:	89 c7                	mov    %eax,%edi
+     5f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     5fb:	e8 e6 09 00 00       	call   fe6 <printf>
+     600:	90                   	nop
+     601:	eb fd                	jmp    600 <testinvalidargs+0x7a>
+
+  if (open("/small.txt", O_RDWR) != -1 || open("/small.txt", O_WRONLY) != -1)
+     603:	be 02 00 00 00       	mov    $0x2,%esi
+     608:	48 8d 05 13 14 00 00 	lea    0x1413(%rip),%rax        # 1a22 <malloc+0x1ba>
+     60f:	48 89 c7             	mov    %rax,%rdi
+     612:	e8 b6 0f 00 00       	call   15cd <open>
+     617:	83 f8 ff             	cmp    $0xffffffff,%eax
+     61a:	75 19                	jne    635 <testinvalidargs+0xaf>
+     61c:	be 01 00 00 00       	mov    $0x1,%esi
+     621:	48 8d 05 fa 13 00 00 	lea    0x13fa(%rip),%rax        # 1a22 <malloc+0x1ba>
+     628:	48 89 c7             	mov    %rax,%rdi
+     62b:	e8 9d 0f 00 00       	call   15cd <open>
+     630:	83 f8 ff             	cmp    $0xffffffff,%eax
+     633:	74 5c                	je     691 <testinvalidargs+0x10b>
+    error("tried to open a file for writing in read only fs");
+     635:	8b 05 a5 1c 00 00    	mov    0x1ca5(%rip),%eax        # 22e0 <stdout>
+     63b:	ba 66 00 00 00       	mov    $0x66,%edx
+     640:	48 8d 0d e6 13 00 00 	lea    0x13e6(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     647:	48 89 ce             	mov    %rcx,%rsi
+     64a:	89 c7                	mov    %eax,%edi
+     64c:	b8 00 00 00 00       	mov    $0x0,%eax
+     651:	e8 90 09 00 00       	call   fe6 <printf>
+     656:	8b 05 84 1c 00 00    	mov    0x1c84(%rip),%eax        # 22e0 <stdout>
+     65c:	48 8d 15 3d 16 00 00 	lea    0x163d(%rip),%rdx        # 1ca0 <malloc+0x438>
+     663:	48 89 d6             	mov    %rdx,%rsi
+     666:	89 c7                	mov    %eax,%edi
+     668:	b8 00 00 00 00       	mov    $0x0,%eax
+     66d:	e8 74 09 00 00       	call   fe6 <printf>
+     672:	8b 05 68 1c 00 00    	mov    0x1c68(%rip),%eax        # 22e0 <stdout>
+     678:	48 8d 15 da 13 00 00 	lea    0x13da(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     67f:	48 89 d6             	mov    %rdx,%rsi
+     682:	89 c7                	mov    %eax,%edi
+     684:	b8 00 00 00 00       	mov    $0x0,%eax
+     689:	e8 58 09 00 00       	call   fe6 <printf>
+     68e:	90                   	nop
+     68f:	eb fd                	jmp    68e <testinvalidargs+0x108>
+
+  if (open("/other.txt", O_RDONLY) != -1)
+     691:	be 00 00 00 00       	mov    $0x0,%esi
+     696:	48 8d 05 d0 15 00 00 	lea    0x15d0(%rip),%rax        # 1c6d <malloc+0x405>
+     69d:	48 89 c7             	mov    %rax,%rdi
+     6a0:	e8 28 0f 00 00       	call   15cd <open>
+     6a5:	83 f8 ff             	cmp    $0xffffffff,%eax
+     6a8:	74 5c                	je     706 <testinvalidargs+0x180>
+    error("opened a file that doesn't exist");
+     6aa:	8b 05 30 1c 00 00    	mov    0x1c30(%rip),%eax        # 22e0 <stdout>
+     6b0:	ba 69 00 00 00       	mov    $0x69,%edx
+     6b5:	48 8d 0d 71 13 00 00 	lea    0x1371(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     6bc:	48 89 ce             	mov    %rcx,%rsi
+     6bf:	89 c7                	mov    %eax,%edi
+     6c1:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c6:	e8 1b 09 00 00       	call   fe6 <printf>
+     6cb:	8b 05 0f 1c 00 00    	mov    0x1c0f(%rip),%eax        # 22e0 <stdout>
+     6d1:	48 8d 15 00 16 00 00 	lea    0x1600(%rip),%rdx        # 1cd8 <malloc+0x470>
+     6d8:	48 89 d6             	mov    %rdx,%rsi
+     6db:	89 c7                	mov    %eax,%edi
+     6dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     6e2:	e8 ff 08 00 00       	call   fe6 <printf>
+     6e7:	8b 05 f3 1b 00 00    	mov    0x1bf3(%rip),%eax        # 22e0 <stdout>
+     6ed:	48 8d 15 65 13 00 00 	lea    0x1365(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     6f4:	48 89 d6             	mov    %rdx,%rsi
+     6f7:	89 c7                	mov    %eax,%edi
+     6f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6fe:	e8 e3 08 00 00       	call   fe6 <printf>
+     703:	90                   	nop
+     704:	eb fd                	jmp    703 <testinvalidargs+0x17d>
+
+  printf(stdout, "passed argument checking for open\n");
+     706:	8b 05 d4 1b 00 00    	mov    0x1bd4(%rip),%eax        # 22e0 <stdout>
+     70c:	48 8d 15 ed 15 00 00 	lea    0x15ed(%rip),%rdx        # 1d00 <malloc+0x498>
+     713:	48 89 d6             	mov    %rdx,%rsi
+     716:	89 c7                	mov    %eax,%edi
+     718:	b8 00 00 00 00       	mov    $0x0,%eax
+     71d:	e8 c4 08 00 00       	call   fe6 <printf>
+
+  // read
+  if (read(15, buf, 11) != -1)
+     722:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     726:	ba 0b 00 00 00       	mov    $0xb,%edx
+     72b:	48 89 c6             	mov    %rax,%rsi
+     72e:	bf 0f 00 00 00       	mov    $0xf,%edi
+     733:	e8 6d 0e 00 00       	call   15a5 <read>
+     738:	83 f8 ff             	cmp    $0xffffffff,%eax
+     73b:	74 5c                	je     799 <testinvalidargs+0x213>
+    error("read on a non existent file descriptor");
+     73d:	8b 05 9d 1b 00 00    	mov    0x1b9d(%rip),%eax        # 22e0 <stdout>
+     743:	ba 6f 00 00 00       	mov    $0x6f,%edx
+     748:	48 8d 0d de 12 00 00 	lea    0x12de(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     74f:	48 89 ce             	mov    %rcx,%rsi
+     752:	89 c7                	mov    %eax,%edi
+     754:	b8 00 00 00 00       	mov    $0x0,%eax
+     759:	e8 88 08 00 00       	call   fe6 <printf>
+     75e:	8b 05 7c 1b 00 00    	mov    0x1b7c(%rip),%eax        # 22e0 <stdout>
+     764:	48 8d 15 bd 15 00 00 	lea    0x15bd(%rip),%rdx        # 1d28 <malloc+0x4c0>
+     76b:	48 89 d6             	mov    %rdx,%rsi
+     76e:	89 c7                	mov    %eax,%edi
+     770:	b8 00 00 00 00       	mov    $0x0,%eax
+     775:	e8 6c 08 00 00       	call   fe6 <printf>
+     77a:	8b 05 60 1b 00 00    	mov    0x1b60(%rip),%eax        # 22e0 <stdout>
+     780:	48 8d 15 d2 12 00 00 	lea    0x12d2(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     787:	48 89 d6             	mov    %rdx,%rsi
+     78a:	89 c7                	mov    %eax,%edi
+     78c:	b8 00 00 00 00       	mov    $0x0,%eax
+     791:	e8 50 08 00 00       	call   fe6 <printf>
+     796:	90                   	nop
+     797:	eb fd                	jmp    796 <testinvalidargs+0x210>
+
+  fd = open("/small.txt", O_RDONLY);
+     799:	be 00 00 00 00       	mov    $0x0,%esi
+     79e:	48 8d 05 7d 12 00 00 	lea    0x127d(%rip),%rax        # 1a22 <malloc+0x1ba>
+     7a5:	48 89 c7             	mov    %rax,%rdi
+     7a8:	e8 20 0e 00 00       	call   15cd <open>
+     7ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if ((i = read(fd, buf, -100)) != -1)
+     7b0:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     7b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7b7:	ba 9c ff ff ff       	mov    $0xffffff9c,%edx
+     7bc:	48 89 ce             	mov    %rcx,%rsi
+     7bf:	89 c7                	mov    %eax,%edi
+     7c1:	e8 df 0d 00 00       	call   15a5 <read>
+     7c6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     7c9:	83 7d f8 ff          	cmpl   $0xffffffff,-0x8(%rbp)
+     7cd:	74 5f                	je     82e <testinvalidargs+0x2a8>
+    error("negative n didn't return error was %d", i);
+     7cf:	8b 05 0b 1b 00 00    	mov    0x1b0b(%rip),%eax        # 22e0 <stdout>
+     7d5:	ba 74 00 00 00       	mov    $0x74,%edx
+     7da:	48 8d 0d 4c 12 00 00 	lea    0x124c(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     7e1:	48 89 ce             	mov    %rcx,%rsi
+     7e4:	89 c7                	mov    %eax,%edi
+     7e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     7eb:	e8 f6 07 00 00       	call   fe6 <printf>
+     7f0:	8b 05 ea 1a 00 00    	mov    0x1aea(%rip),%eax        # 22e0 <stdout>
+     7f6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     7f9:	48 8d 0d 50 15 00 00 	lea    0x1550(%rip),%rcx        # 1d50 <malloc+0x4e8>
+     800:	48 89 ce             	mov    %rcx,%rsi
+     803:	89 c7                	mov    %eax,%edi
+     805:	b8 00 00 00 00       	mov    $0x0,%eax
+     80a:	e8 d7 07 00 00       	call   fe6 <printf>
+     80f:	8b 05 cb 1a 00 00    	mov    0x1acb(%rip),%eax        # 22e0 <stdout>
+     815:	48 8d 15 3d 12 00 00 	lea    0x123d(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     81c:	48 89 d6             	mov    %rdx,%rsi
+     81f:	89 c7                	mov    %eax,%edi
+     821:	b8 00 00 00 00       	mov    $0x0,%eax
+     826:	e8 bb 07 00 00       	call   fe6 <printf>
+     82b:	90                   	nop
+     82c:	eb fd                	jmp    82b <testinvalidargs+0x2a5>
+
+  if (read(fd, (char *)0xffffff00, 10) != -1)
+     82e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     831:	ba 0a 00 00 00       	mov    $0xa,%edx
+     836:	b9 00 ff ff ff       	mov    $0xffffff00,%ecx
+     83b:	48 89 ce             	mov    %rcx,%rsi
+     83e:	89 c7                	mov    %eax,%edi
+     840:	e8 60 0d 00 00       	call   15a5 <read>
+     845:	83 f8 ff             	cmp    $0xffffffff,%eax
+     848:	74 5c                	je     8a6 <testinvalidargs+0x320>
+    error("able to read to a buffer not in my memory region");
+     84a:	8b 05 90 1a 00 00    	mov    0x1a90(%rip),%eax        # 22e0 <stdout>
+     850:	ba 77 00 00 00       	mov    $0x77,%edx
+     855:	48 8d 0d d1 11 00 00 	lea    0x11d1(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     85c:	48 89 ce             	mov    %rcx,%rsi
+     85f:	89 c7                	mov    %eax,%edi
+     861:	b8 00 00 00 00       	mov    $0x0,%eax
+     866:	e8 7b 07 00 00       	call   fe6 <printf>
+     86b:	8b 05 6f 1a 00 00    	mov    0x1a6f(%rip),%eax        # 22e0 <stdout>
+     871:	48 8d 15 00 15 00 00 	lea    0x1500(%rip),%rdx        # 1d78 <malloc+0x510>
+     878:	48 89 d6             	mov    %rdx,%rsi
+     87b:	89 c7                	mov    %eax,%edi
+     87d:	b8 00 00 00 00       	mov    $0x0,%eax
+     882:	e8 5f 07 00 00       	call   fe6 <printf>
+     887:	8b 05 53 1a 00 00    	mov    0x1a53(%rip),%eax        # 22e0 <stdout>
+     88d:	48 8d 15 c5 11 00 00 	lea    0x11c5(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     894:	48 89 d6             	mov    %rdx,%rsi
+     897:	89 c7                	mov    %eax,%edi
+     899:	b8 00 00 00 00       	mov    $0x0,%eax
+     89e:	e8 43 07 00 00       	call   fe6 <printf>
+     8a3:	90                   	nop
+     8a4:	eb fd                	jmp    8a3 <testinvalidargs+0x31d>
+
+  printf(stdout, "passed argument checking for read\n");
+     8a6:	8b 05 34 1a 00 00    	mov    0x1a34(%rip),%eax        # 22e0 <stdout>
+     8ac:	48 8d 15 fd 14 00 00 	lea    0x14fd(%rip),%rdx        # 1db0 <malloc+0x548>
+     8b3:	48 89 d6             	mov    %rdx,%rsi
+     8b6:	89 c7                	mov    %eax,%edi
+     8b8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8bd:	e8 24 07 00 00       	call   fe6 <printf>
+
+  // write
+  if (write(15, buf, 11) != -1)
+     8c2:	48 8d 45 ed          	lea    -0x13(%rbp),%rax
+     8c6:	ba 0b 00 00 00       	mov    $0xb,%edx
+     8cb:	48 89 c6             	mov    %rax,%rsi
+     8ce:	bf 0f 00 00 00       	mov    $0xf,%edi
+     8d3:	e8 d5 0c 00 00       	call   15ad <write>
+     8d8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     8db:	74 5c                	je     939 <testinvalidargs+0x3b3>
+    error("write on a non existent file descriptor");
+     8dd:	8b 05 fd 19 00 00    	mov    0x19fd(%rip),%eax        # 22e0 <stdout>
+     8e3:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     8e8:	48 8d 0d 3e 11 00 00 	lea    0x113e(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     8ef:	48 89 ce             	mov    %rcx,%rsi
+     8f2:	89 c7                	mov    %eax,%edi
+     8f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f9:	e8 e8 06 00 00       	call   fe6 <printf>
+     8fe:	8b 05 dc 19 00 00    	mov    0x19dc(%rip),%eax        # 22e0 <stdout>
+     904:	48 8d 15 cd 14 00 00 	lea    0x14cd(%rip),%rdx        # 1dd8 <malloc+0x570>
+     90b:	48 89 d6             	mov    %rdx,%rsi
+     90e:	89 c7                	mov    %eax,%edi
+     910:	b8 00 00 00 00       	mov    $0x0,%eax
+     915:	e8 cc 06 00 00       	call   fe6 <printf>
+     91a:	8b 05 c0 19 00 00    	mov    0x19c0(%rip),%eax        # 22e0 <stdout>
+     920:	48 8d 15 32 11 00 00 	lea    0x1132(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     927:	48 89 d6             	mov    %rdx,%rsi
+     92a:	89 c7                	mov    %eax,%edi
+     92c:	b8 00 00 00 00       	mov    $0x0,%eax
+     931:	e8 b0 06 00 00       	call   fe6 <printf>
+     936:	90                   	nop
+     937:	eb fd                	jmp    936 <testinvalidargs+0x3b0>
+
+  if (write(fd, buf, 11) != -1)
+     939:	48 8d 4d ed          	lea    -0x13(%rbp),%rcx
+     93d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     940:	ba 0b 00 00 00       	mov    $0xb,%edx
+     945:	48 89 ce             	mov    %rcx,%rsi
+     948:	89 c7                	mov    %eax,%edi
+     94a:	e8 5e 0c 00 00       	call   15ad <write>
+     94f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     952:	74 5c                	je     9b0 <testinvalidargs+0x42a>
+    error("able to write to a file in read only fs");
+     954:	8b 05 86 19 00 00    	mov    0x1986(%rip),%eax        # 22e0 <stdout>
+     95a:	ba 80 00 00 00       	mov    $0x80,%edx
+     95f:	48 8d 0d c7 10 00 00 	lea    0x10c7(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     966:	48 89 ce             	mov    %rcx,%rsi
+     969:	89 c7                	mov    %eax,%edi
+     96b:	b8 00 00 00 00       	mov    $0x0,%eax
+     970:	e8 71 06 00 00       	call   fe6 <printf>
+     975:	8b 05 65 19 00 00    	mov    0x1965(%rip),%eax        # 22e0 <stdout>
+     97b:	48 8d 15 7e 14 00 00 	lea    0x147e(%rip),%rdx        # 1e00 <malloc+0x598>
+     982:	48 89 d6             	mov    %rdx,%rsi
+     985:	89 c7                	mov    %eax,%edi
+     987:	b8 00 00 00 00       	mov    $0x0,%eax
+     98c:	e8 55 06 00 00       	call   fe6 <printf>
+     991:	8b 05 49 19 00 00    	mov    0x1949(%rip),%eax        # 22e0 <stdout>
+     997:	48 8d 15 bb 10 00 00 	lea    0x10bb(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     99e:	48 89 d6             	mov    %rdx,%rsi
+     9a1:	89 c7                	mov    %eax,%edi
+     9a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a8:	e8 39 06 00 00       	call   fe6 <printf>
+     9ad:	90                   	nop
+     9ae:	eb fd                	jmp    9ad <testinvalidargs+0x427>
+
+  printf(stdout, "passed argument checking for write\n");
+     9b0:	8b 05 2a 19 00 00    	mov    0x192a(%rip),%eax        # 22e0 <stdout>
+     9b6:	48 8d 15 6b 14 00 00 	lea    0x146b(%rip),%rdx        # 1e28 <malloc+0x5c0>
+     9bd:	48 89 d6             	mov    %rdx,%rsi
+     9c0:	89 c7                	mov    %eax,%edi
+     9c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9c7:	e8 1a 06 00 00       	call   fe6 <printf>
+
+  // dup
+  if (dup(15) != -1)
+     9cc:	bf 0f 00 00 00       	mov    $0xf,%edi
+     9d1:	e8 2f 0c 00 00       	call   1605 <dup>
+     9d6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     9d9:	74 5c                	je     a37 <testinvalidargs+0x4b1>
+    error("able to duplicated a non open file");
+     9db:	8b 05 ff 18 00 00    	mov    0x18ff(%rip),%eax        # 22e0 <stdout>
+     9e1:	ba 86 00 00 00       	mov    $0x86,%edx
+     9e6:	48 8d 0d 40 10 00 00 	lea    0x1040(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     9ed:	48 89 ce             	mov    %rcx,%rsi
+     9f0:	89 c7                	mov    %eax,%edi
+     9f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f7:	e8 ea 05 00 00       	call   fe6 <printf>
+     9fc:	8b 05 de 18 00 00    	mov    0x18de(%rip),%eax        # 22e0 <stdout>
+     a02:	48 8d 15 47 14 00 00 	lea    0x1447(%rip),%rdx        # 1e50 <malloc+0x5e8>
+     a09:	48 89 d6             	mov    %rdx,%rsi
+     a0c:	89 c7                	mov    %eax,%edi
+     a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a13:	e8 ce 05 00 00       	call   fe6 <printf>
+     a18:	8b 05 c2 18 00 00    	mov    0x18c2(%rip),%eax        # 22e0 <stdout>
+     a1e:	48 8d 15 34 10 00 00 	lea    0x1034(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     a25:	48 89 d6             	mov    %rdx,%rsi
+     a28:	89 c7                	mov    %eax,%edi
+     a2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     a2f:	e8 b2 05 00 00       	call   fe6 <printf>
+     a34:	90                   	nop
+     a35:	eb fd                	jmp    a34 <testinvalidargs+0x4ae>
+
+  printf(stdout, "passed argument checking for dup\n");
+     a37:	8b 05 a3 18 00 00    	mov    0x18a3(%rip),%eax        # 22e0 <stdout>
+     a3d:	48 8d 15 34 14 00 00 	lea    0x1434(%rip),%rdx        # 1e78 <malloc+0x610>
+     a44:	48 89 d6             	mov    %rdx,%rsi
+     a47:	89 c7                	mov    %eax,%edi
+     a49:	b8 00 00 00 00       	mov    $0x0,%eax
+     a4e:	e8 93 05 00 00       	call   fe6 <printf>
+
+  // close
+  if (close(15) != -1)
+     a53:	bf 0f 00 00 00       	mov    $0xf,%edi
+     a58:	e8 58 0b 00 00       	call   15b5 <close>
+     a5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     a60:	74 5c                	je     abe <testinvalidargs+0x538>
+    error("able to close non open file");
+     a62:	8b 05 78 18 00 00    	mov    0x1878(%rip),%eax        # 22e0 <stdout>
+     a68:	ba 8c 00 00 00       	mov    $0x8c,%edx
+     a6d:	48 8d 0d b9 0f 00 00 	lea    0xfb9(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     a74:	48 89 ce             	mov    %rcx,%rsi
+     a77:	89 c7                	mov    %eax,%edi
+     a79:	b8 00 00 00 00       	mov    $0x0,%eax
+     a7e:	e8 63 05 00 00       	call   fe6 <printf>
+     a83:	8b 05 57 18 00 00    	mov    0x1857(%rip),%eax        # 22e0 <stdout>
+     a89:	48 8d 15 0a 14 00 00 	lea    0x140a(%rip),%rdx        # 1e9a <malloc+0x632>
+     a90:	48 89 d6             	mov    %rdx,%rsi
+     a93:	89 c7                	mov    %eax,%edi
+     a95:	b8 00 00 00 00       	mov    $0x0,%eax
+     a9a:	e8 47 05 00 00       	call   fe6 <printf>
+     a9f:	8b 05 3b 18 00 00    	mov    0x183b(%rip),%eax        # 22e0 <stdout>
+     aa5:	48 8d 15 ad 0f 00 00 	lea    0xfad(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     aac:	48 89 d6             	mov    %rdx,%rsi
+     aaf:	89 c7                	mov    %eax,%edi
+     ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ab6:	e8 2b 05 00 00       	call   fe6 <printf>
+     abb:	90                   	nop
+     abc:	eb fd                	jmp    abb <testinvalidargs+0x535>
+
+  if (close(fd) > 0 && close(fd) != -1)
+     abe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ac1:	89 c7                	mov    %eax,%edi
+     ac3:	e8 ed 0a 00 00       	call   15b5 <close>
+     ac8:	85 c0                	test   %eax,%eax
+     aca:	7e 6b                	jle    b37 <testinvalidargs+0x5b1>
+     acc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     acf:	89 c7                	mov    %eax,%edi
+     ad1:	e8 df 0a 00 00       	call   15b5 <close>
+     ad6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ad9:	74 5c                	je     b37 <testinvalidargs+0x5b1>
+    error("able to close same file twice");
+     adb:	8b 05 ff 17 00 00    	mov    0x17ff(%rip),%eax        # 22e0 <stdout>
+     ae1:	ba 8f 00 00 00       	mov    $0x8f,%edx
+     ae6:	48 8d 0d 40 0f 00 00 	lea    0xf40(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     aed:	48 89 ce             	mov    %rcx,%rsi
+     af0:	89 c7                	mov    %eax,%edi
+     af2:	b8 00 00 00 00       	mov    $0x0,%eax
+     af7:	e8 ea 04 00 00       	call   fe6 <printf>
+     afc:	8b 05 de 17 00 00    	mov    0x17de(%rip),%eax        # 22e0 <stdout>
+     b02:	48 8d 15 ad 13 00 00 	lea    0x13ad(%rip),%rdx        # 1eb6 <malloc+0x64e>
+     b09:	48 89 d6             	mov    %rdx,%rsi
+     b0c:	89 c7                	mov    %eax,%edi
+     b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b13:	e8 ce 04 00 00       	call   fe6 <printf>
+     b18:	8b 05 c2 17 00 00    	mov    0x17c2(%rip),%eax        # 22e0 <stdout>
+     b1e:	48 8d 15 34 0f 00 00 	lea    0xf34(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     b25:	48 89 d6             	mov    %rdx,%rsi
+     b28:	89 c7                	mov    %eax,%edi
+     b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2f:	e8 b2 04 00 00       	call   fe6 <printf>
+     b34:	90                   	nop
+     b35:	eb fd                	jmp    b34 <testinvalidargs+0x5ae>
+
+  printf(stdout, "passed argument checking for close\n");
+     b37:	8b 05 a3 17 00 00    	mov    0x17a3(%rip),%eax        # 22e0 <stdout>
+     b3d:	48 8d 15 94 13 00 00 	lea    0x1394(%rip),%rdx        # 1ed8 <malloc+0x670>
+     b44:	48 89 d6             	mov    %rdx,%rsi
+     b47:	89 c7                	mov    %eax,%edi
+     b49:	b8 00 00 00 00       	mov    $0x0,%eax
+     b4e:	e8 93 04 00 00       	call   fe6 <printf>
+
+  // pipe
+  if (pipe((int *)0xffffff00) != -1)
+     b53:	b8 00 ff ff ff       	mov    $0xffffff00,%eax
+     b58:	48 89 c7             	mov    %rax,%rdi
+     b5b:	e8 3d 0a 00 00       	call   159d <pipe>
+     b60:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b63:	74 5c                	je     bc1 <testinvalidargs+0x63b>
+    error("able to alloc a pipe not in my memory region");
+     b65:	8b 05 75 17 00 00    	mov    0x1775(%rip),%eax        # 22e0 <stdout>
+     b6b:	ba 95 00 00 00       	mov    $0x95,%edx
+     b70:	48 8d 0d b6 0e 00 00 	lea    0xeb6(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     b77:	48 89 ce             	mov    %rcx,%rsi
+     b7a:	89 c7                	mov    %eax,%edi
+     b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b81:	e8 60 04 00 00       	call   fe6 <printf>
+     b86:	8b 05 54 17 00 00    	mov    0x1754(%rip),%eax        # 22e0 <stdout>
+     b8c:	48 8d 15 6d 13 00 00 	lea    0x136d(%rip),%rdx        # 1f00 <malloc+0x698>
+     b93:	48 89 d6             	mov    %rdx,%rsi
+     b96:	89 c7                	mov    %eax,%edi
+     b98:	b8 00 00 00 00       	mov    $0x0,%eax
+     b9d:	e8 44 04 00 00       	call   fe6 <printf>
+     ba2:	8b 05 38 17 00 00    	mov    0x1738(%rip),%eax        # 22e0 <stdout>
+     ba8:	48 8d 15 aa 0e 00 00 	lea    0xeaa(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     baf:	48 89 d6             	mov    %rdx,%rsi
+     bb2:	89 c7                	mov    %eax,%edi
+     bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb9:	e8 28 04 00 00       	call   fe6 <printf>
+     bbe:	90                   	nop
+     bbf:	eb fd                	jmp    bbe <testinvalidargs+0x638>
+
+  printf(stdout, "passed argument checking for pipe\n");
+     bc1:	8b 05 19 17 00 00    	mov    0x1719(%rip),%eax        # 22e0 <stdout>
+     bc7:	48 8d 15 62 13 00 00 	lea    0x1362(%rip),%rdx        # 1f30 <malloc+0x6c8>
+     bce:	48 89 d6             	mov    %rdx,%rsi
+     bd1:	89 c7                	mov    %eax,%edi
+     bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd8:	e8 09 04 00 00       	call   fe6 <printf>
+}
+     bdd:	90                   	nop
+     bde:	c9                   	leave
+     bdf:	c3                   	ret
+
+0000000000000be0 <testmaxfiles>:
+
+void
+testmaxfiles(void)
+{
+     be0:	55                   	push   %rbp
+     be1:	48 89 e5             	mov    %rsp,%rbp
+}
+     be4:	90                   	nop
+     be5:	5d                   	pop    %rbp
+     be6:	c3                   	ret
+
+0000000000000be7 <pipetest>:
+
+void
+pipetest(void)
+{
+     be7:	55                   	push   %rbp
+     be8:	48 89 e5             	mov    %rsp,%rbp
+     beb:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[11];
+  int pfds[2];
+  int i;
+  pipe(pfds);
+     bef:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+     bf3:	48 89 c7             	mov    %rax,%rdi
+     bf6:	e8 a2 09 00 00       	call   159d <pipe>
+
+  if(write(pfds[1], "aaaaaaaaaa", 10) != 10)
+     bfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     bfe:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c03:	48 8d 0d ae 0e 00 00 	lea    0xeae(%rip),%rcx        # 1ab8 <malloc+0x250>
+     c0a:	48 89 ce             	mov    %rcx,%rsi
+     c0d:	89 c7                	mov    %eax,%edi
+     c0f:	e8 99 09 00 00       	call   15ad <write>
+     c14:	83 f8 0a             	cmp    $0xa,%eax
+     c17:	74 5c                	je     c75 <pipetest+0x8e>
+    error("unable to write to pipe");
+     c19:	8b 05 c1 16 00 00    	mov    0x16c1(%rip),%eax        # 22e0 <stdout>
+     c1f:	ba a8 00 00 00       	mov    $0xa8,%edx
+     c24:	48 8d 0d 02 0e 00 00 	lea    0xe02(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     c2b:	48 89 ce             	mov    %rcx,%rsi
+     c2e:	89 c7                	mov    %eax,%edi
+     c30:	b8 00 00 00 00       	mov    $0x0,%eax
+     c35:	e8 ac 03 00 00       	call   fe6 <printf>
+     c3a:	8b 05 a0 16 00 00    	mov    0x16a0(%rip),%eax        # 22e0 <stdout>
+     c40:	48 8d 15 0c 13 00 00 	lea    0x130c(%rip),%rdx        # 1f53 <malloc+0x6eb>
+     c47:	48 89 d6             	mov    %rdx,%rsi
+     c4a:	89 c7                	mov    %eax,%edi
+     c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+     c51:	e8 90 03 00 00       	call   fe6 <printf>
+     c56:	8b 05 84 16 00 00    	mov    0x1684(%rip),%eax        # 22e0 <stdout>
+     c5c:	48 8d 15 f6 0d 00 00 	lea    0xdf6(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     c63:	48 89 d6             	mov    %rdx,%rsi
+     c66:	89 c7                	mov    %eax,%edi
+     c68:	b8 00 00 00 00       	mov    $0x0,%eax
+     c6d:	e8 74 03 00 00       	call   fe6 <printf>
+     c72:	90                   	nop
+     c73:	eb fd                	jmp    c72 <pipetest+0x8b>
+
+  if ((i = read(pfds[0], buf, 10)) != 10)
+     c75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     c78:	48 8d 4d f1          	lea    -0xf(%rbp),%rcx
+     c7c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c81:	48 89 ce             	mov    %rcx,%rsi
+     c84:	89 c7                	mov    %eax,%edi
+     c86:	e8 1a 09 00 00       	call   15a5 <read>
+     c8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     c8e:	83 7d fc 0a          	cmpl   $0xa,-0x4(%rbp)
+     c92:	74 5f                	je     cf3 <pipetest+0x10c>
+    error("didn't read 10 bytes, only read %d bytes", i);
+     c94:	8b 05 46 16 00 00    	mov    0x1646(%rip),%eax        # 22e0 <stdout>
+     c9a:	ba ab 00 00 00       	mov    $0xab,%edx
+     c9f:	48 8d 0d 87 0d 00 00 	lea    0xd87(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     ca6:	48 89 ce             	mov    %rcx,%rsi
+     ca9:	89 c7                	mov    %eax,%edi
+     cab:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb0:	e8 31 03 00 00       	call   fe6 <printf>
+     cb5:	8b 05 25 16 00 00    	mov    0x1625(%rip),%eax        # 22e0 <stdout>
+     cbb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     cbe:	48 8d 0d ab 12 00 00 	lea    0x12ab(%rip),%rcx        # 1f70 <malloc+0x708>
+     cc5:	48 89 ce             	mov    %rcx,%rsi
+     cc8:	89 c7                	mov    %eax,%edi
+     cca:	b8 00 00 00 00       	mov    $0x0,%eax
+     ccf:	e8 12 03 00 00       	call   fe6 <printf>
+     cd4:	8b 05 06 16 00 00    	mov    0x1606(%rip),%eax        # 22e0 <stdout>
+     cda:	48 8d 15 78 0d 00 00 	lea    0xd78(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     ce1:	48 89 d6             	mov    %rdx,%rsi
+     ce4:	89 c7                	mov    %eax,%edi
+     ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+     ceb:	e8 f6 02 00 00       	call   fe6 <printf>
+     cf0:	90                   	nop
+     cf1:	eb fd                	jmp    cf0 <pipetest+0x109>
+
+  buf[10] = 0;
+     cf3:	c6 45 fb 00          	movb   $0x0,-0x5(%rbp)
+  if (strcmp(buf, "aaaaaaaaaa") != 0)
+     cf7:	48 8d 45 f1          	lea    -0xf(%rbp),%rax
+     cfb:	48 8d 15 b6 0d 00 00 	lea    0xdb6(%rip),%rdx        # 1ab8 <malloc+0x250>
+     d02:	48 89 d6             	mov    %rdx,%rsi
+     d05:	48 89 c7             	mov    %rax,%rdi
+     d08:	e8 1a 06 00 00       	call   1327 <strcmp>
+     d0d:	85 c0                	test   %eax,%eax
+     d0f:	74 60                	je     d71 <pipetest+0x18a>
+    error("buf wasn't 10 a's, was '%s'", buf);
+     d11:	8b 05 c9 15 00 00    	mov    0x15c9(%rip),%eax        # 22e0 <stdout>
+     d17:	ba af 00 00 00       	mov    $0xaf,%edx
+     d1c:	48 8d 0d 0a 0d 00 00 	lea    0xd0a(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     d23:	48 89 ce             	mov    %rcx,%rsi
+     d26:	89 c7                	mov    %eax,%edi
+     d28:	b8 00 00 00 00       	mov    $0x0,%eax
+     d2d:	e8 b4 02 00 00       	call   fe6 <printf>
+     d32:	8b 05 a8 15 00 00    	mov    0x15a8(%rip),%eax        # 22e0 <stdout>
+     d38:	48 8d 55 f1          	lea    -0xf(%rbp),%rdx
+     d3c:	48 8d 0d 56 12 00 00 	lea    0x1256(%rip),%rcx        # 1f99 <malloc+0x731>
+     d43:	48 89 ce             	mov    %rcx,%rsi
+     d46:	89 c7                	mov    %eax,%edi
+     d48:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4d:	e8 94 02 00 00       	call   fe6 <printf>
+     d52:	8b 05 88 15 00 00    	mov    0x1588(%rip),%eax        # 22e0 <stdout>
+     d58:	48 8d 15 fa 0c 00 00 	lea    0xcfa(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     d5f:	48 89 d6             	mov    %rdx,%rsi
+     d62:	89 c7                	mov    %eax,%edi
+     d64:	b8 00 00 00 00       	mov    $0x0,%eax
+     d69:	e8 78 02 00 00       	call   fe6 <printf>
+     d6e:	90                   	nop
+     d6f:	eb fd                	jmp    d6e <pipetest+0x187>
+
+  printf(stdout, "read succeeded ok\n");
+     d71:	8b 05 69 15 00 00    	mov    0x1569(%rip),%eax        # 22e0 <stdout>
+     d77:	48 8d 15 37 12 00 00 	lea    0x1237(%rip),%rdx        # 1fb5 <malloc+0x74d>
+     d7e:	48 89 d6             	mov    %rdx,%rsi
+     d81:	89 c7                	mov    %eax,%edi
+     d83:	b8 00 00 00 00       	mov    $0x0,%eax
+     d88:	e8 59 02 00 00       	call   fe6 <printf>
+
+  if (close(pfds[0]) < 0 || close(pfds[1]) < 0)
+     d8d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     d90:	89 c7                	mov    %eax,%edi
+     d92:	e8 1e 08 00 00       	call   15b5 <close>
+     d97:	85 c0                	test   %eax,%eax
+     d99:	78 0e                	js     da9 <pipetest+0x1c2>
+     d9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     d9e:	89 c7                	mov    %eax,%edi
+     da0:	e8 10 08 00 00       	call   15b5 <close>
+     da5:	85 c0                	test   %eax,%eax
+     da7:	79 5c                	jns    e05 <pipetest+0x21e>
+    error("closing the files in the pipe");
+     da9:	8b 05 31 15 00 00    	mov    0x1531(%rip),%eax        # 22e0 <stdout>
+     daf:	ba b4 00 00 00       	mov    $0xb4,%edx
+     db4:	48 8d 0d 72 0c 00 00 	lea    0xc72(%rip),%rcx        # 1a2d <malloc+0x1c5>
+     dbb:	48 89 ce             	mov    %rcx,%rsi
+     dbe:	89 c7                	mov    %eax,%edi
+     dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc5:	e8 1c 02 00 00       	call   fe6 <printf>
+     dca:	8b 05 10 15 00 00    	mov    0x1510(%rip),%eax        # 22e0 <stdout>
+     dd0:	48 8d 15 f1 11 00 00 	lea    0x11f1(%rip),%rdx        # 1fc8 <malloc+0x760>
+     dd7:	48 89 d6             	mov    %rdx,%rsi
+     dda:	89 c7                	mov    %eax,%edi
+     ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+     de1:	e8 00 02 00 00       	call   fe6 <printf>
+     de6:	8b 05 f4 14 00 00    	mov    0x14f4(%rip),%eax        # 22e0 <stdout>
+     dec:	48 8d 15 66 0c 00 00 	lea    0xc66(%rip),%rdx        # 1a59 <malloc+0x1f1>
+     df3:	48 89 d6             	mov    %rdx,%rsi
+     df6:	89 c7                	mov    %eax,%edi
+     df8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dfd:	e8 e4 01 00 00       	call   fe6 <printf>
+     e02:	90                   	nop
+     e03:	eb fd                	jmp    e02 <pipetest+0x21b>
+
+  printf(stdout, "pipe test ok\n");
+     e05:	8b 05 d5 14 00 00    	mov    0x14d5(%rip),%eax        # 22e0 <stdout>
+     e0b:	48 8d 15 d4 11 00 00 	lea    0x11d4(%rip),%rdx        # 1fe6 <malloc+0x77e>
+     e12:	48 89 d6             	mov    %rdx,%rsi
+     e15:	89 c7                	mov    %eax,%edi
+     e17:	b8 00 00 00 00       	mov    $0x0,%eax
+     e1c:	e8 c5 01 00 00       	call   fe6 <printf>
+}
+     e21:	90                   	nop
+     e22:	c9                   	leave
+     e23:	c3                   	ret
+
+0000000000000e24 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     e24:	55                   	push   %rbp
+     e25:	48 89 e5             	mov    %rsp,%rbp
+     e28:	48 83 ec 10          	sub    $0x10,%rsp
+     e2c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     e2f:	89 f0                	mov    %esi,%eax
+     e31:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     e34:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     e38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e3b:	ba 01 00 00 00       	mov    $0x1,%edx
+     e40:	48 89 ce             	mov    %rcx,%rsi
+     e43:	89 c7                	mov    %eax,%edi
+     e45:	e8 63 07 00 00       	call   15ad <write>
+}
+     e4a:	90                   	nop
+     e4b:	c9                   	leave
+     e4c:	c3                   	ret
+
+0000000000000e4d <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     e4d:	55                   	push   %rbp
+     e4e:	48 89 e5             	mov    %rsp,%rbp
+     e51:	48 83 ec 40          	sub    $0x40,%rsp
+     e55:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     e58:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     e5b:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     e5e:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     e61:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     e65:	74 1f                	je     e86 <printint64+0x39>
+     e67:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     e6a:	c1 e8 1f             	shr    $0x1f,%eax
+     e6d:	0f b6 c0             	movzbl %al,%eax
+     e70:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     e73:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     e77:	74 0d                	je     e86 <printint64+0x39>
+    x = -xx;
+     e79:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     e7c:	f7 d8                	neg    %eax
+     e7e:	48 98                	cltq
+     e80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e84:	eb 09                	jmp    e8f <printint64+0x42>
+  else
+    x = xx;
+     e86:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     e89:	48 98                	cltq
+     e8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     e8f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     e96:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     e99:	48 63 c8             	movslq %eax,%rcx
+     e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea0:	ba 00 00 00 00       	mov    $0x0,%edx
+     ea5:	48 f7 f1             	div    %rcx
+     ea8:	48 89 d1             	mov    %rdx,%rcx
+     eab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eae:	8d 50 01             	lea    0x1(%rax),%edx
+     eb1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     eb4:	48 8d 15 35 14 00 00 	lea    0x1435(%rip),%rdx        # 22f0 <digits.1>
+     ebb:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     ebf:	48 98                	cltq
+     ec1:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     ec5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     ec8:	48 63 f0             	movslq %eax,%rsi
+     ecb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+     ed4:	48 f7 f6             	div    %rsi
+     ed7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     edb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     ee0:	75 b4                	jne    e96 <printint64+0x49>
+
+  if(sgn)
+     ee2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     ee6:	74 2b                	je     f13 <printint64+0xc6>
+    buf[i++] = '-';
+     ee8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     eeb:	8d 50 01             	lea    0x1(%rax),%edx
+     eee:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ef1:	48 98                	cltq
+     ef3:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     ef8:	eb 19                	jmp    f13 <printint64+0xc6>
+    putc(fd, buf[i]);
+     efa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     efd:	48 98                	cltq
+     eff:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     f04:	0f be d0             	movsbl %al,%edx
+     f07:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     f0a:	89 d6                	mov    %edx,%esi
+     f0c:	89 c7                	mov    %eax,%edi
+     f0e:	e8 11 ff ff ff       	call   e24 <putc>
+  while(--i >= 0)
+     f13:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     f17:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f1b:	79 dd                	jns    efa <printint64+0xad>
+}
+     f1d:	90                   	nop
+     f1e:	90                   	nop
+     f1f:	c9                   	leave
+     f20:	c3                   	ret
+
+0000000000000f21 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     f21:	55                   	push   %rbp
+     f22:	48 89 e5             	mov    %rsp,%rbp
+     f25:	48 83 ec 30          	sub    $0x30,%rsp
+     f29:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f2c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     f2f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     f32:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     f35:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     f3c:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     f40:	74 17                	je     f59 <printint+0x38>
+     f42:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     f46:	79 11                	jns    f59 <printint+0x38>
+    neg = 1;
+     f48:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     f4f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     f52:	f7 d8                	neg    %eax
+     f54:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     f57:	eb 06                	jmp    f5f <printint+0x3e>
+  } else {
+    x = xx;
+     f59:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     f5c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     f5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     f66:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     f69:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+     f71:	f7 f1                	div    %ecx
+     f73:	89 d1                	mov    %edx,%ecx
+     f75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f78:	8d 50 01             	lea    0x1(%rax),%edx
+     f7b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     f7e:	89 c9                	mov    %ecx,%ecx
+     f80:	48 8d 15 89 13 00 00 	lea    0x1389(%rip),%rdx        # 2310 <digits.0>
+     f87:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     f8b:	48 98                	cltq
+     f8d:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     f91:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     f94:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f97:	ba 00 00 00 00       	mov    $0x0,%edx
+     f9c:	f7 f6                	div    %esi
+     f9e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     fa1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     fa5:	75 bf                	jne    f66 <printint+0x45>
+  if(neg)
+     fa7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     fab:	74 2b                	je     fd8 <printint+0xb7>
+    buf[i++] = '-';
+     fad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fb0:	8d 50 01             	lea    0x1(%rax),%edx
+     fb3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     fb6:	48 98                	cltq
+     fb8:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     fbd:	eb 19                	jmp    fd8 <printint+0xb7>
+    putc(fd, buf[i]);
+     fbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fc2:	48 98                	cltq
+     fc4:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     fc9:	0f be d0             	movsbl %al,%edx
+     fcc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fcf:	89 d6                	mov    %edx,%esi
+     fd1:	89 c7                	mov    %eax,%edi
+     fd3:	e8 4c fe ff ff       	call   e24 <putc>
+  while(--i >= 0)
+     fd8:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     fdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     fe0:	79 dd                	jns    fbf <printint+0x9e>
+}
+     fe2:	90                   	nop
+     fe3:	90                   	nop
+     fe4:	c9                   	leave
+     fe5:	c3                   	ret
+
+0000000000000fe6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     fe6:	55                   	push   %rbp
+     fe7:	48 89 e5             	mov    %rsp,%rbp
+     fea:	48 83 ec 70          	sub    $0x70,%rsp
+     fee:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     ff1:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     ff5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     ff9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     ffd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1001:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    1005:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    100c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1010:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1014:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1018:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    101c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1023:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    102a:	e9 6b 02 00 00       	jmp    129a <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    102f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1032:	48 63 d0             	movslq %eax,%rdx
+    1035:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1039:	48 01 d0             	add    %rdx,%rax
+    103c:	0f b6 00             	movzbl (%rax),%eax
+    103f:	0f be c0             	movsbl %al,%eax
+    1042:	25 ff 00 00 00       	and    $0xff,%eax
+    1047:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    104a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    104e:	75 30                	jne    1080 <printf+0x9a>
+      if(c == '%'){
+    1050:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1054:	75 13                	jne    1069 <printf+0x83>
+        state = '%';
+    1056:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    105d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1064:	e9 2d 02 00 00       	jmp    1296 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1069:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    106c:	0f be d0             	movsbl %al,%edx
+    106f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1072:	89 d6                	mov    %edx,%esi
+    1074:	89 c7                	mov    %eax,%edi
+    1076:	e8 a9 fd ff ff       	call   e24 <putc>
+    107b:	e9 16 02 00 00       	jmp    1296 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    1080:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1084:	0f 85 0c 02 00 00    	jne    1296 <printf+0x2b0>
+      if(c == 'l') {
+    108a:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    108e:	75 0c                	jne    109c <printf+0xb6>
+        lflag = 1;
+    1090:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1097:	e9 fa 01 00 00       	jmp    1296 <printf+0x2b0>
+      } else if(c == 'd'){
+    109c:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    10a0:	0f 85 95 00 00 00    	jne    113b <printf+0x155>
+        if (lflag == 1)
+    10a6:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    10aa:	75 49                	jne    10f5 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    10ac:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    10af:	83 f8 2f             	cmp    $0x2f,%eax
+    10b2:	77 17                	ja     10cb <printf+0xe5>
+    10b4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    10b8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    10bb:	89 d2                	mov    %edx,%edx
+    10bd:	48 01 d0             	add    %rdx,%rax
+    10c0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    10c3:	83 c2 08             	add    $0x8,%edx
+    10c6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    10c9:	eb 0c                	jmp    10d7 <printf+0xf1>
+    10cb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    10cf:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    10d3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    10d7:	48 8b 00             	mov    (%rax),%rax
+    10da:	89 c6                	mov    %eax,%esi
+    10dc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10df:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10e4:	ba 0a 00 00 00       	mov    $0xa,%edx
+    10e9:	89 c7                	mov    %eax,%edi
+    10eb:	e8 5d fd ff ff       	call   e4d <printint64>
+    10f0:	e9 9a 01 00 00       	jmp    128f <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    10f5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    10f8:	83 f8 2f             	cmp    $0x2f,%eax
+    10fb:	77 17                	ja     1114 <printf+0x12e>
+    10fd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1101:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1104:	89 d2                	mov    %edx,%edx
+    1106:	48 01 d0             	add    %rdx,%rax
+    1109:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    110c:	83 c2 08             	add    $0x8,%edx
+    110f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1112:	eb 0c                	jmp    1120 <printf+0x13a>
+    1114:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1118:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    111c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1120:	8b 30                	mov    (%rax),%esi
+    1122:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1125:	b9 01 00 00 00       	mov    $0x1,%ecx
+    112a:	ba 0a 00 00 00       	mov    $0xa,%edx
+    112f:	89 c7                	mov    %eax,%edi
+    1131:	e8 eb fd ff ff       	call   f21 <printint>
+    1136:	e9 54 01 00 00       	jmp    128f <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    113b:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    113f:	74 0a                	je     114b <printf+0x165>
+    1141:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1145:	0f 85 95 00 00 00    	jne    11e0 <printf+0x1fa>
+        if (lflag == 1)
+    114b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    114f:	75 49                	jne    119a <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1151:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1154:	83 f8 2f             	cmp    $0x2f,%eax
+    1157:	77 17                	ja     1170 <printf+0x18a>
+    1159:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    115d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1160:	89 d2                	mov    %edx,%edx
+    1162:	48 01 d0             	add    %rdx,%rax
+    1165:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1168:	83 c2 08             	add    $0x8,%edx
+    116b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    116e:	eb 0c                	jmp    117c <printf+0x196>
+    1170:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1174:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1178:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    117c:	48 8b 00             	mov    (%rax),%rax
+    117f:	89 c6                	mov    %eax,%esi
+    1181:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1184:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1189:	ba 10 00 00 00       	mov    $0x10,%edx
+    118e:	89 c7                	mov    %eax,%edi
+    1190:	e8 b8 fc ff ff       	call   e4d <printint64>
+        if (lflag == 1)
+    1195:	e9 f5 00 00 00       	jmp    128f <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    119a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    119d:	83 f8 2f             	cmp    $0x2f,%eax
+    11a0:	77 17                	ja     11b9 <printf+0x1d3>
+    11a2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    11a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11a9:	89 d2                	mov    %edx,%edx
+    11ab:	48 01 d0             	add    %rdx,%rax
+    11ae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11b1:	83 c2 08             	add    $0x8,%edx
+    11b4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    11b7:	eb 0c                	jmp    11c5 <printf+0x1df>
+    11b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    11bd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    11c1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    11c5:	8b 30                	mov    (%rax),%esi
+    11c7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+    11cf:	ba 10 00 00 00       	mov    $0x10,%edx
+    11d4:	89 c7                	mov    %eax,%edi
+    11d6:	e8 46 fd ff ff       	call   f21 <printint>
+        if (lflag == 1)
+    11db:	e9 af 00 00 00       	jmp    128f <printf+0x2a9>
+      } else if(c == 's'){
+    11e0:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    11e4:	75 6e                	jne    1254 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    11e6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    11e9:	83 f8 2f             	cmp    $0x2f,%eax
+    11ec:	77 17                	ja     1205 <printf+0x21f>
+    11ee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    11f2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11f5:	89 d2                	mov    %edx,%edx
+    11f7:	48 01 d0             	add    %rdx,%rax
+    11fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11fd:	83 c2 08             	add    $0x8,%edx
+    1200:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1203:	eb 0c                	jmp    1211 <printf+0x22b>
+    1205:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1209:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    120d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1211:	48 8b 00             	mov    (%rax),%rax
+    1214:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1218:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    121d:	75 28                	jne    1247 <printf+0x261>
+          s = "(null)";
+    121f:	48 8d 05 ce 0d 00 00 	lea    0xdce(%rip),%rax        # 1ff4 <malloc+0x78c>
+    1226:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    122a:	eb 1b                	jmp    1247 <printf+0x261>
+          putc(fd, *s);
+    122c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1230:	0f b6 00             	movzbl (%rax),%eax
+    1233:	0f be d0             	movsbl %al,%edx
+    1236:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1239:	89 d6                	mov    %edx,%esi
+    123b:	89 c7                	mov    %eax,%edi
+    123d:	e8 e2 fb ff ff       	call   e24 <putc>
+        for(; *s; s++)
+    1242:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1247:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    124b:	0f b6 00             	movzbl (%rax),%eax
+    124e:	84 c0                	test   %al,%al
+    1250:	75 da                	jne    122c <printf+0x246>
+    1252:	eb 3b                	jmp    128f <printf+0x2a9>
+      } else if(c == '%'){
+    1254:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1258:	75 14                	jne    126e <printf+0x288>
+        putc(fd, c);
+    125a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    125d:	0f be d0             	movsbl %al,%edx
+    1260:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1263:	89 d6                	mov    %edx,%esi
+    1265:	89 c7                	mov    %eax,%edi
+    1267:	e8 b8 fb ff ff       	call   e24 <putc>
+    126c:	eb 21                	jmp    128f <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    126e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1271:	be 25 00 00 00       	mov    $0x25,%esi
+    1276:	89 c7                	mov    %eax,%edi
+    1278:	e8 a7 fb ff ff       	call   e24 <putc>
+        putc(fd, c);
+    127d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1280:	0f be d0             	movsbl %al,%edx
+    1283:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1286:	89 d6                	mov    %edx,%esi
+    1288:	89 c7                	mov    %eax,%edi
+    128a:	e8 95 fb ff ff       	call   e24 <putc>
+      }
+      state = 0;
+    128f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1296:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    129a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    129d:	48 63 d0             	movslq %eax,%rdx
+    12a0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    12a4:	48 01 d0             	add    %rdx,%rax
+    12a7:	0f b6 00             	movzbl (%rax),%eax
+    12aa:	84 c0                	test   %al,%al
+    12ac:	0f 85 7d fd ff ff    	jne    102f <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    12b2:	90                   	nop
+    12b3:	90                   	nop
+    12b4:	c9                   	leave
+    12b5:	c3                   	ret
+
+00000000000012b6 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    12b6:	55                   	push   %rbp
+    12b7:	48 89 e5             	mov    %rsp,%rbp
+    12ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    12be:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    12c1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    12c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    12c8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    12cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    12ce:	48 89 ce             	mov    %rcx,%rsi
+    12d1:	48 89 f7             	mov    %rsi,%rdi
+    12d4:	89 d1                	mov    %edx,%ecx
+    12d6:	fc                   	cld
+    12d7:	f3 aa                	rep stos %al,%es:(%rdi)
+    12d9:	89 ca                	mov    %ecx,%edx
+    12db:	48 89 fe             	mov    %rdi,%rsi
+    12de:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    12e2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    12e5:	90                   	nop
+    12e6:	5d                   	pop    %rbp
+    12e7:	c3                   	ret
+
+00000000000012e8 <strcpy>:
+{
+    12e8:	55                   	push   %rbp
+    12e9:	48 89 e5             	mov    %rsp,%rbp
+    12ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    12f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    12f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    12fc:	90                   	nop
+    12fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1301:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1305:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    130d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1311:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1315:	0f b6 12             	movzbl (%rdx),%edx
+    1318:	88 10                	mov    %dl,(%rax)
+    131a:	0f b6 00             	movzbl (%rax),%eax
+    131d:	84 c0                	test   %al,%al
+    131f:	75 dc                	jne    12fd <strcpy+0x15>
+  return os;
+    1321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1325:	5d                   	pop    %rbp
+    1326:	c3                   	ret
+
+0000000000001327 <strcmp>:
+{
+    1327:	55                   	push   %rbp
+    1328:	48 89 e5             	mov    %rsp,%rbp
+    132b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    132f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1333:	eb 0a                	jmp    133f <strcmp+0x18>
+    p++, q++;
+    1335:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    133a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    133f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1343:	0f b6 00             	movzbl (%rax),%eax
+    1346:	84 c0                	test   %al,%al
+    1348:	74 12                	je     135c <strcmp+0x35>
+    134a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    134e:	0f b6 10             	movzbl (%rax),%edx
+    1351:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1355:	0f b6 00             	movzbl (%rax),%eax
+    1358:	38 c2                	cmp    %al,%dl
+    135a:	74 d9                	je     1335 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    135c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1360:	0f b6 00             	movzbl (%rax),%eax
+    1363:	0f b6 d0             	movzbl %al,%edx
+    1366:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    136a:	0f b6 00             	movzbl (%rax),%eax
+    136d:	0f b6 c0             	movzbl %al,%eax
+    1370:	29 c2                	sub    %eax,%edx
+    1372:	89 d0                	mov    %edx,%eax
+}
+    1374:	5d                   	pop    %rbp
+    1375:	c3                   	ret
+
+0000000000001376 <strlen>:
+{
+    1376:	55                   	push   %rbp
+    1377:	48 89 e5             	mov    %rsp,%rbp
+    137a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    137e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1385:	eb 04                	jmp    138b <strlen+0x15>
+    1387:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    138b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    138e:	48 63 d0             	movslq %eax,%rdx
+    1391:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1395:	48 01 d0             	add    %rdx,%rax
+    1398:	0f b6 00             	movzbl (%rax),%eax
+    139b:	84 c0                	test   %al,%al
+    139d:	75 e8                	jne    1387 <strlen+0x11>
+  return n;
+    139f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    13a2:	5d                   	pop    %rbp
+    13a3:	c3                   	ret
+
+00000000000013a4 <memset>:
+{
+    13a4:	55                   	push   %rbp
+    13a5:	48 89 e5             	mov    %rsp,%rbp
+    13a8:	48 83 ec 10          	sub    $0x10,%rsp
+    13ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13b0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    13b3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    13b6:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    13b9:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    13bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13c0:	89 ce                	mov    %ecx,%esi
+    13c2:	48 89 c7             	mov    %rax,%rdi
+    13c5:	e8 ec fe ff ff       	call   12b6 <stosb>
+  return dst;
+    13ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    13ce:	c9                   	leave
+    13cf:	c3                   	ret
+
+00000000000013d0 <strchr>:
+{
+    13d0:	55                   	push   %rbp
+    13d1:	48 89 e5             	mov    %rsp,%rbp
+    13d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    13d8:	89 f0                	mov    %esi,%eax
+    13da:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    13dd:	eb 17                	jmp    13f6 <strchr+0x26>
+    if(*s == c)
+    13df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13e3:	0f b6 00             	movzbl (%rax),%eax
+    13e6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    13e9:	75 06                	jne    13f1 <strchr+0x21>
+      return (char*)s;
+    13eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13ef:	eb 15                	jmp    1406 <strchr+0x36>
+  for(; *s; s++)
+    13f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    13f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13fa:	0f b6 00             	movzbl (%rax),%eax
+    13fd:	84 c0                	test   %al,%al
+    13ff:	75 de                	jne    13df <strchr+0xf>
+  return 0;
+    1401:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1406:	5d                   	pop    %rbp
+    1407:	c3                   	ret
+
+0000000000001408 <gets>:
+gets(char *buf, int max)
+{
+    1408:	55                   	push   %rbp
+    1409:	48 89 e5             	mov    %rsp,%rbp
+    140c:	48 83 ec 20          	sub    $0x20,%rsp
+    1410:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1414:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    1417:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    141e:	eb 48                	jmp    1468 <gets+0x60>
+    cc = read(0, &c, 1);
+    1420:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1424:	ba 01 00 00 00       	mov    $0x1,%edx
+    1429:	48 89 c6             	mov    %rax,%rsi
+    142c:	bf 00 00 00 00       	mov    $0x0,%edi
+    1431:	e8 6f 01 00 00       	call   15a5 <read>
+    1436:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1439:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    143d:	7e 36                	jle    1475 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    143f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1442:	8d 50 01             	lea    0x1(%rax),%edx
+    1445:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1448:	48 63 d0             	movslq %eax,%rdx
+    144b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    144f:	48 01 c2             	add    %rax,%rdx
+    1452:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1456:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1458:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    145c:	3c 0a                	cmp    $0xa,%al
+    145e:	74 16                	je     1476 <gets+0x6e>
+    1460:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1464:	3c 0d                	cmp    $0xd,%al
+    1466:	74 0e                	je     1476 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1468:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    146b:	83 c0 01             	add    $0x1,%eax
+    146e:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1471:	7f ad                	jg     1420 <gets+0x18>
+    1473:	eb 01                	jmp    1476 <gets+0x6e>
+      break;
+    1475:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1476:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1479:	48 63 d0             	movslq %eax,%rdx
+    147c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1480:	48 01 d0             	add    %rdx,%rax
+    1483:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    148a:	c9                   	leave
+    148b:	c3                   	ret
+
+000000000000148c <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    148c:	55                   	push   %rbp
+    148d:	48 89 e5             	mov    %rsp,%rbp
+    1490:	48 83 ec 20          	sub    $0x20,%rsp
+    1494:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1498:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    149c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14a0:	be 00 00 00 00       	mov    $0x0,%esi
+    14a5:	48 89 c7             	mov    %rax,%rdi
+    14a8:	e8 20 01 00 00       	call   15cd <open>
+    14ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    14b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    14b4:	79 07                	jns    14bd <stat+0x31>
+    return -1;
+    14b6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    14bb:	eb 21                	jmp    14de <stat+0x52>
+  r = fstat(fd, st);
+    14bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    14c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14c4:	48 89 d6             	mov    %rdx,%rsi
+    14c7:	89 c7                	mov    %eax,%edi
+    14c9:	e8 17 01 00 00       	call   15e5 <fstat>
+    14ce:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    14d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14d4:	89 c7                	mov    %eax,%edi
+    14d6:	e8 da 00 00 00       	call   15b5 <close>
+  return r;
+    14db:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    14de:	c9                   	leave
+    14df:	c3                   	ret
+
+00000000000014e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    14e0:	55                   	push   %rbp
+    14e1:	48 89 e5             	mov    %rsp,%rbp
+    14e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    14e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    14ef:	eb 28                	jmp    1519 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    14f1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    14f4:	89 d0                	mov    %edx,%eax
+    14f6:	c1 e0 02             	shl    $0x2,%eax
+    14f9:	01 d0                	add    %edx,%eax
+    14fb:	01 c0                	add    %eax,%eax
+    14fd:	89 c1                	mov    %eax,%ecx
+    14ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1503:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1507:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    150b:	0f b6 00             	movzbl (%rax),%eax
+    150e:	0f be c0             	movsbl %al,%eax
+    1511:	01 c8                	add    %ecx,%eax
+    1513:	83 e8 30             	sub    $0x30,%eax
+    1516:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1519:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    151d:	0f b6 00             	movzbl (%rax),%eax
+    1520:	3c 2f                	cmp    $0x2f,%al
+    1522:	7e 0b                	jle    152f <atoi+0x4f>
+    1524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1528:	0f b6 00             	movzbl (%rax),%eax
+    152b:	3c 39                	cmp    $0x39,%al
+    152d:	7e c2                	jle    14f1 <atoi+0x11>
+  return n;
+    152f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1532:	5d                   	pop    %rbp
+    1533:	c3                   	ret
+
+0000000000001534 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1534:	55                   	push   %rbp
+    1535:	48 89 e5             	mov    %rsp,%rbp
+    1538:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    153c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1540:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1547:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    154b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    154f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1553:	eb 1d                	jmp    1572 <memmove+0x3e>
+    *dst++ = *src++;
+    1555:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1559:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    155d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1565:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1569:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    156d:	0f b6 12             	movzbl (%rdx),%edx
+    1570:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1572:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1575:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1578:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    157b:	85 c0                	test   %eax,%eax
+    157d:	7f d6                	jg     1555 <memmove+0x21>
+  return vdst;
+    157f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1583:	5d                   	pop    %rbp
+    1584:	c3                   	ret
+
+0000000000001585 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1585:	b8 01 00 00 00       	mov    $0x1,%eax
+    158a:	cd 40                	int    $0x40
+    158c:	c3                   	ret
+
+000000000000158d <exit>:
+SYSCALL(exit)
+    158d:	b8 02 00 00 00       	mov    $0x2,%eax
+    1592:	cd 40                	int    $0x40
+    1594:	c3                   	ret
+
+0000000000001595 <wait>:
+SYSCALL(wait)
+    1595:	b8 03 00 00 00       	mov    $0x3,%eax
+    159a:	cd 40                	int    $0x40
+    159c:	c3                   	ret
+
+000000000000159d <pipe>:
+SYSCALL(pipe)
+    159d:	b8 04 00 00 00       	mov    $0x4,%eax
+    15a2:	cd 40                	int    $0x40
+    15a4:	c3                   	ret
+
+00000000000015a5 <read>:
+SYSCALL(read)
+    15a5:	b8 05 00 00 00       	mov    $0x5,%eax
+    15aa:	cd 40                	int    $0x40
+    15ac:	c3                   	ret
+
+00000000000015ad <write>:
+SYSCALL(write)
+    15ad:	b8 10 00 00 00       	mov    $0x10,%eax
+    15b2:	cd 40                	int    $0x40
+    15b4:	c3                   	ret
+
+00000000000015b5 <close>:
+SYSCALL(close)
+    15b5:	b8 15 00 00 00       	mov    $0x15,%eax
+    15ba:	cd 40                	int    $0x40
+    15bc:	c3                   	ret
+
+00000000000015bd <kill>:
+SYSCALL(kill)
+    15bd:	b8 06 00 00 00       	mov    $0x6,%eax
+    15c2:	cd 40                	int    $0x40
+    15c4:	c3                   	ret
+
+00000000000015c5 <exec>:
+SYSCALL(exec)
+    15c5:	b8 07 00 00 00       	mov    $0x7,%eax
+    15ca:	cd 40                	int    $0x40
+    15cc:	c3                   	ret
+
+00000000000015cd <open>:
+SYSCALL(open)
+    15cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+    15d2:	cd 40                	int    $0x40
+    15d4:	c3                   	ret
+
+00000000000015d5 <mknod>:
+SYSCALL(mknod)
+    15d5:	b8 11 00 00 00       	mov    $0x11,%eax
+    15da:	cd 40                	int    $0x40
+    15dc:	c3                   	ret
+
+00000000000015dd <unlink>:
+SYSCALL(unlink)
+    15dd:	b8 12 00 00 00       	mov    $0x12,%eax
+    15e2:	cd 40                	int    $0x40
+    15e4:	c3                   	ret
+
+00000000000015e5 <fstat>:
+SYSCALL(fstat)
+    15e5:	b8 08 00 00 00       	mov    $0x8,%eax
+    15ea:	cd 40                	int    $0x40
+    15ec:	c3                   	ret
+
+00000000000015ed <link>:
+SYSCALL(link)
+    15ed:	b8 13 00 00 00       	mov    $0x13,%eax
+    15f2:	cd 40                	int    $0x40
+    15f4:	c3                   	ret
+
+00000000000015f5 <mkdir>:
+SYSCALL(mkdir)
+    15f5:	b8 14 00 00 00       	mov    $0x14,%eax
+    15fa:	cd 40                	int    $0x40
+    15fc:	c3                   	ret
+
+00000000000015fd <chdir>:
+SYSCALL(chdir)
+    15fd:	b8 09 00 00 00       	mov    $0x9,%eax
+    1602:	cd 40                	int    $0x40
+    1604:	c3                   	ret
+
+0000000000001605 <dup>:
+SYSCALL(dup)
+    1605:	b8 0a 00 00 00       	mov    $0xa,%eax
+    160a:	cd 40                	int    $0x40
+    160c:	c3                   	ret
+
+000000000000160d <getpid>:
+SYSCALL(getpid)
+    160d:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1612:	cd 40                	int    $0x40
+    1614:	c3                   	ret
+
+0000000000001615 <sbrk>:
+SYSCALL(sbrk)
+    1615:	b8 0c 00 00 00       	mov    $0xc,%eax
+    161a:	cd 40                	int    $0x40
+    161c:	c3                   	ret
+
+000000000000161d <sleep>:
+SYSCALL(sleep)
+    161d:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1622:	cd 40                	int    $0x40
+    1624:	c3                   	ret
+
+0000000000001625 <uptime>:
+SYSCALL(uptime)
+    1625:	b8 0e 00 00 00       	mov    $0xe,%eax
+    162a:	cd 40                	int    $0x40
+    162c:	c3                   	ret
+
+000000000000162d <sysinfo>:
+SYSCALL(sysinfo)
+    162d:	b8 16 00 00 00       	mov    $0x16,%eax
+    1632:	cd 40                	int    $0x40
+    1634:	c3                   	ret
+
+0000000000001635 <mmap>:
+SYSCALL(mmap)
+    1635:	b8 17 00 00 00       	mov    $0x17,%eax
+    163a:	cd 40                	int    $0x40
+    163c:	c3                   	ret
+
+000000000000163d <munmap>:
+SYSCALL(munmap)
+    163d:	b8 18 00 00 00       	mov    $0x18,%eax
+    1642:	cd 40                	int    $0x40
+    1644:	c3                   	ret
+
+0000000000001645 <crashn>:
+SYSCALL(crashn)
+    1645:	b8 19 00 00 00       	mov    $0x19,%eax
+    164a:	cd 40                	int    $0x40
+    164c:	c3                   	ret
+
+000000000000164d <mmap2>:
+SYSCALL_ADDR(mmap2)
+    164d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1652:	cd 40                	int    $0x40
+    1654:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1657:	74 02                	je     165b <mmap2+0xe>
+    1659:	89 c0                	mov    %eax,%eax
+    165b:	c3                   	ret
+
+000000000000165c <munmap2>:
+SYSCALL(munmap2)
+    165c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1661:	cd 40                	int    $0x40
+    1663:	c3                   	ret
+
+0000000000001664 <msync>:
+SYSCALL(msync)
+    1664:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1669:	cd 40                	int    $0x40
+    166b:	c3                   	ret
+
+000000000000166c <sendfile>:
+SYSCALL(sendfile)
+    166c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1671:	cd 40                	int    $0x40
+    1673:	c3                   	ret
+
+0000000000001674 <splice>:
+SYSCALL(splice)
+    1674:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1679:	cd 40                	int    $0x40
+    167b:	c3                   	ret
+
+000000000000167c <pread>:
+SYSCALL(pread)
+    167c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1681:	cd 40                	int    $0x40
+    1683:	c3                   	ret
+
+0000000000001684 <pwrite>:
+SYSCALL(pwrite)
+    1684:	b8 20 00 00 00       	mov    $0x20,%eax
+    1689:	cd 40                	int    $0x40
+    168b:	c3                   	ret
+
+000000000000168c <readv>:
+SYSCALL(readv)
+    168c:	b8 21 00 00 00       	mov    $0x21,%eax
+    1691:	cd 40                	int    $0x40
+    1693:	c3                   	ret
+
+0000000000001694 <writev>:
+SYSCALL(writev)
+    1694:	b8 22 00 00 00       	mov    $0x22,%eax
+    1699:	cd 40                	int    $0x40
+    169b:	c3                   	ret
+
+000000000000169c <poll>:
+SYSCALL(poll)
+    169c:	b8 23 00 00 00       	mov    $0x23,%eax
+    16a1:	cd 40                	int    $0x40
+    16a3:	c3                   	ret
+
+00000000000016a4 <pipe2>:
+SYSCALL(pipe2)
+    16a4:	b8 24 00 00 00       	mov    $0x24,%eax
+    16a9:	cd 40                	int    $0x40
+    16ab:	c3                   	ret
+
+00000000000016ac <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    16ac:	55                   	push   %rbp
+    16ad:	48 89 e5             	mov    %rsp,%rbp
+    16b0:	48 83 ec 20          	sub    $0x20,%rsp
+    16b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    16b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16bc:	48 83 e8 10          	sub    $0x10,%rax
+    16c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    16c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16c8:	48 8b 10             	mov    (%rax),%rdx
+    16cb:	48 8d 05 7e 0c 00 00 	lea    0xc7e(%rip),%rax        # 2350 <bigblock>
+    16d2:	48 39 c2             	cmp    %rax,%rdx
+    16d5:	75 1f                	jne    16f6 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    16d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16db:	8b 40 08             	mov    0x8(%rax),%eax
+    16de:	c1 e0 04             	shl    $0x4,%eax
+    16e1:	89 c2                	mov    %eax,%edx
+    16e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16e7:	89 d6                	mov    %edx,%esi
+    16e9:	48 89 c7             	mov    %rax,%rdi
+    16ec:	e8 6b ff ff ff       	call   165c <munmap2>
+    return;
+    16f1:	e9 0b 01 00 00       	jmp    1801 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    16f6:	48 8b 05 43 0c 00 00 	mov    0xc43(%rip),%rax        # 2340 <freep>
+    16fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1701:	eb 2f                	jmp    1732 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1703:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1707:	48 8b 00             	mov    (%rax),%rax
+    170a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    170e:	72 17                	jb     1727 <free+0x7b>
+    1710:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1714:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1718:	72 2f                	jb     1749 <free+0x9d>
+    171a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    171e:	48 8b 00             	mov    (%rax),%rax
+    1721:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1725:	72 22                	jb     1749 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    172b:	48 8b 00             	mov    (%rax),%rax
+    172e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1732:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1736:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    173a:	73 c7                	jae    1703 <free+0x57>
+    173c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1740:	48 8b 00             	mov    (%rax),%rax
+    1743:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1747:	73 ba                	jae    1703 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1749:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    174d:	8b 40 08             	mov    0x8(%rax),%eax
+    1750:	89 c0                	mov    %eax,%eax
+    1752:	48 c1 e0 04          	shl    $0x4,%rax
+    1756:	48 89 c2             	mov    %rax,%rdx
+    1759:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    175d:	48 01 c2             	add    %rax,%rdx
+    1760:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1764:	48 8b 00             	mov    (%rax),%rax
+    1767:	48 39 c2             	cmp    %rax,%rdx
+    176a:	75 2d                	jne    1799 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    176c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1770:	8b 50 08             	mov    0x8(%rax),%edx
+    1773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1777:	48 8b 00             	mov    (%rax),%rax
+    177a:	8b 40 08             	mov    0x8(%rax),%eax
+    177d:	01 c2                	add    %eax,%edx
+    177f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1783:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178a:	48 8b 00             	mov    (%rax),%rax
+    178d:	48 8b 10             	mov    (%rax),%rdx
+    1790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1794:	48 89 10             	mov    %rdx,(%rax)
+    1797:	eb 0e                	jmp    17a7 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179d:	48 8b 10             	mov    (%rax),%rdx
+    17a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a4:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    17a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ab:	8b 40 08             	mov    0x8(%rax),%eax
+    17ae:	89 c0                	mov    %eax,%eax
+    17b0:	48 c1 e0 04          	shl    $0x4,%rax
+    17b4:	48 89 c2             	mov    %rax,%rdx
+    17b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17bb:	48 01 d0             	add    %rdx,%rax
+    17be:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    17c2:	75 27                	jne    17eb <free+0x13f>
+    p->s.size += bp->s.size;
+    17c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17c8:	8b 50 08             	mov    0x8(%rax),%edx
+    17cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17cf:	8b 40 08             	mov    0x8(%rax),%eax
+    17d2:	01 c2                	add    %eax,%edx
+    17d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17d8:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    17db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17df:	48 8b 10             	mov    (%rax),%rdx
+    17e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17e6:	48 89 10             	mov    %rdx,(%rax)
+    17e9:	eb 0b                	jmp    17f6 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    17eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    17f3:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    17f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17fa:	48 89 05 3f 0b 00 00 	mov    %rax,0xb3f(%rip)        # 2340 <freep>
+}
+    1801:	c9                   	leave
+    1802:	c3                   	ret
+
+0000000000001803 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1803:	55                   	push   %rbp
+    1804:	48 89 e5             	mov    %rsp,%rbp
+    1807:	48 83 ec 20          	sub    $0x20,%rsp
+    180b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    180e:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1815:	77 07                	ja     181e <morecore+0x1b>
+    nu = 4096;
+    1817:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    181e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1821:	c1 e0 04             	shl    $0x4,%eax
+    1824:	89 c7                	mov    %eax,%edi
+    1826:	e8 ea fd ff ff       	call   1615 <sbrk>
+    182b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    182f:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1834:	75 07                	jne    183d <morecore+0x3a>
+    return 0;
+    1836:	b8 00 00 00 00       	mov    $0x0,%eax
+    183b:	eb 29                	jmp    1866 <morecore+0x63>
+  hp = (Header*)p;
+    183d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1841:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1845:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1849:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    184c:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    184f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1853:	48 83 c0 10          	add    $0x10,%rax
+    1857:	48 89 c7             	mov    %rax,%rdi
+    185a:	e8 4d fe ff ff       	call   16ac <free>
+  return freep;
+    185f:	48 8b 05 da 0a 00 00 	mov    0xada(%rip),%rax        # 2340 <freep>
+}
+    1866:	c9                   	leave
+    1867:	c3                   	ret
+
+0000000000001868 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1868:	55                   	push   %rbp
+    1869:	48 89 e5             	mov    %rsp,%rbp
+    186c:	48 83 ec 30          	sub    $0x30,%rsp
+    1870:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1873:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1876:	48 83 c0 0f          	add    $0xf,%rax
+    187a:	48 c1 e8 04          	shr    $0x4,%rax
+    187e:	83 c0 01             	add    $0x1,%eax
+    1881:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1884:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    188b:	76 62                	jbe    18ef <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    188d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1890:	c1 e0 04             	shl    $0x4,%eax
+    1893:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1899:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    189f:	b9 22 00 00 00       	mov    $0x22,%ecx
+    18a4:	ba 03 00 00 00       	mov    $0x3,%edx
+    18a9:	89 c6                	mov    %eax,%esi
+    18ab:	bf 00 00 00 00       	mov    $0x0,%edi
+    18b0:	e8 98 fd ff ff       	call   164d <mmap2>
+    18b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    18b9:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    18be:	75 0a                	jne    18ca <malloc+0x62>
+      return 0;
+    18c0:	b8 00 00 00 00       	mov    $0x0,%eax
+    18c5:	e9 1c 01 00 00       	jmp    19e6 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    18ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18ce:	48 8d 15 7b 0a 00 00 	lea    0xa7b(%rip),%rdx        # 2350 <bigblock>
+    18d5:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    18d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18dc:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    18df:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    18e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    18e6:	48 83 c0 10          	add    $0x10,%rax
+    18ea:	e9 f7 00 00 00       	jmp    19e6 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    18ef:	48 8b 05 4a 0a 00 00 	mov    0xa4a(%rip),%rax        # 2340 <freep>
+    18f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    18fa:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    18ff:	75 2e                	jne    192f <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1901:	48 8d 05 28 0a 00 00 	lea    0xa28(%rip),%rax        # 2330 <base>
+    1908:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    190c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1910:	48 89 05 29 0a 00 00 	mov    %rax,0xa29(%rip)        # 2340 <freep>
+    1917:	48 8b 05 22 0a 00 00 	mov    0xa22(%rip),%rax        # 2340 <freep>
+    191e:	48 89 05 0b 0a 00 00 	mov    %rax,0xa0b(%rip)        # 2330 <base>
+    base.s.size = 0;
+    1925:	c7 05 09 0a 00 00 00 	movl   $0x0,0xa09(%rip)        # 2338 <base+0x8>
+    192c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    192f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1933:	48 8b 00             	mov    (%rax),%rax
+    1936:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    193a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    193e:	8b 40 08             	mov    0x8(%rax),%eax
+    1941:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1944:	72 5f                	jb     19a5 <malloc+0x13d>
+      if(p->s.size == nunits)
+    1946:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    194a:	8b 40 08             	mov    0x8(%rax),%eax
+    194d:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1950:	75 10                	jne    1962 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1956:	48 8b 10             	mov    (%rax),%rdx
+    1959:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195d:	48 89 10             	mov    %rdx,(%rax)
+    1960:	eb 2e                	jmp    1990 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1962:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1966:	8b 40 08             	mov    0x8(%rax),%eax
+    1969:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    196c:	89 c2                	mov    %eax,%edx
+    196e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1972:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1975:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1979:	8b 40 08             	mov    0x8(%rax),%eax
+    197c:	89 c0                	mov    %eax,%eax
+    197e:	48 c1 e0 04          	shl    $0x4,%rax
+    1982:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1986:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    198a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    198d:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1990:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1994:	48 89 05 a5 09 00 00 	mov    %rax,0x9a5(%rip)        # 2340 <freep>
+      return (void*)(p + 1);
+    199b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    199f:	48 83 c0 10          	add    $0x10,%rax
+    19a3:	eb 41                	jmp    19e6 <malloc+0x17e>
+    }
+    if(p == freep)
+    19a5:	48 8b 05 94 09 00 00 	mov    0x994(%rip),%rax        # 2340 <freep>
+    19ac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    19b0:	75 1c                	jne    19ce <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    19b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    19b5:	89 c7                	mov    %eax,%edi
+    19b7:	e8 47 fe ff ff       	call   1803 <morecore>
+    19bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    19c0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    19c5:	75 07                	jne    19ce <malloc+0x166>
+        return 0;
+    19c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    19cc:	eb 18                	jmp    19e6 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    19ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    19d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19da:	48 8b 00             	mov    (%rax),%rax
+    19dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    19e1:	e9 54 ff ff ff       	jmp    193a <malloc+0xd2>
+  }
+}
+    19e6:	c9                   	leave
+    19e7:	c3                   	ret
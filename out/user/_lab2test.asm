@@ -0,0 +1,2327 @@
+
+out/user/_lab2test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void forktest(void);
+void pipetest(void);
+void pkilltest(void);
+void exectest(void);
+
+int main() {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+       8:	be 02 00 00 00       	mov    $0x2,%esi
+       d:	48 8d 05 ec 16 00 00 	lea    0x16ec(%rip),%rax        # 1700 <malloc+0x181>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 c8 12 00 00       	call   12e4 <open>
+      1c:	85 c0                	test   %eax,%eax
+      1e:	79 0a                	jns    2a <main+0x2a>
+    return -1;
+      20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      25:	e9 a5 00 00 00       	jmp    cf <main+0xcf>
+  }
+  dup(0);  // stdout
+      2a:	bf 00 00 00 00       	mov    $0x0,%edi
+      2f:	e8 e8 12 00 00       	call   131c <dup>
+  dup(0);  // stderr
+      34:	bf 00 00 00 00       	mov    $0x0,%edi
+      39:	e8 de 12 00 00       	call   131c <dup>
+
+  pid = fork();
+      3e:	e8 59 12 00 00       	call   129c <fork>
+      43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+      46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      4a:	79 1e                	jns    6a <main+0x6a>
+    printf(1, "fork failed\n");
+      4c:	48 8d 05 b5 16 00 00 	lea    0x16b5(%rip),%rax        # 1708 <malloc+0x189>
+      53:	48 89 c6             	mov    %rax,%rsi
+      56:	bf 01 00 00 00       	mov    $0x1,%edi
+      5b:	b8 00 00 00 00       	mov    $0x0,%eax
+      60:	e8 98 0c 00 00       	call   cfd <printf>
+    exit();
+      65:	e8 3a 12 00 00       	call   12a4 <exit>
+  }
+
+  if(pid == 0){
+      6a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      6e:	75 44                	jne    b4 <main+0xb4>
+    forktest();
+      70:	e8 5c 00 00 00       	call   d1 <forktest>
+    pipetest();
+      75:	e8 0c 02 00 00       	call   286 <pipetest>
+    exectest();
+      7a:	e8 77 08 00 00       	call   8f6 <exectest>
+
+    printf(1, "lab2 tests passed!!\n");
+      7f:	48 8d 05 8f 16 00 00 	lea    0x168f(%rip),%rax        # 1715 <malloc+0x196>
+      86:	48 89 c6             	mov    %rax,%rsi
+      89:	bf 01 00 00 00       	mov    $0x1,%edi
+      8e:	b8 00 00 00 00       	mov    $0x0,%eax
+      93:	e8 65 0c 00 00       	call   cfd <printf>
+
+    while(1);
+      98:	90                   	nop
+      99:	eb fd                	jmp    98 <main+0x98>
+  }
+
+  while((wpid=wait()) >= 0 && wpid != pid)
+    printf(1, "zombie!\n");
+      9b:	48 8d 05 88 16 00 00 	lea    0x1688(%rip),%rax        # 172a <malloc+0x1ab>
+      a2:	48 89 c6             	mov    %rax,%rsi
+      a5:	bf 01 00 00 00       	mov    $0x1,%edi
+      aa:	b8 00 00 00 00       	mov    $0x0,%eax
+      af:	e8 49 0c 00 00       	call   cfd <printf>
+  while((wpid=wait()) >= 0 && wpid != pid)
+      b4:	e8 f3 11 00 00       	call   12ac <wait>
+      b9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      bc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      c0:	78 08                	js     ca <main+0xca>
+      c2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      c5:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+      c8:	75 d1                	jne    9b <main+0x9b>
+
+  exit();
+      ca:	e8 d5 11 00 00       	call   12a4 <exit>
+  return 0;
+}
+      cf:	c9                   	leave
+      d0:	c3                   	ret
+
+00000000000000d1 <forktest>:
+
+void
+forktest(void)
+{
+      d1:	55                   	push   %rbp
+      d2:	48 89 e5             	mov    %rsp,%rbp
+      d5:	48 83 ec 10          	sub    $0x10,%rsp
+  int n, pid;
+  int nproc = 6;
+      d9:	c7 45 f8 06 00 00 00 	movl   $0x6,-0x8(%rbp)
+
+  printf(1, "forktest\n");
+      e0:	48 8d 05 4c 16 00 00 	lea    0x164c(%rip),%rax        # 1733 <malloc+0x1b4>
+      e7:	48 89 c6             	mov    %rax,%rsi
+      ea:	bf 01 00 00 00       	mov    $0x1,%edi
+      ef:	b8 00 00 00 00       	mov    $0x0,%eax
+      f4:	e8 04 0c 00 00       	call   cfd <printf>
+
+  for(n=0; n<nproc; n++){
+      f9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     100:	eb 1d                	jmp    11f <forktest+0x4e>
+    pid = fork();
+     102:	e8 95 11 00 00       	call   129c <fork>
+     107:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if(pid < 0)
+     10a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     10e:	78 19                	js     129 <forktest+0x58>
+      break;
+    if(pid == 0)
+     110:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     114:	75 05                	jne    11b <forktest+0x4a>
+      exit();
+     116:	e8 89 11 00 00       	call   12a4 <exit>
+  for(n=0; n<nproc; n++){
+     11b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     11f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     122:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     125:	7c db                	jl     102 <forktest+0x31>
+     127:	eb 01                	jmp    12a <forktest+0x59>
+      break;
+     129:	90                   	nop
+  }
+
+  if(n != nproc){
+     12a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     12d:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+     130:	0f 84 c8 00 00 00    	je     1fe <forktest+0x12d>
+    error("forktest: fork claimed to work %d times! but only %d\n", nproc, n);
+     136:	8b 05 54 1b 00 00    	mov    0x1b54(%rip),%eax        # 1c90 <stdout>
+     13c:	ba 47 00 00 00       	mov    $0x47,%edx
+     141:	48 8d 0d f5 15 00 00 	lea    0x15f5(%rip),%rcx        # 173d <malloc+0x1be>
+     148:	48 89 ce             	mov    %rcx,%rsi
+     14b:	89 c7                	mov    %eax,%edi
+     14d:	b8 00 00 00 00       	mov    $0x0,%eax
+     152:	e8 a6 0b 00 00       	call   cfd <printf>
+     157:	8b 05 33 1b 00 00    	mov    0x1b33(%rip),%eax        # 1c90 <stdout>
+     15d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     160:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     163:	48 8d 35 e6 15 00 00 	lea    0x15e6(%rip),%rsi        # 1750 <malloc+0x1d1>
+     16a:	89 c7                	mov    %eax,%edi
+     16c:	b8 00 00 00 00       	mov    $0x0,%eax
+     171:	e8 87 0b 00 00       	call   cfd <printf>
+     176:	8b 05 14 1b 00 00    	mov    0x1b14(%rip),%eax        # 1c90 <stdout>
+     17c:	48 8d 15 03 16 00 00 	lea    0x1603(%rip),%rdx        # 1786 <malloc+0x207>
+     183:	48 89 d6             	mov    %rdx,%rsi
+     186:	89 c7                	mov    %eax,%edi
+     188:	b8 00 00 00 00       	mov    $0x0,%eax
+     18d:	e8 6b 0b 00 00       	call   cfd <printf>
+     192:	90                   	nop
+     193:	eb fd                	jmp    192 <forktest+0xc1>
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+     195:	e8 12 11 00 00       	call   12ac <wait>
+     19a:	85 c0                	test   %eax,%eax
+     19c:	79 5c                	jns    1fa <forktest+0x129>
+      error("forktest: wait stopped early\n");
+     19e:	8b 05 ec 1a 00 00    	mov    0x1aec(%rip),%eax        # 1c90 <stdout>
+     1a4:	ba 4c 00 00 00       	mov    $0x4c,%edx
+     1a9:	48 8d 0d 8d 15 00 00 	lea    0x158d(%rip),%rcx        # 173d <malloc+0x1be>
+     1b0:	48 89 ce             	mov    %rcx,%rsi
+     1b3:	89 c7                	mov    %eax,%edi
+     1b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ba:	e8 3e 0b 00 00       	call   cfd <printf>
+     1bf:	8b 05 cb 1a 00 00    	mov    0x1acb(%rip),%eax        # 1c90 <stdout>
+     1c5:	48 8d 15 bc 15 00 00 	lea    0x15bc(%rip),%rdx        # 1788 <malloc+0x209>
+     1cc:	48 89 d6             	mov    %rdx,%rsi
+     1cf:	89 c7                	mov    %eax,%edi
+     1d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d6:	e8 22 0b 00 00       	call   cfd <printf>
+     1db:	8b 05 af 1a 00 00    	mov    0x1aaf(%rip),%eax        # 1c90 <stdout>
+     1e1:	48 8d 15 9e 15 00 00 	lea    0x159e(%rip),%rdx        # 1786 <malloc+0x207>
+     1e8:	48 89 d6             	mov    %rdx,%rsi
+     1eb:	89 c7                	mov    %eax,%edi
+     1ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f2:	e8 06 0b 00 00       	call   cfd <printf>
+     1f7:	90                   	nop
+     1f8:	eb fd                	jmp    1f7 <forktest+0x126>
+  for(; n > 0; n--){
+     1fa:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     1fe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     202:	7f 91                	jg     195 <forktest+0xc4>
+    }
+  }
+
+  if(wait() != -1){
+     204:	e8 a3 10 00 00       	call   12ac <wait>
+     209:	83 f8 ff             	cmp    $0xffffffff,%eax
+     20c:	74 5c                	je     26a <forktest+0x199>
+    error("forktest: wait got too many\n");
+     20e:	8b 05 7c 1a 00 00    	mov    0x1a7c(%rip),%eax        # 1c90 <stdout>
+     214:	ba 51 00 00 00       	mov    $0x51,%edx
+     219:	48 8d 0d 1d 15 00 00 	lea    0x151d(%rip),%rcx        # 173d <malloc+0x1be>
+     220:	48 89 ce             	mov    %rcx,%rsi
+     223:	89 c7                	mov    %eax,%edi
+     225:	b8 00 00 00 00       	mov    $0x0,%eax
+     22a:	e8 ce 0a 00 00       	call   cfd <printf>
+     22f:	8b 05 5b 1a 00 00    	mov    0x1a5b(%rip),%eax        # 1c90 <stdout>
+     235:	48 8d 15 6a 15 00 00 	lea    0x156a(%rip),%rdx        # 17a6 <malloc+0x227>
+     23c:	48 89 d6             	mov    %rdx,%rsi
+     23f:	89 c7                	mov    %eax,%edi
+     241:	b8 00 00 00 00       	mov    $0x0,%eax
+     246:	e8 b2 0a 00 00       	call   cfd <printf>
+     24b:	8b 05 3f 1a 00 00    	mov    0x1a3f(%rip),%eax        # 1c90 <stdout>
+     251:	48 8d 15 2e 15 00 00 	lea    0x152e(%rip),%rdx        # 1786 <malloc+0x207>
+     258:	48 89 d6             	mov    %rdx,%rsi
+     25b:	89 c7                	mov    %eax,%edi
+     25d:	b8 00 00 00 00       	mov    $0x0,%eax
+     262:	e8 96 0a 00 00       	call   cfd <printf>
+     267:	90                   	nop
+     268:	eb fd                	jmp    267 <forktest+0x196>
+  }
+
+  printf(1, "forktest: fork test OK\n");
+     26a:	48 8d 05 52 15 00 00 	lea    0x1552(%rip),%rax        # 17c3 <malloc+0x244>
+     271:	48 89 c6             	mov    %rax,%rsi
+     274:	bf 01 00 00 00       	mov    $0x1,%edi
+     279:	b8 00 00 00 00       	mov    $0x0,%eax
+     27e:	e8 7a 0a 00 00       	call   cfd <printf>
+}
+     283:	90                   	nop
+     284:	c9                   	leave
+     285:	c3                   	ret
+
+0000000000000286 <pipetest>:
+
+void
+pipetest(void)
+{
+     286:	55                   	push   %rbp
+     287:	48 89 e5             	mov    %rsp,%rbp
+     28a:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  char buf[500];
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     291:	48 8d 85 ec fd ff ff 	lea    -0x214(%rbp),%rax
+     298:	48 89 c7             	mov    %rax,%rdi
+     29b:	e8 14 10 00 00       	call   12b4 <pipe>
+     2a0:	85 c0                	test   %eax,%eax
+     2a2:	74 5c                	je     300 <pipetest+0x7a>
+    error("pipetest: pipe() failed\n");
+     2a4:	8b 05 e6 19 00 00    	mov    0x19e6(%rip),%eax        # 1c90 <stdout>
+     2aa:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     2af:	48 8d 0d 87 14 00 00 	lea    0x1487(%rip),%rcx        # 173d <malloc+0x1be>
+     2b6:	48 89 ce             	mov    %rcx,%rsi
+     2b9:	89 c7                	mov    %eax,%edi
+     2bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     2c0:	e8 38 0a 00 00       	call   cfd <printf>
+     2c5:	8b 05 c5 19 00 00    	mov    0x19c5(%rip),%eax        # 1c90 <stdout>
+     2cb:	48 8d 15 09 15 00 00 	lea    0x1509(%rip),%rdx        # 17db <malloc+0x25c>
+     2d2:	48 89 d6             	mov    %rdx,%rsi
+     2d5:	89 c7                	mov    %eax,%edi
+     2d7:	b8 00 00 00 00       	mov    $0x0,%eax
+     2dc:	e8 1c 0a 00 00       	call   cfd <printf>
+     2e1:	8b 05 a9 19 00 00    	mov    0x19a9(%rip),%eax        # 1c90 <stdout>
+     2e7:	48 8d 15 98 14 00 00 	lea    0x1498(%rip),%rdx        # 1786 <malloc+0x207>
+     2ee:	48 89 d6             	mov    %rdx,%rsi
+     2f1:	89 c7                	mov    %eax,%edi
+     2f3:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f8:	e8 00 0a 00 00       	call   cfd <printf>
+     2fd:	90                   	nop
+     2fe:	eb fd                	jmp    2fd <pipetest+0x77>
+  }
+  pid = fork();
+     300:	e8 97 0f 00 00       	call   129c <fork>
+     305:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  seq = 0;
+     308:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if(pid == 0){
+     30f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     313:	0f 85 d3 00 00 00    	jne    3ec <pipetest+0x166>
+    close(fds[0]);
+     319:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     31f:	89 c7                	mov    %eax,%edi
+     321:	e8 a6 0f 00 00       	call   12cc <close>
+    for(n = 0; n < 5; n++){
+     326:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     32d:	e9 ab 00 00 00       	jmp    3dd <pipetest+0x157>
+      for(i = 0; i < 95; i++)
+     332:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     339:	eb 1b                	jmp    356 <pipetest+0xd0>
+        buf[i] = seq++;
+     33b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     33e:	8d 50 01             	lea    0x1(%rax),%edx
+     341:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     344:	89 c2                	mov    %eax,%edx
+     346:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     349:	48 98                	cltq
+     34b:	88 94 05 f4 fd ff ff 	mov    %dl,-0x20c(%rbp,%rax,1)
+      for(i = 0; i < 95; i++)
+     352:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     356:	83 7d f8 5e          	cmpl   $0x5e,-0x8(%rbp)
+     35a:	7e df                	jle    33b <pipetest+0xb5>
+      if(write(fds[1], buf, 95) != 95){
+     35c:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     362:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     369:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     36e:	48 89 ce             	mov    %rcx,%rsi
+     371:	89 c7                	mov    %eax,%edi
+     373:	e8 4c 0f 00 00       	call   12c4 <write>
+     378:	83 f8 5f             	cmp    $0x5f,%eax
+     37b:	74 5c                	je     3d9 <pipetest+0x153>
+        error("pipetest: oops 1\n");
+     37d:	8b 05 0d 19 00 00    	mov    0x190d(%rip),%eax        # 1c90 <stdout>
+     383:	ba 69 00 00 00       	mov    $0x69,%edx
+     388:	48 8d 0d ae 13 00 00 	lea    0x13ae(%rip),%rcx        # 173d <malloc+0x1be>
+     38f:	48 89 ce             	mov    %rcx,%rsi
+     392:	89 c7                	mov    %eax,%edi
+     394:	b8 00 00 00 00       	mov    $0x0,%eax
+     399:	e8 5f 09 00 00       	call   cfd <printf>
+     39e:	8b 05 ec 18 00 00    	mov    0x18ec(%rip),%eax        # 1c90 <stdout>
+     3a4:	48 8d 15 49 14 00 00 	lea    0x1449(%rip),%rdx        # 17f4 <malloc+0x275>
+     3ab:	48 89 d6             	mov    %rdx,%rsi
+     3ae:	89 c7                	mov    %eax,%edi
+     3b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b5:	e8 43 09 00 00       	call   cfd <printf>
+     3ba:	8b 05 d0 18 00 00    	mov    0x18d0(%rip),%eax        # 1c90 <stdout>
+     3c0:	48 8d 15 bf 13 00 00 	lea    0x13bf(%rip),%rdx        # 1786 <malloc+0x207>
+     3c7:	48 89 d6             	mov    %rdx,%rsi
+     3ca:	89 c7                	mov    %eax,%edi
+     3cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     3d1:	e8 27 09 00 00       	call   cfd <printf>
+     3d6:	90                   	nop
+     3d7:	eb fd                	jmp    3d6 <pipetest+0x150>
+    for(n = 0; n < 5; n++){
+     3d9:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     3dd:	83 7d f4 04          	cmpl   $0x4,-0xc(%rbp)
+     3e1:	0f 8e 4b ff ff ff    	jle    332 <pipetest+0xac>
+      }
+    }
+    exit();
+     3e7:	e8 b8 0e 00 00       	call   12a4 <exit>
+  } else if(pid > 0){
+     3ec:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+     3f0:	0f 8e 77 01 00 00    	jle    56d <pipetest+0x2e7>
+    close(fds[1]);
+     3f6:	8b 85 f0 fd ff ff    	mov    -0x210(%rbp),%eax
+     3fc:	89 c7                	mov    %eax,%edi
+     3fe:	e8 c9 0e 00 00       	call   12cc <close>
+    total = 0;
+     403:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    cc = 1;
+     40a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     411:	e9 b4 00 00 00       	jmp    4ca <pipetest+0x244>
+      for(i = 0; i < n; i++){
+     416:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     41d:	e9 82 00 00 00       	jmp    4a4 <pipetest+0x21e>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     422:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     425:	48 98                	cltq
+     427:	0f b6 84 05 f4 fd ff 	movzbl -0x20c(%rbp,%rax,1),%eax
+     42e:	ff 
+     42f:	0f be c8             	movsbl %al,%ecx
+     432:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     435:	8d 50 01             	lea    0x1(%rax),%edx
+     438:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     43b:	31 c8                	xor    %ecx,%eax
+     43d:	0f b6 c0             	movzbl %al,%eax
+     440:	85 c0                	test   %eax,%eax
+     442:	74 5c                	je     4a0 <pipetest+0x21a>
+          error("pipetest: oops 2\n");
+     444:	8b 05 46 18 00 00    	mov    0x1846(%rip),%eax        # 1c90 <stdout>
+     44a:	ba 74 00 00 00       	mov    $0x74,%edx
+     44f:	48 8d 0d e7 12 00 00 	lea    0x12e7(%rip),%rcx        # 173d <malloc+0x1be>
+     456:	48 89 ce             	mov    %rcx,%rsi
+     459:	89 c7                	mov    %eax,%edi
+     45b:	b8 00 00 00 00       	mov    $0x0,%eax
+     460:	e8 98 08 00 00       	call   cfd <printf>
+     465:	8b 05 25 18 00 00    	mov    0x1825(%rip),%eax        # 1c90 <stdout>
+     46b:	48 8d 15 94 13 00 00 	lea    0x1394(%rip),%rdx        # 1806 <malloc+0x287>
+     472:	48 89 d6             	mov    %rdx,%rsi
+     475:	89 c7                	mov    %eax,%edi
+     477:	b8 00 00 00 00       	mov    $0x0,%eax
+     47c:	e8 7c 08 00 00       	call   cfd <printf>
+     481:	8b 05 09 18 00 00    	mov    0x1809(%rip),%eax        # 1c90 <stdout>
+     487:	48 8d 15 f8 12 00 00 	lea    0x12f8(%rip),%rdx        # 1786 <malloc+0x207>
+     48e:	48 89 d6             	mov    %rdx,%rsi
+     491:	89 c7                	mov    %eax,%edi
+     493:	b8 00 00 00 00       	mov    $0x0,%eax
+     498:	e8 60 08 00 00       	call   cfd <printf>
+     49d:	90                   	nop
+     49e:	eb fd                	jmp    49d <pipetest+0x217>
+      for(i = 0; i < n; i++){
+     4a0:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     4a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4a7:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+     4aa:	0f 8c 72 ff ff ff    	jl     422 <pipetest+0x19c>
+        }
+      }
+      total += n;
+     4b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4b3:	01 45 ec             	add    %eax,-0x14(%rbp)
+      cc = cc * 2;
+     4b6:	d1 65 f0             	shll   -0x10(%rbp)
+      if(cc > sizeof(buf))
+     4b9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     4bc:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     4c1:	76 07                	jbe    4ca <pipetest+0x244>
+        cc = sizeof(buf);
+     4c3:	c7 45 f0 f4 01 00 00 	movl   $0x1f4,-0x10(%rbp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     4ca:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     4d0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     4d3:	48 8d 8d f4 fd ff ff 	lea    -0x20c(%rbp),%rcx
+     4da:	48 89 ce             	mov    %rcx,%rsi
+     4dd:	89 c7                	mov    %eax,%edi
+     4df:	e8 d8 0d 00 00       	call   12bc <read>
+     4e4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     4e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     4eb:	0f 8f 25 ff ff ff    	jg     416 <pipetest+0x190>
+    }
+    if(total != 5 * 95){
+     4f1:	81 7d ec db 01 00 00 	cmpl   $0x1db,-0x14(%rbp)
+     4f8:	74 5f                	je     559 <pipetest+0x2d3>
+      error("pipetest: oops 3 total %d\n", total);
+     4fa:	8b 05 90 17 00 00    	mov    0x1790(%rip),%eax        # 1c90 <stdout>
+     500:	ba 7d 00 00 00       	mov    $0x7d,%edx
+     505:	48 8d 0d 31 12 00 00 	lea    0x1231(%rip),%rcx        # 173d <malloc+0x1be>
+     50c:	48 89 ce             	mov    %rcx,%rsi
+     50f:	89 c7                	mov    %eax,%edi
+     511:	b8 00 00 00 00       	mov    $0x0,%eax
+     516:	e8 e2 07 00 00       	call   cfd <printf>
+     51b:	8b 05 6f 17 00 00    	mov    0x176f(%rip),%eax        # 1c90 <stdout>
+     521:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     524:	48 8d 0d ed 12 00 00 	lea    0x12ed(%rip),%rcx        # 1818 <malloc+0x299>
+     52b:	48 89 ce             	mov    %rcx,%rsi
+     52e:	89 c7                	mov    %eax,%edi
+     530:	b8 00 00 00 00       	mov    $0x0,%eax
+     535:	e8 c3 07 00 00       	call   cfd <printf>
+     53a:	8b 05 50 17 00 00    	mov    0x1750(%rip),%eax        # 1c90 <stdout>
+     540:	48 8d 15 3f 12 00 00 	lea    0x123f(%rip),%rdx        # 1786 <malloc+0x207>
+     547:	48 89 d6             	mov    %rdx,%rsi
+     54a:	89 c7                	mov    %eax,%edi
+     54c:	b8 00 00 00 00       	mov    $0x0,%eax
+     551:	e8 a7 07 00 00       	call   cfd <printf>
+     556:	90                   	nop
+     557:	eb fd                	jmp    556 <pipetest+0x2d0>
+    }
+    close(fds[0]);
+     559:	8b 85 ec fd ff ff    	mov    -0x214(%rbp),%eax
+     55f:	89 c7                	mov    %eax,%edi
+     561:	e8 66 0d 00 00       	call   12cc <close>
+    wait();
+     566:	e8 41 0d 00 00       	call   12ac <wait>
+     56b:	eb 5c                	jmp    5c9 <pipetest+0x343>
+  } else {
+    error("pipetest: fork() failed\n");
+     56d:	8b 05 1d 17 00 00    	mov    0x171d(%rip),%eax        # 1c90 <stdout>
+     573:	ba 82 00 00 00       	mov    $0x82,%edx
+     578:	48 8d 0d be 11 00 00 	lea    0x11be(%rip),%rcx        # 173d <malloc+0x1be>
+     57f:	48 89 ce             	mov    %rcx,%rsi
+     582:	89 c7                	mov    %eax,%edi
+     584:	b8 00 00 00 00       	mov    $0x0,%eax
+     589:	e8 6f 07 00 00       	call   cfd <printf>
+     58e:	8b 05 fc 16 00 00    	mov    0x16fc(%rip),%eax        # 1c90 <stdout>
+     594:	48 8d 15 98 12 00 00 	lea    0x1298(%rip),%rdx        # 1833 <malloc+0x2b4>
+     59b:	48 89 d6             	mov    %rdx,%rsi
+     59e:	89 c7                	mov    %eax,%edi
+     5a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a5:	e8 53 07 00 00       	call   cfd <printf>
+     5aa:	8b 05 e0 16 00 00    	mov    0x16e0(%rip),%eax        # 1c90 <stdout>
+     5b0:	48 8d 15 cf 11 00 00 	lea    0x11cf(%rip),%rdx        # 1786 <malloc+0x207>
+     5b7:	48 89 d6             	mov    %rdx,%rsi
+     5ba:	89 c7                	mov    %eax,%edi
+     5bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c1:	e8 37 07 00 00       	call   cfd <printf>
+     5c6:	90                   	nop
+     5c7:	eb fd                	jmp    5c6 <pipetest+0x340>
+  }
+  printf(1, "pipetest ok\n");
+     5c9:	48 8d 05 7c 12 00 00 	lea    0x127c(%rip),%rax        # 184c <malloc+0x2cd>
+     5d0:	48 89 c6             	mov    %rax,%rsi
+     5d3:	bf 01 00 00 00       	mov    $0x1,%edi
+     5d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     5dd:	e8 1b 07 00 00       	call   cfd <printf>
+}
+     5e2:	90                   	nop
+     5e3:	c9                   	leave
+     5e4:	c3                   	ret
+
+00000000000005e5 <pkilltest>:
+
+void
+pkilltest(void)
+{
+     5e5:	55                   	push   %rbp
+     5e6:	48 89 e5             	mov    %rsp,%rbp
+     5e9:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[11];
+
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     5ed:	48 8d 05 65 12 00 00 	lea    0x1265(%rip),%rax        # 1859 <malloc+0x2da>
+     5f4:	48 89 c6             	mov    %rax,%rsi
+     5f7:	bf 01 00 00 00       	mov    $0x1,%edi
+     5fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     601:	e8 f7 06 00 00       	call   cfd <printf>
+  pid1 = fork();
+     606:	e8 91 0c 00 00       	call   129c <fork>
+     60b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid1 == 0)
+     60e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     612:	75 03                	jne    617 <pkilltest+0x32>
+    for(;;)
+     614:	90                   	nop
+     615:	eb fd                	jmp    614 <pkilltest+0x2f>
+      ;
+
+  pid2 = fork();
+     617:	e8 80 0c 00 00       	call   129c <fork>
+     61c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(pid2 == 0)
+     61f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     623:	75 03                	jne    628 <pkilltest+0x43>
+    for(;;)
+     625:	90                   	nop
+     626:	eb fd                	jmp    625 <pkilltest+0x40>
+      ;
+
+  pipe(pfds);
+     628:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     62c:	48 89 c7             	mov    %rax,%rdi
+     62f:	e8 80 0c 00 00       	call   12b4 <pipe>
+  pid3 = fork();
+     634:	e8 63 0c 00 00       	call   129c <fork>
+     639:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(pid3 == 0){
+     63c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     640:	0f 85 91 00 00 00    	jne    6d7 <pkilltest+0xf2>
+    close(pfds[0]);
+     646:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     649:	89 c7                	mov    %eax,%edi
+     64b:	e8 7c 0c 00 00       	call   12cc <close>
+    if(write(pfds[1], "x", 1) != 1)
+     650:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     653:	ba 01 00 00 00       	mov    $0x1,%edx
+     658:	48 8d 0d 04 12 00 00 	lea    0x1204(%rip),%rcx        # 1863 <malloc+0x2e4>
+     65f:	48 89 ce             	mov    %rcx,%rsi
+     662:	89 c7                	mov    %eax,%edi
+     664:	e8 5b 0c 00 00       	call   12c4 <write>
+     669:	83 f8 01             	cmp    $0x1,%eax
+     66c:	74 5c                	je     6ca <pkilltest+0xe5>
+      error("pkilltest: write error");
+     66e:	8b 05 1c 16 00 00    	mov    0x161c(%rip),%eax        # 1c90 <stdout>
+     674:	ba 9f 00 00 00       	mov    $0x9f,%edx
+     679:	48 8d 0d bd 10 00 00 	lea    0x10bd(%rip),%rcx        # 173d <malloc+0x1be>
+     680:	48 89 ce             	mov    %rcx,%rsi
+     683:	89 c7                	mov    %eax,%edi
+     685:	b8 00 00 00 00       	mov    $0x0,%eax
+     68a:	e8 6e 06 00 00       	call   cfd <printf>
+     68f:	8b 05 fb 15 00 00    	mov    0x15fb(%rip),%eax        # 1c90 <stdout>
+     695:	48 8d 15 c9 11 00 00 	lea    0x11c9(%rip),%rdx        # 1865 <malloc+0x2e6>
+     69c:	48 89 d6             	mov    %rdx,%rsi
+     69f:	89 c7                	mov    %eax,%edi
+     6a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a6:	e8 52 06 00 00       	call   cfd <printf>
+     6ab:	8b 05 df 15 00 00    	mov    0x15df(%rip),%eax        # 1c90 <stdout>
+     6b1:	48 8d 15 ce 10 00 00 	lea    0x10ce(%rip),%rdx        # 1786 <malloc+0x207>
+     6b8:	48 89 d6             	mov    %rdx,%rsi
+     6bb:	89 c7                	mov    %eax,%edi
+     6bd:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c2:	e8 36 06 00 00       	call   cfd <printf>
+     6c7:	90                   	nop
+     6c8:	eb fd                	jmp    6c7 <pkilltest+0xe2>
+    close(pfds[1]);
+     6ca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6cd:	89 c7                	mov    %eax,%edi
+     6cf:	e8 f8 0b 00 00       	call   12cc <close>
+    for(;;)
+     6d4:	90                   	nop
+     6d5:	eb fd                	jmp    6d4 <pkilltest+0xef>
+      ;
+  }
+
+  close(pfds[1]);
+     6d7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6da:	89 c7                	mov    %eax,%edi
+     6dc:	e8 eb 0b 00 00       	call   12cc <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     6e1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     6e4:	48 8d 4d e9          	lea    -0x17(%rbp),%rcx
+     6e8:	ba 0b 00 00 00       	mov    $0xb,%edx
+     6ed:	48 89 ce             	mov    %rcx,%rsi
+     6f0:	89 c7                	mov    %eax,%edi
+     6f2:	e8 c5 0b 00 00       	call   12bc <read>
+     6f7:	83 f8 01             	cmp    $0x1,%eax
+     6fa:	74 5c                	je     758 <pkilltest+0x173>
+    error("pkilltest: read error");
+     6fc:	8b 05 8e 15 00 00    	mov    0x158e(%rip),%eax        # 1c90 <stdout>
+     702:	ba a7 00 00 00       	mov    $0xa7,%edx
+     707:	48 8d 0d 2f 10 00 00 	lea    0x102f(%rip),%rcx        # 173d <malloc+0x1be>
+     70e:	48 89 ce             	mov    %rcx,%rsi
+     711:	89 c7                	mov    %eax,%edi
+     713:	b8 00 00 00 00       	mov    $0x0,%eax
+     718:	e8 e0 05 00 00       	call   cfd <printf>
+     71d:	8b 05 6d 15 00 00    	mov    0x156d(%rip),%eax        # 1c90 <stdout>
+     723:	48 8d 15 52 11 00 00 	lea    0x1152(%rip),%rdx        # 187c <malloc+0x2fd>
+     72a:	48 89 d6             	mov    %rdx,%rsi
+     72d:	89 c7                	mov    %eax,%edi
+     72f:	b8 00 00 00 00       	mov    $0x0,%eax
+     734:	e8 c4 05 00 00       	call   cfd <printf>
+     739:	8b 05 51 15 00 00    	mov    0x1551(%rip),%eax        # 1c90 <stdout>
+     73f:	48 8d 15 40 10 00 00 	lea    0x1040(%rip),%rdx        # 1786 <malloc+0x207>
+     746:	48 89 d6             	mov    %rdx,%rsi
+     749:	89 c7                	mov    %eax,%edi
+     74b:	b8 00 00 00 00       	mov    $0x0,%eax
+     750:	e8 a8 05 00 00       	call   cfd <printf>
+     755:	90                   	nop
+     756:	eb fd                	jmp    755 <pkilltest+0x170>
+  }
+  close(pfds[0]);
+     758:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     75b:	89 c7                	mov    %eax,%edi
+     75d:	e8 6a 0b 00 00       	call   12cc <close>
+  printf(1, "kill... ");
+     762:	48 8d 05 29 11 00 00 	lea    0x1129(%rip),%rax        # 1892 <malloc+0x313>
+     769:	48 89 c6             	mov    %rax,%rsi
+     76c:	bf 01 00 00 00       	mov    $0x1,%edi
+     771:	b8 00 00 00 00       	mov    $0x0,%eax
+     776:	e8 82 05 00 00       	call   cfd <printf>
+  kill(pid1);
+     77b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     77e:	89 c7                	mov    %eax,%edi
+     780:	e8 4f 0b 00 00       	call   12d4 <kill>
+  kill(pid2);
+     785:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     788:	89 c7                	mov    %eax,%edi
+     78a:	e8 45 0b 00 00       	call   12d4 <kill>
+  kill(pid3);
+     78f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     792:	89 c7                	mov    %eax,%edi
+     794:	e8 3b 0b 00 00       	call   12d4 <kill>
+  printf(1, "wait... ");
+     799:	48 8d 05 fb 10 00 00 	lea    0x10fb(%rip),%rax        # 189b <malloc+0x31c>
+     7a0:	48 89 c6             	mov    %rax,%rsi
+     7a3:	bf 01 00 00 00       	mov    $0x1,%edi
+     7a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ad:	e8 4b 05 00 00       	call   cfd <printf>
+  wait();
+     7b2:	e8 f5 0a 00 00       	call   12ac <wait>
+  wait();
+     7b7:	e8 f0 0a 00 00       	call   12ac <wait>
+  wait();
+     7bc:	e8 eb 0a 00 00       	call   12ac <wait>
+  printf(1, "pkilltest: ok\n");
+     7c1:	48 8d 05 dc 10 00 00 	lea    0x10dc(%rip),%rax        # 18a4 <malloc+0x325>
+     7c8:	48 89 c6             	mov    %rax,%rsi
+     7cb:	bf 01 00 00 00       	mov    $0x1,%edi
+     7d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d5:	e8 23 05 00 00       	call   cfd <printf>
+}
+     7da:	90                   	nop
+     7db:	c9                   	leave
+     7dc:	c3                   	ret
+
+00000000000007dd <racetest>:
+
+void
+racetest(void)
+{
+     7dd:	55                   	push   %rbp
+     7de:	48 89 e5             	mov    %rsp,%rbp
+     7e1:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     7e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     7ec:	e9 df 00 00 00       	jmp    8d0 <racetest+0xf3>
+    pid = fork();
+     7f1:	e8 a6 0a 00 00       	call   129c <fork>
+     7f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(pid < 0){
+     7f9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     7fd:	79 5c                	jns    85b <racetest+0x7e>
+      error("racetest: fork failed\n");
+     7ff:	8b 05 8b 14 00 00    	mov    0x148b(%rip),%eax        # 1c90 <stdout>
+     805:	ba bd 00 00 00       	mov    $0xbd,%edx
+     80a:	48 8d 0d 2c 0f 00 00 	lea    0xf2c(%rip),%rcx        # 173d <malloc+0x1be>
+     811:	48 89 ce             	mov    %rcx,%rsi
+     814:	89 c7                	mov    %eax,%edi
+     816:	b8 00 00 00 00       	mov    $0x0,%eax
+     81b:	e8 dd 04 00 00       	call   cfd <printf>
+     820:	8b 05 6a 14 00 00    	mov    0x146a(%rip),%eax        # 1c90 <stdout>
+     826:	48 8d 15 86 10 00 00 	lea    0x1086(%rip),%rdx        # 18b3 <malloc+0x334>
+     82d:	48 89 d6             	mov    %rdx,%rsi
+     830:	89 c7                	mov    %eax,%edi
+     832:	b8 00 00 00 00       	mov    $0x0,%eax
+     837:	e8 c1 04 00 00       	call   cfd <printf>
+     83c:	8b 05 4e 14 00 00    	mov    0x144e(%rip),%eax        # 1c90 <stdout>
+     842:	48 8d 15 3d 0f 00 00 	lea    0xf3d(%rip),%rdx        # 1786 <malloc+0x207>
+     849:	48 89 d6             	mov    %rdx,%rsi
+     84c:	89 c7                	mov    %eax,%edi
+     84e:	b8 00 00 00 00       	mov    $0x0,%eax
+     853:	e8 a5 04 00 00       	call   cfd <printf>
+     858:	90                   	nop
+     859:	eb fd                	jmp    858 <racetest+0x7b>
+    }
+    if(pid){
+     85b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     85f:	74 66                	je     8c7 <racetest+0xea>
+      if(wait() != pid){
+     861:	e8 46 0a 00 00       	call   12ac <wait>
+     866:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     869:	74 61                	je     8cc <racetest+0xef>
+        error("racetest: wait wrong pid\n");
+     86b:	8b 05 1f 14 00 00    	mov    0x141f(%rip),%eax        # 1c90 <stdout>
+     871:	ba c1 00 00 00       	mov    $0xc1,%edx
+     876:	48 8d 0d c0 0e 00 00 	lea    0xec0(%rip),%rcx        # 173d <malloc+0x1be>
+     87d:	48 89 ce             	mov    %rcx,%rsi
+     880:	89 c7                	mov    %eax,%edi
+     882:	b8 00 00 00 00       	mov    $0x0,%eax
+     887:	e8 71 04 00 00       	call   cfd <printf>
+     88c:	8b 05 fe 13 00 00    	mov    0x13fe(%rip),%eax        # 1c90 <stdout>
+     892:	48 8d 15 31 10 00 00 	lea    0x1031(%rip),%rdx        # 18ca <malloc+0x34b>
+     899:	48 89 d6             	mov    %rdx,%rsi
+     89c:	89 c7                	mov    %eax,%edi
+     89e:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a3:	e8 55 04 00 00       	call   cfd <printf>
+     8a8:	8b 05 e2 13 00 00    	mov    0x13e2(%rip),%eax        # 1c90 <stdout>
+     8ae:	48 8d 15 d1 0e 00 00 	lea    0xed1(%rip),%rdx        # 1786 <malloc+0x207>
+     8b5:	48 89 d6             	mov    %rdx,%rsi
+     8b8:	89 c7                	mov    %eax,%edi
+     8ba:	b8 00 00 00 00       	mov    $0x0,%eax
+     8bf:	e8 39 04 00 00       	call   cfd <printf>
+     8c4:	90                   	nop
+     8c5:	eb fd                	jmp    8c4 <racetest+0xe7>
+      }
+    } else {
+      exit();
+     8c7:	e8 d8 09 00 00       	call   12a4 <exit>
+  for(i = 0; i < 100; i++){
+     8cc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     8d0:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     8d4:	0f 8e 17 ff ff ff    	jle    7f1 <racetest+0x14>
+    }
+  }
+  printf(1, "racetest ok\n");
+     8da:	48 8d 05 03 10 00 00 	lea    0x1003(%rip),%rax        # 18e4 <malloc+0x365>
+     8e1:	48 89 c6             	mov    %rax,%rsi
+     8e4:	bf 01 00 00 00       	mov    $0x1,%edi
+     8e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ee:	e8 0a 04 00 00       	call   cfd <printf>
+}
+     8f3:	90                   	nop
+     8f4:	c9                   	leave
+     8f5:	c3                   	ret
+
+00000000000008f6 <exectest>:
+
+void
+exectest(void)
+{
+     8f6:	55                   	push   %rbp
+     8f7:	48 89 e5             	mov    %rsp,%rbp
+     8fa:	48 83 ec 30          	sub    $0x30,%rsp
+  printf(1, "exectest: starting ls\n");
+     8fe:	48 8d 05 ec 0f 00 00 	lea    0xfec(%rip),%rax        # 18f1 <malloc+0x372>
+     905:	48 89 c6             	mov    %rax,%rsi
+     908:	bf 01 00 00 00       	mov    $0x1,%edi
+     90d:	b8 00 00 00 00       	mov    $0x0,%eax
+     912:	e8 e6 03 00 00       	call   cfd <printf>
+  int pid = fork();
+     917:	e8 80 09 00 00       	call   129c <fork>
+     91c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+     91f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     923:	79 5c                	jns    981 <exectest+0x8b>
+    error("exectest: fork failed\n");
+     925:	8b 05 65 13 00 00    	mov    0x1365(%rip),%eax        # 1c90 <stdout>
+     92b:	ba d0 00 00 00       	mov    $0xd0,%edx
+     930:	48 8d 0d 06 0e 00 00 	lea    0xe06(%rip),%rcx        # 173d <malloc+0x1be>
+     937:	48 89 ce             	mov    %rcx,%rsi
+     93a:	89 c7                	mov    %eax,%edi
+     93c:	b8 00 00 00 00       	mov    $0x0,%eax
+     941:	e8 b7 03 00 00       	call   cfd <printf>
+     946:	8b 05 44 13 00 00    	mov    0x1344(%rip),%eax        # 1c90 <stdout>
+     94c:	48 8d 15 b5 0f 00 00 	lea    0xfb5(%rip),%rdx        # 1908 <malloc+0x389>
+     953:	48 89 d6             	mov    %rdx,%rsi
+     956:	89 c7                	mov    %eax,%edi
+     958:	b8 00 00 00 00       	mov    $0x0,%eax
+     95d:	e8 9b 03 00 00       	call   cfd <printf>
+     962:	8b 05 28 13 00 00    	mov    0x1328(%rip),%eax        # 1c90 <stdout>
+     968:	48 8d 15 17 0e 00 00 	lea    0xe17(%rip),%rdx        # 1786 <malloc+0x207>
+     96f:	48 89 d6             	mov    %rdx,%rsi
+     972:	89 c7                	mov    %eax,%edi
+     974:	b8 00 00 00 00       	mov    $0x0,%eax
+     979:	e8 7f 03 00 00       	call   cfd <printf>
+     97e:	90                   	nop
+     97f:	eb fd                	jmp    97e <exectest+0x88>
+  }
+
+  char *argv[] = {0};
+     981:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+     988:	00 
+
+  if(pid == 0){
+     989:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     98d:	75 72                	jne    a01 <exectest+0x10b>
+    exec("ls", argv);
+     98f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     993:	48 89 c6             	mov    %rax,%rsi
+     996:	48 8d 05 82 0f 00 00 	lea    0xf82(%rip),%rax        # 191f <malloc+0x3a0>
+     99d:	48 89 c7             	mov    %rax,%rdi
+     9a0:	e8 37 09 00 00       	call   12dc <exec>
+    error("exectest: exec ls failed\n");
+     9a5:	8b 05 e5 12 00 00    	mov    0x12e5(%rip),%eax        # 1c90 <stdout>
+     9ab:	ba d7 00 00 00       	mov    $0xd7,%edx
+     9b0:	48 8d 0d 86 0d 00 00 	lea    0xd86(%rip),%rcx        # 173d <malloc+0x1be>
+     9b7:	48 89 ce             	mov    %rcx,%rsi
+     9ba:	89 c7                	mov    %eax,%edi
+     9bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     9c1:	e8 37 03 00 00       	call   cfd <printf>
+     9c6:	8b 05 c4 12 00 00    	mov    0x12c4(%rip),%eax        # 1c90 <stdout>
+     9cc:	48 8d 15 4f 0f 00 00 	lea    0xf4f(%rip),%rdx        # 1922 <malloc+0x3a3>
+     9d3:	48 89 d6             	mov    %rdx,%rsi
+     9d6:	89 c7                	mov    %eax,%edi
+     9d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     9dd:	e8 1b 03 00 00       	call   cfd <printf>
+     9e2:	8b 05 a8 12 00 00    	mov    0x12a8(%rip),%eax        # 1c90 <stdout>
+     9e8:	48 8d 15 97 0d 00 00 	lea    0xd97(%rip),%rdx        # 1786 <malloc+0x207>
+     9ef:	48 89 d6             	mov    %rdx,%rsi
+     9f2:	89 c7                	mov    %eax,%edi
+     9f4:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f9:	e8 ff 02 00 00       	call   cfd <printf>
+     9fe:	90                   	nop
+     9ff:	eb fd                	jmp    9fe <exectest+0x108>
+  } else {
+    pid = wait();
+     a01:	e8 a6 08 00 00       	call   12ac <wait>
+     a06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  char *echoargv[] = { "echo", "echotest", "ok", 0 };
+     a09:	48 8d 05 2c 0f 00 00 	lea    0xf2c(%rip),%rax        # 193c <malloc+0x3bd>
+     a10:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+     a14:	48 8d 05 26 0f 00 00 	lea    0xf26(%rip),%rax        # 1941 <malloc+0x3c2>
+     a1b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+     a1f:	48 8d 05 24 0f 00 00 	lea    0xf24(%rip),%rax        # 194a <malloc+0x3cb>
+     a26:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     a2a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+     a31:	00 
+  printf(stdout, "exectest: test argument\n");
+     a32:	8b 05 58 12 00 00    	mov    0x1258(%rip),%eax        # 1c90 <stdout>
+     a38:	48 8d 15 0e 0f 00 00 	lea    0xf0e(%rip),%rdx        # 194d <malloc+0x3ce>
+     a3f:	48 89 d6             	mov    %rdx,%rsi
+     a42:	89 c7                	mov    %eax,%edi
+     a44:	b8 00 00 00 00       	mov    $0x0,%eax
+     a49:	e8 af 02 00 00       	call   cfd <printf>
+
+  pid = fork();
+     a4e:	e8 49 08 00 00       	call   129c <fork>
+     a53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid < 0){
+     a56:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     a5a:	79 5c                	jns    ab8 <exectest+0x1c2>
+    error("exectest: fork failed\n");
+     a5c:	8b 05 2e 12 00 00    	mov    0x122e(%rip),%eax        # 1c90 <stdout>
+     a62:	ba e1 00 00 00       	mov    $0xe1,%edx
+     a67:	48 8d 0d cf 0c 00 00 	lea    0xccf(%rip),%rcx        # 173d <malloc+0x1be>
+     a6e:	48 89 ce             	mov    %rcx,%rsi
+     a71:	89 c7                	mov    %eax,%edi
+     a73:	b8 00 00 00 00       	mov    $0x0,%eax
+     a78:	e8 80 02 00 00       	call   cfd <printf>
+     a7d:	8b 05 0d 12 00 00    	mov    0x120d(%rip),%eax        # 1c90 <stdout>
+     a83:	48 8d 15 7e 0e 00 00 	lea    0xe7e(%rip),%rdx        # 1908 <malloc+0x389>
+     a8a:	48 89 d6             	mov    %rdx,%rsi
+     a8d:	89 c7                	mov    %eax,%edi
+     a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a94:	e8 64 02 00 00       	call   cfd <printf>
+     a99:	8b 05 f1 11 00 00    	mov    0x11f1(%rip),%eax        # 1c90 <stdout>
+     a9f:	48 8d 15 e0 0c 00 00 	lea    0xce0(%rip),%rdx        # 1786 <malloc+0x207>
+     aa6:	48 89 d6             	mov    %rdx,%rsi
+     aa9:	89 c7                	mov    %eax,%edi
+     aab:	b8 00 00 00 00       	mov    $0x0,%eax
+     ab0:	e8 48 02 00 00       	call   cfd <printf>
+     ab5:	90                   	nop
+     ab6:	eb fd                	jmp    ab5 <exectest+0x1bf>
+  }
+  if(pid == 0){
+     ab8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     abc:	75 72                	jne    b30 <exectest+0x23a>
+    exec("echo", echoargv);
+     abe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     ac2:	48 89 c6             	mov    %rax,%rsi
+     ac5:	48 8d 05 70 0e 00 00 	lea    0xe70(%rip),%rax        # 193c <malloc+0x3bd>
+     acc:	48 89 c7             	mov    %rax,%rdi
+     acf:	e8 08 08 00 00       	call   12dc <exec>
+    error("exectest: exec echo failed\n");
+     ad4:	8b 05 b6 11 00 00    	mov    0x11b6(%rip),%eax        # 1c90 <stdout>
+     ada:	ba e5 00 00 00       	mov    $0xe5,%edx
+     adf:	48 8d 0d 57 0c 00 00 	lea    0xc57(%rip),%rcx        # 173d <malloc+0x1be>
+     ae6:	48 89 ce             	mov    %rcx,%rsi
+     ae9:	89 c7                	mov    %eax,%edi
+     aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+     af0:	e8 08 02 00 00       	call   cfd <printf>
+     af5:	8b 05 95 11 00 00    	mov    0x1195(%rip),%eax        # 1c90 <stdout>
+     afb:	48 8d 15 64 0e 00 00 	lea    0xe64(%rip),%rdx        # 1966 <malloc+0x3e7>
+     b02:	48 89 d6             	mov    %rdx,%rsi
+     b05:	89 c7                	mov    %eax,%edi
+     b07:	b8 00 00 00 00       	mov    $0x0,%eax
+     b0c:	e8 ec 01 00 00       	call   cfd <printf>
+     b11:	8b 05 79 11 00 00    	mov    0x1179(%rip),%eax        # 1c90 <stdout>
+     b17:	48 8d 15 68 0c 00 00 	lea    0xc68(%rip),%rdx        # 1786 <malloc+0x207>
+     b1e:	48 89 d6             	mov    %rdx,%rsi
+     b21:	89 c7                	mov    %eax,%edi
+     b23:	b8 00 00 00 00       	mov    $0x0,%eax
+     b28:	e8 d0 01 00 00       	call   cfd <printf>
+     b2d:	90                   	nop
+     b2e:	eb fd                	jmp    b2d <exectest+0x237>
+  } else {
+    pid = wait();
+     b30:	e8 77 07 00 00       	call   12ac <wait>
+     b35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+}
+     b38:	90                   	nop
+     b39:	c9                   	leave
+     b3a:	c3                   	ret
+
+0000000000000b3b <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     b3b:	55                   	push   %rbp
+     b3c:	48 89 e5             	mov    %rsp,%rbp
+     b3f:	48 83 ec 10          	sub    $0x10,%rsp
+     b43:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     b46:	89 f0                	mov    %esi,%eax
+     b48:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     b4b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     b4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b52:	ba 01 00 00 00       	mov    $0x1,%edx
+     b57:	48 89 ce             	mov    %rcx,%rsi
+     b5a:	89 c7                	mov    %eax,%edi
+     b5c:	e8 63 07 00 00       	call   12c4 <write>
+}
+     b61:	90                   	nop
+     b62:	c9                   	leave
+     b63:	c3                   	ret
+
+0000000000000b64 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     b64:	55                   	push   %rbp
+     b65:	48 89 e5             	mov    %rsp,%rbp
+     b68:	48 83 ec 40          	sub    $0x40,%rsp
+     b6c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     b6f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     b72:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     b75:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     b78:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     b7c:	74 1f                	je     b9d <printint64+0x39>
+     b7e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     b81:	c1 e8 1f             	shr    $0x1f,%eax
+     b84:	0f b6 c0             	movzbl %al,%eax
+     b87:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     b8a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     b8e:	74 0d                	je     b9d <printint64+0x39>
+    x = -xx;
+     b90:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     b93:	f7 d8                	neg    %eax
+     b95:	48 98                	cltq
+     b97:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     b9b:	eb 09                	jmp    ba6 <printint64+0x42>
+  else
+    x = xx;
+     b9d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ba0:	48 98                	cltq
+     ba2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     ba6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     bad:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     bb0:	48 63 c8             	movslq %eax,%rcx
+     bb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+     bbc:	48 f7 f1             	div    %rcx
+     bbf:	48 89 d1             	mov    %rdx,%rcx
+     bc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc5:	8d 50 01             	lea    0x1(%rax),%edx
+     bc8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     bcb:	48 8d 15 ce 10 00 00 	lea    0x10ce(%rip),%rdx        # 1ca0 <digits.1>
+     bd2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     bd6:	48 98                	cltq
+     bd8:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     bdc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     bdf:	48 63 f0             	movslq %eax,%rsi
+     be2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     be6:	ba 00 00 00 00       	mov    $0x0,%edx
+     beb:	48 f7 f6             	div    %rsi
+     bee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     bf2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     bf7:	75 b4                	jne    bad <printint64+0x49>
+
+  if(sgn)
+     bf9:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     bfd:	74 2b                	je     c2a <printint64+0xc6>
+    buf[i++] = '-';
+     bff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c02:	8d 50 01             	lea    0x1(%rax),%edx
+     c05:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     c08:	48 98                	cltq
+     c0a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     c0f:	eb 19                	jmp    c2a <printint64+0xc6>
+    putc(fd, buf[i]);
+     c11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c14:	48 98                	cltq
+     c16:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     c1b:	0f be d0             	movsbl %al,%edx
+     c1e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     c21:	89 d6                	mov    %edx,%esi
+     c23:	89 c7                	mov    %eax,%edi
+     c25:	e8 11 ff ff ff       	call   b3b <putc>
+  while(--i >= 0)
+     c2a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     c2e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c32:	79 dd                	jns    c11 <printint64+0xad>
+}
+     c34:	90                   	nop
+     c35:	90                   	nop
+     c36:	c9                   	leave
+     c37:	c3                   	ret
+
+0000000000000c38 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c38:	55                   	push   %rbp
+     c39:	48 89 e5             	mov    %rsp,%rbp
+     c3c:	48 83 ec 30          	sub    $0x30,%rsp
+     c40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     c43:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     c46:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     c49:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     c4c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     c53:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     c57:	74 17                	je     c70 <printint+0x38>
+     c59:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     c5d:	79 11                	jns    c70 <printint+0x38>
+    neg = 1;
+     c5f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     c66:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c69:	f7 d8                	neg    %eax
+     c6b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     c6e:	eb 06                	jmp    c76 <printint+0x3e>
+  } else {
+    x = xx;
+     c70:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c73:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     c76:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     c7d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     c80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c83:	ba 00 00 00 00       	mov    $0x0,%edx
+     c88:	f7 f1                	div    %ecx
+     c8a:	89 d1                	mov    %edx,%ecx
+     c8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c8f:	8d 50 01             	lea    0x1(%rax),%edx
+     c92:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     c95:	89 c9                	mov    %ecx,%ecx
+     c97:	48 8d 15 22 10 00 00 	lea    0x1022(%rip),%rdx        # 1cc0 <digits.0>
+     c9e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     ca2:	48 98                	cltq
+     ca4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     ca8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     cab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cae:	ba 00 00 00 00       	mov    $0x0,%edx
+     cb3:	f7 f6                	div    %esi
+     cb5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     cb8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     cbc:	75 bf                	jne    c7d <printint+0x45>
+  if(neg)
+     cbe:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     cc2:	74 2b                	je     cef <printint+0xb7>
+    buf[i++] = '-';
+     cc4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cc7:	8d 50 01             	lea    0x1(%rax),%edx
+     cca:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ccd:	48 98                	cltq
+     ccf:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     cd4:	eb 19                	jmp    cef <printint+0xb7>
+    putc(fd, buf[i]);
+     cd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd9:	48 98                	cltq
+     cdb:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     ce0:	0f be d0             	movsbl %al,%edx
+     ce3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ce6:	89 d6                	mov    %edx,%esi
+     ce8:	89 c7                	mov    %eax,%edi
+     cea:	e8 4c fe ff ff       	call   b3b <putc>
+  while(--i >= 0)
+     cef:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     cf3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     cf7:	79 dd                	jns    cd6 <printint+0x9e>
+}
+     cf9:	90                   	nop
+     cfa:	90                   	nop
+     cfb:	c9                   	leave
+     cfc:	c3                   	ret
+
+0000000000000cfd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     cfd:	55                   	push   %rbp
+     cfe:	48 89 e5             	mov    %rsp,%rbp
+     d01:	48 83 ec 70          	sub    $0x70,%rsp
+     d05:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     d08:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     d0c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     d10:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     d14:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     d18:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     d1c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     d23:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     d27:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     d2b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     d2f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     d33:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     d3a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     d41:	e9 6b 02 00 00       	jmp    fb1 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     d46:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     d49:	48 63 d0             	movslq %eax,%rdx
+     d4c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     d50:	48 01 d0             	add    %rdx,%rax
+     d53:	0f b6 00             	movzbl (%rax),%eax
+     d56:	0f be c0             	movsbl %al,%eax
+     d59:	25 ff 00 00 00       	and    $0xff,%eax
+     d5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     d61:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     d65:	75 30                	jne    d97 <printf+0x9a>
+      if(c == '%'){
+     d67:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     d6b:	75 13                	jne    d80 <printf+0x83>
+        state = '%';
+     d6d:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     d74:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     d7b:	e9 2d 02 00 00       	jmp    fad <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     d83:	0f be d0             	movsbl %al,%edx
+     d86:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d89:	89 d6                	mov    %edx,%esi
+     d8b:	89 c7                	mov    %eax,%edi
+     d8d:	e8 a9 fd ff ff       	call   b3b <putc>
+     d92:	e9 16 02 00 00       	jmp    fad <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     d97:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     d9b:	0f 85 0c 02 00 00    	jne    fad <printf+0x2b0>
+      if(c == 'l') {
+     da1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     da5:	75 0c                	jne    db3 <printf+0xb6>
+        lflag = 1;
+     da7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     dae:	e9 fa 01 00 00       	jmp    fad <printf+0x2b0>
+      } else if(c == 'd'){
+     db3:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     db7:	0f 85 95 00 00 00    	jne    e52 <printf+0x155>
+        if (lflag == 1)
+     dbd:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     dc1:	75 49                	jne    e0c <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     dc3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     dc6:	83 f8 2f             	cmp    $0x2f,%eax
+     dc9:	77 17                	ja     de2 <printf+0xe5>
+     dcb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     dcf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     dd2:	89 d2                	mov    %edx,%edx
+     dd4:	48 01 d0             	add    %rdx,%rax
+     dd7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     dda:	83 c2 08             	add    $0x8,%edx
+     ddd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     de0:	eb 0c                	jmp    dee <printf+0xf1>
+     de2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     de6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     dea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     dee:	48 8b 00             	mov    (%rax),%rax
+     df1:	89 c6                	mov    %eax,%esi
+     df3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     df6:	b9 01 00 00 00       	mov    $0x1,%ecx
+     dfb:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e00:	89 c7                	mov    %eax,%edi
+     e02:	e8 5d fd ff ff       	call   b64 <printint64>
+     e07:	e9 9a 01 00 00       	jmp    fa6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     e0c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     e0f:	83 f8 2f             	cmp    $0x2f,%eax
+     e12:	77 17                	ja     e2b <printf+0x12e>
+     e14:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     e18:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e1b:	89 d2                	mov    %edx,%edx
+     e1d:	48 01 d0             	add    %rdx,%rax
+     e20:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e23:	83 c2 08             	add    $0x8,%edx
+     e26:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     e29:	eb 0c                	jmp    e37 <printf+0x13a>
+     e2b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     e2f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     e33:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     e37:	8b 30                	mov    (%rax),%esi
+     e39:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     e3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e41:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e46:	89 c7                	mov    %eax,%edi
+     e48:	e8 eb fd ff ff       	call   c38 <printint>
+     e4d:	e9 54 01 00 00       	jmp    fa6 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     e52:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     e56:	74 0a                	je     e62 <printf+0x165>
+     e58:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     e5c:	0f 85 95 00 00 00    	jne    ef7 <printf+0x1fa>
+        if (lflag == 1)
+     e62:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     e66:	75 49                	jne    eb1 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     e68:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     e6b:	83 f8 2f             	cmp    $0x2f,%eax
+     e6e:	77 17                	ja     e87 <printf+0x18a>
+     e70:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     e74:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e77:	89 d2                	mov    %edx,%edx
+     e79:	48 01 d0             	add    %rdx,%rax
+     e7c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e7f:	83 c2 08             	add    $0x8,%edx
+     e82:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     e85:	eb 0c                	jmp    e93 <printf+0x196>
+     e87:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     e8b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     e8f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     e93:	48 8b 00             	mov    (%rax),%rax
+     e96:	89 c6                	mov    %eax,%esi
+     e98:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     e9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ea0:	ba 10 00 00 00       	mov    $0x10,%edx
+     ea5:	89 c7                	mov    %eax,%edi
+     ea7:	e8 b8 fc ff ff       	call   b64 <printint64>
+        if (lflag == 1)
+     eac:	e9 f5 00 00 00       	jmp    fa6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     eb1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     eb4:	83 f8 2f             	cmp    $0x2f,%eax
+     eb7:	77 17                	ja     ed0 <printf+0x1d3>
+     eb9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     ebd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ec0:	89 d2                	mov    %edx,%edx
+     ec2:	48 01 d0             	add    %rdx,%rax
+     ec5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ec8:	83 c2 08             	add    $0x8,%edx
+     ecb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     ece:	eb 0c                	jmp    edc <printf+0x1df>
+     ed0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     ed4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ed8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     edc:	8b 30                	mov    (%rax),%esi
+     ede:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     ee1:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ee6:	ba 10 00 00 00       	mov    $0x10,%edx
+     eeb:	89 c7                	mov    %eax,%edi
+     eed:	e8 46 fd ff ff       	call   c38 <printint>
+        if (lflag == 1)
+     ef2:	e9 af 00 00 00       	jmp    fa6 <printf+0x2a9>
+      } else if(c == 's'){
+     ef7:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     efb:	75 6e                	jne    f6b <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     efd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     f00:	83 f8 2f             	cmp    $0x2f,%eax
+     f03:	77 17                	ja     f1c <printf+0x21f>
+     f05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     f09:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f0c:	89 d2                	mov    %edx,%edx
+     f0e:	48 01 d0             	add    %rdx,%rax
+     f11:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f14:	83 c2 08             	add    $0x8,%edx
+     f17:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     f1a:	eb 0c                	jmp    f28 <printf+0x22b>
+     f1c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     f20:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     f24:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     f28:	48 8b 00             	mov    (%rax),%rax
+     f2b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     f2f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     f34:	75 28                	jne    f5e <printf+0x261>
+          s = "(null)";
+     f36:	48 8d 05 45 0a 00 00 	lea    0xa45(%rip),%rax        # 1982 <malloc+0x403>
+     f3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     f41:	eb 1b                	jmp    f5e <printf+0x261>
+          putc(fd, *s);
+     f43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f47:	0f b6 00             	movzbl (%rax),%eax
+     f4a:	0f be d0             	movsbl %al,%edx
+     f4d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f50:	89 d6                	mov    %edx,%esi
+     f52:	89 c7                	mov    %eax,%edi
+     f54:	e8 e2 fb ff ff       	call   b3b <putc>
+        for(; *s; s++)
+     f59:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     f5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f62:	0f b6 00             	movzbl (%rax),%eax
+     f65:	84 c0                	test   %al,%al
+     f67:	75 da                	jne    f43 <printf+0x246>
+     f69:	eb 3b                	jmp    fa6 <printf+0x2a9>
+      } else if(c == '%'){
+     f6b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     f6f:	75 14                	jne    f85 <printf+0x288>
+        putc(fd, c);
+     f71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     f74:	0f be d0             	movsbl %al,%edx
+     f77:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f7a:	89 d6                	mov    %edx,%esi
+     f7c:	89 c7                	mov    %eax,%edi
+     f7e:	e8 b8 fb ff ff       	call   b3b <putc>
+     f83:	eb 21                	jmp    fa6 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     f85:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f88:	be 25 00 00 00       	mov    $0x25,%esi
+     f8d:	89 c7                	mov    %eax,%edi
+     f8f:	e8 a7 fb ff ff       	call   b3b <putc>
+        putc(fd, c);
+     f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     f97:	0f be d0             	movsbl %al,%edx
+     f9a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f9d:	89 d6                	mov    %edx,%esi
+     f9f:	89 c7                	mov    %eax,%edi
+     fa1:	e8 95 fb ff ff       	call   b3b <putc>
+      }
+      state = 0;
+     fa6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     fad:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     fb1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     fb4:	48 63 d0             	movslq %eax,%rdx
+     fb7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     fbb:	48 01 d0             	add    %rdx,%rax
+     fbe:	0f b6 00             	movzbl (%rax),%eax
+     fc1:	84 c0                	test   %al,%al
+     fc3:	0f 85 7d fd ff ff    	jne    d46 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     fc9:	90                   	nop
+     fca:	90                   	nop
+     fcb:	c9                   	leave
+     fcc:	c3                   	ret
+
+0000000000000fcd <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     fcd:	55                   	push   %rbp
+     fce:	48 89 e5             	mov    %rsp,%rbp
+     fd1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fd5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     fd8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     fdb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     fdf:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     fe2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fe5:	48 89 ce             	mov    %rcx,%rsi
+     fe8:	48 89 f7             	mov    %rsi,%rdi
+     feb:	89 d1                	mov    %edx,%ecx
+     fed:	fc                   	cld
+     fee:	f3 aa                	rep stos %al,%es:(%rdi)
+     ff0:	89 ca                	mov    %ecx,%edx
+     ff2:	48 89 fe             	mov    %rdi,%rsi
+     ff5:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     ff9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+     ffc:	90                   	nop
+     ffd:	5d                   	pop    %rbp
+     ffe:	c3                   	ret
+
+0000000000000fff <strcpy>:
+{
+     fff:	55                   	push   %rbp
+    1000:	48 89 e5             	mov    %rsp,%rbp
+    1003:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1007:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    100b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    100f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1013:	90                   	nop
+    1014:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1018:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    101c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1020:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1024:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1028:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    102c:	0f b6 12             	movzbl (%rdx),%edx
+    102f:	88 10                	mov    %dl,(%rax)
+    1031:	0f b6 00             	movzbl (%rax),%eax
+    1034:	84 c0                	test   %al,%al
+    1036:	75 dc                	jne    1014 <strcpy+0x15>
+  return os;
+    1038:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    103c:	5d                   	pop    %rbp
+    103d:	c3                   	ret
+
+000000000000103e <strcmp>:
+{
+    103e:	55                   	push   %rbp
+    103f:	48 89 e5             	mov    %rsp,%rbp
+    1042:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1046:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    104a:	eb 0a                	jmp    1056 <strcmp+0x18>
+    p++, q++;
+    104c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1051:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1056:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105a:	0f b6 00             	movzbl (%rax),%eax
+    105d:	84 c0                	test   %al,%al
+    105f:	74 12                	je     1073 <strcmp+0x35>
+    1061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1065:	0f b6 10             	movzbl (%rax),%edx
+    1068:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    106c:	0f b6 00             	movzbl (%rax),%eax
+    106f:	38 c2                	cmp    %al,%dl
+    1071:	74 d9                	je     104c <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1077:	0f b6 00             	movzbl (%rax),%eax
+    107a:	0f b6 d0             	movzbl %al,%edx
+    107d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1081:	0f b6 00             	movzbl (%rax),%eax
+    1084:	0f b6 c0             	movzbl %al,%eax
+    1087:	29 c2                	sub    %eax,%edx
+    1089:	89 d0                	mov    %edx,%eax
+}
+    108b:	5d                   	pop    %rbp
+    108c:	c3                   	ret
+
+000000000000108d <strlen>:
+{
+    108d:	55                   	push   %rbp
+    108e:	48 89 e5             	mov    %rsp,%rbp
+    1091:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1095:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    109c:	eb 04                	jmp    10a2 <strlen+0x15>
+    109e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10a5:	48 63 d0             	movslq %eax,%rdx
+    10a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10ac:	48 01 d0             	add    %rdx,%rax
+    10af:	0f b6 00             	movzbl (%rax),%eax
+    10b2:	84 c0                	test   %al,%al
+    10b4:	75 e8                	jne    109e <strlen+0x11>
+  return n;
+    10b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    10b9:	5d                   	pop    %rbp
+    10ba:	c3                   	ret
+
+00000000000010bb <memset>:
+{
+    10bb:	55                   	push   %rbp
+    10bc:	48 89 e5             	mov    %rsp,%rbp
+    10bf:	48 83 ec 10          	sub    $0x10,%rsp
+    10c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10c7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    10ca:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    10cd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    10d0:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    10d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d7:	89 ce                	mov    %ecx,%esi
+    10d9:	48 89 c7             	mov    %rax,%rdi
+    10dc:	e8 ec fe ff ff       	call   fcd <stosb>
+  return dst;
+    10e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    10e5:	c9                   	leave
+    10e6:	c3                   	ret
+
+00000000000010e7 <strchr>:
+{
+    10e7:	55                   	push   %rbp
+    10e8:	48 89 e5             	mov    %rsp,%rbp
+    10eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10ef:	89 f0                	mov    %esi,%eax
+    10f1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    10f4:	eb 17                	jmp    110d <strchr+0x26>
+    if(*s == c)
+    10f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10fa:	0f b6 00             	movzbl (%rax),%eax
+    10fd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1100:	75 06                	jne    1108 <strchr+0x21>
+      return (char*)s;
+    1102:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1106:	eb 15                	jmp    111d <strchr+0x36>
+  for(; *s; s++)
+    1108:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    110d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1111:	0f b6 00             	movzbl (%rax),%eax
+    1114:	84 c0                	test   %al,%al
+    1116:	75 de                	jne    10f6 <strchr+0xf>
+  return 0;
+    1118:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    111d:	5d                   	pop    %rbp
+    111e:	c3                   	ret
+
+000000000000111f <gets>:
+gets(char *buf, int max)
+{
+    111f:	55                   	push   %rbp
+    1120:	48 89 e5             	mov    %rsp,%rbp
+    1123:	48 83 ec 20          	sub    $0x20,%rsp
+    1127:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    112b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    112e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1135:	eb 48                	jmp    117f <gets+0x60>
+    cc = read(0, &c, 1);
+    1137:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    113b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1140:	48 89 c6             	mov    %rax,%rsi
+    1143:	bf 00 00 00 00       	mov    $0x0,%edi
+    1148:	e8 6f 01 00 00       	call   12bc <read>
+    114d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1150:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1154:	7e 36                	jle    118c <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1159:	8d 50 01             	lea    0x1(%rax),%edx
+    115c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    115f:	48 63 d0             	movslq %eax,%rdx
+    1162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1166:	48 01 c2             	add    %rax,%rdx
+    1169:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    116d:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    116f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1173:	3c 0a                	cmp    $0xa,%al
+    1175:	74 16                	je     118d <gets+0x6e>
+    1177:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    117b:	3c 0d                	cmp    $0xd,%al
+    117d:	74 0e                	je     118d <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    117f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1182:	83 c0 01             	add    $0x1,%eax
+    1185:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1188:	7f ad                	jg     1137 <gets+0x18>
+    118a:	eb 01                	jmp    118d <gets+0x6e>
+      break;
+    118c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    118d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1190:	48 63 d0             	movslq %eax,%rdx
+    1193:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1197:	48 01 d0             	add    %rdx,%rax
+    119a:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    119d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    11a1:	c9                   	leave
+    11a2:	c3                   	ret
+
+00000000000011a3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    11a3:	55                   	push   %rbp
+    11a4:	48 89 e5             	mov    %rsp,%rbp
+    11a7:	48 83 ec 20          	sub    $0x20,%rsp
+    11ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11b7:	be 00 00 00 00       	mov    $0x0,%esi
+    11bc:	48 89 c7             	mov    %rax,%rdi
+    11bf:	e8 20 01 00 00       	call   12e4 <open>
+    11c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    11c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    11cb:	79 07                	jns    11d4 <stat+0x31>
+    return -1;
+    11cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11d2:	eb 21                	jmp    11f5 <stat+0x52>
+  r = fstat(fd, st);
+    11d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    11d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11db:	48 89 d6             	mov    %rdx,%rsi
+    11de:	89 c7                	mov    %eax,%edi
+    11e0:	e8 17 01 00 00       	call   12fc <fstat>
+    11e5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    11e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11eb:	89 c7                	mov    %eax,%edi
+    11ed:	e8 da 00 00 00       	call   12cc <close>
+  return r;
+    11f2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    11f5:	c9                   	leave
+    11f6:	c3                   	ret
+
+00000000000011f7 <atoi>:
+
+int
+atoi(const char *s)
+{
+    11f7:	55                   	push   %rbp
+    11f8:	48 89 e5             	mov    %rsp,%rbp
+    11fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    11ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1206:	eb 28                	jmp    1230 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1208:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    120b:	89 d0                	mov    %edx,%eax
+    120d:	c1 e0 02             	shl    $0x2,%eax
+    1210:	01 d0                	add    %edx,%eax
+    1212:	01 c0                	add    %eax,%eax
+    1214:	89 c1                	mov    %eax,%ecx
+    1216:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    121a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    121e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1222:	0f b6 00             	movzbl (%rax),%eax
+    1225:	0f be c0             	movsbl %al,%eax
+    1228:	01 c8                	add    %ecx,%eax
+    122a:	83 e8 30             	sub    $0x30,%eax
+    122d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1230:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1234:	0f b6 00             	movzbl (%rax),%eax
+    1237:	3c 2f                	cmp    $0x2f,%al
+    1239:	7e 0b                	jle    1246 <atoi+0x4f>
+    123b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    123f:	0f b6 00             	movzbl (%rax),%eax
+    1242:	3c 39                	cmp    $0x39,%al
+    1244:	7e c2                	jle    1208 <atoi+0x11>
+  return n;
+    1246:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1249:	5d                   	pop    %rbp
+    124a:	c3                   	ret
+
+000000000000124b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    124b:	55                   	push   %rbp
+    124c:	48 89 e5             	mov    %rsp,%rbp
+    124f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1253:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1257:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    125a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    125e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1266:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    126a:	eb 1d                	jmp    1289 <memmove+0x3e>
+    *dst++ = *src++;
+    126c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1270:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1274:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1278:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    127c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1280:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1284:	0f b6 12             	movzbl (%rdx),%edx
+    1287:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1289:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    128c:	8d 50 ff             	lea    -0x1(%rax),%edx
+    128f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1292:	85 c0                	test   %eax,%eax
+    1294:	7f d6                	jg     126c <memmove+0x21>
+  return vdst;
+    1296:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    129a:	5d                   	pop    %rbp
+    129b:	c3                   	ret
+
+000000000000129c <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    129c:	b8 01 00 00 00       	mov    $0x1,%eax
+    12a1:	cd 40                	int    $0x40
+    12a3:	c3                   	ret
+
+00000000000012a4 <exit>:
+SYSCALL(exit)
+    12a4:	b8 02 00 00 00       	mov    $0x2,%eax
+    12a9:	cd 40                	int    $0x40
+    12ab:	c3                   	ret
+
+00000000000012ac <wait>:
+SYSCALL(wait)
+    12ac:	b8 03 00 00 00       	mov    $0x3,%eax
+    12b1:	cd 40                	int    $0x40
+    12b3:	c3                   	ret
+
+00000000000012b4 <pipe>:
+SYSCALL(pipe)
+    12b4:	b8 04 00 00 00       	mov    $0x4,%eax
+    12b9:	cd 40                	int    $0x40
+    12bb:	c3                   	ret
+
+00000000000012bc <read>:
+SYSCALL(read)
+    12bc:	b8 05 00 00 00       	mov    $0x5,%eax
+    12c1:	cd 40                	int    $0x40
+    12c3:	c3                   	ret
+
+00000000000012c4 <write>:
+SYSCALL(write)
+    12c4:	b8 10 00 00 00       	mov    $0x10,%eax
+    12c9:	cd 40                	int    $0x40
+    12cb:	c3                   	ret
+
+00000000000012cc <close>:
+SYSCALL(close)
+    12cc:	b8 15 00 00 00       	mov    $0x15,%eax
+    12d1:	cd 40                	int    $0x40
+    12d3:	c3                   	ret
+
+00000000000012d4 <kill>:
+SYSCALL(kill)
+    12d4:	b8 06 00 00 00       	mov    $0x6,%eax
+    12d9:	cd 40                	int    $0x40
+    12db:	c3                   	ret
+
+00000000000012dc <exec>:
+SYSCALL(exec)
+    12dc:	b8 07 00 00 00       	mov    $0x7,%eax
+    12e1:	cd 40                	int    $0x40
+    12e3:	c3                   	ret
+
+00000000000012e4 <open>:
+SYSCALL(open)
+    12e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12e9:	cd 40                	int    $0x40
+    12eb:	c3                   	ret
+
+00000000000012ec <mknod>:
+SYSCALL(mknod)
+    12ec:	b8 11 00 00 00       	mov    $0x11,%eax
+    12f1:	cd 40                	int    $0x40
+    12f3:	c3                   	ret
+
+00000000000012f4 <unlink>:
+SYSCALL(unlink)
+    12f4:	b8 12 00 00 00       	mov    $0x12,%eax
+    12f9:	cd 40                	int    $0x40
+    12fb:	c3                   	ret
+
+00000000000012fc <fstat>:
+SYSCALL(fstat)
+    12fc:	b8 08 00 00 00       	mov    $0x8,%eax
+    1301:	cd 40                	int    $0x40
+    1303:	c3                   	ret
+
+0000000000001304 <link>:
+SYSCALL(link)
+    1304:	b8 13 00 00 00       	mov    $0x13,%eax
+    1309:	cd 40                	int    $0x40
+    130b:	c3                   	ret
+
+000000000000130c <mkdir>:
+SYSCALL(mkdir)
+    130c:	b8 14 00 00 00       	mov    $0x14,%eax
+    1311:	cd 40                	int    $0x40
+    1313:	c3                   	ret
+
+0000000000001314 <chdir>:
+SYSCALL(chdir)
+    1314:	b8 09 00 00 00       	mov    $0x9,%eax
+    1319:	cd 40                	int    $0x40
+    131b:	c3                   	ret
+
+000000000000131c <dup>:
+SYSCALL(dup)
+    131c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1321:	cd 40                	int    $0x40
+    1323:	c3                   	ret
+
+0000000000001324 <getpid>:
+SYSCALL(getpid)
+    1324:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1329:	cd 40                	int    $0x40
+    132b:	c3                   	ret
+
+000000000000132c <sbrk>:
+SYSCALL(sbrk)
+    132c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1331:	cd 40                	int    $0x40
+    1333:	c3                   	ret
+
+0000000000001334 <sleep>:
+SYSCALL(sleep)
+    1334:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1339:	cd 40                	int    $0x40
+    133b:	c3                   	ret
+
+000000000000133c <uptime>:
+SYSCALL(uptime)
+    133c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1341:	cd 40                	int    $0x40
+    1343:	c3                   	ret
+
+0000000000001344 <sysinfo>:
+SYSCALL(sysinfo)
+    1344:	b8 16 00 00 00       	mov    $0x16,%eax
+    1349:	cd 40                	int    $0x40
+    134b:	c3                   	ret
+
+000000000000134c <mmap>:
+SYSCALL(mmap)
+    134c:	b8 17 00 00 00       	mov    $0x17,%eax
+    1351:	cd 40                	int    $0x40
+    1353:	c3                   	ret
+
+0000000000001354 <munmap>:
+SYSCALL(munmap)
+    1354:	b8 18 00 00 00       	mov    $0x18,%eax
+    1359:	cd 40                	int    $0x40
+    135b:	c3                   	ret
+
+000000000000135c <crashn>:
+SYSCALL(crashn)
+    135c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1361:	cd 40                	int    $0x40
+    1363:	c3                   	ret
+
+0000000000001364 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1364:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1369:	cd 40                	int    $0x40
+    136b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    136e:	74 02                	je     1372 <mmap2+0xe>
+    1370:	89 c0                	mov    %eax,%eax
+    1372:	c3                   	ret
+
+0000000000001373 <munmap2>:
+SYSCALL(munmap2)
+    1373:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1378:	cd 40                	int    $0x40
+    137a:	c3                   	ret
+
+000000000000137b <msync>:
+SYSCALL(msync)
+    137b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1380:	cd 40                	int    $0x40
+    1382:	c3                   	ret
+
+0000000000001383 <sendfile>:
+SYSCALL(sendfile)
+    1383:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1388:	cd 40                	int    $0x40
+    138a:	c3                   	ret
+
+000000000000138b <splice>:
+SYSCALL(splice)
+    138b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1390:	cd 40                	int    $0x40
+    1392:	c3                   	ret
+
+0000000000001393 <pread>:
+SYSCALL(pread)
+    1393:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1398:	cd 40                	int    $0x40
+    139a:	c3                   	ret
+
+000000000000139b <pwrite>:
+SYSCALL(pwrite)
+    139b:	b8 20 00 00 00       	mov    $0x20,%eax
+    13a0:	cd 40                	int    $0x40
+    13a2:	c3                   	ret
+
+00000000000013a3 <readv>:
+SYSCALL(readv)
+    13a3:	b8 21 00 00 00       	mov    $0x21,%eax
+    13a8:	cd 40                	int    $0x40
+    13aa:	c3                   	ret
+
+00000000000013ab <writev>:
+SYSCALL(writev)
+    13ab:	b8 22 00 00 00       	mov    $0x22,%eax
+    13b0:	cd 40                	int    $0x40
+    13b2:	c3                   	ret
+
+00000000000013b3 <poll>:
+SYSCALL(poll)
+    13b3:	b8 23 00 00 00       	mov    $0x23,%eax
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+00000000000013bb <pipe2>:
+SYSCALL(pipe2)
+    13bb:	b8 24 00 00 00       	mov    $0x24,%eax
+    13c0:	cd 40                	int    $0x40
+    13c2:	c3                   	ret
+
+00000000000013c3 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    13c3:	55                   	push   %rbp
+    13c4:	48 89 e5             	mov    %rsp,%rbp
+    13c7:	48 83 ec 20          	sub    $0x20,%rsp
+    13cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    13cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13d3:	48 83 e8 10          	sub    $0x10,%rax
+    13d7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    13db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13df:	48 8b 10             	mov    (%rax),%rdx
+    13e2:	48 8d 05 17 09 00 00 	lea    0x917(%rip),%rax        # 1d00 <bigblock>
+    13e9:	48 39 c2             	cmp    %rax,%rdx
+    13ec:	75 1f                	jne    140d <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    13ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13f2:	8b 40 08             	mov    0x8(%rax),%eax
+    13f5:	c1 e0 04             	shl    $0x4,%eax
+    13f8:	89 c2                	mov    %eax,%edx
+    13fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13fe:	89 d6                	mov    %edx,%esi
+    1400:	48 89 c7             	mov    %rax,%rdi
+    1403:	e8 6b ff ff ff       	call   1373 <munmap2>
+    return;
+    1408:	e9 0b 01 00 00       	jmp    1518 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    140d:	48 8b 05 dc 08 00 00 	mov    0x8dc(%rip),%rax        # 1cf0 <freep>
+    1414:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1418:	eb 2f                	jmp    1449 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    141a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    141e:	48 8b 00             	mov    (%rax),%rax
+    1421:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1425:	72 17                	jb     143e <free+0x7b>
+    1427:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    142b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    142f:	72 2f                	jb     1460 <free+0x9d>
+    1431:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1435:	48 8b 00             	mov    (%rax),%rax
+    1438:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    143c:	72 22                	jb     1460 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    143e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1442:	48 8b 00             	mov    (%rax),%rax
+    1445:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1449:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    144d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1451:	73 c7                	jae    141a <free+0x57>
+    1453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1457:	48 8b 00             	mov    (%rax),%rax
+    145a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    145e:	73 ba                	jae    141a <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1460:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1464:	8b 40 08             	mov    0x8(%rax),%eax
+    1467:	89 c0                	mov    %eax,%eax
+    1469:	48 c1 e0 04          	shl    $0x4,%rax
+    146d:	48 89 c2             	mov    %rax,%rdx
+    1470:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1474:	48 01 c2             	add    %rax,%rdx
+    1477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    147b:	48 8b 00             	mov    (%rax),%rax
+    147e:	48 39 c2             	cmp    %rax,%rdx
+    1481:	75 2d                	jne    14b0 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1483:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1487:	8b 50 08             	mov    0x8(%rax),%edx
+    148a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    148e:	48 8b 00             	mov    (%rax),%rax
+    1491:	8b 40 08             	mov    0x8(%rax),%eax
+    1494:	01 c2                	add    %eax,%edx
+    1496:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    149a:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    149d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14a1:	48 8b 00             	mov    (%rax),%rax
+    14a4:	48 8b 10             	mov    (%rax),%rdx
+    14a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14ab:	48 89 10             	mov    %rdx,(%rax)
+    14ae:	eb 0e                	jmp    14be <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    14b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14b4:	48 8b 10             	mov    (%rax),%rdx
+    14b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14bb:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    14be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c2:	8b 40 08             	mov    0x8(%rax),%eax
+    14c5:	89 c0                	mov    %eax,%eax
+    14c7:	48 c1 e0 04          	shl    $0x4,%rax
+    14cb:	48 89 c2             	mov    %rax,%rdx
+    14ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14d2:	48 01 d0             	add    %rdx,%rax
+    14d5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    14d9:	75 27                	jne    1502 <free+0x13f>
+    p->s.size += bp->s.size;
+    14db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14df:	8b 50 08             	mov    0x8(%rax),%edx
+    14e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14e6:	8b 40 08             	mov    0x8(%rax),%eax
+    14e9:	01 c2                	add    %eax,%edx
+    14eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14ef:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    14f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14f6:	48 8b 10             	mov    (%rax),%rdx
+    14f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14fd:	48 89 10             	mov    %rdx,(%rax)
+    1500:	eb 0b                	jmp    150d <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1502:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1506:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    150a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    150d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1511:	48 89 05 d8 07 00 00 	mov    %rax,0x7d8(%rip)        # 1cf0 <freep>
+}
+    1518:	c9                   	leave
+    1519:	c3                   	ret
+
+000000000000151a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    151a:	55                   	push   %rbp
+    151b:	48 89 e5             	mov    %rsp,%rbp
+    151e:	48 83 ec 20          	sub    $0x20,%rsp
+    1522:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1525:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    152c:	77 07                	ja     1535 <morecore+0x1b>
+    nu = 4096;
+    152e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1535:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1538:	c1 e0 04             	shl    $0x4,%eax
+    153b:	89 c7                	mov    %eax,%edi
+    153d:	e8 ea fd ff ff       	call   132c <sbrk>
+    1542:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1546:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    154b:	75 07                	jne    1554 <morecore+0x3a>
+    return 0;
+    154d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1552:	eb 29                	jmp    157d <morecore+0x63>
+  hp = (Header*)p;
+    1554:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1558:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    155c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1560:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1563:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1566:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    156a:	48 83 c0 10          	add    $0x10,%rax
+    156e:	48 89 c7             	mov    %rax,%rdi
+    1571:	e8 4d fe ff ff       	call   13c3 <free>
+  return freep;
+    1576:	48 8b 05 73 07 00 00 	mov    0x773(%rip),%rax        # 1cf0 <freep>
+}
+    157d:	c9                   	leave
+    157e:	c3                   	ret
+
+000000000000157f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    157f:	55                   	push   %rbp
+    1580:	48 89 e5             	mov    %rsp,%rbp
+    1583:	48 83 ec 30          	sub    $0x30,%rsp
+    1587:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    158a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    158d:	48 83 c0 0f          	add    $0xf,%rax
+    1591:	48 c1 e8 04          	shr    $0x4,%rax
+    1595:	83 c0 01             	add    $0x1,%eax
+    1598:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    159b:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    15a2:	76 62                	jbe    1606 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    15a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    15a7:	c1 e0 04             	shl    $0x4,%eax
+    15aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    15b0:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    15b6:	b9 22 00 00 00       	mov    $0x22,%ecx
+    15bb:	ba 03 00 00 00       	mov    $0x3,%edx
+    15c0:	89 c6                	mov    %eax,%esi
+    15c2:	bf 00 00 00 00       	mov    $0x0,%edi
+    15c7:	e8 98 fd ff ff       	call   1364 <mmap2>
+    15cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    15d0:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15d5:	75 0a                	jne    15e1 <malloc+0x62>
+      return 0;
+    15d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    15dc:	e9 1c 01 00 00       	jmp    16fd <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    15e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e5:	48 8d 15 14 07 00 00 	lea    0x714(%rip),%rdx        # 1d00 <bigblock>
+    15ec:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    15ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15f3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    15f6:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    15f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15fd:	48 83 c0 10          	add    $0x10,%rax
+    1601:	e9 f7 00 00 00       	jmp    16fd <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1606:	48 8b 05 e3 06 00 00 	mov    0x6e3(%rip),%rax        # 1cf0 <freep>
+    160d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1611:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1616:	75 2e                	jne    1646 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1618:	48 8d 05 c1 06 00 00 	lea    0x6c1(%rip),%rax        # 1ce0 <base>
+    161f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1623:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1627:	48 89 05 c2 06 00 00 	mov    %rax,0x6c2(%rip)        # 1cf0 <freep>
+    162e:	48 8b 05 bb 06 00 00 	mov    0x6bb(%rip),%rax        # 1cf0 <freep>
+    1635:	48 89 05 a4 06 00 00 	mov    %rax,0x6a4(%rip)        # 1ce0 <base>
+    base.s.size = 0;
+    163c:	c7 05 a2 06 00 00 00 	movl   $0x0,0x6a2(%rip)        # 1ce8 <base+0x8>
+    1643:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    164a:	48 8b 00             	mov    (%rax),%rax
+    164d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1651:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1655:	8b 40 08             	mov    0x8(%rax),%eax
+    1658:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    165b:	72 5f                	jb     16bc <malloc+0x13d>
+      if(p->s.size == nunits)
+    165d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1661:	8b 40 08             	mov    0x8(%rax),%eax
+    1664:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1667:	75 10                	jne    1679 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    166d:	48 8b 10             	mov    (%rax),%rdx
+    1670:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1674:	48 89 10             	mov    %rdx,(%rax)
+    1677:	eb 2e                	jmp    16a7 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167d:	8b 40 08             	mov    0x8(%rax),%eax
+    1680:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1683:	89 c2                	mov    %eax,%edx
+    1685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1689:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    168c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1690:	8b 40 08             	mov    0x8(%rax),%eax
+    1693:	89 c0                	mov    %eax,%eax
+    1695:	48 c1 e0 04          	shl    $0x4,%rax
+    1699:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    169d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    16a4:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    16a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16ab:	48 89 05 3e 06 00 00 	mov    %rax,0x63e(%rip)        # 1cf0 <freep>
+      return (void*)(p + 1);
+    16b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b6:	48 83 c0 10          	add    $0x10,%rax
+    16ba:	eb 41                	jmp    16fd <malloc+0x17e>
+    }
+    if(p == freep)
+    16bc:	48 8b 05 2d 06 00 00 	mov    0x62d(%rip),%rax        # 1cf0 <freep>
+    16c3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    16c7:	75 1c                	jne    16e5 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    16c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    16cc:	89 c7                	mov    %eax,%edi
+    16ce:	e8 47 fe ff ff       	call   151a <morecore>
+    16d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16d7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    16dc:	75 07                	jne    16e5 <malloc+0x166>
+        return 0;
+    16de:	b8 00 00 00 00       	mov    $0x0,%eax
+    16e3:	eb 18                	jmp    16fd <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f1:	48 8b 00             	mov    (%rax),%rax
+    16f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    16f8:	e9 54 ff ff ff       	jmp    1651 <malloc+0xd2>
+  }
+}
+    16fd:	c9                   	leave
+    16fe:	c3                   	ret
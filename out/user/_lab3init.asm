@@ -0,0 +1,1440 @@
+
+out/user/_lab3init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+char *argv[] = { "lab3test", 0 };
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  if(open("console", O_RDWR) < 0){
+   4:	be 02 00 00 00       	mov    $0x2,%esi
+   9:	48 8d 05 51 0c 00 00 	lea    0xc51(%rip),%rax        # c61 <malloc+0x189>
+  10:	48 89 c7             	mov    %rax,%rdi
+  13:	e8 25 08 00 00       	call   83d <open>
+  18:	85 c0                	test   %eax,%eax
+  1a:	79 2d                	jns    49 <main+0x49>
+    mknod("console", 1, 1);
+  1c:	ba 01 00 00 00       	mov    $0x1,%edx
+  21:	be 01 00 00 00       	mov    $0x1,%esi
+  26:	48 8d 05 34 0c 00 00 	lea    0xc34(%rip),%rax        # c61 <malloc+0x189>
+  2d:	48 89 c7             	mov    %rax,%rdi
+  30:	e8 10 08 00 00       	call   845 <mknod>
+    open("console", O_RDWR);
+  35:	be 02 00 00 00       	mov    $0x2,%esi
+  3a:	48 8d 05 20 0c 00 00 	lea    0xc20(%rip),%rax        # c61 <malloc+0x189>
+  41:	48 89 c7             	mov    %rax,%rdi
+  44:	e8 f4 07 00 00       	call   83d <open>
+  }
+  dup(0);  // stdout
+  49:	bf 00 00 00 00       	mov    $0x0,%edi
+  4e:	e8 22 08 00 00       	call   875 <dup>
+  dup(0);  // stderr
+  53:	bf 00 00 00 00       	mov    $0x0,%edi
+  58:	e8 18 08 00 00       	call   875 <dup>
+
+  exec("lab3test", argv);
+  5d:	48 8d 05 7c 0e 00 00 	lea    0xe7c(%rip),%rax        # ee0 <argv>
+  64:	48 89 c6             	mov    %rax,%rsi
+  67:	48 8d 05 ea 0b 00 00 	lea    0xbea(%rip),%rax        # c58 <malloc+0x180>
+  6e:	48 89 c7             	mov    %rax,%rdi
+  71:	e8 bf 07 00 00       	call   835 <exec>
+  printf(1, "lab3init: exec failed\n");
+  76:	48 8d 05 ec 0b 00 00 	lea    0xbec(%rip),%rax        # c69 <malloc+0x191>
+  7d:	48 89 c6             	mov    %rax,%rsi
+  80:	bf 01 00 00 00       	mov    $0x1,%edi
+  85:	b8 00 00 00 00       	mov    $0x0,%eax
+  8a:	e8 c7 01 00 00       	call   256 <printf>
+  exit();
+  8f:	e8 69 07 00 00       	call   7fd <exit>
+
+0000000000000094 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+  94:	55                   	push   %rbp
+  95:	48 89 e5             	mov    %rsp,%rbp
+  98:	48 83 ec 10          	sub    $0x10,%rsp
+  9c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  9f:	89 f0                	mov    %esi,%eax
+  a1:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+  a4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  ab:	ba 01 00 00 00       	mov    $0x1,%edx
+  b0:	48 89 ce             	mov    %rcx,%rsi
+  b3:	89 c7                	mov    %eax,%edi
+  b5:	e8 63 07 00 00       	call   81d <write>
+}
+  ba:	90                   	nop
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+
+00000000000000bd <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+  bd:	55                   	push   %rbp
+  be:	48 89 e5             	mov    %rsp,%rbp
+  c1:	48 83 ec 40          	sub    $0x40,%rsp
+  c5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  c8:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  cb:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  ce:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+  d1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  d5:	74 1f                	je     f6 <printint64+0x39>
+  d7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  da:	c1 e8 1f             	shr    $0x1f,%eax
+  dd:	0f b6 c0             	movzbl %al,%eax
+  e0:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  e3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  e7:	74 0d                	je     f6 <printint64+0x39>
+    x = -xx;
+  e9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  ec:	f7 d8                	neg    %eax
+  ee:	48 98                	cltq
+  f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  f4:	eb 09                	jmp    ff <printint64+0x42>
+  else
+    x = xx;
+  f6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  f9:	48 98                	cltq
+  fb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+  ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 106:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 109:	48 63 c8             	movslq %eax,%rcx
+ 10c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 110:	ba 00 00 00 00       	mov    $0x0,%edx
+ 115:	48 f7 f1             	div    %rcx
+ 118:	48 89 d1             	mov    %rdx,%rcx
+ 11b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 11e:	8d 50 01             	lea    0x1(%rax),%edx
+ 121:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 124:	48 8d 15 c5 0d 00 00 	lea    0xdc5(%rip),%rdx        # ef0 <digits.1>
+ 12b:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 12f:	48 98                	cltq
+ 131:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 135:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 138:	48 63 f0             	movslq %eax,%rsi
+ 13b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 13f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 144:	48 f7 f6             	div    %rsi
+ 147:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 14b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 150:	75 b4                	jne    106 <printint64+0x49>
+
+  if(sgn)
+ 152:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 156:	74 2b                	je     183 <printint64+0xc6>
+    buf[i++] = '-';
+ 158:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 15b:	8d 50 01             	lea    0x1(%rax),%edx
+ 15e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 161:	48 98                	cltq
+ 163:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 168:	eb 19                	jmp    183 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 16a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 16d:	48 98                	cltq
+ 16f:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 174:	0f be d0             	movsbl %al,%edx
+ 177:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 17a:	89 d6                	mov    %edx,%esi
+ 17c:	89 c7                	mov    %eax,%edi
+ 17e:	e8 11 ff ff ff       	call   94 <putc>
+  while(--i >= 0)
+ 183:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 187:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 18b:	79 dd                	jns    16a <printint64+0xad>
+}
+ 18d:	90                   	nop
+ 18e:	90                   	nop
+ 18f:	c9                   	leave
+ 190:	c3                   	ret
+
+0000000000000191 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 191:	55                   	push   %rbp
+ 192:	48 89 e5             	mov    %rsp,%rbp
+ 195:	48 83 ec 30          	sub    $0x30,%rsp
+ 199:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 19c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 19f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1a2:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1a5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 1ac:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1b0:	74 17                	je     1c9 <printint+0x38>
+ 1b2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1b6:	79 11                	jns    1c9 <printint+0x38>
+    neg = 1;
+ 1b8:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1bf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1c2:	f7 d8                	neg    %eax
+ 1c4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1c7:	eb 06                	jmp    1cf <printint+0x3e>
+  } else {
+    x = xx;
+ 1c9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1cc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1cf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 1d6:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1e1:	f7 f1                	div    %ecx
+ 1e3:	89 d1                	mov    %edx,%ecx
+ 1e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1e8:	8d 50 01             	lea    0x1(%rax),%edx
+ 1eb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ee:	89 c9                	mov    %ecx,%ecx
+ 1f0:	48 8d 15 19 0d 00 00 	lea    0xd19(%rip),%rdx        # f10 <digits.0>
+ 1f7:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1fb:	48 98                	cltq
+ 1fd:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 201:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 204:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 207:	ba 00 00 00 00       	mov    $0x0,%edx
+ 20c:	f7 f6                	div    %esi
+ 20e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 211:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 215:	75 bf                	jne    1d6 <printint+0x45>
+  if(neg)
+ 217:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 21b:	74 2b                	je     248 <printint+0xb7>
+    buf[i++] = '-';
+ 21d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 220:	8d 50 01             	lea    0x1(%rax),%edx
+ 223:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 226:	48 98                	cltq
+ 228:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 22d:	eb 19                	jmp    248 <printint+0xb7>
+    putc(fd, buf[i]);
+ 22f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 232:	48 98                	cltq
+ 234:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 239:	0f be d0             	movsbl %al,%edx
+ 23c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 23f:	89 d6                	mov    %edx,%esi
+ 241:	89 c7                	mov    %eax,%edi
+ 243:	e8 4c fe ff ff       	call   94 <putc>
+  while(--i >= 0)
+ 248:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 24c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 250:	79 dd                	jns    22f <printint+0x9e>
+}
+ 252:	90                   	nop
+ 253:	90                   	nop
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+
+0000000000000256 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 256:	55                   	push   %rbp
+ 257:	48 89 e5             	mov    %rsp,%rbp
+ 25a:	48 83 ec 70          	sub    $0x70,%rsp
+ 25e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 261:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 265:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 269:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 26d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 271:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 275:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 27c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 280:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 284:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 288:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 28c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 293:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 29a:	e9 6b 02 00 00       	jmp    50a <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 29f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2a2:	48 63 d0             	movslq %eax,%rdx
+ 2a5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2a9:	48 01 d0             	add    %rdx,%rax
+ 2ac:	0f b6 00             	movzbl (%rax),%eax
+ 2af:	0f be c0             	movsbl %al,%eax
+ 2b2:	25 ff 00 00 00       	and    $0xff,%eax
+ 2b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 2ba:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2be:	75 30                	jne    2f0 <printf+0x9a>
+      if(c == '%'){
+ 2c0:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2c4:	75 13                	jne    2d9 <printf+0x83>
+        state = '%';
+ 2c6:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2cd:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2d4:	e9 2d 02 00 00       	jmp    506 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2dc:	0f be d0             	movsbl %al,%edx
+ 2df:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2e2:	89 d6                	mov    %edx,%esi
+ 2e4:	89 c7                	mov    %eax,%edi
+ 2e6:	e8 a9 fd ff ff       	call   94 <putc>
+ 2eb:	e9 16 02 00 00       	jmp    506 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 2f0:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 2f4:	0f 85 0c 02 00 00    	jne    506 <printf+0x2b0>
+      if(c == 'l') {
+ 2fa:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 2fe:	75 0c                	jne    30c <printf+0xb6>
+        lflag = 1;
+ 300:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 307:	e9 fa 01 00 00       	jmp    506 <printf+0x2b0>
+      } else if(c == 'd'){
+ 30c:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 310:	0f 85 95 00 00 00    	jne    3ab <printf+0x155>
+        if (lflag == 1)
+ 316:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 31a:	75 49                	jne    365 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 31c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 31f:	83 f8 2f             	cmp    $0x2f,%eax
+ 322:	77 17                	ja     33b <printf+0xe5>
+ 324:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 328:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 32b:	89 d2                	mov    %edx,%edx
+ 32d:	48 01 d0             	add    %rdx,%rax
+ 330:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 333:	83 c2 08             	add    $0x8,%edx
+ 336:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 339:	eb 0c                	jmp    347 <printf+0xf1>
+ 33b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 33f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 343:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 347:	48 8b 00             	mov    (%rax),%rax
+ 34a:	89 c6                	mov    %eax,%esi
+ 34c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 34f:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 354:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 359:	89 c7                	mov    %eax,%edi
+ 35b:	e8 5d fd ff ff       	call   bd <printint64>
+ 360:	e9 9a 01 00 00       	jmp    4ff <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 365:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 368:	83 f8 2f             	cmp    $0x2f,%eax
+ 36b:	77 17                	ja     384 <printf+0x12e>
+ 36d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 371:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 374:	89 d2                	mov    %edx,%edx
+ 376:	48 01 d0             	add    %rdx,%rax
+ 379:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 37c:	83 c2 08             	add    $0x8,%edx
+ 37f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 382:	eb 0c                	jmp    390 <printf+0x13a>
+ 384:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 388:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 38c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 390:	8b 30                	mov    (%rax),%esi
+ 392:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 395:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 39a:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 39f:	89 c7                	mov    %eax,%edi
+ 3a1:	e8 eb fd ff ff       	call   191 <printint>
+ 3a6:	e9 54 01 00 00       	jmp    4ff <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 3ab:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3af:	74 0a                	je     3bb <printf+0x165>
+ 3b1:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3b5:	0f 85 95 00 00 00    	jne    450 <printf+0x1fa>
+        if (lflag == 1)
+ 3bb:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3bf:	75 49                	jne    40a <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3c1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3c4:	83 f8 2f             	cmp    $0x2f,%eax
+ 3c7:	77 17                	ja     3e0 <printf+0x18a>
+ 3c9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3cd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3d0:	89 d2                	mov    %edx,%edx
+ 3d2:	48 01 d0             	add    %rdx,%rax
+ 3d5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3d8:	83 c2 08             	add    $0x8,%edx
+ 3db:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3de:	eb 0c                	jmp    3ec <printf+0x196>
+ 3e0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3e4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3e8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3ec:	48 8b 00             	mov    (%rax),%rax
+ 3ef:	89 c6                	mov    %eax,%esi
+ 3f1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 3f9:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3fe:	89 c7                	mov    %eax,%edi
+ 400:	e8 b8 fc ff ff       	call   bd <printint64>
+        if (lflag == 1)
+ 405:	e9 f5 00 00 00       	jmp    4ff <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 40a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 40d:	83 f8 2f             	cmp    $0x2f,%eax
+ 410:	77 17                	ja     429 <printf+0x1d3>
+ 412:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 416:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 419:	89 d2                	mov    %edx,%edx
+ 41b:	48 01 d0             	add    %rdx,%rax
+ 41e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 421:	83 c2 08             	add    $0x8,%edx
+ 424:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 427:	eb 0c                	jmp    435 <printf+0x1df>
+ 429:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 42d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 431:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 435:	8b 30                	mov    (%rax),%esi
+ 437:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 43a:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 43f:	ba 10 00 00 00       	mov    $0x10,%edx
+ 444:	89 c7                	mov    %eax,%edi
+ 446:	e8 46 fd ff ff       	call   191 <printint>
+        if (lflag == 1)
+ 44b:	e9 af 00 00 00       	jmp    4ff <printf+0x2a9>
+      } else if(c == 's'){
+ 450:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 454:	75 6e                	jne    4c4 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 456:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 459:	83 f8 2f             	cmp    $0x2f,%eax
+ 45c:	77 17                	ja     475 <printf+0x21f>
+ 45e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 462:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 465:	89 d2                	mov    %edx,%edx
+ 467:	48 01 d0             	add    %rdx,%rax
+ 46a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 46d:	83 c2 08             	add    $0x8,%edx
+ 470:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 473:	eb 0c                	jmp    481 <printf+0x22b>
+ 475:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 479:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 47d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 481:	48 8b 00             	mov    (%rax),%rax
+ 484:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 488:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 48d:	75 28                	jne    4b7 <printf+0x261>
+          s = "(null)";
+ 48f:	48 8d 05 ea 07 00 00 	lea    0x7ea(%rip),%rax        # c80 <malloc+0x1a8>
+ 496:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 49a:	eb 1b                	jmp    4b7 <printf+0x261>
+          putc(fd, *s);
+ 49c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4a0:	0f b6 00             	movzbl (%rax),%eax
+ 4a3:	0f be d0             	movsbl %al,%edx
+ 4a6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4a9:	89 d6                	mov    %edx,%esi
+ 4ab:	89 c7                	mov    %eax,%edi
+ 4ad:	e8 e2 fb ff ff       	call   94 <putc>
+        for(; *s; s++)
+ 4b2:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4bb:	0f b6 00             	movzbl (%rax),%eax
+ 4be:	84 c0                	test   %al,%al
+ 4c0:	75 da                	jne    49c <printf+0x246>
+ 4c2:	eb 3b                	jmp    4ff <printf+0x2a9>
+      } else if(c == '%'){
+ 4c4:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4c8:	75 14                	jne    4de <printf+0x288>
+        putc(fd, c);
+ 4ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4cd:	0f be d0             	movsbl %al,%edx
+ 4d0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4d3:	89 d6                	mov    %edx,%esi
+ 4d5:	89 c7                	mov    %eax,%edi
+ 4d7:	e8 b8 fb ff ff       	call   94 <putc>
+ 4dc:	eb 21                	jmp    4ff <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4de:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4e1:	be 25 00 00 00       	mov    $0x25,%esi
+ 4e6:	89 c7                	mov    %eax,%edi
+ 4e8:	e8 a7 fb ff ff       	call   94 <putc>
+        putc(fd, c);
+ 4ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4f0:	0f be d0             	movsbl %al,%edx
+ 4f3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f6:	89 d6                	mov    %edx,%esi
+ 4f8:	89 c7                	mov    %eax,%edi
+ 4fa:	e8 95 fb ff ff       	call   94 <putc>
+      }
+      state = 0;
+ 4ff:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 506:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 50a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 50d:	48 63 d0             	movslq %eax,%rdx
+ 510:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 514:	48 01 d0             	add    %rdx,%rax
+ 517:	0f b6 00             	movzbl (%rax),%eax
+ 51a:	84 c0                	test   %al,%al
+ 51c:	0f 85 7d fd ff ff    	jne    29f <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 522:	90                   	nop
+ 523:	90                   	nop
+ 524:	c9                   	leave
+ 525:	c3                   	ret
+
+0000000000000526 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 526:	55                   	push   %rbp
+ 527:	48 89 e5             	mov    %rsp,%rbp
+ 52a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 52e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 531:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 534:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 538:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 53b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 53e:	48 89 ce             	mov    %rcx,%rsi
+ 541:	48 89 f7             	mov    %rsi,%rdi
+ 544:	89 d1                	mov    %edx,%ecx
+ 546:	fc                   	cld
+ 547:	f3 aa                	rep stos %al,%es:(%rdi)
+ 549:	89 ca                	mov    %ecx,%edx
+ 54b:	48 89 fe             	mov    %rdi,%rsi
+ 54e:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 552:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 555:	90                   	nop
+ 556:	5d                   	pop    %rbp
+ 557:	c3                   	ret
+
+0000000000000558 <strcpy>:
+{
+ 558:	55                   	push   %rbp
+ 559:	48 89 e5             	mov    %rsp,%rbp
+ 55c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 560:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 568:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 56c:	90                   	nop
+ 56d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 571:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 575:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 579:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 57d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 581:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 585:	0f b6 12             	movzbl (%rdx),%edx
+ 588:	88 10                	mov    %dl,(%rax)
+ 58a:	0f b6 00             	movzbl (%rax),%eax
+ 58d:	84 c0                	test   %al,%al
+ 58f:	75 dc                	jne    56d <strcpy+0x15>
+  return os;
+ 591:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 595:	5d                   	pop    %rbp
+ 596:	c3                   	ret
+
+0000000000000597 <strcmp>:
+{
+ 597:	55                   	push   %rbp
+ 598:	48 89 e5             	mov    %rsp,%rbp
+ 59b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 59f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5a3:	eb 0a                	jmp    5af <strcmp+0x18>
+    p++, q++;
+ 5a5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5aa:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5b3:	0f b6 00             	movzbl (%rax),%eax
+ 5b6:	84 c0                	test   %al,%al
+ 5b8:	74 12                	je     5cc <strcmp+0x35>
+ 5ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5be:	0f b6 10             	movzbl (%rax),%edx
+ 5c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5c5:	0f b6 00             	movzbl (%rax),%eax
+ 5c8:	38 c2                	cmp    %al,%dl
+ 5ca:	74 d9                	je     5a5 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5d0:	0f b6 00             	movzbl (%rax),%eax
+ 5d3:	0f b6 d0             	movzbl %al,%edx
+ 5d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5da:	0f b6 00             	movzbl (%rax),%eax
+ 5dd:	0f b6 c0             	movzbl %al,%eax
+ 5e0:	29 c2                	sub    %eax,%edx
+ 5e2:	89 d0                	mov    %edx,%eax
+}
+ 5e4:	5d                   	pop    %rbp
+ 5e5:	c3                   	ret
+
+00000000000005e6 <strlen>:
+{
+ 5e6:	55                   	push   %rbp
+ 5e7:	48 89 e5             	mov    %rsp,%rbp
+ 5ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 5ee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 5f5:	eb 04                	jmp    5fb <strlen+0x15>
+ 5f7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 5fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 5fe:	48 63 d0             	movslq %eax,%rdx
+ 601:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 605:	48 01 d0             	add    %rdx,%rax
+ 608:	0f b6 00             	movzbl (%rax),%eax
+ 60b:	84 c0                	test   %al,%al
+ 60d:	75 e8                	jne    5f7 <strlen+0x11>
+  return n;
+ 60f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 612:	5d                   	pop    %rbp
+ 613:	c3                   	ret
+
+0000000000000614 <memset>:
+{
+ 614:	55                   	push   %rbp
+ 615:	48 89 e5             	mov    %rsp,%rbp
+ 618:	48 83 ec 10          	sub    $0x10,%rsp
+ 61c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 620:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 623:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 626:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 629:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 62c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 630:	89 ce                	mov    %ecx,%esi
+ 632:	48 89 c7             	mov    %rax,%rdi
+ 635:	e8 ec fe ff ff       	call   526 <stosb>
+  return dst;
+ 63a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 63e:	c9                   	leave
+ 63f:	c3                   	ret
+
+0000000000000640 <strchr>:
+{
+ 640:	55                   	push   %rbp
+ 641:	48 89 e5             	mov    %rsp,%rbp
+ 644:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 648:	89 f0                	mov    %esi,%eax
+ 64a:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 64d:	eb 17                	jmp    666 <strchr+0x26>
+    if(*s == c)
+ 64f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 653:	0f b6 00             	movzbl (%rax),%eax
+ 656:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 659:	75 06                	jne    661 <strchr+0x21>
+      return (char*)s;
+ 65b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 65f:	eb 15                	jmp    676 <strchr+0x36>
+  for(; *s; s++)
+ 661:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 66a:	0f b6 00             	movzbl (%rax),%eax
+ 66d:	84 c0                	test   %al,%al
+ 66f:	75 de                	jne    64f <strchr+0xf>
+  return 0;
+ 671:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 676:	5d                   	pop    %rbp
+ 677:	c3                   	ret
+
+0000000000000678 <gets>:
+gets(char *buf, int max)
+{
+ 678:	55                   	push   %rbp
+ 679:	48 89 e5             	mov    %rsp,%rbp
+ 67c:	48 83 ec 20          	sub    $0x20,%rsp
+ 680:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 684:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 687:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 68e:	eb 48                	jmp    6d8 <gets+0x60>
+    cc = read(0, &c, 1);
+ 690:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 694:	ba 01 00 00 00       	mov    $0x1,%edx
+ 699:	48 89 c6             	mov    %rax,%rsi
+ 69c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6a1:	e8 6f 01 00 00       	call   815 <read>
+ 6a6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 6a9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6ad:	7e 36                	jle    6e5 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 6af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6b2:	8d 50 01             	lea    0x1(%rax),%edx
+ 6b5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6b8:	48 63 d0             	movslq %eax,%rdx
+ 6bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6bf:	48 01 c2             	add    %rax,%rdx
+ 6c2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6c6:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 6c8:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6cc:	3c 0a                	cmp    $0xa,%al
+ 6ce:	74 16                	je     6e6 <gets+0x6e>
+ 6d0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6d4:	3c 0d                	cmp    $0xd,%al
+ 6d6:	74 0e                	je     6e6 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 6d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6db:	83 c0 01             	add    $0x1,%eax
+ 6de:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6e1:	7f ad                	jg     690 <gets+0x18>
+ 6e3:	eb 01                	jmp    6e6 <gets+0x6e>
+      break;
+ 6e5:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 6e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6e9:	48 63 d0             	movslq %eax,%rdx
+ 6ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6f0:	48 01 d0             	add    %rdx,%rax
+ 6f3:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 6f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 6fa:	c9                   	leave
+ 6fb:	c3                   	ret
+
+00000000000006fc <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 6fc:	55                   	push   %rbp
+ 6fd:	48 89 e5             	mov    %rsp,%rbp
+ 700:	48 83 ec 20          	sub    $0x20,%rsp
+ 704:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 708:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 70c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 710:	be 00 00 00 00       	mov    $0x0,%esi
+ 715:	48 89 c7             	mov    %rax,%rdi
+ 718:	e8 20 01 00 00       	call   83d <open>
+ 71d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 720:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 724:	79 07                	jns    72d <stat+0x31>
+    return -1;
+ 726:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 72b:	eb 21                	jmp    74e <stat+0x52>
+  r = fstat(fd, st);
+ 72d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 731:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 734:	48 89 d6             	mov    %rdx,%rsi
+ 737:	89 c7                	mov    %eax,%edi
+ 739:	e8 17 01 00 00       	call   855 <fstat>
+ 73e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 741:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 744:	89 c7                	mov    %eax,%edi
+ 746:	e8 da 00 00 00       	call   825 <close>
+  return r;
+ 74b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 74e:	c9                   	leave
+ 74f:	c3                   	ret
+
+0000000000000750 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 750:	55                   	push   %rbp
+ 751:	48 89 e5             	mov    %rsp,%rbp
+ 754:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 758:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 75f:	eb 28                	jmp    789 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 761:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 764:	89 d0                	mov    %edx,%eax
+ 766:	c1 e0 02             	shl    $0x2,%eax
+ 769:	01 d0                	add    %edx,%eax
+ 76b:	01 c0                	add    %eax,%eax
+ 76d:	89 c1                	mov    %eax,%ecx
+ 76f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 773:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 777:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 77b:	0f b6 00             	movzbl (%rax),%eax
+ 77e:	0f be c0             	movsbl %al,%eax
+ 781:	01 c8                	add    %ecx,%eax
+ 783:	83 e8 30             	sub    $0x30,%eax
+ 786:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78d:	0f b6 00             	movzbl (%rax),%eax
+ 790:	3c 2f                	cmp    $0x2f,%al
+ 792:	7e 0b                	jle    79f <atoi+0x4f>
+ 794:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 798:	0f b6 00             	movzbl (%rax),%eax
+ 79b:	3c 39                	cmp    $0x39,%al
+ 79d:	7e c2                	jle    761 <atoi+0x11>
+  return n;
+ 79f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7a2:	5d                   	pop    %rbp
+ 7a3:	c3                   	ret
+
+00000000000007a4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 7a4:	55                   	push   %rbp
+ 7a5:	48 89 e5             	mov    %rsp,%rbp
+ 7a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7b0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 7c3:	eb 1d                	jmp    7e2 <memmove+0x3e>
+    *dst++ = *src++;
+ 7c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7c9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7cd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7d5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7d9:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7dd:	0f b6 12             	movzbl (%rdx),%edx
+ 7e0:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 7e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7e5:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7e8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7eb:	85 c0                	test   %eax,%eax
+ 7ed:	7f d6                	jg     7c5 <memmove+0x21>
+  return vdst;
+ 7ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7f3:	5d                   	pop    %rbp
+ 7f4:	c3                   	ret
+
+00000000000007f5 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 7f5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7fa:	cd 40                	int    $0x40
+ 7fc:	c3                   	ret
+
+00000000000007fd <exit>:
+SYSCALL(exit)
+ 7fd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 802:	cd 40                	int    $0x40
+ 804:	c3                   	ret
+
+0000000000000805 <wait>:
+SYSCALL(wait)
+ 805:	b8 03 00 00 00       	mov    $0x3,%eax
+ 80a:	cd 40                	int    $0x40
+ 80c:	c3                   	ret
+
+000000000000080d <pipe>:
+SYSCALL(pipe)
+ 80d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 812:	cd 40                	int    $0x40
+ 814:	c3                   	ret
+
+0000000000000815 <read>:
+SYSCALL(read)
+ 815:	b8 05 00 00 00       	mov    $0x5,%eax
+ 81a:	cd 40                	int    $0x40
+ 81c:	c3                   	ret
+
+000000000000081d <write>:
+SYSCALL(write)
+ 81d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 822:	cd 40                	int    $0x40
+ 824:	c3                   	ret
+
+0000000000000825 <close>:
+SYSCALL(close)
+ 825:	b8 15 00 00 00       	mov    $0x15,%eax
+ 82a:	cd 40                	int    $0x40
+ 82c:	c3                   	ret
+
+000000000000082d <kill>:
+SYSCALL(kill)
+ 82d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 832:	cd 40                	int    $0x40
+ 834:	c3                   	ret
+
+0000000000000835 <exec>:
+SYSCALL(exec)
+ 835:	b8 07 00 00 00       	mov    $0x7,%eax
+ 83a:	cd 40                	int    $0x40
+ 83c:	c3                   	ret
+
+000000000000083d <open>:
+SYSCALL(open)
+ 83d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 842:	cd 40                	int    $0x40
+ 844:	c3                   	ret
+
+0000000000000845 <mknod>:
+SYSCALL(mknod)
+ 845:	b8 11 00 00 00       	mov    $0x11,%eax
+ 84a:	cd 40                	int    $0x40
+ 84c:	c3                   	ret
+
+000000000000084d <unlink>:
+SYSCALL(unlink)
+ 84d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 852:	cd 40                	int    $0x40
+ 854:	c3                   	ret
+
+0000000000000855 <fstat>:
+SYSCALL(fstat)
+ 855:	b8 08 00 00 00       	mov    $0x8,%eax
+ 85a:	cd 40                	int    $0x40
+ 85c:	c3                   	ret
+
+000000000000085d <link>:
+SYSCALL(link)
+ 85d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 862:	cd 40                	int    $0x40
+ 864:	c3                   	ret
+
+0000000000000865 <mkdir>:
+SYSCALL(mkdir)
+ 865:	b8 14 00 00 00       	mov    $0x14,%eax
+ 86a:	cd 40                	int    $0x40
+ 86c:	c3                   	ret
+
+000000000000086d <chdir>:
+SYSCALL(chdir)
+ 86d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 872:	cd 40                	int    $0x40
+ 874:	c3                   	ret
+
+0000000000000875 <dup>:
+SYSCALL(dup)
+ 875:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 87a:	cd 40                	int    $0x40
+ 87c:	c3                   	ret
+
+000000000000087d <getpid>:
+SYSCALL(getpid)
+ 87d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 882:	cd 40                	int    $0x40
+ 884:	c3                   	ret
+
+0000000000000885 <sbrk>:
+SYSCALL(sbrk)
+ 885:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 88a:	cd 40                	int    $0x40
+ 88c:	c3                   	ret
+
+000000000000088d <sleep>:
+SYSCALL(sleep)
+ 88d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 892:	cd 40                	int    $0x40
+ 894:	c3                   	ret
+
+0000000000000895 <uptime>:
+SYSCALL(uptime)
+ 895:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 89a:	cd 40                	int    $0x40
+ 89c:	c3                   	ret
+
+000000000000089d <sysinfo>:
+SYSCALL(sysinfo)
+ 89d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8a2:	cd 40                	int    $0x40
+ 8a4:	c3                   	ret
+
+00000000000008a5 <mmap>:
+SYSCALL(mmap)
+ 8a5:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8aa:	cd 40                	int    $0x40
+ 8ac:	c3                   	ret
+
+00000000000008ad <munmap>:
+SYSCALL(munmap)
+ 8ad:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8b2:	cd 40                	int    $0x40
+ 8b4:	c3                   	ret
+
+00000000000008b5 <crashn>:
+SYSCALL(crashn)
+ 8b5:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8ba:	cd 40                	int    $0x40
+ 8bc:	c3                   	ret
+
+00000000000008bd <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 8bd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8c2:	cd 40                	int    $0x40
+ 8c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c7:	74 02                	je     8cb <mmap2+0xe>
+ 8c9:	89 c0                	mov    %eax,%eax
+ 8cb:	c3                   	ret
+
+00000000000008cc <munmap2>:
+SYSCALL(munmap2)
+ 8cc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+00000000000008d4 <msync>:
+SYSCALL(msync)
+ 8d4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8d9:	cd 40                	int    $0x40
+ 8db:	c3                   	ret
+
+00000000000008dc <sendfile>:
+SYSCALL(sendfile)
+ 8dc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8e1:	cd 40                	int    $0x40
+ 8e3:	c3                   	ret
+
+00000000000008e4 <splice>:
+SYSCALL(splice)
+ 8e4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8e9:	cd 40                	int    $0x40
+ 8eb:	c3                   	ret
+
+00000000000008ec <pread>:
+SYSCALL(pread)
+ 8ec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8f1:	cd 40                	int    $0x40
+ 8f3:	c3                   	ret
+
+00000000000008f4 <pwrite>:
+SYSCALL(pwrite)
+ 8f4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8f9:	cd 40                	int    $0x40
+ 8fb:	c3                   	ret
+
+00000000000008fc <readv>:
+SYSCALL(readv)
+ 8fc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 901:	cd 40                	int    $0x40
+ 903:	c3                   	ret
+
+0000000000000904 <writev>:
+SYSCALL(writev)
+ 904:	b8 22 00 00 00       	mov    $0x22,%eax
+ 909:	cd 40                	int    $0x40
+ 90b:	c3                   	ret
+
+000000000000090c <poll>:
+SYSCALL(poll)
+ 90c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 911:	cd 40                	int    $0x40
+ 913:	c3                   	ret
+
+0000000000000914 <pipe2>:
+SYSCALL(pipe2)
+ 914:	b8 24 00 00 00       	mov    $0x24,%eax
+ 919:	cd 40                	int    $0x40
+ 91b:	c3                   	ret
+
+000000000000091c <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ 91c:	55                   	push   %rbp
+ 91d:	48 89 e5             	mov    %rsp,%rbp
+ 920:	48 83 ec 20          	sub    $0x20,%rsp
+ 924:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 92c:	48 83 e8 10          	sub    $0x10,%rax
+ 930:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ 934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 938:	48 8b 10             	mov    (%rax),%rdx
+ 93b:	48 8d 05 0e 06 00 00 	lea    0x60e(%rip),%rax        # f50 <bigblock>
+ 942:	48 39 c2             	cmp    %rax,%rdx
+ 945:	75 1f                	jne    966 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ 947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 94b:	8b 40 08             	mov    0x8(%rax),%eax
+ 94e:	c1 e0 04             	shl    $0x4,%eax
+ 951:	89 c2                	mov    %eax,%edx
+ 953:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 957:	89 d6                	mov    %edx,%esi
+ 959:	48 89 c7             	mov    %rax,%rdi
+ 95c:	e8 6b ff ff ff       	call   8cc <munmap2>
+    return;
+ 961:	e9 0b 01 00 00       	jmp    a71 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 966:	48 8b 05 d3 05 00 00 	mov    0x5d3(%rip),%rax        # f40 <freep>
+ 96d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 971:	eb 2f                	jmp    9a2 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 973:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 977:	48 8b 00             	mov    (%rax),%rax
+ 97a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 97e:	72 17                	jb     997 <free+0x7b>
+ 980:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 984:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 988:	72 2f                	jb     9b9 <free+0x9d>
+ 98a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 98e:	48 8b 00             	mov    (%rax),%rax
+ 991:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 995:	72 22                	jb     9b9 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 997:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 99b:	48 8b 00             	mov    (%rax),%rax
+ 99e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9a6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9aa:	73 c7                	jae    973 <free+0x57>
+ 9ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b0:	48 8b 00             	mov    (%rax),%rax
+ 9b3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9b7:	73 ba                	jae    973 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9bd:	8b 40 08             	mov    0x8(%rax),%eax
+ 9c0:	89 c0                	mov    %eax,%eax
+ 9c2:	48 c1 e0 04          	shl    $0x4,%rax
+ 9c6:	48 89 c2             	mov    %rax,%rdx
+ 9c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9cd:	48 01 c2             	add    %rax,%rdx
+ 9d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d4:	48 8b 00             	mov    (%rax),%rax
+ 9d7:	48 39 c2             	cmp    %rax,%rdx
+ 9da:	75 2d                	jne    a09 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ 9dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9e0:	8b 50 08             	mov    0x8(%rax),%edx
+ 9e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9e7:	48 8b 00             	mov    (%rax),%rax
+ 9ea:	8b 40 08             	mov    0x8(%rax),%eax
+ 9ed:	01 c2                	add    %eax,%edx
+ 9ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f3:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9fa:	48 8b 00             	mov    (%rax),%rax
+ 9fd:	48 8b 10             	mov    (%rax),%rdx
+ a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a04:	48 89 10             	mov    %rdx,(%rax)
+ a07:	eb 0e                	jmp    a17 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a0d:	48 8b 10             	mov    (%rax),%rdx
+ a10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a14:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ a17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a1b:	8b 40 08             	mov    0x8(%rax),%eax
+ a1e:	89 c0                	mov    %eax,%eax
+ a20:	48 c1 e0 04          	shl    $0x4,%rax
+ a24:	48 89 c2             	mov    %rax,%rdx
+ a27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a2b:	48 01 d0             	add    %rdx,%rax
+ a2e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a32:	75 27                	jne    a5b <free+0x13f>
+    p->s.size += bp->s.size;
+ a34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a38:	8b 50 08             	mov    0x8(%rax),%edx
+ a3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a3f:	8b 40 08             	mov    0x8(%rax),%eax
+ a42:	01 c2                	add    %eax,%edx
+ a44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a48:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a4f:	48 8b 10             	mov    (%rax),%rdx
+ a52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a56:	48 89 10             	mov    %rdx,(%rax)
+ a59:	eb 0b                	jmp    a66 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a63:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6a:	48 89 05 cf 04 00 00 	mov    %rax,0x4cf(%rip)        # f40 <freep>
+}
+ a71:	c9                   	leave
+ a72:	c3                   	ret
+
+0000000000000a73 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a73:	55                   	push   %rbp
+ a74:	48 89 e5             	mov    %rsp,%rbp
+ a77:	48 83 ec 20          	sub    $0x20,%rsp
+ a7b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a7e:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a85:	77 07                	ja     a8e <morecore+0x1b>
+    nu = 4096;
+ a87:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ a91:	c1 e0 04             	shl    $0x4,%eax
+ a94:	89 c7                	mov    %eax,%edi
+ a96:	e8 ea fd ff ff       	call   885 <sbrk>
+ a9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ a9f:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ aa4:	75 07                	jne    aad <morecore+0x3a>
+    return 0;
+ aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+ aab:	eb 29                	jmp    ad6 <morecore+0x63>
+  hp = (Header*)p;
+ aad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ab1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ab5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ab9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ abc:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ abf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ac3:	48 83 c0 10          	add    $0x10,%rax
+ ac7:	48 89 c7             	mov    %rax,%rdi
+ aca:	e8 4d fe ff ff       	call   91c <free>
+  return freep;
+ acf:	48 8b 05 6a 04 00 00 	mov    0x46a(%rip),%rax        # f40 <freep>
+}
+ ad6:	c9                   	leave
+ ad7:	c3                   	ret
+
+0000000000000ad8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ad8:	55                   	push   %rbp
+ ad9:	48 89 e5             	mov    %rsp,%rbp
+ adc:	48 83 ec 30          	sub    $0x30,%rsp
+ ae0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ae3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ ae6:	48 83 c0 0f          	add    $0xf,%rax
+ aea:	48 c1 e8 04          	shr    $0x4,%rax
+ aee:	83 c0 01             	add    $0x1,%eax
+ af1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ af4:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ afb:	76 62                	jbe    b5f <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ afd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b00:	c1 e0 04             	shl    $0x4,%eax
+ b03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ b09:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ b0f:	b9 22 00 00 00       	mov    $0x22,%ecx
+ b14:	ba 03 00 00 00       	mov    $0x3,%edx
+ b19:	89 c6                	mov    %eax,%esi
+ b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+ b20:	e8 98 fd ff ff       	call   8bd <mmap2>
+ b25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ b29:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b2e:	75 0a                	jne    b3a <malloc+0x62>
+      return 0;
+ b30:	b8 00 00 00 00       	mov    $0x0,%eax
+ b35:	e9 1c 01 00 00       	jmp    c56 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ b3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b3e:	48 8d 15 0b 04 00 00 	lea    0x40b(%rip),%rdx        # f50 <bigblock>
+ b45:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b4f:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ b52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b56:	48 83 c0 10          	add    $0x10,%rax
+ b5a:	e9 f7 00 00 00       	jmp    c56 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ b5f:	48 8b 05 da 03 00 00 	mov    0x3da(%rip),%rax        # f40 <freep>
+ b66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b6a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b6f:	75 2e                	jne    b9f <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ b71:	48 8d 05 b8 03 00 00 	lea    0x3b8(%rip),%rax        # f30 <base>
+ b78:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b80:	48 89 05 b9 03 00 00 	mov    %rax,0x3b9(%rip)        # f40 <freep>
+ b87:	48 8b 05 b2 03 00 00 	mov    0x3b2(%rip),%rax        # f40 <freep>
+ b8e:	48 89 05 9b 03 00 00 	mov    %rax,0x39b(%rip)        # f30 <base>
+    base.s.size = 0;
+ b95:	c7 05 99 03 00 00 00 	movl   $0x0,0x399(%rip)        # f38 <base+0x8>
+ b9c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba3:	48 8b 00             	mov    (%rax),%rax
+ ba6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ baa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bae:	8b 40 08             	mov    0x8(%rax),%eax
+ bb1:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ bb4:	72 5f                	jb     c15 <malloc+0x13d>
+      if(p->s.size == nunits)
+ bb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bba:	8b 40 08             	mov    0x8(%rax),%eax
+ bbd:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ bc0:	75 10                	jne    bd2 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ bc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc6:	48 8b 10             	mov    (%rax),%rdx
+ bc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bcd:	48 89 10             	mov    %rdx,(%rax)
+ bd0:	eb 2e                	jmp    c00 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd6:	8b 40 08             	mov    0x8(%rax),%eax
+ bd9:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ bdc:	89 c2                	mov    %eax,%edx
+ bde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be2:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ be5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be9:	8b 40 08             	mov    0x8(%rax),%eax
+ bec:	89 c0                	mov    %eax,%eax
+ bee:	48 c1 e0 04          	shl    $0x4,%rax
+ bf2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ bf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bfa:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bfd:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ c00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c04:	48 89 05 35 03 00 00 	mov    %rax,0x335(%rip)        # f40 <freep>
+      return (void*)(p + 1);
+ c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0f:	48 83 c0 10          	add    $0x10,%rax
+ c13:	eb 41                	jmp    c56 <malloc+0x17e>
+    }
+    if(p == freep)
+ c15:	48 8b 05 24 03 00 00 	mov    0x324(%rip),%rax        # f40 <freep>
+ c1c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c20:	75 1c                	jne    c3e <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ c22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c25:	89 c7                	mov    %eax,%edi
+ c27:	e8 47 fe ff ff       	call   a73 <morecore>
+ c2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c30:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ c35:	75 07                	jne    c3e <malloc+0x166>
+        return 0;
+ c37:	b8 00 00 00 00       	mov    $0x0,%eax
+ c3c:	eb 18                	jmp    c56 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c4a:	48 8b 00             	mov    (%rax),%rax
+ c4d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ c51:	e9 54 ff ff ff       	jmp    baa <malloc+0xd2>
+  }
+}
+ c56:	c9                   	leave
+ c57:	c3                   	ret
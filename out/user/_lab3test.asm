@@ -0,0 +1,2988 @@
+
+out/user/_lab3test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+void growstacktest(void);
+void copyonwriteforktest(void);
+
+int
+main(int argc, char *argv[])
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+       8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+       b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  memtest();
+       f:	e8 35 00 00 00       	call   49 <memtest>
+  sbrktest();
+      14:	e8 8c 01 00 00       	call   1a5 <sbrktest>
+  mmaptest();
+      19:	e8 d8 09 00 00       	call   9f6 <mmaptest>
+  growstacktest();
+      1e:	e8 7c 0e 00 00       	call   e9f <growstacktest>
+  copyonwriteforktest();
+      23:	e8 83 10 00 00       	call   10ab <copyonwriteforktest>
+
+  printf(stdout, "lab3 tests passed!!\n");
+      28:	8b 05 f2 28 00 00    	mov    0x28f2(%rip),%eax        # 2920 <stdout>
+      2e:	48 8d 15 9b 1f 00 00 	lea    0x1f9b(%rip),%rdx        # 1fd0 <malloc+0x187>
+      35:	48 89 d6             	mov    %rdx,%rsi
+      38:	89 c7                	mov    %eax,%edi
+      3a:	b8 00 00 00 00       	mov    $0x0,%eax
+      3f:	e8 83 15 00 00       	call   15c7 <printf>
+
+  exit();
+      44:	e8 25 1b 00 00       	call   1b6e <exit>
+
+0000000000000049 <memtest>:
+  return 0;
+}
+
+void memtest()
+{
+      49:	55                   	push   %rbp
+      4a:	48 89 e5             	mov    %rsp,%rbp
+      4d:	48 83 ec 20          	sub    $0x20,%rsp
+  void *m1, *m2;
+  int pid;
+  int i;
+
+  printf(stdout, "memtest\n");
+      51:	8b 05 c9 28 00 00    	mov    0x28c9(%rip),%eax        # 2920 <stdout>
+      57:	48 8d 15 87 1f 00 00 	lea    0x1f87(%rip),%rdx        # 1fe5 <malloc+0x19c>
+      5e:	48 89 d6             	mov    %rdx,%rsi
+      61:	89 c7                	mov    %eax,%edi
+      63:	b8 00 00 00 00       	mov    $0x0,%eax
+      68:	e8 5a 15 00 00       	call   15c7 <printf>
+  if((pid = fork()) == 0){
+      6d:	e8 f4 1a 00 00       	call   1b66 <fork>
+      72:	89 45 f0             	mov    %eax,-0x10(%rbp)
+      75:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+      79:	0f 85 02 01 00 00    	jne    181 <memtest+0x138>
+    m1 = 0;
+      7f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+      86:	00 
+    for (i=0;i<10;i++) {
+      87:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      8e:	eb 25                	jmp    b5 <memtest+0x6c>
+      m2 = malloc(10001);
+      90:	bf 11 27 00 00       	mov    $0x2711,%edi
+      95:	e8 af 1d 00 00       	call   1e49 <malloc>
+      9a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      *(char**)m2 = m1;
+      9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+      a6:	48 89 10             	mov    %rdx,(%rax)
+      m1 = m2;
+      a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    for (i=0;i<10;i++) {
+      b1:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+      b5:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+      b9:	7e d5                	jle    90 <memtest+0x47>
+    }
+    while(m1){
+      bb:	eb 1f                	jmp    dc <memtest+0x93>
+      m2 = *(char**)m1;
+      bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      c1:	48 8b 00             	mov    (%rax),%rax
+      c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      free(m1);
+      c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+      cc:	48 89 c7             	mov    %rax,%rdi
+      cf:	e8 b9 1b 00 00       	call   1c8d <free>
+      m1 = m2;
+      d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      d8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    while(m1){
+      dc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      e1:	75 da                	jne    bd <memtest+0x74>
+    }
+    m1 = malloc(1024*20);
+      e3:	bf 00 50 00 00       	mov    $0x5000,%edi
+      e8:	e8 5c 1d 00 00       	call   1e49 <malloc>
+      ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(m1 == 0){
+      f1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+      f6:	75 5c                	jne    154 <memtest+0x10b>
+      error("couldn't allocate mem?!!\n");
+      f8:	8b 05 22 28 00 00    	mov    0x2822(%rip),%eax        # 2920 <stdout>
+      fe:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     103:	48 8d 0d e4 1e 00 00 	lea    0x1ee4(%rip),%rcx        # 1fee <malloc+0x1a5>
+     10a:	48 89 ce             	mov    %rcx,%rsi
+     10d:	89 c7                	mov    %eax,%edi
+     10f:	b8 00 00 00 00       	mov    $0x0,%eax
+     114:	e8 ae 14 00 00       	call   15c7 <printf>
+     119:	8b 05 01 28 00 00    	mov    0x2801(%rip),%eax        # 2920 <stdout>
+     11f:	48 8d 15 da 1e 00 00 	lea    0x1eda(%rip),%rdx        # 2000 <malloc+0x1b7>
+     126:	48 89 d6             	mov    %rdx,%rsi
+     129:	89 c7                	mov    %eax,%edi
+     12b:	b8 00 00 00 00       	mov    $0x0,%eax
+     130:	e8 92 14 00 00       	call   15c7 <printf>
+     135:	8b 05 e5 27 00 00    	mov    0x27e5(%rip),%eax        # 2920 <stdout>
+     13b:	48 8d 15 d8 1e 00 00 	lea    0x1ed8(%rip),%rdx        # 201a <malloc+0x1d1>
+     142:	48 89 d6             	mov    %rdx,%rsi
+     145:	89 c7                	mov    %eax,%edi
+     147:	b8 00 00 00 00       	mov    $0x0,%eax
+     14c:	e8 76 14 00 00       	call   15c7 <printf>
+     151:	90                   	nop
+     152:	eb fd                	jmp    151 <memtest+0x108>
+    }
+    free(m1);
+     154:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     158:	48 89 c7             	mov    %rax,%rdi
+     15b:	e8 2d 1b 00 00       	call   1c8d <free>
+    printf(stdout, "mem ok\n");
+     160:	8b 05 ba 27 00 00    	mov    0x27ba(%rip),%eax        # 2920 <stdout>
+     166:	48 8d 15 af 1e 00 00 	lea    0x1eaf(%rip),%rdx        # 201c <malloc+0x1d3>
+     16d:	48 89 d6             	mov    %rdx,%rsi
+     170:	89 c7                	mov    %eax,%edi
+     172:	b8 00 00 00 00       	mov    $0x0,%eax
+     177:	e8 4b 14 00 00       	call   15c7 <printf>
+    exit();
+     17c:	e8 ed 19 00 00       	call   1b6e <exit>
+  } else {
+    wait();
+     181:	e8 f0 19 00 00       	call   1b76 <wait>
+  }
+  printf(stdout, "memtest passed\n");
+     186:	8b 05 94 27 00 00    	mov    0x2794(%rip),%eax        # 2920 <stdout>
+     18c:	48 8d 15 91 1e 00 00 	lea    0x1e91(%rip),%rdx        # 2024 <malloc+0x1db>
+     193:	48 89 d6             	mov    %rdx,%rsi
+     196:	89 c7                	mov    %eax,%edi
+     198:	b8 00 00 00 00       	mov    $0x0,%eax
+     19d:	e8 25 14 00 00       	call   15c7 <printf>
+}
+     1a2:	90                   	nop
+     1a3:	c9                   	leave
+     1a4:	c3                   	ret
+
+00000000000001a5 <sbrktest>:
+
+void
+sbrktest(void)
+{
+     1a5:	55                   	push   %rbp
+     1a6:	48 89 e5             	mov    %rsp,%rbp
+     1a9:	48 83 ec 70          	sub    $0x70,%rsp
+  int fds[2], pid, pids[7];
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint64_t amt;
+
+  printf(stdout, "sbrktest\n");
+     1ad:	8b 05 6d 27 00 00    	mov    0x276d(%rip),%eax        # 2920 <stdout>
+     1b3:	48 8d 15 7a 1e 00 00 	lea    0x1e7a(%rip),%rdx        # 2034 <malloc+0x1eb>
+     1ba:	48 89 d6             	mov    %rdx,%rsi
+     1bd:	89 c7                	mov    %eax,%edi
+     1bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c4:	e8 fe 13 00 00       	call   15c7 <printf>
+  oldbrk = sbrk(0);
+     1c9:	bf 00 00 00 00       	mov    $0x0,%edi
+     1ce:	e8 23 1a 00 00       	call   1bf6 <sbrk>
+     1d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+     1d7:	bf 00 00 00 00       	mov    $0x0,%edi
+     1dc:	e8 15 1a 00 00       	call   1bf6 <sbrk>
+     1e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  int i;
+  for(i = 0; i < 5000; i++){
+     1e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     1ec:	e9 96 00 00 00       	jmp    287 <sbrktest+0xe2>
+    b = sbrk(1);
+     1f1:	bf 01 00 00 00       	mov    $0x1,%edi
+     1f6:	e8 fb 19 00 00       	call   1bf6 <sbrk>
+     1fb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    if(b != a){
+     1ff:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     203:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     207:	74 67                	je     270 <sbrktest+0xcb>
+      error("sbrk test failed %d %x %x\n", i, a, b);
+     209:	8b 05 11 27 00 00    	mov    0x2711(%rip),%eax        # 2920 <stdout>
+     20f:	ba 59 00 00 00       	mov    $0x59,%edx
+     214:	48 8d 0d d3 1d 00 00 	lea    0x1dd3(%rip),%rcx        # 1fee <malloc+0x1a5>
+     21b:	48 89 ce             	mov    %rcx,%rsi
+     21e:	89 c7                	mov    %eax,%edi
+     220:	b8 00 00 00 00       	mov    $0x0,%eax
+     225:	e8 9d 13 00 00       	call   15c7 <printf>
+     22a:	8b 05 f0 26 00 00    	mov    0x26f0(%rip),%eax        # 2920 <stdout>
+     230:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+     234:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     238:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     23b:	49 89 f0             	mov    %rsi,%r8
+     23e:	48 8d 35 f9 1d 00 00 	lea    0x1df9(%rip),%rsi        # 203e <malloc+0x1f5>
+     245:	89 c7                	mov    %eax,%edi
+     247:	b8 00 00 00 00       	mov    $0x0,%eax
+     24c:	e8 76 13 00 00       	call   15c7 <printf>
+     251:	8b 05 c9 26 00 00    	mov    0x26c9(%rip),%eax        # 2920 <stdout>
+     257:	48 8d 15 bc 1d 00 00 	lea    0x1dbc(%rip),%rdx        # 201a <malloc+0x1d1>
+     25e:	48 89 d6             	mov    %rdx,%rsi
+     261:	89 c7                	mov    %eax,%edi
+     263:	b8 00 00 00 00       	mov    $0x0,%eax
+     268:	e8 5a 13 00 00       	call   15c7 <printf>
+     26d:	90                   	nop
+     26e:	eb fd                	jmp    26d <sbrktest+0xc8>
+    }
+    *b = 1;
+     270:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     274:	c6 00 01             	movb   $0x1,(%rax)
+    a = b + 1;
+     277:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+     27b:	48 83 c0 01          	add    $0x1,%rax
+     27f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for(i = 0; i < 5000; i++){
+     283:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     287:	81 7d f4 87 13 00 00 	cmpl   $0x1387,-0xc(%rbp)
+     28e:	0f 8e 5d ff ff ff    	jle    1f1 <sbrktest+0x4c>
+  }
+  pid = fork();
+     294:	e8 cd 18 00 00       	call   1b66 <fork>
+     299:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if(pid < 0){
+     29c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     2a0:	79 5c                	jns    2fe <sbrktest+0x159>
+    error("sbrk test fork failed\n");
+     2a2:	8b 05 78 26 00 00    	mov    0x2678(%rip),%eax        # 2920 <stdout>
+     2a8:	ba 60 00 00 00       	mov    $0x60,%edx
+     2ad:	48 8d 0d 3a 1d 00 00 	lea    0x1d3a(%rip),%rcx        # 1fee <malloc+0x1a5>
+     2b4:	48 89 ce             	mov    %rcx,%rsi
+     2b7:	89 c7                	mov    %eax,%edi
+     2b9:	b8 00 00 00 00       	mov    $0x0,%eax
+     2be:	e8 04 13 00 00       	call   15c7 <printf>
+     2c3:	8b 05 57 26 00 00    	mov    0x2657(%rip),%eax        # 2920 <stdout>
+     2c9:	48 8d 15 89 1d 00 00 	lea    0x1d89(%rip),%rdx        # 2059 <malloc+0x210>
+     2d0:	48 89 d6             	mov    %rdx,%rsi
+     2d3:	89 c7                	mov    %eax,%edi
+     2d5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2da:	e8 e8 12 00 00       	call   15c7 <printf>
+     2df:	8b 05 3b 26 00 00    	mov    0x263b(%rip),%eax        # 2920 <stdout>
+     2e5:	48 8d 15 2e 1d 00 00 	lea    0x1d2e(%rip),%rdx        # 201a <malloc+0x1d1>
+     2ec:	48 89 d6             	mov    %rdx,%rsi
+     2ef:	89 c7                	mov    %eax,%edi
+     2f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f6:	e8 cc 12 00 00       	call   15c7 <printf>
+     2fb:	90                   	nop
+     2fc:	eb fd                	jmp    2fb <sbrktest+0x156>
+  }
+  c = sbrk(1);
+     2fe:	bf 01 00 00 00       	mov    $0x1,%edi
+     303:	e8 ee 18 00 00       	call   1bf6 <sbrk>
+     308:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  c = sbrk(1);
+     30c:	bf 01 00 00 00       	mov    $0x1,%edi
+     311:	e8 e0 18 00 00       	call   1bf6 <sbrk>
+     316:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if(c != a + 1){
+     31a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     31e:	48 83 c0 01          	add    $0x1,%rax
+     322:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     326:	74 5c                	je     384 <sbrktest+0x1df>
+    error("sbrk test failed post-fork\n");
+     328:	8b 05 f2 25 00 00    	mov    0x25f2(%rip),%eax        # 2920 <stdout>
+     32e:	ba 65 00 00 00       	mov    $0x65,%edx
+     333:	48 8d 0d b4 1c 00 00 	lea    0x1cb4(%rip),%rcx        # 1fee <malloc+0x1a5>
+     33a:	48 89 ce             	mov    %rcx,%rsi
+     33d:	89 c7                	mov    %eax,%edi
+     33f:	b8 00 00 00 00       	mov    $0x0,%eax
+     344:	e8 7e 12 00 00       	call   15c7 <printf>
+     349:	8b 05 d1 25 00 00    	mov    0x25d1(%rip),%eax        # 2920 <stdout>
+     34f:	48 8d 15 1a 1d 00 00 	lea    0x1d1a(%rip),%rdx        # 2070 <malloc+0x227>
+     356:	48 89 d6             	mov    %rdx,%rsi
+     359:	89 c7                	mov    %eax,%edi
+     35b:	b8 00 00 00 00       	mov    $0x0,%eax
+     360:	e8 62 12 00 00       	call   15c7 <printf>
+     365:	8b 05 b5 25 00 00    	mov    0x25b5(%rip),%eax        # 2920 <stdout>
+     36b:	48 8d 15 a8 1c 00 00 	lea    0x1ca8(%rip),%rdx        # 201a <malloc+0x1d1>
+     372:	48 89 d6             	mov    %rdx,%rsi
+     375:	89 c7                	mov    %eax,%edi
+     377:	b8 00 00 00 00       	mov    $0x0,%eax
+     37c:	e8 46 12 00 00       	call   15c7 <printf>
+     381:	90                   	nop
+     382:	eb fd                	jmp    381 <sbrktest+0x1dc>
+  }
+  if(pid == 0)
+     384:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     388:	75 05                	jne    38f <sbrktest+0x1ea>
+    exit();
+     38a:	e8 df 17 00 00       	call   1b6e <exit>
+  wait();
+     38f:	e8 e2 17 00 00       	call   1b76 <wait>
+
+  // can one grow address space to something big?
+#define BIG (1*1024*1024)
+  a = sbrk(0);
+     394:	bf 00 00 00 00       	mov    $0x0,%edi
+     399:	e8 58 18 00 00       	call   1bf6 <sbrk>
+     39e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  amt = (BIG) - (uint64_t)a;
+     3a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3a6:	ba 00 00 10 00       	mov    $0x100000,%edx
+     3ab:	48 29 c2             	sub    %rax,%rdx
+     3ae:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  p = sbrk(amt);
+     3b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     3b6:	89 c7                	mov    %eax,%edi
+     3b8:	e8 39 18 00 00       	call   1bf6 <sbrk>
+     3bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (p != a) {
+     3c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     3c5:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     3c9:	74 5c                	je     427 <sbrktest+0x282>
+    error("sbrk test failed to grow big address space; enough phys mem?\n");
+     3cb:	8b 05 4f 25 00 00    	mov    0x254f(%rip),%eax        # 2920 <stdout>
+     3d1:	ba 71 00 00 00       	mov    $0x71,%edx
+     3d6:	48 8d 0d 11 1c 00 00 	lea    0x1c11(%rip),%rcx        # 1fee <malloc+0x1a5>
+     3dd:	48 89 ce             	mov    %rcx,%rsi
+     3e0:	89 c7                	mov    %eax,%edi
+     3e2:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e7:	e8 db 11 00 00       	call   15c7 <printf>
+     3ec:	8b 05 2e 25 00 00    	mov    0x252e(%rip),%eax        # 2920 <stdout>
+     3f2:	48 8d 15 97 1c 00 00 	lea    0x1c97(%rip),%rdx        # 2090 <malloc+0x247>
+     3f9:	48 89 d6             	mov    %rdx,%rsi
+     3fc:	89 c7                	mov    %eax,%edi
+     3fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     403:	e8 bf 11 00 00       	call   15c7 <printf>
+     408:	8b 05 12 25 00 00    	mov    0x2512(%rip),%eax        # 2920 <stdout>
+     40e:	48 8d 15 05 1c 00 00 	lea    0x1c05(%rip),%rdx        # 201a <malloc+0x1d1>
+     415:	48 89 d6             	mov    %rdx,%rsi
+     418:	89 c7                	mov    %eax,%edi
+     41a:	b8 00 00 00 00       	mov    $0x0,%eax
+     41f:	e8 a3 11 00 00       	call   15c7 <printf>
+     424:	90                   	nop
+     425:	eb fd                	jmp    424 <sbrktest+0x27f>
+  }
+  lastaddr = (char*) (BIG-1);
+     427:	48 c7 45 c0 ff ff 0f 	movq   $0xfffff,-0x40(%rbp)
+     42e:	00 
+  *lastaddr = 99;
+     42f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     433:	c6 00 63             	movb   $0x63,(%rax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+     436:	bf 00 00 00 00       	mov    $0x0,%edi
+     43b:	e8 b6 17 00 00       	call   1bf6 <sbrk>
+     440:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = sbrk(-4096);
+     444:	bf 00 f0 ff ff       	mov    $0xfffff000,%edi
+     449:	e8 a8 17 00 00       	call   1bf6 <sbrk>
+     44e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if(c == (char*)0xffffffff){
+     452:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     457:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     45b:	75 5c                	jne    4b9 <sbrktest+0x314>
+    error("sbrk could not deallocate\n");
+     45d:	8b 05 bd 24 00 00    	mov    0x24bd(%rip),%eax        # 2920 <stdout>
+     463:	ba 7a 00 00 00       	mov    $0x7a,%edx
+     468:	48 8d 0d 7f 1b 00 00 	lea    0x1b7f(%rip),%rcx        # 1fee <malloc+0x1a5>
+     46f:	48 89 ce             	mov    %rcx,%rsi
+     472:	89 c7                	mov    %eax,%edi
+     474:	b8 00 00 00 00       	mov    $0x0,%eax
+     479:	e8 49 11 00 00       	call   15c7 <printf>
+     47e:	8b 05 9c 24 00 00    	mov    0x249c(%rip),%eax        # 2920 <stdout>
+     484:	48 8d 15 43 1c 00 00 	lea    0x1c43(%rip),%rdx        # 20ce <malloc+0x285>
+     48b:	48 89 d6             	mov    %rdx,%rsi
+     48e:	89 c7                	mov    %eax,%edi
+     490:	b8 00 00 00 00       	mov    $0x0,%eax
+     495:	e8 2d 11 00 00       	call   15c7 <printf>
+     49a:	8b 05 80 24 00 00    	mov    0x2480(%rip),%eax        # 2920 <stdout>
+     4a0:	48 8d 15 73 1b 00 00 	lea    0x1b73(%rip),%rdx        # 201a <malloc+0x1d1>
+     4a7:	48 89 d6             	mov    %rdx,%rsi
+     4aa:	89 c7                	mov    %eax,%edi
+     4ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b1:	e8 11 11 00 00       	call   15c7 <printf>
+     4b6:	90                   	nop
+     4b7:	eb fd                	jmp    4b6 <sbrktest+0x311>
+  }
+  c = sbrk(0);
+     4b9:	bf 00 00 00 00       	mov    $0x0,%edi
+     4be:	e8 33 17 00 00       	call   1bf6 <sbrk>
+     4c3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if(c != a - 4096){
+     4c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4cb:	48 2d 00 10 00 00    	sub    $0x1000,%rax
+     4d1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     4d5:	74 61                	je     538 <sbrktest+0x393>
+    error("sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+     4d7:	8b 05 43 24 00 00    	mov    0x2443(%rip),%eax        # 2920 <stdout>
+     4dd:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     4e2:	48 8d 0d 05 1b 00 00 	lea    0x1b05(%rip),%rcx        # 1fee <malloc+0x1a5>
+     4e9:	48 89 ce             	mov    %rcx,%rsi
+     4ec:	89 c7                	mov    %eax,%edi
+     4ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f3:	e8 cf 10 00 00       	call   15c7 <printf>
+     4f8:	8b 05 22 24 00 00    	mov    0x2422(%rip),%eax        # 2920 <stdout>
+     4fe:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     502:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     506:	48 8d 35 e3 1b 00 00 	lea    0x1be3(%rip),%rsi        # 20f0 <malloc+0x2a7>
+     50d:	89 c7                	mov    %eax,%edi
+     50f:	b8 00 00 00 00       	mov    $0x0,%eax
+     514:	e8 ae 10 00 00       	call   15c7 <printf>
+     519:	8b 05 01 24 00 00    	mov    0x2401(%rip),%eax        # 2920 <stdout>
+     51f:	48 8d 15 f4 1a 00 00 	lea    0x1af4(%rip),%rdx        # 201a <malloc+0x1d1>
+     526:	48 89 d6             	mov    %rdx,%rsi
+     529:	89 c7                	mov    %eax,%edi
+     52b:	b8 00 00 00 00       	mov    $0x0,%eax
+     530:	e8 92 10 00 00       	call   15c7 <printf>
+     535:	90                   	nop
+     536:	eb fd                	jmp    535 <sbrktest+0x390>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+     538:	bf 00 00 00 00       	mov    $0x0,%edi
+     53d:	e8 b4 16 00 00       	call   1bf6 <sbrk>
+     542:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = sbrk(4096);
+     546:	bf 00 10 00 00       	mov    $0x1000,%edi
+     54b:	e8 a6 16 00 00       	call   1bf6 <sbrk>
+     550:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if(c != a || sbrk(0) != a + 4096){
+     554:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     558:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     55c:	75 1a                	jne    578 <sbrktest+0x3d3>
+     55e:	bf 00 00 00 00       	mov    $0x0,%edi
+     563:	e8 8e 16 00 00       	call   1bf6 <sbrk>
+     568:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     56c:	48 81 c2 00 10 00 00 	add    $0x1000,%rdx
+     573:	48 39 d0             	cmp    %rdx,%rax
+     576:	74 61                	je     5d9 <sbrktest+0x434>
+    error("sbrk re-allocation failed, a %x c %x\n", a, c);
+     578:	8b 05 a2 23 00 00    	mov    0x23a2(%rip),%eax        # 2920 <stdout>
+     57e:	ba 85 00 00 00       	mov    $0x85,%edx
+     583:	48 8d 0d 64 1a 00 00 	lea    0x1a64(%rip),%rcx        # 1fee <malloc+0x1a5>
+     58a:	48 89 ce             	mov    %rcx,%rsi
+     58d:	89 c7                	mov    %eax,%edi
+     58f:	b8 00 00 00 00       	mov    $0x0,%eax
+     594:	e8 2e 10 00 00       	call   15c7 <printf>
+     599:	8b 05 81 23 00 00    	mov    0x2381(%rip),%eax        # 2920 <stdout>
+     59f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     5a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     5a7:	48 8d 35 7a 1b 00 00 	lea    0x1b7a(%rip),%rsi        # 2128 <malloc+0x2df>
+     5ae:	89 c7                	mov    %eax,%edi
+     5b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     5b5:	e8 0d 10 00 00       	call   15c7 <printf>
+     5ba:	8b 05 60 23 00 00    	mov    0x2360(%rip),%eax        # 2920 <stdout>
+     5c0:	48 8d 15 53 1a 00 00 	lea    0x1a53(%rip),%rdx        # 201a <malloc+0x1d1>
+     5c7:	48 89 d6             	mov    %rdx,%rsi
+     5ca:	89 c7                	mov    %eax,%edi
+     5cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     5d1:	e8 f1 0f 00 00       	call   15c7 <printf>
+     5d6:	90                   	nop
+     5d7:	eb fd                	jmp    5d6 <sbrktest+0x431>
+  }
+  if(*lastaddr == 99){
+     5d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+     5dd:	0f b6 00             	movzbl (%rax),%eax
+     5e0:	3c 63                	cmp    $0x63,%al
+     5e2:	75 5c                	jne    640 <sbrktest+0x49b>
+    // should be zero
+    error("sbrk de-allocation didn't really deallocate\n");
+     5e4:	8b 05 36 23 00 00    	mov    0x2336(%rip),%eax        # 2920 <stdout>
+     5ea:	ba 89 00 00 00       	mov    $0x89,%edx
+     5ef:	48 8d 0d f8 19 00 00 	lea    0x19f8(%rip),%rcx        # 1fee <malloc+0x1a5>
+     5f6:	48 89 ce             	mov    %rcx,%rsi
+     5f9:	89 c7                	mov    %eax,%edi
+     5fb:	b8 00 00 00 00       	mov    $0x0,%eax
+     600:	e8 c2 0f 00 00       	call   15c7 <printf>
+     605:	8b 05 15 23 00 00    	mov    0x2315(%rip),%eax        # 2920 <stdout>
+     60b:	48 8d 15 3e 1b 00 00 	lea    0x1b3e(%rip),%rdx        # 2150 <malloc+0x307>
+     612:	48 89 d6             	mov    %rdx,%rsi
+     615:	89 c7                	mov    %eax,%edi
+     617:	b8 00 00 00 00       	mov    $0x0,%eax
+     61c:	e8 a6 0f 00 00       	call   15c7 <printf>
+     621:	8b 05 f9 22 00 00    	mov    0x22f9(%rip),%eax        # 2920 <stdout>
+     627:	48 8d 15 ec 19 00 00 	lea    0x19ec(%rip),%rdx        # 201a <malloc+0x1d1>
+     62e:	48 89 d6             	mov    %rdx,%rsi
+     631:	89 c7                	mov    %eax,%edi
+     633:	b8 00 00 00 00       	mov    $0x0,%eax
+     638:	e8 8a 0f 00 00       	call   15c7 <printf>
+     63d:	90                   	nop
+     63e:	eb fd                	jmp    63d <sbrktest+0x498>
+  }
+
+  a = sbrk(0);
+     640:	bf 00 00 00 00       	mov    $0x0,%edi
+     645:	e8 ac 15 00 00       	call   1bf6 <sbrk>
+     64a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+     64e:	bf 00 00 00 00       	mov    $0x0,%edi
+     653:	e8 9e 15 00 00       	call   1bf6 <sbrk>
+     658:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     65c:	48 29 c2             	sub    %rax,%rdx
+     65f:	89 d0                	mov    %edx,%eax
+     661:	89 c7                	mov    %eax,%edi
+     663:	e8 8e 15 00 00       	call   1bf6 <sbrk>
+     668:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if(c != a){
+     66c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     670:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+     674:	74 61                	je     6d7 <sbrktest+0x532>
+    error("sbrk downsize failed, a %x c %x\n", a, c);
+     676:	8b 05 a4 22 00 00    	mov    0x22a4(%rip),%eax        # 2920 <stdout>
+     67c:	ba 8f 00 00 00       	mov    $0x8f,%edx
+     681:	48 8d 0d 66 19 00 00 	lea    0x1966(%rip),%rcx        # 1fee <malloc+0x1a5>
+     688:	48 89 ce             	mov    %rcx,%rsi
+     68b:	89 c7                	mov    %eax,%edi
+     68d:	b8 00 00 00 00       	mov    $0x0,%eax
+     692:	e8 30 0f 00 00       	call   15c7 <printf>
+     697:	8b 05 83 22 00 00    	mov    0x2283(%rip),%eax        # 2920 <stdout>
+     69d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     6a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     6a5:	48 8d 35 d4 1a 00 00 	lea    0x1ad4(%rip),%rsi        # 2180 <malloc+0x337>
+     6ac:	89 c7                	mov    %eax,%edi
+     6ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     6b3:	e8 0f 0f 00 00       	call   15c7 <printf>
+     6b8:	8b 05 62 22 00 00    	mov    0x2262(%rip),%eax        # 2920 <stdout>
+     6be:	48 8d 15 55 19 00 00 	lea    0x1955(%rip),%rdx        # 201a <malloc+0x1d1>
+     6c5:	48 89 d6             	mov    %rdx,%rsi
+     6c8:	89 c7                	mov    %eax,%edi
+     6ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cf:	e8 f3 0e 00 00       	call   15c7 <printf>
+     6d4:	90                   	nop
+     6d5:	eb fd                	jmp    6d4 <sbrktest+0x52f>
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+     6d7:	48 c7 45 f8 00 00 00 	movq   $0xffffffff80000000,-0x8(%rbp)
+     6de:	80 
+     6df:	e9 04 01 00 00       	jmp    7e8 <sbrktest+0x643>
+    pid = fork();
+     6e4:	e8 7d 14 00 00       	call   1b66 <fork>
+     6e9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if(pid < 0){
+     6ec:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     6f0:	79 5c                	jns    74e <sbrktest+0x5a9>
+      error("fork failed\n");
+     6f2:	8b 05 28 22 00 00    	mov    0x2228(%rip),%eax        # 2920 <stdout>
+     6f8:	ba 96 00 00 00       	mov    $0x96,%edx
+     6fd:	48 8d 0d ea 18 00 00 	lea    0x18ea(%rip),%rcx        # 1fee <malloc+0x1a5>
+     704:	48 89 ce             	mov    %rcx,%rsi
+     707:	89 c7                	mov    %eax,%edi
+     709:	b8 00 00 00 00       	mov    $0x0,%eax
+     70e:	e8 b4 0e 00 00       	call   15c7 <printf>
+     713:	8b 05 07 22 00 00    	mov    0x2207(%rip),%eax        # 2920 <stdout>
+     719:	48 8d 15 81 1a 00 00 	lea    0x1a81(%rip),%rdx        # 21a1 <malloc+0x358>
+     720:	48 89 d6             	mov    %rdx,%rsi
+     723:	89 c7                	mov    %eax,%edi
+     725:	b8 00 00 00 00       	mov    $0x0,%eax
+     72a:	e8 98 0e 00 00       	call   15c7 <printf>
+     72f:	8b 05 eb 21 00 00    	mov    0x21eb(%rip),%eax        # 2920 <stdout>
+     735:	48 8d 15 de 18 00 00 	lea    0x18de(%rip),%rdx        # 201a <malloc+0x1d1>
+     73c:	48 89 d6             	mov    %rdx,%rsi
+     73f:	89 c7                	mov    %eax,%edi
+     741:	b8 00 00 00 00       	mov    $0x0,%eax
+     746:	e8 7c 0e 00 00       	call   15c7 <printf>
+     74b:	90                   	nop
+     74c:	eb fd                	jmp    74b <sbrktest+0x5a6>
+    }
+    if(pid == 0){
+     74e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     752:	0f 85 83 00 00 00    	jne    7db <sbrktest+0x636>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+     758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     75c:	0f b6 00             	movzbl (%rax),%eax
+     75f:	0f be c8             	movsbl %al,%ecx
+     762:	8b 05 b8 21 00 00    	mov    0x21b8(%rip),%eax        # 2920 <stdout>
+     768:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     76c:	48 8d 35 3b 1a 00 00 	lea    0x1a3b(%rip),%rsi        # 21ae <malloc+0x365>
+     773:	89 c7                	mov    %eax,%edi
+     775:	b8 00 00 00 00       	mov    $0x0,%eax
+     77a:	e8 48 0e 00 00       	call   15c7 <printf>
+      error("a bad process is not killed!");
+     77f:	8b 05 9b 21 00 00    	mov    0x219b(%rip),%eax        # 2920 <stdout>
+     785:	ba 9a 00 00 00       	mov    $0x9a,%edx
+     78a:	48 8d 0d 5d 18 00 00 	lea    0x185d(%rip),%rcx        # 1fee <malloc+0x1a5>
+     791:	48 89 ce             	mov    %rcx,%rsi
+     794:	89 c7                	mov    %eax,%edi
+     796:	b8 00 00 00 00       	mov    $0x0,%eax
+     79b:	e8 27 0e 00 00       	call   15c7 <printf>
+     7a0:	8b 05 7a 21 00 00    	mov    0x217a(%rip),%eax        # 2920 <stdout>
+     7a6:	48 8d 15 1a 1a 00 00 	lea    0x1a1a(%rip),%rdx        # 21c7 <malloc+0x37e>
+     7ad:	48 89 d6             	mov    %rdx,%rsi
+     7b0:	89 c7                	mov    %eax,%edi
+     7b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     7b7:	e8 0b 0e 00 00       	call   15c7 <printf>
+     7bc:	8b 05 5e 21 00 00    	mov    0x215e(%rip),%eax        # 2920 <stdout>
+     7c2:	48 8d 15 51 18 00 00 	lea    0x1851(%rip),%rdx        # 201a <malloc+0x1d1>
+     7c9:	48 89 d6             	mov    %rdx,%rsi
+     7cc:	89 c7                	mov    %eax,%edi
+     7ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d3:	e8 ef 0d 00 00       	call   15c7 <printf>
+     7d8:	90                   	nop
+     7d9:	eb fd                	jmp    7d8 <sbrktest+0x633>
+    }
+    wait();
+     7db:	e8 96 13 00 00       	call   1b76 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+     7e0:	48 81 45 f8 50 c3 00 	addq   $0xc350,-0x8(%rbp)
+     7e7:	00 
+     7e8:	48 81 7d f8 7f 84 1e 	cmpq   $0xffffffff801e847f,-0x8(%rbp)
+     7ef:	80 
+     7f0:	0f 86 ee fe ff ff    	jbe    6e4 <sbrktest+0x53f>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+     7f6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+     7fa:	48 89 c7             	mov    %rax,%rdi
+     7fd:	e8 7c 13 00 00       	call   1b7e <pipe>
+     802:	85 c0                	test   %eax,%eax
+     804:	74 5c                	je     862 <sbrktest+0x6bd>
+    error("pipe() failed\n");
+     806:	8b 05 14 21 00 00    	mov    0x2114(%rip),%eax        # 2920 <stdout>
+     80c:	ba a2 00 00 00       	mov    $0xa2,%edx
+     811:	48 8d 0d d6 17 00 00 	lea    0x17d6(%rip),%rcx        # 1fee <malloc+0x1a5>
+     818:	48 89 ce             	mov    %rcx,%rsi
+     81b:	89 c7                	mov    %eax,%edi
+     81d:	b8 00 00 00 00       	mov    $0x0,%eax
+     822:	e8 a0 0d 00 00       	call   15c7 <printf>
+     827:	8b 05 f3 20 00 00    	mov    0x20f3(%rip),%eax        # 2920 <stdout>
+     82d:	48 8d 15 b0 19 00 00 	lea    0x19b0(%rip),%rdx        # 21e4 <malloc+0x39b>
+     834:	48 89 d6             	mov    %rdx,%rsi
+     837:	89 c7                	mov    %eax,%edi
+     839:	b8 00 00 00 00       	mov    $0x0,%eax
+     83e:	e8 84 0d 00 00       	call   15c7 <printf>
+     843:	8b 05 d7 20 00 00    	mov    0x20d7(%rip),%eax        # 2920 <stdout>
+     849:	48 8d 15 ca 17 00 00 	lea    0x17ca(%rip),%rdx        # 201a <malloc+0x1d1>
+     850:	48 89 d6             	mov    %rdx,%rsi
+     853:	89 c7                	mov    %eax,%edi
+     855:	b8 00 00 00 00       	mov    $0x0,%eax
+     85a:	e8 68 0d 00 00       	call   15c7 <printf>
+     85f:	90                   	nop
+     860:	eb fd                	jmp    85f <sbrktest+0x6ba>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     862:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     869:	e9 83 00 00 00       	jmp    8f1 <sbrktest+0x74c>
+    if((pids[i] = fork()) == 0){
+     86e:	e8 f3 12 00 00       	call   1b66 <fork>
+     873:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     876:	48 63 d2             	movslq %edx,%rdx
+     879:	89 44 95 94          	mov    %eax,-0x6c(%rbp,%rdx,4)
+     87d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     880:	48 98                	cltq
+     882:	8b 44 85 94          	mov    -0x6c(%rbp,%rax,4),%eax
+     886:	85 c0                	test   %eax,%eax
+     888:	75 3f                	jne    8c9 <sbrktest+0x724>
+      // allocate a lot of memory
+      sbrk(BIG - (uint64_t)sbrk(0));
+     88a:	bf 00 00 00 00       	mov    $0x0,%edi
+     88f:	e8 62 13 00 00       	call   1bf6 <sbrk>
+     894:	89 c2                	mov    %eax,%edx
+     896:	b8 00 00 10 00       	mov    $0x100000,%eax
+     89b:	29 d0                	sub    %edx,%eax
+     89d:	89 c7                	mov    %eax,%edi
+     89f:	e8 52 13 00 00       	call   1bf6 <sbrk>
+      write(fds[1], "x", 1);
+     8a4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+     8a7:	ba 01 00 00 00       	mov    $0x1,%edx
+     8ac:	48 8d 0d 40 19 00 00 	lea    0x1940(%rip),%rcx        # 21f3 <malloc+0x3aa>
+     8b3:	48 89 ce             	mov    %rcx,%rsi
+     8b6:	89 c7                	mov    %eax,%edi
+     8b8:	e8 d1 12 00 00       	call   1b8e <write>
+      // sit around until killed
+      for(;;) sleep(1000);
+     8bd:	bf e8 03 00 00       	mov    $0x3e8,%edi
+     8c2:	e8 37 13 00 00       	call   1bfe <sleep>
+     8c7:	eb f4                	jmp    8bd <sbrktest+0x718>
+    }
+    if(pids[i] != -1)
+     8c9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8cc:	48 98                	cltq
+     8ce:	8b 44 85 94          	mov    -0x6c(%rbp,%rax,4),%eax
+     8d2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     8d5:	74 16                	je     8ed <sbrktest+0x748>
+      read(fds[0], &scratch, 1);
+     8d7:	8b 45 b0             	mov    -0x50(%rbp),%eax
+     8da:	48 8d 4d 93          	lea    -0x6d(%rbp),%rcx
+     8de:	ba 01 00 00 00       	mov    $0x1,%edx
+     8e3:	48 89 ce             	mov    %rcx,%rsi
+     8e6:	89 c7                	mov    %eax,%edi
+     8e8:	e8 99 12 00 00       	call   1b86 <read>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     8ed:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     8f1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8f4:	83 f8 06             	cmp    $0x6,%eax
+     8f7:	0f 86 71 ff ff ff    	jbe    86e <sbrktest+0x6c9>
+  }
+
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+     8fd:	bf 00 10 00 00       	mov    $0x1000,%edi
+     902:	e8 ef 12 00 00       	call   1bf6 <sbrk>
+     907:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     90b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     912:	eb 2a                	jmp    93e <sbrktest+0x799>
+    if(pids[i] == -1)
+     914:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     917:	48 98                	cltq
+     919:	8b 44 85 94          	mov    -0x6c(%rbp,%rax,4),%eax
+     91d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     920:	74 17                	je     939 <sbrktest+0x794>
+      continue;
+    kill(pids[i]);
+     922:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     925:	48 98                	cltq
+     927:	8b 44 85 94          	mov    -0x6c(%rbp,%rax,4),%eax
+     92b:	89 c7                	mov    %eax,%edi
+     92d:	e8 6c 12 00 00       	call   1b9e <kill>
+    wait();
+     932:	e8 3f 12 00 00       	call   1b76 <wait>
+     937:	eb 01                	jmp    93a <sbrktest+0x795>
+      continue;
+     939:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+     93a:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     93e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     941:	83 f8 06             	cmp    $0x6,%eax
+     944:	76 ce                	jbe    914 <sbrktest+0x76f>
+  }
+  if(c == (char*)0xffffffff){
+     946:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     94b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+     94f:	75 5c                	jne    9ad <sbrktest+0x808>
+    error("failed sbrk leaked memory\n");
+     951:	8b 05 c9 1f 00 00    	mov    0x1fc9(%rip),%eax        # 2920 <stdout>
+     957:	ba ba 00 00 00       	mov    $0xba,%edx
+     95c:	48 8d 0d 8b 16 00 00 	lea    0x168b(%rip),%rcx        # 1fee <malloc+0x1a5>
+     963:	48 89 ce             	mov    %rcx,%rsi
+     966:	89 c7                	mov    %eax,%edi
+     968:	b8 00 00 00 00       	mov    $0x0,%eax
+     96d:	e8 55 0c 00 00       	call   15c7 <printf>
+     972:	8b 05 a8 1f 00 00    	mov    0x1fa8(%rip),%eax        # 2920 <stdout>
+     978:	48 8d 15 76 18 00 00 	lea    0x1876(%rip),%rdx        # 21f5 <malloc+0x3ac>
+     97f:	48 89 d6             	mov    %rdx,%rsi
+     982:	89 c7                	mov    %eax,%edi
+     984:	b8 00 00 00 00       	mov    $0x0,%eax
+     989:	e8 39 0c 00 00       	call   15c7 <printf>
+     98e:	8b 05 8c 1f 00 00    	mov    0x1f8c(%rip),%eax        # 2920 <stdout>
+     994:	48 8d 15 7f 16 00 00 	lea    0x167f(%rip),%rdx        # 201a <malloc+0x1d1>
+     99b:	48 89 d6             	mov    %rdx,%rsi
+     99e:	89 c7                	mov    %eax,%edi
+     9a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a5:	e8 1d 0c 00 00       	call   15c7 <printf>
+     9aa:	90                   	nop
+     9ab:	eb fd                	jmp    9aa <sbrktest+0x805>
+  }
+
+  if(sbrk(0) > oldbrk)
+     9ad:	bf 00 00 00 00       	mov    $0x0,%edi
+     9b2:	e8 3f 12 00 00       	call   1bf6 <sbrk>
+     9b7:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     9bb:	73 1a                	jae    9d7 <sbrktest+0x832>
+    sbrk(-(sbrk(0) - oldbrk));
+     9bd:	bf 00 00 00 00       	mov    $0x0,%edi
+     9c2:	e8 2f 12 00 00       	call   1bf6 <sbrk>
+     9c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     9cb:	48 29 c2             	sub    %rax,%rdx
+     9ce:	89 d0                	mov    %edx,%eax
+     9d0:	89 c7                	mov    %eax,%edi
+     9d2:	e8 1f 12 00 00       	call   1bf6 <sbrk>
+
+  printf(stdout, "sbrktest OK\n");
+     9d7:	8b 05 43 1f 00 00    	mov    0x1f43(%rip),%eax        # 2920 <stdout>
+     9dd:	48 8d 15 2c 18 00 00 	lea    0x182c(%rip),%rdx        # 2210 <malloc+0x3c7>
+     9e4:	48 89 d6             	mov    %rdx,%rsi
+     9e7:	89 c7                	mov    %eax,%edi
+     9e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ee:	e8 d4 0b 00 00       	call   15c7 <printf>
+}
+     9f3:	90                   	nop
+     9f4:	c9                   	leave
+     9f5:	c3                   	ret
+
+00000000000009f6 <mmaptest>:
+
+void mmaptest()
+{
+     9f6:	55                   	push   %rbp
+     9f7:	48 89 e5             	mov    %rsp,%rbp
+     9fa:	48 83 ec 20          	sub    $0x20,%rsp
+  char* addr = (char*)SZ_2G;
+     9fe:	b8 00 00 00 80       	mov    $0x80000000,%eax
+     a03:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  int fd;
+  int r;
+  int pid;
+
+  printf(stdout, "mmaptest\n");
+     a07:	8b 05 13 1f 00 00    	mov    0x1f13(%rip),%eax        # 2920 <stdout>
+     a0d:	48 8d 15 09 18 00 00 	lea    0x1809(%rip),%rdx        # 221d <malloc+0x3d4>
+     a14:	48 89 d6             	mov    %rdx,%rsi
+     a17:	89 c7                	mov    %eax,%edi
+     a19:	b8 00 00 00 00       	mov    $0x0,%eax
+     a1e:	e8 a4 0b 00 00       	call   15c7 <printf>
+
+  fd = open("/small.txt", O_RDONLY);
+     a23:	be 00 00 00 00       	mov    $0x0,%esi
+     a28:	48 8d 05 f8 17 00 00 	lea    0x17f8(%rip),%rax        # 2227 <malloc+0x3de>
+     a2f:	48 89 c7             	mov    %rax,%rdi
+     a32:	e8 77 11 00 00       	call   1bae <open>
+     a37:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(fd < 0)
+     a3a:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     a3e:	79 5c                	jns    a9c <mmaptest+0xa6>
+    error("unable to open small file");
+     a40:	8b 05 da 1e 00 00    	mov    0x1eda(%rip),%eax        # 2920 <stdout>
+     a46:	ba ce 00 00 00       	mov    $0xce,%edx
+     a4b:	48 8d 0d 9c 15 00 00 	lea    0x159c(%rip),%rcx        # 1fee <malloc+0x1a5>
+     a52:	48 89 ce             	mov    %rcx,%rsi
+     a55:	89 c7                	mov    %eax,%edi
+     a57:	b8 00 00 00 00       	mov    $0x0,%eax
+     a5c:	e8 66 0b 00 00       	call   15c7 <printf>
+     a61:	8b 05 b9 1e 00 00    	mov    0x1eb9(%rip),%eax        # 2920 <stdout>
+     a67:	48 8d 15 c4 17 00 00 	lea    0x17c4(%rip),%rdx        # 2232 <malloc+0x3e9>
+     a6e:	48 89 d6             	mov    %rdx,%rsi
+     a71:	89 c7                	mov    %eax,%edi
+     a73:	b8 00 00 00 00       	mov    $0x0,%eax
+     a78:	e8 4a 0b 00 00       	call   15c7 <printf>
+     a7d:	8b 05 9d 1e 00 00    	mov    0x1e9d(%rip),%eax        # 2920 <stdout>
+     a83:	48 8d 15 90 15 00 00 	lea    0x1590(%rip),%rdx        # 201a <malloc+0x1d1>
+     a8a:	48 89 d6             	mov    %rdx,%rsi
+     a8d:	89 c7                	mov    %eax,%edi
+     a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a94:	e8 2e 0b 00 00       	call   15c7 <printf>
+     a99:	90                   	nop
+     a9a:	eb fd                	jmp    a99 <mmaptest+0xa3>
+
+  r = mmap(fd);
+     a9c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a9f:	89 c7                	mov    %eax,%edi
+     aa1:	e8 70 11 00 00       	call   1c16 <mmap>
+     aa6:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if(r < 0)
+     aa9:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     aad:	79 5c                	jns    b0b <mmaptest+0x115>
+    error("unable to mmap a small file");
+     aaf:	8b 05 6b 1e 00 00    	mov    0x1e6b(%rip),%eax        # 2920 <stdout>
+     ab5:	ba d2 00 00 00       	mov    $0xd2,%edx
+     aba:	48 8d 0d 2d 15 00 00 	lea    0x152d(%rip),%rcx        # 1fee <malloc+0x1a5>
+     ac1:	48 89 ce             	mov    %rcx,%rsi
+     ac4:	89 c7                	mov    %eax,%edi
+     ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+     acb:	e8 f7 0a 00 00       	call   15c7 <printf>
+     ad0:	8b 05 4a 1e 00 00    	mov    0x1e4a(%rip),%eax        # 2920 <stdout>
+     ad6:	48 8d 15 6f 17 00 00 	lea    0x176f(%rip),%rdx        # 224c <malloc+0x403>
+     add:	48 89 d6             	mov    %rdx,%rsi
+     ae0:	89 c7                	mov    %eax,%edi
+     ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae7:	e8 db 0a 00 00       	call   15c7 <printf>
+     aec:	8b 05 2e 1e 00 00    	mov    0x1e2e(%rip),%eax        # 2920 <stdout>
+     af2:	48 8d 15 21 15 00 00 	lea    0x1521(%rip),%rdx        # 201a <malloc+0x1d1>
+     af9:	48 89 d6             	mov    %rdx,%rsi
+     afc:	89 c7                	mov    %eax,%edi
+     afe:	b8 00 00 00 00       	mov    $0x0,%eax
+     b03:	e8 bf 0a 00 00       	call   15c7 <printf>
+     b08:	90                   	nop
+     b09:	eb fd                	jmp    b08 <mmaptest+0x112>
+
+  if (strcmp(addr, "aaaaaaaaaabbbbbbbbbbccccc\n") != 0)
+     b0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b0f:	48 8d 15 52 17 00 00 	lea    0x1752(%rip),%rdx        # 2268 <malloc+0x41f>
+     b16:	48 89 d6             	mov    %rdx,%rsi
+     b19:	48 89 c7             	mov    %rax,%rdi
+     b1c:	e8 e7 0d 00 00       	call   1908 <strcmp>
+     b21:	85 c0                	test   %eax,%eax
+     b23:	74 60                	je     b85 <mmaptest+0x18f>
+    error("file content was not aaaaaaaaaabbbbbbbbbbccccc, was: '%s'", addr);
+     b25:	8b 05 f5 1d 00 00    	mov    0x1df5(%rip),%eax        # 2920 <stdout>
+     b2b:	ba d5 00 00 00       	mov    $0xd5,%edx
+     b30:	48 8d 0d b7 14 00 00 	lea    0x14b7(%rip),%rcx        # 1fee <malloc+0x1a5>
+     b37:	48 89 ce             	mov    %rcx,%rsi
+     b3a:	89 c7                	mov    %eax,%edi
+     b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b41:	e8 81 0a 00 00       	call   15c7 <printf>
+     b46:	8b 05 d4 1d 00 00    	mov    0x1dd4(%rip),%eax        # 2920 <stdout>
+     b4c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     b50:	48 8d 0d 31 17 00 00 	lea    0x1731(%rip),%rcx        # 2288 <malloc+0x43f>
+     b57:	48 89 ce             	mov    %rcx,%rsi
+     b5a:	89 c7                	mov    %eax,%edi
+     b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b61:	e8 61 0a 00 00       	call   15c7 <printf>
+     b66:	8b 05 b4 1d 00 00    	mov    0x1db4(%rip),%eax        # 2920 <stdout>
+     b6c:	48 8d 15 a7 14 00 00 	lea    0x14a7(%rip),%rdx        # 201a <malloc+0x1d1>
+     b73:	48 89 d6             	mov    %rdx,%rsi
+     b76:	89 c7                	mov    %eax,%edi
+     b78:	b8 00 00 00 00       	mov    $0x0,%eax
+     b7d:	e8 45 0a 00 00       	call   15c7 <printf>
+     b82:	90                   	nop
+     b83:	eb fd                	jmp    b82 <mmaptest+0x18c>
+
+  r = munmap(fd);
+     b85:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     b88:	89 c7                	mov    %eax,%edi
+     b8a:	e8 8f 10 00 00       	call   1c1e <munmap>
+     b8f:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if(r < 0)
+     b92:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     b96:	79 5c                	jns    bf4 <mmaptest+0x1fe>
+    error("unable to munmap");
+     b98:	8b 05 82 1d 00 00    	mov    0x1d82(%rip),%eax        # 2920 <stdout>
+     b9e:	ba d9 00 00 00       	mov    $0xd9,%edx
+     ba3:	48 8d 0d 44 14 00 00 	lea    0x1444(%rip),%rcx        # 1fee <malloc+0x1a5>
+     baa:	48 89 ce             	mov    %rcx,%rsi
+     bad:	89 c7                	mov    %eax,%edi
+     baf:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb4:	e8 0e 0a 00 00       	call   15c7 <printf>
+     bb9:	8b 05 61 1d 00 00    	mov    0x1d61(%rip),%eax        # 2920 <stdout>
+     bbf:	48 8d 15 fc 16 00 00 	lea    0x16fc(%rip),%rdx        # 22c2 <malloc+0x479>
+     bc6:	48 89 d6             	mov    %rdx,%rsi
+     bc9:	89 c7                	mov    %eax,%edi
+     bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd0:	e8 f2 09 00 00       	call   15c7 <printf>
+     bd5:	8b 05 45 1d 00 00    	mov    0x1d45(%rip),%eax        # 2920 <stdout>
+     bdb:	48 8d 15 38 14 00 00 	lea    0x1438(%rip),%rdx        # 201a <malloc+0x1d1>
+     be2:	48 89 d6             	mov    %rdx,%rsi
+     be5:	89 c7                	mov    %eax,%edi
+     be7:	b8 00 00 00 00       	mov    $0x0,%eax
+     bec:	e8 d6 09 00 00       	call   15c7 <printf>
+     bf1:	90                   	nop
+     bf2:	eb fd                	jmp    bf1 <mmaptest+0x1fb>
+
+  close(fd);
+     bf4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     bf7:	89 c7                	mov    %eax,%edi
+     bf9:	e8 98 0f 00 00       	call   1b96 <close>
+
+  // test inter-process communication via mmaped file
+
+  fd = open("/small.txt", O_RDONLY);
+     bfe:	be 00 00 00 00       	mov    $0x0,%esi
+     c03:	48 8d 05 1d 16 00 00 	lea    0x161d(%rip),%rax        # 2227 <malloc+0x3de>
+     c0a:	48 89 c7             	mov    %rax,%rdi
+     c0d:	e8 9c 0f 00 00       	call   1bae <open>
+     c12:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(fd < 0)
+     c15:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     c19:	79 5c                	jns    c77 <mmaptest+0x281>
+    error("unable to open small file");
+     c1b:	8b 05 ff 1c 00 00    	mov    0x1cff(%rip),%eax        # 2920 <stdout>
+     c21:	ba e1 00 00 00       	mov    $0xe1,%edx
+     c26:	48 8d 0d c1 13 00 00 	lea    0x13c1(%rip),%rcx        # 1fee <malloc+0x1a5>
+     c2d:	48 89 ce             	mov    %rcx,%rsi
+     c30:	89 c7                	mov    %eax,%edi
+     c32:	b8 00 00 00 00       	mov    $0x0,%eax
+     c37:	e8 8b 09 00 00       	call   15c7 <printf>
+     c3c:	8b 05 de 1c 00 00    	mov    0x1cde(%rip),%eax        # 2920 <stdout>
+     c42:	48 8d 15 e9 15 00 00 	lea    0x15e9(%rip),%rdx        # 2232 <malloc+0x3e9>
+     c49:	48 89 d6             	mov    %rdx,%rsi
+     c4c:	89 c7                	mov    %eax,%edi
+     c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+     c53:	e8 6f 09 00 00       	call   15c7 <printf>
+     c58:	8b 05 c2 1c 00 00    	mov    0x1cc2(%rip),%eax        # 2920 <stdout>
+     c5e:	48 8d 15 b5 13 00 00 	lea    0x13b5(%rip),%rdx        # 201a <malloc+0x1d1>
+     c65:	48 89 d6             	mov    %rdx,%rsi
+     c68:	89 c7                	mov    %eax,%edi
+     c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c6f:	e8 53 09 00 00       	call   15c7 <printf>
+     c74:	90                   	nop
+     c75:	eb fd                	jmp    c74 <mmaptest+0x27e>
+
+  r = mmap(fd);
+     c77:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c7a:	89 c7                	mov    %eax,%edi
+     c7c:	e8 95 0f 00 00       	call   1c16 <mmap>
+     c81:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if(r < 0)
+     c84:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     c88:	79 5c                	jns    ce6 <mmaptest+0x2f0>
+    error("unable to mmap a small file");
+     c8a:	8b 05 90 1c 00 00    	mov    0x1c90(%rip),%eax        # 2920 <stdout>
+     c90:	ba e5 00 00 00       	mov    $0xe5,%edx
+     c95:	48 8d 0d 52 13 00 00 	lea    0x1352(%rip),%rcx        # 1fee <malloc+0x1a5>
+     c9c:	48 89 ce             	mov    %rcx,%rsi
+     c9f:	89 c7                	mov    %eax,%edi
+     ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca6:	e8 1c 09 00 00       	call   15c7 <printf>
+     cab:	8b 05 6f 1c 00 00    	mov    0x1c6f(%rip),%eax        # 2920 <stdout>
+     cb1:	48 8d 15 94 15 00 00 	lea    0x1594(%rip),%rdx        # 224c <malloc+0x403>
+     cb8:	48 89 d6             	mov    %rdx,%rsi
+     cbb:	89 c7                	mov    %eax,%edi
+     cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc2:	e8 00 09 00 00       	call   15c7 <printf>
+     cc7:	8b 05 53 1c 00 00    	mov    0x1c53(%rip),%eax        # 2920 <stdout>
+     ccd:	48 8d 15 46 13 00 00 	lea    0x1346(%rip),%rdx        # 201a <malloc+0x1d1>
+     cd4:	48 89 d6             	mov    %rdx,%rsi
+     cd7:	89 c7                	mov    %eax,%edi
+     cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+     cde:	e8 e4 08 00 00       	call   15c7 <printf>
+     ce3:	90                   	nop
+     ce4:	eb fd                	jmp    ce3 <mmaptest+0x2ed>
+
+  pid = fork();
+     ce6:	e8 7b 0e 00 00       	call   1b66 <fork>
+     ceb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (pid == 0) {
+     cee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     cf2:	0f 85 90 00 00 00    	jne    d88 <mmaptest+0x392>
+    addr[0] = 'b';
+     cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cfc:	c6 00 62             	movb   $0x62,(%rax)
+    addr[5] = 'd';
+     cff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d03:	48 83 c0 05          	add    $0x5,%rax
+     d07:	c6 00 64             	movb   $0x64,(%rax)
+    r = munmap(fd);
+     d0a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d0d:	89 c7                	mov    %eax,%edi
+     d0f:	e8 0a 0f 00 00       	call   1c1e <munmap>
+     d14:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if(r < 0)
+     d17:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     d1b:	79 5c                	jns    d79 <mmaptest+0x383>
+      error("unable to munmap");
+     d1d:	8b 05 fd 1b 00 00    	mov    0x1bfd(%rip),%eax        # 2920 <stdout>
+     d23:	ba ed 00 00 00       	mov    $0xed,%edx
+     d28:	48 8d 0d bf 12 00 00 	lea    0x12bf(%rip),%rcx        # 1fee <malloc+0x1a5>
+     d2f:	48 89 ce             	mov    %rcx,%rsi
+     d32:	89 c7                	mov    %eax,%edi
+     d34:	b8 00 00 00 00       	mov    $0x0,%eax
+     d39:	e8 89 08 00 00       	call   15c7 <printf>
+     d3e:	8b 05 dc 1b 00 00    	mov    0x1bdc(%rip),%eax        # 2920 <stdout>
+     d44:	48 8d 15 77 15 00 00 	lea    0x1577(%rip),%rdx        # 22c2 <malloc+0x479>
+     d4b:	48 89 d6             	mov    %rdx,%rsi
+     d4e:	89 c7                	mov    %eax,%edi
+     d50:	b8 00 00 00 00       	mov    $0x0,%eax
+     d55:	e8 6d 08 00 00       	call   15c7 <printf>
+     d5a:	8b 05 c0 1b 00 00    	mov    0x1bc0(%rip),%eax        # 2920 <stdout>
+     d60:	48 8d 15 b3 12 00 00 	lea    0x12b3(%rip),%rdx        # 201a <malloc+0x1d1>
+     d67:	48 89 d6             	mov    %rdx,%rsi
+     d6a:	89 c7                	mov    %eax,%edi
+     d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+     d71:	e8 51 08 00 00       	call   15c7 <printf>
+     d76:	90                   	nop
+     d77:	eb fd                	jmp    d76 <mmaptest+0x380>
+
+    close(fd);
+     d79:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d7c:	89 c7                	mov    %eax,%edi
+     d7e:	e8 13 0e 00 00       	call   1b96 <close>
+    exit();
+     d83:	e8 e6 0d 00 00       	call   1b6e <exit>
+  } else {
+    wait();
+     d88:	e8 e9 0d 00 00       	call   1b76 <wait>
+  }
+
+  if (strcmp(addr, "baaaadaaaabbbbbbbbbbccccc\n") != 0)
+     d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d91:	48 8d 15 3b 15 00 00 	lea    0x153b(%rip),%rdx        # 22d3 <malloc+0x48a>
+     d98:	48 89 d6             	mov    %rdx,%rsi
+     d9b:	48 89 c7             	mov    %rax,%rdi
+     d9e:	e8 65 0b 00 00       	call   1908 <strcmp>
+     da3:	85 c0                	test   %eax,%eax
+     da5:	74 60                	je     e07 <mmaptest+0x411>
+    error("file content was not baaaadaaaabbbbbbbbbbccccc, was: '%s'", addr);
+     da7:	8b 05 73 1b 00 00    	mov    0x1b73(%rip),%eax        # 2920 <stdout>
+     dad:	ba f6 00 00 00       	mov    $0xf6,%edx
+     db2:	48 8d 0d 35 12 00 00 	lea    0x1235(%rip),%rcx        # 1fee <malloc+0x1a5>
+     db9:	48 89 ce             	mov    %rcx,%rsi
+     dbc:	89 c7                	mov    %eax,%edi
+     dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc3:	e8 ff 07 00 00       	call   15c7 <printf>
+     dc8:	8b 05 52 1b 00 00    	mov    0x1b52(%rip),%eax        # 2920 <stdout>
+     dce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     dd2:	48 8d 0d 17 15 00 00 	lea    0x1517(%rip),%rcx        # 22f0 <malloc+0x4a7>
+     dd9:	48 89 ce             	mov    %rcx,%rsi
+     ddc:	89 c7                	mov    %eax,%edi
+     dde:	b8 00 00 00 00       	mov    $0x0,%eax
+     de3:	e8 df 07 00 00       	call   15c7 <printf>
+     de8:	8b 05 32 1b 00 00    	mov    0x1b32(%rip),%eax        # 2920 <stdout>
+     dee:	48 8d 15 25 12 00 00 	lea    0x1225(%rip),%rdx        # 201a <malloc+0x1d1>
+     df5:	48 89 d6             	mov    %rdx,%rsi
+     df8:	89 c7                	mov    %eax,%edi
+     dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+     dff:	e8 c3 07 00 00       	call   15c7 <printf>
+     e04:	90                   	nop
+     e05:	eb fd                	jmp    e04 <mmaptest+0x40e>
+
+  r = munmap(fd);
+     e07:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e0a:	89 c7                	mov    %eax,%edi
+     e0c:	e8 0d 0e 00 00       	call   1c1e <munmap>
+     e11:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if(r < 0)
+     e14:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     e18:	79 5c                	jns    e76 <mmaptest+0x480>
+    error("unable to munmap");
+     e1a:	8b 05 00 1b 00 00    	mov    0x1b00(%rip),%eax        # 2920 <stdout>
+     e20:	ba fa 00 00 00       	mov    $0xfa,%edx
+     e25:	48 8d 0d c2 11 00 00 	lea    0x11c2(%rip),%rcx        # 1fee <malloc+0x1a5>
+     e2c:	48 89 ce             	mov    %rcx,%rsi
+     e2f:	89 c7                	mov    %eax,%edi
+     e31:	b8 00 00 00 00       	mov    $0x0,%eax
+     e36:	e8 8c 07 00 00       	call   15c7 <printf>
+     e3b:	8b 05 df 1a 00 00    	mov    0x1adf(%rip),%eax        # 2920 <stdout>
+     e41:	48 8d 15 7a 14 00 00 	lea    0x147a(%rip),%rdx        # 22c2 <malloc+0x479>
+     e48:	48 89 d6             	mov    %rdx,%rsi
+     e4b:	89 c7                	mov    %eax,%edi
+     e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e52:	e8 70 07 00 00       	call   15c7 <printf>
+     e57:	8b 05 c3 1a 00 00    	mov    0x1ac3(%rip),%eax        # 2920 <stdout>
+     e5d:	48 8d 15 b6 11 00 00 	lea    0x11b6(%rip),%rdx        # 201a <malloc+0x1d1>
+     e64:	48 89 d6             	mov    %rdx,%rsi
+     e67:	89 c7                	mov    %eax,%edi
+     e69:	b8 00 00 00 00       	mov    $0x0,%eax
+     e6e:	e8 54 07 00 00       	call   15c7 <printf>
+     e73:	90                   	nop
+     e74:	eb fd                	jmp    e73 <mmaptest+0x47d>
+
+  close(fd);
+     e76:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e79:	89 c7                	mov    %eax,%edi
+     e7b:	e8 16 0d 00 00       	call   1b96 <close>
+
+  printf(stdout, "mmaptest passed\n");
+     e80:	8b 05 9a 1a 00 00    	mov    0x1a9a(%rip),%eax        # 2920 <stdout>
+     e86:	48 8d 15 9d 14 00 00 	lea    0x149d(%rip),%rdx        # 232a <malloc+0x4e1>
+     e8d:	48 89 d6             	mov    %rdx,%rsi
+     e90:	89 c7                	mov    %eax,%edi
+     e92:	b8 00 00 00 00       	mov    $0x0,%eax
+     e97:	e8 2b 07 00 00       	call   15c7 <printf>
+}
+     e9c:	90                   	nop
+     e9d:	c9                   	leave
+     e9e:	c3                   	ret
+
+0000000000000e9f <growstacktest>:
+
+void growstacktest()
+{
+     e9f:	55                   	push   %rbp
+     ea0:	48 89 e5             	mov    %rsp,%rbp
+     ea3:	41 57                	push   %r15
+     ea5:	41 56                	push   %r14
+     ea7:	41 55                	push   %r13
+     ea9:	41 54                	push   %r12
+     eab:	53                   	push   %rbx
+     eac:	48 83 ec 48          	sub    $0x48,%rsp
+     eb0:	48 89 e0             	mov    %rsp,%rax
+     eb3:	48 89 c3             	mov    %rax,%rbx
+  int i;
+  struct sys_info info1, info2;
+  printf(stdout, "growstacktest\n");
+     eb6:	8b 05 64 1a 00 00    	mov    0x1a64(%rip),%eax        # 2920 <stdout>
+     ebc:	48 8d 15 78 14 00 00 	lea    0x1478(%rip),%rdx        # 233b <malloc+0x4f2>
+     ec3:	48 89 d6             	mov    %rdx,%rsi
+     ec6:	89 c7                	mov    %eax,%edi
+     ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+     ecd:	e8 f5 06 00 00       	call   15c7 <printf>
+  sysinfo(&info1);
+     ed2:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+     ed6:	48 89 c7             	mov    %rax,%rdi
+     ed9:	e8 30 0d 00 00       	call   1c0e <sysinfo>
+
+  printf(stdout, "pages_in_use before stack allocation = %d\n", info1.pages_in_use);
+     ede:	8b 55 a4             	mov    -0x5c(%rbp),%edx
+     ee1:	8b 05 39 1a 00 00    	mov    0x1a39(%rip),%eax        # 2920 <stdout>
+     ee7:	48 8d 0d 62 14 00 00 	lea    0x1462(%rip),%rcx        # 2350 <malloc+0x507>
+     eee:	48 89 ce             	mov    %rcx,%rsi
+     ef1:	89 c7                	mov    %eax,%edi
+     ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef8:	e8 ca 06 00 00       	call   15c7 <printf>
+  printf(stdout, "pages_in_swap before stack allocation = %d\n", info1.pages_in_swap);
+     efd:	8b 55 a8             	mov    -0x58(%rbp),%edx
+     f00:	8b 05 1a 1a 00 00    	mov    0x1a1a(%rip),%eax        # 2920 <stdout>
+     f06:	48 8d 0d 73 14 00 00 	lea    0x1473(%rip),%rcx        # 2380 <malloc+0x537>
+     f0d:	48 89 ce             	mov    %rcx,%rsi
+     f10:	89 c7                	mov    %eax,%edi
+     f12:	b8 00 00 00 00       	mov    $0x0,%eax
+     f17:	e8 ab 06 00 00       	call   15c7 <printf>
+
+  int page8 = 8 * 4096;
+     f1c:	c7 45 c8 00 80 00 00 	movl   $0x8000,-0x38(%rbp)
+  char buf[page8];
+     f23:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     f26:	48 63 d0             	movslq %eax,%rdx
+     f29:	48 83 ea 01          	sub    $0x1,%rdx
+     f2d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+     f31:	48 63 d0             	movslq %eax,%rdx
+     f34:	49 89 d6             	mov    %rdx,%r14
+     f37:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+     f3d:	48 63 d0             	movslq %eax,%rdx
+     f40:	49 89 d4             	mov    %rdx,%r12
+     f43:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+     f49:	48 98                	cltq
+     f4b:	ba 10 00 00 00       	mov    $0x10,%edx
+     f50:	48 83 ea 01          	sub    $0x1,%rdx
+     f54:	48 01 d0             	add    %rdx,%rax
+     f57:	be 10 00 00 00       	mov    $0x10,%esi
+     f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+     f61:	48 f7 f6             	div    %rsi
+     f64:	48 6b c0 10          	imul   $0x10,%rax,%rax
+     f68:	48 29 c4             	sub    %rax,%rsp
+     f6b:	48 89 e0             	mov    %rsp,%rax
+     f6e:	48 83 c0 00          	add    $0x0,%rax
+     f72:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  for (i = 0; i < 8; i ++) {
+     f76:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+     f7d:	eb 3a                	jmp    fb9 <growstacktest+0x11a>
+    buf[i * 4096] = 'a';
+     f7f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     f82:	c1 e0 0c             	shl    $0xc,%eax
+     f85:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     f89:	48 98                	cltq
+     f8b:	c6 04 02 61          	movb   $0x61,(%rdx,%rax,1)
+    buf[i * 4096 - 1] = buf[i * 4096];
+     f8f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     f92:	c1 e0 0c             	shl    $0xc,%eax
+     f95:	89 c1                	mov    %eax,%ecx
+     f97:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     f9a:	c1 e0 0c             	shl    $0xc,%eax
+     f9d:	8d 70 ff             	lea    -0x1(%rax),%esi
+     fa0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     fa4:	48 63 c1             	movslq %ecx,%rax
+     fa7:	0f b6 0c 02          	movzbl (%rdx,%rax,1),%ecx
+     fab:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+     faf:	48 63 c6             	movslq %esi,%rax
+     fb2:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  for (i = 0; i < 8; i ++) {
+     fb5:	83 45 cc 01          	addl   $0x1,-0x34(%rbp)
+     fb9:	83 7d cc 07          	cmpl   $0x7,-0x34(%rbp)
+     fbd:	7e c0                	jle    f7f <growstacktest+0xe0>
+
+  }
+  sysinfo(&info2);
+     fbf:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+     fc3:	48 89 c7             	mov    %rax,%rdi
+     fc6:	e8 43 0c 00 00       	call   1c0e <sysinfo>
+
+  printf(stdout, "pages_in_use after stack allocation = %d\n", info2.pages_in_use);
+     fcb:	8b 55 90             	mov    -0x70(%rbp),%edx
+     fce:	8b 05 4c 19 00 00    	mov    0x194c(%rip),%eax        # 2920 <stdout>
+     fd4:	48 8d 0d d5 13 00 00 	lea    0x13d5(%rip),%rcx        # 23b0 <malloc+0x567>
+     fdb:	48 89 ce             	mov    %rcx,%rsi
+     fde:	89 c7                	mov    %eax,%edi
+     fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe5:	e8 dd 05 00 00       	call   15c7 <printf>
+  printf(stdout, "pages_in_swap after stack allocation = %d\n", info2.pages_in_swap);
+     fea:	8b 55 94             	mov    -0x6c(%rbp),%edx
+     fed:	8b 05 2d 19 00 00    	mov    0x192d(%rip),%eax        # 2920 <stdout>
+     ff3:	48 8d 0d e6 13 00 00 	lea    0x13e6(%rip),%rcx        # 23e0 <malloc+0x597>
+     ffa:	48 89 ce             	mov    %rcx,%rsi
+     ffd:	89 c7                	mov    %eax,%edi
+     fff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1004:	e8 be 05 00 00       	call   15c7 <printf>
+
+  // if grow ustack on-demand is implemented, then the 8 pages are allocated at run-time
+  if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap - info2.pages_in_swap != 8)
+    1009:	8b 55 90             	mov    -0x70(%rbp),%edx
+    100c:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+    100f:	29 c2                	sub    %eax,%edx
+    1011:	8b 45 a8             	mov    -0x58(%rbp),%eax
+    1014:	01 c2                	add    %eax,%edx
+    1016:	8b 45 94             	mov    -0x6c(%rbp),%eax
+    1019:	29 c2                	sub    %eax,%edx
+    101b:	83 fa 08             	cmp    $0x8,%edx
+    101e:	74 5c                	je     107c <growstacktest+0x1dd>
+   error("user stack is not growing");
+    1020:	8b 05 fa 18 00 00    	mov    0x18fa(%rip),%eax        # 2920 <stdout>
+    1026:	ba 19 01 00 00       	mov    $0x119,%edx
+    102b:	48 8d 0d bc 0f 00 00 	lea    0xfbc(%rip),%rcx        # 1fee <malloc+0x1a5>
+    1032:	48 89 ce             	mov    %rcx,%rsi
+    1035:	89 c7                	mov    %eax,%edi
+    1037:	b8 00 00 00 00       	mov    $0x0,%eax
+    103c:	e8 86 05 00 00       	call   15c7 <printf>
+    1041:	8b 05 d9 18 00 00    	mov    0x18d9(%rip),%eax        # 2920 <stdout>
+    1047:	48 8d 15 bd 13 00 00 	lea    0x13bd(%rip),%rdx        # 240b <malloc+0x5c2>
+    104e:	48 89 d6             	mov    %rdx,%rsi
+    1051:	89 c7                	mov    %eax,%edi
+    1053:	b8 00 00 00 00       	mov    $0x0,%eax
+    1058:	e8 6a 05 00 00       	call   15c7 <printf>
+    105d:	8b 05 bd 18 00 00    	mov    0x18bd(%rip),%eax        # 2920 <stdout>
+    1063:	48 8d 15 b0 0f 00 00 	lea    0xfb0(%rip),%rdx        # 201a <malloc+0x1d1>
+    106a:	48 89 d6             	mov    %rdx,%rsi
+    106d:	89 c7                	mov    %eax,%edi
+    106f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1074:	e8 4e 05 00 00       	call   15c7 <printf>
+    1079:	90                   	nop
+    107a:	eb fd                	jmp    1079 <growstacktest+0x1da>
+
+  printf(stdout, "growstacktest passed\n");
+    107c:	8b 05 9e 18 00 00    	mov    0x189e(%rip),%eax        # 2920 <stdout>
+    1082:	48 8d 15 9c 13 00 00 	lea    0x139c(%rip),%rdx        # 2425 <malloc+0x5dc>
+    1089:	48 89 d6             	mov    %rdx,%rsi
+    108c:	89 c7                	mov    %eax,%edi
+    108e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1093:	e8 2f 05 00 00       	call   15c7 <printf>
+    1098:	48 89 dc             	mov    %rbx,%rsp
+}
+    109b:	90                   	nop
+    109c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+    10a0:	5b                   	pop    %rbx
+    10a1:	41 5c                	pop    %r12
+    10a3:	41 5d                	pop    %r13
+    10a5:	41 5e                	pop    %r14
+    10a7:	41 5f                	pop    %r15
+    10a9:	5d                   	pop    %rbp
+    10aa:	c3                   	ret
+
+00000000000010ab <copyonwriteforktest>:
+
+void
+copyonwriteforktest() {
+    10ab:	55                   	push   %rbp
+    10ac:	48 89 e5             	mov    %rsp,%rbp
+    10af:	48 83 ec 70          	sub    $0x70,%rsp
+  struct sys_info info1, info2, info3, info4;
+  int page200 = 200 * 4096;
+    10b3:	c7 45 f4 00 80 0c 00 	movl   $0xc8000,-0xc(%rbp)
+  char *a = sbrk(page200);
+    10ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    10bd:	89 c7                	mov    %eax,%edi
+    10bf:	e8 32 0b 00 00       	call   1bf6 <sbrk>
+    10c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  char b;
+  int j;
+
+  a[0] = 0;
+    10c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10cc:	c6 00 00             	movb   $0x0,(%rax)
+  printf(stdout, "copyonwriteforktest\n");
+    10cf:	8b 05 4b 18 00 00    	mov    0x184b(%rip),%eax        # 2920 <stdout>
+    10d5:	48 8d 15 5f 13 00 00 	lea    0x135f(%rip),%rdx        # 243b <malloc+0x5f2>
+    10dc:	48 89 d6             	mov    %rdx,%rsi
+    10df:	89 c7                	mov    %eax,%edi
+    10e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e6:	e8 dc 04 00 00       	call   15c7 <printf>
+  sysinfo(&info1);
+    10eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    10ef:	48 89 c7             	mov    %rax,%rdi
+    10f2:	e8 17 0b 00 00       	call   1c0e <sysinfo>
+  printf(stdout, "pages_in_use before copy-on-write fork = %d\n", info1.pages_in_use);
+    10f7:	8b 55 d0             	mov    -0x30(%rbp),%edx
+    10fa:	8b 05 20 18 00 00    	mov    0x1820(%rip),%eax        # 2920 <stdout>
+    1100:	48 8d 0d 49 13 00 00 	lea    0x1349(%rip),%rcx        # 2450 <malloc+0x607>
+    1107:	48 89 ce             	mov    %rcx,%rsi
+    110a:	89 c7                	mov    %eax,%edi
+    110c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1111:	e8 b1 04 00 00       	call   15c7 <printf>
+  printf(stdout, "pages_in_swap before copy-on-write fork = %d\n", info1.pages_in_swap);
+    1116:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+    1119:	8b 05 01 18 00 00    	mov    0x1801(%rip),%eax        # 2920 <stdout>
+    111f:	48 8d 0d 5a 13 00 00 	lea    0x135a(%rip),%rcx        # 2480 <malloc+0x637>
+    1126:	48 89 ce             	mov    %rcx,%rsi
+    1129:	89 c7                	mov    %eax,%edi
+    112b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1130:	e8 92 04 00 00       	call   15c7 <printf>
+  int pid = fork();
+    1135:	e8 2c 0a 00 00       	call   1b66 <fork>
+    113a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if (pid == 0) {
+    113d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    1141:	75 0f                	jne    1152 <copyonwriteforktest+0xa7>
+    sleep(100);
+    1143:	bf 64 00 00 00       	mov    $0x64,%edi
+    1148:	e8 b1 0a 00 00       	call   1bfe <sleep>
+    exit();
+    114d:	e8 1c 0a 00 00       	call   1b6e <exit>
+  } else {
+    sysinfo(&info2);
+    1152:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+    1156:	48 89 c7             	mov    %rax,%rdi
+    1159:	e8 b0 0a 00 00       	call   1c0e <sysinfo>
+    printf(stdout, "pages_in_use after copy-on-write fork = %d\n", info2.pages_in_use);
+    115e:	8b 55 bc             	mov    -0x44(%rbp),%edx
+    1161:	8b 05 b9 17 00 00    	mov    0x17b9(%rip),%eax        # 2920 <stdout>
+    1167:	48 8d 0d 42 13 00 00 	lea    0x1342(%rip),%rcx        # 24b0 <malloc+0x667>
+    116e:	48 89 ce             	mov    %rcx,%rsi
+    1171:	89 c7                	mov    %eax,%edi
+    1173:	b8 00 00 00 00       	mov    $0x0,%eax
+    1178:	e8 4a 04 00 00       	call   15c7 <printf>
+    printf(stdout, "pages_in_swap after copy-on-write fork = %d\n", info2.pages_in_swap);
+    117d:	8b 55 c0             	mov    -0x40(%rbp),%edx
+    1180:	8b 05 9a 17 00 00    	mov    0x179a(%rip),%eax        # 2920 <stdout>
+    1186:	48 8d 0d 53 13 00 00 	lea    0x1353(%rip),%rcx        # 24e0 <malloc+0x697>
+    118d:	48 89 ce             	mov    %rcx,%rsi
+    1190:	89 c7                	mov    %eax,%edi
+    1192:	b8 00 00 00 00       	mov    $0x0,%eax
+    1197:	e8 2b 04 00 00       	call   15c7 <printf>
+
+    // if copy-on-write is implemented, there is no way a new process can take more than 100 pages
+    if (info2.pages_in_use - info1.pages_in_use + info1.pages_in_swap - info2.pages_in_swap > 100)
+    119c:	8b 55 bc             	mov    -0x44(%rbp),%edx
+    119f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+    11a2:	29 c2                	sub    %eax,%edx
+    11a4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+    11a7:	01 c2                	add    %eax,%edx
+    11a9:	8b 45 c0             	mov    -0x40(%rbp),%eax
+    11ac:	29 c2                	sub    %eax,%edx
+    11ae:	83 fa 64             	cmp    $0x64,%edx
+    11b1:	7e 5c                	jle    120f <copyonwriteforktest+0x164>
+      error("too much memory is used for fork");
+    11b3:	8b 05 67 17 00 00    	mov    0x1767(%rip),%eax        # 2920 <stdout>
+    11b9:	ba 36 01 00 00       	mov    $0x136,%edx
+    11be:	48 8d 0d 29 0e 00 00 	lea    0xe29(%rip),%rcx        # 1fee <malloc+0x1a5>
+    11c5:	48 89 ce             	mov    %rcx,%rsi
+    11c8:	89 c7                	mov    %eax,%edi
+    11ca:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cf:	e8 f3 03 00 00       	call   15c7 <printf>
+    11d4:	8b 05 46 17 00 00    	mov    0x1746(%rip),%eax        # 2920 <stdout>
+    11da:	48 8d 15 2f 13 00 00 	lea    0x132f(%rip),%rdx        # 2510 <malloc+0x6c7>
+    11e1:	48 89 d6             	mov    %rdx,%rsi
+    11e4:	89 c7                	mov    %eax,%edi
+    11e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11eb:	e8 d7 03 00 00       	call   15c7 <printf>
+    11f0:	8b 05 2a 17 00 00    	mov    0x172a(%rip),%eax        # 2920 <stdout>
+    11f6:	48 8d 15 1d 0e 00 00 	lea    0xe1d(%rip),%rdx        # 201a <malloc+0x1d1>
+    11fd:	48 89 d6             	mov    %rdx,%rsi
+    1200:	89 c7                	mov    %eax,%edi
+    1202:	b8 00 00 00 00       	mov    $0x0,%eax
+    1207:	e8 bb 03 00 00       	call   15c7 <printf>
+    120c:	90                   	nop
+    120d:	eb fd                	jmp    120c <copyonwriteforktest+0x161>
+
+    for (j=0;j<200;j++) {
+    120f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    1216:	eb 1a                	jmp    1232 <copyonwriteforktest+0x187>
+      b = a[j * 4096];
+    1218:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    121b:	c1 e0 0c             	shl    $0xc,%eax
+    121e:	48 63 d0             	movslq %eax,%rdx
+    1221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1225:	48 01 d0             	add    %rdx,%rax
+    1228:	0f b6 00             	movzbl (%rax),%eax
+    122b:	88 45 ff             	mov    %al,-0x1(%rbp)
+    for (j=0;j<200;j++) {
+    122e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    1232:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    1239:	7e dd                	jle    1218 <copyonwriteforktest+0x16d>
+    }
+
+    sysinfo(&info3);
+    123b:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+    123f:	48 89 c7             	mov    %rax,%rdi
+    1242:	e8 c7 09 00 00       	call   1c0e <sysinfo>
+    printf(stdout, "pages_in_use after read = %d\n", info3.pages_in_use);
+    1247:	8b 55 a8             	mov    -0x58(%rbp),%edx
+    124a:	8b 05 d0 16 00 00    	mov    0x16d0(%rip),%eax        # 2920 <stdout>
+    1250:	48 8d 0d da 12 00 00 	lea    0x12da(%rip),%rcx        # 2531 <malloc+0x6e8>
+    1257:	48 89 ce             	mov    %rcx,%rsi
+    125a:	89 c7                	mov    %eax,%edi
+    125c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1261:	e8 61 03 00 00       	call   15c7 <printf>
+    printf(stdout, "pages_in_swap after read = %d\n", info3.pages_in_swap);
+    1266:	8b 55 ac             	mov    -0x54(%rbp),%edx
+    1269:	8b 05 b1 16 00 00    	mov    0x16b1(%rip),%eax        # 2920 <stdout>
+    126f:	48 8d 0d da 12 00 00 	lea    0x12da(%rip),%rcx        # 2550 <malloc+0x707>
+    1276:	48 89 ce             	mov    %rcx,%rsi
+    1279:	89 c7                	mov    %eax,%edi
+    127b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1280:	e8 42 03 00 00       	call   15c7 <printf>
+
+    // Read should not increase the amount of memory allocated
+    if (info3.pages_in_use - info2.pages_in_use + info3.pages_in_swap - info2.pages_in_swap > 100)
+    1285:	8b 55 a8             	mov    -0x58(%rbp),%edx
+    1288:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    128b:	29 c2                	sub    %eax,%edx
+    128d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+    1290:	01 c2                	add    %eax,%edx
+    1292:	8b 45 c0             	mov    -0x40(%rbp),%eax
+    1295:	29 c2                	sub    %eax,%edx
+    1297:	83 fa 64             	cmp    $0x64,%edx
+    129a:	7e 5c                	jle    12f8 <copyonwriteforktest+0x24d>
+      error("too much memory is used for read");
+    129c:	8b 05 7e 16 00 00    	mov    0x167e(%rip),%eax        # 2920 <stdout>
+    12a2:	ba 42 01 00 00       	mov    $0x142,%edx
+    12a7:	48 8d 0d 40 0d 00 00 	lea    0xd40(%rip),%rcx        # 1fee <malloc+0x1a5>
+    12ae:	48 89 ce             	mov    %rcx,%rsi
+    12b1:	89 c7                	mov    %eax,%edi
+    12b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b8:	e8 0a 03 00 00       	call   15c7 <printf>
+    12bd:	8b 05 5d 16 00 00    	mov    0x165d(%rip),%eax        # 2920 <stdout>
+    12c3:	48 8d 15 a6 12 00 00 	lea    0x12a6(%rip),%rdx        # 2570 <malloc+0x727>
+    12ca:	48 89 d6             	mov    %rdx,%rsi
+    12cd:	89 c7                	mov    %eax,%edi
+    12cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d4:	e8 ee 02 00 00       	call   15c7 <printf>
+    12d9:	8b 05 41 16 00 00    	mov    0x1641(%rip),%eax        # 2920 <stdout>
+    12df:	48 8d 15 34 0d 00 00 	lea    0xd34(%rip),%rdx        # 201a <malloc+0x1d1>
+    12e6:	48 89 d6             	mov    %rdx,%rsi
+    12e9:	89 c7                	mov    %eax,%edi
+    12eb:	b8 00 00 00 00       	mov    $0x0,%eax
+    12f0:	e8 d2 02 00 00       	call   15c7 <printf>
+    12f5:	90                   	nop
+    12f6:	eb fd                	jmp    12f5 <copyonwriteforktest+0x24a>
+
+    for (j=0;j<200;j++) {
+    12f8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+    12ff:	eb 1a                	jmp    131b <copyonwriteforktest+0x270>
+      a[j * 4096] = b;
+    1301:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1304:	c1 e0 0c             	shl    $0xc,%eax
+    1307:	48 63 d0             	movslq %eax,%rdx
+    130a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    130e:	48 01 c2             	add    %rax,%rdx
+    1311:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+    1315:	88 02                	mov    %al,(%rdx)
+    for (j=0;j<200;j++) {
+    1317:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    131b:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    1322:	7e dd                	jle    1301 <copyonwriteforktest+0x256>
+    }
+
+    sysinfo(&info4);
+    1324:	48 8d 45 94          	lea    -0x6c(%rbp),%rax
+    1328:	48 89 c7             	mov    %rax,%rdi
+    132b:	e8 de 08 00 00       	call   1c0e <sysinfo>
+    printf(stdout, "pages_in_use after write = %d\n", info4.pages_in_use);
+    1330:	8b 55 94             	mov    -0x6c(%rbp),%edx
+    1333:	8b 05 e7 15 00 00    	mov    0x15e7(%rip),%eax        # 2920 <stdout>
+    1339:	48 8d 0d 58 12 00 00 	lea    0x1258(%rip),%rcx        # 2598 <malloc+0x74f>
+    1340:	48 89 ce             	mov    %rcx,%rsi
+    1343:	89 c7                	mov    %eax,%edi
+    1345:	b8 00 00 00 00       	mov    $0x0,%eax
+    134a:	e8 78 02 00 00       	call   15c7 <printf>
+    printf(stdout, "pages_in_swap after write = %d\n", info4.pages_in_swap);
+    134f:	8b 55 98             	mov    -0x68(%rbp),%edx
+    1352:	8b 05 c8 15 00 00    	mov    0x15c8(%rip),%eax        # 2920 <stdout>
+    1358:	48 8d 0d 59 12 00 00 	lea    0x1259(%rip),%rcx        # 25b8 <malloc+0x76f>
+    135f:	48 89 ce             	mov    %rcx,%rsi
+    1362:	89 c7                	mov    %eax,%edi
+    1364:	b8 00 00 00 00       	mov    $0x0,%eax
+    1369:	e8 59 02 00 00       	call   15c7 <printf>
+
+    // Write should allocate the 200 pages of memory
+    if (info4.pages_in_use - info3.pages_in_use + info4.pages_in_swap - info3.pages_in_swap < 100)
+    136e:	8b 55 94             	mov    -0x6c(%rbp),%edx
+    1371:	8b 45 a8             	mov    -0x58(%rbp),%eax
+    1374:	29 c2                	sub    %eax,%edx
+    1376:	8b 45 98             	mov    -0x68(%rbp),%eax
+    1379:	01 c2                	add    %eax,%edx
+    137b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+    137e:	29 c2                	sub    %eax,%edx
+    1380:	83 fa 63             	cmp    $0x63,%edx
+    1383:	7f 5c                	jg     13e1 <copyonwriteforktest+0x336>
+      error("too less memory is used for write");
+    1385:	8b 05 95 15 00 00    	mov    0x1595(%rip),%eax        # 2920 <stdout>
+    138b:	ba 4e 01 00 00       	mov    $0x14e,%edx
+    1390:	48 8d 0d 57 0c 00 00 	lea    0xc57(%rip),%rcx        # 1fee <malloc+0x1a5>
+    1397:	48 89 ce             	mov    %rcx,%rsi
+    139a:	89 c7                	mov    %eax,%edi
+    139c:	b8 00 00 00 00       	mov    $0x0,%eax
+    13a1:	e8 21 02 00 00       	call   15c7 <printf>
+    13a6:	8b 05 74 15 00 00    	mov    0x1574(%rip),%eax        # 2920 <stdout>
+    13ac:	48 8d 15 25 12 00 00 	lea    0x1225(%rip),%rdx        # 25d8 <malloc+0x78f>
+    13b3:	48 89 d6             	mov    %rdx,%rsi
+    13b6:	89 c7                	mov    %eax,%edi
+    13b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13bd:	e8 05 02 00 00       	call   15c7 <printf>
+    13c2:	8b 05 58 15 00 00    	mov    0x1558(%rip),%eax        # 2920 <stdout>
+    13c8:	48 8d 15 4b 0c 00 00 	lea    0xc4b(%rip),%rdx        # 201a <malloc+0x1d1>
+    13cf:	48 89 d6             	mov    %rdx,%rsi
+    13d2:	89 c7                	mov    %eax,%edi
+    13d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    13d9:	e8 e9 01 00 00       	call   15c7 <printf>
+    13de:	90                   	nop
+    13df:	eb fd                	jmp    13de <copyonwriteforktest+0x333>
+
+    wait();
+    13e1:	e8 90 07 00 00       	call   1b76 <wait>
+  }
+
+  printf(stdout, "copyonwriteforktest passed\n");
+    13e6:	8b 05 34 15 00 00    	mov    0x1534(%rip),%eax        # 2920 <stdout>
+    13ec:	48 8d 15 07 12 00 00 	lea    0x1207(%rip),%rdx        # 25fa <malloc+0x7b1>
+    13f3:	48 89 d6             	mov    %rdx,%rsi
+    13f6:	89 c7                	mov    %eax,%edi
+    13f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    13fd:	e8 c5 01 00 00       	call   15c7 <printf>
+}
+    1402:	90                   	nop
+    1403:	c9                   	leave
+    1404:	c3                   	ret
+
+0000000000001405 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    1405:	55                   	push   %rbp
+    1406:	48 89 e5             	mov    %rsp,%rbp
+    1409:	48 83 ec 10          	sub    $0x10,%rsp
+    140d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1410:	89 f0                	mov    %esi,%eax
+    1412:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    1415:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1419:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    141c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1421:	48 89 ce             	mov    %rcx,%rsi
+    1424:	89 c7                	mov    %eax,%edi
+    1426:	e8 63 07 00 00       	call   1b8e <write>
+}
+    142b:	90                   	nop
+    142c:	c9                   	leave
+    142d:	c3                   	ret
+
+000000000000142e <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    142e:	55                   	push   %rbp
+    142f:	48 89 e5             	mov    %rsp,%rbp
+    1432:	48 83 ec 40          	sub    $0x40,%rsp
+    1436:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1439:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    143c:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    143f:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    1442:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1446:	74 1f                	je     1467 <printint64+0x39>
+    1448:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    144b:	c1 e8 1f             	shr    $0x1f,%eax
+    144e:	0f b6 c0             	movzbl %al,%eax
+    1451:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1454:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1458:	74 0d                	je     1467 <printint64+0x39>
+    x = -xx;
+    145a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    145d:	f7 d8                	neg    %eax
+    145f:	48 98                	cltq
+    1461:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1465:	eb 09                	jmp    1470 <printint64+0x42>
+  else
+    x = xx;
+    1467:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    146a:	48 98                	cltq
+    146c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1470:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    1477:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    147a:	48 63 c8             	movslq %eax,%rcx
+    147d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1481:	ba 00 00 00 00       	mov    $0x0,%edx
+    1486:	48 f7 f1             	div    %rcx
+    1489:	48 89 d1             	mov    %rdx,%rcx
+    148c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    148f:	8d 50 01             	lea    0x1(%rax),%edx
+    1492:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1495:	48 8d 15 94 14 00 00 	lea    0x1494(%rip),%rdx        # 2930 <digits.1>
+    149c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    14a0:	48 98                	cltq
+    14a2:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    14a6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    14a9:	48 63 f0             	movslq %eax,%rsi
+    14ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14b0:	ba 00 00 00 00       	mov    $0x0,%edx
+    14b5:	48 f7 f6             	div    %rsi
+    14b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    14bc:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    14c1:	75 b4                	jne    1477 <printint64+0x49>
+
+  if(sgn)
+    14c3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    14c7:	74 2b                	je     14f4 <printint64+0xc6>
+    buf[i++] = '-';
+    14c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14cc:	8d 50 01             	lea    0x1(%rax),%edx
+    14cf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    14d2:	48 98                	cltq
+    14d4:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    14d9:	eb 19                	jmp    14f4 <printint64+0xc6>
+    putc(fd, buf[i]);
+    14db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14de:	48 98                	cltq
+    14e0:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    14e5:	0f be d0             	movsbl %al,%edx
+    14e8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    14eb:	89 d6                	mov    %edx,%esi
+    14ed:	89 c7                	mov    %eax,%edi
+    14ef:	e8 11 ff ff ff       	call   1405 <putc>
+  while(--i >= 0)
+    14f4:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    14f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    14fc:	79 dd                	jns    14db <printint64+0xad>
+}
+    14fe:	90                   	nop
+    14ff:	90                   	nop
+    1500:	c9                   	leave
+    1501:	c3                   	ret
+
+0000000000001502 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1502:	55                   	push   %rbp
+    1503:	48 89 e5             	mov    %rsp,%rbp
+    1506:	48 83 ec 30          	sub    $0x30,%rsp
+    150a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    150d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1510:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1513:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1516:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    151d:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1521:	74 17                	je     153a <printint+0x38>
+    1523:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    1527:	79 11                	jns    153a <printint+0x38>
+    neg = 1;
+    1529:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1530:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1533:	f7 d8                	neg    %eax
+    1535:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1538:	eb 06                	jmp    1540 <printint+0x3e>
+  } else {
+    x = xx;
+    153a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    153d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1540:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    1547:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    154a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    154d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1552:	f7 f1                	div    %ecx
+    1554:	89 d1                	mov    %edx,%ecx
+    1556:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1559:	8d 50 01             	lea    0x1(%rax),%edx
+    155c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    155f:	89 c9                	mov    %ecx,%ecx
+    1561:	48 8d 15 e8 13 00 00 	lea    0x13e8(%rip),%rdx        # 2950 <digits.0>
+    1568:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    156c:	48 98                	cltq
+    156e:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1572:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1575:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1578:	ba 00 00 00 00       	mov    $0x0,%edx
+    157d:	f7 f6                	div    %esi
+    157f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1582:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1586:	75 bf                	jne    1547 <printint+0x45>
+  if(neg)
+    1588:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    158c:	74 2b                	je     15b9 <printint+0xb7>
+    buf[i++] = '-';
+    158e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1591:	8d 50 01             	lea    0x1(%rax),%edx
+    1594:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1597:	48 98                	cltq
+    1599:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    159e:	eb 19                	jmp    15b9 <printint+0xb7>
+    putc(fd, buf[i]);
+    15a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15a3:	48 98                	cltq
+    15a5:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    15aa:	0f be d0             	movsbl %al,%edx
+    15ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15b0:	89 d6                	mov    %edx,%esi
+    15b2:	89 c7                	mov    %eax,%edi
+    15b4:	e8 4c fe ff ff       	call   1405 <putc>
+  while(--i >= 0)
+    15b9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    15bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    15c1:	79 dd                	jns    15a0 <printint+0x9e>
+}
+    15c3:	90                   	nop
+    15c4:	90                   	nop
+    15c5:	c9                   	leave
+    15c6:	c3                   	ret
+
+00000000000015c7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    15c7:	55                   	push   %rbp
+    15c8:	48 89 e5             	mov    %rsp,%rbp
+    15cb:	48 83 ec 70          	sub    $0x70,%rsp
+    15cf:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    15d2:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    15d6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    15da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    15de:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    15e2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    15e6:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    15ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    15f1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    15f5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    15f9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    15fd:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1604:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    160b:	e9 6b 02 00 00       	jmp    187b <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1610:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1613:	48 63 d0             	movslq %eax,%rdx
+    1616:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    161a:	48 01 d0             	add    %rdx,%rax
+    161d:	0f b6 00             	movzbl (%rax),%eax
+    1620:	0f be c0             	movsbl %al,%eax
+    1623:	25 ff 00 00 00       	and    $0xff,%eax
+    1628:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    162b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    162f:	75 30                	jne    1661 <printf+0x9a>
+      if(c == '%'){
+    1631:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1635:	75 13                	jne    164a <printf+0x83>
+        state = '%';
+    1637:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    163e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1645:	e9 2d 02 00 00       	jmp    1877 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    164a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    164d:	0f be d0             	movsbl %al,%edx
+    1650:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1653:	89 d6                	mov    %edx,%esi
+    1655:	89 c7                	mov    %eax,%edi
+    1657:	e8 a9 fd ff ff       	call   1405 <putc>
+    165c:	e9 16 02 00 00       	jmp    1877 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    1661:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1665:	0f 85 0c 02 00 00    	jne    1877 <printf+0x2b0>
+      if(c == 'l') {
+    166b:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    166f:	75 0c                	jne    167d <printf+0xb6>
+        lflag = 1;
+    1671:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1678:	e9 fa 01 00 00       	jmp    1877 <printf+0x2b0>
+      } else if(c == 'd'){
+    167d:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1681:	0f 85 95 00 00 00    	jne    171c <printf+0x155>
+        if (lflag == 1)
+    1687:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    168b:	75 49                	jne    16d6 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    168d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1690:	83 f8 2f             	cmp    $0x2f,%eax
+    1693:	77 17                	ja     16ac <printf+0xe5>
+    1695:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1699:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    169c:	89 d2                	mov    %edx,%edx
+    169e:	48 01 d0             	add    %rdx,%rax
+    16a1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16a4:	83 c2 08             	add    $0x8,%edx
+    16a7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    16aa:	eb 0c                	jmp    16b8 <printf+0xf1>
+    16ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    16b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    16b4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    16b8:	48 8b 00             	mov    (%rax),%rax
+    16bb:	89 c6                	mov    %eax,%esi
+    16bd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    16c0:	b9 01 00 00 00       	mov    $0x1,%ecx
+    16c5:	ba 0a 00 00 00       	mov    $0xa,%edx
+    16ca:	89 c7                	mov    %eax,%edi
+    16cc:	e8 5d fd ff ff       	call   142e <printint64>
+    16d1:	e9 9a 01 00 00       	jmp    1870 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    16d6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    16d9:	83 f8 2f             	cmp    $0x2f,%eax
+    16dc:	77 17                	ja     16f5 <printf+0x12e>
+    16de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    16e2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16e5:	89 d2                	mov    %edx,%edx
+    16e7:	48 01 d0             	add    %rdx,%rax
+    16ea:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16ed:	83 c2 08             	add    $0x8,%edx
+    16f0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    16f3:	eb 0c                	jmp    1701 <printf+0x13a>
+    16f5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    16f9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    16fd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1701:	8b 30                	mov    (%rax),%esi
+    1703:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1706:	b9 01 00 00 00       	mov    $0x1,%ecx
+    170b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1710:	89 c7                	mov    %eax,%edi
+    1712:	e8 eb fd ff ff       	call   1502 <printint>
+    1717:	e9 54 01 00 00       	jmp    1870 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    171c:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1720:	74 0a                	je     172c <printf+0x165>
+    1722:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1726:	0f 85 95 00 00 00    	jne    17c1 <printf+0x1fa>
+        if (lflag == 1)
+    172c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1730:	75 49                	jne    177b <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1732:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1735:	83 f8 2f             	cmp    $0x2f,%eax
+    1738:	77 17                	ja     1751 <printf+0x18a>
+    173a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    173e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1741:	89 d2                	mov    %edx,%edx
+    1743:	48 01 d0             	add    %rdx,%rax
+    1746:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1749:	83 c2 08             	add    $0x8,%edx
+    174c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    174f:	eb 0c                	jmp    175d <printf+0x196>
+    1751:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1755:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1759:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    175d:	48 8b 00             	mov    (%rax),%rax
+    1760:	89 c6                	mov    %eax,%esi
+    1762:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1765:	b9 00 00 00 00       	mov    $0x0,%ecx
+    176a:	ba 10 00 00 00       	mov    $0x10,%edx
+    176f:	89 c7                	mov    %eax,%edi
+    1771:	e8 b8 fc ff ff       	call   142e <printint64>
+        if (lflag == 1)
+    1776:	e9 f5 00 00 00       	jmp    1870 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    177b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    177e:	83 f8 2f             	cmp    $0x2f,%eax
+    1781:	77 17                	ja     179a <printf+0x1d3>
+    1783:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1787:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    178a:	89 d2                	mov    %edx,%edx
+    178c:	48 01 d0             	add    %rdx,%rax
+    178f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1792:	83 c2 08             	add    $0x8,%edx
+    1795:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1798:	eb 0c                	jmp    17a6 <printf+0x1df>
+    179a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    179e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    17a2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    17a6:	8b 30                	mov    (%rax),%esi
+    17a8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    17ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+    17b0:	ba 10 00 00 00       	mov    $0x10,%edx
+    17b5:	89 c7                	mov    %eax,%edi
+    17b7:	e8 46 fd ff ff       	call   1502 <printint>
+        if (lflag == 1)
+    17bc:	e9 af 00 00 00       	jmp    1870 <printf+0x2a9>
+      } else if(c == 's'){
+    17c1:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    17c5:	75 6e                	jne    1835 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    17c7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    17ca:	83 f8 2f             	cmp    $0x2f,%eax
+    17cd:	77 17                	ja     17e6 <printf+0x21f>
+    17cf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    17d3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17d6:	89 d2                	mov    %edx,%edx
+    17d8:	48 01 d0             	add    %rdx,%rax
+    17db:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17de:	83 c2 08             	add    $0x8,%edx
+    17e1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    17e4:	eb 0c                	jmp    17f2 <printf+0x22b>
+    17e6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    17ea:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    17ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    17f2:	48 8b 00             	mov    (%rax),%rax
+    17f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    17f9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    17fe:	75 28                	jne    1828 <printf+0x261>
+          s = "(null)";
+    1800:	48 8d 05 0f 0e 00 00 	lea    0xe0f(%rip),%rax        # 2616 <malloc+0x7cd>
+    1807:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    180b:	eb 1b                	jmp    1828 <printf+0x261>
+          putc(fd, *s);
+    180d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1811:	0f b6 00             	movzbl (%rax),%eax
+    1814:	0f be d0             	movsbl %al,%edx
+    1817:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    181a:	89 d6                	mov    %edx,%esi
+    181c:	89 c7                	mov    %eax,%edi
+    181e:	e8 e2 fb ff ff       	call   1405 <putc>
+        for(; *s; s++)
+    1823:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1828:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    182c:	0f b6 00             	movzbl (%rax),%eax
+    182f:	84 c0                	test   %al,%al
+    1831:	75 da                	jne    180d <printf+0x246>
+    1833:	eb 3b                	jmp    1870 <printf+0x2a9>
+      } else if(c == '%'){
+    1835:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1839:	75 14                	jne    184f <printf+0x288>
+        putc(fd, c);
+    183b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    183e:	0f be d0             	movsbl %al,%edx
+    1841:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1844:	89 d6                	mov    %edx,%esi
+    1846:	89 c7                	mov    %eax,%edi
+    1848:	e8 b8 fb ff ff       	call   1405 <putc>
+    184d:	eb 21                	jmp    1870 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    184f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1852:	be 25 00 00 00       	mov    $0x25,%esi
+    1857:	89 c7                	mov    %eax,%edi
+    1859:	e8 a7 fb ff ff       	call   1405 <putc>
+        putc(fd, c);
+    185e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1861:	0f be d0             	movsbl %al,%edx
+    1864:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1867:	89 d6                	mov    %edx,%esi
+    1869:	89 c7                	mov    %eax,%edi
+    186b:	e8 95 fb ff ff       	call   1405 <putc>
+      }
+      state = 0;
+    1870:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1877:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    187b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    187e:	48 63 d0             	movslq %eax,%rdx
+    1881:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1885:	48 01 d0             	add    %rdx,%rax
+    1888:	0f b6 00             	movzbl (%rax),%eax
+    188b:	84 c0                	test   %al,%al
+    188d:	0f 85 7d fd ff ff    	jne    1610 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1893:	90                   	nop
+    1894:	90                   	nop
+    1895:	c9                   	leave
+    1896:	c3                   	ret
+
+0000000000001897 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    1897:	55                   	push   %rbp
+    1898:	48 89 e5             	mov    %rsp,%rbp
+    189b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    189f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    18a2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    18a5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    18a9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    18ac:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18af:	48 89 ce             	mov    %rcx,%rsi
+    18b2:	48 89 f7             	mov    %rsi,%rdi
+    18b5:	89 d1                	mov    %edx,%ecx
+    18b7:	fc                   	cld
+    18b8:	f3 aa                	rep stos %al,%es:(%rdi)
+    18ba:	89 ca                	mov    %ecx,%edx
+    18bc:	48 89 fe             	mov    %rdi,%rsi
+    18bf:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    18c3:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    18c6:	90                   	nop
+    18c7:	5d                   	pop    %rbp
+    18c8:	c3                   	ret
+
+00000000000018c9 <strcpy>:
+{
+    18c9:	55                   	push   %rbp
+    18ca:	48 89 e5             	mov    %rsp,%rbp
+    18cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    18d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    18dd:	90                   	nop
+    18de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    18e2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    18e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    18ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ee:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    18f2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    18f6:	0f b6 12             	movzbl (%rdx),%edx
+    18f9:	88 10                	mov    %dl,(%rax)
+    18fb:	0f b6 00             	movzbl (%rax),%eax
+    18fe:	84 c0                	test   %al,%al
+    1900:	75 dc                	jne    18de <strcpy+0x15>
+  return os;
+    1902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1906:	5d                   	pop    %rbp
+    1907:	c3                   	ret
+
+0000000000001908 <strcmp>:
+{
+    1908:	55                   	push   %rbp
+    1909:	48 89 e5             	mov    %rsp,%rbp
+    190c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1910:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1914:	eb 0a                	jmp    1920 <strcmp+0x18>
+    p++, q++;
+    1916:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    191b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1920:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1924:	0f b6 00             	movzbl (%rax),%eax
+    1927:	84 c0                	test   %al,%al
+    1929:	74 12                	je     193d <strcmp+0x35>
+    192b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    192f:	0f b6 10             	movzbl (%rax),%edx
+    1932:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1936:	0f b6 00             	movzbl (%rax),%eax
+    1939:	38 c2                	cmp    %al,%dl
+    193b:	74 d9                	je     1916 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    193d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1941:	0f b6 00             	movzbl (%rax),%eax
+    1944:	0f b6 d0             	movzbl %al,%edx
+    1947:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    194b:	0f b6 00             	movzbl (%rax),%eax
+    194e:	0f b6 c0             	movzbl %al,%eax
+    1951:	29 c2                	sub    %eax,%edx
+    1953:	89 d0                	mov    %edx,%eax
+}
+    1955:	5d                   	pop    %rbp
+    1956:	c3                   	ret
+
+0000000000001957 <strlen>:
+{
+    1957:	55                   	push   %rbp
+    1958:	48 89 e5             	mov    %rsp,%rbp
+    195b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    195f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1966:	eb 04                	jmp    196c <strlen+0x15>
+    1968:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    196c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    196f:	48 63 d0             	movslq %eax,%rdx
+    1972:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1976:	48 01 d0             	add    %rdx,%rax
+    1979:	0f b6 00             	movzbl (%rax),%eax
+    197c:	84 c0                	test   %al,%al
+    197e:	75 e8                	jne    1968 <strlen+0x11>
+  return n;
+    1980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1983:	5d                   	pop    %rbp
+    1984:	c3                   	ret
+
+0000000000001985 <memset>:
+{
+    1985:	55                   	push   %rbp
+    1986:	48 89 e5             	mov    %rsp,%rbp
+    1989:	48 83 ec 10          	sub    $0x10,%rsp
+    198d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1991:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1994:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1997:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    199a:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    199d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a1:	89 ce                	mov    %ecx,%esi
+    19a3:	48 89 c7             	mov    %rax,%rdi
+    19a6:	e8 ec fe ff ff       	call   1897 <stosb>
+  return dst;
+    19ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    19af:	c9                   	leave
+    19b0:	c3                   	ret
+
+00000000000019b1 <strchr>:
+{
+    19b1:	55                   	push   %rbp
+    19b2:	48 89 e5             	mov    %rsp,%rbp
+    19b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19b9:	89 f0                	mov    %esi,%eax
+    19bb:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    19be:	eb 17                	jmp    19d7 <strchr+0x26>
+    if(*s == c)
+    19c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c4:	0f b6 00             	movzbl (%rax),%eax
+    19c7:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    19ca:	75 06                	jne    19d2 <strchr+0x21>
+      return (char*)s;
+    19cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d0:	eb 15                	jmp    19e7 <strchr+0x36>
+  for(; *s; s++)
+    19d2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    19d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19db:	0f b6 00             	movzbl (%rax),%eax
+    19de:	84 c0                	test   %al,%al
+    19e0:	75 de                	jne    19c0 <strchr+0xf>
+  return 0;
+    19e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19e7:	5d                   	pop    %rbp
+    19e8:	c3                   	ret
+
+00000000000019e9 <gets>:
+gets(char *buf, int max)
+{
+    19e9:	55                   	push   %rbp
+    19ea:	48 89 e5             	mov    %rsp,%rbp
+    19ed:	48 83 ec 20          	sub    $0x20,%rsp
+    19f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19f5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    19f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    19ff:	eb 48                	jmp    1a49 <gets+0x60>
+    cc = read(0, &c, 1);
+    1a01:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1a05:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a0a:	48 89 c6             	mov    %rax,%rsi
+    1a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+    1a12:	e8 6f 01 00 00       	call   1b86 <read>
+    1a17:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1a1a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1a1e:	7e 36                	jle    1a56 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a23:	8d 50 01             	lea    0x1(%rax),%edx
+    1a26:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1a29:	48 63 d0             	movslq %eax,%rdx
+    1a2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a30:	48 01 c2             	add    %rax,%rdx
+    1a33:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a37:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1a39:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a3d:	3c 0a                	cmp    $0xa,%al
+    1a3f:	74 16                	je     1a57 <gets+0x6e>
+    1a41:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a45:	3c 0d                	cmp    $0xd,%al
+    1a47:	74 0e                	je     1a57 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1a49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a4c:	83 c0 01             	add    $0x1,%eax
+    1a4f:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1a52:	7f ad                	jg     1a01 <gets+0x18>
+    1a54:	eb 01                	jmp    1a57 <gets+0x6e>
+      break;
+    1a56:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1a57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a5a:	48 63 d0             	movslq %eax,%rdx
+    1a5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a61:	48 01 d0             	add    %rdx,%rax
+    1a64:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1a6b:	c9                   	leave
+    1a6c:	c3                   	ret
+
+0000000000001a6d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1a6d:	55                   	push   %rbp
+    1a6e:	48 89 e5             	mov    %rsp,%rbp
+    1a71:	48 83 ec 20          	sub    $0x20,%rsp
+    1a75:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a79:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1a7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a81:	be 00 00 00 00       	mov    $0x0,%esi
+    1a86:	48 89 c7             	mov    %rax,%rdi
+    1a89:	e8 20 01 00 00       	call   1bae <open>
+    1a8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1a91:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1a95:	79 07                	jns    1a9e <stat+0x31>
+    return -1;
+    1a97:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1a9c:	eb 21                	jmp    1abf <stat+0x52>
+  r = fstat(fd, st);
+    1a9e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1aa2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aa5:	48 89 d6             	mov    %rdx,%rsi
+    1aa8:	89 c7                	mov    %eax,%edi
+    1aaa:	e8 17 01 00 00       	call   1bc6 <fstat>
+    1aaf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1ab2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1ab5:	89 c7                	mov    %eax,%edi
+    1ab7:	e8 da 00 00 00       	call   1b96 <close>
+  return r;
+    1abc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1abf:	c9                   	leave
+    1ac0:	c3                   	ret
+
+0000000000001ac1 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1ac1:	55                   	push   %rbp
+    1ac2:	48 89 e5             	mov    %rsp,%rbp
+    1ac5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1ac9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1ad0:	eb 28                	jmp    1afa <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1ad2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ad5:	89 d0                	mov    %edx,%eax
+    1ad7:	c1 e0 02             	shl    $0x2,%eax
+    1ada:	01 d0                	add    %edx,%eax
+    1adc:	01 c0                	add    %eax,%eax
+    1ade:	89 c1                	mov    %eax,%ecx
+    1ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1ae8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1aec:	0f b6 00             	movzbl (%rax),%eax
+    1aef:	0f be c0             	movsbl %al,%eax
+    1af2:	01 c8                	add    %ecx,%eax
+    1af4:	83 e8 30             	sub    $0x30,%eax
+    1af7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1afa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1afe:	0f b6 00             	movzbl (%rax),%eax
+    1b01:	3c 2f                	cmp    $0x2f,%al
+    1b03:	7e 0b                	jle    1b10 <atoi+0x4f>
+    1b05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b09:	0f b6 00             	movzbl (%rax),%eax
+    1b0c:	3c 39                	cmp    $0x39,%al
+    1b0e:	7e c2                	jle    1ad2 <atoi+0x11>
+  return n;
+    1b10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1b13:	5d                   	pop    %rbp
+    1b14:	c3                   	ret
+
+0000000000001b15 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1b15:	55                   	push   %rbp
+    1b16:	48 89 e5             	mov    %rsp,%rbp
+    1b19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b1d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1b21:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1b2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b30:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1b34:	eb 1d                	jmp    1b53 <memmove+0x3e>
+    *dst++ = *src++;
+    1b36:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b3a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1b3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b46:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1b4a:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1b4e:	0f b6 12             	movzbl (%rdx),%edx
+    1b51:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1b53:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b56:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1b59:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1b5c:	85 c0                	test   %eax,%eax
+    1b5e:	7f d6                	jg     1b36 <memmove+0x21>
+  return vdst;
+    1b60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b64:	5d                   	pop    %rbp
+    1b65:	c3                   	ret
+
+0000000000001b66 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1b66:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b6b:	cd 40                	int    $0x40
+    1b6d:	c3                   	ret
+
+0000000000001b6e <exit>:
+SYSCALL(exit)
+    1b6e:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b73:	cd 40                	int    $0x40
+    1b75:	c3                   	ret
+
+0000000000001b76 <wait>:
+SYSCALL(wait)
+    1b76:	b8 03 00 00 00       	mov    $0x3,%eax
+    1b7b:	cd 40                	int    $0x40
+    1b7d:	c3                   	ret
+
+0000000000001b7e <pipe>:
+SYSCALL(pipe)
+    1b7e:	b8 04 00 00 00       	mov    $0x4,%eax
+    1b83:	cd 40                	int    $0x40
+    1b85:	c3                   	ret
+
+0000000000001b86 <read>:
+SYSCALL(read)
+    1b86:	b8 05 00 00 00       	mov    $0x5,%eax
+    1b8b:	cd 40                	int    $0x40
+    1b8d:	c3                   	ret
+
+0000000000001b8e <write>:
+SYSCALL(write)
+    1b8e:	b8 10 00 00 00       	mov    $0x10,%eax
+    1b93:	cd 40                	int    $0x40
+    1b95:	c3                   	ret
+
+0000000000001b96 <close>:
+SYSCALL(close)
+    1b96:	b8 15 00 00 00       	mov    $0x15,%eax
+    1b9b:	cd 40                	int    $0x40
+    1b9d:	c3                   	ret
+
+0000000000001b9e <kill>:
+SYSCALL(kill)
+    1b9e:	b8 06 00 00 00       	mov    $0x6,%eax
+    1ba3:	cd 40                	int    $0x40
+    1ba5:	c3                   	ret
+
+0000000000001ba6 <exec>:
+SYSCALL(exec)
+    1ba6:	b8 07 00 00 00       	mov    $0x7,%eax
+    1bab:	cd 40                	int    $0x40
+    1bad:	c3                   	ret
+
+0000000000001bae <open>:
+SYSCALL(open)
+    1bae:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1bb3:	cd 40                	int    $0x40
+    1bb5:	c3                   	ret
+
+0000000000001bb6 <mknod>:
+SYSCALL(mknod)
+    1bb6:	b8 11 00 00 00       	mov    $0x11,%eax
+    1bbb:	cd 40                	int    $0x40
+    1bbd:	c3                   	ret
+
+0000000000001bbe <unlink>:
+SYSCALL(unlink)
+    1bbe:	b8 12 00 00 00       	mov    $0x12,%eax
+    1bc3:	cd 40                	int    $0x40
+    1bc5:	c3                   	ret
+
+0000000000001bc6 <fstat>:
+SYSCALL(fstat)
+    1bc6:	b8 08 00 00 00       	mov    $0x8,%eax
+    1bcb:	cd 40                	int    $0x40
+    1bcd:	c3                   	ret
+
+0000000000001bce <link>:
+SYSCALL(link)
+    1bce:	b8 13 00 00 00       	mov    $0x13,%eax
+    1bd3:	cd 40                	int    $0x40
+    1bd5:	c3                   	ret
+
+0000000000001bd6 <mkdir>:
+SYSCALL(mkdir)
+    1bd6:	b8 14 00 00 00       	mov    $0x14,%eax
+    1bdb:	cd 40                	int    $0x40
+    1bdd:	c3                   	ret
+
+0000000000001bde <chdir>:
+SYSCALL(chdir)
+    1bde:	b8 09 00 00 00       	mov    $0x9,%eax
+    1be3:	cd 40                	int    $0x40
+    1be5:	c3                   	ret
+
+0000000000001be6 <dup>:
+SYSCALL(dup)
+    1be6:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1beb:	cd 40                	int    $0x40
+    1bed:	c3                   	ret
+
+0000000000001bee <getpid>:
+SYSCALL(getpid)
+    1bee:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1bf3:	cd 40                	int    $0x40
+    1bf5:	c3                   	ret
+
+0000000000001bf6 <sbrk>:
+SYSCALL(sbrk)
+    1bf6:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1bfb:	cd 40                	int    $0x40
+    1bfd:	c3                   	ret
+
+0000000000001bfe <sleep>:
+SYSCALL(sleep)
+    1bfe:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1c03:	cd 40                	int    $0x40
+    1c05:	c3                   	ret
+
+0000000000001c06 <uptime>:
+SYSCALL(uptime)
+    1c06:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1c0b:	cd 40                	int    $0x40
+    1c0d:	c3                   	ret
+
+0000000000001c0e <sysinfo>:
+SYSCALL(sysinfo)
+    1c0e:	b8 16 00 00 00       	mov    $0x16,%eax
+    1c13:	cd 40                	int    $0x40
+    1c15:	c3                   	ret
+
+0000000000001c16 <mmap>:
+SYSCALL(mmap)
+    1c16:	b8 17 00 00 00       	mov    $0x17,%eax
+    1c1b:	cd 40                	int    $0x40
+    1c1d:	c3                   	ret
+
+0000000000001c1e <munmap>:
+SYSCALL(munmap)
+    1c1e:	b8 18 00 00 00       	mov    $0x18,%eax
+    1c23:	cd 40                	int    $0x40
+    1c25:	c3                   	ret
+
+0000000000001c26 <crashn>:
+SYSCALL(crashn)
+    1c26:	b8 19 00 00 00       	mov    $0x19,%eax
+    1c2b:	cd 40                	int    $0x40
+    1c2d:	c3                   	ret
+
+0000000000001c2e <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1c2e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1c33:	cd 40                	int    $0x40
+    1c35:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c38:	74 02                	je     1c3c <mmap2+0xe>
+    1c3a:	89 c0                	mov    %eax,%eax
+    1c3c:	c3                   	ret
+
+0000000000001c3d <munmap2>:
+SYSCALL(munmap2)
+    1c3d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1c42:	cd 40                	int    $0x40
+    1c44:	c3                   	ret
+
+0000000000001c45 <msync>:
+SYSCALL(msync)
+    1c45:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1c4a:	cd 40                	int    $0x40
+    1c4c:	c3                   	ret
+
+0000000000001c4d <sendfile>:
+SYSCALL(sendfile)
+    1c4d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1c52:	cd 40                	int    $0x40
+    1c54:	c3                   	ret
+
+0000000000001c55 <splice>:
+SYSCALL(splice)
+    1c55:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1c5a:	cd 40                	int    $0x40
+    1c5c:	c3                   	ret
+
+0000000000001c5d <pread>:
+SYSCALL(pread)
+    1c5d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1c62:	cd 40                	int    $0x40
+    1c64:	c3                   	ret
+
+0000000000001c65 <pwrite>:
+SYSCALL(pwrite)
+    1c65:	b8 20 00 00 00       	mov    $0x20,%eax
+    1c6a:	cd 40                	int    $0x40
+    1c6c:	c3                   	ret
+
+0000000000001c6d <readv>:
+SYSCALL(readv)
+    1c6d:	b8 21 00 00 00       	mov    $0x21,%eax
+    1c72:	cd 40                	int    $0x40
+    1c74:	c3                   	ret
+
+0000000000001c75 <writev>:
+SYSCALL(writev)
+    1c75:	b8 22 00 00 00       	mov    $0x22,%eax
+    1c7a:	cd 40                	int    $0x40
+    1c7c:	c3                   	ret
+
+0000000000001c7d <poll>:
+SYSCALL(poll)
+    1c7d:	b8 23 00 00 00       	mov    $0x23,%eax
+    1c82:	cd 40                	int    $0x40
+    1c84:	c3                   	ret
+
+0000000000001c85 <pipe2>:
+SYSCALL(pipe2)
+    1c85:	b8 24 00 00 00       	mov    $0x24,%eax
+    1c8a:	cd 40                	int    $0x40
+    1c8c:	c3                   	ret
+
+0000000000001c8d <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1c8d:	55                   	push   %rbp
+    1c8e:	48 89 e5             	mov    %rsp,%rbp
+    1c91:	48 83 ec 20          	sub    $0x20,%rsp
+    1c95:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1c9d:	48 83 e8 10          	sub    $0x10,%rax
+    1ca1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1ca5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ca9:	48 8b 10             	mov    (%rax),%rdx
+    1cac:	48 8d 05 dd 0c 00 00 	lea    0xcdd(%rip),%rax        # 2990 <bigblock>
+    1cb3:	48 39 c2             	cmp    %rax,%rdx
+    1cb6:	75 1f                	jne    1cd7 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1cb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cbc:	8b 40 08             	mov    0x8(%rax),%eax
+    1cbf:	c1 e0 04             	shl    $0x4,%eax
+    1cc2:	89 c2                	mov    %eax,%edx
+    1cc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cc8:	89 d6                	mov    %edx,%esi
+    1cca:	48 89 c7             	mov    %rax,%rdi
+    1ccd:	e8 6b ff ff ff       	call   1c3d <munmap2>
+    return;
+    1cd2:	e9 0b 01 00 00       	jmp    1de2 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1cd7:	48 8b 05 a2 0c 00 00 	mov    0xca2(%rip),%rax        # 2980 <freep>
+    1cde:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ce2:	eb 2f                	jmp    1d13 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ce8:	48 8b 00             	mov    (%rax),%rax
+    1ceb:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1cef:	72 17                	jb     1d08 <free+0x7b>
+    1cf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cf5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1cf9:	72 2f                	jb     1d2a <free+0x9d>
+    1cfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cff:	48 8b 00             	mov    (%rax),%rax
+    1d02:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d06:	72 22                	jb     1d2a <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d0c:	48 8b 00             	mov    (%rax),%rax
+    1d0f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d17:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d1b:	73 c7                	jae    1ce4 <free+0x57>
+    1d1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d21:	48 8b 00             	mov    (%rax),%rax
+    1d24:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d28:	73 ba                	jae    1ce4 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1d2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d2e:	8b 40 08             	mov    0x8(%rax),%eax
+    1d31:	89 c0                	mov    %eax,%eax
+    1d33:	48 c1 e0 04          	shl    $0x4,%rax
+    1d37:	48 89 c2             	mov    %rax,%rdx
+    1d3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d3e:	48 01 c2             	add    %rax,%rdx
+    1d41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d45:	48 8b 00             	mov    (%rax),%rax
+    1d48:	48 39 c2             	cmp    %rax,%rdx
+    1d4b:	75 2d                	jne    1d7a <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d51:	8b 50 08             	mov    0x8(%rax),%edx
+    1d54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d58:	48 8b 00             	mov    (%rax),%rax
+    1d5b:	8b 40 08             	mov    0x8(%rax),%eax
+    1d5e:	01 c2                	add    %eax,%edx
+    1d60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d64:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1d67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d6b:	48 8b 00             	mov    (%rax),%rax
+    1d6e:	48 8b 10             	mov    (%rax),%rdx
+    1d71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d75:	48 89 10             	mov    %rdx,(%rax)
+    1d78:	eb 0e                	jmp    1d88 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1d7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d7e:	48 8b 10             	mov    (%rax),%rdx
+    1d81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d85:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1d88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d8c:	8b 40 08             	mov    0x8(%rax),%eax
+    1d8f:	89 c0                	mov    %eax,%eax
+    1d91:	48 c1 e0 04          	shl    $0x4,%rax
+    1d95:	48 89 c2             	mov    %rax,%rdx
+    1d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d9c:	48 01 d0             	add    %rdx,%rax
+    1d9f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1da3:	75 27                	jne    1dcc <free+0x13f>
+    p->s.size += bp->s.size;
+    1da5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da9:	8b 50 08             	mov    0x8(%rax),%edx
+    1dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db0:	8b 40 08             	mov    0x8(%rax),%eax
+    1db3:	01 c2                	add    %eax,%edx
+    1db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1db9:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1dbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc0:	48 8b 10             	mov    (%rax),%rdx
+    1dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dc7:	48 89 10             	mov    %rdx,(%rax)
+    1dca:	eb 0b                	jmp    1dd7 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1dcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1dd4:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ddb:	48 89 05 9e 0b 00 00 	mov    %rax,0xb9e(%rip)        # 2980 <freep>
+}
+    1de2:	c9                   	leave
+    1de3:	c3                   	ret
+
+0000000000001de4 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1de4:	55                   	push   %rbp
+    1de5:	48 89 e5             	mov    %rsp,%rbp
+    1de8:	48 83 ec 20          	sub    $0x20,%rsp
+    1dec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1def:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1df6:	77 07                	ja     1dff <morecore+0x1b>
+    nu = 4096;
+    1df8:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1dff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e02:	c1 e0 04             	shl    $0x4,%eax
+    1e05:	89 c7                	mov    %eax,%edi
+    1e07:	e8 ea fd ff ff       	call   1bf6 <sbrk>
+    1e0c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1e10:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1e15:	75 07                	jne    1e1e <morecore+0x3a>
+    return 0;
+    1e17:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e1c:	eb 29                	jmp    1e47 <morecore+0x63>
+  hp = (Header*)p;
+    1e1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e22:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1e26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e2a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1e2d:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1e30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e34:	48 83 c0 10          	add    $0x10,%rax
+    1e38:	48 89 c7             	mov    %rax,%rdi
+    1e3b:	e8 4d fe ff ff       	call   1c8d <free>
+  return freep;
+    1e40:	48 8b 05 39 0b 00 00 	mov    0xb39(%rip),%rax        # 2980 <freep>
+}
+    1e47:	c9                   	leave
+    1e48:	c3                   	ret
+
+0000000000001e49 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e49:	55                   	push   %rbp
+    1e4a:	48 89 e5             	mov    %rsp,%rbp
+    1e4d:	48 83 ec 30          	sub    $0x30,%rsp
+    1e51:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1e54:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e57:	48 83 c0 0f          	add    $0xf,%rax
+    1e5b:	48 c1 e8 04          	shr    $0x4,%rax
+    1e5f:	83 c0 01             	add    $0x1,%eax
+    1e62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1e65:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1e6c:	76 62                	jbe    1ed0 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1e6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e71:	c1 e0 04             	shl    $0x4,%eax
+    1e74:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1e7a:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1e80:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1e85:	ba 03 00 00 00       	mov    $0x3,%edx
+    1e8a:	89 c6                	mov    %eax,%esi
+    1e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+    1e91:	e8 98 fd ff ff       	call   1c2e <mmap2>
+    1e96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1e9a:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1e9f:	75 0a                	jne    1eab <malloc+0x62>
+      return 0;
+    1ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ea6:	e9 1c 01 00 00       	jmp    1fc7 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1eab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eaf:	48 8d 15 da 0a 00 00 	lea    0xada(%rip),%rdx        # 2990 <bigblock>
+    1eb6:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1eb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ebd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1ec0:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1ec3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ec7:	48 83 c0 10          	add    $0x10,%rax
+    1ecb:	e9 f7 00 00 00       	jmp    1fc7 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1ed0:	48 8b 05 a9 0a 00 00 	mov    0xaa9(%rip),%rax        # 2980 <freep>
+    1ed7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1edb:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ee0:	75 2e                	jne    1f10 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1ee2:	48 8d 05 87 0a 00 00 	lea    0xa87(%rip),%rax        # 2970 <base>
+    1ee9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1eed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ef1:	48 89 05 88 0a 00 00 	mov    %rax,0xa88(%rip)        # 2980 <freep>
+    1ef8:	48 8b 05 81 0a 00 00 	mov    0xa81(%rip),%rax        # 2980 <freep>
+    1eff:	48 89 05 6a 0a 00 00 	mov    %rax,0xa6a(%rip)        # 2970 <base>
+    base.s.size = 0;
+    1f06:	c7 05 68 0a 00 00 00 	movl   $0x0,0xa68(%rip)        # 2978 <base+0x8>
+    1f0d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1f10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f14:	48 8b 00             	mov    (%rax),%rax
+    1f17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1f1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f1f:	8b 40 08             	mov    0x8(%rax),%eax
+    1f22:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1f25:	72 5f                	jb     1f86 <malloc+0x13d>
+      if(p->s.size == nunits)
+    1f27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f2b:	8b 40 08             	mov    0x8(%rax),%eax
+    1f2e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1f31:	75 10                	jne    1f43 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1f33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f37:	48 8b 10             	mov    (%rax),%rdx
+    1f3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f3e:	48 89 10             	mov    %rdx,(%rax)
+    1f41:	eb 2e                	jmp    1f71 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1f43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f47:	8b 40 08             	mov    0x8(%rax),%eax
+    1f4a:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1f4d:	89 c2                	mov    %eax,%edx
+    1f4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f53:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1f56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5a:	8b 40 08             	mov    0x8(%rax),%eax
+    1f5d:	89 c0                	mov    %eax,%eax
+    1f5f:	48 c1 e0 04          	shl    $0x4,%rax
+    1f63:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1f67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f6b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1f6e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1f71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f75:	48 89 05 04 0a 00 00 	mov    %rax,0xa04(%rip)        # 2980 <freep>
+      return (void*)(p + 1);
+    1f7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f80:	48 83 c0 10          	add    $0x10,%rax
+    1f84:	eb 41                	jmp    1fc7 <malloc+0x17e>
+    }
+    if(p == freep)
+    1f86:	48 8b 05 f3 09 00 00 	mov    0x9f3(%rip),%rax        # 2980 <freep>
+    1f8d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f91:	75 1c                	jne    1faf <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1f93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f96:	89 c7                	mov    %eax,%edi
+    1f98:	e8 47 fe ff ff       	call   1de4 <morecore>
+    1f9d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1fa1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1fa6:	75 07                	jne    1faf <malloc+0x166>
+        return 0;
+    1fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fad:	eb 18                	jmp    1fc7 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1faf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1fb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fbb:	48 8b 00             	mov    (%rax),%rax
+    1fbe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1fc2:	e9 54 ff ff ff       	jmp    1f1b <malloc+0xd2>
+  }
+}
+    1fc7:	c9                   	leave
+    1fc8:	c3                   	ret
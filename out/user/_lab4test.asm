@@ -0,0 +1,1811 @@
+
+out/user/_lab4test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <swaptest>:
+    while(1) {} \
+  } while (0)
+
+void
+swaptest(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 60          	sub    $0x60,%rsp
+  char *start = sbrk(0);
+       8:	bf 00 00 00 00       	mov    $0x0,%edi
+       d:	e8 86 0c 00 00       	call   c98 <sbrk>
+      12:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  char *a;
+  int i;
+  int b = 4096;
+      16:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  int num_pages_to_alloc = 6000;
+      1d:	c7 45 e8 70 17 00 00 	movl   $0x1770,-0x18(%rbp)
+  struct sys_info info1, info2, info3;
+
+  for(i = 0; i < num_pages_to_alloc; i++){
+      24:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      2b:	eb 70                	jmp    9d <swaptest+0x9d>
+    a = sbrk(b);
+      2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      30:	89 c7                	mov    %eax,%edi
+      32:	e8 61 0c 00 00       	call   c98 <sbrk>
+      37:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if (a == (char*)-1) {
+      3b:	48 83 7d e0 ff       	cmpq   $0xffffffffffffffff,-0x20(%rbp)
+      40:	75 1e                	jne    60 <swaptest+0x60>
+      printf(stdout, "no more memory\n");
+      42:	8b 05 d8 13 00 00    	mov    0x13d8(%rip),%eax        # 1420 <stdout>
+      48:	48 8d 15 21 10 00 00 	lea    0x1021(%rip),%rdx        # 1070 <malloc+0x185>
+      4f:	48 89 d6             	mov    %rdx,%rsi
+      52:	89 c7                	mov    %eax,%edi
+      54:	b8 00 00 00 00       	mov    $0x0,%eax
+      59:	e8 0b 06 00 00       	call   669 <printf>
+      break;
+      5e:	eb 45                	jmp    a5 <swaptest+0xa5>
+    }
+    memset(a, 0, b);
+      60:	8b 55 ec             	mov    -0x14(%rbp),%edx
+      63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      67:	be 00 00 00 00       	mov    $0x0,%esi
+      6c:	48 89 c7             	mov    %rax,%rdi
+      6f:	e8 b3 09 00 00       	call   a27 <memset>
+    *(int*)a = i;
+      74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      78:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      7b:	89 10                	mov    %edx,(%rax)
+    printf(stdout, "%d pages allocated\n");
+      7d:	8b 05 9d 13 00 00    	mov    0x139d(%rip),%eax        # 1420 <stdout>
+      83:	48 8d 15 f6 0f 00 00 	lea    0xff6(%rip),%rdx        # 1080 <malloc+0x195>
+      8a:	48 89 d6             	mov    %rdx,%rsi
+      8d:	89 c7                	mov    %eax,%edi
+      8f:	b8 00 00 00 00       	mov    $0x0,%eax
+      94:	e8 d0 05 00 00       	call   669 <printf>
+  for(i = 0; i < num_pages_to_alloc; i++){
+      99:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      a0:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+      a3:	7c 88                	jl     2d <swaptest+0x2d>
+  }
+
+  sysinfo(&info1);
+      a5:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+      a9:	48 89 c7             	mov    %rax,%rdi
+      ac:	e8 ff 0b 00 00       	call   cb0 <sysinfo>
+
+  // check whether memory data is consistent
+  for(i = 0; i < num_pages_to_alloc; i++){
+      b1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      b8:	e9 aa 00 00 00       	jmp    167 <swaptest+0x167>
+    printf(stdout, "%d\n", i);
+      bd:	8b 05 5d 13 00 00    	mov    0x135d(%rip),%eax        # 1420 <stdout>
+      c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      c6:	48 8d 0d c7 0f 00 00 	lea    0xfc7(%rip),%rcx        # 1094 <malloc+0x1a9>
+      cd:	48 89 ce             	mov    %rcx,%rsi
+      d0:	89 c7                	mov    %eax,%edi
+      d2:	b8 00 00 00 00       	mov    $0x0,%eax
+      d7:	e8 8d 05 00 00       	call   669 <printf>
+    if (*(int*)(start + i*b) != i) {
+      dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      df:	0f af 45 ec          	imul   -0x14(%rbp),%eax
+      e3:	48 63 d0             	movslq %eax,%rdx
+      e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+      ea:	48 01 d0             	add    %rdx,%rax
+      ed:	8b 00                	mov    (%rax),%eax
+      ef:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+      f2:	74 6f                	je     163 <swaptest+0x163>
+      error("data is incorrect, should be %d, but %d\n", i, *(int*)(start + i*b));
+      f4:	8b 05 26 13 00 00    	mov    0x1326(%rip),%eax        # 1420 <stdout>
+      fa:	ba 2e 00 00 00       	mov    $0x2e,%edx
+      ff:	48 8d 0d 92 0f 00 00 	lea    0xf92(%rip),%rcx        # 1098 <malloc+0x1ad>
+     106:	48 89 ce             	mov    %rcx,%rsi
+     109:	89 c7                	mov    %eax,%edi
+     10b:	b8 00 00 00 00       	mov    $0x0,%eax
+     110:	e8 54 05 00 00       	call   669 <printf>
+     115:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     118:	0f af 45 ec          	imul   -0x14(%rbp),%eax
+     11c:	48 63 d0             	movslq %eax,%rdx
+     11f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     123:	48 01 d0             	add    %rdx,%rax
+     126:	8b 08                	mov    (%rax),%ecx
+     128:	8b 05 f2 12 00 00    	mov    0x12f2(%rip),%eax        # 1420 <stdout>
+     12e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     131:	48 8d 35 78 0f 00 00 	lea    0xf78(%rip),%rsi        # 10b0 <malloc+0x1c5>
+     138:	89 c7                	mov    %eax,%edi
+     13a:	b8 00 00 00 00       	mov    $0x0,%eax
+     13f:	e8 25 05 00 00       	call   669 <printf>
+     144:	8b 05 d6 12 00 00    	mov    0x12d6(%rip),%eax        # 1420 <stdout>
+     14a:	48 8d 15 88 0f 00 00 	lea    0xf88(%rip),%rdx        # 10d9 <malloc+0x1ee>
+     151:	48 89 d6             	mov    %rdx,%rsi
+     154:	89 c7                	mov    %eax,%edi
+     156:	b8 00 00 00 00       	mov    $0x0,%eax
+     15b:	e8 09 05 00 00       	call   669 <printf>
+     160:	90                   	nop
+     161:	eb fd                	jmp    160 <swaptest+0x160>
+  for(i = 0; i < num_pages_to_alloc; i++){
+     163:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     167:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     16a:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     16d:	0f 8c 4a ff ff ff    	jl     bd <swaptest+0xbd>
+    }
+  }
+
+  sysinfo(&info2);
+     173:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+     177:	48 89 c7             	mov    %rax,%rdi
+     17a:	e8 31 0b 00 00       	call   cb0 <sysinfo>
+
+  printf(stdout, "number of disk reads = %d\n", info2.num_disk_reads - info1.num_disk_reads);
+     17f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+     182:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     185:	29 c2                	sub    %eax,%edx
+     187:	8b 05 93 12 00 00    	mov    0x1293(%rip),%eax        # 1420 <stdout>
+     18d:	48 8d 0d 47 0f 00 00 	lea    0xf47(%rip),%rcx        # 10db <malloc+0x1f0>
+     194:	48 89 ce             	mov    %rcx,%rsi
+     197:	89 c7                	mov    %eax,%edi
+     199:	b8 00 00 00 00       	mov    $0x0,%eax
+     19e:	e8 c6 04 00 00       	call   669 <printf>
+
+  for(i = 0; i < num_pages_to_alloc; i++){
+     1a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     1aa:	eb 10                	jmp    1bc <swaptest+0x1bc>
+    sbrk(-b);
+     1ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1af:	f7 d8                	neg    %eax
+     1b1:	89 c7                	mov    %eax,%edi
+     1b3:	e8 e0 0a 00 00       	call   c98 <sbrk>
+  for(i = 0; i < num_pages_to_alloc; i++){
+     1b8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     1bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1bf:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+     1c2:	7c e8                	jl     1ac <swaptest+0x1ac>
+  }
+
+  sysinfo(&info3);
+     1c4:	48 8d 45 a4          	lea    -0x5c(%rbp),%rax
+     1c8:	48 89 c7             	mov    %rax,%rdi
+     1cb:	e8 e0 0a 00 00       	call   cb0 <sysinfo>
+  printf(stdout, "number of pages in swap = %d\n", info3.pages_in_swap);
+     1d0:	8b 55 a8             	mov    -0x58(%rbp),%edx
+     1d3:	8b 05 47 12 00 00    	mov    0x1247(%rip),%eax        # 1420 <stdout>
+     1d9:	48 8d 0d 16 0f 00 00 	lea    0xf16(%rip),%rcx        # 10f6 <malloc+0x20b>
+     1e0:	48 89 ce             	mov    %rcx,%rsi
+     1e3:	89 c7                	mov    %eax,%edi
+     1e5:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ea:	e8 7a 04 00 00       	call   669 <printf>
+
+  printf(stdout, "swaptest OK\n");
+     1ef:	8b 05 2b 12 00 00    	mov    0x122b(%rip),%eax        # 1420 <stdout>
+     1f5:	48 8d 15 18 0f 00 00 	lea    0xf18(%rip),%rdx        # 1114 <malloc+0x229>
+     1fc:	48 89 d6             	mov    %rdx,%rsi
+     1ff:	89 c7                	mov    %eax,%edi
+     201:	b8 00 00 00 00       	mov    $0x0,%eax
+     206:	e8 5e 04 00 00       	call   669 <printf>
+}
+     20b:	90                   	nop
+     20c:	c9                   	leave
+     20d:	c3                   	ret
+
+000000000000020e <localitytest>:
+
+void
+localitytest(void)
+{
+     20e:	55                   	push   %rbp
+     20f:	48 89 e5             	mov    %rsp,%rbp
+     212:	48 83 ec 60          	sub    $0x60,%rsp
+  char *start = sbrk(0);
+     216:	bf 00 00 00 00       	mov    $0x0,%edi
+     21b:	e8 78 0a 00 00       	call   c98 <sbrk>
+     220:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  char *a;
+  int i,j,k;
+  int b = 4096;
+     224:	c7 45 e4 00 10 00 00 	movl   $0x1000,-0x1c(%rbp)
+  int groups = 6;
+     22b:	c7 45 e0 06 00 00 00 	movl   $0x6,-0x20(%rbp)
+  int pages_per_group = 1000;
+     232:	c7 45 dc e8 03 00 00 	movl   $0x3e8,-0x24(%rbp)
+  struct sys_info info1, info2;
+
+  for(i = 0; i < groups * pages_per_group; i++){
+     239:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     240:	eb 2f                	jmp    271 <localitytest+0x63>
+    a = sbrk(b);
+     242:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     245:	89 c7                	mov    %eax,%edi
+     247:	e8 4c 0a 00 00       	call   c98 <sbrk>
+     24c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    memset(a, 0, b);
+     250:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     253:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     257:	be 00 00 00 00       	mov    $0x0,%esi
+     25c:	48 89 c7             	mov    %rax,%rdi
+     25f:	e8 c3 07 00 00       	call   a27 <memset>
+    *(int*)a = i;
+     264:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     268:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     26b:	89 10                	mov    %edx,(%rax)
+  for(i = 0; i < groups * pages_per_group; i++){
+     26d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     271:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     274:	0f af 45 dc          	imul   -0x24(%rbp),%eax
+     278:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     27b:	7c c5                	jl     242 <localitytest+0x34>
+  }
+
+  printf(stdout, "%d pages allocated\n", groups*pages_per_group);
+     27d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     280:	0f af 45 dc          	imul   -0x24(%rbp),%eax
+     284:	89 c2                	mov    %eax,%edx
+     286:	8b 05 94 11 00 00    	mov    0x1194(%rip),%eax        # 1420 <stdout>
+     28c:	48 8d 0d ed 0d 00 00 	lea    0xded(%rip),%rcx        # 1080 <malloc+0x195>
+     293:	48 89 ce             	mov    %rcx,%rsi
+     296:	89 c7                	mov    %eax,%edi
+     298:	b8 00 00 00 00       	mov    $0x0,%eax
+     29d:	e8 c7 03 00 00       	call   669 <printf>
+
+  sysinfo(&info1);
+     2a2:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+     2a6:	48 89 c7             	mov    %rax,%rdi
+     2a9:	e8 02 0a 00 00       	call   cb0 <sysinfo>
+
+  // test whether LRU is implemented
+  for(i = 0; i < groups; i++){
+     2ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2b5:	e9 c7 00 00 00       	jmp    381 <localitytest+0x173>
+    for (j = i; j < groups; j++) {
+     2ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2bd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     2c0:	e9 ac 00 00 00       	jmp    371 <localitytest+0x163>
+      for (k = pages_per_group-1; k >=0 ; k--) {
+     2c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2c8:	83 e8 01             	sub    $0x1,%eax
+     2cb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     2ce:	e9 90 00 00 00       	jmp    363 <localitytest+0x155>
+        if (*(int*)(start + (j*pages_per_group + k)*b) != j*pages_per_group + k) {
+     2d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2d6:	0f af 45 dc          	imul   -0x24(%rbp),%eax
+     2da:	89 c2                	mov    %eax,%edx
+     2dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2df:	01 d0                	add    %edx,%eax
+     2e1:	0f af 45 e4          	imul   -0x1c(%rbp),%eax
+     2e5:	48 63 d0             	movslq %eax,%rdx
+     2e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     2ec:	48 01 d0             	add    %rdx,%rax
+     2ef:	8b 10                	mov    (%rax),%edx
+     2f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2f4:	0f af 45 dc          	imul   -0x24(%rbp),%eax
+     2f8:	89 c1                	mov    %eax,%ecx
+     2fa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2fd:	01 c8                	add    %ecx,%eax
+     2ff:	39 c2                	cmp    %eax,%edx
+     301:	74 5c                	je     35f <localitytest+0x151>
+          error("data is incorrect");
+     303:	8b 05 17 11 00 00    	mov    0x1117(%rip),%eax        # 1420 <stdout>
+     309:	ba 5a 00 00 00       	mov    $0x5a,%edx
+     30e:	48 8d 0d 83 0d 00 00 	lea    0xd83(%rip),%rcx        # 1098 <malloc+0x1ad>
+     315:	48 89 ce             	mov    %rcx,%rsi
+     318:	89 c7                	mov    %eax,%edi
+     31a:	b8 00 00 00 00       	mov    $0x0,%eax
+     31f:	e8 45 03 00 00       	call   669 <printf>
+     324:	8b 05 f6 10 00 00    	mov    0x10f6(%rip),%eax        # 1420 <stdout>
+     32a:	48 8d 15 f0 0d 00 00 	lea    0xdf0(%rip),%rdx        # 1121 <malloc+0x236>
+     331:	48 89 d6             	mov    %rdx,%rsi
+     334:	89 c7                	mov    %eax,%edi
+     336:	b8 00 00 00 00       	mov    $0x0,%eax
+     33b:	e8 29 03 00 00       	call   669 <printf>
+     340:	8b 05 da 10 00 00    	mov    0x10da(%rip),%eax        # 1420 <stdout>
+     346:	48 8d 15 8c 0d 00 00 	lea    0xd8c(%rip),%rdx        # 10d9 <malloc+0x1ee>
+     34d:	48 89 d6             	mov    %rdx,%rsi
+     350:	89 c7                	mov    %eax,%edi
+     352:	b8 00 00 00 00       	mov    $0x0,%eax
+     357:	e8 0d 03 00 00       	call   669 <printf>
+     35c:	90                   	nop
+     35d:	eb fd                	jmp    35c <localitytest+0x14e>
+      for (k = pages_per_group-1; k >=0 ; k--) {
+     35f:	83 6d f4 01          	subl   $0x1,-0xc(%rbp)
+     363:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     367:	0f 89 66 ff ff ff    	jns    2d3 <localitytest+0xc5>
+    for (j = i; j < groups; j++) {
+     36d:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     371:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     374:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+     377:	0f 8c 48 ff ff ff    	jl     2c5 <localitytest+0xb7>
+  for(i = 0; i < groups; i++){
+     37d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     381:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     384:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+     387:	0f 8c 2d ff ff ff    	jl     2ba <localitytest+0xac>
+        }
+      }
+    }
+  }
+
+  sysinfo(&info2);
+     38d:	48 8d 45 a8          	lea    -0x58(%rbp),%rax
+     391:	48 89 c7             	mov    %rax,%rdi
+     394:	e8 17 09 00 00       	call   cb0 <sysinfo>
+  // If LRU is implemented, the first ~4000 pages should not incur disk operations
+  // Number of disk operations is around (2000 + 5000 + 4000) * 8 * 2 = 176000
+
+  // we set threshold to be 230000 so any LRU-like implementation can pass our test
+
+  printf(stdout, "number of disk reads = %d\n", info2.num_disk_reads - info1.num_disk_reads);
+     399:	8b 55 b8             	mov    -0x48(%rbp),%edx
+     39c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     39f:	29 c2                	sub    %eax,%edx
+     3a1:	8b 05 79 10 00 00    	mov    0x1079(%rip),%eax        # 1420 <stdout>
+     3a7:	48 8d 0d 2d 0d 00 00 	lea    0xd2d(%rip),%rcx        # 10db <malloc+0x1f0>
+     3ae:	48 89 ce             	mov    %rcx,%rsi
+     3b1:	89 c7                	mov    %eax,%edi
+     3b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b8:	e8 ac 02 00 00       	call   669 <printf>
+  if (info2.num_disk_reads - info1.num_disk_reads > 230000)
+     3bd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+     3c0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     3c3:	29 c2                	sub    %eax,%edx
+     3c5:	81 fa 70 82 03 00    	cmp    $0x38270,%edx
+     3cb:	7e 5c                	jle    429 <localitytest+0x21b>
+    error("LRU function does not exist!");
+     3cd:	8b 05 4d 10 00 00    	mov    0x104d(%rip),%eax        # 1420 <stdout>
+     3d3:	ba 6f 00 00 00       	mov    $0x6f,%edx
+     3d8:	48 8d 0d b9 0c 00 00 	lea    0xcb9(%rip),%rcx        # 1098 <malloc+0x1ad>
+     3df:	48 89 ce             	mov    %rcx,%rsi
+     3e2:	89 c7                	mov    %eax,%edi
+     3e4:	b8 00 00 00 00       	mov    $0x0,%eax
+     3e9:	e8 7b 02 00 00       	call   669 <printf>
+     3ee:	8b 05 2c 10 00 00    	mov    0x102c(%rip),%eax        # 1420 <stdout>
+     3f4:	48 8d 15 38 0d 00 00 	lea    0xd38(%rip),%rdx        # 1133 <malloc+0x248>
+     3fb:	48 89 d6             	mov    %rdx,%rsi
+     3fe:	89 c7                	mov    %eax,%edi
+     400:	b8 00 00 00 00       	mov    $0x0,%eax
+     405:	e8 5f 02 00 00       	call   669 <printf>
+     40a:	8b 05 10 10 00 00    	mov    0x1010(%rip),%eax        # 1420 <stdout>
+     410:	48 8d 15 c2 0c 00 00 	lea    0xcc2(%rip),%rdx        # 10d9 <malloc+0x1ee>
+     417:	48 89 d6             	mov    %rdx,%rsi
+     41a:	89 c7                	mov    %eax,%edi
+     41c:	b8 00 00 00 00       	mov    $0x0,%eax
+     421:	e8 43 02 00 00       	call   669 <printf>
+     426:	90                   	nop
+     427:	eb fd                	jmp    426 <localitytest+0x218>
+
+  for(i = 0; i < groups * pages_per_group; i++){
+     429:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     430:	eb 10                	jmp    442 <localitytest+0x234>
+    sbrk(-b);
+     432:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     435:	f7 d8                	neg    %eax
+     437:	89 c7                	mov    %eax,%edi
+     439:	e8 5a 08 00 00       	call   c98 <sbrk>
+  for(i = 0; i < groups * pages_per_group; i++){
+     43e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     442:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     445:	0f af 45 dc          	imul   -0x24(%rbp),%eax
+     449:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+     44c:	7c e4                	jl     432 <localitytest+0x224>
+  }
+
+  printf(stdout, "localitytest OK\n");
+     44e:	8b 05 cc 0f 00 00    	mov    0xfcc(%rip),%eax        # 1420 <stdout>
+     454:	48 8d 15 f5 0c 00 00 	lea    0xcf5(%rip),%rdx        # 1150 <malloc+0x265>
+     45b:	48 89 d6             	mov    %rdx,%rsi
+     45e:	89 c7                	mov    %eax,%edi
+     460:	b8 00 00 00 00       	mov    $0x0,%eax
+     465:	e8 ff 01 00 00       	call   669 <printf>
+}
+     46a:	90                   	nop
+     46b:	c9                   	leave
+     46c:	c3                   	ret
+
+000000000000046d <main>:
+
+int
+main(int argc, char *argv[])
+{
+     46d:	55                   	push   %rbp
+     46e:	48 89 e5             	mov    %rsp,%rbp
+     471:	48 83 ec 10          	sub    $0x10,%rsp
+     475:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     478:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  swaptest();
+     47c:	e8 7f fb ff ff       	call   0 <swaptest>
+  localitytest();
+     481:	e8 88 fd ff ff       	call   20e <localitytest>
+  printf(stdout, "lab4 tests passed!!\n");
+     486:	8b 05 94 0f 00 00    	mov    0xf94(%rip),%eax        # 1420 <stdout>
+     48c:	48 8d 15 ce 0c 00 00 	lea    0xcce(%rip),%rdx        # 1161 <malloc+0x276>
+     493:	48 89 d6             	mov    %rdx,%rsi
+     496:	89 c7                	mov    %eax,%edi
+     498:	b8 00 00 00 00       	mov    $0x0,%eax
+     49d:	e8 c7 01 00 00       	call   669 <printf>
+  exit();
+     4a2:	e8 69 07 00 00       	call   c10 <exit>
+
+00000000000004a7 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     4a7:	55                   	push   %rbp
+     4a8:	48 89 e5             	mov    %rsp,%rbp
+     4ab:	48 83 ec 10          	sub    $0x10,%rsp
+     4af:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     4b2:	89 f0                	mov    %esi,%eax
+     4b4:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     4b7:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     4bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4be:	ba 01 00 00 00       	mov    $0x1,%edx
+     4c3:	48 89 ce             	mov    %rcx,%rsi
+     4c6:	89 c7                	mov    %eax,%edi
+     4c8:	e8 63 07 00 00       	call   c30 <write>
+}
+     4cd:	90                   	nop
+     4ce:	c9                   	leave
+     4cf:	c3                   	ret
+
+00000000000004d0 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     4d0:	55                   	push   %rbp
+     4d1:	48 89 e5             	mov    %rsp,%rbp
+     4d4:	48 83 ec 40          	sub    $0x40,%rsp
+     4d8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     4db:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     4de:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     4e1:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     4e4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     4e8:	74 1f                	je     509 <printint64+0x39>
+     4ea:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4ed:	c1 e8 1f             	shr    $0x1f,%eax
+     4f0:	0f b6 c0             	movzbl %al,%eax
+     4f3:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     4f6:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     4fa:	74 0d                	je     509 <printint64+0x39>
+    x = -xx;
+     4fc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     4ff:	f7 d8                	neg    %eax
+     501:	48 98                	cltq
+     503:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     507:	eb 09                	jmp    512 <printint64+0x42>
+  else
+    x = xx;
+     509:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     50c:	48 98                	cltq
+     50e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     512:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     519:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     51c:	48 63 c8             	movslq %eax,%rcx
+     51f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     523:	ba 00 00 00 00       	mov    $0x0,%edx
+     528:	48 f7 f1             	div    %rcx
+     52b:	48 89 d1             	mov    %rdx,%rcx
+     52e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     531:	8d 50 01             	lea    0x1(%rax),%edx
+     534:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     537:	48 8d 15 f2 0e 00 00 	lea    0xef2(%rip),%rdx        # 1430 <digits.1>
+     53e:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     542:	48 98                	cltq
+     544:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     548:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     54b:	48 63 f0             	movslq %eax,%rsi
+     54e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     552:	ba 00 00 00 00       	mov    $0x0,%edx
+     557:	48 f7 f6             	div    %rsi
+     55a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     55e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     563:	75 b4                	jne    519 <printint64+0x49>
+
+  if(sgn)
+     565:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     569:	74 2b                	je     596 <printint64+0xc6>
+    buf[i++] = '-';
+     56b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     56e:	8d 50 01             	lea    0x1(%rax),%edx
+     571:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     574:	48 98                	cltq
+     576:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     57b:	eb 19                	jmp    596 <printint64+0xc6>
+    putc(fd, buf[i]);
+     57d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     580:	48 98                	cltq
+     582:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     587:	0f be d0             	movsbl %al,%edx
+     58a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     58d:	89 d6                	mov    %edx,%esi
+     58f:	89 c7                	mov    %eax,%edi
+     591:	e8 11 ff ff ff       	call   4a7 <putc>
+  while(--i >= 0)
+     596:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     59a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     59e:	79 dd                	jns    57d <printint64+0xad>
+}
+     5a0:	90                   	nop
+     5a1:	90                   	nop
+     5a2:	c9                   	leave
+     5a3:	c3                   	ret
+
+00000000000005a4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     5a4:	55                   	push   %rbp
+     5a5:	48 89 e5             	mov    %rsp,%rbp
+     5a8:	48 83 ec 30          	sub    $0x30,%rsp
+     5ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     5af:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     5b2:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     5b5:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     5b8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     5bf:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     5c3:	74 17                	je     5dc <printint+0x38>
+     5c5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     5c9:	79 11                	jns    5dc <printint+0x38>
+    neg = 1;
+     5cb:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     5d2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     5d5:	f7 d8                	neg    %eax
+     5d7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     5da:	eb 06                	jmp    5e2 <printint+0x3e>
+  } else {
+    x = xx;
+     5dc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     5df:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     5e2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     5e9:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     5ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     5ef:	ba 00 00 00 00       	mov    $0x0,%edx
+     5f4:	f7 f1                	div    %ecx
+     5f6:	89 d1                	mov    %edx,%ecx
+     5f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5fb:	8d 50 01             	lea    0x1(%rax),%edx
+     5fe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     601:	89 c9                	mov    %ecx,%ecx
+     603:	48 8d 15 46 0e 00 00 	lea    0xe46(%rip),%rdx        # 1450 <digits.0>
+     60a:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     60e:	48 98                	cltq
+     610:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     614:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     617:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     61a:	ba 00 00 00 00       	mov    $0x0,%edx
+     61f:	f7 f6                	div    %esi
+     621:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     624:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     628:	75 bf                	jne    5e9 <printint+0x45>
+  if(neg)
+     62a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     62e:	74 2b                	je     65b <printint+0xb7>
+    buf[i++] = '-';
+     630:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     633:	8d 50 01             	lea    0x1(%rax),%edx
+     636:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     639:	48 98                	cltq
+     63b:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     640:	eb 19                	jmp    65b <printint+0xb7>
+    putc(fd, buf[i]);
+     642:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     645:	48 98                	cltq
+     647:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     64c:	0f be d0             	movsbl %al,%edx
+     64f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     652:	89 d6                	mov    %edx,%esi
+     654:	89 c7                	mov    %eax,%edi
+     656:	e8 4c fe ff ff       	call   4a7 <putc>
+  while(--i >= 0)
+     65b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     65f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     663:	79 dd                	jns    642 <printint+0x9e>
+}
+     665:	90                   	nop
+     666:	90                   	nop
+     667:	c9                   	leave
+     668:	c3                   	ret
+
+0000000000000669 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     669:	55                   	push   %rbp
+     66a:	48 89 e5             	mov    %rsp,%rbp
+     66d:	48 83 ec 70          	sub    $0x70,%rsp
+     671:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     674:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     678:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     67c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     680:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     684:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     688:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     68f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     693:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     697:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     69b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     69f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     6a6:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     6ad:	e9 6b 02 00 00       	jmp    91d <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     6b2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     6b5:	48 63 d0             	movslq %eax,%rdx
+     6b8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     6bc:	48 01 d0             	add    %rdx,%rax
+     6bf:	0f b6 00             	movzbl (%rax),%eax
+     6c2:	0f be c0             	movsbl %al,%eax
+     6c5:	25 ff 00 00 00       	and    $0xff,%eax
+     6ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     6cd:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     6d1:	75 30                	jne    703 <printf+0x9a>
+      if(c == '%'){
+     6d3:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     6d7:	75 13                	jne    6ec <printf+0x83>
+        state = '%';
+     6d9:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     6e0:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     6e7:	e9 2d 02 00 00       	jmp    919 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     6ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     6ef:	0f be d0             	movsbl %al,%edx
+     6f2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     6f5:	89 d6                	mov    %edx,%esi
+     6f7:	89 c7                	mov    %eax,%edi
+     6f9:	e8 a9 fd ff ff       	call   4a7 <putc>
+     6fe:	e9 16 02 00 00       	jmp    919 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     703:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     707:	0f 85 0c 02 00 00    	jne    919 <printf+0x2b0>
+      if(c == 'l') {
+     70d:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     711:	75 0c                	jne    71f <printf+0xb6>
+        lflag = 1;
+     713:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     71a:	e9 fa 01 00 00       	jmp    919 <printf+0x2b0>
+      } else if(c == 'd'){
+     71f:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     723:	0f 85 95 00 00 00    	jne    7be <printf+0x155>
+        if (lflag == 1)
+     729:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     72d:	75 49                	jne    778 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     72f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     732:	83 f8 2f             	cmp    $0x2f,%eax
+     735:	77 17                	ja     74e <printf+0xe5>
+     737:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     73b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     73e:	89 d2                	mov    %edx,%edx
+     740:	48 01 d0             	add    %rdx,%rax
+     743:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     746:	83 c2 08             	add    $0x8,%edx
+     749:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     74c:	eb 0c                	jmp    75a <printf+0xf1>
+     74e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     752:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     756:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     75a:	48 8b 00             	mov    (%rax),%rax
+     75d:	89 c6                	mov    %eax,%esi
+     75f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     762:	b9 01 00 00 00       	mov    $0x1,%ecx
+     767:	ba 0a 00 00 00       	mov    $0xa,%edx
+     76c:	89 c7                	mov    %eax,%edi
+     76e:	e8 5d fd ff ff       	call   4d0 <printint64>
+     773:	e9 9a 01 00 00       	jmp    912 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     778:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     77b:	83 f8 2f             	cmp    $0x2f,%eax
+     77e:	77 17                	ja     797 <printf+0x12e>
+     780:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     784:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     787:	89 d2                	mov    %edx,%edx
+     789:	48 01 d0             	add    %rdx,%rax
+     78c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     78f:	83 c2 08             	add    $0x8,%edx
+     792:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     795:	eb 0c                	jmp    7a3 <printf+0x13a>
+     797:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     79b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     79f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     7a3:	8b 30                	mov    (%rax),%esi
+     7a5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7a8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     7ad:	ba 0a 00 00 00       	mov    $0xa,%edx
+     7b2:	89 c7                	mov    %eax,%edi
+     7b4:	e8 eb fd ff ff       	call   5a4 <printint>
+     7b9:	e9 54 01 00 00       	jmp    912 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     7be:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     7c2:	74 0a                	je     7ce <printf+0x165>
+     7c4:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     7c8:	0f 85 95 00 00 00    	jne    863 <printf+0x1fa>
+        if (lflag == 1)
+     7ce:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     7d2:	75 49                	jne    81d <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     7d4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     7d7:	83 f8 2f             	cmp    $0x2f,%eax
+     7da:	77 17                	ja     7f3 <printf+0x18a>
+     7dc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     7e0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7e3:	89 d2                	mov    %edx,%edx
+     7e5:	48 01 d0             	add    %rdx,%rax
+     7e8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     7eb:	83 c2 08             	add    $0x8,%edx
+     7ee:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     7f1:	eb 0c                	jmp    7ff <printf+0x196>
+     7f3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     7f7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     7fb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     7ff:	48 8b 00             	mov    (%rax),%rax
+     802:	89 c6                	mov    %eax,%esi
+     804:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     807:	b9 00 00 00 00       	mov    $0x0,%ecx
+     80c:	ba 10 00 00 00       	mov    $0x10,%edx
+     811:	89 c7                	mov    %eax,%edi
+     813:	e8 b8 fc ff ff       	call   4d0 <printint64>
+        if (lflag == 1)
+     818:	e9 f5 00 00 00       	jmp    912 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     81d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     820:	83 f8 2f             	cmp    $0x2f,%eax
+     823:	77 17                	ja     83c <printf+0x1d3>
+     825:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     829:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     82c:	89 d2                	mov    %edx,%edx
+     82e:	48 01 d0             	add    %rdx,%rax
+     831:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     834:	83 c2 08             	add    $0x8,%edx
+     837:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     83a:	eb 0c                	jmp    848 <printf+0x1df>
+     83c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     840:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     844:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     848:	8b 30                	mov    (%rax),%esi
+     84a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     84d:	b9 00 00 00 00       	mov    $0x0,%ecx
+     852:	ba 10 00 00 00       	mov    $0x10,%edx
+     857:	89 c7                	mov    %eax,%edi
+     859:	e8 46 fd ff ff       	call   5a4 <printint>
+        if (lflag == 1)
+     85e:	e9 af 00 00 00       	jmp    912 <printf+0x2a9>
+      } else if(c == 's'){
+     863:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     867:	75 6e                	jne    8d7 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     869:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     86c:	83 f8 2f             	cmp    $0x2f,%eax
+     86f:	77 17                	ja     888 <printf+0x21f>
+     871:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     875:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     878:	89 d2                	mov    %edx,%edx
+     87a:	48 01 d0             	add    %rdx,%rax
+     87d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     880:	83 c2 08             	add    $0x8,%edx
+     883:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     886:	eb 0c                	jmp    894 <printf+0x22b>
+     888:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     88c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     890:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     894:	48 8b 00             	mov    (%rax),%rax
+     897:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     89b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     8a0:	75 28                	jne    8ca <printf+0x261>
+          s = "(null)";
+     8a2:	48 8d 05 cd 08 00 00 	lea    0x8cd(%rip),%rax        # 1176 <malloc+0x28b>
+     8a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     8ad:	eb 1b                	jmp    8ca <printf+0x261>
+          putc(fd, *s);
+     8af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     8b3:	0f b6 00             	movzbl (%rax),%eax
+     8b6:	0f be d0             	movsbl %al,%edx
+     8b9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8bc:	89 d6                	mov    %edx,%esi
+     8be:	89 c7                	mov    %eax,%edi
+     8c0:	e8 e2 fb ff ff       	call   4a7 <putc>
+        for(; *s; s++)
+     8c5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     8ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     8ce:	0f b6 00             	movzbl (%rax),%eax
+     8d1:	84 c0                	test   %al,%al
+     8d3:	75 da                	jne    8af <printf+0x246>
+     8d5:	eb 3b                	jmp    912 <printf+0x2a9>
+      } else if(c == '%'){
+     8d7:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     8db:	75 14                	jne    8f1 <printf+0x288>
+        putc(fd, c);
+     8dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     8e0:	0f be d0             	movsbl %al,%edx
+     8e3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8e6:	89 d6                	mov    %edx,%esi
+     8e8:	89 c7                	mov    %eax,%edi
+     8ea:	e8 b8 fb ff ff       	call   4a7 <putc>
+     8ef:	eb 21                	jmp    912 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     8f1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8f4:	be 25 00 00 00       	mov    $0x25,%esi
+     8f9:	89 c7                	mov    %eax,%edi
+     8fb:	e8 a7 fb ff ff       	call   4a7 <putc>
+        putc(fd, c);
+     900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     903:	0f be d0             	movsbl %al,%edx
+     906:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     909:	89 d6                	mov    %edx,%esi
+     90b:	89 c7                	mov    %eax,%edi
+     90d:	e8 95 fb ff ff       	call   4a7 <putc>
+      }
+      state = 0;
+     912:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     919:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     91d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     920:	48 63 d0             	movslq %eax,%rdx
+     923:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     927:	48 01 d0             	add    %rdx,%rax
+     92a:	0f b6 00             	movzbl (%rax),%eax
+     92d:	84 c0                	test   %al,%al
+     92f:	0f 85 7d fd ff ff    	jne    6b2 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     935:	90                   	nop
+     936:	90                   	nop
+     937:	c9                   	leave
+     938:	c3                   	ret
+
+0000000000000939 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     939:	55                   	push   %rbp
+     93a:	48 89 e5             	mov    %rsp,%rbp
+     93d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     941:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     944:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     947:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     94b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     94e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     951:	48 89 ce             	mov    %rcx,%rsi
+     954:	48 89 f7             	mov    %rsi,%rdi
+     957:	89 d1                	mov    %edx,%ecx
+     959:	fc                   	cld
+     95a:	f3 aa                	rep stos %al,%es:(%rdi)
+     95c:	89 ca                	mov    %ecx,%edx
+     95e:	48 89 fe             	mov    %rdi,%rsi
+     961:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     965:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+     968:	90                   	nop
+     969:	5d                   	pop    %rbp
+     96a:	c3                   	ret
+
+000000000000096b <strcpy>:
+{
+     96b:	55                   	push   %rbp
+     96c:	48 89 e5             	mov    %rsp,%rbp
+     96f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     973:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     97b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     97f:	90                   	nop
+     980:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     984:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     988:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     98c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     990:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     994:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     998:	0f b6 12             	movzbl (%rdx),%edx
+     99b:	88 10                	mov    %dl,(%rax)
+     99d:	0f b6 00             	movzbl (%rax),%eax
+     9a0:	84 c0                	test   %al,%al
+     9a2:	75 dc                	jne    980 <strcpy+0x15>
+  return os;
+     9a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     9a8:	5d                   	pop    %rbp
+     9a9:	c3                   	ret
+
+00000000000009aa <strcmp>:
+{
+     9aa:	55                   	push   %rbp
+     9ab:	48 89 e5             	mov    %rsp,%rbp
+     9ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     9b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     9b6:	eb 0a                	jmp    9c2 <strcmp+0x18>
+    p++, q++;
+     9b8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     9bd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     9c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9c6:	0f b6 00             	movzbl (%rax),%eax
+     9c9:	84 c0                	test   %al,%al
+     9cb:	74 12                	je     9df <strcmp+0x35>
+     9cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9d1:	0f b6 10             	movzbl (%rax),%edx
+     9d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9d8:	0f b6 00             	movzbl (%rax),%eax
+     9db:	38 c2                	cmp    %al,%dl
+     9dd:	74 d9                	je     9b8 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     9df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9e3:	0f b6 00             	movzbl (%rax),%eax
+     9e6:	0f b6 d0             	movzbl %al,%edx
+     9e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     9ed:	0f b6 00             	movzbl (%rax),%eax
+     9f0:	0f b6 c0             	movzbl %al,%eax
+     9f3:	29 c2                	sub    %eax,%edx
+     9f5:	89 d0                	mov    %edx,%eax
+}
+     9f7:	5d                   	pop    %rbp
+     9f8:	c3                   	ret
+
+00000000000009f9 <strlen>:
+{
+     9f9:	55                   	push   %rbp
+     9fa:	48 89 e5             	mov    %rsp,%rbp
+     9fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+     a01:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a08:	eb 04                	jmp    a0e <strlen+0x15>
+     a0a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a0e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a11:	48 63 d0             	movslq %eax,%rdx
+     a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a18:	48 01 d0             	add    %rdx,%rax
+     a1b:	0f b6 00             	movzbl (%rax),%eax
+     a1e:	84 c0                	test   %al,%al
+     a20:	75 e8                	jne    a0a <strlen+0x11>
+  return n;
+     a22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     a25:	5d                   	pop    %rbp
+     a26:	c3                   	ret
+
+0000000000000a27 <memset>:
+{
+     a27:	55                   	push   %rbp
+     a28:	48 89 e5             	mov    %rsp,%rbp
+     a2b:	48 83 ec 10          	sub    $0x10,%rsp
+     a2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a33:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     a36:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     a39:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     a3c:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     a3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a43:	89 ce                	mov    %ecx,%esi
+     a45:	48 89 c7             	mov    %rax,%rdi
+     a48:	e8 ec fe ff ff       	call   939 <stosb>
+  return dst;
+     a4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     a51:	c9                   	leave
+     a52:	c3                   	ret
+
+0000000000000a53 <strchr>:
+{
+     a53:	55                   	push   %rbp
+     a54:	48 89 e5             	mov    %rsp,%rbp
+     a57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a5b:	89 f0                	mov    %esi,%eax
+     a5d:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     a60:	eb 17                	jmp    a79 <strchr+0x26>
+    if(*s == c)
+     a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a66:	0f b6 00             	movzbl (%rax),%eax
+     a69:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     a6c:	75 06                	jne    a74 <strchr+0x21>
+      return (char*)s;
+     a6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a72:	eb 15                	jmp    a89 <strchr+0x36>
+  for(; *s; s++)
+     a74:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     a79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a7d:	0f b6 00             	movzbl (%rax),%eax
+     a80:	84 c0                	test   %al,%al
+     a82:	75 de                	jne    a62 <strchr+0xf>
+  return 0;
+     a84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     a89:	5d                   	pop    %rbp
+     a8a:	c3                   	ret
+
+0000000000000a8b <gets>:
+gets(char *buf, int max)
+{
+     a8b:	55                   	push   %rbp
+     a8c:	48 89 e5             	mov    %rsp,%rbp
+     a8f:	48 83 ec 20          	sub    $0x20,%rsp
+     a93:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a97:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     a9a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     aa1:	eb 48                	jmp    aeb <gets+0x60>
+    cc = read(0, &c, 1);
+     aa3:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     aa7:	ba 01 00 00 00       	mov    $0x1,%edx
+     aac:	48 89 c6             	mov    %rax,%rsi
+     aaf:	bf 00 00 00 00       	mov    $0x0,%edi
+     ab4:	e8 6f 01 00 00       	call   c28 <read>
+     ab9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     abc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     ac0:	7e 36                	jle    af8 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     ac2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ac5:	8d 50 01             	lea    0x1(%rax),%edx
+     ac8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     acb:	48 63 d0             	movslq %eax,%rdx
+     ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ad2:	48 01 c2             	add    %rax,%rdx
+     ad5:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ad9:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     adb:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     adf:	3c 0a                	cmp    $0xa,%al
+     ae1:	74 16                	je     af9 <gets+0x6e>
+     ae3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ae7:	3c 0d                	cmp    $0xd,%al
+     ae9:	74 0e                	je     af9 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     aeb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aee:	83 c0 01             	add    $0x1,%eax
+     af1:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     af4:	7f ad                	jg     aa3 <gets+0x18>
+     af6:	eb 01                	jmp    af9 <gets+0x6e>
+      break;
+     af8:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     af9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     afc:	48 63 d0             	movslq %eax,%rdx
+     aff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b03:	48 01 d0             	add    %rdx,%rax
+     b06:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     b09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     b0d:	c9                   	leave
+     b0e:	c3                   	ret
+
+0000000000000b0f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     b0f:	55                   	push   %rbp
+     b10:	48 89 e5             	mov    %rsp,%rbp
+     b13:	48 83 ec 20          	sub    $0x20,%rsp
+     b17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b1b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b23:	be 00 00 00 00       	mov    $0x0,%esi
+     b28:	48 89 c7             	mov    %rax,%rdi
+     b2b:	e8 20 01 00 00       	call   c50 <open>
+     b30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     b33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     b37:	79 07                	jns    b40 <stat+0x31>
+    return -1;
+     b39:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     b3e:	eb 21                	jmp    b61 <stat+0x52>
+  r = fstat(fd, st);
+     b40:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b47:	48 89 d6             	mov    %rdx,%rsi
+     b4a:	89 c7                	mov    %eax,%edi
+     b4c:	e8 17 01 00 00       	call   c68 <fstat>
+     b51:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     b54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b57:	89 c7                	mov    %eax,%edi
+     b59:	e8 da 00 00 00       	call   c38 <close>
+  return r;
+     b5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     b61:	c9                   	leave
+     b62:	c3                   	ret
+
+0000000000000b63 <atoi>:
+
+int
+atoi(const char *s)
+{
+     b63:	55                   	push   %rbp
+     b64:	48 89 e5             	mov    %rsp,%rbp
+     b67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     b6b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     b72:	eb 28                	jmp    b9c <atoi+0x39>
+    n = n*10 + *s++ - '0';
+     b74:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     b77:	89 d0                	mov    %edx,%eax
+     b79:	c1 e0 02             	shl    $0x2,%eax
+     b7c:	01 d0                	add    %edx,%eax
+     b7e:	01 c0                	add    %eax,%eax
+     b80:	89 c1                	mov    %eax,%ecx
+     b82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b86:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     b8a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     b8e:	0f b6 00             	movzbl (%rax),%eax
+     b91:	0f be c0             	movsbl %al,%eax
+     b94:	01 c8                	add    %ecx,%eax
+     b96:	83 e8 30             	sub    $0x30,%eax
+     b99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ba0:	0f b6 00             	movzbl (%rax),%eax
+     ba3:	3c 2f                	cmp    $0x2f,%al
+     ba5:	7e 0b                	jle    bb2 <atoi+0x4f>
+     ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bab:	0f b6 00             	movzbl (%rax),%eax
+     bae:	3c 39                	cmp    $0x39,%al
+     bb0:	7e c2                	jle    b74 <atoi+0x11>
+  return n;
+     bb2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     bb5:	5d                   	pop    %rbp
+     bb6:	c3                   	ret
+
+0000000000000bb7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     bb7:	55                   	push   %rbp
+     bb8:	48 89 e5             	mov    %rsp,%rbp
+     bbb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bbf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     bc3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     bc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     bce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     bd2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     bd6:	eb 1d                	jmp    bf5 <memmove+0x3e>
+    *dst++ = *src++;
+     bd8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     bdc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     be0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     be4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     be8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     bec:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     bf0:	0f b6 12             	movzbl (%rdx),%edx
+     bf3:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     bf5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     bf8:	8d 50 ff             	lea    -0x1(%rax),%edx
+     bfb:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     bfe:	85 c0                	test   %eax,%eax
+     c00:	7f d6                	jg     bd8 <memmove+0x21>
+  return vdst;
+     c02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c06:	5d                   	pop    %rbp
+     c07:	c3                   	ret
+
+0000000000000c08 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+     c08:	b8 01 00 00 00       	mov    $0x1,%eax
+     c0d:	cd 40                	int    $0x40
+     c0f:	c3                   	ret
+
+0000000000000c10 <exit>:
+SYSCALL(exit)
+     c10:	b8 02 00 00 00       	mov    $0x2,%eax
+     c15:	cd 40                	int    $0x40
+     c17:	c3                   	ret
+
+0000000000000c18 <wait>:
+SYSCALL(wait)
+     c18:	b8 03 00 00 00       	mov    $0x3,%eax
+     c1d:	cd 40                	int    $0x40
+     c1f:	c3                   	ret
+
+0000000000000c20 <pipe>:
+SYSCALL(pipe)
+     c20:	b8 04 00 00 00       	mov    $0x4,%eax
+     c25:	cd 40                	int    $0x40
+     c27:	c3                   	ret
+
+0000000000000c28 <read>:
+SYSCALL(read)
+     c28:	b8 05 00 00 00       	mov    $0x5,%eax
+     c2d:	cd 40                	int    $0x40
+     c2f:	c3                   	ret
+
+0000000000000c30 <write>:
+SYSCALL(write)
+     c30:	b8 10 00 00 00       	mov    $0x10,%eax
+     c35:	cd 40                	int    $0x40
+     c37:	c3                   	ret
+
+0000000000000c38 <close>:
+SYSCALL(close)
+     c38:	b8 15 00 00 00       	mov    $0x15,%eax
+     c3d:	cd 40                	int    $0x40
+     c3f:	c3                   	ret
+
+0000000000000c40 <kill>:
+SYSCALL(kill)
+     c40:	b8 06 00 00 00       	mov    $0x6,%eax
+     c45:	cd 40                	int    $0x40
+     c47:	c3                   	ret
+
+0000000000000c48 <exec>:
+SYSCALL(exec)
+     c48:	b8 07 00 00 00       	mov    $0x7,%eax
+     c4d:	cd 40                	int    $0x40
+     c4f:	c3                   	ret
+
+0000000000000c50 <open>:
+SYSCALL(open)
+     c50:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c55:	cd 40                	int    $0x40
+     c57:	c3                   	ret
+
+0000000000000c58 <mknod>:
+SYSCALL(mknod)
+     c58:	b8 11 00 00 00       	mov    $0x11,%eax
+     c5d:	cd 40                	int    $0x40
+     c5f:	c3                   	ret
+
+0000000000000c60 <unlink>:
+SYSCALL(unlink)
+     c60:	b8 12 00 00 00       	mov    $0x12,%eax
+     c65:	cd 40                	int    $0x40
+     c67:	c3                   	ret
+
+0000000000000c68 <fstat>:
+SYSCALL(fstat)
+     c68:	b8 08 00 00 00       	mov    $0x8,%eax
+     c6d:	cd 40                	int    $0x40
+     c6f:	c3                   	ret
+
+0000000000000c70 <link>:
+SYSCALL(link)
+     c70:	b8 13 00 00 00       	mov    $0x13,%eax
+     c75:	cd 40                	int    $0x40
+     c77:	c3                   	ret
+
+0000000000000c78 <mkdir>:
+SYSCALL(mkdir)
+     c78:	b8 14 00 00 00       	mov    $0x14,%eax
+     c7d:	cd 40                	int    $0x40
+     c7f:	c3                   	ret
+
+0000000000000c80 <chdir>:
+SYSCALL(chdir)
+     c80:	b8 09 00 00 00       	mov    $0x9,%eax
+     c85:	cd 40                	int    $0x40
+     c87:	c3                   	ret
+
+0000000000000c88 <dup>:
+SYSCALL(dup)
+     c88:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c8d:	cd 40                	int    $0x40
+     c8f:	c3                   	ret
+
+0000000000000c90 <getpid>:
+SYSCALL(getpid)
+     c90:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c95:	cd 40                	int    $0x40
+     c97:	c3                   	ret
+
+0000000000000c98 <sbrk>:
+SYSCALL(sbrk)
+     c98:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c9d:	cd 40                	int    $0x40
+     c9f:	c3                   	ret
+
+0000000000000ca0 <sleep>:
+SYSCALL(sleep)
+     ca0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ca5:	cd 40                	int    $0x40
+     ca7:	c3                   	ret
+
+0000000000000ca8 <uptime>:
+SYSCALL(uptime)
+     ca8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     cad:	cd 40                	int    $0x40
+     caf:	c3                   	ret
+
+0000000000000cb0 <sysinfo>:
+SYSCALL(sysinfo)
+     cb0:	b8 16 00 00 00       	mov    $0x16,%eax
+     cb5:	cd 40                	int    $0x40
+     cb7:	c3                   	ret
+
+0000000000000cb8 <mmap>:
+SYSCALL(mmap)
+     cb8:	b8 17 00 00 00       	mov    $0x17,%eax
+     cbd:	cd 40                	int    $0x40
+     cbf:	c3                   	ret
+
+0000000000000cc0 <munmap>:
+SYSCALL(munmap)
+     cc0:	b8 18 00 00 00       	mov    $0x18,%eax
+     cc5:	cd 40                	int    $0x40
+     cc7:	c3                   	ret
+
+0000000000000cc8 <crashn>:
+SYSCALL(crashn)
+     cc8:	b8 19 00 00 00       	mov    $0x19,%eax
+     ccd:	cd 40                	int    $0x40
+     ccf:	c3                   	ret
+
+0000000000000cd0 <mmap2>:
+SYSCALL_ADDR(mmap2)
+     cd0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     cd5:	cd 40                	int    $0x40
+     cd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cda:	74 02                	je     cde <mmap2+0xe>
+     cdc:	89 c0                	mov    %eax,%eax
+     cde:	c3                   	ret
+
+0000000000000cdf <munmap2>:
+SYSCALL(munmap2)
+     cdf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ce4:	cd 40                	int    $0x40
+     ce6:	c3                   	ret
+
+0000000000000ce7 <msync>:
+SYSCALL(msync)
+     ce7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     cec:	cd 40                	int    $0x40
+     cee:	c3                   	ret
+
+0000000000000cef <sendfile>:
+SYSCALL(sendfile)
+     cef:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     cf4:	cd 40                	int    $0x40
+     cf6:	c3                   	ret
+
+0000000000000cf7 <splice>:
+SYSCALL(splice)
+     cf7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     cfc:	cd 40                	int    $0x40
+     cfe:	c3                   	ret
+
+0000000000000cff <pread>:
+SYSCALL(pread)
+     cff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d04:	cd 40                	int    $0x40
+     d06:	c3                   	ret
+
+0000000000000d07 <pwrite>:
+SYSCALL(pwrite)
+     d07:	b8 20 00 00 00       	mov    $0x20,%eax
+     d0c:	cd 40                	int    $0x40
+     d0e:	c3                   	ret
+
+0000000000000d0f <readv>:
+SYSCALL(readv)
+     d0f:	b8 21 00 00 00       	mov    $0x21,%eax
+     d14:	cd 40                	int    $0x40
+     d16:	c3                   	ret
+
+0000000000000d17 <writev>:
+SYSCALL(writev)
+     d17:	b8 22 00 00 00       	mov    $0x22,%eax
+     d1c:	cd 40                	int    $0x40
+     d1e:	c3                   	ret
+
+0000000000000d1f <poll>:
+SYSCALL(poll)
+     d1f:	b8 23 00 00 00       	mov    $0x23,%eax
+     d24:	cd 40                	int    $0x40
+     d26:	c3                   	ret
+
+0000000000000d27 <pipe2>:
+SYSCALL(pipe2)
+     d27:	b8 24 00 00 00       	mov    $0x24,%eax
+     d2c:	cd 40                	int    $0x40
+     d2e:	c3                   	ret
+
+0000000000000d2f <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+     d2f:	55                   	push   %rbp
+     d30:	48 89 e5             	mov    %rsp,%rbp
+     d33:	48 83 ec 20          	sub    $0x20,%rsp
+     d37:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d3f:	48 83 e8 10          	sub    $0x10,%rax
+     d43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+     d47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d4b:	48 8b 10             	mov    (%rax),%rdx
+     d4e:	48 8d 05 3b 07 00 00 	lea    0x73b(%rip),%rax        # 1490 <bigblock>
+     d55:	48 39 c2             	cmp    %rax,%rdx
+     d58:	75 1f                	jne    d79 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+     d5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d5e:	8b 40 08             	mov    0x8(%rax),%eax
+     d61:	c1 e0 04             	shl    $0x4,%eax
+     d64:	89 c2                	mov    %eax,%edx
+     d66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d6a:	89 d6                	mov    %edx,%esi
+     d6c:	48 89 c7             	mov    %rax,%rdi
+     d6f:	e8 6b ff ff ff       	call   cdf <munmap2>
+    return;
+     d74:	e9 0b 01 00 00       	jmp    e84 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     d79:	48 8b 05 00 07 00 00 	mov    0x700(%rip),%rax        # 1480 <freep>
+     d80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     d84:	eb 2f                	jmp    db5 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     d8a:	48 8b 00             	mov    (%rax),%rax
+     d8d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d91:	72 17                	jb     daa <free+0x7b>
+     d93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     d97:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     d9b:	72 2f                	jb     dcc <free+0x9d>
+     d9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     da1:	48 8b 00             	mov    (%rax),%rax
+     da4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     da8:	72 22                	jb     dcc <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dae:	48 8b 00             	mov    (%rax),%rax
+     db1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     db5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     db9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     dbd:	73 c7                	jae    d86 <free+0x57>
+     dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dc3:	48 8b 00             	mov    (%rax),%rax
+     dc6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     dca:	73 ba                	jae    d86 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     dcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     dd0:	8b 40 08             	mov    0x8(%rax),%eax
+     dd3:	89 c0                	mov    %eax,%eax
+     dd5:	48 c1 e0 04          	shl    $0x4,%rax
+     dd9:	48 89 c2             	mov    %rax,%rdx
+     ddc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     de0:	48 01 c2             	add    %rax,%rdx
+     de3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     de7:	48 8b 00             	mov    (%rax),%rax
+     dea:	48 39 c2             	cmp    %rax,%rdx
+     ded:	75 2d                	jne    e1c <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+     def:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     df3:	8b 50 08             	mov    0x8(%rax),%edx
+     df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     dfa:	48 8b 00             	mov    (%rax),%rax
+     dfd:	8b 40 08             	mov    0x8(%rax),%eax
+     e00:	01 c2                	add    %eax,%edx
+     e02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e06:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e0d:	48 8b 00             	mov    (%rax),%rax
+     e10:	48 8b 10             	mov    (%rax),%rdx
+     e13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e17:	48 89 10             	mov    %rdx,(%rax)
+     e1a:	eb 0e                	jmp    e2a <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+     e1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e20:	48 8b 10             	mov    (%rax),%rdx
+     e23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e27:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     e2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e2e:	8b 40 08             	mov    0x8(%rax),%eax
+     e31:	89 c0                	mov    %eax,%eax
+     e33:	48 c1 e0 04          	shl    $0x4,%rax
+     e37:	48 89 c2             	mov    %rax,%rdx
+     e3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e3e:	48 01 d0             	add    %rdx,%rax
+     e41:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e45:	75 27                	jne    e6e <free+0x13f>
+    p->s.size += bp->s.size;
+     e47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4b:	8b 50 08             	mov    0x8(%rax),%edx
+     e4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e52:	8b 40 08             	mov    0x8(%rax),%eax
+     e55:	01 c2                	add    %eax,%edx
+     e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e5b:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     e5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e62:	48 8b 10             	mov    (%rax),%rdx
+     e65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e69:	48 89 10             	mov    %rdx,(%rax)
+     e6c:	eb 0b                	jmp    e79 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+     e6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e76:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     e79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e7d:	48 89 05 fc 05 00 00 	mov    %rax,0x5fc(%rip)        # 1480 <freep>
+}
+     e84:	c9                   	leave
+     e85:	c3                   	ret
+
+0000000000000e86 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     e86:	55                   	push   %rbp
+     e87:	48 89 e5             	mov    %rsp,%rbp
+     e8a:	48 83 ec 20          	sub    $0x20,%rsp
+     e8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     e91:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     e98:	77 07                	ja     ea1 <morecore+0x1b>
+    nu = 4096;
+     e9a:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     ea1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     ea4:	c1 e0 04             	shl    $0x4,%eax
+     ea7:	89 c7                	mov    %eax,%edi
+     ea9:	e8 ea fd ff ff       	call   c98 <sbrk>
+     eae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     eb2:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     eb7:	75 07                	jne    ec0 <morecore+0x3a>
+    return 0;
+     eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+     ebe:	eb 29                	jmp    ee9 <morecore+0x63>
+  hp = (Header*)p;
+     ec0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ec4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ecc:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     ecf:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     ed2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ed6:	48 83 c0 10          	add    $0x10,%rax
+     eda:	48 89 c7             	mov    %rax,%rdi
+     edd:	e8 4d fe ff ff       	call   d2f <free>
+  return freep;
+     ee2:	48 8b 05 97 05 00 00 	mov    0x597(%rip),%rax        # 1480 <freep>
+}
+     ee9:	c9                   	leave
+     eea:	c3                   	ret
+
+0000000000000eeb <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     eeb:	55                   	push   %rbp
+     eec:	48 89 e5             	mov    %rsp,%rbp
+     eef:	48 83 ec 30          	sub    $0x30,%rsp
+     ef3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ef6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     ef9:	48 83 c0 0f          	add    $0xf,%rax
+     efd:	48 c1 e8 04          	shr    $0x4,%rax
+     f01:	83 c0 01             	add    $0x1,%eax
+     f04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+     f07:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+     f0e:	76 62                	jbe    f72 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+     f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f13:	c1 e0 04             	shl    $0x4,%eax
+     f16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     f1c:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+     f22:	b9 22 00 00 00       	mov    $0x22,%ecx
+     f27:	ba 03 00 00 00       	mov    $0x3,%edx
+     f2c:	89 c6                	mov    %eax,%esi
+     f2e:	bf 00 00 00 00       	mov    $0x0,%edi
+     f33:	e8 98 fd ff ff       	call   cd0 <mmap2>
+     f38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+     f3c:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     f41:	75 0a                	jne    f4d <malloc+0x62>
+      return 0;
+     f43:	b8 00 00 00 00       	mov    $0x0,%eax
+     f48:	e9 1c 01 00 00       	jmp    1069 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+     f4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f51:	48 8d 15 38 05 00 00 	lea    0x538(%rip),%rdx        # 1490 <bigblock>
+     f58:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+     f5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f5f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f62:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+     f65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f69:	48 83 c0 10          	add    $0x10,%rax
+     f6d:	e9 f7 00 00 00       	jmp    1069 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+     f72:	48 8b 05 07 05 00 00 	mov    0x507(%rip),%rax        # 1480 <freep>
+     f79:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f7d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     f82:	75 2e                	jne    fb2 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+     f84:	48 8d 05 e5 04 00 00 	lea    0x4e5(%rip),%rax        # 1470 <base>
+     f8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f93:	48 89 05 e6 04 00 00 	mov    %rax,0x4e6(%rip)        # 1480 <freep>
+     f9a:	48 8b 05 df 04 00 00 	mov    0x4df(%rip),%rax        # 1480 <freep>
+     fa1:	48 89 05 c8 04 00 00 	mov    %rax,0x4c8(%rip)        # 1470 <base>
+    base.s.size = 0;
+     fa8:	c7 05 c6 04 00 00 00 	movl   $0x0,0x4c6(%rip)        # 1478 <base+0x8>
+     faf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fb6:	48 8b 00             	mov    (%rax),%rax
+     fb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+     fbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fc1:	8b 40 08             	mov    0x8(%rax),%eax
+     fc4:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+     fc7:	72 5f                	jb     1028 <malloc+0x13d>
+      if(p->s.size == nunits)
+     fc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fcd:	8b 40 08             	mov    0x8(%rax),%eax
+     fd0:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+     fd3:	75 10                	jne    fe5 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+     fd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fd9:	48 8b 10             	mov    (%rax),%rdx
+     fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fe0:	48 89 10             	mov    %rdx,(%rax)
+     fe3:	eb 2e                	jmp    1013 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+     fe5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fe9:	8b 40 08             	mov    0x8(%rax),%eax
+     fec:	2b 45 ec             	sub    -0x14(%rbp),%eax
+     fef:	89 c2                	mov    %eax,%edx
+     ff1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ff5:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+     ff8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ffc:	8b 40 08             	mov    0x8(%rax),%eax
+     fff:	89 c0                	mov    %eax,%eax
+    1001:	48 c1 e0 04          	shl    $0x4,%rax
+    1005:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1009:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    100d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1010:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1017:	48 89 05 62 04 00 00 	mov    %rax,0x462(%rip)        # 1480 <freep>
+      return (void*)(p + 1);
+    101e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1022:	48 83 c0 10          	add    $0x10,%rax
+    1026:	eb 41                	jmp    1069 <malloc+0x17e>
+    }
+    if(p == freep)
+    1028:	48 8b 05 51 04 00 00 	mov    0x451(%rip),%rax        # 1480 <freep>
+    102f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1033:	75 1c                	jne    1051 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1035:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1038:	89 c7                	mov    %eax,%edi
+    103a:	e8 47 fe ff ff       	call   e86 <morecore>
+    103f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1043:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1048:	75 07                	jne    1051 <malloc+0x166>
+        return 0;
+    104a:	b8 00 00 00 00       	mov    $0x0,%eax
+    104f:	eb 18                	jmp    1069 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1051:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1055:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1059:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105d:	48 8b 00             	mov    (%rax),%rax
+    1060:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1064:	e9 54 ff ff ff       	jmp    fbd <malloc+0xd2>
+  }
+}
+    1069:	c9                   	leave
+    106a:	c3                   	ret
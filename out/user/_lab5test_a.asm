@@ -0,0 +1,1824 @@
+
+out/user/_lab5test_a:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <modification>:
+  printf(stdout, msg,  ##__VA_ARGS__); \
+  printf(stdout, "\n"); \
+  while(1) {};} while(0)
+
+void
+modification(void) {
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+
+  printf(stdout, "modification test starting\n");
+       8:	8b 05 12 15 00 00    	mov    0x1512(%rip),%eax        # 1520 <stdout>
+       e:	48 8d 15 23 11 00 00 	lea    0x1123(%rip),%rdx        # 1138 <malloc+0x184>
+      15:	48 89 d6             	mov    %rdx,%rsi
+      18:	89 c7                	mov    %eax,%edi
+      1a:	b8 00 00 00 00       	mov    $0x0,%eax
+      1f:	e8 0e 07 00 00       	call   732 <printf>
+  strcpy(buf, "lab5 is 451's last lab.\n");
+      24:	48 8d 05 29 11 00 00 	lea    0x1129(%rip),%rax        # 1154 <malloc+0x1a0>
+      2b:	48 89 c6             	mov    %rax,%rsi
+      2e:	48 8d 05 8b 15 00 00 	lea    0x158b(%rip),%rax        # 15c0 <buf>
+      35:	48 89 c7             	mov    %rax,%rdi
+      38:	e8 f7 09 00 00       	call   a34 <strcpy>
+  fd = open("small.txt", O_RDWR);
+      3d:	be 02 00 00 00       	mov    $0x2,%esi
+      42:	48 8d 05 24 11 00 00 	lea    0x1124(%rip),%rax        # 116d <malloc+0x1b9>
+      49:	48 89 c7             	mov    %rax,%rdi
+      4c:	e8 c8 0c 00 00       	call   d19 <open>
+      51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  write(fd, buf, 50);
+      54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      57:	ba 32 00 00 00       	mov    $0x32,%edx
+      5c:	48 8d 0d 5d 15 00 00 	lea    0x155d(%rip),%rcx        # 15c0 <buf>
+      63:	48 89 ce             	mov    %rcx,%rsi
+      66:	89 c7                	mov    %eax,%edi
+      68:	e8 8c 0c 00 00       	call   cf9 <write>
+  close(fd);
+      6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      70:	89 c7                	mov    %eax,%edi
+      72:	e8 8a 0c 00 00       	call   d01 <close>
+
+  fd = open("small.txt", O_RDONLY);
+      77:	be 00 00 00 00       	mov    $0x0,%esi
+      7c:	48 8d 05 ea 10 00 00 	lea    0x10ea(%rip),%rax        # 116d <malloc+0x1b9>
+      83:	48 89 c7             	mov    %rax,%rdi
+      86:	e8 8e 0c 00 00       	call   d19 <open>
+      8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  read(fd, buf, 50);
+      8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      91:	ba 32 00 00 00       	mov    $0x32,%edx
+      96:	48 8d 0d 23 15 00 00 	lea    0x1523(%rip),%rcx        # 15c0 <buf>
+      9d:	48 89 ce             	mov    %rcx,%rsi
+      a0:	89 c7                	mov    %eax,%edi
+      a2:	e8 4a 0c 00 00       	call   cf1 <read>
+
+  if (strcmp(buf, "lab5 is 451's last lab.\n") != 0)
+      a7:	48 8d 05 a6 10 00 00 	lea    0x10a6(%rip),%rax        # 1154 <malloc+0x1a0>
+      ae:	48 89 c6             	mov    %rax,%rsi
+      b1:	48 8d 05 08 15 00 00 	lea    0x1508(%rip),%rax        # 15c0 <buf>
+      b8:	48 89 c7             	mov    %rax,%rdi
+      bb:	e8 b3 09 00 00       	call   a73 <strcmp>
+      c0:	85 c0                	test   %eax,%eax
+      c2:	74 63                	je     127 <modification+0x127>
+    error("file content was not lab5 is 451's last lab., was: '%s'", buf);
+      c4:	8b 05 56 14 00 00    	mov    0x1456(%rip),%eax        # 1520 <stdout>
+      ca:	ba 22 00 00 00       	mov    $0x22,%edx
+      cf:	48 8d 0d a1 10 00 00 	lea    0x10a1(%rip),%rcx        # 1177 <malloc+0x1c3>
+      d6:	48 89 ce             	mov    %rcx,%rsi
+      d9:	89 c7                	mov    %eax,%edi
+      db:	b8 00 00 00 00       	mov    $0x0,%eax
+      e0:	e8 4d 06 00 00       	call   732 <printf>
+      e5:	8b 05 35 14 00 00    	mov    0x1435(%rip),%eax        # 1520 <stdout>
+      eb:	48 8d 15 ce 14 00 00 	lea    0x14ce(%rip),%rdx        # 15c0 <buf>
+      f2:	48 8d 0d 97 10 00 00 	lea    0x1097(%rip),%rcx        # 1190 <malloc+0x1dc>
+      f9:	48 89 ce             	mov    %rcx,%rsi
+      fc:	89 c7                	mov    %eax,%edi
+      fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     103:	e8 2a 06 00 00       	call   732 <printf>
+     108:	8b 05 12 14 00 00    	mov    0x1412(%rip),%eax        # 1520 <stdout>
+     10e:	48 8d 15 b3 10 00 00 	lea    0x10b3(%rip),%rdx        # 11c8 <malloc+0x214>
+     115:	48 89 d6             	mov    %rdx,%rsi
+     118:	89 c7                	mov    %eax,%edi
+     11a:	b8 00 00 00 00       	mov    $0x0,%eax
+     11f:	e8 0e 06 00 00       	call   732 <printf>
+     124:	90                   	nop
+     125:	eb fd                	jmp    124 <modification+0x124>
+
+  close(fd);
+     127:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     12a:	89 c7                	mov    %eax,%edi
+     12c:	e8 d0 0b 00 00       	call   d01 <close>
+
+  printf(stdout, "modification test ok!\n");
+     131:	8b 05 e9 13 00 00    	mov    0x13e9(%rip),%eax        # 1520 <stdout>
+     137:	48 8d 15 8c 10 00 00 	lea    0x108c(%rip),%rdx        # 11ca <malloc+0x216>
+     13e:	48 89 d6             	mov    %rdx,%rsi
+     141:	89 c7                	mov    %eax,%edi
+     143:	b8 00 00 00 00       	mov    $0x0,%eax
+     148:	e8 e5 05 00 00       	call   732 <printf>
+}
+     14d:	90                   	nop
+     14e:	c9                   	leave
+     14f:	c3                   	ret
+
+0000000000000150 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     150:	55                   	push   %rbp
+     151:	48 89 e5             	mov    %rsp,%rbp
+     154:	48 83 ec 50          	sub    $0x50,%rsp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     158:	48 8d 05 82 10 00 00 	lea    0x1082(%rip),%rax        # 11e1 <malloc+0x22d>
+     15f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+     163:	48 8d 05 7a 10 00 00 	lea    0x107a(%rip),%rax        # 11e4 <malloc+0x230>
+     16a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+     16e:	48 8d 05 72 10 00 00 	lea    0x1072(%rip),%rax        # 11e7 <malloc+0x233>
+     175:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     179:	48 8d 05 6a 10 00 00 	lea    0x106a(%rip),%rax        # 11ea <malloc+0x236>
+     180:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     184:	48 8d 05 62 10 00 00 	lea    0x1062(%rip),%rax        # 11ed <malloc+0x239>
+     18b:	48 89 c6             	mov    %rax,%rsi
+     18e:	bf 01 00 00 00       	mov    $0x1,%edi
+     193:	b8 00 00 00 00       	mov    $0x0,%eax
+     198:	e8 95 05 00 00       	call   732 <printf>
+
+  for(pi = 0; pi < 4; pi++){
+     19d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     1a4:	e9 bb 01 00 00       	jmp    364 <fourfiles+0x214>
+    fname = names[pi];
+     1a9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     1ac:	48 98                	cltq
+     1ae:	48 8b 44 c5 b8       	mov    -0x48(%rbp,%rax,8),%rax
+     1b3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+    pid = fork();
+     1b7:	e8 15 0b 00 00       	call   cd1 <fork>
+     1bc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if(pid < 0){
+     1bf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     1c3:	79 5c                	jns    221 <fourfiles+0xd1>
+      error("fork failed\n");
+     1c5:	8b 05 55 13 00 00    	mov    0x1355(%rip),%eax        # 1520 <stdout>
+     1cb:	ba 39 00 00 00       	mov    $0x39,%edx
+     1d0:	48 8d 0d a0 0f 00 00 	lea    0xfa0(%rip),%rcx        # 1177 <malloc+0x1c3>
+     1d7:	48 89 ce             	mov    %rcx,%rsi
+     1da:	89 c7                	mov    %eax,%edi
+     1dc:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e1:	e8 4c 05 00 00       	call   732 <printf>
+     1e6:	8b 05 34 13 00 00    	mov    0x1334(%rip),%eax        # 1520 <stdout>
+     1ec:	48 8d 15 0a 10 00 00 	lea    0x100a(%rip),%rdx        # 11fd <malloc+0x249>
+     1f3:	48 89 d6             	mov    %rdx,%rsi
+     1f6:	89 c7                	mov    %eax,%edi
+     1f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1fd:	e8 30 05 00 00       	call   732 <printf>
+     202:	8b 05 18 13 00 00    	mov    0x1318(%rip),%eax        # 1520 <stdout>
+     208:	48 8d 15 b9 0f 00 00 	lea    0xfb9(%rip),%rdx        # 11c8 <malloc+0x214>
+     20f:	48 89 d6             	mov    %rdx,%rsi
+     212:	89 c7                	mov    %eax,%edi
+     214:	b8 00 00 00 00       	mov    $0x0,%eax
+     219:	e8 14 05 00 00       	call   732 <printf>
+     21e:	90                   	nop
+     21f:	eb fd                	jmp    21e <fourfiles+0xce>
+    }
+
+    if(pid == 0){
+     221:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+     225:	0f 85 35 01 00 00    	jne    360 <fourfiles+0x210>
+      fd = open(fname, O_CREATE | O_RDWR);
+     22b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     22f:	be 02 02 00 00       	mov    $0x202,%esi
+     234:	48 89 c7             	mov    %rax,%rdi
+     237:	e8 dd 0a 00 00       	call   d19 <open>
+     23c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+      if(fd < 0){
+     23f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     243:	79 5c                	jns    2a1 <fourfiles+0x151>
+        error("create failed\n");
+     245:	8b 05 d5 12 00 00    	mov    0x12d5(%rip),%eax        # 1520 <stdout>
+     24b:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     250:	48 8d 0d 20 0f 00 00 	lea    0xf20(%rip),%rcx        # 1177 <malloc+0x1c3>
+     257:	48 89 ce             	mov    %rcx,%rsi
+     25a:	89 c7                	mov    %eax,%edi
+     25c:	b8 00 00 00 00       	mov    $0x0,%eax
+     261:	e8 cc 04 00 00       	call   732 <printf>
+     266:	8b 05 b4 12 00 00    	mov    0x12b4(%rip),%eax        # 1520 <stdout>
+     26c:	48 8d 15 97 0f 00 00 	lea    0xf97(%rip),%rdx        # 120a <malloc+0x256>
+     273:	48 89 d6             	mov    %rdx,%rsi
+     276:	89 c7                	mov    %eax,%edi
+     278:	b8 00 00 00 00       	mov    $0x0,%eax
+     27d:	e8 b0 04 00 00       	call   732 <printf>
+     282:	8b 05 98 12 00 00    	mov    0x1298(%rip),%eax        # 1520 <stdout>
+     288:	48 8d 15 39 0f 00 00 	lea    0xf39(%rip),%rdx        # 11c8 <malloc+0x214>
+     28f:	48 89 d6             	mov    %rdx,%rsi
+     292:	89 c7                	mov    %eax,%edi
+     294:	b8 00 00 00 00       	mov    $0x0,%eax
+     299:	e8 94 04 00 00       	call   732 <printf>
+     29e:	90                   	nop
+     29f:	eb fd                	jmp    29e <fourfiles+0x14e>
+      }
+
+      memset(buf, '0'+pi, 512);
+     2a1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     2a4:	83 c0 30             	add    $0x30,%eax
+     2a7:	ba 00 02 00 00       	mov    $0x200,%edx
+     2ac:	89 c6                	mov    %eax,%esi
+     2ae:	48 8d 05 0b 13 00 00 	lea    0x130b(%rip),%rax        # 15c0 <buf>
+     2b5:	48 89 c7             	mov    %rax,%rdi
+     2b8:	e8 33 08 00 00       	call   af0 <memset>
+      for(i = 0; i < 12; i++){
+     2bd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2c4:	e9 88 00 00 00       	jmp    351 <fourfiles+0x201>
+        if((n = write(fd, buf, 500)) != 500){
+     2c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     2cc:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     2d1:	48 8d 0d e8 12 00 00 	lea    0x12e8(%rip),%rcx        # 15c0 <buf>
+     2d8:	48 89 ce             	mov    %rcx,%rsi
+     2db:	89 c7                	mov    %eax,%edi
+     2dd:	e8 17 0a 00 00       	call   cf9 <write>
+     2e2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+     2e5:	81 7d e0 f4 01 00 00 	cmpl   $0x1f4,-0x20(%rbp)
+     2ec:	74 5f                	je     34d <fourfiles+0x1fd>
+          error("write failed %d\n", n);
+     2ee:	8b 05 2c 12 00 00    	mov    0x122c(%rip),%eax        # 1520 <stdout>
+     2f4:	ba 45 00 00 00       	mov    $0x45,%edx
+     2f9:	48 8d 0d 77 0e 00 00 	lea    0xe77(%rip),%rcx        # 1177 <malloc+0x1c3>
+     300:	48 89 ce             	mov    %rcx,%rsi
+     303:	89 c7                	mov    %eax,%edi
+     305:	b8 00 00 00 00       	mov    $0x0,%eax
+     30a:	e8 23 04 00 00       	call   732 <printf>
+     30f:	8b 05 0b 12 00 00    	mov    0x120b(%rip),%eax        # 1520 <stdout>
+     315:	8b 55 e0             	mov    -0x20(%rbp),%edx
+     318:	48 8d 0d fa 0e 00 00 	lea    0xefa(%rip),%rcx        # 1219 <malloc+0x265>
+     31f:	48 89 ce             	mov    %rcx,%rsi
+     322:	89 c7                	mov    %eax,%edi
+     324:	b8 00 00 00 00       	mov    $0x0,%eax
+     329:	e8 04 04 00 00       	call   732 <printf>
+     32e:	8b 05 ec 11 00 00    	mov    0x11ec(%rip),%eax        # 1520 <stdout>
+     334:	48 8d 15 8d 0e 00 00 	lea    0xe8d(%rip),%rdx        # 11c8 <malloc+0x214>
+     33b:	48 89 d6             	mov    %rdx,%rsi
+     33e:	89 c7                	mov    %eax,%edi
+     340:	b8 00 00 00 00       	mov    $0x0,%eax
+     345:	e8 e8 03 00 00       	call   732 <printf>
+     34a:	90                   	nop
+     34b:	eb fd                	jmp    34a <fourfiles+0x1fa>
+      for(i = 0; i < 12; i++){
+     34d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     351:	83 7d fc 0b          	cmpl   $0xb,-0x4(%rbp)
+     355:	0f 8e 6e ff ff ff    	jle    2c9 <fourfiles+0x179>
+        }
+      }
+      exit();
+     35b:	e8 79 09 00 00       	call   cd9 <exit>
+  for(pi = 0; pi < 4; pi++){
+     360:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     364:	83 7d f0 03          	cmpl   $0x3,-0x10(%rbp)
+     368:	0f 8e 3b fe ff ff    	jle    1a9 <fourfiles+0x59>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+     36e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+     375:	eb 09                	jmp    380 <fourfiles+0x230>
+    wait();
+     377:	e8 65 09 00 00       	call   ce1 <wait>
+  for(pi = 0; pi < 4; pi++){
+     37c:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+     380:	83 7d f0 03          	cmpl   $0x3,-0x10(%rbp)
+     384:	7e f1                	jle    377 <fourfiles+0x227>
+  }
+
+  for(i = 0; i < 2; i++){
+     386:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     38d:	e9 62 01 00 00       	jmp    4f4 <fourfiles+0x3a4>
+    fname = names[i];
+     392:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     395:	48 98                	cltq
+     397:	48 8b 44 c5 b8       	mov    -0x48(%rbp,%rax,8),%rax
+     39c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    fd = open(fname, 0);
+     3a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     3a4:	be 00 00 00 00       	mov    $0x0,%esi
+     3a9:	48 89 c7             	mov    %rax,%rdi
+     3ac:	e8 68 09 00 00       	call   d19 <open>
+     3b1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    total = 0;
+     3b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     3bb:	e9 98 00 00 00       	jmp    458 <fourfiles+0x308>
+      for(j = 0; j < n; j++){
+     3c0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     3c7:	eb 7d                	jmp    446 <fourfiles+0x2f6>
+        if(buf[j] != '0'+i){
+     3c9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3cc:	48 98                	cltq
+     3ce:	48 8d 15 eb 11 00 00 	lea    0x11eb(%rip),%rdx        # 15c0 <buf>
+     3d5:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     3d9:	0f be d0             	movsbl %al,%edx
+     3dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3df:	83 c0 30             	add    $0x30,%eax
+     3e2:	39 c2                	cmp    %eax,%edx
+     3e4:	74 5c                	je     442 <fourfiles+0x2f2>
+          error("wrong char\n");
+     3e6:	8b 05 34 11 00 00    	mov    0x1134(%rip),%eax        # 1520 <stdout>
+     3ec:	ba 57 00 00 00       	mov    $0x57,%edx
+     3f1:	48 8d 0d 7f 0d 00 00 	lea    0xd7f(%rip),%rcx        # 1177 <malloc+0x1c3>
+     3f8:	48 89 ce             	mov    %rcx,%rsi
+     3fb:	89 c7                	mov    %eax,%edi
+     3fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     402:	e8 2b 03 00 00       	call   732 <printf>
+     407:	8b 05 13 11 00 00    	mov    0x1113(%rip),%eax        # 1520 <stdout>
+     40d:	48 8d 15 16 0e 00 00 	lea    0xe16(%rip),%rdx        # 122a <malloc+0x276>
+     414:	48 89 d6             	mov    %rdx,%rsi
+     417:	89 c7                	mov    %eax,%edi
+     419:	b8 00 00 00 00       	mov    $0x0,%eax
+     41e:	e8 0f 03 00 00       	call   732 <printf>
+     423:	8b 05 f7 10 00 00    	mov    0x10f7(%rip),%eax        # 1520 <stdout>
+     429:	48 8d 15 98 0d 00 00 	lea    0xd98(%rip),%rdx        # 11c8 <malloc+0x214>
+     430:	48 89 d6             	mov    %rdx,%rsi
+     433:	89 c7                	mov    %eax,%edi
+     435:	b8 00 00 00 00       	mov    $0x0,%eax
+     43a:	e8 f3 02 00 00       	call   732 <printf>
+     43f:	90                   	nop
+     440:	eb fd                	jmp    43f <fourfiles+0x2ef>
+      for(j = 0; j < n; j++){
+     442:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     446:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     449:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+     44c:	0f 8c 77 ff ff ff    	jl     3c9 <fourfiles+0x279>
+        }
+      }
+      total += n;
+     452:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     455:	01 45 f4             	add    %eax,-0xc(%rbp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     458:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     45b:	ba 00 20 00 00       	mov    $0x2000,%edx
+     460:	48 8d 0d 59 11 00 00 	lea    0x1159(%rip),%rcx        # 15c0 <buf>
+     467:	48 89 ce             	mov    %rcx,%rsi
+     46a:	89 c7                	mov    %eax,%edi
+     46c:	e8 80 08 00 00       	call   cf1 <read>
+     471:	89 45 e0             	mov    %eax,-0x20(%rbp)
+     474:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+     478:	0f 8f 42 ff ff ff    	jg     3c0 <fourfiles+0x270>
+    }
+    close(fd);
+     47e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     481:	89 c7                	mov    %eax,%edi
+     483:	e8 79 08 00 00       	call   d01 <close>
+    if(total != 12*500){
+     488:	81 7d f4 70 17 00 00 	cmpl   $0x1770,-0xc(%rbp)
+     48f:	74 5f                	je     4f0 <fourfiles+0x3a0>
+      error("wrong length %d\n", total);
+     491:	8b 05 89 10 00 00    	mov    0x1089(%rip),%eax        # 1520 <stdout>
+     497:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     49c:	48 8d 0d d4 0c 00 00 	lea    0xcd4(%rip),%rcx        # 1177 <malloc+0x1c3>
+     4a3:	48 89 ce             	mov    %rcx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 80 02 00 00       	call   732 <printf>
+     4b2:	8b 05 68 10 00 00    	mov    0x1068(%rip),%eax        # 1520 <stdout>
+     4b8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     4bb:	48 8d 0d 74 0d 00 00 	lea    0xd74(%rip),%rcx        # 1236 <malloc+0x282>
+     4c2:	48 89 ce             	mov    %rcx,%rsi
+     4c5:	89 c7                	mov    %eax,%edi
+     4c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     4cc:	e8 61 02 00 00       	call   732 <printf>
+     4d1:	8b 05 49 10 00 00    	mov    0x1049(%rip),%eax        # 1520 <stdout>
+     4d7:	48 8d 15 ea 0c 00 00 	lea    0xcea(%rip),%rdx        # 11c8 <malloc+0x214>
+     4de:	48 89 d6             	mov    %rdx,%rsi
+     4e1:	89 c7                	mov    %eax,%edi
+     4e3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e8:	e8 45 02 00 00       	call   732 <printf>
+     4ed:	90                   	nop
+     4ee:	eb fd                	jmp    4ed <fourfiles+0x39d>
+  for(i = 0; i < 2; i++){
+     4f0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     4f4:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+     4f8:	0f 8e 94 fe ff ff    	jle    392 <fourfiles+0x242>
+    }
+  }
+
+  printf(1, "fourfiles ok\n");
+     4fe:	48 8d 05 42 0d 00 00 	lea    0xd42(%rip),%rax        # 1247 <malloc+0x293>
+     505:	48 89 c6             	mov    %rax,%rsi
+     508:	bf 01 00 00 00       	mov    $0x1,%edi
+     50d:	b8 00 00 00 00       	mov    $0x0,%eax
+     512:	e8 1b 02 00 00       	call   732 <printf>
+}
+     517:	90                   	nop
+     518:	c9                   	leave
+     519:	c3                   	ret
+
+000000000000051a <main>:
+
+int
+main(int argc, char *argv[])
+{
+     51a:	55                   	push   %rbp
+     51b:	48 89 e5             	mov    %rsp,%rbp
+     51e:	48 83 ec 10          	sub    $0x10,%rsp
+     522:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     525:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab5test_a starting\n");
+     529:	8b 05 f1 0f 00 00    	mov    0xff1(%rip),%eax        # 1520 <stdout>
+     52f:	48 8d 15 1f 0d 00 00 	lea    0xd1f(%rip),%rdx        # 1255 <malloc+0x2a1>
+     536:	48 89 d6             	mov    %rdx,%rsi
+     539:	89 c7                	mov    %eax,%edi
+     53b:	b8 00 00 00 00       	mov    $0x0,%eax
+     540:	e8 ed 01 00 00       	call   732 <printf>
+  modification();
+     545:	e8 b6 fa ff ff       	call   0 <modification>
+  fourfiles();
+     54a:	e8 01 fc ff ff       	call   150 <fourfiles>
+
+  printf(stdout, "lab5test_a passed!\n");
+     54f:	8b 05 cb 0f 00 00    	mov    0xfcb(%rip),%eax        # 1520 <stdout>
+     555:	48 8d 15 0e 0d 00 00 	lea    0xd0e(%rip),%rdx        # 126a <malloc+0x2b6>
+     55c:	48 89 d6             	mov    %rdx,%rsi
+     55f:	89 c7                	mov    %eax,%edi
+     561:	b8 00 00 00 00       	mov    $0x0,%eax
+     566:	e8 c7 01 00 00       	call   732 <printf>
+  exit();
+     56b:	e8 69 07 00 00       	call   cd9 <exit>
+
+0000000000000570 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     570:	55                   	push   %rbp
+     571:	48 89 e5             	mov    %rsp,%rbp
+     574:	48 83 ec 10          	sub    $0x10,%rsp
+     578:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     57b:	89 f0                	mov    %esi,%eax
+     57d:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     580:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     584:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     587:	ba 01 00 00 00       	mov    $0x1,%edx
+     58c:	48 89 ce             	mov    %rcx,%rsi
+     58f:	89 c7                	mov    %eax,%edi
+     591:	e8 63 07 00 00       	call   cf9 <write>
+}
+     596:	90                   	nop
+     597:	c9                   	leave
+     598:	c3                   	ret
+
+0000000000000599 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     599:	55                   	push   %rbp
+     59a:	48 89 e5             	mov    %rsp,%rbp
+     59d:	48 83 ec 40          	sub    $0x40,%rsp
+     5a1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     5a4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     5a7:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     5aa:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     5ad:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     5b1:	74 1f                	je     5d2 <printint64+0x39>
+     5b3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5b6:	c1 e8 1f             	shr    $0x1f,%eax
+     5b9:	0f b6 c0             	movzbl %al,%eax
+     5bc:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     5bf:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     5c3:	74 0d                	je     5d2 <printint64+0x39>
+    x = -xx;
+     5c5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5c8:	f7 d8                	neg    %eax
+     5ca:	48 98                	cltq
+     5cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     5d0:	eb 09                	jmp    5db <printint64+0x42>
+  else
+    x = xx;
+     5d2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     5d5:	48 98                	cltq
+     5d7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     5db:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     5e2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     5e5:	48 63 c8             	movslq %eax,%rcx
+     5e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ec:	ba 00 00 00 00       	mov    $0x0,%edx
+     5f1:	48 f7 f1             	div    %rcx
+     5f4:	48 89 d1             	mov    %rdx,%rcx
+     5f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5fa:	8d 50 01             	lea    0x1(%rax),%edx
+     5fd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     600:	48 8d 15 29 0f 00 00 	lea    0xf29(%rip),%rdx        # 1530 <digits.1>
+     607:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     60b:	48 98                	cltq
+     60d:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     611:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     614:	48 63 f0             	movslq %eax,%rsi
+     617:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     61b:	ba 00 00 00 00       	mov    $0x0,%edx
+     620:	48 f7 f6             	div    %rsi
+     623:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     627:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     62c:	75 b4                	jne    5e2 <printint64+0x49>
+
+  if(sgn)
+     62e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     632:	74 2b                	je     65f <printint64+0xc6>
+    buf[i++] = '-';
+     634:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     637:	8d 50 01             	lea    0x1(%rax),%edx
+     63a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     63d:	48 98                	cltq
+     63f:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     644:	eb 19                	jmp    65f <printint64+0xc6>
+    putc(fd, buf[i]);
+     646:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     649:	48 98                	cltq
+     64b:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     650:	0f be d0             	movsbl %al,%edx
+     653:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     656:	89 d6                	mov    %edx,%esi
+     658:	89 c7                	mov    %eax,%edi
+     65a:	e8 11 ff ff ff       	call   570 <putc>
+  while(--i >= 0)
+     65f:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     663:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     667:	79 dd                	jns    646 <printint64+0xad>
+}
+     669:	90                   	nop
+     66a:	90                   	nop
+     66b:	c9                   	leave
+     66c:	c3                   	ret
+
+000000000000066d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     66d:	55                   	push   %rbp
+     66e:	48 89 e5             	mov    %rsp,%rbp
+     671:	48 83 ec 30          	sub    $0x30,%rsp
+     675:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     678:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     67b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     67e:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     681:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     688:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     68c:	74 17                	je     6a5 <printint+0x38>
+     68e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     692:	79 11                	jns    6a5 <printint+0x38>
+    neg = 1;
+     694:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     69b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     69e:	f7 d8                	neg    %eax
+     6a0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6a3:	eb 06                	jmp    6ab <printint+0x3e>
+  } else {
+    x = xx;
+     6a5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     6a8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     6ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     6b2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     6b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6b8:	ba 00 00 00 00       	mov    $0x0,%edx
+     6bd:	f7 f1                	div    %ecx
+     6bf:	89 d1                	mov    %edx,%ecx
+     6c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6c4:	8d 50 01             	lea    0x1(%rax),%edx
+     6c7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     6ca:	89 c9                	mov    %ecx,%ecx
+     6cc:	48 8d 15 7d 0e 00 00 	lea    0xe7d(%rip),%rdx        # 1550 <digits.0>
+     6d3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     6d7:	48 98                	cltq
+     6d9:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     6dd:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     6e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6e3:	ba 00 00 00 00       	mov    $0x0,%edx
+     6e8:	f7 f6                	div    %esi
+     6ea:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     6ed:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     6f1:	75 bf                	jne    6b2 <printint+0x45>
+  if(neg)
+     6f3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     6f7:	74 2b                	je     724 <printint+0xb7>
+    buf[i++] = '-';
+     6f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     6fc:	8d 50 01             	lea    0x1(%rax),%edx
+     6ff:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     702:	48 98                	cltq
+     704:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     709:	eb 19                	jmp    724 <printint+0xb7>
+    putc(fd, buf[i]);
+     70b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     70e:	48 98                	cltq
+     710:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     715:	0f be d0             	movsbl %al,%edx
+     718:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     71b:	89 d6                	mov    %edx,%esi
+     71d:	89 c7                	mov    %eax,%edi
+     71f:	e8 4c fe ff ff       	call   570 <putc>
+  while(--i >= 0)
+     724:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     728:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     72c:	79 dd                	jns    70b <printint+0x9e>
+}
+     72e:	90                   	nop
+     72f:	90                   	nop
+     730:	c9                   	leave
+     731:	c3                   	ret
+
+0000000000000732 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     732:	55                   	push   %rbp
+     733:	48 89 e5             	mov    %rsp,%rbp
+     736:	48 83 ec 70          	sub    $0x70,%rsp
+     73a:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     73d:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     741:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     745:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     749:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     74d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     751:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     758:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     75c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     760:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     764:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     768:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     76f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     776:	e9 6b 02 00 00       	jmp    9e6 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     77b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     77e:	48 63 d0             	movslq %eax,%rdx
+     781:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     785:	48 01 d0             	add    %rdx,%rax
+     788:	0f b6 00             	movzbl (%rax),%eax
+     78b:	0f be c0             	movsbl %al,%eax
+     78e:	25 ff 00 00 00       	and    $0xff,%eax
+     793:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     796:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     79a:	75 30                	jne    7cc <printf+0x9a>
+      if(c == '%'){
+     79c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     7a0:	75 13                	jne    7b5 <printf+0x83>
+        state = '%';
+     7a2:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     7a9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     7b0:	e9 2d 02 00 00       	jmp    9e2 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     7b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     7b8:	0f be d0             	movsbl %al,%edx
+     7bb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     7be:	89 d6                	mov    %edx,%esi
+     7c0:	89 c7                	mov    %eax,%edi
+     7c2:	e8 a9 fd ff ff       	call   570 <putc>
+     7c7:	e9 16 02 00 00       	jmp    9e2 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     7cc:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     7d0:	0f 85 0c 02 00 00    	jne    9e2 <printf+0x2b0>
+      if(c == 'l') {
+     7d6:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     7da:	75 0c                	jne    7e8 <printf+0xb6>
+        lflag = 1;
+     7dc:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     7e3:	e9 fa 01 00 00       	jmp    9e2 <printf+0x2b0>
+      } else if(c == 'd'){
+     7e8:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     7ec:	0f 85 95 00 00 00    	jne    887 <printf+0x155>
+        if (lflag == 1)
+     7f2:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     7f6:	75 49                	jne    841 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     7f8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     7fb:	83 f8 2f             	cmp    $0x2f,%eax
+     7fe:	77 17                	ja     817 <printf+0xe5>
+     800:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     804:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     807:	89 d2                	mov    %edx,%edx
+     809:	48 01 d0             	add    %rdx,%rax
+     80c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     80f:	83 c2 08             	add    $0x8,%edx
+     812:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     815:	eb 0c                	jmp    823 <printf+0xf1>
+     817:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     81b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     81f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     823:	48 8b 00             	mov    (%rax),%rax
+     826:	89 c6                	mov    %eax,%esi
+     828:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     82b:	b9 01 00 00 00       	mov    $0x1,%ecx
+     830:	ba 0a 00 00 00       	mov    $0xa,%edx
+     835:	89 c7                	mov    %eax,%edi
+     837:	e8 5d fd ff ff       	call   599 <printint64>
+     83c:	e9 9a 01 00 00       	jmp    9db <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     841:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     844:	83 f8 2f             	cmp    $0x2f,%eax
+     847:	77 17                	ja     860 <printf+0x12e>
+     849:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     84d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     850:	89 d2                	mov    %edx,%edx
+     852:	48 01 d0             	add    %rdx,%rax
+     855:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     858:	83 c2 08             	add    $0x8,%edx
+     85b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     85e:	eb 0c                	jmp    86c <printf+0x13a>
+     860:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     864:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     868:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     86c:	8b 30                	mov    (%rax),%esi
+     86e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     871:	b9 01 00 00 00       	mov    $0x1,%ecx
+     876:	ba 0a 00 00 00       	mov    $0xa,%edx
+     87b:	89 c7                	mov    %eax,%edi
+     87d:	e8 eb fd ff ff       	call   66d <printint>
+     882:	e9 54 01 00 00       	jmp    9db <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     887:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     88b:	74 0a                	je     897 <printf+0x165>
+     88d:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     891:	0f 85 95 00 00 00    	jne    92c <printf+0x1fa>
+        if (lflag == 1)
+     897:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     89b:	75 49                	jne    8e6 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     89d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8a0:	83 f8 2f             	cmp    $0x2f,%eax
+     8a3:	77 17                	ja     8bc <printf+0x18a>
+     8a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8a9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8ac:	89 d2                	mov    %edx,%edx
+     8ae:	48 01 d0             	add    %rdx,%rax
+     8b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8b4:	83 c2 08             	add    $0x8,%edx
+     8b7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     8ba:	eb 0c                	jmp    8c8 <printf+0x196>
+     8bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     8c0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     8c4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     8c8:	48 8b 00             	mov    (%rax),%rax
+     8cb:	89 c6                	mov    %eax,%esi
+     8cd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     8d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     8d5:	ba 10 00 00 00       	mov    $0x10,%edx
+     8da:	89 c7                	mov    %eax,%edi
+     8dc:	e8 b8 fc ff ff       	call   599 <printint64>
+        if (lflag == 1)
+     8e1:	e9 f5 00 00 00       	jmp    9db <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     8e6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     8e9:	83 f8 2f             	cmp    $0x2f,%eax
+     8ec:	77 17                	ja     905 <printf+0x1d3>
+     8ee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     8f2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8f5:	89 d2                	mov    %edx,%edx
+     8f7:	48 01 d0             	add    %rdx,%rax
+     8fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     8fd:	83 c2 08             	add    $0x8,%edx
+     900:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     903:	eb 0c                	jmp    911 <printf+0x1df>
+     905:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     909:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     90d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     911:	8b 30                	mov    (%rax),%esi
+     913:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     916:	b9 00 00 00 00       	mov    $0x0,%ecx
+     91b:	ba 10 00 00 00       	mov    $0x10,%edx
+     920:	89 c7                	mov    %eax,%edi
+     922:	e8 46 fd ff ff       	call   66d <printint>
+        if (lflag == 1)
+     927:	e9 af 00 00 00       	jmp    9db <printf+0x2a9>
+      } else if(c == 's'){
+     92c:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     930:	75 6e                	jne    9a0 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     932:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     935:	83 f8 2f             	cmp    $0x2f,%eax
+     938:	77 17                	ja     951 <printf+0x21f>
+     93a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     93e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     941:	89 d2                	mov    %edx,%edx
+     943:	48 01 d0             	add    %rdx,%rax
+     946:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     949:	83 c2 08             	add    $0x8,%edx
+     94c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     94f:	eb 0c                	jmp    95d <printf+0x22b>
+     951:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     955:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     959:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     95d:	48 8b 00             	mov    (%rax),%rax
+     960:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     964:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     969:	75 28                	jne    993 <printf+0x261>
+          s = "(null)";
+     96b:	48 8d 05 0c 09 00 00 	lea    0x90c(%rip),%rax        # 127e <malloc+0x2ca>
+     972:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     976:	eb 1b                	jmp    993 <printf+0x261>
+          putc(fd, *s);
+     978:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     97c:	0f b6 00             	movzbl (%rax),%eax
+     97f:	0f be d0             	movsbl %al,%edx
+     982:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     985:	89 d6                	mov    %edx,%esi
+     987:	89 c7                	mov    %eax,%edi
+     989:	e8 e2 fb ff ff       	call   570 <putc>
+        for(; *s; s++)
+     98e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     993:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     997:	0f b6 00             	movzbl (%rax),%eax
+     99a:	84 c0                	test   %al,%al
+     99c:	75 da                	jne    978 <printf+0x246>
+     99e:	eb 3b                	jmp    9db <printf+0x2a9>
+      } else if(c == '%'){
+     9a0:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     9a4:	75 14                	jne    9ba <printf+0x288>
+        putc(fd, c);
+     9a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9a9:	0f be d0             	movsbl %al,%edx
+     9ac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9af:	89 d6                	mov    %edx,%esi
+     9b1:	89 c7                	mov    %eax,%edi
+     9b3:	e8 b8 fb ff ff       	call   570 <putc>
+     9b8:	eb 21                	jmp    9db <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     9ba:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9bd:	be 25 00 00 00       	mov    $0x25,%esi
+     9c2:	89 c7                	mov    %eax,%edi
+     9c4:	e8 a7 fb ff ff       	call   570 <putc>
+        putc(fd, c);
+     9c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     9cc:	0f be d0             	movsbl %al,%edx
+     9cf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9d2:	89 d6                	mov    %edx,%esi
+     9d4:	89 c7                	mov    %eax,%edi
+     9d6:	e8 95 fb ff ff       	call   570 <putc>
+      }
+      state = 0;
+     9db:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     9e2:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     9e6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     9e9:	48 63 d0             	movslq %eax,%rdx
+     9ec:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     9f0:	48 01 d0             	add    %rdx,%rax
+     9f3:	0f b6 00             	movzbl (%rax),%eax
+     9f6:	84 c0                	test   %al,%al
+     9f8:	0f 85 7d fd ff ff    	jne    77b <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     9fe:	90                   	nop
+     9ff:	90                   	nop
+     a00:	c9                   	leave
+     a01:	c3                   	ret
+
+0000000000000a02 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     a02:	55                   	push   %rbp
+     a03:	48 89 e5             	mov    %rsp,%rbp
+     a06:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a0a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     a0d:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     a10:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     a14:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     a17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     a1a:	48 89 ce             	mov    %rcx,%rsi
+     a1d:	48 89 f7             	mov    %rsi,%rdi
+     a20:	89 d1                	mov    %edx,%ecx
+     a22:	fc                   	cld
+     a23:	f3 aa                	rep stos %al,%es:(%rdi)
+     a25:	89 ca                	mov    %ecx,%edx
+     a27:	48 89 fe             	mov    %rdi,%rsi
+     a2a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     a2e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+     a31:	90                   	nop
+     a32:	5d                   	pop    %rbp
+     a33:	c3                   	ret
+
+0000000000000a34 <strcpy>:
+{
+     a34:	55                   	push   %rbp
+     a35:	48 89 e5             	mov    %rsp,%rbp
+     a38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     a3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     a40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a44:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     a48:	90                   	nop
+     a49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     a4d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     a51:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     a55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     a59:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     a5d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     a61:	0f b6 12             	movzbl (%rdx),%edx
+     a64:	88 10                	mov    %dl,(%rax)
+     a66:	0f b6 00             	movzbl (%rax),%eax
+     a69:	84 c0                	test   %al,%al
+     a6b:	75 dc                	jne    a49 <strcpy+0x15>
+  return os;
+     a6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     a71:	5d                   	pop    %rbp
+     a72:	c3                   	ret
+
+0000000000000a73 <strcmp>:
+{
+     a73:	55                   	push   %rbp
+     a74:	48 89 e5             	mov    %rsp,%rbp
+     a77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     a7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     a7f:	eb 0a                	jmp    a8b <strcmp+0x18>
+    p++, q++;
+     a81:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     a86:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     a8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a8f:	0f b6 00             	movzbl (%rax),%eax
+     a92:	84 c0                	test   %al,%al
+     a94:	74 12                	je     aa8 <strcmp+0x35>
+     a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     a9a:	0f b6 10             	movzbl (%rax),%edx
+     a9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     aa1:	0f b6 00             	movzbl (%rax),%eax
+     aa4:	38 c2                	cmp    %al,%dl
+     aa6:	74 d9                	je     a81 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     aa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     aac:	0f b6 00             	movzbl (%rax),%eax
+     aaf:	0f b6 d0             	movzbl %al,%edx
+     ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ab6:	0f b6 00             	movzbl (%rax),%eax
+     ab9:	0f b6 c0             	movzbl %al,%eax
+     abc:	29 c2                	sub    %eax,%edx
+     abe:	89 d0                	mov    %edx,%eax
+}
+     ac0:	5d                   	pop    %rbp
+     ac1:	c3                   	ret
+
+0000000000000ac2 <strlen>:
+{
+     ac2:	55                   	push   %rbp
+     ac3:	48 89 e5             	mov    %rsp,%rbp
+     ac6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+     aca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     ad1:	eb 04                	jmp    ad7 <strlen+0x15>
+     ad3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     ad7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ada:	48 63 d0             	movslq %eax,%rdx
+     add:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ae1:	48 01 d0             	add    %rdx,%rax
+     ae4:	0f b6 00             	movzbl (%rax),%eax
+     ae7:	84 c0                	test   %al,%al
+     ae9:	75 e8                	jne    ad3 <strlen+0x11>
+  return n;
+     aeb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     aee:	5d                   	pop    %rbp
+     aef:	c3                   	ret
+
+0000000000000af0 <memset>:
+{
+     af0:	55                   	push   %rbp
+     af1:	48 89 e5             	mov    %rsp,%rbp
+     af4:	48 83 ec 10          	sub    $0x10,%rsp
+     af8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     afc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     aff:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     b02:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     b05:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     b08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b0c:	89 ce                	mov    %ecx,%esi
+     b0e:	48 89 c7             	mov    %rax,%rdi
+     b11:	e8 ec fe ff ff       	call   a02 <stosb>
+  return dst;
+     b16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     b1a:	c9                   	leave
+     b1b:	c3                   	ret
+
+0000000000000b1c <strchr>:
+{
+     b1c:	55                   	push   %rbp
+     b1d:	48 89 e5             	mov    %rsp,%rbp
+     b20:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     b24:	89 f0                	mov    %esi,%eax
+     b26:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     b29:	eb 17                	jmp    b42 <strchr+0x26>
+    if(*s == c)
+     b2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b2f:	0f b6 00             	movzbl (%rax),%eax
+     b32:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     b35:	75 06                	jne    b3d <strchr+0x21>
+      return (char*)s;
+     b37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b3b:	eb 15                	jmp    b52 <strchr+0x36>
+  for(; *s; s++)
+     b3d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     b46:	0f b6 00             	movzbl (%rax),%eax
+     b49:	84 c0                	test   %al,%al
+     b4b:	75 de                	jne    b2b <strchr+0xf>
+  return 0;
+     b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     b52:	5d                   	pop    %rbp
+     b53:	c3                   	ret
+
+0000000000000b54 <gets>:
+gets(char *buf, int max)
+{
+     b54:	55                   	push   %rbp
+     b55:	48 89 e5             	mov    %rsp,%rbp
+     b58:	48 83 ec 20          	sub    $0x20,%rsp
+     b5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b60:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     b63:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b6a:	eb 48                	jmp    bb4 <gets+0x60>
+    cc = read(0, &c, 1);
+     b6c:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     b70:	ba 01 00 00 00       	mov    $0x1,%edx
+     b75:	48 89 c6             	mov    %rax,%rsi
+     b78:	bf 00 00 00 00       	mov    $0x0,%edi
+     b7d:	e8 6f 01 00 00       	call   cf1 <read>
+     b82:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     b85:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     b89:	7e 36                	jle    bc1 <gets+0x6d>
+      break;
+    buf[i++] = c;
+     b8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b8e:	8d 50 01             	lea    0x1(%rax),%edx
+     b91:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     b94:	48 63 d0             	movslq %eax,%rdx
+     b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b9b:	48 01 c2             	add    %rax,%rdx
+     b9e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ba2:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     ba4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     ba8:	3c 0a                	cmp    $0xa,%al
+     baa:	74 16                	je     bc2 <gets+0x6e>
+     bac:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     bb0:	3c 0d                	cmp    $0xd,%al
+     bb2:	74 0e                	je     bc2 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     bb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bb7:	83 c0 01             	add    $0x1,%eax
+     bba:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     bbd:	7f ad                	jg     b6c <gets+0x18>
+     bbf:	eb 01                	jmp    bc2 <gets+0x6e>
+      break;
+     bc1:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     bc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bc5:	48 63 d0             	movslq %eax,%rdx
+     bc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bcc:	48 01 d0             	add    %rdx,%rax
+     bcf:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     bd6:	c9                   	leave
+     bd7:	c3                   	ret
+
+0000000000000bd8 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     bd8:	55                   	push   %rbp
+     bd9:	48 89 e5             	mov    %rsp,%rbp
+     bdc:	48 83 ec 20          	sub    $0x20,%rsp
+     be0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     be4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bec:	be 00 00 00 00       	mov    $0x0,%esi
+     bf1:	48 89 c7             	mov    %rax,%rdi
+     bf4:	e8 20 01 00 00       	call   d19 <open>
+     bf9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     bfc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c00:	79 07                	jns    c09 <stat+0x31>
+    return -1;
+     c02:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c07:	eb 21                	jmp    c2a <stat+0x52>
+  r = fstat(fd, st);
+     c09:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     c0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c10:	48 89 d6             	mov    %rdx,%rsi
+     c13:	89 c7                	mov    %eax,%edi
+     c15:	e8 17 01 00 00       	call   d31 <fstat>
+     c1a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     c1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c20:	89 c7                	mov    %eax,%edi
+     c22:	e8 da 00 00 00       	call   d01 <close>
+  return r;
+     c27:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     c2a:	c9                   	leave
+     c2b:	c3                   	ret
+
+0000000000000c2c <atoi>:
+
+int
+atoi(const char *s)
+{
+     c2c:	55                   	push   %rbp
+     c2d:	48 89 e5             	mov    %rsp,%rbp
+     c30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     c34:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     c3b:	eb 28                	jmp    c65 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+     c3d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     c40:	89 d0                	mov    %edx,%eax
+     c42:	c1 e0 02             	shl    $0x2,%eax
+     c45:	01 d0                	add    %edx,%eax
+     c47:	01 c0                	add    %eax,%eax
+     c49:	89 c1                	mov    %eax,%ecx
+     c4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c4f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     c53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     c57:	0f b6 00             	movzbl (%rax),%eax
+     c5a:	0f be c0             	movsbl %al,%eax
+     c5d:	01 c8                	add    %ecx,%eax
+     c5f:	83 e8 30             	sub    $0x30,%eax
+     c62:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     c65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c69:	0f b6 00             	movzbl (%rax),%eax
+     c6c:	3c 2f                	cmp    $0x2f,%al
+     c6e:	7e 0b                	jle    c7b <atoi+0x4f>
+     c70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c74:	0f b6 00             	movzbl (%rax),%eax
+     c77:	3c 39                	cmp    $0x39,%al
+     c79:	7e c2                	jle    c3d <atoi+0x11>
+  return n;
+     c7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c7e:	5d                   	pop    %rbp
+     c7f:	c3                   	ret
+
+0000000000000c80 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     c80:	55                   	push   %rbp
+     c81:	48 89 e5             	mov    %rsp,%rbp
+     c84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     c88:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     c8c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     c8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c93:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     c97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     c9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     c9f:	eb 1d                	jmp    cbe <memmove+0x3e>
+    *dst++ = *src++;
+     ca1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     ca5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     ca9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     cad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cb1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     cb5:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     cb9:	0f b6 12             	movzbl (%rdx),%edx
+     cbc:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     cbe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     cc1:	8d 50 ff             	lea    -0x1(%rax),%edx
+     cc4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     cc7:	85 c0                	test   %eax,%eax
+     cc9:	7f d6                	jg     ca1 <memmove+0x21>
+  return vdst;
+     ccb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ccf:	5d                   	pop    %rbp
+     cd0:	c3                   	ret
+
+0000000000000cd1 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+     cd1:	b8 01 00 00 00       	mov    $0x1,%eax
+     cd6:	cd 40                	int    $0x40
+     cd8:	c3                   	ret
+
+0000000000000cd9 <exit>:
+SYSCALL(exit)
+     cd9:	b8 02 00 00 00       	mov    $0x2,%eax
+     cde:	cd 40                	int    $0x40
+     ce0:	c3                   	ret
+
+0000000000000ce1 <wait>:
+SYSCALL(wait)
+     ce1:	b8 03 00 00 00       	mov    $0x3,%eax
+     ce6:	cd 40                	int    $0x40
+     ce8:	c3                   	ret
+
+0000000000000ce9 <pipe>:
+SYSCALL(pipe)
+     ce9:	b8 04 00 00 00       	mov    $0x4,%eax
+     cee:	cd 40                	int    $0x40
+     cf0:	c3                   	ret
+
+0000000000000cf1 <read>:
+SYSCALL(read)
+     cf1:	b8 05 00 00 00       	mov    $0x5,%eax
+     cf6:	cd 40                	int    $0x40
+     cf8:	c3                   	ret
+
+0000000000000cf9 <write>:
+SYSCALL(write)
+     cf9:	b8 10 00 00 00       	mov    $0x10,%eax
+     cfe:	cd 40                	int    $0x40
+     d00:	c3                   	ret
+
+0000000000000d01 <close>:
+SYSCALL(close)
+     d01:	b8 15 00 00 00       	mov    $0x15,%eax
+     d06:	cd 40                	int    $0x40
+     d08:	c3                   	ret
+
+0000000000000d09 <kill>:
+SYSCALL(kill)
+     d09:	b8 06 00 00 00       	mov    $0x6,%eax
+     d0e:	cd 40                	int    $0x40
+     d10:	c3                   	ret
+
+0000000000000d11 <exec>:
+SYSCALL(exec)
+     d11:	b8 07 00 00 00       	mov    $0x7,%eax
+     d16:	cd 40                	int    $0x40
+     d18:	c3                   	ret
+
+0000000000000d19 <open>:
+SYSCALL(open)
+     d19:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d1e:	cd 40                	int    $0x40
+     d20:	c3                   	ret
+
+0000000000000d21 <mknod>:
+SYSCALL(mknod)
+     d21:	b8 11 00 00 00       	mov    $0x11,%eax
+     d26:	cd 40                	int    $0x40
+     d28:	c3                   	ret
+
+0000000000000d29 <unlink>:
+SYSCALL(unlink)
+     d29:	b8 12 00 00 00       	mov    $0x12,%eax
+     d2e:	cd 40                	int    $0x40
+     d30:	c3                   	ret
+
+0000000000000d31 <fstat>:
+SYSCALL(fstat)
+     d31:	b8 08 00 00 00       	mov    $0x8,%eax
+     d36:	cd 40                	int    $0x40
+     d38:	c3                   	ret
+
+0000000000000d39 <link>:
+SYSCALL(link)
+     d39:	b8 13 00 00 00       	mov    $0x13,%eax
+     d3e:	cd 40                	int    $0x40
+     d40:	c3                   	ret
+
+0000000000000d41 <mkdir>:
+SYSCALL(mkdir)
+     d41:	b8 14 00 00 00       	mov    $0x14,%eax
+     d46:	cd 40                	int    $0x40
+     d48:	c3                   	ret
+
+0000000000000d49 <chdir>:
+SYSCALL(chdir)
+     d49:	b8 09 00 00 00       	mov    $0x9,%eax
+     d4e:	cd 40                	int    $0x40
+     d50:	c3                   	ret
+
+0000000000000d51 <dup>:
+SYSCALL(dup)
+     d51:	b8 0a 00 00 00       	mov    $0xa,%eax
+     d56:	cd 40                	int    $0x40
+     d58:	c3                   	ret
+
+0000000000000d59 <getpid>:
+SYSCALL(getpid)
+     d59:	b8 0b 00 00 00       	mov    $0xb,%eax
+     d5e:	cd 40                	int    $0x40
+     d60:	c3                   	ret
+
+0000000000000d61 <sbrk>:
+SYSCALL(sbrk)
+     d61:	b8 0c 00 00 00       	mov    $0xc,%eax
+     d66:	cd 40                	int    $0x40
+     d68:	c3                   	ret
+
+0000000000000d69 <sleep>:
+SYSCALL(sleep)
+     d69:	b8 0d 00 00 00       	mov    $0xd,%eax
+     d6e:	cd 40                	int    $0x40
+     d70:	c3                   	ret
+
+0000000000000d71 <uptime>:
+SYSCALL(uptime)
+     d71:	b8 0e 00 00 00       	mov    $0xe,%eax
+     d76:	cd 40                	int    $0x40
+     d78:	c3                   	ret
+
+0000000000000d79 <sysinfo>:
+SYSCALL(sysinfo)
+     d79:	b8 16 00 00 00       	mov    $0x16,%eax
+     d7e:	cd 40                	int    $0x40
+     d80:	c3                   	ret
+
+0000000000000d81 <mmap>:
+SYSCALL(mmap)
+     d81:	b8 17 00 00 00       	mov    $0x17,%eax
+     d86:	cd 40                	int    $0x40
+     d88:	c3                   	ret
+
+0000000000000d89 <munmap>:
+SYSCALL(munmap)
+     d89:	b8 18 00 00 00       	mov    $0x18,%eax
+     d8e:	cd 40                	int    $0x40
+     d90:	c3                   	ret
+
+0000000000000d91 <crashn>:
+SYSCALL(crashn)
+     d91:	b8 19 00 00 00       	mov    $0x19,%eax
+     d96:	cd 40                	int    $0x40
+     d98:	c3                   	ret
+
+0000000000000d99 <mmap2>:
+SYSCALL_ADDR(mmap2)
+     d99:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d9e:	cd 40                	int    $0x40
+     da0:	83 f8 ff             	cmp    $0xffffffff,%eax
+     da3:	74 02                	je     da7 <mmap2+0xe>
+     da5:	89 c0                	mov    %eax,%eax
+     da7:	c3                   	ret
+
+0000000000000da8 <munmap2>:
+SYSCALL(munmap2)
+     da8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     dad:	cd 40                	int    $0x40
+     daf:	c3                   	ret
+
+0000000000000db0 <msync>:
+SYSCALL(msync)
+     db0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     db5:	cd 40                	int    $0x40
+     db7:	c3                   	ret
+
+0000000000000db8 <sendfile>:
+SYSCALL(sendfile)
+     db8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     dbd:	cd 40                	int    $0x40
+     dbf:	c3                   	ret
+
+0000000000000dc0 <splice>:
+SYSCALL(splice)
+     dc0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     dc5:	cd 40                	int    $0x40
+     dc7:	c3                   	ret
+
+0000000000000dc8 <pread>:
+SYSCALL(pread)
+     dc8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     dcd:	cd 40                	int    $0x40
+     dcf:	c3                   	ret
+
+0000000000000dd0 <pwrite>:
+SYSCALL(pwrite)
+     dd0:	b8 20 00 00 00       	mov    $0x20,%eax
+     dd5:	cd 40                	int    $0x40
+     dd7:	c3                   	ret
+
+0000000000000dd8 <readv>:
+SYSCALL(readv)
+     dd8:	b8 21 00 00 00       	mov    $0x21,%eax
+     ddd:	cd 40                	int    $0x40
+     ddf:	c3                   	ret
+
+0000000000000de0 <writev>:
+SYSCALL(writev)
+     de0:	b8 22 00 00 00       	mov    $0x22,%eax
+     de5:	cd 40                	int    $0x40
+     de7:	c3                   	ret
+
+0000000000000de8 <poll>:
+SYSCALL(poll)
+     de8:	b8 23 00 00 00       	mov    $0x23,%eax
+     ded:	cd 40                	int    $0x40
+     def:	c3                   	ret
+
+0000000000000df0 <pipe2>:
+SYSCALL(pipe2)
+     df0:	b8 24 00 00 00       	mov    $0x24,%eax
+     df5:	cd 40                	int    $0x40
+     df7:	c3                   	ret
+
+0000000000000df8 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+     df8:	55                   	push   %rbp
+     df9:	48 89 e5             	mov    %rsp,%rbp
+     dfc:	48 83 ec 20          	sub    $0x20,%rsp
+     e00:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e08:	48 83 e8 10          	sub    $0x10,%rax
+     e0c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+     e10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e14:	48 8b 10             	mov    (%rax),%rdx
+     e17:	48 8d 05 82 07 00 00 	lea    0x782(%rip),%rax        # 15a0 <bigblock>
+     e1e:	48 39 c2             	cmp    %rax,%rdx
+     e21:	75 1f                	jne    e42 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+     e23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e27:	8b 40 08             	mov    0x8(%rax),%eax
+     e2a:	c1 e0 04             	shl    $0x4,%eax
+     e2d:	89 c2                	mov    %eax,%edx
+     e2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e33:	89 d6                	mov    %edx,%esi
+     e35:	48 89 c7             	mov    %rax,%rdi
+     e38:	e8 6b ff ff ff       	call   da8 <munmap2>
+    return;
+     e3d:	e9 0b 01 00 00       	jmp    f4d <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e42:	48 8b 05 47 07 00 00 	mov    0x747(%rip),%rax        # 1590 <freep>
+     e49:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e4d:	eb 2f                	jmp    e7e <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e53:	48 8b 00             	mov    (%rax),%rax
+     e56:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e5a:	72 17                	jb     e73 <free+0x7b>
+     e5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e60:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e64:	72 2f                	jb     e95 <free+0x9d>
+     e66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e6a:	48 8b 00             	mov    (%rax),%rax
+     e6d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e71:	72 22                	jb     e95 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e77:	48 8b 00             	mov    (%rax),%rax
+     e7a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     e7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e82:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     e86:	73 c7                	jae    e4f <free+0x57>
+     e88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e8c:	48 8b 00             	mov    (%rax),%rax
+     e8f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     e93:	73 ba                	jae    e4f <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     e95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e99:	8b 40 08             	mov    0x8(%rax),%eax
+     e9c:	89 c0                	mov    %eax,%eax
+     e9e:	48 c1 e0 04          	shl    $0x4,%rax
+     ea2:	48 89 c2             	mov    %rax,%rdx
+     ea5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ea9:	48 01 c2             	add    %rax,%rdx
+     eac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     eb0:	48 8b 00             	mov    (%rax),%rax
+     eb3:	48 39 c2             	cmp    %rax,%rdx
+     eb6:	75 2d                	jne    ee5 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+     eb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ebc:	8b 50 08             	mov    0x8(%rax),%edx
+     ebf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ec3:	48 8b 00             	mov    (%rax),%rax
+     ec6:	8b 40 08             	mov    0x8(%rax),%eax
+     ec9:	01 c2                	add    %eax,%edx
+     ecb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ecf:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ed2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ed6:	48 8b 00             	mov    (%rax),%rax
+     ed9:	48 8b 10             	mov    (%rax),%rdx
+     edc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ee0:	48 89 10             	mov    %rdx,(%rax)
+     ee3:	eb 0e                	jmp    ef3 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+     ee5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ee9:	48 8b 10             	mov    (%rax),%rdx
+     eec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ef0:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+     ef3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ef7:	8b 40 08             	mov    0x8(%rax),%eax
+     efa:	89 c0                	mov    %eax,%eax
+     efc:	48 c1 e0 04          	shl    $0x4,%rax
+     f00:	48 89 c2             	mov    %rax,%rdx
+     f03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f07:	48 01 d0             	add    %rdx,%rax
+     f0a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+     f0e:	75 27                	jne    f37 <free+0x13f>
+    p->s.size += bp->s.size;
+     f10:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f14:	8b 50 08             	mov    0x8(%rax),%edx
+     f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f1b:	8b 40 08             	mov    0x8(%rax),%eax
+     f1e:	01 c2                	add    %eax,%edx
+     f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f24:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+     f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f2b:	48 8b 10             	mov    (%rax),%rdx
+     f2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f32:	48 89 10             	mov    %rdx,(%rax)
+     f35:	eb 0b                	jmp    f42 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+     f37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f3b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     f3f:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+     f42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f46:	48 89 05 43 06 00 00 	mov    %rax,0x643(%rip)        # 1590 <freep>
+}
+     f4d:	c9                   	leave
+     f4e:	c3                   	ret
+
+0000000000000f4f <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f4f:	55                   	push   %rbp
+     f50:	48 89 e5             	mov    %rsp,%rbp
+     f53:	48 83 ec 20          	sub    $0x20,%rsp
+     f57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     f5a:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+     f61:	77 07                	ja     f6a <morecore+0x1b>
+    nu = 4096;
+     f63:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+     f6a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     f6d:	c1 e0 04             	shl    $0x4,%eax
+     f70:	89 c7                	mov    %eax,%edi
+     f72:	e8 ea fd ff ff       	call   d61 <sbrk>
+     f77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+     f7b:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+     f80:	75 07                	jne    f89 <morecore+0x3a>
+    return 0;
+     f82:	b8 00 00 00 00       	mov    $0x0,%eax
+     f87:	eb 29                	jmp    fb2 <morecore+0x63>
+  hp = (Header*)p;
+     f89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     f8d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+     f91:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f95:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     f98:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+     f9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f9f:	48 83 c0 10          	add    $0x10,%rax
+     fa3:	48 89 c7             	mov    %rax,%rdi
+     fa6:	e8 4d fe ff ff       	call   df8 <free>
+  return freep;
+     fab:	48 8b 05 de 05 00 00 	mov    0x5de(%rip),%rax        # 1590 <freep>
+}
+     fb2:	c9                   	leave
+     fb3:	c3                   	ret
+
+0000000000000fb4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fb4:	55                   	push   %rbp
+     fb5:	48 89 e5             	mov    %rsp,%rbp
+     fb8:	48 83 ec 30          	sub    $0x30,%rsp
+     fbc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     fc2:	48 83 c0 0f          	add    $0xf,%rax
+     fc6:	48 c1 e8 04          	shr    $0x4,%rax
+     fca:	83 c0 01             	add    $0x1,%eax
+     fcd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+     fd0:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+     fd7:	76 62                	jbe    103b <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+     fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     fdc:	c1 e0 04             	shl    $0x4,%eax
+     fdf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     fe5:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+     feb:	b9 22 00 00 00       	mov    $0x22,%ecx
+     ff0:	ba 03 00 00 00       	mov    $0x3,%edx
+     ff5:	89 c6                	mov    %eax,%esi
+     ff7:	bf 00 00 00 00       	mov    $0x0,%edi
+     ffc:	e8 98 fd ff ff       	call   d99 <mmap2>
+    1001:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1005:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    100a:	75 0a                	jne    1016 <malloc+0x62>
+      return 0;
+    100c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1011:	e9 1c 01 00 00       	jmp    1132 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1016:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    101a:	48 8d 15 7f 05 00 00 	lea    0x57f(%rip),%rdx        # 15a0 <bigblock>
+    1021:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1024:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1028:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    102b:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    102e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1032:	48 83 c0 10          	add    $0x10,%rax
+    1036:	e9 f7 00 00 00       	jmp    1132 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    103b:	48 8b 05 4e 05 00 00 	mov    0x54e(%rip),%rax        # 1590 <freep>
+    1042:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1046:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    104b:	75 2e                	jne    107b <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    104d:	48 8d 05 2c 05 00 00 	lea    0x52c(%rip),%rax        # 1580 <base>
+    1054:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1058:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    105c:	48 89 05 2d 05 00 00 	mov    %rax,0x52d(%rip)        # 1590 <freep>
+    1063:	48 8b 05 26 05 00 00 	mov    0x526(%rip),%rax        # 1590 <freep>
+    106a:	48 89 05 0f 05 00 00 	mov    %rax,0x50f(%rip)        # 1580 <base>
+    base.s.size = 0;
+    1071:	c7 05 0d 05 00 00 00 	movl   $0x0,0x50d(%rip)        # 1588 <base+0x8>
+    1078:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    107b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    107f:	48 8b 00             	mov    (%rax),%rax
+    1082:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1086:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    108a:	8b 40 08             	mov    0x8(%rax),%eax
+    108d:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1090:	72 5f                	jb     10f1 <malloc+0x13d>
+      if(p->s.size == nunits)
+    1092:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1096:	8b 40 08             	mov    0x8(%rax),%eax
+    1099:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    109c:	75 10                	jne    10ae <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    109e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a2:	48 8b 10             	mov    (%rax),%rdx
+    10a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10a9:	48 89 10             	mov    %rdx,(%rax)
+    10ac:	eb 2e                	jmp    10dc <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    10ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10b2:	8b 40 08             	mov    0x8(%rax),%eax
+    10b5:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    10b8:	89 c2                	mov    %eax,%edx
+    10ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10be:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    10c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10c5:	8b 40 08             	mov    0x8(%rax),%eax
+    10c8:	89 c0                	mov    %eax,%eax
+    10ca:	48 c1 e0 04          	shl    $0x4,%rax
+    10ce:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    10d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    10d9:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    10dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10e0:	48 89 05 a9 04 00 00 	mov    %rax,0x4a9(%rip)        # 1590 <freep>
+      return (void*)(p + 1);
+    10e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10eb:	48 83 c0 10          	add    $0x10,%rax
+    10ef:	eb 41                	jmp    1132 <malloc+0x17e>
+    }
+    if(p == freep)
+    10f1:	48 8b 05 98 04 00 00 	mov    0x498(%rip),%rax        # 1590 <freep>
+    10f8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    10fc:	75 1c                	jne    111a <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    10fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1101:	89 c7                	mov    %eax,%edi
+    1103:	e8 47 fe ff ff       	call   f4f <morecore>
+    1108:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    110c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1111:	75 07                	jne    111a <malloc+0x166>
+        return 0;
+    1113:	b8 00 00 00 00       	mov    $0x0,%eax
+    1118:	eb 18                	jmp    1132 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    111a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    111e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1126:	48 8b 00             	mov    (%rax),%rax
+    1129:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    112d:	e9 54 ff ff ff       	jmp    1086 <malloc+0xd2>
+  }
+}
+    1132:	c9                   	leave
+    1133:	c3                   	ret
@@ -0,0 +1,1973 @@
+
+out/user/_lab5test_b:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <get_progress>:
+
+int state;
+
+void
+get_progress(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  fd = open("progress.txt", O_RDONLY);
+       8:	be 00 00 00 00       	mov    $0x0,%esi
+       d:	48 8d 05 bc 12 00 00 	lea    0x12bc(%rip),%rax        # 12d0 <malloc+0x183>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 96 0e 00 00       	call   eb2 <open>
+      1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (fd < 0) {
+      1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+      23:	79 49                	jns    6e <get_progress+0x6e>
+    //nothing is created yet
+    state = 1;
+      25:	c7 05 d1 17 00 00 01 	movl   $0x1,0x17d1(%rip)        # 1800 <state>
+      2c:	00 00 00 
+    fd = open("progress.txt", O_CREATE | O_RDWR);
+      2f:	be 02 02 00 00       	mov    $0x202,%esi
+      34:	48 8d 05 95 12 00 00 	lea    0x1295(%rip),%rax        # 12d0 <malloc+0x183>
+      3b:	48 89 c7             	mov    %rax,%rdi
+      3e:	e8 6f 0e 00 00       	call   eb2 <open>
+      43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    write(fd, &state, sizeof(int));
+      46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      49:	ba 04 00 00 00       	mov    $0x4,%edx
+      4e:	48 8d 0d ab 17 00 00 	lea    0x17ab(%rip),%rcx        # 1800 <state>
+      55:	48 89 ce             	mov    %rcx,%rsi
+      58:	89 c7                	mov    %eax,%edi
+      5a:	e8 33 0e 00 00       	call   e92 <write>
+    close(fd);
+      5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      62:	89 c7                	mov    %eax,%edi
+      64:	e8 31 0e 00 00       	call   e9a <close>
+    state ++;
+    fd = open("progress.txt", O_RDWR);
+    write(fd, &state, sizeof(int));
+    close(fd);
+  }
+}
+      69:	e9 d5 00 00 00       	jmp    143 <get_progress+0x143>
+    read(fd, &state, sizeof(int));
+      6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      71:	ba 04 00 00 00       	mov    $0x4,%edx
+      76:	48 8d 0d 83 17 00 00 	lea    0x1783(%rip),%rcx        # 1800 <state>
+      7d:	48 89 ce             	mov    %rcx,%rsi
+      80:	89 c7                	mov    %eax,%edi
+      82:	e8 03 0e 00 00       	call   e8a <read>
+    close(fd);
+      87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8a:	89 c7                	mov    %eax,%edi
+      8c:	e8 09 0e 00 00       	call   e9a <close>
+    if (state > 1000)
+      91:	8b 05 69 17 00 00    	mov    0x1769(%rip),%eax        # 1800 <state>
+      97:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+      9c:	7e 5c                	jle    fa <get_progress+0xfa>
+      error("too many steps before operating is complete");
+      9e:	8b 05 cc 16 00 00    	mov    0x16cc(%rip),%eax        # 1770 <stdout>
+      a4:	ba 26 00 00 00       	mov    $0x26,%edx
+      a9:	48 8d 0d 2d 12 00 00 	lea    0x122d(%rip),%rcx        # 12dd <malloc+0x190>
+      b0:	48 89 ce             	mov    %rcx,%rsi
+      b3:	89 c7                	mov    %eax,%edi
+      b5:	b8 00 00 00 00       	mov    $0x0,%eax
+      ba:	e8 0c 08 00 00       	call   8cb <printf>
+      bf:	8b 05 ab 16 00 00    	mov    0x16ab(%rip),%eax        # 1770 <stdout>
+      c5:	48 8d 15 24 12 00 00 	lea    0x1224(%rip),%rdx        # 12f0 <malloc+0x1a3>
+      cc:	48 89 d6             	mov    %rdx,%rsi
+      cf:	89 c7                	mov    %eax,%edi
+      d1:	b8 00 00 00 00       	mov    $0x0,%eax
+      d6:	e8 f0 07 00 00       	call   8cb <printf>
+      db:	8b 05 8f 16 00 00    	mov    0x168f(%rip),%eax        # 1770 <stdout>
+      e1:	48 8d 15 34 12 00 00 	lea    0x1234(%rip),%rdx        # 131c <malloc+0x1cf>
+      e8:	48 89 d6             	mov    %rdx,%rsi
+      eb:	89 c7                	mov    %eax,%edi
+      ed:	b8 00 00 00 00       	mov    $0x0,%eax
+      f2:	e8 d4 07 00 00       	call   8cb <printf>
+      f7:	90                   	nop
+      f8:	eb fd                	jmp    f7 <get_progress+0xf7>
+    state ++;
+      fa:	8b 05 00 17 00 00    	mov    0x1700(%rip),%eax        # 1800 <state>
+     100:	83 c0 01             	add    $0x1,%eax
+     103:	89 05 f7 16 00 00    	mov    %eax,0x16f7(%rip)        # 1800 <state>
+    fd = open("progress.txt", O_RDWR);
+     109:	be 02 00 00 00       	mov    $0x2,%esi
+     10e:	48 8d 05 bb 11 00 00 	lea    0x11bb(%rip),%rax        # 12d0 <malloc+0x183>
+     115:	48 89 c7             	mov    %rax,%rdi
+     118:	e8 95 0d 00 00       	call   eb2 <open>
+     11d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    write(fd, &state, sizeof(int));
+     120:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     123:	ba 04 00 00 00       	mov    $0x4,%edx
+     128:	48 8d 0d d1 16 00 00 	lea    0x16d1(%rip),%rcx        # 1800 <state>
+     12f:	48 89 ce             	mov    %rcx,%rsi
+     132:	89 c7                	mov    %eax,%edi
+     134:	e8 59 0d 00 00       	call   e92 <write>
+    close(fd);
+     139:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     13c:	89 c7                	mov    %eax,%edi
+     13e:	e8 57 0d 00 00       	call   e9a <close>
+}
+     143:	90                   	nop
+     144:	c9                   	leave
+     145:	c3                   	ret
+
+0000000000000146 <check1>:
+
+void
+check1(void)
+{
+     146:	55                   	push   %rbp
+     147:	48 89 e5             	mov    %rsp,%rbp
+     14a:	48 83 ec 30          	sub    $0x30,%rsp
+  int fd;
+  int i,j;
+  struct stat st;
+
+  fd = open("big.txt", O_RDONLY);
+     14e:	be 00 00 00 00       	mov    $0x0,%esi
+     153:	48 8d 05 c4 11 00 00 	lea    0x11c4(%rip),%rax        # 131e <malloc+0x1d1>
+     15a:	48 89 c7             	mov    %rax,%rdi
+     15d:	e8 50 0d 00 00       	call   eb2 <open>
+     162:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd < 0)
+     165:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     169:	0f 88 4d 02 00 00    	js     3bc <check1+0x276>
+    return;
+  fstat(fd, &st);
+     16f:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+     173:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     176:	48 89 d6             	mov    %rdx,%rsi
+     179:	89 c7                	mov    %eax,%edi
+     17b:	e8 4a 0d 00 00       	call   eca <fstat>
+
+  // check if it is a zero-size file
+  if (st.size == 0)
+     180:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     183:	85 c0                	test   %eax,%eax
+     185:	0f 84 34 02 00 00    	je     3bf <check1+0x279>
+    return;
+
+  if (st.size % 512 != 0)
+     18b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     18e:	25 ff 01 00 00       	and    $0x1ff,%eax
+     193:	85 c0                	test   %eax,%eax
+     195:	74 5c                	je     1f3 <check1+0xad>
+    error("write is in-complete, file system not in consistent state!");
+     197:	8b 05 d3 15 00 00    	mov    0x15d3(%rip),%eax        # 1770 <stdout>
+     19d:	ba 40 00 00 00       	mov    $0x40,%edx
+     1a2:	48 8d 0d 34 11 00 00 	lea    0x1134(%rip),%rcx        # 12dd <malloc+0x190>
+     1a9:	48 89 ce             	mov    %rcx,%rsi
+     1ac:	89 c7                	mov    %eax,%edi
+     1ae:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b3:	e8 13 07 00 00       	call   8cb <printf>
+     1b8:	8b 05 b2 15 00 00    	mov    0x15b2(%rip),%eax        # 1770 <stdout>
+     1be:	48 8d 15 63 11 00 00 	lea    0x1163(%rip),%rdx        # 1328 <malloc+0x1db>
+     1c5:	48 89 d6             	mov    %rdx,%rsi
+     1c8:	89 c7                	mov    %eax,%edi
+     1ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     1cf:	e8 f7 06 00 00       	call   8cb <printf>
+     1d4:	8b 05 96 15 00 00    	mov    0x1596(%rip),%eax        # 1770 <stdout>
+     1da:	48 8d 15 3b 11 00 00 	lea    0x113b(%rip),%rdx        # 131c <malloc+0x1cf>
+     1e1:	48 89 d6             	mov    %rdx,%rsi
+     1e4:	89 c7                	mov    %eax,%edi
+     1e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     1eb:	e8 db 06 00 00       	call   8cb <printf>
+     1f0:	90                   	nop
+     1f1:	eb fd                	jmp    1f0 <check1+0xaa>
+
+  // check if the size of the file is correct
+  int progress = st.size / 512;
+     1f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1f6:	c1 e8 09             	shr    $0x9,%eax
+     1f9:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if (progress > 3)
+     1fc:	83 7d f0 03          	cmpl   $0x3,-0x10(%rbp)
+     200:	7e 5c                	jle    25e <check1+0x118>
+    error("write is incorrect, file system not in consistent state!");
+     202:	8b 05 68 15 00 00    	mov    0x1568(%rip),%eax        # 1770 <stdout>
+     208:	ba 45 00 00 00       	mov    $0x45,%edx
+     20d:	48 8d 0d c9 10 00 00 	lea    0x10c9(%rip),%rcx        # 12dd <malloc+0x190>
+     214:	48 89 ce             	mov    %rcx,%rsi
+     217:	89 c7                	mov    %eax,%edi
+     219:	b8 00 00 00 00       	mov    $0x0,%eax
+     21e:	e8 a8 06 00 00       	call   8cb <printf>
+     223:	8b 05 47 15 00 00    	mov    0x1547(%rip),%eax        # 1770 <stdout>
+     229:	48 8d 15 38 11 00 00 	lea    0x1138(%rip),%rdx        # 1368 <malloc+0x21b>
+     230:	48 89 d6             	mov    %rdx,%rsi
+     233:	89 c7                	mov    %eax,%edi
+     235:	b8 00 00 00 00       	mov    $0x0,%eax
+     23a:	e8 8c 06 00 00       	call   8cb <printf>
+     23f:	8b 05 2b 15 00 00    	mov    0x152b(%rip),%eax        # 1770 <stdout>
+     245:	48 8d 15 d0 10 00 00 	lea    0x10d0(%rip),%rdx        # 131c <malloc+0x1cf>
+     24c:	48 89 d6             	mov    %rdx,%rsi
+     24f:	89 c7                	mov    %eax,%edi
+     251:	b8 00 00 00 00       	mov    $0x0,%eax
+     256:	e8 70 06 00 00       	call   8cb <printf>
+     25b:	90                   	nop
+     25c:	eb fd                	jmp    25b <check1+0x115>
+
+  memset(buf, 0, sizeof(buf));
+     25e:	ba 00 20 00 00       	mov    $0x2000,%edx
+     263:	be 00 00 00 00       	mov    $0x0,%esi
+     268:	48 8d 05 b1 15 00 00 	lea    0x15b1(%rip),%rax        # 1820 <buf>
+     26f:	48 89 c7             	mov    %rax,%rdi
+     272:	e8 12 0a 00 00       	call   c89 <memset>
+  read(fd, buf, 3 * 512);
+     277:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     27a:	ba 00 06 00 00       	mov    $0x600,%edx
+     27f:	48 8d 0d 9a 15 00 00 	lea    0x159a(%rip),%rcx        # 1820 <buf>
+     286:	48 89 ce             	mov    %rcx,%rsi
+     289:	89 c7                	mov    %eax,%edi
+     28b:	e8 fa 0b 00 00       	call   e8a <read>
+  for (i = 0; i < progress; i++) {
+     290:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     297:	e9 c7 00 00 00       	jmp    363 <check1+0x21d>
+    for (j = 0; j < 512; j++ ){
+     29c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     2a3:	e9 aa 00 00 00       	jmp    352 <check1+0x20c>
+      if (buf[i * 512 + j] != 'a' + i)
+     2a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2ab:	c1 e0 09             	shl    $0x9,%eax
+     2ae:	89 c2                	mov    %eax,%edx
+     2b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2b3:	01 d0                	add    %edx,%eax
+     2b5:	48 98                	cltq
+     2b7:	48 8d 15 62 15 00 00 	lea    0x1562(%rip),%rdx        # 1820 <buf>
+     2be:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     2c2:	0f be d0             	movsbl %al,%edx
+     2c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c8:	83 c0 61             	add    $0x61,%eax
+     2cb:	39 c2                	cmp    %eax,%edx
+     2cd:	74 7f                	je     34e <check1+0x208>
+        error("file system not in consistent state!, i = %d, j = %d, content = %d", i, j, buf[i*512+j]);
+     2cf:	8b 05 9b 14 00 00    	mov    0x149b(%rip),%eax        # 1770 <stdout>
+     2d5:	ba 4c 00 00 00       	mov    $0x4c,%edx
+     2da:	48 8d 0d fc 0f 00 00 	lea    0xffc(%rip),%rcx        # 12dd <malloc+0x190>
+     2e1:	48 89 ce             	mov    %rcx,%rsi
+     2e4:	89 c7                	mov    %eax,%edi
+     2e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2eb:	e8 db 05 00 00       	call   8cb <printf>
+     2f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2f3:	c1 e0 09             	shl    $0x9,%eax
+     2f6:	89 c2                	mov    %eax,%edx
+     2f8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2fb:	01 d0                	add    %edx,%eax
+     2fd:	48 98                	cltq
+     2ff:	48 8d 15 1a 15 00 00 	lea    0x151a(%rip),%rdx        # 1820 <buf>
+     306:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     30a:	0f be f0             	movsbl %al,%esi
+     30d:	8b 05 5d 14 00 00    	mov    0x145d(%rip),%eax        # 1770 <stdout>
+     313:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+     316:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     319:	41 89 f0             	mov    %esi,%r8d
+     31c:	48 8d 35 85 10 00 00 	lea    0x1085(%rip),%rsi        # 13a8 <malloc+0x25b>
+     323:	89 c7                	mov    %eax,%edi
+     325:	b8 00 00 00 00       	mov    $0x0,%eax
+     32a:	e8 9c 05 00 00       	call   8cb <printf>
+     32f:	8b 05 3b 14 00 00    	mov    0x143b(%rip),%eax        # 1770 <stdout>
+     335:	48 8d 15 e0 0f 00 00 	lea    0xfe0(%rip),%rdx        # 131c <malloc+0x1cf>
+     33c:	48 89 d6             	mov    %rdx,%rsi
+     33f:	89 c7                	mov    %eax,%edi
+     341:	b8 00 00 00 00       	mov    $0x0,%eax
+     346:	e8 80 05 00 00       	call   8cb <printf>
+     34b:	90                   	nop
+     34c:	eb fd                	jmp    34b <check1+0x205>
+    for (j = 0; j < 512; j++ ){
+     34e:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     352:	81 7d f8 ff 01 00 00 	cmpl   $0x1ff,-0x8(%rbp)
+     359:	0f 8e 49 ff ff ff    	jle    2a8 <check1+0x162>
+  for (i = 0; i < progress; i++) {
+     35f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     363:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     366:	3b 45 f0             	cmp    -0x10(%rbp),%eax
+     369:	0f 8c 2d ff ff ff    	jl     29c <check1+0x156>
+    }
+  }
+  close(fd);
+     36f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     372:	89 c7                	mov    %eax,%edi
+     374:	e8 21 0b 00 00       	call   e9a <close>
+
+  if (progress == 3) {
+     379:	83 7d f0 03          	cmpl   $0x3,-0x10(%rbp)
+     37d:	75 41                	jne    3c0 <check1+0x27a>
+    printf(stdout, "big.txt is completely written\n");
+     37f:	8b 05 eb 13 00 00    	mov    0x13eb(%rip),%eax        # 1770 <stdout>
+     385:	48 8d 15 64 10 00 00 	lea    0x1064(%rip),%rdx        # 13f0 <malloc+0x2a3>
+     38c:	48 89 d6             	mov    %rdx,%rsi
+     38f:	89 c7                	mov    %eax,%edi
+     391:	b8 00 00 00 00       	mov    $0x0,%eax
+     396:	e8 30 05 00 00       	call   8cb <printf>
+    printf(stdout, "lab5test_b passed!\n");
+     39b:	8b 05 cf 13 00 00    	mov    0x13cf(%rip),%eax        # 1770 <stdout>
+     3a1:	48 8d 15 67 10 00 00 	lea    0x1067(%rip),%rdx        # 140f <malloc+0x2c2>
+     3a8:	48 89 d6             	mov    %rdx,%rsi
+     3ab:	89 c7                	mov    %eax,%edi
+     3ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b2:	e8 14 05 00 00       	call   8cb <printf>
+    exit();
+     3b7:	e8 b6 0a 00 00       	call   e72 <exit>
+    return;
+     3bc:	90                   	nop
+     3bd:	eb 01                	jmp    3c0 <check1+0x27a>
+    return;
+     3bf:	90                   	nop
+  }
+}
+     3c0:	c9                   	leave
+     3c1:	c3                   	ret
+
+00000000000003c2 <check2>:
+
+void
+check2(void)
+{
+     3c2:	55                   	push   %rbp
+     3c3:	48 89 e5             	mov    %rsp,%rbp
+     3c6:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd;
+  int i,j;
+  struct stat st;
+
+  fd = open("big.txt", O_RDONLY);
+     3ca:	be 00 00 00 00       	mov    $0x0,%esi
+     3cf:	48 8d 05 48 0f 00 00 	lea    0xf48(%rip),%rax        # 131e <malloc+0x1d1>
+     3d6:	48 89 c7             	mov    %rax,%rdi
+     3d9:	e8 d4 0a 00 00       	call   eb2 <open>
+     3de:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if (fd < 0)
+     3e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     3e5:	79 5c                	jns    443 <check2+0x81>
+    error("file is not generated");
+     3e7:	8b 05 83 13 00 00    	mov    0x1383(%rip),%eax        # 1770 <stdout>
+     3ed:	ba 61 00 00 00       	mov    $0x61,%edx
+     3f2:	48 8d 0d e4 0e 00 00 	lea    0xee4(%rip),%rcx        # 12dd <malloc+0x190>
+     3f9:	48 89 ce             	mov    %rcx,%rsi
+     3fc:	89 c7                	mov    %eax,%edi
+     3fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     403:	e8 c3 04 00 00       	call   8cb <printf>
+     408:	8b 05 62 13 00 00    	mov    0x1362(%rip),%eax        # 1770 <stdout>
+     40e:	48 8d 15 0e 10 00 00 	lea    0x100e(%rip),%rdx        # 1423 <malloc+0x2d6>
+     415:	48 89 d6             	mov    %rdx,%rsi
+     418:	89 c7                	mov    %eax,%edi
+     41a:	b8 00 00 00 00       	mov    $0x0,%eax
+     41f:	e8 a7 04 00 00       	call   8cb <printf>
+     424:	8b 05 46 13 00 00    	mov    0x1346(%rip),%eax        # 1770 <stdout>
+     42a:	48 8d 15 eb 0e 00 00 	lea    0xeeb(%rip),%rdx        # 131c <malloc+0x1cf>
+     431:	48 89 d6             	mov    %rdx,%rsi
+     434:	89 c7                	mov    %eax,%edi
+     436:	b8 00 00 00 00       	mov    $0x0,%eax
+     43b:	e8 8b 04 00 00       	call   8cb <printf>
+     440:	90                   	nop
+     441:	eb fd                	jmp    440 <check2+0x7e>
+
+  fstat(fd, &st);
+     443:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+     447:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     44a:	48 89 d6             	mov    %rdx,%rsi
+     44d:	89 c7                	mov    %eax,%edi
+     44f:	e8 76 0a 00 00       	call   eca <fstat>
+
+  // check if the size of the file is correct
+  if (st.size != 512 * 3)
+     454:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     457:	3d 00 06 00 00       	cmp    $0x600,%eax
+     45c:	74 5c                	je     4ba <check2+0xf8>
+    error("write is in-complete, file system not in consistent state!");
+     45e:	8b 05 0c 13 00 00    	mov    0x130c(%rip),%eax        # 1770 <stdout>
+     464:	ba 67 00 00 00       	mov    $0x67,%edx
+     469:	48 8d 0d 6d 0e 00 00 	lea    0xe6d(%rip),%rcx        # 12dd <malloc+0x190>
+     470:	48 89 ce             	mov    %rcx,%rsi
+     473:	89 c7                	mov    %eax,%edi
+     475:	b8 00 00 00 00       	mov    $0x0,%eax
+     47a:	e8 4c 04 00 00       	call   8cb <printf>
+     47f:	8b 05 eb 12 00 00    	mov    0x12eb(%rip),%eax        # 1770 <stdout>
+     485:	48 8d 15 9c 0e 00 00 	lea    0xe9c(%rip),%rdx        # 1328 <malloc+0x1db>
+     48c:	48 89 d6             	mov    %rdx,%rsi
+     48f:	89 c7                	mov    %eax,%edi
+     491:	b8 00 00 00 00       	mov    $0x0,%eax
+     496:	e8 30 04 00 00       	call   8cb <printf>
+     49b:	8b 05 cf 12 00 00    	mov    0x12cf(%rip),%eax        # 1770 <stdout>
+     4a1:	48 8d 15 74 0e 00 00 	lea    0xe74(%rip),%rdx        # 131c <malloc+0x1cf>
+     4a8:	48 89 d6             	mov    %rdx,%rsi
+     4ab:	89 c7                	mov    %eax,%edi
+     4ad:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b2:	e8 14 04 00 00       	call   8cb <printf>
+     4b7:	90                   	nop
+     4b8:	eb fd                	jmp    4b7 <check2+0xf5>
+  memset(buf, 0, sizeof(buf));
+     4ba:	ba 00 20 00 00       	mov    $0x2000,%edx
+     4bf:	be 00 00 00 00       	mov    $0x0,%esi
+     4c4:	48 8d 05 55 13 00 00 	lea    0x1355(%rip),%rax        # 1820 <buf>
+     4cb:	48 89 c7             	mov    %rax,%rdi
+     4ce:	e8 b6 07 00 00       	call   c89 <memset>
+  read(fd, buf, 3 * 512);
+     4d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4d6:	ba 00 06 00 00       	mov    $0x600,%edx
+     4db:	48 8d 0d 3e 13 00 00 	lea    0x133e(%rip),%rcx        # 1820 <buf>
+     4e2:	48 89 ce             	mov    %rcx,%rsi
+     4e5:	89 c7                	mov    %eax,%edi
+     4e7:	e8 9e 09 00 00       	call   e8a <read>
+  for (i = 0; i < 3; i++) {
+     4ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     4f3:	e9 a4 00 00 00       	jmp    59c <check2+0x1da>
+    for (j = 0; j < 512; j++ ){
+     4f8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     4ff:	e9 87 00 00 00       	jmp    58b <check2+0x1c9>
+      if (buf[i * 512 + j] != 'a' + i)
+     504:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     507:	c1 e0 09             	shl    $0x9,%eax
+     50a:	89 c2                	mov    %eax,%edx
+     50c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     50f:	01 d0                	add    %edx,%eax
+     511:	48 98                	cltq
+     513:	48 8d 15 06 13 00 00 	lea    0x1306(%rip),%rdx        # 1820 <buf>
+     51a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     51e:	0f be d0             	movsbl %al,%edx
+     521:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     524:	83 c0 61             	add    $0x61,%eax
+     527:	39 c2                	cmp    %eax,%edx
+     529:	74 5c                	je     587 <check2+0x1c5>
+        error("file system not in consistent state!");
+     52b:	8b 05 3f 12 00 00    	mov    0x123f(%rip),%eax        # 1770 <stdout>
+     531:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     536:	48 8d 0d a0 0d 00 00 	lea    0xda0(%rip),%rcx        # 12dd <malloc+0x190>
+     53d:	48 89 ce             	mov    %rcx,%rsi
+     540:	89 c7                	mov    %eax,%edi
+     542:	b8 00 00 00 00       	mov    $0x0,%eax
+     547:	e8 7f 03 00 00       	call   8cb <printf>
+     54c:	8b 05 1e 12 00 00    	mov    0x121e(%rip),%eax        # 1770 <stdout>
+     552:	48 8d 15 e7 0e 00 00 	lea    0xee7(%rip),%rdx        # 1440 <malloc+0x2f3>
+     559:	48 89 d6             	mov    %rdx,%rsi
+     55c:	89 c7                	mov    %eax,%edi
+     55e:	b8 00 00 00 00       	mov    $0x0,%eax
+     563:	e8 63 03 00 00       	call   8cb <printf>
+     568:	8b 05 02 12 00 00    	mov    0x1202(%rip),%eax        # 1770 <stdout>
+     56e:	48 8d 15 a7 0d 00 00 	lea    0xda7(%rip),%rdx        # 131c <malloc+0x1cf>
+     575:	48 89 d6             	mov    %rdx,%rsi
+     578:	89 c7                	mov    %eax,%edi
+     57a:	b8 00 00 00 00       	mov    $0x0,%eax
+     57f:	e8 47 03 00 00       	call   8cb <printf>
+     584:	90                   	nop
+     585:	eb fd                	jmp    584 <check2+0x1c2>
+    for (j = 0; j < 512; j++ ){
+     587:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     58b:	81 7d f8 ff 01 00 00 	cmpl   $0x1ff,-0x8(%rbp)
+     592:	0f 8e 6c ff ff ff    	jle    504 <check2+0x142>
+  for (i = 0; i < 3; i++) {
+     598:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     59c:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+     5a0:	0f 8e 52 ff ff ff    	jle    4f8 <check2+0x136>
+    }
+  }
+  close(fd);
+     5a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     5a9:	89 c7                	mov    %eax,%edi
+     5ab:	e8 ea 08 00 00       	call   e9a <close>
+  return;
+     5b0:	90                   	nop
+}
+     5b1:	c9                   	leave
+     5b2:	c3                   	ret
+
+00000000000005b3 <crashsafe>:
+
+void
+crashsafe(int steps)
+{
+     5b3:	55                   	push   %rbp
+     5b4:	48 89 e5             	mov    %rsp,%rbp
+     5b7:	48 83 ec 20          	sub    $0x20,%rsp
+     5bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int fd;
+  crashn(steps);
+     5be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     5c1:	89 c7                	mov    %eax,%edi
+     5c3:	e8 62 09 00 00       	call   f2a <crashn>
+  printf(stdout, "crash after %d steps\n", steps);
+     5c8:	8b 05 a2 11 00 00    	mov    0x11a2(%rip),%eax        # 1770 <stdout>
+     5ce:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     5d1:	48 8d 0d 8d 0e 00 00 	lea    0xe8d(%rip),%rcx        # 1465 <malloc+0x318>
+     5d8:	48 89 ce             	mov    %rcx,%rsi
+     5db:	89 c7                	mov    %eax,%edi
+     5dd:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e2:	e8 e4 02 00 00       	call   8cb <printf>
+  fd = open("big.txt", O_CREATE | O_RDWR);
+     5e7:	be 02 02 00 00       	mov    $0x202,%esi
+     5ec:	48 8d 05 2b 0d 00 00 	lea    0xd2b(%rip),%rax        # 131e <malloc+0x1d1>
+     5f3:	48 89 c7             	mov    %rax,%rdi
+     5f6:	e8 b7 08 00 00       	call   eb2 <open>
+     5fb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  memset(buf, 'a', 512);
+     5fe:	ba 00 02 00 00       	mov    $0x200,%edx
+     603:	be 61 00 00 00       	mov    $0x61,%esi
+     608:	48 8d 05 11 12 00 00 	lea    0x1211(%rip),%rax        # 1820 <buf>
+     60f:	48 89 c7             	mov    %rax,%rdi
+     612:	e8 72 06 00 00       	call   c89 <memset>
+  memset(buf + 512 * 1, 'b', 512);
+     617:	48 8d 05 02 14 00 00 	lea    0x1402(%rip),%rax        # 1a20 <buf+0x200>
+     61e:	ba 00 02 00 00       	mov    $0x200,%edx
+     623:	be 62 00 00 00       	mov    $0x62,%esi
+     628:	48 89 c7             	mov    %rax,%rdi
+     62b:	e8 59 06 00 00       	call   c89 <memset>
+  memset(buf + 512 * 2, 'c', 512);
+     630:	48 8d 05 e9 15 00 00 	lea    0x15e9(%rip),%rax        # 1c20 <buf+0x400>
+     637:	ba 00 02 00 00       	mov    $0x200,%edx
+     63c:	be 63 00 00 00       	mov    $0x63,%esi
+     641:	48 89 c7             	mov    %rax,%rdi
+     644:	e8 40 06 00 00       	call   c89 <memset>
+  write(fd, buf, 512);
+     649:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     64c:	ba 00 02 00 00       	mov    $0x200,%edx
+     651:	48 8d 0d c8 11 00 00 	lea    0x11c8(%rip),%rcx        # 1820 <buf>
+     658:	48 89 ce             	mov    %rcx,%rsi
+     65b:	89 c7                	mov    %eax,%edi
+     65d:	e8 30 08 00 00       	call   e92 <write>
+  write(fd, buf + 512, 512);
+     662:	48 8d 0d b7 13 00 00 	lea    0x13b7(%rip),%rcx        # 1a20 <buf+0x200>
+     669:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     66c:	ba 00 02 00 00       	mov    $0x200,%edx
+     671:	48 89 ce             	mov    %rcx,%rsi
+     674:	89 c7                	mov    %eax,%edi
+     676:	e8 17 08 00 00       	call   e92 <write>
+  write(fd, buf + 1024, 512);
+     67b:	48 8d 0d 9e 15 00 00 	lea    0x159e(%rip),%rcx        # 1c20 <buf+0x400>
+     682:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     685:	ba 00 02 00 00       	mov    $0x200,%edx
+     68a:	48 89 ce             	mov    %rcx,%rsi
+     68d:	89 c7                	mov    %eax,%edi
+     68f:	e8 fe 07 00 00       	call   e92 <write>
+  close(fd);
+     694:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     697:	89 c7                	mov    %eax,%edi
+     699:	e8 fc 07 00 00       	call   e9a <close>
+}
+     69e:	90                   	nop
+     69f:	c9                   	leave
+     6a0:	c3                   	ret
+
+00000000000006a1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     6a1:	55                   	push   %rbp
+     6a2:	48 89 e5             	mov    %rsp,%rbp
+     6a5:	48 83 ec 10          	sub    $0x10,%rsp
+     6a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     6ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  printf(stdout, "lab5test_b starting\n");
+     6b0:	8b 05 ba 10 00 00    	mov    0x10ba(%rip),%eax        # 1770 <stdout>
+     6b6:	48 8d 15 be 0d 00 00 	lea    0xdbe(%rip),%rdx        # 147b <malloc+0x32e>
+     6bd:	48 89 d6             	mov    %rdx,%rsi
+     6c0:	89 c7                	mov    %eax,%edi
+     6c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c7:	e8 ff 01 00 00       	call   8cb <printf>
+  check1();
+     6cc:	e8 75 fa ff ff       	call   146 <check1>
+  get_progress();
+     6d1:	e8 2a f9 ff ff       	call   0 <get_progress>
+  crashsafe(state);
+     6d6:	8b 05 24 11 00 00    	mov    0x1124(%rip),%eax        # 1800 <state>
+     6dc:	89 c7                	mov    %eax,%edi
+     6de:	e8 d0 fe ff ff       	call   5b3 <crashsafe>
+  check2();
+     6e3:	e8 da fc ff ff       	call   3c2 <check2>
+  printf(stdout, "lab5test_b passed!\n");
+     6e8:	8b 05 82 10 00 00    	mov    0x1082(%rip),%eax        # 1770 <stdout>
+     6ee:	48 8d 15 1a 0d 00 00 	lea    0xd1a(%rip),%rdx        # 140f <malloc+0x2c2>
+     6f5:	48 89 d6             	mov    %rdx,%rsi
+     6f8:	89 c7                	mov    %eax,%edi
+     6fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ff:	e8 c7 01 00 00       	call   8cb <printf>
+  exit();
+     704:	e8 69 07 00 00       	call   e72 <exit>
+
+0000000000000709 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     709:	55                   	push   %rbp
+     70a:	48 89 e5             	mov    %rsp,%rbp
+     70d:	48 83 ec 10          	sub    $0x10,%rsp
+     711:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     714:	89 f0                	mov    %esi,%eax
+     716:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     719:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     71d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     720:	ba 01 00 00 00       	mov    $0x1,%edx
+     725:	48 89 ce             	mov    %rcx,%rsi
+     728:	89 c7                	mov    %eax,%edi
+     72a:	e8 63 07 00 00       	call   e92 <write>
+}
+     72f:	90                   	nop
+     730:	c9                   	leave
+     731:	c3                   	ret
+
+0000000000000732 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     732:	55                   	push   %rbp
+     733:	48 89 e5             	mov    %rsp,%rbp
+     736:	48 83 ec 40          	sub    $0x40,%rsp
+     73a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     73d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     740:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     743:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     746:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     74a:	74 1f                	je     76b <printint64+0x39>
+     74c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     74f:	c1 e8 1f             	shr    $0x1f,%eax
+     752:	0f b6 c0             	movzbl %al,%eax
+     755:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     758:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     75c:	74 0d                	je     76b <printint64+0x39>
+    x = -xx;
+     75e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     761:	f7 d8                	neg    %eax
+     763:	48 98                	cltq
+     765:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     769:	eb 09                	jmp    774 <printint64+0x42>
+  else
+    x = xx;
+     76b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     76e:	48 98                	cltq
+     770:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     774:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     77b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     77e:	48 63 c8             	movslq %eax,%rcx
+     781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     785:	ba 00 00 00 00       	mov    $0x0,%edx
+     78a:	48 f7 f1             	div    %rcx
+     78d:	48 89 d1             	mov    %rdx,%rcx
+     790:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     793:	8d 50 01             	lea    0x1(%rax),%edx
+     796:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     799:	48 8d 15 e0 0f 00 00 	lea    0xfe0(%rip),%rdx        # 1780 <digits.1>
+     7a0:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     7a4:	48 98                	cltq
+     7a6:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     7aa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     7ad:	48 63 f0             	movslq %eax,%rsi
+     7b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     7b4:	ba 00 00 00 00       	mov    $0x0,%edx
+     7b9:	48 f7 f6             	div    %rsi
+     7bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     7c0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     7c5:	75 b4                	jne    77b <printint64+0x49>
+
+  if(sgn)
+     7c7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     7cb:	74 2b                	je     7f8 <printint64+0xc6>
+    buf[i++] = '-';
+     7cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7d0:	8d 50 01             	lea    0x1(%rax),%edx
+     7d3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     7d6:	48 98                	cltq
+     7d8:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     7dd:	eb 19                	jmp    7f8 <printint64+0xc6>
+    putc(fd, buf[i]);
+     7df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     7e2:	48 98                	cltq
+     7e4:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     7e9:	0f be d0             	movsbl %al,%edx
+     7ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     7ef:	89 d6                	mov    %edx,%esi
+     7f1:	89 c7                	mov    %eax,%edi
+     7f3:	e8 11 ff ff ff       	call   709 <putc>
+  while(--i >= 0)
+     7f8:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     7fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     800:	79 dd                	jns    7df <printint64+0xad>
+}
+     802:	90                   	nop
+     803:	90                   	nop
+     804:	c9                   	leave
+     805:	c3                   	ret
+
+0000000000000806 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     806:	55                   	push   %rbp
+     807:	48 89 e5             	mov    %rsp,%rbp
+     80a:	48 83 ec 30          	sub    $0x30,%rsp
+     80e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     811:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     814:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     817:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     81a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     821:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     825:	74 17                	je     83e <printint+0x38>
+     827:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     82b:	79 11                	jns    83e <printint+0x38>
+    neg = 1;
+     82d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     834:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     837:	f7 d8                	neg    %eax
+     839:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     83c:	eb 06                	jmp    844 <printint+0x3e>
+  } else {
+    x = xx;
+     83e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     841:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     844:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     84b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     84e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     851:	ba 00 00 00 00       	mov    $0x0,%edx
+     856:	f7 f1                	div    %ecx
+     858:	89 d1                	mov    %edx,%ecx
+     85a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     85d:	8d 50 01             	lea    0x1(%rax),%edx
+     860:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     863:	89 c9                	mov    %ecx,%ecx
+     865:	48 8d 15 34 0f 00 00 	lea    0xf34(%rip),%rdx        # 17a0 <digits.0>
+     86c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     870:	48 98                	cltq
+     872:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     876:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     879:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     87c:	ba 00 00 00 00       	mov    $0x0,%edx
+     881:	f7 f6                	div    %esi
+     883:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     886:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     88a:	75 bf                	jne    84b <printint+0x45>
+  if(neg)
+     88c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     890:	74 2b                	je     8bd <printint+0xb7>
+    buf[i++] = '-';
+     892:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     895:	8d 50 01             	lea    0x1(%rax),%edx
+     898:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     89b:	48 98                	cltq
+     89d:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     8a2:	eb 19                	jmp    8bd <printint+0xb7>
+    putc(fd, buf[i]);
+     8a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8a7:	48 98                	cltq
+     8a9:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     8ae:	0f be d0             	movsbl %al,%edx
+     8b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     8b4:	89 d6                	mov    %edx,%esi
+     8b6:	89 c7                	mov    %eax,%edi
+     8b8:	e8 4c fe ff ff       	call   709 <putc>
+  while(--i >= 0)
+     8bd:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     8c1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     8c5:	79 dd                	jns    8a4 <printint+0x9e>
+}
+     8c7:	90                   	nop
+     8c8:	90                   	nop
+     8c9:	c9                   	leave
+     8ca:	c3                   	ret
+
+00000000000008cb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     8cb:	55                   	push   %rbp
+     8cc:	48 89 e5             	mov    %rsp,%rbp
+     8cf:	48 83 ec 70          	sub    $0x70,%rsp
+     8d3:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     8d6:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     8da:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     8de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     8e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     8e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     8ea:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     8f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     8f5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     8f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     8fd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     901:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     908:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     90f:	e9 6b 02 00 00       	jmp    b7f <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     914:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     917:	48 63 d0             	movslq %eax,%rdx
+     91a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     91e:	48 01 d0             	add    %rdx,%rax
+     921:	0f b6 00             	movzbl (%rax),%eax
+     924:	0f be c0             	movsbl %al,%eax
+     927:	25 ff 00 00 00       	and    $0xff,%eax
+     92c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     92f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     933:	75 30                	jne    965 <printf+0x9a>
+      if(c == '%'){
+     935:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     939:	75 13                	jne    94e <printf+0x83>
+        state = '%';
+     93b:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     942:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     949:	e9 2d 02 00 00       	jmp    b7b <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     94e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     951:	0f be d0             	movsbl %al,%edx
+     954:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     957:	89 d6                	mov    %edx,%esi
+     959:	89 c7                	mov    %eax,%edi
+     95b:	e8 a9 fd ff ff       	call   709 <putc>
+     960:	e9 16 02 00 00       	jmp    b7b <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     965:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     969:	0f 85 0c 02 00 00    	jne    b7b <printf+0x2b0>
+      if(c == 'l') {
+     96f:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     973:	75 0c                	jne    981 <printf+0xb6>
+        lflag = 1;
+     975:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     97c:	e9 fa 01 00 00       	jmp    b7b <printf+0x2b0>
+      } else if(c == 'd'){
+     981:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     985:	0f 85 95 00 00 00    	jne    a20 <printf+0x155>
+        if (lflag == 1)
+     98b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     98f:	75 49                	jne    9da <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     991:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     994:	83 f8 2f             	cmp    $0x2f,%eax
+     997:	77 17                	ja     9b0 <printf+0xe5>
+     999:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     99d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9a0:	89 d2                	mov    %edx,%edx
+     9a2:	48 01 d0             	add    %rdx,%rax
+     9a5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9a8:	83 c2 08             	add    $0x8,%edx
+     9ab:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     9ae:	eb 0c                	jmp    9bc <printf+0xf1>
+     9b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9b4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     9b8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     9bc:	48 8b 00             	mov    (%rax),%rax
+     9bf:	89 c6                	mov    %eax,%esi
+     9c1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     9c4:	b9 01 00 00 00       	mov    $0x1,%ecx
+     9c9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     9ce:	89 c7                	mov    %eax,%edi
+     9d0:	e8 5d fd ff ff       	call   732 <printint64>
+     9d5:	e9 9a 01 00 00       	jmp    b74 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     9da:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     9dd:	83 f8 2f             	cmp    $0x2f,%eax
+     9e0:	77 17                	ja     9f9 <printf+0x12e>
+     9e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     9e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9e9:	89 d2                	mov    %edx,%edx
+     9eb:	48 01 d0             	add    %rdx,%rax
+     9ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     9f1:	83 c2 08             	add    $0x8,%edx
+     9f4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     9f7:	eb 0c                	jmp    a05 <printf+0x13a>
+     9f9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     9fd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a01:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     a05:	8b 30                	mov    (%rax),%esi
+     a07:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a0a:	b9 01 00 00 00       	mov    $0x1,%ecx
+     a0f:	ba 0a 00 00 00       	mov    $0xa,%edx
+     a14:	89 c7                	mov    %eax,%edi
+     a16:	e8 eb fd ff ff       	call   806 <printint>
+     a1b:	e9 54 01 00 00       	jmp    b74 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     a20:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     a24:	74 0a                	je     a30 <printf+0x165>
+     a26:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     a2a:	0f 85 95 00 00 00    	jne    ac5 <printf+0x1fa>
+        if (lflag == 1)
+     a30:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     a34:	75 49                	jne    a7f <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     a36:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     a39:	83 f8 2f             	cmp    $0x2f,%eax
+     a3c:	77 17                	ja     a55 <printf+0x18a>
+     a3e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     a42:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a45:	89 d2                	mov    %edx,%edx
+     a47:	48 01 d0             	add    %rdx,%rax
+     a4a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a4d:	83 c2 08             	add    $0x8,%edx
+     a50:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     a53:	eb 0c                	jmp    a61 <printf+0x196>
+     a55:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     a59:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     a5d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     a61:	48 8b 00             	mov    (%rax),%rax
+     a64:	89 c6                	mov    %eax,%esi
+     a66:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     a69:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a6e:	ba 10 00 00 00       	mov    $0x10,%edx
+     a73:	89 c7                	mov    %eax,%edi
+     a75:	e8 b8 fc ff ff       	call   732 <printint64>
+        if (lflag == 1)
+     a7a:	e9 f5 00 00 00       	jmp    b74 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     a7f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     a82:	83 f8 2f             	cmp    $0x2f,%eax
+     a85:	77 17                	ja     a9e <printf+0x1d3>
+     a87:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     a8b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a8e:	89 d2                	mov    %edx,%edx
+     a90:	48 01 d0             	add    %rdx,%rax
+     a93:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     a96:	83 c2 08             	add    $0x8,%edx
+     a99:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     a9c:	eb 0c                	jmp    aaa <printf+0x1df>
+     a9e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     aa2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     aa6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     aaa:	8b 30                	mov    (%rax),%esi
+     aac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ab4:	ba 10 00 00 00       	mov    $0x10,%edx
+     ab9:	89 c7                	mov    %eax,%edi
+     abb:	e8 46 fd ff ff       	call   806 <printint>
+        if (lflag == 1)
+     ac0:	e9 af 00 00 00       	jmp    b74 <printf+0x2a9>
+      } else if(c == 's'){
+     ac5:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     ac9:	75 6e                	jne    b39 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     acb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     ace:	83 f8 2f             	cmp    $0x2f,%eax
+     ad1:	77 17                	ja     aea <printf+0x21f>
+     ad3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     ad7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ada:	89 d2                	mov    %edx,%edx
+     adc:	48 01 d0             	add    %rdx,%rax
+     adf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ae2:	83 c2 08             	add    $0x8,%edx
+     ae5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     ae8:	eb 0c                	jmp    af6 <printf+0x22b>
+     aea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     aee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     af2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     af6:	48 8b 00             	mov    (%rax),%rax
+     af9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     afd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     b02:	75 28                	jne    b2c <printf+0x261>
+          s = "(null)";
+     b04:	48 8d 05 85 09 00 00 	lea    0x985(%rip),%rax        # 1490 <malloc+0x343>
+     b0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     b0f:	eb 1b                	jmp    b2c <printf+0x261>
+          putc(fd, *s);
+     b11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b15:	0f b6 00             	movzbl (%rax),%eax
+     b18:	0f be d0             	movsbl %al,%edx
+     b1b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b1e:	89 d6                	mov    %edx,%esi
+     b20:	89 c7                	mov    %eax,%edi
+     b22:	e8 e2 fb ff ff       	call   709 <putc>
+        for(; *s; s++)
+     b27:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     b2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     b30:	0f b6 00             	movzbl (%rax),%eax
+     b33:	84 c0                	test   %al,%al
+     b35:	75 da                	jne    b11 <printf+0x246>
+     b37:	eb 3b                	jmp    b74 <printf+0x2a9>
+      } else if(c == '%'){
+     b39:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     b3d:	75 14                	jne    b53 <printf+0x288>
+        putc(fd, c);
+     b3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     b42:	0f be d0             	movsbl %al,%edx
+     b45:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b48:	89 d6                	mov    %edx,%esi
+     b4a:	89 c7                	mov    %eax,%edi
+     b4c:	e8 b8 fb ff ff       	call   709 <putc>
+     b51:	eb 21                	jmp    b74 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     b53:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b56:	be 25 00 00 00       	mov    $0x25,%esi
+     b5b:	89 c7                	mov    %eax,%edi
+     b5d:	e8 a7 fb ff ff       	call   709 <putc>
+        putc(fd, c);
+     b62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     b65:	0f be d0             	movsbl %al,%edx
+     b68:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     b6b:	89 d6                	mov    %edx,%esi
+     b6d:	89 c7                	mov    %eax,%edi
+     b6f:	e8 95 fb ff ff       	call   709 <putc>
+      }
+      state = 0;
+     b74:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     b7b:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     b7f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     b82:	48 63 d0             	movslq %eax,%rdx
+     b85:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     b89:	48 01 d0             	add    %rdx,%rax
+     b8c:	0f b6 00             	movzbl (%rax),%eax
+     b8f:	84 c0                	test   %al,%al
+     b91:	0f 85 7d fd ff ff    	jne    914 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     b97:	90                   	nop
+     b98:	90                   	nop
+     b99:	c9                   	leave
+     b9a:	c3                   	ret
+
+0000000000000b9b <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     b9b:	55                   	push   %rbp
+     b9c:	48 89 e5             	mov    %rsp,%rbp
+     b9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     ba3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     ba6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     ba9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     bad:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     bb0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     bb3:	48 89 ce             	mov    %rcx,%rsi
+     bb6:	48 89 f7             	mov    %rsi,%rdi
+     bb9:	89 d1                	mov    %edx,%ecx
+     bbb:	fc                   	cld
+     bbc:	f3 aa                	rep stos %al,%es:(%rdi)
+     bbe:	89 ca                	mov    %ecx,%edx
+     bc0:	48 89 fe             	mov    %rdi,%rsi
+     bc3:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+     bc7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+     bca:	90                   	nop
+     bcb:	5d                   	pop    %rbp
+     bcc:	c3                   	ret
+
+0000000000000bcd <strcpy>:
+{
+     bcd:	55                   	push   %rbp
+     bce:	48 89 e5             	mov    %rsp,%rbp
+     bd1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     bd5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+     bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bdd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+     be1:	90                   	nop
+     be2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     be6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     bea:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+     bee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bf2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     bf6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     bfa:	0f b6 12             	movzbl (%rdx),%edx
+     bfd:	88 10                	mov    %dl,(%rax)
+     bff:	0f b6 00             	movzbl (%rax),%eax
+     c02:	84 c0                	test   %al,%al
+     c04:	75 dc                	jne    be2 <strcpy+0x15>
+  return os;
+     c06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     c0a:	5d                   	pop    %rbp
+     c0b:	c3                   	ret
+
+0000000000000c0c <strcmp>:
+{
+     c0c:	55                   	push   %rbp
+     c0d:	48 89 e5             	mov    %rsp,%rbp
+     c10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+     c18:	eb 0a                	jmp    c24 <strcmp+0x18>
+    p++, q++;
+     c1a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     c1f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+     c24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c28:	0f b6 00             	movzbl (%rax),%eax
+     c2b:	84 c0                	test   %al,%al
+     c2d:	74 12                	je     c41 <strcmp+0x35>
+     c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c33:	0f b6 10             	movzbl (%rax),%edx
+     c36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c3a:	0f b6 00             	movzbl (%rax),%eax
+     c3d:	38 c2                	cmp    %al,%dl
+     c3f:	74 d9                	je     c1a <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+     c41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     c45:	0f b6 00             	movzbl (%rax),%eax
+     c48:	0f b6 d0             	movzbl %al,%edx
+     c4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c4f:	0f b6 00             	movzbl (%rax),%eax
+     c52:	0f b6 c0             	movzbl %al,%eax
+     c55:	29 c2                	sub    %eax,%edx
+     c57:	89 d0                	mov    %edx,%eax
+}
+     c59:	5d                   	pop    %rbp
+     c5a:	c3                   	ret
+
+0000000000000c5b <strlen>:
+{
+     c5b:	55                   	push   %rbp
+     c5c:	48 89 e5             	mov    %rsp,%rbp
+     c5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+     c63:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     c6a:	eb 04                	jmp    c70 <strlen+0x15>
+     c6c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c73:	48 63 d0             	movslq %eax,%rdx
+     c76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c7a:	48 01 d0             	add    %rdx,%rax
+     c7d:	0f b6 00             	movzbl (%rax),%eax
+     c80:	84 c0                	test   %al,%al
+     c82:	75 e8                	jne    c6c <strlen+0x11>
+  return n;
+     c84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     c87:	5d                   	pop    %rbp
+     c88:	c3                   	ret
+
+0000000000000c89 <memset>:
+{
+     c89:	55                   	push   %rbp
+     c8a:	48 89 e5             	mov    %rsp,%rbp
+     c8d:	48 83 ec 10          	sub    $0x10,%rsp
+     c91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     c95:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     c98:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+     c9b:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     c9e:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     ca5:	89 ce                	mov    %ecx,%esi
+     ca7:	48 89 c7             	mov    %rax,%rdi
+     caa:	e8 ec fe ff ff       	call   b9b <stosb>
+  return dst;
+     caf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     cb3:	c9                   	leave
+     cb4:	c3                   	ret
+
+0000000000000cb5 <strchr>:
+{
+     cb5:	55                   	push   %rbp
+     cb6:	48 89 e5             	mov    %rsp,%rbp
+     cb9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     cbd:	89 f0                	mov    %esi,%eax
+     cbf:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+     cc2:	eb 17                	jmp    cdb <strchr+0x26>
+    if(*s == c)
+     cc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cc8:	0f b6 00             	movzbl (%rax),%eax
+     ccb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+     cce:	75 06                	jne    cd6 <strchr+0x21>
+      return (char*)s;
+     cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cd4:	eb 15                	jmp    ceb <strchr+0x36>
+  for(; *s; s++)
+     cd6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+     cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     cdf:	0f b6 00             	movzbl (%rax),%eax
+     ce2:	84 c0                	test   %al,%al
+     ce4:	75 de                	jne    cc4 <strchr+0xf>
+  return 0;
+     ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ceb:	5d                   	pop    %rbp
+     cec:	c3                   	ret
+
+0000000000000ced <gets>:
+gets(char *buf, int max)
+{
+     ced:	55                   	push   %rbp
+     cee:	48 89 e5             	mov    %rsp,%rbp
+     cf1:	48 83 ec 20          	sub    $0x20,%rsp
+     cf5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     cf9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     cfc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d03:	eb 48                	jmp    d4d <gets+0x60>
+    cc = read(0, &c, 1);
+     d05:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+     d09:	ba 01 00 00 00       	mov    $0x1,%edx
+     d0e:	48 89 c6             	mov    %rax,%rsi
+     d11:	bf 00 00 00 00       	mov    $0x0,%edi
+     d16:	e8 6f 01 00 00       	call   e8a <read>
+     d1b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+     d1e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     d22:	7e 36                	jle    d5a <gets+0x6d>
+      break;
+    buf[i++] = c;
+     d24:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d27:	8d 50 01             	lea    0x1(%rax),%edx
+     d2a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     d2d:	48 63 d0             	movslq %eax,%rdx
+     d30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d34:	48 01 c2             	add    %rax,%rdx
+     d37:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d3b:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+     d3d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d41:	3c 0a                	cmp    $0xa,%al
+     d43:	74 16                	je     d5b <gets+0x6e>
+     d45:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+     d49:	3c 0d                	cmp    $0xd,%al
+     d4b:	74 0e                	je     d5b <gets+0x6e>
+  for(i=0; i+1 < max; ){
+     d4d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d50:	83 c0 01             	add    $0x1,%eax
+     d53:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+     d56:	7f ad                	jg     d05 <gets+0x18>
+     d58:	eb 01                	jmp    d5b <gets+0x6e>
+      break;
+     d5a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     d5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d5e:	48 63 d0             	movslq %eax,%rdx
+     d61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d65:	48 01 d0             	add    %rdx,%rax
+     d68:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+     d6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+     d6f:	c9                   	leave
+     d70:	c3                   	ret
+
+0000000000000d71 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     d71:	55                   	push   %rbp
+     d72:	48 89 e5             	mov    %rsp,%rbp
+     d75:	48 83 ec 20          	sub    $0x20,%rsp
+     d79:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     d7d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d85:	be 00 00 00 00       	mov    $0x0,%esi
+     d8a:	48 89 c7             	mov    %rax,%rdi
+     d8d:	e8 20 01 00 00       	call   eb2 <open>
+     d92:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+     d95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d99:	79 07                	jns    da2 <stat+0x31>
+    return -1;
+     d9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     da0:	eb 21                	jmp    dc3 <stat+0x52>
+  r = fstat(fd, st);
+     da2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     da6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     da9:	48 89 d6             	mov    %rdx,%rsi
+     dac:	89 c7                	mov    %eax,%edi
+     dae:	e8 17 01 00 00       	call   eca <fstat>
+     db3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+     db6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     db9:	89 c7                	mov    %eax,%edi
+     dbb:	e8 da 00 00 00       	call   e9a <close>
+  return r;
+     dc0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+     dc3:	c9                   	leave
+     dc4:	c3                   	ret
+
+0000000000000dc5 <atoi>:
+
+int
+atoi(const char *s)
+{
+     dc5:	55                   	push   %rbp
+     dc6:	48 89 e5             	mov    %rsp,%rbp
+     dc9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+     dcd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     dd4:	eb 28                	jmp    dfe <atoi+0x39>
+    n = n*10 + *s++ - '0';
+     dd6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     dd9:	89 d0                	mov    %edx,%eax
+     ddb:	c1 e0 02             	shl    $0x2,%eax
+     dde:	01 d0                	add    %edx,%eax
+     de0:	01 c0                	add    %eax,%eax
+     de2:	89 c1                	mov    %eax,%ecx
+     de4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     de8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+     dec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+     df0:	0f b6 00             	movzbl (%rax),%eax
+     df3:	0f be c0             	movsbl %al,%eax
+     df6:	01 c8                	add    %ecx,%eax
+     df8:	83 e8 30             	sub    $0x30,%eax
+     dfb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+     dfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e02:	0f b6 00             	movzbl (%rax),%eax
+     e05:	3c 2f                	cmp    $0x2f,%al
+     e07:	7e 0b                	jle    e14 <atoi+0x4f>
+     e09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e0d:	0f b6 00             	movzbl (%rax),%eax
+     e10:	3c 39                	cmp    $0x39,%al
+     e12:	7e c2                	jle    dd6 <atoi+0x11>
+  return n;
+     e14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     e17:	5d                   	pop    %rbp
+     e18:	c3                   	ret
+
+0000000000000e19 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     e19:	55                   	push   %rbp
+     e1a:	48 89 e5             	mov    %rsp,%rbp
+     e1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     e21:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     e25:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+     e28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+     e30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+     e38:	eb 1d                	jmp    e57 <memmove+0x3e>
+    *dst++ = *src++;
+     e3a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+     e3e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+     e42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     e46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     e4a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+     e4e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+     e52:	0f b6 12             	movzbl (%rdx),%edx
+     e55:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+     e57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     e5a:	8d 50 ff             	lea    -0x1(%rax),%edx
+     e5d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+     e60:	85 c0                	test   %eax,%eax
+     e62:	7f d6                	jg     e3a <memmove+0x21>
+  return vdst;
+     e64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e68:	5d                   	pop    %rbp
+     e69:	c3                   	ret
+
+0000000000000e6a <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+     e6a:	b8 01 00 00 00       	mov    $0x1,%eax
+     e6f:	cd 40                	int    $0x40
+     e71:	c3                   	ret
+
+0000000000000e72 <exit>:
+SYSCALL(exit)
+     e72:	b8 02 00 00 00       	mov    $0x2,%eax
+     e77:	cd 40                	int    $0x40
+     e79:	c3                   	ret
+
+0000000000000e7a <wait>:
+SYSCALL(wait)
+     e7a:	b8 03 00 00 00       	mov    $0x3,%eax
+     e7f:	cd 40                	int    $0x40
+     e81:	c3                   	ret
+
+0000000000000e82 <pipe>:
+SYSCALL(pipe)
+     e82:	b8 04 00 00 00       	mov    $0x4,%eax
+     e87:	cd 40                	int    $0x40
+     e89:	c3                   	ret
+
+0000000000000e8a <read>:
+SYSCALL(read)
+     e8a:	b8 05 00 00 00       	mov    $0x5,%eax
+     e8f:	cd 40                	int    $0x40
+     e91:	c3                   	ret
+
+0000000000000e92 <write>:
+SYSCALL(write)
+     e92:	b8 10 00 00 00       	mov    $0x10,%eax
+     e97:	cd 40                	int    $0x40
+     e99:	c3                   	ret
+
+0000000000000e9a <close>:
+SYSCALL(close)
+     e9a:	b8 15 00 00 00       	mov    $0x15,%eax
+     e9f:	cd 40                	int    $0x40
+     ea1:	c3                   	ret
+
+0000000000000ea2 <kill>:
+SYSCALL(kill)
+     ea2:	b8 06 00 00 00       	mov    $0x6,%eax
+     ea7:	cd 40                	int    $0x40
+     ea9:	c3                   	ret
+
+0000000000000eaa <exec>:
+SYSCALL(exec)
+     eaa:	b8 07 00 00 00       	mov    $0x7,%eax
+     eaf:	cd 40                	int    $0x40
+     eb1:	c3                   	ret
+
+0000000000000eb2 <open>:
+SYSCALL(open)
+     eb2:	b8 0f 00 00 00       	mov    $0xf,%eax
+     eb7:	cd 40                	int    $0x40
+     eb9:	c3                   	ret
+
+0000000000000eba <mknod>:
+SYSCALL(mknod)
+     eba:	b8 11 00 00 00       	mov    $0x11,%eax
+     ebf:	cd 40                	int    $0x40
+     ec1:	c3                   	ret
+
+0000000000000ec2 <unlink>:
+SYSCALL(unlink)
+     ec2:	b8 12 00 00 00       	mov    $0x12,%eax
+     ec7:	cd 40                	int    $0x40
+     ec9:	c3                   	ret
+
+0000000000000eca <fstat>:
+SYSCALL(fstat)
+     eca:	b8 08 00 00 00       	mov    $0x8,%eax
+     ecf:	cd 40                	int    $0x40
+     ed1:	c3                   	ret
+
+0000000000000ed2 <link>:
+SYSCALL(link)
+     ed2:	b8 13 00 00 00       	mov    $0x13,%eax
+     ed7:	cd 40                	int    $0x40
+     ed9:	c3                   	ret
+
+0000000000000eda <mkdir>:
+SYSCALL(mkdir)
+     eda:	b8 14 00 00 00       	mov    $0x14,%eax
+     edf:	cd 40                	int    $0x40
+     ee1:	c3                   	ret
+
+0000000000000ee2 <chdir>:
+SYSCALL(chdir)
+     ee2:	b8 09 00 00 00       	mov    $0x9,%eax
+     ee7:	cd 40                	int    $0x40
+     ee9:	c3                   	ret
+
+0000000000000eea <dup>:
+SYSCALL(dup)
+     eea:	b8 0a 00 00 00       	mov    $0xa,%eax
+     eef:	cd 40                	int    $0x40
+     ef1:	c3                   	ret
+
+0000000000000ef2 <getpid>:
+SYSCALL(getpid)
+     ef2:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ef7:	cd 40                	int    $0x40
+     ef9:	c3                   	ret
+
+0000000000000efa <sbrk>:
+SYSCALL(sbrk)
+     efa:	b8 0c 00 00 00       	mov    $0xc,%eax
+     eff:	cd 40                	int    $0x40
+     f01:	c3                   	ret
+
+0000000000000f02 <sleep>:
+SYSCALL(sleep)
+     f02:	b8 0d 00 00 00       	mov    $0xd,%eax
+     f07:	cd 40                	int    $0x40
+     f09:	c3                   	ret
+
+0000000000000f0a <uptime>:
+SYSCALL(uptime)
+     f0a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     f0f:	cd 40                	int    $0x40
+     f11:	c3                   	ret
+
+0000000000000f12 <sysinfo>:
+SYSCALL(sysinfo)
+     f12:	b8 16 00 00 00       	mov    $0x16,%eax
+     f17:	cd 40                	int    $0x40
+     f19:	c3                   	ret
+
+0000000000000f1a <mmap>:
+SYSCALL(mmap)
+     f1a:	b8 17 00 00 00       	mov    $0x17,%eax
+     f1f:	cd 40                	int    $0x40
+     f21:	c3                   	ret
+
+0000000000000f22 <munmap>:
+SYSCALL(munmap)
+     f22:	b8 18 00 00 00       	mov    $0x18,%eax
+     f27:	cd 40                	int    $0x40
+     f29:	c3                   	ret
+
+0000000000000f2a <crashn>:
+SYSCALL(crashn)
+     f2a:	b8 19 00 00 00       	mov    $0x19,%eax
+     f2f:	cd 40                	int    $0x40
+     f31:	c3                   	ret
+
+0000000000000f32 <mmap2>:
+SYSCALL_ADDR(mmap2)
+     f32:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     f37:	cd 40                	int    $0x40
+     f39:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f3c:	74 02                	je     f40 <mmap2+0xe>
+     f3e:	89 c0                	mov    %eax,%eax
+     f40:	c3                   	ret
+
+0000000000000f41 <munmap2>:
+SYSCALL(munmap2)
+     f41:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     f46:	cd 40                	int    $0x40
+     f48:	c3                   	ret
+
+0000000000000f49 <msync>:
+SYSCALL(msync)
+     f49:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     f4e:	cd 40                	int    $0x40
+     f50:	c3                   	ret
+
+0000000000000f51 <sendfile>:
+SYSCALL(sendfile)
+     f51:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     f56:	cd 40                	int    $0x40
+     f58:	c3                   	ret
+
+0000000000000f59 <splice>:
+SYSCALL(splice)
+     f59:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f5e:	cd 40                	int    $0x40
+     f60:	c3                   	ret
+
+0000000000000f61 <pread>:
+SYSCALL(pread)
+     f61:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f66:	cd 40                	int    $0x40
+     f68:	c3                   	ret
+
+0000000000000f69 <pwrite>:
+SYSCALL(pwrite)
+     f69:	b8 20 00 00 00       	mov    $0x20,%eax
+     f6e:	cd 40                	int    $0x40
+     f70:	c3                   	ret
+
+0000000000000f71 <readv>:
+SYSCALL(readv)
+     f71:	b8 21 00 00 00       	mov    $0x21,%eax
+     f76:	cd 40                	int    $0x40
+     f78:	c3                   	ret
+
+0000000000000f79 <writev>:
+SYSCALL(writev)
+     f79:	b8 22 00 00 00       	mov    $0x22,%eax
+     f7e:	cd 40                	int    $0x40
+     f80:	c3                   	ret
+
+0000000000000f81 <poll>:
+SYSCALL(poll)
+     f81:	b8 23 00 00 00       	mov    $0x23,%eax
+     f86:	cd 40                	int    $0x40
+     f88:	c3                   	ret
+
+0000000000000f89 <pipe2>:
+SYSCALL(pipe2)
+     f89:	b8 24 00 00 00       	mov    $0x24,%eax
+     f8e:	cd 40                	int    $0x40
+     f90:	c3                   	ret
+
+0000000000000f91 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+     f91:	55                   	push   %rbp
+     f92:	48 89 e5             	mov    %rsp,%rbp
+     f95:	48 83 ec 20          	sub    $0x20,%rsp
+     f99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     fa1:	48 83 e8 10          	sub    $0x10,%rax
+     fa5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+     fa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fad:	48 8b 10             	mov    (%rax),%rdx
+     fb0:	48 8d 05 29 08 00 00 	lea    0x829(%rip),%rax        # 17e0 <bigblock>
+     fb7:	48 39 c2             	cmp    %rax,%rdx
+     fba:	75 1f                	jne    fdb <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+     fbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fc0:	8b 40 08             	mov    0x8(%rax),%eax
+     fc3:	c1 e0 04             	shl    $0x4,%eax
+     fc6:	89 c2                	mov    %eax,%edx
+     fc8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     fcc:	89 d6                	mov    %edx,%esi
+     fce:	48 89 c7             	mov    %rax,%rdi
+     fd1:	e8 6b ff ff ff       	call   f41 <munmap2>
+    return;
+     fd6:	e9 0b 01 00 00       	jmp    10e6 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fdb:	48 8b 05 ee 07 00 00 	mov    0x7ee(%rip),%rax        # 17d0 <freep>
+     fe2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+     fe6:	eb 2f                	jmp    1017 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fe8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     fec:	48 8b 00             	mov    (%rax),%rax
+     fef:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ff3:	72 17                	jb     100c <free+0x7b>
+     ff5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ff9:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+     ffd:	72 2f                	jb     102e <free+0x9d>
+     fff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1003:	48 8b 00             	mov    (%rax),%rax
+    1006:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    100a:	72 22                	jb     102e <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    100c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1010:	48 8b 00             	mov    (%rax),%rax
+    1013:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1017:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    101b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    101f:	73 c7                	jae    fe8 <free+0x57>
+    1021:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1025:	48 8b 00             	mov    (%rax),%rax
+    1028:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    102c:	73 ba                	jae    fe8 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    102e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1032:	8b 40 08             	mov    0x8(%rax),%eax
+    1035:	89 c0                	mov    %eax,%eax
+    1037:	48 c1 e0 04          	shl    $0x4,%rax
+    103b:	48 89 c2             	mov    %rax,%rdx
+    103e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1042:	48 01 c2             	add    %rax,%rdx
+    1045:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1049:	48 8b 00             	mov    (%rax),%rax
+    104c:	48 39 c2             	cmp    %rax,%rdx
+    104f:	75 2d                	jne    107e <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1051:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1055:	8b 50 08             	mov    0x8(%rax),%edx
+    1058:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    105c:	48 8b 00             	mov    (%rax),%rax
+    105f:	8b 40 08             	mov    0x8(%rax),%eax
+    1062:	01 c2                	add    %eax,%edx
+    1064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1068:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    106b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    106f:	48 8b 00             	mov    (%rax),%rax
+    1072:	48 8b 10             	mov    (%rax),%rdx
+    1075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1079:	48 89 10             	mov    %rdx,(%rax)
+    107c:	eb 0e                	jmp    108c <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    107e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1082:	48 8b 10             	mov    (%rax),%rdx
+    1085:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1089:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    108c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1090:	8b 40 08             	mov    0x8(%rax),%eax
+    1093:	89 c0                	mov    %eax,%eax
+    1095:	48 c1 e0 04          	shl    $0x4,%rax
+    1099:	48 89 c2             	mov    %rax,%rdx
+    109c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10a0:	48 01 d0             	add    %rdx,%rax
+    10a3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    10a7:	75 27                	jne    10d0 <free+0x13f>
+    p->s.size += bp->s.size;
+    10a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10ad:	8b 50 08             	mov    0x8(%rax),%edx
+    10b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10b4:	8b 40 08             	mov    0x8(%rax),%eax
+    10b7:	01 c2                	add    %eax,%edx
+    10b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10bd:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    10c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10c4:	48 8b 10             	mov    (%rax),%rdx
+    10c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10cb:	48 89 10             	mov    %rdx,(%rax)
+    10ce:	eb 0b                	jmp    10db <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    10d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10d4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    10d8:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    10db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10df:	48 89 05 ea 06 00 00 	mov    %rax,0x6ea(%rip)        # 17d0 <freep>
+}
+    10e6:	c9                   	leave
+    10e7:	c3                   	ret
+
+00000000000010e8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    10e8:	55                   	push   %rbp
+    10e9:	48 89 e5             	mov    %rsp,%rbp
+    10ec:	48 83 ec 20          	sub    $0x20,%rsp
+    10f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    10f3:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    10fa:	77 07                	ja     1103 <morecore+0x1b>
+    nu = 4096;
+    10fc:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1103:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1106:	c1 e0 04             	shl    $0x4,%eax
+    1109:	89 c7                	mov    %eax,%edi
+    110b:	e8 ea fd ff ff       	call   efa <sbrk>
+    1110:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1114:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1119:	75 07                	jne    1122 <morecore+0x3a>
+    return 0;
+    111b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1120:	eb 29                	jmp    114b <morecore+0x63>
+  hp = (Header*)p;
+    1122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1126:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    112a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    112e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1131:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1134:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1138:	48 83 c0 10          	add    $0x10,%rax
+    113c:	48 89 c7             	mov    %rax,%rdi
+    113f:	e8 4d fe ff ff       	call   f91 <free>
+  return freep;
+    1144:	48 8b 05 85 06 00 00 	mov    0x685(%rip),%rax        # 17d0 <freep>
+}
+    114b:	c9                   	leave
+    114c:	c3                   	ret
+
+000000000000114d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    114d:	55                   	push   %rbp
+    114e:	48 89 e5             	mov    %rsp,%rbp
+    1151:	48 83 ec 30          	sub    $0x30,%rsp
+    1155:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1158:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    115b:	48 83 c0 0f          	add    $0xf,%rax
+    115f:	48 c1 e8 04          	shr    $0x4,%rax
+    1163:	83 c0 01             	add    $0x1,%eax
+    1166:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1169:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1170:	76 62                	jbe    11d4 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1172:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1175:	c1 e0 04             	shl    $0x4,%eax
+    1178:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    117e:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1184:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1189:	ba 03 00 00 00       	mov    $0x3,%edx
+    118e:	89 c6                	mov    %eax,%esi
+    1190:	bf 00 00 00 00       	mov    $0x0,%edi
+    1195:	e8 98 fd ff ff       	call   f32 <mmap2>
+    119a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    119e:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    11a3:	75 0a                	jne    11af <malloc+0x62>
+      return 0;
+    11a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    11aa:	e9 1c 01 00 00       	jmp    12cb <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    11af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11b3:	48 8d 15 26 06 00 00 	lea    0x626(%rip),%rdx        # 17e0 <bigblock>
+    11ba:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    11bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    11c4:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    11c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    11cb:	48 83 c0 10          	add    $0x10,%rax
+    11cf:	e9 f7 00 00 00       	jmp    12cb <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    11d4:	48 8b 05 f5 05 00 00 	mov    0x5f5(%rip),%rax        # 17d0 <freep>
+    11db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    11df:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    11e4:	75 2e                	jne    1214 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    11e6:	48 8d 05 d3 05 00 00 	lea    0x5d3(%rip),%rax        # 17c0 <base>
+    11ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    11f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11f5:	48 89 05 d4 05 00 00 	mov    %rax,0x5d4(%rip)        # 17d0 <freep>
+    11fc:	48 8b 05 cd 05 00 00 	mov    0x5cd(%rip),%rax        # 17d0 <freep>
+    1203:	48 89 05 b6 05 00 00 	mov    %rax,0x5b6(%rip)        # 17c0 <base>
+    base.s.size = 0;
+    120a:	c7 05 b4 05 00 00 00 	movl   $0x0,0x5b4(%rip)        # 17c8 <base+0x8>
+    1211:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1214:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1218:	48 8b 00             	mov    (%rax),%rax
+    121b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    121f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1223:	8b 40 08             	mov    0x8(%rax),%eax
+    1226:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1229:	72 5f                	jb     128a <malloc+0x13d>
+      if(p->s.size == nunits)
+    122b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    122f:	8b 40 08             	mov    0x8(%rax),%eax
+    1232:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1235:	75 10                	jne    1247 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1237:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    123b:	48 8b 10             	mov    (%rax),%rdx
+    123e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1242:	48 89 10             	mov    %rdx,(%rax)
+    1245:	eb 2e                	jmp    1275 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1247:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    124b:	8b 40 08             	mov    0x8(%rax),%eax
+    124e:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1251:	89 c2                	mov    %eax,%edx
+    1253:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1257:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    125a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    125e:	8b 40 08             	mov    0x8(%rax),%eax
+    1261:	89 c0                	mov    %eax,%eax
+    1263:	48 c1 e0 04          	shl    $0x4,%rax
+    1267:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    126b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    126f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1272:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1275:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1279:	48 89 05 50 05 00 00 	mov    %rax,0x550(%rip)        # 17d0 <freep>
+      return (void*)(p + 1);
+    1280:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1284:	48 83 c0 10          	add    $0x10,%rax
+    1288:	eb 41                	jmp    12cb <malloc+0x17e>
+    }
+    if(p == freep)
+    128a:	48 8b 05 3f 05 00 00 	mov    0x53f(%rip),%rax        # 17d0 <freep>
+    1291:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1295:	75 1c                	jne    12b3 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1297:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    129a:	89 c7                	mov    %eax,%edi
+    129c:	e8 47 fe ff ff       	call   10e8 <morecore>
+    12a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    12a5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    12aa:	75 07                	jne    12b3 <malloc+0x166>
+        return 0;
+    12ac:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b1:	eb 18                	jmp    12cb <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    12bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    12bf:	48 8b 00             	mov    (%rax),%rax
+    12c2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    12c6:	e9 54 ff ff ff       	jmp    121f <malloc+0xd2>
+  }
+}
+    12cb:	c9                   	leave
+    12cc:	c3                   	ret
@@ -0,0 +1,1443 @@
+
+out/user/_ln:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <stat.h>
+#include <user.h>
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 10          	sub    $0x10,%rsp
+   8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+   b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(argc != 3){
+   f:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+  13:	74 1e                	je     33 <main+0x33>
+    printf(2, "Usage: ln old new\n");
+  15:	48 8d 05 3a 0c 00 00 	lea    0xc3a(%rip),%rax        # c56 <malloc+0x180>
+  1c:	48 89 c6             	mov    %rax,%rsi
+  1f:	bf 02 00 00 00       	mov    $0x2,%edi
+  24:	b8 00 00 00 00       	mov    $0x0,%eax
+  29:	e8 26 02 00 00       	call   254 <printf>
+    exit();
+  2e:	e8 c8 07 00 00       	call   7fb <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  37:	48 83 c0 10          	add    $0x10,%rax
+  3b:	48 8b 10             	mov    (%rax),%rdx
+  3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  42:	48 83 c0 08          	add    $0x8,%rax
+  46:	48 8b 00             	mov    (%rax),%rax
+  49:	48 89 d6             	mov    %rdx,%rsi
+  4c:	48 89 c7             	mov    %rax,%rdi
+  4f:	e8 07 08 00 00       	call   85b <link>
+  54:	85 c0                	test   %eax,%eax
+  56:	79 35                	jns    8d <main+0x8d>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  5c:	48 83 c0 10          	add    $0x10,%rax
+  60:	48 8b 10             	mov    (%rax),%rdx
+  63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  67:	48 83 c0 08          	add    $0x8,%rax
+  6b:	48 8b 00             	mov    (%rax),%rax
+  6e:	48 89 d1             	mov    %rdx,%rcx
+  71:	48 89 c2             	mov    %rax,%rdx
+  74:	48 8d 05 ee 0b 00 00 	lea    0xbee(%rip),%rax        # c69 <malloc+0x193>
+  7b:	48 89 c6             	mov    %rax,%rsi
+  7e:	bf 02 00 00 00       	mov    $0x2,%edi
+  83:	b8 00 00 00 00       	mov    $0x0,%eax
+  88:	e8 c7 01 00 00       	call   254 <printf>
+  exit();
+  8d:	e8 69 07 00 00       	call   7fb <exit>
+
+0000000000000092 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+  92:	55                   	push   %rbp
+  93:	48 89 e5             	mov    %rsp,%rbp
+  96:	48 83 ec 10          	sub    $0x10,%rsp
+  9a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  9d:	89 f0                	mov    %esi,%eax
+  9f:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+  a2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  ae:	48 89 ce             	mov    %rcx,%rsi
+  b1:	89 c7                	mov    %eax,%edi
+  b3:	e8 63 07 00 00       	call   81b <write>
+}
+  b8:	90                   	nop
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+00000000000000bb <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+  bb:	55                   	push   %rbp
+  bc:	48 89 e5             	mov    %rsp,%rbp
+  bf:	48 83 ec 40          	sub    $0x40,%rsp
+  c3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  c6:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  c9:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  cc:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+  cf:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  d3:	74 1f                	je     f4 <printint64+0x39>
+  d5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  d8:	c1 e8 1f             	shr    $0x1f,%eax
+  db:	0f b6 c0             	movzbl %al,%eax
+  de:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  e1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  e5:	74 0d                	je     f4 <printint64+0x39>
+    x = -xx;
+  e7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  ea:	f7 d8                	neg    %eax
+  ec:	48 98                	cltq
+  ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  f2:	eb 09                	jmp    fd <printint64+0x42>
+  else
+    x = xx;
+  f4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  f7:	48 98                	cltq
+  f9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+  fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 104:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 107:	48 63 c8             	movslq %eax,%rcx
+ 10a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 10e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 113:	48 f7 f1             	div    %rcx
+ 116:	48 89 d1             	mov    %rdx,%rcx
+ 119:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 11c:	8d 50 01             	lea    0x1(%rax),%edx
+ 11f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 122:	48 8d 15 b7 0d 00 00 	lea    0xdb7(%rip),%rdx        # ee0 <digits.1>
+ 129:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 12d:	48 98                	cltq
+ 12f:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 133:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 136:	48 63 f0             	movslq %eax,%rsi
+ 139:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 13d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 142:	48 f7 f6             	div    %rsi
+ 145:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 149:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 14e:	75 b4                	jne    104 <printint64+0x49>
+
+  if(sgn)
+ 150:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 154:	74 2b                	je     181 <printint64+0xc6>
+    buf[i++] = '-';
+ 156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 159:	8d 50 01             	lea    0x1(%rax),%edx
+ 15c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 15f:	48 98                	cltq
+ 161:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 166:	eb 19                	jmp    181 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 168:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 16b:	48 98                	cltq
+ 16d:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 172:	0f be d0             	movsbl %al,%edx
+ 175:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 178:	89 d6                	mov    %edx,%esi
+ 17a:	89 c7                	mov    %eax,%edi
+ 17c:	e8 11 ff ff ff       	call   92 <putc>
+  while(--i >= 0)
+ 181:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 185:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 189:	79 dd                	jns    168 <printint64+0xad>
+}
+ 18b:	90                   	nop
+ 18c:	90                   	nop
+ 18d:	c9                   	leave
+ 18e:	c3                   	ret
+
+000000000000018f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 18f:	55                   	push   %rbp
+ 190:	48 89 e5             	mov    %rsp,%rbp
+ 193:	48 83 ec 30          	sub    $0x30,%rsp
+ 197:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 19a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 19d:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1a0:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1a3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 1aa:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1ae:	74 17                	je     1c7 <printint+0x38>
+ 1b0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1b4:	79 11                	jns    1c7 <printint+0x38>
+    neg = 1;
+ 1b6:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1bd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1c0:	f7 d8                	neg    %eax
+ 1c2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1c5:	eb 06                	jmp    1cd <printint+0x3e>
+  } else {
+    x = xx;
+ 1c7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1ca:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 1d4:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1da:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1df:	f7 f1                	div    %ecx
+ 1e1:	89 d1                	mov    %edx,%ecx
+ 1e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1e6:	8d 50 01             	lea    0x1(%rax),%edx
+ 1e9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ec:	89 c9                	mov    %ecx,%ecx
+ 1ee:	48 8d 15 0b 0d 00 00 	lea    0xd0b(%rip),%rdx        # f00 <digits.0>
+ 1f5:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 1f9:	48 98                	cltq
+ 1fb:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 1ff:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 202:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 205:	ba 00 00 00 00       	mov    $0x0,%edx
+ 20a:	f7 f6                	div    %esi
+ 20c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 20f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 213:	75 bf                	jne    1d4 <printint+0x45>
+  if(neg)
+ 215:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 219:	74 2b                	je     246 <printint+0xb7>
+    buf[i++] = '-';
+ 21b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 21e:	8d 50 01             	lea    0x1(%rax),%edx
+ 221:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 224:	48 98                	cltq
+ 226:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 22b:	eb 19                	jmp    246 <printint+0xb7>
+    putc(fd, buf[i]);
+ 22d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 230:	48 98                	cltq
+ 232:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 237:	0f be d0             	movsbl %al,%edx
+ 23a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 23d:	89 d6                	mov    %edx,%esi
+ 23f:	89 c7                	mov    %eax,%edi
+ 241:	e8 4c fe ff ff       	call   92 <putc>
+  while(--i >= 0)
+ 246:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 24a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 24e:	79 dd                	jns    22d <printint+0x9e>
+}
+ 250:	90                   	nop
+ 251:	90                   	nop
+ 252:	c9                   	leave
+ 253:	c3                   	ret
+
+0000000000000254 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 254:	55                   	push   %rbp
+ 255:	48 89 e5             	mov    %rsp,%rbp
+ 258:	48 83 ec 70          	sub    $0x70,%rsp
+ 25c:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 25f:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 263:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 267:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 26b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 26f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 273:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 27a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 27e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 282:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 286:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 28a:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 291:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 298:	e9 6b 02 00 00       	jmp    508 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 29d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2a0:	48 63 d0             	movslq %eax,%rdx
+ 2a3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2a7:	48 01 d0             	add    %rdx,%rax
+ 2aa:	0f b6 00             	movzbl (%rax),%eax
+ 2ad:	0f be c0             	movsbl %al,%eax
+ 2b0:	25 ff 00 00 00       	and    $0xff,%eax
+ 2b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 2b8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2bc:	75 30                	jne    2ee <printf+0x9a>
+      if(c == '%'){
+ 2be:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2c2:	75 13                	jne    2d7 <printf+0x83>
+        state = '%';
+ 2c4:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2cb:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2d2:	e9 2d 02 00 00       	jmp    504 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2da:	0f be d0             	movsbl %al,%edx
+ 2dd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2e0:	89 d6                	mov    %edx,%esi
+ 2e2:	89 c7                	mov    %eax,%edi
+ 2e4:	e8 a9 fd ff ff       	call   92 <putc>
+ 2e9:	e9 16 02 00 00       	jmp    504 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 2ee:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 2f2:	0f 85 0c 02 00 00    	jne    504 <printf+0x2b0>
+      if(c == 'l') {
+ 2f8:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 2fc:	75 0c                	jne    30a <printf+0xb6>
+        lflag = 1;
+ 2fe:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 305:	e9 fa 01 00 00       	jmp    504 <printf+0x2b0>
+      } else if(c == 'd'){
+ 30a:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 30e:	0f 85 95 00 00 00    	jne    3a9 <printf+0x155>
+        if (lflag == 1)
+ 314:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 318:	75 49                	jne    363 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 31a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 31d:	83 f8 2f             	cmp    $0x2f,%eax
+ 320:	77 17                	ja     339 <printf+0xe5>
+ 322:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 326:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 329:	89 d2                	mov    %edx,%edx
+ 32b:	48 01 d0             	add    %rdx,%rax
+ 32e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 331:	83 c2 08             	add    $0x8,%edx
+ 334:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 337:	eb 0c                	jmp    345 <printf+0xf1>
+ 339:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 33d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 341:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 345:	48 8b 00             	mov    (%rax),%rax
+ 348:	89 c6                	mov    %eax,%esi
+ 34a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 34d:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 352:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 357:	89 c7                	mov    %eax,%edi
+ 359:	e8 5d fd ff ff       	call   bb <printint64>
+ 35e:	e9 9a 01 00 00       	jmp    4fd <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 363:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 366:	83 f8 2f             	cmp    $0x2f,%eax
+ 369:	77 17                	ja     382 <printf+0x12e>
+ 36b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 36f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 372:	89 d2                	mov    %edx,%edx
+ 374:	48 01 d0             	add    %rdx,%rax
+ 377:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 37a:	83 c2 08             	add    $0x8,%edx
+ 37d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 380:	eb 0c                	jmp    38e <printf+0x13a>
+ 382:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 386:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 38a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 38e:	8b 30                	mov    (%rax),%esi
+ 390:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 393:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 398:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 39d:	89 c7                	mov    %eax,%edi
+ 39f:	e8 eb fd ff ff       	call   18f <printint>
+ 3a4:	e9 54 01 00 00       	jmp    4fd <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 3a9:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3ad:	74 0a                	je     3b9 <printf+0x165>
+ 3af:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3b3:	0f 85 95 00 00 00    	jne    44e <printf+0x1fa>
+        if (lflag == 1)
+ 3b9:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3bd:	75 49                	jne    408 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3bf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3c2:	83 f8 2f             	cmp    $0x2f,%eax
+ 3c5:	77 17                	ja     3de <printf+0x18a>
+ 3c7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3cb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3ce:	89 d2                	mov    %edx,%edx
+ 3d0:	48 01 d0             	add    %rdx,%rax
+ 3d3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3d6:	83 c2 08             	add    $0x8,%edx
+ 3d9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3dc:	eb 0c                	jmp    3ea <printf+0x196>
+ 3de:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3e2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3e6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3ea:	48 8b 00             	mov    (%rax),%rax
+ 3ed:	89 c6                	mov    %eax,%esi
+ 3ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 3f7:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3fc:	89 c7                	mov    %eax,%edi
+ 3fe:	e8 b8 fc ff ff       	call   bb <printint64>
+        if (lflag == 1)
+ 403:	e9 f5 00 00 00       	jmp    4fd <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 408:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 40b:	83 f8 2f             	cmp    $0x2f,%eax
+ 40e:	77 17                	ja     427 <printf+0x1d3>
+ 410:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 414:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 417:	89 d2                	mov    %edx,%edx
+ 419:	48 01 d0             	add    %rdx,%rax
+ 41c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 41f:	83 c2 08             	add    $0x8,%edx
+ 422:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 425:	eb 0c                	jmp    433 <printf+0x1df>
+ 427:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 42b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 42f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 433:	8b 30                	mov    (%rax),%esi
+ 435:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 438:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 43d:	ba 10 00 00 00       	mov    $0x10,%edx
+ 442:	89 c7                	mov    %eax,%edi
+ 444:	e8 46 fd ff ff       	call   18f <printint>
+        if (lflag == 1)
+ 449:	e9 af 00 00 00       	jmp    4fd <printf+0x2a9>
+      } else if(c == 's'){
+ 44e:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 452:	75 6e                	jne    4c2 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 454:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 457:	83 f8 2f             	cmp    $0x2f,%eax
+ 45a:	77 17                	ja     473 <printf+0x21f>
+ 45c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 460:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 463:	89 d2                	mov    %edx,%edx
+ 465:	48 01 d0             	add    %rdx,%rax
+ 468:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 46b:	83 c2 08             	add    $0x8,%edx
+ 46e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 471:	eb 0c                	jmp    47f <printf+0x22b>
+ 473:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 477:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 47b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 47f:	48 8b 00             	mov    (%rax),%rax
+ 482:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 486:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 48b:	75 28                	jne    4b5 <printf+0x261>
+          s = "(null)";
+ 48d:	48 8d 05 e9 07 00 00 	lea    0x7e9(%rip),%rax        # c7d <malloc+0x1a7>
+ 494:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 498:	eb 1b                	jmp    4b5 <printf+0x261>
+          putc(fd, *s);
+ 49a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 49e:	0f b6 00             	movzbl (%rax),%eax
+ 4a1:	0f be d0             	movsbl %al,%edx
+ 4a4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4a7:	89 d6                	mov    %edx,%esi
+ 4a9:	89 c7                	mov    %eax,%edi
+ 4ab:	e8 e2 fb ff ff       	call   92 <putc>
+        for(; *s; s++)
+ 4b0:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4b9:	0f b6 00             	movzbl (%rax),%eax
+ 4bc:	84 c0                	test   %al,%al
+ 4be:	75 da                	jne    49a <printf+0x246>
+ 4c0:	eb 3b                	jmp    4fd <printf+0x2a9>
+      } else if(c == '%'){
+ 4c2:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4c6:	75 14                	jne    4dc <printf+0x288>
+        putc(fd, c);
+ 4c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4cb:	0f be d0             	movsbl %al,%edx
+ 4ce:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4d1:	89 d6                	mov    %edx,%esi
+ 4d3:	89 c7                	mov    %eax,%edi
+ 4d5:	e8 b8 fb ff ff       	call   92 <putc>
+ 4da:	eb 21                	jmp    4fd <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4dc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4df:	be 25 00 00 00       	mov    $0x25,%esi
+ 4e4:	89 c7                	mov    %eax,%edi
+ 4e6:	e8 a7 fb ff ff       	call   92 <putc>
+        putc(fd, c);
+ 4eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4ee:	0f be d0             	movsbl %al,%edx
+ 4f1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f4:	89 d6                	mov    %edx,%esi
+ 4f6:	89 c7                	mov    %eax,%edi
+ 4f8:	e8 95 fb ff ff       	call   92 <putc>
+      }
+      state = 0;
+ 4fd:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 504:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 508:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 50b:	48 63 d0             	movslq %eax,%rdx
+ 50e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 512:	48 01 d0             	add    %rdx,%rax
+ 515:	0f b6 00             	movzbl (%rax),%eax
+ 518:	84 c0                	test   %al,%al
+ 51a:	0f 85 7d fd ff ff    	jne    29d <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 520:	90                   	nop
+ 521:	90                   	nop
+ 522:	c9                   	leave
+ 523:	c3                   	ret
+
+0000000000000524 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 524:	55                   	push   %rbp
+ 525:	48 89 e5             	mov    %rsp,%rbp
+ 528:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 52c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 52f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 532:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 536:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 539:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 53c:	48 89 ce             	mov    %rcx,%rsi
+ 53f:	48 89 f7             	mov    %rsi,%rdi
+ 542:	89 d1                	mov    %edx,%ecx
+ 544:	fc                   	cld
+ 545:	f3 aa                	rep stos %al,%es:(%rdi)
+ 547:	89 ca                	mov    %ecx,%edx
+ 549:	48 89 fe             	mov    %rdi,%rsi
+ 54c:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 550:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 553:	90                   	nop
+ 554:	5d                   	pop    %rbp
+ 555:	c3                   	ret
+
+0000000000000556 <strcpy>:
+{
+ 556:	55                   	push   %rbp
+ 557:	48 89 e5             	mov    %rsp,%rbp
+ 55a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 55e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 562:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 566:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 56a:	90                   	nop
+ 56b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 56f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 573:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 577:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 57b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 57f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 583:	0f b6 12             	movzbl (%rdx),%edx
+ 586:	88 10                	mov    %dl,(%rax)
+ 588:	0f b6 00             	movzbl (%rax),%eax
+ 58b:	84 c0                	test   %al,%al
+ 58d:	75 dc                	jne    56b <strcpy+0x15>
+  return os;
+ 58f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 593:	5d                   	pop    %rbp
+ 594:	c3                   	ret
+
+0000000000000595 <strcmp>:
+{
+ 595:	55                   	push   %rbp
+ 596:	48 89 e5             	mov    %rsp,%rbp
+ 599:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 59d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5a1:	eb 0a                	jmp    5ad <strcmp+0x18>
+    p++, q++;
+ 5a3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5a8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5b1:	0f b6 00             	movzbl (%rax),%eax
+ 5b4:	84 c0                	test   %al,%al
+ 5b6:	74 12                	je     5ca <strcmp+0x35>
+ 5b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5bc:	0f b6 10             	movzbl (%rax),%edx
+ 5bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5c3:	0f b6 00             	movzbl (%rax),%eax
+ 5c6:	38 c2                	cmp    %al,%dl
+ 5c8:	74 d9                	je     5a3 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5ce:	0f b6 00             	movzbl (%rax),%eax
+ 5d1:	0f b6 d0             	movzbl %al,%edx
+ 5d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5d8:	0f b6 00             	movzbl (%rax),%eax
+ 5db:	0f b6 c0             	movzbl %al,%eax
+ 5de:	29 c2                	sub    %eax,%edx
+ 5e0:	89 d0                	mov    %edx,%eax
+}
+ 5e2:	5d                   	pop    %rbp
+ 5e3:	c3                   	ret
+
+00000000000005e4 <strlen>:
+{
+ 5e4:	55                   	push   %rbp
+ 5e5:	48 89 e5             	mov    %rsp,%rbp
+ 5e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 5ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 5f3:	eb 04                	jmp    5f9 <strlen+0x15>
+ 5f5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 5f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 5fc:	48 63 d0             	movslq %eax,%rdx
+ 5ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 603:	48 01 d0             	add    %rdx,%rax
+ 606:	0f b6 00             	movzbl (%rax),%eax
+ 609:	84 c0                	test   %al,%al
+ 60b:	75 e8                	jne    5f5 <strlen+0x11>
+  return n;
+ 60d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 610:	5d                   	pop    %rbp
+ 611:	c3                   	ret
+
+0000000000000612 <memset>:
+{
+ 612:	55                   	push   %rbp
+ 613:	48 89 e5             	mov    %rsp,%rbp
+ 616:	48 83 ec 10          	sub    $0x10,%rsp
+ 61a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 61e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 621:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 624:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 627:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 62a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 62e:	89 ce                	mov    %ecx,%esi
+ 630:	48 89 c7             	mov    %rax,%rdi
+ 633:	e8 ec fe ff ff       	call   524 <stosb>
+  return dst;
+ 638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 63c:	c9                   	leave
+ 63d:	c3                   	ret
+
+000000000000063e <strchr>:
+{
+ 63e:	55                   	push   %rbp
+ 63f:	48 89 e5             	mov    %rsp,%rbp
+ 642:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 646:	89 f0                	mov    %esi,%eax
+ 648:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 64b:	eb 17                	jmp    664 <strchr+0x26>
+    if(*s == c)
+ 64d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 651:	0f b6 00             	movzbl (%rax),%eax
+ 654:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 657:	75 06                	jne    65f <strchr+0x21>
+      return (char*)s;
+ 659:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 65d:	eb 15                	jmp    674 <strchr+0x36>
+  for(; *s; s++)
+ 65f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 668:	0f b6 00             	movzbl (%rax),%eax
+ 66b:	84 c0                	test   %al,%al
+ 66d:	75 de                	jne    64d <strchr+0xf>
+  return 0;
+ 66f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 674:	5d                   	pop    %rbp
+ 675:	c3                   	ret
+
+0000000000000676 <gets>:
+gets(char *buf, int max)
+{
+ 676:	55                   	push   %rbp
+ 677:	48 89 e5             	mov    %rsp,%rbp
+ 67a:	48 83 ec 20          	sub    $0x20,%rsp
+ 67e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 682:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 685:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 68c:	eb 48                	jmp    6d6 <gets+0x60>
+    cc = read(0, &c, 1);
+ 68e:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 692:	ba 01 00 00 00       	mov    $0x1,%edx
+ 697:	48 89 c6             	mov    %rax,%rsi
+ 69a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 69f:	e8 6f 01 00 00       	call   813 <read>
+ 6a4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 6a7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6ab:	7e 36                	jle    6e3 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 6ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6b0:	8d 50 01             	lea    0x1(%rax),%edx
+ 6b3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6b6:	48 63 d0             	movslq %eax,%rdx
+ 6b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6bd:	48 01 c2             	add    %rax,%rdx
+ 6c0:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6c4:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 6c6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6ca:	3c 0a                	cmp    $0xa,%al
+ 6cc:	74 16                	je     6e4 <gets+0x6e>
+ 6ce:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6d2:	3c 0d                	cmp    $0xd,%al
+ 6d4:	74 0e                	je     6e4 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 6d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6d9:	83 c0 01             	add    $0x1,%eax
+ 6dc:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6df:	7f ad                	jg     68e <gets+0x18>
+ 6e1:	eb 01                	jmp    6e4 <gets+0x6e>
+      break;
+ 6e3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 6e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6e7:	48 63 d0             	movslq %eax,%rdx
+ 6ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6ee:	48 01 d0             	add    %rdx,%rax
+ 6f1:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 6f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 6f8:	c9                   	leave
+ 6f9:	c3                   	ret
+
+00000000000006fa <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 6fa:	55                   	push   %rbp
+ 6fb:	48 89 e5             	mov    %rsp,%rbp
+ 6fe:	48 83 ec 20          	sub    $0x20,%rsp
+ 702:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 706:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 70a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 70e:	be 00 00 00 00       	mov    $0x0,%esi
+ 713:	48 89 c7             	mov    %rax,%rdi
+ 716:	e8 20 01 00 00       	call   83b <open>
+ 71b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 71e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 722:	79 07                	jns    72b <stat+0x31>
+    return -1;
+ 724:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 729:	eb 21                	jmp    74c <stat+0x52>
+  r = fstat(fd, st);
+ 72b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 72f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 732:	48 89 d6             	mov    %rdx,%rsi
+ 735:	89 c7                	mov    %eax,%edi
+ 737:	e8 17 01 00 00       	call   853 <fstat>
+ 73c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 73f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 742:	89 c7                	mov    %eax,%edi
+ 744:	e8 da 00 00 00       	call   823 <close>
+  return r;
+ 749:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 74c:	c9                   	leave
+ 74d:	c3                   	ret
+
+000000000000074e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 74e:	55                   	push   %rbp
+ 74f:	48 89 e5             	mov    %rsp,%rbp
+ 752:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 756:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 75d:	eb 28                	jmp    787 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 75f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 762:	89 d0                	mov    %edx,%eax
+ 764:	c1 e0 02             	shl    $0x2,%eax
+ 767:	01 d0                	add    %edx,%eax
+ 769:	01 c0                	add    %eax,%eax
+ 76b:	89 c1                	mov    %eax,%ecx
+ 76d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 771:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 775:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 779:	0f b6 00             	movzbl (%rax),%eax
+ 77c:	0f be c0             	movsbl %al,%eax
+ 77f:	01 c8                	add    %ecx,%eax
+ 781:	83 e8 30             	sub    $0x30,%eax
+ 784:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 78b:	0f b6 00             	movzbl (%rax),%eax
+ 78e:	3c 2f                	cmp    $0x2f,%al
+ 790:	7e 0b                	jle    79d <atoi+0x4f>
+ 792:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 796:	0f b6 00             	movzbl (%rax),%eax
+ 799:	3c 39                	cmp    $0x39,%al
+ 79b:	7e c2                	jle    75f <atoi+0x11>
+  return n;
+ 79d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7a0:	5d                   	pop    %rbp
+ 7a1:	c3                   	ret
+
+00000000000007a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 7a2:	55                   	push   %rbp
+ 7a3:	48 89 e5             	mov    %rsp,%rbp
+ 7a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7ae:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 7c1:	eb 1d                	jmp    7e0 <memmove+0x3e>
+    *dst++ = *src++;
+ 7c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7c7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7cb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7d7:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7db:	0f b6 12             	movzbl (%rdx),%edx
+ 7de:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 7e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7e3:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7e6:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7e9:	85 c0                	test   %eax,%eax
+ 7eb:	7f d6                	jg     7c3 <memmove+0x21>
+  return vdst;
+ 7ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7f1:	5d                   	pop    %rbp
+ 7f2:	c3                   	ret
+
+00000000000007f3 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 7f3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+00000000000007fb <exit>:
+SYSCALL(exit)
+ 7fb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+0000000000000803 <wait>:
+SYSCALL(wait)
+ 803:	b8 03 00 00 00       	mov    $0x3,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+000000000000080b <pipe>:
+SYSCALL(pipe)
+ 80b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+0000000000000813 <read>:
+SYSCALL(read)
+ 813:	b8 05 00 00 00       	mov    $0x5,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+000000000000081b <write>:
+SYSCALL(write)
+ 81b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+0000000000000823 <close>:
+SYSCALL(close)
+ 823:	b8 15 00 00 00       	mov    $0x15,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+000000000000082b <kill>:
+SYSCALL(kill)
+ 82b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+0000000000000833 <exec>:
+SYSCALL(exec)
+ 833:	b8 07 00 00 00       	mov    $0x7,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+000000000000083b <open>:
+SYSCALL(open)
+ 83b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+0000000000000843 <mknod>:
+SYSCALL(mknod)
+ 843:	b8 11 00 00 00       	mov    $0x11,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+000000000000084b <unlink>:
+SYSCALL(unlink)
+ 84b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+0000000000000853 <fstat>:
+SYSCALL(fstat)
+ 853:	b8 08 00 00 00       	mov    $0x8,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+000000000000085b <link>:
+SYSCALL(link)
+ 85b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+0000000000000863 <mkdir>:
+SYSCALL(mkdir)
+ 863:	b8 14 00 00 00       	mov    $0x14,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+000000000000086b <chdir>:
+SYSCALL(chdir)
+ 86b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+0000000000000873 <dup>:
+SYSCALL(dup)
+ 873:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+000000000000087b <getpid>:
+SYSCALL(getpid)
+ 87b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+0000000000000883 <sbrk>:
+SYSCALL(sbrk)
+ 883:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+000000000000088b <sleep>:
+SYSCALL(sleep)
+ 88b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+0000000000000893 <uptime>:
+SYSCALL(uptime)
+ 893:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+000000000000089b <sysinfo>:
+SYSCALL(sysinfo)
+ 89b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+00000000000008a3 <mmap>:
+SYSCALL(mmap)
+ 8a3:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+00000000000008ab <munmap>:
+SYSCALL(munmap)
+ 8ab:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+00000000000008b3 <crashn>:
+SYSCALL(crashn)
+ 8b3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+00000000000008bb <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 8bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c5:	74 02                	je     8c9 <mmap2+0xe>
+ 8c7:	89 c0                	mov    %eax,%eax
+ 8c9:	c3                   	ret
+
+00000000000008ca <munmap2>:
+SYSCALL(munmap2)
+ 8ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8cf:	cd 40                	int    $0x40
+ 8d1:	c3                   	ret
+
+00000000000008d2 <msync>:
+SYSCALL(msync)
+ 8d2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8d7:	cd 40                	int    $0x40
+ 8d9:	c3                   	ret
+
+00000000000008da <sendfile>:
+SYSCALL(sendfile)
+ 8da:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8df:	cd 40                	int    $0x40
+ 8e1:	c3                   	ret
+
+00000000000008e2 <splice>:
+SYSCALL(splice)
+ 8e2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8e7:	cd 40                	int    $0x40
+ 8e9:	c3                   	ret
+
+00000000000008ea <pread>:
+SYSCALL(pread)
+ 8ea:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8ef:	cd 40                	int    $0x40
+ 8f1:	c3                   	ret
+
+00000000000008f2 <pwrite>:
+SYSCALL(pwrite)
+ 8f2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8f7:	cd 40                	int    $0x40
+ 8f9:	c3                   	ret
+
+00000000000008fa <readv>:
+SYSCALL(readv)
+ 8fa:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8ff:	cd 40                	int    $0x40
+ 901:	c3                   	ret
+
+0000000000000902 <writev>:
+SYSCALL(writev)
+ 902:	b8 22 00 00 00       	mov    $0x22,%eax
+ 907:	cd 40                	int    $0x40
+ 909:	c3                   	ret
+
+000000000000090a <poll>:
+SYSCALL(poll)
+ 90a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 90f:	cd 40                	int    $0x40
+ 911:	c3                   	ret
+
+0000000000000912 <pipe2>:
+SYSCALL(pipe2)
+ 912:	b8 24 00 00 00       	mov    $0x24,%eax
+ 917:	cd 40                	int    $0x40
+ 919:	c3                   	ret
+
+000000000000091a <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ 91a:	55                   	push   %rbp
+ 91b:	48 89 e5             	mov    %rsp,%rbp
+ 91e:	48 83 ec 20          	sub    $0x20,%rsp
+ 922:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 926:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 92a:	48 83 e8 10          	sub    $0x10,%rax
+ 92e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ 932:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 936:	48 8b 10             	mov    (%rax),%rdx
+ 939:	48 8d 05 00 06 00 00 	lea    0x600(%rip),%rax        # f40 <bigblock>
+ 940:	48 39 c2             	cmp    %rax,%rdx
+ 943:	75 1f                	jne    964 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ 945:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 949:	8b 40 08             	mov    0x8(%rax),%eax
+ 94c:	c1 e0 04             	shl    $0x4,%eax
+ 94f:	89 c2                	mov    %eax,%edx
+ 951:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 955:	89 d6                	mov    %edx,%esi
+ 957:	48 89 c7             	mov    %rax,%rdi
+ 95a:	e8 6b ff ff ff       	call   8ca <munmap2>
+    return;
+ 95f:	e9 0b 01 00 00       	jmp    a6f <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 964:	48 8b 05 c5 05 00 00 	mov    0x5c5(%rip),%rax        # f30 <freep>
+ 96b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 96f:	eb 2f                	jmp    9a0 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 971:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 975:	48 8b 00             	mov    (%rax),%rax
+ 978:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 97c:	72 17                	jb     995 <free+0x7b>
+ 97e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 982:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 986:	72 2f                	jb     9b7 <free+0x9d>
+ 988:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 98c:	48 8b 00             	mov    (%rax),%rax
+ 98f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 993:	72 22                	jb     9b7 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 995:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 999:	48 8b 00             	mov    (%rax),%rax
+ 99c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9a4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9a8:	73 c7                	jae    971 <free+0x57>
+ 9aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ae:	48 8b 00             	mov    (%rax),%rax
+ 9b1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9b5:	73 ba                	jae    971 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9bb:	8b 40 08             	mov    0x8(%rax),%eax
+ 9be:	89 c0                	mov    %eax,%eax
+ 9c0:	48 c1 e0 04          	shl    $0x4,%rax
+ 9c4:	48 89 c2             	mov    %rax,%rdx
+ 9c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9cb:	48 01 c2             	add    %rax,%rdx
+ 9ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d2:	48 8b 00             	mov    (%rax),%rax
+ 9d5:	48 39 c2             	cmp    %rax,%rdx
+ 9d8:	75 2d                	jne    a07 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ 9da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9de:	8b 50 08             	mov    0x8(%rax),%edx
+ 9e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9e5:	48 8b 00             	mov    (%rax),%rax
+ 9e8:	8b 40 08             	mov    0x8(%rax),%eax
+ 9eb:	01 c2                	add    %eax,%edx
+ 9ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f1:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9f8:	48 8b 00             	mov    (%rax),%rax
+ 9fb:	48 8b 10             	mov    (%rax),%rdx
+ 9fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a02:	48 89 10             	mov    %rdx,(%rax)
+ a05:	eb 0e                	jmp    a15 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a0b:	48 8b 10             	mov    (%rax),%rdx
+ a0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a12:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ a15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a19:	8b 40 08             	mov    0x8(%rax),%eax
+ a1c:	89 c0                	mov    %eax,%eax
+ a1e:	48 c1 e0 04          	shl    $0x4,%rax
+ a22:	48 89 c2             	mov    %rax,%rdx
+ a25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a29:	48 01 d0             	add    %rdx,%rax
+ a2c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a30:	75 27                	jne    a59 <free+0x13f>
+    p->s.size += bp->s.size;
+ a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a36:	8b 50 08             	mov    0x8(%rax),%edx
+ a39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a3d:	8b 40 08             	mov    0x8(%rax),%eax
+ a40:	01 c2                	add    %eax,%edx
+ a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a46:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a4d:	48 8b 10             	mov    (%rax),%rdx
+ a50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a54:	48 89 10             	mov    %rdx,(%rax)
+ a57:	eb 0b                	jmp    a64 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ a59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a61:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a68:	48 89 05 c1 04 00 00 	mov    %rax,0x4c1(%rip)        # f30 <freep>
+}
+ a6f:	c9                   	leave
+ a70:	c3                   	ret
+
+0000000000000a71 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a71:	55                   	push   %rbp
+ a72:	48 89 e5             	mov    %rsp,%rbp
+ a75:	48 83 ec 20          	sub    $0x20,%rsp
+ a79:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a7c:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a83:	77 07                	ja     a8c <morecore+0x1b>
+    nu = 4096;
+ a85:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ a8f:	c1 e0 04             	shl    $0x4,%eax
+ a92:	89 c7                	mov    %eax,%edi
+ a94:	e8 ea fd ff ff       	call   883 <sbrk>
+ a99:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ a9d:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ aa2:	75 07                	jne    aab <morecore+0x3a>
+    return 0;
+ aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+ aa9:	eb 29                	jmp    ad4 <morecore+0x63>
+  hp = (Header*)p;
+ aab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ aaf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ab7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ aba:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ abd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ac1:	48 83 c0 10          	add    $0x10,%rax
+ ac5:	48 89 c7             	mov    %rax,%rdi
+ ac8:	e8 4d fe ff ff       	call   91a <free>
+  return freep;
+ acd:	48 8b 05 5c 04 00 00 	mov    0x45c(%rip),%rax        # f30 <freep>
+}
+ ad4:	c9                   	leave
+ ad5:	c3                   	ret
+
+0000000000000ad6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ad6:	55                   	push   %rbp
+ ad7:	48 89 e5             	mov    %rsp,%rbp
+ ada:	48 83 ec 30          	sub    $0x30,%rsp
+ ade:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ae1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ ae4:	48 83 c0 0f          	add    $0xf,%rax
+ ae8:	48 c1 e8 04          	shr    $0x4,%rax
+ aec:	83 c0 01             	add    $0x1,%eax
+ aef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ af2:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ af9:	76 62                	jbe    b5d <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ afb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ afe:	c1 e0 04             	shl    $0x4,%eax
+ b01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ b07:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ b0d:	b9 22 00 00 00       	mov    $0x22,%ecx
+ b12:	ba 03 00 00 00       	mov    $0x3,%edx
+ b17:	89 c6                	mov    %eax,%esi
+ b19:	bf 00 00 00 00       	mov    $0x0,%edi
+ b1e:	e8 98 fd ff ff       	call   8bb <mmap2>
+ b23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ b27:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b2c:	75 0a                	jne    b38 <malloc+0x62>
+      return 0;
+ b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+ b33:	e9 1c 01 00 00       	jmp    c54 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ b38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b3c:	48 8d 15 fd 03 00 00 	lea    0x3fd(%rip),%rdx        # f40 <bigblock>
+ b43:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b4d:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b54:	48 83 c0 10          	add    $0x10,%rax
+ b58:	e9 f7 00 00 00       	jmp    c54 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ b5d:	48 8b 05 cc 03 00 00 	mov    0x3cc(%rip),%rax        # f30 <freep>
+ b64:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b68:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b6d:	75 2e                	jne    b9d <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ b6f:	48 8d 05 aa 03 00 00 	lea    0x3aa(%rip),%rax        # f20 <base>
+ b76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b7e:	48 89 05 ab 03 00 00 	mov    %rax,0x3ab(%rip)        # f30 <freep>
+ b85:	48 8b 05 a4 03 00 00 	mov    0x3a4(%rip),%rax        # f30 <freep>
+ b8c:	48 89 05 8d 03 00 00 	mov    %rax,0x38d(%rip)        # f20 <base>
+    base.s.size = 0;
+ b93:	c7 05 8b 03 00 00 00 	movl   $0x0,0x38b(%rip)        # f28 <base+0x8>
+ b9a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba1:	48 8b 00             	mov    (%rax),%rax
+ ba4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ ba8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bac:	8b 40 08             	mov    0x8(%rax),%eax
+ baf:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ bb2:	72 5f                	jb     c13 <malloc+0x13d>
+      if(p->s.size == nunits)
+ bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bb8:	8b 40 08             	mov    0x8(%rax),%eax
+ bbb:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ bbe:	75 10                	jne    bd0 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ bc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bc4:	48 8b 10             	mov    (%rax),%rdx
+ bc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bcb:	48 89 10             	mov    %rdx,(%rax)
+ bce:	eb 2e                	jmp    bfe <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ bd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd4:	8b 40 08             	mov    0x8(%rax),%eax
+ bd7:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ bda:	89 c2                	mov    %eax,%edx
+ bdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be0:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ be3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be7:	8b 40 08             	mov    0x8(%rax),%eax
+ bea:	89 c0                	mov    %eax,%eax
+ bec:	48 c1 e0 04          	shl    $0x4,%rax
+ bf0:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ bf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ bfb:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ bfe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c02:	48 89 05 27 03 00 00 	mov    %rax,0x327(%rip)        # f30 <freep>
+      return (void*)(p + 1);
+ c09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0d:	48 83 c0 10          	add    $0x10,%rax
+ c11:	eb 41                	jmp    c54 <malloc+0x17e>
+    }
+    if(p == freep)
+ c13:	48 8b 05 16 03 00 00 	mov    0x316(%rip),%rax        # f30 <freep>
+ c1a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c1e:	75 1c                	jne    c3c <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ c20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c23:	89 c7                	mov    %eax,%edi
+ c25:	e8 47 fe ff ff       	call   a71 <morecore>
+ c2a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c2e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ c33:	75 07                	jne    c3c <malloc+0x166>
+        return 0;
+ c35:	b8 00 00 00 00       	mov    $0x0,%eax
+ c3a:	eb 18                	jmp    c54 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c40:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c48:	48 8b 00             	mov    (%rax),%rax
+ c4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ c4f:	e9 54 ff ff ff       	jmp    ba8 <malloc+0xd2>
+  }
+}
+ c54:	c9                   	leave
+ c55:	c3                   	ret
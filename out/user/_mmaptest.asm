@@ -0,0 +1,3021 @@
+
+out/user/_mmaptest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <makefile>:
+char buf[PGSIZE];
+
+// Create a file of NPAGES pages, page i filled with 'a' + i % 26.
+void
+makefile(char *name)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int fd, i;
+
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+       c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      10:	be 02 02 00 00       	mov    $0x202,%esi
+      15:	48 89 c7             	mov    %rax,%rdi
+      18:	e8 09 1e 00 00       	call   1e26 <open>
+      1d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      20:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      24:	79 60                	jns    86 <makefile+0x86>
+    error("unable to create %s", name);
+      26:	8b 05 f4 28 00 00    	mov    0x28f4(%rip),%eax        # 2920 <stdout>
+      2c:	ba 1e 00 00 00       	mov    $0x1e,%edx
+      31:	48 8d 0d 10 22 00 00 	lea    0x2210(%rip),%rcx        # 2248 <malloc+0x187>
+      38:	48 89 ce             	mov    %rcx,%rsi
+      3b:	89 c7                	mov    %eax,%edi
+      3d:	b8 00 00 00 00       	mov    $0x0,%eax
+      42:	e8 f8 17 00 00       	call   183f <printf>
+      47:	8b 05 d3 28 00 00    	mov    0x28d3(%rip),%eax        # 2920 <stdout>
+      4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+      51:	48 8d 0d 02 22 00 00 	lea    0x2202(%rip),%rcx        # 225a <malloc+0x199>
+      58:	48 89 ce             	mov    %rcx,%rsi
+      5b:	89 c7                	mov    %eax,%edi
+      5d:	b8 00 00 00 00       	mov    $0x0,%eax
+      62:	e8 d8 17 00 00       	call   183f <printf>
+      67:	8b 05 b3 28 00 00    	mov    0x28b3(%rip),%eax        # 2920 <stdout>
+      6d:	48 8d 15 fa 21 00 00 	lea    0x21fa(%rip),%rdx        # 226e <malloc+0x1ad>
+      74:	48 89 d6             	mov    %rdx,%rsi
+      77:	89 c7                	mov    %eax,%edi
+      79:	b8 00 00 00 00       	mov    $0x0,%eax
+      7e:	e8 bc 17 00 00       	call   183f <printf>
+      83:	90                   	nop
+      84:	eb fd                	jmp    83 <makefile+0x83>
+  for(i = 0; i < NPAGES; i++){
+      86:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      8d:	e9 bf 00 00 00       	jmp    151 <makefile+0x151>
+    memset(buf, 'a' + i % 26, PGSIZE);
+      92:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      95:	48 63 d0             	movslq %eax,%rdx
+      98:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+      9f:	48 c1 ea 20          	shr    $0x20,%rdx
+      a3:	c1 fa 03             	sar    $0x3,%edx
+      a6:	89 c1                	mov    %eax,%ecx
+      a8:	c1 f9 1f             	sar    $0x1f,%ecx
+      ab:	29 ca                	sub    %ecx,%edx
+      ad:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+      b0:	29 c8                	sub    %ecx,%eax
+      b2:	89 c2                	mov    %eax,%edx
+      b4:	8d 42 61             	lea    0x61(%rdx),%eax
+      b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+      bc:	89 c6                	mov    %eax,%esi
+      be:	48 8d 05 fb 28 00 00 	lea    0x28fb(%rip),%rax        # 29c0 <buf>
+      c5:	48 89 c7             	mov    %rax,%rdi
+      c8:	e8 30 1b 00 00       	call   1bfd <memset>
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+      cd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+      d5:	48 8d 0d e4 28 00 00 	lea    0x28e4(%rip),%rcx        # 29c0 <buf>
+      dc:	48 89 ce             	mov    %rcx,%rsi
+      df:	89 c7                	mov    %eax,%edi
+      e1:	e8 20 1d 00 00       	call   1e06 <write>
+      e6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      eb:	74 60                	je     14d <makefile+0x14d>
+      error("unable to write page %d of %s", i, name);
+      ed:	8b 05 2d 28 00 00    	mov    0x282d(%rip),%eax        # 2920 <stdout>
+      f3:	ba 22 00 00 00       	mov    $0x22,%edx
+      f8:	48 8d 0d 49 21 00 00 	lea    0x2149(%rip),%rcx        # 2248 <malloc+0x187>
+      ff:	48 89 ce             	mov    %rcx,%rsi
+     102:	89 c7                	mov    %eax,%edi
+     104:	b8 00 00 00 00       	mov    $0x0,%eax
+     109:	e8 31 17 00 00       	call   183f <printf>
+     10e:	8b 05 0c 28 00 00    	mov    0x280c(%rip),%eax        # 2920 <stdout>
+     114:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     118:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     11b:	48 8d 35 4e 21 00 00 	lea    0x214e(%rip),%rsi        # 2270 <malloc+0x1af>
+     122:	89 c7                	mov    %eax,%edi
+     124:	b8 00 00 00 00       	mov    $0x0,%eax
+     129:	e8 11 17 00 00       	call   183f <printf>
+     12e:	8b 05 ec 27 00 00    	mov    0x27ec(%rip),%eax        # 2920 <stdout>
+     134:	48 8d 15 33 21 00 00 	lea    0x2133(%rip),%rdx        # 226e <malloc+0x1ad>
+     13b:	48 89 d6             	mov    %rdx,%rsi
+     13e:	89 c7                	mov    %eax,%edi
+     140:	b8 00 00 00 00       	mov    $0x0,%eax
+     145:	e8 f5 16 00 00       	call   183f <printf>
+     14a:	90                   	nop
+     14b:	eb fd                	jmp    14a <makefile+0x14a>
+  for(i = 0; i < NPAGES; i++){
+     14d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     151:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+     155:	0f 8e 37 ff ff ff    	jle    92 <makefile+0x92>
+  }
+  close(fd);
+     15b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     15e:	89 c7                	mov    %eax,%edi
+     160:	e8 a9 1c 00 00       	call   1e0e <close>
+}
+     165:	90                   	nop
+     166:	c9                   	leave
+     167:	c3                   	ret
+
+0000000000000168 <lazytest>:
+
+void
+lazytest(void)
+{
+     168:	55                   	push   %rbp
+     169:	48 89 e5             	mov    %rsp,%rbp
+     16c:	48 83 ec 40          	sub    $0x40,%rsp
+  struct sys_info info1, info2;
+  char *p;
+  int fd;
+
+  printf(stdout, "lazytest\n");
+     170:	8b 05 aa 27 00 00    	mov    0x27aa(%rip),%eax        # 2920 <stdout>
+     176:	48 8d 15 11 21 00 00 	lea    0x2111(%rip),%rdx        # 228e <malloc+0x1cd>
+     17d:	48 89 d6             	mov    %rdx,%rsi
+     180:	89 c7                	mov    %eax,%edi
+     182:	b8 00 00 00 00       	mov    $0x0,%eax
+     187:	e8 b3 16 00 00       	call   183f <printf>
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+     18c:	be 00 00 00 00       	mov    $0x0,%esi
+     191:	48 8d 05 00 21 00 00 	lea    0x2100(%rip),%rax        # 2298 <malloc+0x1d7>
+     198:	48 89 c7             	mov    %rax,%rdi
+     19b:	e8 86 1c 00 00       	call   1e26 <open>
+     1a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     1a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     1a7:	79 5c                	jns    205 <lazytest+0x9d>
+    error("unable to open mmap1.txt");
+     1a9:	8b 05 71 27 00 00    	mov    0x2771(%rip),%eax        # 2920 <stdout>
+     1af:	ba 30 00 00 00       	mov    $0x30,%edx
+     1b4:	48 8d 0d 8d 20 00 00 	lea    0x208d(%rip),%rcx        # 2248 <malloc+0x187>
+     1bb:	48 89 ce             	mov    %rcx,%rsi
+     1be:	89 c7                	mov    %eax,%edi
+     1c0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c5:	e8 75 16 00 00       	call   183f <printf>
+     1ca:	8b 05 50 27 00 00    	mov    0x2750(%rip),%eax        # 2920 <stdout>
+     1d0:	48 8d 15 cb 20 00 00 	lea    0x20cb(%rip),%rdx        # 22a2 <malloc+0x1e1>
+     1d7:	48 89 d6             	mov    %rdx,%rsi
+     1da:	89 c7                	mov    %eax,%edi
+     1dc:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e1:	e8 59 16 00 00       	call   183f <printf>
+     1e6:	8b 05 34 27 00 00    	mov    0x2734(%rip),%eax        # 2920 <stdout>
+     1ec:	48 8d 15 7b 20 00 00 	lea    0x207b(%rip),%rdx        # 226e <malloc+0x1ad>
+     1f3:	48 89 d6             	mov    %rdx,%rsi
+     1f6:	89 c7                	mov    %eax,%edi
+     1f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1fd:	e8 3d 16 00 00       	call   183f <printf>
+     202:	90                   	nop
+     203:	eb fd                	jmp    202 <lazytest+0x9a>
+
+  sysinfo(&info1);
+     205:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     209:	48 89 c7             	mov    %rax,%rdi
+     20c:	e8 75 1c 00 00       	call   1e86 <sysinfo>
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+     211:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     21a:	41 89 c0             	mov    %eax,%r8d
+     21d:	b9 02 00 00 00       	mov    $0x2,%ecx
+     222:	ba 01 00 00 00       	mov    $0x1,%edx
+     227:	be 00 00 04 00       	mov    $0x40000,%esi
+     22c:	bf 00 00 00 00       	mov    $0x0,%edi
+     231:	e8 70 1c 00 00       	call   1ea6 <mmap2>
+     236:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(p == MAP_FAILED)
+     23a:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     23f:	75 5c                	jne    29d <lazytest+0x135>
+    error("mmap2 failed");
+     241:	8b 05 d9 26 00 00    	mov    0x26d9(%rip),%eax        # 2920 <stdout>
+     247:	ba 35 00 00 00       	mov    $0x35,%edx
+     24c:	48 8d 0d f5 1f 00 00 	lea    0x1ff5(%rip),%rcx        # 2248 <malloc+0x187>
+     253:	48 89 ce             	mov    %rcx,%rsi
+     256:	89 c7                	mov    %eax,%edi
+     258:	b8 00 00 00 00       	mov    $0x0,%eax
+     25d:	e8 dd 15 00 00       	call   183f <printf>
+     262:	8b 05 b8 26 00 00    	mov    0x26b8(%rip),%eax        # 2920 <stdout>
+     268:	48 8d 15 4c 20 00 00 	lea    0x204c(%rip),%rdx        # 22bb <malloc+0x1fa>
+     26f:	48 89 d6             	mov    %rdx,%rsi
+     272:	89 c7                	mov    %eax,%edi
+     274:	b8 00 00 00 00       	mov    $0x0,%eax
+     279:	e8 c1 15 00 00       	call   183f <printf>
+     27e:	8b 05 9c 26 00 00    	mov    0x269c(%rip),%eax        # 2920 <stdout>
+     284:	48 8d 15 e3 1f 00 00 	lea    0x1fe3(%rip),%rdx        # 226e <malloc+0x1ad>
+     28b:	48 89 d6             	mov    %rdx,%rsi
+     28e:	89 c7                	mov    %eax,%edi
+     290:	b8 00 00 00 00       	mov    $0x0,%eax
+     295:	e8 a5 15 00 00       	call   183f <printf>
+     29a:	90                   	nop
+     29b:	eb fd                	jmp    29a <lazytest+0x132>
+  sysinfo(&info2);
+     29d:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+     2a1:	48 89 c7             	mov    %rax,%rdi
+     2a4:	e8 dd 1b 00 00       	call   1e86 <sysinfo>
+  if(info2.pages_in_use - info1.pages_in_use > 1)
+     2a9:	8b 55 c8             	mov    -0x38(%rbp),%edx
+     2ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2af:	29 c2                	sub    %eax,%edx
+     2b1:	83 fa 01             	cmp    $0x1,%edx
+     2b4:	7e 64                	jle    31a <lazytest+0x1b2>
+    error("mapping took %d pages before any was touched",
+     2b6:	8b 05 64 26 00 00    	mov    0x2664(%rip),%eax        # 2920 <stdout>
+     2bc:	ba 38 00 00 00       	mov    $0x38,%edx
+     2c1:	48 8d 0d 80 1f 00 00 	lea    0x1f80(%rip),%rcx        # 2248 <malloc+0x187>
+     2c8:	48 89 ce             	mov    %rcx,%rsi
+     2cb:	89 c7                	mov    %eax,%edi
+     2cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     2d2:	e8 68 15 00 00       	call   183f <printf>
+     2d7:	8b 55 c8             	mov    -0x38(%rbp),%edx
+     2da:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     2dd:	29 c2                	sub    %eax,%edx
+     2df:	8b 05 3b 26 00 00    	mov    0x263b(%rip),%eax        # 2920 <stdout>
+     2e5:	48 8d 0d dc 1f 00 00 	lea    0x1fdc(%rip),%rcx        # 22c8 <malloc+0x207>
+     2ec:	48 89 ce             	mov    %rcx,%rsi
+     2ef:	89 c7                	mov    %eax,%edi
+     2f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f6:	e8 44 15 00 00       	call   183f <printf>
+     2fb:	8b 05 1f 26 00 00    	mov    0x261f(%rip),%eax        # 2920 <stdout>
+     301:	48 8d 15 66 1f 00 00 	lea    0x1f66(%rip),%rdx        # 226e <malloc+0x1ad>
+     308:	48 89 d6             	mov    %rdx,%rsi
+     30b:	89 c7                	mov    %eax,%edi
+     30d:	b8 00 00 00 00       	mov    $0x0,%eax
+     312:	e8 28 15 00 00       	call   183f <printf>
+     317:	90                   	nop
+     318:	eb fd                	jmp    317 <lazytest+0x1af>
+          info2.pages_in_use - info1.pages_in_use);
+
+  if(p[0] != 'a' || p[5 * PGSIZE + 7] != 'f' || p[NPAGES * PGSIZE - 1] != 'a' + (NPAGES - 1) % 26)
+     31a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     31e:	0f b6 00             	movzbl (%rax),%eax
+     321:	3c 61                	cmp    $0x61,%al
+     323:	75 22                	jne    347 <lazytest+0x1df>
+     325:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     329:	48 05 07 50 00 00    	add    $0x5007,%rax
+     32f:	0f b6 00             	movzbl (%rax),%eax
+     332:	3c 66                	cmp    $0x66,%al
+     334:	75 11                	jne    347 <lazytest+0x1df>
+     336:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     33a:	48 05 ff ff 03 00    	add    $0x3ffff,%rax
+     340:	0f b6 00             	movzbl (%rax),%eax
+     343:	3c 6c                	cmp    $0x6c,%al
+     345:	74 5c                	je     3a3 <lazytest+0x23b>
+    error("mapping does not match the file");
+     347:	8b 05 d3 25 00 00    	mov    0x25d3(%rip),%eax        # 2920 <stdout>
+     34d:	ba 3c 00 00 00       	mov    $0x3c,%edx
+     352:	48 8d 0d ef 1e 00 00 	lea    0x1eef(%rip),%rcx        # 2248 <malloc+0x187>
+     359:	48 89 ce             	mov    %rcx,%rsi
+     35c:	89 c7                	mov    %eax,%edi
+     35e:	b8 00 00 00 00       	mov    $0x0,%eax
+     363:	e8 d7 14 00 00       	call   183f <printf>
+     368:	8b 05 b2 25 00 00    	mov    0x25b2(%rip),%eax        # 2920 <stdout>
+     36e:	48 8d 15 83 1f 00 00 	lea    0x1f83(%rip),%rdx        # 22f8 <malloc+0x237>
+     375:	48 89 d6             	mov    %rdx,%rsi
+     378:	89 c7                	mov    %eax,%edi
+     37a:	b8 00 00 00 00       	mov    $0x0,%eax
+     37f:	e8 bb 14 00 00       	call   183f <printf>
+     384:	8b 05 96 25 00 00    	mov    0x2596(%rip),%eax        # 2920 <stdout>
+     38a:	48 8d 15 dd 1e 00 00 	lea    0x1edd(%rip),%rdx        # 226e <malloc+0x1ad>
+     391:	48 89 d6             	mov    %rdx,%rsi
+     394:	89 c7                	mov    %eax,%edi
+     396:	b8 00 00 00 00       	mov    $0x0,%eax
+     39b:	e8 9f 14 00 00       	call   183f <printf>
+     3a0:	90                   	nop
+     3a1:	eb fd                	jmp    3a0 <lazytest+0x238>
+  if(munmap2(p, NPAGES * PGSIZE) < 0)
+     3a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3a7:	be 00 00 04 00       	mov    $0x40000,%esi
+     3ac:	48 89 c7             	mov    %rax,%rdi
+     3af:	e8 01 1b 00 00       	call   1eb5 <munmap2>
+     3b4:	85 c0                	test   %eax,%eax
+     3b6:	79 5c                	jns    414 <lazytest+0x2ac>
+    error("munmap2 failed");
+     3b8:	8b 05 62 25 00 00    	mov    0x2562(%rip),%eax        # 2920 <stdout>
+     3be:	ba 3e 00 00 00       	mov    $0x3e,%edx
+     3c3:	48 8d 0d 7e 1e 00 00 	lea    0x1e7e(%rip),%rcx        # 2248 <malloc+0x187>
+     3ca:	48 89 ce             	mov    %rcx,%rsi
+     3cd:	89 c7                	mov    %eax,%edi
+     3cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     3d4:	e8 66 14 00 00       	call   183f <printf>
+     3d9:	8b 05 41 25 00 00    	mov    0x2541(%rip),%eax        # 2920 <stdout>
+     3df:	48 8d 15 32 1f 00 00 	lea    0x1f32(%rip),%rdx        # 2318 <malloc+0x257>
+     3e6:	48 89 d6             	mov    %rdx,%rsi
+     3e9:	89 c7                	mov    %eax,%edi
+     3eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f0:	e8 4a 14 00 00       	call   183f <printf>
+     3f5:	8b 05 25 25 00 00    	mov    0x2525(%rip),%eax        # 2920 <stdout>
+     3fb:	48 8d 15 6c 1e 00 00 	lea    0x1e6c(%rip),%rdx        # 226e <malloc+0x1ad>
+     402:	48 89 d6             	mov    %rdx,%rsi
+     405:	89 c7                	mov    %eax,%edi
+     407:	b8 00 00 00 00       	mov    $0x0,%eax
+     40c:	e8 2e 14 00 00       	call   183f <printf>
+     411:	90                   	nop
+     412:	eb fd                	jmp    411 <lazytest+0x2a9>
+  close(fd);
+     414:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     417:	89 c7                	mov    %eax,%edi
+     419:	e8 f0 19 00 00       	call   1e0e <close>
+  printf(stdout, "lazytest OK\n");
+     41e:	8b 05 fc 24 00 00    	mov    0x24fc(%rip),%eax        # 2920 <stdout>
+     424:	48 8d 15 fc 1e 00 00 	lea    0x1efc(%rip),%rdx        # 2327 <malloc+0x266>
+     42b:	48 89 d6             	mov    %rdx,%rsi
+     42e:	89 c7                	mov    %eax,%edi
+     430:	b8 00 00 00 00       	mov    $0x0,%eax
+     435:	e8 05 14 00 00       	call   183f <printf>
+}
+     43a:	90                   	nop
+     43b:	c9                   	leave
+     43c:	c3                   	ret
+
+000000000000043d <sharedtest>:
+
+void
+sharedtest(void)
+{
+     43d:	55                   	push   %rbp
+     43e:	48 89 e5             	mov    %rsp,%rbp
+     441:	48 83 ec 20          	sub    $0x20,%rsp
+  char *p, *q;
+  int fd, pid;
+
+  printf(stdout, "sharedtest\n");
+     445:	8b 05 d5 24 00 00    	mov    0x24d5(%rip),%eax        # 2920 <stdout>
+     44b:	48 8d 15 e2 1e 00 00 	lea    0x1ee2(%rip),%rdx        # 2334 <malloc+0x273>
+     452:	48 89 d6             	mov    %rdx,%rsi
+     455:	89 c7                	mov    %eax,%edi
+     457:	b8 00 00 00 00       	mov    $0x0,%eax
+     45c:	e8 de 13 00 00       	call   183f <printf>
+  if((fd = open("mmap1.txt", O_RDWR)) < 0)
+     461:	be 02 00 00 00       	mov    $0x2,%esi
+     466:	48 8d 05 2b 1e 00 00 	lea    0x1e2b(%rip),%rax        # 2298 <malloc+0x1d7>
+     46d:	48 89 c7             	mov    %rax,%rdi
+     470:	e8 b1 19 00 00       	call   1e26 <open>
+     475:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     478:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     47c:	79 5c                	jns    4da <sharedtest+0x9d>
+    error("unable to open mmap1.txt");
+     47e:	8b 05 9c 24 00 00    	mov    0x249c(%rip),%eax        # 2920 <stdout>
+     484:	ba 4b 00 00 00       	mov    $0x4b,%edx
+     489:	48 8d 0d b8 1d 00 00 	lea    0x1db8(%rip),%rcx        # 2248 <malloc+0x187>
+     490:	48 89 ce             	mov    %rcx,%rsi
+     493:	89 c7                	mov    %eax,%edi
+     495:	b8 00 00 00 00       	mov    $0x0,%eax
+     49a:	e8 a0 13 00 00       	call   183f <printf>
+     49f:	8b 05 7b 24 00 00    	mov    0x247b(%rip),%eax        # 2920 <stdout>
+     4a5:	48 8d 15 f6 1d 00 00 	lea    0x1df6(%rip),%rdx        # 22a2 <malloc+0x1e1>
+     4ac:	48 89 d6             	mov    %rdx,%rsi
+     4af:	89 c7                	mov    %eax,%edi
+     4b1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b6:	e8 84 13 00 00       	call   183f <printf>
+     4bb:	8b 05 5f 24 00 00    	mov    0x245f(%rip),%eax        # 2920 <stdout>
+     4c1:	48 8d 15 a6 1d 00 00 	lea    0x1da6(%rip),%rdx        # 226e <malloc+0x1ad>
+     4c8:	48 89 d6             	mov    %rdx,%rsi
+     4cb:	89 c7                	mov    %eax,%edi
+     4cd:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d2:	e8 68 13 00 00       	call   183f <printf>
+     4d7:	90                   	nop
+     4d8:	eb fd                	jmp    4d7 <sharedtest+0x9a>
+
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+     4da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     4dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     4e3:	41 89 c0             	mov    %eax,%r8d
+     4e6:	b9 01 00 00 00       	mov    $0x1,%ecx
+     4eb:	ba 03 00 00 00       	mov    $0x3,%edx
+     4f0:	be 00 00 04 00       	mov    $0x40000,%esi
+     4f5:	bf 00 00 00 00       	mov    $0x0,%edi
+     4fa:	e8 a7 19 00 00       	call   1ea6 <mmap2>
+     4ff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  q = mmap2(0, PGSIZE, PROT_READ, MAP_SHARED, fd, 2 * PGSIZE);
+     503:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     506:	41 b9 00 20 00 00    	mov    $0x2000,%r9d
+     50c:	41 89 c0             	mov    %eax,%r8d
+     50f:	b9 01 00 00 00       	mov    $0x1,%ecx
+     514:	ba 01 00 00 00       	mov    $0x1,%edx
+     519:	be 00 10 00 00       	mov    $0x1000,%esi
+     51e:	bf 00 00 00 00       	mov    $0x0,%edi
+     523:	e8 7e 19 00 00       	call   1ea6 <mmap2>
+     528:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if(p == MAP_FAILED || q == MAP_FAILED || p == q)
+     52c:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     531:	74 11                	je     544 <sharedtest+0x107>
+     533:	48 83 7d e8 ff       	cmpq   $0xffffffffffffffff,-0x18(%rbp)
+     538:	74 0a                	je     544 <sharedtest+0x107>
+     53a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     53e:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+     542:	75 5c                	jne    5a0 <sharedtest+0x163>
+    error("mmap2 failed");
+     544:	8b 05 d6 23 00 00    	mov    0x23d6(%rip),%eax        # 2920 <stdout>
+     54a:	ba 50 00 00 00       	mov    $0x50,%edx
+     54f:	48 8d 0d f2 1c 00 00 	lea    0x1cf2(%rip),%rcx        # 2248 <malloc+0x187>
+     556:	48 89 ce             	mov    %rcx,%rsi
+     559:	89 c7                	mov    %eax,%edi
+     55b:	b8 00 00 00 00       	mov    $0x0,%eax
+     560:	e8 da 12 00 00       	call   183f <printf>
+     565:	8b 05 b5 23 00 00    	mov    0x23b5(%rip),%eax        # 2920 <stdout>
+     56b:	48 8d 15 49 1d 00 00 	lea    0x1d49(%rip),%rdx        # 22bb <malloc+0x1fa>
+     572:	48 89 d6             	mov    %rdx,%rsi
+     575:	89 c7                	mov    %eax,%edi
+     577:	b8 00 00 00 00       	mov    $0x0,%eax
+     57c:	e8 be 12 00 00       	call   183f <printf>
+     581:	8b 05 99 23 00 00    	mov    0x2399(%rip),%eax        # 2920 <stdout>
+     587:	48 8d 15 e0 1c 00 00 	lea    0x1ce0(%rip),%rdx        # 226e <malloc+0x1ad>
+     58e:	48 89 d6             	mov    %rdx,%rsi
+     591:	89 c7                	mov    %eax,%edi
+     593:	b8 00 00 00 00       	mov    $0x0,%eax
+     598:	e8 a2 12 00 00       	call   183f <printf>
+     59d:	90                   	nop
+     59e:	eb fd                	jmp    59d <sharedtest+0x160>
+
+  // a child writes through its copy of the mapping
+  pid = fork();
+     5a0:	e8 39 18 00 00       	call   1dde <fork>
+     5a5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if(pid < 0)
+     5a8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     5ac:	79 5c                	jns    60a <sharedtest+0x1cd>
+    error("fork failed");
+     5ae:	8b 05 6c 23 00 00    	mov    0x236c(%rip),%eax        # 2920 <stdout>
+     5b4:	ba 55 00 00 00       	mov    $0x55,%edx
+     5b9:	48 8d 0d 88 1c 00 00 	lea    0x1c88(%rip),%rcx        # 2248 <malloc+0x187>
+     5c0:	48 89 ce             	mov    %rcx,%rsi
+     5c3:	89 c7                	mov    %eax,%edi
+     5c5:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ca:	e8 70 12 00 00       	call   183f <printf>
+     5cf:	8b 05 4b 23 00 00    	mov    0x234b(%rip),%eax        # 2920 <stdout>
+     5d5:	48 8d 15 64 1d 00 00 	lea    0x1d64(%rip),%rdx        # 2340 <malloc+0x27f>
+     5dc:	48 89 d6             	mov    %rdx,%rsi
+     5df:	89 c7                	mov    %eax,%edi
+     5e1:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e6:	e8 54 12 00 00       	call   183f <printf>
+     5eb:	8b 05 2f 23 00 00    	mov    0x232f(%rip),%eax        # 2920 <stdout>
+     5f1:	48 8d 15 76 1c 00 00 	lea    0x1c76(%rip),%rdx        # 226e <malloc+0x1ad>
+     5f8:	48 89 d6             	mov    %rdx,%rsi
+     5fb:	89 c7                	mov    %eax,%edi
+     5fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     602:	e8 38 12 00 00       	call   183f <printf>
+     607:	90                   	nop
+     608:	eb fd                	jmp    607 <sharedtest+0x1ca>
+  if(pid == 0){
+     60a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     60e:	75 12                	jne    622 <sharedtest+0x1e5>
+    p[2 * PGSIZE] = 'X';
+     610:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     614:	48 05 00 20 00 00    	add    $0x2000,%rax
+     61a:	c6 00 58             	movb   $0x58,(%rax)
+    exit();
+     61d:	e8 c4 17 00 00       	call   1de6 <exit>
+  }
+  wait();
+     622:	e8 c7 17 00 00       	call   1dee <wait>
+
+  // both mappings and read() see the change
+  if(p[2 * PGSIZE] != 'X' || q[0] != 'X')
+     627:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     62b:	48 05 00 20 00 00    	add    $0x2000,%rax
+     631:	0f b6 00             	movzbl (%rax),%eax
+     634:	3c 58                	cmp    $0x58,%al
+     636:	75 0b                	jne    643 <sharedtest+0x206>
+     638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     63c:	0f b6 00             	movzbl (%rax),%eax
+     63f:	3c 58                	cmp    $0x58,%al
+     641:	74 5c                	je     69f <sharedtest+0x262>
+    error("change made in the child is not shared");
+     643:	8b 05 d7 22 00 00    	mov    0x22d7(%rip),%eax        # 2920 <stdout>
+     649:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     64e:	48 8d 0d f3 1b 00 00 	lea    0x1bf3(%rip),%rcx        # 2248 <malloc+0x187>
+     655:	48 89 ce             	mov    %rcx,%rsi
+     658:	89 c7                	mov    %eax,%edi
+     65a:	b8 00 00 00 00       	mov    $0x0,%eax
+     65f:	e8 db 11 00 00       	call   183f <printf>
+     664:	8b 05 b6 22 00 00    	mov    0x22b6(%rip),%eax        # 2920 <stdout>
+     66a:	48 8d 15 df 1c 00 00 	lea    0x1cdf(%rip),%rdx        # 2350 <malloc+0x28f>
+     671:	48 89 d6             	mov    %rdx,%rsi
+     674:	89 c7                	mov    %eax,%edi
+     676:	b8 00 00 00 00       	mov    $0x0,%eax
+     67b:	e8 bf 11 00 00       	call   183f <printf>
+     680:	8b 05 9a 22 00 00    	mov    0x229a(%rip),%eax        # 2920 <stdout>
+     686:	48 8d 15 e1 1b 00 00 	lea    0x1be1(%rip),%rdx        # 226e <malloc+0x1ad>
+     68d:	48 89 d6             	mov    %rdx,%rsi
+     690:	89 c7                	mov    %eax,%edi
+     692:	b8 00 00 00 00       	mov    $0x0,%eax
+     697:	e8 a3 11 00 00       	call   183f <printf>
+     69c:	90                   	nop
+     69d:	eb fd                	jmp    69c <sharedtest+0x25f>
+  if(msync(p, NPAGES * PGSIZE) < 0)
+     69f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     6a3:	be 00 00 04 00       	mov    $0x40000,%esi
+     6a8:	48 89 c7             	mov    %rax,%rdi
+     6ab:	e8 0d 18 00 00       	call   1ebd <msync>
+     6b0:	85 c0                	test   %eax,%eax
+     6b2:	79 5c                	jns    710 <sharedtest+0x2d3>
+    error("msync failed");
+     6b4:	8b 05 66 22 00 00    	mov    0x2266(%rip),%eax        # 2920 <stdout>
+     6ba:	ba 60 00 00 00       	mov    $0x60,%edx
+     6bf:	48 8d 0d 82 1b 00 00 	lea    0x1b82(%rip),%rcx        # 2248 <malloc+0x187>
+     6c6:	48 89 ce             	mov    %rcx,%rsi
+     6c9:	89 c7                	mov    %eax,%edi
+     6cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d0:	e8 6a 11 00 00       	call   183f <printf>
+     6d5:	8b 05 45 22 00 00    	mov    0x2245(%rip),%eax        # 2920 <stdout>
+     6db:	48 8d 15 95 1c 00 00 	lea    0x1c95(%rip),%rdx        # 2377 <malloc+0x2b6>
+     6e2:	48 89 d6             	mov    %rdx,%rsi
+     6e5:	89 c7                	mov    %eax,%edi
+     6e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ec:	e8 4e 11 00 00       	call   183f <printf>
+     6f1:	8b 05 29 22 00 00    	mov    0x2229(%rip),%eax        # 2920 <stdout>
+     6f7:	48 8d 15 70 1b 00 00 	lea    0x1b70(%rip),%rdx        # 226e <malloc+0x1ad>
+     6fe:	48 89 d6             	mov    %rdx,%rsi
+     701:	89 c7                	mov    %eax,%edi
+     703:	b8 00 00 00 00       	mov    $0x0,%eax
+     708:	e8 32 11 00 00       	call   183f <printf>
+     70d:	90                   	nop
+     70e:	eb fd                	jmp    70d <sharedtest+0x2d0>
+  if(munmap2(p, NPAGES * PGSIZE) < 0 || munmap2(q, PGSIZE) < 0)
+     710:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     714:	be 00 00 04 00       	mov    $0x40000,%esi
+     719:	48 89 c7             	mov    %rax,%rdi
+     71c:	e8 94 17 00 00       	call   1eb5 <munmap2>
+     721:	85 c0                	test   %eax,%eax
+     723:	78 15                	js     73a <sharedtest+0x2fd>
+     725:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     729:	be 00 10 00 00       	mov    $0x1000,%esi
+     72e:	48 89 c7             	mov    %rax,%rdi
+     731:	e8 7f 17 00 00       	call   1eb5 <munmap2>
+     736:	85 c0                	test   %eax,%eax
+     738:	79 5c                	jns    796 <sharedtest+0x359>
+    error("munmap2 failed");
+     73a:	8b 05 e0 21 00 00    	mov    0x21e0(%rip),%eax        # 2920 <stdout>
+     740:	ba 62 00 00 00       	mov    $0x62,%edx
+     745:	48 8d 0d fc 1a 00 00 	lea    0x1afc(%rip),%rcx        # 2248 <malloc+0x187>
+     74c:	48 89 ce             	mov    %rcx,%rsi
+     74f:	89 c7                	mov    %eax,%edi
+     751:	b8 00 00 00 00       	mov    $0x0,%eax
+     756:	e8 e4 10 00 00       	call   183f <printf>
+     75b:	8b 05 bf 21 00 00    	mov    0x21bf(%rip),%eax        # 2920 <stdout>
+     761:	48 8d 15 b0 1b 00 00 	lea    0x1bb0(%rip),%rdx        # 2318 <malloc+0x257>
+     768:	48 89 d6             	mov    %rdx,%rsi
+     76b:	89 c7                	mov    %eax,%edi
+     76d:	b8 00 00 00 00       	mov    $0x0,%eax
+     772:	e8 c8 10 00 00       	call   183f <printf>
+     777:	8b 05 a3 21 00 00    	mov    0x21a3(%rip),%eax        # 2920 <stdout>
+     77d:	48 8d 15 ea 1a 00 00 	lea    0x1aea(%rip),%rdx        # 226e <malloc+0x1ad>
+     784:	48 89 d6             	mov    %rdx,%rsi
+     787:	89 c7                	mov    %eax,%edi
+     789:	b8 00 00 00 00       	mov    $0x0,%eax
+     78e:	e8 ac 10 00 00       	call   183f <printf>
+     793:	90                   	nop
+     794:	eb fd                	jmp    793 <sharedtest+0x356>
+  close(fd);
+     796:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     799:	89 c7                	mov    %eax,%edi
+     79b:	e8 6e 16 00 00       	call   1e0e <close>
+
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+     7a0:	be 00 00 00 00       	mov    $0x0,%esi
+     7a5:	48 8d 05 ec 1a 00 00 	lea    0x1aec(%rip),%rax        # 2298 <malloc+0x1d7>
+     7ac:	48 89 c7             	mov    %rax,%rdi
+     7af:	e8 72 16 00 00       	call   1e26 <open>
+     7b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     7b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     7bb:	79 5c                	jns    819 <sharedtest+0x3dc>
+    error("unable to open mmap1.txt");
+     7bd:	8b 05 5d 21 00 00    	mov    0x215d(%rip),%eax        # 2920 <stdout>
+     7c3:	ba 66 00 00 00       	mov    $0x66,%edx
+     7c8:	48 8d 0d 79 1a 00 00 	lea    0x1a79(%rip),%rcx        # 2248 <malloc+0x187>
+     7cf:	48 89 ce             	mov    %rcx,%rsi
+     7d2:	89 c7                	mov    %eax,%edi
+     7d4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7d9:	e8 61 10 00 00       	call   183f <printf>
+     7de:	8b 05 3c 21 00 00    	mov    0x213c(%rip),%eax        # 2920 <stdout>
+     7e4:	48 8d 15 b7 1a 00 00 	lea    0x1ab7(%rip),%rdx        # 22a2 <malloc+0x1e1>
+     7eb:	48 89 d6             	mov    %rdx,%rsi
+     7ee:	89 c7                	mov    %eax,%edi
+     7f0:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f5:	e8 45 10 00 00       	call   183f <printf>
+     7fa:	8b 05 20 21 00 00    	mov    0x2120(%rip),%eax        # 2920 <stdout>
+     800:	48 8d 15 67 1a 00 00 	lea    0x1a67(%rip),%rdx        # 226e <malloc+0x1ad>
+     807:	48 89 d6             	mov    %rdx,%rsi
+     80a:	89 c7                	mov    %eax,%edi
+     80c:	b8 00 00 00 00       	mov    $0x0,%eax
+     811:	e8 29 10 00 00       	call   183f <printf>
+     816:	90                   	nop
+     817:	eb fd                	jmp    816 <sharedtest+0x3d9>
+  if(read(fd, buf, PGSIZE) != PGSIZE || read(fd, buf, PGSIZE) != PGSIZE ||
+     819:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     81c:	ba 00 10 00 00       	mov    $0x1000,%edx
+     821:	48 8d 0d 98 21 00 00 	lea    0x2198(%rip),%rcx        # 29c0 <buf>
+     828:	48 89 ce             	mov    %rcx,%rsi
+     82b:	89 c7                	mov    %eax,%edi
+     82d:	e8 cc 15 00 00       	call   1dfe <read>
+     832:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     837:	75 40                	jne    879 <sharedtest+0x43c>
+     839:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     83c:	ba 00 10 00 00       	mov    $0x1000,%edx
+     841:	48 8d 0d 78 21 00 00 	lea    0x2178(%rip),%rcx        # 29c0 <buf>
+     848:	48 89 ce             	mov    %rcx,%rsi
+     84b:	89 c7                	mov    %eax,%edi
+     84d:	e8 ac 15 00 00       	call   1dfe <read>
+     852:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     857:	75 20                	jne    879 <sharedtest+0x43c>
+     read(fd, buf, PGSIZE) != PGSIZE)
+     859:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     85c:	ba 00 10 00 00       	mov    $0x1000,%edx
+     861:	48 8d 0d 58 21 00 00 	lea    0x2158(%rip),%rcx        # 29c0 <buf>
+     868:	48 89 ce             	mov    %rcx,%rsi
+     86b:	89 c7                	mov    %eax,%edi
+     86d:	e8 8c 15 00 00       	call   1dfe <read>
+  if(read(fd, buf, PGSIZE) != PGSIZE || read(fd, buf, PGSIZE) != PGSIZE ||
+     872:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     877:	74 5c                	je     8d5 <sharedtest+0x498>
+    error("unable to read mmap1.txt");
+     879:	8b 05 a1 20 00 00    	mov    0x20a1(%rip),%eax        # 2920 <stdout>
+     87f:	ba 69 00 00 00       	mov    $0x69,%edx
+     884:	48 8d 0d bd 19 00 00 	lea    0x19bd(%rip),%rcx        # 2248 <malloc+0x187>
+     88b:	48 89 ce             	mov    %rcx,%rsi
+     88e:	89 c7                	mov    %eax,%edi
+     890:	b8 00 00 00 00       	mov    $0x0,%eax
+     895:	e8 a5 0f 00 00       	call   183f <printf>
+     89a:	8b 05 80 20 00 00    	mov    0x2080(%rip),%eax        # 2920 <stdout>
+     8a0:	48 8d 15 dd 1a 00 00 	lea    0x1add(%rip),%rdx        # 2384 <malloc+0x2c3>
+     8a7:	48 89 d6             	mov    %rdx,%rsi
+     8aa:	89 c7                	mov    %eax,%edi
+     8ac:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b1:	e8 89 0f 00 00       	call   183f <printf>
+     8b6:	8b 05 64 20 00 00    	mov    0x2064(%rip),%eax        # 2920 <stdout>
+     8bc:	48 8d 15 ab 19 00 00 	lea    0x19ab(%rip),%rdx        # 226e <malloc+0x1ad>
+     8c3:	48 89 d6             	mov    %rdx,%rsi
+     8c6:	89 c7                	mov    %eax,%edi
+     8c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8cd:	e8 6d 0f 00 00       	call   183f <printf>
+     8d2:	90                   	nop
+     8d3:	eb fd                	jmp    8d2 <sharedtest+0x495>
+  if(buf[0] != 'X' || buf[1] != 'c')
+     8d5:	0f b6 05 e4 20 00 00 	movzbl 0x20e4(%rip),%eax        # 29c0 <buf>
+     8dc:	3c 58                	cmp    $0x58,%al
+     8de:	75 0b                	jne    8eb <sharedtest+0x4ae>
+     8e0:	0f b6 05 da 20 00 00 	movzbl 0x20da(%rip),%eax        # 29c1 <buf+0x1>
+     8e7:	3c 63                	cmp    $0x63,%al
+     8e9:	74 6d                	je     958 <sharedtest+0x51b>
+    error("change was not written back, got %c%c", buf[0], buf[1]);
+     8eb:	8b 05 2f 20 00 00    	mov    0x202f(%rip),%eax        # 2920 <stdout>
+     8f1:	ba 6b 00 00 00       	mov    $0x6b,%edx
+     8f6:	48 8d 0d 4b 19 00 00 	lea    0x194b(%rip),%rcx        # 2248 <malloc+0x187>
+     8fd:	48 89 ce             	mov    %rcx,%rsi
+     900:	89 c7                	mov    %eax,%edi
+     902:	b8 00 00 00 00       	mov    $0x0,%eax
+     907:	e8 33 0f 00 00       	call   183f <printf>
+     90c:	0f b6 05 ae 20 00 00 	movzbl 0x20ae(%rip),%eax        # 29c1 <buf+0x1>
+     913:	0f be c8             	movsbl %al,%ecx
+     916:	0f b6 05 a3 20 00 00 	movzbl 0x20a3(%rip),%eax        # 29c0 <buf>
+     91d:	0f be d0             	movsbl %al,%edx
+     920:	8b 05 fa 1f 00 00    	mov    0x1ffa(%rip),%eax        # 2920 <stdout>
+     926:	48 8d 35 73 1a 00 00 	lea    0x1a73(%rip),%rsi        # 23a0 <malloc+0x2df>
+     92d:	89 c7                	mov    %eax,%edi
+     92f:	b8 00 00 00 00       	mov    $0x0,%eax
+     934:	e8 06 0f 00 00       	call   183f <printf>
+     939:	8b 05 e1 1f 00 00    	mov    0x1fe1(%rip),%eax        # 2920 <stdout>
+     93f:	48 8d 15 28 19 00 00 	lea    0x1928(%rip),%rdx        # 226e <malloc+0x1ad>
+     946:	48 89 d6             	mov    %rdx,%rsi
+     949:	89 c7                	mov    %eax,%edi
+     94b:	b8 00 00 00 00       	mov    $0x0,%eax
+     950:	e8 ea 0e 00 00       	call   183f <printf>
+     955:	90                   	nop
+     956:	eb fd                	jmp    955 <sharedtest+0x518>
+  close(fd);
+     958:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     95b:	89 c7                	mov    %eax,%edi
+     95d:	e8 ac 14 00 00       	call   1e0e <close>
+  printf(stdout, "sharedtest OK\n");
+     962:	8b 05 b8 1f 00 00    	mov    0x1fb8(%rip),%eax        # 2920 <stdout>
+     968:	48 8d 15 57 1a 00 00 	lea    0x1a57(%rip),%rdx        # 23c6 <malloc+0x305>
+     96f:	48 89 d6             	mov    %rdx,%rsi
+     972:	89 c7                	mov    %eax,%edi
+     974:	b8 00 00 00 00       	mov    $0x0,%eax
+     979:	e8 c1 0e 00 00       	call   183f <printf>
+}
+     97e:	90                   	nop
+     97f:	c9                   	leave
+     980:	c3                   	ret
+
+0000000000000981 <privatetest>:
+
+void
+privatetest(void)
+{
+     981:	55                   	push   %rbp
+     982:	48 89 e5             	mov    %rsp,%rbp
+     985:	48 83 ec 20          	sub    $0x20,%rsp
+  char *p;
+  int fd, pid;
+
+  printf(stdout, "privatetest\n");
+     989:	8b 05 91 1f 00 00    	mov    0x1f91(%rip),%eax        # 2920 <stdout>
+     98f:	48 8d 15 3f 1a 00 00 	lea    0x1a3f(%rip),%rdx        # 23d5 <malloc+0x314>
+     996:	48 89 d6             	mov    %rdx,%rsi
+     999:	89 c7                	mov    %eax,%edi
+     99b:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a0:	e8 9a 0e 00 00       	call   183f <printf>
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+     9a5:	be 00 00 00 00       	mov    $0x0,%esi
+     9aa:	48 8d 05 e7 18 00 00 	lea    0x18e7(%rip),%rax        # 2298 <malloc+0x1d7>
+     9b1:	48 89 c7             	mov    %rax,%rdi
+     9b4:	e8 6d 14 00 00       	call   1e26 <open>
+     9b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     9bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     9c0:	79 5c                	jns    a1e <privatetest+0x9d>
+    error("unable to open mmap1.txt");
+     9c2:	8b 05 58 1f 00 00    	mov    0x1f58(%rip),%eax        # 2920 <stdout>
+     9c8:	ba 78 00 00 00       	mov    $0x78,%edx
+     9cd:	48 8d 0d 74 18 00 00 	lea    0x1874(%rip),%rcx        # 2248 <malloc+0x187>
+     9d4:	48 89 ce             	mov    %rcx,%rsi
+     9d7:	89 c7                	mov    %eax,%edi
+     9d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     9de:	e8 5c 0e 00 00       	call   183f <printf>
+     9e3:	8b 05 37 1f 00 00    	mov    0x1f37(%rip),%eax        # 2920 <stdout>
+     9e9:	48 8d 15 b2 18 00 00 	lea    0x18b2(%rip),%rdx        # 22a2 <malloc+0x1e1>
+     9f0:	48 89 d6             	mov    %rdx,%rsi
+     9f3:	89 c7                	mov    %eax,%edi
+     9f5:	b8 00 00 00 00       	mov    $0x0,%eax
+     9fa:	e8 40 0e 00 00       	call   183f <printf>
+     9ff:	8b 05 1b 1f 00 00    	mov    0x1f1b(%rip),%eax        # 2920 <stdout>
+     a05:	48 8d 15 62 18 00 00 	lea    0x1862(%rip),%rdx        # 226e <malloc+0x1ad>
+     a0c:	48 89 d6             	mov    %rdx,%rsi
+     a0f:	89 c7                	mov    %eax,%edi
+     a11:	b8 00 00 00 00       	mov    $0x0,%eax
+     a16:	e8 24 0e 00 00       	call   183f <printf>
+     a1b:	90                   	nop
+     a1c:	eb fd                	jmp    a1b <privatetest+0x9a>
+
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+     a1e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a21:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     a27:	41 89 c0             	mov    %eax,%r8d
+     a2a:	b9 02 00 00 00       	mov    $0x2,%ecx
+     a2f:	ba 03 00 00 00       	mov    $0x3,%edx
+     a34:	be 00 00 04 00       	mov    $0x40000,%esi
+     a39:	bf 00 00 00 00       	mov    $0x0,%edi
+     a3e:	e8 63 14 00 00       	call   1ea6 <mmap2>
+     a43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(p == MAP_FAILED)
+     a47:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     a4c:	75 5c                	jne    aaa <privatetest+0x129>
+    error("mmap2 failed");
+     a4e:	8b 05 cc 1e 00 00    	mov    0x1ecc(%rip),%eax        # 2920 <stdout>
+     a54:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     a59:	48 8d 0d e8 17 00 00 	lea    0x17e8(%rip),%rcx        # 2248 <malloc+0x187>
+     a60:	48 89 ce             	mov    %rcx,%rsi
+     a63:	89 c7                	mov    %eax,%edi
+     a65:	b8 00 00 00 00       	mov    $0x0,%eax
+     a6a:	e8 d0 0d 00 00       	call   183f <printf>
+     a6f:	8b 05 ab 1e 00 00    	mov    0x1eab(%rip),%eax        # 2920 <stdout>
+     a75:	48 8d 15 3f 18 00 00 	lea    0x183f(%rip),%rdx        # 22bb <malloc+0x1fa>
+     a7c:	48 89 d6             	mov    %rdx,%rsi
+     a7f:	89 c7                	mov    %eax,%edi
+     a81:	b8 00 00 00 00       	mov    $0x0,%eax
+     a86:	e8 b4 0d 00 00       	call   183f <printf>
+     a8b:	8b 05 8f 1e 00 00    	mov    0x1e8f(%rip),%eax        # 2920 <stdout>
+     a91:	48 8d 15 d6 17 00 00 	lea    0x17d6(%rip),%rdx        # 226e <malloc+0x1ad>
+     a98:	48 89 d6             	mov    %rdx,%rsi
+     a9b:	89 c7                	mov    %eax,%edi
+     a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa2:	e8 98 0d 00 00       	call   183f <printf>
+     aa7:	90                   	nop
+     aa8:	eb fd                	jmp    aa7 <privatetest+0x126>
+  p[PGSIZE] = 'Y';
+     aaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     aae:	48 05 00 10 00 00    	add    $0x1000,%rax
+     ab4:	c6 00 59             	movb   $0x59,(%rax)
+
+  pid = fork();
+     ab7:	e8 22 13 00 00       	call   1dde <fork>
+     abc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(pid < 0)
+     abf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     ac3:	79 5c                	jns    b21 <privatetest+0x1a0>
+    error("fork failed");
+     ac5:	8b 05 55 1e 00 00    	mov    0x1e55(%rip),%eax        # 2920 <stdout>
+     acb:	ba 81 00 00 00       	mov    $0x81,%edx
+     ad0:	48 8d 0d 71 17 00 00 	lea    0x1771(%rip),%rcx        # 2248 <malloc+0x187>
+     ad7:	48 89 ce             	mov    %rcx,%rsi
+     ada:	89 c7                	mov    %eax,%edi
+     adc:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae1:	e8 59 0d 00 00       	call   183f <printf>
+     ae6:	8b 05 34 1e 00 00    	mov    0x1e34(%rip),%eax        # 2920 <stdout>
+     aec:	48 8d 15 4d 18 00 00 	lea    0x184d(%rip),%rdx        # 2340 <malloc+0x27f>
+     af3:	48 89 d6             	mov    %rdx,%rsi
+     af6:	89 c7                	mov    %eax,%edi
+     af8:	b8 00 00 00 00       	mov    $0x0,%eax
+     afd:	e8 3d 0d 00 00       	call   183f <printf>
+     b02:	8b 05 18 1e 00 00    	mov    0x1e18(%rip),%eax        # 2920 <stdout>
+     b08:	48 8d 15 5f 17 00 00 	lea    0x175f(%rip),%rdx        # 226e <malloc+0x1ad>
+     b0f:	48 89 d6             	mov    %rdx,%rsi
+     b12:	89 c7                	mov    %eax,%edi
+     b14:	b8 00 00 00 00       	mov    $0x0,%eax
+     b19:	e8 21 0d 00 00       	call   183f <printf>
+     b1e:	90                   	nop
+     b1f:	eb fd                	jmp    b1e <privatetest+0x19d>
+  if(pid == 0){
+     b21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     b25:	75 79                	jne    ba0 <privatetest+0x21f>
+    p[PGSIZE] = 'Z';
+     b27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b2b:	48 05 00 10 00 00    	add    $0x1000,%rax
+     b31:	c6 00 5a             	movb   $0x5a,(%rax)
+    if(p[0] != 'a')
+     b34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     b38:	0f b6 00             	movzbl (%rax),%eax
+     b3b:	3c 61                	cmp    $0x61,%al
+     b3d:	74 5c                	je     b9b <privatetest+0x21a>
+      error("child sees the wrong data");
+     b3f:	8b 05 db 1d 00 00    	mov    0x1ddb(%rip),%eax        # 2920 <stdout>
+     b45:	ba 85 00 00 00       	mov    $0x85,%edx
+     b4a:	48 8d 0d f7 16 00 00 	lea    0x16f7(%rip),%rcx        # 2248 <malloc+0x187>
+     b51:	48 89 ce             	mov    %rcx,%rsi
+     b54:	89 c7                	mov    %eax,%edi
+     b56:	b8 00 00 00 00       	mov    $0x0,%eax
+     b5b:	e8 df 0c 00 00       	call   183f <printf>
+     b60:	8b 05 ba 1d 00 00    	mov    0x1dba(%rip),%eax        # 2920 <stdout>
+     b66:	48 8d 15 75 18 00 00 	lea    0x1875(%rip),%rdx        # 23e2 <malloc+0x321>
+     b6d:	48 89 d6             	mov    %rdx,%rsi
+     b70:	89 c7                	mov    %eax,%edi
+     b72:	b8 00 00 00 00       	mov    $0x0,%eax
+     b77:	e8 c3 0c 00 00       	call   183f <printf>
+     b7c:	8b 05 9e 1d 00 00    	mov    0x1d9e(%rip),%eax        # 2920 <stdout>
+     b82:	48 8d 15 e5 16 00 00 	lea    0x16e5(%rip),%rdx        # 226e <malloc+0x1ad>
+     b89:	48 89 d6             	mov    %rdx,%rsi
+     b8c:	89 c7                	mov    %eax,%edi
+     b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+     b93:	e8 a7 0c 00 00       	call   183f <printf>
+     b98:	90                   	nop
+     b99:	eb fd                	jmp    b98 <privatetest+0x217>
+    exit();
+     b9b:	e8 46 12 00 00       	call   1de6 <exit>
+  }
+  wait();
+     ba0:	e8 49 12 00 00       	call   1dee <wait>
+
+  if(p[PGSIZE] != 'Y')
+     ba5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ba9:	48 05 00 10 00 00    	add    $0x1000,%rax
+     baf:	0f b6 00             	movzbl (%rax),%eax
+     bb2:	3c 59                	cmp    $0x59,%al
+     bb4:	74 5c                	je     c12 <privatetest+0x291>
+    error("private page changed by the child");
+     bb6:	8b 05 64 1d 00 00    	mov    0x1d64(%rip),%eax        # 2920 <stdout>
+     bbc:	ba 8b 00 00 00       	mov    $0x8b,%edx
+     bc1:	48 8d 0d 80 16 00 00 	lea    0x1680(%rip),%rcx        # 2248 <malloc+0x187>
+     bc8:	48 89 ce             	mov    %rcx,%rsi
+     bcb:	89 c7                	mov    %eax,%edi
+     bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+     bd2:	e8 68 0c 00 00       	call   183f <printf>
+     bd7:	8b 05 43 1d 00 00    	mov    0x1d43(%rip),%eax        # 2920 <stdout>
+     bdd:	48 8d 15 1c 18 00 00 	lea    0x181c(%rip),%rdx        # 2400 <malloc+0x33f>
+     be4:	48 89 d6             	mov    %rdx,%rsi
+     be7:	89 c7                	mov    %eax,%edi
+     be9:	b8 00 00 00 00       	mov    $0x0,%eax
+     bee:	e8 4c 0c 00 00       	call   183f <printf>
+     bf3:	8b 05 27 1d 00 00    	mov    0x1d27(%rip),%eax        # 2920 <stdout>
+     bf9:	48 8d 15 6e 16 00 00 	lea    0x166e(%rip),%rdx        # 226e <malloc+0x1ad>
+     c00:	48 89 d6             	mov    %rdx,%rsi
+     c03:	89 c7                	mov    %eax,%edi
+     c05:	b8 00 00 00 00       	mov    $0x0,%eax
+     c0a:	e8 30 0c 00 00       	call   183f <printf>
+     c0f:	90                   	nop
+     c10:	eb fd                	jmp    c0f <privatetest+0x28e>
+  munmap2(p, NPAGES * PGSIZE);
+     c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c16:	be 00 00 04 00       	mov    $0x40000,%esi
+     c1b:	48 89 c7             	mov    %rax,%rdi
+     c1e:	e8 92 12 00 00       	call   1eb5 <munmap2>
+
+  // the file itself is unchanged
+  if(read(fd, buf, PGSIZE) != PGSIZE || read(fd, buf, PGSIZE) != PGSIZE)
+     c23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c26:	ba 00 10 00 00       	mov    $0x1000,%edx
+     c2b:	48 8d 0d 8e 1d 00 00 	lea    0x1d8e(%rip),%rcx        # 29c0 <buf>
+     c32:	48 89 ce             	mov    %rcx,%rsi
+     c35:	89 c7                	mov    %eax,%edi
+     c37:	e8 c2 11 00 00       	call   1dfe <read>
+     c3c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     c41:	75 20                	jne    c63 <privatetest+0x2e2>
+     c43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c46:	ba 00 10 00 00       	mov    $0x1000,%edx
+     c4b:	48 8d 0d 6e 1d 00 00 	lea    0x1d6e(%rip),%rcx        # 29c0 <buf>
+     c52:	48 89 ce             	mov    %rcx,%rsi
+     c55:	89 c7                	mov    %eax,%edi
+     c57:	e8 a2 11 00 00       	call   1dfe <read>
+     c5c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     c61:	74 5c                	je     cbf <privatetest+0x33e>
+    error("unable to read mmap1.txt");
+     c63:	8b 05 b7 1c 00 00    	mov    0x1cb7(%rip),%eax        # 2920 <stdout>
+     c69:	ba 90 00 00 00       	mov    $0x90,%edx
+     c6e:	48 8d 0d d3 15 00 00 	lea    0x15d3(%rip),%rcx        # 2248 <malloc+0x187>
+     c75:	48 89 ce             	mov    %rcx,%rsi
+     c78:	89 c7                	mov    %eax,%edi
+     c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c7f:	e8 bb 0b 00 00       	call   183f <printf>
+     c84:	8b 05 96 1c 00 00    	mov    0x1c96(%rip),%eax        # 2920 <stdout>
+     c8a:	48 8d 15 f3 16 00 00 	lea    0x16f3(%rip),%rdx        # 2384 <malloc+0x2c3>
+     c91:	48 89 d6             	mov    %rdx,%rsi
+     c94:	89 c7                	mov    %eax,%edi
+     c96:	b8 00 00 00 00       	mov    $0x0,%eax
+     c9b:	e8 9f 0b 00 00       	call   183f <printf>
+     ca0:	8b 05 7a 1c 00 00    	mov    0x1c7a(%rip),%eax        # 2920 <stdout>
+     ca6:	48 8d 15 c1 15 00 00 	lea    0x15c1(%rip),%rdx        # 226e <malloc+0x1ad>
+     cad:	48 89 d6             	mov    %rdx,%rsi
+     cb0:	89 c7                	mov    %eax,%edi
+     cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+     cb7:	e8 83 0b 00 00       	call   183f <printf>
+     cbc:	90                   	nop
+     cbd:	eb fd                	jmp    cbc <privatetest+0x33b>
+  if(buf[0] != 'b')
+     cbf:	0f b6 05 fa 1c 00 00 	movzbl 0x1cfa(%rip),%eax        # 29c0 <buf>
+     cc6:	3c 62                	cmp    $0x62,%al
+     cc8:	74 5c                	je     d26 <privatetest+0x3a5>
+    error("private change reached the file");
+     cca:	8b 05 50 1c 00 00    	mov    0x1c50(%rip),%eax        # 2920 <stdout>
+     cd0:	ba 92 00 00 00       	mov    $0x92,%edx
+     cd5:	48 8d 0d 6c 15 00 00 	lea    0x156c(%rip),%rcx        # 2248 <malloc+0x187>
+     cdc:	48 89 ce             	mov    %rcx,%rsi
+     cdf:	89 c7                	mov    %eax,%edi
+     ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce6:	e8 54 0b 00 00       	call   183f <printf>
+     ceb:	8b 05 2f 1c 00 00    	mov    0x1c2f(%rip),%eax        # 2920 <stdout>
+     cf1:	48 8d 15 30 17 00 00 	lea    0x1730(%rip),%rdx        # 2428 <malloc+0x367>
+     cf8:	48 89 d6             	mov    %rdx,%rsi
+     cfb:	89 c7                	mov    %eax,%edi
+     cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+     d02:	e8 38 0b 00 00       	call   183f <printf>
+     d07:	8b 05 13 1c 00 00    	mov    0x1c13(%rip),%eax        # 2920 <stdout>
+     d0d:	48 8d 15 5a 15 00 00 	lea    0x155a(%rip),%rdx        # 226e <malloc+0x1ad>
+     d14:	48 89 d6             	mov    %rdx,%rsi
+     d17:	89 c7                	mov    %eax,%edi
+     d19:	b8 00 00 00 00       	mov    $0x0,%eax
+     d1e:	e8 1c 0b 00 00       	call   183f <printf>
+     d23:	90                   	nop
+     d24:	eb fd                	jmp    d23 <privatetest+0x3a2>
+  close(fd);
+     d26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d29:	89 c7                	mov    %eax,%edi
+     d2b:	e8 de 10 00 00       	call   1e0e <close>
+  printf(stdout, "privatetest OK\n");
+     d30:	8b 05 ea 1b 00 00    	mov    0x1bea(%rip),%eax        # 2920 <stdout>
+     d36:	48 8d 15 0b 17 00 00 	lea    0x170b(%rip),%rdx        # 2448 <malloc+0x387>
+     d3d:	48 89 d6             	mov    %rdx,%rsi
+     d40:	89 c7                	mov    %eax,%edi
+     d42:	b8 00 00 00 00       	mov    $0x0,%eax
+     d47:	e8 f3 0a 00 00       	call   183f <printf>
+}
+     d4c:	90                   	nop
+     d4d:	c9                   	leave
+     d4e:	c3                   	ret
+
+0000000000000d4f <invalidtest>:
+
+void
+invalidtest(void)
+{
+     d4f:	55                   	push   %rbp
+     d50:	48 89 e5             	mov    %rsp,%rbp
+     d53:	48 83 ec 10          	sub    $0x10,%rsp
+  char *p;
+  int fd;
+
+  printf(stdout, "invalidtest\n");
+     d57:	8b 05 c3 1b 00 00    	mov    0x1bc3(%rip),%eax        # 2920 <stdout>
+     d5d:	48 8d 15 f4 16 00 00 	lea    0x16f4(%rip),%rdx        # 2458 <malloc+0x397>
+     d64:	48 89 d6             	mov    %rdx,%rsi
+     d67:	89 c7                	mov    %eax,%edi
+     d69:	b8 00 00 00 00       	mov    $0x0,%eax
+     d6e:	e8 cc 0a 00 00       	call   183f <printf>
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+     d73:	be 00 00 00 00       	mov    $0x0,%esi
+     d78:	48 8d 05 19 15 00 00 	lea    0x1519(%rip),%rax        # 2298 <malloc+0x1d7>
+     d7f:	48 89 c7             	mov    %rax,%rdi
+     d82:	e8 9f 10 00 00       	call   1e26 <open>
+     d87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     d8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d8e:	79 5c                	jns    dec <invalidtest+0x9d>
+    error("unable to open mmap1.txt");
+     d90:	8b 05 8a 1b 00 00    	mov    0x1b8a(%rip),%eax        # 2920 <stdout>
+     d96:	ba 9f 00 00 00       	mov    $0x9f,%edx
+     d9b:	48 8d 0d a6 14 00 00 	lea    0x14a6(%rip),%rcx        # 2248 <malloc+0x187>
+     da2:	48 89 ce             	mov    %rcx,%rsi
+     da5:	89 c7                	mov    %eax,%edi
+     da7:	b8 00 00 00 00       	mov    $0x0,%eax
+     dac:	e8 8e 0a 00 00       	call   183f <printf>
+     db1:	8b 05 69 1b 00 00    	mov    0x1b69(%rip),%eax        # 2920 <stdout>
+     db7:	48 8d 15 e4 14 00 00 	lea    0x14e4(%rip),%rdx        # 22a2 <malloc+0x1e1>
+     dbe:	48 89 d6             	mov    %rdx,%rsi
+     dc1:	89 c7                	mov    %eax,%edi
+     dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc8:	e8 72 0a 00 00       	call   183f <printf>
+     dcd:	8b 05 4d 1b 00 00    	mov    0x1b4d(%rip),%eax        # 2920 <stdout>
+     dd3:	48 8d 15 94 14 00 00 	lea    0x1494(%rip),%rdx        # 226e <malloc+0x1ad>
+     dda:	48 89 d6             	mov    %rdx,%rsi
+     ddd:	89 c7                	mov    %eax,%edi
+     ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+     de4:	e8 56 0a 00 00       	call   183f <printf>
+     de9:	90                   	nop
+     dea:	eb fd                	jmp    de9 <invalidtest+0x9a>
+
+  // shared writable mappings need a file open for writing
+  if(mmap2(0, PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED)
+     dec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     def:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     df5:	41 89 c0             	mov    %eax,%r8d
+     df8:	b9 01 00 00 00       	mov    $0x1,%ecx
+     dfd:	ba 03 00 00 00       	mov    $0x3,%edx
+     e02:	be 00 10 00 00       	mov    $0x1000,%esi
+     e07:	bf 00 00 00 00       	mov    $0x0,%edi
+     e0c:	e8 95 10 00 00       	call   1ea6 <mmap2>
+     e11:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+     e15:	74 5c                	je     e73 <invalidtest+0x124>
+    error("mapped a read-only file shared and writable");
+     e17:	8b 05 03 1b 00 00    	mov    0x1b03(%rip),%eax        # 2920 <stdout>
+     e1d:	ba a3 00 00 00       	mov    $0xa3,%edx
+     e22:	48 8d 0d 1f 14 00 00 	lea    0x141f(%rip),%rcx        # 2248 <malloc+0x187>
+     e29:	48 89 ce             	mov    %rcx,%rsi
+     e2c:	89 c7                	mov    %eax,%edi
+     e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e33:	e8 07 0a 00 00       	call   183f <printf>
+     e38:	8b 05 e2 1a 00 00    	mov    0x1ae2(%rip),%eax        # 2920 <stdout>
+     e3e:	48 8d 15 23 16 00 00 	lea    0x1623(%rip),%rdx        # 2468 <malloc+0x3a7>
+     e45:	48 89 d6             	mov    %rdx,%rsi
+     e48:	89 c7                	mov    %eax,%edi
+     e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4f:	e8 eb 09 00 00       	call   183f <printf>
+     e54:	8b 05 c6 1a 00 00    	mov    0x1ac6(%rip),%eax        # 2920 <stdout>
+     e5a:	48 8d 15 0d 14 00 00 	lea    0x140d(%rip),%rdx        # 226e <malloc+0x1ad>
+     e61:	48 89 d6             	mov    %rdx,%rsi
+     e64:	89 c7                	mov    %eax,%edi
+     e66:	b8 00 00 00 00       	mov    $0x0,%eax
+     e6b:	e8 cf 09 00 00       	call   183f <printf>
+     e70:	90                   	nop
+     e71:	eb fd                	jmp    e70 <invalidtest+0x121>
+  if(mmap2(0, PGSIZE, PROT_READ, MAP_SHARED, fd, 7) != MAP_FAILED)
+     e73:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e76:	41 b9 07 00 00 00    	mov    $0x7,%r9d
+     e7c:	41 89 c0             	mov    %eax,%r8d
+     e7f:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e84:	ba 01 00 00 00       	mov    $0x1,%edx
+     e89:	be 00 10 00 00       	mov    $0x1000,%esi
+     e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+     e93:	e8 0e 10 00 00       	call   1ea6 <mmap2>
+     e98:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+     e9c:	74 5c                	je     efa <invalidtest+0x1ab>
+    error("mapped at an unaligned offset");
+     e9e:	8b 05 7c 1a 00 00    	mov    0x1a7c(%rip),%eax        # 2920 <stdout>
+     ea4:	ba a5 00 00 00       	mov    $0xa5,%edx
+     ea9:	48 8d 0d 98 13 00 00 	lea    0x1398(%rip),%rcx        # 2248 <malloc+0x187>
+     eb0:	48 89 ce             	mov    %rcx,%rsi
+     eb3:	89 c7                	mov    %eax,%edi
+     eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eba:	e8 80 09 00 00       	call   183f <printf>
+     ebf:	8b 05 5b 1a 00 00    	mov    0x1a5b(%rip),%eax        # 2920 <stdout>
+     ec5:	48 8d 15 c8 15 00 00 	lea    0x15c8(%rip),%rdx        # 2494 <malloc+0x3d3>
+     ecc:	48 89 d6             	mov    %rdx,%rsi
+     ecf:	89 c7                	mov    %eax,%edi
+     ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed6:	e8 64 09 00 00       	call   183f <printf>
+     edb:	8b 05 3f 1a 00 00    	mov    0x1a3f(%rip),%eax        # 2920 <stdout>
+     ee1:	48 8d 15 86 13 00 00 	lea    0x1386(%rip),%rdx        # 226e <malloc+0x1ad>
+     ee8:	48 89 d6             	mov    %rdx,%rsi
+     eeb:	89 c7                	mov    %eax,%edi
+     eed:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef2:	e8 48 09 00 00       	call   183f <printf>
+     ef7:	90                   	nop
+     ef8:	eb fd                	jmp    ef7 <invalidtest+0x1a8>
+  if(mmap2(0, 0, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+     efa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     efd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     f03:	41 89 c0             	mov    %eax,%r8d
+     f06:	b9 01 00 00 00       	mov    $0x1,%ecx
+     f0b:	ba 01 00 00 00       	mov    $0x1,%edx
+     f10:	be 00 00 00 00       	mov    $0x0,%esi
+     f15:	bf 00 00 00 00       	mov    $0x0,%edi
+     f1a:	e8 87 0f 00 00       	call   1ea6 <mmap2>
+     f1f:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+     f23:	74 5c                	je     f81 <invalidtest+0x232>
+    error("mapped zero bytes");
+     f25:	8b 05 f5 19 00 00    	mov    0x19f5(%rip),%eax        # 2920 <stdout>
+     f2b:	ba a7 00 00 00       	mov    $0xa7,%edx
+     f30:	48 8d 0d 11 13 00 00 	lea    0x1311(%rip),%rcx        # 2248 <malloc+0x187>
+     f37:	48 89 ce             	mov    %rcx,%rsi
+     f3a:	89 c7                	mov    %eax,%edi
+     f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+     f41:	e8 f9 08 00 00       	call   183f <printf>
+     f46:	8b 05 d4 19 00 00    	mov    0x19d4(%rip),%eax        # 2920 <stdout>
+     f4c:	48 8d 15 5f 15 00 00 	lea    0x155f(%rip),%rdx        # 24b2 <malloc+0x3f1>
+     f53:	48 89 d6             	mov    %rdx,%rsi
+     f56:	89 c7                	mov    %eax,%edi
+     f58:	b8 00 00 00 00       	mov    $0x0,%eax
+     f5d:	e8 dd 08 00 00       	call   183f <printf>
+     f62:	8b 05 b8 19 00 00    	mov    0x19b8(%rip),%eax        # 2920 <stdout>
+     f68:	48 8d 15 ff 12 00 00 	lea    0x12ff(%rip),%rdx        # 226e <malloc+0x1ad>
+     f6f:	48 89 d6             	mov    %rdx,%rsi
+     f72:	89 c7                	mov    %eax,%edi
+     f74:	b8 00 00 00 00       	mov    $0x0,%eax
+     f79:	e8 c1 08 00 00       	call   183f <printf>
+     f7e:	90                   	nop
+     f7f:	eb fd                	jmp    f7e <invalidtest+0x22f>
+
+  // unmapping the middle of a mapping leaves the two ends
+  p = mmap2(0, 3 * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+     f81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     f8a:	41 89 c0             	mov    %eax,%r8d
+     f8d:	b9 02 00 00 00       	mov    $0x2,%ecx
+     f92:	ba 01 00 00 00       	mov    $0x1,%edx
+     f97:	be 00 30 00 00       	mov    $0x3000,%esi
+     f9c:	bf 00 00 00 00       	mov    $0x0,%edi
+     fa1:	e8 00 0f 00 00       	call   1ea6 <mmap2>
+     fa6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(p == MAP_FAILED)
+     faa:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     faf:	75 5c                	jne    100d <invalidtest+0x2be>
+    error("mmap2 failed");
+     fb1:	8b 05 69 19 00 00    	mov    0x1969(%rip),%eax        # 2920 <stdout>
+     fb7:	ba ac 00 00 00       	mov    $0xac,%edx
+     fbc:	48 8d 0d 85 12 00 00 	lea    0x1285(%rip),%rcx        # 2248 <malloc+0x187>
+     fc3:	48 89 ce             	mov    %rcx,%rsi
+     fc6:	89 c7                	mov    %eax,%edi
+     fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+     fcd:	e8 6d 08 00 00       	call   183f <printf>
+     fd2:	8b 05 48 19 00 00    	mov    0x1948(%rip),%eax        # 2920 <stdout>
+     fd8:	48 8d 15 dc 12 00 00 	lea    0x12dc(%rip),%rdx        # 22bb <malloc+0x1fa>
+     fdf:	48 89 d6             	mov    %rdx,%rsi
+     fe2:	89 c7                	mov    %eax,%edi
+     fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe9:	e8 51 08 00 00       	call   183f <printf>
+     fee:	8b 05 2c 19 00 00    	mov    0x192c(%rip),%eax        # 2920 <stdout>
+     ff4:	48 8d 15 73 12 00 00 	lea    0x1273(%rip),%rdx        # 226e <malloc+0x1ad>
+     ffb:	48 89 d6             	mov    %rdx,%rsi
+     ffe:	89 c7                	mov    %eax,%edi
+    1000:	b8 00 00 00 00       	mov    $0x0,%eax
+    1005:	e8 35 08 00 00       	call   183f <printf>
+    100a:	90                   	nop
+    100b:	eb fd                	jmp    100a <invalidtest+0x2bb>
+  if(munmap2(p + PGSIZE, PGSIZE) < 0)
+    100d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1011:	48 05 00 10 00 00    	add    $0x1000,%rax
+    1017:	be 00 10 00 00       	mov    $0x1000,%esi
+    101c:	48 89 c7             	mov    %rax,%rdi
+    101f:	e8 91 0e 00 00       	call   1eb5 <munmap2>
+    1024:	85 c0                	test   %eax,%eax
+    1026:	79 5c                	jns    1084 <invalidtest+0x335>
+    error("munmap2 of the middle page failed");
+    1028:	8b 05 f2 18 00 00    	mov    0x18f2(%rip),%eax        # 2920 <stdout>
+    102e:	ba ae 00 00 00       	mov    $0xae,%edx
+    1033:	48 8d 0d 0e 12 00 00 	lea    0x120e(%rip),%rcx        # 2248 <malloc+0x187>
+    103a:	48 89 ce             	mov    %rcx,%rsi
+    103d:	89 c7                	mov    %eax,%edi
+    103f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1044:	e8 f6 07 00 00       	call   183f <printf>
+    1049:	8b 05 d1 18 00 00    	mov    0x18d1(%rip),%eax        # 2920 <stdout>
+    104f:	48 8d 15 72 14 00 00 	lea    0x1472(%rip),%rdx        # 24c8 <malloc+0x407>
+    1056:	48 89 d6             	mov    %rdx,%rsi
+    1059:	89 c7                	mov    %eax,%edi
+    105b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1060:	e8 da 07 00 00       	call   183f <printf>
+    1065:	8b 05 b5 18 00 00    	mov    0x18b5(%rip),%eax        # 2920 <stdout>
+    106b:	48 8d 15 fc 11 00 00 	lea    0x11fc(%rip),%rdx        # 226e <malloc+0x1ad>
+    1072:	48 89 d6             	mov    %rdx,%rsi
+    1075:	89 c7                	mov    %eax,%edi
+    1077:	b8 00 00 00 00       	mov    $0x0,%eax
+    107c:	e8 be 07 00 00       	call   183f <printf>
+    1081:	90                   	nop
+    1082:	eb fd                	jmp    1081 <invalidtest+0x332>
+  if(p[0] != 'a' || p[2 * PGSIZE + 1] != 'c')
+    1084:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1088:	0f b6 00             	movzbl (%rax),%eax
+    108b:	3c 61                	cmp    $0x61,%al
+    108d:	75 11                	jne    10a0 <invalidtest+0x351>
+    108f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1093:	48 05 01 20 00 00    	add    $0x2001,%rax
+    1099:	0f b6 00             	movzbl (%rax),%eax
+    109c:	3c 63                	cmp    $0x63,%al
+    109e:	74 5c                	je     10fc <invalidtest+0x3ad>
+    error("ends of the mapping are gone");
+    10a0:	8b 05 7a 18 00 00    	mov    0x187a(%rip),%eax        # 2920 <stdout>
+    10a6:	ba b0 00 00 00       	mov    $0xb0,%edx
+    10ab:	48 8d 0d 96 11 00 00 	lea    0x1196(%rip),%rcx        # 2248 <malloc+0x187>
+    10b2:	48 89 ce             	mov    %rcx,%rsi
+    10b5:	89 c7                	mov    %eax,%edi
+    10b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bc:	e8 7e 07 00 00       	call   183f <printf>
+    10c1:	8b 05 59 18 00 00    	mov    0x1859(%rip),%eax        # 2920 <stdout>
+    10c7:	48 8d 15 1c 14 00 00 	lea    0x141c(%rip),%rdx        # 24ea <malloc+0x429>
+    10ce:	48 89 d6             	mov    %rdx,%rsi
+    10d1:	89 c7                	mov    %eax,%edi
+    10d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d8:	e8 62 07 00 00       	call   183f <printf>
+    10dd:	8b 05 3d 18 00 00    	mov    0x183d(%rip),%eax        # 2920 <stdout>
+    10e3:	48 8d 15 84 11 00 00 	lea    0x1184(%rip),%rdx        # 226e <malloc+0x1ad>
+    10ea:	48 89 d6             	mov    %rdx,%rsi
+    10ed:	89 c7                	mov    %eax,%edi
+    10ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f4:	e8 46 07 00 00       	call   183f <printf>
+    10f9:	90                   	nop
+    10fa:	eb fd                	jmp    10f9 <invalidtest+0x3aa>
+  if(msync(p + PGSIZE, PGSIZE) != -1)
+    10fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1100:	48 05 00 10 00 00    	add    $0x1000,%rax
+    1106:	be 00 10 00 00       	mov    $0x1000,%esi
+    110b:	48 89 c7             	mov    %rax,%rdi
+    110e:	e8 aa 0d 00 00       	call   1ebd <msync>
+    1113:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1116:	74 5c                	je     1174 <invalidtest+0x425>
+    error("msync of an unmapped range succeeded");
+    1118:	8b 05 02 18 00 00    	mov    0x1802(%rip),%eax        # 2920 <stdout>
+    111e:	ba b2 00 00 00       	mov    $0xb2,%edx
+    1123:	48 8d 0d 1e 11 00 00 	lea    0x111e(%rip),%rcx        # 2248 <malloc+0x187>
+    112a:	48 89 ce             	mov    %rcx,%rsi
+    112d:	89 c7                	mov    %eax,%edi
+    112f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1134:	e8 06 07 00 00       	call   183f <printf>
+    1139:	8b 05 e1 17 00 00    	mov    0x17e1(%rip),%eax        # 2920 <stdout>
+    113f:	48 8d 15 c2 13 00 00 	lea    0x13c2(%rip),%rdx        # 2508 <malloc+0x447>
+    1146:	48 89 d6             	mov    %rdx,%rsi
+    1149:	89 c7                	mov    %eax,%edi
+    114b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1150:	e8 ea 06 00 00       	call   183f <printf>
+    1155:	8b 05 c5 17 00 00    	mov    0x17c5(%rip),%eax        # 2920 <stdout>
+    115b:	48 8d 15 0c 11 00 00 	lea    0x110c(%rip),%rdx        # 226e <malloc+0x1ad>
+    1162:	48 89 d6             	mov    %rdx,%rsi
+    1165:	89 c7                	mov    %eax,%edi
+    1167:	b8 00 00 00 00       	mov    $0x0,%eax
+    116c:	e8 ce 06 00 00       	call   183f <printf>
+    1171:	90                   	nop
+    1172:	eb fd                	jmp    1171 <invalidtest+0x422>
+  munmap2(p, 3 * PGSIZE);
+    1174:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1178:	be 00 30 00 00       	mov    $0x3000,%esi
+    117d:	48 89 c7             	mov    %rax,%rdi
+    1180:	e8 30 0d 00 00       	call   1eb5 <munmap2>
+  close(fd);
+    1185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1188:	89 c7                	mov    %eax,%edi
+    118a:	e8 7f 0c 00 00       	call   1e0e <close>
+  printf(stdout, "invalidtest OK\n");
+    118f:	8b 05 8b 17 00 00    	mov    0x178b(%rip),%eax        # 2920 <stdout>
+    1195:	48 8d 15 91 13 00 00 	lea    0x1391(%rip),%rdx        # 252d <malloc+0x46c>
+    119c:	48 89 d6             	mov    %rdx,%rsi
+    119f:	89 c7                	mov    %eax,%edi
+    11a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a6:	e8 94 06 00 00       	call   183f <printf>
+}
+    11ab:	90                   	nop
+    11ac:	c9                   	leave
+    11ad:	c3                   	ret
+
+00000000000011ae <anontest>:
+
+void
+anontest(void)
+{
+    11ae:	55                   	push   %rbp
+    11af:	48 89 e5             	mov    %rsp,%rbp
+    11b2:	48 83 ec 50          	sub    $0x50,%rsp
+  struct sys_info info1, info2;
+  char *p, *q;
+  int i, pid;
+
+  printf(stdout, "anontest\n");
+    11b6:	8b 05 64 17 00 00    	mov    0x1764(%rip),%eax        # 2920 <stdout>
+    11bc:	48 8d 15 7a 13 00 00 	lea    0x137a(%rip),%rdx        # 253d <malloc+0x47c>
+    11c3:	48 89 d6             	mov    %rdx,%rsi
+    11c6:	89 c7                	mov    %eax,%edi
+    11c8:	b8 00 00 00 00       	mov    $0x0,%eax
+    11cd:	e8 6d 06 00 00       	call   183f <printf>
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE,
+    11d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    11d8:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    11de:	b9 22 00 00 00       	mov    $0x22,%ecx
+    11e3:	ba 03 00 00 00       	mov    $0x3,%edx
+    11e8:	be 00 00 04 00       	mov    $0x40000,%esi
+    11ed:	bf 00 00 00 00       	mov    $0x0,%edi
+    11f2:	e8 af 0c 00 00       	call   1ea6 <mmap2>
+    11f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  q = mmap2(0, 2 * PGSIZE, PROT_READ | PROT_WRITE,
+    11fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1201:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1207:	b9 21 00 00 00       	mov    $0x21,%ecx
+    120c:	ba 03 00 00 00       	mov    $0x3,%edx
+    1211:	be 00 20 00 00       	mov    $0x2000,%esi
+    1216:	bf 00 00 00 00       	mov    $0x0,%edi
+    121b:	e8 86 0c 00 00       	call   1ea6 <mmap2>
+    1220:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED || q == MAP_FAILED)
+    1224:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+    1229:	74 07                	je     1232 <anontest+0x84>
+    122b:	48 83 7d e8 ff       	cmpq   $0xffffffffffffffff,-0x18(%rbp)
+    1230:	75 5c                	jne    128e <anontest+0xe0>
+    error("anonymous mmap2 failed");
+    1232:	8b 05 e8 16 00 00    	mov    0x16e8(%rip),%eax        # 2920 <stdout>
+    1238:	ba c5 00 00 00       	mov    $0xc5,%edx
+    123d:	48 8d 0d 04 10 00 00 	lea    0x1004(%rip),%rcx        # 2248 <malloc+0x187>
+    1244:	48 89 ce             	mov    %rcx,%rsi
+    1247:	89 c7                	mov    %eax,%edi
+    1249:	b8 00 00 00 00       	mov    $0x0,%eax
+    124e:	e8 ec 05 00 00       	call   183f <printf>
+    1253:	8b 05 c7 16 00 00    	mov    0x16c7(%rip),%eax        # 2920 <stdout>
+    1259:	48 8d 15 e7 12 00 00 	lea    0x12e7(%rip),%rdx        # 2547 <malloc+0x486>
+    1260:	48 89 d6             	mov    %rdx,%rsi
+    1263:	89 c7                	mov    %eax,%edi
+    1265:	b8 00 00 00 00       	mov    $0x0,%eax
+    126a:	e8 d0 05 00 00       	call   183f <printf>
+    126f:	8b 05 ab 16 00 00    	mov    0x16ab(%rip),%eax        # 2920 <stdout>
+    1275:	48 8d 15 f2 0f 00 00 	lea    0xff2(%rip),%rdx        # 226e <malloc+0x1ad>
+    127c:	48 89 d6             	mov    %rdx,%rsi
+    127f:	89 c7                	mov    %eax,%edi
+    1281:	b8 00 00 00 00       	mov    $0x0,%eax
+    1286:	e8 b4 05 00 00       	call   183f <printf>
+    128b:	90                   	nop
+    128c:	eb fd                	jmp    128b <anontest+0xdd>
+  for(i = 0; i < NPAGES * PGSIZE; i += PGSIZE / 4)
+    128e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1295:	eb 77                	jmp    130e <anontest+0x160>
+    if(p[i] != 0)
+    1297:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    129a:	48 63 d0             	movslq %eax,%rdx
+    129d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    12a1:	48 01 d0             	add    %rdx,%rax
+    12a4:	0f b6 00             	movzbl (%rax),%eax
+    12a7:	84 c0                	test   %al,%al
+    12a9:	74 5c                	je     1307 <anontest+0x159>
+      error("anonymous memory is not zeroed");
+    12ab:	8b 05 6f 16 00 00    	mov    0x166f(%rip),%eax        # 2920 <stdout>
+    12b1:	ba c8 00 00 00       	mov    $0xc8,%edx
+    12b6:	48 8d 0d 8b 0f 00 00 	lea    0xf8b(%rip),%rcx        # 2248 <malloc+0x187>
+    12bd:	48 89 ce             	mov    %rcx,%rsi
+    12c0:	89 c7                	mov    %eax,%edi
+    12c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12c7:	e8 73 05 00 00       	call   183f <printf>
+    12cc:	8b 05 4e 16 00 00    	mov    0x164e(%rip),%eax        # 2920 <stdout>
+    12d2:	48 8d 15 87 12 00 00 	lea    0x1287(%rip),%rdx        # 2560 <malloc+0x49f>
+    12d9:	48 89 d6             	mov    %rdx,%rsi
+    12dc:	89 c7                	mov    %eax,%edi
+    12de:	b8 00 00 00 00       	mov    $0x0,%eax
+    12e3:	e8 57 05 00 00       	call   183f <printf>
+    12e8:	8b 05 32 16 00 00    	mov    0x1632(%rip),%eax        # 2920 <stdout>
+    12ee:	48 8d 15 79 0f 00 00 	lea    0xf79(%rip),%rdx        # 226e <malloc+0x1ad>
+    12f5:	48 89 d6             	mov    %rdx,%rsi
+    12f8:	89 c7                	mov    %eax,%edi
+    12fa:	b8 00 00 00 00       	mov    $0x0,%eax
+    12ff:	e8 3b 05 00 00       	call   183f <printf>
+    1304:	90                   	nop
+    1305:	eb fd                	jmp    1304 <anontest+0x156>
+  for(i = 0; i < NPAGES * PGSIZE; i += PGSIZE / 4)
+    1307:	81 45 fc 00 04 00 00 	addl   $0x400,-0x4(%rbp)
+    130e:	81 7d fc ff ff 03 00 	cmpl   $0x3ffff,-0x4(%rbp)
+    1315:	7e 80                	jle    1297 <anontest+0xe9>
+  p[0] = 'p';
+    1317:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    131b:	c6 00 70             	movb   $0x70,(%rax)
+
+  // the child shares q, and gets its own copy of p
+  pid = fork();
+    131e:	e8 bb 0a 00 00       	call   1dde <fork>
+    1323:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if(pid < 0)
+    1326:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    132a:	79 5c                	jns    1388 <anontest+0x1da>
+    error("fork failed");
+    132c:	8b 05 ee 15 00 00    	mov    0x15ee(%rip),%eax        # 2920 <stdout>
+    1332:	ba ce 00 00 00       	mov    $0xce,%edx
+    1337:	48 8d 0d 0a 0f 00 00 	lea    0xf0a(%rip),%rcx        # 2248 <malloc+0x187>
+    133e:	48 89 ce             	mov    %rcx,%rsi
+    1341:	89 c7                	mov    %eax,%edi
+    1343:	b8 00 00 00 00       	mov    $0x0,%eax
+    1348:	e8 f2 04 00 00       	call   183f <printf>
+    134d:	8b 05 cd 15 00 00    	mov    0x15cd(%rip),%eax        # 2920 <stdout>
+    1353:	48 8d 15 e6 0f 00 00 	lea    0xfe6(%rip),%rdx        # 2340 <malloc+0x27f>
+    135a:	48 89 d6             	mov    %rdx,%rsi
+    135d:	89 c7                	mov    %eax,%edi
+    135f:	b8 00 00 00 00       	mov    $0x0,%eax
+    1364:	e8 d6 04 00 00       	call   183f <printf>
+    1369:	8b 05 b1 15 00 00    	mov    0x15b1(%rip),%eax        # 2920 <stdout>
+    136f:	48 8d 15 f8 0e 00 00 	lea    0xef8(%rip),%rdx        # 226e <malloc+0x1ad>
+    1376:	48 89 d6             	mov    %rdx,%rsi
+    1379:	89 c7                	mov    %eax,%edi
+    137b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1380:	e8 ba 04 00 00       	call   183f <printf>
+    1385:	90                   	nop
+    1386:	eb fd                	jmp    1385 <anontest+0x1d7>
+  if(pid == 0){
+    1388:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+    138c:	75 19                	jne    13a7 <anontest+0x1f9>
+    p[0] = 'c';
+    138e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1392:	c6 00 63             	movb   $0x63,(%rax)
+    q[PGSIZE] = 'c';
+    1395:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1399:	48 05 00 10 00 00    	add    $0x1000,%rax
+    139f:	c6 00 63             	movb   $0x63,(%rax)
+    exit();
+    13a2:	e8 3f 0a 00 00       	call   1de6 <exit>
+  }
+  wait();
+    13a7:	e8 42 0a 00 00       	call   1dee <wait>
+  if(p[0] != 'p' || q[PGSIZE] != 'c')
+    13ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13b0:	0f b6 00             	movzbl (%rax),%eax
+    13b3:	3c 70                	cmp    $0x70,%al
+    13b5:	75 11                	jne    13c8 <anontest+0x21a>
+    13b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13bb:	48 05 00 10 00 00    	add    $0x1000,%rax
+    13c1:	0f b6 00             	movzbl (%rax),%eax
+    13c4:	3c 63                	cmp    $0x63,%al
+    13c6:	74 5c                	je     1424 <anontest+0x276>
+    error("anonymous mappings were not copied/shared across fork");
+    13c8:	8b 05 52 15 00 00    	mov    0x1552(%rip),%eax        # 2920 <stdout>
+    13ce:	ba d6 00 00 00       	mov    $0xd6,%edx
+    13d3:	48 8d 0d 6e 0e 00 00 	lea    0xe6e(%rip),%rcx        # 2248 <malloc+0x187>
+    13da:	48 89 ce             	mov    %rcx,%rsi
+    13dd:	89 c7                	mov    %eax,%edi
+    13df:	b8 00 00 00 00       	mov    $0x0,%eax
+    13e4:	e8 56 04 00 00       	call   183f <printf>
+    13e9:	8b 05 31 15 00 00    	mov    0x1531(%rip),%eax        # 2920 <stdout>
+    13ef:	48 8d 15 8a 11 00 00 	lea    0x118a(%rip),%rdx        # 2580 <malloc+0x4bf>
+    13f6:	48 89 d6             	mov    %rdx,%rsi
+    13f9:	89 c7                	mov    %eax,%edi
+    13fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1400:	e8 3a 04 00 00       	call   183f <printf>
+    1405:	8b 05 15 15 00 00    	mov    0x1515(%rip),%eax        # 2920 <stdout>
+    140b:	48 8d 15 5c 0e 00 00 	lea    0xe5c(%rip),%rdx        # 226e <malloc+0x1ad>
+    1412:	48 89 d6             	mov    %rdx,%rsi
+    1415:	89 c7                	mov    %eax,%edi
+    1417:	b8 00 00 00 00       	mov    $0x0,%eax
+    141c:	e8 1e 04 00 00       	call   183f <printf>
+    1421:	90                   	nop
+    1422:	eb fd                	jmp    1421 <anontest+0x273>
+
+  // unmapping gives the pages back
+  sysinfo(&info1);
+    1424:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1428:	48 89 c7             	mov    %rax,%rdi
+    142b:	e8 56 0a 00 00       	call   1e86 <sysinfo>
+  if(munmap2(p, NPAGES * PGSIZE) < 0 || munmap2(q, 2 * PGSIZE) < 0)
+    1430:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1434:	be 00 00 04 00       	mov    $0x40000,%esi
+    1439:	48 89 c7             	mov    %rax,%rdi
+    143c:	e8 74 0a 00 00       	call   1eb5 <munmap2>
+    1441:	85 c0                	test   %eax,%eax
+    1443:	78 15                	js     145a <anontest+0x2ac>
+    1445:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1449:	be 00 20 00 00       	mov    $0x2000,%esi
+    144e:	48 89 c7             	mov    %rax,%rdi
+    1451:	e8 5f 0a 00 00       	call   1eb5 <munmap2>
+    1456:	85 c0                	test   %eax,%eax
+    1458:	79 5c                	jns    14b6 <anontest+0x308>
+    error("munmap2 failed");
+    145a:	8b 05 c0 14 00 00    	mov    0x14c0(%rip),%eax        # 2920 <stdout>
+    1460:	ba db 00 00 00       	mov    $0xdb,%edx
+    1465:	48 8d 0d dc 0d 00 00 	lea    0xddc(%rip),%rcx        # 2248 <malloc+0x187>
+    146c:	48 89 ce             	mov    %rcx,%rsi
+    146f:	89 c7                	mov    %eax,%edi
+    1471:	b8 00 00 00 00       	mov    $0x0,%eax
+    1476:	e8 c4 03 00 00       	call   183f <printf>
+    147b:	8b 05 9f 14 00 00    	mov    0x149f(%rip),%eax        # 2920 <stdout>
+    1481:	48 8d 15 90 0e 00 00 	lea    0xe90(%rip),%rdx        # 2318 <malloc+0x257>
+    1488:	48 89 d6             	mov    %rdx,%rsi
+    148b:	89 c7                	mov    %eax,%edi
+    148d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1492:	e8 a8 03 00 00       	call   183f <printf>
+    1497:	8b 05 83 14 00 00    	mov    0x1483(%rip),%eax        # 2920 <stdout>
+    149d:	48 8d 15 ca 0d 00 00 	lea    0xdca(%rip),%rdx        # 226e <malloc+0x1ad>
+    14a4:	48 89 d6             	mov    %rdx,%rsi
+    14a7:	89 c7                	mov    %eax,%edi
+    14a9:	b8 00 00 00 00       	mov    $0x0,%eax
+    14ae:	e8 8c 03 00 00       	call   183f <printf>
+    14b3:	90                   	nop
+    14b4:	eb fd                	jmp    14b3 <anontest+0x305>
+  sysinfo(&info2);
+    14b6:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+    14ba:	48 89 c7             	mov    %rax,%rdi
+    14bd:	e8 c4 09 00 00       	call   1e86 <sysinfo>
+  if(info1.pages_in_use - info2.pages_in_use < NPAGES)
+    14c2:	8b 55 d0             	mov    -0x30(%rbp),%edx
+    14c5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    14c8:	29 c2                	sub    %eax,%edx
+    14ca:	83 fa 3f             	cmp    $0x3f,%edx
+    14cd:	7f 64                	jg     1533 <anontest+0x385>
+    error("only %d pages freed", info1.pages_in_use - info2.pages_in_use);
+    14cf:	8b 05 4b 14 00 00    	mov    0x144b(%rip),%eax        # 2920 <stdout>
+    14d5:	ba de 00 00 00       	mov    $0xde,%edx
+    14da:	48 8d 0d 67 0d 00 00 	lea    0xd67(%rip),%rcx        # 2248 <malloc+0x187>
+    14e1:	48 89 ce             	mov    %rcx,%rsi
+    14e4:	89 c7                	mov    %eax,%edi
+    14e6:	b8 00 00 00 00       	mov    $0x0,%eax
+    14eb:	e8 4f 03 00 00       	call   183f <printf>
+    14f0:	8b 55 d0             	mov    -0x30(%rbp),%edx
+    14f3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    14f6:	29 c2                	sub    %eax,%edx
+    14f8:	8b 05 22 14 00 00    	mov    0x1422(%rip),%eax        # 2920 <stdout>
+    14fe:	48 8d 0d b1 10 00 00 	lea    0x10b1(%rip),%rcx        # 25b6 <malloc+0x4f5>
+    1505:	48 89 ce             	mov    %rcx,%rsi
+    1508:	89 c7                	mov    %eax,%edi
+    150a:	b8 00 00 00 00       	mov    $0x0,%eax
+    150f:	e8 2b 03 00 00       	call   183f <printf>
+    1514:	8b 05 06 14 00 00    	mov    0x1406(%rip),%eax        # 2920 <stdout>
+    151a:	48 8d 15 4d 0d 00 00 	lea    0xd4d(%rip),%rdx        # 226e <malloc+0x1ad>
+    1521:	48 89 d6             	mov    %rdx,%rsi
+    1524:	89 c7                	mov    %eax,%edi
+    1526:	b8 00 00 00 00       	mov    $0x0,%eax
+    152b:	e8 0f 03 00 00       	call   183f <printf>
+    1530:	90                   	nop
+    1531:	eb fd                	jmp    1530 <anontest+0x382>
+
+  // so does free for big blocks
+  p = malloc(NPAGES * PGSIZE);
+    1533:	bf 00 00 04 00       	mov    $0x40000,%edi
+    1538:	e8 84 0b 00 00       	call   20c1 <malloc>
+    153d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  memset(p, 1, NPAGES * PGSIZE);
+    1541:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1545:	ba 00 00 04 00       	mov    $0x40000,%edx
+    154a:	be 01 00 00 00       	mov    $0x1,%esi
+    154f:	48 89 c7             	mov    %rax,%rdi
+    1552:	e8 a6 06 00 00       	call   1bfd <memset>
+  sysinfo(&info1);
+    1557:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    155b:	48 89 c7             	mov    %rax,%rdi
+    155e:	e8 23 09 00 00       	call   1e86 <sysinfo>
+  free(p);
+    1563:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1567:	48 89 c7             	mov    %rax,%rdi
+    156a:	e8 96 09 00 00       	call   1f05 <free>
+  sysinfo(&info2);
+    156f:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+    1573:	48 89 c7             	mov    %rax,%rdi
+    1576:	e8 0b 09 00 00       	call   1e86 <sysinfo>
+  if(info1.pages_in_use - info2.pages_in_use < NPAGES)
+    157b:	8b 55 d0             	mov    -0x30(%rbp),%edx
+    157e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    1581:	29 c2                	sub    %eax,%edx
+    1583:	83 fa 3f             	cmp    $0x3f,%edx
+    1586:	7f 6f                	jg     15f7 <anontest+0x449>
+    error("free kept %d pages", NPAGES - (info1.pages_in_use - info2.pages_in_use));
+    1588:	8b 05 92 13 00 00    	mov    0x1392(%rip),%eax        # 2920 <stdout>
+    158e:	ba e7 00 00 00       	mov    $0xe7,%edx
+    1593:	48 8d 0d ae 0c 00 00 	lea    0xcae(%rip),%rcx        # 2248 <malloc+0x187>
+    159a:	48 89 ce             	mov    %rcx,%rsi
+    159d:	89 c7                	mov    %eax,%edi
+    159f:	b8 00 00 00 00       	mov    $0x0,%eax
+    15a4:	e8 96 02 00 00       	call   183f <printf>
+    15a9:	8b 55 d0             	mov    -0x30(%rbp),%edx
+    15ac:	8b 45 bc             	mov    -0x44(%rbp),%eax
+    15af:	89 d1                	mov    %edx,%ecx
+    15b1:	29 c1                	sub    %eax,%ecx
+    15b3:	b8 40 00 00 00       	mov    $0x40,%eax
+    15b8:	29 c8                	sub    %ecx,%eax
+    15ba:	89 c2                	mov    %eax,%edx
+    15bc:	8b 05 5e 13 00 00    	mov    0x135e(%rip),%eax        # 2920 <stdout>
+    15c2:	48 8d 0d 01 10 00 00 	lea    0x1001(%rip),%rcx        # 25ca <malloc+0x509>
+    15c9:	48 89 ce             	mov    %rcx,%rsi
+    15cc:	89 c7                	mov    %eax,%edi
+    15ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    15d3:	e8 67 02 00 00       	call   183f <printf>
+    15d8:	8b 05 42 13 00 00    	mov    0x1342(%rip),%eax        # 2920 <stdout>
+    15de:	48 8d 15 89 0c 00 00 	lea    0xc89(%rip),%rdx        # 226e <malloc+0x1ad>
+    15e5:	48 89 d6             	mov    %rdx,%rsi
+    15e8:	89 c7                	mov    %eax,%edi
+    15ea:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ef:	e8 4b 02 00 00       	call   183f <printf>
+    15f4:	90                   	nop
+    15f5:	eb fd                	jmp    15f4 <anontest+0x446>
+  printf(stdout, "anontest OK\n");
+    15f7:	8b 05 23 13 00 00    	mov    0x1323(%rip),%eax        # 2920 <stdout>
+    15fd:	48 8d 15 d9 0f 00 00 	lea    0xfd9(%rip),%rdx        # 25dd <malloc+0x51c>
+    1604:	48 89 d6             	mov    %rdx,%rsi
+    1607:	89 c7                	mov    %eax,%edi
+    1609:	b8 00 00 00 00       	mov    $0x0,%eax
+    160e:	e8 2c 02 00 00       	call   183f <printf>
+}
+    1613:	90                   	nop
+    1614:	c9                   	leave
+    1615:	c3                   	ret
+
+0000000000001616 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    1616:	55                   	push   %rbp
+    1617:	48 89 e5             	mov    %rsp,%rbp
+    161a:	48 83 ec 10          	sub    $0x10,%rsp
+    161e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1621:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  makefile("mmap1.txt");
+    1625:	48 8d 05 6c 0c 00 00 	lea    0xc6c(%rip),%rax        # 2298 <malloc+0x1d7>
+    162c:	48 89 c7             	mov    %rax,%rdi
+    162f:	e8 cc e9 ff ff       	call   0 <makefile>
+  lazytest();
+    1634:	e8 2f eb ff ff       	call   168 <lazytest>
+  sharedtest();
+    1639:	e8 ff ed ff ff       	call   43d <sharedtest>
+  privatetest();
+    163e:	e8 3e f3 ff ff       	call   981 <privatetest>
+  invalidtest();
+    1643:	e8 07 f7 ff ff       	call   d4f <invalidtest>
+  anontest();
+    1648:	e8 61 fb ff ff       	call   11ae <anontest>
+  unlink("mmap1.txt");
+    164d:	48 8d 05 44 0c 00 00 	lea    0xc44(%rip),%rax        # 2298 <malloc+0x1d7>
+    1654:	48 89 c7             	mov    %rax,%rdi
+    1657:	e8 da 07 00 00       	call   1e36 <unlink>
+
+  printf(stdout, "mmaptest passed!\n");
+    165c:	8b 05 be 12 00 00    	mov    0x12be(%rip),%eax        # 2920 <stdout>
+    1662:	48 8d 15 81 0f 00 00 	lea    0xf81(%rip),%rdx        # 25ea <malloc+0x529>
+    1669:	48 89 d6             	mov    %rdx,%rsi
+    166c:	89 c7                	mov    %eax,%edi
+    166e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1673:	e8 c7 01 00 00       	call   183f <printf>
+  exit();
+    1678:	e8 69 07 00 00       	call   1de6 <exit>
+
+000000000000167d <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    167d:	55                   	push   %rbp
+    167e:	48 89 e5             	mov    %rsp,%rbp
+    1681:	48 83 ec 10          	sub    $0x10,%rsp
+    1685:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1688:	89 f0                	mov    %esi,%eax
+    168a:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    168d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    1691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1694:	ba 01 00 00 00       	mov    $0x1,%edx
+    1699:	48 89 ce             	mov    %rcx,%rsi
+    169c:	89 c7                	mov    %eax,%edi
+    169e:	e8 63 07 00 00       	call   1e06 <write>
+}
+    16a3:	90                   	nop
+    16a4:	c9                   	leave
+    16a5:	c3                   	ret
+
+00000000000016a6 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    16a6:	55                   	push   %rbp
+    16a7:	48 89 e5             	mov    %rsp,%rbp
+    16aa:	48 83 ec 40          	sub    $0x40,%rsp
+    16ae:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    16b1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    16b4:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    16b7:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    16ba:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    16be:	74 1f                	je     16df <printint64+0x39>
+    16c0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    16c3:	c1 e8 1f             	shr    $0x1f,%eax
+    16c6:	0f b6 c0             	movzbl %al,%eax
+    16c9:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    16cc:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    16d0:	74 0d                	je     16df <printint64+0x39>
+    x = -xx;
+    16d2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    16d5:	f7 d8                	neg    %eax
+    16d7:	48 98                	cltq
+    16d9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16dd:	eb 09                	jmp    16e8 <printint64+0x42>
+  else
+    x = xx;
+    16df:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    16e2:	48 98                	cltq
+    16e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    16e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    16ef:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    16f2:	48 63 c8             	movslq %eax,%rcx
+    16f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16f9:	ba 00 00 00 00       	mov    $0x0,%edx
+    16fe:	48 f7 f1             	div    %rcx
+    1701:	48 89 d1             	mov    %rdx,%rcx
+    1704:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1707:	8d 50 01             	lea    0x1(%rax),%edx
+    170a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    170d:	48 8d 15 1c 12 00 00 	lea    0x121c(%rip),%rdx        # 2930 <digits.1>
+    1714:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1718:	48 98                	cltq
+    171a:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    171e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1721:	48 63 f0             	movslq %eax,%rsi
+    1724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1728:	ba 00 00 00 00       	mov    $0x0,%edx
+    172d:	48 f7 f6             	div    %rsi
+    1730:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1734:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1739:	75 b4                	jne    16ef <printint64+0x49>
+
+  if(sgn)
+    173b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    173f:	74 2b                	je     176c <printint64+0xc6>
+    buf[i++] = '-';
+    1741:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1744:	8d 50 01             	lea    0x1(%rax),%edx
+    1747:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    174a:	48 98                	cltq
+    174c:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1751:	eb 19                	jmp    176c <printint64+0xc6>
+    putc(fd, buf[i]);
+    1753:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1756:	48 98                	cltq
+    1758:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    175d:	0f be d0             	movsbl %al,%edx
+    1760:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1763:	89 d6                	mov    %edx,%esi
+    1765:	89 c7                	mov    %eax,%edi
+    1767:	e8 11 ff ff ff       	call   167d <putc>
+  while(--i >= 0)
+    176c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1770:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1774:	79 dd                	jns    1753 <printint64+0xad>
+}
+    1776:	90                   	nop
+    1777:	90                   	nop
+    1778:	c9                   	leave
+    1779:	c3                   	ret
+
+000000000000177a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    177a:	55                   	push   %rbp
+    177b:	48 89 e5             	mov    %rsp,%rbp
+    177e:	48 83 ec 30          	sub    $0x30,%rsp
+    1782:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1785:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1788:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    178b:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    178e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    1795:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1799:	74 17                	je     17b2 <printint+0x38>
+    179b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    179f:	79 11                	jns    17b2 <printint+0x38>
+    neg = 1;
+    17a1:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    17a8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    17ab:	f7 d8                	neg    %eax
+    17ad:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    17b0:	eb 06                	jmp    17b8 <printint+0x3e>
+  } else {
+    x = xx;
+    17b2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    17b5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    17b8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    17bf:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    17c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    17c5:	ba 00 00 00 00       	mov    $0x0,%edx
+    17ca:	f7 f1                	div    %ecx
+    17cc:	89 d1                	mov    %edx,%ecx
+    17ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17d1:	8d 50 01             	lea    0x1(%rax),%edx
+    17d4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    17d7:	89 c9                	mov    %ecx,%ecx
+    17d9:	48 8d 15 70 11 00 00 	lea    0x1170(%rip),%rdx        # 2950 <digits.0>
+    17e0:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    17e4:	48 98                	cltq
+    17e6:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    17ea:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    17ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    17f0:	ba 00 00 00 00       	mov    $0x0,%edx
+    17f5:	f7 f6                	div    %esi
+    17f7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    17fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    17fe:	75 bf                	jne    17bf <printint+0x45>
+  if(neg)
+    1800:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1804:	74 2b                	je     1831 <printint+0xb7>
+    buf[i++] = '-';
+    1806:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1809:	8d 50 01             	lea    0x1(%rax),%edx
+    180c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    180f:	48 98                	cltq
+    1811:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1816:	eb 19                	jmp    1831 <printint+0xb7>
+    putc(fd, buf[i]);
+    1818:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    181b:	48 98                	cltq
+    181d:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1822:	0f be d0             	movsbl %al,%edx
+    1825:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1828:	89 d6                	mov    %edx,%esi
+    182a:	89 c7                	mov    %eax,%edi
+    182c:	e8 4c fe ff ff       	call   167d <putc>
+  while(--i >= 0)
+    1831:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1835:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1839:	79 dd                	jns    1818 <printint+0x9e>
+}
+    183b:	90                   	nop
+    183c:	90                   	nop
+    183d:	c9                   	leave
+    183e:	c3                   	ret
+
+000000000000183f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    183f:	55                   	push   %rbp
+    1840:	48 89 e5             	mov    %rsp,%rbp
+    1843:	48 83 ec 70          	sub    $0x70,%rsp
+    1847:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    184a:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    184e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1852:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1856:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    185a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    185e:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1865:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1869:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    186d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    1871:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1875:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    187c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1883:	e9 6b 02 00 00       	jmp    1af3 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1888:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    188b:	48 63 d0             	movslq %eax,%rdx
+    188e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1892:	48 01 d0             	add    %rdx,%rax
+    1895:	0f b6 00             	movzbl (%rax),%eax
+    1898:	0f be c0             	movsbl %al,%eax
+    189b:	25 ff 00 00 00       	and    $0xff,%eax
+    18a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    18a3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    18a7:	75 30                	jne    18d9 <printf+0x9a>
+      if(c == '%'){
+    18a9:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    18ad:	75 13                	jne    18c2 <printf+0x83>
+        state = '%';
+    18af:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    18b6:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    18bd:	e9 2d 02 00 00       	jmp    1aef <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    18c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    18c5:	0f be d0             	movsbl %al,%edx
+    18c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    18cb:	89 d6                	mov    %edx,%esi
+    18cd:	89 c7                	mov    %eax,%edi
+    18cf:	e8 a9 fd ff ff       	call   167d <putc>
+    18d4:	e9 16 02 00 00       	jmp    1aef <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    18d9:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    18dd:	0f 85 0c 02 00 00    	jne    1aef <printf+0x2b0>
+      if(c == 'l') {
+    18e3:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    18e7:	75 0c                	jne    18f5 <printf+0xb6>
+        lflag = 1;
+    18e9:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    18f0:	e9 fa 01 00 00       	jmp    1aef <printf+0x2b0>
+      } else if(c == 'd'){
+    18f5:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    18f9:	0f 85 95 00 00 00    	jne    1994 <printf+0x155>
+        if (lflag == 1)
+    18ff:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1903:	75 49                	jne    194e <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1905:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1908:	83 f8 2f             	cmp    $0x2f,%eax
+    190b:	77 17                	ja     1924 <printf+0xe5>
+    190d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1911:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1914:	89 d2                	mov    %edx,%edx
+    1916:	48 01 d0             	add    %rdx,%rax
+    1919:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    191c:	83 c2 08             	add    $0x8,%edx
+    191f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1922:	eb 0c                	jmp    1930 <printf+0xf1>
+    1924:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1928:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    192c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1930:	48 8b 00             	mov    (%rax),%rax
+    1933:	89 c6                	mov    %eax,%esi
+    1935:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1938:	b9 01 00 00 00       	mov    $0x1,%ecx
+    193d:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1942:	89 c7                	mov    %eax,%edi
+    1944:	e8 5d fd ff ff       	call   16a6 <printint64>
+    1949:	e9 9a 01 00 00       	jmp    1ae8 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    194e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1951:	83 f8 2f             	cmp    $0x2f,%eax
+    1954:	77 17                	ja     196d <printf+0x12e>
+    1956:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    195a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    195d:	89 d2                	mov    %edx,%edx
+    195f:	48 01 d0             	add    %rdx,%rax
+    1962:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1965:	83 c2 08             	add    $0x8,%edx
+    1968:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    196b:	eb 0c                	jmp    1979 <printf+0x13a>
+    196d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1971:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1975:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1979:	8b 30                	mov    (%rax),%esi
+    197b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    197e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1983:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1988:	89 c7                	mov    %eax,%edi
+    198a:	e8 eb fd ff ff       	call   177a <printint>
+    198f:	e9 54 01 00 00       	jmp    1ae8 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    1994:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1998:	74 0a                	je     19a4 <printf+0x165>
+    199a:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    199e:	0f 85 95 00 00 00    	jne    1a39 <printf+0x1fa>
+        if (lflag == 1)
+    19a4:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    19a8:	75 49                	jne    19f3 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    19aa:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    19ad:	83 f8 2f             	cmp    $0x2f,%eax
+    19b0:	77 17                	ja     19c9 <printf+0x18a>
+    19b2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    19b6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19b9:	89 d2                	mov    %edx,%edx
+    19bb:	48 01 d0             	add    %rdx,%rax
+    19be:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    19c1:	83 c2 08             	add    $0x8,%edx
+    19c4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    19c7:	eb 0c                	jmp    19d5 <printf+0x196>
+    19c9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    19cd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    19d1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    19d5:	48 8b 00             	mov    (%rax),%rax
+    19d8:	89 c6                	mov    %eax,%esi
+    19da:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    19dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+    19e2:	ba 10 00 00 00       	mov    $0x10,%edx
+    19e7:	89 c7                	mov    %eax,%edi
+    19e9:	e8 b8 fc ff ff       	call   16a6 <printint64>
+        if (lflag == 1)
+    19ee:	e9 f5 00 00 00       	jmp    1ae8 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    19f3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    19f6:	83 f8 2f             	cmp    $0x2f,%eax
+    19f9:	77 17                	ja     1a12 <printf+0x1d3>
+    19fb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    19ff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a02:	89 d2                	mov    %edx,%edx
+    1a04:	48 01 d0             	add    %rdx,%rax
+    1a07:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a0a:	83 c2 08             	add    $0x8,%edx
+    1a0d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a10:	eb 0c                	jmp    1a1e <printf+0x1df>
+    1a12:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a16:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a1a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a1e:	8b 30                	mov    (%rax),%esi
+    1a20:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1a23:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1a28:	ba 10 00 00 00       	mov    $0x10,%edx
+    1a2d:	89 c7                	mov    %eax,%edi
+    1a2f:	e8 46 fd ff ff       	call   177a <printint>
+        if (lflag == 1)
+    1a34:	e9 af 00 00 00       	jmp    1ae8 <printf+0x2a9>
+      } else if(c == 's'){
+    1a39:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1a3d:	75 6e                	jne    1aad <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    1a3f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1a42:	83 f8 2f             	cmp    $0x2f,%eax
+    1a45:	77 17                	ja     1a5e <printf+0x21f>
+    1a47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1a4b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a4e:	89 d2                	mov    %edx,%edx
+    1a50:	48 01 d0             	add    %rdx,%rax
+    1a53:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1a56:	83 c2 08             	add    $0x8,%edx
+    1a59:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1a5c:	eb 0c                	jmp    1a6a <printf+0x22b>
+    1a5e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1a62:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1a66:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1a6a:	48 8b 00             	mov    (%rax),%rax
+    1a6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    1a71:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1a76:	75 28                	jne    1aa0 <printf+0x261>
+          s = "(null)";
+    1a78:	48 8d 05 7d 0b 00 00 	lea    0xb7d(%rip),%rax        # 25fc <malloc+0x53b>
+    1a7f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    1a83:	eb 1b                	jmp    1aa0 <printf+0x261>
+          putc(fd, *s);
+    1a85:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1a89:	0f b6 00             	movzbl (%rax),%eax
+    1a8c:	0f be d0             	movsbl %al,%edx
+    1a8f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1a92:	89 d6                	mov    %edx,%esi
+    1a94:	89 c7                	mov    %eax,%edi
+    1a96:	e8 e2 fb ff ff       	call   167d <putc>
+        for(; *s; s++)
+    1a9b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    1aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1aa4:	0f b6 00             	movzbl (%rax),%eax
+    1aa7:	84 c0                	test   %al,%al
+    1aa9:	75 da                	jne    1a85 <printf+0x246>
+    1aab:	eb 3b                	jmp    1ae8 <printf+0x2a9>
+      } else if(c == '%'){
+    1aad:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1ab1:	75 14                	jne    1ac7 <printf+0x288>
+        putc(fd, c);
+    1ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1ab6:	0f be d0             	movsbl %al,%edx
+    1ab9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1abc:	89 d6                	mov    %edx,%esi
+    1abe:	89 c7                	mov    %eax,%edi
+    1ac0:	e8 b8 fb ff ff       	call   167d <putc>
+    1ac5:	eb 21                	jmp    1ae8 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1ac7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1aca:	be 25 00 00 00       	mov    $0x25,%esi
+    1acf:	89 c7                	mov    %eax,%edi
+    1ad1:	e8 a7 fb ff ff       	call   167d <putc>
+        putc(fd, c);
+    1ad6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1ad9:	0f be d0             	movsbl %al,%edx
+    1adc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1adf:	89 d6                	mov    %edx,%esi
+    1ae1:	89 c7                	mov    %eax,%edi
+    1ae3:	e8 95 fb ff ff       	call   167d <putc>
+      }
+      state = 0;
+    1ae8:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1aef:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1af3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1af6:	48 63 d0             	movslq %eax,%rdx
+    1af9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1afd:	48 01 d0             	add    %rdx,%rax
+    1b00:	0f b6 00             	movzbl (%rax),%eax
+    1b03:	84 c0                	test   %al,%al
+    1b05:	0f 85 7d fd ff ff    	jne    1888 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1b0b:	90                   	nop
+    1b0c:	90                   	nop
+    1b0d:	c9                   	leave
+    1b0e:	c3                   	ret
+
+0000000000001b0f <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    1b0f:	55                   	push   %rbp
+    1b10:	48 89 e5             	mov    %rsp,%rbp
+    1b13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1b1a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    1b1d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1b21:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1b24:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1b27:	48 89 ce             	mov    %rcx,%rsi
+    1b2a:	48 89 f7             	mov    %rsi,%rdi
+    1b2d:	89 d1                	mov    %edx,%ecx
+    1b2f:	fc                   	cld
+    1b30:	f3 aa                	rep stos %al,%es:(%rdi)
+    1b32:	89 ca                	mov    %ecx,%edx
+    1b34:	48 89 fe             	mov    %rdi,%rsi
+    1b37:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1b3b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    1b3e:	90                   	nop
+    1b3f:	5d                   	pop    %rbp
+    1b40:	c3                   	ret
+
+0000000000001b41 <strcpy>:
+{
+    1b41:	55                   	push   %rbp
+    1b42:	48 89 e5             	mov    %rsp,%rbp
+    1b45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b49:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1b4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1b55:	90                   	nop
+    1b56:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1b5a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1b5e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1b62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b66:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1b6a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1b6e:	0f b6 12             	movzbl (%rdx),%edx
+    1b71:	88 10                	mov    %dl,(%rax)
+    1b73:	0f b6 00             	movzbl (%rax),%eax
+    1b76:	84 c0                	test   %al,%al
+    1b78:	75 dc                	jne    1b56 <strcpy+0x15>
+  return os;
+    1b7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1b7e:	5d                   	pop    %rbp
+    1b7f:	c3                   	ret
+
+0000000000001b80 <strcmp>:
+{
+    1b80:	55                   	push   %rbp
+    1b81:	48 89 e5             	mov    %rsp,%rbp
+    1b84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1b88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1b8c:	eb 0a                	jmp    1b98 <strcmp+0x18>
+    p++, q++;
+    1b8e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1b93:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9c:	0f b6 00             	movzbl (%rax),%eax
+    1b9f:	84 c0                	test   %al,%al
+    1ba1:	74 12                	je     1bb5 <strcmp+0x35>
+    1ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba7:	0f b6 10             	movzbl (%rax),%edx
+    1baa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bae:	0f b6 00             	movzbl (%rax),%eax
+    1bb1:	38 c2                	cmp    %al,%dl
+    1bb3:	74 d9                	je     1b8e <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb9:	0f b6 00             	movzbl (%rax),%eax
+    1bbc:	0f b6 d0             	movzbl %al,%edx
+    1bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bc3:	0f b6 00             	movzbl (%rax),%eax
+    1bc6:	0f b6 c0             	movzbl %al,%eax
+    1bc9:	29 c2                	sub    %eax,%edx
+    1bcb:	89 d0                	mov    %edx,%eax
+}
+    1bcd:	5d                   	pop    %rbp
+    1bce:	c3                   	ret
+
+0000000000001bcf <strlen>:
+{
+    1bcf:	55                   	push   %rbp
+    1bd0:	48 89 e5             	mov    %rsp,%rbp
+    1bd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1bd7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1bde:	eb 04                	jmp    1be4 <strlen+0x15>
+    1be0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1be4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1be7:	48 63 d0             	movslq %eax,%rdx
+    1bea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1bee:	48 01 d0             	add    %rdx,%rax
+    1bf1:	0f b6 00             	movzbl (%rax),%eax
+    1bf4:	84 c0                	test   %al,%al
+    1bf6:	75 e8                	jne    1be0 <strlen+0x11>
+  return n;
+    1bf8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1bfb:	5d                   	pop    %rbp
+    1bfc:	c3                   	ret
+
+0000000000001bfd <memset>:
+{
+    1bfd:	55                   	push   %rbp
+    1bfe:	48 89 e5             	mov    %rsp,%rbp
+    1c01:	48 83 ec 10          	sub    $0x10,%rsp
+    1c05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c09:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1c0c:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1c0f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1c12:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1c15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c19:	89 ce                	mov    %ecx,%esi
+    1c1b:	48 89 c7             	mov    %rax,%rdi
+    1c1e:	e8 ec fe ff ff       	call   1b0f <stosb>
+  return dst;
+    1c23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1c27:	c9                   	leave
+    1c28:	c3                   	ret
+
+0000000000001c29 <strchr>:
+{
+    1c29:	55                   	push   %rbp
+    1c2a:	48 89 e5             	mov    %rsp,%rbp
+    1c2d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1c31:	89 f0                	mov    %esi,%eax
+    1c33:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1c36:	eb 17                	jmp    1c4f <strchr+0x26>
+    if(*s == c)
+    1c38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3c:	0f b6 00             	movzbl (%rax),%eax
+    1c3f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1c42:	75 06                	jne    1c4a <strchr+0x21>
+      return (char*)s;
+    1c44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c48:	eb 15                	jmp    1c5f <strchr+0x36>
+  for(; *s; s++)
+    1c4a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c53:	0f b6 00             	movzbl (%rax),%eax
+    1c56:	84 c0                	test   %al,%al
+    1c58:	75 de                	jne    1c38 <strchr+0xf>
+  return 0;
+    1c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1c5f:	5d                   	pop    %rbp
+    1c60:	c3                   	ret
+
+0000000000001c61 <gets>:
+gets(char *buf, int max)
+{
+    1c61:	55                   	push   %rbp
+    1c62:	48 89 e5             	mov    %rsp,%rbp
+    1c65:	48 83 ec 20          	sub    $0x20,%rsp
+    1c69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1c6d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    1c70:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1c77:	eb 48                	jmp    1cc1 <gets+0x60>
+    cc = read(0, &c, 1);
+    1c79:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1c7d:	ba 01 00 00 00       	mov    $0x1,%edx
+    1c82:	48 89 c6             	mov    %rax,%rsi
+    1c85:	bf 00 00 00 00       	mov    $0x0,%edi
+    1c8a:	e8 6f 01 00 00       	call   1dfe <read>
+    1c8f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1c92:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1c96:	7e 36                	jle    1cce <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1c98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1c9b:	8d 50 01             	lea    0x1(%rax),%edx
+    1c9e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1ca1:	48 63 d0             	movslq %eax,%rdx
+    1ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca8:	48 01 c2             	add    %rax,%rdx
+    1cab:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1caf:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1cb1:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1cb5:	3c 0a                	cmp    $0xa,%al
+    1cb7:	74 16                	je     1ccf <gets+0x6e>
+    1cb9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1cbd:	3c 0d                	cmp    $0xd,%al
+    1cbf:	74 0e                	je     1ccf <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1cc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cc4:	83 c0 01             	add    $0x1,%eax
+    1cc7:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1cca:	7f ad                	jg     1c79 <gets+0x18>
+    1ccc:	eb 01                	jmp    1ccf <gets+0x6e>
+      break;
+    1cce:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1ccf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1cd2:	48 63 d0             	movslq %eax,%rdx
+    1cd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cd9:	48 01 d0             	add    %rdx,%rax
+    1cdc:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1ce3:	c9                   	leave
+    1ce4:	c3                   	ret
+
+0000000000001ce5 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1ce5:	55                   	push   %rbp
+    1ce6:	48 89 e5             	mov    %rsp,%rbp
+    1ce9:	48 83 ec 20          	sub    $0x20,%rsp
+    1ced:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1cf1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1cf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1cf9:	be 00 00 00 00       	mov    $0x0,%esi
+    1cfe:	48 89 c7             	mov    %rax,%rdi
+    1d01:	e8 20 01 00 00       	call   1e26 <open>
+    1d06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1d09:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1d0d:	79 07                	jns    1d16 <stat+0x31>
+    return -1;
+    1d0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1d14:	eb 21                	jmp    1d37 <stat+0x52>
+  r = fstat(fd, st);
+    1d16:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1d1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d1d:	48 89 d6             	mov    %rdx,%rsi
+    1d20:	89 c7                	mov    %eax,%edi
+    1d22:	e8 17 01 00 00       	call   1e3e <fstat>
+    1d27:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1d2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1d2d:	89 c7                	mov    %eax,%edi
+    1d2f:	e8 da 00 00 00       	call   1e0e <close>
+  return r;
+    1d34:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1d37:	c9                   	leave
+    1d38:	c3                   	ret
+
+0000000000001d39 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1d39:	55                   	push   %rbp
+    1d3a:	48 89 e5             	mov    %rsp,%rbp
+    1d3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1d41:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1d48:	eb 28                	jmp    1d72 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1d4a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1d4d:	89 d0                	mov    %edx,%eax
+    1d4f:	c1 e0 02             	shl    $0x2,%eax
+    1d52:	01 d0                	add    %edx,%eax
+    1d54:	01 c0                	add    %eax,%eax
+    1d56:	89 c1                	mov    %eax,%ecx
+    1d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d5c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1d60:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1d64:	0f b6 00             	movzbl (%rax),%eax
+    1d67:	0f be c0             	movsbl %al,%eax
+    1d6a:	01 c8                	add    %ecx,%eax
+    1d6c:	83 e8 30             	sub    $0x30,%eax
+    1d6f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1d72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d76:	0f b6 00             	movzbl (%rax),%eax
+    1d79:	3c 2f                	cmp    $0x2f,%al
+    1d7b:	7e 0b                	jle    1d88 <atoi+0x4f>
+    1d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1d81:	0f b6 00             	movzbl (%rax),%eax
+    1d84:	3c 39                	cmp    $0x39,%al
+    1d86:	7e c2                	jle    1d4a <atoi+0x11>
+  return n;
+    1d88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1d8b:	5d                   	pop    %rbp
+    1d8c:	c3                   	ret
+
+0000000000001d8d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1d8d:	55                   	push   %rbp
+    1d8e:	48 89 e5             	mov    %rsp,%rbp
+    1d91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1d95:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1d99:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1d9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1da0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1da4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1da8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1dac:	eb 1d                	jmp    1dcb <memmove+0x3e>
+    *dst++ = *src++;
+    1dae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1db2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1db6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1dba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dbe:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1dc2:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1dc6:	0f b6 12             	movzbl (%rdx),%edx
+    1dc9:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1dcb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1dce:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1dd1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1dd4:	85 c0                	test   %eax,%eax
+    1dd6:	7f d6                	jg     1dae <memmove+0x21>
+  return vdst;
+    1dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ddc:	5d                   	pop    %rbp
+    1ddd:	c3                   	ret
+
+0000000000001dde <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1dde:	b8 01 00 00 00       	mov    $0x1,%eax
+    1de3:	cd 40                	int    $0x40
+    1de5:	c3                   	ret
+
+0000000000001de6 <exit>:
+SYSCALL(exit)
+    1de6:	b8 02 00 00 00       	mov    $0x2,%eax
+    1deb:	cd 40                	int    $0x40
+    1ded:	c3                   	ret
+
+0000000000001dee <wait>:
+SYSCALL(wait)
+    1dee:	b8 03 00 00 00       	mov    $0x3,%eax
+    1df3:	cd 40                	int    $0x40
+    1df5:	c3                   	ret
+
+0000000000001df6 <pipe>:
+SYSCALL(pipe)
+    1df6:	b8 04 00 00 00       	mov    $0x4,%eax
+    1dfb:	cd 40                	int    $0x40
+    1dfd:	c3                   	ret
+
+0000000000001dfe <read>:
+SYSCALL(read)
+    1dfe:	b8 05 00 00 00       	mov    $0x5,%eax
+    1e03:	cd 40                	int    $0x40
+    1e05:	c3                   	ret
+
+0000000000001e06 <write>:
+SYSCALL(write)
+    1e06:	b8 10 00 00 00       	mov    $0x10,%eax
+    1e0b:	cd 40                	int    $0x40
+    1e0d:	c3                   	ret
+
+0000000000001e0e <close>:
+SYSCALL(close)
+    1e0e:	b8 15 00 00 00       	mov    $0x15,%eax
+    1e13:	cd 40                	int    $0x40
+    1e15:	c3                   	ret
+
+0000000000001e16 <kill>:
+SYSCALL(kill)
+    1e16:	b8 06 00 00 00       	mov    $0x6,%eax
+    1e1b:	cd 40                	int    $0x40
+    1e1d:	c3                   	ret
+
+0000000000001e1e <exec>:
+SYSCALL(exec)
+    1e1e:	b8 07 00 00 00       	mov    $0x7,%eax
+    1e23:	cd 40                	int    $0x40
+    1e25:	c3                   	ret
+
+0000000000001e26 <open>:
+SYSCALL(open)
+    1e26:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1e2b:	cd 40                	int    $0x40
+    1e2d:	c3                   	ret
+
+0000000000001e2e <mknod>:
+SYSCALL(mknod)
+    1e2e:	b8 11 00 00 00       	mov    $0x11,%eax
+    1e33:	cd 40                	int    $0x40
+    1e35:	c3                   	ret
+
+0000000000001e36 <unlink>:
+SYSCALL(unlink)
+    1e36:	b8 12 00 00 00       	mov    $0x12,%eax
+    1e3b:	cd 40                	int    $0x40
+    1e3d:	c3                   	ret
+
+0000000000001e3e <fstat>:
+SYSCALL(fstat)
+    1e3e:	b8 08 00 00 00       	mov    $0x8,%eax
+    1e43:	cd 40                	int    $0x40
+    1e45:	c3                   	ret
+
+0000000000001e46 <link>:
+SYSCALL(link)
+    1e46:	b8 13 00 00 00       	mov    $0x13,%eax
+    1e4b:	cd 40                	int    $0x40
+    1e4d:	c3                   	ret
+
+0000000000001e4e <mkdir>:
+SYSCALL(mkdir)
+    1e4e:	b8 14 00 00 00       	mov    $0x14,%eax
+    1e53:	cd 40                	int    $0x40
+    1e55:	c3                   	ret
+
+0000000000001e56 <chdir>:
+SYSCALL(chdir)
+    1e56:	b8 09 00 00 00       	mov    $0x9,%eax
+    1e5b:	cd 40                	int    $0x40
+    1e5d:	c3                   	ret
+
+0000000000001e5e <dup>:
+SYSCALL(dup)
+    1e5e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1e63:	cd 40                	int    $0x40
+    1e65:	c3                   	ret
+
+0000000000001e66 <getpid>:
+SYSCALL(getpid)
+    1e66:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1e6b:	cd 40                	int    $0x40
+    1e6d:	c3                   	ret
+
+0000000000001e6e <sbrk>:
+SYSCALL(sbrk)
+    1e6e:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1e73:	cd 40                	int    $0x40
+    1e75:	c3                   	ret
+
+0000000000001e76 <sleep>:
+SYSCALL(sleep)
+    1e76:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1e7b:	cd 40                	int    $0x40
+    1e7d:	c3                   	ret
+
+0000000000001e7e <uptime>:
+SYSCALL(uptime)
+    1e7e:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1e83:	cd 40                	int    $0x40
+    1e85:	c3                   	ret
+
+0000000000001e86 <sysinfo>:
+SYSCALL(sysinfo)
+    1e86:	b8 16 00 00 00       	mov    $0x16,%eax
+    1e8b:	cd 40                	int    $0x40
+    1e8d:	c3                   	ret
+
+0000000000001e8e <mmap>:
+SYSCALL(mmap)
+    1e8e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1e93:	cd 40                	int    $0x40
+    1e95:	c3                   	ret
+
+0000000000001e96 <munmap>:
+SYSCALL(munmap)
+    1e96:	b8 18 00 00 00       	mov    $0x18,%eax
+    1e9b:	cd 40                	int    $0x40
+    1e9d:	c3                   	ret
+
+0000000000001e9e <crashn>:
+SYSCALL(crashn)
+    1e9e:	b8 19 00 00 00       	mov    $0x19,%eax
+    1ea3:	cd 40                	int    $0x40
+    1ea5:	c3                   	ret
+
+0000000000001ea6 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1ea6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1eab:	cd 40                	int    $0x40
+    1ead:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1eb0:	74 02                	je     1eb4 <mmap2+0xe>
+    1eb2:	89 c0                	mov    %eax,%eax
+    1eb4:	c3                   	ret
+
+0000000000001eb5 <munmap2>:
+SYSCALL(munmap2)
+    1eb5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1eba:	cd 40                	int    $0x40
+    1ebc:	c3                   	ret
+
+0000000000001ebd <msync>:
+SYSCALL(msync)
+    1ebd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1ec2:	cd 40                	int    $0x40
+    1ec4:	c3                   	ret
+
+0000000000001ec5 <sendfile>:
+SYSCALL(sendfile)
+    1ec5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1eca:	cd 40                	int    $0x40
+    1ecc:	c3                   	ret
+
+0000000000001ecd <splice>:
+SYSCALL(splice)
+    1ecd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1ed2:	cd 40                	int    $0x40
+    1ed4:	c3                   	ret
+
+0000000000001ed5 <pread>:
+SYSCALL(pread)
+    1ed5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1eda:	cd 40                	int    $0x40
+    1edc:	c3                   	ret
+
+0000000000001edd <pwrite>:
+SYSCALL(pwrite)
+    1edd:	b8 20 00 00 00       	mov    $0x20,%eax
+    1ee2:	cd 40                	int    $0x40
+    1ee4:	c3                   	ret
+
+0000000000001ee5 <readv>:
+SYSCALL(readv)
+    1ee5:	b8 21 00 00 00       	mov    $0x21,%eax
+    1eea:	cd 40                	int    $0x40
+    1eec:	c3                   	ret
+
+0000000000001eed <writev>:
+SYSCALL(writev)
+    1eed:	b8 22 00 00 00       	mov    $0x22,%eax
+    1ef2:	cd 40                	int    $0x40
+    1ef4:	c3                   	ret
+
+0000000000001ef5 <poll>:
+SYSCALL(poll)
+    1ef5:	b8 23 00 00 00       	mov    $0x23,%eax
+    1efa:	cd 40                	int    $0x40
+    1efc:	c3                   	ret
+
+0000000000001efd <pipe2>:
+SYSCALL(pipe2)
+    1efd:	b8 24 00 00 00       	mov    $0x24,%eax
+    1f02:	cd 40                	int    $0x40
+    1f04:	c3                   	ret
+
+0000000000001f05 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1f05:	55                   	push   %rbp
+    1f06:	48 89 e5             	mov    %rsp,%rbp
+    1f09:	48 83 ec 20          	sub    $0x20,%rsp
+    1f0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1f11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1f15:	48 83 e8 10          	sub    $0x10,%rax
+    1f19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1f1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f21:	48 8b 10             	mov    (%rax),%rdx
+    1f24:	48 8d 05 75 0a 00 00 	lea    0xa75(%rip),%rax        # 29a0 <bigblock>
+    1f2b:	48 39 c2             	cmp    %rax,%rdx
+    1f2e:	75 1f                	jne    1f4f <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1f30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f34:	8b 40 08             	mov    0x8(%rax),%eax
+    1f37:	c1 e0 04             	shl    $0x4,%eax
+    1f3a:	89 c2                	mov    %eax,%edx
+    1f3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f40:	89 d6                	mov    %edx,%esi
+    1f42:	48 89 c7             	mov    %rax,%rdi
+    1f45:	e8 6b ff ff ff       	call   1eb5 <munmap2>
+    return;
+    1f4a:	e9 0b 01 00 00       	jmp    205a <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1f4f:	48 8b 05 3a 0a 00 00 	mov    0xa3a(%rip),%rax        # 2990 <freep>
+    1f56:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f5a:	eb 2f                	jmp    1f8b <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1f5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f60:	48 8b 00             	mov    (%rax),%rax
+    1f63:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f67:	72 17                	jb     1f80 <free+0x7b>
+    1f69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f6d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f71:	72 2f                	jb     1fa2 <free+0x9d>
+    1f73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f77:	48 8b 00             	mov    (%rax),%rax
+    1f7a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1f7e:	72 22                	jb     1fa2 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1f80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f84:	48 8b 00             	mov    (%rax),%rax
+    1f87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1f8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f8f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f93:	73 c7                	jae    1f5c <free+0x57>
+    1f95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f99:	48 8b 00             	mov    (%rax),%rax
+    1f9c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1fa0:	73 ba                	jae    1f5c <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1fa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fa6:	8b 40 08             	mov    0x8(%rax),%eax
+    1fa9:	89 c0                	mov    %eax,%eax
+    1fab:	48 c1 e0 04          	shl    $0x4,%rax
+    1faf:	48 89 c2             	mov    %rax,%rdx
+    1fb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fb6:	48 01 c2             	add    %rax,%rdx
+    1fb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fbd:	48 8b 00             	mov    (%rax),%rax
+    1fc0:	48 39 c2             	cmp    %rax,%rdx
+    1fc3:	75 2d                	jne    1ff2 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1fc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fc9:	8b 50 08             	mov    0x8(%rax),%edx
+    1fcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fd0:	48 8b 00             	mov    (%rax),%rax
+    1fd3:	8b 40 08             	mov    0x8(%rax),%eax
+    1fd6:	01 c2                	add    %eax,%edx
+    1fd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fdc:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fe3:	48 8b 00             	mov    (%rax),%rax
+    1fe6:	48 8b 10             	mov    (%rax),%rdx
+    1fe9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1fed:	48 89 10             	mov    %rdx,(%rax)
+    1ff0:	eb 0e                	jmp    2000 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1ff2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ff6:	48 8b 10             	mov    (%rax),%rdx
+    1ff9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ffd:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    2000:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2004:	8b 40 08             	mov    0x8(%rax),%eax
+    2007:	89 c0                	mov    %eax,%eax
+    2009:	48 c1 e0 04          	shl    $0x4,%rax
+    200d:	48 89 c2             	mov    %rax,%rdx
+    2010:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2014:	48 01 d0             	add    %rdx,%rax
+    2017:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    201b:	75 27                	jne    2044 <free+0x13f>
+    p->s.size += bp->s.size;
+    201d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2021:	8b 50 08             	mov    0x8(%rax),%edx
+    2024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2028:	8b 40 08             	mov    0x8(%rax),%eax
+    202b:	01 c2                	add    %eax,%edx
+    202d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2031:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    2034:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2038:	48 8b 10             	mov    (%rax),%rdx
+    203b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    203f:	48 89 10             	mov    %rdx,(%rax)
+    2042:	eb 0b                	jmp    204f <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    2044:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2048:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    204c:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    204f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2053:	48 89 05 36 09 00 00 	mov    %rax,0x936(%rip)        # 2990 <freep>
+}
+    205a:	c9                   	leave
+    205b:	c3                   	ret
+
+000000000000205c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    205c:	55                   	push   %rbp
+    205d:	48 89 e5             	mov    %rsp,%rbp
+    2060:	48 83 ec 20          	sub    $0x20,%rsp
+    2064:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    2067:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    206e:	77 07                	ja     2077 <morecore+0x1b>
+    nu = 4096;
+    2070:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    2077:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    207a:	c1 e0 04             	shl    $0x4,%eax
+    207d:	89 c7                	mov    %eax,%edi
+    207f:	e8 ea fd ff ff       	call   1e6e <sbrk>
+    2084:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    2088:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    208d:	75 07                	jne    2096 <morecore+0x3a>
+    return 0;
+    208f:	b8 00 00 00 00       	mov    $0x0,%eax
+    2094:	eb 29                	jmp    20bf <morecore+0x63>
+  hp = (Header*)p;
+    2096:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    209a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    209e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    20a5:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    20a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    20ac:	48 83 c0 10          	add    $0x10,%rax
+    20b0:	48 89 c7             	mov    %rax,%rdi
+    20b3:	e8 4d fe ff ff       	call   1f05 <free>
+  return freep;
+    20b8:	48 8b 05 d1 08 00 00 	mov    0x8d1(%rip),%rax        # 2990 <freep>
+}
+    20bf:	c9                   	leave
+    20c0:	c3                   	ret
+
+00000000000020c1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    20c1:	55                   	push   %rbp
+    20c2:	48 89 e5             	mov    %rsp,%rbp
+    20c5:	48 83 ec 30          	sub    $0x30,%rsp
+    20c9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    20cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    20cf:	48 83 c0 0f          	add    $0xf,%rax
+    20d3:	48 c1 e8 04          	shr    $0x4,%rax
+    20d7:	83 c0 01             	add    $0x1,%eax
+    20da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    20dd:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    20e4:	76 62                	jbe    2148 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    20e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    20e9:	c1 e0 04             	shl    $0x4,%eax
+    20ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    20f2:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    20f8:	b9 22 00 00 00       	mov    $0x22,%ecx
+    20fd:	ba 03 00 00 00       	mov    $0x3,%edx
+    2102:	89 c6                	mov    %eax,%esi
+    2104:	bf 00 00 00 00       	mov    $0x0,%edi
+    2109:	e8 98 fd ff ff       	call   1ea6 <mmap2>
+    210e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    2112:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    2117:	75 0a                	jne    2123 <malloc+0x62>
+      return 0;
+    2119:	b8 00 00 00 00       	mov    $0x0,%eax
+    211e:	e9 1c 01 00 00       	jmp    223f <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    2123:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2127:	48 8d 15 72 08 00 00 	lea    0x872(%rip),%rdx        # 29a0 <bigblock>
+    212e:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    2131:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2135:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    2138:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    213b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    213f:	48 83 c0 10          	add    $0x10,%rax
+    2143:	e9 f7 00 00 00       	jmp    223f <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    2148:	48 8b 05 41 08 00 00 	mov    0x841(%rip),%rax        # 2990 <freep>
+    214f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2153:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    2158:	75 2e                	jne    2188 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    215a:	48 8d 05 1f 08 00 00 	lea    0x81f(%rip),%rax        # 2980 <base>
+    2161:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    2165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    2169:	48 89 05 20 08 00 00 	mov    %rax,0x820(%rip)        # 2990 <freep>
+    2170:	48 8b 05 19 08 00 00 	mov    0x819(%rip),%rax        # 2990 <freep>
+    2177:	48 89 05 02 08 00 00 	mov    %rax,0x802(%rip)        # 2980 <base>
+    base.s.size = 0;
+    217e:	c7 05 00 08 00 00 00 	movl   $0x0,0x800(%rip)        # 2988 <base+0x8>
+    2185:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2188:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    218c:	48 8b 00             	mov    (%rax),%rax
+    218f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    2193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2197:	8b 40 08             	mov    0x8(%rax),%eax
+    219a:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    219d:	72 5f                	jb     21fe <malloc+0x13d>
+      if(p->s.size == nunits)
+    219f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21a3:	8b 40 08             	mov    0x8(%rax),%eax
+    21a6:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    21a9:	75 10                	jne    21bb <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    21ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21af:	48 8b 10             	mov    (%rax),%rdx
+    21b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21b6:	48 89 10             	mov    %rdx,(%rax)
+    21b9:	eb 2e                	jmp    21e9 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    21bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21bf:	8b 40 08             	mov    0x8(%rax),%eax
+    21c2:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    21c5:	89 c2                	mov    %eax,%edx
+    21c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21cb:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    21ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21d2:	8b 40 08             	mov    0x8(%rax),%eax
+    21d5:	89 c0                	mov    %eax,%eax
+    21d7:	48 c1 e0 04          	shl    $0x4,%rax
+    21db:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    21df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21e3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    21e6:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    21e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    21ed:	48 89 05 9c 07 00 00 	mov    %rax,0x79c(%rip)        # 2990 <freep>
+      return (void*)(p + 1);
+    21f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    21f8:	48 83 c0 10          	add    $0x10,%rax
+    21fc:	eb 41                	jmp    223f <malloc+0x17e>
+    }
+    if(p == freep)
+    21fe:	48 8b 05 8b 07 00 00 	mov    0x78b(%rip),%rax        # 2990 <freep>
+    2205:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    2209:	75 1c                	jne    2227 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    220b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    220e:	89 c7                	mov    %eax,%edi
+    2210:	e8 47 fe ff ff       	call   205c <morecore>
+    2215:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    2219:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    221e:	75 07                	jne    2227 <malloc+0x166>
+        return 0;
+    2220:	b8 00 00 00 00       	mov    $0x0,%eax
+    2225:	eb 18                	jmp    223f <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2227:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    222b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    222f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    2233:	48 8b 00             	mov    (%rax),%rax
+    2236:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    223a:	e9 54 ff ff ff       	jmp    2193 <malloc+0xd2>
+  }
+}
+    223f:	c9                   	leave
+    2240:	c3                   	ret
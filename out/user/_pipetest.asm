@@ -0,0 +1,2625 @@
+
+out/user/_pipetest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <writestream>:
+
+// Write TOTAL bytes of the stream to fd in writes of many sizes, some
+// of them smaller than a page and some spanning several.
+void
+writestream(int fd)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  static int sizes[] = { 1, 7, 512, PGSIZE, PGSIZE + 904, 3 * PGSIZE };
+  int k, i, n;
+
+  for(k = i = 0; k < TOTAL; k += n, i++){
+       b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+      12:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      18:	e9 2e 01 00 00       	jmp    14b <writestream+0x14b>
+    n = sizes[i % 6];
+      1d:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+      20:	48 63 c1             	movslq %ecx,%rax
+      23:	48 69 c0 ab aa aa 2a 	imul   $0x2aaaaaab,%rax,%rax
+      2a:	48 c1 e8 20          	shr    $0x20,%rax
+      2e:	48 89 c2             	mov    %rax,%rdx
+      31:	89 c8                	mov    %ecx,%eax
+      33:	c1 f8 1f             	sar    $0x1f,%eax
+      36:	29 c2                	sub    %eax,%edx
+      38:	89 d0                	mov    %edx,%eax
+      3a:	01 c0                	add    %eax,%eax
+      3c:	01 d0                	add    %edx,%eax
+      3e:	01 c0                	add    %eax,%eax
+      40:	29 c1                	sub    %eax,%ecx
+      42:	89 ca                	mov    %ecx,%edx
+      44:	48 63 c2             	movslq %edx,%rax
+      47:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      4e:	00 
+      4f:	48 8d 05 ba 21 00 00 	lea    0x21ba(%rip),%rax        # 2210 <sizes.1>
+      56:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+      59:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if(n > TOTAL - k)
+      5c:	b8 00 90 01 00       	mov    $0x19000,%eax
+      61:	2b 45 fc             	sub    -0x4(%rbp),%eax
+      64:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+      67:	7e 0b                	jle    74 <writestream+0x74>
+      n = TOTAL - k;
+      69:	b8 00 90 01 00       	mov    $0x19000,%eax
+      6e:	2b 45 fc             	sub    -0x4(%rbp),%eax
+      71:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    for(int j = 0; j < n; j++)
+      74:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+      7b:	eb 41                	jmp    be <writestream+0xbe>
+      buf[j] = STREAM(k + j);
+      7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      80:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      83:	01 d0                	add    %edx,%eax
+      85:	48 63 d0             	movslq %eax,%rdx
+      88:	48 69 d2 bf bf 8c 82 	imul   $0xffffffff828cbfbf,%rdx,%rdx
+      8f:	48 c1 ea 20          	shr    $0x20,%rdx
+      93:	01 c2                	add    %eax,%edx
+      95:	c1 fa 07             	sar    $0x7,%edx
+      98:	89 c1                	mov    %eax,%ecx
+      9a:	c1 f9 1f             	sar    $0x1f,%ecx
+      9d:	29 ca                	sub    %ecx,%edx
+      9f:	69 ca fb 00 00 00    	imul   $0xfb,%edx,%ecx
+      a5:	29 c8                	sub    %ecx,%eax
+      a7:	89 c2                	mov    %eax,%edx
+      a9:	89 d1                	mov    %edx,%ecx
+      ab:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      ae:	48 98                	cltq
+      b0:	48 8d 15 09 22 00 00 	lea    0x2209(%rip),%rdx        # 22c0 <buf>
+      b7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+    for(int j = 0; j < n; j++)
+      ba:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+      be:	8b 45 f0             	mov    -0x10(%rbp),%eax
+      c1:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+      c4:	7c b7                	jl     7d <writestream+0x7d>
+    if(write(fd, buf, n) != n)
+      c6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+      c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      cc:	48 8d 0d ed 21 00 00 	lea    0x21ed(%rip),%rcx        # 22c0 <buf>
+      d3:	48 89 ce             	mov    %rcx,%rsi
+      d6:	89 c7                	mov    %eax,%edi
+      d8:	e8 f7 16 00 00       	call   17d4 <write>
+      dd:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+      e0:	74 5f                	je     141 <writestream+0x141>
+      error("write of %d bytes at %d failed", n, k);
+      e2:	8b 05 18 21 00 00    	mov    0x2118(%rip),%eax        # 2200 <stdout>
+      e8:	ba 27 00 00 00       	mov    $0x27,%edx
+      ed:	48 8d 0d 1c 1b 00 00 	lea    0x1b1c(%rip),%rcx        # 1c10 <malloc+0x181>
+      f4:	48 89 ce             	mov    %rcx,%rsi
+      f7:	89 c7                	mov    %eax,%edi
+      f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fe:	e8 0a 11 00 00       	call   120d <printf>
+     103:	8b 05 f7 20 00 00    	mov    0x20f7(%rip),%eax        # 2200 <stdout>
+     109:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     10c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     10f:	48 8d 35 12 1b 00 00 	lea    0x1b12(%rip),%rsi        # 1c28 <malloc+0x199>
+     116:	89 c7                	mov    %eax,%edi
+     118:	b8 00 00 00 00       	mov    $0x0,%eax
+     11d:	e8 eb 10 00 00       	call   120d <printf>
+     122:	8b 05 d8 20 00 00    	mov    0x20d8(%rip),%eax        # 2200 <stdout>
+     128:	48 8d 15 18 1b 00 00 	lea    0x1b18(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     12f:	48 89 d6             	mov    %rdx,%rsi
+     132:	89 c7                	mov    %eax,%edi
+     134:	b8 00 00 00 00       	mov    $0x0,%eax
+     139:	e8 cf 10 00 00       	call   120d <printf>
+     13e:	90                   	nop
+     13f:	eb fd                	jmp    13e <writestream+0x13e>
+  for(k = i = 0; k < TOTAL; k += n, i++){
+     141:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     144:	01 45 fc             	add    %eax,-0x4(%rbp)
+     147:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     14b:	81 7d fc ff 8f 01 00 	cmpl   $0x18fff,-0x4(%rbp)
+     152:	0f 8e c5 fe ff ff    	jle    1d <writestream+0x1d>
+  }
+}
+     158:	90                   	nop
+     159:	90                   	nop
+     15a:	c9                   	leave
+     15b:	c3                   	ret
+
+000000000000015c <readstream>:
+
+// Read the stream back from fd in reads of other sizes, then expect
+// the end of the pipe.
+void
+readstream(int fd)
+{
+     15c:	55                   	push   %rbp
+     15d:	48 89 e5             	mov    %rsp,%rbp
+     160:	48 83 ec 20          	sub    $0x20,%rsp
+     164:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  static int sizes[] = { 3, PGSIZE, 100, 2 * PGSIZE + 17 };
+  int k, i, n;
+
+  for(k = i = 0; k < TOTAL; k += n, i++){
+     167:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     16e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     171:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     174:	e9 cd 01 00 00       	jmp    346 <readstream+0x1ea>
+    n = read(fd, buf, sizes[i % 4]);
+     179:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     17c:	89 d0                	mov    %edx,%eax
+     17e:	c1 f8 1f             	sar    $0x1f,%eax
+     181:	c1 e8 1e             	shr    $0x1e,%eax
+     184:	01 c2                	add    %eax,%edx
+     186:	83 e2 03             	and    $0x3,%edx
+     189:	29 c2                	sub    %eax,%edx
+     18b:	89 d0                	mov    %edx,%eax
+     18d:	48 98                	cltq
+     18f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     196:	00 
+     197:	48 8d 05 92 20 00 00 	lea    0x2092(%rip),%rax        # 2230 <sizes.0>
+     19e:	8b 14 02             	mov    (%rdx,%rax,1),%edx
+     1a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1a4:	48 8d 0d 15 21 00 00 	lea    0x2115(%rip),%rcx        # 22c0 <buf>
+     1ab:	48 89 ce             	mov    %rcx,%rsi
+     1ae:	89 c7                	mov    %eax,%edi
+     1b0:	e8 17 16 00 00       	call   17cc <read>
+     1b5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    if(n <= 0 || k + n > TOTAL)
+     1b8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     1bc:	7e 0f                	jle    1cd <readstream+0x71>
+     1be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     1c1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     1c4:	01 d0                	add    %edx,%eax
+     1c6:	3d 00 90 01 00       	cmp    $0x19000,%eax
+     1cb:	7e 5f                	jle    22c <readstream+0xd0>
+      error("read at %d returned %d", k, n);
+     1cd:	8b 05 2d 20 00 00    	mov    0x202d(%rip),%eax        # 2200 <stdout>
+     1d3:	ba 36 00 00 00       	mov    $0x36,%edx
+     1d8:	48 8d 0d 31 1a 00 00 	lea    0x1a31(%rip),%rcx        # 1c10 <malloc+0x181>
+     1df:	48 89 ce             	mov    %rcx,%rsi
+     1e2:	89 c7                	mov    %eax,%edi
+     1e4:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e9:	e8 1f 10 00 00       	call   120d <printf>
+     1ee:	8b 05 0c 20 00 00    	mov    0x200c(%rip),%eax        # 2200 <stdout>
+     1f4:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+     1f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     1fa:	48 8d 35 48 1a 00 00 	lea    0x1a48(%rip),%rsi        # 1c49 <malloc+0x1ba>
+     201:	89 c7                	mov    %eax,%edi
+     203:	b8 00 00 00 00       	mov    $0x0,%eax
+     208:	e8 00 10 00 00       	call   120d <printf>
+     20d:	8b 05 ed 1f 00 00    	mov    0x1fed(%rip),%eax        # 2200 <stdout>
+     213:	48 8d 15 2d 1a 00 00 	lea    0x1a2d(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     21a:	48 89 d6             	mov    %rdx,%rsi
+     21d:	89 c7                	mov    %eax,%edi
+     21f:	b8 00 00 00 00       	mov    $0x0,%eax
+     224:	e8 e4 0f 00 00       	call   120d <printf>
+     229:	90                   	nop
+     22a:	eb fd                	jmp    229 <readstream+0xcd>
+    for(int j = 0; j < n; j++)
+     22c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+     233:	e9 f8 00 00 00       	jmp    330 <readstream+0x1d4>
+      if(buf[j] != STREAM(k + j))
+     238:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     23b:	48 98                	cltq
+     23d:	48 8d 15 7c 20 00 00 	lea    0x207c(%rip),%rdx        # 22c0 <buf>
+     244:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+     248:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     24b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     24e:	01 d0                	add    %edx,%eax
+     250:	48 63 d0             	movslq %eax,%rdx
+     253:	48 69 d2 bf bf 8c 82 	imul   $0xffffffff828cbfbf,%rdx,%rdx
+     25a:	48 c1 ea 20          	shr    $0x20,%rdx
+     25e:	01 c2                	add    %eax,%edx
+     260:	c1 fa 07             	sar    $0x7,%edx
+     263:	89 c1                	mov    %eax,%ecx
+     265:	c1 f9 1f             	sar    $0x1f,%ecx
+     268:	29 ca                	sub    %ecx,%edx
+     26a:	69 ca fb 00 00 00    	imul   $0xfb,%edx,%ecx
+     270:	29 c8                	sub    %ecx,%eax
+     272:	89 c2                	mov    %eax,%edx
+     274:	89 d0                	mov    %edx,%eax
+     276:	40 38 c6             	cmp    %al,%sil
+     279:	0f 84 ad 00 00 00    	je     32c <readstream+0x1d0>
+        error("byte %d of the stream is %d, not %d", k + j, buf[j], STREAM(k + j));
+     27f:	8b 05 7b 1f 00 00    	mov    0x1f7b(%rip),%eax        # 2200 <stdout>
+     285:	ba 39 00 00 00       	mov    $0x39,%edx
+     28a:	48 8d 0d 7f 19 00 00 	lea    0x197f(%rip),%rcx        # 1c10 <malloc+0x181>
+     291:	48 89 ce             	mov    %rcx,%rsi
+     294:	89 c7                	mov    %eax,%edi
+     296:	b8 00 00 00 00       	mov    $0x0,%eax
+     29b:	e8 6d 0f 00 00       	call   120d <printf>
+     2a0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     2a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2a6:	01 d0                	add    %edx,%eax
+     2a8:	48 63 d0             	movslq %eax,%rdx
+     2ab:	48 69 d2 bf bf 8c 82 	imul   $0xffffffff828cbfbf,%rdx,%rdx
+     2b2:	48 c1 ea 20          	shr    $0x20,%rdx
+     2b6:	01 c2                	add    %eax,%edx
+     2b8:	c1 fa 07             	sar    $0x7,%edx
+     2bb:	89 c1                	mov    %eax,%ecx
+     2bd:	c1 f9 1f             	sar    $0x1f,%ecx
+     2c0:	29 ca                	sub    %ecx,%edx
+     2c2:	69 ca fb 00 00 00    	imul   $0xfb,%edx,%ecx
+     2c8:	29 c8                	sub    %ecx,%eax
+     2ca:	89 c2                	mov    %eax,%edx
+     2cc:	89 d0                	mov    %edx,%eax
+     2ce:	0f be f8             	movsbl %al,%edi
+     2d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2d4:	48 98                	cltq
+     2d6:	48 8d 15 e3 1f 00 00 	lea    0x1fe3(%rip),%rdx        # 22c0 <buf>
+     2dd:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     2e1:	0f be d0             	movsbl %al,%edx
+     2e4:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     2e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     2ea:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+     2ed:	8b 05 0d 1f 00 00    	mov    0x1f0d(%rip),%eax        # 2200 <stdout>
+     2f3:	41 89 f8             	mov    %edi,%r8d
+     2f6:	89 d1                	mov    %edx,%ecx
+     2f8:	89 f2                	mov    %esi,%edx
+     2fa:	48 8d 35 5f 19 00 00 	lea    0x195f(%rip),%rsi        # 1c60 <malloc+0x1d1>
+     301:	89 c7                	mov    %eax,%edi
+     303:	b8 00 00 00 00       	mov    $0x0,%eax
+     308:	e8 00 0f 00 00       	call   120d <printf>
+     30d:	8b 05 ed 1e 00 00    	mov    0x1eed(%rip),%eax        # 2200 <stdout>
+     313:	48 8d 15 2d 19 00 00 	lea    0x192d(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     31a:	48 89 d6             	mov    %rdx,%rsi
+     31d:	89 c7                	mov    %eax,%edi
+     31f:	b8 00 00 00 00       	mov    $0x0,%eax
+     324:	e8 e4 0e 00 00       	call   120d <printf>
+     329:	90                   	nop
+     32a:	eb fd                	jmp    329 <readstream+0x1cd>
+    for(int j = 0; j < n; j++)
+     32c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     330:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     333:	3b 45 f0             	cmp    -0x10(%rbp),%eax
+     336:	0f 8c fc fe ff ff    	jl     238 <readstream+0xdc>
+  for(k = i = 0; k < TOTAL; k += n, i++){
+     33c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     33f:	01 45 fc             	add    %eax,-0x4(%rbp)
+     342:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     346:	81 7d fc ff 8f 01 00 	cmpl   $0x18fff,-0x4(%rbp)
+     34d:	0f 8e 26 fe ff ff    	jle    179 <readstream+0x1d>
+  }
+  if((n = read(fd, buf, 1)) != 0)
+     353:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     356:	ba 01 00 00 00       	mov    $0x1,%edx
+     35b:	48 8d 0d 5e 1f 00 00 	lea    0x1f5e(%rip),%rcx        # 22c0 <buf>
+     362:	48 89 ce             	mov    %rcx,%rsi
+     365:	89 c7                	mov    %eax,%edi
+     367:	e8 60 14 00 00       	call   17cc <read>
+     36c:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     36f:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     373:	74 5f                	je     3d4 <readstream+0x278>
+    error("read past the end of the stream returned %d", n);
+     375:	8b 05 85 1e 00 00    	mov    0x1e85(%rip),%eax        # 2200 <stdout>
+     37b:	ba 3c 00 00 00       	mov    $0x3c,%edx
+     380:	48 8d 0d 89 18 00 00 	lea    0x1889(%rip),%rcx        # 1c10 <malloc+0x181>
+     387:	48 89 ce             	mov    %rcx,%rsi
+     38a:	89 c7                	mov    %eax,%edi
+     38c:	b8 00 00 00 00       	mov    $0x0,%eax
+     391:	e8 77 0e 00 00       	call   120d <printf>
+     396:	8b 05 64 1e 00 00    	mov    0x1e64(%rip),%eax        # 2200 <stdout>
+     39c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     39f:	48 8d 0d e2 18 00 00 	lea    0x18e2(%rip),%rcx        # 1c88 <malloc+0x1f9>
+     3a6:	48 89 ce             	mov    %rcx,%rsi
+     3a9:	89 c7                	mov    %eax,%edi
+     3ab:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b0:	e8 58 0e 00 00       	call   120d <printf>
+     3b5:	8b 05 45 1e 00 00    	mov    0x1e45(%rip),%eax        # 2200 <stdout>
+     3bb:	48 8d 15 85 18 00 00 	lea    0x1885(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     3c2:	48 89 d6             	mov    %rdx,%rsi
+     3c5:	89 c7                	mov    %eax,%edi
+     3c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3cc:	e8 3c 0e 00 00       	call   120d <printf>
+     3d1:	90                   	nop
+     3d2:	eb fd                	jmp    3d1 <readstream+0x275>
+}
+     3d4:	90                   	nop
+     3d5:	c9                   	leave
+     3d6:	c3                   	ret
+
+00000000000003d7 <ringtest>:
+
+// A stream much larger than the pipe goes through intact, with the
+// writer blocking whenever the ring of pages is full.
+void
+ringtest(void)
+{
+     3d7:	55                   	push   %rbp
+     3d8:	48 89 e5             	mov    %rsp,%rbp
+     3db:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], pid;
+
+  printf(stdout, "ringtest\n");
+     3df:	8b 05 1b 1e 00 00    	mov    0x1e1b(%rip),%eax        # 2200 <stdout>
+     3e5:	48 8d 15 c8 18 00 00 	lea    0x18c8(%rip),%rdx        # 1cb4 <malloc+0x225>
+     3ec:	48 89 d6             	mov    %rdx,%rsi
+     3ef:	89 c7                	mov    %eax,%edi
+     3f1:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f6:	e8 12 0e 00 00       	call   120d <printf>
+  if(pipe(fds) < 0)
+     3fb:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     3ff:	48 89 c7             	mov    %rax,%rdi
+     402:	e8 bd 13 00 00       	call   17c4 <pipe>
+     407:	85 c0                	test   %eax,%eax
+     409:	79 5c                	jns    467 <ringtest+0x90>
+    error("pipe failed");
+     40b:	8b 05 ef 1d 00 00    	mov    0x1def(%rip),%eax        # 2200 <stdout>
+     411:	ba 48 00 00 00       	mov    $0x48,%edx
+     416:	48 8d 0d f3 17 00 00 	lea    0x17f3(%rip),%rcx        # 1c10 <malloc+0x181>
+     41d:	48 89 ce             	mov    %rcx,%rsi
+     420:	89 c7                	mov    %eax,%edi
+     422:	b8 00 00 00 00       	mov    $0x0,%eax
+     427:	e8 e1 0d 00 00       	call   120d <printf>
+     42c:	8b 05 ce 1d 00 00    	mov    0x1dce(%rip),%eax        # 2200 <stdout>
+     432:	48 8d 15 85 18 00 00 	lea    0x1885(%rip),%rdx        # 1cbe <malloc+0x22f>
+     439:	48 89 d6             	mov    %rdx,%rsi
+     43c:	89 c7                	mov    %eax,%edi
+     43e:	b8 00 00 00 00       	mov    $0x0,%eax
+     443:	e8 c5 0d 00 00       	call   120d <printf>
+     448:	8b 05 b2 1d 00 00    	mov    0x1db2(%rip),%eax        # 2200 <stdout>
+     44e:	48 8d 15 f2 17 00 00 	lea    0x17f2(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     455:	48 89 d6             	mov    %rdx,%rsi
+     458:	89 c7                	mov    %eax,%edi
+     45a:	b8 00 00 00 00       	mov    $0x0,%eax
+     45f:	e8 a9 0d 00 00       	call   120d <printf>
+     464:	90                   	nop
+     465:	eb fd                	jmp    464 <ringtest+0x8d>
+  if((pid = fork()) < 0)
+     467:	e8 40 13 00 00       	call   17ac <fork>
+     46c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     46f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     473:	79 5c                	jns    4d1 <ringtest+0xfa>
+    error("fork failed");
+     475:	8b 05 85 1d 00 00    	mov    0x1d85(%rip),%eax        # 2200 <stdout>
+     47b:	ba 4a 00 00 00       	mov    $0x4a,%edx
+     480:	48 8d 0d 89 17 00 00 	lea    0x1789(%rip),%rcx        # 1c10 <malloc+0x181>
+     487:	48 89 ce             	mov    %rcx,%rsi
+     48a:	89 c7                	mov    %eax,%edi
+     48c:	b8 00 00 00 00       	mov    $0x0,%eax
+     491:	e8 77 0d 00 00       	call   120d <printf>
+     496:	8b 05 64 1d 00 00    	mov    0x1d64(%rip),%eax        # 2200 <stdout>
+     49c:	48 8d 15 27 18 00 00 	lea    0x1827(%rip),%rdx        # 1cca <malloc+0x23b>
+     4a3:	48 89 d6             	mov    %rdx,%rsi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ad:	e8 5b 0d 00 00       	call   120d <printf>
+     4b2:	8b 05 48 1d 00 00    	mov    0x1d48(%rip),%eax        # 2200 <stdout>
+     4b8:	48 8d 15 88 17 00 00 	lea    0x1788(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     4bf:	48 89 d6             	mov    %rdx,%rsi
+     4c2:	89 c7                	mov    %eax,%edi
+     4c4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4c9:	e8 3f 0d 00 00       	call   120d <printf>
+     4ce:	90                   	nop
+     4cf:	eb fd                	jmp    4ce <ringtest+0xf7>
+  if(pid == 0){
+     4d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     4d5:	75 19                	jne    4f0 <ringtest+0x119>
+    close(fds[0]);
+     4d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4da:	89 c7                	mov    %eax,%edi
+     4dc:	e8 fb 12 00 00       	call   17dc <close>
+    writestream(fds[1]);
+     4e1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4e4:	89 c7                	mov    %eax,%edi
+     4e6:	e8 15 fb ff ff       	call   0 <writestream>
+    exit();
+     4eb:	e8 c4 12 00 00       	call   17b4 <exit>
+  }
+  close(fds[1]);
+     4f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4f3:	89 c7                	mov    %eax,%edi
+     4f5:	e8 e2 12 00 00       	call   17dc <close>
+  readstream(fds[0]);
+     4fa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     4fd:	89 c7                	mov    %eax,%edi
+     4ff:	e8 58 fc ff ff       	call   15c <readstream>
+  close(fds[0]);
+     504:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     507:	89 c7                	mov    %eax,%edi
+     509:	e8 ce 12 00 00       	call   17dc <close>
+  wait();
+     50e:	e8 a9 12 00 00       	call   17bc <wait>
+  printf(stdout, "ringtest OK\n");
+     513:	8b 05 e7 1c 00 00    	mov    0x1ce7(%rip),%eax        # 2200 <stdout>
+     519:	48 8d 15 b6 17 00 00 	lea    0x17b6(%rip),%rdx        # 1cd6 <malloc+0x247>
+     520:	48 89 d6             	mov    %rdx,%rsi
+     523:	89 c7                	mov    %eax,%edi
+     525:	b8 00 00 00 00       	mov    $0x0,%eax
+     52a:	e8 de 0c 00 00       	call   120d <printf>
+}
+     52f:	90                   	nop
+     530:	c9                   	leave
+     531:	c3                   	ret
+
+0000000000000532 <blockingtest>:
+
+// A single write bigger than the pipe returns only once all of it is
+// in, while a slow reader takes it out.
+void
+blockingtest(void)
+{
+     532:	55                   	push   %rbp
+     533:	48 89 e5             	mov    %rsp,%rbp
+     536:	48 83 ec 20          	sub    $0x20,%rsp
+  int fds[2], pid, n, total;
+  char *big;
+
+  printf(stdout, "blockingtest\n");
+     53a:	8b 05 c0 1c 00 00    	mov    0x1cc0(%rip),%eax        # 2200 <stdout>
+     540:	48 8d 15 9c 17 00 00 	lea    0x179c(%rip),%rdx        # 1ce3 <malloc+0x254>
+     547:	48 89 d6             	mov    %rdx,%rsi
+     54a:	89 c7                	mov    %eax,%edi
+     54c:	b8 00 00 00 00       	mov    $0x0,%eax
+     551:	e8 b7 0c 00 00       	call   120d <printf>
+  if(pipe(fds) < 0)
+     556:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     55a:	48 89 c7             	mov    %rax,%rdi
+     55d:	e8 62 12 00 00       	call   17c4 <pipe>
+     562:	85 c0                	test   %eax,%eax
+     564:	79 5c                	jns    5c2 <blockingtest+0x90>
+    error("pipe failed");
+     566:	8b 05 94 1c 00 00    	mov    0x1c94(%rip),%eax        # 2200 <stdout>
+     56c:	ba 61 00 00 00       	mov    $0x61,%edx
+     571:	48 8d 0d 98 16 00 00 	lea    0x1698(%rip),%rcx        # 1c10 <malloc+0x181>
+     578:	48 89 ce             	mov    %rcx,%rsi
+     57b:	89 c7                	mov    %eax,%edi
+     57d:	b8 00 00 00 00       	mov    $0x0,%eax
+     582:	e8 86 0c 00 00       	call   120d <printf>
+     587:	8b 05 73 1c 00 00    	mov    0x1c73(%rip),%eax        # 2200 <stdout>
+     58d:	48 8d 15 2a 17 00 00 	lea    0x172a(%rip),%rdx        # 1cbe <malloc+0x22f>
+     594:	48 89 d6             	mov    %rdx,%rsi
+     597:	89 c7                	mov    %eax,%edi
+     599:	b8 00 00 00 00       	mov    $0x0,%eax
+     59e:	e8 6a 0c 00 00       	call   120d <printf>
+     5a3:	8b 05 57 1c 00 00    	mov    0x1c57(%rip),%eax        # 2200 <stdout>
+     5a9:	48 8d 15 97 16 00 00 	lea    0x1697(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     5b0:	48 89 d6             	mov    %rdx,%rsi
+     5b3:	89 c7                	mov    %eax,%edi
+     5b5:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ba:	e8 4e 0c 00 00       	call   120d <printf>
+     5bf:	90                   	nop
+     5c0:	eb fd                	jmp    5bf <blockingtest+0x8d>
+  if((pid = fork()) < 0)
+     5c2:	e8 e5 11 00 00       	call   17ac <fork>
+     5c7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     5ca:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     5ce:	79 5c                	jns    62c <blockingtest+0xfa>
+    error("fork failed");
+     5d0:	8b 05 2a 1c 00 00    	mov    0x1c2a(%rip),%eax        # 2200 <stdout>
+     5d6:	ba 63 00 00 00       	mov    $0x63,%edx
+     5db:	48 8d 0d 2e 16 00 00 	lea    0x162e(%rip),%rcx        # 1c10 <malloc+0x181>
+     5e2:	48 89 ce             	mov    %rcx,%rsi
+     5e5:	89 c7                	mov    %eax,%edi
+     5e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ec:	e8 1c 0c 00 00       	call   120d <printf>
+     5f1:	8b 05 09 1c 00 00    	mov    0x1c09(%rip),%eax        # 2200 <stdout>
+     5f7:	48 8d 15 cc 16 00 00 	lea    0x16cc(%rip),%rdx        # 1cca <malloc+0x23b>
+     5fe:	48 89 d6             	mov    %rdx,%rsi
+     601:	89 c7                	mov    %eax,%edi
+     603:	b8 00 00 00 00       	mov    $0x0,%eax
+     608:	e8 00 0c 00 00       	call   120d <printf>
+     60d:	8b 05 ed 1b 00 00    	mov    0x1bed(%rip),%eax        # 2200 <stdout>
+     613:	48 8d 15 2d 16 00 00 	lea    0x162d(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     61a:	48 89 d6             	mov    %rdx,%rsi
+     61d:	89 c7                	mov    %eax,%edi
+     61f:	b8 00 00 00 00       	mov    $0x0,%eax
+     624:	e8 e4 0b 00 00       	call   120d <printf>
+     629:	90                   	nop
+     62a:	eb fd                	jmp    629 <blockingtest+0xf7>
+  if(pid == 0){
+     62c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     630:	0f 85 b4 00 00 00    	jne    6ea <blockingtest+0x1b8>
+    close(fds[1]);
+     636:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     639:	89 c7                	mov    %eax,%edi
+     63b:	e8 9c 11 00 00       	call   17dc <close>
+    for(total = 0; (n = read(fds[0], buf, PGSIZE)) > 0; total += n)
+     640:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     647:	eb 10                	jmp    659 <blockingtest+0x127>
+      sleep(1);
+     649:	bf 01 00 00 00       	mov    $0x1,%edi
+     64e:	e8 f1 11 00 00       	call   1844 <sleep>
+    for(total = 0; (n = read(fds[0], buf, PGSIZE)) > 0; total += n)
+     653:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     656:	01 45 fc             	add    %eax,-0x4(%rbp)
+     659:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     65c:	ba 00 10 00 00       	mov    $0x1000,%edx
+     661:	48 8d 0d 58 1c 00 00 	lea    0x1c58(%rip),%rcx        # 22c0 <buf>
+     668:	48 89 ce             	mov    %rcx,%rsi
+     66b:	89 c7                	mov    %eax,%edi
+     66d:	e8 5a 11 00 00       	call   17cc <read>
+     672:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     675:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     679:	7f ce                	jg     649 <blockingtest+0x117>
+    if(total != 20 * PGSIZE)
+     67b:	81 7d fc 00 40 01 00 	cmpl   $0x14000,-0x4(%rbp)
+     682:	74 61                	je     6e5 <blockingtest+0x1b3>
+      error("reader got %d bytes, not %d", total, 20 * PGSIZE);
+     684:	8b 05 76 1b 00 00    	mov    0x1b76(%rip),%eax        # 2200 <stdout>
+     68a:	ba 69 00 00 00       	mov    $0x69,%edx
+     68f:	48 8d 0d 7a 15 00 00 	lea    0x157a(%rip),%rcx        # 1c10 <malloc+0x181>
+     696:	48 89 ce             	mov    %rcx,%rsi
+     699:	89 c7                	mov    %eax,%edi
+     69b:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a0:	e8 68 0b 00 00       	call   120d <printf>
+     6a5:	8b 05 55 1b 00 00    	mov    0x1b55(%rip),%eax        # 2200 <stdout>
+     6ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     6ae:	b9 00 40 01 00       	mov    $0x14000,%ecx
+     6b3:	48 8d 35 37 16 00 00 	lea    0x1637(%rip),%rsi        # 1cf1 <malloc+0x262>
+     6ba:	89 c7                	mov    %eax,%edi
+     6bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c1:	e8 47 0b 00 00       	call   120d <printf>
+     6c6:	8b 05 34 1b 00 00    	mov    0x1b34(%rip),%eax        # 2200 <stdout>
+     6cc:	48 8d 15 74 15 00 00 	lea    0x1574(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     6d3:	48 89 d6             	mov    %rdx,%rsi
+     6d6:	89 c7                	mov    %eax,%edi
+     6d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     6dd:	e8 2b 0b 00 00       	call   120d <printf>
+     6e2:	90                   	nop
+     6e3:	eb fd                	jmp    6e2 <blockingtest+0x1b0>
+    exit();
+     6e5:	e8 ca 10 00 00       	call   17b4 <exit>
+  }
+  close(fds[0]);
+     6ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     6ed:	89 c7                	mov    %eax,%edi
+     6ef:	e8 e8 10 00 00       	call   17dc <close>
+  big = malloc(20 * PGSIZE);
+     6f4:	bf 00 40 01 00       	mov    $0x14000,%edi
+     6f9:	e8 91 13 00 00       	call   1a8f <malloc>
+     6fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  memset(big, 'x', 20 * PGSIZE);
+     702:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     706:	ba 00 40 01 00       	mov    $0x14000,%edx
+     70b:	be 78 00 00 00       	mov    $0x78,%esi
+     710:	48 89 c7             	mov    %rax,%rdi
+     713:	e8 b3 0e 00 00       	call   15cb <memset>
+  if((n = write(fds[1], big, 20 * PGSIZE)) != 20 * PGSIZE)
+     718:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     71b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     71f:	ba 00 40 01 00       	mov    $0x14000,%edx
+     724:	48 89 ce             	mov    %rcx,%rsi
+     727:	89 c7                	mov    %eax,%edi
+     729:	e8 a6 10 00 00       	call   17d4 <write>
+     72e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     731:	81 7d ec 00 40 01 00 	cmpl   $0x14000,-0x14(%rbp)
+     738:	74 61                	je     79b <blockingtest+0x269>
+    error("write returned %d, not %d", n, 20 * PGSIZE);
+     73a:	8b 05 c0 1a 00 00    	mov    0x1ac0(%rip),%eax        # 2200 <stdout>
+     740:	ba 70 00 00 00       	mov    $0x70,%edx
+     745:	48 8d 0d c4 14 00 00 	lea    0x14c4(%rip),%rcx        # 1c10 <malloc+0x181>
+     74c:	48 89 ce             	mov    %rcx,%rsi
+     74f:	89 c7                	mov    %eax,%edi
+     751:	b8 00 00 00 00       	mov    $0x0,%eax
+     756:	e8 b2 0a 00 00       	call   120d <printf>
+     75b:	8b 05 9f 1a 00 00    	mov    0x1a9f(%rip),%eax        # 2200 <stdout>
+     761:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     764:	b9 00 40 01 00       	mov    $0x14000,%ecx
+     769:	48 8d 35 9d 15 00 00 	lea    0x159d(%rip),%rsi        # 1d0d <malloc+0x27e>
+     770:	89 c7                	mov    %eax,%edi
+     772:	b8 00 00 00 00       	mov    $0x0,%eax
+     777:	e8 91 0a 00 00       	call   120d <printf>
+     77c:	8b 05 7e 1a 00 00    	mov    0x1a7e(%rip),%eax        # 2200 <stdout>
+     782:	48 8d 15 be 14 00 00 	lea    0x14be(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     789:	48 89 d6             	mov    %rdx,%rsi
+     78c:	89 c7                	mov    %eax,%edi
+     78e:	b8 00 00 00 00       	mov    $0x0,%eax
+     793:	e8 75 0a 00 00       	call   120d <printf>
+     798:	90                   	nop
+     799:	eb fd                	jmp    798 <blockingtest+0x266>
+  free(big);
+     79b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     79f:	48 89 c7             	mov    %rax,%rdi
+     7a2:	e8 2c 11 00 00       	call   18d3 <free>
+  close(fds[1]);
+     7a7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     7aa:	89 c7                	mov    %eax,%edi
+     7ac:	e8 2b 10 00 00       	call   17dc <close>
+  wait();
+     7b1:	e8 06 10 00 00       	call   17bc <wait>
+  printf(stdout, "blockingtest OK\n");
+     7b6:	8b 05 44 1a 00 00    	mov    0x1a44(%rip),%eax        # 2200 <stdout>
+     7bc:	48 8d 15 64 15 00 00 	lea    0x1564(%rip),%rdx        # 1d27 <malloc+0x298>
+     7c3:	48 89 d6             	mov    %rdx,%rsi
+     7c6:	89 c7                	mov    %eax,%edi
+     7c8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7cd:	e8 3b 0a 00 00       	call   120d <printf>
+}
+     7d2:	90                   	nop
+     7d3:	c9                   	leave
+     7d4:	c3                   	ret
+
+00000000000007d5 <faulttest>:
+
+// Reads into and writes from memory that is not mapped in yet take a
+// page fault in the middle of the copy.
+void
+faulttest(void)
+{
+     7d5:	55                   	push   %rbp
+     7d6:	48 89 e5             	mov    %rsp,%rbp
+     7d9:	48 83 ec 20          	sub    $0x20,%rsp
+  int fds[2], fd, i;
+  char *src, *dst;
+
+  printf(stdout, "faulttest\n");
+     7dd:	8b 05 1d 1a 00 00    	mov    0x1a1d(%rip),%eax        # 2200 <stdout>
+     7e3:	48 8d 15 4e 15 00 00 	lea    0x154e(%rip),%rdx        # 1d38 <malloc+0x2a9>
+     7ea:	48 89 d6             	mov    %rdx,%rsi
+     7ed:	89 c7                	mov    %eax,%edi
+     7ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     7f4:	e8 14 0a 00 00       	call   120d <printf>
+  if((fd = open("pipe1.txt", O_CREATE | O_RDWR)) < 0)
+     7f9:	be 02 02 00 00       	mov    $0x202,%esi
+     7fe:	48 8d 05 3e 15 00 00 	lea    0x153e(%rip),%rax        # 1d43 <malloc+0x2b4>
+     805:	48 89 c7             	mov    %rax,%rdi
+     808:	e8 e7 0f 00 00       	call   17f4 <open>
+     80d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     810:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     814:	79 5c                	jns    872 <faulttest+0x9d>
+    error("unable to create pipe1.txt");
+     816:	8b 05 e4 19 00 00    	mov    0x19e4(%rip),%eax        # 2200 <stdout>
+     81c:	ba 81 00 00 00       	mov    $0x81,%edx
+     821:	48 8d 0d e8 13 00 00 	lea    0x13e8(%rip),%rcx        # 1c10 <malloc+0x181>
+     828:	48 89 ce             	mov    %rcx,%rsi
+     82b:	89 c7                	mov    %eax,%edi
+     82d:	b8 00 00 00 00       	mov    $0x0,%eax
+     832:	e8 d6 09 00 00       	call   120d <printf>
+     837:	8b 05 c3 19 00 00    	mov    0x19c3(%rip),%eax        # 2200 <stdout>
+     83d:	48 8d 15 09 15 00 00 	lea    0x1509(%rip),%rdx        # 1d4d <malloc+0x2be>
+     844:	48 89 d6             	mov    %rdx,%rsi
+     847:	89 c7                	mov    %eax,%edi
+     849:	b8 00 00 00 00       	mov    $0x0,%eax
+     84e:	e8 ba 09 00 00       	call   120d <printf>
+     853:	8b 05 a7 19 00 00    	mov    0x19a7(%rip),%eax        # 2200 <stdout>
+     859:	48 8d 15 e7 13 00 00 	lea    0x13e7(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     860:	48 89 d6             	mov    %rdx,%rsi
+     863:	89 c7                	mov    %eax,%edi
+     865:	b8 00 00 00 00       	mov    $0x0,%eax
+     86a:	e8 9e 09 00 00       	call   120d <printf>
+     86f:	90                   	nop
+     870:	eb fd                	jmp    86f <faulttest+0x9a>
+  for(i = 0; i < 2; i++){
+     872:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     879:	e9 9c 00 00 00       	jmp    91a <faulttest+0x145>
+    memset(buf, 'p' + i, PGSIZE);
+     87e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     881:	83 c0 70             	add    $0x70,%eax
+     884:	ba 00 10 00 00       	mov    $0x1000,%edx
+     889:	89 c6                	mov    %eax,%esi
+     88b:	48 8d 05 2e 1a 00 00 	lea    0x1a2e(%rip),%rax        # 22c0 <buf>
+     892:	48 89 c7             	mov    %rax,%rdi
+     895:	e8 31 0d 00 00       	call   15cb <memset>
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+     89a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     89d:	ba 00 10 00 00       	mov    $0x1000,%edx
+     8a2:	48 8d 0d 17 1a 00 00 	lea    0x1a17(%rip),%rcx        # 22c0 <buf>
+     8a9:	48 89 ce             	mov    %rcx,%rsi
+     8ac:	89 c7                	mov    %eax,%edi
+     8ae:	e8 21 0f 00 00       	call   17d4 <write>
+     8b3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     8b8:	74 5c                	je     916 <faulttest+0x141>
+      error("unable to write pipe1.txt");
+     8ba:	8b 05 40 19 00 00    	mov    0x1940(%rip),%eax        # 2200 <stdout>
+     8c0:	ba 85 00 00 00       	mov    $0x85,%edx
+     8c5:	48 8d 0d 44 13 00 00 	lea    0x1344(%rip),%rcx        # 1c10 <malloc+0x181>
+     8cc:	48 89 ce             	mov    %rcx,%rsi
+     8cf:	89 c7                	mov    %eax,%edi
+     8d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d6:	e8 32 09 00 00       	call   120d <printf>
+     8db:	8b 05 1f 19 00 00    	mov    0x191f(%rip),%eax        # 2200 <stdout>
+     8e1:	48 8d 15 80 14 00 00 	lea    0x1480(%rip),%rdx        # 1d68 <malloc+0x2d9>
+     8e8:	48 89 d6             	mov    %rdx,%rsi
+     8eb:	89 c7                	mov    %eax,%edi
+     8ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     8f2:	e8 16 09 00 00       	call   120d <printf>
+     8f7:	8b 05 03 19 00 00    	mov    0x1903(%rip),%eax        # 2200 <stdout>
+     8fd:	48 8d 15 43 13 00 00 	lea    0x1343(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     904:	48 89 d6             	mov    %rdx,%rsi
+     907:	89 c7                	mov    %eax,%edi
+     909:	b8 00 00 00 00       	mov    $0x0,%eax
+     90e:	e8 fa 08 00 00       	call   120d <printf>
+     913:	90                   	nop
+     914:	eb fd                	jmp    913 <faulttest+0x13e>
+  for(i = 0; i < 2; i++){
+     916:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     91a:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+     91e:	0f 8e 5a ff ff ff    	jle    87e <faulttest+0xa9>
+  }
+
+  src = mmap2(0, 2 * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+     924:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     927:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     92d:	41 89 c0             	mov    %eax,%r8d
+     930:	b9 02 00 00 00       	mov    $0x2,%ecx
+     935:	ba 01 00 00 00       	mov    $0x1,%edx
+     93a:	be 00 20 00 00       	mov    $0x2000,%esi
+     93f:	bf 00 00 00 00       	mov    $0x0,%edi
+     944:	e8 2b 0f 00 00       	call   1874 <mmap2>
+     949:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  dst = mmap2(0, 2 * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+     94d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     953:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+     959:	b9 22 00 00 00       	mov    $0x22,%ecx
+     95e:	ba 03 00 00 00       	mov    $0x3,%edx
+     963:	be 00 20 00 00       	mov    $0x2000,%esi
+     968:	bf 00 00 00 00       	mov    $0x0,%edi
+     96d:	e8 02 0f 00 00       	call   1874 <mmap2>
+     972:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if(src == MAP_FAILED || dst == MAP_FAILED)
+     976:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     97b:	74 07                	je     984 <faulttest+0x1af>
+     97d:	48 83 7d e8 ff       	cmpq   $0xffffffffffffffff,-0x18(%rbp)
+     982:	75 5c                	jne    9e0 <faulttest+0x20b>
+    error("mmap2 failed");
+     984:	8b 05 76 18 00 00    	mov    0x1876(%rip),%eax        # 2200 <stdout>
+     98a:	ba 8b 00 00 00       	mov    $0x8b,%edx
+     98f:	48 8d 0d 7a 12 00 00 	lea    0x127a(%rip),%rcx        # 1c10 <malloc+0x181>
+     996:	48 89 ce             	mov    %rcx,%rsi
+     999:	89 c7                	mov    %eax,%edi
+     99b:	b8 00 00 00 00       	mov    $0x0,%eax
+     9a0:	e8 68 08 00 00       	call   120d <printf>
+     9a5:	8b 05 55 18 00 00    	mov    0x1855(%rip),%eax        # 2200 <stdout>
+     9ab:	48 8d 15 d0 13 00 00 	lea    0x13d0(%rip),%rdx        # 1d82 <malloc+0x2f3>
+     9b2:	48 89 d6             	mov    %rdx,%rsi
+     9b5:	89 c7                	mov    %eax,%edi
+     9b7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9bc:	e8 4c 08 00 00       	call   120d <printf>
+     9c1:	8b 05 39 18 00 00    	mov    0x1839(%rip),%eax        # 2200 <stdout>
+     9c7:	48 8d 15 79 12 00 00 	lea    0x1279(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     9ce:	48 89 d6             	mov    %rdx,%rsi
+     9d1:	89 c7                	mov    %eax,%edi
+     9d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d8:	e8 30 08 00 00       	call   120d <printf>
+     9dd:	90                   	nop
+     9de:	eb fd                	jmp    9dd <faulttest+0x208>
+  if(pipe(fds) < 0)
+     9e0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+     9e4:	48 89 c7             	mov    %rax,%rdi
+     9e7:	e8 d8 0d 00 00       	call   17c4 <pipe>
+     9ec:	85 c0                	test   %eax,%eax
+     9ee:	79 5c                	jns    a4c <faulttest+0x277>
+    error("pipe failed");
+     9f0:	8b 05 0a 18 00 00    	mov    0x180a(%rip),%eax        # 2200 <stdout>
+     9f6:	ba 8d 00 00 00       	mov    $0x8d,%edx
+     9fb:	48 8d 0d 0e 12 00 00 	lea    0x120e(%rip),%rcx        # 1c10 <malloc+0x181>
+     a02:	48 89 ce             	mov    %rcx,%rsi
+     a05:	89 c7                	mov    %eax,%edi
+     a07:	b8 00 00 00 00       	mov    $0x0,%eax
+     a0c:	e8 fc 07 00 00       	call   120d <printf>
+     a11:	8b 05 e9 17 00 00    	mov    0x17e9(%rip),%eax        # 2200 <stdout>
+     a17:	48 8d 15 a0 12 00 00 	lea    0x12a0(%rip),%rdx        # 1cbe <malloc+0x22f>
+     a1e:	48 89 d6             	mov    %rdx,%rsi
+     a21:	89 c7                	mov    %eax,%edi
+     a23:	b8 00 00 00 00       	mov    $0x0,%eax
+     a28:	e8 e0 07 00 00       	call   120d <printf>
+     a2d:	8b 05 cd 17 00 00    	mov    0x17cd(%rip),%eax        # 2200 <stdout>
+     a33:	48 8d 15 0d 12 00 00 	lea    0x120d(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     a3a:	48 89 d6             	mov    %rdx,%rsi
+     a3d:	89 c7                	mov    %eax,%edi
+     a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a44:	e8 c4 07 00 00       	call   120d <printf>
+     a49:	90                   	nop
+     a4a:	eb fd                	jmp    a49 <faulttest+0x274>
+  if(write(fds[1], src, 2 * PGSIZE) != 2 * PGSIZE)
+     a4c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     a4f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+     a53:	ba 00 20 00 00       	mov    $0x2000,%edx
+     a58:	48 89 ce             	mov    %rcx,%rsi
+     a5b:	89 c7                	mov    %eax,%edi
+     a5d:	e8 72 0d 00 00       	call   17d4 <write>
+     a62:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     a67:	74 5c                	je     ac5 <faulttest+0x2f0>
+    error("write from an untouched file mapping failed");
+     a69:	8b 05 91 17 00 00    	mov    0x1791(%rip),%eax        # 2200 <stdout>
+     a6f:	ba 8f 00 00 00       	mov    $0x8f,%edx
+     a74:	48 8d 0d 95 11 00 00 	lea    0x1195(%rip),%rcx        # 1c10 <malloc+0x181>
+     a7b:	48 89 ce             	mov    %rcx,%rsi
+     a7e:	89 c7                	mov    %eax,%edi
+     a80:	b8 00 00 00 00       	mov    $0x0,%eax
+     a85:	e8 83 07 00 00       	call   120d <printf>
+     a8a:	8b 05 70 17 00 00    	mov    0x1770(%rip),%eax        # 2200 <stdout>
+     a90:	48 8d 15 f9 12 00 00 	lea    0x12f9(%rip),%rdx        # 1d90 <malloc+0x301>
+     a97:	48 89 d6             	mov    %rdx,%rsi
+     a9a:	89 c7                	mov    %eax,%edi
+     a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa1:	e8 67 07 00 00       	call   120d <printf>
+     aa6:	8b 05 54 17 00 00    	mov    0x1754(%rip),%eax        # 2200 <stdout>
+     aac:	48 8d 15 94 11 00 00 	lea    0x1194(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     ab3:	48 89 d6             	mov    %rdx,%rsi
+     ab6:	89 c7                	mov    %eax,%edi
+     ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+     abd:	e8 4b 07 00 00       	call   120d <printf>
+     ac2:	90                   	nop
+     ac3:	eb fd                	jmp    ac2 <faulttest+0x2ed>
+  if(read(fds[0], dst, 2 * PGSIZE) != 2 * PGSIZE)
+     ac5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     ac8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     acc:	ba 00 20 00 00       	mov    $0x2000,%edx
+     ad1:	48 89 ce             	mov    %rcx,%rsi
+     ad4:	89 c7                	mov    %eax,%edi
+     ad6:	e8 f1 0c 00 00       	call   17cc <read>
+     adb:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     ae0:	74 5c                	je     b3e <faulttest+0x369>
+    error("read into an untouched anonymous mapping failed");
+     ae2:	8b 05 18 17 00 00    	mov    0x1718(%rip),%eax        # 2200 <stdout>
+     ae8:	ba 91 00 00 00       	mov    $0x91,%edx
+     aed:	48 8d 0d 1c 11 00 00 	lea    0x111c(%rip),%rcx        # 1c10 <malloc+0x181>
+     af4:	48 89 ce             	mov    %rcx,%rsi
+     af7:	89 c7                	mov    %eax,%edi
+     af9:	b8 00 00 00 00       	mov    $0x0,%eax
+     afe:	e8 0a 07 00 00       	call   120d <printf>
+     b03:	8b 05 f7 16 00 00    	mov    0x16f7(%rip),%eax        # 2200 <stdout>
+     b09:	48 8d 15 b0 12 00 00 	lea    0x12b0(%rip),%rdx        # 1dc0 <malloc+0x331>
+     b10:	48 89 d6             	mov    %rdx,%rsi
+     b13:	89 c7                	mov    %eax,%edi
+     b15:	b8 00 00 00 00       	mov    $0x0,%eax
+     b1a:	e8 ee 06 00 00       	call   120d <printf>
+     b1f:	8b 05 db 16 00 00    	mov    0x16db(%rip),%eax        # 2200 <stdout>
+     b25:	48 8d 15 1b 11 00 00 	lea    0x111b(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     b2c:	48 89 d6             	mov    %rdx,%rsi
+     b2f:	89 c7                	mov    %eax,%edi
+     b31:	b8 00 00 00 00       	mov    $0x0,%eax
+     b36:	e8 d2 06 00 00       	call   120d <printf>
+     b3b:	90                   	nop
+     b3c:	eb fd                	jmp    b3b <faulttest+0x366>
+  for(i = 0; i < 2 * PGSIZE; i++)
+     b3e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b45:	e9 9e 00 00 00       	jmp    be8 <faulttest+0x413>
+    if(dst[i] != 'p' + i / PGSIZE)
+     b4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b4d:	48 63 d0             	movslq %eax,%rdx
+     b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b54:	48 01 d0             	add    %rdx,%rax
+     b57:	0f b6 00             	movzbl (%rax),%eax
+     b5a:	0f be d0             	movsbl %al,%edx
+     b5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b60:	8d 88 ff 0f 00 00    	lea    0xfff(%rax),%ecx
+     b66:	85 c0                	test   %eax,%eax
+     b68:	0f 48 c1             	cmovs  %ecx,%eax
+     b6b:	c1 f8 0c             	sar    $0xc,%eax
+     b6e:	83 c0 70             	add    $0x70,%eax
+     b71:	39 c2                	cmp    %eax,%edx
+     b73:	74 6f                	je     be4 <faulttest+0x40f>
+      error("byte %d is %d", i, dst[i]);
+     b75:	8b 05 85 16 00 00    	mov    0x1685(%rip),%eax        # 2200 <stdout>
+     b7b:	ba 94 00 00 00       	mov    $0x94,%edx
+     b80:	48 8d 0d 89 10 00 00 	lea    0x1089(%rip),%rcx        # 1c10 <malloc+0x181>
+     b87:	48 89 ce             	mov    %rcx,%rsi
+     b8a:	89 c7                	mov    %eax,%edi
+     b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     b91:	e8 77 06 00 00       	call   120d <printf>
+     b96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b99:	48 63 d0             	movslq %eax,%rdx
+     b9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ba0:	48 01 d0             	add    %rdx,%rax
+     ba3:	0f b6 00             	movzbl (%rax),%eax
+     ba6:	0f be c8             	movsbl %al,%ecx
+     ba9:	8b 05 51 16 00 00    	mov    0x1651(%rip),%eax        # 2200 <stdout>
+     baf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     bb2:	48 8d 35 37 12 00 00 	lea    0x1237(%rip),%rsi        # 1df0 <malloc+0x361>
+     bb9:	89 c7                	mov    %eax,%edi
+     bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc0:	e8 48 06 00 00       	call   120d <printf>
+     bc5:	8b 05 35 16 00 00    	mov    0x1635(%rip),%eax        # 2200 <stdout>
+     bcb:	48 8d 15 75 10 00 00 	lea    0x1075(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     bd2:	48 89 d6             	mov    %rdx,%rsi
+     bd5:	89 c7                	mov    %eax,%edi
+     bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+     bdc:	e8 2c 06 00 00       	call   120d <printf>
+     be1:	90                   	nop
+     be2:	eb fd                	jmp    be1 <faulttest+0x40c>
+  for(i = 0; i < 2 * PGSIZE; i++)
+     be4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     be8:	81 7d fc ff 1f 00 00 	cmpl   $0x1fff,-0x4(%rbp)
+     bef:	0f 8e 55 ff ff ff    	jle    b4a <faulttest+0x375>
+  close(fds[0]);
+     bf5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     bf8:	89 c7                	mov    %eax,%edi
+     bfa:	e8 dd 0b 00 00       	call   17dc <close>
+  close(fds[1]);
+     bff:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     c02:	89 c7                	mov    %eax,%edi
+     c04:	e8 d3 0b 00 00       	call   17dc <close>
+  if(munmap2(src, 2 * PGSIZE) < 0 || munmap2(dst, 2 * PGSIZE) < 0)
+     c09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c0d:	be 00 20 00 00       	mov    $0x2000,%esi
+     c12:	48 89 c7             	mov    %rax,%rdi
+     c15:	e8 69 0c 00 00       	call   1883 <munmap2>
+     c1a:	85 c0                	test   %eax,%eax
+     c1c:	78 15                	js     c33 <faulttest+0x45e>
+     c1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     c22:	be 00 20 00 00       	mov    $0x2000,%esi
+     c27:	48 89 c7             	mov    %rax,%rdi
+     c2a:	e8 54 0c 00 00       	call   1883 <munmap2>
+     c2f:	85 c0                	test   %eax,%eax
+     c31:	79 5c                	jns    c8f <faulttest+0x4ba>
+    error("munmap2 failed");
+     c33:	8b 05 c7 15 00 00    	mov    0x15c7(%rip),%eax        # 2200 <stdout>
+     c39:	ba 98 00 00 00       	mov    $0x98,%edx
+     c3e:	48 8d 0d cb 0f 00 00 	lea    0xfcb(%rip),%rcx        # 1c10 <malloc+0x181>
+     c45:	48 89 ce             	mov    %rcx,%rsi
+     c48:	89 c7                	mov    %eax,%edi
+     c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c4f:	e8 b9 05 00 00       	call   120d <printf>
+     c54:	8b 05 a6 15 00 00    	mov    0x15a6(%rip),%eax        # 2200 <stdout>
+     c5a:	48 8d 15 9d 11 00 00 	lea    0x119d(%rip),%rdx        # 1dfe <malloc+0x36f>
+     c61:	48 89 d6             	mov    %rdx,%rsi
+     c64:	89 c7                	mov    %eax,%edi
+     c66:	b8 00 00 00 00       	mov    $0x0,%eax
+     c6b:	e8 9d 05 00 00       	call   120d <printf>
+     c70:	8b 05 8a 15 00 00    	mov    0x158a(%rip),%eax        # 2200 <stdout>
+     c76:	48 8d 15 ca 0f 00 00 	lea    0xfca(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     c7d:	48 89 d6             	mov    %rdx,%rsi
+     c80:	89 c7                	mov    %eax,%edi
+     c82:	b8 00 00 00 00       	mov    $0x0,%eax
+     c87:	e8 81 05 00 00       	call   120d <printf>
+     c8c:	90                   	nop
+     c8d:	eb fd                	jmp    c8c <faulttest+0x4b7>
+  close(fd);
+     c8f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c92:	89 c7                	mov    %eax,%edi
+     c94:	e8 43 0b 00 00       	call   17dc <close>
+  unlink("pipe1.txt");
+     c99:	48 8d 05 a3 10 00 00 	lea    0x10a3(%rip),%rax        # 1d43 <malloc+0x2b4>
+     ca0:	48 89 c7             	mov    %rax,%rdi
+     ca3:	e8 5c 0b 00 00       	call   1804 <unlink>
+  printf(stdout, "faulttest OK\n");
+     ca8:	8b 05 52 15 00 00    	mov    0x1552(%rip),%eax        # 2200 <stdout>
+     cae:	48 8d 15 58 11 00 00 	lea    0x1158(%rip),%rdx        # 1e0d <malloc+0x37e>
+     cb5:	48 89 d6             	mov    %rdx,%rsi
+     cb8:	89 c7                	mov    %eax,%edi
+     cba:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbf:	e8 49 05 00 00       	call   120d <printf>
+}
+     cc4:	90                   	nop
+     cc5:	c9                   	leave
+     cc6:	c3                   	ret
+
+0000000000000cc7 <closetest>:
+
+// Closing one end shows at the other.
+void
+closetest(void)
+{
+     cc7:	55                   	push   %rbp
+     cc8:	48 89 e5             	mov    %rsp,%rbp
+     ccb:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], n;
+
+  printf(stdout, "closetest\n");
+     ccf:	8b 05 2b 15 00 00    	mov    0x152b(%rip),%eax        # 2200 <stdout>
+     cd5:	48 8d 15 3f 11 00 00 	lea    0x113f(%rip),%rdx        # 1e1b <malloc+0x38c>
+     cdc:	48 89 d6             	mov    %rdx,%rsi
+     cdf:	89 c7                	mov    %eax,%edi
+     ce1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce6:	e8 22 05 00 00       	call   120d <printf>
+  if(pipe(fds) < 0)
+     ceb:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     cef:	48 89 c7             	mov    %rax,%rdi
+     cf2:	e8 cd 0a 00 00       	call   17c4 <pipe>
+     cf7:	85 c0                	test   %eax,%eax
+     cf9:	79 5c                	jns    d57 <closetest+0x90>
+    error("pipe failed");
+     cfb:	8b 05 ff 14 00 00    	mov    0x14ff(%rip),%eax        # 2200 <stdout>
+     d01:	ba a6 00 00 00       	mov    $0xa6,%edx
+     d06:	48 8d 0d 03 0f 00 00 	lea    0xf03(%rip),%rcx        # 1c10 <malloc+0x181>
+     d0d:	48 89 ce             	mov    %rcx,%rsi
+     d10:	89 c7                	mov    %eax,%edi
+     d12:	b8 00 00 00 00       	mov    $0x0,%eax
+     d17:	e8 f1 04 00 00       	call   120d <printf>
+     d1c:	8b 05 de 14 00 00    	mov    0x14de(%rip),%eax        # 2200 <stdout>
+     d22:	48 8d 15 95 0f 00 00 	lea    0xf95(%rip),%rdx        # 1cbe <malloc+0x22f>
+     d29:	48 89 d6             	mov    %rdx,%rsi
+     d2c:	89 c7                	mov    %eax,%edi
+     d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+     d33:	e8 d5 04 00 00       	call   120d <printf>
+     d38:	8b 05 c2 14 00 00    	mov    0x14c2(%rip),%eax        # 2200 <stdout>
+     d3e:	48 8d 15 02 0f 00 00 	lea    0xf02(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     d45:	48 89 d6             	mov    %rdx,%rsi
+     d48:	89 c7                	mov    %eax,%edi
+     d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4f:	e8 b9 04 00 00       	call   120d <printf>
+     d54:	90                   	nop
+     d55:	eb fd                	jmp    d54 <closetest+0x8d>
+  if(write(fds[1], "hello", 5) != 5)
+     d57:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     d5a:	ba 05 00 00 00       	mov    $0x5,%edx
+     d5f:	48 8d 0d c0 10 00 00 	lea    0x10c0(%rip),%rcx        # 1e26 <malloc+0x397>
+     d66:	48 89 ce             	mov    %rcx,%rsi
+     d69:	89 c7                	mov    %eax,%edi
+     d6b:	e8 64 0a 00 00       	call   17d4 <write>
+     d70:	83 f8 05             	cmp    $0x5,%eax
+     d73:	74 5c                	je     dd1 <closetest+0x10a>
+    error("write failed");
+     d75:	8b 05 85 14 00 00    	mov    0x1485(%rip),%eax        # 2200 <stdout>
+     d7b:	ba a8 00 00 00       	mov    $0xa8,%edx
+     d80:	48 8d 0d 89 0e 00 00 	lea    0xe89(%rip),%rcx        # 1c10 <malloc+0x181>
+     d87:	48 89 ce             	mov    %rcx,%rsi
+     d8a:	89 c7                	mov    %eax,%edi
+     d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     d91:	e8 77 04 00 00       	call   120d <printf>
+     d96:	8b 05 64 14 00 00    	mov    0x1464(%rip),%eax        # 2200 <stdout>
+     d9c:	48 8d 15 89 10 00 00 	lea    0x1089(%rip),%rdx        # 1e2c <malloc+0x39d>
+     da3:	48 89 d6             	mov    %rdx,%rsi
+     da6:	89 c7                	mov    %eax,%edi
+     da8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dad:	e8 5b 04 00 00       	call   120d <printf>
+     db2:	8b 05 48 14 00 00    	mov    0x1448(%rip),%eax        # 2200 <stdout>
+     db8:	48 8d 15 88 0e 00 00 	lea    0xe88(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     dbf:	48 89 d6             	mov    %rdx,%rsi
+     dc2:	89 c7                	mov    %eax,%edi
+     dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc9:	e8 3f 04 00 00       	call   120d <printf>
+     dce:	90                   	nop
+     dcf:	eb fd                	jmp    dce <closetest+0x107>
+  close(fds[1]);
+     dd1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     dd4:	89 c7                	mov    %eax,%edi
+     dd6:	e8 01 0a 00 00       	call   17dc <close>
+  if((n = read(fds[0], buf, sizeof(buf))) != 5)
+     ddb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     dde:	ba 00 30 00 00       	mov    $0x3000,%edx
+     de3:	48 8d 0d d6 14 00 00 	lea    0x14d6(%rip),%rcx        # 22c0 <buf>
+     dea:	48 89 ce             	mov    %rcx,%rsi
+     ded:	89 c7                	mov    %eax,%edi
+     def:	e8 d8 09 00 00       	call   17cc <read>
+     df4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     df7:	83 7d fc 05          	cmpl   $0x5,-0x4(%rbp)
+     dfb:	74 5f                	je     e5c <closetest+0x195>
+    error("read of what is left returned %d", n);
+     dfd:	8b 05 fd 13 00 00    	mov    0x13fd(%rip),%eax        # 2200 <stdout>
+     e03:	ba ab 00 00 00       	mov    $0xab,%edx
+     e08:	48 8d 0d 01 0e 00 00 	lea    0xe01(%rip),%rcx        # 1c10 <malloc+0x181>
+     e0f:	48 89 ce             	mov    %rcx,%rsi
+     e12:	89 c7                	mov    %eax,%edi
+     e14:	b8 00 00 00 00       	mov    $0x0,%eax
+     e19:	e8 ef 03 00 00       	call   120d <printf>
+     e1e:	8b 05 dc 13 00 00    	mov    0x13dc(%rip),%eax        # 2200 <stdout>
+     e24:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     e27:	48 8d 0d 12 10 00 00 	lea    0x1012(%rip),%rcx        # 1e40 <malloc+0x3b1>
+     e2e:	48 89 ce             	mov    %rcx,%rsi
+     e31:	89 c7                	mov    %eax,%edi
+     e33:	b8 00 00 00 00       	mov    $0x0,%eax
+     e38:	e8 d0 03 00 00       	call   120d <printf>
+     e3d:	8b 05 bd 13 00 00    	mov    0x13bd(%rip),%eax        # 2200 <stdout>
+     e43:	48 8d 15 fd 0d 00 00 	lea    0xdfd(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     e4a:	48 89 d6             	mov    %rdx,%rsi
+     e4d:	89 c7                	mov    %eax,%edi
+     e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e54:	e8 b4 03 00 00       	call   120d <printf>
+     e59:	90                   	nop
+     e5a:	eb fd                	jmp    e59 <closetest+0x192>
+  if((n = read(fds[0], buf, sizeof(buf))) != 0)
+     e5c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     e5f:	ba 00 30 00 00       	mov    $0x3000,%edx
+     e64:	48 8d 0d 55 14 00 00 	lea    0x1455(%rip),%rcx        # 22c0 <buf>
+     e6b:	48 89 ce             	mov    %rcx,%rsi
+     e6e:	89 c7                	mov    %eax,%edi
+     e70:	e8 57 09 00 00       	call   17cc <read>
+     e75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     e78:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     e7c:	74 5f                	je     edd <closetest+0x216>
+    error("read of a closed pipe returned %d", n);
+     e7e:	8b 05 7c 13 00 00    	mov    0x137c(%rip),%eax        # 2200 <stdout>
+     e84:	ba ad 00 00 00       	mov    $0xad,%edx
+     e89:	48 8d 0d 80 0d 00 00 	lea    0xd80(%rip),%rcx        # 1c10 <malloc+0x181>
+     e90:	48 89 ce             	mov    %rcx,%rsi
+     e93:	89 c7                	mov    %eax,%edi
+     e95:	b8 00 00 00 00       	mov    $0x0,%eax
+     e9a:	e8 6e 03 00 00       	call   120d <printf>
+     e9f:	8b 05 5b 13 00 00    	mov    0x135b(%rip),%eax        # 2200 <stdout>
+     ea5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     ea8:	48 8d 0d b9 0f 00 00 	lea    0xfb9(%rip),%rcx        # 1e68 <malloc+0x3d9>
+     eaf:	48 89 ce             	mov    %rcx,%rsi
+     eb2:	89 c7                	mov    %eax,%edi
+     eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb9:	e8 4f 03 00 00       	call   120d <printf>
+     ebe:	8b 05 3c 13 00 00    	mov    0x133c(%rip),%eax        # 2200 <stdout>
+     ec4:	48 8d 15 7c 0d 00 00 	lea    0xd7c(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     ecb:	48 89 d6             	mov    %rdx,%rsi
+     ece:	89 c7                	mov    %eax,%edi
+     ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed5:	e8 33 03 00 00       	call   120d <printf>
+     eda:	90                   	nop
+     edb:	eb fd                	jmp    eda <closetest+0x213>
+  close(fds[0]);
+     edd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ee0:	89 c7                	mov    %eax,%edi
+     ee2:	e8 f5 08 00 00       	call   17dc <close>
+
+  if(pipe(fds) < 0)
+     ee7:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+     eeb:	48 89 c7             	mov    %rax,%rdi
+     eee:	e8 d1 08 00 00       	call   17c4 <pipe>
+     ef3:	85 c0                	test   %eax,%eax
+     ef5:	79 5c                	jns    f53 <closetest+0x28c>
+    error("pipe failed");
+     ef7:	8b 05 03 13 00 00    	mov    0x1303(%rip),%eax        # 2200 <stdout>
+     efd:	ba b1 00 00 00       	mov    $0xb1,%edx
+     f02:	48 8d 0d 07 0d 00 00 	lea    0xd07(%rip),%rcx        # 1c10 <malloc+0x181>
+     f09:	48 89 ce             	mov    %rcx,%rsi
+     f0c:	89 c7                	mov    %eax,%edi
+     f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+     f13:	e8 f5 02 00 00       	call   120d <printf>
+     f18:	8b 05 e2 12 00 00    	mov    0x12e2(%rip),%eax        # 2200 <stdout>
+     f1e:	48 8d 15 99 0d 00 00 	lea    0xd99(%rip),%rdx        # 1cbe <malloc+0x22f>
+     f25:	48 89 d6             	mov    %rdx,%rsi
+     f28:	89 c7                	mov    %eax,%edi
+     f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2f:	e8 d9 02 00 00       	call   120d <printf>
+     f34:	8b 05 c6 12 00 00    	mov    0x12c6(%rip),%eax        # 2200 <stdout>
+     f3a:	48 8d 15 06 0d 00 00 	lea    0xd06(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     f41:	48 89 d6             	mov    %rdx,%rsi
+     f44:	89 c7                	mov    %eax,%edi
+     f46:	b8 00 00 00 00       	mov    $0x0,%eax
+     f4b:	e8 bd 02 00 00       	call   120d <printf>
+     f50:	90                   	nop
+     f51:	eb fd                	jmp    f50 <closetest+0x289>
+  close(fds[0]);
+     f53:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     f56:	89 c7                	mov    %eax,%edi
+     f58:	e8 7f 08 00 00       	call   17dc <close>
+  if((n = write(fds[1], "hello", 5)) != -1)
+     f5d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f60:	ba 05 00 00 00       	mov    $0x5,%edx
+     f65:	48 8d 0d ba 0e 00 00 	lea    0xeba(%rip),%rcx        # 1e26 <malloc+0x397>
+     f6c:	48 89 ce             	mov    %rcx,%rsi
+     f6f:	89 c7                	mov    %eax,%edi
+     f71:	e8 5e 08 00 00       	call   17d4 <write>
+     f76:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     f79:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     f7d:	74 5f                	je     fde <closetest+0x317>
+    error("write to a pipe nobody reads returned %d", n);
+     f7f:	8b 05 7b 12 00 00    	mov    0x127b(%rip),%eax        # 2200 <stdout>
+     f85:	ba b4 00 00 00       	mov    $0xb4,%edx
+     f8a:	48 8d 0d 7f 0c 00 00 	lea    0xc7f(%rip),%rcx        # 1c10 <malloc+0x181>
+     f91:	48 89 ce             	mov    %rcx,%rsi
+     f94:	89 c7                	mov    %eax,%edi
+     f96:	b8 00 00 00 00       	mov    $0x0,%eax
+     f9b:	e8 6d 02 00 00       	call   120d <printf>
+     fa0:	8b 05 5a 12 00 00    	mov    0x125a(%rip),%eax        # 2200 <stdout>
+     fa6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     fa9:	48 8d 0d e0 0e 00 00 	lea    0xee0(%rip),%rcx        # 1e90 <malloc+0x401>
+     fb0:	48 89 ce             	mov    %rcx,%rsi
+     fb3:	89 c7                	mov    %eax,%edi
+     fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+     fba:	e8 4e 02 00 00       	call   120d <printf>
+     fbf:	8b 05 3b 12 00 00    	mov    0x123b(%rip),%eax        # 2200 <stdout>
+     fc5:	48 8d 15 7b 0c 00 00 	lea    0xc7b(%rip),%rdx        # 1c47 <malloc+0x1b8>
+     fcc:	48 89 d6             	mov    %rdx,%rsi
+     fcf:	89 c7                	mov    %eax,%edi
+     fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd6:	e8 32 02 00 00       	call   120d <printf>
+     fdb:	90                   	nop
+     fdc:	eb fd                	jmp    fdb <closetest+0x314>
+  close(fds[1]);
+     fde:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     fe1:	89 c7                	mov    %eax,%edi
+     fe3:	e8 f4 07 00 00       	call   17dc <close>
+  printf(stdout, "closetest OK\n");
+     fe8:	8b 05 12 12 00 00    	mov    0x1212(%rip),%eax        # 2200 <stdout>
+     fee:	48 8d 15 c4 0e 00 00 	lea    0xec4(%rip),%rdx        # 1eb9 <malloc+0x42a>
+     ff5:	48 89 d6             	mov    %rdx,%rsi
+     ff8:	89 c7                	mov    %eax,%edi
+     ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+     fff:	e8 09 02 00 00       	call   120d <printf>
+}
+    1004:	90                   	nop
+    1005:	c9                   	leave
+    1006:	c3                   	ret
+
+0000000000001007 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    1007:	55                   	push   %rbp
+    1008:	48 89 e5             	mov    %rsp,%rbp
+    100b:	48 83 ec 10          	sub    $0x10,%rsp
+    100f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1012:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  ringtest();
+    1016:	e8 bc f3 ff ff       	call   3d7 <ringtest>
+  blockingtest();
+    101b:	e8 12 f5 ff ff       	call   532 <blockingtest>
+  faulttest();
+    1020:	e8 b0 f7 ff ff       	call   7d5 <faulttest>
+  closetest();
+    1025:	e8 9d fc ff ff       	call   cc7 <closetest>
+  printf(stdout, "pipetest passed!!\n");
+    102a:	8b 05 d0 11 00 00    	mov    0x11d0(%rip),%eax        # 2200 <stdout>
+    1030:	48 8d 15 90 0e 00 00 	lea    0xe90(%rip),%rdx        # 1ec7 <malloc+0x438>
+    1037:	48 89 d6             	mov    %rdx,%rsi
+    103a:	89 c7                	mov    %eax,%edi
+    103c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1041:	e8 c7 01 00 00       	call   120d <printf>
+  exit();
+    1046:	e8 69 07 00 00       	call   17b4 <exit>
+
+000000000000104b <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    104b:	55                   	push   %rbp
+    104c:	48 89 e5             	mov    %rsp,%rbp
+    104f:	48 83 ec 10          	sub    $0x10,%rsp
+    1053:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1056:	89 f0                	mov    %esi,%eax
+    1058:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    105b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    105f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1062:	ba 01 00 00 00       	mov    $0x1,%edx
+    1067:	48 89 ce             	mov    %rcx,%rsi
+    106a:	89 c7                	mov    %eax,%edi
+    106c:	e8 63 07 00 00       	call   17d4 <write>
+}
+    1071:	90                   	nop
+    1072:	c9                   	leave
+    1073:	c3                   	ret
+
+0000000000001074 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    1074:	55                   	push   %rbp
+    1075:	48 89 e5             	mov    %rsp,%rbp
+    1078:	48 83 ec 40          	sub    $0x40,%rsp
+    107c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    107f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1082:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1085:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    1088:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    108c:	74 1f                	je     10ad <printint64+0x39>
+    108e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1091:	c1 e8 1f             	shr    $0x1f,%eax
+    1094:	0f b6 c0             	movzbl %al,%eax
+    1097:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    109a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    109e:	74 0d                	je     10ad <printint64+0x39>
+    x = -xx;
+    10a0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    10a3:	f7 d8                	neg    %eax
+    10a5:	48 98                	cltq
+    10a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    10ab:	eb 09                	jmp    10b6 <printint64+0x42>
+  else
+    x = xx;
+    10ad:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    10b0:	48 98                	cltq
+    10b2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    10b6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    10bd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    10c0:	48 63 c8             	movslq %eax,%rcx
+    10c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10c7:	ba 00 00 00 00       	mov    $0x0,%edx
+    10cc:	48 f7 f1             	div    %rcx
+    10cf:	48 89 d1             	mov    %rdx,%rcx
+    10d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10d5:	8d 50 01             	lea    0x1(%rax),%edx
+    10d8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    10db:	48 8d 15 5e 11 00 00 	lea    0x115e(%rip),%rdx        # 2240 <digits.1>
+    10e2:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    10e6:	48 98                	cltq
+    10e8:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    10ec:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    10ef:	48 63 f0             	movslq %eax,%rsi
+    10f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    10f6:	ba 00 00 00 00       	mov    $0x0,%edx
+    10fb:	48 f7 f6             	div    %rsi
+    10fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1102:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1107:	75 b4                	jne    10bd <printint64+0x49>
+
+  if(sgn)
+    1109:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    110d:	74 2b                	je     113a <printint64+0xc6>
+    buf[i++] = '-';
+    110f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1112:	8d 50 01             	lea    0x1(%rax),%edx
+    1115:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1118:	48 98                	cltq
+    111a:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    111f:	eb 19                	jmp    113a <printint64+0xc6>
+    putc(fd, buf[i]);
+    1121:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1124:	48 98                	cltq
+    1126:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    112b:	0f be d0             	movsbl %al,%edx
+    112e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    1131:	89 d6                	mov    %edx,%esi
+    1133:	89 c7                	mov    %eax,%edi
+    1135:	e8 11 ff ff ff       	call   104b <putc>
+  while(--i >= 0)
+    113a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    113e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1142:	79 dd                	jns    1121 <printint64+0xad>
+}
+    1144:	90                   	nop
+    1145:	90                   	nop
+    1146:	c9                   	leave
+    1147:	c3                   	ret
+
+0000000000001148 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1148:	55                   	push   %rbp
+    1149:	48 89 e5             	mov    %rsp,%rbp
+    114c:	48 83 ec 30          	sub    $0x30,%rsp
+    1150:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1153:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1156:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1159:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    115c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    1163:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1167:	74 17                	je     1180 <printint+0x38>
+    1169:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    116d:	79 11                	jns    1180 <printint+0x38>
+    neg = 1;
+    116f:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1176:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1179:	f7 d8                	neg    %eax
+    117b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    117e:	eb 06                	jmp    1186 <printint+0x3e>
+  } else {
+    x = xx;
+    1180:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1183:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1186:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    118d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1190:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1193:	ba 00 00 00 00       	mov    $0x0,%edx
+    1198:	f7 f1                	div    %ecx
+    119a:	89 d1                	mov    %edx,%ecx
+    119c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    119f:	8d 50 01             	lea    0x1(%rax),%edx
+    11a2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11a5:	89 c9                	mov    %ecx,%ecx
+    11a7:	48 8d 15 b2 10 00 00 	lea    0x10b2(%rip),%rdx        # 2260 <digits.0>
+    11ae:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    11b2:	48 98                	cltq
+    11b4:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    11b8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    11bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11be:	ba 00 00 00 00       	mov    $0x0,%edx
+    11c3:	f7 f6                	div    %esi
+    11c5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    11c8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    11cc:	75 bf                	jne    118d <printint+0x45>
+  if(neg)
+    11ce:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    11d2:	74 2b                	je     11ff <printint+0xb7>
+    buf[i++] = '-';
+    11d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11d7:	8d 50 01             	lea    0x1(%rax),%edx
+    11da:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11dd:	48 98                	cltq
+    11df:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    11e4:	eb 19                	jmp    11ff <printint+0xb7>
+    putc(fd, buf[i]);
+    11e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11e9:	48 98                	cltq
+    11eb:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    11f0:	0f be d0             	movsbl %al,%edx
+    11f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    11f6:	89 d6                	mov    %edx,%esi
+    11f8:	89 c7                	mov    %eax,%edi
+    11fa:	e8 4c fe ff ff       	call   104b <putc>
+  while(--i >= 0)
+    11ff:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1203:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1207:	79 dd                	jns    11e6 <printint+0x9e>
+}
+    1209:	90                   	nop
+    120a:	90                   	nop
+    120b:	c9                   	leave
+    120c:	c3                   	ret
+
+000000000000120d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    120d:	55                   	push   %rbp
+    120e:	48 89 e5             	mov    %rsp,%rbp
+    1211:	48 83 ec 70          	sub    $0x70,%rsp
+    1215:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1218:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    121c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    1220:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1224:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1228:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    122c:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1233:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1237:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    123b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    123f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1243:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    124a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1251:	e9 6b 02 00 00       	jmp    14c1 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1256:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1259:	48 63 d0             	movslq %eax,%rdx
+    125c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1260:	48 01 d0             	add    %rdx,%rax
+    1263:	0f b6 00             	movzbl (%rax),%eax
+    1266:	0f be c0             	movsbl %al,%eax
+    1269:	25 ff 00 00 00       	and    $0xff,%eax
+    126e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    1271:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1275:	75 30                	jne    12a7 <printf+0x9a>
+      if(c == '%'){
+    1277:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    127b:	75 13                	jne    1290 <printf+0x83>
+        state = '%';
+    127d:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1284:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    128b:	e9 2d 02 00 00       	jmp    14bd <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1290:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1293:	0f be d0             	movsbl %al,%edx
+    1296:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1299:	89 d6                	mov    %edx,%esi
+    129b:	89 c7                	mov    %eax,%edi
+    129d:	e8 a9 fd ff ff       	call   104b <putc>
+    12a2:	e9 16 02 00 00       	jmp    14bd <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    12a7:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    12ab:	0f 85 0c 02 00 00    	jne    14bd <printf+0x2b0>
+      if(c == 'l') {
+    12b1:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    12b5:	75 0c                	jne    12c3 <printf+0xb6>
+        lflag = 1;
+    12b7:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    12be:	e9 fa 01 00 00       	jmp    14bd <printf+0x2b0>
+      } else if(c == 'd'){
+    12c3:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    12c7:	0f 85 95 00 00 00    	jne    1362 <printf+0x155>
+        if (lflag == 1)
+    12cd:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    12d1:	75 49                	jne    131c <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    12d3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    12d6:	83 f8 2f             	cmp    $0x2f,%eax
+    12d9:	77 17                	ja     12f2 <printf+0xe5>
+    12db:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    12df:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    12e2:	89 d2                	mov    %edx,%edx
+    12e4:	48 01 d0             	add    %rdx,%rax
+    12e7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    12ea:	83 c2 08             	add    $0x8,%edx
+    12ed:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    12f0:	eb 0c                	jmp    12fe <printf+0xf1>
+    12f2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    12f6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    12fa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    12fe:	48 8b 00             	mov    (%rax),%rax
+    1301:	89 c6                	mov    %eax,%esi
+    1303:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1306:	b9 01 00 00 00       	mov    $0x1,%ecx
+    130b:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1310:	89 c7                	mov    %eax,%edi
+    1312:	e8 5d fd ff ff       	call   1074 <printint64>
+    1317:	e9 9a 01 00 00       	jmp    14b6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    131c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    131f:	83 f8 2f             	cmp    $0x2f,%eax
+    1322:	77 17                	ja     133b <printf+0x12e>
+    1324:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1328:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    132b:	89 d2                	mov    %edx,%edx
+    132d:	48 01 d0             	add    %rdx,%rax
+    1330:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1333:	83 c2 08             	add    $0x8,%edx
+    1336:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1339:	eb 0c                	jmp    1347 <printf+0x13a>
+    133b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    133f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1343:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1347:	8b 30                	mov    (%rax),%esi
+    1349:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    134c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1351:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1356:	89 c7                	mov    %eax,%edi
+    1358:	e8 eb fd ff ff       	call   1148 <printint>
+    135d:	e9 54 01 00 00       	jmp    14b6 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    1362:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1366:	74 0a                	je     1372 <printf+0x165>
+    1368:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    136c:	0f 85 95 00 00 00    	jne    1407 <printf+0x1fa>
+        if (lflag == 1)
+    1372:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1376:	75 49                	jne    13c1 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1378:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    137b:	83 f8 2f             	cmp    $0x2f,%eax
+    137e:	77 17                	ja     1397 <printf+0x18a>
+    1380:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1384:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1387:	89 d2                	mov    %edx,%edx
+    1389:	48 01 d0             	add    %rdx,%rax
+    138c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    138f:	83 c2 08             	add    $0x8,%edx
+    1392:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1395:	eb 0c                	jmp    13a3 <printf+0x196>
+    1397:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    139b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    139f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13a3:	48 8b 00             	mov    (%rax),%rax
+    13a6:	89 c6                	mov    %eax,%esi
+    13a8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    13ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+    13b0:	ba 10 00 00 00       	mov    $0x10,%edx
+    13b5:	89 c7                	mov    %eax,%edi
+    13b7:	e8 b8 fc ff ff       	call   1074 <printint64>
+        if (lflag == 1)
+    13bc:	e9 f5 00 00 00       	jmp    14b6 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    13c1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13c4:	83 f8 2f             	cmp    $0x2f,%eax
+    13c7:	77 17                	ja     13e0 <printf+0x1d3>
+    13c9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13cd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13d0:	89 d2                	mov    %edx,%edx
+    13d2:	48 01 d0             	add    %rdx,%rax
+    13d5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13d8:	83 c2 08             	add    $0x8,%edx
+    13db:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    13de:	eb 0c                	jmp    13ec <printf+0x1df>
+    13e0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    13e4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    13e8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13ec:	8b 30                	mov    (%rax),%esi
+    13ee:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    13f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    13f6:	ba 10 00 00 00       	mov    $0x10,%edx
+    13fb:	89 c7                	mov    %eax,%edi
+    13fd:	e8 46 fd ff ff       	call   1148 <printint>
+        if (lflag == 1)
+    1402:	e9 af 00 00 00       	jmp    14b6 <printf+0x2a9>
+      } else if(c == 's'){
+    1407:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    140b:	75 6e                	jne    147b <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    140d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1410:	83 f8 2f             	cmp    $0x2f,%eax
+    1413:	77 17                	ja     142c <printf+0x21f>
+    1415:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1419:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    141c:	89 d2                	mov    %edx,%edx
+    141e:	48 01 d0             	add    %rdx,%rax
+    1421:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1424:	83 c2 08             	add    $0x8,%edx
+    1427:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    142a:	eb 0c                	jmp    1438 <printf+0x22b>
+    142c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1430:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1434:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1438:	48 8b 00             	mov    (%rax),%rax
+    143b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    143f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1444:	75 28                	jne    146e <printf+0x261>
+          s = "(null)";
+    1446:	48 8d 05 8d 0a 00 00 	lea    0xa8d(%rip),%rax        # 1eda <malloc+0x44b>
+    144d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    1451:	eb 1b                	jmp    146e <printf+0x261>
+          putc(fd, *s);
+    1453:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1457:	0f b6 00             	movzbl (%rax),%eax
+    145a:	0f be d0             	movsbl %al,%edx
+    145d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1460:	89 d6                	mov    %edx,%esi
+    1462:	89 c7                	mov    %eax,%edi
+    1464:	e8 e2 fb ff ff       	call   104b <putc>
+        for(; *s; s++)
+    1469:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    146e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1472:	0f b6 00             	movzbl (%rax),%eax
+    1475:	84 c0                	test   %al,%al
+    1477:	75 da                	jne    1453 <printf+0x246>
+    1479:	eb 3b                	jmp    14b6 <printf+0x2a9>
+      } else if(c == '%'){
+    147b:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    147f:	75 14                	jne    1495 <printf+0x288>
+        putc(fd, c);
+    1481:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1484:	0f be d0             	movsbl %al,%edx
+    1487:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    148a:	89 d6                	mov    %edx,%esi
+    148c:	89 c7                	mov    %eax,%edi
+    148e:	e8 b8 fb ff ff       	call   104b <putc>
+    1493:	eb 21                	jmp    14b6 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1495:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1498:	be 25 00 00 00       	mov    $0x25,%esi
+    149d:	89 c7                	mov    %eax,%edi
+    149f:	e8 a7 fb ff ff       	call   104b <putc>
+        putc(fd, c);
+    14a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    14a7:	0f be d0             	movsbl %al,%edx
+    14aa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14ad:	89 d6                	mov    %edx,%esi
+    14af:	89 c7                	mov    %eax,%edi
+    14b1:	e8 95 fb ff ff       	call   104b <putc>
+      }
+      state = 0;
+    14b6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    14bd:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    14c1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    14c4:	48 63 d0             	movslq %eax,%rdx
+    14c7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    14cb:	48 01 d0             	add    %rdx,%rax
+    14ce:	0f b6 00             	movzbl (%rax),%eax
+    14d1:	84 c0                	test   %al,%al
+    14d3:	0f 85 7d fd ff ff    	jne    1256 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    14d9:	90                   	nop
+    14da:	90                   	nop
+    14db:	c9                   	leave
+    14dc:	c3                   	ret
+
+00000000000014dd <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    14dd:	55                   	push   %rbp
+    14de:	48 89 e5             	mov    %rsp,%rbp
+    14e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    14e5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    14e8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    14eb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    14ef:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    14f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    14f5:	48 89 ce             	mov    %rcx,%rsi
+    14f8:	48 89 f7             	mov    %rsi,%rdi
+    14fb:	89 d1                	mov    %edx,%ecx
+    14fd:	fc                   	cld
+    14fe:	f3 aa                	rep stos %al,%es:(%rdi)
+    1500:	89 ca                	mov    %ecx,%edx
+    1502:	48 89 fe             	mov    %rdi,%rsi
+    1505:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1509:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    150c:	90                   	nop
+    150d:	5d                   	pop    %rbp
+    150e:	c3                   	ret
+
+000000000000150f <strcpy>:
+{
+    150f:	55                   	push   %rbp
+    1510:	48 89 e5             	mov    %rsp,%rbp
+    1513:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1517:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    151b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    151f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1523:	90                   	nop
+    1524:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1528:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    152c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1530:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1534:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1538:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    153c:	0f b6 12             	movzbl (%rdx),%edx
+    153f:	88 10                	mov    %dl,(%rax)
+    1541:	0f b6 00             	movzbl (%rax),%eax
+    1544:	84 c0                	test   %al,%al
+    1546:	75 dc                	jne    1524 <strcpy+0x15>
+  return os;
+    1548:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    154c:	5d                   	pop    %rbp
+    154d:	c3                   	ret
+
+000000000000154e <strcmp>:
+{
+    154e:	55                   	push   %rbp
+    154f:	48 89 e5             	mov    %rsp,%rbp
+    1552:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1556:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    155a:	eb 0a                	jmp    1566 <strcmp+0x18>
+    p++, q++;
+    155c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1561:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1566:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    156a:	0f b6 00             	movzbl (%rax),%eax
+    156d:	84 c0                	test   %al,%al
+    156f:	74 12                	je     1583 <strcmp+0x35>
+    1571:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1575:	0f b6 10             	movzbl (%rax),%edx
+    1578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    157c:	0f b6 00             	movzbl (%rax),%eax
+    157f:	38 c2                	cmp    %al,%dl
+    1581:	74 d9                	je     155c <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1583:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1587:	0f b6 00             	movzbl (%rax),%eax
+    158a:	0f b6 d0             	movzbl %al,%edx
+    158d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1591:	0f b6 00             	movzbl (%rax),%eax
+    1594:	0f b6 c0             	movzbl %al,%eax
+    1597:	29 c2                	sub    %eax,%edx
+    1599:	89 d0                	mov    %edx,%eax
+}
+    159b:	5d                   	pop    %rbp
+    159c:	c3                   	ret
+
+000000000000159d <strlen>:
+{
+    159d:	55                   	push   %rbp
+    159e:	48 89 e5             	mov    %rsp,%rbp
+    15a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    15a5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    15ac:	eb 04                	jmp    15b2 <strlen+0x15>
+    15ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    15b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15b5:	48 63 d0             	movslq %eax,%rdx
+    15b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15bc:	48 01 d0             	add    %rdx,%rax
+    15bf:	0f b6 00             	movzbl (%rax),%eax
+    15c2:	84 c0                	test   %al,%al
+    15c4:	75 e8                	jne    15ae <strlen+0x11>
+  return n;
+    15c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    15c9:	5d                   	pop    %rbp
+    15ca:	c3                   	ret
+
+00000000000015cb <memset>:
+{
+    15cb:	55                   	push   %rbp
+    15cc:	48 89 e5             	mov    %rsp,%rbp
+    15cf:	48 83 ec 10          	sub    $0x10,%rsp
+    15d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15d7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    15da:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    15dd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    15e0:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    15e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15e7:	89 ce                	mov    %ecx,%esi
+    15e9:	48 89 c7             	mov    %rax,%rdi
+    15ec:	e8 ec fe ff ff       	call   14dd <stosb>
+  return dst;
+    15f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    15f5:	c9                   	leave
+    15f6:	c3                   	ret
+
+00000000000015f7 <strchr>:
+{
+    15f7:	55                   	push   %rbp
+    15f8:	48 89 e5             	mov    %rsp,%rbp
+    15fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15ff:	89 f0                	mov    %esi,%eax
+    1601:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1604:	eb 17                	jmp    161d <strchr+0x26>
+    if(*s == c)
+    1606:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160a:	0f b6 00             	movzbl (%rax),%eax
+    160d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1610:	75 06                	jne    1618 <strchr+0x21>
+      return (char*)s;
+    1612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1616:	eb 15                	jmp    162d <strchr+0x36>
+  for(; *s; s++)
+    1618:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    161d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1621:	0f b6 00             	movzbl (%rax),%eax
+    1624:	84 c0                	test   %al,%al
+    1626:	75 de                	jne    1606 <strchr+0xf>
+  return 0;
+    1628:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    162d:	5d                   	pop    %rbp
+    162e:	c3                   	ret
+
+000000000000162f <gets>:
+gets(char *buf, int max)
+{
+    162f:	55                   	push   %rbp
+    1630:	48 89 e5             	mov    %rsp,%rbp
+    1633:	48 83 ec 20          	sub    $0x20,%rsp
+    1637:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    163b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    163e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1645:	eb 48                	jmp    168f <gets+0x60>
+    cc = read(0, &c, 1);
+    1647:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    164b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1650:	48 89 c6             	mov    %rax,%rsi
+    1653:	bf 00 00 00 00       	mov    $0x0,%edi
+    1658:	e8 6f 01 00 00       	call   17cc <read>
+    165d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1660:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1664:	7e 36                	jle    169c <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1666:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1669:	8d 50 01             	lea    0x1(%rax),%edx
+    166c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    166f:	48 63 d0             	movslq %eax,%rdx
+    1672:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1676:	48 01 c2             	add    %rax,%rdx
+    1679:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    167d:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    167f:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1683:	3c 0a                	cmp    $0xa,%al
+    1685:	74 16                	je     169d <gets+0x6e>
+    1687:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    168b:	3c 0d                	cmp    $0xd,%al
+    168d:	74 0e                	je     169d <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    168f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1692:	83 c0 01             	add    $0x1,%eax
+    1695:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1698:	7f ad                	jg     1647 <gets+0x18>
+    169a:	eb 01                	jmp    169d <gets+0x6e>
+      break;
+    169c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    169d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16a0:	48 63 d0             	movslq %eax,%rdx
+    16a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a7:	48 01 d0             	add    %rdx,%rax
+    16aa:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    16ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    16b1:	c9                   	leave
+    16b2:	c3                   	ret
+
+00000000000016b3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    16b3:	55                   	push   %rbp
+    16b4:	48 89 e5             	mov    %rsp,%rbp
+    16b7:	48 83 ec 20          	sub    $0x20,%rsp
+    16bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    16bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    16c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16c7:	be 00 00 00 00       	mov    $0x0,%esi
+    16cc:	48 89 c7             	mov    %rax,%rdi
+    16cf:	e8 20 01 00 00       	call   17f4 <open>
+    16d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    16d7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    16db:	79 07                	jns    16e4 <stat+0x31>
+    return -1;
+    16dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    16e2:	eb 21                	jmp    1705 <stat+0x52>
+  r = fstat(fd, st);
+    16e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    16e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16eb:	48 89 d6             	mov    %rdx,%rsi
+    16ee:	89 c7                	mov    %eax,%edi
+    16f0:	e8 17 01 00 00       	call   180c <fstat>
+    16f5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    16f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    16fb:	89 c7                	mov    %eax,%edi
+    16fd:	e8 da 00 00 00       	call   17dc <close>
+  return r;
+    1702:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1705:	c9                   	leave
+    1706:	c3                   	ret
+
+0000000000001707 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1707:	55                   	push   %rbp
+    1708:	48 89 e5             	mov    %rsp,%rbp
+    170b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    170f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1716:	eb 28                	jmp    1740 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1718:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    171b:	89 d0                	mov    %edx,%eax
+    171d:	c1 e0 02             	shl    $0x2,%eax
+    1720:	01 d0                	add    %edx,%eax
+    1722:	01 c0                	add    %eax,%eax
+    1724:	89 c1                	mov    %eax,%ecx
+    1726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    172a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    172e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1732:	0f b6 00             	movzbl (%rax),%eax
+    1735:	0f be c0             	movsbl %al,%eax
+    1738:	01 c8                	add    %ecx,%eax
+    173a:	83 e8 30             	sub    $0x30,%eax
+    173d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1744:	0f b6 00             	movzbl (%rax),%eax
+    1747:	3c 2f                	cmp    $0x2f,%al
+    1749:	7e 0b                	jle    1756 <atoi+0x4f>
+    174b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    174f:	0f b6 00             	movzbl (%rax),%eax
+    1752:	3c 39                	cmp    $0x39,%al
+    1754:	7e c2                	jle    1718 <atoi+0x11>
+  return n;
+    1756:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1759:	5d                   	pop    %rbp
+    175a:	c3                   	ret
+
+000000000000175b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    175b:	55                   	push   %rbp
+    175c:	48 89 e5             	mov    %rsp,%rbp
+    175f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1763:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1767:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    176a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    176e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1772:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1776:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    177a:	eb 1d                	jmp    1799 <memmove+0x3e>
+    *dst++ = *src++;
+    177c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1780:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1784:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    178c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1790:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1794:	0f b6 12             	movzbl (%rdx),%edx
+    1797:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1799:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    179c:	8d 50 ff             	lea    -0x1(%rax),%edx
+    179f:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    17a2:	85 c0                	test   %eax,%eax
+    17a4:	7f d6                	jg     177c <memmove+0x21>
+  return vdst;
+    17a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17aa:	5d                   	pop    %rbp
+    17ab:	c3                   	ret
+
+00000000000017ac <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    17ac:	b8 01 00 00 00       	mov    $0x1,%eax
+    17b1:	cd 40                	int    $0x40
+    17b3:	c3                   	ret
+
+00000000000017b4 <exit>:
+SYSCALL(exit)
+    17b4:	b8 02 00 00 00       	mov    $0x2,%eax
+    17b9:	cd 40                	int    $0x40
+    17bb:	c3                   	ret
+
+00000000000017bc <wait>:
+SYSCALL(wait)
+    17bc:	b8 03 00 00 00       	mov    $0x3,%eax
+    17c1:	cd 40                	int    $0x40
+    17c3:	c3                   	ret
+
+00000000000017c4 <pipe>:
+SYSCALL(pipe)
+    17c4:	b8 04 00 00 00       	mov    $0x4,%eax
+    17c9:	cd 40                	int    $0x40
+    17cb:	c3                   	ret
+
+00000000000017cc <read>:
+SYSCALL(read)
+    17cc:	b8 05 00 00 00       	mov    $0x5,%eax
+    17d1:	cd 40                	int    $0x40
+    17d3:	c3                   	ret
+
+00000000000017d4 <write>:
+SYSCALL(write)
+    17d4:	b8 10 00 00 00       	mov    $0x10,%eax
+    17d9:	cd 40                	int    $0x40
+    17db:	c3                   	ret
+
+00000000000017dc <close>:
+SYSCALL(close)
+    17dc:	b8 15 00 00 00       	mov    $0x15,%eax
+    17e1:	cd 40                	int    $0x40
+    17e3:	c3                   	ret
+
+00000000000017e4 <kill>:
+SYSCALL(kill)
+    17e4:	b8 06 00 00 00       	mov    $0x6,%eax
+    17e9:	cd 40                	int    $0x40
+    17eb:	c3                   	ret
+
+00000000000017ec <exec>:
+SYSCALL(exec)
+    17ec:	b8 07 00 00 00       	mov    $0x7,%eax
+    17f1:	cd 40                	int    $0x40
+    17f3:	c3                   	ret
+
+00000000000017f4 <open>:
+SYSCALL(open)
+    17f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+    17f9:	cd 40                	int    $0x40
+    17fb:	c3                   	ret
+
+00000000000017fc <mknod>:
+SYSCALL(mknod)
+    17fc:	b8 11 00 00 00       	mov    $0x11,%eax
+    1801:	cd 40                	int    $0x40
+    1803:	c3                   	ret
+
+0000000000001804 <unlink>:
+SYSCALL(unlink)
+    1804:	b8 12 00 00 00       	mov    $0x12,%eax
+    1809:	cd 40                	int    $0x40
+    180b:	c3                   	ret
+
+000000000000180c <fstat>:
+SYSCALL(fstat)
+    180c:	b8 08 00 00 00       	mov    $0x8,%eax
+    1811:	cd 40                	int    $0x40
+    1813:	c3                   	ret
+
+0000000000001814 <link>:
+SYSCALL(link)
+    1814:	b8 13 00 00 00       	mov    $0x13,%eax
+    1819:	cd 40                	int    $0x40
+    181b:	c3                   	ret
+
+000000000000181c <mkdir>:
+SYSCALL(mkdir)
+    181c:	b8 14 00 00 00       	mov    $0x14,%eax
+    1821:	cd 40                	int    $0x40
+    1823:	c3                   	ret
+
+0000000000001824 <chdir>:
+SYSCALL(chdir)
+    1824:	b8 09 00 00 00       	mov    $0x9,%eax
+    1829:	cd 40                	int    $0x40
+    182b:	c3                   	ret
+
+000000000000182c <dup>:
+SYSCALL(dup)
+    182c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1831:	cd 40                	int    $0x40
+    1833:	c3                   	ret
+
+0000000000001834 <getpid>:
+SYSCALL(getpid)
+    1834:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1839:	cd 40                	int    $0x40
+    183b:	c3                   	ret
+
+000000000000183c <sbrk>:
+SYSCALL(sbrk)
+    183c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1841:	cd 40                	int    $0x40
+    1843:	c3                   	ret
+
+0000000000001844 <sleep>:
+SYSCALL(sleep)
+    1844:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1849:	cd 40                	int    $0x40
+    184b:	c3                   	ret
+
+000000000000184c <uptime>:
+SYSCALL(uptime)
+    184c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1851:	cd 40                	int    $0x40
+    1853:	c3                   	ret
+
+0000000000001854 <sysinfo>:
+SYSCALL(sysinfo)
+    1854:	b8 16 00 00 00       	mov    $0x16,%eax
+    1859:	cd 40                	int    $0x40
+    185b:	c3                   	ret
+
+000000000000185c <mmap>:
+SYSCALL(mmap)
+    185c:	b8 17 00 00 00       	mov    $0x17,%eax
+    1861:	cd 40                	int    $0x40
+    1863:	c3                   	ret
+
+0000000000001864 <munmap>:
+SYSCALL(munmap)
+    1864:	b8 18 00 00 00       	mov    $0x18,%eax
+    1869:	cd 40                	int    $0x40
+    186b:	c3                   	ret
+
+000000000000186c <crashn>:
+SYSCALL(crashn)
+    186c:	b8 19 00 00 00       	mov    $0x19,%eax
+    1871:	cd 40                	int    $0x40
+    1873:	c3                   	ret
+
+0000000000001874 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1874:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1879:	cd 40                	int    $0x40
+    187b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    187e:	74 02                	je     1882 <mmap2+0xe>
+    1880:	89 c0                	mov    %eax,%eax
+    1882:	c3                   	ret
+
+0000000000001883 <munmap2>:
+SYSCALL(munmap2)
+    1883:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1888:	cd 40                	int    $0x40
+    188a:	c3                   	ret
+
+000000000000188b <msync>:
+SYSCALL(msync)
+    188b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1890:	cd 40                	int    $0x40
+    1892:	c3                   	ret
+
+0000000000001893 <sendfile>:
+SYSCALL(sendfile)
+    1893:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1898:	cd 40                	int    $0x40
+    189a:	c3                   	ret
+
+000000000000189b <splice>:
+SYSCALL(splice)
+    189b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    18a0:	cd 40                	int    $0x40
+    18a2:	c3                   	ret
+
+00000000000018a3 <pread>:
+SYSCALL(pread)
+    18a3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    18a8:	cd 40                	int    $0x40
+    18aa:	c3                   	ret
+
+00000000000018ab <pwrite>:
+SYSCALL(pwrite)
+    18ab:	b8 20 00 00 00       	mov    $0x20,%eax
+    18b0:	cd 40                	int    $0x40
+    18b2:	c3                   	ret
+
+00000000000018b3 <readv>:
+SYSCALL(readv)
+    18b3:	b8 21 00 00 00       	mov    $0x21,%eax
+    18b8:	cd 40                	int    $0x40
+    18ba:	c3                   	ret
+
+00000000000018bb <writev>:
+SYSCALL(writev)
+    18bb:	b8 22 00 00 00       	mov    $0x22,%eax
+    18c0:	cd 40                	int    $0x40
+    18c2:	c3                   	ret
+
+00000000000018c3 <poll>:
+SYSCALL(poll)
+    18c3:	b8 23 00 00 00       	mov    $0x23,%eax
+    18c8:	cd 40                	int    $0x40
+    18ca:	c3                   	ret
+
+00000000000018cb <pipe2>:
+SYSCALL(pipe2)
+    18cb:	b8 24 00 00 00       	mov    $0x24,%eax
+    18d0:	cd 40                	int    $0x40
+    18d2:	c3                   	ret
+
+00000000000018d3 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    18d3:	55                   	push   %rbp
+    18d4:	48 89 e5             	mov    %rsp,%rbp
+    18d7:	48 83 ec 20          	sub    $0x20,%rsp
+    18db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    18df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18e3:	48 83 e8 10          	sub    $0x10,%rax
+    18e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    18eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18ef:	48 8b 10             	mov    (%rax),%rdx
+    18f2:	48 8d 05 a7 09 00 00 	lea    0x9a7(%rip),%rax        # 22a0 <bigblock>
+    18f9:	48 39 c2             	cmp    %rax,%rdx
+    18fc:	75 1f                	jne    191d <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    18fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1902:	8b 40 08             	mov    0x8(%rax),%eax
+    1905:	c1 e0 04             	shl    $0x4,%eax
+    1908:	89 c2                	mov    %eax,%edx
+    190a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    190e:	89 d6                	mov    %edx,%esi
+    1910:	48 89 c7             	mov    %rax,%rdi
+    1913:	e8 6b ff ff ff       	call   1883 <munmap2>
+    return;
+    1918:	e9 0b 01 00 00       	jmp    1a28 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    191d:	48 8b 05 6c 09 00 00 	mov    0x96c(%rip),%rax        # 2290 <freep>
+    1924:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1928:	eb 2f                	jmp    1959 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    192a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    192e:	48 8b 00             	mov    (%rax),%rax
+    1931:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1935:	72 17                	jb     194e <free+0x7b>
+    1937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    193b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    193f:	72 2f                	jb     1970 <free+0x9d>
+    1941:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1945:	48 8b 00             	mov    (%rax),%rax
+    1948:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    194c:	72 22                	jb     1970 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    194e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1952:	48 8b 00             	mov    (%rax),%rax
+    1955:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1959:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    195d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1961:	73 c7                	jae    192a <free+0x57>
+    1963:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1967:	48 8b 00             	mov    (%rax),%rax
+    196a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    196e:	73 ba                	jae    192a <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1970:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1974:	8b 40 08             	mov    0x8(%rax),%eax
+    1977:	89 c0                	mov    %eax,%eax
+    1979:	48 c1 e0 04          	shl    $0x4,%rax
+    197d:	48 89 c2             	mov    %rax,%rdx
+    1980:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1984:	48 01 c2             	add    %rax,%rdx
+    1987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    198b:	48 8b 00             	mov    (%rax),%rax
+    198e:	48 39 c2             	cmp    %rax,%rdx
+    1991:	75 2d                	jne    19c0 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1997:	8b 50 08             	mov    0x8(%rax),%edx
+    199a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    199e:	48 8b 00             	mov    (%rax),%rax
+    19a1:	8b 40 08             	mov    0x8(%rax),%eax
+    19a4:	01 c2                	add    %eax,%edx
+    19a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19aa:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    19ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19b1:	48 8b 00             	mov    (%rax),%rax
+    19b4:	48 8b 10             	mov    (%rax),%rdx
+    19b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19bb:	48 89 10             	mov    %rdx,(%rax)
+    19be:	eb 0e                	jmp    19ce <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    19c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c4:	48 8b 10             	mov    (%rax),%rdx
+    19c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19cb:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    19ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d2:	8b 40 08             	mov    0x8(%rax),%eax
+    19d5:	89 c0                	mov    %eax,%eax
+    19d7:	48 c1 e0 04          	shl    $0x4,%rax
+    19db:	48 89 c2             	mov    %rax,%rdx
+    19de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e2:	48 01 d0             	add    %rdx,%rax
+    19e5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    19e9:	75 27                	jne    1a12 <free+0x13f>
+    p->s.size += bp->s.size;
+    19eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ef:	8b 50 08             	mov    0x8(%rax),%edx
+    19f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19f6:	8b 40 08             	mov    0x8(%rax),%eax
+    19f9:	01 c2                	add    %eax,%edx
+    19fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ff:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a06:	48 8b 10             	mov    (%rax),%rdx
+    1a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a0d:	48 89 10             	mov    %rdx,(%rax)
+    1a10:	eb 0b                	jmp    1a1d <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a16:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1a1a:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1a1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a21:	48 89 05 68 08 00 00 	mov    %rax,0x868(%rip)        # 2290 <freep>
+}
+    1a28:	c9                   	leave
+    1a29:	c3                   	ret
+
+0000000000001a2a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1a2a:	55                   	push   %rbp
+    1a2b:	48 89 e5             	mov    %rsp,%rbp
+    1a2e:	48 83 ec 20          	sub    $0x20,%rsp
+    1a32:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1a35:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1a3c:	77 07                	ja     1a45 <morecore+0x1b>
+    nu = 4096;
+    1a3e:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1a45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a48:	c1 e0 04             	shl    $0x4,%eax
+    1a4b:	89 c7                	mov    %eax,%edi
+    1a4d:	e8 ea fd ff ff       	call   183c <sbrk>
+    1a52:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1a56:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1a5b:	75 07                	jne    1a64 <morecore+0x3a>
+    return 0;
+    1a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a62:	eb 29                	jmp    1a8d <morecore+0x63>
+  hp = (Header*)p;
+    1a64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1a6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a70:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1a73:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1a76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a7a:	48 83 c0 10          	add    $0x10,%rax
+    1a7e:	48 89 c7             	mov    %rax,%rdi
+    1a81:	e8 4d fe ff ff       	call   18d3 <free>
+  return freep;
+    1a86:	48 8b 05 03 08 00 00 	mov    0x803(%rip),%rax        # 2290 <freep>
+}
+    1a8d:	c9                   	leave
+    1a8e:	c3                   	ret
+
+0000000000001a8f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1a8f:	55                   	push   %rbp
+    1a90:	48 89 e5             	mov    %rsp,%rbp
+    1a93:	48 83 ec 30          	sub    $0x30,%rsp
+    1a97:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1a9a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1a9d:	48 83 c0 0f          	add    $0xf,%rax
+    1aa1:	48 c1 e8 04          	shr    $0x4,%rax
+    1aa5:	83 c0 01             	add    $0x1,%eax
+    1aa8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1aab:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1ab2:	76 62                	jbe    1b16 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1ab4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1ab7:	c1 e0 04             	shl    $0x4,%eax
+    1aba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1ac0:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1ac6:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1acb:	ba 03 00 00 00       	mov    $0x3,%edx
+    1ad0:	89 c6                	mov    %eax,%esi
+    1ad2:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ad7:	e8 98 fd ff ff       	call   1874 <mmap2>
+    1adc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1ae0:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1ae5:	75 0a                	jne    1af1 <malloc+0x62>
+      return 0;
+    1ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+    1aec:	e9 1c 01 00 00       	jmp    1c0d <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1af5:	48 8d 15 a4 07 00 00 	lea    0x7a4(%rip),%rdx        # 22a0 <bigblock>
+    1afc:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b03:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b06:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1b09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b0d:	48 83 c0 10          	add    $0x10,%rax
+    1b11:	e9 f7 00 00 00       	jmp    1c0d <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1b16:	48 8b 05 73 07 00 00 	mov    0x773(%rip),%rax        # 2290 <freep>
+    1b1d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b21:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1b26:	75 2e                	jne    1b56 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1b28:	48 8d 05 51 07 00 00 	lea    0x751(%rip),%rax        # 2280 <base>
+    1b2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b37:	48 89 05 52 07 00 00 	mov    %rax,0x752(%rip)        # 2290 <freep>
+    1b3e:	48 8b 05 4b 07 00 00 	mov    0x74b(%rip),%rax        # 2290 <freep>
+    1b45:	48 89 05 34 07 00 00 	mov    %rax,0x734(%rip)        # 2280 <base>
+    base.s.size = 0;
+    1b4c:	c7 05 32 07 00 00 00 	movl   $0x0,0x732(%rip)        # 2288 <base+0x8>
+    1b53:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1b56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b5a:	48 8b 00             	mov    (%rax),%rax
+    1b5d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b65:	8b 40 08             	mov    0x8(%rax),%eax
+    1b68:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1b6b:	72 5f                	jb     1bcc <malloc+0x13d>
+      if(p->s.size == nunits)
+    1b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b71:	8b 40 08             	mov    0x8(%rax),%eax
+    1b74:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1b77:	75 10                	jne    1b89 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b7d:	48 8b 10             	mov    (%rax),%rdx
+    1b80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b84:	48 89 10             	mov    %rdx,(%rax)
+    1b87:	eb 2e                	jmp    1bb7 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1b89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b8d:	8b 40 08             	mov    0x8(%rax),%eax
+    1b90:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1b93:	89 c2                	mov    %eax,%edx
+    1b95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b99:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1b9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba0:	8b 40 08             	mov    0x8(%rax),%eax
+    1ba3:	89 c0                	mov    %eax,%eax
+    1ba5:	48 c1 e0 04          	shl    $0x4,%rax
+    1ba9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1bad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bb1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1bb4:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1bb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bbb:	48 89 05 ce 06 00 00 	mov    %rax,0x6ce(%rip)        # 2290 <freep>
+      return (void*)(p + 1);
+    1bc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bc6:	48 83 c0 10          	add    $0x10,%rax
+    1bca:	eb 41                	jmp    1c0d <malloc+0x17e>
+    }
+    if(p == freep)
+    1bcc:	48 8b 05 bd 06 00 00 	mov    0x6bd(%rip),%rax        # 2290 <freep>
+    1bd3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1bd7:	75 1c                	jne    1bf5 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1bd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1bdc:	89 c7                	mov    %eax,%edi
+    1bde:	e8 47 fe ff ff       	call   1a2a <morecore>
+    1be3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1be7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1bec:	75 07                	jne    1bf5 <malloc+0x166>
+        return 0;
+    1bee:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bf3:	eb 18                	jmp    1c0d <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1bf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bf9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c01:	48 8b 00             	mov    (%rax),%rax
+    1c04:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1c08:	e9 54 ff ff ff       	jmp    1b61 <malloc+0xd2>
+  }
+}
+    1c0d:	c9                   	leave
+    1c0e:	c3                   	ret
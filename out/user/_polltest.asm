@@ -0,0 +1,2654 @@
+
+out/user/_polltest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <pollone>:
+
+// Poll the one file fd for events without waiting, returning its
+// revents.
+int
+pollone(int fd, int events)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 20          	sub    $0x20,%rsp
+       8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+       b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  struct pollfd pfd;
+  int n;
+
+  pfd.fd = fd;
+       e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+      11:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  pfd.events = events;
+      14:	8b 45 e8             	mov    -0x18(%rbp),%eax
+      17:	66 89 45 f8          	mov    %ax,-0x8(%rbp)
+  pfd.revents = -1;
+      1b:	66 c7 45 fa ff ff    	movw   $0xffff,-0x6(%rbp)
+  if((n = poll(&pfd, 1, 0)) != (pfd.revents != 0))
+      21:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+      25:	ba 00 00 00 00       	mov    $0x0,%edx
+      2a:	be 01 00 00 00       	mov    $0x1,%esi
+      2f:	48 89 c7             	mov    %rax,%rdi
+      32:	e8 5a 19 00 00       	call   1991 <poll>
+      37:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      3a:	0f b7 45 fa          	movzwl -0x6(%rbp),%eax
+      3e:	66 85 c0             	test   %ax,%ax
+      41:	0f 95 c0             	setne  %al
+      44:	0f b6 c0             	movzbl %al,%eax
+      47:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+      4a:	74 63                	je     af <pollone+0xaf>
+    error("poll returned %d with revents %x", n, pfd.revents);
+      4c:	8b 05 6e 23 00 00    	mov    0x236e(%rip),%eax        # 23c0 <stdout>
+      52:	ba 21 00 00 00       	mov    $0x21,%edx
+      57:	48 8d 0d 82 1c 00 00 	lea    0x1c82(%rip),%rcx        # 1ce0 <malloc+0x183>
+      5e:	48 89 ce             	mov    %rcx,%rsi
+      61:	89 c7                	mov    %eax,%edi
+      63:	b8 00 00 00 00       	mov    $0x0,%eax
+      68:	e8 6e 12 00 00       	call   12db <printf>
+      6d:	0f b7 45 fa          	movzwl -0x6(%rbp),%eax
+      71:	0f bf c8             	movswl %ax,%ecx
+      74:	8b 05 46 23 00 00    	mov    0x2346(%rip),%eax        # 23c0 <stdout>
+      7a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+      7d:	48 8d 35 74 1c 00 00 	lea    0x1c74(%rip),%rsi        # 1cf8 <malloc+0x19b>
+      84:	89 c7                	mov    %eax,%edi
+      86:	b8 00 00 00 00       	mov    $0x0,%eax
+      8b:	e8 4b 12 00 00       	call   12db <printf>
+      90:	8b 05 2a 23 00 00    	mov    0x232a(%rip),%eax        # 23c0 <stdout>
+      96:	48 8d 15 7c 1c 00 00 	lea    0x1c7c(%rip),%rdx        # 1d19 <malloc+0x1bc>
+      9d:	48 89 d6             	mov    %rdx,%rsi
+      a0:	89 c7                	mov    %eax,%edi
+      a2:	b8 00 00 00 00       	mov    $0x0,%eax
+      a7:	e8 2f 12 00 00       	call   12db <printf>
+      ac:	90                   	nop
+      ad:	eb fd                	jmp    ac <pollone+0xac>
+  return pfd.revents;
+      af:	0f b7 45 fa          	movzwl -0x6(%rbp),%eax
+      b3:	98                   	cwtl
+}
+      b4:	c9                   	leave
+      b5:	c3                   	ret
+
+00000000000000b6 <readytest>:
+
+// An empty pipe can be written but not read, one with data can be
+// read too.
+void
+readytest(void)
+{
+      b6:	55                   	push   %rbp
+      b7:	48 89 e5             	mov    %rsp,%rbp
+      ba:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2];
+
+  printf(stdout, "readytest\n");
+      be:	8b 05 fc 22 00 00    	mov    0x22fc(%rip),%eax        # 23c0 <stdout>
+      c4:	48 8d 15 50 1c 00 00 	lea    0x1c50(%rip),%rdx        # 1d1b <malloc+0x1be>
+      cb:	48 89 d6             	mov    %rdx,%rsi
+      ce:	89 c7                	mov    %eax,%edi
+      d0:	b8 00 00 00 00       	mov    $0x0,%eax
+      d5:	e8 01 12 00 00       	call   12db <printf>
+  if(pipe(fds) < 0)
+      da:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+      de:	48 89 c7             	mov    %rax,%rdi
+      e1:	e8 ac 17 00 00       	call   1892 <pipe>
+      e6:	85 c0                	test   %eax,%eax
+      e8:	79 5c                	jns    146 <readytest+0x90>
+    error("pipe failed");
+      ea:	8b 05 d0 22 00 00    	mov    0x22d0(%rip),%eax        # 23c0 <stdout>
+      f0:	ba 2e 00 00 00       	mov    $0x2e,%edx
+      f5:	48 8d 0d e4 1b 00 00 	lea    0x1be4(%rip),%rcx        # 1ce0 <malloc+0x183>
+      fc:	48 89 ce             	mov    %rcx,%rsi
+      ff:	89 c7                	mov    %eax,%edi
+     101:	b8 00 00 00 00       	mov    $0x0,%eax
+     106:	e8 d0 11 00 00       	call   12db <printf>
+     10b:	8b 05 af 22 00 00    	mov    0x22af(%rip),%eax        # 23c0 <stdout>
+     111:	48 8d 15 0e 1c 00 00 	lea    0x1c0e(%rip),%rdx        # 1d26 <malloc+0x1c9>
+     118:	48 89 d6             	mov    %rdx,%rsi
+     11b:	89 c7                	mov    %eax,%edi
+     11d:	b8 00 00 00 00       	mov    $0x0,%eax
+     122:	e8 b4 11 00 00       	call   12db <printf>
+     127:	8b 05 93 22 00 00    	mov    0x2293(%rip),%eax        # 23c0 <stdout>
+     12d:	48 8d 15 e5 1b 00 00 	lea    0x1be5(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     134:	48 89 d6             	mov    %rdx,%rsi
+     137:	89 c7                	mov    %eax,%edi
+     139:	b8 00 00 00 00       	mov    $0x0,%eax
+     13e:	e8 98 11 00 00       	call   12db <printf>
+     143:	90                   	nop
+     144:	eb fd                	jmp    143 <readytest+0x8d>
+  if(pollone(fds[0], POLLIN) != 0)
+     146:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     149:	be 01 00 00 00       	mov    $0x1,%esi
+     14e:	89 c7                	mov    %eax,%edi
+     150:	e8 ab fe ff ff       	call   0 <pollone>
+     155:	85 c0                	test   %eax,%eax
+     157:	74 5c                	je     1b5 <readytest+0xff>
+    error("empty pipe is ready to read");
+     159:	8b 05 61 22 00 00    	mov    0x2261(%rip),%eax        # 23c0 <stdout>
+     15f:	ba 30 00 00 00       	mov    $0x30,%edx
+     164:	48 8d 0d 75 1b 00 00 	lea    0x1b75(%rip),%rcx        # 1ce0 <malloc+0x183>
+     16b:	48 89 ce             	mov    %rcx,%rsi
+     16e:	89 c7                	mov    %eax,%edi
+     170:	b8 00 00 00 00       	mov    $0x0,%eax
+     175:	e8 61 11 00 00       	call   12db <printf>
+     17a:	8b 05 40 22 00 00    	mov    0x2240(%rip),%eax        # 23c0 <stdout>
+     180:	48 8d 15 ab 1b 00 00 	lea    0x1bab(%rip),%rdx        # 1d32 <malloc+0x1d5>
+     187:	48 89 d6             	mov    %rdx,%rsi
+     18a:	89 c7                	mov    %eax,%edi
+     18c:	b8 00 00 00 00       	mov    $0x0,%eax
+     191:	e8 45 11 00 00       	call   12db <printf>
+     196:	8b 05 24 22 00 00    	mov    0x2224(%rip),%eax        # 23c0 <stdout>
+     19c:	48 8d 15 76 1b 00 00 	lea    0x1b76(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     1a3:	48 89 d6             	mov    %rdx,%rsi
+     1a6:	89 c7                	mov    %eax,%edi
+     1a8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ad:	e8 29 11 00 00       	call   12db <printf>
+     1b2:	90                   	nop
+     1b3:	eb fd                	jmp    1b2 <readytest+0xfc>
+  if(pollone(fds[1], POLLOUT) != POLLOUT)
+     1b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     1b8:	be 04 00 00 00       	mov    $0x4,%esi
+     1bd:	89 c7                	mov    %eax,%edi
+     1bf:	e8 3c fe ff ff       	call   0 <pollone>
+     1c4:	83 f8 04             	cmp    $0x4,%eax
+     1c7:	74 5c                	je     225 <readytest+0x16f>
+    error("empty pipe is not ready to write");
+     1c9:	8b 05 f1 21 00 00    	mov    0x21f1(%rip),%eax        # 23c0 <stdout>
+     1cf:	ba 32 00 00 00       	mov    $0x32,%edx
+     1d4:	48 8d 0d 05 1b 00 00 	lea    0x1b05(%rip),%rcx        # 1ce0 <malloc+0x183>
+     1db:	48 89 ce             	mov    %rcx,%rsi
+     1de:	89 c7                	mov    %eax,%edi
+     1e0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1e5:	e8 f1 10 00 00       	call   12db <printf>
+     1ea:	8b 05 d0 21 00 00    	mov    0x21d0(%rip),%eax        # 23c0 <stdout>
+     1f0:	48 8d 15 59 1b 00 00 	lea    0x1b59(%rip),%rdx        # 1d50 <malloc+0x1f3>
+     1f7:	48 89 d6             	mov    %rdx,%rsi
+     1fa:	89 c7                	mov    %eax,%edi
+     1fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     201:	e8 d5 10 00 00       	call   12db <printf>
+     206:	8b 05 b4 21 00 00    	mov    0x21b4(%rip),%eax        # 23c0 <stdout>
+     20c:	48 8d 15 06 1b 00 00 	lea    0x1b06(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     213:	48 89 d6             	mov    %rdx,%rsi
+     216:	89 c7                	mov    %eax,%edi
+     218:	b8 00 00 00 00       	mov    $0x0,%eax
+     21d:	e8 b9 10 00 00       	call   12db <printf>
+     222:	90                   	nop
+     223:	eb fd                	jmp    222 <readytest+0x16c>
+  if(write(fds[1], "x", 1) != 1)
+     225:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     228:	ba 01 00 00 00       	mov    $0x1,%edx
+     22d:	48 8d 0d 3d 1b 00 00 	lea    0x1b3d(%rip),%rcx        # 1d71 <malloc+0x214>
+     234:	48 89 ce             	mov    %rcx,%rsi
+     237:	89 c7                	mov    %eax,%edi
+     239:	e8 64 16 00 00       	call   18a2 <write>
+     23e:	83 f8 01             	cmp    $0x1,%eax
+     241:	74 5c                	je     29f <readytest+0x1e9>
+    error("write failed");
+     243:	8b 05 77 21 00 00    	mov    0x2177(%rip),%eax        # 23c0 <stdout>
+     249:	ba 34 00 00 00       	mov    $0x34,%edx
+     24e:	48 8d 0d 8b 1a 00 00 	lea    0x1a8b(%rip),%rcx        # 1ce0 <malloc+0x183>
+     255:	48 89 ce             	mov    %rcx,%rsi
+     258:	89 c7                	mov    %eax,%edi
+     25a:	b8 00 00 00 00       	mov    $0x0,%eax
+     25f:	e8 77 10 00 00       	call   12db <printf>
+     264:	8b 05 56 21 00 00    	mov    0x2156(%rip),%eax        # 23c0 <stdout>
+     26a:	48 8d 15 02 1b 00 00 	lea    0x1b02(%rip),%rdx        # 1d73 <malloc+0x216>
+     271:	48 89 d6             	mov    %rdx,%rsi
+     274:	89 c7                	mov    %eax,%edi
+     276:	b8 00 00 00 00       	mov    $0x0,%eax
+     27b:	e8 5b 10 00 00       	call   12db <printf>
+     280:	8b 05 3a 21 00 00    	mov    0x213a(%rip),%eax        # 23c0 <stdout>
+     286:	48 8d 15 8c 1a 00 00 	lea    0x1a8c(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     28d:	48 89 d6             	mov    %rdx,%rsi
+     290:	89 c7                	mov    %eax,%edi
+     292:	b8 00 00 00 00       	mov    $0x0,%eax
+     297:	e8 3f 10 00 00       	call   12db <printf>
+     29c:	90                   	nop
+     29d:	eb fd                	jmp    29c <readytest+0x1e6>
+  if(pollone(fds[0], POLLIN) != POLLIN)
+     29f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2a2:	be 01 00 00 00       	mov    $0x1,%esi
+     2a7:	89 c7                	mov    %eax,%edi
+     2a9:	e8 52 fd ff ff       	call   0 <pollone>
+     2ae:	83 f8 01             	cmp    $0x1,%eax
+     2b1:	74 5c                	je     30f <readytest+0x259>
+    error("pipe with data is not ready to read");
+     2b3:	8b 05 07 21 00 00    	mov    0x2107(%rip),%eax        # 23c0 <stdout>
+     2b9:	ba 36 00 00 00       	mov    $0x36,%edx
+     2be:	48 8d 0d 1b 1a 00 00 	lea    0x1a1b(%rip),%rcx        # 1ce0 <malloc+0x183>
+     2c5:	48 89 ce             	mov    %rcx,%rsi
+     2c8:	89 c7                	mov    %eax,%edi
+     2ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     2cf:	e8 07 10 00 00       	call   12db <printf>
+     2d4:	8b 05 e6 20 00 00    	mov    0x20e6(%rip),%eax        # 23c0 <stdout>
+     2da:	48 8d 15 9f 1a 00 00 	lea    0x1a9f(%rip),%rdx        # 1d80 <malloc+0x223>
+     2e1:	48 89 d6             	mov    %rdx,%rsi
+     2e4:	89 c7                	mov    %eax,%edi
+     2e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     2eb:	e8 eb 0f 00 00       	call   12db <printf>
+     2f0:	8b 05 ca 20 00 00    	mov    0x20ca(%rip),%eax        # 23c0 <stdout>
+     2f6:	48 8d 15 1c 1a 00 00 	lea    0x1a1c(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     2fd:	48 89 d6             	mov    %rdx,%rsi
+     300:	89 c7                	mov    %eax,%edi
+     302:	b8 00 00 00 00       	mov    $0x0,%eax
+     307:	e8 cf 0f 00 00       	call   12db <printf>
+     30c:	90                   	nop
+     30d:	eb fd                	jmp    30c <readytest+0x256>
+  if(read(fds[0], buf, 1) != 1)
+     30f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     312:	ba 01 00 00 00       	mov    $0x1,%edx
+     317:	48 8d 0d 42 21 00 00 	lea    0x2142(%rip),%rcx        # 2460 <buf>
+     31e:	48 89 ce             	mov    %rcx,%rsi
+     321:	89 c7                	mov    %eax,%edi
+     323:	e8 72 15 00 00       	call   189a <read>
+     328:	83 f8 01             	cmp    $0x1,%eax
+     32b:	74 5c                	je     389 <readytest+0x2d3>
+    error("read failed");
+     32d:	8b 05 8d 20 00 00    	mov    0x208d(%rip),%eax        # 23c0 <stdout>
+     333:	ba 38 00 00 00       	mov    $0x38,%edx
+     338:	48 8d 0d a1 19 00 00 	lea    0x19a1(%rip),%rcx        # 1ce0 <malloc+0x183>
+     33f:	48 89 ce             	mov    %rcx,%rsi
+     342:	89 c7                	mov    %eax,%edi
+     344:	b8 00 00 00 00       	mov    $0x0,%eax
+     349:	e8 8d 0f 00 00       	call   12db <printf>
+     34e:	8b 05 6c 20 00 00    	mov    0x206c(%rip),%eax        # 23c0 <stdout>
+     354:	48 8d 15 49 1a 00 00 	lea    0x1a49(%rip),%rdx        # 1da4 <malloc+0x247>
+     35b:	48 89 d6             	mov    %rdx,%rsi
+     35e:	89 c7                	mov    %eax,%edi
+     360:	b8 00 00 00 00       	mov    $0x0,%eax
+     365:	e8 71 0f 00 00       	call   12db <printf>
+     36a:	8b 05 50 20 00 00    	mov    0x2050(%rip),%eax        # 23c0 <stdout>
+     370:	48 8d 15 a2 19 00 00 	lea    0x19a2(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     377:	48 89 d6             	mov    %rdx,%rsi
+     37a:	89 c7                	mov    %eax,%edi
+     37c:	b8 00 00 00 00       	mov    $0x0,%eax
+     381:	e8 55 0f 00 00       	call   12db <printf>
+     386:	90                   	nop
+     387:	eb fd                	jmp    386 <readytest+0x2d0>
+  if(pollone(fds[0], POLLIN) != 0)
+     389:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     38c:	be 01 00 00 00       	mov    $0x1,%esi
+     391:	89 c7                	mov    %eax,%edi
+     393:	e8 68 fc ff ff       	call   0 <pollone>
+     398:	85 c0                	test   %eax,%eax
+     39a:	74 5c                	je     3f8 <readytest+0x342>
+    error("drained pipe is ready to read");
+     39c:	8b 05 1e 20 00 00    	mov    0x201e(%rip),%eax        # 23c0 <stdout>
+     3a2:	ba 3a 00 00 00       	mov    $0x3a,%edx
+     3a7:	48 8d 0d 32 19 00 00 	lea    0x1932(%rip),%rcx        # 1ce0 <malloc+0x183>
+     3ae:	48 89 ce             	mov    %rcx,%rsi
+     3b1:	89 c7                	mov    %eax,%edi
+     3b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     3b8:	e8 1e 0f 00 00       	call   12db <printf>
+     3bd:	8b 05 fd 1f 00 00    	mov    0x1ffd(%rip),%eax        # 23c0 <stdout>
+     3c3:	48 8d 15 e6 19 00 00 	lea    0x19e6(%rip),%rdx        # 1db0 <malloc+0x253>
+     3ca:	48 89 d6             	mov    %rdx,%rsi
+     3cd:	89 c7                	mov    %eax,%edi
+     3cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     3d4:	e8 02 0f 00 00       	call   12db <printf>
+     3d9:	8b 05 e1 1f 00 00    	mov    0x1fe1(%rip),%eax        # 23c0 <stdout>
+     3df:	48 8d 15 33 19 00 00 	lea    0x1933(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     3e6:	48 89 d6             	mov    %rdx,%rsi
+     3e9:	89 c7                	mov    %eax,%edi
+     3eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     3f0:	e8 e6 0e 00 00       	call   12db <printf>
+     3f5:	90                   	nop
+     3f6:	eb fd                	jmp    3f5 <readytest+0x33f>
+  close(fds[0]);
+     3f8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3fb:	89 c7                	mov    %eax,%edi
+     3fd:	e8 a8 14 00 00       	call   18aa <close>
+  close(fds[1]);
+     402:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     405:	89 c7                	mov    %eax,%edi
+     407:	e8 9e 14 00 00       	call   18aa <close>
+  printf(stdout, "readytest OK\n");
+     40c:	8b 05 ae 1f 00 00    	mov    0x1fae(%rip),%eax        # 23c0 <stdout>
+     412:	48 8d 15 b5 19 00 00 	lea    0x19b5(%rip),%rdx        # 1dce <malloc+0x271>
+     419:	48 89 d6             	mov    %rdx,%rsi
+     41c:	89 c7                	mov    %eax,%edi
+     41e:	b8 00 00 00 00       	mov    $0x0,%eax
+     423:	e8 b3 0e 00 00       	call   12db <printf>
+}
+     428:	90                   	nop
+     429:	c9                   	leave
+     42a:	c3                   	ret
+
+000000000000042b <nonblocktest>:
+// With O_NONBLOCK, reading an empty pipe and writing a full one fail
+// with E_AGAIN instead of waiting, and poll agrees with them about
+// when a write can go in.
+void
+nonblocktest(void)
+{
+     42b:	55                   	push   %rbp
+     42c:	48 89 e5             	mov    %rsp,%rbp
+     42f:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], n, total;
+
+  printf(stdout, "nonblocktest\n");
+     433:	8b 05 87 1f 00 00    	mov    0x1f87(%rip),%eax        # 23c0 <stdout>
+     439:	48 8d 15 9c 19 00 00 	lea    0x199c(%rip),%rdx        # 1ddc <malloc+0x27f>
+     440:	48 89 d6             	mov    %rdx,%rsi
+     443:	89 c7                	mov    %eax,%edi
+     445:	b8 00 00 00 00       	mov    $0x0,%eax
+     44a:	e8 8c 0e 00 00       	call   12db <printf>
+  if(pipe2(fds, O_NONBLOCK) < 0)
+     44f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     453:	be 00 08 00 00       	mov    $0x800,%esi
+     458:	48 89 c7             	mov    %rax,%rdi
+     45b:	e8 39 15 00 00       	call   1999 <pipe2>
+     460:	85 c0                	test   %eax,%eax
+     462:	79 5c                	jns    4c0 <nonblocktest+0x95>
+    error("pipe2 failed");
+     464:	8b 05 56 1f 00 00    	mov    0x1f56(%rip),%eax        # 23c0 <stdout>
+     46a:	ba 4a 00 00 00       	mov    $0x4a,%edx
+     46f:	48 8d 0d 6a 18 00 00 	lea    0x186a(%rip),%rcx        # 1ce0 <malloc+0x183>
+     476:	48 89 ce             	mov    %rcx,%rsi
+     479:	89 c7                	mov    %eax,%edi
+     47b:	b8 00 00 00 00       	mov    $0x0,%eax
+     480:	e8 56 0e 00 00       	call   12db <printf>
+     485:	8b 05 35 1f 00 00    	mov    0x1f35(%rip),%eax        # 23c0 <stdout>
+     48b:	48 8d 15 58 19 00 00 	lea    0x1958(%rip),%rdx        # 1dea <malloc+0x28d>
+     492:	48 89 d6             	mov    %rdx,%rsi
+     495:	89 c7                	mov    %eax,%edi
+     497:	b8 00 00 00 00       	mov    $0x0,%eax
+     49c:	e8 3a 0e 00 00       	call   12db <printf>
+     4a1:	8b 05 19 1f 00 00    	mov    0x1f19(%rip),%eax        # 23c0 <stdout>
+     4a7:	48 8d 15 6b 18 00 00 	lea    0x186b(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     4ae:	48 89 d6             	mov    %rdx,%rsi
+     4b1:	89 c7                	mov    %eax,%edi
+     4b3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b8:	e8 1e 0e 00 00       	call   12db <printf>
+     4bd:	90                   	nop
+     4be:	eb fd                	jmp    4bd <nonblocktest+0x92>
+  if((n = read(fds[0], buf, 1)) != -E_AGAIN)
+     4c0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     4c3:	ba 01 00 00 00       	mov    $0x1,%edx
+     4c8:	48 8d 0d 91 1f 00 00 	lea    0x1f91(%rip),%rcx        # 2460 <buf>
+     4cf:	48 89 ce             	mov    %rcx,%rsi
+     4d2:	89 c7                	mov    %eax,%edi
+     4d4:	e8 c1 13 00 00       	call   189a <read>
+     4d9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     4dc:	83 7d f8 f9          	cmpl   $0xfffffff9,-0x8(%rbp)
+     4e0:	74 5f                	je     541 <nonblocktest+0x116>
+    error("read of an empty pipe returned %d", n);
+     4e2:	8b 05 d8 1e 00 00    	mov    0x1ed8(%rip),%eax        # 23c0 <stdout>
+     4e8:	ba 4c 00 00 00       	mov    $0x4c,%edx
+     4ed:	48 8d 0d ec 17 00 00 	lea    0x17ec(%rip),%rcx        # 1ce0 <malloc+0x183>
+     4f4:	48 89 ce             	mov    %rcx,%rsi
+     4f7:	89 c7                	mov    %eax,%edi
+     4f9:	b8 00 00 00 00       	mov    $0x0,%eax
+     4fe:	e8 d8 0d 00 00       	call   12db <printf>
+     503:	8b 05 b7 1e 00 00    	mov    0x1eb7(%rip),%eax        # 23c0 <stdout>
+     509:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     50c:	48 8d 0d e5 18 00 00 	lea    0x18e5(%rip),%rcx        # 1df8 <malloc+0x29b>
+     513:	48 89 ce             	mov    %rcx,%rsi
+     516:	89 c7                	mov    %eax,%edi
+     518:	b8 00 00 00 00       	mov    $0x0,%eax
+     51d:	e8 b9 0d 00 00       	call   12db <printf>
+     522:	8b 05 98 1e 00 00    	mov    0x1e98(%rip),%eax        # 23c0 <stdout>
+     528:	48 8d 15 ea 17 00 00 	lea    0x17ea(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     52f:	48 89 d6             	mov    %rdx,%rsi
+     532:	89 c7                	mov    %eax,%edi
+     534:	b8 00 00 00 00       	mov    $0x0,%eax
+     539:	e8 9d 0d 00 00       	call   12db <printf>
+     53e:	90                   	nop
+     53f:	eb fd                	jmp    53e <nonblocktest+0x113>
+
+  memset(buf, 'n', PGSIZE);
+     541:	ba 00 10 00 00       	mov    $0x1000,%edx
+     546:	be 6e 00 00 00       	mov    $0x6e,%esi
+     54b:	48 8d 05 0e 1f 00 00 	lea    0x1f0e(%rip),%rax        # 2460 <buf>
+     552:	48 89 c7             	mov    %rax,%rdi
+     555:	e8 3f 11 00 00       	call   1699 <memset>
+  for(total = 0; (n = write(fds[1], buf, PGSIZE)) > 0; total += n)
+     55a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     561:	eb 6b                	jmp    5ce <nonblocktest+0x1a3>
+    if(total > 1024 * PGSIZE)
+     563:	81 7d fc 00 00 40 00 	cmpl   $0x400000,-0x4(%rbp)
+     56a:	7e 5c                	jle    5c8 <nonblocktest+0x19d>
+      error("pipe never filled up");
+     56c:	8b 05 4e 1e 00 00    	mov    0x1e4e(%rip),%eax        # 23c0 <stdout>
+     572:	ba 51 00 00 00       	mov    $0x51,%edx
+     577:	48 8d 0d 62 17 00 00 	lea    0x1762(%rip),%rcx        # 1ce0 <malloc+0x183>
+     57e:	48 89 ce             	mov    %rcx,%rsi
+     581:	89 c7                	mov    %eax,%edi
+     583:	b8 00 00 00 00       	mov    $0x0,%eax
+     588:	e8 4e 0d 00 00       	call   12db <printf>
+     58d:	8b 05 2d 1e 00 00    	mov    0x1e2d(%rip),%eax        # 23c0 <stdout>
+     593:	48 8d 15 80 18 00 00 	lea    0x1880(%rip),%rdx        # 1e1a <malloc+0x2bd>
+     59a:	48 89 d6             	mov    %rdx,%rsi
+     59d:	89 c7                	mov    %eax,%edi
+     59f:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a4:	e8 32 0d 00 00       	call   12db <printf>
+     5a9:	8b 05 11 1e 00 00    	mov    0x1e11(%rip),%eax        # 23c0 <stdout>
+     5af:	48 8d 15 63 17 00 00 	lea    0x1763(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     5b6:	48 89 d6             	mov    %rdx,%rsi
+     5b9:	89 c7                	mov    %eax,%edi
+     5bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c0:	e8 16 0d 00 00       	call   12db <printf>
+     5c5:	90                   	nop
+     5c6:	eb fd                	jmp    5c5 <nonblocktest+0x19a>
+  for(total = 0; (n = write(fds[1], buf, PGSIZE)) > 0; total += n)
+     5c8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     5cb:	01 45 fc             	add    %eax,-0x4(%rbp)
+     5ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     5d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+     5d6:	48 8d 0d 83 1e 00 00 	lea    0x1e83(%rip),%rcx        # 2460 <buf>
+     5dd:	48 89 ce             	mov    %rcx,%rsi
+     5e0:	89 c7                	mov    %eax,%edi
+     5e2:	e8 bb 12 00 00       	call   18a2 <write>
+     5e7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     5ea:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     5ee:	0f 8f 6f ff ff ff    	jg     563 <nonblocktest+0x138>
+  if(n != -E_AGAIN)
+     5f4:	83 7d f8 f9          	cmpl   $0xfffffff9,-0x8(%rbp)
+     5f8:	74 5f                	je     659 <nonblocktest+0x22e>
+    error("write to a full pipe returned %d", n);
+     5fa:	8b 05 c0 1d 00 00    	mov    0x1dc0(%rip),%eax        # 23c0 <stdout>
+     600:	ba 53 00 00 00       	mov    $0x53,%edx
+     605:	48 8d 0d d4 16 00 00 	lea    0x16d4(%rip),%rcx        # 1ce0 <malloc+0x183>
+     60c:	48 89 ce             	mov    %rcx,%rsi
+     60f:	89 c7                	mov    %eax,%edi
+     611:	b8 00 00 00 00       	mov    $0x0,%eax
+     616:	e8 c0 0c 00 00       	call   12db <printf>
+     61b:	8b 05 9f 1d 00 00    	mov    0x1d9f(%rip),%eax        # 23c0 <stdout>
+     621:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     624:	48 8d 0d 05 18 00 00 	lea    0x1805(%rip),%rcx        # 1e30 <malloc+0x2d3>
+     62b:	48 89 ce             	mov    %rcx,%rsi
+     62e:	89 c7                	mov    %eax,%edi
+     630:	b8 00 00 00 00       	mov    $0x0,%eax
+     635:	e8 a1 0c 00 00       	call   12db <printf>
+     63a:	8b 05 80 1d 00 00    	mov    0x1d80(%rip),%eax        # 23c0 <stdout>
+     640:	48 8d 15 d2 16 00 00 	lea    0x16d2(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     647:	48 89 d6             	mov    %rdx,%rsi
+     64a:	89 c7                	mov    %eax,%edi
+     64c:	b8 00 00 00 00       	mov    $0x0,%eax
+     651:	e8 85 0c 00 00       	call   12db <printf>
+     656:	90                   	nop
+     657:	eb fd                	jmp    656 <nonblocktest+0x22b>
+  if(pollone(fds[1], POLLOUT) != 0)
+     659:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     65c:	be 04 00 00 00       	mov    $0x4,%esi
+     661:	89 c7                	mov    %eax,%edi
+     663:	e8 98 f9 ff ff       	call   0 <pollone>
+     668:	85 c0                	test   %eax,%eax
+     66a:	74 5c                	je     6c8 <nonblocktest+0x29d>
+    error("full pipe is ready to write");
+     66c:	8b 05 4e 1d 00 00    	mov    0x1d4e(%rip),%eax        # 23c0 <stdout>
+     672:	ba 55 00 00 00       	mov    $0x55,%edx
+     677:	48 8d 0d 62 16 00 00 	lea    0x1662(%rip),%rcx        # 1ce0 <malloc+0x183>
+     67e:	48 89 ce             	mov    %rcx,%rsi
+     681:	89 c7                	mov    %eax,%edi
+     683:	b8 00 00 00 00       	mov    $0x0,%eax
+     688:	e8 4e 0c 00 00       	call   12db <printf>
+     68d:	8b 05 2d 1d 00 00    	mov    0x1d2d(%rip),%eax        # 23c0 <stdout>
+     693:	48 8d 15 b7 17 00 00 	lea    0x17b7(%rip),%rdx        # 1e51 <malloc+0x2f4>
+     69a:	48 89 d6             	mov    %rdx,%rsi
+     69d:	89 c7                	mov    %eax,%edi
+     69f:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a4:	e8 32 0c 00 00       	call   12db <printf>
+     6a9:	8b 05 11 1d 00 00    	mov    0x1d11(%rip),%eax        # 23c0 <stdout>
+     6af:	48 8d 15 63 16 00 00 	lea    0x1663(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     6b6:	48 89 d6             	mov    %rdx,%rsi
+     6b9:	89 c7                	mov    %eax,%edi
+     6bb:	b8 00 00 00 00       	mov    $0x0,%eax
+     6c0:	e8 16 0c 00 00       	call   12db <printf>
+     6c5:	90                   	nop
+     6c6:	eb fd                	jmp    6c5 <nonblocktest+0x29a>
+
+  // the page at the tail is not free until it is drained
+  if(read(fds[0], buf, 100) != 100)
+     6c8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     6cb:	ba 64 00 00 00       	mov    $0x64,%edx
+     6d0:	48 8d 0d 89 1d 00 00 	lea    0x1d89(%rip),%rcx        # 2460 <buf>
+     6d7:	48 89 ce             	mov    %rcx,%rsi
+     6da:	89 c7                	mov    %eax,%edi
+     6dc:	e8 b9 11 00 00       	call   189a <read>
+     6e1:	83 f8 64             	cmp    $0x64,%eax
+     6e4:	74 5c                	je     742 <nonblocktest+0x317>
+    error("read failed");
+     6e6:	8b 05 d4 1c 00 00    	mov    0x1cd4(%rip),%eax        # 23c0 <stdout>
+     6ec:	ba 59 00 00 00       	mov    $0x59,%edx
+     6f1:	48 8d 0d e8 15 00 00 	lea    0x15e8(%rip),%rcx        # 1ce0 <malloc+0x183>
+     6f8:	48 89 ce             	mov    %rcx,%rsi
+     6fb:	89 c7                	mov    %eax,%edi
+     6fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     702:	e8 d4 0b 00 00       	call   12db <printf>
+     707:	8b 05 b3 1c 00 00    	mov    0x1cb3(%rip),%eax        # 23c0 <stdout>
+     70d:	48 8d 15 90 16 00 00 	lea    0x1690(%rip),%rdx        # 1da4 <malloc+0x247>
+     714:	48 89 d6             	mov    %rdx,%rsi
+     717:	89 c7                	mov    %eax,%edi
+     719:	b8 00 00 00 00       	mov    $0x0,%eax
+     71e:	e8 b8 0b 00 00       	call   12db <printf>
+     723:	8b 05 97 1c 00 00    	mov    0x1c97(%rip),%eax        # 23c0 <stdout>
+     729:	48 8d 15 e9 15 00 00 	lea    0x15e9(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     730:	48 89 d6             	mov    %rdx,%rsi
+     733:	89 c7                	mov    %eax,%edi
+     735:	b8 00 00 00 00       	mov    $0x0,%eax
+     73a:	e8 9c 0b 00 00       	call   12db <printf>
+     73f:	90                   	nop
+     740:	eb fd                	jmp    73f <nonblocktest+0x314>
+  if(pollone(fds[1], POLLOUT) != 0)
+     742:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     745:	be 04 00 00 00       	mov    $0x4,%esi
+     74a:	89 c7                	mov    %eax,%edi
+     74c:	e8 af f8 ff ff       	call   0 <pollone>
+     751:	85 c0                	test   %eax,%eax
+     753:	74 5c                	je     7b1 <nonblocktest+0x386>
+    error("pipe is ready to write with every page still taken");
+     755:	8b 05 65 1c 00 00    	mov    0x1c65(%rip),%eax        # 23c0 <stdout>
+     75b:	ba 5b 00 00 00       	mov    $0x5b,%edx
+     760:	48 8d 0d 79 15 00 00 	lea    0x1579(%rip),%rcx        # 1ce0 <malloc+0x183>
+     767:	48 89 ce             	mov    %rcx,%rsi
+     76a:	89 c7                	mov    %eax,%edi
+     76c:	b8 00 00 00 00       	mov    $0x0,%eax
+     771:	e8 65 0b 00 00       	call   12db <printf>
+     776:	8b 05 44 1c 00 00    	mov    0x1c44(%rip),%eax        # 23c0 <stdout>
+     77c:	48 8d 15 ed 16 00 00 	lea    0x16ed(%rip),%rdx        # 1e70 <malloc+0x313>
+     783:	48 89 d6             	mov    %rdx,%rsi
+     786:	89 c7                	mov    %eax,%edi
+     788:	b8 00 00 00 00       	mov    $0x0,%eax
+     78d:	e8 49 0b 00 00       	call   12db <printf>
+     792:	8b 05 28 1c 00 00    	mov    0x1c28(%rip),%eax        # 23c0 <stdout>
+     798:	48 8d 15 7a 15 00 00 	lea    0x157a(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     79f:	48 89 d6             	mov    %rdx,%rsi
+     7a2:	89 c7                	mov    %eax,%edi
+     7a4:	b8 00 00 00 00       	mov    $0x0,%eax
+     7a9:	e8 2d 0b 00 00       	call   12db <printf>
+     7ae:	90                   	nop
+     7af:	eb fd                	jmp    7ae <nonblocktest+0x383>
+  if(read(fds[0], buf, PGSIZE - 100) != PGSIZE - 100)
+     7b1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     7b4:	ba 9c 0f 00 00       	mov    $0xf9c,%edx
+     7b9:	48 8d 0d a0 1c 00 00 	lea    0x1ca0(%rip),%rcx        # 2460 <buf>
+     7c0:	48 89 ce             	mov    %rcx,%rsi
+     7c3:	89 c7                	mov    %eax,%edi
+     7c5:	e8 d0 10 00 00       	call   189a <read>
+     7ca:	3d 9c 0f 00 00       	cmp    $0xf9c,%eax
+     7cf:	74 5c                	je     82d <nonblocktest+0x402>
+    error("read failed");
+     7d1:	8b 05 e9 1b 00 00    	mov    0x1be9(%rip),%eax        # 23c0 <stdout>
+     7d7:	ba 5d 00 00 00       	mov    $0x5d,%edx
+     7dc:	48 8d 0d fd 14 00 00 	lea    0x14fd(%rip),%rcx        # 1ce0 <malloc+0x183>
+     7e3:	48 89 ce             	mov    %rcx,%rsi
+     7e6:	89 c7                	mov    %eax,%edi
+     7e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ed:	e8 e9 0a 00 00       	call   12db <printf>
+     7f2:	8b 05 c8 1b 00 00    	mov    0x1bc8(%rip),%eax        # 23c0 <stdout>
+     7f8:	48 8d 15 a5 15 00 00 	lea    0x15a5(%rip),%rdx        # 1da4 <malloc+0x247>
+     7ff:	48 89 d6             	mov    %rdx,%rsi
+     802:	89 c7                	mov    %eax,%edi
+     804:	b8 00 00 00 00       	mov    $0x0,%eax
+     809:	e8 cd 0a 00 00       	call   12db <printf>
+     80e:	8b 05 ac 1b 00 00    	mov    0x1bac(%rip),%eax        # 23c0 <stdout>
+     814:	48 8d 15 fe 14 00 00 	lea    0x14fe(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     81b:	48 89 d6             	mov    %rdx,%rsi
+     81e:	89 c7                	mov    %eax,%edi
+     820:	b8 00 00 00 00       	mov    $0x0,%eax
+     825:	e8 b1 0a 00 00       	call   12db <printf>
+     82a:	90                   	nop
+     82b:	eb fd                	jmp    82a <nonblocktest+0x3ff>
+  if(pollone(fds[1], POLLOUT) != POLLOUT)
+     82d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     830:	be 04 00 00 00       	mov    $0x4,%esi
+     835:	89 c7                	mov    %eax,%edi
+     837:	e8 c4 f7 ff ff       	call   0 <pollone>
+     83c:	83 f8 04             	cmp    $0x4,%eax
+     83f:	74 5c                	je     89d <nonblocktest+0x472>
+    error("pipe with a free page is not ready to write");
+     841:	8b 05 79 1b 00 00    	mov    0x1b79(%rip),%eax        # 23c0 <stdout>
+     847:	ba 5f 00 00 00       	mov    $0x5f,%edx
+     84c:	48 8d 0d 8d 14 00 00 	lea    0x148d(%rip),%rcx        # 1ce0 <malloc+0x183>
+     853:	48 89 ce             	mov    %rcx,%rsi
+     856:	89 c7                	mov    %eax,%edi
+     858:	b8 00 00 00 00       	mov    $0x0,%eax
+     85d:	e8 79 0a 00 00       	call   12db <printf>
+     862:	8b 05 58 1b 00 00    	mov    0x1b58(%rip),%eax        # 23c0 <stdout>
+     868:	48 8d 15 39 16 00 00 	lea    0x1639(%rip),%rdx        # 1ea8 <malloc+0x34b>
+     86f:	48 89 d6             	mov    %rdx,%rsi
+     872:	89 c7                	mov    %eax,%edi
+     874:	b8 00 00 00 00       	mov    $0x0,%eax
+     879:	e8 5d 0a 00 00       	call   12db <printf>
+     87e:	8b 05 3c 1b 00 00    	mov    0x1b3c(%rip),%eax        # 23c0 <stdout>
+     884:	48 8d 15 8e 14 00 00 	lea    0x148e(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     88b:	48 89 d6             	mov    %rdx,%rsi
+     88e:	89 c7                	mov    %eax,%edi
+     890:	b8 00 00 00 00       	mov    $0x0,%eax
+     895:	e8 41 0a 00 00       	call   12db <printf>
+     89a:	90                   	nop
+     89b:	eb fd                	jmp    89a <nonblocktest+0x46f>
+  if((n = write(fds[1], buf, PGSIZE)) != PGSIZE)
+     89d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     8a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+     8a5:	48 8d 0d b4 1b 00 00 	lea    0x1bb4(%rip),%rcx        # 2460 <buf>
+     8ac:	48 89 ce             	mov    %rcx,%rsi
+     8af:	89 c7                	mov    %eax,%edi
+     8b1:	e8 ec 0f 00 00       	call   18a2 <write>
+     8b6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     8b9:	81 7d f8 00 10 00 00 	cmpl   $0x1000,-0x8(%rbp)
+     8c0:	74 5f                	je     921 <nonblocktest+0x4f6>
+    error("write into the free page returned %d", n);
+     8c2:	8b 05 f8 1a 00 00    	mov    0x1af8(%rip),%eax        # 23c0 <stdout>
+     8c8:	ba 61 00 00 00       	mov    $0x61,%edx
+     8cd:	48 8d 0d 0c 14 00 00 	lea    0x140c(%rip),%rcx        # 1ce0 <malloc+0x183>
+     8d4:	48 89 ce             	mov    %rcx,%rsi
+     8d7:	89 c7                	mov    %eax,%edi
+     8d9:	b8 00 00 00 00       	mov    $0x0,%eax
+     8de:	e8 f8 09 00 00       	call   12db <printf>
+     8e3:	8b 05 d7 1a 00 00    	mov    0x1ad7(%rip),%eax        # 23c0 <stdout>
+     8e9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     8ec:	48 8d 0d e5 15 00 00 	lea    0x15e5(%rip),%rcx        # 1ed8 <malloc+0x37b>
+     8f3:	48 89 ce             	mov    %rcx,%rsi
+     8f6:	89 c7                	mov    %eax,%edi
+     8f8:	b8 00 00 00 00       	mov    $0x0,%eax
+     8fd:	e8 d9 09 00 00       	call   12db <printf>
+     902:	8b 05 b8 1a 00 00    	mov    0x1ab8(%rip),%eax        # 23c0 <stdout>
+     908:	48 8d 15 0a 14 00 00 	lea    0x140a(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     90f:	48 89 d6             	mov    %rdx,%rsi
+     912:	89 c7                	mov    %eax,%edi
+     914:	b8 00 00 00 00       	mov    $0x0,%eax
+     919:	e8 bd 09 00 00       	call   12db <printf>
+     91e:	90                   	nop
+     91f:	eb fd                	jmp    91e <nonblocktest+0x4f3>
+
+  // the rest is still there, and then the end
+  close(fds[1]);
+     921:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     924:	89 c7                	mov    %eax,%edi
+     926:	e8 7f 0f 00 00       	call   18aa <close>
+  while((n = read(fds[0], buf, PGSIZE)) > 0)
+     92b:	90                   	nop
+     92c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     92f:	ba 00 10 00 00       	mov    $0x1000,%edx
+     934:	48 8d 0d 25 1b 00 00 	lea    0x1b25(%rip),%rcx        # 2460 <buf>
+     93b:	48 89 ce             	mov    %rcx,%rsi
+     93e:	89 c7                	mov    %eax,%edi
+     940:	e8 55 0f 00 00       	call   189a <read>
+     945:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     948:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     94c:	7f de                	jg     92c <nonblocktest+0x501>
+    ;
+  if(n != 0)
+     94e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     952:	74 5f                	je     9b3 <nonblocktest+0x588>
+    error("read of a drained and closed pipe returned %d", n);
+     954:	8b 05 66 1a 00 00    	mov    0x1a66(%rip),%eax        # 23c0 <stdout>
+     95a:	ba 68 00 00 00       	mov    $0x68,%edx
+     95f:	48 8d 0d 7a 13 00 00 	lea    0x137a(%rip),%rcx        # 1ce0 <malloc+0x183>
+     966:	48 89 ce             	mov    %rcx,%rsi
+     969:	89 c7                	mov    %eax,%edi
+     96b:	b8 00 00 00 00       	mov    $0x0,%eax
+     970:	e8 66 09 00 00       	call   12db <printf>
+     975:	8b 05 45 1a 00 00    	mov    0x1a45(%rip),%eax        # 23c0 <stdout>
+     97b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     97e:	48 8d 0d 7b 15 00 00 	lea    0x157b(%rip),%rcx        # 1f00 <malloc+0x3a3>
+     985:	48 89 ce             	mov    %rcx,%rsi
+     988:	89 c7                	mov    %eax,%edi
+     98a:	b8 00 00 00 00       	mov    $0x0,%eax
+     98f:	e8 47 09 00 00       	call   12db <printf>
+     994:	8b 05 26 1a 00 00    	mov    0x1a26(%rip),%eax        # 23c0 <stdout>
+     99a:	48 8d 15 78 13 00 00 	lea    0x1378(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     9a1:	48 89 d6             	mov    %rdx,%rsi
+     9a4:	89 c7                	mov    %eax,%edi
+     9a6:	b8 00 00 00 00       	mov    $0x0,%eax
+     9ab:	e8 2b 09 00 00       	call   12db <printf>
+     9b0:	90                   	nop
+     9b1:	eb fd                	jmp    9b0 <nonblocktest+0x585>
+  close(fds[0]);
+     9b3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     9b6:	89 c7                	mov    %eax,%edi
+     9b8:	e8 ed 0e 00 00       	call   18aa <close>
+  printf(stdout, "nonblocktest OK\n");
+     9bd:	8b 05 fd 19 00 00    	mov    0x19fd(%rip),%eax        # 23c0 <stdout>
+     9c3:	48 8d 15 64 15 00 00 	lea    0x1564(%rip),%rdx        # 1f2e <malloc+0x3d1>
+     9ca:	48 89 d6             	mov    %rdx,%rsi
+     9cd:	89 c7                	mov    %eax,%edi
+     9cf:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d4:	e8 02 09 00 00       	call   12db <printf>
+}
+     9d9:	90                   	nop
+     9da:	c9                   	leave
+     9db:	c3                   	ret
+
+00000000000009dc <hanguptest>:
+
+// Closing one end of a pipe shows at the other.
+void
+hanguptest(void)
+{
+     9dc:	55                   	push   %rbp
+     9dd:	48 89 e5             	mov    %rsp,%rbp
+     9e0:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2];
+
+  printf(stdout, "hanguptest\n");
+     9e4:	8b 05 d6 19 00 00    	mov    0x19d6(%rip),%eax        # 23c0 <stdout>
+     9ea:	48 8d 15 4e 15 00 00 	lea    0x154e(%rip),%rdx        # 1f3f <malloc+0x3e2>
+     9f1:	48 89 d6             	mov    %rdx,%rsi
+     9f4:	89 c7                	mov    %eax,%edi
+     9f6:	b8 00 00 00 00       	mov    $0x0,%eax
+     9fb:	e8 db 08 00 00       	call   12db <printf>
+  if(pipe(fds) < 0)
+     a00:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+     a04:	48 89 c7             	mov    %rax,%rdi
+     a07:	e8 86 0e 00 00       	call   1892 <pipe>
+     a0c:	85 c0                	test   %eax,%eax
+     a0e:	79 5c                	jns    a6c <hanguptest+0x90>
+    error("pipe failed");
+     a10:	8b 05 aa 19 00 00    	mov    0x19aa(%rip),%eax        # 23c0 <stdout>
+     a16:	ba 75 00 00 00       	mov    $0x75,%edx
+     a1b:	48 8d 0d be 12 00 00 	lea    0x12be(%rip),%rcx        # 1ce0 <malloc+0x183>
+     a22:	48 89 ce             	mov    %rcx,%rsi
+     a25:	89 c7                	mov    %eax,%edi
+     a27:	b8 00 00 00 00       	mov    $0x0,%eax
+     a2c:	e8 aa 08 00 00       	call   12db <printf>
+     a31:	8b 05 89 19 00 00    	mov    0x1989(%rip),%eax        # 23c0 <stdout>
+     a37:	48 8d 15 e8 12 00 00 	lea    0x12e8(%rip),%rdx        # 1d26 <malloc+0x1c9>
+     a3e:	48 89 d6             	mov    %rdx,%rsi
+     a41:	89 c7                	mov    %eax,%edi
+     a43:	b8 00 00 00 00       	mov    $0x0,%eax
+     a48:	e8 8e 08 00 00       	call   12db <printf>
+     a4d:	8b 05 6d 19 00 00    	mov    0x196d(%rip),%eax        # 23c0 <stdout>
+     a53:	48 8d 15 bf 12 00 00 	lea    0x12bf(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     a5a:	48 89 d6             	mov    %rdx,%rsi
+     a5d:	89 c7                	mov    %eax,%edi
+     a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a64:	e8 72 08 00 00       	call   12db <printf>
+     a69:	90                   	nop
+     a6a:	eb fd                	jmp    a69 <hanguptest+0x8d>
+  close(fds[1]);
+     a6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a6f:	89 c7                	mov    %eax,%edi
+     a71:	e8 34 0e 00 00       	call   18aa <close>
+  if(pollone(fds[0], POLLIN) != POLLHUP)
+     a76:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     a79:	be 01 00 00 00       	mov    $0x1,%esi
+     a7e:	89 c7                	mov    %eax,%edi
+     a80:	e8 7b f5 ff ff       	call   0 <pollone>
+     a85:	83 f8 10             	cmp    $0x10,%eax
+     a88:	74 5c                	je     ae6 <hanguptest+0x10a>
+    error("closed write end does not show as POLLHUP");
+     a8a:	8b 05 30 19 00 00    	mov    0x1930(%rip),%eax        # 23c0 <stdout>
+     a90:	ba 78 00 00 00       	mov    $0x78,%edx
+     a95:	48 8d 0d 44 12 00 00 	lea    0x1244(%rip),%rcx        # 1ce0 <malloc+0x183>
+     a9c:	48 89 ce             	mov    %rcx,%rsi
+     a9f:	89 c7                	mov    %eax,%edi
+     aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+     aa6:	e8 30 08 00 00       	call   12db <printf>
+     aab:	8b 05 0f 19 00 00    	mov    0x190f(%rip),%eax        # 23c0 <stdout>
+     ab1:	48 8d 15 98 14 00 00 	lea    0x1498(%rip),%rdx        # 1f50 <malloc+0x3f3>
+     ab8:	48 89 d6             	mov    %rdx,%rsi
+     abb:	89 c7                	mov    %eax,%edi
+     abd:	b8 00 00 00 00       	mov    $0x0,%eax
+     ac2:	e8 14 08 00 00       	call   12db <printf>
+     ac7:	8b 05 f3 18 00 00    	mov    0x18f3(%rip),%eax        # 23c0 <stdout>
+     acd:	48 8d 15 45 12 00 00 	lea    0x1245(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     ad4:	48 89 d6             	mov    %rdx,%rsi
+     ad7:	89 c7                	mov    %eax,%edi
+     ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+     ade:	e8 f8 07 00 00       	call   12db <printf>
+     ae3:	90                   	nop
+     ae4:	eb fd                	jmp    ae3 <hanguptest+0x107>
+  close(fds[0]);
+     ae6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     ae9:	89 c7                	mov    %eax,%edi
+     aeb:	e8 ba 0d 00 00       	call   18aa <close>
+
+  if(pipe(fds) < 0)
+     af0:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+     af4:	48 89 c7             	mov    %rax,%rdi
+     af7:	e8 96 0d 00 00       	call   1892 <pipe>
+     afc:	85 c0                	test   %eax,%eax
+     afe:	79 5c                	jns    b5c <hanguptest+0x180>
+    error("pipe failed");
+     b00:	8b 05 ba 18 00 00    	mov    0x18ba(%rip),%eax        # 23c0 <stdout>
+     b06:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     b0b:	48 8d 0d ce 11 00 00 	lea    0x11ce(%rip),%rcx        # 1ce0 <malloc+0x183>
+     b12:	48 89 ce             	mov    %rcx,%rsi
+     b15:	89 c7                	mov    %eax,%edi
+     b17:	b8 00 00 00 00       	mov    $0x0,%eax
+     b1c:	e8 ba 07 00 00       	call   12db <printf>
+     b21:	8b 05 99 18 00 00    	mov    0x1899(%rip),%eax        # 23c0 <stdout>
+     b27:	48 8d 15 f8 11 00 00 	lea    0x11f8(%rip),%rdx        # 1d26 <malloc+0x1c9>
+     b2e:	48 89 d6             	mov    %rdx,%rsi
+     b31:	89 c7                	mov    %eax,%edi
+     b33:	b8 00 00 00 00       	mov    $0x0,%eax
+     b38:	e8 9e 07 00 00       	call   12db <printf>
+     b3d:	8b 05 7d 18 00 00    	mov    0x187d(%rip),%eax        # 23c0 <stdout>
+     b43:	48 8d 15 cf 11 00 00 	lea    0x11cf(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     b4a:	48 89 d6             	mov    %rdx,%rsi
+     b4d:	89 c7                	mov    %eax,%edi
+     b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b54:	e8 82 07 00 00       	call   12db <printf>
+     b59:	90                   	nop
+     b5a:	eb fd                	jmp    b59 <hanguptest+0x17d>
+  close(fds[0]);
+     b5c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b5f:	89 c7                	mov    %eax,%edi
+     b61:	e8 44 0d 00 00       	call   18aa <close>
+  if(pollone(fds[1], POLLOUT) != POLLERR)
+     b66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b69:	be 04 00 00 00       	mov    $0x4,%esi
+     b6e:	89 c7                	mov    %eax,%edi
+     b70:	e8 8b f4 ff ff       	call   0 <pollone>
+     b75:	83 f8 08             	cmp    $0x8,%eax
+     b78:	74 5c                	je     bd6 <hanguptest+0x1fa>
+    error("closed read end does not show as POLLERR");
+     b7a:	8b 05 40 18 00 00    	mov    0x1840(%rip),%eax        # 23c0 <stdout>
+     b80:	ba 7f 00 00 00       	mov    $0x7f,%edx
+     b85:	48 8d 0d 54 11 00 00 	lea    0x1154(%rip),%rcx        # 1ce0 <malloc+0x183>
+     b8c:	48 89 ce             	mov    %rcx,%rsi
+     b8f:	89 c7                	mov    %eax,%edi
+     b91:	b8 00 00 00 00       	mov    $0x0,%eax
+     b96:	e8 40 07 00 00       	call   12db <printf>
+     b9b:	8b 05 1f 18 00 00    	mov    0x181f(%rip),%eax        # 23c0 <stdout>
+     ba1:	48 8d 15 d8 13 00 00 	lea    0x13d8(%rip),%rdx        # 1f80 <malloc+0x423>
+     ba8:	48 89 d6             	mov    %rdx,%rsi
+     bab:	89 c7                	mov    %eax,%edi
+     bad:	b8 00 00 00 00       	mov    $0x0,%eax
+     bb2:	e8 24 07 00 00       	call   12db <printf>
+     bb7:	8b 05 03 18 00 00    	mov    0x1803(%rip),%eax        # 23c0 <stdout>
+     bbd:	48 8d 15 55 11 00 00 	lea    0x1155(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     bc4:	48 89 d6             	mov    %rdx,%rsi
+     bc7:	89 c7                	mov    %eax,%edi
+     bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+     bce:	e8 08 07 00 00       	call   12db <printf>
+     bd3:	90                   	nop
+     bd4:	eb fd                	jmp    bd3 <hanguptest+0x1f7>
+  close(fds[1]);
+     bd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bd9:	89 c7                	mov    %eax,%edi
+     bdb:	e8 ca 0c 00 00       	call   18aa <close>
+  printf(stdout, "hanguptest OK\n");
+     be0:	8b 05 da 17 00 00    	mov    0x17da(%rip),%eax        # 23c0 <stdout>
+     be6:	48 8d 15 bc 13 00 00 	lea    0x13bc(%rip),%rdx        # 1fa9 <malloc+0x44c>
+     bed:	48 89 d6             	mov    %rdx,%rsi
+     bf0:	89 c7                	mov    %eax,%edi
+     bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf7:	e8 df 06 00 00       	call   12db <printf>
+}
+     bfc:	90                   	nop
+     bfd:	c9                   	leave
+     bfe:	c3                   	ret
+
+0000000000000bff <nvaltest>:
+
+// An fd that is not open is POLLNVAL, a negative one is skipped.
+void
+nvaltest(void)
+{
+     bff:	55                   	push   %rbp
+     c00:	48 89 e5             	mov    %rsp,%rbp
+     c03:	48 83 ec 10          	sub    $0x10,%rsp
+  struct pollfd pfds[2];
+
+  printf(stdout, "nvaltest\n");
+     c07:	8b 05 b3 17 00 00    	mov    0x17b3(%rip),%eax        # 23c0 <stdout>
+     c0d:	48 8d 15 a4 13 00 00 	lea    0x13a4(%rip),%rdx        # 1fb8 <malloc+0x45b>
+     c14:	48 89 d6             	mov    %rdx,%rsi
+     c17:	89 c7                	mov    %eax,%edi
+     c19:	b8 00 00 00 00       	mov    $0x0,%eax
+     c1e:	e8 b8 06 00 00       	call   12db <printf>
+  pfds[0].fd = 100;
+     c23:	c7 45 f0 64 00 00 00 	movl   $0x64,-0x10(%rbp)
+  pfds[0].events = POLLIN;
+     c2a:	66 c7 45 f4 01 00    	movw   $0x1,-0xc(%rbp)
+  pfds[1].fd = -1;
+     c30:	c7 45 f8 ff ff ff ff 	movl   $0xffffffff,-0x8(%rbp)
+  pfds[1].events = POLLIN;
+     c37:	66 c7 45 fc 01 00    	movw   $0x1,-0x4(%rbp)
+  if(poll(pfds, 2, 0) != 1)
+     c3d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     c41:	ba 00 00 00 00       	mov    $0x0,%edx
+     c46:	be 02 00 00 00       	mov    $0x2,%esi
+     c4b:	48 89 c7             	mov    %rax,%rdi
+     c4e:	e8 3e 0d 00 00       	call   1991 <poll>
+     c53:	83 f8 01             	cmp    $0x1,%eax
+     c56:	74 5c                	je     cb4 <nvaltest+0xb5>
+    error("poll did not count the closed fd");
+     c58:	8b 05 62 17 00 00    	mov    0x1762(%rip),%eax        # 23c0 <stdout>
+     c5e:	ba 90 00 00 00       	mov    $0x90,%edx
+     c63:	48 8d 0d 76 10 00 00 	lea    0x1076(%rip),%rcx        # 1ce0 <malloc+0x183>
+     c6a:	48 89 ce             	mov    %rcx,%rsi
+     c6d:	89 c7                	mov    %eax,%edi
+     c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+     c74:	e8 62 06 00 00       	call   12db <printf>
+     c79:	8b 05 41 17 00 00    	mov    0x1741(%rip),%eax        # 23c0 <stdout>
+     c7f:	48 8d 15 42 13 00 00 	lea    0x1342(%rip),%rdx        # 1fc8 <malloc+0x46b>
+     c86:	48 89 d6             	mov    %rdx,%rsi
+     c89:	89 c7                	mov    %eax,%edi
+     c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     c90:	e8 46 06 00 00       	call   12db <printf>
+     c95:	8b 05 25 17 00 00    	mov    0x1725(%rip),%eax        # 23c0 <stdout>
+     c9b:	48 8d 15 77 10 00 00 	lea    0x1077(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     ca2:	48 89 d6             	mov    %rdx,%rsi
+     ca5:	89 c7                	mov    %eax,%edi
+     ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+     cac:	e8 2a 06 00 00       	call   12db <printf>
+     cb1:	90                   	nop
+     cb2:	eb fd                	jmp    cb1 <nvaltest+0xb2>
+  if(pfds[0].revents != POLLNVAL || pfds[1].revents != 0)
+     cb4:	0f b7 45 f6          	movzwl -0xa(%rbp),%eax
+     cb8:	66 83 f8 20          	cmp    $0x20,%ax
+     cbc:	75 09                	jne    cc7 <nvaltest+0xc8>
+     cbe:	0f b7 45 fe          	movzwl -0x2(%rbp),%eax
+     cc2:	66 85 c0             	test   %ax,%ax
+     cc5:	74 67                	je     d2e <nvaltest+0x12f>
+    error("revents are %x and %x", pfds[0].revents, pfds[1].revents);
+     cc7:	8b 05 f3 16 00 00    	mov    0x16f3(%rip),%eax        # 23c0 <stdout>
+     ccd:	ba 92 00 00 00       	mov    $0x92,%edx
+     cd2:	48 8d 0d 07 10 00 00 	lea    0x1007(%rip),%rcx        # 1ce0 <malloc+0x183>
+     cd9:	48 89 ce             	mov    %rcx,%rsi
+     cdc:	89 c7                	mov    %eax,%edi
+     cde:	b8 00 00 00 00       	mov    $0x0,%eax
+     ce3:	e8 f3 05 00 00       	call   12db <printf>
+     ce8:	0f b7 45 fe          	movzwl -0x2(%rbp),%eax
+     cec:	0f bf c8             	movswl %ax,%ecx
+     cef:	0f b7 45 f6          	movzwl -0xa(%rbp),%eax
+     cf3:	0f bf d0             	movswl %ax,%edx
+     cf6:	8b 05 c4 16 00 00    	mov    0x16c4(%rip),%eax        # 23c0 <stdout>
+     cfc:	48 8d 35 e6 12 00 00 	lea    0x12e6(%rip),%rsi        # 1fe9 <malloc+0x48c>
+     d03:	89 c7                	mov    %eax,%edi
+     d05:	b8 00 00 00 00       	mov    $0x0,%eax
+     d0a:	e8 cc 05 00 00       	call   12db <printf>
+     d0f:	8b 05 ab 16 00 00    	mov    0x16ab(%rip),%eax        # 23c0 <stdout>
+     d15:	48 8d 15 fd 0f 00 00 	lea    0xffd(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     d1c:	48 89 d6             	mov    %rdx,%rsi
+     d1f:	89 c7                	mov    %eax,%edi
+     d21:	b8 00 00 00 00       	mov    $0x0,%eax
+     d26:	e8 b0 05 00 00       	call   12db <printf>
+     d2b:	90                   	nop
+     d2c:	eb fd                	jmp    d2b <nvaltest+0x12c>
+  printf(stdout, "nvaltest OK\n");
+     d2e:	8b 05 8c 16 00 00    	mov    0x168c(%rip),%eax        # 23c0 <stdout>
+     d34:	48 8d 15 c4 12 00 00 	lea    0x12c4(%rip),%rdx        # 1fff <malloc+0x4a2>
+     d3b:	48 89 d6             	mov    %rdx,%rsi
+     d3e:	89 c7                	mov    %eax,%edi
+     d40:	b8 00 00 00 00       	mov    $0x0,%eax
+     d45:	e8 91 05 00 00       	call   12db <printf>
+}
+     d4a:	90                   	nop
+     d4b:	c9                   	leave
+     d4c:	c3                   	ret
+
+0000000000000d4d <waittest>:
+
+// poll sleeps until one of several pipes has data, or its timeout.
+void
+waittest(void)
+{
+     d4d:	55                   	push   %rbp
+     d4e:	48 89 e5             	mov    %rsp,%rbp
+     d51:	48 83 ec 30          	sub    $0x30,%rsp
+  struct pollfd pfds[2];
+  int a[2], b[2], pid, start, n;
+
+  printf(stdout, "waittest\n");
+     d55:	8b 05 65 16 00 00    	mov    0x1665(%rip),%eax        # 23c0 <stdout>
+     d5b:	48 8d 15 aa 12 00 00 	lea    0x12aa(%rip),%rdx        # 200c <malloc+0x4af>
+     d62:	48 89 d6             	mov    %rdx,%rsi
+     d65:	89 c7                	mov    %eax,%edi
+     d67:	b8 00 00 00 00       	mov    $0x0,%eax
+     d6c:	e8 6a 05 00 00       	call   12db <printf>
+  if(pipe(a) < 0 || pipe(b) < 0)
+     d71:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     d75:	48 89 c7             	mov    %rax,%rdi
+     d78:	e8 15 0b 00 00       	call   1892 <pipe>
+     d7d:	85 c0                	test   %eax,%eax
+     d7f:	78 10                	js     d91 <waittest+0x44>
+     d81:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+     d85:	48 89 c7             	mov    %rax,%rdi
+     d88:	e8 05 0b 00 00       	call   1892 <pipe>
+     d8d:	85 c0                	test   %eax,%eax
+     d8f:	79 5c                	jns    ded <waittest+0xa0>
+    error("pipe failed");
+     d91:	8b 05 29 16 00 00    	mov    0x1629(%rip),%eax        # 23c0 <stdout>
+     d97:	ba 9f 00 00 00       	mov    $0x9f,%edx
+     d9c:	48 8d 0d 3d 0f 00 00 	lea    0xf3d(%rip),%rcx        # 1ce0 <malloc+0x183>
+     da3:	48 89 ce             	mov    %rcx,%rsi
+     da6:	89 c7                	mov    %eax,%edi
+     da8:	b8 00 00 00 00       	mov    $0x0,%eax
+     dad:	e8 29 05 00 00       	call   12db <printf>
+     db2:	8b 05 08 16 00 00    	mov    0x1608(%rip),%eax        # 23c0 <stdout>
+     db8:	48 8d 15 67 0f 00 00 	lea    0xf67(%rip),%rdx        # 1d26 <malloc+0x1c9>
+     dbf:	48 89 d6             	mov    %rdx,%rsi
+     dc2:	89 c7                	mov    %eax,%edi
+     dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc9:	e8 0d 05 00 00       	call   12db <printf>
+     dce:	8b 05 ec 15 00 00    	mov    0x15ec(%rip),%eax        # 23c0 <stdout>
+     dd4:	48 8d 15 3e 0f 00 00 	lea    0xf3e(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     ddb:	48 89 d6             	mov    %rdx,%rsi
+     dde:	89 c7                	mov    %eax,%edi
+     de0:	b8 00 00 00 00       	mov    $0x0,%eax
+     de5:	e8 f1 04 00 00       	call   12db <printf>
+     dea:	90                   	nop
+     deb:	eb fd                	jmp    dea <waittest+0x9d>
+  pfds[0].fd = a[0];
+     ded:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     df0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  pfds[0].events = POLLIN;
+     df3:	66 c7 45 e8 01 00    	movw   $0x1,-0x18(%rbp)
+  pfds[1].fd = b[0];
+     df9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     dfc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  pfds[1].events = POLLIN;
+     dff:	66 c7 45 f0 01 00    	movw   $0x1,-0x10(%rbp)
+
+  start = uptime();
+     e05:	e8 10 0b 00 00       	call   191a <uptime>
+     e0a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if((n = poll(pfds, 2, 10)) != 0)
+     e0d:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     e11:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e16:	be 02 00 00 00       	mov    $0x2,%esi
+     e1b:	48 89 c7             	mov    %rax,%rdi
+     e1e:	e8 6e 0b 00 00       	call   1991 <poll>
+     e23:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     e26:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     e2a:	74 5f                	je     e8b <waittest+0x13e>
+    error("poll of empty pipes returned %d", n);
+     e2c:	8b 05 8e 15 00 00    	mov    0x158e(%rip),%eax        # 23c0 <stdout>
+     e32:	ba a7 00 00 00       	mov    $0xa7,%edx
+     e37:	48 8d 0d a2 0e 00 00 	lea    0xea2(%rip),%rcx        # 1ce0 <malloc+0x183>
+     e3e:	48 89 ce             	mov    %rcx,%rsi
+     e41:	89 c7                	mov    %eax,%edi
+     e43:	b8 00 00 00 00       	mov    $0x0,%eax
+     e48:	e8 8e 04 00 00       	call   12db <printf>
+     e4d:	8b 05 6d 15 00 00    	mov    0x156d(%rip),%eax        # 23c0 <stdout>
+     e53:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     e56:	48 8d 0d bb 11 00 00 	lea    0x11bb(%rip),%rcx        # 2018 <malloc+0x4bb>
+     e5d:	48 89 ce             	mov    %rcx,%rsi
+     e60:	89 c7                	mov    %eax,%edi
+     e62:	b8 00 00 00 00       	mov    $0x0,%eax
+     e67:	e8 6f 04 00 00       	call   12db <printf>
+     e6c:	8b 05 4e 15 00 00    	mov    0x154e(%rip),%eax        # 23c0 <stdout>
+     e72:	48 8d 15 a0 0e 00 00 	lea    0xea0(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     e79:	48 89 d6             	mov    %rdx,%rsi
+     e7c:	89 c7                	mov    %eax,%edi
+     e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e83:	e8 53 04 00 00       	call   12db <printf>
+     e88:	90                   	nop
+     e89:	eb fd                	jmp    e88 <waittest+0x13b>
+  if(uptime() - start < 10)
+     e8b:	e8 8a 0a 00 00       	call   191a <uptime>
+     e90:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     e93:	83 f8 09             	cmp    $0x9,%eax
+     e96:	7f 5c                	jg     ef4 <waittest+0x1a7>
+    error("poll returned before its timeout");
+     e98:	8b 05 22 15 00 00    	mov    0x1522(%rip),%eax        # 23c0 <stdout>
+     e9e:	ba a9 00 00 00       	mov    $0xa9,%edx
+     ea3:	48 8d 0d 36 0e 00 00 	lea    0xe36(%rip),%rcx        # 1ce0 <malloc+0x183>
+     eaa:	48 89 ce             	mov    %rcx,%rsi
+     ead:	89 c7                	mov    %eax,%edi
+     eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+     eb4:	e8 22 04 00 00       	call   12db <printf>
+     eb9:	8b 05 01 15 00 00    	mov    0x1501(%rip),%eax        # 23c0 <stdout>
+     ebf:	48 8d 15 72 11 00 00 	lea    0x1172(%rip),%rdx        # 2038 <malloc+0x4db>
+     ec6:	48 89 d6             	mov    %rdx,%rsi
+     ec9:	89 c7                	mov    %eax,%edi
+     ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed0:	e8 06 04 00 00       	call   12db <printf>
+     ed5:	8b 05 e5 14 00 00    	mov    0x14e5(%rip),%eax        # 23c0 <stdout>
+     edb:	48 8d 15 37 0e 00 00 	lea    0xe37(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     ee2:	48 89 d6             	mov    %rdx,%rsi
+     ee5:	89 c7                	mov    %eax,%edi
+     ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+     eec:	e8 ea 03 00 00       	call   12db <printf>
+     ef1:	90                   	nop
+     ef2:	eb fd                	jmp    ef1 <waittest+0x1a4>
+
+  if((pid = fork()) < 0)
+     ef4:	e8 81 09 00 00       	call   187a <fork>
+     ef9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     efc:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     f00:	79 5c                	jns    f5e <waittest+0x211>
+    error("fork failed");
+     f02:	8b 05 b8 14 00 00    	mov    0x14b8(%rip),%eax        # 23c0 <stdout>
+     f08:	ba ac 00 00 00       	mov    $0xac,%edx
+     f0d:	48 8d 0d cc 0d 00 00 	lea    0xdcc(%rip),%rcx        # 1ce0 <malloc+0x183>
+     f14:	48 89 ce             	mov    %rcx,%rsi
+     f17:	89 c7                	mov    %eax,%edi
+     f19:	b8 00 00 00 00       	mov    $0x0,%eax
+     f1e:	e8 b8 03 00 00       	call   12db <printf>
+     f23:	8b 05 97 14 00 00    	mov    0x1497(%rip),%eax        # 23c0 <stdout>
+     f29:	48 8d 15 29 11 00 00 	lea    0x1129(%rip),%rdx        # 2059 <malloc+0x4fc>
+     f30:	48 89 d6             	mov    %rdx,%rsi
+     f33:	89 c7                	mov    %eax,%edi
+     f35:	b8 00 00 00 00       	mov    $0x0,%eax
+     f3a:	e8 9c 03 00 00       	call   12db <printf>
+     f3f:	8b 05 7b 14 00 00    	mov    0x147b(%rip),%eax        # 23c0 <stdout>
+     f45:	48 8d 15 cd 0d 00 00 	lea    0xdcd(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     f4c:	48 89 d6             	mov    %rdx,%rsi
+     f4f:	89 c7                	mov    %eax,%edi
+     f51:	b8 00 00 00 00       	mov    $0x0,%eax
+     f56:	e8 80 03 00 00       	call   12db <printf>
+     f5b:	90                   	nop
+     f5c:	eb fd                	jmp    f5b <waittest+0x20e>
+  if(pid == 0){
+     f5e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     f62:	75 28                	jne    f8c <waittest+0x23f>
+    sleep(5);
+     f64:	bf 05 00 00 00       	mov    $0x5,%edi
+     f69:	e8 a4 09 00 00       	call   1912 <sleep>
+    write(b[1], "b", 1);
+     f6e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     f71:	ba 01 00 00 00       	mov    $0x1,%edx
+     f76:	48 8d 0d e8 10 00 00 	lea    0x10e8(%rip),%rcx        # 2065 <malloc+0x508>
+     f7d:	48 89 ce             	mov    %rcx,%rsi
+     f80:	89 c7                	mov    %eax,%edi
+     f82:	e8 1b 09 00 00       	call   18a2 <write>
+    exit();
+     f87:	e8 f6 08 00 00       	call   1882 <exit>
+  }
+  if((n = poll(pfds, 2, -1)) != 1)
+     f8c:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+     f90:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+     f95:	be 02 00 00 00       	mov    $0x2,%esi
+     f9a:	48 89 c7             	mov    %rax,%rdi
+     f9d:	e8 ef 09 00 00       	call   1991 <poll>
+     fa2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     fa5:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+     fa9:	74 5f                	je     100a <waittest+0x2bd>
+    error("poll returned %d", n);
+     fab:	8b 05 0f 14 00 00    	mov    0x140f(%rip),%eax        # 23c0 <stdout>
+     fb1:	ba b3 00 00 00       	mov    $0xb3,%edx
+     fb6:	48 8d 0d 23 0d 00 00 	lea    0xd23(%rip),%rcx        # 1ce0 <malloc+0x183>
+     fbd:	48 89 ce             	mov    %rcx,%rsi
+     fc0:	89 c7                	mov    %eax,%edi
+     fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+     fc7:	e8 0f 03 00 00       	call   12db <printf>
+     fcc:	8b 05 ee 13 00 00    	mov    0x13ee(%rip),%eax        # 23c0 <stdout>
+     fd2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     fd5:	48 8d 0d 8b 10 00 00 	lea    0x108b(%rip),%rcx        # 2067 <malloc+0x50a>
+     fdc:	48 89 ce             	mov    %rcx,%rsi
+     fdf:	89 c7                	mov    %eax,%edi
+     fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe6:	e8 f0 02 00 00       	call   12db <printf>
+     feb:	8b 05 cf 13 00 00    	mov    0x13cf(%rip),%eax        # 23c0 <stdout>
+     ff1:	48 8d 15 21 0d 00 00 	lea    0xd21(%rip),%rdx        # 1d19 <malloc+0x1bc>
+     ff8:	48 89 d6             	mov    %rdx,%rsi
+     ffb:	89 c7                	mov    %eax,%edi
+     ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+    1002:	e8 d4 02 00 00       	call   12db <printf>
+    1007:	90                   	nop
+    1008:	eb fd                	jmp    1007 <waittest+0x2ba>
+  if(pfds[0].revents != 0 || pfds[1].revents != POLLIN)
+    100a:	0f b7 45 ea          	movzwl -0x16(%rbp),%eax
+    100e:	66 85 c0             	test   %ax,%ax
+    1011:	75 0a                	jne    101d <waittest+0x2d0>
+    1013:	0f b7 45 f2          	movzwl -0xe(%rbp),%eax
+    1017:	66 83 f8 01          	cmp    $0x1,%ax
+    101b:	74 67                	je     1084 <waittest+0x337>
+    error("revents are %x and %x", pfds[0].revents, pfds[1].revents);
+    101d:	8b 05 9d 13 00 00    	mov    0x139d(%rip),%eax        # 23c0 <stdout>
+    1023:	ba b5 00 00 00       	mov    $0xb5,%edx
+    1028:	48 8d 0d b1 0c 00 00 	lea    0xcb1(%rip),%rcx        # 1ce0 <malloc+0x183>
+    102f:	48 89 ce             	mov    %rcx,%rsi
+    1032:	89 c7                	mov    %eax,%edi
+    1034:	b8 00 00 00 00       	mov    $0x0,%eax
+    1039:	e8 9d 02 00 00       	call   12db <printf>
+    103e:	0f b7 45 f2          	movzwl -0xe(%rbp),%eax
+    1042:	0f bf c8             	movswl %ax,%ecx
+    1045:	0f b7 45 ea          	movzwl -0x16(%rbp),%eax
+    1049:	0f bf d0             	movswl %ax,%edx
+    104c:	8b 05 6e 13 00 00    	mov    0x136e(%rip),%eax        # 23c0 <stdout>
+    1052:	48 8d 35 90 0f 00 00 	lea    0xf90(%rip),%rsi        # 1fe9 <malloc+0x48c>
+    1059:	89 c7                	mov    %eax,%edi
+    105b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1060:	e8 76 02 00 00       	call   12db <printf>
+    1065:	8b 05 55 13 00 00    	mov    0x1355(%rip),%eax        # 23c0 <stdout>
+    106b:	48 8d 15 a7 0c 00 00 	lea    0xca7(%rip),%rdx        # 1d19 <malloc+0x1bc>
+    1072:	48 89 d6             	mov    %rdx,%rsi
+    1075:	89 c7                	mov    %eax,%edi
+    1077:	b8 00 00 00 00       	mov    $0x0,%eax
+    107c:	e8 5a 02 00 00       	call   12db <printf>
+    1081:	90                   	nop
+    1082:	eb fd                	jmp    1081 <waittest+0x334>
+  wait();
+    1084:	e8 01 08 00 00       	call   188a <wait>
+  close(a[0]);
+    1089:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    108c:	89 c7                	mov    %eax,%edi
+    108e:	e8 17 08 00 00       	call   18aa <close>
+  close(a[1]);
+    1093:	8b 45 e0             	mov    -0x20(%rbp),%eax
+    1096:	89 c7                	mov    %eax,%edi
+    1098:	e8 0d 08 00 00       	call   18aa <close>
+  close(b[0]);
+    109d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+    10a0:	89 c7                	mov    %eax,%edi
+    10a2:	e8 03 08 00 00       	call   18aa <close>
+  close(b[1]);
+    10a7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    10aa:	89 c7                	mov    %eax,%edi
+    10ac:	e8 f9 07 00 00       	call   18aa <close>
+  printf(stdout, "waittest OK\n");
+    10b1:	8b 05 09 13 00 00    	mov    0x1309(%rip),%eax        # 23c0 <stdout>
+    10b7:	48 8d 15 ba 0f 00 00 	lea    0xfba(%rip),%rdx        # 2078 <malloc+0x51b>
+    10be:	48 89 d6             	mov    %rdx,%rsi
+    10c1:	89 c7                	mov    %eax,%edi
+    10c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c8:	e8 0e 02 00 00       	call   12db <printf>
+}
+    10cd:	90                   	nop
+    10ce:	c9                   	leave
+    10cf:	c3                   	ret
+
+00000000000010d0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    10d0:	55                   	push   %rbp
+    10d1:	48 89 e5             	mov    %rsp,%rbp
+    10d4:	48 83 ec 10          	sub    $0x10,%rsp
+    10d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    10db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  readytest();
+    10df:	e8 d2 ef ff ff       	call   b6 <readytest>
+  nonblocktest();
+    10e4:	e8 42 f3 ff ff       	call   42b <nonblocktest>
+  hanguptest();
+    10e9:	e8 ee f8 ff ff       	call   9dc <hanguptest>
+  nvaltest();
+    10ee:	e8 0c fb ff ff       	call   bff <nvaltest>
+  waittest();
+    10f3:	e8 55 fc ff ff       	call   d4d <waittest>
+  printf(stdout, "polltest passed!!\n");
+    10f8:	8b 05 c2 12 00 00    	mov    0x12c2(%rip),%eax        # 23c0 <stdout>
+    10fe:	48 8d 15 80 0f 00 00 	lea    0xf80(%rip),%rdx        # 2085 <malloc+0x528>
+    1105:	48 89 d6             	mov    %rdx,%rsi
+    1108:	89 c7                	mov    %eax,%edi
+    110a:	b8 00 00 00 00       	mov    $0x0,%eax
+    110f:	e8 c7 01 00 00       	call   12db <printf>
+  exit();
+    1114:	e8 69 07 00 00       	call   1882 <exit>
+
+0000000000001119 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    1119:	55                   	push   %rbp
+    111a:	48 89 e5             	mov    %rsp,%rbp
+    111d:	48 83 ec 10          	sub    $0x10,%rsp
+    1121:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1124:	89 f0                	mov    %esi,%eax
+    1126:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    1129:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    112d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1130:	ba 01 00 00 00       	mov    $0x1,%edx
+    1135:	48 89 ce             	mov    %rcx,%rsi
+    1138:	89 c7                	mov    %eax,%edi
+    113a:	e8 63 07 00 00       	call   18a2 <write>
+}
+    113f:	90                   	nop
+    1140:	c9                   	leave
+    1141:	c3                   	ret
+
+0000000000001142 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    1142:	55                   	push   %rbp
+    1143:	48 89 e5             	mov    %rsp,%rbp
+    1146:	48 83 ec 40          	sub    $0x40,%rsp
+    114a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    114d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1150:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1153:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    1156:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    115a:	74 1f                	je     117b <printint64+0x39>
+    115c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    115f:	c1 e8 1f             	shr    $0x1f,%eax
+    1162:	0f b6 c0             	movzbl %al,%eax
+    1165:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1168:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    116c:	74 0d                	je     117b <printint64+0x39>
+    x = -xx;
+    116e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1171:	f7 d8                	neg    %eax
+    1173:	48 98                	cltq
+    1175:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1179:	eb 09                	jmp    1184 <printint64+0x42>
+  else
+    x = xx;
+    117b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    117e:	48 98                	cltq
+    1180:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1184:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    118b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    118e:	48 63 c8             	movslq %eax,%rcx
+    1191:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1195:	ba 00 00 00 00       	mov    $0x0,%edx
+    119a:	48 f7 f1             	div    %rcx
+    119d:	48 89 d1             	mov    %rdx,%rcx
+    11a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11a3:	8d 50 01             	lea    0x1(%rax),%edx
+    11a6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11a9:	48 8d 15 20 12 00 00 	lea    0x1220(%rip),%rdx        # 23d0 <digits.1>
+    11b0:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    11b4:	48 98                	cltq
+    11b6:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    11ba:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    11bd:	48 63 f0             	movslq %eax,%rsi
+    11c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    11c4:	ba 00 00 00 00       	mov    $0x0,%edx
+    11c9:	48 f7 f6             	div    %rsi
+    11cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    11d0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    11d5:	75 b4                	jne    118b <printint64+0x49>
+
+  if(sgn)
+    11d7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    11db:	74 2b                	je     1208 <printint64+0xc6>
+    buf[i++] = '-';
+    11dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11e0:	8d 50 01             	lea    0x1(%rax),%edx
+    11e3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    11e6:	48 98                	cltq
+    11e8:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    11ed:	eb 19                	jmp    1208 <printint64+0xc6>
+    putc(fd, buf[i]);
+    11ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11f2:	48 98                	cltq
+    11f4:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    11f9:	0f be d0             	movsbl %al,%edx
+    11fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    11ff:	89 d6                	mov    %edx,%esi
+    1201:	89 c7                	mov    %eax,%edi
+    1203:	e8 11 ff ff ff       	call   1119 <putc>
+  while(--i >= 0)
+    1208:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    120c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1210:	79 dd                	jns    11ef <printint64+0xad>
+}
+    1212:	90                   	nop
+    1213:	90                   	nop
+    1214:	c9                   	leave
+    1215:	c3                   	ret
+
+0000000000001216 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1216:	55                   	push   %rbp
+    1217:	48 89 e5             	mov    %rsp,%rbp
+    121a:	48 83 ec 30          	sub    $0x30,%rsp
+    121e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1221:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1224:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1227:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    122a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    1231:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1235:	74 17                	je     124e <printint+0x38>
+    1237:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    123b:	79 11                	jns    124e <printint+0x38>
+    neg = 1;
+    123d:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1244:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1247:	f7 d8                	neg    %eax
+    1249:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    124c:	eb 06                	jmp    1254 <printint+0x3e>
+  } else {
+    x = xx;
+    124e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1251:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1254:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    125b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    125e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1261:	ba 00 00 00 00       	mov    $0x0,%edx
+    1266:	f7 f1                	div    %ecx
+    1268:	89 d1                	mov    %edx,%ecx
+    126a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    126d:	8d 50 01             	lea    0x1(%rax),%edx
+    1270:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1273:	89 c9                	mov    %ecx,%ecx
+    1275:	48 8d 15 74 11 00 00 	lea    0x1174(%rip),%rdx        # 23f0 <digits.0>
+    127c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1280:	48 98                	cltq
+    1282:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1286:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1289:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    128c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1291:	f7 f6                	div    %esi
+    1293:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1296:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    129a:	75 bf                	jne    125b <printint+0x45>
+  if(neg)
+    129c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    12a0:	74 2b                	je     12cd <printint+0xb7>
+    buf[i++] = '-';
+    12a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12a5:	8d 50 01             	lea    0x1(%rax),%edx
+    12a8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    12ab:	48 98                	cltq
+    12ad:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    12b2:	eb 19                	jmp    12cd <printint+0xb7>
+    putc(fd, buf[i]);
+    12b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12b7:	48 98                	cltq
+    12b9:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    12be:	0f be d0             	movsbl %al,%edx
+    12c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    12c4:	89 d6                	mov    %edx,%esi
+    12c6:	89 c7                	mov    %eax,%edi
+    12c8:	e8 4c fe ff ff       	call   1119 <putc>
+  while(--i >= 0)
+    12cd:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    12d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    12d5:	79 dd                	jns    12b4 <printint+0x9e>
+}
+    12d7:	90                   	nop
+    12d8:	90                   	nop
+    12d9:	c9                   	leave
+    12da:	c3                   	ret
+
+00000000000012db <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    12db:	55                   	push   %rbp
+    12dc:	48 89 e5             	mov    %rsp,%rbp
+    12df:	48 83 ec 70          	sub    $0x70,%rsp
+    12e3:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    12e6:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    12ea:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    12ee:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    12f2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    12f6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    12fa:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1301:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1305:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1309:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    130d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1311:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1318:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    131f:	e9 6b 02 00 00       	jmp    158f <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1324:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1327:	48 63 d0             	movslq %eax,%rdx
+    132a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    132e:	48 01 d0             	add    %rdx,%rax
+    1331:	0f b6 00             	movzbl (%rax),%eax
+    1334:	0f be c0             	movsbl %al,%eax
+    1337:	25 ff 00 00 00       	and    $0xff,%eax
+    133c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    133f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1343:	75 30                	jne    1375 <printf+0x9a>
+      if(c == '%'){
+    1345:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1349:	75 13                	jne    135e <printf+0x83>
+        state = '%';
+    134b:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1352:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1359:	e9 2d 02 00 00       	jmp    158b <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    135e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1361:	0f be d0             	movsbl %al,%edx
+    1364:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1367:	89 d6                	mov    %edx,%esi
+    1369:	89 c7                	mov    %eax,%edi
+    136b:	e8 a9 fd ff ff       	call   1119 <putc>
+    1370:	e9 16 02 00 00       	jmp    158b <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    1375:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1379:	0f 85 0c 02 00 00    	jne    158b <printf+0x2b0>
+      if(c == 'l') {
+    137f:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1383:	75 0c                	jne    1391 <printf+0xb6>
+        lflag = 1;
+    1385:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    138c:	e9 fa 01 00 00       	jmp    158b <printf+0x2b0>
+      } else if(c == 'd'){
+    1391:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1395:	0f 85 95 00 00 00    	jne    1430 <printf+0x155>
+        if (lflag == 1)
+    139b:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    139f:	75 49                	jne    13ea <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    13a1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13a4:	83 f8 2f             	cmp    $0x2f,%eax
+    13a7:	77 17                	ja     13c0 <printf+0xe5>
+    13a9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13ad:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13b0:	89 d2                	mov    %edx,%edx
+    13b2:	48 01 d0             	add    %rdx,%rax
+    13b5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13b8:	83 c2 08             	add    $0x8,%edx
+    13bb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    13be:	eb 0c                	jmp    13cc <printf+0xf1>
+    13c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    13c4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    13c8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    13cc:	48 8b 00             	mov    (%rax),%rax
+    13cf:	89 c6                	mov    %eax,%esi
+    13d1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    13d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+    13d9:	ba 0a 00 00 00       	mov    $0xa,%edx
+    13de:	89 c7                	mov    %eax,%edi
+    13e0:	e8 5d fd ff ff       	call   1142 <printint64>
+    13e5:	e9 9a 01 00 00       	jmp    1584 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    13ea:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    13ed:	83 f8 2f             	cmp    $0x2f,%eax
+    13f0:	77 17                	ja     1409 <printf+0x12e>
+    13f2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    13f6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    13f9:	89 d2                	mov    %edx,%edx
+    13fb:	48 01 d0             	add    %rdx,%rax
+    13fe:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1401:	83 c2 08             	add    $0x8,%edx
+    1404:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1407:	eb 0c                	jmp    1415 <printf+0x13a>
+    1409:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    140d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1411:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1415:	8b 30                	mov    (%rax),%esi
+    1417:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    141a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    141f:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1424:	89 c7                	mov    %eax,%edi
+    1426:	e8 eb fd ff ff       	call   1216 <printint>
+    142b:	e9 54 01 00 00       	jmp    1584 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    1430:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1434:	74 0a                	je     1440 <printf+0x165>
+    1436:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    143a:	0f 85 95 00 00 00    	jne    14d5 <printf+0x1fa>
+        if (lflag == 1)
+    1440:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1444:	75 49                	jne    148f <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1446:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1449:	83 f8 2f             	cmp    $0x2f,%eax
+    144c:	77 17                	ja     1465 <printf+0x18a>
+    144e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1452:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1455:	89 d2                	mov    %edx,%edx
+    1457:	48 01 d0             	add    %rdx,%rax
+    145a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    145d:	83 c2 08             	add    $0x8,%edx
+    1460:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1463:	eb 0c                	jmp    1471 <printf+0x196>
+    1465:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1469:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    146d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1471:	48 8b 00             	mov    (%rax),%rax
+    1474:	89 c6                	mov    %eax,%esi
+    1476:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1479:	b9 00 00 00 00       	mov    $0x0,%ecx
+    147e:	ba 10 00 00 00       	mov    $0x10,%edx
+    1483:	89 c7                	mov    %eax,%edi
+    1485:	e8 b8 fc ff ff       	call   1142 <printint64>
+        if (lflag == 1)
+    148a:	e9 f5 00 00 00       	jmp    1584 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    148f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1492:	83 f8 2f             	cmp    $0x2f,%eax
+    1495:	77 17                	ja     14ae <printf+0x1d3>
+    1497:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    149b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    149e:	89 d2                	mov    %edx,%edx
+    14a0:	48 01 d0             	add    %rdx,%rax
+    14a3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14a6:	83 c2 08             	add    $0x8,%edx
+    14a9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    14ac:	eb 0c                	jmp    14ba <printf+0x1df>
+    14ae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    14b2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    14b6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    14ba:	8b 30                	mov    (%rax),%esi
+    14bc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    14c4:	ba 10 00 00 00       	mov    $0x10,%edx
+    14c9:	89 c7                	mov    %eax,%edi
+    14cb:	e8 46 fd ff ff       	call   1216 <printint>
+        if (lflag == 1)
+    14d0:	e9 af 00 00 00       	jmp    1584 <printf+0x2a9>
+      } else if(c == 's'){
+    14d5:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    14d9:	75 6e                	jne    1549 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    14db:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    14de:	83 f8 2f             	cmp    $0x2f,%eax
+    14e1:	77 17                	ja     14fa <printf+0x21f>
+    14e3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    14e7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14ea:	89 d2                	mov    %edx,%edx
+    14ec:	48 01 d0             	add    %rdx,%rax
+    14ef:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14f2:	83 c2 08             	add    $0x8,%edx
+    14f5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    14f8:	eb 0c                	jmp    1506 <printf+0x22b>
+    14fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    14fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1502:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1506:	48 8b 00             	mov    (%rax),%rax
+    1509:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    150d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1512:	75 28                	jne    153c <printf+0x261>
+          s = "(null)";
+    1514:	48 8d 05 7d 0b 00 00 	lea    0xb7d(%rip),%rax        # 2098 <malloc+0x53b>
+    151b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    151f:	eb 1b                	jmp    153c <printf+0x261>
+          putc(fd, *s);
+    1521:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1525:	0f b6 00             	movzbl (%rax),%eax
+    1528:	0f be d0             	movsbl %al,%edx
+    152b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    152e:	89 d6                	mov    %edx,%esi
+    1530:	89 c7                	mov    %eax,%edi
+    1532:	e8 e2 fb ff ff       	call   1119 <putc>
+        for(; *s; s++)
+    1537:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    153c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1540:	0f b6 00             	movzbl (%rax),%eax
+    1543:	84 c0                	test   %al,%al
+    1545:	75 da                	jne    1521 <printf+0x246>
+    1547:	eb 3b                	jmp    1584 <printf+0x2a9>
+      } else if(c == '%'){
+    1549:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    154d:	75 14                	jne    1563 <printf+0x288>
+        putc(fd, c);
+    154f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1552:	0f be d0             	movsbl %al,%edx
+    1555:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1558:	89 d6                	mov    %edx,%esi
+    155a:	89 c7                	mov    %eax,%edi
+    155c:	e8 b8 fb ff ff       	call   1119 <putc>
+    1561:	eb 21                	jmp    1584 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1563:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1566:	be 25 00 00 00       	mov    $0x25,%esi
+    156b:	89 c7                	mov    %eax,%edi
+    156d:	e8 a7 fb ff ff       	call   1119 <putc>
+        putc(fd, c);
+    1572:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1575:	0f be d0             	movsbl %al,%edx
+    1578:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    157b:	89 d6                	mov    %edx,%esi
+    157d:	89 c7                	mov    %eax,%edi
+    157f:	e8 95 fb ff ff       	call   1119 <putc>
+      }
+      state = 0;
+    1584:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    158b:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    158f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1592:	48 63 d0             	movslq %eax,%rdx
+    1595:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1599:	48 01 d0             	add    %rdx,%rax
+    159c:	0f b6 00             	movzbl (%rax),%eax
+    159f:	84 c0                	test   %al,%al
+    15a1:	0f 85 7d fd ff ff    	jne    1324 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    15a7:	90                   	nop
+    15a8:	90                   	nop
+    15a9:	c9                   	leave
+    15aa:	c3                   	ret
+
+00000000000015ab <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    15ab:	55                   	push   %rbp
+    15ac:	48 89 e5             	mov    %rsp,%rbp
+    15af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    15b3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    15b6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    15b9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    15bd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    15c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    15c3:	48 89 ce             	mov    %rcx,%rsi
+    15c6:	48 89 f7             	mov    %rsi,%rdi
+    15c9:	89 d1                	mov    %edx,%ecx
+    15cb:	fc                   	cld
+    15cc:	f3 aa                	rep stos %al,%es:(%rdi)
+    15ce:	89 ca                	mov    %ecx,%edx
+    15d0:	48 89 fe             	mov    %rdi,%rsi
+    15d3:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    15d7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    15da:	90                   	nop
+    15db:	5d                   	pop    %rbp
+    15dc:	c3                   	ret
+
+00000000000015dd <strcpy>:
+{
+    15dd:	55                   	push   %rbp
+    15de:	48 89 e5             	mov    %rsp,%rbp
+    15e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    15e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    15e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    15f1:	90                   	nop
+    15f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    15f6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    15fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    15fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1602:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1606:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    160a:	0f b6 12             	movzbl (%rdx),%edx
+    160d:	88 10                	mov    %dl,(%rax)
+    160f:	0f b6 00             	movzbl (%rax),%eax
+    1612:	84 c0                	test   %al,%al
+    1614:	75 dc                	jne    15f2 <strcpy+0x15>
+  return os;
+    1616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    161a:	5d                   	pop    %rbp
+    161b:	c3                   	ret
+
+000000000000161c <strcmp>:
+{
+    161c:	55                   	push   %rbp
+    161d:	48 89 e5             	mov    %rsp,%rbp
+    1620:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1624:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1628:	eb 0a                	jmp    1634 <strcmp+0x18>
+    p++, q++;
+    162a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    162f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1638:	0f b6 00             	movzbl (%rax),%eax
+    163b:	84 c0                	test   %al,%al
+    163d:	74 12                	je     1651 <strcmp+0x35>
+    163f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1643:	0f b6 10             	movzbl (%rax),%edx
+    1646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    164a:	0f b6 00             	movzbl (%rax),%eax
+    164d:	38 c2                	cmp    %al,%dl
+    164f:	74 d9                	je     162a <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1651:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1655:	0f b6 00             	movzbl (%rax),%eax
+    1658:	0f b6 d0             	movzbl %al,%edx
+    165b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    165f:	0f b6 00             	movzbl (%rax),%eax
+    1662:	0f b6 c0             	movzbl %al,%eax
+    1665:	29 c2                	sub    %eax,%edx
+    1667:	89 d0                	mov    %edx,%eax
+}
+    1669:	5d                   	pop    %rbp
+    166a:	c3                   	ret
+
+000000000000166b <strlen>:
+{
+    166b:	55                   	push   %rbp
+    166c:	48 89 e5             	mov    %rsp,%rbp
+    166f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1673:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    167a:	eb 04                	jmp    1680 <strlen+0x15>
+    167c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1680:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1683:	48 63 d0             	movslq %eax,%rdx
+    1686:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    168a:	48 01 d0             	add    %rdx,%rax
+    168d:	0f b6 00             	movzbl (%rax),%eax
+    1690:	84 c0                	test   %al,%al
+    1692:	75 e8                	jne    167c <strlen+0x11>
+  return n;
+    1694:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1697:	5d                   	pop    %rbp
+    1698:	c3                   	ret
+
+0000000000001699 <memset>:
+{
+    1699:	55                   	push   %rbp
+    169a:	48 89 e5             	mov    %rsp,%rbp
+    169d:	48 83 ec 10          	sub    $0x10,%rsp
+    16a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16a5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    16a8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    16ab:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    16ae:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    16b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b5:	89 ce                	mov    %ecx,%esi
+    16b7:	48 89 c7             	mov    %rax,%rdi
+    16ba:	e8 ec fe ff ff       	call   15ab <stosb>
+  return dst;
+    16bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    16c3:	c9                   	leave
+    16c4:	c3                   	ret
+
+00000000000016c5 <strchr>:
+{
+    16c5:	55                   	push   %rbp
+    16c6:	48 89 e5             	mov    %rsp,%rbp
+    16c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16cd:	89 f0                	mov    %esi,%eax
+    16cf:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    16d2:	eb 17                	jmp    16eb <strchr+0x26>
+    if(*s == c)
+    16d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16d8:	0f b6 00             	movzbl (%rax),%eax
+    16db:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    16de:	75 06                	jne    16e6 <strchr+0x21>
+      return (char*)s;
+    16e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16e4:	eb 15                	jmp    16fb <strchr+0x36>
+  for(; *s; s++)
+    16e6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    16eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16ef:	0f b6 00             	movzbl (%rax),%eax
+    16f2:	84 c0                	test   %al,%al
+    16f4:	75 de                	jne    16d4 <strchr+0xf>
+  return 0;
+    16f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    16fb:	5d                   	pop    %rbp
+    16fc:	c3                   	ret
+
+00000000000016fd <gets>:
+gets(char *buf, int max)
+{
+    16fd:	55                   	push   %rbp
+    16fe:	48 89 e5             	mov    %rsp,%rbp
+    1701:	48 83 ec 20          	sub    $0x20,%rsp
+    1705:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1709:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    170c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1713:	eb 48                	jmp    175d <gets+0x60>
+    cc = read(0, &c, 1);
+    1715:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1719:	ba 01 00 00 00       	mov    $0x1,%edx
+    171e:	48 89 c6             	mov    %rax,%rsi
+    1721:	bf 00 00 00 00       	mov    $0x0,%edi
+    1726:	e8 6f 01 00 00       	call   189a <read>
+    172b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    172e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1732:	7e 36                	jle    176a <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1734:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1737:	8d 50 01             	lea    0x1(%rax),%edx
+    173a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    173d:	48 63 d0             	movslq %eax,%rdx
+    1740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1744:	48 01 c2             	add    %rax,%rdx
+    1747:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    174b:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    174d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1751:	3c 0a                	cmp    $0xa,%al
+    1753:	74 16                	je     176b <gets+0x6e>
+    1755:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1759:	3c 0d                	cmp    $0xd,%al
+    175b:	74 0e                	je     176b <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    175d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1760:	83 c0 01             	add    $0x1,%eax
+    1763:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1766:	7f ad                	jg     1715 <gets+0x18>
+    1768:	eb 01                	jmp    176b <gets+0x6e>
+      break;
+    176a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    176b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    176e:	48 63 d0             	movslq %eax,%rdx
+    1771:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1775:	48 01 d0             	add    %rdx,%rax
+    1778:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    177b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    177f:	c9                   	leave
+    1780:	c3                   	ret
+
+0000000000001781 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1781:	55                   	push   %rbp
+    1782:	48 89 e5             	mov    %rsp,%rbp
+    1785:	48 83 ec 20          	sub    $0x20,%rsp
+    1789:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    178d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1791:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1795:	be 00 00 00 00       	mov    $0x0,%esi
+    179a:	48 89 c7             	mov    %rax,%rdi
+    179d:	e8 20 01 00 00       	call   18c2 <open>
+    17a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    17a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    17a9:	79 07                	jns    17b2 <stat+0x31>
+    return -1;
+    17ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    17b0:	eb 21                	jmp    17d3 <stat+0x52>
+  r = fstat(fd, st);
+    17b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    17b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17b9:	48 89 d6             	mov    %rdx,%rsi
+    17bc:	89 c7                	mov    %eax,%edi
+    17be:	e8 17 01 00 00       	call   18da <fstat>
+    17c3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    17c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17c9:	89 c7                	mov    %eax,%edi
+    17cb:	e8 da 00 00 00       	call   18aa <close>
+  return r;
+    17d0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    17d3:	c9                   	leave
+    17d4:	c3                   	ret
+
+00000000000017d5 <atoi>:
+
+int
+atoi(const char *s)
+{
+    17d5:	55                   	push   %rbp
+    17d6:	48 89 e5             	mov    %rsp,%rbp
+    17d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    17dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    17e4:	eb 28                	jmp    180e <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    17e6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    17e9:	89 d0                	mov    %edx,%eax
+    17eb:	c1 e0 02             	shl    $0x2,%eax
+    17ee:	01 d0                	add    %edx,%eax
+    17f0:	01 c0                	add    %eax,%eax
+    17f2:	89 c1                	mov    %eax,%ecx
+    17f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    17fc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1800:	0f b6 00             	movzbl (%rax),%eax
+    1803:	0f be c0             	movsbl %al,%eax
+    1806:	01 c8                	add    %ecx,%eax
+    1808:	83 e8 30             	sub    $0x30,%eax
+    180b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    180e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1812:	0f b6 00             	movzbl (%rax),%eax
+    1815:	3c 2f                	cmp    $0x2f,%al
+    1817:	7e 0b                	jle    1824 <atoi+0x4f>
+    1819:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    181d:	0f b6 00             	movzbl (%rax),%eax
+    1820:	3c 39                	cmp    $0x39,%al
+    1822:	7e c2                	jle    17e6 <atoi+0x11>
+  return n;
+    1824:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1827:	5d                   	pop    %rbp
+    1828:	c3                   	ret
+
+0000000000001829 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1829:	55                   	push   %rbp
+    182a:	48 89 e5             	mov    %rsp,%rbp
+    182d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1831:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1835:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    183c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1840:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1844:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1848:	eb 1d                	jmp    1867 <memmove+0x3e>
+    *dst++ = *src++;
+    184a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    184e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1852:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    185a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    185e:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1862:	0f b6 12             	movzbl (%rdx),%edx
+    1865:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1867:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    186a:	8d 50 ff             	lea    -0x1(%rax),%edx
+    186d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1870:	85 c0                	test   %eax,%eax
+    1872:	7f d6                	jg     184a <memmove+0x21>
+  return vdst;
+    1874:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1878:	5d                   	pop    %rbp
+    1879:	c3                   	ret
+
+000000000000187a <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    187a:	b8 01 00 00 00       	mov    $0x1,%eax
+    187f:	cd 40                	int    $0x40
+    1881:	c3                   	ret
+
+0000000000001882 <exit>:
+SYSCALL(exit)
+    1882:	b8 02 00 00 00       	mov    $0x2,%eax
+    1887:	cd 40                	int    $0x40
+    1889:	c3                   	ret
+
+000000000000188a <wait>:
+SYSCALL(wait)
+    188a:	b8 03 00 00 00       	mov    $0x3,%eax
+    188f:	cd 40                	int    $0x40
+    1891:	c3                   	ret
+
+0000000000001892 <pipe>:
+SYSCALL(pipe)
+    1892:	b8 04 00 00 00       	mov    $0x4,%eax
+    1897:	cd 40                	int    $0x40
+    1899:	c3                   	ret
+
+000000000000189a <read>:
+SYSCALL(read)
+    189a:	b8 05 00 00 00       	mov    $0x5,%eax
+    189f:	cd 40                	int    $0x40
+    18a1:	c3                   	ret
+
+00000000000018a2 <write>:
+SYSCALL(write)
+    18a2:	b8 10 00 00 00       	mov    $0x10,%eax
+    18a7:	cd 40                	int    $0x40
+    18a9:	c3                   	ret
+
+00000000000018aa <close>:
+SYSCALL(close)
+    18aa:	b8 15 00 00 00       	mov    $0x15,%eax
+    18af:	cd 40                	int    $0x40
+    18b1:	c3                   	ret
+
+00000000000018b2 <kill>:
+SYSCALL(kill)
+    18b2:	b8 06 00 00 00       	mov    $0x6,%eax
+    18b7:	cd 40                	int    $0x40
+    18b9:	c3                   	ret
+
+00000000000018ba <exec>:
+SYSCALL(exec)
+    18ba:	b8 07 00 00 00       	mov    $0x7,%eax
+    18bf:	cd 40                	int    $0x40
+    18c1:	c3                   	ret
+
+00000000000018c2 <open>:
+SYSCALL(open)
+    18c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+    18c7:	cd 40                	int    $0x40
+    18c9:	c3                   	ret
+
+00000000000018ca <mknod>:
+SYSCALL(mknod)
+    18ca:	b8 11 00 00 00       	mov    $0x11,%eax
+    18cf:	cd 40                	int    $0x40
+    18d1:	c3                   	ret
+
+00000000000018d2 <unlink>:
+SYSCALL(unlink)
+    18d2:	b8 12 00 00 00       	mov    $0x12,%eax
+    18d7:	cd 40                	int    $0x40
+    18d9:	c3                   	ret
+
+00000000000018da <fstat>:
+SYSCALL(fstat)
+    18da:	b8 08 00 00 00       	mov    $0x8,%eax
+    18df:	cd 40                	int    $0x40
+    18e1:	c3                   	ret
+
+00000000000018e2 <link>:
+SYSCALL(link)
+    18e2:	b8 13 00 00 00       	mov    $0x13,%eax
+    18e7:	cd 40                	int    $0x40
+    18e9:	c3                   	ret
+
+00000000000018ea <mkdir>:
+SYSCALL(mkdir)
+    18ea:	b8 14 00 00 00       	mov    $0x14,%eax
+    18ef:	cd 40                	int    $0x40
+    18f1:	c3                   	ret
+
+00000000000018f2 <chdir>:
+SYSCALL(chdir)
+    18f2:	b8 09 00 00 00       	mov    $0x9,%eax
+    18f7:	cd 40                	int    $0x40
+    18f9:	c3                   	ret
+
+00000000000018fa <dup>:
+SYSCALL(dup)
+    18fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+    18ff:	cd 40                	int    $0x40
+    1901:	c3                   	ret
+
+0000000000001902 <getpid>:
+SYSCALL(getpid)
+    1902:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1907:	cd 40                	int    $0x40
+    1909:	c3                   	ret
+
+000000000000190a <sbrk>:
+SYSCALL(sbrk)
+    190a:	b8 0c 00 00 00       	mov    $0xc,%eax
+    190f:	cd 40                	int    $0x40
+    1911:	c3                   	ret
+
+0000000000001912 <sleep>:
+SYSCALL(sleep)
+    1912:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1917:	cd 40                	int    $0x40
+    1919:	c3                   	ret
+
+000000000000191a <uptime>:
+SYSCALL(uptime)
+    191a:	b8 0e 00 00 00       	mov    $0xe,%eax
+    191f:	cd 40                	int    $0x40
+    1921:	c3                   	ret
+
+0000000000001922 <sysinfo>:
+SYSCALL(sysinfo)
+    1922:	b8 16 00 00 00       	mov    $0x16,%eax
+    1927:	cd 40                	int    $0x40
+    1929:	c3                   	ret
+
+000000000000192a <mmap>:
+SYSCALL(mmap)
+    192a:	b8 17 00 00 00       	mov    $0x17,%eax
+    192f:	cd 40                	int    $0x40
+    1931:	c3                   	ret
+
+0000000000001932 <munmap>:
+SYSCALL(munmap)
+    1932:	b8 18 00 00 00       	mov    $0x18,%eax
+    1937:	cd 40                	int    $0x40
+    1939:	c3                   	ret
+
+000000000000193a <crashn>:
+SYSCALL(crashn)
+    193a:	b8 19 00 00 00       	mov    $0x19,%eax
+    193f:	cd 40                	int    $0x40
+    1941:	c3                   	ret
+
+0000000000001942 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1942:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1947:	cd 40                	int    $0x40
+    1949:	83 f8 ff             	cmp    $0xffffffff,%eax
+    194c:	74 02                	je     1950 <mmap2+0xe>
+    194e:	89 c0                	mov    %eax,%eax
+    1950:	c3                   	ret
+
+0000000000001951 <munmap2>:
+SYSCALL(munmap2)
+    1951:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1956:	cd 40                	int    $0x40
+    1958:	c3                   	ret
+
+0000000000001959 <msync>:
+SYSCALL(msync)
+    1959:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    195e:	cd 40                	int    $0x40
+    1960:	c3                   	ret
+
+0000000000001961 <sendfile>:
+SYSCALL(sendfile)
+    1961:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1966:	cd 40                	int    $0x40
+    1968:	c3                   	ret
+
+0000000000001969 <splice>:
+SYSCALL(splice)
+    1969:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    196e:	cd 40                	int    $0x40
+    1970:	c3                   	ret
+
+0000000000001971 <pread>:
+SYSCALL(pread)
+    1971:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1976:	cd 40                	int    $0x40
+    1978:	c3                   	ret
+
+0000000000001979 <pwrite>:
+SYSCALL(pwrite)
+    1979:	b8 20 00 00 00       	mov    $0x20,%eax
+    197e:	cd 40                	int    $0x40
+    1980:	c3                   	ret
+
+0000000000001981 <readv>:
+SYSCALL(readv)
+    1981:	b8 21 00 00 00       	mov    $0x21,%eax
+    1986:	cd 40                	int    $0x40
+    1988:	c3                   	ret
+
+0000000000001989 <writev>:
+SYSCALL(writev)
+    1989:	b8 22 00 00 00       	mov    $0x22,%eax
+    198e:	cd 40                	int    $0x40
+    1990:	c3                   	ret
+
+0000000000001991 <poll>:
+SYSCALL(poll)
+    1991:	b8 23 00 00 00       	mov    $0x23,%eax
+    1996:	cd 40                	int    $0x40
+    1998:	c3                   	ret
+
+0000000000001999 <pipe2>:
+SYSCALL(pipe2)
+    1999:	b8 24 00 00 00       	mov    $0x24,%eax
+    199e:	cd 40                	int    $0x40
+    19a0:	c3                   	ret
+
+00000000000019a1 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    19a1:	55                   	push   %rbp
+    19a2:	48 89 e5             	mov    %rsp,%rbp
+    19a5:	48 83 ec 20          	sub    $0x20,%rsp
+    19a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    19ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    19b1:	48 83 e8 10          	sub    $0x10,%rax
+    19b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    19b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19bd:	48 8b 10             	mov    (%rax),%rdx
+    19c0:	48 8d 05 79 0a 00 00 	lea    0xa79(%rip),%rax        # 2440 <bigblock>
+    19c7:	48 39 c2             	cmp    %rax,%rdx
+    19ca:	75 1f                	jne    19eb <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    19cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19d0:	8b 40 08             	mov    0x8(%rax),%eax
+    19d3:	c1 e0 04             	shl    $0x4,%eax
+    19d6:	89 c2                	mov    %eax,%edx
+    19d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19dc:	89 d6                	mov    %edx,%esi
+    19de:	48 89 c7             	mov    %rax,%rdi
+    19e1:	e8 6b ff ff ff       	call   1951 <munmap2>
+    return;
+    19e6:	e9 0b 01 00 00       	jmp    1af6 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    19eb:	48 8b 05 3e 0a 00 00 	mov    0xa3e(%rip),%rax        # 2430 <freep>
+    19f2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    19f6:	eb 2f                	jmp    1a27 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    19f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19fc:	48 8b 00             	mov    (%rax),%rax
+    19ff:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a03:	72 17                	jb     1a1c <free+0x7b>
+    1a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a09:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a0d:	72 2f                	jb     1a3e <free+0x9d>
+    1a0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a13:	48 8b 00             	mov    (%rax),%rax
+    1a16:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a1a:	72 22                	jb     1a3e <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a20:	48 8b 00             	mov    (%rax),%rax
+    1a23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a2b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a2f:	73 c7                	jae    19f8 <free+0x57>
+    1a31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a35:	48 8b 00             	mov    (%rax),%rax
+    1a38:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1a3c:	73 ba                	jae    19f8 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1a3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a42:	8b 40 08             	mov    0x8(%rax),%eax
+    1a45:	89 c0                	mov    %eax,%eax
+    1a47:	48 c1 e0 04          	shl    $0x4,%rax
+    1a4b:	48 89 c2             	mov    %rax,%rdx
+    1a4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a52:	48 01 c2             	add    %rax,%rdx
+    1a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a59:	48 8b 00             	mov    (%rax),%rax
+    1a5c:	48 39 c2             	cmp    %rax,%rdx
+    1a5f:	75 2d                	jne    1a8e <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a65:	8b 50 08             	mov    0x8(%rax),%edx
+    1a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a6c:	48 8b 00             	mov    (%rax),%rax
+    1a6f:	8b 40 08             	mov    0x8(%rax),%eax
+    1a72:	01 c2                	add    %eax,%edx
+    1a74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a78:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1a7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a7f:	48 8b 00             	mov    (%rax),%rax
+    1a82:	48 8b 10             	mov    (%rax),%rdx
+    1a85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a89:	48 89 10             	mov    %rdx,(%rax)
+    1a8c:	eb 0e                	jmp    1a9c <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a92:	48 8b 10             	mov    (%rax),%rdx
+    1a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a99:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1a9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aa0:	8b 40 08             	mov    0x8(%rax),%eax
+    1aa3:	89 c0                	mov    %eax,%eax
+    1aa5:	48 c1 e0 04          	shl    $0x4,%rax
+    1aa9:	48 89 c2             	mov    %rax,%rdx
+    1aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ab0:	48 01 d0             	add    %rdx,%rax
+    1ab3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1ab7:	75 27                	jne    1ae0 <free+0x13f>
+    p->s.size += bp->s.size;
+    1ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1abd:	8b 50 08             	mov    0x8(%rax),%edx
+    1ac0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ac4:	8b 40 08             	mov    0x8(%rax),%eax
+    1ac7:	01 c2                	add    %eax,%edx
+    1ac9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1acd:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ad4:	48 8b 10             	mov    (%rax),%rdx
+    1ad7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1adb:	48 89 10             	mov    %rdx,(%rax)
+    1ade:	eb 0b                	jmp    1aeb <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1ae0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ae4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ae8:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1aeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aef:	48 89 05 3a 09 00 00 	mov    %rax,0x93a(%rip)        # 2430 <freep>
+}
+    1af6:	c9                   	leave
+    1af7:	c3                   	ret
+
+0000000000001af8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1af8:	55                   	push   %rbp
+    1af9:	48 89 e5             	mov    %rsp,%rbp
+    1afc:	48 83 ec 20          	sub    $0x20,%rsp
+    1b00:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1b03:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1b0a:	77 07                	ja     1b13 <morecore+0x1b>
+    nu = 4096;
+    1b0c:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1b13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b16:	c1 e0 04             	shl    $0x4,%eax
+    1b19:	89 c7                	mov    %eax,%edi
+    1b1b:	e8 ea fd ff ff       	call   190a <sbrk>
+    1b20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1b24:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1b29:	75 07                	jne    1b32 <morecore+0x3a>
+    return 0;
+    1b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b30:	eb 29                	jmp    1b5b <morecore+0x63>
+  hp = (Header*)p;
+    1b32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1b3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b3e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1b41:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b48:	48 83 c0 10          	add    $0x10,%rax
+    1b4c:	48 89 c7             	mov    %rax,%rdi
+    1b4f:	e8 4d fe ff ff       	call   19a1 <free>
+  return freep;
+    1b54:	48 8b 05 d5 08 00 00 	mov    0x8d5(%rip),%rax        # 2430 <freep>
+}
+    1b5b:	c9                   	leave
+    1b5c:	c3                   	ret
+
+0000000000001b5d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1b5d:	55                   	push   %rbp
+    1b5e:	48 89 e5             	mov    %rsp,%rbp
+    1b61:	48 83 ec 30          	sub    $0x30,%rsp
+    1b65:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1b68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b6b:	48 83 c0 0f          	add    $0xf,%rax
+    1b6f:	48 c1 e8 04          	shr    $0x4,%rax
+    1b73:	83 c0 01             	add    $0x1,%eax
+    1b76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1b79:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1b80:	76 62                	jbe    1be4 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1b82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1b85:	c1 e0 04             	shl    $0x4,%eax
+    1b88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1b8e:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1b94:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1b99:	ba 03 00 00 00       	mov    $0x3,%edx
+    1b9e:	89 c6                	mov    %eax,%esi
+    1ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+    1ba5:	e8 98 fd ff ff       	call   1942 <mmap2>
+    1baa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1bae:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1bb3:	75 0a                	jne    1bbf <malloc+0x62>
+      return 0;
+    1bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+    1bba:	e9 1c 01 00 00       	jmp    1cdb <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1bbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bc3:	48 8d 15 76 08 00 00 	lea    0x876(%rip),%rdx        # 2440 <bigblock>
+    1bca:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1bcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bd1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1bd4:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1bd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bdb:	48 83 c0 10          	add    $0x10,%rax
+    1bdf:	e9 f7 00 00 00       	jmp    1cdb <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1be4:	48 8b 05 45 08 00 00 	mov    0x845(%rip),%rax        # 2430 <freep>
+    1beb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1bef:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1bf4:	75 2e                	jne    1c24 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1bf6:	48 8d 05 23 08 00 00 	lea    0x823(%rip),%rax        # 2420 <base>
+    1bfd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1c01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c05:	48 89 05 24 08 00 00 	mov    %rax,0x824(%rip)        # 2430 <freep>
+    1c0c:	48 8b 05 1d 08 00 00 	mov    0x81d(%rip),%rax        # 2430 <freep>
+    1c13:	48 89 05 06 08 00 00 	mov    %rax,0x806(%rip)        # 2420 <base>
+    base.s.size = 0;
+    1c1a:	c7 05 04 08 00 00 00 	movl   $0x0,0x804(%rip)        # 2428 <base+0x8>
+    1c21:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1c24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c28:	48 8b 00             	mov    (%rax),%rax
+    1c2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1c2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c33:	8b 40 08             	mov    0x8(%rax),%eax
+    1c36:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1c39:	72 5f                	jb     1c9a <malloc+0x13d>
+      if(p->s.size == nunits)
+    1c3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c3f:	8b 40 08             	mov    0x8(%rax),%eax
+    1c42:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1c45:	75 10                	jne    1c57 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1c47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c4b:	48 8b 10             	mov    (%rax),%rdx
+    1c4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c52:	48 89 10             	mov    %rdx,(%rax)
+    1c55:	eb 2e                	jmp    1c85 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1c57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c5b:	8b 40 08             	mov    0x8(%rax),%eax
+    1c5e:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1c61:	89 c2                	mov    %eax,%edx
+    1c63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c67:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1c6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c6e:	8b 40 08             	mov    0x8(%rax),%eax
+    1c71:	89 c0                	mov    %eax,%eax
+    1c73:	48 c1 e0 04          	shl    $0x4,%rax
+    1c77:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c82:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1c85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c89:	48 89 05 a0 07 00 00 	mov    %rax,0x7a0(%rip)        # 2430 <freep>
+      return (void*)(p + 1);
+    1c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c94:	48 83 c0 10          	add    $0x10,%rax
+    1c98:	eb 41                	jmp    1cdb <malloc+0x17e>
+    }
+    if(p == freep)
+    1c9a:	48 8b 05 8f 07 00 00 	mov    0x78f(%rip),%rax        # 2430 <freep>
+    1ca1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1ca5:	75 1c                	jne    1cc3 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1ca7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1caa:	89 c7                	mov    %eax,%edi
+    1cac:	e8 47 fe ff ff       	call   1af8 <morecore>
+    1cb1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1cb5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1cba:	75 07                	jne    1cc3 <malloc+0x166>
+        return 0;
+    1cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+    1cc1:	eb 18                	jmp    1cdb <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1cc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ccb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ccf:	48 8b 00             	mov    (%rax),%rax
+    1cd2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1cd6:	e9 54 ff ff ff       	jmp    1c2f <malloc+0xd2>
+  }
+}
+    1cdb:	c9                   	leave
+    1cdc:	c3                   	ret
@@ -0,0 +1,2674 @@
+
+out/user/_preadtest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <makefile>:
+// Byte k of pread1.txt.
+#define BYTE(k) ((char)('A' + (k) % 53))
+
+void
+makefile(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, k;
+
+  if((fd = open("pread1.txt", O_CREATE | O_RDWR)) < 0)
+       8:	be 02 02 00 00       	mov    $0x202,%esi
+       d:	48 8d 05 84 1d 00 00 	lea    0x1d84(%rip),%rax        # 1d98 <malloc+0x183>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 5e 19 00 00       	call   197a <open>
+      1c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      1f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      23:	79 5c                	jns    81 <makefile+0x81>
+    error("unable to create pread1.txt");
+      25:	8b 05 95 23 00 00    	mov    0x2395(%rip),%eax        # 23c0 <stdout>
+      2b:	ba 1e 00 00 00       	mov    $0x1e,%edx
+      30:	48 8d 0d 6c 1d 00 00 	lea    0x1d6c(%rip),%rcx        # 1da3 <malloc+0x18e>
+      37:	48 89 ce             	mov    %rcx,%rsi
+      3a:	89 c7                	mov    %eax,%edi
+      3c:	b8 00 00 00 00       	mov    $0x0,%eax
+      41:	e8 4d 13 00 00       	call   1393 <printf>
+      46:	8b 05 74 23 00 00    	mov    0x2374(%rip),%eax        # 23c0 <stdout>
+      4c:	48 8d 15 62 1d 00 00 	lea    0x1d62(%rip),%rdx        # 1db5 <malloc+0x1a0>
+      53:	48 89 d6             	mov    %rdx,%rsi
+      56:	89 c7                	mov    %eax,%edi
+      58:	b8 00 00 00 00       	mov    $0x0,%eax
+      5d:	e8 31 13 00 00       	call   1393 <printf>
+      62:	8b 05 58 23 00 00    	mov    0x2358(%rip),%eax        # 23c0 <stdout>
+      68:	48 8d 15 62 1d 00 00 	lea    0x1d62(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+      6f:	48 89 d6             	mov    %rdx,%rsi
+      72:	89 c7                	mov    %eax,%edi
+      74:	b8 00 00 00 00       	mov    $0x0,%eax
+      79:	e8 15 13 00 00       	call   1393 <printf>
+      7e:	90                   	nop
+      7f:	eb fd                	jmp    7e <makefile+0x7e>
+  for(k = 0; k < FILESZ; k++)
+      81:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      88:	eb 3c                	jmp    c6 <makefile+0xc6>
+    buf[k] = BYTE(k);
+      8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8d:	48 63 d0             	movslq %eax,%rdx
+      90:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+      97:	48 c1 ea 20          	shr    $0x20,%rdx
+      9b:	c1 fa 04             	sar    $0x4,%edx
+      9e:	89 c1                	mov    %eax,%ecx
+      a0:	c1 f9 1f             	sar    $0x1f,%ecx
+      a3:	29 ca                	sub    %ecx,%edx
+      a5:	6b ca 35             	imul   $0x35,%edx,%ecx
+      a8:	29 c8                	sub    %ecx,%eax
+      aa:	89 c2                	mov    %eax,%edx
+      ac:	89 d0                	mov    %edx,%eax
+      ae:	83 c0 41             	add    $0x41,%eax
+      b1:	89 c1                	mov    %eax,%ecx
+      b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      b6:	48 98                	cltq
+      b8:	48 8d 15 a1 23 00 00 	lea    0x23a1(%rip),%rdx        # 2460 <buf>
+      bf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(k = 0; k < FILESZ; k++)
+      c2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      c6:	81 7d fc ff 1f 00 00 	cmpl   $0x1fff,-0x4(%rbp)
+      cd:	7e bb                	jle    8a <makefile+0x8a>
+  if(write(fd, buf, FILESZ) != FILESZ)
+      cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      d2:	ba 00 20 00 00       	mov    $0x2000,%edx
+      d7:	48 8d 0d 82 23 00 00 	lea    0x2382(%rip),%rcx        # 2460 <buf>
+      de:	48 89 ce             	mov    %rcx,%rsi
+      e1:	89 c7                	mov    %eax,%edi
+      e3:	e8 72 18 00 00       	call   195a <write>
+      e8:	3d 00 20 00 00       	cmp    $0x2000,%eax
+      ed:	74 5c                	je     14b <makefile+0x14b>
+    error("unable to write pread1.txt");
+      ef:	8b 05 cb 22 00 00    	mov    0x22cb(%rip),%eax        # 23c0 <stdout>
+      f5:	ba 22 00 00 00       	mov    $0x22,%edx
+      fa:	48 8d 0d a2 1c 00 00 	lea    0x1ca2(%rip),%rcx        # 1da3 <malloc+0x18e>
+     101:	48 89 ce             	mov    %rcx,%rsi
+     104:	89 c7                	mov    %eax,%edi
+     106:	b8 00 00 00 00       	mov    $0x0,%eax
+     10b:	e8 83 12 00 00       	call   1393 <printf>
+     110:	8b 05 aa 22 00 00    	mov    0x22aa(%rip),%eax        # 23c0 <stdout>
+     116:	48 8d 15 b6 1c 00 00 	lea    0x1cb6(%rip),%rdx        # 1dd3 <malloc+0x1be>
+     11d:	48 89 d6             	mov    %rdx,%rsi
+     120:	89 c7                	mov    %eax,%edi
+     122:	b8 00 00 00 00       	mov    $0x0,%eax
+     127:	e8 67 12 00 00       	call   1393 <printf>
+     12c:	8b 05 8e 22 00 00    	mov    0x228e(%rip),%eax        # 23c0 <stdout>
+     132:	48 8d 15 98 1c 00 00 	lea    0x1c98(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     139:	48 89 d6             	mov    %rdx,%rsi
+     13c:	89 c7                	mov    %eax,%edi
+     13e:	b8 00 00 00 00       	mov    $0x0,%eax
+     143:	e8 4b 12 00 00       	call   1393 <printf>
+     148:	90                   	nop
+     149:	eb fd                	jmp    148 <makefile+0x148>
+  close(fd);
+     14b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     14e:	89 c7                	mov    %eax,%edi
+     150:	e8 0d 18 00 00       	call   1962 <close>
+}
+     155:	90                   	nop
+     156:	c9                   	leave
+     157:	c3                   	ret
+
+0000000000000158 <offsettest>:
+
+// pread and pwrite work at the offset given and leave the file offset
+// alone.
+void
+offsettest(void)
+{
+     158:	55                   	push   %rbp
+     159:	48 89 e5             	mov    %rsp,%rbp
+     15c:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, n, fds[2];
+  char c;
+
+  printf(stdout, "offsettest\n");
+     160:	8b 05 5a 22 00 00    	mov    0x225a(%rip),%eax        # 23c0 <stdout>
+     166:	48 8d 15 81 1c 00 00 	lea    0x1c81(%rip),%rdx        # 1dee <malloc+0x1d9>
+     16d:	48 89 d6             	mov    %rdx,%rsi
+     170:	89 c7                	mov    %eax,%edi
+     172:	b8 00 00 00 00       	mov    $0x0,%eax
+     177:	e8 17 12 00 00       	call   1393 <printf>
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+     17c:	be 02 00 00 00       	mov    $0x2,%esi
+     181:	48 8d 05 10 1c 00 00 	lea    0x1c10(%rip),%rax        # 1d98 <malloc+0x183>
+     188:	48 89 c7             	mov    %rax,%rdi
+     18b:	e8 ea 17 00 00       	call   197a <open>
+     190:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     193:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     197:	79 5c                	jns    1f5 <offsettest+0x9d>
+    error("unable to open pread1.txt");
+     199:	8b 05 21 22 00 00    	mov    0x2221(%rip),%eax        # 23c0 <stdout>
+     19f:	ba 30 00 00 00       	mov    $0x30,%edx
+     1a4:	48 8d 0d f8 1b 00 00 	lea    0x1bf8(%rip),%rcx        # 1da3 <malloc+0x18e>
+     1ab:	48 89 ce             	mov    %rcx,%rsi
+     1ae:	89 c7                	mov    %eax,%edi
+     1b0:	b8 00 00 00 00       	mov    $0x0,%eax
+     1b5:	e8 d9 11 00 00       	call   1393 <printf>
+     1ba:	8b 05 00 22 00 00    	mov    0x2200(%rip),%eax        # 23c0 <stdout>
+     1c0:	48 8d 15 33 1c 00 00 	lea    0x1c33(%rip),%rdx        # 1dfa <malloc+0x1e5>
+     1c7:	48 89 d6             	mov    %rdx,%rsi
+     1ca:	89 c7                	mov    %eax,%edi
+     1cc:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d1:	e8 bd 11 00 00       	call   1393 <printf>
+     1d6:	8b 05 e4 21 00 00    	mov    0x21e4(%rip),%eax        # 23c0 <stdout>
+     1dc:	48 8d 15 ee 1b 00 00 	lea    0x1bee(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     1e3:	48 89 d6             	mov    %rdx,%rsi
+     1e6:	89 c7                	mov    %eax,%edi
+     1e8:	b8 00 00 00 00       	mov    $0x0,%eax
+     1ed:	e8 a1 11 00 00       	call   1393 <printf>
+     1f2:	90                   	nop
+     1f3:	eb fd                	jmp    1f2 <offsettest+0x9a>
+  if(read(fd, buf, 10) != 10)
+     1f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     1f8:	ba 0a 00 00 00       	mov    $0xa,%edx
+     1fd:	48 8d 0d 5c 22 00 00 	lea    0x225c(%rip),%rcx        # 2460 <buf>
+     204:	48 89 ce             	mov    %rcx,%rsi
+     207:	89 c7                	mov    %eax,%edi
+     209:	e8 44 17 00 00       	call   1952 <read>
+     20e:	83 f8 0a             	cmp    $0xa,%eax
+     211:	74 5c                	je     26f <offsettest+0x117>
+    error("unable to read pread1.txt");
+     213:	8b 05 a7 21 00 00    	mov    0x21a7(%rip),%eax        # 23c0 <stdout>
+     219:	ba 32 00 00 00       	mov    $0x32,%edx
+     21e:	48 8d 0d 7e 1b 00 00 	lea    0x1b7e(%rip),%rcx        # 1da3 <malloc+0x18e>
+     225:	48 89 ce             	mov    %rcx,%rsi
+     228:	89 c7                	mov    %eax,%edi
+     22a:	b8 00 00 00 00       	mov    $0x0,%eax
+     22f:	e8 5f 11 00 00       	call   1393 <printf>
+     234:	8b 05 86 21 00 00    	mov    0x2186(%rip),%eax        # 23c0 <stdout>
+     23a:	48 8d 15 d3 1b 00 00 	lea    0x1bd3(%rip),%rdx        # 1e14 <malloc+0x1ff>
+     241:	48 89 d6             	mov    %rdx,%rsi
+     244:	89 c7                	mov    %eax,%edi
+     246:	b8 00 00 00 00       	mov    $0x0,%eax
+     24b:	e8 43 11 00 00       	call   1393 <printf>
+     250:	8b 05 6a 21 00 00    	mov    0x216a(%rip),%eax        # 23c0 <stdout>
+     256:	48 8d 15 74 1b 00 00 	lea    0x1b74(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     25d:	48 89 d6             	mov    %rdx,%rsi
+     260:	89 c7                	mov    %eax,%edi
+     262:	b8 00 00 00 00       	mov    $0x0,%eax
+     267:	e8 27 11 00 00       	call   1393 <printf>
+     26c:	90                   	nop
+     26d:	eb fd                	jmp    26c <offsettest+0x114>
+
+  if((n = pread(fd, buf, 100, 5000)) != 100)
+     26f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     272:	b9 88 13 00 00       	mov    $0x1388,%ecx
+     277:	ba 64 00 00 00       	mov    $0x64,%edx
+     27c:	48 8d 35 dd 21 00 00 	lea    0x21dd(%rip),%rsi        # 2460 <buf>
+     283:	89 c7                	mov    %eax,%edi
+     285:	e8 9f 17 00 00       	call   1a29 <pread>
+     28a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     28d:	83 7d fc 64          	cmpl   $0x64,-0x4(%rbp)
+     291:	74 5f                	je     2f2 <offsettest+0x19a>
+    error("pread returned %d", n);
+     293:	8b 05 27 21 00 00    	mov    0x2127(%rip),%eax        # 23c0 <stdout>
+     299:	ba 35 00 00 00       	mov    $0x35,%edx
+     29e:	48 8d 0d fe 1a 00 00 	lea    0x1afe(%rip),%rcx        # 1da3 <malloc+0x18e>
+     2a5:	48 89 ce             	mov    %rcx,%rsi
+     2a8:	89 c7                	mov    %eax,%edi
+     2aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     2af:	e8 df 10 00 00       	call   1393 <printf>
+     2b4:	8b 05 06 21 00 00    	mov    0x2106(%rip),%eax        # 23c0 <stdout>
+     2ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     2bd:	48 8d 0d 6a 1b 00 00 	lea    0x1b6a(%rip),%rcx        # 1e2e <malloc+0x219>
+     2c4:	48 89 ce             	mov    %rcx,%rsi
+     2c7:	89 c7                	mov    %eax,%edi
+     2c9:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ce:	e8 c0 10 00 00       	call   1393 <printf>
+     2d3:	8b 05 e7 20 00 00    	mov    0x20e7(%rip),%eax        # 23c0 <stdout>
+     2d9:	48 8d 15 f1 1a 00 00 	lea    0x1af1(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     2e0:	48 89 d6             	mov    %rdx,%rsi
+     2e3:	89 c7                	mov    %eax,%edi
+     2e5:	b8 00 00 00 00       	mov    $0x0,%eax
+     2ea:	e8 a4 10 00 00       	call   1393 <printf>
+     2ef:	90                   	nop
+     2f0:	eb fd                	jmp    2ef <offsettest+0x197>
+  for(n = 0; n < 100; n++)
+     2f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     2f9:	e9 a4 00 00 00       	jmp    3a2 <offsettest+0x24a>
+    if(buf[n] != BYTE(5000 + n))
+     2fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     301:	48 98                	cltq
+     303:	48 8d 15 56 21 00 00 	lea    0x2156(%rip),%rdx        # 2460 <buf>
+     30a:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+     30e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     311:	05 88 13 00 00       	add    $0x1388,%eax
+     316:	48 63 d0             	movslq %eax,%rdx
+     319:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+     320:	48 c1 ea 20          	shr    $0x20,%rdx
+     324:	c1 fa 04             	sar    $0x4,%edx
+     327:	89 c1                	mov    %eax,%ecx
+     329:	c1 f9 1f             	sar    $0x1f,%ecx
+     32c:	29 ca                	sub    %ecx,%edx
+     32e:	6b ca 35             	imul   $0x35,%edx,%ecx
+     331:	29 c8                	sub    %ecx,%eax
+     333:	89 c2                	mov    %eax,%edx
+     335:	89 d0                	mov    %edx,%eax
+     337:	83 c0 41             	add    $0x41,%eax
+     33a:	40 38 c6             	cmp    %al,%sil
+     33d:	74 5f                	je     39e <offsettest+0x246>
+      error("byte %d of the pread is wrong", n);
+     33f:	8b 05 7b 20 00 00    	mov    0x207b(%rip),%eax        # 23c0 <stdout>
+     345:	ba 38 00 00 00       	mov    $0x38,%edx
+     34a:	48 8d 0d 52 1a 00 00 	lea    0x1a52(%rip),%rcx        # 1da3 <malloc+0x18e>
+     351:	48 89 ce             	mov    %rcx,%rsi
+     354:	89 c7                	mov    %eax,%edi
+     356:	b8 00 00 00 00       	mov    $0x0,%eax
+     35b:	e8 33 10 00 00       	call   1393 <printf>
+     360:	8b 05 5a 20 00 00    	mov    0x205a(%rip),%eax        # 23c0 <stdout>
+     366:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     369:	48 8d 0d d0 1a 00 00 	lea    0x1ad0(%rip),%rcx        # 1e40 <malloc+0x22b>
+     370:	48 89 ce             	mov    %rcx,%rsi
+     373:	89 c7                	mov    %eax,%edi
+     375:	b8 00 00 00 00       	mov    $0x0,%eax
+     37a:	e8 14 10 00 00       	call   1393 <printf>
+     37f:	8b 05 3b 20 00 00    	mov    0x203b(%rip),%eax        # 23c0 <stdout>
+     385:	48 8d 15 45 1a 00 00 	lea    0x1a45(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     38c:	48 89 d6             	mov    %rdx,%rsi
+     38f:	89 c7                	mov    %eax,%edi
+     391:	b8 00 00 00 00       	mov    $0x0,%eax
+     396:	e8 f8 0f 00 00       	call   1393 <printf>
+     39b:	90                   	nop
+     39c:	eb fd                	jmp    39b <offsettest+0x243>
+  for(n = 0; n < 100; n++)
+     39e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     3a2:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+     3a6:	0f 8e 52 ff ff ff    	jle    2fe <offsettest+0x1a6>
+  if((n = pread(fd, buf, 100, FILESZ - 30)) != 30)
+     3ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     3af:	b9 e2 1f 00 00       	mov    $0x1fe2,%ecx
+     3b4:	ba 64 00 00 00       	mov    $0x64,%edx
+     3b9:	48 8d 35 a0 20 00 00 	lea    0x20a0(%rip),%rsi        # 2460 <buf>
+     3c0:	89 c7                	mov    %eax,%edi
+     3c2:	e8 62 16 00 00       	call   1a29 <pread>
+     3c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     3ca:	83 7d fc 1e          	cmpl   $0x1e,-0x4(%rbp)
+     3ce:	74 5f                	je     42f <offsettest+0x2d7>
+    error("pread across the end of the file returned %d", n);
+     3d0:	8b 05 ea 1f 00 00    	mov    0x1fea(%rip),%eax        # 23c0 <stdout>
+     3d6:	ba 3a 00 00 00       	mov    $0x3a,%edx
+     3db:	48 8d 0d c1 19 00 00 	lea    0x19c1(%rip),%rcx        # 1da3 <malloc+0x18e>
+     3e2:	48 89 ce             	mov    %rcx,%rsi
+     3e5:	89 c7                	mov    %eax,%edi
+     3e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ec:	e8 a2 0f 00 00       	call   1393 <printf>
+     3f1:	8b 05 c9 1f 00 00    	mov    0x1fc9(%rip),%eax        # 23c0 <stdout>
+     3f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     3fa:	48 8d 0d 5f 1a 00 00 	lea    0x1a5f(%rip),%rcx        # 1e60 <malloc+0x24b>
+     401:	48 89 ce             	mov    %rcx,%rsi
+     404:	89 c7                	mov    %eax,%edi
+     406:	b8 00 00 00 00       	mov    $0x0,%eax
+     40b:	e8 83 0f 00 00       	call   1393 <printf>
+     410:	8b 05 aa 1f 00 00    	mov    0x1faa(%rip),%eax        # 23c0 <stdout>
+     416:	48 8d 15 b4 19 00 00 	lea    0x19b4(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     41d:	48 89 d6             	mov    %rdx,%rsi
+     420:	89 c7                	mov    %eax,%edi
+     422:	b8 00 00 00 00       	mov    $0x0,%eax
+     427:	e8 67 0f 00 00       	call   1393 <printf>
+     42c:	90                   	nop
+     42d:	eb fd                	jmp    42c <offsettest+0x2d4>
+  if((n = pread(fd, buf, 100, FILESZ)) != 0)
+     42f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     432:	b9 00 20 00 00       	mov    $0x2000,%ecx
+     437:	ba 64 00 00 00       	mov    $0x64,%edx
+     43c:	48 8d 35 1d 20 00 00 	lea    0x201d(%rip),%rsi        # 2460 <buf>
+     443:	89 c7                	mov    %eax,%edi
+     445:	e8 df 15 00 00       	call   1a29 <pread>
+     44a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     44d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     451:	74 5f                	je     4b2 <offsettest+0x35a>
+    error("pread at the end of the file returned %d", n);
+     453:	8b 05 67 1f 00 00    	mov    0x1f67(%rip),%eax        # 23c0 <stdout>
+     459:	ba 3c 00 00 00       	mov    $0x3c,%edx
+     45e:	48 8d 0d 3e 19 00 00 	lea    0x193e(%rip),%rcx        # 1da3 <malloc+0x18e>
+     465:	48 89 ce             	mov    %rcx,%rsi
+     468:	89 c7                	mov    %eax,%edi
+     46a:	b8 00 00 00 00       	mov    $0x0,%eax
+     46f:	e8 1f 0f 00 00       	call   1393 <printf>
+     474:	8b 05 46 1f 00 00    	mov    0x1f46(%rip),%eax        # 23c0 <stdout>
+     47a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     47d:	48 8d 0d 0c 1a 00 00 	lea    0x1a0c(%rip),%rcx        # 1e90 <malloc+0x27b>
+     484:	48 89 ce             	mov    %rcx,%rsi
+     487:	89 c7                	mov    %eax,%edi
+     489:	b8 00 00 00 00       	mov    $0x0,%eax
+     48e:	e8 00 0f 00 00       	call   1393 <printf>
+     493:	8b 05 27 1f 00 00    	mov    0x1f27(%rip),%eax        # 23c0 <stdout>
+     499:	48 8d 15 31 19 00 00 	lea    0x1931(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     4a0:	48 89 d6             	mov    %rdx,%rsi
+     4a3:	89 c7                	mov    %eax,%edi
+     4a5:	b8 00 00 00 00       	mov    $0x0,%eax
+     4aa:	e8 e4 0e 00 00       	call   1393 <printf>
+     4af:	90                   	nop
+     4b0:	eb fd                	jmp    4af <offsettest+0x357>
+
+  if(pwrite(fd, "#", 1, 3000) != 1)
+     4b2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     4b5:	b9 b8 0b 00 00       	mov    $0xbb8,%ecx
+     4ba:	ba 01 00 00 00       	mov    $0x1,%edx
+     4bf:	48 8d 35 f3 19 00 00 	lea    0x19f3(%rip),%rsi        # 1eb9 <malloc+0x2a4>
+     4c6:	89 c7                	mov    %eax,%edi
+     4c8:	e8 64 15 00 00       	call   1a31 <pwrite>
+     4cd:	83 f8 01             	cmp    $0x1,%eax
+     4d0:	74 5c                	je     52e <offsettest+0x3d6>
+    error("pwrite failed");
+     4d2:	8b 05 e8 1e 00 00    	mov    0x1ee8(%rip),%eax        # 23c0 <stdout>
+     4d8:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     4dd:	48 8d 0d bf 18 00 00 	lea    0x18bf(%rip),%rcx        # 1da3 <malloc+0x18e>
+     4e4:	48 89 ce             	mov    %rcx,%rsi
+     4e7:	89 c7                	mov    %eax,%edi
+     4e9:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ee:	e8 a0 0e 00 00       	call   1393 <printf>
+     4f3:	8b 05 c7 1e 00 00    	mov    0x1ec7(%rip),%eax        # 23c0 <stdout>
+     4f9:	48 8d 15 bb 19 00 00 	lea    0x19bb(%rip),%rdx        # 1ebb <malloc+0x2a6>
+     500:	48 89 d6             	mov    %rdx,%rsi
+     503:	89 c7                	mov    %eax,%edi
+     505:	b8 00 00 00 00       	mov    $0x0,%eax
+     50a:	e8 84 0e 00 00       	call   1393 <printf>
+     50f:	8b 05 ab 1e 00 00    	mov    0x1eab(%rip),%eax        # 23c0 <stdout>
+     515:	48 8d 15 b5 18 00 00 	lea    0x18b5(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     51c:	48 89 d6             	mov    %rdx,%rsi
+     51f:	89 c7                	mov    %eax,%edi
+     521:	b8 00 00 00 00       	mov    $0x0,%eax
+     526:	e8 68 0e 00 00       	call   1393 <printf>
+     52b:	90                   	nop
+     52c:	eb fd                	jmp    52b <offsettest+0x3d3>
+  if(pread(fd, &c, 1, 3000) != 1 || c != '#')
+     52e:	48 8d 75 ef          	lea    -0x11(%rbp),%rsi
+     532:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     535:	b9 b8 0b 00 00       	mov    $0xbb8,%ecx
+     53a:	ba 01 00 00 00       	mov    $0x1,%edx
+     53f:	89 c7                	mov    %eax,%edi
+     541:	e8 e3 14 00 00       	call   1a29 <pread>
+     546:	83 f8 01             	cmp    $0x1,%eax
+     549:	75 08                	jne    553 <offsettest+0x3fb>
+     54b:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+     54f:	3c 23                	cmp    $0x23,%al
+     551:	74 5c                	je     5af <offsettest+0x457>
+    error("pwrite did not reach the file");
+     553:	8b 05 67 1e 00 00    	mov    0x1e67(%rip),%eax        # 23c0 <stdout>
+     559:	ba 41 00 00 00       	mov    $0x41,%edx
+     55e:	48 8d 0d 3e 18 00 00 	lea    0x183e(%rip),%rcx        # 1da3 <malloc+0x18e>
+     565:	48 89 ce             	mov    %rcx,%rsi
+     568:	89 c7                	mov    %eax,%edi
+     56a:	b8 00 00 00 00       	mov    $0x0,%eax
+     56f:	e8 1f 0e 00 00       	call   1393 <printf>
+     574:	8b 05 46 1e 00 00    	mov    0x1e46(%rip),%eax        # 23c0 <stdout>
+     57a:	48 8d 15 48 19 00 00 	lea    0x1948(%rip),%rdx        # 1ec9 <malloc+0x2b4>
+     581:	48 89 d6             	mov    %rdx,%rsi
+     584:	89 c7                	mov    %eax,%edi
+     586:	b8 00 00 00 00       	mov    $0x0,%eax
+     58b:	e8 03 0e 00 00       	call   1393 <printf>
+     590:	8b 05 2a 1e 00 00    	mov    0x1e2a(%rip),%eax        # 23c0 <stdout>
+     596:	48 8d 15 34 18 00 00 	lea    0x1834(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     59d:	48 89 d6             	mov    %rdx,%rsi
+     5a0:	89 c7                	mov    %eax,%edi
+     5a2:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a7:	e8 e7 0d 00 00       	call   1393 <printf>
+     5ac:	90                   	nop
+     5ad:	eb fd                	jmp    5ac <offsettest+0x454>
+  c = BYTE(3000);
+     5af:	c6 45 ef 61          	movb   $0x61,-0x11(%rbp)
+  if(pwrite(fd, &c, 1, 3000) != 1)
+     5b3:	48 8d 75 ef          	lea    -0x11(%rbp),%rsi
+     5b7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     5ba:	b9 b8 0b 00 00       	mov    $0xbb8,%ecx
+     5bf:	ba 01 00 00 00       	mov    $0x1,%edx
+     5c4:	89 c7                	mov    %eax,%edi
+     5c6:	e8 66 14 00 00       	call   1a31 <pwrite>
+     5cb:	83 f8 01             	cmp    $0x1,%eax
+     5ce:	74 5c                	je     62c <offsettest+0x4d4>
+    error("pwrite failed");
+     5d0:	8b 05 ea 1d 00 00    	mov    0x1dea(%rip),%eax        # 23c0 <stdout>
+     5d6:	ba 44 00 00 00       	mov    $0x44,%edx
+     5db:	48 8d 0d c1 17 00 00 	lea    0x17c1(%rip),%rcx        # 1da3 <malloc+0x18e>
+     5e2:	48 89 ce             	mov    %rcx,%rsi
+     5e5:	89 c7                	mov    %eax,%edi
+     5e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5ec:	e8 a2 0d 00 00       	call   1393 <printf>
+     5f1:	8b 05 c9 1d 00 00    	mov    0x1dc9(%rip),%eax        # 23c0 <stdout>
+     5f7:	48 8d 15 bd 18 00 00 	lea    0x18bd(%rip),%rdx        # 1ebb <malloc+0x2a6>
+     5fe:	48 89 d6             	mov    %rdx,%rsi
+     601:	89 c7                	mov    %eax,%edi
+     603:	b8 00 00 00 00       	mov    $0x0,%eax
+     608:	e8 86 0d 00 00       	call   1393 <printf>
+     60d:	8b 05 ad 1d 00 00    	mov    0x1dad(%rip),%eax        # 23c0 <stdout>
+     613:	48 8d 15 b7 17 00 00 	lea    0x17b7(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     61a:	48 89 d6             	mov    %rdx,%rsi
+     61d:	89 c7                	mov    %eax,%edi
+     61f:	b8 00 00 00 00       	mov    $0x0,%eax
+     624:	e8 6a 0d 00 00       	call   1393 <printf>
+     629:	90                   	nop
+     62a:	eb fd                	jmp    629 <offsettest+0x4d1>
+
+  // the file offset is still where read left it
+  if(read(fd, &c, 1) != 1 || c != BYTE(10))
+     62c:	48 8d 4d ef          	lea    -0x11(%rbp),%rcx
+     630:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     633:	ba 01 00 00 00       	mov    $0x1,%edx
+     638:	48 89 ce             	mov    %rcx,%rsi
+     63b:	89 c7                	mov    %eax,%edi
+     63d:	e8 10 13 00 00       	call   1952 <read>
+     642:	83 f8 01             	cmp    $0x1,%eax
+     645:	75 08                	jne    64f <offsettest+0x4f7>
+     647:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+     64b:	3c 4b                	cmp    $0x4b,%al
+     64d:	74 5c                	je     6ab <offsettest+0x553>
+    error("pread or pwrite moved the file offset");
+     64f:	8b 05 6b 1d 00 00    	mov    0x1d6b(%rip),%eax        # 23c0 <stdout>
+     655:	ba 48 00 00 00       	mov    $0x48,%edx
+     65a:	48 8d 0d 42 17 00 00 	lea    0x1742(%rip),%rcx        # 1da3 <malloc+0x18e>
+     661:	48 89 ce             	mov    %rcx,%rsi
+     664:	89 c7                	mov    %eax,%edi
+     666:	b8 00 00 00 00       	mov    $0x0,%eax
+     66b:	e8 23 0d 00 00       	call   1393 <printf>
+     670:	8b 05 4a 1d 00 00    	mov    0x1d4a(%rip),%eax        # 23c0 <stdout>
+     676:	48 8d 15 6b 18 00 00 	lea    0x186b(%rip),%rdx        # 1ee8 <malloc+0x2d3>
+     67d:	48 89 d6             	mov    %rdx,%rsi
+     680:	89 c7                	mov    %eax,%edi
+     682:	b8 00 00 00 00       	mov    $0x0,%eax
+     687:	e8 07 0d 00 00       	call   1393 <printf>
+     68c:	8b 05 2e 1d 00 00    	mov    0x1d2e(%rip),%eax        # 23c0 <stdout>
+     692:	48 8d 15 38 17 00 00 	lea    0x1738(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     699:	48 89 d6             	mov    %rdx,%rsi
+     69c:	89 c7                	mov    %eax,%edi
+     69e:	b8 00 00 00 00       	mov    $0x0,%eax
+     6a3:	e8 eb 0c 00 00       	call   1393 <printf>
+     6a8:	90                   	nop
+     6a9:	eb fd                	jmp    6a8 <offsettest+0x550>
+
+  if(pipe(fds) < 0)
+     6ab:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     6af:	48 89 c7             	mov    %rax,%rdi
+     6b2:	e8 93 12 00 00       	call   194a <pipe>
+     6b7:	85 c0                	test   %eax,%eax
+     6b9:	79 5c                	jns    717 <offsettest+0x5bf>
+    error("pipe failed");
+     6bb:	8b 05 ff 1c 00 00    	mov    0x1cff(%rip),%eax        # 23c0 <stdout>
+     6c1:	ba 4b 00 00 00       	mov    $0x4b,%edx
+     6c6:	48 8d 0d d6 16 00 00 	lea    0x16d6(%rip),%rcx        # 1da3 <malloc+0x18e>
+     6cd:	48 89 ce             	mov    %rcx,%rsi
+     6d0:	89 c7                	mov    %eax,%edi
+     6d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d7:	e8 b7 0c 00 00       	call   1393 <printf>
+     6dc:	8b 05 de 1c 00 00    	mov    0x1cde(%rip),%eax        # 23c0 <stdout>
+     6e2:	48 8d 15 25 18 00 00 	lea    0x1825(%rip),%rdx        # 1f0e <malloc+0x2f9>
+     6e9:	48 89 d6             	mov    %rdx,%rsi
+     6ec:	89 c7                	mov    %eax,%edi
+     6ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f3:	e8 9b 0c 00 00       	call   1393 <printf>
+     6f8:	8b 05 c2 1c 00 00    	mov    0x1cc2(%rip),%eax        # 23c0 <stdout>
+     6fe:	48 8d 15 cc 16 00 00 	lea    0x16cc(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     705:	48 89 d6             	mov    %rdx,%rsi
+     708:	89 c7                	mov    %eax,%edi
+     70a:	b8 00 00 00 00       	mov    $0x0,%eax
+     70f:	e8 7f 0c 00 00       	call   1393 <printf>
+     714:	90                   	nop
+     715:	eb fd                	jmp    714 <offsettest+0x5bc>
+  if(pread(fds[0], buf, 1, 0) != -1 || pwrite(fds[1], "x", 1, 0) != -1)
+     717:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     71a:	b9 00 00 00 00       	mov    $0x0,%ecx
+     71f:	ba 01 00 00 00       	mov    $0x1,%edx
+     724:	48 8d 35 35 1d 00 00 	lea    0x1d35(%rip),%rsi        # 2460 <buf>
+     72b:	89 c7                	mov    %eax,%edi
+     72d:	e8 f7 12 00 00       	call   1a29 <pread>
+     732:	83 f8 ff             	cmp    $0xffffffff,%eax
+     735:	75 20                	jne    757 <offsettest+0x5ff>
+     737:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     73a:	b9 00 00 00 00       	mov    $0x0,%ecx
+     73f:	ba 01 00 00 00       	mov    $0x1,%edx
+     744:	48 8d 35 cf 17 00 00 	lea    0x17cf(%rip),%rsi        # 1f1a <malloc+0x305>
+     74b:	89 c7                	mov    %eax,%edi
+     74d:	e8 df 12 00 00       	call   1a31 <pwrite>
+     752:	83 f8 ff             	cmp    $0xffffffff,%eax
+     755:	74 5c                	je     7b3 <offsettest+0x65b>
+    error("pread or pwrite on a pipe did not fail");
+     757:	8b 05 63 1c 00 00    	mov    0x1c63(%rip),%eax        # 23c0 <stdout>
+     75d:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     762:	48 8d 0d 3a 16 00 00 	lea    0x163a(%rip),%rcx        # 1da3 <malloc+0x18e>
+     769:	48 89 ce             	mov    %rcx,%rsi
+     76c:	89 c7                	mov    %eax,%edi
+     76e:	b8 00 00 00 00       	mov    $0x0,%eax
+     773:	e8 1b 0c 00 00       	call   1393 <printf>
+     778:	8b 05 42 1c 00 00    	mov    0x1c42(%rip),%eax        # 23c0 <stdout>
+     77e:	48 8d 15 9b 17 00 00 	lea    0x179b(%rip),%rdx        # 1f20 <malloc+0x30b>
+     785:	48 89 d6             	mov    %rdx,%rsi
+     788:	89 c7                	mov    %eax,%edi
+     78a:	b8 00 00 00 00       	mov    $0x0,%eax
+     78f:	e8 ff 0b 00 00       	call   1393 <printf>
+     794:	8b 05 26 1c 00 00    	mov    0x1c26(%rip),%eax        # 23c0 <stdout>
+     79a:	48 8d 15 30 16 00 00 	lea    0x1630(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     7a1:	48 89 d6             	mov    %rdx,%rsi
+     7a4:	89 c7                	mov    %eax,%edi
+     7a6:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ab:	e8 e3 0b 00 00       	call   1393 <printf>
+     7b0:	90                   	nop
+     7b1:	eb fd                	jmp    7b0 <offsettest+0x658>
+  close(fds[0]);
+     7b3:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     7b6:	89 c7                	mov    %eax,%edi
+     7b8:	e8 a5 11 00 00       	call   1962 <close>
+  close(fds[1]);
+     7bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     7c0:	89 c7                	mov    %eax,%edi
+     7c2:	e8 9b 11 00 00       	call   1962 <close>
+  close(fd);
+     7c7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     7ca:	89 c7                	mov    %eax,%edi
+     7cc:	e8 91 11 00 00       	call   1962 <close>
+  printf(stdout, "offsettest OK\n");
+     7d1:	8b 05 e9 1b 00 00    	mov    0x1be9(%rip),%eax        # 23c0 <stdout>
+     7d7:	48 8d 15 69 17 00 00 	lea    0x1769(%rip),%rdx        # 1f47 <malloc+0x332>
+     7de:	48 89 d6             	mov    %rdx,%rsi
+     7e1:	89 c7                	mov    %eax,%edi
+     7e3:	b8 00 00 00 00       	mov    $0x0,%eax
+     7e8:	e8 a6 0b 00 00       	call   1393 <printf>
+}
+     7ed:	90                   	nop
+     7ee:	c9                   	leave
+     7ef:	c3                   	ret
+
+00000000000007f0 <vectortest>:
+
+// readv and writev go through their buffers in order.
+void
+vectortest(void)
+{
+     7f0:	55                   	push   %rbp
+     7f1:	48 89 e5             	mov    %rsp,%rbp
+     7f4:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  struct iovec iov[IOV_MAX + 1];
+  char a[10], b[1], c[300];
+  int fd, n, i;
+
+  printf(stdout, "vectortest\n");
+     7fb:	8b 05 bf 1b 00 00    	mov    0x1bbf(%rip),%eax        # 23c0 <stdout>
+     801:	48 8d 15 4e 17 00 00 	lea    0x174e(%rip),%rdx        # 1f56 <malloc+0x341>
+     808:	48 89 d6             	mov    %rdx,%rsi
+     80b:	89 c7                	mov    %eax,%edi
+     80d:	b8 00 00 00 00       	mov    $0x0,%eax
+     812:	e8 7c 0b 00 00       	call   1393 <printf>
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+     817:	be 02 00 00 00       	mov    $0x2,%esi
+     81c:	48 8d 05 75 15 00 00 	lea    0x1575(%rip),%rax        # 1d98 <malloc+0x183>
+     823:	48 89 c7             	mov    %rax,%rdi
+     826:	e8 4f 11 00 00       	call   197a <open>
+     82b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     82e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     832:	79 5c                	jns    890 <vectortest+0xa0>
+    error("unable to open pread1.txt");
+     834:	8b 05 86 1b 00 00    	mov    0x1b86(%rip),%eax        # 23c0 <stdout>
+     83a:	ba 5e 00 00 00       	mov    $0x5e,%edx
+     83f:	48 8d 0d 5d 15 00 00 	lea    0x155d(%rip),%rcx        # 1da3 <malloc+0x18e>
+     846:	48 89 ce             	mov    %rcx,%rsi
+     849:	89 c7                	mov    %eax,%edi
+     84b:	b8 00 00 00 00       	mov    $0x0,%eax
+     850:	e8 3e 0b 00 00       	call   1393 <printf>
+     855:	8b 05 65 1b 00 00    	mov    0x1b65(%rip),%eax        # 23c0 <stdout>
+     85b:	48 8d 15 98 15 00 00 	lea    0x1598(%rip),%rdx        # 1dfa <malloc+0x1e5>
+     862:	48 89 d6             	mov    %rdx,%rsi
+     865:	89 c7                	mov    %eax,%edi
+     867:	b8 00 00 00 00       	mov    $0x0,%eax
+     86c:	e8 22 0b 00 00       	call   1393 <printf>
+     871:	8b 05 49 1b 00 00    	mov    0x1b49(%rip),%eax        # 23c0 <stdout>
+     877:	48 8d 15 53 15 00 00 	lea    0x1553(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     87e:	48 89 d6             	mov    %rdx,%rsi
+     881:	89 c7                	mov    %eax,%edi
+     883:	b8 00 00 00 00       	mov    $0x0,%eax
+     888:	e8 06 0b 00 00       	call   1393 <printf>
+     88d:	90                   	nop
+     88e:	eb fd                	jmp    88d <vectortest+0x9d>
+  iov[0].iov_base = a;
+     890:	48 8d 85 d6 fe ff ff 	lea    -0x12a(%rbp),%rax
+     897:	48 89 85 e0 fe ff ff 	mov    %rax,-0x120(%rbp)
+  iov[0].iov_len = sizeof(a);
+     89e:	c7 85 e8 fe ff ff 0a 	movl   $0xa,-0x118(%rbp)
+     8a5:	00 00 00 
+  iov[1].iov_base = b;
+     8a8:	48 8d 85 d5 fe ff ff 	lea    -0x12b(%rbp),%rax
+     8af:	48 89 85 f0 fe ff ff 	mov    %rax,-0x110(%rbp)
+  iov[1].iov_len = 0;
+     8b6:	c7 85 f8 fe ff ff 00 	movl   $0x0,-0x108(%rbp)
+     8bd:	00 00 00 
+  iov[2].iov_base = b;
+     8c0:	48 8d 85 d5 fe ff ff 	lea    -0x12b(%rbp),%rax
+     8c7:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+  iov[2].iov_len = sizeof(b);
+     8ce:	c7 85 08 ff ff ff 01 	movl   $0x1,-0xf8(%rbp)
+     8d5:	00 00 00 
+  iov[3].iov_base = c;
+     8d8:	48 8d 85 a9 fd ff ff 	lea    -0x257(%rbp),%rax
+     8df:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  iov[3].iov_len = sizeof(c);
+     8e6:	c7 85 18 ff ff ff 2c 	movl   $0x12c,-0xe8(%rbp)
+     8ed:	01 00 00 
+  if((n = readv(fd, iov, 4)) != 311)
+     8f0:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+     8f7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8fa:	ba 04 00 00 00       	mov    $0x4,%edx
+     8ff:	48 89 ce             	mov    %rcx,%rsi
+     902:	89 c7                	mov    %eax,%edi
+     904:	e8 30 11 00 00       	call   1a39 <readv>
+     909:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     90c:	81 7d f4 37 01 00 00 	cmpl   $0x137,-0xc(%rbp)
+     913:	74 5f                	je     974 <vectortest+0x184>
+    error("readv returned %d", n);
+     915:	8b 05 a5 1a 00 00    	mov    0x1aa5(%rip),%eax        # 23c0 <stdout>
+     91b:	ba 68 00 00 00       	mov    $0x68,%edx
+     920:	48 8d 0d 7c 14 00 00 	lea    0x147c(%rip),%rcx        # 1da3 <malloc+0x18e>
+     927:	48 89 ce             	mov    %rcx,%rsi
+     92a:	89 c7                	mov    %eax,%edi
+     92c:	b8 00 00 00 00       	mov    $0x0,%eax
+     931:	e8 5d 0a 00 00       	call   1393 <printf>
+     936:	8b 05 84 1a 00 00    	mov    0x1a84(%rip),%eax        # 23c0 <stdout>
+     93c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     93f:	48 8d 0d 1c 16 00 00 	lea    0x161c(%rip),%rcx        # 1f62 <malloc+0x34d>
+     946:	48 89 ce             	mov    %rcx,%rsi
+     949:	89 c7                	mov    %eax,%edi
+     94b:	b8 00 00 00 00       	mov    $0x0,%eax
+     950:	e8 3e 0a 00 00       	call   1393 <printf>
+     955:	8b 05 65 1a 00 00    	mov    0x1a65(%rip),%eax        # 23c0 <stdout>
+     95b:	48 8d 15 6f 14 00 00 	lea    0x146f(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     962:	48 89 d6             	mov    %rdx,%rsi
+     965:	89 c7                	mov    %eax,%edi
+     967:	b8 00 00 00 00       	mov    $0x0,%eax
+     96c:	e8 22 0a 00 00       	call   1393 <printf>
+     971:	90                   	nop
+     972:	eb fd                	jmp    971 <vectortest+0x181>
+  for(i = 0; i < 10; i++)
+     974:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     97b:	e9 9c 00 00 00       	jmp    a1c <vectortest+0x22c>
+    if(a[i] != BYTE(i))
+     980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     983:	48 98                	cltq
+     985:	0f b6 b4 05 d6 fe ff 	movzbl -0x12a(%rbp,%rax,1),%esi
+     98c:	ff 
+     98d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     990:	48 63 d0             	movslq %eax,%rdx
+     993:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+     99a:	48 c1 ea 20          	shr    $0x20,%rdx
+     99e:	c1 fa 04             	sar    $0x4,%edx
+     9a1:	89 c1                	mov    %eax,%ecx
+     9a3:	c1 f9 1f             	sar    $0x1f,%ecx
+     9a6:	29 ca                	sub    %ecx,%edx
+     9a8:	6b ca 35             	imul   $0x35,%edx,%ecx
+     9ab:	29 c8                	sub    %ecx,%eax
+     9ad:	89 c2                	mov    %eax,%edx
+     9af:	89 d0                	mov    %edx,%eax
+     9b1:	83 c0 41             	add    $0x41,%eax
+     9b4:	40 38 c6             	cmp    %al,%sil
+     9b7:	74 5f                	je     a18 <vectortest+0x228>
+      error("byte %d of the first buffer is wrong", i);
+     9b9:	8b 05 01 1a 00 00    	mov    0x1a01(%rip),%eax        # 23c0 <stdout>
+     9bf:	ba 6b 00 00 00       	mov    $0x6b,%edx
+     9c4:	48 8d 0d d8 13 00 00 	lea    0x13d8(%rip),%rcx        # 1da3 <malloc+0x18e>
+     9cb:	48 89 ce             	mov    %rcx,%rsi
+     9ce:	89 c7                	mov    %eax,%edi
+     9d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d5:	e8 b9 09 00 00       	call   1393 <printf>
+     9da:	8b 05 e0 19 00 00    	mov    0x19e0(%rip),%eax        # 23c0 <stdout>
+     9e0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     9e3:	48 8d 0d 8e 15 00 00 	lea    0x158e(%rip),%rcx        # 1f78 <malloc+0x363>
+     9ea:	48 89 ce             	mov    %rcx,%rsi
+     9ed:	89 c7                	mov    %eax,%edi
+     9ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f4:	e8 9a 09 00 00       	call   1393 <printf>
+     9f9:	8b 05 c1 19 00 00    	mov    0x19c1(%rip),%eax        # 23c0 <stdout>
+     9ff:	48 8d 15 cb 13 00 00 	lea    0x13cb(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     a06:	48 89 d6             	mov    %rdx,%rsi
+     a09:	89 c7                	mov    %eax,%edi
+     a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+     a10:	e8 7e 09 00 00       	call   1393 <printf>
+     a15:	90                   	nop
+     a16:	eb fd                	jmp    a15 <vectortest+0x225>
+  for(i = 0; i < 10; i++)
+     a18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a1c:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     a20:	0f 8e 5a ff ff ff    	jle    980 <vectortest+0x190>
+  if(b[0] != BYTE(10))
+     a26:	0f b6 85 d5 fe ff ff 	movzbl -0x12b(%rbp),%eax
+     a2d:	3c 4b                	cmp    $0x4b,%al
+     a2f:	74 5c                	je     a8d <vectortest+0x29d>
+    error("the one byte buffer is wrong");
+     a31:	8b 05 89 19 00 00    	mov    0x1989(%rip),%eax        # 23c0 <stdout>
+     a37:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     a3c:	48 8d 0d 60 13 00 00 	lea    0x1360(%rip),%rcx        # 1da3 <malloc+0x18e>
+     a43:	48 89 ce             	mov    %rcx,%rsi
+     a46:	89 c7                	mov    %eax,%edi
+     a48:	b8 00 00 00 00       	mov    $0x0,%eax
+     a4d:	e8 41 09 00 00       	call   1393 <printf>
+     a52:	8b 05 68 19 00 00    	mov    0x1968(%rip),%eax        # 23c0 <stdout>
+     a58:	48 8d 15 3e 15 00 00 	lea    0x153e(%rip),%rdx        # 1f9d <malloc+0x388>
+     a5f:	48 89 d6             	mov    %rdx,%rsi
+     a62:	89 c7                	mov    %eax,%edi
+     a64:	b8 00 00 00 00       	mov    $0x0,%eax
+     a69:	e8 25 09 00 00       	call   1393 <printf>
+     a6e:	8b 05 4c 19 00 00    	mov    0x194c(%rip),%eax        # 23c0 <stdout>
+     a74:	48 8d 15 56 13 00 00 	lea    0x1356(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     a7b:	48 89 d6             	mov    %rdx,%rsi
+     a7e:	89 c7                	mov    %eax,%edi
+     a80:	b8 00 00 00 00       	mov    $0x0,%eax
+     a85:	e8 09 09 00 00       	call   1393 <printf>
+     a8a:	90                   	nop
+     a8b:	eb fd                	jmp    a8a <vectortest+0x29a>
+  for(i = 0; i < 300; i++)
+     a8d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a94:	e9 9f 00 00 00       	jmp    b38 <vectortest+0x348>
+    if(c[i] != BYTE(11 + i))
+     a99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a9c:	48 98                	cltq
+     a9e:	0f b6 b4 05 a9 fd ff 	movzbl -0x257(%rbp,%rax,1),%esi
+     aa5:	ff 
+     aa6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     aa9:	83 c0 0b             	add    $0xb,%eax
+     aac:	48 63 d0             	movslq %eax,%rdx
+     aaf:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+     ab6:	48 c1 ea 20          	shr    $0x20,%rdx
+     aba:	c1 fa 04             	sar    $0x4,%edx
+     abd:	89 c1                	mov    %eax,%ecx
+     abf:	c1 f9 1f             	sar    $0x1f,%ecx
+     ac2:	29 ca                	sub    %ecx,%edx
+     ac4:	6b ca 35             	imul   $0x35,%edx,%ecx
+     ac7:	29 c8                	sub    %ecx,%eax
+     ac9:	89 c2                	mov    %eax,%edx
+     acb:	89 d0                	mov    %edx,%eax
+     acd:	83 c0 41             	add    $0x41,%eax
+     ad0:	40 38 c6             	cmp    %al,%sil
+     ad3:	74 5f                	je     b34 <vectortest+0x344>
+      error("byte %d of the last buffer is wrong", i);
+     ad5:	8b 05 e5 18 00 00    	mov    0x18e5(%rip),%eax        # 23c0 <stdout>
+     adb:	ba 70 00 00 00       	mov    $0x70,%edx
+     ae0:	48 8d 0d bc 12 00 00 	lea    0x12bc(%rip),%rcx        # 1da3 <malloc+0x18e>
+     ae7:	48 89 ce             	mov    %rcx,%rsi
+     aea:	89 c7                	mov    %eax,%edi
+     aec:	b8 00 00 00 00       	mov    $0x0,%eax
+     af1:	e8 9d 08 00 00       	call   1393 <printf>
+     af6:	8b 05 c4 18 00 00    	mov    0x18c4(%rip),%eax        # 23c0 <stdout>
+     afc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     aff:	48 8d 0d ba 14 00 00 	lea    0x14ba(%rip),%rcx        # 1fc0 <malloc+0x3ab>
+     b06:	48 89 ce             	mov    %rcx,%rsi
+     b09:	89 c7                	mov    %eax,%edi
+     b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b10:	e8 7e 08 00 00       	call   1393 <printf>
+     b15:	8b 05 a5 18 00 00    	mov    0x18a5(%rip),%eax        # 23c0 <stdout>
+     b1b:	48 8d 15 af 12 00 00 	lea    0x12af(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     b22:	48 89 d6             	mov    %rdx,%rsi
+     b25:	89 c7                	mov    %eax,%edi
+     b27:	b8 00 00 00 00       	mov    $0x0,%eax
+     b2c:	e8 62 08 00 00       	call   1393 <printf>
+     b31:	90                   	nop
+     b32:	eb fd                	jmp    b31 <vectortest+0x341>
+  for(i = 0; i < 300; i++)
+     b34:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     b38:	81 7d fc 2b 01 00 00 	cmpl   $0x12b,-0x4(%rbp)
+     b3f:	0f 8e 54 ff ff ff    	jle    a99 <vectortest+0x2a9>
+
+  // write the same bytes back where they came from
+  close(fd);
+     b45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     b48:	89 c7                	mov    %eax,%edi
+     b4a:	e8 13 0e 00 00       	call   1962 <close>
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+     b4f:	be 02 00 00 00       	mov    $0x2,%esi
+     b54:	48 8d 05 3d 12 00 00 	lea    0x123d(%rip),%rax        # 1d98 <malloc+0x183>
+     b5b:	48 89 c7             	mov    %rax,%rdi
+     b5e:	e8 17 0e 00 00       	call   197a <open>
+     b63:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     b66:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     b6a:	79 5c                	jns    bc8 <vectortest+0x3d8>
+    error("unable to open pread1.txt");
+     b6c:	8b 05 4e 18 00 00    	mov    0x184e(%rip),%eax        # 23c0 <stdout>
+     b72:	ba 75 00 00 00       	mov    $0x75,%edx
+     b77:	48 8d 0d 25 12 00 00 	lea    0x1225(%rip),%rcx        # 1da3 <malloc+0x18e>
+     b7e:	48 89 ce             	mov    %rcx,%rsi
+     b81:	89 c7                	mov    %eax,%edi
+     b83:	b8 00 00 00 00       	mov    $0x0,%eax
+     b88:	e8 06 08 00 00       	call   1393 <printf>
+     b8d:	8b 05 2d 18 00 00    	mov    0x182d(%rip),%eax        # 23c0 <stdout>
+     b93:	48 8d 15 60 12 00 00 	lea    0x1260(%rip),%rdx        # 1dfa <malloc+0x1e5>
+     b9a:	48 89 d6             	mov    %rdx,%rsi
+     b9d:	89 c7                	mov    %eax,%edi
+     b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+     ba4:	e8 ea 07 00 00       	call   1393 <printf>
+     ba9:	8b 05 11 18 00 00    	mov    0x1811(%rip),%eax        # 23c0 <stdout>
+     baf:	48 8d 15 1b 12 00 00 	lea    0x121b(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     bb6:	48 89 d6             	mov    %rdx,%rsi
+     bb9:	89 c7                	mov    %eax,%edi
+     bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+     bc0:	e8 ce 07 00 00       	call   1393 <printf>
+     bc5:	90                   	nop
+     bc6:	eb fd                	jmp    bc5 <vectortest+0x3d5>
+  if((n = writev(fd, iov, 4)) != 311)
+     bc8:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+     bcf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     bd2:	ba 04 00 00 00       	mov    $0x4,%edx
+     bd7:	48 89 ce             	mov    %rcx,%rsi
+     bda:	89 c7                	mov    %eax,%edi
+     bdc:	e8 60 0e 00 00       	call   1a41 <writev>
+     be1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     be4:	81 7d f4 37 01 00 00 	cmpl   $0x137,-0xc(%rbp)
+     beb:	74 5f                	je     c4c <vectortest+0x45c>
+    error("writev returned %d", n);
+     bed:	8b 05 cd 17 00 00    	mov    0x17cd(%rip),%eax        # 23c0 <stdout>
+     bf3:	ba 77 00 00 00       	mov    $0x77,%edx
+     bf8:	48 8d 0d a4 11 00 00 	lea    0x11a4(%rip),%rcx        # 1da3 <malloc+0x18e>
+     bff:	48 89 ce             	mov    %rcx,%rsi
+     c02:	89 c7                	mov    %eax,%edi
+     c04:	b8 00 00 00 00       	mov    $0x0,%eax
+     c09:	e8 85 07 00 00       	call   1393 <printf>
+     c0e:	8b 05 ac 17 00 00    	mov    0x17ac(%rip),%eax        # 23c0 <stdout>
+     c14:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     c17:	48 8d 0d c6 13 00 00 	lea    0x13c6(%rip),%rcx        # 1fe4 <malloc+0x3cf>
+     c1e:	48 89 ce             	mov    %rcx,%rsi
+     c21:	89 c7                	mov    %eax,%edi
+     c23:	b8 00 00 00 00       	mov    $0x0,%eax
+     c28:	e8 66 07 00 00       	call   1393 <printf>
+     c2d:	8b 05 8d 17 00 00    	mov    0x178d(%rip),%eax        # 23c0 <stdout>
+     c33:	48 8d 15 97 11 00 00 	lea    0x1197(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     c3a:	48 89 d6             	mov    %rdx,%rsi
+     c3d:	89 c7                	mov    %eax,%edi
+     c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+     c44:	e8 4a 07 00 00       	call   1393 <printf>
+     c49:	90                   	nop
+     c4a:	eb fd                	jmp    c49 <vectortest+0x459>
+  if(pread(fd, buf, 400, 0) != 400)
+     c4c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     c4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+     c54:	ba 90 01 00 00       	mov    $0x190,%edx
+     c59:	48 8d 35 00 18 00 00 	lea    0x1800(%rip),%rsi        # 2460 <buf>
+     c60:	89 c7                	mov    %eax,%edi
+     c62:	e8 c2 0d 00 00       	call   1a29 <pread>
+     c67:	3d 90 01 00 00       	cmp    $0x190,%eax
+     c6c:	74 5c                	je     cca <vectortest+0x4da>
+    error("unable to read pread1.txt");
+     c6e:	8b 05 4c 17 00 00    	mov    0x174c(%rip),%eax        # 23c0 <stdout>
+     c74:	ba 79 00 00 00       	mov    $0x79,%edx
+     c79:	48 8d 0d 23 11 00 00 	lea    0x1123(%rip),%rcx        # 1da3 <malloc+0x18e>
+     c80:	48 89 ce             	mov    %rcx,%rsi
+     c83:	89 c7                	mov    %eax,%edi
+     c85:	b8 00 00 00 00       	mov    $0x0,%eax
+     c8a:	e8 04 07 00 00       	call   1393 <printf>
+     c8f:	8b 05 2b 17 00 00    	mov    0x172b(%rip),%eax        # 23c0 <stdout>
+     c95:	48 8d 15 78 11 00 00 	lea    0x1178(%rip),%rdx        # 1e14 <malloc+0x1ff>
+     c9c:	48 89 d6             	mov    %rdx,%rsi
+     c9f:	89 c7                	mov    %eax,%edi
+     ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ca6:	e8 e8 06 00 00       	call   1393 <printf>
+     cab:	8b 05 0f 17 00 00    	mov    0x170f(%rip),%eax        # 23c0 <stdout>
+     cb1:	48 8d 15 19 11 00 00 	lea    0x1119(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     cb8:	48 89 d6             	mov    %rdx,%rsi
+     cbb:	89 c7                	mov    %eax,%edi
+     cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+     cc2:	e8 cc 06 00 00       	call   1393 <printf>
+     cc7:	90                   	nop
+     cc8:	eb fd                	jmp    cc7 <vectortest+0x4d7>
+  for(i = 0; i < 400; i++)
+     cca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     cd1:	e9 9f 00 00 00       	jmp    d75 <vectortest+0x585>
+    if(buf[i] != BYTE(i))
+     cd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd9:	48 98                	cltq
+     cdb:	48 8d 15 7e 17 00 00 	lea    0x177e(%rip),%rdx        # 2460 <buf>
+     ce2:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+     ce6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ce9:	48 63 d0             	movslq %eax,%rdx
+     cec:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+     cf3:	48 c1 ea 20          	shr    $0x20,%rdx
+     cf7:	c1 fa 04             	sar    $0x4,%edx
+     cfa:	89 c1                	mov    %eax,%ecx
+     cfc:	c1 f9 1f             	sar    $0x1f,%ecx
+     cff:	29 ca                	sub    %ecx,%edx
+     d01:	6b ca 35             	imul   $0x35,%edx,%ecx
+     d04:	29 c8                	sub    %ecx,%eax
+     d06:	89 c2                	mov    %eax,%edx
+     d08:	89 d0                	mov    %edx,%eax
+     d0a:	83 c0 41             	add    $0x41,%eax
+     d0d:	40 38 c6             	cmp    %al,%sil
+     d10:	74 5f                	je     d71 <vectortest+0x581>
+      error("byte %d after writev is wrong", i);
+     d12:	8b 05 a8 16 00 00    	mov    0x16a8(%rip),%eax        # 23c0 <stdout>
+     d18:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     d1d:	48 8d 0d 7f 10 00 00 	lea    0x107f(%rip),%rcx        # 1da3 <malloc+0x18e>
+     d24:	48 89 ce             	mov    %rcx,%rsi
+     d27:	89 c7                	mov    %eax,%edi
+     d29:	b8 00 00 00 00       	mov    $0x0,%eax
+     d2e:	e8 60 06 00 00       	call   1393 <printf>
+     d33:	8b 05 87 16 00 00    	mov    0x1687(%rip),%eax        # 23c0 <stdout>
+     d39:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d3c:	48 8d 0d b4 12 00 00 	lea    0x12b4(%rip),%rcx        # 1ff7 <malloc+0x3e2>
+     d43:	48 89 ce             	mov    %rcx,%rsi
+     d46:	89 c7                	mov    %eax,%edi
+     d48:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4d:	e8 41 06 00 00       	call   1393 <printf>
+     d52:	8b 05 68 16 00 00    	mov    0x1668(%rip),%eax        # 23c0 <stdout>
+     d58:	48 8d 15 72 10 00 00 	lea    0x1072(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     d5f:	48 89 d6             	mov    %rdx,%rsi
+     d62:	89 c7                	mov    %eax,%edi
+     d64:	b8 00 00 00 00       	mov    $0x0,%eax
+     d69:	e8 25 06 00 00       	call   1393 <printf>
+     d6e:	90                   	nop
+     d6f:	eb fd                	jmp    d6e <vectortest+0x57e>
+  for(i = 0; i < 400; i++)
+     d71:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     d75:	81 7d fc 8f 01 00 00 	cmpl   $0x18f,-0x4(%rbp)
+     d7c:	0f 8e 54 ff ff ff    	jle    cd6 <vectortest+0x4e6>
+
+  for(i = 0; i <= IOV_MAX; i++){
+     d82:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     d89:	eb 39                	jmp    dc4 <vectortest+0x5d4>
+    iov[i].iov_base = a;
+     d8b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     d8e:	48 98                	cltq
+     d90:	48 c1 e0 04          	shl    $0x4,%rax
+     d94:	48 01 e8             	add    %rbp,%rax
+     d97:	48 8d 90 e0 fe ff ff 	lea    -0x120(%rax),%rdx
+     d9e:	48 8d 85 d6 fe ff ff 	lea    -0x12a(%rbp),%rax
+     da5:	48 89 02             	mov    %rax,(%rdx)
+    iov[i].iov_len = 1;
+     da8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     dab:	48 98                	cltq
+     dad:	48 c1 e0 04          	shl    $0x4,%rax
+     db1:	48 01 e8             	add    %rbp,%rax
+     db4:	48 2d 18 01 00 00    	sub    $0x118,%rax
+     dba:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  for(i = 0; i <= IOV_MAX; i++){
+     dc0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     dc4:	83 7d fc 10          	cmpl   $0x10,-0x4(%rbp)
+     dc8:	7e c1                	jle    d8b <vectortest+0x59b>
+  }
+  if(readv(fd, iov, IOV_MAX + 1) != -1)
+     dca:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+     dd1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     dd4:	ba 11 00 00 00       	mov    $0x11,%edx
+     dd9:	48 89 ce             	mov    %rcx,%rsi
+     ddc:	89 c7                	mov    %eax,%edi
+     dde:	e8 56 0c 00 00       	call   1a39 <readv>
+     de3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     de6:	74 5c                	je     e44 <vectortest+0x654>
+    error("readv of more than IOV_MAX buffers did not fail");
+     de8:	8b 05 d2 15 00 00    	mov    0x15d2(%rip),%eax        # 23c0 <stdout>
+     dee:	ba 83 00 00 00       	mov    $0x83,%edx
+     df3:	48 8d 0d a9 0f 00 00 	lea    0xfa9(%rip),%rcx        # 1da3 <malloc+0x18e>
+     dfa:	48 89 ce             	mov    %rcx,%rsi
+     dfd:	89 c7                	mov    %eax,%edi
+     dff:	b8 00 00 00 00       	mov    $0x0,%eax
+     e04:	e8 8a 05 00 00       	call   1393 <printf>
+     e09:	8b 05 b1 15 00 00    	mov    0x15b1(%rip),%eax        # 23c0 <stdout>
+     e0f:	48 8d 15 02 12 00 00 	lea    0x1202(%rip),%rdx        # 2018 <malloc+0x403>
+     e16:	48 89 d6             	mov    %rdx,%rsi
+     e19:	89 c7                	mov    %eax,%edi
+     e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+     e20:	e8 6e 05 00 00       	call   1393 <printf>
+     e25:	8b 05 95 15 00 00    	mov    0x1595(%rip),%eax        # 23c0 <stdout>
+     e2b:	48 8d 15 9f 0f 00 00 	lea    0xf9f(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     e32:	48 89 d6             	mov    %rdx,%rsi
+     e35:	89 c7                	mov    %eax,%edi
+     e37:	b8 00 00 00 00       	mov    $0x0,%eax
+     e3c:	e8 52 05 00 00       	call   1393 <printf>
+     e41:	90                   	nop
+     e42:	eb fd                	jmp    e41 <vectortest+0x651>
+  close(fd);
+     e44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     e47:	89 c7                	mov    %eax,%edi
+     e49:	e8 14 0b 00 00       	call   1962 <close>
+  printf(stdout, "vectortest OK\n");
+     e4e:	8b 05 6c 15 00 00    	mov    0x156c(%rip),%eax        # 23c0 <stdout>
+     e54:	48 8d 15 ed 11 00 00 	lea    0x11ed(%rip),%rdx        # 2048 <malloc+0x433>
+     e5b:	48 89 d6             	mov    %rdx,%rsi
+     e5e:	89 c7                	mov    %eax,%edi
+     e60:	b8 00 00 00 00       	mov    $0x0,%eax
+     e65:	e8 29 05 00 00       	call   1393 <printf>
+}
+     e6a:	90                   	nop
+     e6b:	c9                   	leave
+     e6c:	c3                   	ret
+
+0000000000000e6d <concurrenttest>:
+
+// Processes sharing one open file read all of it with pread at the
+// same time, as an inode is read under a shared lock.
+void
+concurrenttest(void)
+{
+     e6d:	55                   	push   %rbp
+     e6e:	48 89 e5             	mov    %rsp,%rbp
+     e71:	48 83 ec 20          	sub    $0x20,%rsp
+  int fd, i, j, k, off, pid;
+
+  printf(stdout, "concurrenttest\n");
+     e75:	8b 05 45 15 00 00    	mov    0x1545(%rip),%eax        # 23c0 <stdout>
+     e7b:	48 8d 15 d5 11 00 00 	lea    0x11d5(%rip),%rdx        # 2057 <malloc+0x442>
+     e82:	48 89 d6             	mov    %rdx,%rsi
+     e85:	89 c7                	mov    %eax,%edi
+     e87:	b8 00 00 00 00       	mov    $0x0,%eax
+     e8c:	e8 02 05 00 00       	call   1393 <printf>
+  if((fd = open("pread1.txt", O_RDONLY)) < 0)
+     e91:	be 00 00 00 00       	mov    $0x0,%esi
+     e96:	48 8d 05 fb 0e 00 00 	lea    0xefb(%rip),%rax        # 1d98 <malloc+0x183>
+     e9d:	48 89 c7             	mov    %rax,%rdi
+     ea0:	e8 d5 0a 00 00       	call   197a <open>
+     ea5:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     ea8:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     eac:	79 5c                	jns    f0a <concurrenttest+0x9d>
+    error("unable to open pread1.txt");
+     eae:	8b 05 0c 15 00 00    	mov    0x150c(%rip),%eax        # 23c0 <stdout>
+     eb4:	ba 91 00 00 00       	mov    $0x91,%edx
+     eb9:	48 8d 0d e3 0e 00 00 	lea    0xee3(%rip),%rcx        # 1da3 <malloc+0x18e>
+     ec0:	48 89 ce             	mov    %rcx,%rsi
+     ec3:	89 c7                	mov    %eax,%edi
+     ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+     eca:	e8 c4 04 00 00       	call   1393 <printf>
+     ecf:	8b 05 eb 14 00 00    	mov    0x14eb(%rip),%eax        # 23c0 <stdout>
+     ed5:	48 8d 15 1e 0f 00 00 	lea    0xf1e(%rip),%rdx        # 1dfa <malloc+0x1e5>
+     edc:	48 89 d6             	mov    %rdx,%rsi
+     edf:	89 c7                	mov    %eax,%edi
+     ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee6:	e8 a8 04 00 00       	call   1393 <printf>
+     eeb:	8b 05 cf 14 00 00    	mov    0x14cf(%rip),%eax        # 23c0 <stdout>
+     ef1:	48 8d 15 d9 0e 00 00 	lea    0xed9(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     ef8:	48 89 d6             	mov    %rdx,%rsi
+     efb:	89 c7                	mov    %eax,%edi
+     efd:	b8 00 00 00 00       	mov    $0x0,%eax
+     f02:	e8 8c 04 00 00       	call   1393 <printf>
+     f07:	90                   	nop
+     f08:	eb fd                	jmp    f07 <concurrenttest+0x9a>
+  for(i = 0; i < NREADER; i++){
+     f0a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     f11:	e9 1d 02 00 00       	jmp    1133 <concurrenttest+0x2c6>
+    pid = fork();
+     f16:	e8 17 0a 00 00       	call   1932 <fork>
+     f1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if(pid < 0)
+     f1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     f22:	79 5c                	jns    f80 <concurrenttest+0x113>
+      error("fork failed");
+     f24:	8b 05 96 14 00 00    	mov    0x1496(%rip),%eax        # 23c0 <stdout>
+     f2a:	ba 95 00 00 00       	mov    $0x95,%edx
+     f2f:	48 8d 0d 6d 0e 00 00 	lea    0xe6d(%rip),%rcx        # 1da3 <malloc+0x18e>
+     f36:	48 89 ce             	mov    %rcx,%rsi
+     f39:	89 c7                	mov    %eax,%edi
+     f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f40:	e8 4e 04 00 00       	call   1393 <printf>
+     f45:	8b 05 75 14 00 00    	mov    0x1475(%rip),%eax        # 23c0 <stdout>
+     f4b:	48 8d 15 15 11 00 00 	lea    0x1115(%rip),%rdx        # 2067 <malloc+0x452>
+     f52:	48 89 d6             	mov    %rdx,%rsi
+     f55:	89 c7                	mov    %eax,%edi
+     f57:	b8 00 00 00 00       	mov    $0x0,%eax
+     f5c:	e8 32 04 00 00       	call   1393 <printf>
+     f61:	8b 05 59 14 00 00    	mov    0x1459(%rip),%eax        # 23c0 <stdout>
+     f67:	48 8d 15 63 0e 00 00 	lea    0xe63(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+     f6e:	48 89 d6             	mov    %rdx,%rsi
+     f71:	89 c7                	mov    %eax,%edi
+     f73:	b8 00 00 00 00       	mov    $0x0,%eax
+     f78:	e8 16 04 00 00       	call   1393 <printf>
+     f7d:	90                   	nop
+     f7e:	eb fd                	jmp    f7d <concurrenttest+0x110>
+    if(pid == 0){
+     f80:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     f84:	0f 85 a5 01 00 00    	jne    112f <concurrenttest+0x2c2>
+      for(j = 0; j < 200; j++){
+     f8a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     f91:	e9 87 01 00 00       	jmp    111d <concurrenttest+0x2b0>
+        off = (j * 997 + i * 131) % (FILESZ - 512);
+     f96:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f99:	69 d0 e5 03 00 00    	imul   $0x3e5,%eax,%edx
+     f9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fa2:	69 c0 83 00 00 00    	imul   $0x83,%eax,%eax
+     fa8:	01 d0                	add    %edx,%eax
+     faa:	48 63 d0             	movslq %eax,%rdx
+     fad:	48 69 d2 89 88 88 88 	imul   $0xffffffff88888889,%rdx,%rdx
+     fb4:	48 c1 ea 20          	shr    $0x20,%rdx
+     fb8:	01 c2                	add    %eax,%edx
+     fba:	c1 fa 0c             	sar    $0xc,%edx
+     fbd:	89 c1                	mov    %eax,%ecx
+     fbf:	c1 f9 1f             	sar    $0x1f,%ecx
+     fc2:	29 ca                	sub    %ecx,%edx
+     fc4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+     fc7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     fca:	69 d2 00 1e 00 00    	imul   $0x1e00,%edx,%edx
+     fd0:	29 d0                	sub    %edx,%eax
+     fd2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+        if(pread(fd, buf, 512, off) != 512)
+     fd5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     fd8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     fdb:	89 d1                	mov    %edx,%ecx
+     fdd:	ba 00 02 00 00       	mov    $0x200,%edx
+     fe2:	48 8d 35 77 14 00 00 	lea    0x1477(%rip),%rsi        # 2460 <buf>
+     fe9:	89 c7                	mov    %eax,%edi
+     feb:	e8 39 0a 00 00       	call   1a29 <pread>
+     ff0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ff5:	74 5f                	je     1056 <concurrenttest+0x1e9>
+          error("reader %d: pread at %d failed", i, off);
+     ff7:	8b 05 c3 13 00 00    	mov    0x13c3(%rip),%eax        # 23c0 <stdout>
+     ffd:	ba 9a 00 00 00       	mov    $0x9a,%edx
+    1002:	48 8d 0d 9a 0d 00 00 	lea    0xd9a(%rip),%rcx        # 1da3 <malloc+0x18e>
+    1009:	48 89 ce             	mov    %rcx,%rsi
+    100c:	89 c7                	mov    %eax,%edi
+    100e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1013:	e8 7b 03 00 00       	call   1393 <printf>
+    1018:	8b 05 a2 13 00 00    	mov    0x13a2(%rip),%eax        # 23c0 <stdout>
+    101e:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+    1021:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1024:	48 8d 35 48 10 00 00 	lea    0x1048(%rip),%rsi        # 2073 <malloc+0x45e>
+    102b:	89 c7                	mov    %eax,%edi
+    102d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1032:	e8 5c 03 00 00       	call   1393 <printf>
+    1037:	8b 05 83 13 00 00    	mov    0x1383(%rip),%eax        # 23c0 <stdout>
+    103d:	48 8d 15 8d 0d 00 00 	lea    0xd8d(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+    1044:	48 89 d6             	mov    %rdx,%rsi
+    1047:	89 c7                	mov    %eax,%edi
+    1049:	b8 00 00 00 00       	mov    $0x0,%eax
+    104e:	e8 40 03 00 00       	call   1393 <printf>
+    1053:	90                   	nop
+    1054:	eb fd                	jmp    1053 <concurrenttest+0x1e6>
+        for(k = 0; k < 512; k++)
+    1056:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    105d:	e9 aa 00 00 00       	jmp    110c <concurrenttest+0x29f>
+          if(buf[k] != BYTE(off + k))
+    1062:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1065:	48 98                	cltq
+    1067:	48 8d 15 f2 13 00 00 	lea    0x13f2(%rip),%rdx        # 2460 <buf>
+    106e:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+    1072:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    1075:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1078:	01 d0                	add    %edx,%eax
+    107a:	48 63 d0             	movslq %eax,%rdx
+    107d:	48 69 d2 ed 73 48 4d 	imul   $0x4d4873ed,%rdx,%rdx
+    1084:	48 c1 ea 20          	shr    $0x20,%rdx
+    1088:	c1 fa 04             	sar    $0x4,%edx
+    108b:	89 c1                	mov    %eax,%ecx
+    108d:	c1 f9 1f             	sar    $0x1f,%ecx
+    1090:	29 ca                	sub    %ecx,%edx
+    1092:	6b ca 35             	imul   $0x35,%edx,%ecx
+    1095:	29 c8                	sub    %ecx,%eax
+    1097:	89 c2                	mov    %eax,%edx
+    1099:	89 d0                	mov    %edx,%eax
+    109b:	83 c0 41             	add    $0x41,%eax
+    109e:	40 38 c6             	cmp    %al,%sil
+    10a1:	74 65                	je     1108 <concurrenttest+0x29b>
+            error("reader %d: byte %d is wrong", i, off + k);
+    10a3:	8b 05 17 13 00 00    	mov    0x1317(%rip),%eax        # 23c0 <stdout>
+    10a9:	ba 9d 00 00 00       	mov    $0x9d,%edx
+    10ae:	48 8d 0d ee 0c 00 00 	lea    0xcee(%rip),%rcx        # 1da3 <malloc+0x18e>
+    10b5:	48 89 ce             	mov    %rcx,%rsi
+    10b8:	89 c7                	mov    %eax,%edi
+    10ba:	b8 00 00 00 00       	mov    $0x0,%eax
+    10bf:	e8 cf 02 00 00       	call   1393 <printf>
+    10c4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+    10c7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    10ca:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+    10cd:	8b 05 ed 12 00 00    	mov    0x12ed(%rip),%eax        # 23c0 <stdout>
+    10d3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    10d6:	48 8d 35 b4 0f 00 00 	lea    0xfb4(%rip),%rsi        # 2091 <malloc+0x47c>
+    10dd:	89 c7                	mov    %eax,%edi
+    10df:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e4:	e8 aa 02 00 00       	call   1393 <printf>
+    10e9:	8b 05 d1 12 00 00    	mov    0x12d1(%rip),%eax        # 23c0 <stdout>
+    10ef:	48 8d 15 db 0c 00 00 	lea    0xcdb(%rip),%rdx        # 1dd1 <malloc+0x1bc>
+    10f6:	48 89 d6             	mov    %rdx,%rsi
+    10f9:	89 c7                	mov    %eax,%edi
+    10fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1100:	e8 8e 02 00 00       	call   1393 <printf>
+    1105:	90                   	nop
+    1106:	eb fd                	jmp    1105 <concurrenttest+0x298>
+        for(k = 0; k < 512; k++)
+    1108:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+    110c:	81 7d f4 ff 01 00 00 	cmpl   $0x1ff,-0xc(%rbp)
+    1113:	0f 8e 49 ff ff ff    	jle    1062 <concurrenttest+0x1f5>
+      for(j = 0; j < 200; j++){
+    1119:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+    111d:	81 7d f8 c7 00 00 00 	cmpl   $0xc7,-0x8(%rbp)
+    1124:	0f 8e 6c fe ff ff    	jle    f96 <concurrenttest+0x129>
+      }
+      exit();
+    112a:	e8 0b 08 00 00       	call   193a <exit>
+  for(i = 0; i < NREADER; i++){
+    112f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1133:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+    1137:	0f 8e d9 fd ff ff    	jle    f16 <concurrenttest+0xa9>
+    }
+  }
+  for(i = 0; i < NREADER; i++)
+    113d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1144:	eb 09                	jmp    114f <concurrenttest+0x2e2>
+    wait();
+    1146:	e8 f7 07 00 00       	call   1942 <wait>
+  for(i = 0; i < NREADER; i++)
+    114b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    114f:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+    1153:	7e f1                	jle    1146 <concurrenttest+0x2d9>
+  close(fd);
+    1155:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1158:	89 c7                	mov    %eax,%edi
+    115a:	e8 03 08 00 00       	call   1962 <close>
+  printf(stdout, "concurrenttest OK\n");
+    115f:	8b 05 5b 12 00 00    	mov    0x125b(%rip),%eax        # 23c0 <stdout>
+    1165:	48 8d 15 41 0f 00 00 	lea    0xf41(%rip),%rdx        # 20ad <malloc+0x498>
+    116c:	48 89 d6             	mov    %rdx,%rsi
+    116f:	89 c7                	mov    %eax,%edi
+    1171:	b8 00 00 00 00       	mov    $0x0,%eax
+    1176:	e8 18 02 00 00       	call   1393 <printf>
+}
+    117b:	90                   	nop
+    117c:	c9                   	leave
+    117d:	c3                   	ret
+
+000000000000117e <main>:
+
+int
+main(int argc, char *argv[])
+{
+    117e:	55                   	push   %rbp
+    117f:	48 89 e5             	mov    %rsp,%rbp
+    1182:	48 83 ec 10          	sub    $0x10,%rsp
+    1186:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1189:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  makefile();
+    118d:	e8 6e ee ff ff       	call   0 <makefile>
+  offsettest();
+    1192:	e8 c1 ef ff ff       	call   158 <offsettest>
+  vectortest();
+    1197:	e8 54 f6 ff ff       	call   7f0 <vectortest>
+  concurrenttest();
+    119c:	e8 cc fc ff ff       	call   e6d <concurrenttest>
+  unlink("pread1.txt");
+    11a1:	48 8d 05 f0 0b 00 00 	lea    0xbf0(%rip),%rax        # 1d98 <malloc+0x183>
+    11a8:	48 89 c7             	mov    %rax,%rdi
+    11ab:	e8 da 07 00 00       	call   198a <unlink>
+  printf(stdout, "preadtest passed!!\n");
+    11b0:	8b 05 0a 12 00 00    	mov    0x120a(%rip),%eax        # 23c0 <stdout>
+    11b6:	48 8d 15 03 0f 00 00 	lea    0xf03(%rip),%rdx        # 20c0 <malloc+0x4ab>
+    11bd:	48 89 d6             	mov    %rdx,%rsi
+    11c0:	89 c7                	mov    %eax,%edi
+    11c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c7:	e8 c7 01 00 00       	call   1393 <printf>
+  exit();
+    11cc:	e8 69 07 00 00       	call   193a <exit>
+
+00000000000011d1 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    11d1:	55                   	push   %rbp
+    11d2:	48 89 e5             	mov    %rsp,%rbp
+    11d5:	48 83 ec 10          	sub    $0x10,%rsp
+    11d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    11dc:	89 f0                	mov    %esi,%eax
+    11de:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    11e1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    11e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11e8:	ba 01 00 00 00       	mov    $0x1,%edx
+    11ed:	48 89 ce             	mov    %rcx,%rsi
+    11f0:	89 c7                	mov    %eax,%edi
+    11f2:	e8 63 07 00 00       	call   195a <write>
+}
+    11f7:	90                   	nop
+    11f8:	c9                   	leave
+    11f9:	c3                   	ret
+
+00000000000011fa <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    11fa:	55                   	push   %rbp
+    11fb:	48 89 e5             	mov    %rsp,%rbp
+    11fe:	48 83 ec 40          	sub    $0x40,%rsp
+    1202:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    1205:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1208:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    120b:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    120e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1212:	74 1f                	je     1233 <printint64+0x39>
+    1214:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1217:	c1 e8 1f             	shr    $0x1f,%eax
+    121a:	0f b6 c0             	movzbl %al,%eax
+    121d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1220:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1224:	74 0d                	je     1233 <printint64+0x39>
+    x = -xx;
+    1226:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1229:	f7 d8                	neg    %eax
+    122b:	48 98                	cltq
+    122d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1231:	eb 09                	jmp    123c <printint64+0x42>
+  else
+    x = xx;
+    1233:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1236:	48 98                	cltq
+    1238:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    123c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    1243:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1246:	48 63 c8             	movslq %eax,%rcx
+    1249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    124d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1252:	48 f7 f1             	div    %rcx
+    1255:	48 89 d1             	mov    %rdx,%rcx
+    1258:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    125b:	8d 50 01             	lea    0x1(%rax),%edx
+    125e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1261:	48 8d 15 68 11 00 00 	lea    0x1168(%rip),%rdx        # 23d0 <digits.1>
+    1268:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    126c:	48 98                	cltq
+    126e:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1272:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1275:	48 63 f0             	movslq %eax,%rsi
+    1278:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    127c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1281:	48 f7 f6             	div    %rsi
+    1284:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1288:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    128d:	75 b4                	jne    1243 <printint64+0x49>
+
+  if(sgn)
+    128f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1293:	74 2b                	je     12c0 <printint64+0xc6>
+    buf[i++] = '-';
+    1295:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1298:	8d 50 01             	lea    0x1(%rax),%edx
+    129b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    129e:	48 98                	cltq
+    12a0:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    12a5:	eb 19                	jmp    12c0 <printint64+0xc6>
+    putc(fd, buf[i]);
+    12a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    12aa:	48 98                	cltq
+    12ac:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    12b1:	0f be d0             	movsbl %al,%edx
+    12b4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    12b7:	89 d6                	mov    %edx,%esi
+    12b9:	89 c7                	mov    %eax,%edi
+    12bb:	e8 11 ff ff ff       	call   11d1 <putc>
+  while(--i >= 0)
+    12c0:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    12c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    12c8:	79 dd                	jns    12a7 <printint64+0xad>
+}
+    12ca:	90                   	nop
+    12cb:	90                   	nop
+    12cc:	c9                   	leave
+    12cd:	c3                   	ret
+
+00000000000012ce <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    12ce:	55                   	push   %rbp
+    12cf:	48 89 e5             	mov    %rsp,%rbp
+    12d2:	48 83 ec 30          	sub    $0x30,%rsp
+    12d6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    12d9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    12dc:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    12df:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    12e2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    12e9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    12ed:	74 17                	je     1306 <printint+0x38>
+    12ef:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    12f3:	79 11                	jns    1306 <printint+0x38>
+    neg = 1;
+    12f5:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    12fc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    12ff:	f7 d8                	neg    %eax
+    1301:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1304:	eb 06                	jmp    130c <printint+0x3e>
+  } else {
+    x = xx;
+    1306:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1309:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    130c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    1313:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    1316:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1319:	ba 00 00 00 00       	mov    $0x0,%edx
+    131e:	f7 f1                	div    %ecx
+    1320:	89 d1                	mov    %edx,%ecx
+    1322:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1325:	8d 50 01             	lea    0x1(%rax),%edx
+    1328:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    132b:	89 c9                	mov    %ecx,%ecx
+    132d:	48 8d 15 bc 10 00 00 	lea    0x10bc(%rip),%rdx        # 23f0 <digits.0>
+    1334:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1338:	48 98                	cltq
+    133a:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    133e:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    1341:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1344:	ba 00 00 00 00       	mov    $0x0,%edx
+    1349:	f7 f6                	div    %esi
+    134b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    134e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    1352:	75 bf                	jne    1313 <printint+0x45>
+  if(neg)
+    1354:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1358:	74 2b                	je     1385 <printint+0xb7>
+    buf[i++] = '-';
+    135a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    135d:	8d 50 01             	lea    0x1(%rax),%edx
+    1360:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1363:	48 98                	cltq
+    1365:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    136a:	eb 19                	jmp    1385 <printint+0xb7>
+    putc(fd, buf[i]);
+    136c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    136f:	48 98                	cltq
+    1371:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    1376:	0f be d0             	movsbl %al,%edx
+    1379:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    137c:	89 d6                	mov    %edx,%esi
+    137e:	89 c7                	mov    %eax,%edi
+    1380:	e8 4c fe ff ff       	call   11d1 <putc>
+  while(--i >= 0)
+    1385:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1389:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    138d:	79 dd                	jns    136c <printint+0x9e>
+}
+    138f:	90                   	nop
+    1390:	90                   	nop
+    1391:	c9                   	leave
+    1392:	c3                   	ret
+
+0000000000001393 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1393:	55                   	push   %rbp
+    1394:	48 89 e5             	mov    %rsp,%rbp
+    1397:	48 83 ec 70          	sub    $0x70,%rsp
+    139b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    139e:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    13a2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    13a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    13aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    13ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    13b2:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    13b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    13bd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    13c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    13c5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    13c9:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    13d0:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    13d7:	e9 6b 02 00 00       	jmp    1647 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    13dc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    13df:	48 63 d0             	movslq %eax,%rdx
+    13e2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    13e6:	48 01 d0             	add    %rdx,%rax
+    13e9:	0f b6 00             	movzbl (%rax),%eax
+    13ec:	0f be c0             	movsbl %al,%eax
+    13ef:	25 ff 00 00 00       	and    $0xff,%eax
+    13f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    13f7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    13fb:	75 30                	jne    142d <printf+0x9a>
+      if(c == '%'){
+    13fd:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1401:	75 13                	jne    1416 <printf+0x83>
+        state = '%';
+    1403:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    140a:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    1411:	e9 2d 02 00 00       	jmp    1643 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    1416:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1419:	0f be d0             	movsbl %al,%edx
+    141c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    141f:	89 d6                	mov    %edx,%esi
+    1421:	89 c7                	mov    %eax,%edi
+    1423:	e8 a9 fd ff ff       	call   11d1 <putc>
+    1428:	e9 16 02 00 00       	jmp    1643 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    142d:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    1431:	0f 85 0c 02 00 00    	jne    1643 <printf+0x2b0>
+      if(c == 'l') {
+    1437:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    143b:	75 0c                	jne    1449 <printf+0xb6>
+        lflag = 1;
+    143d:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    1444:	e9 fa 01 00 00       	jmp    1643 <printf+0x2b0>
+      } else if(c == 'd'){
+    1449:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    144d:	0f 85 95 00 00 00    	jne    14e8 <printf+0x155>
+        if (lflag == 1)
+    1453:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1457:	75 49                	jne    14a2 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1459:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    145c:	83 f8 2f             	cmp    $0x2f,%eax
+    145f:	77 17                	ja     1478 <printf+0xe5>
+    1461:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1465:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1468:	89 d2                	mov    %edx,%edx
+    146a:	48 01 d0             	add    %rdx,%rax
+    146d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1470:	83 c2 08             	add    $0x8,%edx
+    1473:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1476:	eb 0c                	jmp    1484 <printf+0xf1>
+    1478:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    147c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1480:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1484:	48 8b 00             	mov    (%rax),%rax
+    1487:	89 c6                	mov    %eax,%esi
+    1489:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    148c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1491:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1496:	89 c7                	mov    %eax,%edi
+    1498:	e8 5d fd ff ff       	call   11fa <printint64>
+    149d:	e9 9a 01 00 00       	jmp    163c <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    14a2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    14a5:	83 f8 2f             	cmp    $0x2f,%eax
+    14a8:	77 17                	ja     14c1 <printf+0x12e>
+    14aa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    14ae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14b1:	89 d2                	mov    %edx,%edx
+    14b3:	48 01 d0             	add    %rdx,%rax
+    14b6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    14b9:	83 c2 08             	add    $0x8,%edx
+    14bc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    14bf:	eb 0c                	jmp    14cd <printf+0x13a>
+    14c1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    14c5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    14c9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    14cd:	8b 30                	mov    (%rax),%esi
+    14cf:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    14d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+    14d7:	ba 0a 00 00 00       	mov    $0xa,%edx
+    14dc:	89 c7                	mov    %eax,%edi
+    14de:	e8 eb fd ff ff       	call   12ce <printint>
+    14e3:	e9 54 01 00 00       	jmp    163c <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    14e8:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    14ec:	74 0a                	je     14f8 <printf+0x165>
+    14ee:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    14f2:	0f 85 95 00 00 00    	jne    158d <printf+0x1fa>
+        if (lflag == 1)
+    14f8:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    14fc:	75 49                	jne    1547 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    14fe:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1501:	83 f8 2f             	cmp    $0x2f,%eax
+    1504:	77 17                	ja     151d <printf+0x18a>
+    1506:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    150a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    150d:	89 d2                	mov    %edx,%edx
+    150f:	48 01 d0             	add    %rdx,%rax
+    1512:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1515:	83 c2 08             	add    $0x8,%edx
+    1518:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    151b:	eb 0c                	jmp    1529 <printf+0x196>
+    151d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1521:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1525:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1529:	48 8b 00             	mov    (%rax),%rax
+    152c:	89 c6                	mov    %eax,%esi
+    152e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1531:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1536:	ba 10 00 00 00       	mov    $0x10,%edx
+    153b:	89 c7                	mov    %eax,%edi
+    153d:	e8 b8 fc ff ff       	call   11fa <printint64>
+        if (lflag == 1)
+    1542:	e9 f5 00 00 00       	jmp    163c <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1547:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    154a:	83 f8 2f             	cmp    $0x2f,%eax
+    154d:	77 17                	ja     1566 <printf+0x1d3>
+    154f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1553:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1556:	89 d2                	mov    %edx,%edx
+    1558:	48 01 d0             	add    %rdx,%rax
+    155b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    155e:	83 c2 08             	add    $0x8,%edx
+    1561:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1564:	eb 0c                	jmp    1572 <printf+0x1df>
+    1566:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    156a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    156e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1572:	8b 30                	mov    (%rax),%esi
+    1574:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1577:	b9 00 00 00 00       	mov    $0x0,%ecx
+    157c:	ba 10 00 00 00       	mov    $0x10,%edx
+    1581:	89 c7                	mov    %eax,%edi
+    1583:	e8 46 fd ff ff       	call   12ce <printint>
+        if (lflag == 1)
+    1588:	e9 af 00 00 00       	jmp    163c <printf+0x2a9>
+      } else if(c == 's'){
+    158d:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1591:	75 6e                	jne    1601 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    1593:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1596:	83 f8 2f             	cmp    $0x2f,%eax
+    1599:	77 17                	ja     15b2 <printf+0x21f>
+    159b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    159f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15a2:	89 d2                	mov    %edx,%edx
+    15a4:	48 01 d0             	add    %rdx,%rax
+    15a7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    15aa:	83 c2 08             	add    $0x8,%edx
+    15ad:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    15b0:	eb 0c                	jmp    15be <printf+0x22b>
+    15b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    15b6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    15ba:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    15be:	48 8b 00             	mov    (%rax),%rax
+    15c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    15c5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    15ca:	75 28                	jne    15f4 <printf+0x261>
+          s = "(null)";
+    15cc:	48 8d 05 01 0b 00 00 	lea    0xb01(%rip),%rax        # 20d4 <malloc+0x4bf>
+    15d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    15d7:	eb 1b                	jmp    15f4 <printf+0x261>
+          putc(fd, *s);
+    15d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    15dd:	0f b6 00             	movzbl (%rax),%eax
+    15e0:	0f be d0             	movsbl %al,%edx
+    15e3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    15e6:	89 d6                	mov    %edx,%esi
+    15e8:	89 c7                	mov    %eax,%edi
+    15ea:	e8 e2 fb ff ff       	call   11d1 <putc>
+        for(; *s; s++)
+    15ef:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    15f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    15f8:	0f b6 00             	movzbl (%rax),%eax
+    15fb:	84 c0                	test   %al,%al
+    15fd:	75 da                	jne    15d9 <printf+0x246>
+    15ff:	eb 3b                	jmp    163c <printf+0x2a9>
+      } else if(c == '%'){
+    1601:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    1605:	75 14                	jne    161b <printf+0x288>
+        putc(fd, c);
+    1607:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    160a:	0f be d0             	movsbl %al,%edx
+    160d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1610:	89 d6                	mov    %edx,%esi
+    1612:	89 c7                	mov    %eax,%edi
+    1614:	e8 b8 fb ff ff       	call   11d1 <putc>
+    1619:	eb 21                	jmp    163c <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    161b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    161e:	be 25 00 00 00       	mov    $0x25,%esi
+    1623:	89 c7                	mov    %eax,%edi
+    1625:	e8 a7 fb ff ff       	call   11d1 <putc>
+        putc(fd, c);
+    162a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    162d:	0f be d0             	movsbl %al,%edx
+    1630:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1633:	89 d6                	mov    %edx,%esi
+    1635:	89 c7                	mov    %eax,%edi
+    1637:	e8 95 fb ff ff       	call   11d1 <putc>
+      }
+      state = 0;
+    163c:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1643:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1647:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    164a:	48 63 d0             	movslq %eax,%rdx
+    164d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    1651:	48 01 d0             	add    %rdx,%rax
+    1654:	0f b6 00             	movzbl (%rax),%eax
+    1657:	84 c0                	test   %al,%al
+    1659:	0f 85 7d fd ff ff    	jne    13dc <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    165f:	90                   	nop
+    1660:	90                   	nop
+    1661:	c9                   	leave
+    1662:	c3                   	ret
+
+0000000000001663 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    1663:	55                   	push   %rbp
+    1664:	48 89 e5             	mov    %rsp,%rbp
+    1667:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    166b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    166e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    1671:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    1675:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1678:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    167b:	48 89 ce             	mov    %rcx,%rsi
+    167e:	48 89 f7             	mov    %rsi,%rdi
+    1681:	89 d1                	mov    %edx,%ecx
+    1683:	fc                   	cld
+    1684:	f3 aa                	rep stos %al,%es:(%rdi)
+    1686:	89 ca                	mov    %ecx,%edx
+    1688:	48 89 fe             	mov    %rdi,%rsi
+    168b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    168f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    1692:	90                   	nop
+    1693:	5d                   	pop    %rbp
+    1694:	c3                   	ret
+
+0000000000001695 <strcpy>:
+{
+    1695:	55                   	push   %rbp
+    1696:	48 89 e5             	mov    %rsp,%rbp
+    1699:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    169d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    16a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    16a9:	90                   	nop
+    16aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    16ae:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    16b2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    16b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    16ba:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    16be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    16c2:	0f b6 12             	movzbl (%rdx),%edx
+    16c5:	88 10                	mov    %dl,(%rax)
+    16c7:	0f b6 00             	movzbl (%rax),%eax
+    16ca:	84 c0                	test   %al,%al
+    16cc:	75 dc                	jne    16aa <strcpy+0x15>
+  return os;
+    16ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    16d2:	5d                   	pop    %rbp
+    16d3:	c3                   	ret
+
+00000000000016d4 <strcmp>:
+{
+    16d4:	55                   	push   %rbp
+    16d5:	48 89 e5             	mov    %rsp,%rbp
+    16d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    16dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    16e0:	eb 0a                	jmp    16ec <strcmp+0x18>
+    p++, q++;
+    16e2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    16e7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    16ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16f0:	0f b6 00             	movzbl (%rax),%eax
+    16f3:	84 c0                	test   %al,%al
+    16f5:	74 12                	je     1709 <strcmp+0x35>
+    16f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16fb:	0f b6 10             	movzbl (%rax),%edx
+    16fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1702:	0f b6 00             	movzbl (%rax),%eax
+    1705:	38 c2                	cmp    %al,%dl
+    1707:	74 d9                	je     16e2 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1709:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    170d:	0f b6 00             	movzbl (%rax),%eax
+    1710:	0f b6 d0             	movzbl %al,%edx
+    1713:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1717:	0f b6 00             	movzbl (%rax),%eax
+    171a:	0f b6 c0             	movzbl %al,%eax
+    171d:	29 c2                	sub    %eax,%edx
+    171f:	89 d0                	mov    %edx,%eax
+}
+    1721:	5d                   	pop    %rbp
+    1722:	c3                   	ret
+
+0000000000001723 <strlen>:
+{
+    1723:	55                   	push   %rbp
+    1724:	48 89 e5             	mov    %rsp,%rbp
+    1727:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    172b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1732:	eb 04                	jmp    1738 <strlen+0x15>
+    1734:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1738:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    173b:	48 63 d0             	movslq %eax,%rdx
+    173e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1742:	48 01 d0             	add    %rdx,%rax
+    1745:	0f b6 00             	movzbl (%rax),%eax
+    1748:	84 c0                	test   %al,%al
+    174a:	75 e8                	jne    1734 <strlen+0x11>
+  return n;
+    174c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    174f:	5d                   	pop    %rbp
+    1750:	c3                   	ret
+
+0000000000001751 <memset>:
+{
+    1751:	55                   	push   %rbp
+    1752:	48 89 e5             	mov    %rsp,%rbp
+    1755:	48 83 ec 10          	sub    $0x10,%rsp
+    1759:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    175d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1760:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    1763:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    1766:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1769:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    176d:	89 ce                	mov    %ecx,%esi
+    176f:	48 89 c7             	mov    %rax,%rdi
+    1772:	e8 ec fe ff ff       	call   1663 <stosb>
+  return dst;
+    1777:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    177b:	c9                   	leave
+    177c:	c3                   	ret
+
+000000000000177d <strchr>:
+{
+    177d:	55                   	push   %rbp
+    177e:	48 89 e5             	mov    %rsp,%rbp
+    1781:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1785:	89 f0                	mov    %esi,%eax
+    1787:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    178a:	eb 17                	jmp    17a3 <strchr+0x26>
+    if(*s == c)
+    178c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1790:	0f b6 00             	movzbl (%rax),%eax
+    1793:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1796:	75 06                	jne    179e <strchr+0x21>
+      return (char*)s;
+    1798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    179c:	eb 15                	jmp    17b3 <strchr+0x36>
+  for(; *s; s++)
+    179e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    17a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17a7:	0f b6 00             	movzbl (%rax),%eax
+    17aa:	84 c0                	test   %al,%al
+    17ac:	75 de                	jne    178c <strchr+0xf>
+  return 0;
+    17ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17b3:	5d                   	pop    %rbp
+    17b4:	c3                   	ret
+
+00000000000017b5 <gets>:
+gets(char *buf, int max)
+{
+    17b5:	55                   	push   %rbp
+    17b6:	48 89 e5             	mov    %rsp,%rbp
+    17b9:	48 83 ec 20          	sub    $0x20,%rsp
+    17bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    17c1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    17c4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    17cb:	eb 48                	jmp    1815 <gets+0x60>
+    cc = read(0, &c, 1);
+    17cd:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    17d1:	ba 01 00 00 00       	mov    $0x1,%edx
+    17d6:	48 89 c6             	mov    %rax,%rsi
+    17d9:	bf 00 00 00 00       	mov    $0x0,%edi
+    17de:	e8 6f 01 00 00       	call   1952 <read>
+    17e3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    17e6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    17ea:	7e 36                	jle    1822 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    17ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    17ef:	8d 50 01             	lea    0x1(%rax),%edx
+    17f2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    17f5:	48 63 d0             	movslq %eax,%rdx
+    17f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    17fc:	48 01 c2             	add    %rax,%rdx
+    17ff:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1803:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1805:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1809:	3c 0a                	cmp    $0xa,%al
+    180b:	74 16                	je     1823 <gets+0x6e>
+    180d:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1811:	3c 0d                	cmp    $0xd,%al
+    1813:	74 0e                	je     1823 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1815:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1818:	83 c0 01             	add    $0x1,%eax
+    181b:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    181e:	7f ad                	jg     17cd <gets+0x18>
+    1820:	eb 01                	jmp    1823 <gets+0x6e>
+      break;
+    1822:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1823:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1826:	48 63 d0             	movslq %eax,%rdx
+    1829:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    182d:	48 01 d0             	add    %rdx,%rax
+    1830:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1833:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1837:	c9                   	leave
+    1838:	c3                   	ret
+
+0000000000001839 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1839:	55                   	push   %rbp
+    183a:	48 89 e5             	mov    %rsp,%rbp
+    183d:	48 83 ec 20          	sub    $0x20,%rsp
+    1841:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1845:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    184d:	be 00 00 00 00       	mov    $0x0,%esi
+    1852:	48 89 c7             	mov    %rax,%rdi
+    1855:	e8 20 01 00 00       	call   197a <open>
+    185a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    185d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1861:	79 07                	jns    186a <stat+0x31>
+    return -1;
+    1863:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1868:	eb 21                	jmp    188b <stat+0x52>
+  r = fstat(fd, st);
+    186a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    186e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1871:	48 89 d6             	mov    %rdx,%rsi
+    1874:	89 c7                	mov    %eax,%edi
+    1876:	e8 17 01 00 00       	call   1992 <fstat>
+    187b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    187e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1881:	89 c7                	mov    %eax,%edi
+    1883:	e8 da 00 00 00       	call   1962 <close>
+  return r;
+    1888:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    188b:	c9                   	leave
+    188c:	c3                   	ret
+
+000000000000188d <atoi>:
+
+int
+atoi(const char *s)
+{
+    188d:	55                   	push   %rbp
+    188e:	48 89 e5             	mov    %rsp,%rbp
+    1891:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1895:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    189c:	eb 28                	jmp    18c6 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    189e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    18a1:	89 d0                	mov    %edx,%eax
+    18a3:	c1 e0 02             	shl    $0x2,%eax
+    18a6:	01 d0                	add    %edx,%eax
+    18a8:	01 c0                	add    %eax,%eax
+    18aa:	89 c1                	mov    %eax,%ecx
+    18ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    18b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    18b8:	0f b6 00             	movzbl (%rax),%eax
+    18bb:	0f be c0             	movsbl %al,%eax
+    18be:	01 c8                	add    %ecx,%eax
+    18c0:	83 e8 30             	sub    $0x30,%eax
+    18c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    18c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18ca:	0f b6 00             	movzbl (%rax),%eax
+    18cd:	3c 2f                	cmp    $0x2f,%al
+    18cf:	7e 0b                	jle    18dc <atoi+0x4f>
+    18d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18d5:	0f b6 00             	movzbl (%rax),%eax
+    18d8:	3c 39                	cmp    $0x39,%al
+    18da:	7e c2                	jle    189e <atoi+0x11>
+  return n;
+    18dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    18df:	5d                   	pop    %rbp
+    18e0:	c3                   	ret
+
+00000000000018e1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    18e1:	55                   	push   %rbp
+    18e2:	48 89 e5             	mov    %rsp,%rbp
+    18e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    18ed:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    18f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    18f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    18fc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1900:	eb 1d                	jmp    191f <memmove+0x3e>
+    *dst++ = *src++;
+    1902:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1906:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    190a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    190e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1912:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1916:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    191a:	0f b6 12             	movzbl (%rdx),%edx
+    191d:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    191f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1922:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1925:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1928:	85 c0                	test   %eax,%eax
+    192a:	7f d6                	jg     1902 <memmove+0x21>
+  return vdst;
+    192c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1930:	5d                   	pop    %rbp
+    1931:	c3                   	ret
+
+0000000000001932 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1932:	b8 01 00 00 00       	mov    $0x1,%eax
+    1937:	cd 40                	int    $0x40
+    1939:	c3                   	ret
+
+000000000000193a <exit>:
+SYSCALL(exit)
+    193a:	b8 02 00 00 00       	mov    $0x2,%eax
+    193f:	cd 40                	int    $0x40
+    1941:	c3                   	ret
+
+0000000000001942 <wait>:
+SYSCALL(wait)
+    1942:	b8 03 00 00 00       	mov    $0x3,%eax
+    1947:	cd 40                	int    $0x40
+    1949:	c3                   	ret
+
+000000000000194a <pipe>:
+SYSCALL(pipe)
+    194a:	b8 04 00 00 00       	mov    $0x4,%eax
+    194f:	cd 40                	int    $0x40
+    1951:	c3                   	ret
+
+0000000000001952 <read>:
+SYSCALL(read)
+    1952:	b8 05 00 00 00       	mov    $0x5,%eax
+    1957:	cd 40                	int    $0x40
+    1959:	c3                   	ret
+
+000000000000195a <write>:
+SYSCALL(write)
+    195a:	b8 10 00 00 00       	mov    $0x10,%eax
+    195f:	cd 40                	int    $0x40
+    1961:	c3                   	ret
+
+0000000000001962 <close>:
+SYSCALL(close)
+    1962:	b8 15 00 00 00       	mov    $0x15,%eax
+    1967:	cd 40                	int    $0x40
+    1969:	c3                   	ret
+
+000000000000196a <kill>:
+SYSCALL(kill)
+    196a:	b8 06 00 00 00       	mov    $0x6,%eax
+    196f:	cd 40                	int    $0x40
+    1971:	c3                   	ret
+
+0000000000001972 <exec>:
+SYSCALL(exec)
+    1972:	b8 07 00 00 00       	mov    $0x7,%eax
+    1977:	cd 40                	int    $0x40
+    1979:	c3                   	ret
+
+000000000000197a <open>:
+SYSCALL(open)
+    197a:	b8 0f 00 00 00       	mov    $0xf,%eax
+    197f:	cd 40                	int    $0x40
+    1981:	c3                   	ret
+
+0000000000001982 <mknod>:
+SYSCALL(mknod)
+    1982:	b8 11 00 00 00       	mov    $0x11,%eax
+    1987:	cd 40                	int    $0x40
+    1989:	c3                   	ret
+
+000000000000198a <unlink>:
+SYSCALL(unlink)
+    198a:	b8 12 00 00 00       	mov    $0x12,%eax
+    198f:	cd 40                	int    $0x40
+    1991:	c3                   	ret
+
+0000000000001992 <fstat>:
+SYSCALL(fstat)
+    1992:	b8 08 00 00 00       	mov    $0x8,%eax
+    1997:	cd 40                	int    $0x40
+    1999:	c3                   	ret
+
+000000000000199a <link>:
+SYSCALL(link)
+    199a:	b8 13 00 00 00       	mov    $0x13,%eax
+    199f:	cd 40                	int    $0x40
+    19a1:	c3                   	ret
+
+00000000000019a2 <mkdir>:
+SYSCALL(mkdir)
+    19a2:	b8 14 00 00 00       	mov    $0x14,%eax
+    19a7:	cd 40                	int    $0x40
+    19a9:	c3                   	ret
+
+00000000000019aa <chdir>:
+SYSCALL(chdir)
+    19aa:	b8 09 00 00 00       	mov    $0x9,%eax
+    19af:	cd 40                	int    $0x40
+    19b1:	c3                   	ret
+
+00000000000019b2 <dup>:
+SYSCALL(dup)
+    19b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19b7:	cd 40                	int    $0x40
+    19b9:	c3                   	ret
+
+00000000000019ba <getpid>:
+SYSCALL(getpid)
+    19ba:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19bf:	cd 40                	int    $0x40
+    19c1:	c3                   	ret
+
+00000000000019c2 <sbrk>:
+SYSCALL(sbrk)
+    19c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19c7:	cd 40                	int    $0x40
+    19c9:	c3                   	ret
+
+00000000000019ca <sleep>:
+SYSCALL(sleep)
+    19ca:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19cf:	cd 40                	int    $0x40
+    19d1:	c3                   	ret
+
+00000000000019d2 <uptime>:
+SYSCALL(uptime)
+    19d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+    19d7:	cd 40                	int    $0x40
+    19d9:	c3                   	ret
+
+00000000000019da <sysinfo>:
+SYSCALL(sysinfo)
+    19da:	b8 16 00 00 00       	mov    $0x16,%eax
+    19df:	cd 40                	int    $0x40
+    19e1:	c3                   	ret
+
+00000000000019e2 <mmap>:
+SYSCALL(mmap)
+    19e2:	b8 17 00 00 00       	mov    $0x17,%eax
+    19e7:	cd 40                	int    $0x40
+    19e9:	c3                   	ret
+
+00000000000019ea <munmap>:
+SYSCALL(munmap)
+    19ea:	b8 18 00 00 00       	mov    $0x18,%eax
+    19ef:	cd 40                	int    $0x40
+    19f1:	c3                   	ret
+
+00000000000019f2 <crashn>:
+SYSCALL(crashn)
+    19f2:	b8 19 00 00 00       	mov    $0x19,%eax
+    19f7:	cd 40                	int    $0x40
+    19f9:	c3                   	ret
+
+00000000000019fa <mmap2>:
+SYSCALL_ADDR(mmap2)
+    19fa:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    19ff:	cd 40                	int    $0x40
+    1a01:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a04:	74 02                	je     1a08 <mmap2+0xe>
+    1a06:	89 c0                	mov    %eax,%eax
+    1a08:	c3                   	ret
+
+0000000000001a09 <munmap2>:
+SYSCALL(munmap2)
+    1a09:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1a0e:	cd 40                	int    $0x40
+    1a10:	c3                   	ret
+
+0000000000001a11 <msync>:
+SYSCALL(msync)
+    1a11:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1a16:	cd 40                	int    $0x40
+    1a18:	c3                   	ret
+
+0000000000001a19 <sendfile>:
+SYSCALL(sendfile)
+    1a19:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1a1e:	cd 40                	int    $0x40
+    1a20:	c3                   	ret
+
+0000000000001a21 <splice>:
+SYSCALL(splice)
+    1a21:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1a26:	cd 40                	int    $0x40
+    1a28:	c3                   	ret
+
+0000000000001a29 <pread>:
+SYSCALL(pread)
+    1a29:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1a2e:	cd 40                	int    $0x40
+    1a30:	c3                   	ret
+
+0000000000001a31 <pwrite>:
+SYSCALL(pwrite)
+    1a31:	b8 20 00 00 00       	mov    $0x20,%eax
+    1a36:	cd 40                	int    $0x40
+    1a38:	c3                   	ret
+
+0000000000001a39 <readv>:
+SYSCALL(readv)
+    1a39:	b8 21 00 00 00       	mov    $0x21,%eax
+    1a3e:	cd 40                	int    $0x40
+    1a40:	c3                   	ret
+
+0000000000001a41 <writev>:
+SYSCALL(writev)
+    1a41:	b8 22 00 00 00       	mov    $0x22,%eax
+    1a46:	cd 40                	int    $0x40
+    1a48:	c3                   	ret
+
+0000000000001a49 <poll>:
+SYSCALL(poll)
+    1a49:	b8 23 00 00 00       	mov    $0x23,%eax
+    1a4e:	cd 40                	int    $0x40
+    1a50:	c3                   	ret
+
+0000000000001a51 <pipe2>:
+SYSCALL(pipe2)
+    1a51:	b8 24 00 00 00       	mov    $0x24,%eax
+    1a56:	cd 40                	int    $0x40
+    1a58:	c3                   	ret
+
+0000000000001a59 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1a59:	55                   	push   %rbp
+    1a5a:	48 89 e5             	mov    %rsp,%rbp
+    1a5d:	48 83 ec 20          	sub    $0x20,%rsp
+    1a61:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a69:	48 83 e8 10          	sub    $0x10,%rax
+    1a6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1a71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a75:	48 8b 10             	mov    (%rax),%rdx
+    1a78:	48 8d 05 c1 09 00 00 	lea    0x9c1(%rip),%rax        # 2440 <bigblock>
+    1a7f:	48 39 c2             	cmp    %rax,%rdx
+    1a82:	75 1f                	jne    1aa3 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1a84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a88:	8b 40 08             	mov    0x8(%rax),%eax
+    1a8b:	c1 e0 04             	shl    $0x4,%eax
+    1a8e:	89 c2                	mov    %eax,%edx
+    1a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1a94:	89 d6                	mov    %edx,%esi
+    1a96:	48 89 c7             	mov    %rax,%rdi
+    1a99:	e8 6b ff ff ff       	call   1a09 <munmap2>
+    return;
+    1a9e:	e9 0b 01 00 00       	jmp    1bae <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1aa3:	48 8b 05 86 09 00 00 	mov    0x986(%rip),%rax        # 2430 <freep>
+    1aaa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1aae:	eb 2f                	jmp    1adf <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ab4:	48 8b 00             	mov    (%rax),%rax
+    1ab7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1abb:	72 17                	jb     1ad4 <free+0x7b>
+    1abd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ac1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1ac5:	72 2f                	jb     1af6 <free+0x9d>
+    1ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1acb:	48 8b 00             	mov    (%rax),%rax
+    1ace:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1ad2:	72 22                	jb     1af6 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1ad4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ad8:	48 8b 00             	mov    (%rax),%rax
+    1adb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1adf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ae3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1ae7:	73 c7                	jae    1ab0 <free+0x57>
+    1ae9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1aed:	48 8b 00             	mov    (%rax),%rax
+    1af0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1af4:	73 ba                	jae    1ab0 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1afa:	8b 40 08             	mov    0x8(%rax),%eax
+    1afd:	89 c0                	mov    %eax,%eax
+    1aff:	48 c1 e0 04          	shl    $0x4,%rax
+    1b03:	48 89 c2             	mov    %rax,%rdx
+    1b06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b0a:	48 01 c2             	add    %rax,%rdx
+    1b0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b11:	48 8b 00             	mov    (%rax),%rax
+    1b14:	48 39 c2             	cmp    %rax,%rdx
+    1b17:	75 2d                	jne    1b46 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1b19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b1d:	8b 50 08             	mov    0x8(%rax),%edx
+    1b20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b24:	48 8b 00             	mov    (%rax),%rax
+    1b27:	8b 40 08             	mov    0x8(%rax),%eax
+    1b2a:	01 c2                	add    %eax,%edx
+    1b2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b30:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1b33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b37:	48 8b 00             	mov    (%rax),%rax
+    1b3a:	48 8b 10             	mov    (%rax),%rdx
+    1b3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b41:	48 89 10             	mov    %rdx,(%rax)
+    1b44:	eb 0e                	jmp    1b54 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b4a:	48 8b 10             	mov    (%rax),%rdx
+    1b4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b51:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1b54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b58:	8b 40 08             	mov    0x8(%rax),%eax
+    1b5b:	89 c0                	mov    %eax,%eax
+    1b5d:	48 c1 e0 04          	shl    $0x4,%rax
+    1b61:	48 89 c2             	mov    %rax,%rdx
+    1b64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b68:	48 01 d0             	add    %rdx,%rax
+    1b6b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1b6f:	75 27                	jne    1b98 <free+0x13f>
+    p->s.size += bp->s.size;
+    1b71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b75:	8b 50 08             	mov    0x8(%rax),%edx
+    1b78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b7c:	8b 40 08             	mov    0x8(%rax),%eax
+    1b7f:	01 c2                	add    %eax,%edx
+    1b81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b85:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1b88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1b8c:	48 8b 10             	mov    (%rax),%rdx
+    1b8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b93:	48 89 10             	mov    %rdx,(%rax)
+    1b96:	eb 0b                	jmp    1ba3 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b9c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1ba0:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ba7:	48 89 05 82 08 00 00 	mov    %rax,0x882(%rip)        # 2430 <freep>
+}
+    1bae:	c9                   	leave
+    1baf:	c3                   	ret
+
+0000000000001bb0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1bb0:	55                   	push   %rbp
+    1bb1:	48 89 e5             	mov    %rsp,%rbp
+    1bb4:	48 83 ec 20          	sub    $0x20,%rsp
+    1bb8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1bbb:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1bc2:	77 07                	ja     1bcb <morecore+0x1b>
+    nu = 4096;
+    1bc4:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1bce:	c1 e0 04             	shl    $0x4,%eax
+    1bd1:	89 c7                	mov    %eax,%edi
+    1bd3:	e8 ea fd ff ff       	call   19c2 <sbrk>
+    1bd8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1bdc:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1be1:	75 07                	jne    1bea <morecore+0x3a>
+    return 0;
+    1be3:	b8 00 00 00 00       	mov    $0x0,%eax
+    1be8:	eb 29                	jmp    1c13 <morecore+0x63>
+  hp = (Header*)p;
+    1bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1bee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1bf6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1bf9:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1bfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1c00:	48 83 c0 10          	add    $0x10,%rax
+    1c04:	48 89 c7             	mov    %rax,%rdi
+    1c07:	e8 4d fe ff ff       	call   1a59 <free>
+  return freep;
+    1c0c:	48 8b 05 1d 08 00 00 	mov    0x81d(%rip),%rax        # 2430 <freep>
+}
+    1c13:	c9                   	leave
+    1c14:	c3                   	ret
+
+0000000000001c15 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1c15:	55                   	push   %rbp
+    1c16:	48 89 e5             	mov    %rsp,%rbp
+    1c19:	48 83 ec 30          	sub    $0x30,%rsp
+    1c1d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1c20:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1c23:	48 83 c0 0f          	add    $0xf,%rax
+    1c27:	48 c1 e8 04          	shr    $0x4,%rax
+    1c2b:	83 c0 01             	add    $0x1,%eax
+    1c2e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1c31:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1c38:	76 62                	jbe    1c9c <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1c3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1c3d:	c1 e0 04             	shl    $0x4,%eax
+    1c40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1c46:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1c4c:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1c51:	ba 03 00 00 00       	mov    $0x3,%edx
+    1c56:	89 c6                	mov    %eax,%esi
+    1c58:	bf 00 00 00 00       	mov    $0x0,%edi
+    1c5d:	e8 98 fd ff ff       	call   19fa <mmap2>
+    1c62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1c66:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1c6b:	75 0a                	jne    1c77 <malloc+0x62>
+      return 0;
+    1c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c72:	e9 1c 01 00 00       	jmp    1d93 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c7b:	48 8d 15 be 07 00 00 	lea    0x7be(%rip),%rdx        # 2440 <bigblock>
+    1c82:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1c85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c89:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1c8c:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1c8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1c93:	48 83 c0 10          	add    $0x10,%rax
+    1c97:	e9 f7 00 00 00       	jmp    1d93 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1c9c:	48 8b 05 8d 07 00 00 	mov    0x78d(%rip),%rax        # 2430 <freep>
+    1ca3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ca7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1cac:	75 2e                	jne    1cdc <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1cae:	48 8d 05 6b 07 00 00 	lea    0x76b(%rip),%rax        # 2420 <base>
+    1cb5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1cb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cbd:	48 89 05 6c 07 00 00 	mov    %rax,0x76c(%rip)        # 2430 <freep>
+    1cc4:	48 8b 05 65 07 00 00 	mov    0x765(%rip),%rax        # 2430 <freep>
+    1ccb:	48 89 05 4e 07 00 00 	mov    %rax,0x74e(%rip)        # 2420 <base>
+    base.s.size = 0;
+    1cd2:	c7 05 4c 07 00 00 00 	movl   $0x0,0x74c(%rip)        # 2428 <base+0x8>
+    1cd9:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1cdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ce0:	48 8b 00             	mov    (%rax),%rax
+    1ce3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1ce7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ceb:	8b 40 08             	mov    0x8(%rax),%eax
+    1cee:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1cf1:	72 5f                	jb     1d52 <malloc+0x13d>
+      if(p->s.size == nunits)
+    1cf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1cf7:	8b 40 08             	mov    0x8(%rax),%eax
+    1cfa:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1cfd:	75 10                	jne    1d0f <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1cff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d03:	48 8b 10             	mov    (%rax),%rdx
+    1d06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d0a:	48 89 10             	mov    %rdx,(%rax)
+    1d0d:	eb 2e                	jmp    1d3d <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1d0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d13:	8b 40 08             	mov    0x8(%rax),%eax
+    1d16:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1d19:	89 c2                	mov    %eax,%edx
+    1d1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d1f:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1d22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d26:	8b 40 08             	mov    0x8(%rax),%eax
+    1d29:	89 c0                	mov    %eax,%eax
+    1d2b:	48 c1 e0 04          	shl    $0x4,%rax
+    1d2f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1d33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d37:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1d3a:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1d3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d41:	48 89 05 e8 06 00 00 	mov    %rax,0x6e8(%rip)        # 2430 <freep>
+      return (void*)(p + 1);
+    1d48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d4c:	48 83 c0 10          	add    $0x10,%rax
+    1d50:	eb 41                	jmp    1d93 <malloc+0x17e>
+    }
+    if(p == freep)
+    1d52:	48 8b 05 d7 06 00 00 	mov    0x6d7(%rip),%rax        # 2430 <freep>
+    1d59:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d5d:	75 1c                	jne    1d7b <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1d5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1d62:	89 c7                	mov    %eax,%edi
+    1d64:	e8 47 fe ff ff       	call   1bb0 <morecore>
+    1d69:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d6d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1d72:	75 07                	jne    1d7b <malloc+0x166>
+        return 0;
+    1d74:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d79:	eb 18                	jmp    1d93 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1d83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d87:	48 8b 00             	mov    (%rax),%rax
+    1d8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1d8e:	e9 54 ff ff ff       	jmp    1ce7 <malloc+0xd2>
+  }
+}
+    1d93:	c9                   	leave
+    1d94:	c3                   	ret
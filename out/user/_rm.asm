@@ -0,0 +1,1459 @@
+
+out/user/_rm:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <stat.h>
+#include <user.h>
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 20          	sub    $0x20,%rsp
+   8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+   b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  if(argc < 2){
+   f:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  13:	7f 1e                	jg     33 <main+0x33>
+    printf(2, "Usage: rm files...\n");
+  15:	48 8d 05 4d 0c 00 00 	lea    0xc4d(%rip),%rax        # c69 <malloc+0x180>
+  1c:	48 89 c6             	mov    %rax,%rsi
+  1f:	bf 02 00 00 00       	mov    $0x2,%edi
+  24:	b8 00 00 00 00       	mov    $0x0,%eax
+  29:	e8 39 02 00 00       	call   267 <printf>
+    exit();
+  2e:	e8 db 07 00 00       	call   80e <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  33:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  3a:	eb 5c                	jmp    98 <main+0x98>
+    if(unlink(argv[i]) < 0){
+  3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  3f:	48 98                	cltq
+  41:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  48:	00 
+  49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  4d:	48 01 d0             	add    %rdx,%rax
+  50:	48 8b 00             	mov    (%rax),%rax
+  53:	48 89 c7             	mov    %rax,%rdi
+  56:	e8 03 08 00 00       	call   85e <unlink>
+  5b:	85 c0                	test   %eax,%eax
+  5d:	79 35                	jns    94 <main+0x94>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  62:	48 98                	cltq
+  64:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  6b:	00 
+  6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  70:	48 01 d0             	add    %rdx,%rax
+  73:	48 8b 00             	mov    (%rax),%rax
+  76:	48 89 c2             	mov    %rax,%rdx
+  79:	48 8d 05 fd 0b 00 00 	lea    0xbfd(%rip),%rax        # c7d <malloc+0x194>
+  80:	48 89 c6             	mov    %rax,%rsi
+  83:	bf 02 00 00 00       	mov    $0x2,%edi
+  88:	b8 00 00 00 00       	mov    $0x0,%eax
+  8d:	e8 d5 01 00 00       	call   267 <printf>
+      break;
+  92:	eb 0c                	jmp    a0 <main+0xa0>
+  for(i = 1; i < argc; i++){
+  94:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  9b:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  9e:	7c 9c                	jl     3c <main+0x3c>
+    }
+  }
+
+  exit();
+  a0:	e8 69 07 00 00       	call   80e <exit>
+
+00000000000000a5 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+  a5:	55                   	push   %rbp
+  a6:	48 89 e5             	mov    %rsp,%rbp
+  a9:	48 83 ec 10          	sub    $0x10,%rsp
+  ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  b0:	89 f0                	mov    %esi,%eax
+  b2:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+  b5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  bc:	ba 01 00 00 00       	mov    $0x1,%edx
+  c1:	48 89 ce             	mov    %rcx,%rsi
+  c4:	89 c7                	mov    %eax,%edi
+  c6:	e8 63 07 00 00       	call   82e <write>
+}
+  cb:	90                   	nop
+  cc:	c9                   	leave
+  cd:	c3                   	ret
+
+00000000000000ce <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+  ce:	55                   	push   %rbp
+  cf:	48 89 e5             	mov    %rsp,%rbp
+  d2:	48 83 ec 40          	sub    $0x40,%rsp
+  d6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  d9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  dc:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  df:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+  e2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  e6:	74 1f                	je     107 <printint64+0x39>
+  e8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  eb:	c1 e8 1f             	shr    $0x1f,%eax
+  ee:	0f b6 c0             	movzbl %al,%eax
+  f1:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  f4:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  f8:	74 0d                	je     107 <printint64+0x39>
+    x = -xx;
+  fa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  fd:	f7 d8                	neg    %eax
+  ff:	48 98                	cltq
+ 101:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 105:	eb 09                	jmp    110 <printint64+0x42>
+  else
+    x = xx;
+ 107:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 10a:	48 98                	cltq
+ 10c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 110:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 117:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 11a:	48 63 c8             	movslq %eax,%rcx
+ 11d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 121:	ba 00 00 00 00       	mov    $0x0,%edx
+ 126:	48 f7 f1             	div    %rcx
+ 129:	48 89 d1             	mov    %rdx,%rcx
+ 12c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 12f:	8d 50 01             	lea    0x1(%rax),%edx
+ 132:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 135:	48 8d 15 c4 0d 00 00 	lea    0xdc4(%rip),%rdx        # f00 <digits.1>
+ 13c:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 140:	48 98                	cltq
+ 142:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 146:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 149:	48 63 f0             	movslq %eax,%rsi
+ 14c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 150:	ba 00 00 00 00       	mov    $0x0,%edx
+ 155:	48 f7 f6             	div    %rsi
+ 158:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 15c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 161:	75 b4                	jne    117 <printint64+0x49>
+
+  if(sgn)
+ 163:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 167:	74 2b                	je     194 <printint64+0xc6>
+    buf[i++] = '-';
+ 169:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 16c:	8d 50 01             	lea    0x1(%rax),%edx
+ 16f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 172:	48 98                	cltq
+ 174:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 179:	eb 19                	jmp    194 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 17b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 17e:	48 98                	cltq
+ 180:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 185:	0f be d0             	movsbl %al,%edx
+ 188:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 18b:	89 d6                	mov    %edx,%esi
+ 18d:	89 c7                	mov    %eax,%edi
+ 18f:	e8 11 ff ff ff       	call   a5 <putc>
+  while(--i >= 0)
+ 194:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 198:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 19c:	79 dd                	jns    17b <printint64+0xad>
+}
+ 19e:	90                   	nop
+ 19f:	90                   	nop
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+
+00000000000001a2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1a2:	55                   	push   %rbp
+ 1a3:	48 89 e5             	mov    %rsp,%rbp
+ 1a6:	48 83 ec 30          	sub    $0x30,%rsp
+ 1aa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 1ad:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 1b0:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1b3:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1b6:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 1bd:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1c1:	74 17                	je     1da <printint+0x38>
+ 1c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1c7:	79 11                	jns    1da <printint+0x38>
+    neg = 1;
+ 1c9:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1d0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1d3:	f7 d8                	neg    %eax
+ 1d5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1d8:	eb 06                	jmp    1e0 <printint+0x3e>
+  } else {
+    x = xx;
+ 1da:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1dd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 1e7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1ed:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1f2:	f7 f1                	div    %ecx
+ 1f4:	89 d1                	mov    %edx,%ecx
+ 1f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 1f9:	8d 50 01             	lea    0x1(%rax),%edx
+ 1fc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 1ff:	89 c9                	mov    %ecx,%ecx
+ 201:	48 8d 15 18 0d 00 00 	lea    0xd18(%rip),%rdx        # f20 <digits.0>
+ 208:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 20c:	48 98                	cltq
+ 20e:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 212:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 215:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 218:	ba 00 00 00 00       	mov    $0x0,%edx
+ 21d:	f7 f6                	div    %esi
+ 21f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 222:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 226:	75 bf                	jne    1e7 <printint+0x45>
+  if(neg)
+ 228:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 22c:	74 2b                	je     259 <printint+0xb7>
+    buf[i++] = '-';
+ 22e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 231:	8d 50 01             	lea    0x1(%rax),%edx
+ 234:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 237:	48 98                	cltq
+ 239:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 23e:	eb 19                	jmp    259 <printint+0xb7>
+    putc(fd, buf[i]);
+ 240:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 243:	48 98                	cltq
+ 245:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 24a:	0f be d0             	movsbl %al,%edx
+ 24d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 250:	89 d6                	mov    %edx,%esi
+ 252:	89 c7                	mov    %eax,%edi
+ 254:	e8 4c fe ff ff       	call   a5 <putc>
+  while(--i >= 0)
+ 259:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 25d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 261:	79 dd                	jns    240 <printint+0x9e>
+}
+ 263:	90                   	nop
+ 264:	90                   	nop
+ 265:	c9                   	leave
+ 266:	c3                   	ret
+
+0000000000000267 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 267:	55                   	push   %rbp
+ 268:	48 89 e5             	mov    %rsp,%rbp
+ 26b:	48 83 ec 70          	sub    $0x70,%rsp
+ 26f:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 272:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 276:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 27a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 27e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 282:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 286:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 28d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 291:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 295:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 299:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 29d:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2a4:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 2ab:	e9 6b 02 00 00       	jmp    51b <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 2b0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2b3:	48 63 d0             	movslq %eax,%rdx
+ 2b6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2ba:	48 01 d0             	add    %rdx,%rax
+ 2bd:	0f b6 00             	movzbl (%rax),%eax
+ 2c0:	0f be c0             	movsbl %al,%eax
+ 2c3:	25 ff 00 00 00       	and    $0xff,%eax
+ 2c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 2cb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2cf:	75 30                	jne    301 <printf+0x9a>
+      if(c == '%'){
+ 2d1:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2d5:	75 13                	jne    2ea <printf+0x83>
+        state = '%';
+ 2d7:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2de:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2e5:	e9 2d 02 00 00       	jmp    517 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2ed:	0f be d0             	movsbl %al,%edx
+ 2f0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 2f3:	89 d6                	mov    %edx,%esi
+ 2f5:	89 c7                	mov    %eax,%edi
+ 2f7:	e8 a9 fd ff ff       	call   a5 <putc>
+ 2fc:	e9 16 02 00 00       	jmp    517 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 301:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 305:	0f 85 0c 02 00 00    	jne    517 <printf+0x2b0>
+      if(c == 'l') {
+ 30b:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 30f:	75 0c                	jne    31d <printf+0xb6>
+        lflag = 1;
+ 311:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 318:	e9 fa 01 00 00       	jmp    517 <printf+0x2b0>
+      } else if(c == 'd'){
+ 31d:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 321:	0f 85 95 00 00 00    	jne    3bc <printf+0x155>
+        if (lflag == 1)
+ 327:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 32b:	75 49                	jne    376 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 32d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 330:	83 f8 2f             	cmp    $0x2f,%eax
+ 333:	77 17                	ja     34c <printf+0xe5>
+ 335:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 339:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 33c:	89 d2                	mov    %edx,%edx
+ 33e:	48 01 d0             	add    %rdx,%rax
+ 341:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 344:	83 c2 08             	add    $0x8,%edx
+ 347:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 34a:	eb 0c                	jmp    358 <printf+0xf1>
+ 34c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 350:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 354:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 358:	48 8b 00             	mov    (%rax),%rax
+ 35b:	89 c6                	mov    %eax,%esi
+ 35d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 360:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 365:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 36a:	89 c7                	mov    %eax,%edi
+ 36c:	e8 5d fd ff ff       	call   ce <printint64>
+ 371:	e9 9a 01 00 00       	jmp    510 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 376:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 379:	83 f8 2f             	cmp    $0x2f,%eax
+ 37c:	77 17                	ja     395 <printf+0x12e>
+ 37e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 382:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 385:	89 d2                	mov    %edx,%edx
+ 387:	48 01 d0             	add    %rdx,%rax
+ 38a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 38d:	83 c2 08             	add    $0x8,%edx
+ 390:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 393:	eb 0c                	jmp    3a1 <printf+0x13a>
+ 395:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 399:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 39d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3a1:	8b 30                	mov    (%rax),%esi
+ 3a3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3a6:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3ab:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3b0:	89 c7                	mov    %eax,%edi
+ 3b2:	e8 eb fd ff ff       	call   1a2 <printint>
+ 3b7:	e9 54 01 00 00       	jmp    510 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 3bc:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3c0:	74 0a                	je     3cc <printf+0x165>
+ 3c2:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3c6:	0f 85 95 00 00 00    	jne    461 <printf+0x1fa>
+        if (lflag == 1)
+ 3cc:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3d0:	75 49                	jne    41b <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3d2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3d5:	83 f8 2f             	cmp    $0x2f,%eax
+ 3d8:	77 17                	ja     3f1 <printf+0x18a>
+ 3da:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3de:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e1:	89 d2                	mov    %edx,%edx
+ 3e3:	48 01 d0             	add    %rdx,%rax
+ 3e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3e9:	83 c2 08             	add    $0x8,%edx
+ 3ec:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3ef:	eb 0c                	jmp    3fd <printf+0x196>
+ 3f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3f5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3f9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3fd:	48 8b 00             	mov    (%rax),%rax
+ 400:	89 c6                	mov    %eax,%esi
+ 402:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 405:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 40a:	ba 10 00 00 00       	mov    $0x10,%edx
+ 40f:	89 c7                	mov    %eax,%edi
+ 411:	e8 b8 fc ff ff       	call   ce <printint64>
+        if (lflag == 1)
+ 416:	e9 f5 00 00 00       	jmp    510 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 41b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 41e:	83 f8 2f             	cmp    $0x2f,%eax
+ 421:	77 17                	ja     43a <printf+0x1d3>
+ 423:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 427:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 42a:	89 d2                	mov    %edx,%edx
+ 42c:	48 01 d0             	add    %rdx,%rax
+ 42f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 432:	83 c2 08             	add    $0x8,%edx
+ 435:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 438:	eb 0c                	jmp    446 <printf+0x1df>
+ 43a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 43e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 442:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 446:	8b 30                	mov    (%rax),%esi
+ 448:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 44b:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 450:	ba 10 00 00 00       	mov    $0x10,%edx
+ 455:	89 c7                	mov    %eax,%edi
+ 457:	e8 46 fd ff ff       	call   1a2 <printint>
+        if (lflag == 1)
+ 45c:	e9 af 00 00 00       	jmp    510 <printf+0x2a9>
+      } else if(c == 's'){
+ 461:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 465:	75 6e                	jne    4d5 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 467:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 46a:	83 f8 2f             	cmp    $0x2f,%eax
+ 46d:	77 17                	ja     486 <printf+0x21f>
+ 46f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 473:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 476:	89 d2                	mov    %edx,%edx
+ 478:	48 01 d0             	add    %rdx,%rax
+ 47b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 47e:	83 c2 08             	add    $0x8,%edx
+ 481:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 484:	eb 0c                	jmp    492 <printf+0x22b>
+ 486:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 48a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 48e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 492:	48 8b 00             	mov    (%rax),%rax
+ 495:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 499:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 49e:	75 28                	jne    4c8 <printf+0x261>
+          s = "(null)";
+ 4a0:	48 8d 05 ef 07 00 00 	lea    0x7ef(%rip),%rax        # c96 <malloc+0x1ad>
+ 4a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 4ab:	eb 1b                	jmp    4c8 <printf+0x261>
+          putc(fd, *s);
+ 4ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4b1:	0f b6 00             	movzbl (%rax),%eax
+ 4b4:	0f be d0             	movsbl %al,%edx
+ 4b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4ba:	89 d6                	mov    %edx,%esi
+ 4bc:	89 c7                	mov    %eax,%edi
+ 4be:	e8 e2 fb ff ff       	call   a5 <putc>
+        for(; *s; s++)
+ 4c3:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4cc:	0f b6 00             	movzbl (%rax),%eax
+ 4cf:	84 c0                	test   %al,%al
+ 4d1:	75 da                	jne    4ad <printf+0x246>
+ 4d3:	eb 3b                	jmp    510 <printf+0x2a9>
+      } else if(c == '%'){
+ 4d5:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4d9:	75 14                	jne    4ef <printf+0x288>
+        putc(fd, c);
+ 4db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4de:	0f be d0             	movsbl %al,%edx
+ 4e1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4e4:	89 d6                	mov    %edx,%esi
+ 4e6:	89 c7                	mov    %eax,%edi
+ 4e8:	e8 b8 fb ff ff       	call   a5 <putc>
+ 4ed:	eb 21                	jmp    510 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 4ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f2:	be 25 00 00 00       	mov    $0x25,%esi
+ 4f7:	89 c7                	mov    %eax,%edi
+ 4f9:	e8 a7 fb ff ff       	call   a5 <putc>
+        putc(fd, c);
+ 4fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 501:	0f be d0             	movsbl %al,%edx
+ 504:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 507:	89 d6                	mov    %edx,%esi
+ 509:	89 c7                	mov    %eax,%edi
+ 50b:	e8 95 fb ff ff       	call   a5 <putc>
+      }
+      state = 0;
+ 510:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 517:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 51b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 51e:	48 63 d0             	movslq %eax,%rdx
+ 521:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 525:	48 01 d0             	add    %rdx,%rax
+ 528:	0f b6 00             	movzbl (%rax),%eax
+ 52b:	84 c0                	test   %al,%al
+ 52d:	0f 85 7d fd ff ff    	jne    2b0 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 533:	90                   	nop
+ 534:	90                   	nop
+ 535:	c9                   	leave
+ 536:	c3                   	ret
+
+0000000000000537 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 537:	55                   	push   %rbp
+ 538:	48 89 e5             	mov    %rsp,%rbp
+ 53b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 53f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 542:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 545:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 549:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 54c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 54f:	48 89 ce             	mov    %rcx,%rsi
+ 552:	48 89 f7             	mov    %rsi,%rdi
+ 555:	89 d1                	mov    %edx,%ecx
+ 557:	fc                   	cld
+ 558:	f3 aa                	rep stos %al,%es:(%rdi)
+ 55a:	89 ca                	mov    %ecx,%edx
+ 55c:	48 89 fe             	mov    %rdi,%rsi
+ 55f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 563:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 566:	90                   	nop
+ 567:	5d                   	pop    %rbp
+ 568:	c3                   	ret
+
+0000000000000569 <strcpy>:
+{
+ 569:	55                   	push   %rbp
+ 56a:	48 89 e5             	mov    %rsp,%rbp
+ 56d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 571:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 575:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 579:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 57d:	90                   	nop
+ 57e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 582:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 586:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 58a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 58e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 592:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 596:	0f b6 12             	movzbl (%rdx),%edx
+ 599:	88 10                	mov    %dl,(%rax)
+ 59b:	0f b6 00             	movzbl (%rax),%eax
+ 59e:	84 c0                	test   %al,%al
+ 5a0:	75 dc                	jne    57e <strcpy+0x15>
+  return os;
+ 5a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 5a6:	5d                   	pop    %rbp
+ 5a7:	c3                   	ret
+
+00000000000005a8 <strcmp>:
+{
+ 5a8:	55                   	push   %rbp
+ 5a9:	48 89 e5             	mov    %rsp,%rbp
+ 5ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5b4:	eb 0a                	jmp    5c0 <strcmp+0x18>
+    p++, q++;
+ 5b6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5bb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5c4:	0f b6 00             	movzbl (%rax),%eax
+ 5c7:	84 c0                	test   %al,%al
+ 5c9:	74 12                	je     5dd <strcmp+0x35>
+ 5cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5cf:	0f b6 10             	movzbl (%rax),%edx
+ 5d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5d6:	0f b6 00             	movzbl (%rax),%eax
+ 5d9:	38 c2                	cmp    %al,%dl
+ 5db:	74 d9                	je     5b6 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5e1:	0f b6 00             	movzbl (%rax),%eax
+ 5e4:	0f b6 d0             	movzbl %al,%edx
+ 5e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5eb:	0f b6 00             	movzbl (%rax),%eax
+ 5ee:	0f b6 c0             	movzbl %al,%eax
+ 5f1:	29 c2                	sub    %eax,%edx
+ 5f3:	89 d0                	mov    %edx,%eax
+}
+ 5f5:	5d                   	pop    %rbp
+ 5f6:	c3                   	ret
+
+00000000000005f7 <strlen>:
+{
+ 5f7:	55                   	push   %rbp
+ 5f8:	48 89 e5             	mov    %rsp,%rbp
+ 5fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 5ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 606:	eb 04                	jmp    60c <strlen+0x15>
+ 608:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 60c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 60f:	48 63 d0             	movslq %eax,%rdx
+ 612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 616:	48 01 d0             	add    %rdx,%rax
+ 619:	0f b6 00             	movzbl (%rax),%eax
+ 61c:	84 c0                	test   %al,%al
+ 61e:	75 e8                	jne    608 <strlen+0x11>
+  return n;
+ 620:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 623:	5d                   	pop    %rbp
+ 624:	c3                   	ret
+
+0000000000000625 <memset>:
+{
+ 625:	55                   	push   %rbp
+ 626:	48 89 e5             	mov    %rsp,%rbp
+ 629:	48 83 ec 10          	sub    $0x10,%rsp
+ 62d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 631:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 634:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 637:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 63a:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 63d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 641:	89 ce                	mov    %ecx,%esi
+ 643:	48 89 c7             	mov    %rax,%rdi
+ 646:	e8 ec fe ff ff       	call   537 <stosb>
+  return dst;
+ 64b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 64f:	c9                   	leave
+ 650:	c3                   	ret
+
+0000000000000651 <strchr>:
+{
+ 651:	55                   	push   %rbp
+ 652:	48 89 e5             	mov    %rsp,%rbp
+ 655:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 659:	89 f0                	mov    %esi,%eax
+ 65b:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 65e:	eb 17                	jmp    677 <strchr+0x26>
+    if(*s == c)
+ 660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 664:	0f b6 00             	movzbl (%rax),%eax
+ 667:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 66a:	75 06                	jne    672 <strchr+0x21>
+      return (char*)s;
+ 66c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 670:	eb 15                	jmp    687 <strchr+0x36>
+  for(; *s; s++)
+ 672:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 67b:	0f b6 00             	movzbl (%rax),%eax
+ 67e:	84 c0                	test   %al,%al
+ 680:	75 de                	jne    660 <strchr+0xf>
+  return 0;
+ 682:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 687:	5d                   	pop    %rbp
+ 688:	c3                   	ret
+
+0000000000000689 <gets>:
+gets(char *buf, int max)
+{
+ 689:	55                   	push   %rbp
+ 68a:	48 89 e5             	mov    %rsp,%rbp
+ 68d:	48 83 ec 20          	sub    $0x20,%rsp
+ 691:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 695:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 698:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 69f:	eb 48                	jmp    6e9 <gets+0x60>
+    cc = read(0, &c, 1);
+ 6a1:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 6a5:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6aa:	48 89 c6             	mov    %rax,%rsi
+ 6ad:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6b2:	e8 6f 01 00 00       	call   826 <read>
+ 6b7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 6ba:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6be:	7e 36                	jle    6f6 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 6c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6c3:	8d 50 01             	lea    0x1(%rax),%edx
+ 6c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6c9:	48 63 d0             	movslq %eax,%rdx
+ 6cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6d0:	48 01 c2             	add    %rax,%rdx
+ 6d3:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6d7:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 6d9:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6dd:	3c 0a                	cmp    $0xa,%al
+ 6df:	74 16                	je     6f7 <gets+0x6e>
+ 6e1:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6e5:	3c 0d                	cmp    $0xd,%al
+ 6e7:	74 0e                	je     6f7 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 6e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6ec:	83 c0 01             	add    $0x1,%eax
+ 6ef:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 6f2:	7f ad                	jg     6a1 <gets+0x18>
+ 6f4:	eb 01                	jmp    6f7 <gets+0x6e>
+      break;
+ 6f6:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 6f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6fa:	48 63 d0             	movslq %eax,%rdx
+ 6fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 701:	48 01 d0             	add    %rdx,%rax
+ 704:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 707:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 70b:	c9                   	leave
+ 70c:	c3                   	ret
+
+000000000000070d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 70d:	55                   	push   %rbp
+ 70e:	48 89 e5             	mov    %rsp,%rbp
+ 711:	48 83 ec 20          	sub    $0x20,%rsp
+ 715:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 719:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 71d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 721:	be 00 00 00 00       	mov    $0x0,%esi
+ 726:	48 89 c7             	mov    %rax,%rdi
+ 729:	e8 20 01 00 00       	call   84e <open>
+ 72e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 731:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 735:	79 07                	jns    73e <stat+0x31>
+    return -1;
+ 737:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 73c:	eb 21                	jmp    75f <stat+0x52>
+  r = fstat(fd, st);
+ 73e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 745:	48 89 d6             	mov    %rdx,%rsi
+ 748:	89 c7                	mov    %eax,%edi
+ 74a:	e8 17 01 00 00       	call   866 <fstat>
+ 74f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 752:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 755:	89 c7                	mov    %eax,%edi
+ 757:	e8 da 00 00 00       	call   836 <close>
+  return r;
+ 75c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 75f:	c9                   	leave
+ 760:	c3                   	ret
+
+0000000000000761 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 761:	55                   	push   %rbp
+ 762:	48 89 e5             	mov    %rsp,%rbp
+ 765:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 769:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 770:	eb 28                	jmp    79a <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 772:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 775:	89 d0                	mov    %edx,%eax
+ 777:	c1 e0 02             	shl    $0x2,%eax
+ 77a:	01 d0                	add    %edx,%eax
+ 77c:	01 c0                	add    %eax,%eax
+ 77e:	89 c1                	mov    %eax,%ecx
+ 780:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 784:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 788:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 78c:	0f b6 00             	movzbl (%rax),%eax
+ 78f:	0f be c0             	movsbl %al,%eax
+ 792:	01 c8                	add    %ecx,%eax
+ 794:	83 e8 30             	sub    $0x30,%eax
+ 797:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 79a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 79e:	0f b6 00             	movzbl (%rax),%eax
+ 7a1:	3c 2f                	cmp    $0x2f,%al
+ 7a3:	7e 0b                	jle    7b0 <atoi+0x4f>
+ 7a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7a9:	0f b6 00             	movzbl (%rax),%eax
+ 7ac:	3c 39                	cmp    $0x39,%al
+ 7ae:	7e c2                	jle    772 <atoi+0x11>
+  return n;
+ 7b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7b3:	5d                   	pop    %rbp
+ 7b4:	c3                   	ret
+
+00000000000007b5 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 7b5:	55                   	push   %rbp
+ 7b6:	48 89 e5             	mov    %rsp,%rbp
+ 7b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7c1:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 7d4:	eb 1d                	jmp    7f3 <memmove+0x3e>
+    *dst++ = *src++;
+ 7d6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7da:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7e6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7ea:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7ee:	0f b6 12             	movzbl (%rdx),%edx
+ 7f1:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 7f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 7f6:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 7f9:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 7fc:	85 c0                	test   %eax,%eax
+ 7fe:	7f d6                	jg     7d6 <memmove+0x21>
+  return vdst;
+ 800:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 804:	5d                   	pop    %rbp
+ 805:	c3                   	ret
+
+0000000000000806 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 806:	b8 01 00 00 00       	mov    $0x1,%eax
+ 80b:	cd 40                	int    $0x40
+ 80d:	c3                   	ret
+
+000000000000080e <exit>:
+SYSCALL(exit)
+ 80e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 813:	cd 40                	int    $0x40
+ 815:	c3                   	ret
+
+0000000000000816 <wait>:
+SYSCALL(wait)
+ 816:	b8 03 00 00 00       	mov    $0x3,%eax
+ 81b:	cd 40                	int    $0x40
+ 81d:	c3                   	ret
+
+000000000000081e <pipe>:
+SYSCALL(pipe)
+ 81e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+0000000000000826 <read>:
+SYSCALL(read)
+ 826:	b8 05 00 00 00       	mov    $0x5,%eax
+ 82b:	cd 40                	int    $0x40
+ 82d:	c3                   	ret
+
+000000000000082e <write>:
+SYSCALL(write)
+ 82e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+0000000000000836 <close>:
+SYSCALL(close)
+ 836:	b8 15 00 00 00       	mov    $0x15,%eax
+ 83b:	cd 40                	int    $0x40
+ 83d:	c3                   	ret
+
+000000000000083e <kill>:
+SYSCALL(kill)
+ 83e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 843:	cd 40                	int    $0x40
+ 845:	c3                   	ret
+
+0000000000000846 <exec>:
+SYSCALL(exec)
+ 846:	b8 07 00 00 00       	mov    $0x7,%eax
+ 84b:	cd 40                	int    $0x40
+ 84d:	c3                   	ret
+
+000000000000084e <open>:
+SYSCALL(open)
+ 84e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+0000000000000856 <mknod>:
+SYSCALL(mknod)
+ 856:	b8 11 00 00 00       	mov    $0x11,%eax
+ 85b:	cd 40                	int    $0x40
+ 85d:	c3                   	ret
+
+000000000000085e <unlink>:
+SYSCALL(unlink)
+ 85e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 863:	cd 40                	int    $0x40
+ 865:	c3                   	ret
+
+0000000000000866 <fstat>:
+SYSCALL(fstat)
+ 866:	b8 08 00 00 00       	mov    $0x8,%eax
+ 86b:	cd 40                	int    $0x40
+ 86d:	c3                   	ret
+
+000000000000086e <link>:
+SYSCALL(link)
+ 86e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 873:	cd 40                	int    $0x40
+ 875:	c3                   	ret
+
+0000000000000876 <mkdir>:
+SYSCALL(mkdir)
+ 876:	b8 14 00 00 00       	mov    $0x14,%eax
+ 87b:	cd 40                	int    $0x40
+ 87d:	c3                   	ret
+
+000000000000087e <chdir>:
+SYSCALL(chdir)
+ 87e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+0000000000000886 <dup>:
+SYSCALL(dup)
+ 886:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 88b:	cd 40                	int    $0x40
+ 88d:	c3                   	ret
+
+000000000000088e <getpid>:
+SYSCALL(getpid)
+ 88e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 893:	cd 40                	int    $0x40
+ 895:	c3                   	ret
+
+0000000000000896 <sbrk>:
+SYSCALL(sbrk)
+ 896:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 89b:	cd 40                	int    $0x40
+ 89d:	c3                   	ret
+
+000000000000089e <sleep>:
+SYSCALL(sleep)
+ 89e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+00000000000008a6 <uptime>:
+SYSCALL(uptime)
+ 8a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8ab:	cd 40                	int    $0x40
+ 8ad:	c3                   	ret
+
+00000000000008ae <sysinfo>:
+SYSCALL(sysinfo)
+ 8ae:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b3:	cd 40                	int    $0x40
+ 8b5:	c3                   	ret
+
+00000000000008b6 <mmap>:
+SYSCALL(mmap)
+ 8b6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8bb:	cd 40                	int    $0x40
+ 8bd:	c3                   	ret
+
+00000000000008be <munmap>:
+SYSCALL(munmap)
+ 8be:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8c3:	cd 40                	int    $0x40
+ 8c5:	c3                   	ret
+
+00000000000008c6 <crashn>:
+SYSCALL(crashn)
+ 8c6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8cb:	cd 40                	int    $0x40
+ 8cd:	c3                   	ret
+
+00000000000008ce <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 8ce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8d3:	cd 40                	int    $0x40
+ 8d5:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8d8:	74 02                	je     8dc <mmap2+0xe>
+ 8da:	89 c0                	mov    %eax,%eax
+ 8dc:	c3                   	ret
+
+00000000000008dd <munmap2>:
+SYSCALL(munmap2)
+ 8dd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8e2:	cd 40                	int    $0x40
+ 8e4:	c3                   	ret
+
+00000000000008e5 <msync>:
+SYSCALL(msync)
+ 8e5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8ea:	cd 40                	int    $0x40
+ 8ec:	c3                   	ret
+
+00000000000008ed <sendfile>:
+SYSCALL(sendfile)
+ 8ed:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8f2:	cd 40                	int    $0x40
+ 8f4:	c3                   	ret
+
+00000000000008f5 <splice>:
+SYSCALL(splice)
+ 8f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8fa:	cd 40                	int    $0x40
+ 8fc:	c3                   	ret
+
+00000000000008fd <pread>:
+SYSCALL(pread)
+ 8fd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 902:	cd 40                	int    $0x40
+ 904:	c3                   	ret
+
+0000000000000905 <pwrite>:
+SYSCALL(pwrite)
+ 905:	b8 20 00 00 00       	mov    $0x20,%eax
+ 90a:	cd 40                	int    $0x40
+ 90c:	c3                   	ret
+
+000000000000090d <readv>:
+SYSCALL(readv)
+ 90d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 912:	cd 40                	int    $0x40
+ 914:	c3                   	ret
+
+0000000000000915 <writev>:
+SYSCALL(writev)
+ 915:	b8 22 00 00 00       	mov    $0x22,%eax
+ 91a:	cd 40                	int    $0x40
+ 91c:	c3                   	ret
+
+000000000000091d <poll>:
+SYSCALL(poll)
+ 91d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 922:	cd 40                	int    $0x40
+ 924:	c3                   	ret
+
+0000000000000925 <pipe2>:
+SYSCALL(pipe2)
+ 925:	b8 24 00 00 00       	mov    $0x24,%eax
+ 92a:	cd 40                	int    $0x40
+ 92c:	c3                   	ret
+
+000000000000092d <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ 92d:	55                   	push   %rbp
+ 92e:	48 89 e5             	mov    %rsp,%rbp
+ 931:	48 83 ec 20          	sub    $0x20,%rsp
+ 935:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 939:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 93d:	48 83 e8 10          	sub    $0x10,%rax
+ 941:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ 945:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 949:	48 8b 10             	mov    (%rax),%rdx
+ 94c:	48 8d 05 0d 06 00 00 	lea    0x60d(%rip),%rax        # f60 <bigblock>
+ 953:	48 39 c2             	cmp    %rax,%rdx
+ 956:	75 1f                	jne    977 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ 958:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 95c:	8b 40 08             	mov    0x8(%rax),%eax
+ 95f:	c1 e0 04             	shl    $0x4,%eax
+ 962:	89 c2                	mov    %eax,%edx
+ 964:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 968:	89 d6                	mov    %edx,%esi
+ 96a:	48 89 c7             	mov    %rax,%rdi
+ 96d:	e8 6b ff ff ff       	call   8dd <munmap2>
+    return;
+ 972:	e9 0b 01 00 00       	jmp    a82 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 977:	48 8b 05 d2 05 00 00 	mov    0x5d2(%rip),%rax        # f50 <freep>
+ 97e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 982:	eb 2f                	jmp    9b3 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 988:	48 8b 00             	mov    (%rax),%rax
+ 98b:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 98f:	72 17                	jb     9a8 <free+0x7b>
+ 991:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 995:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 999:	72 2f                	jb     9ca <free+0x9d>
+ 99b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 99f:	48 8b 00             	mov    (%rax),%rax
+ 9a2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9a6:	72 22                	jb     9ca <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9ac:	48 8b 00             	mov    (%rax),%rax
+ 9af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9b7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9bb:	73 c7                	jae    984 <free+0x57>
+ 9bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9c1:	48 8b 00             	mov    (%rax),%rax
+ 9c4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9c8:	73 ba                	jae    984 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ce:	8b 40 08             	mov    0x8(%rax),%eax
+ 9d1:	89 c0                	mov    %eax,%eax
+ 9d3:	48 c1 e0 04          	shl    $0x4,%rax
+ 9d7:	48 89 c2             	mov    %rax,%rdx
+ 9da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9de:	48 01 c2             	add    %rax,%rdx
+ 9e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9e5:	48 8b 00             	mov    (%rax),%rax
+ 9e8:	48 39 c2             	cmp    %rax,%rdx
+ 9eb:	75 2d                	jne    a1a <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ 9ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9f1:	8b 50 08             	mov    0x8(%rax),%edx
+ 9f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9f8:	48 8b 00             	mov    (%rax),%rax
+ 9fb:	8b 40 08             	mov    0x8(%rax),%eax
+ 9fe:	01 c2                	add    %eax,%edx
+ a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a04:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a0b:	48 8b 00             	mov    (%rax),%rax
+ a0e:	48 8b 10             	mov    (%rax),%rdx
+ a11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a15:	48 89 10             	mov    %rdx,(%rax)
+ a18:	eb 0e                	jmp    a28 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a1e:	48 8b 10             	mov    (%rax),%rdx
+ a21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a25:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a2c:	8b 40 08             	mov    0x8(%rax),%eax
+ a2f:	89 c0                	mov    %eax,%eax
+ a31:	48 c1 e0 04          	shl    $0x4,%rax
+ a35:	48 89 c2             	mov    %rax,%rdx
+ a38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a3c:	48 01 d0             	add    %rdx,%rax
+ a3f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a43:	75 27                	jne    a6c <free+0x13f>
+    p->s.size += bp->s.size;
+ a45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a49:	8b 50 08             	mov    0x8(%rax),%edx
+ a4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a50:	8b 40 08             	mov    0x8(%rax),%eax
+ a53:	01 c2                	add    %eax,%edx
+ a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a59:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a60:	48 8b 10             	mov    (%rax),%rdx
+ a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a67:	48 89 10             	mov    %rdx,(%rax)
+ a6a:	eb 0b                	jmp    a77 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ a6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a70:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a74:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a7b:	48 89 05 ce 04 00 00 	mov    %rax,0x4ce(%rip)        # f50 <freep>
+}
+ a82:	c9                   	leave
+ a83:	c3                   	ret
+
+0000000000000a84 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a84:	55                   	push   %rbp
+ a85:	48 89 e5             	mov    %rsp,%rbp
+ a88:	48 83 ec 20          	sub    $0x20,%rsp
+ a8c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a8f:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ a96:	77 07                	ja     a9f <morecore+0x1b>
+    nu = 4096;
+ a98:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ a9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ aa2:	c1 e0 04             	shl    $0x4,%eax
+ aa5:	89 c7                	mov    %eax,%edi
+ aa7:	e8 ea fd ff ff       	call   896 <sbrk>
+ aac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ ab0:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ ab5:	75 07                	jne    abe <morecore+0x3a>
+    return 0;
+ ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+ abc:	eb 29                	jmp    ae7 <morecore+0x63>
+  hp = (Header*)p;
+ abe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ac2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ac6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ aca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ acd:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ad4:	48 83 c0 10          	add    $0x10,%rax
+ ad8:	48 89 c7             	mov    %rax,%rdi
+ adb:	e8 4d fe ff ff       	call   92d <free>
+  return freep;
+ ae0:	48 8b 05 69 04 00 00 	mov    0x469(%rip),%rax        # f50 <freep>
+}
+ ae7:	c9                   	leave
+ ae8:	c3                   	ret
+
+0000000000000ae9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ae9:	55                   	push   %rbp
+ aea:	48 89 e5             	mov    %rsp,%rbp
+ aed:	48 83 ec 30          	sub    $0x30,%rsp
+ af1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ af7:	48 83 c0 0f          	add    $0xf,%rax
+ afb:	48 c1 e8 04          	shr    $0x4,%rax
+ aff:	83 c0 01             	add    $0x1,%eax
+ b02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ b05:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ b0c:	76 62                	jbe    b70 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ b0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b11:	c1 e0 04             	shl    $0x4,%eax
+ b14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ b1a:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ b20:	b9 22 00 00 00       	mov    $0x22,%ecx
+ b25:	ba 03 00 00 00       	mov    $0x3,%edx
+ b2a:	89 c6                	mov    %eax,%esi
+ b2c:	bf 00 00 00 00       	mov    $0x0,%edi
+ b31:	e8 98 fd ff ff       	call   8ce <mmap2>
+ b36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ b3a:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b3f:	75 0a                	jne    b4b <malloc+0x62>
+      return 0;
+ b41:	b8 00 00 00 00       	mov    $0x0,%eax
+ b46:	e9 1c 01 00 00       	jmp    c67 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ b4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b4f:	48 8d 15 0a 04 00 00 	lea    0x40a(%rip),%rdx        # f60 <bigblock>
+ b56:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ b59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b5d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b60:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ b63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b67:	48 83 c0 10          	add    $0x10,%rax
+ b6b:	e9 f7 00 00 00       	jmp    c67 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ b70:	48 8b 05 d9 03 00 00 	mov    0x3d9(%rip),%rax        # f50 <freep>
+ b77:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b7b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b80:	75 2e                	jne    bb0 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ b82:	48 8d 05 b7 03 00 00 	lea    0x3b7(%rip),%rax        # f40 <base>
+ b89:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ b91:	48 89 05 b8 03 00 00 	mov    %rax,0x3b8(%rip)        # f50 <freep>
+ b98:	48 8b 05 b1 03 00 00 	mov    0x3b1(%rip),%rax        # f50 <freep>
+ b9f:	48 89 05 9a 03 00 00 	mov    %rax,0x39a(%rip)        # f40 <base>
+    base.s.size = 0;
+ ba6:	c7 05 98 03 00 00 00 	movl   $0x0,0x398(%rip)        # f48 <base+0x8>
+ bad:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bb4:	48 8b 00             	mov    (%rax),%rax
+ bb7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ bbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bbf:	8b 40 08             	mov    0x8(%rax),%eax
+ bc2:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ bc5:	72 5f                	jb     c26 <malloc+0x13d>
+      if(p->s.size == nunits)
+ bc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bcb:	8b 40 08             	mov    0x8(%rax),%eax
+ bce:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ bd1:	75 10                	jne    be3 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd7:	48 8b 10             	mov    (%rax),%rdx
+ bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bde:	48 89 10             	mov    %rdx,(%rax)
+ be1:	eb 2e                	jmp    c11 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ be3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be7:	8b 40 08             	mov    0x8(%rax),%eax
+ bea:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ bed:	89 c2                	mov    %eax,%edx
+ bef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf3:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ bf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bfa:	8b 40 08             	mov    0x8(%rax),%eax
+ bfd:	89 c0                	mov    %eax,%eax
+ bff:	48 c1 e0 04          	shl    $0x4,%rax
+ c03:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ c07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c0e:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ c11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c15:	48 89 05 34 03 00 00 	mov    %rax,0x334(%rip)        # f50 <freep>
+      return (void*)(p + 1);
+ c1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c20:	48 83 c0 10          	add    $0x10,%rax
+ c24:	eb 41                	jmp    c67 <malloc+0x17e>
+    }
+    if(p == freep)
+ c26:	48 8b 05 23 03 00 00 	mov    0x323(%rip),%rax        # f50 <freep>
+ c2d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c31:	75 1c                	jne    c4f <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ c33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c36:	89 c7                	mov    %eax,%edi
+ c38:	e8 47 fe ff ff       	call   a84 <morecore>
+ c3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c41:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ c46:	75 07                	jne    c4f <malloc+0x166>
+        return 0;
+ c48:	b8 00 00 00 00       	mov    $0x0,%eax
+ c4d:	eb 18                	jmp    c67 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c5b:	48 8b 00             	mov    (%rax),%rax
+ c5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ c62:	e9 54 ff ff ff       	jmp    bbb <malloc+0xd2>
+  }
+}
+ c67:	c9                   	leave
+ c68:	c3                   	ret
@@ -0,0 +1,2870 @@
+
+out/user/_sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.  Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 40          	sub    $0x40,%rsp
+       8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+       c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+      11:	75 05                	jne    18 <runcmd+0x18>
+    exit();
+      13:	e8 c9 15 00 00       	call   15e1 <exit>
+
+  switch(cmd->type){
+      18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      1c:	8b 00                	mov    (%rax),%eax
+      1e:	83 f8 05             	cmp    $0x5,%eax
+      21:	77 22                	ja     45 <runcmd+0x45>
+      23:	89 c0                	mov    %eax,%eax
+      25:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      2c:	00 
+      2d:	48 8d 05 34 1a 00 00 	lea    0x1a34(%rip),%rax        # 1a68 <malloc+0x1ac>
+      34:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+      37:	48 98                	cltq
+      39:	48 8d 15 28 1a 00 00 	lea    0x1a28(%rip),%rdx        # 1a68 <malloc+0x1ac>
+      40:	48 01 d0             	add    %rdx,%rax
+      43:	ff e0                	jmp    *%rax
+  default:
+    panic("runcmd");
+      45:	48 8d 05 f0 19 00 00 	lea    0x19f0(%rip),%rax        # 1a3c <malloc+0x180>
+      4c:	48 89 c7             	mov    %rax,%rdi
+      4f:	e8 5f 03 00 00       	call   3b3 <panic>
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+      54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      58:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    if(ecmd->argv[0] == 0)
+      5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      60:	48 8b 40 08          	mov    0x8(%rax),%rax
+      64:	48 85 c0             	test   %rax,%rax
+      67:	75 05                	jne    6e <runcmd+0x6e>
+      exit();
+      69:	e8 73 15 00 00       	call   15e1 <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      72:	48 8d 50 08          	lea    0x8(%rax),%rdx
+      76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      7a:	48 8b 40 08          	mov    0x8(%rax),%rax
+      7e:	48 89 d6             	mov    %rdx,%rsi
+      81:	48 89 c7             	mov    %rax,%rdi
+      84:	e8 90 15 00 00       	call   1619 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+      8d:	48 8b 40 08          	mov    0x8(%rax),%rax
+      91:	48 89 c2             	mov    %rax,%rdx
+      94:	48 8d 05 a8 19 00 00 	lea    0x19a8(%rip),%rax        # 1a43 <malloc+0x187>
+      9b:	48 89 c6             	mov    %rax,%rsi
+      9e:	bf 02 00 00 00       	mov    $0x2,%edi
+      a3:	b8 00 00 00 00       	mov    $0x0,%eax
+      a8:	e8 8d 0f 00 00       	call   103a <printf>
+    break;
+      ad:	e9 97 01 00 00       	jmp    249 <runcmd+0x249>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+      b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+      b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    close(rcmd->fd);
+      ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      be:	8b 40 24             	mov    0x24(%rax),%eax
+      c1:	89 c7                	mov    %eax,%edi
+      c3:	e8 41 15 00 00       	call   1609 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+      c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      cc:	8b 50 20             	mov    0x20(%rax),%edx
+      cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      d3:	48 8b 40 10          	mov    0x10(%rax),%rax
+      d7:	89 d6                	mov    %edx,%esi
+      d9:	48 89 c7             	mov    %rax,%rdi
+      dc:	e8 40 15 00 00       	call   1621 <open>
+      e1:	85 c0                	test   %eax,%eax
+      e3:	79 29                	jns    10e <runcmd+0x10e>
+      printf(2, "open %s failed\n", rcmd->file);
+      e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+      e9:	48 8b 40 10          	mov    0x10(%rax),%rax
+      ed:	48 89 c2             	mov    %rax,%rdx
+      f0:	48 8d 05 5c 19 00 00 	lea    0x195c(%rip),%rax        # 1a53 <malloc+0x197>
+      f7:	48 89 c6             	mov    %rax,%rsi
+      fa:	bf 02 00 00 00       	mov    $0x2,%edi
+      ff:	b8 00 00 00 00       	mov    $0x0,%eax
+     104:	e8 31 0f 00 00       	call   103a <printf>
+      exit();
+     109:	e8 d3 14 00 00       	call   15e1 <exit>
+    }
+    runcmd(rcmd->cmd);
+     10e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     112:	48 8b 40 08          	mov    0x8(%rax),%rax
+     116:	48 89 c7             	mov    %rax,%rdi
+     119:	e8 e2 fe ff ff       	call   0 <runcmd>
+    break;
+     11e:	e9 26 01 00 00       	jmp    249 <runcmd+0x249>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     123:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     127:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(fork1() == 0)
+     12b:	e8 b4 02 00 00       	call   3e4 <fork1>
+     130:	85 c0                	test   %eax,%eax
+     132:	75 10                	jne    144 <runcmd+0x144>
+      runcmd(lcmd->left);
+     134:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     138:	48 8b 40 08          	mov    0x8(%rax),%rax
+     13c:	48 89 c7             	mov    %rax,%rdi
+     13f:	e8 bc fe ff ff       	call   0 <runcmd>
+    wait();
+     144:	e8 a0 14 00 00       	call   15e9 <wait>
+    runcmd(lcmd->right);
+     149:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     14d:	48 8b 40 10          	mov    0x10(%rax),%rax
+     151:	48 89 c7             	mov    %rax,%rdi
+     154:	e8 a7 fe ff ff       	call   0 <runcmd>
+    break;
+     159:	e9 eb 00 00 00       	jmp    249 <runcmd+0x249>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     15e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     162:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if(pipe(p) < 0)
+     166:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     16a:	48 89 c7             	mov    %rax,%rdi
+     16d:	e8 7f 14 00 00       	call   15f1 <pipe>
+     172:	85 c0                	test   %eax,%eax
+     174:	79 0f                	jns    185 <runcmd+0x185>
+      panic("pipe");
+     176:	48 8d 05 e6 18 00 00 	lea    0x18e6(%rip),%rax        # 1a63 <malloc+0x1a7>
+     17d:	48 89 c7             	mov    %rax,%rdi
+     180:	e8 2e 02 00 00       	call   3b3 <panic>
+    if(fork1() == 0){
+     185:	e8 5a 02 00 00       	call   3e4 <fork1>
+     18a:	85 c0                	test   %eax,%eax
+     18c:	75 38                	jne    1c6 <runcmd+0x1c6>
+      close(1);
+     18e:	bf 01 00 00 00       	mov    $0x1,%edi
+     193:	e8 71 14 00 00       	call   1609 <close>
+      dup(p[1]);
+     198:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     19b:	89 c7                	mov    %eax,%edi
+     19d:	e8 b7 14 00 00       	call   1659 <dup>
+      close(p[0]);
+     1a2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1a5:	89 c7                	mov    %eax,%edi
+     1a7:	e8 5d 14 00 00       	call   1609 <close>
+      close(p[1]);
+     1ac:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     1af:	89 c7                	mov    %eax,%edi
+     1b1:	e8 53 14 00 00       	call   1609 <close>
+      runcmd(pcmd->left);
+     1b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1ba:	48 8b 40 08          	mov    0x8(%rax),%rax
+     1be:	48 89 c7             	mov    %rax,%rdi
+     1c1:	e8 3a fe ff ff       	call   0 <runcmd>
+    }
+    if(fork1() == 0){
+     1c6:	e8 19 02 00 00       	call   3e4 <fork1>
+     1cb:	85 c0                	test   %eax,%eax
+     1cd:	75 38                	jne    207 <runcmd+0x207>
+      close(0);
+     1cf:	bf 00 00 00 00       	mov    $0x0,%edi
+     1d4:	e8 30 14 00 00       	call   1609 <close>
+      dup(p[0]);
+     1d9:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1dc:	89 c7                	mov    %eax,%edi
+     1de:	e8 76 14 00 00       	call   1659 <dup>
+      close(p[0]);
+     1e3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     1e6:	89 c7                	mov    %eax,%edi
+     1e8:	e8 1c 14 00 00       	call   1609 <close>
+      close(p[1]);
+     1ed:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     1f0:	89 c7                	mov    %eax,%edi
+     1f2:	e8 12 14 00 00       	call   1609 <close>
+      runcmd(pcmd->right);
+     1f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     1fb:	48 8b 40 10          	mov    0x10(%rax),%rax
+     1ff:	48 89 c7             	mov    %rax,%rdi
+     202:	e8 f9 fd ff ff       	call   0 <runcmd>
+    }
+    close(p[0]);
+     207:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     20a:	89 c7                	mov    %eax,%edi
+     20c:	e8 f8 13 00 00       	call   1609 <close>
+    close(p[1]);
+     211:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     214:	89 c7                	mov    %eax,%edi
+     216:	e8 ee 13 00 00       	call   1609 <close>
+    wait();
+     21b:	e8 c9 13 00 00       	call   15e9 <wait>
+    wait();
+     220:	e8 c4 13 00 00       	call   15e9 <wait>
+    break;
+     225:	eb 22                	jmp    249 <runcmd+0x249>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     227:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     22b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(fork1() == 0)
+     22f:	e8 b0 01 00 00       	call   3e4 <fork1>
+     234:	85 c0                	test   %eax,%eax
+     236:	75 10                	jne    248 <runcmd+0x248>
+      runcmd(bcmd->cmd);
+     238:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     23c:	48 8b 40 08          	mov    0x8(%rax),%rax
+     240:	48 89 c7             	mov    %rax,%rdi
+     243:	e8 b8 fd ff ff       	call   0 <runcmd>
+    break;
+     248:	90                   	nop
+  }
+  exit();
+     249:	e8 93 13 00 00       	call   15e1 <exit>
+
+000000000000024e <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     24e:	55                   	push   %rbp
+     24f:	48 89 e5             	mov    %rsp,%rbp
+     252:	48 83 ec 10          	sub    $0x10,%rsp
+     256:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     25a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  printf(2, "$ ");
+     25d:	48 8d 05 1c 18 00 00 	lea    0x181c(%rip),%rax        # 1a80 <malloc+0x1c4>
+     264:	48 89 c6             	mov    %rax,%rsi
+     267:	bf 02 00 00 00       	mov    $0x2,%edi
+     26c:	b8 00 00 00 00       	mov    $0x0,%eax
+     271:	e8 c4 0d 00 00       	call   103a <printf>
+  memset(buf, 0, nbuf);
+     276:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     279:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     27d:	be 00 00 00 00       	mov    $0x0,%esi
+     282:	48 89 c7             	mov    %rax,%rdi
+     285:	e8 6e 11 00 00       	call   13f8 <memset>
+  gets(buf, nbuf);
+     28a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     28d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     291:	89 d6                	mov    %edx,%esi
+     293:	48 89 c7             	mov    %rax,%rdi
+     296:	e8 c1 11 00 00       	call   145c <gets>
+  if(buf[0] == 0) // EOF
+     29b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     29f:	0f b6 00             	movzbl (%rax),%eax
+     2a2:	84 c0                	test   %al,%al
+     2a4:	75 07                	jne    2ad <getcmd+0x5f>
+    return -1;
+     2a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     2ab:	eb 05                	jmp    2b2 <getcmd+0x64>
+  return 0;
+     2ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2b2:	c9                   	leave
+     2b3:	c3                   	ret
+
+00000000000002b4 <main>:
+
+int
+main(void)
+{
+     2b4:	55                   	push   %rbp
+     2b5:	48 89 e5             	mov    %rsp,%rbp
+     2b8:	48 83 ec 10          	sub    $0x10,%rsp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+     2bc:	eb 12                	jmp    2d0 <main+0x1c>
+    if(fd >= 3){
+     2be:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+     2c2:	7e 0c                	jle    2d0 <main+0x1c>
+      close(fd);
+     2c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2c7:	89 c7                	mov    %eax,%edi
+     2c9:	e8 3b 13 00 00       	call   1609 <close>
+      break;
+     2ce:	eb 1d                	jmp    2ed <main+0x39>
+  while((fd = open("console", O_RDWR)) >= 0){
+     2d0:	be 02 00 00 00       	mov    $0x2,%esi
+     2d5:	48 8d 05 a7 17 00 00 	lea    0x17a7(%rip),%rax        # 1a83 <malloc+0x1c7>
+     2dc:	48 89 c7             	mov    %rax,%rdi
+     2df:	e8 3d 13 00 00       	call   1621 <open>
+     2e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     2e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     2eb:	79 d1                	jns    2be <main+0xa>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     2ed:	e9 a0 00 00 00       	jmp    392 <main+0xde>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     2f2:	0f b6 05 27 1d 00 00 	movzbl 0x1d27(%rip),%eax        # 2020 <buf.0>
+     2f9:	3c 63                	cmp    $0x63,%al
+     2fb:	75 6d                	jne    36a <main+0xb6>
+     2fd:	0f b6 05 1d 1d 00 00 	movzbl 0x1d1d(%rip),%eax        # 2021 <buf.0+0x1>
+     304:	3c 64                	cmp    $0x64,%al
+     306:	75 62                	jne    36a <main+0xb6>
+     308:	0f b6 05 13 1d 00 00 	movzbl 0x1d13(%rip),%eax        # 2022 <buf.0+0x2>
+     30f:	3c 20                	cmp    $0x20,%al
+     311:	75 57                	jne    36a <main+0xb6>
+      // Chdir must be called by the parent, not the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+     313:	48 8d 05 06 1d 00 00 	lea    0x1d06(%rip),%rax        # 2020 <buf.0>
+     31a:	48 89 c7             	mov    %rax,%rdi
+     31d:	e8 a8 10 00 00       	call   13ca <strlen>
+     322:	83 e8 01             	sub    $0x1,%eax
+     325:	89 c2                	mov    %eax,%edx
+     327:	48 8d 05 f2 1c 00 00 	lea    0x1cf2(%rip),%rax        # 2020 <buf.0>
+     32e:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+      if(chdir(buf+3) < 0)
+     332:	48 8d 05 ea 1c 00 00 	lea    0x1cea(%rip),%rax        # 2023 <buf.0+0x3>
+     339:	48 89 c7             	mov    %rax,%rdi
+     33c:	e8 10 13 00 00       	call   1651 <chdir>
+     341:	85 c0                	test   %eax,%eax
+     343:	79 4c                	jns    391 <main+0xdd>
+        printf(2, "cannot cd %s\n", buf+3);
+     345:	48 8d 05 d7 1c 00 00 	lea    0x1cd7(%rip),%rax        # 2023 <buf.0+0x3>
+     34c:	48 89 c2             	mov    %rax,%rdx
+     34f:	48 8d 05 35 17 00 00 	lea    0x1735(%rip),%rax        # 1a8b <malloc+0x1cf>
+     356:	48 89 c6             	mov    %rax,%rsi
+     359:	bf 02 00 00 00       	mov    $0x2,%edi
+     35e:	b8 00 00 00 00       	mov    $0x0,%eax
+     363:	e8 d2 0c 00 00       	call   103a <printf>
+      continue;
+     368:	eb 27                	jmp    391 <main+0xdd>
+    }
+    if(fork1() == 0)
+     36a:	e8 75 00 00 00       	call   3e4 <fork1>
+     36f:	85 c0                	test   %eax,%eax
+     371:	75 17                	jne    38a <main+0xd6>
+      runcmd(parsecmd(buf));
+     373:	48 8d 05 a6 1c 00 00 	lea    0x1ca6(%rip),%rax        # 2020 <buf.0>
+     37a:	48 89 c7             	mov    %rax,%rdi
+     37d:	e8 6f 04 00 00       	call   7f1 <parsecmd>
+     382:	48 89 c7             	mov    %rax,%rdi
+     385:	e8 76 fc ff ff       	call   0 <runcmd>
+    wait();
+     38a:	e8 5a 12 00 00       	call   15e9 <wait>
+     38f:	eb 01                	jmp    392 <main+0xde>
+      continue;
+     391:	90                   	nop
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     392:	be 64 00 00 00       	mov    $0x64,%esi
+     397:	48 8d 05 82 1c 00 00 	lea    0x1c82(%rip),%rax        # 2020 <buf.0>
+     39e:	48 89 c7             	mov    %rax,%rdi
+     3a1:	e8 a8 fe ff ff       	call   24e <getcmd>
+     3a6:	85 c0                	test   %eax,%eax
+     3a8:	0f 89 44 ff ff ff    	jns    2f2 <main+0x3e>
+  }
+  exit();
+     3ae:	e8 2e 12 00 00       	call   15e1 <exit>
+
+00000000000003b3 <panic>:
+}
+
+void
+panic(char *s)
+{
+     3b3:	55                   	push   %rbp
+     3b4:	48 89 e5             	mov    %rsp,%rbp
+     3b7:	48 83 ec 10          	sub    $0x10,%rsp
+     3bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  printf(2, "%s\n", s);
+     3bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     3c3:	48 89 c2             	mov    %rax,%rdx
+     3c6:	48 8d 05 cc 16 00 00 	lea    0x16cc(%rip),%rax        # 1a99 <malloc+0x1dd>
+     3cd:	48 89 c6             	mov    %rax,%rsi
+     3d0:	bf 02 00 00 00       	mov    $0x2,%edi
+     3d5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3da:	e8 5b 0c 00 00       	call   103a <printf>
+  exit();
+     3df:	e8 fd 11 00 00       	call   15e1 <exit>
+
+00000000000003e4 <fork1>:
+}
+
+int
+fork1(void)
+{
+     3e4:	55                   	push   %rbp
+     3e5:	48 89 e5             	mov    %rsp,%rbp
+     3e8:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid;
+
+  pid = fork();
+     3ec:	e8 e8 11 00 00       	call   15d9 <fork>
+     3f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(pid == -1)
+     3f4:	83 7d fc ff          	cmpl   $0xffffffff,-0x4(%rbp)
+     3f8:	75 0f                	jne    409 <fork1+0x25>
+    panic("fork");
+     3fa:	48 8d 05 9c 16 00 00 	lea    0x169c(%rip),%rax        # 1a9d <malloc+0x1e1>
+     401:	48 89 c7             	mov    %rax,%rdi
+     404:	e8 aa ff ff ff       	call   3b3 <panic>
+  return pid;
+     409:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+     40c:	c9                   	leave
+     40d:	c3                   	ret
+
+000000000000040e <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     40e:	55                   	push   %rbp
+     40f:	48 89 e5             	mov    %rsp,%rbp
+     412:	48 83 ec 10          	sub    $0x10,%rsp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     416:	bf a8 00 00 00       	mov    $0xa8,%edi
+     41b:	e8 9c 14 00 00       	call   18bc <malloc>
+     420:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     424:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     428:	ba a8 00 00 00       	mov    $0xa8,%edx
+     42d:	be 00 00 00 00       	mov    $0x0,%esi
+     432:	48 89 c7             	mov    %rax,%rdi
+     435:	e8 be 0f 00 00       	call   13f8 <memset>
+  cmd->type = EXEC;
+     43a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     43e:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  return (struct cmd*)cmd;
+     444:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     448:	c9                   	leave
+     449:	c3                   	ret
+
+000000000000044a <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     44a:	55                   	push   %rbp
+     44b:	48 89 e5             	mov    %rsp,%rbp
+     44e:	48 83 ec 30          	sub    $0x30,%rsp
+     452:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     456:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     45a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     45e:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+     461:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     465:	bf 28 00 00 00       	mov    $0x28,%edi
+     46a:	e8 4d 14 00 00       	call   18bc <malloc>
+     46f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     473:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     477:	ba 28 00 00 00       	mov    $0x28,%edx
+     47c:	be 00 00 00 00       	mov    $0x0,%esi
+     481:	48 89 c7             	mov    %rax,%rdi
+     484:	e8 6f 0f 00 00       	call   13f8 <memset>
+  cmd->type = REDIR;
+     489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     48d:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+  cmd->cmd = subcmd;
+     493:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     497:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     49b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->file = file;
+     49f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     4a7:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  cmd->efile = efile;
+     4ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+     4b3:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  cmd->mode = mode;
+     4b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4bb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+     4be:	89 50 20             	mov    %edx,0x20(%rax)
+  cmd->fd = fd;
+     4c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4c5:	8b 55 d0             	mov    -0x30(%rbp),%edx
+     4c8:	89 50 24             	mov    %edx,0x24(%rax)
+  return (struct cmd*)cmd;
+     4cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     4cf:	c9                   	leave
+     4d0:	c3                   	ret
+
+00000000000004d1 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4d1:	55                   	push   %rbp
+     4d2:	48 89 e5             	mov    %rsp,%rbp
+     4d5:	48 83 ec 20          	sub    $0x20,%rsp
+     4d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     4dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4e1:	bf 18 00 00 00       	mov    $0x18,%edi
+     4e6:	e8 d1 13 00 00       	call   18bc <malloc>
+     4eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     4ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     4f3:	ba 18 00 00 00       	mov    $0x18,%edx
+     4f8:	be 00 00 00 00       	mov    $0x0,%esi
+     4fd:	48 89 c7             	mov    %rax,%rdi
+     500:	e8 f3 0e 00 00       	call   13f8 <memset>
+  cmd->type = PIPE;
+     505:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     509:	c7 00 03 00 00 00    	movl   $0x3,(%rax)
+  cmd->left = left;
+     50f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     513:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     517:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     51b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     51f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     523:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd*)cmd;
+     527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+
+000000000000052d <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     52d:	55                   	push   %rbp
+     52e:	48 89 e5             	mov    %rsp,%rbp
+     531:	48 83 ec 20          	sub    $0x20,%rsp
+     535:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     539:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     53d:	bf 18 00 00 00       	mov    $0x18,%edi
+     542:	e8 75 13 00 00       	call   18bc <malloc>
+     547:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     54b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     54f:	ba 18 00 00 00       	mov    $0x18,%edx
+     554:	be 00 00 00 00       	mov    $0x0,%esi
+     559:	48 89 c7             	mov    %rax,%rdi
+     55c:	e8 97 0e 00 00       	call   13f8 <memset>
+  cmd->type = LIST;
+     561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     565:	c7 00 04 00 00 00    	movl   $0x4,(%rax)
+  cmd->left = left;
+     56b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     56f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     573:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  cmd->right = right;
+     577:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     57b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     57f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return (struct cmd*)cmd;
+     583:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     587:	c9                   	leave
+     588:	c3                   	ret
+
+0000000000000589 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     589:	55                   	push   %rbp
+     58a:	48 89 e5             	mov    %rsp,%rbp
+     58d:	48 83 ec 20          	sub    $0x20,%rsp
+     591:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     595:	bf 10 00 00 00       	mov    $0x10,%edi
+     59a:	e8 1d 13 00 00       	call   18bc <malloc>
+     59f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(cmd, 0, sizeof(*cmd));
+     5a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5a7:	ba 10 00 00 00       	mov    $0x10,%edx
+     5ac:	be 00 00 00 00       	mov    $0x0,%esi
+     5b1:	48 89 c7             	mov    %rax,%rdi
+     5b4:	e8 3f 0e 00 00       	call   13f8 <memset>
+  cmd->type = BACK;
+     5b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5bd:	c7 00 05 00 00 00    	movl   $0x5,(%rax)
+  cmd->cmd = subcmd;
+     5c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     5c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     5cb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  return (struct cmd*)cmd;
+     5cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     5d3:	c9                   	leave
+     5d4:	c3                   	ret
+
+00000000000005d5 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     5d5:	55                   	push   %rbp
+     5d6:	48 89 e5             	mov    %rsp,%rbp
+     5d9:	48 83 ec 30          	sub    $0x30,%rsp
+     5dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     5e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     5e5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+     5e9:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  char *s;
+  int ret;
+
+  s = *ps;
+     5ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     5f1:	48 8b 00             	mov    (%rax),%rax
+     5f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     5f8:	eb 05                	jmp    5ff <gettoken+0x2a>
+    s++;
+     5fa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     5ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     603:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     607:	73 20                	jae    629 <gettoken+0x54>
+     609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     60d:	0f b6 00             	movzbl (%rax),%eax
+     610:	0f be c0             	movsbl %al,%eax
+     613:	89 c6                	mov    %eax,%esi
+     615:	48 8d 05 b4 19 00 00 	lea    0x19b4(%rip),%rax        # 1fd0 <whitespace>
+     61c:	48 89 c7             	mov    %rax,%rdi
+     61f:	e8 00 0e 00 00       	call   1424 <strchr>
+     624:	48 85 c0             	test   %rax,%rax
+     627:	75 d1                	jne    5fa <gettoken+0x25>
+  if(q)
+     629:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+     62e:	74 0b                	je     63b <gettoken+0x66>
+    *q = s;
+     630:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     634:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     638:	48 89 10             	mov    %rdx,(%rax)
+  ret = *s;
+     63b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     63f:	0f b6 00             	movzbl (%rax),%eax
+     642:	0f be c0             	movsbl %al,%eax
+     645:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  switch(*s){
+     648:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     64c:	0f b6 00             	movzbl (%rax),%eax
+     64f:	0f be c0             	movsbl %al,%eax
+     652:	83 f8 7c             	cmp    $0x7c,%eax
+     655:	74 30                	je     687 <gettoken+0xb2>
+     657:	83 f8 7c             	cmp    $0x7c,%eax
+     65a:	7f 50                	jg     6ac <gettoken+0xd7>
+     65c:	83 f8 3e             	cmp    $0x3e,%eax
+     65f:	74 2d                	je     68e <gettoken+0xb9>
+     661:	83 f8 3e             	cmp    $0x3e,%eax
+     664:	7f 46                	jg     6ac <gettoken+0xd7>
+     666:	83 f8 3c             	cmp    $0x3c,%eax
+     669:	7f 41                	jg     6ac <gettoken+0xd7>
+     66b:	83 f8 3b             	cmp    $0x3b,%eax
+     66e:	7d 17                	jge    687 <gettoken+0xb2>
+     670:	83 f8 29             	cmp    $0x29,%eax
+     673:	7f 37                	jg     6ac <gettoken+0xd7>
+     675:	83 f8 28             	cmp    $0x28,%eax
+     678:	7d 0d                	jge    687 <gettoken+0xb2>
+     67a:	85 c0                	test   %eax,%eax
+     67c:	0f 84 84 00 00 00    	je     706 <gettoken+0x131>
+     682:	83 f8 26             	cmp    $0x26,%eax
+     685:	75 25                	jne    6ac <gettoken+0xd7>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     687:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    break;
+     68c:	eb 7f                	jmp    70d <gettoken+0x138>
+  case '>':
+    s++;
+     68e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    if(*s == '>'){
+     693:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     697:	0f b6 00             	movzbl (%rax),%eax
+     69a:	3c 3e                	cmp    $0x3e,%al
+     69c:	75 6b                	jne    709 <gettoken+0x134>
+      ret = '+';
+     69e:	c7 45 f4 2b 00 00 00 	movl   $0x2b,-0xc(%rbp)
+      s++;
+     6a5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    }
+    break;
+     6aa:	eb 5d                	jmp    709 <gettoken+0x134>
+  default:
+    ret = 'a';
+     6ac:	c7 45 f4 61 00 00 00 	movl   $0x61,-0xc(%rbp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6b3:	eb 05                	jmp    6ba <gettoken+0xe5>
+      s++;
+     6b5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6be:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     6c2:	73 48                	jae    70c <gettoken+0x137>
+     6c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6c8:	0f b6 00             	movzbl (%rax),%eax
+     6cb:	0f be c0             	movsbl %al,%eax
+     6ce:	89 c6                	mov    %eax,%esi
+     6d0:	48 8d 05 f9 18 00 00 	lea    0x18f9(%rip),%rax        # 1fd0 <whitespace>
+     6d7:	48 89 c7             	mov    %rax,%rdi
+     6da:	e8 45 0d 00 00       	call   1424 <strchr>
+     6df:	48 85 c0             	test   %rax,%rax
+     6e2:	75 28                	jne    70c <gettoken+0x137>
+     6e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     6e8:	0f b6 00             	movzbl (%rax),%eax
+     6eb:	0f be c0             	movsbl %al,%eax
+     6ee:	89 c6                	mov    %eax,%esi
+     6f0:	48 8d 05 e1 18 00 00 	lea    0x18e1(%rip),%rax        # 1fd8 <symbols>
+     6f7:	48 89 c7             	mov    %rax,%rdi
+     6fa:	e8 25 0d 00 00       	call   1424 <strchr>
+     6ff:	48 85 c0             	test   %rax,%rax
+     702:	74 b1                	je     6b5 <gettoken+0xe0>
+    break;
+     704:	eb 06                	jmp    70c <gettoken+0x137>
+    break;
+     706:	90                   	nop
+     707:	eb 04                	jmp    70d <gettoken+0x138>
+    break;
+     709:	90                   	nop
+     70a:	eb 01                	jmp    70d <gettoken+0x138>
+    break;
+     70c:	90                   	nop
+  }
+  if(eq)
+     70d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+     712:	74 12                	je     726 <gettoken+0x151>
+    *eq = s;
+     714:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     718:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     71c:	48 89 10             	mov    %rdx,(%rax)
+
+  while(s < es && strchr(whitespace, *s))
+     71f:	eb 05                	jmp    726 <gettoken+0x151>
+    s++;
+     721:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     726:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     72a:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     72e:	73 20                	jae    750 <gettoken+0x17b>
+     730:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     734:	0f b6 00             	movzbl (%rax),%eax
+     737:	0f be c0             	movsbl %al,%eax
+     73a:	89 c6                	mov    %eax,%esi
+     73c:	48 8d 05 8d 18 00 00 	lea    0x188d(%rip),%rax        # 1fd0 <whitespace>
+     743:	48 89 c7             	mov    %rax,%rdi
+     746:	e8 d9 0c 00 00       	call   1424 <strchr>
+     74b:	48 85 c0             	test   %rax,%rax
+     74e:	75 d1                	jne    721 <gettoken+0x14c>
+  *ps = s;
+     750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     754:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     758:	48 89 10             	mov    %rdx,(%rax)
+  return ret;
+     75b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+}
+     75e:	c9                   	leave
+     75f:	c3                   	ret
+
+0000000000000760 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     760:	55                   	push   %rbp
+     761:	48 89 e5             	mov    %rsp,%rbp
+     764:	48 83 ec 30          	sub    $0x30,%rsp
+     768:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     76c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+     770:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  char *s;
+
+  s = *ps;
+     774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     778:	48 8b 00             	mov    (%rax),%rax
+     77b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     77f:	eb 05                	jmp    786 <peek+0x26>
+    s++;
+     781:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  while(s < es && strchr(whitespace, *s))
+     786:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     78a:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+     78e:	73 20                	jae    7b0 <peek+0x50>
+     790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     794:	0f b6 00             	movzbl (%rax),%eax
+     797:	0f be c0             	movsbl %al,%eax
+     79a:	89 c6                	mov    %eax,%esi
+     79c:	48 8d 05 2d 18 00 00 	lea    0x182d(%rip),%rax        # 1fd0 <whitespace>
+     7a3:	48 89 c7             	mov    %rax,%rdi
+     7a6:	e8 79 0c 00 00       	call   1424 <strchr>
+     7ab:	48 85 c0             	test   %rax,%rax
+     7ae:	75 d1                	jne    781 <peek+0x21>
+  *ps = s;
+     7b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     7b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+     7b8:	48 89 10             	mov    %rdx,(%rax)
+  return *s && strchr(toks, *s);
+     7bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7bf:	0f b6 00             	movzbl (%rax),%eax
+     7c2:	84 c0                	test   %al,%al
+     7c4:	74 24                	je     7ea <peek+0x8a>
+     7c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     7ca:	0f b6 00             	movzbl (%rax),%eax
+     7cd:	0f be d0             	movsbl %al,%edx
+     7d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     7d4:	89 d6                	mov    %edx,%esi
+     7d6:	48 89 c7             	mov    %rax,%rdi
+     7d9:	e8 46 0c 00 00       	call   1424 <strchr>
+     7de:	48 85 c0             	test   %rax,%rax
+     7e1:	74 07                	je     7ea <peek+0x8a>
+     7e3:	b8 01 00 00 00       	mov    $0x1,%eax
+     7e8:	eb 05                	jmp    7ef <peek+0x8f>
+     7ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     7ef:	c9                   	leave
+     7f0:	c3                   	ret
+
+00000000000007f1 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     7f1:	55                   	push   %rbp
+     7f2:	48 89 e5             	mov    %rsp,%rbp
+     7f5:	53                   	push   %rbx
+     7f6:	48 83 ec 28          	sub    $0x28,%rsp
+     7fa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     7fe:	48 8b 5d d8          	mov    -0x28(%rbp),%rbx
+     802:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     806:	48 89 c7             	mov    %rax,%rdi
+     809:	e8 bc 0b 00 00       	call   13ca <strlen>
+     80e:	89 c0                	mov    %eax,%eax
+     810:	48 01 d8             	add    %rbx,%rax
+     813:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  cmd = parseline(&s, es);
+     817:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     81b:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     81f:	48 89 d6             	mov    %rdx,%rsi
+     822:	48 89 c7             	mov    %rax,%rdi
+     825:	e8 6d 00 00 00       	call   897 <parseline>
+     82a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  peek(&s, es, "");
+     82e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     832:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+     836:	48 8d 15 65 12 00 00 	lea    0x1265(%rip),%rdx        # 1aa2 <malloc+0x1e6>
+     83d:	48 89 ce             	mov    %rcx,%rsi
+     840:	48 89 c7             	mov    %rax,%rdi
+     843:	e8 18 ff ff ff       	call   760 <peek>
+  if(s != es){
+     848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     84c:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+     850:	74 2f                	je     881 <parsecmd+0x90>
+    printf(2, "leftovers: %s\n", s);
+     852:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     856:	48 89 c2             	mov    %rax,%rdx
+     859:	48 8d 05 43 12 00 00 	lea    0x1243(%rip),%rax        # 1aa3 <malloc+0x1e7>
+     860:	48 89 c6             	mov    %rax,%rsi
+     863:	bf 02 00 00 00       	mov    $0x2,%edi
+     868:	b8 00 00 00 00       	mov    $0x0,%eax
+     86d:	e8 c8 07 00 00       	call   103a <printf>
+    panic("syntax");
+     872:	48 8d 05 39 12 00 00 	lea    0x1239(%rip),%rax        # 1ab2 <malloc+0x1f6>
+     879:	48 89 c7             	mov    %rax,%rdi
+     87c:	e8 32 fb ff ff       	call   3b3 <panic>
+  }
+  nulterminate(cmd);
+     881:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     885:	48 89 c7             	mov    %rax,%rdi
+     888:	e8 c1 04 00 00       	call   d4e <nulterminate>
+  return cmd;
+     88d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+     891:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+     895:	c9                   	leave
+     896:	c3                   	ret
+
+0000000000000897 <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     897:	55                   	push   %rbp
+     898:	48 89 e5             	mov    %rsp,%rbp
+     89b:	48 83 ec 20          	sub    $0x20,%rsp
+     89f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     8a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     8a7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     8ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8af:	48 89 d6             	mov    %rdx,%rsi
+     8b2:	48 89 c7             	mov    %rax,%rdi
+     8b5:	e8 b5 00 00 00       	call   96f <parsepipe>
+     8ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(peek(ps, es, "&")){
+     8be:	eb 2a                	jmp    8ea <parseline+0x53>
+    gettoken(ps, es, 0, 0);
+     8c0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     8c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+     8cd:	ba 00 00 00 00       	mov    $0x0,%edx
+     8d2:	48 89 c7             	mov    %rax,%rdi
+     8d5:	e8 fb fc ff ff       	call   5d5 <gettoken>
+    cmd = backcmd(cmd);
+     8da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     8de:	48 89 c7             	mov    %rax,%rdi
+     8e1:	e8 a3 fc ff ff       	call   589 <backcmd>
+     8e6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(peek(ps, es, "&")){
+     8ea:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     8ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     8f2:	48 8d 15 c0 11 00 00 	lea    0x11c0(%rip),%rdx        # 1ab9 <malloc+0x1fd>
+     8f9:	48 89 ce             	mov    %rcx,%rsi
+     8fc:	48 89 c7             	mov    %rax,%rdi
+     8ff:	e8 5c fe ff ff       	call   760 <peek>
+     904:	85 c0                	test   %eax,%eax
+     906:	75 b8                	jne    8c0 <parseline+0x29>
+  }
+  if(peek(ps, es, ";")){
+     908:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     90c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     910:	48 8d 15 a4 11 00 00 	lea    0x11a4(%rip),%rdx        # 1abb <malloc+0x1ff>
+     917:	48 89 ce             	mov    %rcx,%rsi
+     91a:	48 89 c7             	mov    %rax,%rdi
+     91d:	e8 3e fe ff ff       	call   760 <peek>
+     922:	85 c0                	test   %eax,%eax
+     924:	74 43                	je     969 <parseline+0xd2>
+    gettoken(ps, es, 0, 0);
+     926:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     92a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     92e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     933:	ba 00 00 00 00       	mov    $0x0,%edx
+     938:	48 89 c7             	mov    %rax,%rdi
+     93b:	e8 95 fc ff ff       	call   5d5 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     940:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     944:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     948:	48 89 d6             	mov    %rdx,%rsi
+     94b:	48 89 c7             	mov    %rax,%rdi
+     94e:	e8 44 ff ff ff       	call   897 <parseline>
+     953:	48 89 c2             	mov    %rax,%rdx
+     956:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     95a:	48 89 d6             	mov    %rdx,%rsi
+     95d:	48 89 c7             	mov    %rax,%rdi
+     960:	e8 c8 fb ff ff       	call   52d <listcmd>
+     965:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     96d:	c9                   	leave
+     96e:	c3                   	ret
+
+000000000000096f <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     96f:	55                   	push   %rbp
+     970:	48 89 e5             	mov    %rsp,%rbp
+     973:	48 83 ec 20          	sub    $0x20,%rsp
+     977:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     97b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     97f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     983:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     987:	48 89 d6             	mov    %rdx,%rsi
+     98a:	48 89 c7             	mov    %rax,%rdi
+     98d:	e8 51 02 00 00       	call   be3 <parseexec>
+     992:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(peek(ps, es, "|")){
+     996:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     99a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     99e:	48 8d 15 18 11 00 00 	lea    0x1118(%rip),%rdx        # 1abd <malloc+0x201>
+     9a5:	48 89 ce             	mov    %rcx,%rsi
+     9a8:	48 89 c7             	mov    %rax,%rdi
+     9ab:	e8 b0 fd ff ff       	call   760 <peek>
+     9b0:	85 c0                	test   %eax,%eax
+     9b2:	74 43                	je     9f7 <parsepipe+0x88>
+    gettoken(ps, es, 0, 0);
+     9b4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     9b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     9bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+     9c1:	ba 00 00 00 00       	mov    $0x0,%edx
+     9c6:	48 89 c7             	mov    %rax,%rdi
+     9c9:	e8 07 fc ff ff       	call   5d5 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     9ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     9d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     9d6:	48 89 d6             	mov    %rdx,%rsi
+     9d9:	48 89 c7             	mov    %rax,%rdi
+     9dc:	e8 8e ff ff ff       	call   96f <parsepipe>
+     9e1:	48 89 c2             	mov    %rax,%rdx
+     9e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     9e8:	48 89 d6             	mov    %rdx,%rsi
+     9eb:	48 89 c7             	mov    %rax,%rdi
+     9ee:	e8 de fa ff ff       	call   4d1 <pipecmd>
+     9f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+  return cmd;
+     9f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     9fb:	c9                   	leave
+     9fc:	c3                   	ret
+
+00000000000009fd <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     9fd:	55                   	push   %rbp
+     9fe:	48 89 e5             	mov    %rsp,%rbp
+     a01:	48 83 ec 40          	sub    $0x40,%rsp
+     a05:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+     a09:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+     a0d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     a11:	e9 cf 00 00 00       	jmp    ae5 <parseredirs+0xe8>
+    tok = gettoken(ps, es, 0, 0);
+     a16:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     a1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     a1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a23:	ba 00 00 00 00       	mov    $0x0,%edx
+     a28:	48 89 c7             	mov    %rax,%rdi
+     a2b:	e8 a5 fb ff ff       	call   5d5 <gettoken>
+     a30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     a33:	48 8d 4d e8          	lea    -0x18(%rbp),%rcx
+     a37:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+     a3b:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+     a3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     a43:	48 89 c7             	mov    %rax,%rdi
+     a46:	e8 8a fb ff ff       	call   5d5 <gettoken>
+     a4b:	83 f8 61             	cmp    $0x61,%eax
+     a4e:	74 0f                	je     a5f <parseredirs+0x62>
+      panic("missing file for redirection");
+     a50:	48 8d 05 68 10 00 00 	lea    0x1068(%rip),%rax        # 1abf <malloc+0x203>
+     a57:	48 89 c7             	mov    %rax,%rdi
+     a5a:	e8 54 f9 ff ff       	call   3b3 <panic>
+    switch(tok){
+     a5f:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     a63:	74 37                	je     a9c <parseredirs+0x9f>
+     a65:	83 7d fc 3e          	cmpl   $0x3e,-0x4(%rbp)
+     a69:	7f 7a                	jg     ae5 <parseredirs+0xe8>
+     a6b:	83 7d fc 2b          	cmpl   $0x2b,-0x4(%rbp)
+     a6f:	74 50                	je     ac1 <parseredirs+0xc4>
+     a71:	83 7d fc 3c          	cmpl   $0x3c,-0x4(%rbp)
+     a75:	75 6e                	jne    ae5 <parseredirs+0xe8>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     a7b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     a7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     a83:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+     a89:	b9 00 00 00 00       	mov    $0x0,%ecx
+     a8e:	48 89 c7             	mov    %rax,%rdi
+     a91:	e8 b4 f9 ff ff       	call   44a <redircmd>
+     a96:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     a9a:	eb 49                	jmp    ae5 <parseredirs+0xe8>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     a9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     aa0:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     aa4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     aa8:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     aae:	b9 01 02 00 00       	mov    $0x201,%ecx
+     ab3:	48 89 c7             	mov    %rax,%rdi
+     ab6:	e8 8f f9 ff ff       	call   44a <redircmd>
+     abb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     abf:	eb 24                	jmp    ae5 <parseredirs+0xe8>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     ac1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+     ac5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+     ac9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     acd:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+     ad3:	b9 01 02 00 00       	mov    $0x201,%ecx
+     ad8:	48 89 c7             	mov    %rax,%rdi
+     adb:	e8 6a f9 ff ff       	call   44a <redircmd>
+     ae0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      break;
+     ae4:	90                   	nop
+  while(peek(ps, es, "<>")){
+     ae5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     ae9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     aed:	48 8d 15 e8 0f 00 00 	lea    0xfe8(%rip),%rdx        # 1adc <malloc+0x220>
+     af4:	48 89 ce             	mov    %rcx,%rsi
+     af7:	48 89 c7             	mov    %rax,%rdi
+     afa:	e8 61 fc ff ff       	call   760 <peek>
+     aff:	85 c0                	test   %eax,%eax
+     b01:	0f 85 0f ff ff ff    	jne    a16 <parseredirs+0x19>
+    }
+  }
+  return cmd;
+     b07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+     b0b:	c9                   	leave
+     b0c:	c3                   	ret
+
+0000000000000b0d <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     b0d:	55                   	push   %rbp
+     b0e:	48 89 e5             	mov    %rsp,%rbp
+     b11:	48 83 ec 20          	sub    $0x20,%rsp
+     b15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+     b19:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+     b1d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     b21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b25:	48 8d 15 b3 0f 00 00 	lea    0xfb3(%rip),%rdx        # 1adf <malloc+0x223>
+     b2c:	48 89 ce             	mov    %rcx,%rsi
+     b2f:	48 89 c7             	mov    %rax,%rdi
+     b32:	e8 29 fc ff ff       	call   760 <peek>
+     b37:	85 c0                	test   %eax,%eax
+     b39:	75 0f                	jne    b4a <parseblock+0x3d>
+    panic("parseblock");
+     b3b:	48 8d 05 9f 0f 00 00 	lea    0xf9f(%rip),%rax        # 1ae1 <malloc+0x225>
+     b42:	48 89 c7             	mov    %rax,%rdi
+     b45:	e8 69 f8 ff ff       	call   3b3 <panic>
+  gettoken(ps, es, 0, 0);
+     b4a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     b4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b52:	b9 00 00 00 00       	mov    $0x0,%ecx
+     b57:	ba 00 00 00 00       	mov    $0x0,%edx
+     b5c:	48 89 c7             	mov    %rax,%rdi
+     b5f:	e8 71 fa ff ff       	call   5d5 <gettoken>
+  cmd = parseline(ps, es);
+     b64:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b6c:	48 89 d6             	mov    %rdx,%rsi
+     b6f:	48 89 c7             	mov    %rax,%rdi
+     b72:	e8 20 fd ff ff       	call   897 <parseline>
+     b77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(!peek(ps, es, ")"))
+     b7b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+     b7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     b83:	48 8d 15 62 0f 00 00 	lea    0xf62(%rip),%rdx        # 1aec <malloc+0x230>
+     b8a:	48 89 ce             	mov    %rcx,%rsi
+     b8d:	48 89 c7             	mov    %rax,%rdi
+     b90:	e8 cb fb ff ff       	call   760 <peek>
+     b95:	85 c0                	test   %eax,%eax
+     b97:	75 0f                	jne    ba8 <parseblock+0x9b>
+    panic("syntax - missing )");
+     b99:	48 8d 05 4e 0f 00 00 	lea    0xf4e(%rip),%rax        # 1aee <malloc+0x232>
+     ba0:	48 89 c7             	mov    %rax,%rdi
+     ba3:	e8 0b f8 ff ff       	call   3b3 <panic>
+  gettoken(ps, es, 0, 0);
+     ba8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+     bac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     bb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+     bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+     bba:	48 89 c7             	mov    %rax,%rdi
+     bbd:	e8 13 fa ff ff       	call   5d5 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     bc2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+     bc6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+     bca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+     bce:	48 89 ce             	mov    %rcx,%rsi
+     bd1:	48 89 c7             	mov    %rax,%rdi
+     bd4:	e8 24 fe ff ff       	call   9fd <parseredirs>
+     bd9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return cmd;
+     bdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+     be1:	c9                   	leave
+     be2:	c3                   	ret
+
+0000000000000be3 <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     be3:	55                   	push   %rbp
+     be4:	48 89 e5             	mov    %rsp,%rbp
+     be7:	48 83 ec 40          	sub    $0x40,%rsp
+     beb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+     bef:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     bf3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     bf7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     bfb:	48 8d 15 dd 0e 00 00 	lea    0xedd(%rip),%rdx        # 1adf <malloc+0x223>
+     c02:	48 89 ce             	mov    %rcx,%rsi
+     c05:	48 89 c7             	mov    %rax,%rdi
+     c08:	e8 53 fb ff ff       	call   760 <peek>
+     c0d:	85 c0                	test   %eax,%eax
+     c0f:	74 18                	je     c29 <parseexec+0x46>
+    return parseblock(ps, es);
+     c11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     c15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c19:	48 89 d6             	mov    %rdx,%rsi
+     c1c:	48 89 c7             	mov    %rax,%rdi
+     c1f:	e8 e9 fe ff ff       	call   b0d <parseblock>
+     c24:	e9 23 01 00 00       	jmp    d4c <parseexec+0x169>
+
+  ret = execcmd();
+     c29:	e8 e0 f7 ff ff       	call   40e <execcmd>
+     c2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  cmd = (struct execcmd*)ret;
+     c32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c36:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  argc = 0;
+     c3a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  ret = parseredirs(ret, ps, es);
+     c41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     c45:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     c4d:	48 89 ce             	mov    %rcx,%rsi
+     c50:	48 89 c7             	mov    %rax,%rdi
+     c53:	e8 a5 fd ff ff       	call   9fd <parseredirs>
+     c58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(!peek(ps, es, "|)&;")){
+     c5c:	e9 98 00 00 00       	jmp    cf9 <parseexec+0x116>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     c61:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+     c65:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+     c69:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+     c6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     c71:	48 89 c7             	mov    %rax,%rdi
+     c74:	e8 5c f9 ff ff       	call   5d5 <gettoken>
+     c79:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+     c7c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+     c80:	0f 84 97 00 00 00    	je     d1d <parseexec+0x13a>
+      break;
+    if(tok != 'a')
+     c86:	83 7d e4 61          	cmpl   $0x61,-0x1c(%rbp)
+     c8a:	74 0f                	je     c9b <parseexec+0xb8>
+      panic("syntax");
+     c8c:	48 8d 05 1f 0e 00 00 	lea    0xe1f(%rip),%rax        # 1ab2 <malloc+0x1f6>
+     c93:	48 89 c7             	mov    %rax,%rdi
+     c96:	e8 18 f7 ff ff       	call   3b3 <panic>
+    cmd->argv[argc] = q;
+     c9b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+     c9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     ca3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     ca6:	48 63 d2             	movslq %edx,%rdx
+     ca9:	48 89 4c d0 08       	mov    %rcx,0x8(%rax,%rdx,8)
+    cmd->eargv[argc] = eq;
+     cae:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+     cb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     cb6:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     cb9:	48 63 c9             	movslq %ecx,%rcx
+     cbc:	48 83 c1 0a          	add    $0xa,%rcx
+     cc0:	48 89 54 c8 08       	mov    %rdx,0x8(%rax,%rcx,8)
+    argc++;
+     cc5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    if(argc >= MAXARGS)
+     cc9:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+     ccd:	7e 0f                	jle    cde <parseexec+0xfb>
+      panic("too many args");
+     ccf:	48 8d 05 2b 0e 00 00 	lea    0xe2b(%rip),%rax        # 1b01 <malloc+0x245>
+     cd6:	48 89 c7             	mov    %rax,%rdi
+     cd9:	e8 d5 f6 ff ff       	call   3b3 <panic>
+    ret = parseredirs(ret, ps, es);
+     cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+     ce2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+     ce6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     cea:	48 89 ce             	mov    %rcx,%rsi
+     ced:	48 89 c7             	mov    %rax,%rdi
+     cf0:	e8 08 fd ff ff       	call   9fd <parseredirs>
+     cf5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(!peek(ps, es, "|)&;")){
+     cf9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+     cfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d01:	48 8d 15 07 0e 00 00 	lea    0xe07(%rip),%rdx        # 1b0f <malloc+0x253>
+     d08:	48 89 ce             	mov    %rcx,%rsi
+     d0b:	48 89 c7             	mov    %rax,%rdi
+     d0e:	e8 4d fa ff ff       	call   760 <peek>
+     d13:	85 c0                	test   %eax,%eax
+     d15:	0f 84 46 ff ff ff    	je     c61 <parseexec+0x7e>
+     d1b:	eb 01                	jmp    d1e <parseexec+0x13b>
+      break;
+     d1d:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d22:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d25:	48 63 d2             	movslq %edx,%rdx
+     d28:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     d2f:	00 00 
+  cmd->eargv[argc] = 0;
+     d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     d35:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     d38:	48 63 d2             	movslq %edx,%rdx
+     d3b:	48 83 c2 0a          	add    $0xa,%rdx
+     d3f:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+     d46:	00 00 
+  return ret;
+     d48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+     d4c:	c9                   	leave
+     d4d:	c3                   	ret
+
+0000000000000d4e <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     d4e:	55                   	push   %rbp
+     d4f:	48 89 e5             	mov    %rsp,%rbp
+     d52:	48 83 ec 40          	sub    $0x40,%rsp
+     d56:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     d5a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     d5f:	75 0a                	jne    d6b <nulterminate+0x1d>
+    return 0;
+     d61:	b8 00 00 00 00       	mov    $0x0,%eax
+     d66:	e9 0b 01 00 00       	jmp    e76 <nulterminate+0x128>
+
+  switch(cmd->type){
+     d6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     d6f:	8b 00                	mov    (%rax),%eax
+     d71:	83 f8 05             	cmp    $0x5,%eax
+     d74:	0f 87 f8 00 00 00    	ja     e72 <nulterminate+0x124>
+     d7a:	89 c0                	mov    %eax,%eax
+     d7c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     d83:	00 
+     d84:	48 8d 05 89 0d 00 00 	lea    0xd89(%rip),%rax        # 1b14 <malloc+0x258>
+     d8b:	8b 04 02             	mov    (%rdx,%rax,1),%eax
+     d8e:	48 98                	cltq
+     d90:	48 8d 15 7d 0d 00 00 	lea    0xd7d(%rip),%rdx        # 1b14 <malloc+0x258>
+     d97:	48 01 d0             	add    %rdx,%rax
+     d9a:	ff e0                	jmp    *%rax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+     d9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     da0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    for(i=0; ecmd->argv[i]; i++)
+     da4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     dab:	eb 1a                	jmp    dc7 <nulterminate+0x79>
+      *ecmd->eargv[i] = 0;
+     dad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     db1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     db4:	48 63 d2             	movslq %edx,%rdx
+     db7:	48 83 c2 0a          	add    $0xa,%rdx
+     dbb:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     dc0:	c6 00 00             	movb   $0x0,(%rax)
+    for(i=0; ecmd->argv[i]; i++)
+     dc3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     dc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+     dcb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     dce:	48 63 d2             	movslq %edx,%rdx
+     dd1:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+     dd6:	48 85 c0             	test   %rax,%rax
+     dd9:	75 d2                	jne    dad <nulterminate+0x5f>
+    break;
+     ddb:	e9 92 00 00 00       	jmp    e72 <nulterminate+0x124>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+     de0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     de4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    nulterminate(rcmd->cmd);
+     de8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     dec:	48 8b 40 08          	mov    0x8(%rax),%rax
+     df0:	48 89 c7             	mov    %rax,%rdi
+     df3:	e8 56 ff ff ff       	call   d4e <nulterminate>
+    *rcmd->efile = 0;
+     df8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+     dfc:	48 8b 40 18          	mov    0x18(%rax),%rax
+     e00:	c6 00 00             	movb   $0x0,(%rax)
+    break;
+     e03:	eb 6d                	jmp    e72 <nulterminate+0x124>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     e05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    nulterminate(pcmd->left);
+     e0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e11:	48 8b 40 08          	mov    0x8(%rax),%rax
+     e15:	48 89 c7             	mov    %rax,%rdi
+     e18:	e8 31 ff ff ff       	call   d4e <nulterminate>
+    nulterminate(pcmd->right);
+     e1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     e21:	48 8b 40 10          	mov    0x10(%rax),%rax
+     e25:	48 89 c7             	mov    %rax,%rdi
+     e28:	e8 21 ff ff ff       	call   d4e <nulterminate>
+    break;
+     e2d:	eb 43                	jmp    e72 <nulterminate+0x124>
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     e2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e33:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    nulterminate(lcmd->left);
+     e37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e3b:	48 8b 40 08          	mov    0x8(%rax),%rax
+     e3f:	48 89 c7             	mov    %rax,%rdi
+     e42:	e8 07 ff ff ff       	call   d4e <nulterminate>
+    nulterminate(lcmd->right);
+     e47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     e4b:	48 8b 40 10          	mov    0x10(%rax),%rax
+     e4f:	48 89 c7             	mov    %rax,%rdi
+     e52:	e8 f7 fe ff ff       	call   d4e <nulterminate>
+    break;
+     e57:	eb 19                	jmp    e72 <nulterminate+0x124>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     e59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nulterminate(bcmd->cmd);
+     e61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     e65:	48 8b 40 08          	mov    0x8(%rax),%rax
+     e69:	48 89 c7             	mov    %rax,%rdi
+     e6c:	e8 dd fe ff ff       	call   d4e <nulterminate>
+    break;
+     e71:	90                   	nop
+  }
+  return cmd;
+     e72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     e76:	c9                   	leave
+     e77:	c3                   	ret
+
+0000000000000e78 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     e78:	55                   	push   %rbp
+     e79:	48 89 e5             	mov    %rsp,%rbp
+     e7c:	48 83 ec 10          	sub    $0x10,%rsp
+     e80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     e83:	89 f0                	mov    %esi,%eax
+     e85:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     e88:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     e8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     e8f:	ba 01 00 00 00       	mov    $0x1,%edx
+     e94:	48 89 ce             	mov    %rcx,%rsi
+     e97:	89 c7                	mov    %eax,%edi
+     e99:	e8 63 07 00 00       	call   1601 <write>
+}
+     e9e:	90                   	nop
+     e9f:	c9                   	leave
+     ea0:	c3                   	ret
+
+0000000000000ea1 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     ea1:	55                   	push   %rbp
+     ea2:	48 89 e5             	mov    %rsp,%rbp
+     ea5:	48 83 ec 40          	sub    $0x40,%rsp
+     ea9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     eac:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     eaf:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     eb2:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     eb5:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     eb9:	74 1f                	je     eda <printint64+0x39>
+     ebb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ebe:	c1 e8 1f             	shr    $0x1f,%eax
+     ec1:	0f b6 c0             	movzbl %al,%eax
+     ec4:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     ec7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     ecb:	74 0d                	je     eda <printint64+0x39>
+    x = -xx;
+     ecd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ed0:	f7 d8                	neg    %eax
+     ed2:	48 98                	cltq
+     ed4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     ed8:	eb 09                	jmp    ee3 <printint64+0x42>
+  else
+    x = xx;
+     eda:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     edd:	48 98                	cltq
+     edf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     ee3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     eea:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     eed:	48 63 c8             	movslq %eax,%rcx
+     ef0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+     ef9:	48 f7 f1             	div    %rcx
+     efc:	48 89 d1             	mov    %rdx,%rcx
+     eff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f02:	8d 50 01             	lea    0x1(%rax),%edx
+     f05:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     f08:	48 8d 15 d1 10 00 00 	lea    0x10d1(%rip),%rdx        # 1fe0 <digits.1>
+     f0f:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     f13:	48 98                	cltq
+     f15:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     f19:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     f1c:	48 63 f0             	movslq %eax,%rsi
+     f1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     f23:	ba 00 00 00 00       	mov    $0x0,%edx
+     f28:	48 f7 f6             	div    %rsi
+     f2b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     f2f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     f34:	75 b4                	jne    eea <printint64+0x49>
+
+  if(sgn)
+     f36:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     f3a:	74 2b                	je     f67 <printint64+0xc6>
+    buf[i++] = '-';
+     f3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f3f:	8d 50 01             	lea    0x1(%rax),%edx
+     f42:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     f45:	48 98                	cltq
+     f47:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     f4c:	eb 19                	jmp    f67 <printint64+0xc6>
+    putc(fd, buf[i]);
+     f4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     f51:	48 98                	cltq
+     f53:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     f58:	0f be d0             	movsbl %al,%edx
+     f5b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     f5e:	89 d6                	mov    %edx,%esi
+     f60:	89 c7                	mov    %eax,%edi
+     f62:	e8 11 ff ff ff       	call   e78 <putc>
+  while(--i >= 0)
+     f67:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     f6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     f6f:	79 dd                	jns    f4e <printint64+0xad>
+}
+     f71:	90                   	nop
+     f72:	90                   	nop
+     f73:	c9                   	leave
+     f74:	c3                   	ret
+
+0000000000000f75 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     f75:	55                   	push   %rbp
+     f76:	48 89 e5             	mov    %rsp,%rbp
+     f79:	48 83 ec 30          	sub    $0x30,%rsp
+     f7d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     f80:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     f83:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     f86:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     f89:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     f90:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     f94:	74 17                	je     fad <printint+0x38>
+     f96:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     f9a:	79 11                	jns    fad <printint+0x38>
+    neg = 1;
+     f9c:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     fa3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     fa6:	f7 d8                	neg    %eax
+     fa8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     fab:	eb 06                	jmp    fb3 <printint+0x3e>
+  } else {
+    x = xx;
+     fad:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     fb0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     fb3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     fba:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     fbd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+     fc5:	f7 f1                	div    %ecx
+     fc7:	89 d1                	mov    %edx,%ecx
+     fc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     fcc:	8d 50 01             	lea    0x1(%rax),%edx
+     fcf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     fd2:	89 c9                	mov    %ecx,%ecx
+     fd4:	48 8d 15 25 10 00 00 	lea    0x1025(%rip),%rdx        # 2000 <digits.0>
+     fdb:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     fdf:	48 98                	cltq
+     fe1:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     fe5:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     fe8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     feb:	ba 00 00 00 00       	mov    $0x0,%edx
+     ff0:	f7 f6                	div    %esi
+     ff2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     ff5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     ff9:	75 bf                	jne    fba <printint+0x45>
+  if(neg)
+     ffb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     fff:	74 2b                	je     102c <printint+0xb7>
+    buf[i++] = '-';
+    1001:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1004:	8d 50 01             	lea    0x1(%rax),%edx
+    1007:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    100a:	48 98                	cltq
+    100c:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    1011:	eb 19                	jmp    102c <printint+0xb7>
+    putc(fd, buf[i]);
+    1013:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1016:	48 98                	cltq
+    1018:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    101d:	0f be d0             	movsbl %al,%edx
+    1020:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1023:	89 d6                	mov    %edx,%esi
+    1025:	89 c7                	mov    %eax,%edi
+    1027:	e8 4c fe ff ff       	call   e78 <putc>
+  while(--i >= 0)
+    102c:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    1030:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1034:	79 dd                	jns    1013 <printint+0x9e>
+}
+    1036:	90                   	nop
+    1037:	90                   	nop
+    1038:	c9                   	leave
+    1039:	c3                   	ret
+
+000000000000103a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    103a:	55                   	push   %rbp
+    103b:	48 89 e5             	mov    %rsp,%rbp
+    103e:	48 83 ec 70          	sub    $0x70,%rsp
+    1042:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    1045:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    1049:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    104d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1051:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    1055:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    1059:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    1060:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    1064:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    1068:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    106c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1070:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1077:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    107e:	e9 6b 02 00 00       	jmp    12ee <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1083:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1086:	48 63 d0             	movslq %eax,%rdx
+    1089:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    108d:	48 01 d0             	add    %rdx,%rax
+    1090:	0f b6 00             	movzbl (%rax),%eax
+    1093:	0f be c0             	movsbl %al,%eax
+    1096:	25 ff 00 00 00       	and    $0xff,%eax
+    109b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    109e:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    10a2:	75 30                	jne    10d4 <printf+0x9a>
+      if(c == '%'){
+    10a4:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    10a8:	75 13                	jne    10bd <printf+0x83>
+        state = '%';
+    10aa:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    10b1:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    10b8:	e9 2d 02 00 00       	jmp    12ea <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    10bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    10c0:	0f be d0             	movsbl %al,%edx
+    10c3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    10c6:	89 d6                	mov    %edx,%esi
+    10c8:	89 c7                	mov    %eax,%edi
+    10ca:	e8 a9 fd ff ff       	call   e78 <putc>
+    10cf:	e9 16 02 00 00       	jmp    12ea <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    10d4:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    10d8:	0f 85 0c 02 00 00    	jne    12ea <printf+0x2b0>
+      if(c == 'l') {
+    10de:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    10e2:	75 0c                	jne    10f0 <printf+0xb6>
+        lflag = 1;
+    10e4:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    10eb:	e9 fa 01 00 00       	jmp    12ea <printf+0x2b0>
+      } else if(c == 'd'){
+    10f0:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    10f4:	0f 85 95 00 00 00    	jne    118f <printf+0x155>
+        if (lflag == 1)
+    10fa:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    10fe:	75 49                	jne    1149 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1100:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1103:	83 f8 2f             	cmp    $0x2f,%eax
+    1106:	77 17                	ja     111f <printf+0xe5>
+    1108:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    110c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    110f:	89 d2                	mov    %edx,%edx
+    1111:	48 01 d0             	add    %rdx,%rax
+    1114:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1117:	83 c2 08             	add    $0x8,%edx
+    111a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    111d:	eb 0c                	jmp    112b <printf+0xf1>
+    111f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1123:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1127:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    112b:	48 8b 00             	mov    (%rax),%rax
+    112e:	89 c6                	mov    %eax,%esi
+    1130:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1133:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1138:	ba 0a 00 00 00       	mov    $0xa,%edx
+    113d:	89 c7                	mov    %eax,%edi
+    113f:	e8 5d fd ff ff       	call   ea1 <printint64>
+    1144:	e9 9a 01 00 00       	jmp    12e3 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    1149:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    114c:	83 f8 2f             	cmp    $0x2f,%eax
+    114f:	77 17                	ja     1168 <printf+0x12e>
+    1151:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1155:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1158:	89 d2                	mov    %edx,%edx
+    115a:	48 01 d0             	add    %rdx,%rax
+    115d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1160:	83 c2 08             	add    $0x8,%edx
+    1163:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1166:	eb 0c                	jmp    1174 <printf+0x13a>
+    1168:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    116c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1170:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1174:	8b 30                	mov    (%rax),%esi
+    1176:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1179:	b9 01 00 00 00       	mov    $0x1,%ecx
+    117e:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1183:	89 c7                	mov    %eax,%edi
+    1185:	e8 eb fd ff ff       	call   f75 <printint>
+    118a:	e9 54 01 00 00       	jmp    12e3 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    118f:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1193:	74 0a                	je     119f <printf+0x165>
+    1195:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    1199:	0f 85 95 00 00 00    	jne    1234 <printf+0x1fa>
+        if (lflag == 1)
+    119f:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    11a3:	75 49                	jne    11ee <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    11a5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    11a8:	83 f8 2f             	cmp    $0x2f,%eax
+    11ab:	77 17                	ja     11c4 <printf+0x18a>
+    11ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    11b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11b4:	89 d2                	mov    %edx,%edx
+    11b6:	48 01 d0             	add    %rdx,%rax
+    11b9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11bc:	83 c2 08             	add    $0x8,%edx
+    11bf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    11c2:	eb 0c                	jmp    11d0 <printf+0x196>
+    11c4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    11c8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    11cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    11d0:	48 8b 00             	mov    (%rax),%rax
+    11d3:	89 c6                	mov    %eax,%esi
+    11d5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    11d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    11dd:	ba 10 00 00 00       	mov    $0x10,%edx
+    11e2:	89 c7                	mov    %eax,%edi
+    11e4:	e8 b8 fc ff ff       	call   ea1 <printint64>
+        if (lflag == 1)
+    11e9:	e9 f5 00 00 00       	jmp    12e3 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    11ee:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    11f1:	83 f8 2f             	cmp    $0x2f,%eax
+    11f4:	77 17                	ja     120d <printf+0x1d3>
+    11f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    11fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    11fd:	89 d2                	mov    %edx,%edx
+    11ff:	48 01 d0             	add    %rdx,%rax
+    1202:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1205:	83 c2 08             	add    $0x8,%edx
+    1208:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    120b:	eb 0c                	jmp    1219 <printf+0x1df>
+    120d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    1211:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1215:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1219:	8b 30                	mov    (%rax),%esi
+    121b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    121e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1223:	ba 10 00 00 00       	mov    $0x10,%edx
+    1228:	89 c7                	mov    %eax,%edi
+    122a:	e8 46 fd ff ff       	call   f75 <printint>
+        if (lflag == 1)
+    122f:	e9 af 00 00 00       	jmp    12e3 <printf+0x2a9>
+      } else if(c == 's'){
+    1234:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    1238:	75 6e                	jne    12a8 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    123a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    123d:	83 f8 2f             	cmp    $0x2f,%eax
+    1240:	77 17                	ja     1259 <printf+0x21f>
+    1242:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1246:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1249:	89 d2                	mov    %edx,%edx
+    124b:	48 01 d0             	add    %rdx,%rax
+    124e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1251:	83 c2 08             	add    $0x8,%edx
+    1254:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1257:	eb 0c                	jmp    1265 <printf+0x22b>
+    1259:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    125d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1261:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1265:	48 8b 00             	mov    (%rax),%rax
+    1268:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    126c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1271:	75 28                	jne    129b <printf+0x261>
+          s = "(null)";
+    1273:	48 8d 05 b2 08 00 00 	lea    0x8b2(%rip),%rax        # 1b2c <malloc+0x270>
+    127a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    127e:	eb 1b                	jmp    129b <printf+0x261>
+          putc(fd, *s);
+    1280:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1284:	0f b6 00             	movzbl (%rax),%eax
+    1287:	0f be d0             	movsbl %al,%edx
+    128a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    128d:	89 d6                	mov    %edx,%esi
+    128f:	89 c7                	mov    %eax,%edi
+    1291:	e8 e2 fb ff ff       	call   e78 <putc>
+        for(; *s; s++)
+    1296:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    129b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    129f:	0f b6 00             	movzbl (%rax),%eax
+    12a2:	84 c0                	test   %al,%al
+    12a4:	75 da                	jne    1280 <printf+0x246>
+    12a6:	eb 3b                	jmp    12e3 <printf+0x2a9>
+      } else if(c == '%'){
+    12a8:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    12ac:	75 14                	jne    12c2 <printf+0x288>
+        putc(fd, c);
+    12ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    12b1:	0f be d0             	movsbl %al,%edx
+    12b4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12b7:	89 d6                	mov    %edx,%esi
+    12b9:	89 c7                	mov    %eax,%edi
+    12bb:	e8 b8 fb ff ff       	call   e78 <putc>
+    12c0:	eb 21                	jmp    12e3 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    12c2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12c5:	be 25 00 00 00       	mov    $0x25,%esi
+    12ca:	89 c7                	mov    %eax,%edi
+    12cc:	e8 a7 fb ff ff       	call   e78 <putc>
+        putc(fd, c);
+    12d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    12d4:	0f be d0             	movsbl %al,%edx
+    12d7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    12da:	89 d6                	mov    %edx,%esi
+    12dc:	89 c7                	mov    %eax,%edi
+    12de:	e8 95 fb ff ff       	call   e78 <putc>
+      }
+      state = 0;
+    12e3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    12ea:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    12ee:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    12f1:	48 63 d0             	movslq %eax,%rdx
+    12f4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    12f8:	48 01 d0             	add    %rdx,%rax
+    12fb:	0f b6 00             	movzbl (%rax),%eax
+    12fe:	84 c0                	test   %al,%al
+    1300:	0f 85 7d fd ff ff    	jne    1083 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1306:	90                   	nop
+    1307:	90                   	nop
+    1308:	c9                   	leave
+    1309:	c3                   	ret
+
+000000000000130a <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    130a:	55                   	push   %rbp
+    130b:	48 89 e5             	mov    %rsp,%rbp
+    130e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1312:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1315:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    1318:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    131c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    131f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1322:	48 89 ce             	mov    %rcx,%rsi
+    1325:	48 89 f7             	mov    %rsi,%rdi
+    1328:	89 d1                	mov    %edx,%ecx
+    132a:	fc                   	cld
+    132b:	f3 aa                	rep stos %al,%es:(%rdi)
+    132d:	89 ca                	mov    %ecx,%edx
+    132f:	48 89 fe             	mov    %rdi,%rsi
+    1332:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    1336:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    1339:	90                   	nop
+    133a:	5d                   	pop    %rbp
+    133b:	c3                   	ret
+
+000000000000133c <strcpy>:
+{
+    133c:	55                   	push   %rbp
+    133d:	48 89 e5             	mov    %rsp,%rbp
+    1340:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1344:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    1348:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    134c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1350:	90                   	nop
+    1351:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1355:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1359:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    135d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1361:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1365:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    1369:	0f b6 12             	movzbl (%rdx),%edx
+    136c:	88 10                	mov    %dl,(%rax)
+    136e:	0f b6 00             	movzbl (%rax),%eax
+    1371:	84 c0                	test   %al,%al
+    1373:	75 dc                	jne    1351 <strcpy+0x15>
+  return os;
+    1375:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1379:	5d                   	pop    %rbp
+    137a:	c3                   	ret
+
+000000000000137b <strcmp>:
+{
+    137b:	55                   	push   %rbp
+    137c:	48 89 e5             	mov    %rsp,%rbp
+    137f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1383:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1387:	eb 0a                	jmp    1393 <strcmp+0x18>
+    p++, q++;
+    1389:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    138e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1393:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1397:	0f b6 00             	movzbl (%rax),%eax
+    139a:	84 c0                	test   %al,%al
+    139c:	74 12                	je     13b0 <strcmp+0x35>
+    139e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13a2:	0f b6 10             	movzbl (%rax),%edx
+    13a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13a9:	0f b6 00             	movzbl (%rax),%eax
+    13ac:	38 c2                	cmp    %al,%dl
+    13ae:	74 d9                	je     1389 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    13b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    13b4:	0f b6 00             	movzbl (%rax),%eax
+    13b7:	0f b6 d0             	movzbl %al,%edx
+    13ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13be:	0f b6 00             	movzbl (%rax),%eax
+    13c1:	0f b6 c0             	movzbl %al,%eax
+    13c4:	29 c2                	sub    %eax,%edx
+    13c6:	89 d0                	mov    %edx,%eax
+}
+    13c8:	5d                   	pop    %rbp
+    13c9:	c3                   	ret
+
+00000000000013ca <strlen>:
+{
+    13ca:	55                   	push   %rbp
+    13cb:	48 89 e5             	mov    %rsp,%rbp
+    13ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    13d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    13d9:	eb 04                	jmp    13df <strlen+0x15>
+    13db:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    13df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    13e2:	48 63 d0             	movslq %eax,%rdx
+    13e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e9:	48 01 d0             	add    %rdx,%rax
+    13ec:	0f b6 00             	movzbl (%rax),%eax
+    13ef:	84 c0                	test   %al,%al
+    13f1:	75 e8                	jne    13db <strlen+0x11>
+  return n;
+    13f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    13f6:	5d                   	pop    %rbp
+    13f7:	c3                   	ret
+
+00000000000013f8 <memset>:
+{
+    13f8:	55                   	push   %rbp
+    13f9:	48 89 e5             	mov    %rsp,%rbp
+    13fc:	48 83 ec 10          	sub    $0x10,%rsp
+    1400:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1404:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1407:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    140a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    140d:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    1410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1414:	89 ce                	mov    %ecx,%esi
+    1416:	48 89 c7             	mov    %rax,%rdi
+    1419:	e8 ec fe ff ff       	call   130a <stosb>
+  return dst;
+    141e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    1422:	c9                   	leave
+    1423:	c3                   	ret
+
+0000000000001424 <strchr>:
+{
+    1424:	55                   	push   %rbp
+    1425:	48 89 e5             	mov    %rsp,%rbp
+    1428:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    142c:	89 f0                	mov    %esi,%eax
+    142e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1431:	eb 17                	jmp    144a <strchr+0x26>
+    if(*s == c)
+    1433:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1437:	0f b6 00             	movzbl (%rax),%eax
+    143a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    143d:	75 06                	jne    1445 <strchr+0x21>
+      return (char*)s;
+    143f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1443:	eb 15                	jmp    145a <strchr+0x36>
+  for(; *s; s++)
+    1445:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    144a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    144e:	0f b6 00             	movzbl (%rax),%eax
+    1451:	84 c0                	test   %al,%al
+    1453:	75 de                	jne    1433 <strchr+0xf>
+  return 0;
+    1455:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    145a:	5d                   	pop    %rbp
+    145b:	c3                   	ret
+
+000000000000145c <gets>:
+gets(char *buf, int max)
+{
+    145c:	55                   	push   %rbp
+    145d:	48 89 e5             	mov    %rsp,%rbp
+    1460:	48 83 ec 20          	sub    $0x20,%rsp
+    1464:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1468:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    146b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1472:	eb 48                	jmp    14bc <gets+0x60>
+    cc = read(0, &c, 1);
+    1474:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1478:	ba 01 00 00 00       	mov    $0x1,%edx
+    147d:	48 89 c6             	mov    %rax,%rsi
+    1480:	bf 00 00 00 00       	mov    $0x0,%edi
+    1485:	e8 6f 01 00 00       	call   15f9 <read>
+    148a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    148d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1491:	7e 36                	jle    14c9 <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1493:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1496:	8d 50 01             	lea    0x1(%rax),%edx
+    1499:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    149c:	48 63 d0             	movslq %eax,%rdx
+    149f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14a3:	48 01 c2             	add    %rax,%rdx
+    14a6:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    14aa:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    14ac:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    14b0:	3c 0a                	cmp    $0xa,%al
+    14b2:	74 16                	je     14ca <gets+0x6e>
+    14b4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    14b8:	3c 0d                	cmp    $0xd,%al
+    14ba:	74 0e                	je     14ca <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    14bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14bf:	83 c0 01             	add    $0x1,%eax
+    14c2:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    14c5:	7f ad                	jg     1474 <gets+0x18>
+    14c7:	eb 01                	jmp    14ca <gets+0x6e>
+      break;
+    14c9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    14ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14cd:	48 63 d0             	movslq %eax,%rdx
+    14d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14d4:	48 01 d0             	add    %rdx,%rax
+    14d7:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    14da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    14de:	c9                   	leave
+    14df:	c3                   	ret
+
+00000000000014e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    14e0:	55                   	push   %rbp
+    14e1:	48 89 e5             	mov    %rsp,%rbp
+    14e4:	48 83 ec 20          	sub    $0x20,%rsp
+    14e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    14ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    14f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    14f4:	be 00 00 00 00       	mov    $0x0,%esi
+    14f9:	48 89 c7             	mov    %rax,%rdi
+    14fc:	e8 20 01 00 00       	call   1621 <open>
+    1501:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1504:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1508:	79 07                	jns    1511 <stat+0x31>
+    return -1;
+    150a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    150f:	eb 21                	jmp    1532 <stat+0x52>
+  r = fstat(fd, st);
+    1511:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1515:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1518:	48 89 d6             	mov    %rdx,%rsi
+    151b:	89 c7                	mov    %eax,%edi
+    151d:	e8 17 01 00 00       	call   1639 <fstat>
+    1522:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1525:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1528:	89 c7                	mov    %eax,%edi
+    152a:	e8 da 00 00 00       	call   1609 <close>
+  return r;
+    152f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1532:	c9                   	leave
+    1533:	c3                   	ret
+
+0000000000001534 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1534:	55                   	push   %rbp
+    1535:	48 89 e5             	mov    %rsp,%rbp
+    1538:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    153c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1543:	eb 28                	jmp    156d <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1545:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1548:	89 d0                	mov    %edx,%eax
+    154a:	c1 e0 02             	shl    $0x2,%eax
+    154d:	01 d0                	add    %edx,%eax
+    154f:	01 c0                	add    %eax,%eax
+    1551:	89 c1                	mov    %eax,%ecx
+    1553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1557:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    155b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    155f:	0f b6 00             	movzbl (%rax),%eax
+    1562:	0f be c0             	movsbl %al,%eax
+    1565:	01 c8                	add    %ecx,%eax
+    1567:	83 e8 30             	sub    $0x30,%eax
+    156a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    156d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1571:	0f b6 00             	movzbl (%rax),%eax
+    1574:	3c 2f                	cmp    $0x2f,%al
+    1576:	7e 0b                	jle    1583 <atoi+0x4f>
+    1578:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    157c:	0f b6 00             	movzbl (%rax),%eax
+    157f:	3c 39                	cmp    $0x39,%al
+    1581:	7e c2                	jle    1545 <atoi+0x11>
+  return n;
+    1583:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1586:	5d                   	pop    %rbp
+    1587:	c3                   	ret
+
+0000000000001588 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1588:	55                   	push   %rbp
+    1589:	48 89 e5             	mov    %rsp,%rbp
+    158c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1590:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1594:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    159b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    159f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    15a3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    15a7:	eb 1d                	jmp    15c6 <memmove+0x3e>
+    *dst++ = *src++;
+    15a9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    15ad:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    15b1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    15b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15b9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    15bd:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    15c1:	0f b6 12             	movzbl (%rdx),%edx
+    15c4:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    15c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15c9:	8d 50 ff             	lea    -0x1(%rax),%edx
+    15cc:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    15cf:	85 c0                	test   %eax,%eax
+    15d1:	7f d6                	jg     15a9 <memmove+0x21>
+  return vdst;
+    15d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    15d7:	5d                   	pop    %rbp
+    15d8:	c3                   	ret
+
+00000000000015d9 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    15d9:	b8 01 00 00 00       	mov    $0x1,%eax
+    15de:	cd 40                	int    $0x40
+    15e0:	c3                   	ret
+
+00000000000015e1 <exit>:
+SYSCALL(exit)
+    15e1:	b8 02 00 00 00       	mov    $0x2,%eax
+    15e6:	cd 40                	int    $0x40
+    15e8:	c3                   	ret
+
+00000000000015e9 <wait>:
+SYSCALL(wait)
+    15e9:	b8 03 00 00 00       	mov    $0x3,%eax
+    15ee:	cd 40                	int    $0x40
+    15f0:	c3                   	ret
+
+00000000000015f1 <pipe>:
+SYSCALL(pipe)
+    15f1:	b8 04 00 00 00       	mov    $0x4,%eax
+    15f6:	cd 40                	int    $0x40
+    15f8:	c3                   	ret
+
+00000000000015f9 <read>:
+SYSCALL(read)
+    15f9:	b8 05 00 00 00       	mov    $0x5,%eax
+    15fe:	cd 40                	int    $0x40
+    1600:	c3                   	ret
+
+0000000000001601 <write>:
+SYSCALL(write)
+    1601:	b8 10 00 00 00       	mov    $0x10,%eax
+    1606:	cd 40                	int    $0x40
+    1608:	c3                   	ret
+
+0000000000001609 <close>:
+SYSCALL(close)
+    1609:	b8 15 00 00 00       	mov    $0x15,%eax
+    160e:	cd 40                	int    $0x40
+    1610:	c3                   	ret
+
+0000000000001611 <kill>:
+SYSCALL(kill)
+    1611:	b8 06 00 00 00       	mov    $0x6,%eax
+    1616:	cd 40                	int    $0x40
+    1618:	c3                   	ret
+
+0000000000001619 <exec>:
+SYSCALL(exec)
+    1619:	b8 07 00 00 00       	mov    $0x7,%eax
+    161e:	cd 40                	int    $0x40
+    1620:	c3                   	ret
+
+0000000000001621 <open>:
+SYSCALL(open)
+    1621:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1626:	cd 40                	int    $0x40
+    1628:	c3                   	ret
+
+0000000000001629 <mknod>:
+SYSCALL(mknod)
+    1629:	b8 11 00 00 00       	mov    $0x11,%eax
+    162e:	cd 40                	int    $0x40
+    1630:	c3                   	ret
+
+0000000000001631 <unlink>:
+SYSCALL(unlink)
+    1631:	b8 12 00 00 00       	mov    $0x12,%eax
+    1636:	cd 40                	int    $0x40
+    1638:	c3                   	ret
+
+0000000000001639 <fstat>:
+SYSCALL(fstat)
+    1639:	b8 08 00 00 00       	mov    $0x8,%eax
+    163e:	cd 40                	int    $0x40
+    1640:	c3                   	ret
+
+0000000000001641 <link>:
+SYSCALL(link)
+    1641:	b8 13 00 00 00       	mov    $0x13,%eax
+    1646:	cd 40                	int    $0x40
+    1648:	c3                   	ret
+
+0000000000001649 <mkdir>:
+SYSCALL(mkdir)
+    1649:	b8 14 00 00 00       	mov    $0x14,%eax
+    164e:	cd 40                	int    $0x40
+    1650:	c3                   	ret
+
+0000000000001651 <chdir>:
+SYSCALL(chdir)
+    1651:	b8 09 00 00 00       	mov    $0x9,%eax
+    1656:	cd 40                	int    $0x40
+    1658:	c3                   	ret
+
+0000000000001659 <dup>:
+SYSCALL(dup)
+    1659:	b8 0a 00 00 00       	mov    $0xa,%eax
+    165e:	cd 40                	int    $0x40
+    1660:	c3                   	ret
+
+0000000000001661 <getpid>:
+SYSCALL(getpid)
+    1661:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1666:	cd 40                	int    $0x40
+    1668:	c3                   	ret
+
+0000000000001669 <sbrk>:
+SYSCALL(sbrk)
+    1669:	b8 0c 00 00 00       	mov    $0xc,%eax
+    166e:	cd 40                	int    $0x40
+    1670:	c3                   	ret
+
+0000000000001671 <sleep>:
+SYSCALL(sleep)
+    1671:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1676:	cd 40                	int    $0x40
+    1678:	c3                   	ret
+
+0000000000001679 <uptime>:
+SYSCALL(uptime)
+    1679:	b8 0e 00 00 00       	mov    $0xe,%eax
+    167e:	cd 40                	int    $0x40
+    1680:	c3                   	ret
+
+0000000000001681 <sysinfo>:
+SYSCALL(sysinfo)
+    1681:	b8 16 00 00 00       	mov    $0x16,%eax
+    1686:	cd 40                	int    $0x40
+    1688:	c3                   	ret
+
+0000000000001689 <mmap>:
+SYSCALL(mmap)
+    1689:	b8 17 00 00 00       	mov    $0x17,%eax
+    168e:	cd 40                	int    $0x40
+    1690:	c3                   	ret
+
+0000000000001691 <munmap>:
+SYSCALL(munmap)
+    1691:	b8 18 00 00 00       	mov    $0x18,%eax
+    1696:	cd 40                	int    $0x40
+    1698:	c3                   	ret
+
+0000000000001699 <crashn>:
+SYSCALL(crashn)
+    1699:	b8 19 00 00 00       	mov    $0x19,%eax
+    169e:	cd 40                	int    $0x40
+    16a0:	c3                   	ret
+
+00000000000016a1 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    16a1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    16a6:	cd 40                	int    $0x40
+    16a8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    16ab:	74 02                	je     16af <mmap2+0xe>
+    16ad:	89 c0                	mov    %eax,%eax
+    16af:	c3                   	ret
+
+00000000000016b0 <munmap2>:
+SYSCALL(munmap2)
+    16b0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    16b5:	cd 40                	int    $0x40
+    16b7:	c3                   	ret
+
+00000000000016b8 <msync>:
+SYSCALL(msync)
+    16b8:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    16bd:	cd 40                	int    $0x40
+    16bf:	c3                   	ret
+
+00000000000016c0 <sendfile>:
+SYSCALL(sendfile)
+    16c0:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    16c5:	cd 40                	int    $0x40
+    16c7:	c3                   	ret
+
+00000000000016c8 <splice>:
+SYSCALL(splice)
+    16c8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    16cd:	cd 40                	int    $0x40
+    16cf:	c3                   	ret
+
+00000000000016d0 <pread>:
+SYSCALL(pread)
+    16d0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    16d5:	cd 40                	int    $0x40
+    16d7:	c3                   	ret
+
+00000000000016d8 <pwrite>:
+SYSCALL(pwrite)
+    16d8:	b8 20 00 00 00       	mov    $0x20,%eax
+    16dd:	cd 40                	int    $0x40
+    16df:	c3                   	ret
+
+00000000000016e0 <readv>:
+SYSCALL(readv)
+    16e0:	b8 21 00 00 00       	mov    $0x21,%eax
+    16e5:	cd 40                	int    $0x40
+    16e7:	c3                   	ret
+
+00000000000016e8 <writev>:
+SYSCALL(writev)
+    16e8:	b8 22 00 00 00       	mov    $0x22,%eax
+    16ed:	cd 40                	int    $0x40
+    16ef:	c3                   	ret
+
+00000000000016f0 <poll>:
+SYSCALL(poll)
+    16f0:	b8 23 00 00 00       	mov    $0x23,%eax
+    16f5:	cd 40                	int    $0x40
+    16f7:	c3                   	ret
+
+00000000000016f8 <pipe2>:
+SYSCALL(pipe2)
+    16f8:	b8 24 00 00 00       	mov    $0x24,%eax
+    16fd:	cd 40                	int    $0x40
+    16ff:	c3                   	ret
+
+0000000000001700 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1700:	55                   	push   %rbp
+    1701:	48 89 e5             	mov    %rsp,%rbp
+    1704:	48 83 ec 20          	sub    $0x20,%rsp
+    1708:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    170c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1710:	48 83 e8 10          	sub    $0x10,%rax
+    1714:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1718:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    171c:	48 8b 10             	mov    (%rax),%rdx
+    171f:	48 8d 05 8a 09 00 00 	lea    0x98a(%rip),%rax        # 20b0 <bigblock>
+    1726:	48 39 c2             	cmp    %rax,%rdx
+    1729:	75 1f                	jne    174a <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    172b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    172f:	8b 40 08             	mov    0x8(%rax),%eax
+    1732:	c1 e0 04             	shl    $0x4,%eax
+    1735:	89 c2                	mov    %eax,%edx
+    1737:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    173b:	89 d6                	mov    %edx,%esi
+    173d:	48 89 c7             	mov    %rax,%rdi
+    1740:	e8 6b ff ff ff       	call   16b0 <munmap2>
+    return;
+    1745:	e9 0b 01 00 00       	jmp    1855 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    174a:	48 8b 05 4f 09 00 00 	mov    0x94f(%rip),%rax        # 20a0 <freep>
+    1751:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1755:	eb 2f                	jmp    1786 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    175b:	48 8b 00             	mov    (%rax),%rax
+    175e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1762:	72 17                	jb     177b <free+0x7b>
+    1764:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1768:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    176c:	72 2f                	jb     179d <free+0x9d>
+    176e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1772:	48 8b 00             	mov    (%rax),%rax
+    1775:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1779:	72 22                	jb     179d <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    177b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    177f:	48 8b 00             	mov    (%rax),%rax
+    1782:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1786:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    178a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    178e:	73 c7                	jae    1757 <free+0x57>
+    1790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1794:	48 8b 00             	mov    (%rax),%rax
+    1797:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    179b:	73 ba                	jae    1757 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    179d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17a1:	8b 40 08             	mov    0x8(%rax),%eax
+    17a4:	89 c0                	mov    %eax,%eax
+    17a6:	48 c1 e0 04          	shl    $0x4,%rax
+    17aa:	48 89 c2             	mov    %rax,%rdx
+    17ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17b1:	48 01 c2             	add    %rax,%rdx
+    17b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17b8:	48 8b 00             	mov    (%rax),%rax
+    17bb:	48 39 c2             	cmp    %rax,%rdx
+    17be:	75 2d                	jne    17ed <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    17c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17c4:	8b 50 08             	mov    0x8(%rax),%edx
+    17c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17cb:	48 8b 00             	mov    (%rax),%rax
+    17ce:	8b 40 08             	mov    0x8(%rax),%eax
+    17d1:	01 c2                	add    %eax,%edx
+    17d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17d7:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    17da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17de:	48 8b 00             	mov    (%rax),%rax
+    17e1:	48 8b 10             	mov    (%rax),%rdx
+    17e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17e8:	48 89 10             	mov    %rdx,(%rax)
+    17eb:	eb 0e                	jmp    17fb <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    17ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17f1:	48 8b 10             	mov    (%rax),%rdx
+    17f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    17f8:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    17fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    17ff:	8b 40 08             	mov    0x8(%rax),%eax
+    1802:	89 c0                	mov    %eax,%eax
+    1804:	48 c1 e0 04          	shl    $0x4,%rax
+    1808:	48 89 c2             	mov    %rax,%rdx
+    180b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    180f:	48 01 d0             	add    %rdx,%rax
+    1812:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1816:	75 27                	jne    183f <free+0x13f>
+    p->s.size += bp->s.size;
+    1818:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    181c:	8b 50 08             	mov    0x8(%rax),%edx
+    181f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1823:	8b 40 08             	mov    0x8(%rax),%eax
+    1826:	01 c2                	add    %eax,%edx
+    1828:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    182c:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    182f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1833:	48 8b 10             	mov    (%rax),%rdx
+    1836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    183a:	48 89 10             	mov    %rdx,(%rax)
+    183d:	eb 0b                	jmp    184a <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    183f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1843:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1847:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    184a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    184e:	48 89 05 4b 08 00 00 	mov    %rax,0x84b(%rip)        # 20a0 <freep>
+}
+    1855:	c9                   	leave
+    1856:	c3                   	ret
+
+0000000000001857 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1857:	55                   	push   %rbp
+    1858:	48 89 e5             	mov    %rsp,%rbp
+    185b:	48 83 ec 20          	sub    $0x20,%rsp
+    185f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1862:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1869:	77 07                	ja     1872 <morecore+0x1b>
+    nu = 4096;
+    186b:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1872:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1875:	c1 e0 04             	shl    $0x4,%eax
+    1878:	89 c7                	mov    %eax,%edi
+    187a:	e8 ea fd ff ff       	call   1669 <sbrk>
+    187f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1883:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1888:	75 07                	jne    1891 <morecore+0x3a>
+    return 0;
+    188a:	b8 00 00 00 00       	mov    $0x0,%eax
+    188f:	eb 29                	jmp    18ba <morecore+0x63>
+  hp = (Header*)p;
+    1891:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1895:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1899:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    189d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    18a0:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    18a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    18a7:	48 83 c0 10          	add    $0x10,%rax
+    18ab:	48 89 c7             	mov    %rax,%rdi
+    18ae:	e8 4d fe ff ff       	call   1700 <free>
+  return freep;
+    18b3:	48 8b 05 e6 07 00 00 	mov    0x7e6(%rip),%rax        # 20a0 <freep>
+}
+    18ba:	c9                   	leave
+    18bb:	c3                   	ret
+
+00000000000018bc <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    18bc:	55                   	push   %rbp
+    18bd:	48 89 e5             	mov    %rsp,%rbp
+    18c0:	48 83 ec 30          	sub    $0x30,%rsp
+    18c4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    18c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    18ca:	48 83 c0 0f          	add    $0xf,%rax
+    18ce:	48 c1 e8 04          	shr    $0x4,%rax
+    18d2:	83 c0 01             	add    $0x1,%eax
+    18d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    18d8:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    18df:	76 62                	jbe    1943 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    18e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    18e4:	c1 e0 04             	shl    $0x4,%eax
+    18e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    18ed:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    18f3:	b9 22 00 00 00       	mov    $0x22,%ecx
+    18f8:	ba 03 00 00 00       	mov    $0x3,%edx
+    18fd:	89 c6                	mov    %eax,%esi
+    18ff:	bf 00 00 00 00       	mov    $0x0,%edi
+    1904:	e8 98 fd ff ff       	call   16a1 <mmap2>
+    1909:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    190d:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1912:	75 0a                	jne    191e <malloc+0x62>
+      return 0;
+    1914:	b8 00 00 00 00       	mov    $0x0,%eax
+    1919:	e9 1c 01 00 00       	jmp    1a3a <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    191e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1922:	48 8d 15 87 07 00 00 	lea    0x787(%rip),%rdx        # 20b0 <bigblock>
+    1929:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    192c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1930:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1933:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1936:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    193a:	48 83 c0 10          	add    $0x10,%rax
+    193e:	e9 f7 00 00 00       	jmp    1a3a <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1943:	48 8b 05 56 07 00 00 	mov    0x756(%rip),%rax        # 20a0 <freep>
+    194a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    194e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1953:	75 2e                	jne    1983 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1955:	48 8d 05 34 07 00 00 	lea    0x734(%rip),%rax        # 2090 <base>
+    195c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1960:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1964:	48 89 05 35 07 00 00 	mov    %rax,0x735(%rip)        # 20a0 <freep>
+    196b:	48 8b 05 2e 07 00 00 	mov    0x72e(%rip),%rax        # 20a0 <freep>
+    1972:	48 89 05 17 07 00 00 	mov    %rax,0x717(%rip)        # 2090 <base>
+    base.s.size = 0;
+    1979:	c7 05 15 07 00 00 00 	movl   $0x0,0x715(%rip)        # 2098 <base+0x8>
+    1980:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1983:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1987:	48 8b 00             	mov    (%rax),%rax
+    198a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    198e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1992:	8b 40 08             	mov    0x8(%rax),%eax
+    1995:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1998:	72 5f                	jb     19f9 <malloc+0x13d>
+      if(p->s.size == nunits)
+    199a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    199e:	8b 40 08             	mov    0x8(%rax),%eax
+    19a1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    19a4:	75 10                	jne    19b6 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    19a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19aa:	48 8b 10             	mov    (%rax),%rdx
+    19ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19b1:	48 89 10             	mov    %rdx,(%rax)
+    19b4:	eb 2e                	jmp    19e4 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    19b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19ba:	8b 40 08             	mov    0x8(%rax),%eax
+    19bd:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    19c0:	89 c2                	mov    %eax,%edx
+    19c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c6:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    19c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19cd:	8b 40 08             	mov    0x8(%rax),%eax
+    19d0:	89 c0                	mov    %eax,%eax
+    19d2:	48 c1 e0 04          	shl    $0x4,%rax
+    19d6:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    19da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19de:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    19e1:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    19e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    19e8:	48 89 05 b1 06 00 00 	mov    %rax,0x6b1(%rip)        # 20a0 <freep>
+      return (void*)(p + 1);
+    19ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19f3:	48 83 c0 10          	add    $0x10,%rax
+    19f7:	eb 41                	jmp    1a3a <malloc+0x17e>
+    }
+    if(p == freep)
+    19f9:	48 8b 05 a0 06 00 00 	mov    0x6a0(%rip),%rax        # 20a0 <freep>
+    1a00:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1a04:	75 1c                	jne    1a22 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1a06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1a09:	89 c7                	mov    %eax,%edi
+    1a0b:	e8 47 fe ff ff       	call   1857 <morecore>
+    1a10:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1a14:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1a19:	75 07                	jne    1a22 <malloc+0x166>
+        return 0;
+    1a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1a20:	eb 18                	jmp    1a3a <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1a22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a26:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1a2e:	48 8b 00             	mov    (%rax),%rax
+    1a31:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1a35:	e9 54 ff ff ff       	jmp    198e <malloc+0xd2>
+  }
+}
+    1a3a:	c9                   	leave
+    1a3b:	c3                   	ret
@@ -0,0 +1,2886 @@
+
+out/user/_splicetest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <makefile>:
+// Byte k of splice1.txt.
+#define BYTE(k) ((char)('a' + (k) / 7 % 26))
+
+void
+makefile(void)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd, k;
+
+  if((fd = open("splice1.txt", O_CREATE | O_RDWR)) < 0)
+       8:	be 02 02 00 00       	mov    $0x202,%esi
+       d:	48 8d 05 bc 1f 00 00 	lea    0x1fbc(%rip),%rax        # 1fd0 <malloc+0x182>
+      14:	48 89 c7             	mov    %rax,%rdi
+      17:	e8 97 1b 00 00       	call   1bb3 <open>
+      1c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      1f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+      23:	79 5c                	jns    81 <makefile+0x81>
+    error("unable to create splice1.txt");
+      25:	8b 05 a5 26 00 00    	mov    0x26a5(%rip),%eax        # 26d0 <stdout>
+      2b:	ba 1d 00 00 00       	mov    $0x1d,%edx
+      30:	48 8d 0d a5 1f 00 00 	lea    0x1fa5(%rip),%rcx        # 1fdc <malloc+0x18e>
+      37:	48 89 ce             	mov    %rcx,%rsi
+      3a:	89 c7                	mov    %eax,%edi
+      3c:	b8 00 00 00 00       	mov    $0x0,%eax
+      41:	e8 86 15 00 00       	call   15cc <printf>
+      46:	8b 05 84 26 00 00    	mov    0x2684(%rip),%eax        # 26d0 <stdout>
+      4c:	48 8d 15 9b 1f 00 00 	lea    0x1f9b(%rip),%rdx        # 1fee <malloc+0x1a0>
+      53:	48 89 d6             	mov    %rdx,%rsi
+      56:	89 c7                	mov    %eax,%edi
+      58:	b8 00 00 00 00       	mov    $0x0,%eax
+      5d:	e8 6a 15 00 00       	call   15cc <printf>
+      62:	8b 05 68 26 00 00    	mov    0x2668(%rip),%eax        # 26d0 <stdout>
+      68:	48 8d 15 9c 1f 00 00 	lea    0x1f9c(%rip),%rdx        # 200b <malloc+0x1bd>
+      6f:	48 89 d6             	mov    %rdx,%rsi
+      72:	89 c7                	mov    %eax,%edi
+      74:	b8 00 00 00 00       	mov    $0x0,%eax
+      79:	e8 4e 15 00 00       	call   15cc <printf>
+      7e:	90                   	nop
+      7f:	eb fd                	jmp    7e <makefile+0x7e>
+  for(k = 0; k < FILESZ; k++)
+      81:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+      88:	eb 56                	jmp    e0 <makefile+0xe0>
+    buf[k] = BYTE(k);
+      8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      8d:	48 63 d0             	movslq %eax,%rdx
+      90:	48 69 d2 93 24 49 92 	imul   $0xffffffff92492493,%rdx,%rdx
+      97:	48 c1 ea 20          	shr    $0x20,%rdx
+      9b:	01 c2                	add    %eax,%edx
+      9d:	89 d1                	mov    %edx,%ecx
+      9f:	c1 f9 02             	sar    $0x2,%ecx
+      a2:	99                   	cltd
+      a3:	89 c8                	mov    %ecx,%eax
+      a5:	29 d0                	sub    %edx,%eax
+      a7:	48 63 d0             	movslq %eax,%rdx
+      aa:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+      b1:	48 c1 ea 20          	shr    $0x20,%rdx
+      b5:	c1 fa 03             	sar    $0x3,%edx
+      b8:	89 c1                	mov    %eax,%ecx
+      ba:	c1 f9 1f             	sar    $0x1f,%ecx
+      bd:	29 ca                	sub    %ecx,%edx
+      bf:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+      c2:	29 c8                	sub    %ecx,%eax
+      c4:	89 c2                	mov    %eax,%edx
+      c6:	89 d0                	mov    %edx,%eax
+      c8:	83 c0 61             	add    $0x61,%eax
+      cb:	89 c1                	mov    %eax,%ecx
+      cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      d0:	48 98                	cltq
+      d2:	48 8d 15 87 26 00 00 	lea    0x2687(%rip),%rdx        # 2760 <buf>
+      d9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(k = 0; k < FILESZ; k++)
+      dc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      e0:	81 7d fc 63 30 00 00 	cmpl   $0x3063,-0x4(%rbp)
+      e7:	7e a1                	jle    8a <makefile+0x8a>
+  if(write(fd, buf, FILESZ) != FILESZ)
+      e9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      ec:	ba 64 30 00 00       	mov    $0x3064,%edx
+      f1:	48 8d 0d 68 26 00 00 	lea    0x2668(%rip),%rcx        # 2760 <buf>
+      f8:	48 89 ce             	mov    %rcx,%rsi
+      fb:	89 c7                	mov    %eax,%edi
+      fd:	e8 91 1a 00 00       	call   1b93 <write>
+     102:	3d 64 30 00 00       	cmp    $0x3064,%eax
+     107:	74 5c                	je     165 <makefile+0x165>
+    error("unable to write splice1.txt");
+     109:	8b 05 c1 25 00 00    	mov    0x25c1(%rip),%eax        # 26d0 <stdout>
+     10f:	ba 21 00 00 00       	mov    $0x21,%edx
+     114:	48 8d 0d c1 1e 00 00 	lea    0x1ec1(%rip),%rcx        # 1fdc <malloc+0x18e>
+     11b:	48 89 ce             	mov    %rcx,%rsi
+     11e:	89 c7                	mov    %eax,%edi
+     120:	b8 00 00 00 00       	mov    $0x0,%eax
+     125:	e8 a2 14 00 00       	call   15cc <printf>
+     12a:	8b 05 a0 25 00 00    	mov    0x25a0(%rip),%eax        # 26d0 <stdout>
+     130:	48 8d 15 d6 1e 00 00 	lea    0x1ed6(%rip),%rdx        # 200d <malloc+0x1bf>
+     137:	48 89 d6             	mov    %rdx,%rsi
+     13a:	89 c7                	mov    %eax,%edi
+     13c:	b8 00 00 00 00       	mov    $0x0,%eax
+     141:	e8 86 14 00 00       	call   15cc <printf>
+     146:	8b 05 84 25 00 00    	mov    0x2584(%rip),%eax        # 26d0 <stdout>
+     14c:	48 8d 15 b8 1e 00 00 	lea    0x1eb8(%rip),%rdx        # 200b <malloc+0x1bd>
+     153:	48 89 d6             	mov    %rdx,%rsi
+     156:	89 c7                	mov    %eax,%edi
+     158:	b8 00 00 00 00       	mov    $0x0,%eax
+     15d:	e8 6a 14 00 00       	call   15cc <printf>
+     162:	90                   	nop
+     163:	eb fd                	jmp    162 <makefile+0x162>
+  close(fd);
+     165:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     168:	89 c7                	mov    %eax,%edi
+     16a:	e8 2c 1a 00 00       	call   1b9b <close>
+}
+     16f:	90                   	nop
+     170:	c9                   	leave
+     171:	c3                   	ret
+
+0000000000000172 <checkpipe>:
+
+// Read n bytes out of the pipe fd and check they are the file's bytes
+// from off on.
+void
+checkpipe(int fd, int off, int n)
+{
+     172:	55                   	push   %rbp
+     173:	48 89 e5             	mov    %rsp,%rbp
+     176:	48 83 ec 20          	sub    $0x20,%rsp
+     17a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+     17d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+     180:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+  int got, r, k;
+
+  for(got = 0; got < n; got += r)
+     183:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     18a:	e9 92 00 00 00       	jmp    221 <checkpipe+0xaf>
+    if((r = read(fd, buf + got, n - got)) <= 0)
+     18f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     192:	2b 45 fc             	sub    -0x4(%rbp),%eax
+     195:	89 c2                	mov    %eax,%edx
+     197:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     19a:	48 98                	cltq
+     19c:	48 8d 0d bd 25 00 00 	lea    0x25bd(%rip),%rcx        # 2760 <buf>
+     1a3:	48 01 c1             	add    %rax,%rcx
+     1a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     1a9:	48 89 ce             	mov    %rcx,%rsi
+     1ac:	89 c7                	mov    %eax,%edi
+     1ae:	e8 d8 19 00 00       	call   1b8b <read>
+     1b3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     1b6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     1ba:	7f 5f                	jg     21b <checkpipe+0xa9>
+      error("read of the pipe returned %d after %d bytes", r, got);
+     1bc:	8b 05 0e 25 00 00    	mov    0x250e(%rip),%eax        # 26d0 <stdout>
+     1c2:	ba 2e 00 00 00       	mov    $0x2e,%edx
+     1c7:	48 8d 0d 0e 1e 00 00 	lea    0x1e0e(%rip),%rcx        # 1fdc <malloc+0x18e>
+     1ce:	48 89 ce             	mov    %rcx,%rsi
+     1d1:	89 c7                	mov    %eax,%edi
+     1d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1d8:	e8 ef 13 00 00       	call   15cc <printf>
+     1dd:	8b 05 ed 24 00 00    	mov    0x24ed(%rip),%eax        # 26d0 <stdout>
+     1e3:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     1e6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     1e9:	48 8d 35 40 1e 00 00 	lea    0x1e40(%rip),%rsi        # 2030 <malloc+0x1e2>
+     1f0:	89 c7                	mov    %eax,%edi
+     1f2:	b8 00 00 00 00       	mov    $0x0,%eax
+     1f7:	e8 d0 13 00 00       	call   15cc <printf>
+     1fc:	8b 05 ce 24 00 00    	mov    0x24ce(%rip),%eax        # 26d0 <stdout>
+     202:	48 8d 15 02 1e 00 00 	lea    0x1e02(%rip),%rdx        # 200b <malloc+0x1bd>
+     209:	48 89 d6             	mov    %rdx,%rsi
+     20c:	89 c7                	mov    %eax,%edi
+     20e:	b8 00 00 00 00       	mov    $0x0,%eax
+     213:	e8 b4 13 00 00       	call   15cc <printf>
+     218:	90                   	nop
+     219:	eb fd                	jmp    218 <checkpipe+0xa6>
+  for(got = 0; got < n; got += r)
+     21b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     21e:	01 45 fc             	add    %eax,-0x4(%rbp)
+     221:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     224:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+     227:	0f 8c 62 ff ff ff    	jl     18f <checkpipe+0x1d>
+  for(k = 0; k < n; k++)
+     22d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     234:	e9 28 01 00 00       	jmp    361 <checkpipe+0x1ef>
+    if(buf[k] != BYTE(off + k))
+     239:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     23c:	48 98                	cltq
+     23e:	48 8d 15 1b 25 00 00 	lea    0x251b(%rip),%rdx        # 2760 <buf>
+     245:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+     249:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     24c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     24f:	01 d0                	add    %edx,%eax
+     251:	48 63 d0             	movslq %eax,%rdx
+     254:	48 69 d2 93 24 49 92 	imul   $0xffffffff92492493,%rdx,%rdx
+     25b:	48 c1 ea 20          	shr    $0x20,%rdx
+     25f:	01 c2                	add    %eax,%edx
+     261:	89 d1                	mov    %edx,%ecx
+     263:	c1 f9 02             	sar    $0x2,%ecx
+     266:	99                   	cltd
+     267:	89 c8                	mov    %ecx,%eax
+     269:	29 d0                	sub    %edx,%eax
+     26b:	48 63 d0             	movslq %eax,%rdx
+     26e:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     275:	48 c1 ea 20          	shr    $0x20,%rdx
+     279:	c1 fa 03             	sar    $0x3,%edx
+     27c:	89 c1                	mov    %eax,%ecx
+     27e:	c1 f9 1f             	sar    $0x1f,%ecx
+     281:	29 ca                	sub    %ecx,%edx
+     283:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     286:	29 c8                	sub    %ecx,%eax
+     288:	89 c2                	mov    %eax,%edx
+     28a:	89 d0                	mov    %edx,%eax
+     28c:	83 c0 61             	add    $0x61,%eax
+     28f:	40 38 c6             	cmp    %al,%sil
+     292:	0f 84 c5 00 00 00    	je     35d <checkpipe+0x1eb>
+      error("byte %d is %c, not %c", off + k, buf[k], BYTE(off + k));
+     298:	8b 05 32 24 00 00    	mov    0x2432(%rip),%eax        # 26d0 <stdout>
+     29e:	ba 31 00 00 00       	mov    $0x31,%edx
+     2a3:	48 8d 0d 32 1d 00 00 	lea    0x1d32(%rip),%rcx        # 1fdc <malloc+0x18e>
+     2aa:	48 89 ce             	mov    %rcx,%rsi
+     2ad:	89 c7                	mov    %eax,%edi
+     2af:	b8 00 00 00 00       	mov    $0x0,%eax
+     2b4:	e8 13 13 00 00       	call   15cc <printf>
+     2b9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     2bc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     2bf:	01 d0                	add    %edx,%eax
+     2c1:	48 63 d0             	movslq %eax,%rdx
+     2c4:	48 69 d2 93 24 49 92 	imul   $0xffffffff92492493,%rdx,%rdx
+     2cb:	48 c1 ea 20          	shr    $0x20,%rdx
+     2cf:	01 c2                	add    %eax,%edx
+     2d1:	89 d1                	mov    %edx,%ecx
+     2d3:	c1 f9 02             	sar    $0x2,%ecx
+     2d6:	99                   	cltd
+     2d7:	89 c8                	mov    %ecx,%eax
+     2d9:	29 d0                	sub    %edx,%eax
+     2db:	48 63 d0             	movslq %eax,%rdx
+     2de:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     2e5:	48 c1 ea 20          	shr    $0x20,%rdx
+     2e9:	c1 fa 03             	sar    $0x3,%edx
+     2ec:	89 c1                	mov    %eax,%ecx
+     2ee:	c1 f9 1f             	sar    $0x1f,%ecx
+     2f1:	29 ca                	sub    %ecx,%edx
+     2f3:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     2f6:	29 c8                	sub    %ecx,%eax
+     2f8:	89 c2                	mov    %eax,%edx
+     2fa:	89 d0                	mov    %edx,%eax
+     2fc:	83 c0 61             	add    $0x61,%eax
+     2ff:	0f be f8             	movsbl %al,%edi
+     302:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     305:	48 98                	cltq
+     307:	48 8d 15 52 24 00 00 	lea    0x2452(%rip),%rdx        # 2760 <buf>
+     30e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+     312:	0f be d0             	movsbl %al,%edx
+     315:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+     318:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     31b:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+     31e:	8b 05 ac 23 00 00    	mov    0x23ac(%rip),%eax        # 26d0 <stdout>
+     324:	41 89 f8             	mov    %edi,%r8d
+     327:	89 d1                	mov    %edx,%ecx
+     329:	89 f2                	mov    %esi,%edx
+     32b:	48 8d 35 2a 1d 00 00 	lea    0x1d2a(%rip),%rsi        # 205c <malloc+0x20e>
+     332:	89 c7                	mov    %eax,%edi
+     334:	b8 00 00 00 00       	mov    $0x0,%eax
+     339:	e8 8e 12 00 00       	call   15cc <printf>
+     33e:	8b 05 8c 23 00 00    	mov    0x238c(%rip),%eax        # 26d0 <stdout>
+     344:	48 8d 15 c0 1c 00 00 	lea    0x1cc0(%rip),%rdx        # 200b <malloc+0x1bd>
+     34b:	48 89 d6             	mov    %rdx,%rsi
+     34e:	89 c7                	mov    %eax,%edi
+     350:	b8 00 00 00 00       	mov    $0x0,%eax
+     355:	e8 72 12 00 00       	call   15cc <printf>
+     35a:	90                   	nop
+     35b:	eb fd                	jmp    35a <checkpipe+0x1e8>
+  for(k = 0; k < n; k++)
+     35d:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     361:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     364:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+     367:	0f 8c cc fe ff ff    	jl     239 <checkpipe+0xc7>
+}
+     36d:	90                   	nop
+     36e:	90                   	nop
+     36f:	c9                   	leave
+     370:	c3                   	ret
+
+0000000000000371 <sendfiletest>:
+
+// sendfile puts a file's pages in a pipe, from a given offset or from
+// the file offset, which it then advances.
+void
+sendfiletest(void)
+{
+     371:	55                   	push   %rbp
+     372:	48 89 e5             	mov    %rsp,%rbp
+     375:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], fd, n;
+
+  printf(stdout, "sendfiletest\n");
+     379:	8b 05 51 23 00 00    	mov    0x2351(%rip),%eax        # 26d0 <stdout>
+     37f:	48 8d 15 ec 1c 00 00 	lea    0x1cec(%rip),%rdx        # 2072 <malloc+0x224>
+     386:	48 89 d6             	mov    %rdx,%rsi
+     389:	89 c7                	mov    %eax,%edi
+     38b:	b8 00 00 00 00       	mov    $0x0,%eax
+     390:	e8 37 12 00 00       	call   15cc <printf>
+  if((fd = open("splice1.txt", O_RDONLY)) < 0)
+     395:	be 00 00 00 00       	mov    $0x0,%esi
+     39a:	48 8d 05 2f 1c 00 00 	lea    0x1c2f(%rip),%rax        # 1fd0 <malloc+0x182>
+     3a1:	48 89 c7             	mov    %rax,%rdi
+     3a4:	e8 0a 18 00 00       	call   1bb3 <open>
+     3a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     3ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     3b0:	79 5c                	jns    40e <sendfiletest+0x9d>
+    error("unable to open splice1.txt");
+     3b2:	8b 05 18 23 00 00    	mov    0x2318(%rip),%eax        # 26d0 <stdout>
+     3b8:	ba 3d 00 00 00       	mov    $0x3d,%edx
+     3bd:	48 8d 0d 18 1c 00 00 	lea    0x1c18(%rip),%rcx        # 1fdc <malloc+0x18e>
+     3c4:	48 89 ce             	mov    %rcx,%rsi
+     3c7:	89 c7                	mov    %eax,%edi
+     3c9:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ce:	e8 f9 11 00 00       	call   15cc <printf>
+     3d3:	8b 05 f7 22 00 00    	mov    0x22f7(%rip),%eax        # 26d0 <stdout>
+     3d9:	48 8d 15 a0 1c 00 00 	lea    0x1ca0(%rip),%rdx        # 2080 <malloc+0x232>
+     3e0:	48 89 d6             	mov    %rdx,%rsi
+     3e3:	89 c7                	mov    %eax,%edi
+     3e5:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ea:	e8 dd 11 00 00       	call   15cc <printf>
+     3ef:	8b 05 db 22 00 00    	mov    0x22db(%rip),%eax        # 26d0 <stdout>
+     3f5:	48 8d 15 0f 1c 00 00 	lea    0x1c0f(%rip),%rdx        # 200b <malloc+0x1bd>
+     3fc:	48 89 d6             	mov    %rdx,%rsi
+     3ff:	89 c7                	mov    %eax,%edi
+     401:	b8 00 00 00 00       	mov    $0x0,%eax
+     406:	e8 c1 11 00 00       	call   15cc <printf>
+     40b:	90                   	nop
+     40c:	eb fd                	jmp    40b <sendfiletest+0x9a>
+  if(pipe(fds) < 0)
+     40e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     412:	48 89 c7             	mov    %rax,%rdi
+     415:	e8 69 17 00 00       	call   1b83 <pipe>
+     41a:	85 c0                	test   %eax,%eax
+     41c:	79 5c                	jns    47a <sendfiletest+0x109>
+    error("pipe failed");
+     41e:	8b 05 ac 22 00 00    	mov    0x22ac(%rip),%eax        # 26d0 <stdout>
+     424:	ba 3f 00 00 00       	mov    $0x3f,%edx
+     429:	48 8d 0d ac 1b 00 00 	lea    0x1bac(%rip),%rcx        # 1fdc <malloc+0x18e>
+     430:	48 89 ce             	mov    %rcx,%rsi
+     433:	89 c7                	mov    %eax,%edi
+     435:	b8 00 00 00 00       	mov    $0x0,%eax
+     43a:	e8 8d 11 00 00       	call   15cc <printf>
+     43f:	8b 05 8b 22 00 00    	mov    0x228b(%rip),%eax        # 26d0 <stdout>
+     445:	48 8d 15 4f 1c 00 00 	lea    0x1c4f(%rip),%rdx        # 209b <malloc+0x24d>
+     44c:	48 89 d6             	mov    %rdx,%rsi
+     44f:	89 c7                	mov    %eax,%edi
+     451:	b8 00 00 00 00       	mov    $0x0,%eax
+     456:	e8 71 11 00 00       	call   15cc <printf>
+     45b:	8b 05 6f 22 00 00    	mov    0x226f(%rip),%eax        # 26d0 <stdout>
+     461:	48 8d 15 a3 1b 00 00 	lea    0x1ba3(%rip),%rdx        # 200b <malloc+0x1bd>
+     468:	48 89 d6             	mov    %rdx,%rsi
+     46b:	89 c7                	mov    %eax,%edi
+     46d:	b8 00 00 00 00       	mov    $0x0,%eax
+     472:	e8 55 11 00 00       	call   15cc <printf>
+     477:	90                   	nop
+     478:	eb fd                	jmp    477 <sendfiletest+0x106>
+
+  // all of it from offset 0, starting at a page boundary
+  if((n = sendfile(fds[1], fd, 0, FILESZ)) != FILESZ)
+     47a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     47d:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     480:	b9 64 30 00 00       	mov    $0x3064,%ecx
+     485:	ba 00 00 00 00       	mov    $0x0,%edx
+     48a:	89 c7                	mov    %eax,%edi
+     48c:	e8 c1 17 00 00       	call   1c52 <sendfile>
+     491:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     494:	81 7d f8 64 30 00 00 	cmpl   $0x3064,-0x8(%rbp)
+     49b:	74 5f                	je     4fc <sendfiletest+0x18b>
+    error("sendfile of the whole file returned %d", n);
+     49d:	8b 05 2d 22 00 00    	mov    0x222d(%rip),%eax        # 26d0 <stdout>
+     4a3:	ba 43 00 00 00       	mov    $0x43,%edx
+     4a8:	48 8d 0d 2d 1b 00 00 	lea    0x1b2d(%rip),%rcx        # 1fdc <malloc+0x18e>
+     4af:	48 89 ce             	mov    %rcx,%rsi
+     4b2:	89 c7                	mov    %eax,%edi
+     4b4:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b9:	e8 0e 11 00 00       	call   15cc <printf>
+     4be:	8b 05 0c 22 00 00    	mov    0x220c(%rip),%eax        # 26d0 <stdout>
+     4c4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     4c7:	48 8d 0d da 1b 00 00 	lea    0x1bda(%rip),%rcx        # 20a8 <malloc+0x25a>
+     4ce:	48 89 ce             	mov    %rcx,%rsi
+     4d1:	89 c7                	mov    %eax,%edi
+     4d3:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d8:	e8 ef 10 00 00       	call   15cc <printf>
+     4dd:	8b 05 ed 21 00 00    	mov    0x21ed(%rip),%eax        # 26d0 <stdout>
+     4e3:	48 8d 15 21 1b 00 00 	lea    0x1b21(%rip),%rdx        # 200b <malloc+0x1bd>
+     4ea:	48 89 d6             	mov    %rdx,%rsi
+     4ed:	89 c7                	mov    %eax,%edi
+     4ef:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f4:	e8 d3 10 00 00       	call   15cc <printf>
+     4f9:	90                   	nop
+     4fa:	eb fd                	jmp    4f9 <sendfiletest+0x188>
+  checkpipe(fds[0], 0, FILESZ);
+     4fc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     4ff:	ba 64 30 00 00       	mov    $0x3064,%edx
+     504:	be 00 00 00 00       	mov    $0x0,%esi
+     509:	89 c7                	mov    %eax,%edi
+     50b:	e8 62 fc ff ff       	call   172 <checkpipe>
+
+  // a range that does not start or end on a page boundary
+  if((n = sendfile(fds[1], fd, PGSIZE - 10, PGSIZE + 20)) != PGSIZE + 20)
+     510:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     513:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     516:	b9 14 10 00 00       	mov    $0x1014,%ecx
+     51b:	ba f6 0f 00 00       	mov    $0xff6,%edx
+     520:	89 c7                	mov    %eax,%edi
+     522:	e8 2b 17 00 00       	call   1c52 <sendfile>
+     527:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     52a:	81 7d f8 14 10 00 00 	cmpl   $0x1014,-0x8(%rbp)
+     531:	74 5f                	je     592 <sendfiletest+0x221>
+    error("sendfile of a range returned %d", n);
+     533:	8b 05 97 21 00 00    	mov    0x2197(%rip),%eax        # 26d0 <stdout>
+     539:	ba 48 00 00 00       	mov    $0x48,%edx
+     53e:	48 8d 0d 97 1a 00 00 	lea    0x1a97(%rip),%rcx        # 1fdc <malloc+0x18e>
+     545:	48 89 ce             	mov    %rcx,%rsi
+     548:	89 c7                	mov    %eax,%edi
+     54a:	b8 00 00 00 00       	mov    $0x0,%eax
+     54f:	e8 78 10 00 00       	call   15cc <printf>
+     554:	8b 05 76 21 00 00    	mov    0x2176(%rip),%eax        # 26d0 <stdout>
+     55a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     55d:	48 8d 0d 6c 1b 00 00 	lea    0x1b6c(%rip),%rcx        # 20d0 <malloc+0x282>
+     564:	48 89 ce             	mov    %rcx,%rsi
+     567:	89 c7                	mov    %eax,%edi
+     569:	b8 00 00 00 00       	mov    $0x0,%eax
+     56e:	e8 59 10 00 00       	call   15cc <printf>
+     573:	8b 05 57 21 00 00    	mov    0x2157(%rip),%eax        # 26d0 <stdout>
+     579:	48 8d 15 8b 1a 00 00 	lea    0x1a8b(%rip),%rdx        # 200b <malloc+0x1bd>
+     580:	48 89 d6             	mov    %rdx,%rsi
+     583:	89 c7                	mov    %eax,%edi
+     585:	b8 00 00 00 00       	mov    $0x0,%eax
+     58a:	e8 3d 10 00 00       	call   15cc <printf>
+     58f:	90                   	nop
+     590:	eb fd                	jmp    58f <sendfiletest+0x21e>
+  checkpipe(fds[0], PGSIZE - 10, PGSIZE + 20);
+     592:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     595:	ba 14 10 00 00       	mov    $0x1014,%edx
+     59a:	be f6 0f 00 00       	mov    $0xff6,%esi
+     59f:	89 c7                	mov    %eax,%edi
+     5a1:	e8 cc fb ff ff       	call   172 <checkpipe>
+
+  // from the file offset, up to the end of the file
+  if(read(fd, buf, 50) != 50)
+     5a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5a9:	ba 32 00 00 00       	mov    $0x32,%edx
+     5ae:	48 8d 0d ab 21 00 00 	lea    0x21ab(%rip),%rcx        # 2760 <buf>
+     5b5:	48 89 ce             	mov    %rcx,%rsi
+     5b8:	89 c7                	mov    %eax,%edi
+     5ba:	e8 cc 15 00 00       	call   1b8b <read>
+     5bf:	83 f8 32             	cmp    $0x32,%eax
+     5c2:	74 5c                	je     620 <sendfiletest+0x2af>
+    error("unable to read splice1.txt");
+     5c4:	8b 05 06 21 00 00    	mov    0x2106(%rip),%eax        # 26d0 <stdout>
+     5ca:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     5cf:	48 8d 0d 06 1a 00 00 	lea    0x1a06(%rip),%rcx        # 1fdc <malloc+0x18e>
+     5d6:	48 89 ce             	mov    %rcx,%rsi
+     5d9:	89 c7                	mov    %eax,%edi
+     5db:	b8 00 00 00 00       	mov    $0x0,%eax
+     5e0:	e8 e7 0f 00 00       	call   15cc <printf>
+     5e5:	8b 05 e5 20 00 00    	mov    0x20e5(%rip),%eax        # 26d0 <stdout>
+     5eb:	48 8d 15 fe 1a 00 00 	lea    0x1afe(%rip),%rdx        # 20f0 <malloc+0x2a2>
+     5f2:	48 89 d6             	mov    %rdx,%rsi
+     5f5:	89 c7                	mov    %eax,%edi
+     5f7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5fc:	e8 cb 0f 00 00       	call   15cc <printf>
+     601:	8b 05 c9 20 00 00    	mov    0x20c9(%rip),%eax        # 26d0 <stdout>
+     607:	48 8d 15 fd 19 00 00 	lea    0x19fd(%rip),%rdx        # 200b <malloc+0x1bd>
+     60e:	48 89 d6             	mov    %rdx,%rsi
+     611:	89 c7                	mov    %eax,%edi
+     613:	b8 00 00 00 00       	mov    $0x0,%eax
+     618:	e8 af 0f 00 00       	call   15cc <printf>
+     61d:	90                   	nop
+     61e:	eb fd                	jmp    61d <sendfiletest+0x2ac>
+  if((n = sendfile(fds[1], fd, -1, FILESZ)) != FILESZ - 50)
+     620:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     623:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     626:	b9 64 30 00 00       	mov    $0x3064,%ecx
+     62b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+     630:	89 c7                	mov    %eax,%edi
+     632:	e8 1b 16 00 00       	call   1c52 <sendfile>
+     637:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     63a:	81 7d f8 32 30 00 00 	cmpl   $0x3032,-0x8(%rbp)
+     641:	74 5f                	je     6a2 <sendfiletest+0x331>
+    error("sendfile from the file offset returned %d", n);
+     643:	8b 05 87 20 00 00    	mov    0x2087(%rip),%eax        # 26d0 <stdout>
+     649:	ba 4f 00 00 00       	mov    $0x4f,%edx
+     64e:	48 8d 0d 87 19 00 00 	lea    0x1987(%rip),%rcx        # 1fdc <malloc+0x18e>
+     655:	48 89 ce             	mov    %rcx,%rsi
+     658:	89 c7                	mov    %eax,%edi
+     65a:	b8 00 00 00 00       	mov    $0x0,%eax
+     65f:	e8 68 0f 00 00       	call   15cc <printf>
+     664:	8b 05 66 20 00 00    	mov    0x2066(%rip),%eax        # 26d0 <stdout>
+     66a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     66d:	48 8d 0d 9c 1a 00 00 	lea    0x1a9c(%rip),%rcx        # 2110 <malloc+0x2c2>
+     674:	48 89 ce             	mov    %rcx,%rsi
+     677:	89 c7                	mov    %eax,%edi
+     679:	b8 00 00 00 00       	mov    $0x0,%eax
+     67e:	e8 49 0f 00 00       	call   15cc <printf>
+     683:	8b 05 47 20 00 00    	mov    0x2047(%rip),%eax        # 26d0 <stdout>
+     689:	48 8d 15 7b 19 00 00 	lea    0x197b(%rip),%rdx        # 200b <malloc+0x1bd>
+     690:	48 89 d6             	mov    %rdx,%rsi
+     693:	89 c7                	mov    %eax,%edi
+     695:	b8 00 00 00 00       	mov    $0x0,%eax
+     69a:	e8 2d 0f 00 00       	call   15cc <printf>
+     69f:	90                   	nop
+     6a0:	eb fd                	jmp    69f <sendfiletest+0x32e>
+  checkpipe(fds[0], 50, FILESZ - 50);
+     6a2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     6a5:	ba 32 30 00 00       	mov    $0x3032,%edx
+     6aa:	be 32 00 00 00       	mov    $0x32,%esi
+     6af:	89 c7                	mov    %eax,%edi
+     6b1:	e8 bc fa ff ff       	call   172 <checkpipe>
+  if((n = sendfile(fds[1], fd, -1, 10)) != 0)
+     6b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     6b9:	8b 75 fc             	mov    -0x4(%rbp),%esi
+     6bc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     6c1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+     6c6:	89 c7                	mov    %eax,%edi
+     6c8:	e8 85 15 00 00       	call   1c52 <sendfile>
+     6cd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     6d0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     6d4:	74 5f                	je     735 <sendfiletest+0x3c4>
+    error("sendfile at the end of the file returned %d", n);
+     6d6:	8b 05 f4 1f 00 00    	mov    0x1ff4(%rip),%eax        # 26d0 <stdout>
+     6dc:	ba 52 00 00 00       	mov    $0x52,%edx
+     6e1:	48 8d 0d f4 18 00 00 	lea    0x18f4(%rip),%rcx        # 1fdc <malloc+0x18e>
+     6e8:	48 89 ce             	mov    %rcx,%rsi
+     6eb:	89 c7                	mov    %eax,%edi
+     6ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f2:	e8 d5 0e 00 00       	call   15cc <printf>
+     6f7:	8b 05 d3 1f 00 00    	mov    0x1fd3(%rip),%eax        # 26d0 <stdout>
+     6fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     700:	48 8d 0d 39 1a 00 00 	lea    0x1a39(%rip),%rcx        # 2140 <malloc+0x2f2>
+     707:	48 89 ce             	mov    %rcx,%rsi
+     70a:	89 c7                	mov    %eax,%edi
+     70c:	b8 00 00 00 00       	mov    $0x0,%eax
+     711:	e8 b6 0e 00 00       	call   15cc <printf>
+     716:	8b 05 b4 1f 00 00    	mov    0x1fb4(%rip),%eax        # 26d0 <stdout>
+     71c:	48 8d 15 e8 18 00 00 	lea    0x18e8(%rip),%rdx        # 200b <malloc+0x1bd>
+     723:	48 89 d6             	mov    %rdx,%rsi
+     726:	89 c7                	mov    %eax,%edi
+     728:	b8 00 00 00 00       	mov    $0x0,%eax
+     72d:	e8 9a 0e 00 00       	call   15cc <printf>
+     732:	90                   	nop
+     733:	eb fd                	jmp    732 <sendfiletest+0x3c1>
+
+  close(fds[0]);
+     735:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     738:	89 c7                	mov    %eax,%edi
+     73a:	e8 5c 14 00 00       	call   1b9b <close>
+  close(fds[1]);
+     73f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     742:	89 c7                	mov    %eax,%edi
+     744:	e8 52 14 00 00       	call   1b9b <close>
+  close(fd);
+     749:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     74c:	89 c7                	mov    %eax,%edi
+     74e:	e8 48 14 00 00       	call   1b9b <close>
+  printf(stdout, "sendfiletest OK\n");
+     753:	8b 05 77 1f 00 00    	mov    0x1f77(%rip),%eax        # 26d0 <stdout>
+     759:	48 8d 15 0c 1a 00 00 	lea    0x1a0c(%rip),%rdx        # 216c <malloc+0x31e>
+     760:	48 89 d6             	mov    %rdx,%rsi
+     763:	89 c7                	mov    %eax,%edi
+     765:	b8 00 00 00 00       	mov    $0x0,%eax
+     76a:	e8 5d 0e 00 00       	call   15cc <printf>
+}
+     76f:	90                   	nop
+     770:	c9                   	leave
+     771:	c3                   	ret
+
+0000000000000772 <splicetest>:
+
+// splice moves data between a pipe and a file at the file offset.
+void
+splicetest(void)
+{
+     772:	55                   	push   %rbp
+     773:	48 89 e5             	mov    %rsp,%rbp
+     776:	48 83 ec 30          	sub    $0x30,%rsp
+  struct stat st;
+  int fds[2], in, out, n, r, w;
+
+  printf(stdout, "splicetest\n");
+     77a:	8b 05 50 1f 00 00    	mov    0x1f50(%rip),%eax        # 26d0 <stdout>
+     780:	48 8d 15 f6 19 00 00 	lea    0x19f6(%rip),%rdx        # 217d <malloc+0x32f>
+     787:	48 89 d6             	mov    %rdx,%rsi
+     78a:	89 c7                	mov    %eax,%edi
+     78c:	b8 00 00 00 00       	mov    $0x0,%eax
+     791:	e8 36 0e 00 00       	call   15cc <printf>
+  if((in = open("splice1.txt", O_RDONLY)) < 0)
+     796:	be 00 00 00 00       	mov    $0x0,%esi
+     79b:	48 8d 05 2e 18 00 00 	lea    0x182e(%rip),%rax        # 1fd0 <malloc+0x182>
+     7a2:	48 89 c7             	mov    %rax,%rdi
+     7a5:	e8 09 14 00 00       	call   1bb3 <open>
+     7aa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     7ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     7b1:	79 5c                	jns    80f <splicetest+0x9d>
+    error("unable to open splice1.txt");
+     7b3:	8b 05 17 1f 00 00    	mov    0x1f17(%rip),%eax        # 26d0 <stdout>
+     7b9:	ba 63 00 00 00       	mov    $0x63,%edx
+     7be:	48 8d 0d 17 18 00 00 	lea    0x1817(%rip),%rcx        # 1fdc <malloc+0x18e>
+     7c5:	48 89 ce             	mov    %rcx,%rsi
+     7c8:	89 c7                	mov    %eax,%edi
+     7ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     7cf:	e8 f8 0d 00 00       	call   15cc <printf>
+     7d4:	8b 05 f6 1e 00 00    	mov    0x1ef6(%rip),%eax        # 26d0 <stdout>
+     7da:	48 8d 15 9f 18 00 00 	lea    0x189f(%rip),%rdx        # 2080 <malloc+0x232>
+     7e1:	48 89 d6             	mov    %rdx,%rsi
+     7e4:	89 c7                	mov    %eax,%edi
+     7e6:	b8 00 00 00 00       	mov    $0x0,%eax
+     7eb:	e8 dc 0d 00 00       	call   15cc <printf>
+     7f0:	8b 05 da 1e 00 00    	mov    0x1eda(%rip),%eax        # 26d0 <stdout>
+     7f6:	48 8d 15 0e 18 00 00 	lea    0x180e(%rip),%rdx        # 200b <malloc+0x1bd>
+     7fd:	48 89 d6             	mov    %rdx,%rsi
+     800:	89 c7                	mov    %eax,%edi
+     802:	b8 00 00 00 00       	mov    $0x0,%eax
+     807:	e8 c0 0d 00 00       	call   15cc <printf>
+     80c:	90                   	nop
+     80d:	eb fd                	jmp    80c <splicetest+0x9a>
+  if((out = open("splice2.txt", O_CREATE | O_RDWR)) < 0)
+     80f:	be 02 02 00 00       	mov    $0x202,%esi
+     814:	48 8d 05 6e 19 00 00 	lea    0x196e(%rip),%rax        # 2189 <malloc+0x33b>
+     81b:	48 89 c7             	mov    %rax,%rdi
+     81e:	e8 90 13 00 00       	call   1bb3 <open>
+     823:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     826:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     82a:	79 5c                	jns    888 <splicetest+0x116>
+    error("unable to create splice2.txt");
+     82c:	8b 05 9e 1e 00 00    	mov    0x1e9e(%rip),%eax        # 26d0 <stdout>
+     832:	ba 65 00 00 00       	mov    $0x65,%edx
+     837:	48 8d 0d 9e 17 00 00 	lea    0x179e(%rip),%rcx        # 1fdc <malloc+0x18e>
+     83e:	48 89 ce             	mov    %rcx,%rsi
+     841:	89 c7                	mov    %eax,%edi
+     843:	b8 00 00 00 00       	mov    $0x0,%eax
+     848:	e8 7f 0d 00 00       	call   15cc <printf>
+     84d:	8b 05 7d 1e 00 00    	mov    0x1e7d(%rip),%eax        # 26d0 <stdout>
+     853:	48 8d 15 3b 19 00 00 	lea    0x193b(%rip),%rdx        # 2195 <malloc+0x347>
+     85a:	48 89 d6             	mov    %rdx,%rsi
+     85d:	89 c7                	mov    %eax,%edi
+     85f:	b8 00 00 00 00       	mov    $0x0,%eax
+     864:	e8 63 0d 00 00       	call   15cc <printf>
+     869:	8b 05 61 1e 00 00    	mov    0x1e61(%rip),%eax        # 26d0 <stdout>
+     86f:	48 8d 15 95 17 00 00 	lea    0x1795(%rip),%rdx        # 200b <malloc+0x1bd>
+     876:	48 89 d6             	mov    %rdx,%rsi
+     879:	89 c7                	mov    %eax,%edi
+     87b:	b8 00 00 00 00       	mov    $0x0,%eax
+     880:	e8 47 0d 00 00       	call   15cc <printf>
+     885:	90                   	nop
+     886:	eb fd                	jmp    885 <splicetest+0x113>
+  if(pipe(fds) < 0)
+     888:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     88c:	48 89 c7             	mov    %rax,%rdi
+     88f:	e8 ef 12 00 00       	call   1b83 <pipe>
+     894:	85 c0                	test   %eax,%eax
+     896:	79 5c                	jns    8f4 <splicetest+0x182>
+    error("pipe failed");
+     898:	8b 05 32 1e 00 00    	mov    0x1e32(%rip),%eax        # 26d0 <stdout>
+     89e:	ba 67 00 00 00       	mov    $0x67,%edx
+     8a3:	48 8d 0d 32 17 00 00 	lea    0x1732(%rip),%rcx        # 1fdc <malloc+0x18e>
+     8aa:	48 89 ce             	mov    %rcx,%rsi
+     8ad:	89 c7                	mov    %eax,%edi
+     8af:	b8 00 00 00 00       	mov    $0x0,%eax
+     8b4:	e8 13 0d 00 00       	call   15cc <printf>
+     8b9:	8b 05 11 1e 00 00    	mov    0x1e11(%rip),%eax        # 26d0 <stdout>
+     8bf:	48 8d 15 d5 17 00 00 	lea    0x17d5(%rip),%rdx        # 209b <malloc+0x24d>
+     8c6:	48 89 d6             	mov    %rdx,%rsi
+     8c9:	89 c7                	mov    %eax,%edi
+     8cb:	b8 00 00 00 00       	mov    $0x0,%eax
+     8d0:	e8 f7 0c 00 00       	call   15cc <printf>
+     8d5:	8b 05 f5 1d 00 00    	mov    0x1df5(%rip),%eax        # 26d0 <stdout>
+     8db:	48 8d 15 29 17 00 00 	lea    0x1729(%rip),%rdx        # 200b <malloc+0x1bd>
+     8e2:	48 89 d6             	mov    %rdx,%rsi
+     8e5:	89 c7                	mov    %eax,%edi
+     8e7:	b8 00 00 00 00       	mov    $0x0,%eax
+     8ec:	e8 db 0c 00 00       	call   15cc <printf>
+     8f1:	90                   	nop
+     8f2:	eb fd                	jmp    8f1 <splicetest+0x17f>
+
+  // file to pipe to file, in pieces of a page and a bit
+  for(n = 0; n < FILESZ; ){
+     8f4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     8fb:	e9 10 01 00 00       	jmp    a10 <splicetest+0x29e>
+    r = splice(in, fds[1], PGSIZE + 300);
+     900:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     903:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     906:	ba 2c 11 00 00       	mov    $0x112c,%edx
+     90b:	89 ce                	mov    %ecx,%esi
+     90d:	89 c7                	mov    %eax,%edi
+     90f:	e8 46 13 00 00       	call   1c5a <splice>
+     914:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(r <= 0)
+     917:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     91b:	0f 8f e5 00 00 00    	jg     a06 <splicetest+0x294>
+      error("splice of the file into the pipe returned %d", r);
+     921:	8b 05 a9 1d 00 00    	mov    0x1da9(%rip),%eax        # 26d0 <stdout>
+     927:	ba 6d 00 00 00       	mov    $0x6d,%edx
+     92c:	48 8d 0d a9 16 00 00 	lea    0x16a9(%rip),%rcx        # 1fdc <malloc+0x18e>
+     933:	48 89 ce             	mov    %rcx,%rsi
+     936:	89 c7                	mov    %eax,%edi
+     938:	b8 00 00 00 00       	mov    $0x0,%eax
+     93d:	e8 8a 0c 00 00       	call   15cc <printf>
+     942:	8b 05 88 1d 00 00    	mov    0x1d88(%rip),%eax        # 26d0 <stdout>
+     948:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     94b:	48 8d 0d 66 18 00 00 	lea    0x1866(%rip),%rcx        # 21b8 <malloc+0x36a>
+     952:	48 89 ce             	mov    %rcx,%rsi
+     955:	89 c7                	mov    %eax,%edi
+     957:	b8 00 00 00 00       	mov    $0x0,%eax
+     95c:	e8 6b 0c 00 00       	call   15cc <printf>
+     961:	8b 05 69 1d 00 00    	mov    0x1d69(%rip),%eax        # 26d0 <stdout>
+     967:	48 8d 15 9d 16 00 00 	lea    0x169d(%rip),%rdx        # 200b <malloc+0x1bd>
+     96e:	48 89 d6             	mov    %rdx,%rsi
+     971:	89 c7                	mov    %eax,%edi
+     973:	b8 00 00 00 00       	mov    $0x0,%eax
+     978:	e8 4f 0c 00 00       	call   15cc <printf>
+     97d:	90                   	nop
+     97e:	eb fd                	jmp    97d <splicetest+0x20b>
+    while(r > 0){
+      w = splice(fds[0], out, r);
+     980:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     983:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     986:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+     989:	89 ce                	mov    %ecx,%esi
+     98b:	89 c7                	mov    %eax,%edi
+     98d:	e8 c8 12 00 00       	call   1c5a <splice>
+     992:	89 45 ec             	mov    %eax,-0x14(%rbp)
+      if(w <= 0)
+     995:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     999:	7f 5f                	jg     9fa <splicetest+0x288>
+        error("splice of the pipe into the file returned %d", w);
+     99b:	8b 05 2f 1d 00 00    	mov    0x1d2f(%rip),%eax        # 26d0 <stdout>
+     9a1:	ba 71 00 00 00       	mov    $0x71,%edx
+     9a6:	48 8d 0d 2f 16 00 00 	lea    0x162f(%rip),%rcx        # 1fdc <malloc+0x18e>
+     9ad:	48 89 ce             	mov    %rcx,%rsi
+     9b0:	89 c7                	mov    %eax,%edi
+     9b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b7:	e8 10 0c 00 00       	call   15cc <printf>
+     9bc:	8b 05 0e 1d 00 00    	mov    0x1d0e(%rip),%eax        # 26d0 <stdout>
+     9c2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+     9c5:	48 8d 0d 1c 18 00 00 	lea    0x181c(%rip),%rcx        # 21e8 <malloc+0x39a>
+     9cc:	48 89 ce             	mov    %rcx,%rsi
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 f1 0b 00 00       	call   15cc <printf>
+     9db:	8b 05 ef 1c 00 00    	mov    0x1cef(%rip),%eax        # 26d0 <stdout>
+     9e1:	48 8d 15 23 16 00 00 	lea    0x1623(%rip),%rdx        # 200b <malloc+0x1bd>
+     9e8:	48 89 d6             	mov    %rdx,%rsi
+     9eb:	89 c7                	mov    %eax,%edi
+     9ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f2:	e8 d5 0b 00 00       	call   15cc <printf>
+     9f7:	90                   	nop
+     9f8:	eb fd                	jmp    9f7 <splicetest+0x285>
+      r -= w;
+     9fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     9fd:	29 45 f8             	sub    %eax,-0x8(%rbp)
+      n += w;
+     a00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+     a03:	01 45 fc             	add    %eax,-0x4(%rbp)
+    while(r > 0){
+     a06:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     a0a:	0f 8f 70 ff ff ff    	jg     980 <splicetest+0x20e>
+  for(n = 0; n < FILESZ; ){
+     a10:	81 7d fc 63 30 00 00 	cmpl   $0x3063,-0x4(%rbp)
+     a17:	0f 8e e3 fe ff ff    	jle    900 <splicetest+0x18e>
+    }
+  }
+  fstat(out, &st);
+     a1d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+     a21:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     a24:	48 89 d6             	mov    %rdx,%rsi
+     a27:	89 c7                	mov    %eax,%edi
+     a29:	e8 9d 11 00 00       	call   1bcb <fstat>
+  if(st.size != FILESZ)
+     a2e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+     a31:	3d 64 30 00 00       	cmp    $0x3064,%eax
+     a36:	74 61                	je     a99 <splicetest+0x327>
+    error("splice2.txt has %d bytes, not %d", st.size, FILESZ);
+     a38:	8b 05 92 1c 00 00    	mov    0x1c92(%rip),%eax        # 26d0 <stdout>
+     a3e:	ba 78 00 00 00       	mov    $0x78,%edx
+     a43:	48 8d 0d 92 15 00 00 	lea    0x1592(%rip),%rcx        # 1fdc <malloc+0x18e>
+     a4a:	48 89 ce             	mov    %rcx,%rsi
+     a4d:	89 c7                	mov    %eax,%edi
+     a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a54:	e8 73 0b 00 00       	call   15cc <printf>
+     a59:	8b 55 e8             	mov    -0x18(%rbp),%edx
+     a5c:	8b 05 6e 1c 00 00    	mov    0x1c6e(%rip),%eax        # 26d0 <stdout>
+     a62:	b9 64 30 00 00       	mov    $0x3064,%ecx
+     a67:	48 8d 35 aa 17 00 00 	lea    0x17aa(%rip),%rsi        # 2218 <malloc+0x3ca>
+     a6e:	89 c7                	mov    %eax,%edi
+     a70:	b8 00 00 00 00       	mov    $0x0,%eax
+     a75:	e8 52 0b 00 00       	call   15cc <printf>
+     a7a:	8b 05 50 1c 00 00    	mov    0x1c50(%rip),%eax        # 26d0 <stdout>
+     a80:	48 8d 15 84 15 00 00 	lea    0x1584(%rip),%rdx        # 200b <malloc+0x1bd>
+     a87:	48 89 d6             	mov    %rdx,%rsi
+     a8a:	89 c7                	mov    %eax,%edi
+     a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+     a91:	e8 36 0b 00 00       	call   15cc <printf>
+     a96:	90                   	nop
+     a97:	eb fd                	jmp    a96 <splicetest+0x324>
+  close(out);
+     a99:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     a9c:	89 c7                	mov    %eax,%edi
+     a9e:	e8 f8 10 00 00       	call   1b9b <close>
+
+  if((out = open("splice2.txt", O_RDONLY)) < 0)
+     aa3:	be 00 00 00 00       	mov    $0x0,%esi
+     aa8:	48 8d 05 da 16 00 00 	lea    0x16da(%rip),%rax        # 2189 <malloc+0x33b>
+     aaf:	48 89 c7             	mov    %rax,%rdi
+     ab2:	e8 fc 10 00 00       	call   1bb3 <open>
+     ab7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+     aba:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+     abe:	79 5c                	jns    b1c <splicetest+0x3aa>
+    error("unable to open splice2.txt");
+     ac0:	8b 05 0a 1c 00 00    	mov    0x1c0a(%rip),%eax        # 26d0 <stdout>
+     ac6:	ba 7c 00 00 00       	mov    $0x7c,%edx
+     acb:	48 8d 0d 0a 15 00 00 	lea    0x150a(%rip),%rcx        # 1fdc <malloc+0x18e>
+     ad2:	48 89 ce             	mov    %rcx,%rsi
+     ad5:	89 c7                	mov    %eax,%edi
+     ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+     adc:	e8 eb 0a 00 00       	call   15cc <printf>
+     ae1:	8b 05 e9 1b 00 00    	mov    0x1be9(%rip),%eax        # 26d0 <stdout>
+     ae7:	48 8d 15 4b 17 00 00 	lea    0x174b(%rip),%rdx        # 2239 <malloc+0x3eb>
+     aee:	48 89 d6             	mov    %rdx,%rsi
+     af1:	89 c7                	mov    %eax,%edi
+     af3:	b8 00 00 00 00       	mov    $0x0,%eax
+     af8:	e8 cf 0a 00 00       	call   15cc <printf>
+     afd:	8b 05 cd 1b 00 00    	mov    0x1bcd(%rip),%eax        # 26d0 <stdout>
+     b03:	48 8d 15 01 15 00 00 	lea    0x1501(%rip),%rdx        # 200b <malloc+0x1bd>
+     b0a:	48 89 d6             	mov    %rdx,%rsi
+     b0d:	89 c7                	mov    %eax,%edi
+     b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b14:	e8 b3 0a 00 00       	call   15cc <printf>
+     b19:	90                   	nop
+     b1a:	eb fd                	jmp    b19 <splicetest+0x3a7>
+  if(read(out, buf, FILESZ) != FILESZ)
+     b1c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     b1f:	ba 64 30 00 00       	mov    $0x3064,%edx
+     b24:	48 8d 0d 35 1c 00 00 	lea    0x1c35(%rip),%rcx        # 2760 <buf>
+     b2b:	48 89 ce             	mov    %rcx,%rsi
+     b2e:	89 c7                	mov    %eax,%edi
+     b30:	e8 56 10 00 00       	call   1b8b <read>
+     b35:	3d 64 30 00 00       	cmp    $0x3064,%eax
+     b3a:	74 5c                	je     b98 <splicetest+0x426>
+    error("unable to read splice2.txt");
+     b3c:	8b 05 8e 1b 00 00    	mov    0x1b8e(%rip),%eax        # 26d0 <stdout>
+     b42:	ba 7e 00 00 00       	mov    $0x7e,%edx
+     b47:	48 8d 0d 8e 14 00 00 	lea    0x148e(%rip),%rcx        # 1fdc <malloc+0x18e>
+     b4e:	48 89 ce             	mov    %rcx,%rsi
+     b51:	89 c7                	mov    %eax,%edi
+     b53:	b8 00 00 00 00       	mov    $0x0,%eax
+     b58:	e8 6f 0a 00 00       	call   15cc <printf>
+     b5d:	8b 05 6d 1b 00 00    	mov    0x1b6d(%rip),%eax        # 26d0 <stdout>
+     b63:	48 8d 15 ea 16 00 00 	lea    0x16ea(%rip),%rdx        # 2254 <malloc+0x406>
+     b6a:	48 89 d6             	mov    %rdx,%rsi
+     b6d:	89 c7                	mov    %eax,%edi
+     b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+     b74:	e8 53 0a 00 00       	call   15cc <printf>
+     b79:	8b 05 51 1b 00 00    	mov    0x1b51(%rip),%eax        # 26d0 <stdout>
+     b7f:	48 8d 15 85 14 00 00 	lea    0x1485(%rip),%rdx        # 200b <malloc+0x1bd>
+     b86:	48 89 d6             	mov    %rdx,%rsi
+     b89:	89 c7                	mov    %eax,%edi
+     b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+     b90:	e8 37 0a 00 00       	call   15cc <printf>
+     b95:	90                   	nop
+     b96:	eb fd                	jmp    b95 <splicetest+0x423>
+  for(n = 0; n < FILESZ; n++)
+     b98:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     b9f:	e9 b9 00 00 00       	jmp    c5d <splicetest+0x4eb>
+    if(buf[n] != BYTE(n))
+     ba4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ba7:	48 98                	cltq
+     ba9:	48 8d 15 b0 1b 00 00 	lea    0x1bb0(%rip),%rdx        # 2760 <buf>
+     bb0:	0f b6 34 10          	movzbl (%rax,%rdx,1),%esi
+     bb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bb7:	48 63 d0             	movslq %eax,%rdx
+     bba:	48 69 d2 93 24 49 92 	imul   $0xffffffff92492493,%rdx,%rdx
+     bc1:	48 c1 ea 20          	shr    $0x20,%rdx
+     bc5:	01 c2                	add    %eax,%edx
+     bc7:	89 d1                	mov    %edx,%ecx
+     bc9:	c1 f9 02             	sar    $0x2,%ecx
+     bcc:	99                   	cltd
+     bcd:	89 c8                	mov    %ecx,%eax
+     bcf:	29 d0                	sub    %edx,%eax
+     bd1:	48 63 d0             	movslq %eax,%rdx
+     bd4:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+     bdb:	48 c1 ea 20          	shr    $0x20,%rdx
+     bdf:	c1 fa 03             	sar    $0x3,%edx
+     be2:	89 c1                	mov    %eax,%ecx
+     be4:	c1 f9 1f             	sar    $0x1f,%ecx
+     be7:	29 ca                	sub    %ecx,%edx
+     be9:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+     bec:	29 c8                	sub    %ecx,%eax
+     bee:	89 c2                	mov    %eax,%edx
+     bf0:	89 d0                	mov    %edx,%eax
+     bf2:	83 c0 61             	add    $0x61,%eax
+     bf5:	40 38 c6             	cmp    %al,%sil
+     bf8:	74 5f                	je     c59 <splicetest+0x4e7>
+      error("byte %d of splice2.txt is wrong", n);
+     bfa:	8b 05 d0 1a 00 00    	mov    0x1ad0(%rip),%eax        # 26d0 <stdout>
+     c00:	ba 81 00 00 00       	mov    $0x81,%edx
+     c05:	48 8d 0d d0 13 00 00 	lea    0x13d0(%rip),%rcx        # 1fdc <malloc+0x18e>
+     c0c:	48 89 ce             	mov    %rcx,%rsi
+     c0f:	89 c7                	mov    %eax,%edi
+     c11:	b8 00 00 00 00       	mov    $0x0,%eax
+     c16:	e8 b1 09 00 00       	call   15cc <printf>
+     c1b:	8b 05 af 1a 00 00    	mov    0x1aaf(%rip),%eax        # 26d0 <stdout>
+     c21:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     c24:	48 8d 0d 45 16 00 00 	lea    0x1645(%rip),%rcx        # 2270 <malloc+0x422>
+     c2b:	48 89 ce             	mov    %rcx,%rsi
+     c2e:	89 c7                	mov    %eax,%edi
+     c30:	b8 00 00 00 00       	mov    $0x0,%eax
+     c35:	e8 92 09 00 00       	call   15cc <printf>
+     c3a:	8b 05 90 1a 00 00    	mov    0x1a90(%rip),%eax        # 26d0 <stdout>
+     c40:	48 8d 15 c4 13 00 00 	lea    0x13c4(%rip),%rdx        # 200b <malloc+0x1bd>
+     c47:	48 89 d6             	mov    %rdx,%rsi
+     c4a:	89 c7                	mov    %eax,%edi
+     c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+     c51:	e8 76 09 00 00       	call   15cc <printf>
+     c56:	90                   	nop
+     c57:	eb fd                	jmp    c56 <splicetest+0x4e4>
+  for(n = 0; n < FILESZ; n++)
+     c59:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     c5d:	81 7d fc 63 30 00 00 	cmpl   $0x3063,-0x4(%rbp)
+     c64:	0f 8e 3a ff ff ff    	jle    ba4 <splicetest+0x432>
+
+  // one end has to be a pipe, and only one
+  if(splice(in, out, 10) != -1)
+     c6a:	8b 4d f0             	mov    -0x10(%rbp),%ecx
+     c6d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c70:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c75:	89 ce                	mov    %ecx,%esi
+     c77:	89 c7                	mov    %eax,%edi
+     c79:	e8 dc 0f 00 00       	call   1c5a <splice>
+     c7e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c81:	74 5c                	je     cdf <splicetest+0x56d>
+    error("splice between two files did not fail");
+     c83:	8b 05 47 1a 00 00    	mov    0x1a47(%rip),%eax        # 26d0 <stdout>
+     c89:	ba 85 00 00 00       	mov    $0x85,%edx
+     c8e:	48 8d 0d 47 13 00 00 	lea    0x1347(%rip),%rcx        # 1fdc <malloc+0x18e>
+     c95:	48 89 ce             	mov    %rcx,%rsi
+     c98:	89 c7                	mov    %eax,%edi
+     c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+     c9f:	e8 28 09 00 00       	call   15cc <printf>
+     ca4:	8b 05 26 1a 00 00    	mov    0x1a26(%rip),%eax        # 26d0 <stdout>
+     caa:	48 8d 15 df 15 00 00 	lea    0x15df(%rip),%rdx        # 2290 <malloc+0x442>
+     cb1:	48 89 d6             	mov    %rdx,%rsi
+     cb4:	89 c7                	mov    %eax,%edi
+     cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+     cbb:	e8 0c 09 00 00       	call   15cc <printf>
+     cc0:	8b 05 0a 1a 00 00    	mov    0x1a0a(%rip),%eax        # 26d0 <stdout>
+     cc6:	48 8d 15 3e 13 00 00 	lea    0x133e(%rip),%rdx        # 200b <malloc+0x1bd>
+     ccd:	48 89 d6             	mov    %rdx,%rsi
+     cd0:	89 c7                	mov    %eax,%edi
+     cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+     cd7:	e8 f0 08 00 00       	call   15cc <printf>
+     cdc:	90                   	nop
+     cdd:	eb fd                	jmp    cdc <splicetest+0x56a>
+  if(splice(fds[0], fds[1], 10) != -1)
+     cdf:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     ce2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     ce5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     cea:	89 ce                	mov    %ecx,%esi
+     cec:	89 c7                	mov    %eax,%edi
+     cee:	e8 67 0f 00 00       	call   1c5a <splice>
+     cf3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cf6:	74 5c                	je     d54 <splicetest+0x5e2>
+    error("splice between two pipes did not fail");
+     cf8:	8b 05 d2 19 00 00    	mov    0x19d2(%rip),%eax        # 26d0 <stdout>
+     cfe:	ba 87 00 00 00       	mov    $0x87,%edx
+     d03:	48 8d 0d d2 12 00 00 	lea    0x12d2(%rip),%rcx        # 1fdc <malloc+0x18e>
+     d0a:	48 89 ce             	mov    %rcx,%rsi
+     d0d:	89 c7                	mov    %eax,%edi
+     d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+     d14:	e8 b3 08 00 00       	call   15cc <printf>
+     d19:	8b 05 b1 19 00 00    	mov    0x19b1(%rip),%eax        # 26d0 <stdout>
+     d1f:	48 8d 15 92 15 00 00 	lea    0x1592(%rip),%rdx        # 22b8 <malloc+0x46a>
+     d26:	48 89 d6             	mov    %rdx,%rsi
+     d29:	89 c7                	mov    %eax,%edi
+     d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+     d30:	e8 97 08 00 00       	call   15cc <printf>
+     d35:	8b 05 95 19 00 00    	mov    0x1995(%rip),%eax        # 26d0 <stdout>
+     d3b:	48 8d 15 c9 12 00 00 	lea    0x12c9(%rip),%rdx        # 200b <malloc+0x1bd>
+     d42:	48 89 d6             	mov    %rdx,%rsi
+     d45:	89 c7                	mov    %eax,%edi
+     d47:	b8 00 00 00 00       	mov    $0x0,%eax
+     d4c:	e8 7b 08 00 00       	call   15cc <printf>
+     d51:	90                   	nop
+     d52:	eb fd                	jmp    d51 <splicetest+0x5df>
+
+  close(fds[0]);
+     d54:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     d57:	89 c7                	mov    %eax,%edi
+     d59:	e8 3d 0e 00 00       	call   1b9b <close>
+  close(fds[1]);
+     d5e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+     d61:	89 c7                	mov    %eax,%edi
+     d63:	e8 33 0e 00 00       	call   1b9b <close>
+  close(in);
+     d68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     d6b:	89 c7                	mov    %eax,%edi
+     d6d:	e8 29 0e 00 00       	call   1b9b <close>
+  close(out);
+     d72:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     d75:	89 c7                	mov    %eax,%edi
+     d77:	e8 1f 0e 00 00       	call   1b9b <close>
+  unlink("splice2.txt");
+     d7c:	48 8d 05 06 14 00 00 	lea    0x1406(%rip),%rax        # 2189 <malloc+0x33b>
+     d83:	48 89 c7             	mov    %rax,%rdi
+     d86:	e8 38 0e 00 00       	call   1bc3 <unlink>
+  printf(stdout, "splicetest OK\n");
+     d8b:	8b 05 3f 19 00 00    	mov    0x193f(%rip),%eax        # 26d0 <stdout>
+     d91:	48 8d 15 46 15 00 00 	lea    0x1546(%rip),%rdx        # 22de <malloc+0x490>
+     d98:	48 89 d6             	mov    %rdx,%rsi
+     d9b:	89 c7                	mov    %eax,%edi
+     d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+     da2:	e8 25 08 00 00       	call   15cc <printf>
+}
+     da7:	90                   	nop
+     da8:	c9                   	leave
+     da9:	c3                   	ret
+
+0000000000000daa <sharetest>:
+
+// A pipe holds the file's own pages, not a copy of them: a write to
+// the file before the pipe is read shows in what comes out of it.
+void
+sharetest(void)
+{
+     daa:	55                   	push   %rbp
+     dab:	48 89 e5             	mov    %rsp,%rbp
+     dae:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], fd, n;
+
+  printf(stdout, "sharetest\n");
+     db2:	8b 05 18 19 00 00    	mov    0x1918(%rip),%eax        # 26d0 <stdout>
+     db8:	48 8d 15 2e 15 00 00 	lea    0x152e(%rip),%rdx        # 22ed <malloc+0x49f>
+     dbf:	48 89 d6             	mov    %rdx,%rsi
+     dc2:	89 c7                	mov    %eax,%edi
+     dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+     dc9:	e8 fe 07 00 00       	call   15cc <printf>
+  if((fd = open("splice1.txt", O_RDWR)) < 0)
+     dce:	be 02 00 00 00       	mov    $0x2,%esi
+     dd3:	48 8d 05 f6 11 00 00 	lea    0x11f6(%rip),%rax        # 1fd0 <malloc+0x182>
+     dda:	48 89 c7             	mov    %rax,%rdi
+     ddd:	e8 d1 0d 00 00       	call   1bb3 <open>
+     de2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     de5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     de9:	79 5c                	jns    e47 <sharetest+0x9d>
+    error("unable to open splice1.txt");
+     deb:	8b 05 df 18 00 00    	mov    0x18df(%rip),%eax        # 26d0 <stdout>
+     df1:	ba 9a 00 00 00       	mov    $0x9a,%edx
+     df6:	48 8d 0d df 11 00 00 	lea    0x11df(%rip),%rcx        # 1fdc <malloc+0x18e>
+     dfd:	48 89 ce             	mov    %rcx,%rsi
+     e00:	89 c7                	mov    %eax,%edi
+     e02:	b8 00 00 00 00       	mov    $0x0,%eax
+     e07:	e8 c0 07 00 00       	call   15cc <printf>
+     e0c:	8b 05 be 18 00 00    	mov    0x18be(%rip),%eax        # 26d0 <stdout>
+     e12:	48 8d 15 67 12 00 00 	lea    0x1267(%rip),%rdx        # 2080 <malloc+0x232>
+     e19:	48 89 d6             	mov    %rdx,%rsi
+     e1c:	89 c7                	mov    %eax,%edi
+     e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e23:	e8 a4 07 00 00       	call   15cc <printf>
+     e28:	8b 05 a2 18 00 00    	mov    0x18a2(%rip),%eax        # 26d0 <stdout>
+     e2e:	48 8d 15 d6 11 00 00 	lea    0x11d6(%rip),%rdx        # 200b <malloc+0x1bd>
+     e35:	48 89 d6             	mov    %rdx,%rsi
+     e38:	89 c7                	mov    %eax,%edi
+     e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e3f:	e8 88 07 00 00       	call   15cc <printf>
+     e44:	90                   	nop
+     e45:	eb fd                	jmp    e44 <sharetest+0x9a>
+  if(pipe(fds) < 0)
+     e47:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+     e4b:	48 89 c7             	mov    %rax,%rdi
+     e4e:	e8 30 0d 00 00       	call   1b83 <pipe>
+     e53:	85 c0                	test   %eax,%eax
+     e55:	79 5c                	jns    eb3 <sharetest+0x109>
+    error("pipe failed");
+     e57:	8b 05 73 18 00 00    	mov    0x1873(%rip),%eax        # 26d0 <stdout>
+     e5d:	ba 9c 00 00 00       	mov    $0x9c,%edx
+     e62:	48 8d 0d 73 11 00 00 	lea    0x1173(%rip),%rcx        # 1fdc <malloc+0x18e>
+     e69:	48 89 ce             	mov    %rcx,%rsi
+     e6c:	89 c7                	mov    %eax,%edi
+     e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+     e73:	e8 54 07 00 00       	call   15cc <printf>
+     e78:	8b 05 52 18 00 00    	mov    0x1852(%rip),%eax        # 26d0 <stdout>
+     e7e:	48 8d 15 16 12 00 00 	lea    0x1216(%rip),%rdx        # 209b <malloc+0x24d>
+     e85:	48 89 d6             	mov    %rdx,%rsi
+     e88:	89 c7                	mov    %eax,%edi
+     e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e8f:	e8 38 07 00 00       	call   15cc <printf>
+     e94:	8b 05 36 18 00 00    	mov    0x1836(%rip),%eax        # 26d0 <stdout>
+     e9a:	48 8d 15 6a 11 00 00 	lea    0x116a(%rip),%rdx        # 200b <malloc+0x1bd>
+     ea1:	48 89 d6             	mov    %rdx,%rsi
+     ea4:	89 c7                	mov    %eax,%edi
+     ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+     eab:	e8 1c 07 00 00       	call   15cc <printf>
+     eb0:	90                   	nop
+     eb1:	eb fd                	jmp    eb0 <sharetest+0x106>
+  if((n = sendfile(fds[1], fd, 0, PGSIZE)) != PGSIZE)
+     eb3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     eb6:	8b 75 f8             	mov    -0x8(%rbp),%esi
+     eb9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+     ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+     ec3:	89 c7                	mov    %eax,%edi
+     ec5:	e8 88 0d 00 00       	call   1c52 <sendfile>
+     eca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     ecd:	81 7d fc 00 10 00 00 	cmpl   $0x1000,-0x4(%rbp)
+     ed4:	74 5f                	je     f35 <sharetest+0x18b>
+    error("sendfile returned %d", n);
+     ed6:	8b 05 f4 17 00 00    	mov    0x17f4(%rip),%eax        # 26d0 <stdout>
+     edc:	ba 9e 00 00 00       	mov    $0x9e,%edx
+     ee1:	48 8d 0d f4 10 00 00 	lea    0x10f4(%rip),%rcx        # 1fdc <malloc+0x18e>
+     ee8:	48 89 ce             	mov    %rcx,%rsi
+     eeb:	89 c7                	mov    %eax,%edi
+     eed:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef2:	e8 d5 06 00 00       	call   15cc <printf>
+     ef7:	8b 05 d3 17 00 00    	mov    0x17d3(%rip),%eax        # 26d0 <stdout>
+     efd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     f00:	48 8d 0d f1 13 00 00 	lea    0x13f1(%rip),%rcx        # 22f8 <malloc+0x4aa>
+     f07:	48 89 ce             	mov    %rcx,%rsi
+     f0a:	89 c7                	mov    %eax,%edi
+     f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+     f11:	e8 b6 06 00 00       	call   15cc <printf>
+     f16:	8b 05 b4 17 00 00    	mov    0x17b4(%rip),%eax        # 26d0 <stdout>
+     f1c:	48 8d 15 e8 10 00 00 	lea    0x10e8(%rip),%rdx        # 200b <malloc+0x1bd>
+     f23:	48 89 d6             	mov    %rdx,%rsi
+     f26:	89 c7                	mov    %eax,%edi
+     f28:	b8 00 00 00 00       	mov    $0x0,%eax
+     f2d:	e8 9a 06 00 00       	call   15cc <printf>
+     f32:	90                   	nop
+     f33:	eb fd                	jmp    f32 <sharetest+0x188>
+  if(pwrite(fd, "XYZ", 3, 100) != 3)
+     f35:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     f38:	b9 64 00 00 00       	mov    $0x64,%ecx
+     f3d:	ba 03 00 00 00       	mov    $0x3,%edx
+     f42:	48 8d 35 c4 13 00 00 	lea    0x13c4(%rip),%rsi        # 230d <malloc+0x4bf>
+     f49:	89 c7                	mov    %eax,%edi
+     f4b:	e8 1a 0d 00 00       	call   1c6a <pwrite>
+     f50:	83 f8 03             	cmp    $0x3,%eax
+     f53:	74 5c                	je     fb1 <sharetest+0x207>
+    error("pwrite failed");
+     f55:	8b 05 75 17 00 00    	mov    0x1775(%rip),%eax        # 26d0 <stdout>
+     f5b:	ba a0 00 00 00       	mov    $0xa0,%edx
+     f60:	48 8d 0d 75 10 00 00 	lea    0x1075(%rip),%rcx        # 1fdc <malloc+0x18e>
+     f67:	48 89 ce             	mov    %rcx,%rsi
+     f6a:	89 c7                	mov    %eax,%edi
+     f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+     f71:	e8 56 06 00 00       	call   15cc <printf>
+     f76:	8b 05 54 17 00 00    	mov    0x1754(%rip),%eax        # 26d0 <stdout>
+     f7c:	48 8d 15 8e 13 00 00 	lea    0x138e(%rip),%rdx        # 2311 <malloc+0x4c3>
+     f83:	48 89 d6             	mov    %rdx,%rsi
+     f86:	89 c7                	mov    %eax,%edi
+     f88:	b8 00 00 00 00       	mov    $0x0,%eax
+     f8d:	e8 3a 06 00 00       	call   15cc <printf>
+     f92:	8b 05 38 17 00 00    	mov    0x1738(%rip),%eax        # 26d0 <stdout>
+     f98:	48 8d 15 6c 10 00 00 	lea    0x106c(%rip),%rdx        # 200b <malloc+0x1bd>
+     f9f:	48 89 d6             	mov    %rdx,%rsi
+     fa2:	89 c7                	mov    %eax,%edi
+     fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+     fa9:	e8 1e 06 00 00       	call   15cc <printf>
+     fae:	90                   	nop
+     faf:	eb fd                	jmp    fae <sharetest+0x204>
+  if(read(fds[0], buf, PGSIZE) != PGSIZE)
+     fb1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+     fb4:	ba 00 10 00 00       	mov    $0x1000,%edx
+     fb9:	48 8d 0d a0 17 00 00 	lea    0x17a0(%rip),%rcx        # 2760 <buf>
+     fc0:	48 89 ce             	mov    %rcx,%rsi
+     fc3:	89 c7                	mov    %eax,%edi
+     fc5:	e8 c1 0b 00 00       	call   1b8b <read>
+     fca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     fcf:	74 5c                	je     102d <sharetest+0x283>
+    error("read of the pipe failed");
+     fd1:	8b 05 f9 16 00 00    	mov    0x16f9(%rip),%eax        # 26d0 <stdout>
+     fd7:	ba a2 00 00 00       	mov    $0xa2,%edx
+     fdc:	48 8d 0d f9 0f 00 00 	lea    0xff9(%rip),%rcx        # 1fdc <malloc+0x18e>
+     fe3:	48 89 ce             	mov    %rcx,%rsi
+     fe6:	89 c7                	mov    %eax,%edi
+     fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+     fed:	e8 da 05 00 00       	call   15cc <printf>
+     ff2:	8b 05 d8 16 00 00    	mov    0x16d8(%rip),%eax        # 26d0 <stdout>
+     ff8:	48 8d 15 20 13 00 00 	lea    0x1320(%rip),%rdx        # 231f <malloc+0x4d1>
+     fff:	48 89 d6             	mov    %rdx,%rsi
+    1002:	89 c7                	mov    %eax,%edi
+    1004:	b8 00 00 00 00       	mov    $0x0,%eax
+    1009:	e8 be 05 00 00       	call   15cc <printf>
+    100e:	8b 05 bc 16 00 00    	mov    0x16bc(%rip),%eax        # 26d0 <stdout>
+    1014:	48 8d 15 f0 0f 00 00 	lea    0xff0(%rip),%rdx        # 200b <malloc+0x1bd>
+    101b:	48 89 d6             	mov    %rdx,%rsi
+    101e:	89 c7                	mov    %eax,%edi
+    1020:	b8 00 00 00 00       	mov    $0x0,%eax
+    1025:	e8 a2 05 00 00       	call   15cc <printf>
+    102a:	90                   	nop
+    102b:	eb fd                	jmp    102a <sharetest+0x280>
+  if(buf[99] != BYTE(99) || buf[100] != 'X' || buf[102] != 'Z' ||
+    102d:	0f b6 05 8f 17 00 00 	movzbl 0x178f(%rip),%eax        # 27c3 <buf+0x63>
+    1034:	3c 6f                	cmp    $0x6f,%al
+    1036:	75 21                	jne    1059 <sharetest+0x2af>
+    1038:	0f b6 05 85 17 00 00 	movzbl 0x1785(%rip),%eax        # 27c4 <buf+0x64>
+    103f:	3c 58                	cmp    $0x58,%al
+    1041:	75 16                	jne    1059 <sharetest+0x2af>
+    1043:	0f b6 05 7c 17 00 00 	movzbl 0x177c(%rip),%eax        # 27c6 <buf+0x66>
+    104a:	3c 5a                	cmp    $0x5a,%al
+    104c:	75 0b                	jne    1059 <sharetest+0x2af>
+     buf[103] != BYTE(103))
+    104e:	0f b6 05 72 17 00 00 	movzbl 0x1772(%rip),%eax        # 27c7 <buf+0x67>
+  if(buf[99] != BYTE(99) || buf[100] != 'X' || buf[102] != 'Z' ||
+    1055:	3c 6f                	cmp    $0x6f,%al
+    1057:	74 5c                	je     10b5 <sharetest+0x30b>
+    error("the pipe does not have the write to the file");
+    1059:	8b 05 71 16 00 00    	mov    0x1671(%rip),%eax        # 26d0 <stdout>
+    105f:	ba a5 00 00 00       	mov    $0xa5,%edx
+    1064:	48 8d 0d 71 0f 00 00 	lea    0xf71(%rip),%rcx        # 1fdc <malloc+0x18e>
+    106b:	48 89 ce             	mov    %rcx,%rsi
+    106e:	89 c7                	mov    %eax,%edi
+    1070:	b8 00 00 00 00       	mov    $0x0,%eax
+    1075:	e8 52 05 00 00       	call   15cc <printf>
+    107a:	8b 05 50 16 00 00    	mov    0x1650(%rip),%eax        # 26d0 <stdout>
+    1080:	48 8d 15 b1 12 00 00 	lea    0x12b1(%rip),%rdx        # 2338 <malloc+0x4ea>
+    1087:	48 89 d6             	mov    %rdx,%rsi
+    108a:	89 c7                	mov    %eax,%edi
+    108c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1091:	e8 36 05 00 00       	call   15cc <printf>
+    1096:	8b 05 34 16 00 00    	mov    0x1634(%rip),%eax        # 26d0 <stdout>
+    109c:	48 8d 15 68 0f 00 00 	lea    0xf68(%rip),%rdx        # 200b <malloc+0x1bd>
+    10a3:	48 89 d6             	mov    %rdx,%rsi
+    10a6:	89 c7                	mov    %eax,%edi
+    10a8:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ad:	e8 1a 05 00 00       	call   15cc <printf>
+    10b2:	90                   	nop
+    10b3:	eb fd                	jmp    10b2 <sharetest+0x308>
+
+  // put the file back as it was
+  for(n = 0; n < 3; n++)
+    10b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10bc:	eb 59                	jmp    1117 <sharetest+0x36d>
+    buf[n] = BYTE(100 + n);
+    10be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10c1:	83 c0 64             	add    $0x64,%eax
+    10c4:	48 63 d0             	movslq %eax,%rdx
+    10c7:	48 69 d2 93 24 49 92 	imul   $0xffffffff92492493,%rdx,%rdx
+    10ce:	48 c1 ea 20          	shr    $0x20,%rdx
+    10d2:	01 c2                	add    %eax,%edx
+    10d4:	89 d1                	mov    %edx,%ecx
+    10d6:	c1 f9 02             	sar    $0x2,%ecx
+    10d9:	99                   	cltd
+    10da:	89 c8                	mov    %ecx,%eax
+    10dc:	29 d0                	sub    %edx,%eax
+    10de:	48 63 d0             	movslq %eax,%rdx
+    10e1:	48 69 d2 4f ec c4 4e 	imul   $0x4ec4ec4f,%rdx,%rdx
+    10e8:	48 c1 ea 20          	shr    $0x20,%rdx
+    10ec:	c1 fa 03             	sar    $0x3,%edx
+    10ef:	89 c1                	mov    %eax,%ecx
+    10f1:	c1 f9 1f             	sar    $0x1f,%ecx
+    10f4:	29 ca                	sub    %ecx,%edx
+    10f6:	6b ca 1a             	imul   $0x1a,%edx,%ecx
+    10f9:	29 c8                	sub    %ecx,%eax
+    10fb:	89 c2                	mov    %eax,%edx
+    10fd:	89 d0                	mov    %edx,%eax
+    10ff:	83 c0 61             	add    $0x61,%eax
+    1102:	89 c1                	mov    %eax,%ecx
+    1104:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1107:	48 98                	cltq
+    1109:	48 8d 15 50 16 00 00 	lea    0x1650(%rip),%rdx        # 2760 <buf>
+    1110:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  for(n = 0; n < 3; n++)
+    1113:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1117:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+    111b:	7e a1                	jle    10be <sharetest+0x314>
+  if(pwrite(fd, buf, 3, 100) != 3)
+    111d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    1120:	b9 64 00 00 00       	mov    $0x64,%ecx
+    1125:	ba 03 00 00 00       	mov    $0x3,%edx
+    112a:	48 8d 35 2f 16 00 00 	lea    0x162f(%rip),%rsi        # 2760 <buf>
+    1131:	89 c7                	mov    %eax,%edi
+    1133:	e8 32 0b 00 00       	call   1c6a <pwrite>
+    1138:	83 f8 03             	cmp    $0x3,%eax
+    113b:	74 5c                	je     1199 <sharetest+0x3ef>
+    error("pwrite failed");
+    113d:	8b 05 8d 15 00 00    	mov    0x158d(%rip),%eax        # 26d0 <stdout>
+    1143:	ba ab 00 00 00       	mov    $0xab,%edx
+    1148:	48 8d 0d 8d 0e 00 00 	lea    0xe8d(%rip),%rcx        # 1fdc <malloc+0x18e>
+    114f:	48 89 ce             	mov    %rcx,%rsi
+    1152:	89 c7                	mov    %eax,%edi
+    1154:	b8 00 00 00 00       	mov    $0x0,%eax
+    1159:	e8 6e 04 00 00       	call   15cc <printf>
+    115e:	8b 05 6c 15 00 00    	mov    0x156c(%rip),%eax        # 26d0 <stdout>
+    1164:	48 8d 15 a6 11 00 00 	lea    0x11a6(%rip),%rdx        # 2311 <malloc+0x4c3>
+    116b:	48 89 d6             	mov    %rdx,%rsi
+    116e:	89 c7                	mov    %eax,%edi
+    1170:	b8 00 00 00 00       	mov    $0x0,%eax
+    1175:	e8 52 04 00 00       	call   15cc <printf>
+    117a:	8b 05 50 15 00 00    	mov    0x1550(%rip),%eax        # 26d0 <stdout>
+    1180:	48 8d 15 84 0e 00 00 	lea    0xe84(%rip),%rdx        # 200b <malloc+0x1bd>
+    1187:	48 89 d6             	mov    %rdx,%rsi
+    118a:	89 c7                	mov    %eax,%edi
+    118c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1191:	e8 36 04 00 00       	call   15cc <printf>
+    1196:	90                   	nop
+    1197:	eb fd                	jmp    1196 <sharetest+0x3ec>
+  close(fds[0]);
+    1199:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    119c:	89 c7                	mov    %eax,%edi
+    119e:	e8 f8 09 00 00       	call   1b9b <close>
+  close(fds[1]);
+    11a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    11a6:	89 c7                	mov    %eax,%edi
+    11a8:	e8 ee 09 00 00       	call   1b9b <close>
+  close(fd);
+    11ad:	8b 45 f8             	mov    -0x8(%rbp),%eax
+    11b0:	89 c7                	mov    %eax,%edi
+    11b2:	e8 e4 09 00 00       	call   1b9b <close>
+  printf(stdout, "sharetest OK\n");
+    11b7:	8b 05 13 15 00 00    	mov    0x1513(%rip),%eax        # 26d0 <stdout>
+    11bd:	48 8d 15 a1 11 00 00 	lea    0x11a1(%rip),%rdx        # 2365 <malloc+0x517>
+    11c4:	48 89 d6             	mov    %rdx,%rsi
+    11c7:	89 c7                	mov    %eax,%edi
+    11c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    11ce:	e8 f9 03 00 00       	call   15cc <printf>
+}
+    11d3:	90                   	nop
+    11d4:	c9                   	leave
+    11d5:	c3                   	ret
+
+00000000000011d6 <unlinktest>:
+
+// Pages a pipe got from a file stay valid after the file is closed
+// and unlinked.
+void
+unlinktest(void)
+{
+    11d6:	55                   	push   %rbp
+    11d7:	48 89 e5             	mov    %rsp,%rbp
+    11da:	48 83 ec 10          	sub    $0x10,%rsp
+  int fds[2], fd, n;
+
+  printf(stdout, "unlinktest\n");
+    11de:	8b 05 ec 14 00 00    	mov    0x14ec(%rip),%eax        # 26d0 <stdout>
+    11e4:	48 8d 15 88 11 00 00 	lea    0x1188(%rip),%rdx        # 2373 <malloc+0x525>
+    11eb:	48 89 d6             	mov    %rdx,%rsi
+    11ee:	89 c7                	mov    %eax,%edi
+    11f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    11f5:	e8 d2 03 00 00       	call   15cc <printf>
+  if((fd = open("splice1.txt", O_RDWR)) < 0)
+    11fa:	be 02 00 00 00       	mov    $0x2,%esi
+    11ff:	48 8d 05 ca 0d 00 00 	lea    0xdca(%rip),%rax        # 1fd0 <malloc+0x182>
+    1206:	48 89 c7             	mov    %rax,%rdi
+    1209:	e8 a5 09 00 00       	call   1bb3 <open>
+    120e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    1211:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1215:	79 5c                	jns    1273 <unlinktest+0x9d>
+    error("unable to open splice1.txt");
+    1217:	8b 05 b3 14 00 00    	mov    0x14b3(%rip),%eax        # 26d0 <stdout>
+    121d:	ba bb 00 00 00       	mov    $0xbb,%edx
+    1222:	48 8d 0d b3 0d 00 00 	lea    0xdb3(%rip),%rcx        # 1fdc <malloc+0x18e>
+    1229:	48 89 ce             	mov    %rcx,%rsi
+    122c:	89 c7                	mov    %eax,%edi
+    122e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1233:	e8 94 03 00 00       	call   15cc <printf>
+    1238:	8b 05 92 14 00 00    	mov    0x1492(%rip),%eax        # 26d0 <stdout>
+    123e:	48 8d 15 3b 0e 00 00 	lea    0xe3b(%rip),%rdx        # 2080 <malloc+0x232>
+    1245:	48 89 d6             	mov    %rdx,%rsi
+    1248:	89 c7                	mov    %eax,%edi
+    124a:	b8 00 00 00 00       	mov    $0x0,%eax
+    124f:	e8 78 03 00 00       	call   15cc <printf>
+    1254:	8b 05 76 14 00 00    	mov    0x1476(%rip),%eax        # 26d0 <stdout>
+    125a:	48 8d 15 aa 0d 00 00 	lea    0xdaa(%rip),%rdx        # 200b <malloc+0x1bd>
+    1261:	48 89 d6             	mov    %rdx,%rsi
+    1264:	89 c7                	mov    %eax,%edi
+    1266:	b8 00 00 00 00       	mov    $0x0,%eax
+    126b:	e8 5c 03 00 00       	call   15cc <printf>
+    1270:	90                   	nop
+    1271:	eb fd                	jmp    1270 <unlinktest+0x9a>
+  if(pipe(fds) < 0)
+    1273:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+    1277:	48 89 c7             	mov    %rax,%rdi
+    127a:	e8 04 09 00 00       	call   1b83 <pipe>
+    127f:	85 c0                	test   %eax,%eax
+    1281:	79 5c                	jns    12df <unlinktest+0x109>
+    error("pipe failed");
+    1283:	8b 05 47 14 00 00    	mov    0x1447(%rip),%eax        # 26d0 <stdout>
+    1289:	ba bd 00 00 00       	mov    $0xbd,%edx
+    128e:	48 8d 0d 47 0d 00 00 	lea    0xd47(%rip),%rcx        # 1fdc <malloc+0x18e>
+    1295:	48 89 ce             	mov    %rcx,%rsi
+    1298:	89 c7                	mov    %eax,%edi
+    129a:	b8 00 00 00 00       	mov    $0x0,%eax
+    129f:	e8 28 03 00 00       	call   15cc <printf>
+    12a4:	8b 05 26 14 00 00    	mov    0x1426(%rip),%eax        # 26d0 <stdout>
+    12aa:	48 8d 15 ea 0d 00 00 	lea    0xdea(%rip),%rdx        # 209b <malloc+0x24d>
+    12b1:	48 89 d6             	mov    %rdx,%rsi
+    12b4:	89 c7                	mov    %eax,%edi
+    12b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    12bb:	e8 0c 03 00 00       	call   15cc <printf>
+    12c0:	8b 05 0a 14 00 00    	mov    0x140a(%rip),%eax        # 26d0 <stdout>
+    12c6:	48 8d 15 3e 0d 00 00 	lea    0xd3e(%rip),%rdx        # 200b <malloc+0x1bd>
+    12cd:	48 89 d6             	mov    %rdx,%rsi
+    12d0:	89 c7                	mov    %eax,%edi
+    12d2:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d7:	e8 f0 02 00 00       	call   15cc <printf>
+    12dc:	90                   	nop
+    12dd:	eb fd                	jmp    12dc <unlinktest+0x106>
+  if((n = sendfile(fds[1], fd, 0, PGSIZE)) != PGSIZE)
+    12df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    12e2:	8b 75 fc             	mov    -0x4(%rbp),%esi
+    12e5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    12ea:	ba 00 00 00 00       	mov    $0x0,%edx
+    12ef:	89 c7                	mov    %eax,%edi
+    12f1:	e8 5c 09 00 00       	call   1c52 <sendfile>
+    12f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    12f9:	81 7d f8 00 10 00 00 	cmpl   $0x1000,-0x8(%rbp)
+    1300:	74 5f                	je     1361 <unlinktest+0x18b>
+    error("sendfile returned %d", n);
+    1302:	8b 05 c8 13 00 00    	mov    0x13c8(%rip),%eax        # 26d0 <stdout>
+    1308:	ba bf 00 00 00       	mov    $0xbf,%edx
+    130d:	48 8d 0d c8 0c 00 00 	lea    0xcc8(%rip),%rcx        # 1fdc <malloc+0x18e>
+    1314:	48 89 ce             	mov    %rcx,%rsi
+    1317:	89 c7                	mov    %eax,%edi
+    1319:	b8 00 00 00 00       	mov    $0x0,%eax
+    131e:	e8 a9 02 00 00       	call   15cc <printf>
+    1323:	8b 05 a7 13 00 00    	mov    0x13a7(%rip),%eax        # 26d0 <stdout>
+    1329:	8b 55 f8             	mov    -0x8(%rbp),%edx
+    132c:	48 8d 0d c5 0f 00 00 	lea    0xfc5(%rip),%rcx        # 22f8 <malloc+0x4aa>
+    1333:	48 89 ce             	mov    %rcx,%rsi
+    1336:	89 c7                	mov    %eax,%edi
+    1338:	b8 00 00 00 00       	mov    $0x0,%eax
+    133d:	e8 8a 02 00 00       	call   15cc <printf>
+    1342:	8b 05 88 13 00 00    	mov    0x1388(%rip),%eax        # 26d0 <stdout>
+    1348:	48 8d 15 bc 0c 00 00 	lea    0xcbc(%rip),%rdx        # 200b <malloc+0x1bd>
+    134f:	48 89 d6             	mov    %rdx,%rsi
+    1352:	89 c7                	mov    %eax,%edi
+    1354:	b8 00 00 00 00       	mov    $0x0,%eax
+    1359:	e8 6e 02 00 00       	call   15cc <printf>
+    135e:	90                   	nop
+    135f:	eb fd                	jmp    135e <unlinktest+0x188>
+  close(fd);
+    1361:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1364:	89 c7                	mov    %eax,%edi
+    1366:	e8 30 08 00 00       	call   1b9b <close>
+  unlink("splice1.txt");
+    136b:	48 8d 05 5e 0c 00 00 	lea    0xc5e(%rip),%rax        # 1fd0 <malloc+0x182>
+    1372:	48 89 c7             	mov    %rax,%rdi
+    1375:	e8 49 08 00 00       	call   1bc3 <unlink>
+  checkpipe(fds[0], 0, PGSIZE);
+    137a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    137d:	ba 00 10 00 00       	mov    $0x1000,%edx
+    1382:	be 00 00 00 00       	mov    $0x0,%esi
+    1387:	89 c7                	mov    %eax,%edi
+    1389:	e8 e4 ed ff ff       	call   172 <checkpipe>
+  close(fds[0]);
+    138e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+    1391:	89 c7                	mov    %eax,%edi
+    1393:	e8 03 08 00 00       	call   1b9b <close>
+  close(fds[1]);
+    1398:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    139b:	89 c7                	mov    %eax,%edi
+    139d:	e8 f9 07 00 00       	call   1b9b <close>
+  printf(stdout, "unlinktest OK\n");
+    13a2:	8b 05 28 13 00 00    	mov    0x1328(%rip),%eax        # 26d0 <stdout>
+    13a8:	48 8d 15 d0 0f 00 00 	lea    0xfd0(%rip),%rdx        # 237f <malloc+0x531>
+    13af:	48 89 d6             	mov    %rdx,%rsi
+    13b2:	89 c7                	mov    %eax,%edi
+    13b4:	b8 00 00 00 00       	mov    $0x0,%eax
+    13b9:	e8 0e 02 00 00       	call   15cc <printf>
+}
+    13be:	90                   	nop
+    13bf:	c9                   	leave
+    13c0:	c3                   	ret
+
+00000000000013c1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    13c1:	55                   	push   %rbp
+    13c2:	48 89 e5             	mov    %rsp,%rbp
+    13c5:	48 83 ec 10          	sub    $0x10,%rsp
+    13c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    13cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  makefile();
+    13d0:	e8 2b ec ff ff       	call   0 <makefile>
+  sendfiletest();
+    13d5:	e8 97 ef ff ff       	call   371 <sendfiletest>
+  splicetest();
+    13da:	e8 93 f3 ff ff       	call   772 <splicetest>
+  sharetest();
+    13df:	e8 c6 f9 ff ff       	call   daa <sharetest>
+  unlinktest();
+    13e4:	e8 ed fd ff ff       	call   11d6 <unlinktest>
+  printf(stdout, "splicetest passed!!\n");
+    13e9:	8b 05 e1 12 00 00    	mov    0x12e1(%rip),%eax        # 26d0 <stdout>
+    13ef:	48 8d 15 98 0f 00 00 	lea    0xf98(%rip),%rdx        # 238e <malloc+0x540>
+    13f6:	48 89 d6             	mov    %rdx,%rsi
+    13f9:	89 c7                	mov    %eax,%edi
+    13fb:	b8 00 00 00 00       	mov    $0x0,%eax
+    1400:	e8 c7 01 00 00       	call   15cc <printf>
+  exit();
+    1405:	e8 69 07 00 00       	call   1b73 <exit>
+
+000000000000140a <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+    140a:	55                   	push   %rbp
+    140b:	48 89 e5             	mov    %rsp,%rbp
+    140e:	48 83 ec 10          	sub    $0x10,%rsp
+    1412:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    1415:	89 f0                	mov    %esi,%eax
+    1417:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+    141a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+    141e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1421:	ba 01 00 00 00       	mov    $0x1,%edx
+    1426:	48 89 ce             	mov    %rcx,%rsi
+    1429:	89 c7                	mov    %eax,%edi
+    142b:	e8 63 07 00 00       	call   1b93 <write>
+}
+    1430:	90                   	nop
+    1431:	c9                   	leave
+    1432:	c3                   	ret
+
+0000000000001433 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+    1433:	55                   	push   %rbp
+    1434:	48 89 e5             	mov    %rsp,%rbp
+    1437:	48 83 ec 40          	sub    $0x40,%rsp
+    143b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+    143e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+    1441:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+    1444:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+    1447:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    144b:	74 1f                	je     146c <printint64+0x39>
+    144d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1450:	c1 e8 1f             	shr    $0x1f,%eax
+    1453:	0f b6 c0             	movzbl %al,%eax
+    1456:	89 45 c0             	mov    %eax,-0x40(%rbp)
+    1459:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    145d:	74 0d                	je     146c <printint64+0x39>
+    x = -xx;
+    145f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    1462:	f7 d8                	neg    %eax
+    1464:	48 98                	cltq
+    1466:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    146a:	eb 09                	jmp    1475 <printint64+0x42>
+  else
+    x = xx;
+    146c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+    146f:	48 98                	cltq
+    1471:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+    1475:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    147c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    147f:	48 63 c8             	movslq %eax,%rcx
+    1482:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1486:	ba 00 00 00 00       	mov    $0x0,%edx
+    148b:	48 f7 f1             	div    %rcx
+    148e:	48 89 d1             	mov    %rdx,%rcx
+    1491:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1494:	8d 50 01             	lea    0x1(%rax),%edx
+    1497:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    149a:	48 8d 15 3f 12 00 00 	lea    0x123f(%rip),%rdx        # 26e0 <digits.1>
+    14a1:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    14a5:	48 98                	cltq
+    14a7:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    14ab:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    14ae:	48 63 f0             	movslq %eax,%rsi
+    14b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14b5:	ba 00 00 00 00       	mov    $0x0,%edx
+    14ba:	48 f7 f6             	div    %rsi
+    14bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    14c1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    14c6:	75 b4                	jne    147c <printint64+0x49>
+
+  if(sgn)
+    14c8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    14cc:	74 2b                	je     14f9 <printint64+0xc6>
+    buf[i++] = '-';
+    14ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14d1:	8d 50 01             	lea    0x1(%rax),%edx
+    14d4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    14d7:	48 98                	cltq
+    14d9:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+    14de:	eb 19                	jmp    14f9 <printint64+0xc6>
+    putc(fd, buf[i]);
+    14e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    14e3:	48 98                	cltq
+    14e5:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+    14ea:	0f be d0             	movsbl %al,%edx
+    14ed:	8b 45 cc             	mov    -0x34(%rbp),%eax
+    14f0:	89 d6                	mov    %edx,%esi
+    14f2:	89 c7                	mov    %eax,%edi
+    14f4:	e8 11 ff ff ff       	call   140a <putc>
+  while(--i >= 0)
+    14f9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    14fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1501:	79 dd                	jns    14e0 <printint64+0xad>
+}
+    1503:	90                   	nop
+    1504:	90                   	nop
+    1505:	c9                   	leave
+    1506:	c3                   	ret
+
+0000000000001507 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1507:	55                   	push   %rbp
+    1508:	48 89 e5             	mov    %rsp,%rbp
+    150b:	48 83 ec 30          	sub    $0x30,%rsp
+    150f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+    1512:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    1515:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+    1518:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    151b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+    1522:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+    1526:	74 17                	je     153f <printint+0x38>
+    1528:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+    152c:	79 11                	jns    153f <printint+0x38>
+    neg = 1;
+    152e:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+    1535:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1538:	f7 d8                	neg    %eax
+    153a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    153d:	eb 06                	jmp    1545 <printint+0x3e>
+  } else {
+    x = xx;
+    153f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+    1542:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+    1545:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+    154c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+    154f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    1552:	ba 00 00 00 00       	mov    $0x0,%edx
+    1557:	f7 f1                	div    %ecx
+    1559:	89 d1                	mov    %edx,%ecx
+    155b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    155e:	8d 50 01             	lea    0x1(%rax),%edx
+    1561:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1564:	89 c9                	mov    %ecx,%ecx
+    1566:	48 8d 15 93 11 00 00 	lea    0x1193(%rip),%rdx        # 2700 <digits.0>
+    156d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+    1571:	48 98                	cltq
+    1573:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+    1577:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+    157a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    157d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1582:	f7 f6                	div    %esi
+    1584:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    1587:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+    158b:	75 bf                	jne    154c <printint+0x45>
+  if(neg)
+    158d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1591:	74 2b                	je     15be <printint+0xb7>
+    buf[i++] = '-';
+    1593:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1596:	8d 50 01             	lea    0x1(%rax),%edx
+    1599:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    159c:	48 98                	cltq
+    159e:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+    15a3:	eb 19                	jmp    15be <printint+0xb7>
+    putc(fd, buf[i]);
+    15a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    15a8:	48 98                	cltq
+    15aa:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+    15af:	0f be d0             	movsbl %al,%edx
+    15b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    15b5:	89 d6                	mov    %edx,%esi
+    15b7:	89 c7                	mov    %eax,%edi
+    15b9:	e8 4c fe ff ff       	call   140a <putc>
+  while(--i >= 0)
+    15be:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+    15c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    15c6:	79 dd                	jns    15a5 <printint+0x9e>
+}
+    15c8:	90                   	nop
+    15c9:	90                   	nop
+    15ca:	c9                   	leave
+    15cb:	c3                   	ret
+
+00000000000015cc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    15cc:	55                   	push   %rbp
+    15cd:	48 89 e5             	mov    %rsp,%rbp
+    15d0:	48 83 ec 70          	sub    $0x70,%rsp
+    15d4:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    15d7:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+    15db:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+    15df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    15e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+    15e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+    15eb:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+    15f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+    15f6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    15fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+    15fe:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+    1602:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    1609:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+    1610:	e9 6b 02 00 00       	jmp    1880 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+    1615:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1618:	48 63 d0             	movslq %eax,%rdx
+    161b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    161f:	48 01 d0             	add    %rdx,%rax
+    1622:	0f b6 00             	movzbl (%rax),%eax
+    1625:	0f be c0             	movsbl %al,%eax
+    1628:	25 ff 00 00 00       	and    $0xff,%eax
+    162d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+    1630:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+    1634:	75 30                	jne    1666 <printf+0x9a>
+      if(c == '%'){
+    1636:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    163a:	75 13                	jne    164f <printf+0x83>
+        state = '%';
+    163c:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+    1643:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+    164a:	e9 2d 02 00 00       	jmp    187c <printf+0x2b0>
+      } else {
+        putc(fd, c);
+    164f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1652:	0f be d0             	movsbl %al,%edx
+    1655:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1658:	89 d6                	mov    %edx,%esi
+    165a:	89 c7                	mov    %eax,%edi
+    165c:	e8 a9 fd ff ff       	call   140a <putc>
+    1661:	e9 16 02 00 00       	jmp    187c <printf+0x2b0>
+      }
+    } else if(state == '%'){
+    1666:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+    166a:	0f 85 0c 02 00 00    	jne    187c <printf+0x2b0>
+      if(c == 'l') {
+    1670:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+    1674:	75 0c                	jne    1682 <printf+0xb6>
+        lflag = 1;
+    1676:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+    167d:	e9 fa 01 00 00       	jmp    187c <printf+0x2b0>
+      } else if(c == 'd'){
+    1682:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+    1686:	0f 85 95 00 00 00    	jne    1721 <printf+0x155>
+        if (lflag == 1)
+    168c:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1690:	75 49                	jne    16db <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+    1692:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1695:	83 f8 2f             	cmp    $0x2f,%eax
+    1698:	77 17                	ja     16b1 <printf+0xe5>
+    169a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    169e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16a1:	89 d2                	mov    %edx,%edx
+    16a3:	48 01 d0             	add    %rdx,%rax
+    16a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16a9:	83 c2 08             	add    $0x8,%edx
+    16ac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    16af:	eb 0c                	jmp    16bd <printf+0xf1>
+    16b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    16b5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    16b9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    16bd:	48 8b 00             	mov    (%rax),%rax
+    16c0:	89 c6                	mov    %eax,%esi
+    16c2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    16c5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    16ca:	ba 0a 00 00 00       	mov    $0xa,%edx
+    16cf:	89 c7                	mov    %eax,%edi
+    16d1:	e8 5d fd ff ff       	call   1433 <printint64>
+    16d6:	e9 9a 01 00 00       	jmp    1875 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+    16db:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    16de:	83 f8 2f             	cmp    $0x2f,%eax
+    16e1:	77 17                	ja     16fa <printf+0x12e>
+    16e3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    16e7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16ea:	89 d2                	mov    %edx,%edx
+    16ec:	48 01 d0             	add    %rdx,%rax
+    16ef:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    16f2:	83 c2 08             	add    $0x8,%edx
+    16f5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    16f8:	eb 0c                	jmp    1706 <printf+0x13a>
+    16fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    16fe:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    1702:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1706:	8b 30                	mov    (%rax),%esi
+    1708:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    170b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1710:	ba 0a 00 00 00       	mov    $0xa,%edx
+    1715:	89 c7                	mov    %eax,%edi
+    1717:	e8 eb fd ff ff       	call   1507 <printint>
+    171c:	e9 54 01 00 00       	jmp    1875 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+    1721:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+    1725:	74 0a                	je     1731 <printf+0x165>
+    1727:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+    172b:	0f 85 95 00 00 00    	jne    17c6 <printf+0x1fa>
+        if (lflag == 1)
+    1731:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+    1735:	75 49                	jne    1780 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+    1737:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    173a:	83 f8 2f             	cmp    $0x2f,%eax
+    173d:	77 17                	ja     1756 <printf+0x18a>
+    173f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    1743:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1746:	89 d2                	mov    %edx,%edx
+    1748:	48 01 d0             	add    %rdx,%rax
+    174b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    174e:	83 c2 08             	add    $0x8,%edx
+    1751:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    1754:	eb 0c                	jmp    1762 <printf+0x196>
+    1756:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    175a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    175e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    1762:	48 8b 00             	mov    (%rax),%rax
+    1765:	89 c6                	mov    %eax,%esi
+    1767:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    176a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    176f:	ba 10 00 00 00       	mov    $0x10,%edx
+    1774:	89 c7                	mov    %eax,%edi
+    1776:	e8 b8 fc ff ff       	call   1433 <printint64>
+        if (lflag == 1)
+    177b:	e9 f5 00 00 00       	jmp    1875 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+    1780:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    1783:	83 f8 2f             	cmp    $0x2f,%eax
+    1786:	77 17                	ja     179f <printf+0x1d3>
+    1788:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    178c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    178f:	89 d2                	mov    %edx,%edx
+    1791:	48 01 d0             	add    %rdx,%rax
+    1794:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    1797:	83 c2 08             	add    $0x8,%edx
+    179a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    179d:	eb 0c                	jmp    17ab <printf+0x1df>
+    179f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    17a3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    17a7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    17ab:	8b 30                	mov    (%rax),%esi
+    17ad:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    17b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    17b5:	ba 10 00 00 00       	mov    $0x10,%edx
+    17ba:	89 c7                	mov    %eax,%edi
+    17bc:	e8 46 fd ff ff       	call   1507 <printint>
+        if (lflag == 1)
+    17c1:	e9 af 00 00 00       	jmp    1875 <printf+0x2a9>
+      } else if(c == 's'){
+    17c6:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+    17ca:	75 6e                	jne    183a <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+    17cc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+    17cf:	83 f8 2f             	cmp    $0x2f,%eax
+    17d2:	77 17                	ja     17eb <printf+0x21f>
+    17d4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+    17d8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17db:	89 d2                	mov    %edx,%edx
+    17dd:	48 01 d0             	add    %rdx,%rax
+    17e0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+    17e3:	83 c2 08             	add    $0x8,%edx
+    17e6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+    17e9:	eb 0c                	jmp    17f7 <printf+0x22b>
+    17eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+    17ef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    17f3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    17f7:	48 8b 00             	mov    (%rax),%rax
+    17fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    17fe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+    1803:	75 28                	jne    182d <printf+0x261>
+          s = "(null)";
+    1805:	48 8d 05 97 0b 00 00 	lea    0xb97(%rip),%rax        # 23a3 <malloc+0x555>
+    180c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+    1810:	eb 1b                	jmp    182d <printf+0x261>
+          putc(fd, *s);
+    1812:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1816:	0f b6 00             	movzbl (%rax),%eax
+    1819:	0f be d0             	movsbl %al,%edx
+    181c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    181f:	89 d6                	mov    %edx,%esi
+    1821:	89 c7                	mov    %eax,%edi
+    1823:	e8 e2 fb ff ff       	call   140a <putc>
+        for(; *s; s++)
+    1828:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+    182d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+    1831:	0f b6 00             	movzbl (%rax),%eax
+    1834:	84 c0                	test   %al,%al
+    1836:	75 da                	jne    1812 <printf+0x246>
+    1838:	eb 3b                	jmp    1875 <printf+0x2a9>
+      } else if(c == '%'){
+    183a:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+    183e:	75 14                	jne    1854 <printf+0x288>
+        putc(fd, c);
+    1840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1843:	0f be d0             	movsbl %al,%edx
+    1846:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1849:	89 d6                	mov    %edx,%esi
+    184b:	89 c7                	mov    %eax,%edi
+    184d:	e8 b8 fb ff ff       	call   140a <putc>
+    1852:	eb 21                	jmp    1875 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1854:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    1857:	be 25 00 00 00       	mov    $0x25,%esi
+    185c:	89 c7                	mov    %eax,%edi
+    185e:	e8 a7 fb ff ff       	call   140a <putc>
+        putc(fd, c);
+    1863:	8b 45 b8             	mov    -0x48(%rbp),%eax
+    1866:	0f be d0             	movsbl %al,%edx
+    1869:	8b 45 9c             	mov    -0x64(%rbp),%eax
+    186c:	89 d6                	mov    %edx,%esi
+    186e:	89 c7                	mov    %eax,%edi
+    1870:	e8 95 fb ff ff       	call   140a <putc>
+      }
+      state = 0;
+    1875:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+    187c:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+    1880:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+    1883:	48 63 d0             	movslq %eax,%rdx
+    1886:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+    188a:	48 01 d0             	add    %rdx,%rax
+    188d:	0f b6 00             	movzbl (%rax),%eax
+    1890:	84 c0                	test   %al,%al
+    1892:	0f 85 7d fd ff ff    	jne    1615 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+    1898:	90                   	nop
+    1899:	90                   	nop
+    189a:	c9                   	leave
+    189b:	c3                   	ret
+
+000000000000189c <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    189c:	55                   	push   %rbp
+    189d:	48 89 e5             	mov    %rsp,%rbp
+    18a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    18a4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    18a7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+    18aa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+    18ae:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    18b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+    18b4:	48 89 ce             	mov    %rcx,%rsi
+    18b7:	48 89 f7             	mov    %rsi,%rdi
+    18ba:	89 d1                	mov    %edx,%ecx
+    18bc:	fc                   	cld
+    18bd:	f3 aa                	rep stos %al,%es:(%rdi)
+    18bf:	89 ca                	mov    %ecx,%edx
+    18c1:	48 89 fe             	mov    %rdi,%rsi
+    18c4:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    18c8:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    18cb:	90                   	nop
+    18cc:	5d                   	pop    %rbp
+    18cd:	c3                   	ret
+
+00000000000018ce <strcpy>:
+{
+    18ce:	55                   	push   %rbp
+    18cf:	48 89 e5             	mov    %rsp,%rbp
+    18d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    18d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    18da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    18e2:	90                   	nop
+    18e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    18e7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    18eb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    18ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    18f3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    18f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    18fb:	0f b6 12             	movzbl (%rdx),%edx
+    18fe:	88 10                	mov    %dl,(%rax)
+    1900:	0f b6 00             	movzbl (%rax),%eax
+    1903:	84 c0                	test   %al,%al
+    1905:	75 dc                	jne    18e3 <strcpy+0x15>
+  return os;
+    1907:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    190b:	5d                   	pop    %rbp
+    190c:	c3                   	ret
+
+000000000000190d <strcmp>:
+{
+    190d:	55                   	push   %rbp
+    190e:	48 89 e5             	mov    %rsp,%rbp
+    1911:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1915:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    1919:	eb 0a                	jmp    1925 <strcmp+0x18>
+    p++, q++;
+    191b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1920:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1925:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1929:	0f b6 00             	movzbl (%rax),%eax
+    192c:	84 c0                	test   %al,%al
+    192e:	74 12                	je     1942 <strcmp+0x35>
+    1930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1934:	0f b6 10             	movzbl (%rax),%edx
+    1937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    193b:	0f b6 00             	movzbl (%rax),%eax
+    193e:	38 c2                	cmp    %al,%dl
+    1940:	74 d9                	je     191b <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1942:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1946:	0f b6 00             	movzbl (%rax),%eax
+    1949:	0f b6 d0             	movzbl %al,%edx
+    194c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1950:	0f b6 00             	movzbl (%rax),%eax
+    1953:	0f b6 c0             	movzbl %al,%eax
+    1956:	29 c2                	sub    %eax,%edx
+    1958:	89 d0                	mov    %edx,%eax
+}
+    195a:	5d                   	pop    %rbp
+    195b:	c3                   	ret
+
+000000000000195c <strlen>:
+{
+    195c:	55                   	push   %rbp
+    195d:	48 89 e5             	mov    %rsp,%rbp
+    1960:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    1964:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    196b:	eb 04                	jmp    1971 <strlen+0x15>
+    196d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    1971:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1974:	48 63 d0             	movslq %eax,%rdx
+    1977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    197b:	48 01 d0             	add    %rdx,%rax
+    197e:	0f b6 00             	movzbl (%rax),%eax
+    1981:	84 c0                	test   %al,%al
+    1983:	75 e8                	jne    196d <strlen+0x11>
+  return n;
+    1985:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1988:	5d                   	pop    %rbp
+    1989:	c3                   	ret
+
+000000000000198a <memset>:
+{
+    198a:	55                   	push   %rbp
+    198b:	48 89 e5             	mov    %rsp,%rbp
+    198e:	48 83 ec 10          	sub    $0x10,%rsp
+    1992:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1996:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    1999:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    199c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    199f:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    19a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19a6:	89 ce                	mov    %ecx,%esi
+    19a8:	48 89 c7             	mov    %rax,%rdi
+    19ab:	e8 ec fe ff ff       	call   189c <stosb>
+  return dst;
+    19b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    19b4:	c9                   	leave
+    19b5:	c3                   	ret
+
+00000000000019b6 <strchr>:
+{
+    19b6:	55                   	push   %rbp
+    19b7:	48 89 e5             	mov    %rsp,%rbp
+    19ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    19be:	89 f0                	mov    %esi,%eax
+    19c0:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    19c3:	eb 17                	jmp    19dc <strchr+0x26>
+    if(*s == c)
+    19c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19c9:	0f b6 00             	movzbl (%rax),%eax
+    19cc:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    19cf:	75 06                	jne    19d7 <strchr+0x21>
+      return (char*)s;
+    19d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19d5:	eb 15                	jmp    19ec <strchr+0x36>
+  for(; *s; s++)
+    19d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    19dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    19e0:	0f b6 00             	movzbl (%rax),%eax
+    19e3:	84 c0                	test   %al,%al
+    19e5:	75 de                	jne    19c5 <strchr+0xf>
+  return 0;
+    19e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    19ec:	5d                   	pop    %rbp
+    19ed:	c3                   	ret
+
+00000000000019ee <gets>:
+gets(char *buf, int max)
+{
+    19ee:	55                   	push   %rbp
+    19ef:	48 89 e5             	mov    %rsp,%rbp
+    19f2:	48 83 ec 20          	sub    $0x20,%rsp
+    19f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    19fa:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    19fd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1a04:	eb 48                	jmp    1a4e <gets+0x60>
+    cc = read(0, &c, 1);
+    1a06:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    1a0a:	ba 01 00 00 00       	mov    $0x1,%edx
+    1a0f:	48 89 c6             	mov    %rax,%rsi
+    1a12:	bf 00 00 00 00       	mov    $0x0,%edi
+    1a17:	e8 6f 01 00 00       	call   1b8b <read>
+    1a1c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1a1f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1a23:	7e 36                	jle    1a5b <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1a25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a28:	8d 50 01             	lea    0x1(%rax),%edx
+    1a2b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1a2e:	48 63 d0             	movslq %eax,%rdx
+    1a31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a35:	48 01 c2             	add    %rax,%rdx
+    1a38:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a3c:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1a3e:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a42:	3c 0a                	cmp    $0xa,%al
+    1a44:	74 16                	je     1a5c <gets+0x6e>
+    1a46:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1a4a:	3c 0d                	cmp    $0xd,%al
+    1a4c:	74 0e                	je     1a5c <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1a4e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a51:	83 c0 01             	add    $0x1,%eax
+    1a54:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1a57:	7f ad                	jg     1a06 <gets+0x18>
+    1a59:	eb 01                	jmp    1a5c <gets+0x6e>
+      break;
+    1a5b:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1a5c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1a5f:	48 63 d0             	movslq %eax,%rdx
+    1a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a66:	48 01 d0             	add    %rdx,%rax
+    1a69:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    1a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    1a70:	c9                   	leave
+    1a71:	c3                   	ret
+
+0000000000001a72 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1a72:	55                   	push   %rbp
+    1a73:	48 89 e5             	mov    %rsp,%rbp
+    1a76:	48 83 ec 20          	sub    $0x20,%rsp
+    1a7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1a7e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1a82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1a86:	be 00 00 00 00       	mov    $0x0,%esi
+    1a8b:	48 89 c7             	mov    %rax,%rdi
+    1a8e:	e8 20 01 00 00       	call   1bb3 <open>
+    1a93:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    1a96:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    1a9a:	79 07                	jns    1aa3 <stat+0x31>
+    return -1;
+    1a9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1aa1:	eb 21                	jmp    1ac4 <stat+0x52>
+  r = fstat(fd, st);
+    1aa3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1aa7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aaa:	48 89 d6             	mov    %rdx,%rsi
+    1aad:	89 c7                	mov    %eax,%edi
+    1aaf:	e8 17 01 00 00       	call   1bcb <fstat>
+    1ab4:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    1ab7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1aba:	89 c7                	mov    %eax,%edi
+    1abc:	e8 da 00 00 00       	call   1b9b <close>
+  return r;
+    1ac1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1ac4:	c9                   	leave
+    1ac5:	c3                   	ret
+
+0000000000001ac6 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1ac6:	55                   	push   %rbp
+    1ac7:	48 89 e5             	mov    %rsp,%rbp
+    1aca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1ace:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1ad5:	eb 28                	jmp    1aff <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1ad7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    1ada:	89 d0                	mov    %edx,%eax
+    1adc:	c1 e0 02             	shl    $0x2,%eax
+    1adf:	01 d0                	add    %edx,%eax
+    1ae1:	01 c0                	add    %eax,%eax
+    1ae3:	89 c1                	mov    %eax,%ecx
+    1ae5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ae9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    1aed:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1af1:	0f b6 00             	movzbl (%rax),%eax
+    1af4:	0f be c0             	movsbl %al,%eax
+    1af7:	01 c8                	add    %ecx,%eax
+    1af9:	83 e8 30             	sub    $0x30,%eax
+    1afc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1aff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b03:	0f b6 00             	movzbl (%rax),%eax
+    1b06:	3c 2f                	cmp    $0x2f,%al
+    1b08:	7e 0b                	jle    1b15 <atoi+0x4f>
+    1b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b0e:	0f b6 00             	movzbl (%rax),%eax
+    1b11:	3c 39                	cmp    $0x39,%al
+    1b13:	7e c2                	jle    1ad7 <atoi+0x11>
+  return n;
+    1b15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    1b18:	5d                   	pop    %rbp
+    1b19:	c3                   	ret
+
+0000000000001b1a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    1b1a:	55                   	push   %rbp
+    1b1b:	48 89 e5             	mov    %rsp,%rbp
+    1b1e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1b22:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1b26:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    1b29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b2d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1b31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1b35:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    1b39:	eb 1d                	jmp    1b58 <memmove+0x3e>
+    *dst++ = *src++;
+    1b3b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1b3f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1b43:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1b47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1b4b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1b4f:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1b53:	0f b6 12             	movzbl (%rdx),%edx
+    1b56:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    1b58:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1b5b:	8d 50 ff             	lea    -0x1(%rax),%edx
+    1b5e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    1b61:	85 c0                	test   %eax,%eax
+    1b63:	7f d6                	jg     1b3b <memmove+0x21>
+  return vdst;
+    1b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1b69:	5d                   	pop    %rbp
+    1b6a:	c3                   	ret
+
+0000000000001b6b <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    1b6b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b70:	cd 40                	int    $0x40
+    1b72:	c3                   	ret
+
+0000000000001b73 <exit>:
+SYSCALL(exit)
+    1b73:	b8 02 00 00 00       	mov    $0x2,%eax
+    1b78:	cd 40                	int    $0x40
+    1b7a:	c3                   	ret
+
+0000000000001b7b <wait>:
+SYSCALL(wait)
+    1b7b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1b80:	cd 40                	int    $0x40
+    1b82:	c3                   	ret
+
+0000000000001b83 <pipe>:
+SYSCALL(pipe)
+    1b83:	b8 04 00 00 00       	mov    $0x4,%eax
+    1b88:	cd 40                	int    $0x40
+    1b8a:	c3                   	ret
+
+0000000000001b8b <read>:
+SYSCALL(read)
+    1b8b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1b90:	cd 40                	int    $0x40
+    1b92:	c3                   	ret
+
+0000000000001b93 <write>:
+SYSCALL(write)
+    1b93:	b8 10 00 00 00       	mov    $0x10,%eax
+    1b98:	cd 40                	int    $0x40
+    1b9a:	c3                   	ret
+
+0000000000001b9b <close>:
+SYSCALL(close)
+    1b9b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1ba0:	cd 40                	int    $0x40
+    1ba2:	c3                   	ret
+
+0000000000001ba3 <kill>:
+SYSCALL(kill)
+    1ba3:	b8 06 00 00 00       	mov    $0x6,%eax
+    1ba8:	cd 40                	int    $0x40
+    1baa:	c3                   	ret
+
+0000000000001bab <exec>:
+SYSCALL(exec)
+    1bab:	b8 07 00 00 00       	mov    $0x7,%eax
+    1bb0:	cd 40                	int    $0x40
+    1bb2:	c3                   	ret
+
+0000000000001bb3 <open>:
+SYSCALL(open)
+    1bb3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1bb8:	cd 40                	int    $0x40
+    1bba:	c3                   	ret
+
+0000000000001bbb <mknod>:
+SYSCALL(mknod)
+    1bbb:	b8 11 00 00 00       	mov    $0x11,%eax
+    1bc0:	cd 40                	int    $0x40
+    1bc2:	c3                   	ret
+
+0000000000001bc3 <unlink>:
+SYSCALL(unlink)
+    1bc3:	b8 12 00 00 00       	mov    $0x12,%eax
+    1bc8:	cd 40                	int    $0x40
+    1bca:	c3                   	ret
+
+0000000000001bcb <fstat>:
+SYSCALL(fstat)
+    1bcb:	b8 08 00 00 00       	mov    $0x8,%eax
+    1bd0:	cd 40                	int    $0x40
+    1bd2:	c3                   	ret
+
+0000000000001bd3 <link>:
+SYSCALL(link)
+    1bd3:	b8 13 00 00 00       	mov    $0x13,%eax
+    1bd8:	cd 40                	int    $0x40
+    1bda:	c3                   	ret
+
+0000000000001bdb <mkdir>:
+SYSCALL(mkdir)
+    1bdb:	b8 14 00 00 00       	mov    $0x14,%eax
+    1be0:	cd 40                	int    $0x40
+    1be2:	c3                   	ret
+
+0000000000001be3 <chdir>:
+SYSCALL(chdir)
+    1be3:	b8 09 00 00 00       	mov    $0x9,%eax
+    1be8:	cd 40                	int    $0x40
+    1bea:	c3                   	ret
+
+0000000000001beb <dup>:
+SYSCALL(dup)
+    1beb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1bf0:	cd 40                	int    $0x40
+    1bf2:	c3                   	ret
+
+0000000000001bf3 <getpid>:
+SYSCALL(getpid)
+    1bf3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1bf8:	cd 40                	int    $0x40
+    1bfa:	c3                   	ret
+
+0000000000001bfb <sbrk>:
+SYSCALL(sbrk)
+    1bfb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1c00:	cd 40                	int    $0x40
+    1c02:	c3                   	ret
+
+0000000000001c03 <sleep>:
+SYSCALL(sleep)
+    1c03:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1c08:	cd 40                	int    $0x40
+    1c0a:	c3                   	ret
+
+0000000000001c0b <uptime>:
+SYSCALL(uptime)
+    1c0b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1c10:	cd 40                	int    $0x40
+    1c12:	c3                   	ret
+
+0000000000001c13 <sysinfo>:
+SYSCALL(sysinfo)
+    1c13:	b8 16 00 00 00       	mov    $0x16,%eax
+    1c18:	cd 40                	int    $0x40
+    1c1a:	c3                   	ret
+
+0000000000001c1b <mmap>:
+SYSCALL(mmap)
+    1c1b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1c20:	cd 40                	int    $0x40
+    1c22:	c3                   	ret
+
+0000000000001c23 <munmap>:
+SYSCALL(munmap)
+    1c23:	b8 18 00 00 00       	mov    $0x18,%eax
+    1c28:	cd 40                	int    $0x40
+    1c2a:	c3                   	ret
+
+0000000000001c2b <crashn>:
+SYSCALL(crashn)
+    1c2b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1c30:	cd 40                	int    $0x40
+    1c32:	c3                   	ret
+
+0000000000001c33 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1c33:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1c38:	cd 40                	int    $0x40
+    1c3a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c3d:	74 02                	je     1c41 <mmap2+0xe>
+    1c3f:	89 c0                	mov    %eax,%eax
+    1c41:	c3                   	ret
+
+0000000000001c42 <munmap2>:
+SYSCALL(munmap2)
+    1c42:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1c47:	cd 40                	int    $0x40
+    1c49:	c3                   	ret
+
+0000000000001c4a <msync>:
+SYSCALL(msync)
+    1c4a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1c4f:	cd 40                	int    $0x40
+    1c51:	c3                   	ret
+
+0000000000001c52 <sendfile>:
+SYSCALL(sendfile)
+    1c52:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1c57:	cd 40                	int    $0x40
+    1c59:	c3                   	ret
+
+0000000000001c5a <splice>:
+SYSCALL(splice)
+    1c5a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1c5f:	cd 40                	int    $0x40
+    1c61:	c3                   	ret
+
+0000000000001c62 <pread>:
+SYSCALL(pread)
+    1c62:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1c67:	cd 40                	int    $0x40
+    1c69:	c3                   	ret
+
+0000000000001c6a <pwrite>:
+SYSCALL(pwrite)
+    1c6a:	b8 20 00 00 00       	mov    $0x20,%eax
+    1c6f:	cd 40                	int    $0x40
+    1c71:	c3                   	ret
+
+0000000000001c72 <readv>:
+SYSCALL(readv)
+    1c72:	b8 21 00 00 00       	mov    $0x21,%eax
+    1c77:	cd 40                	int    $0x40
+    1c79:	c3                   	ret
+
+0000000000001c7a <writev>:
+SYSCALL(writev)
+    1c7a:	b8 22 00 00 00       	mov    $0x22,%eax
+    1c7f:	cd 40                	int    $0x40
+    1c81:	c3                   	ret
+
+0000000000001c82 <poll>:
+SYSCALL(poll)
+    1c82:	b8 23 00 00 00       	mov    $0x23,%eax
+    1c87:	cd 40                	int    $0x40
+    1c89:	c3                   	ret
+
+0000000000001c8a <pipe2>:
+SYSCALL(pipe2)
+    1c8a:	b8 24 00 00 00       	mov    $0x24,%eax
+    1c8f:	cd 40                	int    $0x40
+    1c91:	c3                   	ret
+
+0000000000001c92 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    1c92:	55                   	push   %rbp
+    1c93:	48 89 e5             	mov    %rsp,%rbp
+    1c96:	48 83 ec 20          	sub    $0x20,%rsp
+    1c9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1ca2:	48 83 e8 10          	sub    $0x10,%rax
+    1ca6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    1caa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cae:	48 8b 10             	mov    (%rax),%rdx
+    1cb1:	48 8d 05 88 0a 00 00 	lea    0xa88(%rip),%rax        # 2740 <bigblock>
+    1cb8:	48 39 c2             	cmp    %rax,%rdx
+    1cbb:	75 1f                	jne    1cdc <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    1cbd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cc1:	8b 40 08             	mov    0x8(%rax),%eax
+    1cc4:	c1 e0 04             	shl    $0x4,%eax
+    1cc7:	89 c2                	mov    %eax,%edx
+    1cc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ccd:	89 d6                	mov    %edx,%esi
+    1ccf:	48 89 c7             	mov    %rax,%rdi
+    1cd2:	e8 6b ff ff ff       	call   1c42 <munmap2>
+    return;
+    1cd7:	e9 0b 01 00 00       	jmp    1de7 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1cdc:	48 8b 05 4d 0a 00 00 	mov    0xa4d(%rip),%rax        # 2730 <freep>
+    1ce3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1ce7:	eb 2f                	jmp    1d18 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ced:	48 8b 00             	mov    (%rax),%rax
+    1cf0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1cf4:	72 17                	jb     1d0d <free+0x7b>
+    1cf6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1cfa:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1cfe:	72 2f                	jb     1d2f <free+0x9d>
+    1d00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d04:	48 8b 00             	mov    (%rax),%rax
+    1d07:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d0b:	72 22                	jb     1d2f <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d11:	48 8b 00             	mov    (%rax),%rax
+    1d14:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1d18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d1c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1d20:	73 c7                	jae    1ce9 <free+0x57>
+    1d22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d26:	48 8b 00             	mov    (%rax),%rax
+    1d29:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1d2d:	73 ba                	jae    1ce9 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1d2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d33:	8b 40 08             	mov    0x8(%rax),%eax
+    1d36:	89 c0                	mov    %eax,%eax
+    1d38:	48 c1 e0 04          	shl    $0x4,%rax
+    1d3c:	48 89 c2             	mov    %rax,%rdx
+    1d3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d43:	48 01 c2             	add    %rax,%rdx
+    1d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d4a:	48 8b 00             	mov    (%rax),%rax
+    1d4d:	48 39 c2             	cmp    %rax,%rdx
+    1d50:	75 2d                	jne    1d7f <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1d52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d56:	8b 50 08             	mov    0x8(%rax),%edx
+    1d59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d5d:	48 8b 00             	mov    (%rax),%rax
+    1d60:	8b 40 08             	mov    0x8(%rax),%eax
+    1d63:	01 c2                	add    %eax,%edx
+    1d65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d69:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1d6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d70:	48 8b 00             	mov    (%rax),%rax
+    1d73:	48 8b 10             	mov    (%rax),%rdx
+    1d76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d7a:	48 89 10             	mov    %rdx,(%rax)
+    1d7d:	eb 0e                	jmp    1d8d <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1d7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d83:	48 8b 10             	mov    (%rax),%rdx
+    1d86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1d8a:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    1d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1d91:	8b 40 08             	mov    0x8(%rax),%eax
+    1d94:	89 c0                	mov    %eax,%eax
+    1d96:	48 c1 e0 04          	shl    $0x4,%rax
+    1d9a:	48 89 c2             	mov    %rax,%rdx
+    1d9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1da1:	48 01 d0             	add    %rdx,%rax
+    1da4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    1da8:	75 27                	jne    1dd1 <free+0x13f>
+    p->s.size += bp->s.size;
+    1daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dae:	8b 50 08             	mov    0x8(%rax),%edx
+    1db1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1db5:	8b 40 08             	mov    0x8(%rax),%eax
+    1db8:	01 c2                	add    %eax,%edx
+    1dba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dbe:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1dc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1dc5:	48 8b 10             	mov    (%rax),%rdx
+    1dc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dcc:	48 89 10             	mov    %rdx,(%rax)
+    1dcf:	eb 0b                	jmp    1ddc <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1dd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1dd5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1dd9:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    1ddc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1de0:	48 89 05 49 09 00 00 	mov    %rax,0x949(%rip)        # 2730 <freep>
+}
+    1de7:	c9                   	leave
+    1de8:	c3                   	ret
+
+0000000000001de9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1de9:	55                   	push   %rbp
+    1dea:	48 89 e5             	mov    %rsp,%rbp
+    1ded:	48 83 ec 20          	sub    $0x20,%rsp
+    1df1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1df4:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    1dfb:	77 07                	ja     1e04 <morecore+0x1b>
+    nu = 4096;
+    1dfd:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1e04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e07:	c1 e0 04             	shl    $0x4,%eax
+    1e0a:	89 c7                	mov    %eax,%edi
+    1e0c:	e8 ea fd ff ff       	call   1bfb <sbrk>
+    1e11:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1e15:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1e1a:	75 07                	jne    1e23 <morecore+0x3a>
+    return 0;
+    1e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e21:	eb 29                	jmp    1e4c <morecore+0x63>
+  hp = (Header*)p;
+    1e23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1e27:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    1e2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e2f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1e32:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1e35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1e39:	48 83 c0 10          	add    $0x10,%rax
+    1e3d:	48 89 c7             	mov    %rax,%rdi
+    1e40:	e8 4d fe ff ff       	call   1c92 <free>
+  return freep;
+    1e45:	48 8b 05 e4 08 00 00 	mov    0x8e4(%rip),%rax        # 2730 <freep>
+}
+    1e4c:	c9                   	leave
+    1e4d:	c3                   	ret
+
+0000000000001e4e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e4e:	55                   	push   %rbp
+    1e4f:	48 89 e5             	mov    %rsp,%rbp
+    1e52:	48 83 ec 30          	sub    $0x30,%rsp
+    1e56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1e59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    1e5c:	48 83 c0 0f          	add    $0xf,%rax
+    1e60:	48 c1 e8 04          	shr    $0x4,%rax
+    1e64:	83 c0 01             	add    $0x1,%eax
+    1e67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    1e6a:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    1e71:	76 62                	jbe    1ed5 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    1e73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1e76:	c1 e0 04             	shl    $0x4,%eax
+    1e79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    1e7f:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    1e85:	b9 22 00 00 00       	mov    $0x22,%ecx
+    1e8a:	ba 03 00 00 00       	mov    $0x3,%edx
+    1e8f:	89 c6                	mov    %eax,%esi
+    1e91:	bf 00 00 00 00       	mov    $0x0,%edi
+    1e96:	e8 98 fd ff ff       	call   1c33 <mmap2>
+    1e9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    1e9f:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    1ea4:	75 0a                	jne    1eb0 <malloc+0x62>
+      return 0;
+    1ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eab:	e9 1c 01 00 00       	jmp    1fcc <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    1eb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1eb4:	48 8d 15 85 08 00 00 	lea    0x885(%rip),%rdx        # 2740 <bigblock>
+    1ebb:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1ebe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ec2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1ec5:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    1ec8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1ecc:	48 83 c0 10          	add    $0x10,%rax
+    1ed0:	e9 f7 00 00 00       	jmp    1fcc <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1ed5:	48 8b 05 54 08 00 00 	mov    0x854(%rip),%rax        # 2730 <freep>
+    1edc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ee0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1ee5:	75 2e                	jne    1f15 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1ee7:	48 8d 05 32 08 00 00 	lea    0x832(%rip),%rax        # 2720 <base>
+    1eee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1ef2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1ef6:	48 89 05 33 08 00 00 	mov    %rax,0x833(%rip)        # 2730 <freep>
+    1efd:	48 8b 05 2c 08 00 00 	mov    0x82c(%rip),%rax        # 2730 <freep>
+    1f04:	48 89 05 15 08 00 00 	mov    %rax,0x815(%rip)        # 2720 <base>
+    base.s.size = 0;
+    1f0b:	c7 05 13 08 00 00 00 	movl   $0x0,0x813(%rip)        # 2728 <base+0x8>
+    1f12:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1f15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f19:	48 8b 00             	mov    (%rax),%rax
+    1f1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f24:	8b 40 08             	mov    0x8(%rax),%eax
+    1f27:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    1f2a:	72 5f                	jb     1f8b <malloc+0x13d>
+      if(p->s.size == nunits)
+    1f2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f30:	8b 40 08             	mov    0x8(%rax),%eax
+    1f33:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1f36:	75 10                	jne    1f48 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    1f38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f3c:	48 8b 10             	mov    (%rax),%rdx
+    1f3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f43:	48 89 10             	mov    %rdx,(%rax)
+    1f46:	eb 2e                	jmp    1f76 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    1f48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f4c:	8b 40 08             	mov    0x8(%rax),%eax
+    1f4f:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1f52:	89 c2                	mov    %eax,%edx
+    1f54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f58:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    1f5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f5f:	8b 40 08             	mov    0x8(%rax),%eax
+    1f62:	89 c0                	mov    %eax,%eax
+    1f64:	48 c1 e0 04          	shl    $0x4,%rax
+    1f68:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    1f6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f70:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1f73:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    1f76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1f7a:	48 89 05 af 07 00 00 	mov    %rax,0x7af(%rip)        # 2730 <freep>
+      return (void*)(p + 1);
+    1f81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1f85:	48 83 c0 10          	add    $0x10,%rax
+    1f89:	eb 41                	jmp    1fcc <malloc+0x17e>
+    }
+    if(p == freep)
+    1f8b:	48 8b 05 9e 07 00 00 	mov    0x79e(%rip),%rax        # 2730 <freep>
+    1f92:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1f96:	75 1c                	jne    1fb4 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    1f98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1f9b:	89 c7                	mov    %eax,%edi
+    1f9d:	e8 47 fe ff ff       	call   1de9 <morecore>
+    1fa2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1fa6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    1fab:	75 07                	jne    1fb4 <malloc+0x166>
+        return 0;
+    1fad:	b8 00 00 00 00       	mov    $0x0,%eax
+    1fb2:	eb 18                	jmp    1fcc <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1fb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fb8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1fbc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1fc0:	48 8b 00             	mov    (%rax),%rax
+    1fc3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1fc7:	e9 54 ff ff ff       	jmp    1f20 <malloc+0xd2>
+  }
+}
+    1fcc:	c9                   	leave
+    1fcd:	c3                   	ret
@@ -0,0 +1,2332 @@
+
+out/user/_swaptest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <fillpage>:
+
+// Fill page i of a test: even pages repeat a short pattern, which the
+// compressed pool takes, odd pages are noise that has to go to disk.
+void
+fillpage(uint *p, int i, int seed)
+{
+       0:	55                   	push   %rbp
+       1:	48 89 e5             	mov    %rsp,%rbp
+       4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+       8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+       b:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  uint x = i * 2654435761U + seed;
+       e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      11:	69 d0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%edx
+      17:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      1a:	01 d0                	add    %edx,%eax
+      1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+      1f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+      26:	eb 7c                	jmp    a4 <fillpage+0xa4>
+    if(i % 2 == 0){
+      28:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      2b:	83 e0 01             	and    $0x1,%eax
+      2e:	85 c0                	test   %eax,%eax
+      30:	75 44                	jne    76 <fillpage+0x76>
+      p[k] = (k % 16 == 0) ? i + seed : k % 16;
+      32:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      35:	83 e0 0f             	and    $0xf,%eax
+      38:	85 c0                	test   %eax,%eax
+      3a:	75 0c                	jne    48 <fillpage+0x48>
+      3c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+      3f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      42:	01 d0                	add    %edx,%eax
+      44:	89 c1                	mov    %eax,%ecx
+      46:	eb 16                	jmp    5e <fillpage+0x5e>
+      48:	8b 55 f8             	mov    -0x8(%rbp),%edx
+      4b:	89 d0                	mov    %edx,%eax
+      4d:	c1 f8 1f             	sar    $0x1f,%eax
+      50:	c1 e8 1c             	shr    $0x1c,%eax
+      53:	01 c2                	add    %eax,%edx
+      55:	83 e2 0f             	and    $0xf,%edx
+      58:	29 c2                	sub    %eax,%edx
+      5a:	89 d0                	mov    %edx,%eax
+      5c:	89 c1                	mov    %eax,%ecx
+      5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      61:	48 98                	cltq
+      63:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      6a:	00 
+      6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      6f:	48 01 d0             	add    %rdx,%rax
+      72:	89 08                	mov    %ecx,(%rax)
+      74:	eb 2a                	jmp    a0 <fillpage+0xa0>
+    } else {
+      x = x * 1103515245 + 12345;
+      76:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      79:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+      7f:	05 39 30 00 00       	add    $0x3039,%eax
+      84:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      p[k] = x;
+      87:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      8a:	48 98                	cltq
+      8c:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+      93:	00 
+      94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+      98:	48 01 c2             	add    %rax,%rdx
+      9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+      9e:	89 02                	mov    %eax,(%rdx)
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+      a0:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+      a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+      a7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+      ac:	0f 86 76 ff ff ff    	jbe    28 <fillpage+0x28>
+    }
+  }
+}
+      b2:	90                   	nop
+      b3:	90                   	nop
+      b4:	5d                   	pop    %rbp
+      b5:	c3                   	ret
+
+00000000000000b6 <checkpage>:
+
+void
+checkpage(uint *p, int i, int seed)
+{
+      b6:	55                   	push   %rbp
+      b7:	48 89 e5             	mov    %rsp,%rbp
+      ba:	48 83 ec 20          	sub    $0x20,%rsp
+      be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+      c2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+      c5:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  uint x = i * 2654435761U + seed;
+      c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      cb:	69 d0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%edx
+      d1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      d4:	01 d0                	add    %edx,%eax
+      d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  uint want;
+
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+      d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+      e0:	e9 eb 00 00 00       	jmp    1d0 <checkpage+0x11a>
+    if(i % 2 == 0){
+      e5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+      e8:	83 e0 01             	and    $0x1,%eax
+      eb:	85 c0                	test   %eax,%eax
+      ed:	75 2d                	jne    11c <checkpage+0x66>
+      want = (k % 16 == 0) ? i + seed : k % 16;
+      ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+      f2:	83 e0 0f             	and    $0xf,%eax
+      f5:	85 c0                	test   %eax,%eax
+      f7:	75 0a                	jne    103 <checkpage+0x4d>
+      f9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+      fc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+      ff:	01 d0                	add    %edx,%eax
+     101:	eb 14                	jmp    117 <checkpage+0x61>
+     103:	8b 55 f4             	mov    -0xc(%rbp),%edx
+     106:	89 d0                	mov    %edx,%eax
+     108:	c1 f8 1f             	sar    $0x1f,%eax
+     10b:	c1 e8 1c             	shr    $0x1c,%eax
+     10e:	01 c2                	add    %eax,%edx
+     110:	83 e2 0f             	and    $0xf,%edx
+     113:	29 c2                	sub    %eax,%edx
+     115:	89 d0                	mov    %edx,%eax
+     117:	89 45 f8             	mov    %eax,-0x8(%rbp)
+     11a:	eb 17                	jmp    133 <checkpage+0x7d>
+    } else {
+      x = x * 1103515245 + 12345;
+     11c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     11f:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+     125:	05 39 30 00 00       	add    $0x3039,%eax
+     12a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      want = x;
+     12d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     130:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    }
+    if(p[k] != want)
+     133:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     136:	48 98                	cltq
+     138:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     13f:	00 
+     140:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     144:	48 01 d0             	add    %rdx,%rax
+     147:	8b 00                	mov    (%rax),%eax
+     149:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     14c:	74 7e                	je     1cc <checkpage+0x116>
+      error("page %d word %d is %x, not %x", i, k, p[k], want);
+     14e:	8b 05 ac 1a 00 00    	mov    0x1aac(%rip),%eax        # 1c00 <stdout>
+     154:	ba 35 00 00 00       	mov    $0x35,%edx
+     159:	48 8d 0d b0 15 00 00 	lea    0x15b0(%rip),%rcx        # 1710 <malloc+0x180>
+     160:	48 89 ce             	mov    %rcx,%rsi
+     163:	89 c7                	mov    %eax,%edi
+     165:	b8 00 00 00 00       	mov    $0x0,%eax
+     16a:	e8 9f 0b 00 00       	call   d0e <printf>
+     16f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     172:	48 98                	cltq
+     174:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+     17b:	00 
+     17c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+     180:	48 01 d0             	add    %rdx,%rax
+     183:	8b 30                	mov    (%rax),%esi
+     185:	8b 05 75 1a 00 00    	mov    0x1a75(%rip),%eax        # 1c00 <stdout>
+     18b:	8b 7d f8             	mov    -0x8(%rbp),%edi
+     18e:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+     191:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     194:	41 89 f9             	mov    %edi,%r9d
+     197:	41 89 f0             	mov    %esi,%r8d
+     19a:	48 8d 35 81 15 00 00 	lea    0x1581(%rip),%rsi        # 1722 <malloc+0x192>
+     1a1:	89 c7                	mov    %eax,%edi
+     1a3:	b8 00 00 00 00       	mov    $0x0,%eax
+     1a8:	e8 61 0b 00 00       	call   d0e <printf>
+     1ad:	8b 05 4d 1a 00 00    	mov    0x1a4d(%rip),%eax        # 1c00 <stdout>
+     1b3:	48 8d 15 86 15 00 00 	lea    0x1586(%rip),%rdx        # 1740 <malloc+0x1b0>
+     1ba:	48 89 d6             	mov    %rdx,%rsi
+     1bd:	89 c7                	mov    %eax,%edi
+     1bf:	b8 00 00 00 00       	mov    $0x0,%eax
+     1c4:	e8 45 0b 00 00       	call   d0e <printf>
+     1c9:	90                   	nop
+     1ca:	eb fd                	jmp    1c9 <checkpage+0x113>
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+     1cc:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+     1d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     1d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+     1d8:	0f 86 07 ff ff ff    	jbe    e5 <checkpage+0x2f>
+  }
+}
+     1de:	90                   	nop
+     1df:	90                   	nop
+     1e0:	c9                   	leave
+     1e1:	c3                   	ret
+
+00000000000001e2 <pressuretest>:
+// A heap larger than memory is swapped out and in, to the compressed
+// pool and to disk, without losing a word, and gives back every swap
+// slot when it is freed.
+void
+pressuretest(void)
+{
+     1e2:	55                   	push   %rbp
+     1e3:	48 89 e5             	mov    %rsp,%rbp
+     1e6:	48 83 ec 40          	sub    $0x40,%rsp
+  struct sys_info info1, info2;
+  char *start;
+  int i;
+
+  printf(stdout, "pressuretest\n");
+     1ea:	8b 05 10 1a 00 00    	mov    0x1a10(%rip),%eax        # 1c00 <stdout>
+     1f0:	48 8d 15 4b 15 00 00 	lea    0x154b(%rip),%rdx        # 1742 <malloc+0x1b2>
+     1f7:	48 89 d6             	mov    %rdx,%rsi
+     1fa:	89 c7                	mov    %eax,%edi
+     1fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     201:	e8 08 0b 00 00       	call   d0e <printf>
+  sysinfo(&info1);
+     206:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     20a:	48 89 c7             	mov    %rax,%rdi
+     20d:	e8 43 11 00 00       	call   1355 <sysinfo>
+  start = sbrk(NPAGES * PGSIZE);
+     212:	bf 00 80 38 01       	mov    $0x1388000,%edi
+     217:	e8 21 11 00 00       	call   133d <sbrk>
+     21c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(start == (char*)-1)
+     220:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     225:	75 61                	jne    288 <pressuretest+0xa6>
+    error("sbrk of %d pages failed", NPAGES);
+     227:	8b 05 d3 19 00 00    	mov    0x19d3(%rip),%eax        # 1c00 <stdout>
+     22d:	ba 47 00 00 00       	mov    $0x47,%edx
+     232:	48 8d 0d d7 14 00 00 	lea    0x14d7(%rip),%rcx        # 1710 <malloc+0x180>
+     239:	48 89 ce             	mov    %rcx,%rsi
+     23c:	89 c7                	mov    %eax,%edi
+     23e:	b8 00 00 00 00       	mov    $0x0,%eax
+     243:	e8 c6 0a 00 00       	call   d0e <printf>
+     248:	8b 05 b2 19 00 00    	mov    0x19b2(%rip),%eax        # 1c00 <stdout>
+     24e:	ba 88 13 00 00       	mov    $0x1388,%edx
+     253:	48 8d 0d f6 14 00 00 	lea    0x14f6(%rip),%rcx        # 1750 <malloc+0x1c0>
+     25a:	48 89 ce             	mov    %rcx,%rsi
+     25d:	89 c7                	mov    %eax,%edi
+     25f:	b8 00 00 00 00       	mov    $0x0,%eax
+     264:	e8 a5 0a 00 00       	call   d0e <printf>
+     269:	8b 05 91 19 00 00    	mov    0x1991(%rip),%eax        # 1c00 <stdout>
+     26f:	48 8d 15 ca 14 00 00 	lea    0x14ca(%rip),%rdx        # 1740 <malloc+0x1b0>
+     276:	48 89 d6             	mov    %rdx,%rsi
+     279:	89 c7                	mov    %eax,%edi
+     27b:	b8 00 00 00 00       	mov    $0x0,%eax
+     280:	e8 89 0a 00 00       	call   d0e <printf>
+     285:	90                   	nop
+     286:	eb fd                	jmp    285 <pressuretest+0xa3>
+  for(i = 0; i < NPAGES; i++)
+     288:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     28f:	eb 27                	jmp    2b8 <pressuretest+0xd6>
+    fillpage((uint*)(start + i * PGSIZE), i, 1);
+     291:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     294:	c1 e0 0c             	shl    $0xc,%eax
+     297:	48 63 d0             	movslq %eax,%rdx
+     29a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     29e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     2a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     2a5:	ba 01 00 00 00       	mov    $0x1,%edx
+     2aa:	89 c6                	mov    %eax,%esi
+     2ac:	48 89 cf             	mov    %rcx,%rdi
+     2af:	e8 4c fd ff ff       	call   0 <fillpage>
+  for(i = 0; i < NPAGES; i++)
+     2b4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     2b8:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     2bf:	7e d0                	jle    291 <pressuretest+0xaf>
+
+  sysinfo(&info2);
+     2c1:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+     2c5:	48 89 c7             	mov    %rax,%rdi
+     2c8:	e8 88 10 00 00       	call   1355 <sysinfo>
+  if(info2.pages_in_swap == 0)
+     2cd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     2d0:	85 c0                	test   %eax,%eax
+     2d2:	75 61                	jne    335 <pressuretest+0x153>
+    error("%d pages allocated and none in swap", NPAGES);
+     2d4:	8b 05 26 19 00 00    	mov    0x1926(%rip),%eax        # 1c00 <stdout>
+     2da:	ba 4d 00 00 00       	mov    $0x4d,%edx
+     2df:	48 8d 0d 2a 14 00 00 	lea    0x142a(%rip),%rcx        # 1710 <malloc+0x180>
+     2e6:	48 89 ce             	mov    %rcx,%rsi
+     2e9:	89 c7                	mov    %eax,%edi
+     2eb:	b8 00 00 00 00       	mov    $0x0,%eax
+     2f0:	e8 19 0a 00 00       	call   d0e <printf>
+     2f5:	8b 05 05 19 00 00    	mov    0x1905(%rip),%eax        # 1c00 <stdout>
+     2fb:	ba 88 13 00 00       	mov    $0x1388,%edx
+     300:	48 8d 0d 61 14 00 00 	lea    0x1461(%rip),%rcx        # 1768 <malloc+0x1d8>
+     307:	48 89 ce             	mov    %rcx,%rsi
+     30a:	89 c7                	mov    %eax,%edi
+     30c:	b8 00 00 00 00       	mov    $0x0,%eax
+     311:	e8 f8 09 00 00       	call   d0e <printf>
+     316:	8b 05 e4 18 00 00    	mov    0x18e4(%rip),%eax        # 1c00 <stdout>
+     31c:	48 8d 15 1d 14 00 00 	lea    0x141d(%rip),%rdx        # 1740 <malloc+0x1b0>
+     323:	48 89 d6             	mov    %rdx,%rsi
+     326:	89 c7                	mov    %eax,%edi
+     328:	b8 00 00 00 00       	mov    $0x0,%eax
+     32d:	e8 dc 09 00 00       	call   d0e <printf>
+     332:	90                   	nop
+     333:	eb fd                	jmp    332 <pressuretest+0x150>
+  printf(stdout, "%d pages in swap\n", info2.pages_in_swap);
+     335:	8b 55 cc             	mov    -0x34(%rbp),%edx
+     338:	8b 05 c2 18 00 00    	mov    0x18c2(%rip),%eax        # 1c00 <stdout>
+     33e:	48 8d 0d 47 14 00 00 	lea    0x1447(%rip),%rcx        # 178c <malloc+0x1fc>
+     345:	48 89 ce             	mov    %rcx,%rsi
+     348:	89 c7                	mov    %eax,%edi
+     34a:	b8 00 00 00 00       	mov    $0x0,%eax
+     34f:	e8 ba 09 00 00       	call   d0e <printf>
+
+  // in order, which read-ahead helps, then backwards
+  for(i = 0; i < NPAGES; i++)
+     354:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     35b:	eb 27                	jmp    384 <pressuretest+0x1a2>
+    checkpage((uint*)(start + i * PGSIZE), i, 1);
+     35d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     360:	c1 e0 0c             	shl    $0xc,%eax
+     363:	48 63 d0             	movslq %eax,%rdx
+     366:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     36a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     36e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     371:	ba 01 00 00 00       	mov    $0x1,%edx
+     376:	89 c6                	mov    %eax,%esi
+     378:	48 89 cf             	mov    %rcx,%rdi
+     37b:	e8 36 fd ff ff       	call   b6 <checkpage>
+  for(i = 0; i < NPAGES; i++)
+     380:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     384:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     38b:	7e d0                	jle    35d <pressuretest+0x17b>
+  for(i = NPAGES - 1; i >= 0; i--)
+     38d:	c7 45 fc 87 13 00 00 	movl   $0x1387,-0x4(%rbp)
+     394:	eb 27                	jmp    3bd <pressuretest+0x1db>
+    checkpage((uint*)(start + i * PGSIZE), i, 1);
+     396:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     399:	c1 e0 0c             	shl    $0xc,%eax
+     39c:	48 63 d0             	movslq %eax,%rdx
+     39f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     3a3:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     3a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     3aa:	ba 01 00 00 00       	mov    $0x1,%edx
+     3af:	89 c6                	mov    %eax,%esi
+     3b1:	48 89 cf             	mov    %rcx,%rdi
+     3b4:	e8 fd fc ff ff       	call   b6 <checkpage>
+  for(i = NPAGES - 1; i >= 0; i--)
+     3b9:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     3bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     3c1:	79 d3                	jns    396 <pressuretest+0x1b4>
+
+  sbrk(-NPAGES * PGSIZE);
+     3c3:	bf 00 80 c7 fe       	mov    $0xfec78000,%edi
+     3c8:	e8 70 0f 00 00       	call   133d <sbrk>
+  sysinfo(&info2);
+     3cd:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+     3d1:	48 89 c7             	mov    %rax,%rdi
+     3d4:	e8 7c 0f 00 00       	call   1355 <sysinfo>
+  if(info2.pages_in_swap > info1.pages_in_swap)
+     3d9:	8b 55 cc             	mov    -0x34(%rbp),%edx
+     3dc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+     3df:	39 c2                	cmp    %eax,%edx
+     3e1:	7e 5f                	jle    442 <pressuretest+0x260>
+    error("%d pages still in swap after the heap is freed, %d before",
+     3e3:	8b 05 17 18 00 00    	mov    0x1817(%rip),%eax        # 1c00 <stdout>
+     3e9:	ba 59 00 00 00       	mov    $0x59,%edx
+     3ee:	48 8d 0d 1b 13 00 00 	lea    0x131b(%rip),%rcx        # 1710 <malloc+0x180>
+     3f5:	48 89 ce             	mov    %rcx,%rsi
+     3f8:	89 c7                	mov    %eax,%edi
+     3fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     3ff:	e8 0a 09 00 00       	call   d0e <printf>
+     404:	8b 4d e0             	mov    -0x20(%rbp),%ecx
+     407:	8b 55 cc             	mov    -0x34(%rbp),%edx
+     40a:	8b 05 f0 17 00 00    	mov    0x17f0(%rip),%eax        # 1c00 <stdout>
+     410:	48 8d 35 89 13 00 00 	lea    0x1389(%rip),%rsi        # 17a0 <malloc+0x210>
+     417:	89 c7                	mov    %eax,%edi
+     419:	b8 00 00 00 00       	mov    $0x0,%eax
+     41e:	e8 eb 08 00 00       	call   d0e <printf>
+     423:	8b 05 d7 17 00 00    	mov    0x17d7(%rip),%eax        # 1c00 <stdout>
+     429:	48 8d 15 10 13 00 00 	lea    0x1310(%rip),%rdx        # 1740 <malloc+0x1b0>
+     430:	48 89 d6             	mov    %rdx,%rsi
+     433:	89 c7                	mov    %eax,%edi
+     435:	b8 00 00 00 00       	mov    $0x0,%eax
+     43a:	e8 cf 08 00 00       	call   d0e <printf>
+     43f:	90                   	nop
+     440:	eb fd                	jmp    43f <pressuretest+0x25d>
+          info2.pages_in_swap, info1.pages_in_swap);
+  printf(stdout, "pressuretest OK\n");
+     442:	8b 05 b8 17 00 00    	mov    0x17b8(%rip),%eax        # 1c00 <stdout>
+     448:	48 8d 15 8b 13 00 00 	lea    0x138b(%rip),%rdx        # 17da <malloc+0x24a>
+     44f:	48 89 d6             	mov    %rdx,%rsi
+     452:	89 c7                	mov    %eax,%edi
+     454:	b8 00 00 00 00       	mov    $0x0,%eax
+     459:	e8 b0 08 00 00       	call   d0e <printf>
+}
+     45e:	90                   	nop
+     45f:	c9                   	leave
+     460:	c3                   	ret
+
+0000000000000461 <kswapdtest>:
+
+// The reclaim thread keeps some memory free after the pressure is
+// over, so allocations do not have to reclaim it themselves.
+void
+kswapdtest(void)
+{
+     461:	55                   	push   %rbp
+     462:	48 89 e5             	mov    %rsp,%rbp
+     465:	48 83 ec 30          	sub    $0x30,%rsp
+  struct sys_info info;
+  char *start;
+  int i;
+
+  printf(stdout, "kswapdtest\n");
+     469:	8b 05 91 17 00 00    	mov    0x1791(%rip),%eax        # 1c00 <stdout>
+     46f:	48 8d 15 75 13 00 00 	lea    0x1375(%rip),%rdx        # 17eb <malloc+0x25b>
+     476:	48 89 d6             	mov    %rdx,%rsi
+     479:	89 c7                	mov    %eax,%edi
+     47b:	b8 00 00 00 00       	mov    $0x0,%eax
+     480:	e8 89 08 00 00       	call   d0e <printf>
+  start = sbrk(NPAGES * PGSIZE);
+     485:	bf 00 80 38 01       	mov    $0x1388000,%edi
+     48a:	e8 ae 0e 00 00       	call   133d <sbrk>
+     48f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(start == (char*)-1)
+     493:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     498:	75 61                	jne    4fb <kswapdtest+0x9a>
+    error("sbrk of %d pages failed", NPAGES);
+     49a:	8b 05 60 17 00 00    	mov    0x1760(%rip),%eax        # 1c00 <stdout>
+     4a0:	ba 6a 00 00 00       	mov    $0x6a,%edx
+     4a5:	48 8d 0d 64 12 00 00 	lea    0x1264(%rip),%rcx        # 1710 <malloc+0x180>
+     4ac:	48 89 ce             	mov    %rcx,%rsi
+     4af:	89 c7                	mov    %eax,%edi
+     4b1:	b8 00 00 00 00       	mov    $0x0,%eax
+     4b6:	e8 53 08 00 00       	call   d0e <printf>
+     4bb:	8b 05 3f 17 00 00    	mov    0x173f(%rip),%eax        # 1c00 <stdout>
+     4c1:	ba 88 13 00 00       	mov    $0x1388,%edx
+     4c6:	48 8d 0d 83 12 00 00 	lea    0x1283(%rip),%rcx        # 1750 <malloc+0x1c0>
+     4cd:	48 89 ce             	mov    %rcx,%rsi
+     4d0:	89 c7                	mov    %eax,%edi
+     4d2:	b8 00 00 00 00       	mov    $0x0,%eax
+     4d7:	e8 32 08 00 00       	call   d0e <printf>
+     4dc:	8b 05 1e 17 00 00    	mov    0x171e(%rip),%eax        # 1c00 <stdout>
+     4e2:	48 8d 15 57 12 00 00 	lea    0x1257(%rip),%rdx        # 1740 <malloc+0x1b0>
+     4e9:	48 89 d6             	mov    %rdx,%rsi
+     4ec:	89 c7                	mov    %eax,%edi
+     4ee:	b8 00 00 00 00       	mov    $0x0,%eax
+     4f3:	e8 16 08 00 00       	call   d0e <printf>
+     4f8:	90                   	nop
+     4f9:	eb fd                	jmp    4f8 <kswapdtest+0x97>
+  for(i = 0; i < NPAGES; i++)
+     4fb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     502:	eb 27                	jmp    52b <kswapdtest+0xca>
+    memset(start + i * PGSIZE, i, PGSIZE);
+     504:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     507:	c1 e0 0c             	shl    $0xc,%eax
+     50a:	48 63 d0             	movslq %eax,%rdx
+     50d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     511:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     515:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     518:	ba 00 10 00 00       	mov    $0x1000,%edx
+     51d:	89 c6                	mov    %eax,%esi
+     51f:	48 89 cf             	mov    %rcx,%rdi
+     522:	e8 a5 0b 00 00       	call   10cc <memset>
+  for(i = 0; i < NPAGES; i++)
+     527:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     52b:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     532:	7e d0                	jle    504 <kswapdtest+0xa3>
+  sleep(20);
+     534:	bf 14 00 00 00       	mov    $0x14,%edi
+     539:	e8 07 0e 00 00       	call   1345 <sleep>
+  sysinfo(&info);
+     53e:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+     542:	48 89 c7             	mov    %rax,%rdi
+     545:	e8 0b 0e 00 00       	call   1355 <sysinfo>
+  if(info.free_pages < 16)
+     54a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+     54d:	83 f8 0f             	cmp    $0xf,%eax
+     550:	7f 5f                	jg     5b1 <kswapdtest+0x150>
+    error("only %d pages free with the heap idle", info.free_pages);
+     552:	8b 05 a8 16 00 00    	mov    0x16a8(%rip),%eax        # 1c00 <stdout>
+     558:	ba 70 00 00 00       	mov    $0x70,%edx
+     55d:	48 8d 0d ac 11 00 00 	lea    0x11ac(%rip),%rcx        # 1710 <malloc+0x180>
+     564:	48 89 ce             	mov    %rcx,%rsi
+     567:	89 c7                	mov    %eax,%edi
+     569:	b8 00 00 00 00       	mov    $0x0,%eax
+     56e:	e8 9b 07 00 00       	call   d0e <printf>
+     573:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+     576:	8b 05 84 16 00 00    	mov    0x1684(%rip),%eax        # 1c00 <stdout>
+     57c:	48 8d 0d 75 12 00 00 	lea    0x1275(%rip),%rcx        # 17f8 <malloc+0x268>
+     583:	48 89 ce             	mov    %rcx,%rsi
+     586:	89 c7                	mov    %eax,%edi
+     588:	b8 00 00 00 00       	mov    $0x0,%eax
+     58d:	e8 7c 07 00 00       	call   d0e <printf>
+     592:	8b 05 68 16 00 00    	mov    0x1668(%rip),%eax        # 1c00 <stdout>
+     598:	48 8d 15 a1 11 00 00 	lea    0x11a1(%rip),%rdx        # 1740 <malloc+0x1b0>
+     59f:	48 89 d6             	mov    %rdx,%rsi
+     5a2:	89 c7                	mov    %eax,%edi
+     5a4:	b8 00 00 00 00       	mov    $0x0,%eax
+     5a9:	e8 60 07 00 00       	call   d0e <printf>
+     5ae:	90                   	nop
+     5af:	eb fd                	jmp    5ae <kswapdtest+0x14d>
+  for(i = 0; i < NPAGES; i++)
+     5b1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     5b8:	e9 9d 00 00 00       	jmp    65a <kswapdtest+0x1f9>
+    if(start[i * PGSIZE] != (char)i || start[i * PGSIZE + PGSIZE - 1] != (char)i)
+     5bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5c0:	c1 e0 0c             	shl    $0xc,%eax
+     5c3:	48 63 d0             	movslq %eax,%rdx
+     5c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ca:	48 01 d0             	add    %rdx,%rax
+     5cd:	0f b6 00             	movzbl (%rax),%eax
+     5d0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5d3:	38 d0                	cmp    %dl,%al
+     5d5:	75 20                	jne    5f7 <kswapdtest+0x196>
+     5d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     5da:	83 c0 01             	add    $0x1,%eax
+     5dd:	c1 e0 0c             	shl    $0xc,%eax
+     5e0:	48 98                	cltq
+     5e2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+     5e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     5ea:	48 01 d0             	add    %rdx,%rax
+     5ed:	0f b6 00             	movzbl (%rax),%eax
+     5f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     5f3:	38 d0                	cmp    %dl,%al
+     5f5:	74 5f                	je     656 <kswapdtest+0x1f5>
+      error("page %d is wrong", i);
+     5f7:	8b 05 03 16 00 00    	mov    0x1603(%rip),%eax        # 1c00 <stdout>
+     5fd:	ba 73 00 00 00       	mov    $0x73,%edx
+     602:	48 8d 0d 07 11 00 00 	lea    0x1107(%rip),%rcx        # 1710 <malloc+0x180>
+     609:	48 89 ce             	mov    %rcx,%rsi
+     60c:	89 c7                	mov    %eax,%edi
+     60e:	b8 00 00 00 00       	mov    $0x0,%eax
+     613:	e8 f6 06 00 00       	call   d0e <printf>
+     618:	8b 05 e2 15 00 00    	mov    0x15e2(%rip),%eax        # 1c00 <stdout>
+     61e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+     621:	48 8d 0d f6 11 00 00 	lea    0x11f6(%rip),%rcx        # 181e <malloc+0x28e>
+     628:	48 89 ce             	mov    %rcx,%rsi
+     62b:	89 c7                	mov    %eax,%edi
+     62d:	b8 00 00 00 00       	mov    $0x0,%eax
+     632:	e8 d7 06 00 00       	call   d0e <printf>
+     637:	8b 05 c3 15 00 00    	mov    0x15c3(%rip),%eax        # 1c00 <stdout>
+     63d:	48 8d 15 fc 10 00 00 	lea    0x10fc(%rip),%rdx        # 1740 <malloc+0x1b0>
+     644:	48 89 d6             	mov    %rdx,%rsi
+     647:	89 c7                	mov    %eax,%edi
+     649:	b8 00 00 00 00       	mov    $0x0,%eax
+     64e:	e8 bb 06 00 00       	call   d0e <printf>
+     653:	90                   	nop
+     654:	eb fd                	jmp    653 <kswapdtest+0x1f2>
+  for(i = 0; i < NPAGES; i++)
+     656:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     65a:	81 7d fc 87 13 00 00 	cmpl   $0x1387,-0x4(%rbp)
+     661:	0f 8e 56 ff ff ff    	jle    5bd <kswapdtest+0x15c>
+  sbrk(-NPAGES * PGSIZE);
+     667:	bf 00 80 c7 fe       	mov    $0xfec78000,%edi
+     66c:	e8 cc 0c 00 00       	call   133d <sbrk>
+  printf(stdout, "kswapdtest OK\n");
+     671:	8b 05 89 15 00 00    	mov    0x1589(%rip),%eax        # 1c00 <stdout>
+     677:	48 8d 15 b1 11 00 00 	lea    0x11b1(%rip),%rdx        # 182f <malloc+0x29f>
+     67e:	48 89 d6             	mov    %rdx,%rsi
+     681:	89 c7                	mov    %eax,%edi
+     683:	b8 00 00 00 00       	mov    $0x0,%eax
+     688:	e8 81 06 00 00       	call   d0e <printf>
+}
+     68d:	90                   	nop
+     68e:	c9                   	leave
+     68f:	c3                   	ret
+
+0000000000000690 <sharetest>:
+// slot another is reading in. Each page is read from swap once and
+// shared from the swap cache, and every child sees the right data.
+// Then they write to them, which must not reach anyone else.
+void
+sharetest(void)
+{
+     690:	55                   	push   %rbp
+     691:	48 89 e5             	mov    %rsp,%rbp
+     694:	48 83 ec 50          	sub    $0x50,%rsp
+  struct sys_info info1, info2;
+  char *start, *own;
+  int i, c, pid;
+
+  printf(stdout, "sharetest\n");
+     698:	8b 05 62 15 00 00    	mov    0x1562(%rip),%eax        # 1c00 <stdout>
+     69e:	48 8d 15 99 11 00 00 	lea    0x1199(%rip),%rdx        # 183e <malloc+0x2ae>
+     6a5:	48 89 d6             	mov    %rdx,%rsi
+     6a8:	89 c7                	mov    %eax,%edi
+     6aa:	b8 00 00 00 00       	mov    $0x0,%eax
+     6af:	e8 5a 06 00 00       	call   d0e <printf>
+  sysinfo(&info1);
+     6b4:	48 8d 45 cc          	lea    -0x34(%rbp),%rax
+     6b8:	48 89 c7             	mov    %rax,%rdi
+     6bb:	e8 95 0c 00 00       	call   1355 <sysinfo>
+  start = sbrk(NSHARE * PGSIZE);
+     6c0:	bf 00 40 9c 00       	mov    $0x9c4000,%edi
+     6c5:	e8 73 0c 00 00       	call   133d <sbrk>
+     6ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(start == (char*)-1)
+     6ce:	48 83 7d f0 ff       	cmpq   $0xffffffffffffffff,-0x10(%rbp)
+     6d3:	75 61                	jne    736 <sharetest+0xa6>
+    error("sbrk of %d pages failed", NSHARE);
+     6d5:	8b 05 25 15 00 00    	mov    0x1525(%rip),%eax        # 1c00 <stdout>
+     6db:	ba 88 00 00 00       	mov    $0x88,%edx
+     6e0:	48 8d 0d 29 10 00 00 	lea    0x1029(%rip),%rcx        # 1710 <malloc+0x180>
+     6e7:	48 89 ce             	mov    %rcx,%rsi
+     6ea:	89 c7                	mov    %eax,%edi
+     6ec:	b8 00 00 00 00       	mov    $0x0,%eax
+     6f1:	e8 18 06 00 00       	call   d0e <printf>
+     6f6:	8b 05 04 15 00 00    	mov    0x1504(%rip),%eax        # 1c00 <stdout>
+     6fc:	ba c4 09 00 00       	mov    $0x9c4,%edx
+     701:	48 8d 0d 48 10 00 00 	lea    0x1048(%rip),%rcx        # 1750 <malloc+0x1c0>
+     708:	48 89 ce             	mov    %rcx,%rsi
+     70b:	89 c7                	mov    %eax,%edi
+     70d:	b8 00 00 00 00       	mov    $0x0,%eax
+     712:	e8 f7 05 00 00       	call   d0e <printf>
+     717:	8b 05 e3 14 00 00    	mov    0x14e3(%rip),%eax        # 1c00 <stdout>
+     71d:	48 8d 15 1c 10 00 00 	lea    0x101c(%rip),%rdx        # 1740 <malloc+0x1b0>
+     724:	48 89 d6             	mov    %rdx,%rsi
+     727:	89 c7                	mov    %eax,%edi
+     729:	b8 00 00 00 00       	mov    $0x0,%eax
+     72e:	e8 db 05 00 00       	call   d0e <printf>
+     733:	90                   	nop
+     734:	eb fd                	jmp    733 <sharetest+0xa3>
+  for(i = 0; i < NSHARE; i++)
+     736:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     73d:	eb 27                	jmp    766 <sharetest+0xd6>
+    fillpage((uint*)(start + i * PGSIZE), i, 2);
+     73f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     742:	c1 e0 0c             	shl    $0xc,%eax
+     745:	48 63 d0             	movslq %eax,%rdx
+     748:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     74c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     750:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     753:	ba 02 00 00 00       	mov    $0x2,%edx
+     758:	89 c6                	mov    %eax,%esi
+     75a:	48 89 cf             	mov    %rcx,%rdi
+     75d:	e8 9e f8 ff ff       	call   0 <fillpage>
+  for(i = 0; i < NSHARE; i++)
+     762:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     766:	81 7d fc c3 09 00 00 	cmpl   $0x9c3,-0x4(%rbp)
+     76d:	7e d0                	jle    73f <sharetest+0xaf>
+
+  for(c = 0; c < NCHILD; c++){
+     76f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     776:	e9 99 02 00 00       	jmp    a14 <sharetest+0x384>
+    if((pid = fork()) < 0)
+     77b:	e8 2d 0b 00 00       	call   12ad <fork>
+     780:	89 45 ec             	mov    %eax,-0x14(%rbp)
+     783:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     787:	79 5c                	jns    7e5 <sharetest+0x155>
+      error("fork failed");
+     789:	8b 05 71 14 00 00    	mov    0x1471(%rip),%eax        # 1c00 <stdout>
+     78f:	ba 8e 00 00 00       	mov    $0x8e,%edx
+     794:	48 8d 0d 75 0f 00 00 	lea    0xf75(%rip),%rcx        # 1710 <malloc+0x180>
+     79b:	48 89 ce             	mov    %rcx,%rsi
+     79e:	89 c7                	mov    %eax,%edi
+     7a0:	b8 00 00 00 00       	mov    $0x0,%eax
+     7a5:	e8 64 05 00 00       	call   d0e <printf>
+     7aa:	8b 05 50 14 00 00    	mov    0x1450(%rip),%eax        # 1c00 <stdout>
+     7b0:	48 8d 15 92 10 00 00 	lea    0x1092(%rip),%rdx        # 1849 <malloc+0x2b9>
+     7b7:	48 89 d6             	mov    %rdx,%rsi
+     7ba:	89 c7                	mov    %eax,%edi
+     7bc:	b8 00 00 00 00       	mov    $0x0,%eax
+     7c1:	e8 48 05 00 00       	call   d0e <printf>
+     7c6:	8b 05 34 14 00 00    	mov    0x1434(%rip),%eax        # 1c00 <stdout>
+     7cc:	48 8d 15 6d 0f 00 00 	lea    0xf6d(%rip),%rdx        # 1740 <malloc+0x1b0>
+     7d3:	48 89 d6             	mov    %rdx,%rsi
+     7d6:	89 c7                	mov    %eax,%edi
+     7d8:	b8 00 00 00 00       	mov    $0x0,%eax
+     7dd:	e8 2c 05 00 00       	call   d0e <printf>
+     7e2:	90                   	nop
+     7e3:	eb fd                	jmp    7e2 <sharetest+0x152>
+    if(pid == 0){
+     7e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+     7e9:	0f 85 21 02 00 00    	jne    a10 <sharetest+0x380>
+      // push some of the shared pages out with a heap of our own
+      own = sbrk(NSHARE / 2 * PGSIZE);
+     7ef:	bf 00 20 4e 00       	mov    $0x4e2000,%edi
+     7f4:	e8 44 0b 00 00       	call   133d <sbrk>
+     7f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      if(own == (char*)-1)
+     7fd:	48 83 7d e0 ff       	cmpq   $0xffffffffffffffff,-0x20(%rbp)
+     802:	75 5f                	jne    863 <sharetest+0x1d3>
+        error("child %d: sbrk failed", c);
+     804:	8b 05 f6 13 00 00    	mov    0x13f6(%rip),%eax        # 1c00 <stdout>
+     80a:	ba 93 00 00 00       	mov    $0x93,%edx
+     80f:	48 8d 0d fa 0e 00 00 	lea    0xefa(%rip),%rcx        # 1710 <malloc+0x180>
+     816:	48 89 ce             	mov    %rcx,%rsi
+     819:	89 c7                	mov    %eax,%edi
+     81b:	b8 00 00 00 00       	mov    $0x0,%eax
+     820:	e8 e9 04 00 00       	call   d0e <printf>
+     825:	8b 05 d5 13 00 00    	mov    0x13d5(%rip),%eax        # 1c00 <stdout>
+     82b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     82e:	48 8d 0d 20 10 00 00 	lea    0x1020(%rip),%rcx        # 1855 <malloc+0x2c5>
+     835:	48 89 ce             	mov    %rcx,%rsi
+     838:	89 c7                	mov    %eax,%edi
+     83a:	b8 00 00 00 00       	mov    $0x0,%eax
+     83f:	e8 ca 04 00 00       	call   d0e <printf>
+     844:	8b 05 b6 13 00 00    	mov    0x13b6(%rip),%eax        # 1c00 <stdout>
+     84a:	48 8d 15 ef 0e 00 00 	lea    0xeef(%rip),%rdx        # 1740 <malloc+0x1b0>
+     851:	48 89 d6             	mov    %rdx,%rsi
+     854:	89 c7                	mov    %eax,%edi
+     856:	b8 00 00 00 00       	mov    $0x0,%eax
+     85b:	e8 ae 04 00 00       	call   d0e <printf>
+     860:	90                   	nop
+     861:	eb fd                	jmp    860 <sharetest+0x1d0>
+      for(i = 0; i < NSHARE / 2; i++)
+     863:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     86a:	eb 27                	jmp    893 <sharetest+0x203>
+        memset(own + i * PGSIZE, c, PGSIZE);
+     86c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     86f:	c1 e0 0c             	shl    $0xc,%eax
+     872:	48 63 d0             	movslq %eax,%rdx
+     875:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     879:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     87d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     880:	ba 00 10 00 00       	mov    $0x1000,%edx
+     885:	89 c6                	mov    %eax,%esi
+     887:	48 89 cf             	mov    %rcx,%rdi
+     88a:	e8 3d 08 00 00       	call   10cc <memset>
+      for(i = 0; i < NSHARE / 2; i++)
+     88f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     893:	81 7d fc e1 04 00 00 	cmpl   $0x4e1,-0x4(%rbp)
+     89a:	7e d0                	jle    86c <sharetest+0x1dc>
+      for(i = 0; i < NSHARE; i++)
+     89c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     8a3:	eb 27                	jmp    8cc <sharetest+0x23c>
+        checkpage((uint*)(start + i * PGSIZE), i, 2);
+     8a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8a8:	c1 e0 0c             	shl    $0xc,%eax
+     8ab:	48 63 d0             	movslq %eax,%rdx
+     8ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8b2:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     8b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8b9:	ba 02 00 00 00       	mov    $0x2,%edx
+     8be:	89 c6                	mov    %eax,%esi
+     8c0:	48 89 cf             	mov    %rcx,%rdi
+     8c3:	e8 ee f7 ff ff       	call   b6 <checkpage>
+      for(i = 0; i < NSHARE; i++)
+     8c8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     8cc:	81 7d fc c3 09 00 00 	cmpl   $0x9c3,-0x4(%rbp)
+     8d3:	7e d0                	jle    8a5 <sharetest+0x215>
+      for(i = c; i < NSHARE; i += NCHILD)
+     8d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+     8db:	eb 27                	jmp    904 <sharetest+0x274>
+        fillpage((uint*)(start + i * PGSIZE), i, 3 + c);
+     8dd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     8e0:	8d 50 03             	lea    0x3(%rax),%edx
+     8e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8e6:	c1 e0 0c             	shl    $0xc,%eax
+     8e9:	48 63 c8             	movslq %eax,%rcx
+     8ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     8f0:	48 01 c1             	add    %rax,%rcx
+     8f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     8f6:	89 c6                	mov    %eax,%esi
+     8f8:	48 89 cf             	mov    %rcx,%rdi
+     8fb:	e8 00 f7 ff ff       	call   0 <fillpage>
+      for(i = c; i < NSHARE; i += NCHILD)
+     900:	83 45 fc 03          	addl   $0x3,-0x4(%rbp)
+     904:	81 7d fc c3 09 00 00 	cmpl   $0x9c3,-0x4(%rbp)
+     90b:	7e d0                	jle    8dd <sharetest+0x24d>
+      for(i = 0; i < NSHARE; i++)
+     90d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     914:	eb 58                	jmp    96e <sharetest+0x2de>
+        checkpage((uint*)(start + i * PGSIZE), i, i % NCHILD == c ? 3 + c : 2);
+     916:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     919:	48 63 c1             	movslq %ecx,%rax
+     91c:	48 69 c0 56 55 55 55 	imul   $0x55555556,%rax,%rax
+     923:	48 c1 e8 20          	shr    $0x20,%rax
+     927:	48 89 c2             	mov    %rax,%rdx
+     92a:	89 c8                	mov    %ecx,%eax
+     92c:	c1 f8 1f             	sar    $0x1f,%eax
+     92f:	29 c2                	sub    %eax,%edx
+     931:	89 d0                	mov    %edx,%eax
+     933:	01 c0                	add    %eax,%eax
+     935:	01 d0                	add    %edx,%eax
+     937:	29 c1                	sub    %eax,%ecx
+     939:	89 ca                	mov    %ecx,%edx
+     93b:	39 55 f8             	cmp    %edx,-0x8(%rbp)
+     93e:	75 08                	jne    948 <sharetest+0x2b8>
+     940:	8b 45 f8             	mov    -0x8(%rbp),%eax
+     943:	8d 50 03             	lea    0x3(%rax),%edx
+     946:	eb 05                	jmp    94d <sharetest+0x2bd>
+     948:	ba 02 00 00 00       	mov    $0x2,%edx
+     94d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     950:	c1 e0 0c             	shl    $0xc,%eax
+     953:	48 63 c8             	movslq %eax,%rcx
+     956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     95a:	48 01 c1             	add    %rax,%rcx
+     95d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     960:	89 c6                	mov    %eax,%esi
+     962:	48 89 cf             	mov    %rcx,%rdi
+     965:	e8 4c f7 ff ff       	call   b6 <checkpage>
+      for(i = 0; i < NSHARE; i++)
+     96a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     96e:	81 7d fc c3 09 00 00 	cmpl   $0x9c3,-0x4(%rbp)
+     975:	7e 9f                	jle    916 <sharetest+0x286>
+      for(i = 0; i < NSHARE / 2; i++)
+     977:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     97e:	eb 7e                	jmp    9fe <sharetest+0x36e>
+        if(own[i * PGSIZE] != c)
+     980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     983:	c1 e0 0c             	shl    $0xc,%eax
+     986:	48 63 d0             	movslq %eax,%rdx
+     989:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+     98d:	48 01 d0             	add    %rdx,%rax
+     990:	0f b6 00             	movzbl (%rax),%eax
+     993:	0f be c0             	movsbl %al,%eax
+     996:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+     999:	74 5f                	je     9fa <sharetest+0x36a>
+          error("child %d: page %d of its own heap is wrong", c, i);
+     99b:	8b 05 5f 12 00 00    	mov    0x125f(%rip),%eax        # 1c00 <stdout>
+     9a1:	ba 9e 00 00 00       	mov    $0x9e,%edx
+     9a6:	48 8d 0d 63 0d 00 00 	lea    0xd63(%rip),%rcx        # 1710 <malloc+0x180>
+     9ad:	48 89 ce             	mov    %rcx,%rsi
+     9b0:	89 c7                	mov    %eax,%edi
+     9b2:	b8 00 00 00 00       	mov    $0x0,%eax
+     9b7:	e8 52 03 00 00       	call   d0e <printf>
+     9bc:	8b 05 3e 12 00 00    	mov    0x123e(%rip),%eax        # 1c00 <stdout>
+     9c2:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+     9c5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+     9c8:	48 8d 35 a1 0e 00 00 	lea    0xea1(%rip),%rsi        # 1870 <malloc+0x2e0>
+     9cf:	89 c7                	mov    %eax,%edi
+     9d1:	b8 00 00 00 00       	mov    $0x0,%eax
+     9d6:	e8 33 03 00 00       	call   d0e <printf>
+     9db:	8b 05 1f 12 00 00    	mov    0x121f(%rip),%eax        # 1c00 <stdout>
+     9e1:	48 8d 15 58 0d 00 00 	lea    0xd58(%rip),%rdx        # 1740 <malloc+0x1b0>
+     9e8:	48 89 d6             	mov    %rdx,%rsi
+     9eb:	89 c7                	mov    %eax,%edi
+     9ed:	b8 00 00 00 00       	mov    $0x0,%eax
+     9f2:	e8 17 03 00 00       	call   d0e <printf>
+     9f7:	90                   	nop
+     9f8:	eb fd                	jmp    9f7 <sharetest+0x367>
+      for(i = 0; i < NSHARE / 2; i++)
+     9fa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     9fe:	81 7d fc e1 04 00 00 	cmpl   $0x4e1,-0x4(%rbp)
+     a05:	0f 8e 75 ff ff ff    	jle    980 <sharetest+0x2f0>
+      exit();
+     a0b:	e8 a5 08 00 00       	call   12b5 <exit>
+  for(c = 0; c < NCHILD; c++){
+     a10:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     a14:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+     a18:	0f 8e 5d fd ff ff    	jle    77b <sharetest+0xeb>
+    }
+  }
+  for(c = 0; c < NCHILD; c++)
+     a1e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+     a25:	eb 09                	jmp    a30 <sharetest+0x3a0>
+    wait();
+     a27:	e8 91 08 00 00       	call   12bd <wait>
+  for(c = 0; c < NCHILD; c++)
+     a2c:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+     a30:	83 7d f8 02          	cmpl   $0x2,-0x8(%rbp)
+     a34:	7e f1                	jle    a27 <sharetest+0x397>
+
+  for(i = 0; i < NSHARE; i++)
+     a36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+     a3d:	eb 27                	jmp    a66 <sharetest+0x3d6>
+    checkpage((uint*)(start + i * PGSIZE), i, 2);
+     a3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a42:	c1 e0 0c             	shl    $0xc,%eax
+     a45:	48 63 d0             	movslq %eax,%rdx
+     a48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     a4c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+     a50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     a53:	ba 02 00 00 00       	mov    $0x2,%edx
+     a58:	89 c6                	mov    %eax,%esi
+     a5a:	48 89 cf             	mov    %rcx,%rdi
+     a5d:	e8 54 f6 ff ff       	call   b6 <checkpage>
+  for(i = 0; i < NSHARE; i++)
+     a62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+     a66:	81 7d fc c3 09 00 00 	cmpl   $0x9c3,-0x4(%rbp)
+     a6d:	7e d0                	jle    a3f <sharetest+0x3af>
+  sbrk(-NSHARE * PGSIZE);
+     a6f:	bf 00 c0 63 ff       	mov    $0xff63c000,%edi
+     a74:	e8 c4 08 00 00       	call   133d <sbrk>
+  sysinfo(&info2);
+     a79:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+     a7d:	48 89 c7             	mov    %rax,%rdi
+     a80:	e8 d0 08 00 00       	call   1355 <sysinfo>
+  if(info2.pages_in_swap > info1.pages_in_swap)
+     a85:	8b 55 bc             	mov    -0x44(%rbp),%edx
+     a88:	8b 45 d0             	mov    -0x30(%rbp),%eax
+     a8b:	39 c2                	cmp    %eax,%edx
+     a8d:	7e 5f                	jle    aee <sharetest+0x45e>
+    error("%d pages still in swap after every heap is freed, %d before",
+     a8f:	8b 05 6b 11 00 00    	mov    0x116b(%rip),%eax        # 1c00 <stdout>
+     a95:	ba aa 00 00 00       	mov    $0xaa,%edx
+     a9a:	48 8d 0d 6f 0c 00 00 	lea    0xc6f(%rip),%rcx        # 1710 <malloc+0x180>
+     aa1:	48 89 ce             	mov    %rcx,%rsi
+     aa4:	89 c7                	mov    %eax,%edi
+     aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+     aab:	e8 5e 02 00 00       	call   d0e <printf>
+     ab0:	8b 4d d0             	mov    -0x30(%rbp),%ecx
+     ab3:	8b 55 bc             	mov    -0x44(%rbp),%edx
+     ab6:	8b 05 44 11 00 00    	mov    0x1144(%rip),%eax        # 1c00 <stdout>
+     abc:	48 8d 35 dd 0d 00 00 	lea    0xddd(%rip),%rsi        # 18a0 <malloc+0x310>
+     ac3:	89 c7                	mov    %eax,%edi
+     ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+     aca:	e8 3f 02 00 00       	call   d0e <printf>
+     acf:	8b 05 2b 11 00 00    	mov    0x112b(%rip),%eax        # 1c00 <stdout>
+     ad5:	48 8d 15 64 0c 00 00 	lea    0xc64(%rip),%rdx        # 1740 <malloc+0x1b0>
+     adc:	48 89 d6             	mov    %rdx,%rsi
+     adf:	89 c7                	mov    %eax,%edi
+     ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+     ae6:	e8 23 02 00 00       	call   d0e <printf>
+     aeb:	90                   	nop
+     aec:	eb fd                	jmp    aeb <sharetest+0x45b>
+          info2.pages_in_swap, info1.pages_in_swap);
+  printf(stdout, "sharetest OK\n");
+     aee:	8b 05 0c 11 00 00    	mov    0x110c(%rip),%eax        # 1c00 <stdout>
+     af4:	48 8d 15 e1 0d 00 00 	lea    0xde1(%rip),%rdx        # 18dc <malloc+0x34c>
+     afb:	48 89 d6             	mov    %rdx,%rsi
+     afe:	89 c7                	mov    %eax,%edi
+     b00:	b8 00 00 00 00       	mov    $0x0,%eax
+     b05:	e8 04 02 00 00       	call   d0e <printf>
+}
+     b0a:	90                   	nop
+     b0b:	c9                   	leave
+     b0c:	c3                   	ret
+
+0000000000000b0d <main>:
+
+int
+main(int argc, char *argv[])
+{
+     b0d:	55                   	push   %rbp
+     b0e:	48 89 e5             	mov    %rsp,%rbp
+     b11:	48 83 ec 10          	sub    $0x10,%rsp
+     b15:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     b18:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  pressuretest();
+     b1c:	e8 c1 f6 ff ff       	call   1e2 <pressuretest>
+  kswapdtest();
+     b21:	e8 3b f9 ff ff       	call   461 <kswapdtest>
+  sharetest();
+     b26:	e8 65 fb ff ff       	call   690 <sharetest>
+  printf(stdout, "swaptest passed!!\n");
+     b2b:	8b 05 cf 10 00 00    	mov    0x10cf(%rip),%eax        # 1c00 <stdout>
+     b31:	48 8d 15 b2 0d 00 00 	lea    0xdb2(%rip),%rdx        # 18ea <malloc+0x35a>
+     b38:	48 89 d6             	mov    %rdx,%rsi
+     b3b:	89 c7                	mov    %eax,%edi
+     b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+     b42:	e8 c7 01 00 00       	call   d0e <printf>
+  exit();
+     b47:	e8 69 07 00 00       	call   12b5 <exit>
+
+0000000000000b4c <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+     b4c:	55                   	push   %rbp
+     b4d:	48 89 e5             	mov    %rsp,%rbp
+     b50:	48 83 ec 10          	sub    $0x10,%rsp
+     b54:	89 7d fc             	mov    %edi,-0x4(%rbp)
+     b57:	89 f0                	mov    %esi,%eax
+     b59:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+     b5c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+     b60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     b63:	ba 01 00 00 00       	mov    $0x1,%edx
+     b68:	48 89 ce             	mov    %rcx,%rsi
+     b6b:	89 c7                	mov    %eax,%edi
+     b6d:	e8 63 07 00 00       	call   12d5 <write>
+}
+     b72:	90                   	nop
+     b73:	c9                   	leave
+     b74:	c3                   	ret
+
+0000000000000b75 <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+     b75:	55                   	push   %rbp
+     b76:	48 89 e5             	mov    %rsp,%rbp
+     b79:	48 83 ec 40          	sub    $0x40,%rsp
+     b7d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+     b80:	89 75 c8             	mov    %esi,-0x38(%rbp)
+     b83:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+     b86:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+     b89:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     b8d:	74 1f                	je     bae <printint64+0x39>
+     b8f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     b92:	c1 e8 1f             	shr    $0x1f,%eax
+     b95:	0f b6 c0             	movzbl %al,%eax
+     b98:	89 45 c0             	mov    %eax,-0x40(%rbp)
+     b9b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     b9f:	74 0d                	je     bae <printint64+0x39>
+    x = -xx;
+     ba1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     ba4:	f7 d8                	neg    %eax
+     ba6:	48 98                	cltq
+     ba8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     bac:	eb 09                	jmp    bb7 <printint64+0x42>
+  else
+    x = xx;
+     bae:	8b 45 c8             	mov    -0x38(%rbp),%eax
+     bb1:	48 98                	cltq
+     bb3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+     bb7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     bbe:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     bc1:	48 63 c8             	movslq %eax,%rcx
+     bc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bc8:	ba 00 00 00 00       	mov    $0x0,%edx
+     bcd:	48 f7 f1             	div    %rcx
+     bd0:	48 89 d1             	mov    %rdx,%rcx
+     bd3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     bd6:	8d 50 01             	lea    0x1(%rax),%edx
+     bd9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     bdc:	48 8d 15 2d 10 00 00 	lea    0x102d(%rip),%rdx        # 1c10 <digits.1>
+     be3:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     be7:	48 98                	cltq
+     be9:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     bed:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     bf0:	48 63 f0             	movslq %eax,%rsi
+     bf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+     bf7:	ba 00 00 00 00       	mov    $0x0,%edx
+     bfc:	48 f7 f6             	div    %rsi
+     bff:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     c03:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+     c08:	75 b4                	jne    bbe <printint64+0x49>
+
+  if(sgn)
+     c0a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     c0e:	74 2b                	je     c3b <printint64+0xc6>
+    buf[i++] = '-';
+     c10:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c13:	8d 50 01             	lea    0x1(%rax),%edx
+     c16:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     c19:	48 98                	cltq
+     c1b:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+     c20:	eb 19                	jmp    c3b <printint64+0xc6>
+    putc(fd, buf[i]);
+     c22:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     c25:	48 98                	cltq
+     c27:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+     c2c:	0f be d0             	movsbl %al,%edx
+     c2f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+     c32:	89 d6                	mov    %edx,%esi
+     c34:	89 c7                	mov    %eax,%edi
+     c36:	e8 11 ff ff ff       	call   b4c <putc>
+  while(--i >= 0)
+     c3b:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     c3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     c43:	79 dd                	jns    c22 <printint64+0xad>
+}
+     c45:	90                   	nop
+     c46:	90                   	nop
+     c47:	c9                   	leave
+     c48:	c3                   	ret
+
+0000000000000c49 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c49:	55                   	push   %rbp
+     c4a:	48 89 e5             	mov    %rsp,%rbp
+     c4d:	48 83 ec 30          	sub    $0x30,%rsp
+     c51:	89 7d dc             	mov    %edi,-0x24(%rbp)
+     c54:	89 75 d8             	mov    %esi,-0x28(%rbp)
+     c57:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+     c5a:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     c5d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+     c64:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+     c68:	74 17                	je     c81 <printint+0x38>
+     c6a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+     c6e:	79 11                	jns    c81 <printint+0x38>
+    neg = 1;
+     c70:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+     c77:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c7a:	f7 d8                	neg    %eax
+     c7c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     c7f:	eb 06                	jmp    c87 <printint+0x3e>
+  } else {
+    x = xx;
+     c81:	8b 45 d8             	mov    -0x28(%rbp),%eax
+     c84:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+     c87:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+     c8e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+     c91:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     c94:	ba 00 00 00 00       	mov    $0x0,%edx
+     c99:	f7 f1                	div    %ecx
+     c9b:	89 d1                	mov    %edx,%ecx
+     c9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     ca0:	8d 50 01             	lea    0x1(%rax),%edx
+     ca3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     ca6:	89 c9                	mov    %ecx,%ecx
+     ca8:	48 8d 15 81 0f 00 00 	lea    0xf81(%rip),%rdx        # 1c30 <digits.0>
+     caf:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+     cb3:	48 98                	cltq
+     cb5:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+     cb9:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+     cbc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+     cc4:	f7 f6                	div    %esi
+     cc6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+     cc9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+     ccd:	75 bf                	jne    c8e <printint+0x45>
+  if(neg)
+     ccf:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+     cd3:	74 2b                	je     d00 <printint+0xb7>
+    buf[i++] = '-';
+     cd5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cd8:	8d 50 01             	lea    0x1(%rax),%edx
+     cdb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+     cde:	48 98                	cltq
+     ce0:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+     ce5:	eb 19                	jmp    d00 <printint+0xb7>
+    putc(fd, buf[i]);
+     ce7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+     cea:	48 98                	cltq
+     cec:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+     cf1:	0f be d0             	movsbl %al,%edx
+     cf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+     cf7:	89 d6                	mov    %edx,%esi
+     cf9:	89 c7                	mov    %eax,%edi
+     cfb:	e8 4c fe ff ff       	call   b4c <putc>
+  while(--i >= 0)
+     d00:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+     d04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+     d08:	79 dd                	jns    ce7 <printint+0x9e>
+}
+     d0a:	90                   	nop
+     d0b:	90                   	nop
+     d0c:	c9                   	leave
+     d0d:	c3                   	ret
+
+0000000000000d0e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     d0e:	55                   	push   %rbp
+     d0f:	48 89 e5             	mov    %rsp,%rbp
+     d12:	48 83 ec 70          	sub    $0x70,%rsp
+     d16:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+     d19:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+     d1d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+     d21:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+     d25:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+     d29:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+     d2d:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+     d34:	48 8d 45 10          	lea    0x10(%rbp),%rax
+     d38:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+     d3c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+     d40:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+     d44:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     d4b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+     d52:	e9 6b 02 00 00       	jmp    fc2 <printf+0x2b4>
+    c = fmt[i] & 0xff;
+     d57:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     d5a:	48 63 d0             	movslq %eax,%rdx
+     d5d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     d61:	48 01 d0             	add    %rdx,%rax
+     d64:	0f b6 00             	movzbl (%rax),%eax
+     d67:	0f be c0             	movsbl %al,%eax
+     d6a:	25 ff 00 00 00       	and    $0xff,%eax
+     d6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+     d72:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+     d76:	75 30                	jne    da8 <printf+0x9a>
+      if(c == '%'){
+     d78:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     d7c:	75 13                	jne    d91 <printf+0x83>
+        state = '%';
+     d7e:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+     d85:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+     d8c:	e9 2d 02 00 00       	jmp    fbe <printf+0x2b0>
+      } else {
+        putc(fd, c);
+     d91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     d94:	0f be d0             	movsbl %al,%edx
+     d97:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     d9a:	89 d6                	mov    %edx,%esi
+     d9c:	89 c7                	mov    %eax,%edi
+     d9e:	e8 a9 fd ff ff       	call   b4c <putc>
+     da3:	e9 16 02 00 00       	jmp    fbe <printf+0x2b0>
+      }
+    } else if(state == '%'){
+     da8:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+     dac:	0f 85 0c 02 00 00    	jne    fbe <printf+0x2b0>
+      if(c == 'l') {
+     db2:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+     db6:	75 0c                	jne    dc4 <printf+0xb6>
+        lflag = 1;
+     db8:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+     dbf:	e9 fa 01 00 00       	jmp    fbe <printf+0x2b0>
+      } else if(c == 'd'){
+     dc4:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+     dc8:	0f 85 95 00 00 00    	jne    e63 <printf+0x155>
+        if (lflag == 1)
+     dce:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     dd2:	75 49                	jne    e1d <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+     dd4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     dd7:	83 f8 2f             	cmp    $0x2f,%eax
+     dda:	77 17                	ja     df3 <printf+0xe5>
+     ddc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     de0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     de3:	89 d2                	mov    %edx,%edx
+     de5:	48 01 d0             	add    %rdx,%rax
+     de8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     deb:	83 c2 08             	add    $0x8,%edx
+     dee:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     df1:	eb 0c                	jmp    dff <printf+0xf1>
+     df3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     df7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     dfb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     dff:	48 8b 00             	mov    (%rax),%rax
+     e02:	89 c6                	mov    %eax,%esi
+     e04:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     e07:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e0c:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e11:	89 c7                	mov    %eax,%edi
+     e13:	e8 5d fd ff ff       	call   b75 <printint64>
+     e18:	e9 9a 01 00 00       	jmp    fb7 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+     e1d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     e20:	83 f8 2f             	cmp    $0x2f,%eax
+     e23:	77 17                	ja     e3c <printf+0x12e>
+     e25:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     e29:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e2c:	89 d2                	mov    %edx,%edx
+     e2e:	48 01 d0             	add    %rdx,%rax
+     e31:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e34:	83 c2 08             	add    $0x8,%edx
+     e37:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     e3a:	eb 0c                	jmp    e48 <printf+0x13a>
+     e3c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     e40:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     e44:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     e48:	8b 30                	mov    (%rax),%esi
+     e4a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     e4d:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e52:	ba 0a 00 00 00       	mov    $0xa,%edx
+     e57:	89 c7                	mov    %eax,%edi
+     e59:	e8 eb fd ff ff       	call   c49 <printint>
+     e5e:	e9 54 01 00 00       	jmp    fb7 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+     e63:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+     e67:	74 0a                	je     e73 <printf+0x165>
+     e69:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+     e6d:	0f 85 95 00 00 00    	jne    f08 <printf+0x1fa>
+        if (lflag == 1)
+     e73:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+     e77:	75 49                	jne    ec2 <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+     e79:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     e7c:	83 f8 2f             	cmp    $0x2f,%eax
+     e7f:	77 17                	ja     e98 <printf+0x18a>
+     e81:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     e85:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e88:	89 d2                	mov    %edx,%edx
+     e8a:	48 01 d0             	add    %rdx,%rax
+     e8d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     e90:	83 c2 08             	add    $0x8,%edx
+     e93:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     e96:	eb 0c                	jmp    ea4 <printf+0x196>
+     e98:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     e9c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ea0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     ea4:	48 8b 00             	mov    (%rax),%rax
+     ea7:	89 c6                	mov    %eax,%esi
+     ea9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     eac:	b9 00 00 00 00       	mov    $0x0,%ecx
+     eb1:	ba 10 00 00 00       	mov    $0x10,%edx
+     eb6:	89 c7                	mov    %eax,%edi
+     eb8:	e8 b8 fc ff ff       	call   b75 <printint64>
+        if (lflag == 1)
+     ebd:	e9 f5 00 00 00       	jmp    fb7 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+     ec2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     ec5:	83 f8 2f             	cmp    $0x2f,%eax
+     ec8:	77 17                	ja     ee1 <printf+0x1d3>
+     eca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     ece:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ed1:	89 d2                	mov    %edx,%edx
+     ed3:	48 01 d0             	add    %rdx,%rax
+     ed6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     ed9:	83 c2 08             	add    $0x8,%edx
+     edc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     edf:	eb 0c                	jmp    eed <printf+0x1df>
+     ee1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     ee5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     ee9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     eed:	8b 30                	mov    (%rax),%esi
+     eef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     ef2:	b9 00 00 00 00       	mov    $0x0,%ecx
+     ef7:	ba 10 00 00 00       	mov    $0x10,%edx
+     efc:	89 c7                	mov    %eax,%edi
+     efe:	e8 46 fd ff ff       	call   c49 <printint>
+        if (lflag == 1)
+     f03:	e9 af 00 00 00       	jmp    fb7 <printf+0x2a9>
+      } else if(c == 's'){
+     f08:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+     f0c:	75 6e                	jne    f7c <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+     f0e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+     f11:	83 f8 2f             	cmp    $0x2f,%eax
+     f14:	77 17                	ja     f2d <printf+0x21f>
+     f16:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+     f1a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f1d:	89 d2                	mov    %edx,%edx
+     f1f:	48 01 d0             	add    %rdx,%rax
+     f22:	8b 55 a0             	mov    -0x60(%rbp),%edx
+     f25:	83 c2 08             	add    $0x8,%edx
+     f28:	89 55 a0             	mov    %edx,-0x60(%rbp)
+     f2b:	eb 0c                	jmp    f39 <printf+0x22b>
+     f2d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+     f31:	48 8d 50 08          	lea    0x8(%rax),%rdx
+     f35:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+     f39:	48 8b 00             	mov    (%rax),%rax
+     f3c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+     f40:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+     f45:	75 28                	jne    f6f <printf+0x261>
+          s = "(null)";
+     f47:	48 8d 05 af 09 00 00 	lea    0x9af(%rip),%rax        # 18fd <malloc+0x36d>
+     f4e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+     f52:	eb 1b                	jmp    f6f <printf+0x261>
+          putc(fd, *s);
+     f54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f58:	0f b6 00             	movzbl (%rax),%eax
+     f5b:	0f be d0             	movsbl %al,%edx
+     f5e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f61:	89 d6                	mov    %edx,%esi
+     f63:	89 c7                	mov    %eax,%edi
+     f65:	e8 e2 fb ff ff       	call   b4c <putc>
+        for(; *s; s++)
+     f6a:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+     f6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+     f73:	0f b6 00             	movzbl (%rax),%eax
+     f76:	84 c0                	test   %al,%al
+     f78:	75 da                	jne    f54 <printf+0x246>
+     f7a:	eb 3b                	jmp    fb7 <printf+0x2a9>
+      } else if(c == '%'){
+     f7c:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+     f80:	75 14                	jne    f96 <printf+0x288>
+        putc(fd, c);
+     f82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     f85:	0f be d0             	movsbl %al,%edx
+     f88:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f8b:	89 d6                	mov    %edx,%esi
+     f8d:	89 c7                	mov    %eax,%edi
+     f8f:	e8 b8 fb ff ff       	call   b4c <putc>
+     f94:	eb 21                	jmp    fb7 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     f96:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     f99:	be 25 00 00 00       	mov    $0x25,%esi
+     f9e:	89 c7                	mov    %eax,%edi
+     fa0:	e8 a7 fb ff ff       	call   b4c <putc>
+        putc(fd, c);
+     fa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+     fa8:	0f be d0             	movsbl %al,%edx
+     fab:	8b 45 9c             	mov    -0x64(%rbp),%eax
+     fae:	89 d6                	mov    %edx,%esi
+     fb0:	89 c7                	mov    %eax,%edi
+     fb2:	e8 95 fb ff ff       	call   b4c <putc>
+      }
+      state = 0;
+     fb7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+     fbe:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+     fc2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+     fc5:	48 63 d0             	movslq %eax,%rdx
+     fc8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+     fcc:	48 01 d0             	add    %rdx,%rax
+     fcf:	0f b6 00             	movzbl (%rax),%eax
+     fd2:	84 c0                	test   %al,%al
+     fd4:	0f 85 7d fd ff ff    	jne    d57 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+     fda:	90                   	nop
+     fdb:	90                   	nop
+     fdc:	c9                   	leave
+     fdd:	c3                   	ret
+
+0000000000000fde <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     fde:	55                   	push   %rbp
+     fdf:	48 89 e5             	mov    %rsp,%rbp
+     fe2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+     fe6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+     fe9:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+     fec:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+     ff0:	8b 55 f0             	mov    -0x10(%rbp),%edx
+     ff3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+     ff6:	48 89 ce             	mov    %rcx,%rsi
+     ff9:	48 89 f7             	mov    %rsi,%rdi
+     ffc:	89 d1                	mov    %edx,%ecx
+     ffe:	fc                   	cld
+     fff:	f3 aa                	rep stos %al,%es:(%rdi)
+    1001:	89 ca                	mov    %ecx,%edx
+    1003:	48 89 fe             	mov    %rdi,%rsi
+    1006:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+    100a:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+    100d:	90                   	nop
+    100e:	5d                   	pop    %rbp
+    100f:	c3                   	ret
+
+0000000000001010 <strcpy>:
+{
+    1010:	55                   	push   %rbp
+    1011:	48 89 e5             	mov    %rsp,%rbp
+    1014:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1018:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+    101c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1020:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+    1024:	90                   	nop
+    1025:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    1029:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    102d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    1031:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1035:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1039:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+    103d:	0f b6 12             	movzbl (%rdx),%edx
+    1040:	88 10                	mov    %dl,(%rax)
+    1042:	0f b6 00             	movzbl (%rax),%eax
+    1045:	84 c0                	test   %al,%al
+    1047:	75 dc                	jne    1025 <strcpy+0x15>
+  return os;
+    1049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    104d:	5d                   	pop    %rbp
+    104e:	c3                   	ret
+
+000000000000104f <strcmp>:
+{
+    104f:	55                   	push   %rbp
+    1050:	48 89 e5             	mov    %rsp,%rbp
+    1053:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1057:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+    105b:	eb 0a                	jmp    1067 <strcmp+0x18>
+    p++, q++;
+    105d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    1062:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+    1067:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    106b:	0f b6 00             	movzbl (%rax),%eax
+    106e:	84 c0                	test   %al,%al
+    1070:	74 12                	je     1084 <strcmp+0x35>
+    1072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1076:	0f b6 10             	movzbl (%rax),%edx
+    1079:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    107d:	0f b6 00             	movzbl (%rax),%eax
+    1080:	38 c2                	cmp    %al,%dl
+    1082:	74 d9                	je     105d <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+    1084:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1088:	0f b6 00             	movzbl (%rax),%eax
+    108b:	0f b6 d0             	movzbl %al,%edx
+    108e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1092:	0f b6 00             	movzbl (%rax),%eax
+    1095:	0f b6 c0             	movzbl %al,%eax
+    1098:	29 c2                	sub    %eax,%edx
+    109a:	89 d0                	mov    %edx,%eax
+}
+    109c:	5d                   	pop    %rbp
+    109d:	c3                   	ret
+
+000000000000109e <strlen>:
+{
+    109e:	55                   	push   %rbp
+    109f:	48 89 e5             	mov    %rsp,%rbp
+    10a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+    10a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    10ad:	eb 04                	jmp    10b3 <strlen+0x15>
+    10af:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    10b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    10b6:	48 63 d0             	movslq %eax,%rdx
+    10b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    10bd:	48 01 d0             	add    %rdx,%rax
+    10c0:	0f b6 00             	movzbl (%rax),%eax
+    10c3:	84 c0                	test   %al,%al
+    10c5:	75 e8                	jne    10af <strlen+0x11>
+  return n;
+    10c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    10ca:	5d                   	pop    %rbp
+    10cb:	c3                   	ret
+
+00000000000010cc <memset>:
+{
+    10cc:	55                   	push   %rbp
+    10cd:	48 89 e5             	mov    %rsp,%rbp
+    10d0:	48 83 ec 10          	sub    $0x10,%rsp
+    10d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    10d8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+    10db:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+    10de:	8b 55 f0             	mov    -0x10(%rbp),%edx
+    10e1:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+    10e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    10e8:	89 ce                	mov    %ecx,%esi
+    10ea:	48 89 c7             	mov    %rax,%rdi
+    10ed:	e8 ec fe ff ff       	call   fde <stosb>
+  return dst;
+    10f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+    10f6:	c9                   	leave
+    10f7:	c3                   	ret
+
+00000000000010f8 <strchr>:
+{
+    10f8:	55                   	push   %rbp
+    10f9:	48 89 e5             	mov    %rsp,%rbp
+    10fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+    1100:	89 f0                	mov    %esi,%eax
+    1102:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+    1105:	eb 17                	jmp    111e <strchr+0x26>
+    if(*s == c)
+    1107:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    110b:	0f b6 00             	movzbl (%rax),%eax
+    110e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+    1111:	75 06                	jne    1119 <strchr+0x21>
+      return (char*)s;
+    1113:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1117:	eb 15                	jmp    112e <strchr+0x36>
+  for(; *s; s++)
+    1119:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+    111e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1122:	0f b6 00             	movzbl (%rax),%eax
+    1125:	84 c0                	test   %al,%al
+    1127:	75 de                	jne    1107 <strchr+0xf>
+  return 0;
+    1129:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    112e:	5d                   	pop    %rbp
+    112f:	c3                   	ret
+
+0000000000001130 <gets>:
+gets(char *buf, int max)
+{
+    1130:	55                   	push   %rbp
+    1131:	48 89 e5             	mov    %rsp,%rbp
+    1134:	48 83 ec 20          	sub    $0x20,%rsp
+    1138:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    113c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    113f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    1146:	eb 48                	jmp    1190 <gets+0x60>
+    cc = read(0, &c, 1);
+    1148:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+    114c:	ba 01 00 00 00       	mov    $0x1,%edx
+    1151:	48 89 c6             	mov    %rax,%rsi
+    1154:	bf 00 00 00 00       	mov    $0x0,%edi
+    1159:	e8 6f 01 00 00       	call   12cd <read>
+    115e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+    1161:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+    1165:	7e 36                	jle    119d <gets+0x6d>
+      break;
+    buf[i++] = c;
+    1167:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    116a:	8d 50 01             	lea    0x1(%rax),%edx
+    116d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+    1170:	48 63 d0             	movslq %eax,%rdx
+    1173:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1177:	48 01 c2             	add    %rax,%rdx
+    117a:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    117e:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+    1180:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    1184:	3c 0a                	cmp    $0xa,%al
+    1186:	74 16                	je     119e <gets+0x6e>
+    1188:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+    118c:	3c 0d                	cmp    $0xd,%al
+    118e:	74 0e                	je     119e <gets+0x6e>
+  for(i=0; i+1 < max; ){
+    1190:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    1193:	83 c0 01             	add    $0x1,%eax
+    1196:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+    1199:	7f ad                	jg     1148 <gets+0x18>
+    119b:	eb 01                	jmp    119e <gets+0x6e>
+      break;
+    119d:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    119e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11a1:	48 63 d0             	movslq %eax,%rdx
+    11a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11a8:	48 01 d0             	add    %rdx,%rax
+    11ab:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+    11ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+    11b2:	c9                   	leave
+    11b3:	c3                   	ret
+
+00000000000011b4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    11b4:	55                   	push   %rbp
+    11b5:	48 89 e5             	mov    %rsp,%rbp
+    11b8:	48 83 ec 20          	sub    $0x20,%rsp
+    11bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    11c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    11c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    11c8:	be 00 00 00 00       	mov    $0x0,%esi
+    11cd:	48 89 c7             	mov    %rax,%rdi
+    11d0:	e8 20 01 00 00       	call   12f5 <open>
+    11d5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+    11d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+    11dc:	79 07                	jns    11e5 <stat+0x31>
+    return -1;
+    11de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    11e3:	eb 21                	jmp    1206 <stat+0x52>
+  r = fstat(fd, st);
+    11e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+    11e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11ec:	48 89 d6             	mov    %rdx,%rsi
+    11ef:	89 c7                	mov    %eax,%edi
+    11f1:	e8 17 01 00 00       	call   130d <fstat>
+    11f6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+    11f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+    11fc:	89 c7                	mov    %eax,%edi
+    11fe:	e8 da 00 00 00       	call   12dd <close>
+  return r;
+    1203:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+    1206:	c9                   	leave
+    1207:	c3                   	ret
+
+0000000000001208 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1208:	55                   	push   %rbp
+    1209:	48 89 e5             	mov    %rsp,%rbp
+    120c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+    1210:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1217:	eb 28                	jmp    1241 <atoi+0x39>
+    n = n*10 + *s++ - '0';
+    1219:	8b 55 fc             	mov    -0x4(%rbp),%edx
+    121c:	89 d0                	mov    %edx,%eax
+    121e:	c1 e0 02             	shl    $0x2,%eax
+    1221:	01 d0                	add    %edx,%eax
+    1223:	01 c0                	add    %eax,%eax
+    1225:	89 c1                	mov    %eax,%ecx
+    1227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    122b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+    122f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    1233:	0f b6 00             	movzbl (%rax),%eax
+    1236:	0f be c0             	movsbl %al,%eax
+    1239:	01 c8                	add    %ecx,%eax
+    123b:	83 e8 30             	sub    $0x30,%eax
+    123e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+    1241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1245:	0f b6 00             	movzbl (%rax),%eax
+    1248:	3c 2f                	cmp    $0x2f,%al
+    124a:	7e 0b                	jle    1257 <atoi+0x4f>
+    124c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    1250:	0f b6 00             	movzbl (%rax),%eax
+    1253:	3c 39                	cmp    $0x39,%al
+    1255:	7e c2                	jle    1219 <atoi+0x11>
+  return n;
+    1257:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+    125a:	5d                   	pop    %rbp
+    125b:	c3                   	ret
+
+000000000000125c <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    125c:	55                   	push   %rbp
+    125d:	48 89 e5             	mov    %rsp,%rbp
+    1260:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+    1264:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    1268:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+    126b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    126f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+    1273:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+    1277:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+    127b:	eb 1d                	jmp    129a <memmove+0x3e>
+    *dst++ = *src++;
+    127d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    1281:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    1285:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1289:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    128d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+    1291:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+    1295:	0f b6 12             	movzbl (%rdx),%edx
+    1298:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+    129a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    129d:	8d 50 ff             	lea    -0x1(%rax),%edx
+    12a0:	89 55 dc             	mov    %edx,-0x24(%rbp)
+    12a3:	85 c0                	test   %eax,%eax
+    12a5:	7f d6                	jg     127d <memmove+0x21>
+  return vdst;
+    12a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    12ab:	5d                   	pop    %rbp
+    12ac:	c3                   	ret
+
+00000000000012ad <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    12ad:	b8 01 00 00 00       	mov    $0x1,%eax
+    12b2:	cd 40                	int    $0x40
+    12b4:	c3                   	ret
+
+00000000000012b5 <exit>:
+SYSCALL(exit)
+    12b5:	b8 02 00 00 00       	mov    $0x2,%eax
+    12ba:	cd 40                	int    $0x40
+    12bc:	c3                   	ret
+
+00000000000012bd <wait>:
+SYSCALL(wait)
+    12bd:	b8 03 00 00 00       	mov    $0x3,%eax
+    12c2:	cd 40                	int    $0x40
+    12c4:	c3                   	ret
+
+00000000000012c5 <pipe>:
+SYSCALL(pipe)
+    12c5:	b8 04 00 00 00       	mov    $0x4,%eax
+    12ca:	cd 40                	int    $0x40
+    12cc:	c3                   	ret
+
+00000000000012cd <read>:
+SYSCALL(read)
+    12cd:	b8 05 00 00 00       	mov    $0x5,%eax
+    12d2:	cd 40                	int    $0x40
+    12d4:	c3                   	ret
+
+00000000000012d5 <write>:
+SYSCALL(write)
+    12d5:	b8 10 00 00 00       	mov    $0x10,%eax
+    12da:	cd 40                	int    $0x40
+    12dc:	c3                   	ret
+
+00000000000012dd <close>:
+SYSCALL(close)
+    12dd:	b8 15 00 00 00       	mov    $0x15,%eax
+    12e2:	cd 40                	int    $0x40
+    12e4:	c3                   	ret
+
+00000000000012e5 <kill>:
+SYSCALL(kill)
+    12e5:	b8 06 00 00 00       	mov    $0x6,%eax
+    12ea:	cd 40                	int    $0x40
+    12ec:	c3                   	ret
+
+00000000000012ed <exec>:
+SYSCALL(exec)
+    12ed:	b8 07 00 00 00       	mov    $0x7,%eax
+    12f2:	cd 40                	int    $0x40
+    12f4:	c3                   	ret
+
+00000000000012f5 <open>:
+SYSCALL(open)
+    12f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+    12fa:	cd 40                	int    $0x40
+    12fc:	c3                   	ret
+
+00000000000012fd <mknod>:
+SYSCALL(mknod)
+    12fd:	b8 11 00 00 00       	mov    $0x11,%eax
+    1302:	cd 40                	int    $0x40
+    1304:	c3                   	ret
+
+0000000000001305 <unlink>:
+SYSCALL(unlink)
+    1305:	b8 12 00 00 00       	mov    $0x12,%eax
+    130a:	cd 40                	int    $0x40
+    130c:	c3                   	ret
+
+000000000000130d <fstat>:
+SYSCALL(fstat)
+    130d:	b8 08 00 00 00       	mov    $0x8,%eax
+    1312:	cd 40                	int    $0x40
+    1314:	c3                   	ret
+
+0000000000001315 <link>:
+SYSCALL(link)
+    1315:	b8 13 00 00 00       	mov    $0x13,%eax
+    131a:	cd 40                	int    $0x40
+    131c:	c3                   	ret
+
+000000000000131d <mkdir>:
+SYSCALL(mkdir)
+    131d:	b8 14 00 00 00       	mov    $0x14,%eax
+    1322:	cd 40                	int    $0x40
+    1324:	c3                   	ret
+
+0000000000001325 <chdir>:
+SYSCALL(chdir)
+    1325:	b8 09 00 00 00       	mov    $0x9,%eax
+    132a:	cd 40                	int    $0x40
+    132c:	c3                   	ret
+
+000000000000132d <dup>:
+SYSCALL(dup)
+    132d:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1332:	cd 40                	int    $0x40
+    1334:	c3                   	ret
+
+0000000000001335 <getpid>:
+SYSCALL(getpid)
+    1335:	b8 0b 00 00 00       	mov    $0xb,%eax
+    133a:	cd 40                	int    $0x40
+    133c:	c3                   	ret
+
+000000000000133d <sbrk>:
+SYSCALL(sbrk)
+    133d:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1342:	cd 40                	int    $0x40
+    1344:	c3                   	ret
+
+0000000000001345 <sleep>:
+SYSCALL(sleep)
+    1345:	b8 0d 00 00 00       	mov    $0xd,%eax
+    134a:	cd 40                	int    $0x40
+    134c:	c3                   	ret
+
+000000000000134d <uptime>:
+SYSCALL(uptime)
+    134d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1352:	cd 40                	int    $0x40
+    1354:	c3                   	ret
+
+0000000000001355 <sysinfo>:
+SYSCALL(sysinfo)
+    1355:	b8 16 00 00 00       	mov    $0x16,%eax
+    135a:	cd 40                	int    $0x40
+    135c:	c3                   	ret
+
+000000000000135d <mmap>:
+SYSCALL(mmap)
+    135d:	b8 17 00 00 00       	mov    $0x17,%eax
+    1362:	cd 40                	int    $0x40
+    1364:	c3                   	ret
+
+0000000000001365 <munmap>:
+SYSCALL(munmap)
+    1365:	b8 18 00 00 00       	mov    $0x18,%eax
+    136a:	cd 40                	int    $0x40
+    136c:	c3                   	ret
+
+000000000000136d <crashn>:
+SYSCALL(crashn)
+    136d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1372:	cd 40                	int    $0x40
+    1374:	c3                   	ret
+
+0000000000001375 <mmap2>:
+SYSCALL_ADDR(mmap2)
+    1375:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    137a:	cd 40                	int    $0x40
+    137c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    137f:	74 02                	je     1383 <mmap2+0xe>
+    1381:	89 c0                	mov    %eax,%eax
+    1383:	c3                   	ret
+
+0000000000001384 <munmap2>:
+SYSCALL(munmap2)
+    1384:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1389:	cd 40                	int    $0x40
+    138b:	c3                   	ret
+
+000000000000138c <msync>:
+SYSCALL(msync)
+    138c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1391:	cd 40                	int    $0x40
+    1393:	c3                   	ret
+
+0000000000001394 <sendfile>:
+SYSCALL(sendfile)
+    1394:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1399:	cd 40                	int    $0x40
+    139b:	c3                   	ret
+
+000000000000139c <splice>:
+SYSCALL(splice)
+    139c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13a1:	cd 40                	int    $0x40
+    13a3:	c3                   	ret
+
+00000000000013a4 <pread>:
+SYSCALL(pread)
+    13a4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13a9:	cd 40                	int    $0x40
+    13ab:	c3                   	ret
+
+00000000000013ac <pwrite>:
+SYSCALL(pwrite)
+    13ac:	b8 20 00 00 00       	mov    $0x20,%eax
+    13b1:	cd 40                	int    $0x40
+    13b3:	c3                   	ret
+
+00000000000013b4 <readv>:
+SYSCALL(readv)
+    13b4:	b8 21 00 00 00       	mov    $0x21,%eax
+    13b9:	cd 40                	int    $0x40
+    13bb:	c3                   	ret
+
+00000000000013bc <writev>:
+SYSCALL(writev)
+    13bc:	b8 22 00 00 00       	mov    $0x22,%eax
+    13c1:	cd 40                	int    $0x40
+    13c3:	c3                   	ret
+
+00000000000013c4 <poll>:
+SYSCALL(poll)
+    13c4:	b8 23 00 00 00       	mov    $0x23,%eax
+    13c9:	cd 40                	int    $0x40
+    13cb:	c3                   	ret
+
+00000000000013cc <pipe2>:
+SYSCALL(pipe2)
+    13cc:	b8 24 00 00 00       	mov    $0x24,%eax
+    13d1:	cd 40                	int    $0x40
+    13d3:	c3                   	ret
+
+00000000000013d4 <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+    13d4:	55                   	push   %rbp
+    13d5:	48 89 e5             	mov    %rsp,%rbp
+    13d8:	48 83 ec 20          	sub    $0x20,%rsp
+    13dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    13e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+    13e4:	48 83 e8 10          	sub    $0x10,%rax
+    13e8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+    13ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    13f0:	48 8b 10             	mov    (%rax),%rdx
+    13f3:	48 8d 05 76 08 00 00 	lea    0x876(%rip),%rax        # 1c70 <bigblock>
+    13fa:	48 39 c2             	cmp    %rax,%rdx
+    13fd:	75 1f                	jne    141e <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+    13ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1403:	8b 40 08             	mov    0x8(%rax),%eax
+    1406:	c1 e0 04             	shl    $0x4,%eax
+    1409:	89 c2                	mov    %eax,%edx
+    140b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    140f:	89 d6                	mov    %edx,%esi
+    1411:	48 89 c7             	mov    %rax,%rdi
+    1414:	e8 6b ff ff ff       	call   1384 <munmap2>
+    return;
+    1419:	e9 0b 01 00 00       	jmp    1529 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    141e:	48 8b 05 3b 08 00 00 	mov    0x83b(%rip),%rax        # 1c60 <freep>
+    1425:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    1429:	eb 2f                	jmp    145a <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    142b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    142f:	48 8b 00             	mov    (%rax),%rax
+    1432:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1436:	72 17                	jb     144f <free+0x7b>
+    1438:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    143c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1440:	72 2f                	jb     1471 <free+0x9d>
+    1442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1446:	48 8b 00             	mov    (%rax),%rax
+    1449:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    144d:	72 22                	jb     1471 <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    144f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1453:	48 8b 00             	mov    (%rax),%rax
+    1456:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    145a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    145e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    1462:	73 c7                	jae    142b <free+0x57>
+    1464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1468:	48 8b 00             	mov    (%rax),%rax
+    146b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    146f:	73 ba                	jae    142b <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1471:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1475:	8b 40 08             	mov    0x8(%rax),%eax
+    1478:	89 c0                	mov    %eax,%eax
+    147a:	48 c1 e0 04          	shl    $0x4,%rax
+    147e:	48 89 c2             	mov    %rax,%rdx
+    1481:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1485:	48 01 c2             	add    %rax,%rdx
+    1488:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    148c:	48 8b 00             	mov    (%rax),%rax
+    148f:	48 39 c2             	cmp    %rax,%rdx
+    1492:	75 2d                	jne    14c1 <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+    1494:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1498:	8b 50 08             	mov    0x8(%rax),%edx
+    149b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    149f:	48 8b 00             	mov    (%rax),%rax
+    14a2:	8b 40 08             	mov    0x8(%rax),%eax
+    14a5:	01 c2                	add    %eax,%edx
+    14a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14ab:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14b2:	48 8b 00             	mov    (%rax),%rax
+    14b5:	48 8b 10             	mov    (%rax),%rdx
+    14b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14bc:	48 89 10             	mov    %rdx,(%rax)
+    14bf:	eb 0e                	jmp    14cf <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+    14c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14c5:	48 8b 10             	mov    (%rax),%rdx
+    14c8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14cc:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+    14cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14d3:	8b 40 08             	mov    0x8(%rax),%eax
+    14d6:	89 c0                	mov    %eax,%eax
+    14d8:	48 c1 e0 04          	shl    $0x4,%rax
+    14dc:	48 89 c2             	mov    %rax,%rdx
+    14df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14e3:	48 01 d0             	add    %rdx,%rax
+    14e6:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+    14ea:	75 27                	jne    1513 <free+0x13f>
+    p->s.size += bp->s.size;
+    14ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    14f0:	8b 50 08             	mov    0x8(%rax),%edx
+    14f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    14f7:	8b 40 08             	mov    0x8(%rax),%eax
+    14fa:	01 c2                	add    %eax,%edx
+    14fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1500:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+    1503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1507:	48 8b 10             	mov    (%rax),%rdx
+    150a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    150e:	48 89 10             	mov    %rdx,(%rax)
+    1511:	eb 0b                	jmp    151e <free+0x14a>
+  } else
+    p->s.ptr = bp;
+    1513:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1517:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+    151b:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+    151e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1522:	48 89 05 37 07 00 00 	mov    %rax,0x737(%rip)        # 1c60 <freep>
+}
+    1529:	c9                   	leave
+    152a:	c3                   	ret
+
+000000000000152b <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    152b:	55                   	push   %rbp
+    152c:	48 89 e5             	mov    %rsp,%rbp
+    152f:	48 83 ec 20          	sub    $0x20,%rsp
+    1533:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1536:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+    153d:	77 07                	ja     1546 <morecore+0x1b>
+    nu = 4096;
+    153f:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+    1546:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    1549:	c1 e0 04             	shl    $0x4,%eax
+    154c:	89 c7                	mov    %eax,%edi
+    154e:	e8 ea fd ff ff       	call   133d <sbrk>
+    1553:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+    1557:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    155c:	75 07                	jne    1565 <morecore+0x3a>
+    return 0;
+    155e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1563:	eb 29                	jmp    158e <morecore+0x63>
+  hp = (Header*)p;
+    1565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1569:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+    156d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1571:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1574:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+    1577:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    157b:	48 83 c0 10          	add    $0x10,%rax
+    157f:	48 89 c7             	mov    %rax,%rdi
+    1582:	e8 4d fe ff ff       	call   13d4 <free>
+  return freep;
+    1587:	48 8b 05 d2 06 00 00 	mov    0x6d2(%rip),%rax        # 1c60 <freep>
+}
+    158e:	c9                   	leave
+    158f:	c3                   	ret
+
+0000000000001590 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1590:	55                   	push   %rbp
+    1591:	48 89 e5             	mov    %rsp,%rbp
+    1594:	48 83 ec 30          	sub    $0x30,%rsp
+    1598:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    159b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+    159e:	48 83 c0 0f          	add    $0xf,%rax
+    15a2:	48 c1 e8 04          	shr    $0x4,%rax
+    15a6:	83 c0 01             	add    $0x1,%eax
+    15a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+    15ac:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+    15b3:	76 62                	jbe    1617 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+    15b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    15b8:	c1 e0 04             	shl    $0x4,%eax
+    15bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    15c1:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+    15c7:	b9 22 00 00 00       	mov    $0x22,%ecx
+    15cc:	ba 03 00 00 00       	mov    $0x3,%edx
+    15d1:	89 c6                	mov    %eax,%esi
+    15d3:	bf 00 00 00 00       	mov    $0x0,%edi
+    15d8:	e8 98 fd ff ff       	call   1375 <mmap2>
+    15dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+    15e1:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+    15e6:	75 0a                	jne    15f2 <malloc+0x62>
+      return 0;
+    15e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    15ed:	e9 1c 01 00 00       	jmp    170e <malloc+0x17e>
+    p->s.ptr = &bigblock;
+    15f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    15f6:	48 8d 15 73 06 00 00 	lea    0x673(%rip),%rdx        # 1c70 <bigblock>
+    15fd:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+    1600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1604:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    1607:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+    160a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    160e:	48 83 c0 10          	add    $0x10,%rax
+    1612:	e9 f7 00 00 00       	jmp    170e <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+    1617:	48 8b 05 42 06 00 00 	mov    0x642(%rip),%rax        # 1c60 <freep>
+    161e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1622:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+    1627:	75 2e                	jne    1657 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+    1629:	48 8d 05 20 06 00 00 	lea    0x620(%rip),%rax        # 1c50 <base>
+    1630:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    1634:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1638:	48 89 05 21 06 00 00 	mov    %rax,0x621(%rip)        # 1c60 <freep>
+    163f:	48 8b 05 1a 06 00 00 	mov    0x61a(%rip),%rax        # 1c60 <freep>
+    1646:	48 89 05 03 06 00 00 	mov    %rax,0x603(%rip)        # 1c50 <base>
+    base.s.size = 0;
+    164d:	c7 05 01 06 00 00 00 	movl   $0x0,0x601(%rip)        # 1c58 <base+0x8>
+    1654:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1657:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    165b:	48 8b 00             	mov    (%rax),%rax
+    165e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1666:	8b 40 08             	mov    0x8(%rax),%eax
+    1669:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+    166c:	72 5f                	jb     16cd <malloc+0x13d>
+      if(p->s.size == nunits)
+    166e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1672:	8b 40 08             	mov    0x8(%rax),%eax
+    1675:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+    1678:	75 10                	jne    168a <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+    167a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    167e:	48 8b 10             	mov    (%rax),%rdx
+    1681:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    1685:	48 89 10             	mov    %rdx,(%rax)
+    1688:	eb 2e                	jmp    16b8 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+    168a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    168e:	8b 40 08             	mov    0x8(%rax),%eax
+    1691:	2b 45 ec             	sub    -0x14(%rbp),%eax
+    1694:	89 c2                	mov    %eax,%edx
+    1696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    169a:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    169d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16a1:	8b 40 08             	mov    0x8(%rax),%eax
+    16a4:	89 c0                	mov    %eax,%eax
+    16a6:	48 c1 e0 04          	shl    $0x4,%rax
+    16aa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+    16ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16b2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+    16b5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+    16b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+    16bc:	48 89 05 9d 05 00 00 	mov    %rax,0x59d(%rip)        # 1c60 <freep>
+      return (void*)(p + 1);
+    16c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16c7:	48 83 c0 10          	add    $0x10,%rax
+    16cb:	eb 41                	jmp    170e <malloc+0x17e>
+    }
+    if(p == freep)
+    16cd:	48 8b 05 8c 05 00 00 	mov    0x58c(%rip),%rax        # 1c60 <freep>
+    16d4:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+    16d8:	75 1c                	jne    16f6 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+    16da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+    16dd:	89 c7                	mov    %eax,%edi
+    16df:	e8 47 fe ff ff       	call   152b <morecore>
+    16e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    16e8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+    16ed:	75 07                	jne    16f6 <malloc+0x166>
+        return 0;
+    16ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    16f4:	eb 18                	jmp    170e <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    16f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    16fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    16fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+    1702:	48 8b 00             	mov    (%rax),%rax
+    1705:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+    1709:	e9 54 ff ff ff       	jmp    1662 <malloc+0xd2>
+  }
+}
+    170e:	c9                   	leave
+    170f:	c3                   	ret
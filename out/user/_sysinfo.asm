@@ -0,0 +1,1452 @@
+
+out/user/_sysinfo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include <fs.h>
+#include <sysinfo.h>
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	48 83 ec 30          	sub    $0x30,%rsp
+   8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+   b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+    struct sys_info info;
+    sysinfo(&info);
+   f:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  13:	48 89 c7             	mov    %rax,%rdi
+  16:	e8 a4 08 00 00       	call   8bf <sysinfo>
+
+    printf(1, "pages_in_use = %d\n", info.pages_in_use);
+  1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  1e:	89 c2                	mov    %eax,%edx
+  20:	48 8d 05 53 0c 00 00 	lea    0xc53(%rip),%rax        # c7a <malloc+0x180>
+  27:	48 89 c6             	mov    %rax,%rsi
+  2a:	bf 01 00 00 00       	mov    $0x1,%edi
+  2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  34:	e8 3f 02 00 00       	call   278 <printf>
+    printf(1, "pages_in_swap = %d\n", info.pages_in_swap);    
+  39:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  3c:	89 c2                	mov    %eax,%edx
+  3e:	48 8d 05 48 0c 00 00 	lea    0xc48(%rip),%rax        # c8d <malloc+0x193>
+  45:	48 89 c6             	mov    %rax,%rsi
+  48:	bf 01 00 00 00       	mov    $0x1,%edi
+  4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  52:	e8 21 02 00 00       	call   278 <printf>
+    printf(1, "free_pages = %d\n", info.free_pages);
+  57:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  5a:	89 c2                	mov    %eax,%edx
+  5c:	48 8d 05 3e 0c 00 00 	lea    0xc3e(%rip),%rax        # ca1 <malloc+0x1a7>
+  63:	48 89 c6             	mov    %rax,%rsi
+  66:	bf 01 00 00 00       	mov    $0x1,%edi
+  6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  70:	e8 03 02 00 00       	call   278 <printf>
+    printf(1, "num_page_faults = %d\n", info.num_page_faults);
+  75:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  78:	89 c2                	mov    %eax,%edx
+  7a:	48 8d 05 31 0c 00 00 	lea    0xc31(%rip),%rax        # cb2 <malloc+0x1b8>
+  81:	48 89 c6             	mov    %rax,%rsi
+  84:	bf 01 00 00 00       	mov    $0x1,%edi
+  89:	b8 00 00 00 00       	mov    $0x0,%eax
+  8e:	e8 e5 01 00 00       	call   278 <printf>
+    printf(1, "num_disk_reads = %d\n", info.num_disk_reads);
+  93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  96:	89 c2                	mov    %eax,%edx
+  98:	48 8d 05 29 0c 00 00 	lea    0xc29(%rip),%rax        # cc8 <malloc+0x1ce>
+  9f:	48 89 c6             	mov    %rax,%rsi
+  a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  ac:	e8 c7 01 00 00       	call   278 <printf>
+
+    exit();
+  b1:	e8 69 07 00 00       	call   81f <exit>
+
+00000000000000b6 <putc>:
+#include <user.h>
+#include <stdarg.h>
+
+static void
+putc(int fd, char c)
+{
+  b6:	55                   	push   %rbp
+  b7:	48 89 e5             	mov    %rsp,%rbp
+  ba:	48 83 ec 10          	sub    $0x10,%rsp
+  be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  c1:	89 f0                	mov    %esi,%eax
+  c3:	88 45 f8             	mov    %al,-0x8(%rbp)
+  write(fd, &c, 1);
+  c6:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  d2:	48 89 ce             	mov    %rcx,%rsi
+  d5:	89 c7                	mov    %eax,%edi
+  d7:	e8 63 07 00 00       	call   83f <write>
+}
+  dc:	90                   	nop
+  dd:	c9                   	leave
+  de:	c3                   	ret
+
+00000000000000df <printint64>:
+
+static void
+printint64(int fd, int xx, int base, int sgn)
+{
+  df:	55                   	push   %rbp
+  e0:	48 89 e5             	mov    %rsp,%rbp
+  e3:	48 83 ec 40          	sub    $0x40,%rsp
+  e7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  ea:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  ed:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  f0:	89 4d c0             	mov    %ecx,-0x40(%rbp)
+  static char digits[] = "0123456789abcdef";
+  char buf[32];
+  int i;
+  uint64_t x;
+
+  if(sgn && (sgn = xx < 0))
+  f3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  f7:	74 1f                	je     118 <printint64+0x39>
+  f9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  fc:	c1 e8 1f             	shr    $0x1f,%eax
+  ff:	0f b6 c0             	movzbl %al,%eax
+ 102:	89 45 c0             	mov    %eax,-0x40(%rbp)
+ 105:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 109:	74 0d                	je     118 <printint64+0x39>
+    x = -xx;
+ 10b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 10e:	f7 d8                	neg    %eax
+ 110:	48 98                	cltq
+ 112:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 116:	eb 09                	jmp    121 <printint64+0x42>
+  else
+    x = xx;
+ 118:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ 11b:	48 98                	cltq
+ 11d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  i = 0;
+ 121:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 128:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 12b:	48 63 c8             	movslq %eax,%rcx
+ 12e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 132:	ba 00 00 00 00       	mov    $0x0,%edx
+ 137:	48 f7 f1             	div    %rcx
+ 13a:	48 89 d1             	mov    %rdx,%rcx
+ 13d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 140:	8d 50 01             	lea    0x1(%rax),%edx
+ 143:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 146:	48 8d 15 f3 0d 00 00 	lea    0xdf3(%rip),%rdx        # f40 <digits.1>
+ 14d:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 151:	48 98                	cltq
+ 153:	88 54 05 d0          	mov    %dl,-0x30(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 157:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 15a:	48 63 f0             	movslq %eax,%rsi
+ 15d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 161:	ba 00 00 00 00       	mov    $0x0,%edx
+ 166:	48 f7 f6             	div    %rsi
+ 169:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 16d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ 172:	75 b4                	jne    128 <printint64+0x49>
+
+  if(sgn)
+ 174:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 178:	74 2b                	je     1a5 <printint64+0xc6>
+    buf[i++] = '-';
+ 17a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 17d:	8d 50 01             	lea    0x1(%rax),%edx
+ 180:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 183:	48 98                	cltq
+ 185:	c6 44 05 d0 2d       	movb   $0x2d,-0x30(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 18a:	eb 19                	jmp    1a5 <printint64+0xc6>
+    putc(fd, buf[i]);
+ 18c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 18f:	48 98                	cltq
+ 191:	0f b6 44 05 d0       	movzbl -0x30(%rbp,%rax,1),%eax
+ 196:	0f be d0             	movsbl %al,%edx
+ 199:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ 19c:	89 d6                	mov    %edx,%esi
+ 19e:	89 c7                	mov    %eax,%edi
+ 1a0:	e8 11 ff ff ff       	call   b6 <putc>
+  while(--i >= 0)
+ 1a5:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 1a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 1ad:	79 dd                	jns    18c <printint64+0xad>
+}
+ 1af:	90                   	nop
+ 1b0:	90                   	nop
+ 1b1:	c9                   	leave
+ 1b2:	c3                   	ret
+
+00000000000001b3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1b3:	55                   	push   %rbp
+ 1b4:	48 89 e5             	mov    %rsp,%rbp
+ 1b7:	48 83 ec 30          	sub    $0x30,%rsp
+ 1bb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ 1be:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ 1c1:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+ 1c4:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1c7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  if(sgn && xx < 0){
+ 1ce:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ 1d2:	74 17                	je     1eb <printint+0x38>
+ 1d4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+ 1d8:	79 11                	jns    1eb <printint+0x38>
+    neg = 1;
+ 1da:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%rbp)
+    x = -xx;
+ 1e1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1e4:	f7 d8                	neg    %eax
+ 1e6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 1e9:	eb 06                	jmp    1f1 <printint+0x3e>
+  } else {
+    x = xx;
+ 1eb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ 1ee:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  }
+
+  i = 0;
+ 1f1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ 1f8:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+ 1fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 1fe:	ba 00 00 00 00       	mov    $0x0,%edx
+ 203:	f7 f1                	div    %ecx
+ 205:	89 d1                	mov    %edx,%ecx
+ 207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 20a:	8d 50 01             	lea    0x1(%rax),%edx
+ 20d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 210:	89 c9                	mov    %ecx,%ecx
+ 212:	48 8d 15 47 0d 00 00 	lea    0xd47(%rip),%rdx        # f60 <digits.0>
+ 219:	0f b6 14 11          	movzbl (%rcx,%rdx,1),%edx
+ 21d:	48 98                	cltq
+ 21f:	88 54 05 e4          	mov    %dl,-0x1c(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ 223:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+ 226:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 229:	ba 00 00 00 00       	mov    $0x0,%edx
+ 22e:	f7 f6                	div    %esi
+ 230:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ 233:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ 237:	75 bf                	jne    1f8 <printint+0x45>
+  if(neg)
+ 239:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 23d:	74 2b                	je     26a <printint+0xb7>
+    buf[i++] = '-';
+ 23f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 242:	8d 50 01             	lea    0x1(%rax),%edx
+ 245:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 248:	48 98                	cltq
+ 24a:	c6 44 05 e4 2d       	movb   $0x2d,-0x1c(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 24f:	eb 19                	jmp    26a <printint+0xb7>
+    putc(fd, buf[i]);
+ 251:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 254:	48 98                	cltq
+ 256:	0f b6 44 05 e4       	movzbl -0x1c(%rbp,%rax,1),%eax
+ 25b:	0f be d0             	movsbl %al,%edx
+ 25e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 261:	89 d6                	mov    %edx,%esi
+ 263:	89 c7                	mov    %eax,%edi
+ 265:	e8 4c fe ff ff       	call   b6 <putc>
+  while(--i >= 0)
+ 26a:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ 26e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 272:	79 dd                	jns    251 <printint+0x9e>
+}
+ 274:	90                   	nop
+ 275:	90                   	nop
+ 276:	c9                   	leave
+ 277:	c3                   	ret
+
+0000000000000278 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 278:	55                   	push   %rbp
+ 279:	48 89 e5             	mov    %rsp,%rbp
+ 27c:	48 83 ec 70          	sub    $0x70,%rsp
+ 280:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+ 283:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+ 287:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ 28b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 28f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+ 293:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+  char *s;
+  int c, i, state;
+  int lflag;  
+  va_list valist;
+  va_start(valist, fmt);
+ 297:	c7 45 a0 10 00 00 00 	movl   $0x10,-0x60(%rbp)
+ 29e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ 2a2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+ 2a6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ 2aa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+
+  state = 0;
+ 2ae:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2b5:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+ 2bc:	e9 6b 02 00 00       	jmp    52c <printf+0x2b4>
+    c = fmt[i] & 0xff;
+ 2c1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 2c4:	48 63 d0             	movslq %eax,%rdx
+ 2c7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 2cb:	48 01 d0             	add    %rdx,%rax
+ 2ce:	0f b6 00             	movzbl (%rax),%eax
+ 2d1:	0f be c0             	movsbl %al,%eax
+ 2d4:	25 ff 00 00 00       	and    $0xff,%eax
+ 2d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if(state == 0){
+ 2dc:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+ 2e0:	75 30                	jne    312 <printf+0x9a>
+      if(c == '%'){
+ 2e2:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 2e6:	75 13                	jne    2fb <printf+0x83>
+        state = '%';
+ 2e8:	c7 45 c0 25 00 00 00 	movl   $0x25,-0x40(%rbp)
+        lflag = 0;
+ 2ef:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+ 2f6:	e9 2d 02 00 00       	jmp    528 <printf+0x2b0>
+      } else {
+        putc(fd, c);
+ 2fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 2fe:	0f be d0             	movsbl %al,%edx
+ 301:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 304:	89 d6                	mov    %edx,%esi
+ 306:	89 c7                	mov    %eax,%edi
+ 308:	e8 a9 fd ff ff       	call   b6 <putc>
+ 30d:	e9 16 02 00 00       	jmp    528 <printf+0x2b0>
+      }
+    } else if(state == '%'){
+ 312:	83 7d c0 25          	cmpl   $0x25,-0x40(%rbp)
+ 316:	0f 85 0c 02 00 00    	jne    528 <printf+0x2b0>
+      if(c == 'l') {
+ 31c:	83 7d b8 6c          	cmpl   $0x6c,-0x48(%rbp)
+ 320:	75 0c                	jne    32e <printf+0xb6>
+        lflag = 1;
+ 322:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%rbp)
+        continue;
+ 329:	e9 fa 01 00 00       	jmp    528 <printf+0x2b0>
+      } else if(c == 'd'){
+ 32e:	83 7d b8 64          	cmpl   $0x64,-0x48(%rbp)
+ 332:	0f 85 95 00 00 00    	jne    3cd <printf+0x155>
+        if (lflag == 1)
+ 338:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 33c:	75 49                	jne    387 <printf+0x10f>
+          printint64(fd, va_arg(valist, int64_t), 10, 1);
+ 33e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 341:	83 f8 2f             	cmp    $0x2f,%eax
+ 344:	77 17                	ja     35d <printf+0xe5>
+ 346:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 34a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 34d:	89 d2                	mov    %edx,%edx
+ 34f:	48 01 d0             	add    %rdx,%rax
+ 352:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 355:	83 c2 08             	add    $0x8,%edx
+ 358:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 35b:	eb 0c                	jmp    369 <printf+0xf1>
+ 35d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 361:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 365:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 369:	48 8b 00             	mov    (%rax),%rax
+ 36c:	89 c6                	mov    %eax,%esi
+ 36e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 371:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 376:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 37b:	89 c7                	mov    %eax,%edi
+ 37d:	e8 5d fd ff ff       	call   df <printint64>
+ 382:	e9 9a 01 00 00       	jmp    521 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 10, 1);       
+ 387:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 38a:	83 f8 2f             	cmp    $0x2f,%eax
+ 38d:	77 17                	ja     3a6 <printf+0x12e>
+ 38f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 393:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 396:	89 d2                	mov    %edx,%edx
+ 398:	48 01 d0             	add    %rdx,%rax
+ 39b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 39e:	83 c2 08             	add    $0x8,%edx
+ 3a1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 3a4:	eb 0c                	jmp    3b2 <printf+0x13a>
+ 3a6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 3aa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3ae:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 3b2:	8b 30                	mov    (%rax),%esi
+ 3b4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 3b7:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3bc:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3c1:	89 c7                	mov    %eax,%edi
+ 3c3:	e8 eb fd ff ff       	call   1b3 <printint>
+ 3c8:	e9 54 01 00 00       	jmp    521 <printf+0x2a9>
+      } else if(c == 'x' || c == 'p'){
+ 3cd:	83 7d b8 78          	cmpl   $0x78,-0x48(%rbp)
+ 3d1:	74 0a                	je     3dd <printf+0x165>
+ 3d3:	83 7d b8 70          	cmpl   $0x70,-0x48(%rbp)
+ 3d7:	0f 85 95 00 00 00    	jne    472 <printf+0x1fa>
+        if (lflag == 1)
+ 3dd:	83 7d bc 01          	cmpl   $0x1,-0x44(%rbp)
+ 3e1:	75 49                	jne    42c <printf+0x1b4>
+          printint64(fd, va_arg(valist, int64_t), 16, 0);
+ 3e3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 3e6:	83 f8 2f             	cmp    $0x2f,%eax
+ 3e9:	77 17                	ja     402 <printf+0x18a>
+ 3eb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 3ef:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3f2:	89 d2                	mov    %edx,%edx
+ 3f4:	48 01 d0             	add    %rdx,%rax
+ 3f7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 3fa:	83 c2 08             	add    $0x8,%edx
+ 3fd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 400:	eb 0c                	jmp    40e <printf+0x196>
+ 402:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 406:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 40a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 40e:	48 8b 00             	mov    (%rax),%rax
+ 411:	89 c6                	mov    %eax,%esi
+ 413:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 416:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 41b:	ba 10 00 00 00       	mov    $0x10,%edx
+ 420:	89 c7                	mov    %eax,%edi
+ 422:	e8 b8 fc ff ff       	call   df <printint64>
+        if (lflag == 1)
+ 427:	e9 f5 00 00 00       	jmp    521 <printf+0x2a9>
+        else
+          printint(fd, va_arg(valist, int), 16, 0);
+ 42c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 42f:	83 f8 2f             	cmp    $0x2f,%eax
+ 432:	77 17                	ja     44b <printf+0x1d3>
+ 434:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 438:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 43b:	89 d2                	mov    %edx,%edx
+ 43d:	48 01 d0             	add    %rdx,%rax
+ 440:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 443:	83 c2 08             	add    $0x8,%edx
+ 446:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 449:	eb 0c                	jmp    457 <printf+0x1df>
+ 44b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 44f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 453:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 457:	8b 30                	mov    (%rax),%esi
+ 459:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 45c:	b9 00 00 00 00       	mov    $0x0,%ecx
+ 461:	ba 10 00 00 00       	mov    $0x10,%edx
+ 466:	89 c7                	mov    %eax,%edi
+ 468:	e8 46 fd ff ff       	call   1b3 <printint>
+        if (lflag == 1)
+ 46d:	e9 af 00 00 00       	jmp    521 <printf+0x2a9>
+      } else if(c == 's'){
+ 472:	83 7d b8 73          	cmpl   $0x73,-0x48(%rbp)
+ 476:	75 6e                	jne    4e6 <printf+0x26e>
+        if((s = (char*)va_arg(valist, char *)) == 0)
+ 478:	8b 45 a0             	mov    -0x60(%rbp),%eax
+ 47b:	83 f8 2f             	cmp    $0x2f,%eax
+ 47e:	77 17                	ja     497 <printf+0x21f>
+ 480:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+ 484:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 487:	89 d2                	mov    %edx,%edx
+ 489:	48 01 d0             	add    %rdx,%rax
+ 48c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+ 48f:	83 c2 08             	add    $0x8,%edx
+ 492:	89 55 a0             	mov    %edx,-0x60(%rbp)
+ 495:	eb 0c                	jmp    4a3 <printf+0x22b>
+ 497:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+ 49b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 49f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+ 4a3:	48 8b 00             	mov    (%rax),%rax
+ 4a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ 4aa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ 4af:	75 28                	jne    4d9 <printf+0x261>
+          s = "(null)";
+ 4b1:	48 8d 05 25 08 00 00 	lea    0x825(%rip),%rax        # cdd <malloc+0x1e3>
+ 4b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        for(; *s; s++)
+ 4bc:	eb 1b                	jmp    4d9 <printf+0x261>
+          putc(fd, *s);
+ 4be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4c2:	0f b6 00             	movzbl (%rax),%eax
+ 4c5:	0f be d0             	movsbl %al,%edx
+ 4c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4cb:	89 d6                	mov    %edx,%esi
+ 4cd:	89 c7                	mov    %eax,%edi
+ 4cf:	e8 e2 fb ff ff       	call   b6 <putc>
+        for(; *s; s++)
+ 4d4:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+ 4d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 4dd:	0f b6 00             	movzbl (%rax),%eax
+ 4e0:	84 c0                	test   %al,%al
+ 4e2:	75 da                	jne    4be <printf+0x246>
+ 4e4:	eb 3b                	jmp    521 <printf+0x2a9>
+      } else if(c == '%'){
+ 4e6:	83 7d b8 25          	cmpl   $0x25,-0x48(%rbp)
+ 4ea:	75 14                	jne    500 <printf+0x288>
+        putc(fd, c);
+ 4ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 4ef:	0f be d0             	movsbl %al,%edx
+ 4f2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 4f5:	89 d6                	mov    %edx,%esi
+ 4f7:	89 c7                	mov    %eax,%edi
+ 4f9:	e8 b8 fb ff ff       	call   b6 <putc>
+ 4fe:	eb 21                	jmp    521 <printf+0x2a9>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 500:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 503:	be 25 00 00 00       	mov    $0x25,%esi
+ 508:	89 c7                	mov    %eax,%edi
+ 50a:	e8 a7 fb ff ff       	call   b6 <putc>
+        putc(fd, c);
+ 50f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+ 512:	0f be d0             	movsbl %al,%edx
+ 515:	8b 45 9c             	mov    -0x64(%rbp),%eax
+ 518:	89 d6                	mov    %edx,%esi
+ 51a:	89 c7                	mov    %eax,%edi
+ 51c:	e8 95 fb ff ff       	call   b6 <putc>
+      }
+      state = 0;
+ 521:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 528:	83 45 c4 01          	addl   $0x1,-0x3c(%rbp)
+ 52c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+ 52f:	48 63 d0             	movslq %eax,%rdx
+ 532:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+ 536:	48 01 d0             	add    %rdx,%rax
+ 539:	0f b6 00             	movzbl (%rax),%eax
+ 53c:	84 c0                	test   %al,%al
+ 53e:	0f 85 7d fd ff ff    	jne    2c1 <printf+0x49>
+    }
+  }
+
+  va_end(valist);
+}
+ 544:	90                   	nop
+ 545:	90                   	nop
+ 546:	c9                   	leave
+ 547:	c3                   	ret
+
+0000000000000548 <stosb>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 548:	55                   	push   %rbp
+ 549:	48 89 e5             	mov    %rsp,%rbp
+ 54c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 550:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 553:	89 55 f0             	mov    %edx,-0x10(%rbp)
+      return (char*)s;
+ 556:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ 55a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 55d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ 560:	48 89 ce             	mov    %rcx,%rsi
+ 563:	48 89 f7             	mov    %rsi,%rdi
+ 566:	89 d1                	mov    %edx,%ecx
+ 568:	fc                   	cld
+ 569:	f3 aa                	rep stos %al,%es:(%rdi)
+ 56b:	89 ca                	mov    %ecx,%edx
+ 56d:	48 89 fe             	mov    %rdi,%rsi
+ 570:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ 574:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  return 0;
+}
+
+char*
+ 577:	90                   	nop
+ 578:	5d                   	pop    %rbp
+ 579:	c3                   	ret
+
+000000000000057a <strcpy>:
+{
+ 57a:	55                   	push   %rbp
+ 57b:	48 89 e5             	mov    %rsp,%rbp
+ 57e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 582:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  os = s;
+ 586:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 58a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((*s++ = *t++) != 0)
+ 58e:	90                   	nop
+ 58f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 593:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 597:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ 59b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 59f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 5a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ 5a7:	0f b6 12             	movzbl (%rdx),%edx
+ 5aa:	88 10                	mov    %dl,(%rax)
+ 5ac:	0f b6 00             	movzbl (%rax),%eax
+ 5af:	84 c0                	test   %al,%al
+ 5b1:	75 dc                	jne    58f <strcpy+0x15>
+  return os;
+ 5b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 5b7:	5d                   	pop    %rbp
+ 5b8:	c3                   	ret
+
+00000000000005b9 <strcmp>:
+{
+ 5b9:	55                   	push   %rbp
+ 5ba:	48 89 e5             	mov    %rsp,%rbp
+ 5bd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 5c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5c5:	eb 0a                	jmp    5d1 <strcmp+0x18>
+    p++, q++;
+ 5c7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 5cc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(*p && *p == *q)
+ 5d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5d5:	0f b6 00             	movzbl (%rax),%eax
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	74 12                	je     5ee <strcmp+0x35>
+ 5dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5e0:	0f b6 10             	movzbl (%rax),%edx
+ 5e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5e7:	0f b6 00             	movzbl (%rax),%eax
+ 5ea:	38 c2                	cmp    %al,%dl
+ 5ec:	74 d9                	je     5c7 <strcmp+0xe>
+  return (uchar)*p - (uchar)*q;
+ 5ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 5f2:	0f b6 00             	movzbl (%rax),%eax
+ 5f5:	0f b6 d0             	movzbl %al,%edx
+ 5f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 5fc:	0f b6 00             	movzbl (%rax),%eax
+ 5ff:	0f b6 c0             	movzbl %al,%eax
+ 602:	29 c2                	sub    %eax,%edx
+ 604:	89 d0                	mov    %edx,%eax
+}
+ 606:	5d                   	pop    %rbp
+ 607:	c3                   	ret
+
+0000000000000608 <strlen>:
+{
+ 608:	55                   	push   %rbp
+ 609:	48 89 e5             	mov    %rsp,%rbp
+ 60c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  for(n = 0; s[n]; n++)
+ 610:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 617:	eb 04                	jmp    61d <strlen+0x15>
+ 619:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ 61d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 620:	48 63 d0             	movslq %eax,%rdx
+ 623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 627:	48 01 d0             	add    %rdx,%rax
+ 62a:	0f b6 00             	movzbl (%rax),%eax
+ 62d:	84 c0                	test   %al,%al
+ 62f:	75 e8                	jne    619 <strlen+0x11>
+  return n;
+ 631:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 634:	5d                   	pop    %rbp
+ 635:	c3                   	ret
+
+0000000000000636 <memset>:
+{
+ 636:	55                   	push   %rbp
+ 637:	48 89 e5             	mov    %rsp,%rbp
+ 63a:	48 83 ec 10          	sub    $0x10,%rsp
+ 63e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 642:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ 645:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  stosb(dst, c, n);
+ 648:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ 64b:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ 64e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 652:	89 ce                	mov    %ecx,%esi
+ 654:	48 89 c7             	mov    %rax,%rdi
+ 657:	e8 ec fe ff ff       	call   548 <stosb>
+  return dst;
+ 65c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ 660:	c9                   	leave
+ 661:	c3                   	ret
+
+0000000000000662 <strchr>:
+{
+ 662:	55                   	push   %rbp
+ 663:	48 89 e5             	mov    %rsp,%rbp
+ 666:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ 66a:	89 f0                	mov    %esi,%eax
+ 66c:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for(; *s; s++)
+ 66f:	eb 17                	jmp    688 <strchr+0x26>
+    if(*s == c)
+ 671:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 675:	0f b6 00             	movzbl (%rax),%eax
+ 678:	38 45 f4             	cmp    %al,-0xc(%rbp)
+ 67b:	75 06                	jne    683 <strchr+0x21>
+      return (char*)s;
+ 67d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 681:	eb 15                	jmp    698 <strchr+0x36>
+  for(; *s; s++)
+ 683:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ 688:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 68c:	0f b6 00             	movzbl (%rax),%eax
+ 68f:	84 c0                	test   %al,%al
+ 691:	75 de                	jne    671 <strchr+0xf>
+  return 0;
+ 693:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 698:	5d                   	pop    %rbp
+ 699:	c3                   	ret
+
+000000000000069a <gets>:
+gets(char *buf, int max)
+{
+ 69a:	55                   	push   %rbp
+ 69b:	48 89 e5             	mov    %rsp,%rbp
+ 69e:	48 83 ec 20          	sub    $0x20,%rsp
+ 6a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 6a6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 6a9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ 6b0:	eb 48                	jmp    6fa <gets+0x60>
+    cc = read(0, &c, 1);
+ 6b2:	48 8d 45 f7          	lea    -0x9(%rbp),%rax
+ 6b6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 6bb:	48 89 c6             	mov    %rax,%rsi
+ 6be:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6c3:	e8 6f 01 00 00       	call   837 <read>
+ 6c8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(cc < 1)
+ 6cb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ 6cf:	7e 36                	jle    707 <gets+0x6d>
+      break;
+    buf[i++] = c;
+ 6d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6d4:	8d 50 01             	lea    0x1(%rax),%edx
+ 6d7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ 6da:	48 63 d0             	movslq %eax,%rdx
+ 6dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 6e1:	48 01 c2             	add    %rax,%rdx
+ 6e4:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6e8:	88 02                	mov    %al,(%rdx)
+    if(c == '\n' || c == '\r')
+ 6ea:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6ee:	3c 0a                	cmp    $0xa,%al
+ 6f0:	74 16                	je     708 <gets+0x6e>
+ 6f2:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+ 6f6:	3c 0d                	cmp    $0xd,%al
+ 6f8:	74 0e                	je     708 <gets+0x6e>
+  for(i=0; i+1 < max; ){
+ 6fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 6fd:	83 c0 01             	add    $0x1,%eax
+ 700:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+ 703:	7f ad                	jg     6b2 <gets+0x18>
+ 705:	eb 01                	jmp    708 <gets+0x6e>
+      break;
+ 707:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 708:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 70b:	48 63 d0             	movslq %eax,%rdx
+ 70e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 712:	48 01 d0             	add    %rdx,%rax
+ 715:	c6 00 00             	movb   $0x0,(%rax)
+  return buf;
+ 718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ 71c:	c9                   	leave
+ 71d:	c3                   	ret
+
+000000000000071e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 71e:	55                   	push   %rbp
+ 71f:	48 89 e5             	mov    %rsp,%rbp
+ 722:	48 83 ec 20          	sub    $0x20,%rsp
+ 726:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 72a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 72e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 732:	be 00 00 00 00       	mov    $0x0,%esi
+ 737:	48 89 c7             	mov    %rax,%rdi
+ 73a:	e8 20 01 00 00       	call   85f <open>
+ 73f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(fd < 0)
+ 742:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ 746:	79 07                	jns    74f <stat+0x31>
+    return -1;
+ 748:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 74d:	eb 21                	jmp    770 <stat+0x52>
+  r = fstat(fd, st);
+ 74f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ 753:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 756:	48 89 d6             	mov    %rdx,%rsi
+ 759:	89 c7                	mov    %eax,%edi
+ 75b:	e8 17 01 00 00       	call   877 <fstat>
+ 760:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+ 763:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ 766:	89 c7                	mov    %eax,%edi
+ 768:	e8 da 00 00 00       	call   847 <close>
+  return r;
+ 76d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ 770:	c9                   	leave
+ 771:	c3                   	ret
+
+0000000000000772 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 772:	55                   	push   %rbp
+ 773:	48 89 e5             	mov    %rsp,%rbp
+ 776:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  n = 0;
+ 77a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 781:	eb 28                	jmp    7ab <atoi+0x39>
+    n = n*10 + *s++ - '0';
+ 783:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ 786:	89 d0                	mov    %edx,%eax
+ 788:	c1 e0 02             	shl    $0x2,%eax
+ 78b:	01 d0                	add    %edx,%eax
+ 78d:	01 c0                	add    %eax,%eax
+ 78f:	89 c1                	mov    %eax,%ecx
+ 791:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 795:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ 799:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ 79d:	0f b6 00             	movzbl (%rax),%eax
+ 7a0:	0f be c0             	movsbl %al,%eax
+ 7a3:	01 c8                	add    %ecx,%eax
+ 7a5:	83 e8 30             	sub    $0x30,%eax
+ 7a8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while('0' <= *s && *s <= '9')
+ 7ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7af:	0f b6 00             	movzbl (%rax),%eax
+ 7b2:	3c 2f                	cmp    $0x2f,%al
+ 7b4:	7e 0b                	jle    7c1 <atoi+0x4f>
+ 7b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7ba:	0f b6 00             	movzbl (%rax),%eax
+ 7bd:	3c 39                	cmp    $0x39,%al
+ 7bf:	7e c2                	jle    783 <atoi+0x11>
+  return n;
+ 7c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ 7c4:	5d                   	pop    %rbp
+ 7c5:	c3                   	ret
+
+00000000000007c6 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 7c6:	55                   	push   %rbp
+ 7c7:	48 89 e5             	mov    %rsp,%rbp
+ 7ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ 7ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ 7d2:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *dst, *src;
+
+  dst = vdst;
+ 7d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 7d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  src = vsrc;
+ 7dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ 7e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0)
+ 7e5:	eb 1d                	jmp    804 <memmove+0x3e>
+    *dst++ = *src++;
+ 7e7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ 7eb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ 7ef:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ 7f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 7f7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ 7fb:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+ 7ff:	0f b6 12             	movzbl (%rdx),%edx
+ 802:	88 10                	mov    %dl,(%rax)
+  while(n-- > 0)
+ 804:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ 807:	8d 50 ff             	lea    -0x1(%rax),%edx
+ 80a:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ 80d:	85 c0                	test   %eax,%eax
+ 80f:	7f d6                	jg     7e7 <memmove+0x21>
+  return vdst;
+ 811:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 815:	5d                   	pop    %rbp
+ 816:	c3                   	ret
+
+0000000000000817 <fork>:
+    je 1f; \
+    movl %eax, %eax; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 817:	b8 01 00 00 00       	mov    $0x1,%eax
+ 81c:	cd 40                	int    $0x40
+ 81e:	c3                   	ret
+
+000000000000081f <exit>:
+SYSCALL(exit)
+ 81f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 824:	cd 40                	int    $0x40
+ 826:	c3                   	ret
+
+0000000000000827 <wait>:
+SYSCALL(wait)
+ 827:	b8 03 00 00 00       	mov    $0x3,%eax
+ 82c:	cd 40                	int    $0x40
+ 82e:	c3                   	ret
+
+000000000000082f <pipe>:
+SYSCALL(pipe)
+ 82f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 834:	cd 40                	int    $0x40
+ 836:	c3                   	ret
+
+0000000000000837 <read>:
+SYSCALL(read)
+ 837:	b8 05 00 00 00       	mov    $0x5,%eax
+ 83c:	cd 40                	int    $0x40
+ 83e:	c3                   	ret
+
+000000000000083f <write>:
+SYSCALL(write)
+ 83f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 844:	cd 40                	int    $0x40
+ 846:	c3                   	ret
+
+0000000000000847 <close>:
+SYSCALL(close)
+ 847:	b8 15 00 00 00       	mov    $0x15,%eax
+ 84c:	cd 40                	int    $0x40
+ 84e:	c3                   	ret
+
+000000000000084f <kill>:
+SYSCALL(kill)
+ 84f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 854:	cd 40                	int    $0x40
+ 856:	c3                   	ret
+
+0000000000000857 <exec>:
+SYSCALL(exec)
+ 857:	b8 07 00 00 00       	mov    $0x7,%eax
+ 85c:	cd 40                	int    $0x40
+ 85e:	c3                   	ret
+
+000000000000085f <open>:
+SYSCALL(open)
+ 85f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 864:	cd 40                	int    $0x40
+ 866:	c3                   	ret
+
+0000000000000867 <mknod>:
+SYSCALL(mknod)
+ 867:	b8 11 00 00 00       	mov    $0x11,%eax
+ 86c:	cd 40                	int    $0x40
+ 86e:	c3                   	ret
+
+000000000000086f <unlink>:
+SYSCALL(unlink)
+ 86f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 874:	cd 40                	int    $0x40
+ 876:	c3                   	ret
+
+0000000000000877 <fstat>:
+SYSCALL(fstat)
+ 877:	b8 08 00 00 00       	mov    $0x8,%eax
+ 87c:	cd 40                	int    $0x40
+ 87e:	c3                   	ret
+
+000000000000087f <link>:
+SYSCALL(link)
+ 87f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 884:	cd 40                	int    $0x40
+ 886:	c3                   	ret
+
+0000000000000887 <mkdir>:
+SYSCALL(mkdir)
+ 887:	b8 14 00 00 00       	mov    $0x14,%eax
+ 88c:	cd 40                	int    $0x40
+ 88e:	c3                   	ret
+
+000000000000088f <chdir>:
+SYSCALL(chdir)
+ 88f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 894:	cd 40                	int    $0x40
+ 896:	c3                   	ret
+
+0000000000000897 <dup>:
+SYSCALL(dup)
+ 897:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 89c:	cd 40                	int    $0x40
+ 89e:	c3                   	ret
+
+000000000000089f <getpid>:
+SYSCALL(getpid)
+ 89f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8a4:	cd 40                	int    $0x40
+ 8a6:	c3                   	ret
+
+00000000000008a7 <sbrk>:
+SYSCALL(sbrk)
+ 8a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8ac:	cd 40                	int    $0x40
+ 8ae:	c3                   	ret
+
+00000000000008af <sleep>:
+SYSCALL(sleep)
+ 8af:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8b4:	cd 40                	int    $0x40
+ 8b6:	c3                   	ret
+
+00000000000008b7 <uptime>:
+SYSCALL(uptime)
+ 8b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8bc:	cd 40                	int    $0x40
+ 8be:	c3                   	ret
+
+00000000000008bf <sysinfo>:
+SYSCALL(sysinfo)
+ 8bf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8c4:	cd 40                	int    $0x40
+ 8c6:	c3                   	ret
+
+00000000000008c7 <mmap>:
+SYSCALL(mmap)
+ 8c7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8cc:	cd 40                	int    $0x40
+ 8ce:	c3                   	ret
+
+00000000000008cf <munmap>:
+SYSCALL(munmap)
+ 8cf:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8d4:	cd 40                	int    $0x40
+ 8d6:	c3                   	ret
+
+00000000000008d7 <crashn>:
+SYSCALL(crashn)
+ 8d7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8dc:	cd 40                	int    $0x40
+ 8de:	c3                   	ret
+
+00000000000008df <mmap2>:
+SYSCALL_ADDR(mmap2)
+ 8df:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8e4:	cd 40                	int    $0x40
+ 8e6:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e9:	74 02                	je     8ed <mmap2+0xe>
+ 8eb:	89 c0                	mov    %eax,%eax
+ 8ed:	c3                   	ret
+
+00000000000008ee <munmap2>:
+SYSCALL(munmap2)
+ 8ee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8f3:	cd 40                	int    $0x40
+ 8f5:	c3                   	ret
+
+00000000000008f6 <msync>:
+SYSCALL(msync)
+ 8f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8fb:	cd 40                	int    $0x40
+ 8fd:	c3                   	ret
+
+00000000000008fe <sendfile>:
+SYSCALL(sendfile)
+ 8fe:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 903:	cd 40                	int    $0x40
+ 905:	c3                   	ret
+
+0000000000000906 <splice>:
+SYSCALL(splice)
+ 906:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 90b:	cd 40                	int    $0x40
+ 90d:	c3                   	ret
+
+000000000000090e <pread>:
+SYSCALL(pread)
+ 90e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 913:	cd 40                	int    $0x40
+ 915:	c3                   	ret
+
+0000000000000916 <pwrite>:
+SYSCALL(pwrite)
+ 916:	b8 20 00 00 00       	mov    $0x20,%eax
+ 91b:	cd 40                	int    $0x40
+ 91d:	c3                   	ret
+
+000000000000091e <readv>:
+SYSCALL(readv)
+ 91e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 923:	cd 40                	int    $0x40
+ 925:	c3                   	ret
+
+0000000000000926 <writev>:
+SYSCALL(writev)
+ 926:	b8 22 00 00 00       	mov    $0x22,%eax
+ 92b:	cd 40                	int    $0x40
+ 92d:	c3                   	ret
+
+000000000000092e <poll>:
+SYSCALL(poll)
+ 92e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 933:	cd 40                	int    $0x40
+ 935:	c3                   	ret
+
+0000000000000936 <pipe2>:
+SYSCALL(pipe2)
+ 936:	b8 24 00 00 00       	mov    $0x24,%eax
+ 93b:	cd 40                	int    $0x40
+ 93d:	c3                   	ret
+
+000000000000093e <free>:
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
+void
+free(void *ap)
+{
+ 93e:	55                   	push   %rbp
+ 93f:	48 89 e5             	mov    %rsp,%rbp
+ 942:	48 83 ec 20          	sub    $0x20,%rsp
+ 946:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 94a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ 94e:	48 83 e8 10          	sub    $0x10,%rax
+ 952:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(bp->s.ptr == &bigblock){
+ 956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 95a:	48 8b 10             	mov    (%rax),%rdx
+ 95d:	48 8d 05 3c 06 00 00 	lea    0x63c(%rip),%rax        # fa0 <bigblock>
+ 964:	48 39 c2             	cmp    %rax,%rdx
+ 967:	75 1f                	jne    988 <free+0x4a>
+    munmap2(bp, bp->s.size * sizeof(Header));
+ 969:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 96d:	8b 40 08             	mov    0x8(%rax),%eax
+ 970:	c1 e0 04             	shl    $0x4,%eax
+ 973:	89 c2                	mov    %eax,%edx
+ 975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 979:	89 d6                	mov    %edx,%esi
+ 97b:	48 89 c7             	mov    %rax,%rdi
+ 97e:	e8 6b ff ff ff       	call   8ee <munmap2>
+    return;
+ 983:	e9 0b 01 00 00       	jmp    a93 <free+0x155>
+  }
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 988:	48 8b 05 01 06 00 00 	mov    0x601(%rip),%rax        # f90 <freep>
+ 98f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 993:	eb 2f                	jmp    9c4 <free+0x86>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 995:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 999:	48 8b 00             	mov    (%rax),%rax
+ 99c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9a0:	72 17                	jb     9b9 <free+0x7b>
+ 9a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9a6:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9aa:	72 2f                	jb     9db <free+0x9d>
+ 9ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9b0:	48 8b 00             	mov    (%rax),%rax
+ 9b3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9b7:	72 22                	jb     9db <free+0x9d>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9bd:	48 8b 00             	mov    (%rax),%rax
+ 9c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ 9c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9c8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ 9cc:	73 c7                	jae    995 <free+0x57>
+ 9ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9d2:	48 8b 00             	mov    (%rax),%rax
+ 9d5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ 9d9:	73 ba                	jae    995 <free+0x57>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9df:	8b 40 08             	mov    0x8(%rax),%eax
+ 9e2:	89 c0                	mov    %eax,%eax
+ 9e4:	48 c1 e0 04          	shl    $0x4,%rax
+ 9e8:	48 89 c2             	mov    %rax,%rdx
+ 9eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ 9ef:	48 01 c2             	add    %rax,%rdx
+ 9f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ 9f6:	48 8b 00             	mov    (%rax),%rax
+ 9f9:	48 39 c2             	cmp    %rax,%rdx
+ 9fc:	75 2d                	jne    a2b <free+0xed>
+    bp->s.size += p->s.ptr->s.size;
+ 9fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a02:	8b 50 08             	mov    0x8(%rax),%edx
+ a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a09:	48 8b 00             	mov    (%rax),%rax
+ a0c:	8b 40 08             	mov    0x8(%rax),%eax
+ a0f:	01 c2                	add    %eax,%edx
+ a11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a15:	89 50 08             	mov    %edx,0x8(%rax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a1c:	48 8b 00             	mov    (%rax),%rax
+ a1f:	48 8b 10             	mov    (%rax),%rdx
+ a22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a26:	48 89 10             	mov    %rdx,(%rax)
+ a29:	eb 0e                	jmp    a39 <free+0xfb>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a2f:	48 8b 10             	mov    (%rax),%rdx
+ a32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a36:	48 89 10             	mov    %rdx,(%rax)
+  if(p + p->s.size == bp){
+ a39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a3d:	8b 40 08             	mov    0x8(%rax),%eax
+ a40:	89 c0                	mov    %eax,%eax
+ a42:	48 c1 e0 04          	shl    $0x4,%rax
+ a46:	48 89 c2             	mov    %rax,%rdx
+ a49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a4d:	48 01 d0             	add    %rdx,%rax
+ a50:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ a54:	75 27                	jne    a7d <free+0x13f>
+    p->s.size += bp->s.size;
+ a56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a5a:	8b 50 08             	mov    0x8(%rax),%edx
+ a5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a61:	8b 40 08             	mov    0x8(%rax),%eax
+ a64:	01 c2                	add    %eax,%edx
+ a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a6a:	89 50 08             	mov    %edx,0x8(%rax)
+    p->s.ptr = bp->s.ptr;
+ a6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ a71:	48 8b 10             	mov    (%rax),%rdx
+ a74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a78:	48 89 10             	mov    %rdx,(%rax)
+ a7b:	eb 0b                	jmp    a88 <free+0x14a>
+  } else
+    p->s.ptr = bp;
+ a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a81:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ a85:	48 89 10             	mov    %rdx,(%rax)
+  freep = p;
+ a88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ a8c:	48 89 05 fd 04 00 00 	mov    %rax,0x4fd(%rip)        # f90 <freep>
+}
+ a93:	c9                   	leave
+ a94:	c3                   	ret
+
+0000000000000a95 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a95:	55                   	push   %rbp
+ a96:	48 89 e5             	mov    %rsp,%rbp
+ a99:	48 83 ec 20          	sub    $0x20,%rsp
+ a9d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ aa0:	81 7d ec ff 0f 00 00 	cmpl   $0xfff,-0x14(%rbp)
+ aa7:	77 07                	ja     ab0 <morecore+0x1b>
+    nu = 4096;
+ aa9:	c7 45 ec 00 10 00 00 	movl   $0x1000,-0x14(%rbp)
+  p = sbrk(nu * sizeof(Header));
+ ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ ab3:	c1 e0 04             	shl    $0x4,%eax
+ ab6:	89 c7                	mov    %eax,%edi
+ ab8:	e8 ea fd ff ff       	call   8a7 <sbrk>
+ abd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(p == (char*)-1)
+ ac1:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ ac6:	75 07                	jne    acf <morecore+0x3a>
+    return 0;
+ ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+ acd:	eb 29                	jmp    af8 <morecore+0x63>
+  hp = (Header*)p;
+ acf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ ad3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  hp->s.size = nu;
+ ad7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ adb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ ade:	89 50 08             	mov    %edx,0x8(%rax)
+  free((void*)(hp + 1));
+ ae1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ae5:	48 83 c0 10          	add    $0x10,%rax
+ ae9:	48 89 c7             	mov    %rax,%rdi
+ aec:	e8 4d fe ff ff       	call   93e <free>
+  return freep;
+ af1:	48 8b 05 98 04 00 00 	mov    0x498(%rip),%rax        # f90 <freep>
+}
+ af8:	c9                   	leave
+ af9:	c3                   	ret
+
+0000000000000afa <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ afa:	55                   	push   %rbp
+ afb:	48 89 e5             	mov    %rsp,%rbp
+ afe:	48 83 ec 30          	sub    $0x30,%rsp
+ b02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ b08:	48 83 c0 0f          	add    $0xf,%rax
+ b0c:	48 c1 e8 04          	shr    $0x4,%rax
+ b10:	83 c0 01             	add    $0x1,%eax
+ b13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if(nbytes >= BIGBLOCK){
+ b16:	81 7d dc ff ff 00 00 	cmpl   $0xffff,-0x24(%rbp)
+ b1d:	76 62                	jbe    b81 <malloc+0x87>
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+ b1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ b22:	c1 e0 04             	shl    $0x4,%eax
+ b25:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+ b2b:	41 b8 ff ff ff ff    	mov    $0xffffffff,%r8d
+ b31:	b9 22 00 00 00       	mov    $0x22,%ecx
+ b36:	ba 03 00 00 00       	mov    $0x3,%edx
+ b3b:	89 c6                	mov    %eax,%esi
+ b3d:	bf 00 00 00 00       	mov    $0x0,%edi
+ b42:	e8 98 fd ff ff       	call   8df <mmap2>
+ b47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+ b4b:	48 83 7d f8 ff       	cmpq   $0xffffffffffffffff,-0x8(%rbp)
+ b50:	75 0a                	jne    b5c <malloc+0x62>
+      return 0;
+ b52:	b8 00 00 00 00       	mov    $0x0,%eax
+ b57:	e9 1c 01 00 00       	jmp    c78 <malloc+0x17e>
+    p->s.ptr = &bigblock;
+ b5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b60:	48 8d 15 39 04 00 00 	lea    0x439(%rip),%rdx        # fa0 <bigblock>
+ b67:	48 89 10             	mov    %rdx,(%rax)
+    p->s.size = nunits;
+ b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b6e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ b71:	89 50 08             	mov    %edx,0x8(%rax)
+    return (void*)(p + 1);
+ b74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ b78:	48 83 c0 10          	add    $0x10,%rax
+ b7c:	e9 f7 00 00 00       	jmp    c78 <malloc+0x17e>
+  }
+  if((prevp = freep) == 0){
+ b81:	48 8b 05 08 04 00 00 	mov    0x408(%rip),%rax        # f90 <freep>
+ b88:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b8c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ b91:	75 2e                	jne    bc1 <malloc+0xc7>
+    base.s.ptr = freep = prevp = &base;
+ b93:	48 8d 05 e6 03 00 00 	lea    0x3e6(%rip),%rax        # f80 <base>
+ b9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ b9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ ba2:	48 89 05 e7 03 00 00 	mov    %rax,0x3e7(%rip)        # f90 <freep>
+ ba9:	48 8b 05 e0 03 00 00 	mov    0x3e0(%rip),%rax        # f90 <freep>
+ bb0:	48 89 05 c9 03 00 00 	mov    %rax,0x3c9(%rip)        # f80 <base>
+    base.s.size = 0;
+ bb7:	c7 05 c7 03 00 00 00 	movl   $0x0,0x3c7(%rip)        # f88 <base+0x8>
+ bbe:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bc5:	48 8b 00             	mov    (%rax),%rax
+ bc8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ bcc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bd0:	8b 40 08             	mov    0x8(%rax),%eax
+ bd3:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+ bd6:	72 5f                	jb     c37 <malloc+0x13d>
+      if(p->s.size == nunits)
+ bd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bdc:	8b 40 08             	mov    0x8(%rax),%eax
+ bdf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ be2:	75 10                	jne    bf4 <malloc+0xfa>
+        prevp->s.ptr = p->s.ptr;
+ be4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ be8:	48 8b 10             	mov    (%rax),%rdx
+ beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ bef:	48 89 10             	mov    %rdx,(%rax)
+ bf2:	eb 2e                	jmp    c22 <malloc+0x128>
+      else {
+        p->s.size -= nunits;
+ bf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ bf8:	8b 40 08             	mov    0x8(%rax),%eax
+ bfb:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ bfe:	89 c2                	mov    %eax,%edx
+ c00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c04:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ c07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c0b:	8b 40 08             	mov    0x8(%rax),%eax
+ c0e:	89 c0                	mov    %eax,%eax
+ c10:	48 c1 e0 04          	shl    $0x4,%rax
+ c14:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+        p->s.size = nunits;
+ c18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c1c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ c1f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      freep = prevp;
+ c22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ c26:	48 89 05 63 03 00 00 	mov    %rax,0x363(%rip)        # f90 <freep>
+      return (void*)(p + 1);
+ c2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c31:	48 83 c0 10          	add    $0x10,%rax
+ c35:	eb 41                	jmp    c78 <malloc+0x17e>
+    }
+    if(p == freep)
+ c37:	48 8b 05 52 03 00 00 	mov    0x352(%rip),%rax        # f90 <freep>
+ c3e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ c42:	75 1c                	jne    c60 <malloc+0x166>
+      if((p = morecore(nunits)) == 0)
+ c44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ c47:	89 c7                	mov    %eax,%edi
+ c49:	e8 47 fe ff ff       	call   a95 <morecore>
+ c4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ c52:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ c57:	75 07                	jne    c60 <malloc+0x166>
+        return 0;
+ c59:	b8 00 00 00 00       	mov    $0x0,%eax
+ c5e:	eb 18                	jmp    c78 <malloc+0x17e>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c64:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ c68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ c6c:	48 8b 00             	mov    (%rax),%rax
+ c6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(p->s.size >= nunits){
+ c73:	e9 54 ff ff ff       	jmp    bcc <malloc+0xd2>
+  }
+}
+ c78:	c9                   	leave
+ c79:	c3                   	ret
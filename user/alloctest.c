@@ -0,0 +1,220 @@
+#include <param.h>
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <mman.h>
+#include <sysinfo.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define NPAGES 300
+#define NCHILD 4
+#define SLACK  4  // pages the kernel may keep between two measurements
+
+int stdout = 1;
+struct pollfd pfds[MAXOFILE];
+
+// Pages that are neither free nor in use can only have leaked.
+int
+pagestotal(void)
+{
+  struct sys_info info;
+
+  sysinfo(&info);
+  return info.pages_in_use + info.free_pages;
+}
+
+int
+pagesinuse(void)
+{
+  struct sys_info info;
+
+  sysinfo(&info);
+  return info.pages_in_use;
+}
+
+// Grow the heap by n pages, check they come zeroed, then dirty them.
+char*
+grow(int n, int fill)
+{
+  char *p;
+  int i;
+
+  if((p = sbrk(n * PGSIZE)) == (char*)-1)
+    error("sbrk of %d pages failed", n);
+  for(i = 0; i < n * PGSIZE; i += sizeof(int))
+    if(*(int*)(p + i) != 0)
+      error("byte %d of new memory is not zero", i);
+  memset(p, fill, n * PGSIZE);
+  return p;
+}
+
+// Pages freed and allocated again, many times over, all come back:
+// nothing is lost in the per-CPU caches or the buddy lists, and every
+// page handed out is zero, whether it came from the pre-zeroed pool or
+// not.
+void
+pagetest(void)
+{
+  int i, before, total;
+
+  printf(stdout, "pagetest\n");
+  total = pagestotal();
+  grow(NPAGES, 0xff);
+  sbrk(-NPAGES * PGSIZE);
+  before = pagesinuse();
+  for(i = 0; i < 20; i++){
+    grow(NPAGES, 0xff - i);
+    sbrk(-NPAGES * PGSIZE);
+  }
+  if(pagesinuse() > before + SLACK)
+    error("%d pages in use, %d before", pagesinuse(), before);
+  if(pagestotal() != total)
+    error("%d pages free or in use, %d before", pagestotal(), total);
+  printf(stdout, "pagetest OK\n");
+}
+
+// Processes on every CPU allocate and free at once, each with data of
+// its own that must not change under it.
+void
+concurrenttest(void)
+{
+  int i, j, k, pid, before, total;
+  char *p;
+
+  printf(stdout, "concurrenttest\n");
+  total = pagestotal();
+  before = pagesinuse();
+  for(i = 0; i < NCHILD; i++){
+    if((pid = fork()) < 0)
+      error("fork failed");
+    if(pid == 0){
+      for(j = 0; j < 10; j++){
+        p = grow(NPAGES / NCHILD, 'a' + i);
+        for(k = 0; k < NPAGES / NCHILD * PGSIZE; k += PGSIZE)
+          if(p[k] != 'a' + i)
+            error("child %d lost its data", i);
+        sbrk(-NPAGES / NCHILD * PGSIZE);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  if(pagesinuse() > before + SLACK)
+    error("%d pages in use, %d before", pagesinuse(), before);
+  if(pagestotal() != total)
+    error("%d pages free or in use, %d before", pagestotal(), total);
+  printf(stdout, "concurrenttest OK\n");
+}
+
+// Kernel objects come and go with processes, pipes and files: process
+// structures, kernel stacks, page tables, file structures and pipes.
+// Creating and dropping them many times leaves memory where it was.
+void
+objecttest(void)
+{
+  int i, fds[2], fd, pid, before;
+
+  printf(stdout, "objecttest\n");
+  if((fd = open("alloc1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create alloc1.txt");
+  close(fd);
+
+  before = pagesinuse();
+  for(i = 0; i < 200; i++){
+    if(pipe(fds) < 0)
+      error("pipe failed");
+    if((fd = open("alloc1.txt", O_RDONLY)) < 0)
+      error("unable to open alloc1.txt");
+    pid = fork();
+    if(pid < 0)
+      error("fork failed");
+    if(pid == 0){
+      write(fds[1], "x", 1);
+      exit();
+    }
+    wait();
+    close(fd);
+    close(fds[0]);
+    close(fds[1]);
+  }
+  if(pagesinuse() > before + SLACK)
+    error("%d pages in use, %d before", pagesinuse(), before);
+  unlink("alloc1.txt");
+  printf(stdout, "objecttest OK\n");
+}
+
+// A poll of many entries takes a block of contiguous pages for them,
+// which goes back to the buddy lists each time.
+void
+blocktest(void)
+{
+  int i, before;
+
+  printf(stdout, "blocktest\n");
+  for(i = 0; i < MAXOFILE; i++){
+    pfds[i].fd = -1;
+    pfds[i].events = POLLIN;
+  }
+  before = pagesinuse();
+  for(i = 0; i < 100; i++)
+    if(poll(pfds, MAXOFILE, 0) != 0)
+      error("poll of no files failed");
+  if(pagesinuse() > before + SLACK)
+    error("%d pages in use, %d before", pagesinuse(), before);
+  printf(stdout, "blocktest OK\n");
+}
+
+// Anonymous mappings come zeroed too, also after a fork has shared
+// them copy-on-write.
+void
+zerotest(void)
+{
+  char *p;
+  int i, k, pid;
+
+  printf(stdout, "zerotest\n");
+  for(i = 0; i < 5; i++){
+    p = mmap2(0, 64 * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+      error("mmap2 failed");
+    for(k = 0; k < 64 * PGSIZE; k += 64)
+      if(p[k] != 0)
+        error("byte %d of an anonymous mapping is not zero", k);
+    memset(p, 0x5a, 64 * PGSIZE);
+    if((pid = fork()) < 0)
+      error("fork failed");
+    if(pid == 0){
+      memset(p, 0xa5, 64 * PGSIZE);
+      exit();
+    }
+    wait();
+    if(p[0] != 0x5a || p[64 * PGSIZE - 1] != 0x5a)
+      error("child write reached the parent");
+    if(munmap2(p, 64 * PGSIZE) < 0)
+      error("munmap2 failed");
+  }
+  printf(stdout, "zerotest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  pagetest();
+  concurrenttest();
+  objecttest();
+  blocktest();
+  zerotest();
+  printf(stdout, "alloctest passed!!\n");
+  exit();
+}
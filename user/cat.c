@@ -7,8 +7,19 @@ char buf[512];
 void
 cat(int fd)
 {
-  int n;
+  int n, sent = 0;
 
+  // a regular file goes out straight from the kernel's page cache
+  while((n = sendfile(1, fd, -1, 16 * 4096)) > 0)
+    sent = 1;
+  if(n == 0)
+    return;
+  if(sent){
+    printf(1, "cat: write error\n");
+    exit();
+  }
+
+  // anything else, e.g. a pipe, is copied through buf
   while((n = read(fd, buf, sizeof(buf))) > 0) {
     if (write(1, buf, n) != n) {
       printf(1, "cat: write error\n");
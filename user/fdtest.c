@@ -0,0 +1,163 @@
+#include <param.h>
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <poll.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define NFD    200  // well past NOFILE
+#define NPIPE  40
+
+int stdout = 1;
+int fds[MAXOFILE + 1];
+struct pollfd pfds[MAXOFILE + 1];
+
+// The table grows past NOFILE, handing out the lowest free fd each
+// time, and every fd is a file of its own.
+void
+growtest(void)
+{
+  int fd, i;
+  char c;
+
+  printf(stdout, "growtest\n");
+  if((fd = open("fd1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create fd1.txt");
+  if(write(fd, "0123456789", 10) != 10)
+    error("unable to write fd1.txt");
+  close(fd);
+
+  for(i = 0; i < NFD; i++){
+    if((fds[i] = open("fd1.txt", O_RDONLY)) < 0)
+      error("open %d failed", i);
+    if(i > 0 && fds[i] != fds[i - 1] + 1)
+      error("open %d returned fd %d after %d", i, fds[i], fds[i - 1]);
+  }
+
+  // each open has its own offset
+  for(i = 0; i < NFD; i++){
+    if(read(fds[i], &c, 1) != 1 || c != '0')
+      error("first read of fd %d got %c", fds[i], c);
+  }
+  if(read(fds[NFD - 1], &c, 1) != 1 || c != '1')
+    error("second read of fd %d got %c", fds[NFD - 1], c);
+
+  // the lowest free fd is handed out first
+  close(fds[150]);
+  close(fds[20]);
+  if((fd = open("fd1.txt", O_RDONLY)) != fds[20])
+    error("open returned %d, not the lowest free %d", fd, fds[20]);
+  if((fd = dup(fds[0])) != fds[150])
+    error("dup returned %d, not the lowest free %d", fd, fds[150]);
+
+  // a dup shares the offset of the file it copies
+  if(read(fds[0], &c, 1) != 1 || c != '1' || read(fds[150], &c, 1) != 1 || c != '2')
+    error("dup does not share the file offset");
+  printf(stdout, "growtest OK\n");
+}
+
+// A child gets every fd of its parent, and closing its copies leaves
+// the parent's alone.
+void
+forktest(void)
+{
+  int pid, i;
+  char c;
+
+  printf(stdout, "forktest\n");
+  if((pid = fork()) < 0)
+    error("fork failed");
+  if(pid == 0){
+    if(read(fds[NFD - 1], &c, 1) != 1 || c != '2')
+      error("child read of fd %d got %c", fds[NFD - 1], c);
+    for(i = 0; i < NFD; i++)
+      close(fds[i]);
+    exit();
+  }
+  wait();
+  if(read(fds[NFD - 1], &c, 1) != 1 || c != '3')
+    error("fd %d does not share its offset with the child", fds[NFD - 1]);
+  for(i = 0; i < NFD; i++)
+    if(close(fds[i]) < 0)
+      error("close of fd %d failed", fds[i]);
+  printf(stdout, "forktest OK\n");
+}
+
+// poll watches more than NOFILE files at once.
+void
+polltest(void)
+{
+  int p[NPIPE][2], i, n;
+
+  printf(stdout, "polltest\n");
+  for(i = 0; i < NPIPE; i++){
+    if(pipe(p[i]) < 0)
+      error("pipe %d failed", i);
+    pfds[i].fd = p[i][0];
+    pfds[i].events = POLLIN;
+  }
+  if(write(p[NPIPE - 3][1], "x", 1) != 1)
+    error("write failed");
+  if((n = poll(pfds, NPIPE, 0)) != 1)
+    error("poll returned %d", n);
+  for(i = 0; i < NPIPE; i++)
+    if(pfds[i].revents != (i == NPIPE - 3 ? POLLIN : 0))
+      error("pipe %d has revents %x", i, pfds[i].revents);
+  for(i = 0; i < NPIPE; i++){
+    close(p[i][0]);
+    close(p[i][1]);
+  }
+  printf(stdout, "polltest OK\n");
+}
+
+// A process can have MAXOFILE files open and no more, and they can all
+// be polled in one call.
+void
+limittest(void)
+{
+  int i, n, first;
+
+  printf(stdout, "limittest\n");
+  if((first = open("fd1.txt", O_RDONLY)) < 0)
+    error("unable to open fd1.txt");
+  fds[0] = first;
+  for(n = 1; (fds[n] = dup(first)) >= 0; n++)
+    if(n == MAXOFILE)
+      error("more than MAXOFILE fds open");
+  if(fds[n - 1] != MAXOFILE - 1)
+    error("table filled up at fd %d, not %d", fds[n - 1], MAXOFILE - 1);
+
+  for(i = 0; i < MAXOFILE; i++){
+    pfds[i].fd = i;
+    pfds[i].events = POLLIN;
+  }
+  if((n = poll(pfds, MAXOFILE, 0)) < MAXOFILE - 3)
+    error("poll of %d fds returned %d", MAXOFILE, n);
+  if(poll(pfds, MAXOFILE + 1, 0) != -1)
+    error("poll of more than MAXOFILE fds did not fail");
+
+  for(i = 3; i < MAXOFILE; i++)
+    if(close(i) < 0)
+      error("close of fd %d failed", i);
+  unlink("fd1.txt");
+  printf(stdout, "limittest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  growtest();
+  forktest();
+  polltest();
+  limittest();
+  printf(stdout, "fdtest passed!!\n");
+  exit();
+}
@@ -0,0 +1,198 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fs.h>
+#include <fcntl.h>
+#include <mman.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define NFILES 64
+
+int stdout = 1;
+char buf[3 * BSIZE];
+
+// Check that name holds n bytes, byte i being c + i % 26.
+void
+checkfile(char *name, int n, char c)
+{
+  struct stat st;
+  int fd, i;
+
+  if((fd = open(name, O_RDONLY)) < 0)
+    error("unable to open %s", name);
+  fstat(fd, &st);
+  if(st.size != n)
+    error("%s has %d bytes, not %d", name, st.size, n);
+  memset(buf, 0, sizeof(buf));
+  if(read(fd, buf, sizeof(buf)) != n)
+    error("unable to read the %d bytes of %s", n, name);
+  for(i = 0; i < n; i++)
+    if(buf[i] != c + i % 26)
+      error("byte %d of %s is %d, not %c", i, name, buf[i], c + i % 26);
+  close(fd);
+}
+
+// A file grows a byte at a time through its inline data and out of
+// it into a block, and reads back right at every size on the way.
+void
+growtest(void)
+{
+  int fd, i;
+  char c;
+
+  printf(stdout, "growtest\n");
+  if((fd = open("inline1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create inline1.txt");
+  for(i = 0; i < DINLINESZ + BSIZE + 10; i++){
+    c = 'a' + i % 26;
+    if(write(fd, &c, 1) != 1)
+      error("unable to write byte %d", i);
+    if(i < DINLINESZ + 2 || i % 100 == 0)
+      checkfile("inline1.txt", i + 1, 'a');
+  }
+  close(fd);
+  checkfile("inline1.txt", DINLINESZ + BSIZE + 10, 'a');
+  if(unlink("inline1.txt") < 0)
+    error("unable to unlink inline1.txt");
+  printf(stdout, "growtest OK\n");
+}
+
+// A write that starts inside the inline data and ends past it moves
+// the old bytes out along with the new ones.
+void
+boundarytest(void)
+{
+  int fd, i;
+
+  printf(stdout, "boundarytest\n");
+  if((fd = open("inline2.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create inline2.txt");
+  for(i = 0; i < DINLINESZ; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, DINLINESZ) != DINLINESZ)
+    error("unable to fill the inline data");
+  checkfile("inline2.txt", DINLINESZ, 'a');
+
+  // rewrite the middle of it, still inline
+  if(pwrite(fd, "XY", 2, 10) != 2)
+    error("unable to rewrite inline bytes");
+  buf[10] = 'X';
+  buf[11] = 'Y';
+  if(pread(fd, buf + BSIZE, DINLINESZ, 0) != DINLINESZ)
+    error("unable to read the inline data");
+  for(i = 0; i < DINLINESZ; i++)
+    if(buf[BSIZE + i] != buf[i])
+      error("byte %d of the rewritten inline data is wrong", i);
+  buf[10] = 'a' + 10;
+  buf[11] = 'a' + 11;
+  if(pwrite(fd, buf + 10, 2, 10) != 2)
+    error("unable to restore inline bytes");
+
+  // straddle the end of the inline data
+  for(i = DINLINESZ - 8; i < 2 * BSIZE; i++)
+    buf[i] = 'a' + i % 26;
+  if(pwrite(fd, buf + DINLINESZ - 8, 2 * BSIZE - (DINLINESZ - 8),
+            DINLINESZ - 8) != 2 * BSIZE - (DINLINESZ - 8))
+    error("unable to write past the inline data");
+  close(fd);
+  checkfile("inline2.txt", 2 * BSIZE, 'a');
+  if(unlink("inline2.txt") < 0)
+    error("unable to unlink inline2.txt");
+  printf(stdout, "boundarytest OK\n");
+}
+
+// Many small files of every inline size, each with its own contents.
+void
+manytest(void)
+{
+  char name[16];
+  int fd, i, j;
+
+  printf(stdout, "manytest\n");
+  strcpy(name, "small00");
+  for(i = 0; i < NFILES; i++){
+    name[5] = '0' + i / 10;
+    name[6] = '0' + i % 10;
+    if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+      error("unable to create %s", name);
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+      buf[j] = 'a' + (i + j) % 26;
+    if(write(fd, buf, i % (DINLINESZ + 1)) != i % (DINLINESZ + 1))
+      error("unable to write %s", name);
+    close(fd);
+  }
+  for(i = 0; i < NFILES; i++){
+    name[5] = '0' + i / 10;
+    name[6] = '0' + i % 10;
+    if((fd = open(name, O_RDONLY)) < 0)
+      error("unable to open %s", name);
+    j = read(fd, buf, sizeof(buf));
+    if(j != i % (DINLINESZ + 1))
+      error("%s has %d bytes, not %d", name, j, i % (DINLINESZ + 1));
+    for(j = 0; j < i % (DINLINESZ + 1); j++)
+      if(buf[j] != 'a' + (i + j) % 26)
+        error("byte %d of %s is wrong", j, name);
+    close(fd);
+    if(unlink(name) < 0)
+      error("unable to unlink %s", name);
+  }
+  printf(stdout, "manytest OK\n");
+}
+
+// An inline file is mapped from its inline data, and a store through
+// a shared mapping goes back into it.
+void
+mmaptest(void)
+{
+  char *p;
+  int fd, i;
+
+  printf(stdout, "mmaptest\n");
+  if((fd = open("inline3.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create inline3.txt");
+  for(i = 0; i < DINLINESZ / 2; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, DINLINESZ / 2) != DINLINESZ / 2)
+    error("unable to write inline3.txt");
+
+  p = mmap2(0, PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED)
+    error("mmap2 failed");
+  for(i = 0; i < PGSIZE; i++)
+    if(p[i] != (i < DINLINESZ / 2 ? 'a' + i % 26 : 0))
+      error("byte %d of the mapping is %d", i, p[i]);
+  p[3] = 'Z';
+  if(msync(p, PGSIZE) < 0)
+    error("msync failed");
+  if(munmap2(p, PGSIZE) < 0)
+    error("munmap2 failed");
+  close(fd);
+
+  if((fd = open("inline3.txt", O_RDONLY)) < 0)
+    error("unable to open inline3.txt");
+  if(read(fd, buf, sizeof(buf)) != DINLINESZ / 2 || buf[3] != 'Z' || buf[4] != 'e')
+    error("store through the mapping did not reach the file");
+  close(fd);
+  if(unlink("inline3.txt") < 0)
+    error("unable to unlink inline3.txt");
+  printf(stdout, "mmaptest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  growtest();
+  boundarytest();
+  manytest();
+  mmaptest();
+  printf(stdout, "inlinetest passed!!\n");
+  exit();
+}
@@ -0,0 +1,161 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fs.h>
+#include <fcntl.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define NFILES 300  // well past the inodes mkfs makes room for
+
+int stdout = 1;
+uint inums[NFILES];
+char name[8];
+
+char*
+filename(char c, int i)
+{
+  name[0] = c;
+  name[1] = '0' + i / 100;
+  name[2] = '0' + i / 10 % 10;
+  name[3] = '0' + i % 10;
+  name[4] = 0;
+  return name;
+}
+
+// Create name holding i, returning its inum.
+uint
+create(char *name, int i)
+{
+  struct stat st;
+  int fd;
+
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+    error("unable to create %s", name);
+  if(write(fd, &i, sizeof(i)) != sizeof(i))
+    error("unable to write %s", name);
+  fstat(fd, &st);
+  close(fd);
+  return st.ino;
+}
+
+// Return 1 if name holds just i.
+int
+holds(char *name, int i)
+{
+  int fd, n, v[2];
+
+  if((fd = open(name, O_RDONLY)) < 0)
+    error("unable to open %s", name);
+  n = read(fd, v, sizeof(v));
+  close(fd);
+  return n == sizeof(int) && v[0] == i;
+}
+
+// The inodefile grows to take many new files, each with an inum of
+// its own.
+void
+growtest(void)
+{
+  int i, j;
+
+  printf(stdout, "growtest\n");
+  for(i = 0; i < NFILES; i++){
+    inums[i] = create(filename('i', i), i);
+    for(j = 0; j < i; j++)
+      if(inums[j] == inums[i])
+        error("i%d and i%d share inum %d", j, i, inums[i]);
+  }
+  for(i = 0; i < NFILES; i++)
+    if(!holds(filename('i', i), i))
+      error("i%d does not hold %d", i, i);
+  printf(stdout, "growtest OK\n");
+}
+
+// Inums of unlinked files are taken again, lowest first, by new files
+// that start out empty.
+void
+reusetest(void)
+{
+  struct stat st;
+  uint lowest = ~0, inum;
+  int i, j, fd;
+  char c;
+
+  printf(stdout, "reusetest\n");
+  for(i = 0; i < NFILES; i += 2){
+    if(unlink(filename('i', i)) < 0)
+      error("unable to unlink i%d", i);
+    if(inums[i] < lowest)
+      lowest = inums[i];
+  }
+
+  for(i = 0; i < NFILES; i += 2){
+    if((fd = open(filename('j', i), O_CREATE | O_RDWR)) < 0)
+      error("unable to create j%d", i);
+    if(read(fd, &c, 1) != 0)
+      error("new file j%d has the contents of an old one", i);
+    fstat(fd, &st);
+    close(fd);
+    inum = st.ino;
+    if(i == 0 && inum != lowest)
+      error("first new file got inum %d, not the lowest free %d", inum, lowest);
+    for(j = 0; j < NFILES && inums[j] != inum; j += 2)
+      ;
+    if(j >= NFILES)
+      error("j%d got inum %d, which was not freed", i, inum);
+  }
+
+  // the files left alone are untouched
+  for(i = 1; i < NFILES; i += 2)
+    if(!holds(filename('i', i), i))
+      error("i%d does not hold %d", i, i);
+
+  for(i = 0; i < NFILES; i++)
+    if(unlink(filename(i % 2 ? 'i' : 'j', i)) < 0)
+      error("unable to unlink file %d", i);
+  printf(stdout, "reusetest OK\n");
+}
+
+// An unlinked file that is still open keeps its inum until it is
+// closed.
+void
+opentest(void)
+{
+  uint inum;
+  int fd;
+  int v;
+
+  printf(stdout, "opentest\n");
+  inum = create("open1", 42);
+  if((fd = open("open1", O_RDONLY)) < 0)
+    error("unable to open open1");
+  if(unlink("open1") < 0)
+    error("unable to unlink open1");
+  if(create("open2", 43) == inum)
+    error("open2 took the inum of open1 while it is open");
+  if(read(fd, &v, sizeof(v)) != sizeof(v) || v != 42)
+    error("open1 lost its contents after unlink");
+  close(fd);
+  if(create("open3", 44) != inum)
+    error("inum of open1 was not freed by its last close");
+  if(unlink("open2") < 0 || unlink("open3") < 0)
+    error("unable to unlink");
+  printf(stdout, "opentest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  growtest();
+  reusetest();
+  opentest();
+  printf(stdout, "inodetest passed!!\n");
+  exit();
+}
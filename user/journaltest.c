@@ -0,0 +1,130 @@
+// Crash consistency of the journal.
+//
+// Run journaltest again after every reboot until it reports that it
+// passed. Each run first checks what the crash of the run before left
+// on disk, then rewrites journal.txt and has the machine crash on one
+// more disk write than last time. The count is kept by the disk
+// driver, so the crashes walk through every write the file system
+// issues: data blocks, the log blocks and commit record of each
+// commit, and the installs after it. A crash drops the writes still
+// queued behind the one in progress, so a commit record can reach the
+// disk without the log blocks queued before it. With either
+// journaling mode of the image (make LOGMODE=ordered or LOGMODE=full)
+// a crash must leave the file with some number of whole writes, each
+// with the right data: in ordered mode the data blocks of a write
+// reach disk before the commit that makes the size cover them, a
+// commit torn by the crash must fail its checksum and not be
+// replayed, and one that was committed but not installed must be
+// replayed at boot.
+
+#include <param.h>
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fs.h>
+#include <fcntl.h>
+
+#define error(msg, ...) do { \
+  printf(stdout, "ERROR (line %d): ", __LINE__); \
+  printf(stdout, msg,  ##__VA_ARGS__); \
+  printf(stdout, "\n"); \
+  while(1) {};} while(0)
+
+#define CHUNK   (6 * BSIZE)  // one write, fits in one transaction
+#define NCHUNK  4
+
+char buf[CHUNK];
+int stdout = 1;
+int state;
+
+void
+get_progress(void)
+{
+  int fd;
+
+  if ((fd = open("jprogress.txt", O_RDONLY)) < 0) {
+    // first run
+    state = 1;
+    if ((fd = open("jprogress.txt", O_CREATE | O_RDWR)) < 0)
+      error("unable to create jprogress.txt");
+    write(fd, &state, sizeof(int));
+    close(fd);
+    return;
+  }
+  read(fd, &state, sizeof(int));
+  close(fd);
+
+  if (state > 1000)
+    error("too many steps before operating is complete");
+
+  state++;
+  fd = open("jprogress.txt", O_RDWR);
+  write(fd, &state, sizeof(int));
+  close(fd);
+}
+
+// journal.txt must hold whole chunks, chunk i filled with 'a' + i
+void
+check(void)
+{
+  struct stat st;
+  int fd, i, j;
+
+  if ((fd = open("journal.txt", O_RDONLY)) < 0)
+    return;
+  fstat(fd, &st);
+  if (st.size % CHUNK != 0)
+    error("journal.txt has %d bytes, not whole writes", st.size);
+  if (st.size > NCHUNK * CHUNK)
+    error("journal.txt has %d bytes, more than was written", st.size);
+
+  for (i = 0; i < st.size / CHUNK; i++) {
+    if (read(fd, buf, CHUNK) != CHUNK)
+      error("unable to read chunk %d of journal.txt", i);
+    for (j = 0; j < CHUNK; j++) {
+      if (buf[j] != 'a' + i)
+        error("chunk %d of journal.txt has %d at %d, not %c",
+              i, buf[j], j, 'a' + i);
+    }
+  }
+  close(fd);
+
+  if (st.size == NCHUNK * CHUNK) {
+    printf(stdout, "journal.txt is completely written\n");
+    printf(stdout, "journaltest passed!\n");
+    exit();
+  }
+}
+
+// start over from an empty file, then crash on the disk write after
+// steps more
+void
+crashwrite(int steps)
+{
+  int fd, i;
+
+  unlink("journal.txt");
+  crashn(steps);
+  printf(stdout, "crash after %d steps\n", steps);
+  if ((fd = open("journal.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create journal.txt");
+  for (i = 0; i < NCHUNK; i++) {
+    memset(buf, 'a' + i, CHUNK);
+    if (write(fd, buf, CHUNK) != CHUNK)
+      error("unable to write chunk %d of journal.txt", i);
+  }
+  close(fd);
+  // made it without crashing, nothing more to count
+  crashn(1 << 30);
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(stdout, "journaltest starting\n");
+  check();
+  get_progress();
+  crashwrite(state);
+  check();
+  error("journal.txt is not complete after all writes returned");
+}
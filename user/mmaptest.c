@@ -0,0 +1,249 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <stdarg.h>
+#include <fcntl.h>
+#include <mman.h>
+#include <sysinfo.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define NPAGES 64
+
+int stdout = 1;
+char buf[PGSIZE];
+
+// Create a file of NPAGES pages, page i filled with 'a' + i % 26.
+void
+makefile(char *name)
+{
+  int fd, i;
+
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0)
+    error("unable to create %s", name);
+  for(i = 0; i < NPAGES; i++){
+    memset(buf, 'a' + i % 26, PGSIZE);
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+      error("unable to write page %d of %s", i, name);
+  }
+  close(fd);
+}
+
+void
+lazytest(void)
+{
+  struct sys_info info1, info2;
+  char *p;
+  int fd;
+
+  printf(stdout, "lazytest\n");
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+    error("unable to open mmap1.txt");
+
+  sysinfo(&info1);
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED)
+    error("mmap2 failed");
+  sysinfo(&info2);
+  if(info2.pages_in_use - info1.pages_in_use > 1)
+    error("mapping took %d pages before any was touched",
+          info2.pages_in_use - info1.pages_in_use);
+
+  if(p[0] != 'a' || p[5 * PGSIZE + 7] != 'f' || p[NPAGES * PGSIZE - 1] != 'a' + (NPAGES - 1) % 26)
+    error("mapping does not match the file");
+  if(munmap2(p, NPAGES * PGSIZE) < 0)
+    error("munmap2 failed");
+  close(fd);
+  printf(stdout, "lazytest OK\n");
+}
+
+void
+sharedtest(void)
+{
+  char *p, *q;
+  int fd, pid;
+
+  printf(stdout, "sharedtest\n");
+  if((fd = open("mmap1.txt", O_RDWR)) < 0)
+    error("unable to open mmap1.txt");
+
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  q = mmap2(0, PGSIZE, PROT_READ, MAP_SHARED, fd, 2 * PGSIZE);
+  if(p == MAP_FAILED || q == MAP_FAILED || p == q)
+    error("mmap2 failed");
+
+  // a child writes through its copy of the mapping
+  pid = fork();
+  if(pid < 0)
+    error("fork failed");
+  if(pid == 0){
+    p[2 * PGSIZE] = 'X';
+    exit();
+  }
+  wait();
+
+  // both mappings and read() see the change
+  if(p[2 * PGSIZE] != 'X' || q[0] != 'X')
+    error("change made in the child is not shared");
+  if(msync(p, NPAGES * PGSIZE) < 0)
+    error("msync failed");
+  if(munmap2(p, NPAGES * PGSIZE) < 0 || munmap2(q, PGSIZE) < 0)
+    error("munmap2 failed");
+  close(fd);
+
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+    error("unable to open mmap1.txt");
+  if(read(fd, buf, PGSIZE) != PGSIZE || read(fd, buf, PGSIZE) != PGSIZE ||
+     read(fd, buf, PGSIZE) != PGSIZE)
+    error("unable to read mmap1.txt");
+  if(buf[0] != 'X' || buf[1] != 'c')
+    error("change was not written back, got %c%c", buf[0], buf[1]);
+  close(fd);
+  printf(stdout, "sharedtest OK\n");
+}
+
+void
+privatetest(void)
+{
+  char *p;
+  int fd, pid;
+
+  printf(stdout, "privatetest\n");
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+    error("unable to open mmap1.txt");
+
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED)
+    error("mmap2 failed");
+  p[PGSIZE] = 'Y';
+
+  pid = fork();
+  if(pid < 0)
+    error("fork failed");
+  if(pid == 0){
+    p[PGSIZE] = 'Z';
+    if(p[0] != 'a')
+      error("child sees the wrong data");
+    exit();
+  }
+  wait();
+
+  if(p[PGSIZE] != 'Y')
+    error("private page changed by the child");
+  munmap2(p, NPAGES * PGSIZE);
+
+  // the file itself is unchanged
+  if(read(fd, buf, PGSIZE) != PGSIZE || read(fd, buf, PGSIZE) != PGSIZE)
+    error("unable to read mmap1.txt");
+  if(buf[0] != 'b')
+    error("private change reached the file");
+  close(fd);
+  printf(stdout, "privatetest OK\n");
+}
+
+void
+invalidtest(void)
+{
+  char *p;
+  int fd;
+
+  printf(stdout, "invalidtest\n");
+  if((fd = open("mmap1.txt", O_RDONLY)) < 0)
+    error("unable to open mmap1.txt");
+
+  // shared writable mappings need a file open for writing
+  if(mmap2(0, PGSIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED)
+    error("mapped a read-only file shared and writable");
+  if(mmap2(0, PGSIZE, PROT_READ, MAP_SHARED, fd, 7) != MAP_FAILED)
+    error("mapped at an unaligned offset");
+  if(mmap2(0, 0, PROT_READ, MAP_SHARED, fd, 0) != MAP_FAILED)
+    error("mapped zero bytes");
+
+  // unmapping the middle of a mapping leaves the two ends
+  p = mmap2(0, 3 * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED)
+    error("mmap2 failed");
+  if(munmap2(p + PGSIZE, PGSIZE) < 0)
+    error("munmap2 of the middle page failed");
+  if(p[0] != 'a' || p[2 * PGSIZE + 1] != 'c')
+    error("ends of the mapping are gone");
+  if(msync(p + PGSIZE, PGSIZE) != -1)
+    error("msync of an unmapped range succeeded");
+  munmap2(p, 3 * PGSIZE);
+  close(fd);
+  printf(stdout, "invalidtest OK\n");
+}
+
+void
+anontest(void)
+{
+  struct sys_info info1, info2;
+  char *p, *q;
+  int i, pid;
+
+  printf(stdout, "anontest\n");
+  p = mmap2(0, NPAGES * PGSIZE, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  q = mmap2(0, 2 * PGSIZE, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED || q == MAP_FAILED)
+    error("anonymous mmap2 failed");
+  for(i = 0; i < NPAGES * PGSIZE; i += PGSIZE / 4)
+    if(p[i] != 0)
+      error("anonymous memory is not zeroed");
+  p[0] = 'p';
+
+  // the child shares q, and gets its own copy of p
+  pid = fork();
+  if(pid < 0)
+    error("fork failed");
+  if(pid == 0){
+    p[0] = 'c';
+    q[PGSIZE] = 'c';
+    exit();
+  }
+  wait();
+  if(p[0] != 'p' || q[PGSIZE] != 'c')
+    error("anonymous mappings were not copied/shared across fork");
+
+  // unmapping gives the pages back
+  sysinfo(&info1);
+  if(munmap2(p, NPAGES * PGSIZE) < 0 || munmap2(q, 2 * PGSIZE) < 0)
+    error("munmap2 failed");
+  sysinfo(&info2);
+  if(info1.pages_in_use - info2.pages_in_use < NPAGES)
+    error("only %d pages freed", info1.pages_in_use - info2.pages_in_use);
+
+  // so does free for big blocks
+  p = malloc(NPAGES * PGSIZE);
+  memset(p, 1, NPAGES * PGSIZE);
+  sysinfo(&info1);
+  free(p);
+  sysinfo(&info2);
+  if(info1.pages_in_use - info2.pages_in_use < NPAGES)
+    error("free kept %d pages", NPAGES - (info1.pages_in_use - info2.pages_in_use));
+  printf(stdout, "anontest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  makefile("mmap1.txt");
+  lazytest();
+  sharedtest();
+  privatetest();
+  invalidtest();
+  anontest();
+  unlink("mmap1.txt");
+
+  printf(stdout, "mmaptest passed!\n");
+  exit();
+  return 0;
+}
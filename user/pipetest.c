@@ -0,0 +1,194 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <mman.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define TOTAL  (100 * 1024)
+
+int stdout = 1;
+char buf[3 * PGSIZE];
+
+// Byte k of a stream written to a pipe.
+#define STREAM(k) ((char)((k) % 251))
+
+// Write TOTAL bytes of the stream to fd in writes of many sizes, some
+// of them smaller than a page and some spanning several.
+void
+writestream(int fd)
+{
+  static int sizes[] = { 1, 7, 512, PGSIZE, PGSIZE + 904, 3 * PGSIZE };
+  int k, i, n;
+
+  for(k = i = 0; k < TOTAL; k += n, i++){
+    n = sizes[i % 6];
+    if(n > TOTAL - k)
+      n = TOTAL - k;
+    for(int j = 0; j < n; j++)
+      buf[j] = STREAM(k + j);
+    if(write(fd, buf, n) != n)
+      error("write of %d bytes at %d failed", n, k);
+  }
+}
+
+// Read the stream back from fd in reads of other sizes, then expect
+// the end of the pipe.
+void
+readstream(int fd)
+{
+  static int sizes[] = { 3, PGSIZE, 100, 2 * PGSIZE + 17 };
+  int k, i, n;
+
+  for(k = i = 0; k < TOTAL; k += n, i++){
+    n = read(fd, buf, sizes[i % 4]);
+    if(n <= 0 || k + n > TOTAL)
+      error("read at %d returned %d", k, n);
+    for(int j = 0; j < n; j++)
+      if(buf[j] != STREAM(k + j))
+        error("byte %d of the stream is %d, not %d", k + j, buf[j], STREAM(k + j));
+  }
+  if((n = read(fd, buf, 1)) != 0)
+    error("read past the end of the stream returned %d", n);
+}
+
+// A stream much larger than the pipe goes through intact, with the
+// writer blocking whenever the ring of pages is full.
+void
+ringtest(void)
+{
+  int fds[2], pid;
+
+  printf(stdout, "ringtest\n");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if((pid = fork()) < 0)
+    error("fork failed");
+  if(pid == 0){
+    close(fds[0]);
+    writestream(fds[1]);
+    exit();
+  }
+  close(fds[1]);
+  readstream(fds[0]);
+  close(fds[0]);
+  wait();
+  printf(stdout, "ringtest OK\n");
+}
+
+// A single write bigger than the pipe returns only once all of it is
+// in, while a slow reader takes it out.
+void
+blockingtest(void)
+{
+  int fds[2], pid, n, total;
+  char *big;
+
+  printf(stdout, "blockingtest\n");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if((pid = fork()) < 0)
+    error("fork failed");
+  if(pid == 0){
+    close(fds[1]);
+    for(total = 0; (n = read(fds[0], buf, PGSIZE)) > 0; total += n)
+      sleep(1);
+    if(total != 20 * PGSIZE)
+      error("reader got %d bytes, not %d", total, 20 * PGSIZE);
+    exit();
+  }
+  close(fds[0]);
+  big = malloc(20 * PGSIZE);
+  memset(big, 'x', 20 * PGSIZE);
+  if((n = write(fds[1], big, 20 * PGSIZE)) != 20 * PGSIZE)
+    error("write returned %d, not %d", n, 20 * PGSIZE);
+  free(big);
+  close(fds[1]);
+  wait();
+  printf(stdout, "blockingtest OK\n");
+}
+
+// Reads into and writes from memory that is not mapped in yet take a
+// page fault in the middle of the copy.
+void
+faulttest(void)
+{
+  int fds[2], fd, i;
+  char *src, *dst;
+
+  printf(stdout, "faulttest\n");
+  if((fd = open("pipe1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create pipe1.txt");
+  for(i = 0; i < 2; i++){
+    memset(buf, 'p' + i, PGSIZE);
+    if(write(fd, buf, PGSIZE) != PGSIZE)
+      error("unable to write pipe1.txt");
+  }
+
+  src = mmap2(0, 2 * PGSIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  dst = mmap2(0, 2 * PGSIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(src == MAP_FAILED || dst == MAP_FAILED)
+    error("mmap2 failed");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if(write(fds[1], src, 2 * PGSIZE) != 2 * PGSIZE)
+    error("write from an untouched file mapping failed");
+  if(read(fds[0], dst, 2 * PGSIZE) != 2 * PGSIZE)
+    error("read into an untouched anonymous mapping failed");
+  for(i = 0; i < 2 * PGSIZE; i++)
+    if(dst[i] != 'p' + i / PGSIZE)
+      error("byte %d is %d", i, dst[i]);
+  close(fds[0]);
+  close(fds[1]);
+  if(munmap2(src, 2 * PGSIZE) < 0 || munmap2(dst, 2 * PGSIZE) < 0)
+    error("munmap2 failed");
+  close(fd);
+  unlink("pipe1.txt");
+  printf(stdout, "faulttest OK\n");
+}
+
+// Closing one end shows at the other.
+void
+closetest(void)
+{
+  int fds[2], n;
+
+  printf(stdout, "closetest\n");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if(write(fds[1], "hello", 5) != 5)
+    error("write failed");
+  close(fds[1]);
+  if((n = read(fds[0], buf, sizeof(buf))) != 5)
+    error("read of what is left returned %d", n);
+  if((n = read(fds[0], buf, sizeof(buf))) != 0)
+    error("read of a closed pipe returned %d", n);
+  close(fds[0]);
+
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  close(fds[0]);
+  if((n = write(fds[1], "hello", 5)) != -1)
+    error("write to a pipe nobody reads returned %d", n);
+  close(fds[1]);
+  printf(stdout, "closetest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  ringtest();
+  blockingtest();
+  faulttest();
+  closetest();
+  printf(stdout, "pipetest passed!!\n");
+  exit();
+}
@@ -0,0 +1,200 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <error.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+
+int stdout = 1;
+char buf[PGSIZE];
+
+// Poll the one file fd for events without waiting, returning its
+// revents.
+int
+pollone(int fd, int events)
+{
+  struct pollfd pfd;
+  int n;
+
+  pfd.fd = fd;
+  pfd.events = events;
+  pfd.revents = -1;
+  if((n = poll(&pfd, 1, 0)) != (pfd.revents != 0))
+    error("poll returned %d with revents %x", n, pfd.revents);
+  return pfd.revents;
+}
+
+// An empty pipe can be written but not read, one with data can be
+// read too.
+void
+readytest(void)
+{
+  int fds[2];
+
+  printf(stdout, "readytest\n");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if(pollone(fds[0], POLLIN) != 0)
+    error("empty pipe is ready to read");
+  if(pollone(fds[1], POLLOUT) != POLLOUT)
+    error("empty pipe is not ready to write");
+  if(write(fds[1], "x", 1) != 1)
+    error("write failed");
+  if(pollone(fds[0], POLLIN) != POLLIN)
+    error("pipe with data is not ready to read");
+  if(read(fds[0], buf, 1) != 1)
+    error("read failed");
+  if(pollone(fds[0], POLLIN) != 0)
+    error("drained pipe is ready to read");
+  close(fds[0]);
+  close(fds[1]);
+  printf(stdout, "readytest OK\n");
+}
+
+// With O_NONBLOCK, reading an empty pipe and writing a full one fail
+// with E_AGAIN instead of waiting, and poll agrees with them about
+// when a write can go in.
+void
+nonblocktest(void)
+{
+  int fds[2], n, total;
+
+  printf(stdout, "nonblocktest\n");
+  if(pipe2(fds, O_NONBLOCK) < 0)
+    error("pipe2 failed");
+  if((n = read(fds[0], buf, 1)) != -E_AGAIN)
+    error("read of an empty pipe returned %d", n);
+
+  memset(buf, 'n', PGSIZE);
+  for(total = 0; (n = write(fds[1], buf, PGSIZE)) > 0; total += n)
+    if(total > 1024 * PGSIZE)
+      error("pipe never filled up");
+  if(n != -E_AGAIN)
+    error("write to a full pipe returned %d", n);
+  if(pollone(fds[1], POLLOUT) != 0)
+    error("full pipe is ready to write");
+
+  // the page at the tail is not free until it is drained
+  if(read(fds[0], buf, 100) != 100)
+    error("read failed");
+  if(pollone(fds[1], POLLOUT) != 0)
+    error("pipe is ready to write with every page still taken");
+  if(read(fds[0], buf, PGSIZE - 100) != PGSIZE - 100)
+    error("read failed");
+  if(pollone(fds[1], POLLOUT) != POLLOUT)
+    error("pipe with a free page is not ready to write");
+  if((n = write(fds[1], buf, PGSIZE)) != PGSIZE)
+    error("write into the free page returned %d", n);
+
+  // the rest is still there, and then the end
+  close(fds[1]);
+  while((n = read(fds[0], buf, PGSIZE)) > 0)
+    ;
+  if(n != 0)
+    error("read of a drained and closed pipe returned %d", n);
+  close(fds[0]);
+  printf(stdout, "nonblocktest OK\n");
+}
+
+// Closing one end of a pipe shows at the other.
+void
+hanguptest(void)
+{
+  int fds[2];
+
+  printf(stdout, "hanguptest\n");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  close(fds[1]);
+  if(pollone(fds[0], POLLIN) != POLLHUP)
+    error("closed write end does not show as POLLHUP");
+  close(fds[0]);
+
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  close(fds[0]);
+  if(pollone(fds[1], POLLOUT) != POLLERR)
+    error("closed read end does not show as POLLERR");
+  close(fds[1]);
+  printf(stdout, "hanguptest OK\n");
+}
+
+// An fd that is not open is POLLNVAL, a negative one is skipped.
+void
+nvaltest(void)
+{
+  struct pollfd pfds[2];
+
+  printf(stdout, "nvaltest\n");
+  pfds[0].fd = 100;
+  pfds[0].events = POLLIN;
+  pfds[1].fd = -1;
+  pfds[1].events = POLLIN;
+  if(poll(pfds, 2, 0) != 1)
+    error("poll did not count the closed fd");
+  if(pfds[0].revents != POLLNVAL || pfds[1].revents != 0)
+    error("revents are %x and %x", pfds[0].revents, pfds[1].revents);
+  printf(stdout, "nvaltest OK\n");
+}
+
+// poll sleeps until one of several pipes has data, or its timeout.
+void
+waittest(void)
+{
+  struct pollfd pfds[2];
+  int a[2], b[2], pid, start, n;
+
+  printf(stdout, "waittest\n");
+  if(pipe(a) < 0 || pipe(b) < 0)
+    error("pipe failed");
+  pfds[0].fd = a[0];
+  pfds[0].events = POLLIN;
+  pfds[1].fd = b[0];
+  pfds[1].events = POLLIN;
+
+  start = uptime();
+  if((n = poll(pfds, 2, 10)) != 0)
+    error("poll of empty pipes returned %d", n);
+  if(uptime() - start < 10)
+    error("poll returned before its timeout");
+
+  if((pid = fork()) < 0)
+    error("fork failed");
+  if(pid == 0){
+    sleep(5);
+    write(b[1], "b", 1);
+    exit();
+  }
+  if((n = poll(pfds, 2, -1)) != 1)
+    error("poll returned %d", n);
+  if(pfds[0].revents != 0 || pfds[1].revents != POLLIN)
+    error("revents are %x and %x", pfds[0].revents, pfds[1].revents);
+  wait();
+  close(a[0]);
+  close(a[1]);
+  close(b[0]);
+  close(b[1]);
+  printf(stdout, "waittest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  readytest();
+  nonblocktest();
+  hanguptest();
+  nvaltest();
+  waittest();
+  printf(stdout, "polltest passed!!\n");
+  exit();
+}
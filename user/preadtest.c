@@ -0,0 +1,178 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <uio.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define FILESZ  8192
+#define NREADER 4
+
+int stdout = 1;
+char buf[FILESZ];
+
+// Byte k of pread1.txt.
+#define BYTE(k) ((char)('A' + (k) % 53))
+
+void
+makefile(void)
+{
+  int fd, k;
+
+  if((fd = open("pread1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create pread1.txt");
+  for(k = 0; k < FILESZ; k++)
+    buf[k] = BYTE(k);
+  if(write(fd, buf, FILESZ) != FILESZ)
+    error("unable to write pread1.txt");
+  close(fd);
+}
+
+// pread and pwrite work at the offset given and leave the file offset
+// alone.
+void
+offsettest(void)
+{
+  int fd, n, fds[2];
+  char c;
+
+  printf(stdout, "offsettest\n");
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+    error("unable to open pread1.txt");
+  if(read(fd, buf, 10) != 10)
+    error("unable to read pread1.txt");
+
+  if((n = pread(fd, buf, 100, 5000)) != 100)
+    error("pread returned %d", n);
+  for(n = 0; n < 100; n++)
+    if(buf[n] != BYTE(5000 + n))
+      error("byte %d of the pread is wrong", n);
+  if((n = pread(fd, buf, 100, FILESZ - 30)) != 30)
+    error("pread across the end of the file returned %d", n);
+  if((n = pread(fd, buf, 100, FILESZ)) != 0)
+    error("pread at the end of the file returned %d", n);
+
+  if(pwrite(fd, "#", 1, 3000) != 1)
+    error("pwrite failed");
+  if(pread(fd, &c, 1, 3000) != 1 || c != '#')
+    error("pwrite did not reach the file");
+  c = BYTE(3000);
+  if(pwrite(fd, &c, 1, 3000) != 1)
+    error("pwrite failed");
+
+  // the file offset is still where read left it
+  if(read(fd, &c, 1) != 1 || c != BYTE(10))
+    error("pread or pwrite moved the file offset");
+
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if(pread(fds[0], buf, 1, 0) != -1 || pwrite(fds[1], "x", 1, 0) != -1)
+    error("pread or pwrite on a pipe did not fail");
+  close(fds[0]);
+  close(fds[1]);
+  close(fd);
+  printf(stdout, "offsettest OK\n");
+}
+
+// readv and writev go through their buffers in order.
+void
+vectortest(void)
+{
+  struct iovec iov[IOV_MAX + 1];
+  char a[10], b[1], c[300];
+  int fd, n, i;
+
+  printf(stdout, "vectortest\n");
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+    error("unable to open pread1.txt");
+  iov[0].iov_base = a;
+  iov[0].iov_len = sizeof(a);
+  iov[1].iov_base = b;
+  iov[1].iov_len = 0;
+  iov[2].iov_base = b;
+  iov[2].iov_len = sizeof(b);
+  iov[3].iov_base = c;
+  iov[3].iov_len = sizeof(c);
+  if((n = readv(fd, iov, 4)) != 311)
+    error("readv returned %d", n);
+  for(i = 0; i < 10; i++)
+    if(a[i] != BYTE(i))
+      error("byte %d of the first buffer is wrong", i);
+  if(b[0] != BYTE(10))
+    error("the one byte buffer is wrong");
+  for(i = 0; i < 300; i++)
+    if(c[i] != BYTE(11 + i))
+      error("byte %d of the last buffer is wrong", i);
+
+  // write the same bytes back where they came from
+  close(fd);
+  if((fd = open("pread1.txt", O_RDWR)) < 0)
+    error("unable to open pread1.txt");
+  if((n = writev(fd, iov, 4)) != 311)
+    error("writev returned %d", n);
+  if(pread(fd, buf, 400, 0) != 400)
+    error("unable to read pread1.txt");
+  for(i = 0; i < 400; i++)
+    if(buf[i] != BYTE(i))
+      error("byte %d after writev is wrong", i);
+
+  for(i = 0; i <= IOV_MAX; i++){
+    iov[i].iov_base = a;
+    iov[i].iov_len = 1;
+  }
+  if(readv(fd, iov, IOV_MAX + 1) != -1)
+    error("readv of more than IOV_MAX buffers did not fail");
+  close(fd);
+  printf(stdout, "vectortest OK\n");
+}
+
+// Processes sharing one open file read all of it with pread at the
+// same time, as an inode is read under a shared lock.
+void
+concurrenttest(void)
+{
+  int fd, i, j, k, off, pid;
+
+  printf(stdout, "concurrenttest\n");
+  if((fd = open("pread1.txt", O_RDONLY)) < 0)
+    error("unable to open pread1.txt");
+  for(i = 0; i < NREADER; i++){
+    pid = fork();
+    if(pid < 0)
+      error("fork failed");
+    if(pid == 0){
+      for(j = 0; j < 200; j++){
+        off = (j * 997 + i * 131) % (FILESZ - 512);
+        if(pread(fd, buf, 512, off) != 512)
+          error("reader %d: pread at %d failed", i, off);
+        for(k = 0; k < 512; k++)
+          if(buf[k] != BYTE(off + k))
+            error("reader %d: byte %d is wrong", i, off + k);
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < NREADER; i++)
+    wait();
+  close(fd);
+  printf(stdout, "concurrenttest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  makefile();
+  offsettest();
+  vectortest();
+  concurrenttest();
+  unlink("pread1.txt");
+  printf(stdout, "preadtest passed!!\n");
+  exit();
+}
@@ -0,0 +1,210 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define FILESZ (3 * PGSIZE + 100)
+
+int stdout = 1;
+char buf[FILESZ];
+
+// Byte k of splice1.txt.
+#define BYTE(k) ((char)('a' + (k) / 7 % 26))
+
+void
+makefile(void)
+{
+  int fd, k;
+
+  if((fd = open("splice1.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create splice1.txt");
+  for(k = 0; k < FILESZ; k++)
+    buf[k] = BYTE(k);
+  if(write(fd, buf, FILESZ) != FILESZ)
+    error("unable to write splice1.txt");
+  close(fd);
+}
+
+// Read n bytes out of the pipe fd and check they are the file's bytes
+// from off on.
+void
+checkpipe(int fd, int off, int n)
+{
+  int got, r, k;
+
+  for(got = 0; got < n; got += r)
+    if((r = read(fd, buf + got, n - got)) <= 0)
+      error("read of the pipe returned %d after %d bytes", r, got);
+  for(k = 0; k < n; k++)
+    if(buf[k] != BYTE(off + k))
+      error("byte %d is %c, not %c", off + k, buf[k], BYTE(off + k));
+}
+
+// sendfile puts a file's pages in a pipe, from a given offset or from
+// the file offset, which it then advances.
+void
+sendfiletest(void)
+{
+  int fds[2], fd, n;
+
+  printf(stdout, "sendfiletest\n");
+  if((fd = open("splice1.txt", O_RDONLY)) < 0)
+    error("unable to open splice1.txt");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+
+  // all of it from offset 0, starting at a page boundary
+  if((n = sendfile(fds[1], fd, 0, FILESZ)) != FILESZ)
+    error("sendfile of the whole file returned %d", n);
+  checkpipe(fds[0], 0, FILESZ);
+
+  // a range that does not start or end on a page boundary
+  if((n = sendfile(fds[1], fd, PGSIZE - 10, PGSIZE + 20)) != PGSIZE + 20)
+    error("sendfile of a range returned %d", n);
+  checkpipe(fds[0], PGSIZE - 10, PGSIZE + 20);
+
+  // from the file offset, up to the end of the file
+  if(read(fd, buf, 50) != 50)
+    error("unable to read splice1.txt");
+  if((n = sendfile(fds[1], fd, -1, FILESZ)) != FILESZ - 50)
+    error("sendfile from the file offset returned %d", n);
+  checkpipe(fds[0], 50, FILESZ - 50);
+  if((n = sendfile(fds[1], fd, -1, 10)) != 0)
+    error("sendfile at the end of the file returned %d", n);
+
+  close(fds[0]);
+  close(fds[1]);
+  close(fd);
+  printf(stdout, "sendfiletest OK\n");
+}
+
+// splice moves data between a pipe and a file at the file offset.
+void
+splicetest(void)
+{
+  struct stat st;
+  int fds[2], in, out, n, r, w;
+
+  printf(stdout, "splicetest\n");
+  if((in = open("splice1.txt", O_RDONLY)) < 0)
+    error("unable to open splice1.txt");
+  if((out = open("splice2.txt", O_CREATE | O_RDWR)) < 0)
+    error("unable to create splice2.txt");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+
+  // file to pipe to file, in pieces of a page and a bit
+  for(n = 0; n < FILESZ; ){
+    r = splice(in, fds[1], PGSIZE + 300);
+    if(r <= 0)
+      error("splice of the file into the pipe returned %d", r);
+    while(r > 0){
+      w = splice(fds[0], out, r);
+      if(w <= 0)
+        error("splice of the pipe into the file returned %d", w);
+      r -= w;
+      n += w;
+    }
+  }
+  fstat(out, &st);
+  if(st.size != FILESZ)
+    error("splice2.txt has %d bytes, not %d", st.size, FILESZ);
+  close(out);
+
+  if((out = open("splice2.txt", O_RDONLY)) < 0)
+    error("unable to open splice2.txt");
+  if(read(out, buf, FILESZ) != FILESZ)
+    error("unable to read splice2.txt");
+  for(n = 0; n < FILESZ; n++)
+    if(buf[n] != BYTE(n))
+      error("byte %d of splice2.txt is wrong", n);
+
+  // one end has to be a pipe, and only one
+  if(splice(in, out, 10) != -1)
+    error("splice between two files did not fail");
+  if(splice(fds[0], fds[1], 10) != -1)
+    error("splice between two pipes did not fail");
+
+  close(fds[0]);
+  close(fds[1]);
+  close(in);
+  close(out);
+  unlink("splice2.txt");
+  printf(stdout, "splicetest OK\n");
+}
+
+// A pipe holds the file's own pages, not a copy of them: a write to
+// the file before the pipe is read shows in what comes out of it.
+void
+sharetest(void)
+{
+  int fds[2], fd, n;
+
+  printf(stdout, "sharetest\n");
+  if((fd = open("splice1.txt", O_RDWR)) < 0)
+    error("unable to open splice1.txt");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if((n = sendfile(fds[1], fd, 0, PGSIZE)) != PGSIZE)
+    error("sendfile returned %d", n);
+  if(pwrite(fd, "XYZ", 3, 100) != 3)
+    error("pwrite failed");
+  if(read(fds[0], buf, PGSIZE) != PGSIZE)
+    error("read of the pipe failed");
+  if(buf[99] != BYTE(99) || buf[100] != 'X' || buf[102] != 'Z' ||
+     buf[103] != BYTE(103))
+    error("the pipe does not have the write to the file");
+
+  // put the file back as it was
+  for(n = 0; n < 3; n++)
+    buf[n] = BYTE(100 + n);
+  if(pwrite(fd, buf, 3, 100) != 3)
+    error("pwrite failed");
+  close(fds[0]);
+  close(fds[1]);
+  close(fd);
+  printf(stdout, "sharetest OK\n");
+}
+
+// Pages a pipe got from a file stay valid after the file is closed
+// and unlinked.
+void
+unlinktest(void)
+{
+  int fds[2], fd, n;
+
+  printf(stdout, "unlinktest\n");
+  if((fd = open("splice1.txt", O_RDWR)) < 0)
+    error("unable to open splice1.txt");
+  if(pipe(fds) < 0)
+    error("pipe failed");
+  if((n = sendfile(fds[1], fd, 0, PGSIZE)) != PGSIZE)
+    error("sendfile returned %d", n);
+  close(fd);
+  unlink("splice1.txt");
+  checkpipe(fds[0], 0, PGSIZE);
+  close(fds[0]);
+  close(fds[1]);
+  printf(stdout, "unlinktest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  makefile();
+  sendfiletest();
+  splicetest();
+  sharetest();
+  unlinktest();
+  printf(stdout, "splicetest passed!!\n");
+  exit();
+}
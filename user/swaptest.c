@@ -0,0 +1,183 @@
+#include <cdefs.h>
+#include <stat.h>
+#include <user.h>
+#include <fcntl.h>
+#include <sysinfo.h>
+
+#define error(msg, ...) \
+  do { \
+    printf(stdout, "ERROR (line %d): ", __LINE__); \
+    printf(stdout, msg,  ##__VA_ARGS__); \
+    printf(stdout, "\n"); \
+    while(1) {} \
+  } while (0)
+
+#define PGSIZE 4096
+#define NPAGES 5000  // more than the machine's 16MB
+#define NSHARE 2500
+#define NCHILD 3
+
+int stdout = 1;
+
+// Fill page i of a test: even pages repeat a short pattern, which the
+// compressed pool takes, odd pages are noise that has to go to disk.
+void
+fillpage(uint *p, int i, int seed)
+{
+  uint x = i * 2654435761U + seed;
+
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+    if(i % 2 == 0){
+      p[k] = (k % 16 == 0) ? i + seed : k % 16;
+    } else {
+      x = x * 1103515245 + 12345;
+      p[k] = x;
+    }
+  }
+}
+
+void
+checkpage(uint *p, int i, int seed)
+{
+  uint x = i * 2654435761U + seed;
+  uint want;
+
+  for(int k = 0; k < PGSIZE / sizeof(uint); k++){
+    if(i % 2 == 0){
+      want = (k % 16 == 0) ? i + seed : k % 16;
+    } else {
+      x = x * 1103515245 + 12345;
+      want = x;
+    }
+    if(p[k] != want)
+      error("page %d word %d is %x, not %x", i, k, p[k], want);
+  }
+}
+
+// A heap larger than memory is swapped out and in, to the compressed
+// pool and to disk, without losing a word, and gives back every swap
+// slot when it is freed.
+void
+pressuretest(void)
+{
+  struct sys_info info1, info2;
+  char *start;
+  int i;
+
+  printf(stdout, "pressuretest\n");
+  sysinfo(&info1);
+  start = sbrk(NPAGES * PGSIZE);
+  if(start == (char*)-1)
+    error("sbrk of %d pages failed", NPAGES);
+  for(i = 0; i < NPAGES; i++)
+    fillpage((uint*)(start + i * PGSIZE), i, 1);
+
+  sysinfo(&info2);
+  if(info2.pages_in_swap == 0)
+    error("%d pages allocated and none in swap", NPAGES);
+  printf(stdout, "%d pages in swap\n", info2.pages_in_swap);
+
+  // in order, which read-ahead helps, then backwards
+  for(i = 0; i < NPAGES; i++)
+    checkpage((uint*)(start + i * PGSIZE), i, 1);
+  for(i = NPAGES - 1; i >= 0; i--)
+    checkpage((uint*)(start + i * PGSIZE), i, 1);
+
+  sbrk(-NPAGES * PGSIZE);
+  sysinfo(&info2);
+  if(info2.pages_in_swap > info1.pages_in_swap)
+    error("%d pages still in swap after the heap is freed, %d before",
+          info2.pages_in_swap, info1.pages_in_swap);
+  printf(stdout, "pressuretest OK\n");
+}
+
+// The reclaim thread keeps some memory free after the pressure is
+// over, so allocations do not have to reclaim it themselves.
+void
+kswapdtest(void)
+{
+  struct sys_info info;
+  char *start;
+  int i;
+
+  printf(stdout, "kswapdtest\n");
+  start = sbrk(NPAGES * PGSIZE);
+  if(start == (char*)-1)
+    error("sbrk of %d pages failed", NPAGES);
+  for(i = 0; i < NPAGES; i++)
+    memset(start + i * PGSIZE, i, PGSIZE);
+  sleep(20);
+  sysinfo(&info);
+  if(info.free_pages < 16)
+    error("only %d pages free with the heap idle", info.free_pages);
+  for(i = 0; i < NPAGES; i++)
+    if(start[i * PGSIZE] != (char)i || start[i * PGSIZE + PGSIZE - 1] != (char)i)
+      error("page %d is wrong", i);
+  sbrk(-NPAGES * PGSIZE);
+  printf(stdout, "kswapdtest OK\n");
+}
+
+// Children share their parent's pages copy-on-write and read them all
+// at once while memory is short, so one child often faults on a swap
+// slot another is reading in. Each page is read from swap once and
+// shared from the swap cache, and every child sees the right data.
+// Then they write to them, which must not reach anyone else.
+void
+sharetest(void)
+{
+  struct sys_info info1, info2;
+  char *start, *own;
+  int i, c, pid;
+
+  printf(stdout, "sharetest\n");
+  sysinfo(&info1);
+  start = sbrk(NSHARE * PGSIZE);
+  if(start == (char*)-1)
+    error("sbrk of %d pages failed", NSHARE);
+  for(i = 0; i < NSHARE; i++)
+    fillpage((uint*)(start + i * PGSIZE), i, 2);
+
+  for(c = 0; c < NCHILD; c++){
+    if((pid = fork()) < 0)
+      error("fork failed");
+    if(pid == 0){
+      // push some of the shared pages out with a heap of our own
+      own = sbrk(NSHARE / 2 * PGSIZE);
+      if(own == (char*)-1)
+        error("child %d: sbrk failed", c);
+      for(i = 0; i < NSHARE / 2; i++)
+        memset(own + i * PGSIZE, c, PGSIZE);
+      for(i = 0; i < NSHARE; i++)
+        checkpage((uint*)(start + i * PGSIZE), i, 2);
+      for(i = c; i < NSHARE; i += NCHILD)
+        fillpage((uint*)(start + i * PGSIZE), i, 3 + c);
+      for(i = 0; i < NSHARE; i++)
+        checkpage((uint*)(start + i * PGSIZE), i, i % NCHILD == c ? 3 + c : 2);
+      for(i = 0; i < NSHARE / 2; i++)
+        if(own[i * PGSIZE] != c)
+          error("child %d: page %d of its own heap is wrong", c, i);
+      exit();
+    }
+  }
+  for(c = 0; c < NCHILD; c++)
+    wait();
+
+  for(i = 0; i < NSHARE; i++)
+    checkpage((uint*)(start + i * PGSIZE), i, 2);
+  sbrk(-NSHARE * PGSIZE);
+  sysinfo(&info2);
+  if(info2.pages_in_swap > info1.pages_in_swap)
+    error("%d pages still in swap after every heap is freed, %d before",
+          info2.pages_in_swap, info1.pages_in_swap);
+  printf(stdout, "sharetest OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  pressuretest();
+  kswapdtest();
+  sharetest();
+  printf(stdout, "swaptest passed!!\n");
+  exit();
+}
@@ -2,6 +2,7 @@
 #include <stat.h>
 #include <user.h>
 #include <param.h>
+#include <mman.h>
 
 // Memory allocator by Kernighan and Ritchie,
 // The C programming Language, 2nd ed.  Section 8.7.
@@ -21,12 +22,22 @@ typedef union header Header;
 static Header base;
 static Header *freep;
 
+// Blocks of at least this many bytes get a mapping of their own, so
+// free can hand them straight back to the kernel. Their header points
+// at bigblock instead of a free list neighbour.
+#define BIGBLOCK (64*1024)
+static Header bigblock;
+
 void
 free(void *ap)
 {
   Header *bp, *p;
 
   bp = (Header*)ap - 1;
+  if(bp->s.ptr == &bigblock){
+    munmap2(bp, bp->s.size * sizeof(Header));
+    return;
+  }
   for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
     if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
       break;
@@ -67,6 +78,15 @@ malloc(uint nbytes)
   uint nunits;
 
   nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  if(nbytes >= BIGBLOCK){
+    p = mmap2(0, nunits * sizeof(Header), PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p == MAP_FAILED)
+      return 0;
+    p->s.ptr = &bigblock;
+    p->s.size = nunits;
+    return (void*)(p + 1);
+  }
   if((prevp = freep) == 0){
     base.s.ptr = freep = prevp = &base;
     base.s.size = 0;